@@ -43,6 +43,17 @@ for f in $sources; do
     # example/imageviewer is unusual in that needs additional libraries.
     echo "Building gen/bin/example-$f"
     $CC -O3 example/$f/*.c -lxcb -lxcb-image -o gen/bin/example-$f
+  elif [ $f = convert-to-nia ] || [ $f = pgif2nia ] || [ $f = pinflate ] || \
+       [ $f = racread ] || [ $f = zcat ]; then
+    # example/convert-to-nia, example/pgif2nia, example/pinflate,
+    # example/racread and example/zcat are unusual in that they need the
+    # pthread library.
+    echo "Building gen/bin/example-$f"
+    $CC -O3 example/$f/*.c -lpthread -o gen/bin/example-$f
+  elif [ $f = jsonptr ]; then
+    # example/jsonptr is unusual in that it needs the pthread library.
+    echo "Building gen/bin/example-$f"
+    $CXX -O3 example/$f/*.cc -lpthread -o gen/bin/example-$f
   elif [ $f = library ]; then
     # example/library is unusual in that it uses separately compiled libraries
     # (built by "wuffs genlib", e.g. by running build-all.sh) instead of
@@ -31,6 +31,11 @@ const (
 	CformatterDefault = "clang-format-5.0"
 	CformatterUsage   = `C formatter`
 
+	CPUDefault = -1
+	CPUMin     = -1
+	CPUMax     = 1023
+	CPUUsage   = `the CPU to pin benchmarks to, or -1 for no pinning`
+
 	FocusDefault = ""
 	FocusUsage   = `comma-separated list of tests or benchmarks (name prefixes) to focus on, e.g. "wuffs_gif_decode"`
 
@@ -45,6 +50,9 @@ const (
 	MimicDefault = false
 	MimicUsage   = `whether to compare Wuffs' output with other libraries' output`
 
+	PerfDefault = false
+	PerfUsage   = `whether to also report hardware performance counters, e.g. cycles/byte`
+
 	RepsDefault = 5
 	RepsMin     = 0
 	RepsMax     = 1000000
@@ -49,6 +49,11 @@ compressed independently. You can specify the target chunk size in terms of
 either its compressed size or decompressed size. By default (if both
 -cchunksize and -dchunksize are zero), a 64KiB -dchunksize is used.
 
+With -dchunksize, chunks are compressed in parallel. The output is the same
+regardless of the -concurrency flag value, which defaults to the number of
+CPUs. Pass -concurrency=1 to compress on a single execution thread. With
+-cchunksize, chunks are always compressed sequentially.
+
 You can also specify a -cpagesize, which is similar to but not exactly the same
 concept as alignment. If non-zero, padding is inserted into the output to
 minimize the number of pages that each chunk occupies. Look for "CPageSize" in
@@ -98,6 +103,8 @@ Encode-Related Flags:
         the chunk size (in CSpace)
     -codec
         the compression codec (default "zstd")
+    -concurrency
+        the number of chunks to compress in parallel; 0 means the number of CPUs
     -cpagesize
         the page size (in CSpace)
     -dchunksize
@@ -50,6 +50,11 @@ compressed independently. You can specify the target chunk size in terms of
 either its compressed size or decompressed size. By default (if both
 -cchunksize and -dchunksize are zero), a 64KiB -dchunksize is used.
 
+With -dchunksize, chunks are compressed in parallel. The output is the same
+regardless of the -concurrency flag value, which defaults to the number of
+CPUs. Pass -concurrency=1 to compress on a single execution thread. With
+-cchunksize, chunks are always compressed sequentially.
+
 You can also specify a -cpagesize, which is similar to but not exactly the same
 concept as alignment. If non-zero, padding is inserted into the output to
 minimize the number of pages that each chunk occupies. Look for "CPageSize" in
@@ -99,6 +104,8 @@ Encode-Related Flags:
         the chunk size (in CSpace)
     -codec
         the compression codec (default "zstd")
+    -concurrency
+        the number of chunks to compress in parallel; 0 means the number of CPUs
     -cpagesize
         the page size (in CSpace)
     -dchunksize
@@ -276,6 +283,8 @@ var (
 
 	// Encode-related flags.
 	codecFlag         = flag.String("codec", "zstd", "the compression codec")
+	concurrencyFlag   = flag.Int("concurrency", 0,
+		"the number of chunks to compress in parallel; 0 means the number of CPUs")
 	cpagesizeFlag     = flag.String("cpagesize", "0", "the page size (in CSpace)")
 	cchunksizeFlag    = flag.String("cchunksize", "0", "the chunk size (in CSpace)")
 	dchunksizeFlag    = flag.String("dchunksize", "0", "the chunk size (in DSpace)")
@@ -505,6 +514,13 @@ func encode(r io.Reader) error {
 		return errors.New("invalid -dchunksize")
 	}
 
+	concurrency := *concurrencyFlag
+	if concurrency < 0 {
+		return errors.New("invalid -concurrency")
+	} else if concurrency == 0 {
+		concurrency = runtime.NumCPU()
+	}
+
 	if (cchunksize != 0) && (dchunksize != 0) {
 		return errors.New("must specify none or one of -cchunksize or -dchunksize")
 	} else if (cchunksize == 0) && (dchunksize == 0) {
@@ -518,6 +534,7 @@ func encode(r io.Reader) error {
 		CPageSize:     uint64(cpagesize),
 		CChunkSize:    uint64(cchunksize),
 		DChunkSize:    uint64(dchunksize),
+		Concurrency:   concurrency,
 	}
 	switch *codecFlag {
 	case "lz4":
@@ -35,9 +35,11 @@ func doTest(args []string) error  { return doBenchTest(args, false) }
 func doBenchTest(args []string, bench bool) error {
 	flags := flag.FlagSet{}
 	ccompilersFlag := flags.String("ccompilers", cf.CcompilersDefault, cf.CcompilersUsage)
+	cpuFlag := flags.Int("cpu", cf.CPUDefault, cf.CPUUsage)
 	focusFlag := flags.String("focus", cf.FocusDefault, cf.FocusUsage)
 	iterscaleFlag := flags.Int("iterscale", cf.IterscaleDefault, cf.IterscaleUsage)
 	mimicFlag := flags.Bool("mimic", cf.MimicDefault, cf.MimicUsage)
+	perfFlag := flags.Bool("perf", cf.PerfDefault, cf.PerfUsage)
 	repsFlag := flags.Int("reps", cf.RepsDefault, cf.RepsUsage)
 
 	if err := flags.Parse(args); err != nil {
@@ -47,6 +49,10 @@ func doBenchTest(args []string, bench bool) error {
 	if !cf.IsAlphaNumericIsh(*ccompilersFlag) {
 		return fmt.Errorf("bad -ccompilers flag value %q", *ccompilersFlag)
 	}
+	if *cpuFlag < cf.CPUMin || cf.CPUMax < *cpuFlag {
+		return fmt.Errorf("bad -cpu flag value %d, outside the range [%d ..= %d]",
+			*cpuFlag, cf.CPUMin, cf.CPUMax)
+	}
 	if !cf.IsAlphaNumericIsh(*focusFlag) {
 		return fmt.Errorf("bad -focus flag value %q", *focusFlag)
 	}
@@ -64,7 +70,7 @@ func doBenchTest(args []string, bench bool) error {
 	failed := false
 	for _, arg := range args {
 		f, err := doBenchTest1(arg, bench,
-			*ccompilersFlag, *focusFlag, *iterscaleFlag, *mimicFlag, *repsFlag)
+			*ccompilersFlag, *cpuFlag, *focusFlag, *iterscaleFlag, *mimicFlag, *perfFlag, *repsFlag)
 		if err != nil {
 			return err
 		}
@@ -80,8 +86,8 @@ func doBenchTest(args []string, bench bool) error {
 	return nil
 }
 
-func doBenchTest1(filename string, bench bool, ccompilers string, focus string,
-	iterscale int, mimic bool, reps int) (failed bool, err error) {
+func doBenchTest1(filename string, bench bool, ccompilers string, cpu int, focus string,
+	iterscale int, mimic bool, perf bool, reps int) (failed bool, err error) {
 
 	workDir, err := ioutil.TempDir("", "wuffs-c")
 	if err != nil {
@@ -124,6 +130,12 @@ func doBenchTest1(filename string, bench bool, ccompilers string, focus string,
 				fmt.Sprintf("-iterscale=%d", iterscale),
 				fmt.Sprintf("-reps=%d", reps),
 			)
+			if cpu >= 0 {
+				outArgs = append(outArgs, fmt.Sprintf("-cpu=%d", cpu))
+			}
+			if perf {
+				outArgs = append(outArgs, "-perf")
+			}
 		}
 		if focus != "" {
 			outArgs = append(outArgs, fmt.Sprintf("-focus=%s", focus))
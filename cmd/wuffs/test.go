@@ -32,10 +32,12 @@ func doBenchTest(wuffsRoot string, args []string, bench bool) error {
 	flags := flag.NewFlagSet("test", flag.ExitOnError)
 	ccompilersFlag := flags.String("ccompilers", cf.CcompilersDefault, cf.CcompilersUsage)
 	cformatterFlag := flags.String("cformatter", cf.CformatterDefault, cf.CformatterUsage)
+	cpuFlag := flags.Int("cpu", cf.CPUDefault, cf.CPUUsage)
 	focusFlag := flags.String("focus", cf.FocusDefault, cf.FocusUsage)
 	iterscaleFlag := flags.Int("iterscale", cf.IterscaleDefault, cf.IterscaleUsage)
 	langsFlag := flags.String("langs", langsDefault, langsUsage)
 	mimicFlag := flags.Bool("mimic", cf.MimicDefault, cf.MimicUsage)
+	perfFlag := flags.Bool("perf", cf.PerfDefault, cf.PerfUsage)
 	repsFlag := flags.Int("reps", cf.RepsDefault, cf.RepsUsage)
 	skipgenFlag := flags.Bool("skipgen", skipgenDefault, skipgenUsage)
 	skipgendepsFlag := flags.Bool("skipgendeps", skipgendepsDefault, skipgendepsUsage)
@@ -54,6 +56,10 @@ func doBenchTest(wuffsRoot string, args []string, bench bool) error {
 	if !cf.IsAlphaNumericIsh(*cformatterFlag) {
 		return fmt.Errorf("bad -cformatter flag value %q", *cformatterFlag)
 	}
+	if *cpuFlag < cf.CPUMin || cf.CPUMax < *cpuFlag {
+		return fmt.Errorf("bad -cpu flag value %d, outside the range [%d ..= %d]",
+			*cpuFlag, cf.CPUMin, cf.CPUMax)
+	}
 	if !cf.IsAlphaNumericIsh(*focusFlag) {
 		return fmt.Errorf("bad -focus flag value %q", *focusFlag)
 	}
@@ -77,6 +83,12 @@ func doBenchTest(wuffsRoot string, args []string, bench bool) error {
 			fmt.Sprintf("-iterscale=%d", *iterscaleFlag),
 			fmt.Sprintf("-reps=%d", *repsFlag),
 		)
+		if *cpuFlag >= 0 {
+			cmdArgs = append(cmdArgs, fmt.Sprintf("-cpu=%d", *cpuFlag))
+		}
+		if *perfFlag {
+			cmdArgs = append(cmdArgs, "-perf")
+		}
 	} else {
 		cmdArgs = append(cmdArgs, "test")
 	}
@@ -16,13 +16,23 @@
 
 /*
 convert-to-nia converts an image from stdin (e.g. in the BMP, GIF, JPEG or PNG
-format) to stdout (in the NIA/NIE format).
+format) to stdout (in the NIA/NIE format). Given file name arguments, it
+instead converts each of those files, using multiple threads. To run:
+
+$CC -O3 convert-to-nia.c -lpthread && \
+  ./a.out < ../../test/data/bricks-dither.bmp > /tmp/bricks-dither.nia; \
+  rm -f a.out
+
+for a C compiler $CC, such as clang or gcc.
 
 See the "const char* g_usage" string below for details.
 */
 
 #include <errno.h>
+#include <fcntl.h>
 #include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
 #include <unistd.h>
 
 // Wuffs ships as a "single file C library" or "header file library" as per
@@ -41,11 +51,16 @@ See the "const char* g_usage" string below for details.
 // modules we use makes that process explicit. Preprocessing means that such
 // code simply isn't compiled.
 #define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
 #define WUFFS_CONFIG__MODULE__BASE
 #define WUFFS_CONFIG__MODULE__BMP
+#define WUFFS_CONFIG__MODULE__CRC32
+#define WUFFS_CONFIG__MODULE__DEFLATE
 #define WUFFS_CONFIG__MODULE__GIF
 #define WUFFS_CONFIG__MODULE__LZW
+#define WUFFS_CONFIG__MODULE__PNG
 #define WUFFS_CONFIG__MODULE__WBMP
+#define WUFFS_CONFIG__MODULE__ZLIB
 
 // If building this program in an environment that doesn't easily accommodate
 // relative includes, you can use the script/inline-c-relative-includes.go
@@ -72,10 +87,13 @@ See the "const char* g_usage" string below for details.
 
 static const char* g_usage =
     "Usage: convert-to-nia -flags < src.img > dst.nia\n"
+    "       convert-to-nia -flags src0.img src1.img ...\n"
     "\n"
     "Flags:\n"
     "    -1      -first-frame-only\n"
     "            -fail-if-unsandboxed\n"
+    "            -j=NUM_THREADS\n"
+    "            -output-directory=DIR\n"
     "\n"
     "convert-to-nia converts an image from stdin (e.g. in the BMP, GIF, JPEG\n"
     "or PNG format) to stdout (in the NIA format, or in the NIE format if\n"
@@ -84,9 +102,17 @@ static const char* g_usage =
     "NIA/NIE is a trivial animated/still image file format, specified at\n"
     "https://github.com/google/wuffs/blob/master/doc/spec/nie-spec.md\n"
     "\n"
+    "Given file name arguments, it runs in batch mode, converting each\n"
+    "src.img file to a src.img.nia (or src.img.nie) file, using -j worker\n"
+    "threads (the default is the number of online processors). With\n"
+    "-output-directory, the output files are written to that directory\n"
+    "instead of alongside the input files. Failures are reported per file\n"
+    "and do not stop the other conversions. Failed outputs are removed.\n"
+    "\n"
     "The -fail-if-unsandboxed flag causes the program to exit if it does not\n"
     "self-impose a sandbox. On Linux, it self-imposes a SECCOMP_MODE_STRICT\n"
-    "sandbox, regardless of whether this flag was set.";
+    "sandbox, regardless of whether this flag was set. Batch mode, which\n"
+    "opens files and starts threads, is never sandboxed.";
 
 // ----
 
@@ -96,27 +122,11 @@ static const char* g_usage =
 
 bool g_sandboxed = false;
 
-wuffs_base__pixel_buffer g_pixbuf = {0};
-wuffs_base__slice_u8 g_pixbuf_slice = {0};
-wuffs_base__slice_u8 g_pixbuf_backup_slice = {0};
-wuffs_base__io_buffer g_src = {0};
-wuffs_base__slice_u8 g_workbuf_slice = {0};
-
-wuffs_base__image_config g_image_config = {0};
-wuffs_base__frame_config g_frame_config = {0};
-uint32_t g_width = 0;
-uint32_t g_height = 0;
-
-wuffs_base__image_decoder* g_image_decoder = NULL;
-union {
-  wuffs_bmp__decoder bmp;
-  wuffs_gif__decoder gif;
-  wuffs_wbmp__decoder wbmp;
-} g_potential_decoders;
-
 // ----
 
 #define BYTES_PER_PIXEL 4
+#define MAX_NUM_THREADS 256
+#define NIX_HEADER_SIZE 16
 
 #ifndef MAX_DIMENSION
 #define MAX_DIMENSION 65535
@@ -126,26 +136,82 @@ union {
 #define SRC_BUFFER_ARRAY_SIZE (64 * 1024)
 #endif
 
+// The dst buffer coalesces the NIA/NIE headers, footers and (small) frames
+// into fewer, larger write calls. When streaming a NIE image in bands of rows,
+// each band is also decoded directly into it.
+#ifndef DST_BUFFER_ARRAY_SIZE
+#define DST_BUFFER_ARRAY_SIZE (1024 * 1024)
+#endif
+
+// The PNG decoder's work buffer holds the whole (filtered) image, so its size
+// is comparable to the pixel buffer's.
 #ifndef WORKBUF_ARRAY_SIZE
-#define WORKBUF_ARRAY_SIZE (1024 * 1024)
+#define WORKBUF_ARRAY_SIZE (256 * 1024 * 1024)
 #endif
 
 #ifndef PIXBUF_ARRAY_SIZE
 #define PIXBUF_ARRAY_SIZE (256 * 1024 * 1024)
 #endif
 
+// These arrays back the stdin-to-stdout converter. It runs under a sandbox
+// that disallows allocating memory, so its buffers are statically sized.
 uint8_t g_src_buffer_array[SRC_BUFFER_ARRAY_SIZE] = {0};
+uint8_t g_dst_buffer_array[DST_BUFFER_ARRAY_SIZE] = {0};
 uint8_t g_workbuf_array[WORKBUF_ARRAY_SIZE] = {0};
 uint8_t g_pixbuf_array[PIXBUF_ARRAY_SIZE] = {0};
 
 // ----
 
+// converter holds the state for converting one image at a time. There is one
+// converter for the stdin-to-stdout mode and one per batch mode worker thread,
+// re-used for each of that thread's files.
+typedef struct {
+  int src_fd;
+  int dst_fd;
+  wuffs_base__io_buffer src;
+  wuffs_base__io_buffer dst;
+
+  // A growable converter (in batch mode) heap-allocates these arrays, on
+  // demand, up to the WORKBUF_ARRAY_SIZE and PIXBUF_ARRAY_SIZE limits. A fixed
+  // one uses the g_etc_array globals, and its pixel backup buffer is carved
+  // from the end of the pixbuf_array.
+  bool growable;
+  wuffs_base__slice_u8 workbuf_array;
+  wuffs_base__slice_u8 pixbuf_array;
+  wuffs_base__slice_u8 backup_array;
+
+  wuffs_base__pixel_buffer pixbuf;
+  wuffs_base__slice_u8 pixbuf_slice;
+  wuffs_base__slice_u8 pixbuf_backup_slice;
+  wuffs_base__slice_u8 workbuf_slice;
+
+  wuffs_base__image_config image_config;
+  wuffs_base__frame_config frame_config;
+  uint32_t width;
+  uint32_t height;
+
+  wuffs_base__image_decoder* image_decoder;
+  bool image_decoder_supports_bands;
+  union {
+    wuffs_bmp__decoder bmp;
+    wuffs_gif__decoder gif;
+    wuffs_png__decoder png;
+    wuffs_wbmp__decoder wbmp;
+  } potential_decoders;
+} converter;
+
+converter g_converter = {0};
+
+// ----
+
 struct {
   int remaining_argc;
   char** remaining_argv;
 
   bool fail_if_unsandboxed;
   bool first_frame_only;
+  uint32_t num_threads;
+  const char* output_directory;
 } g_flags = {0};
 
 const char*  //
@@ -178,6 +244,19 @@ parse_flags(int argc, char** argv) {
       g_flags.first_frame_only = true;
       continue;
     }
+    if (!strncmp(arg, "j=", 2)) {
+      wuffs_base__result_u64 r = wuffs_base__parse_number_u64(
+          wuffs_base__make_slice_u8((uint8_t*)(arg + 2), strlen(arg + 2)));
+      if (r.status.repr || (r.value < 1) || (r.value > MAX_NUM_THREADS)) {
+        return "main: bad -j flag value";
+      }
+      g_flags.num_threads = (uint32_t)(r.value);
+      continue;
+    }
+    if (!strncmp(arg, "output-directory=", 17)) {
+      g_flags.output_directory = arg + 17;
+      continue;
+    }
 
     return g_usage;
   }
@@ -193,21 +272,34 @@ parse_flags(int argc, char** argv) {
 static void  //
 ignore_return_value(int ignored) {}
 
+// grow ensures that the array has at least n bytes, re-allocating it (and
+// discarding its contents) if the converter is growable. It returns whether
+// it succeeded.
+static bool  //
+grow(converter* c, wuffs_base__slice_u8* array, uint64_t n) {
+  if (array->len >= n) {
+    return true;
+  } else if (!c->growable) {
+    return false;
+  }
+  free(array->ptr);
+  array->ptr = (uint8_t*)malloc((size_t)n);
+  array->len = array->ptr ? ((size_t)n) : 0;
+  return array->ptr != NULL;
+}
+
 const char*  //
-read_more_src() {
-  if (g_src.meta.closed) {
+read_more_src(converter* c) {
+  if (c->src.meta.closed) {
     return "main: unexpected end of file";
   }
-  wuffs_base__io_buffer__compact(&g_src);
-  ssize_t n = read(STDIN_FD, g_src.data.ptr + g_src.meta.wi,
-                   g_src.data.len - g_src.meta.wi);
+  wuffs_base__io_buffer__compact(&c->src);
+  ssize_t n = read(c->src_fd, c->src.data.ptr + c->src.meta.wi,
+                   c->src.data.len - c->src.meta.wi);
   if (n > 0) {
-    g_src.meta.wi += n;
-  } else if (errno == 0) {
-    if (n < 0) {
-      return "main: unexpected negative-count read";
-    }
-    g_src.meta.closed = true;
+    c->src.meta.wi += n;
+  } else if (n == 0) {
+    c->src.meta.closed = true;
   } else if (errno != EINTR) {
     return strerror(errno);
   }
@@ -215,41 +307,91 @@ read_more_src() {
 }
 
 const char*  //
-load_image_type() {
-  while (g_src.meta.ri >= g_src.meta.wi) {
-    TRY(read_more_src());
+write_all(int fd, const uint8_t* ptr, size_t len) {
+  while (len > 0) {
+    ssize_t n = write(fd, ptr, len);
+    if (n < 0) {
+      if (errno != EINTR) {
+        return strerror(errno);
+      }
+      continue;
+    }
+    ptr += n;
+    len -= (size_t)n;
+  }
+  return NULL;
+}
+
+const char*  //
+flush_dst(converter* c) {
+  const char* z = write_all(c->dst_fd, c->dst.data.ptr, c->dst.meta.wi);
+  c->dst.meta.wi = 0;
+  return z;
+}
+
+// write_dst appends to the dst buffer, flushing it when full. Data at least
+// as long as the buffer bypasses it.
+const char*  //
+write_dst(converter* c, const uint8_t* ptr, size_t len) {
+  if (len > (c->dst.data.len - c->dst.meta.wi)) {
+    TRY(flush_dst(c));
+    if (len >= c->dst.data.len) {
+      return write_all(c->dst_fd, ptr, len);
+    }
+  }
+  memcpy(c->dst.data.ptr + c->dst.meta.wi, ptr, len);
+  c->dst.meta.wi += len;
+  return NULL;
+}
+
+const char*  //
+load_image_type(converter* c) {
+  while (c->src.meta.ri >= c->src.meta.wi) {
+    TRY(read_more_src(c));
   }
 
   wuffs_base__status status;
-  switch (g_src_buffer_array[0]) {
+  c->image_decoder_supports_bands = true;
+  switch (c->src.data.ptr[c->src.meta.ri]) {
     case '\x00':
       status = wuffs_wbmp__decoder__initialize(
-          &g_potential_decoders.wbmp, sizeof g_potential_decoders.wbmp,
+          &c->potential_decoders.wbmp, sizeof c->potential_decoders.wbmp,
           WUFFS_VERSION, WUFFS_INITIALIZE__DEFAULT_OPTIONS);
       TRY(wuffs_base__status__message(&status));
-      g_image_decoder =
+      c->image_decoder =
           wuffs_wbmp__decoder__upcast_as__wuffs_base__image_decoder(
-              &g_potential_decoders.wbmp);
+              &c->potential_decoders.wbmp);
       break;
 
     case 'B':
       status = wuffs_bmp__decoder__initialize(
-          &g_potential_decoders.bmp, sizeof g_potential_decoders.bmp,
+          &c->potential_decoders.bmp, sizeof c->potential_decoders.bmp,
           WUFFS_VERSION, WUFFS_INITIALIZE__DEFAULT_OPTIONS);
       TRY(wuffs_base__status__message(&status));
-      g_image_decoder =
+      c->image_decoder =
           wuffs_bmp__decoder__upcast_as__wuffs_base__image_decoder(
-              &g_potential_decoders.bmp);
+              &c->potential_decoders.bmp);
       break;
 
     case 'G':
       status = wuffs_gif__decoder__initialize(
-          &g_potential_decoders.gif, sizeof g_potential_decoders.gif,
+          &c->potential_decoders.gif, sizeof c->potential_decoders.gif,
           WUFFS_VERSION, WUFFS_INITIALIZE__DEFAULT_OPTIONS);
       TRY(wuffs_base__status__message(&status));
-      g_image_decoder =
+      c->image_decoder =
           wuffs_gif__decoder__upcast_as__wuffs_base__image_decoder(
-              &g_potential_decoders.gif);
+              &c->potential_decoders.gif);
+      c->image_decoder_supports_bands = false;
+      break;
+
+    case 0x89:
+      status = wuffs_png__decoder__initialize(
+          &c->potential_decoders.png, sizeof c->potential_decoders.png,
+          WUFFS_VERSION, WUFFS_INITIALIZE__DEFAULT_OPTIONS);
+      TRY(wuffs_base__status__message(&status));
+      c->image_decoder =
+          wuffs_png__decoder__upcast_as__wuffs_base__image_decoder(
+              &c->potential_decoders.png);
       break;
 
     default:
@@ -259,181 +401,336 @@ load_image_type() {
 }
 
 const char*  //
-load_image_config() {
+load_image_config(converter* c) {
   // Decode the wuffs_base__image_config.
   while (true) {
     wuffs_base__status status = wuffs_base__image_decoder__decode_image_config(
-        g_image_decoder, &g_image_config, &g_src);
+        c->image_decoder, &c->image_config, &c->src);
     if (status.repr == NULL) {
       break;
     } else if (status.repr != wuffs_base__suspension__short_read) {
       return wuffs_base__status__message(&status);
     }
-    TRY(read_more_src());
+    TRY(read_more_src(c));
   }
 
   // Read the dimensions.
-  uint32_t w = wuffs_base__pixel_config__width(&g_image_config.pixcfg);
-  uint32_t h = wuffs_base__pixel_config__height(&g_image_config.pixcfg);
+  uint32_t w = wuffs_base__pixel_config__width(&c->image_config.pixcfg);
+  uint32_t h = wuffs_base__pixel_config__height(&c->image_config.pixcfg);
   if ((w > MAX_DIMENSION) || (h > MAX_DIMENSION)) {
     return "main: image is too large";
   }
-  g_width = w;
-  g_height = h;
+  c->width = w;
+  c->height = h;
 
   // Override the image's native pixel format to be BGRA_NONPREMUL.
-  wuffs_base__pixel_config__set(&g_image_config.pixcfg,
+  wuffs_base__pixel_config__set(&c->image_config.pixcfg,
                                 WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
                                 WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, w, h);
 
   // Configure the work buffer.
   uint64_t workbuf_len =
-      wuffs_base__image_decoder__workbuf_len(g_image_decoder).max_incl;
-  if (workbuf_len > WORKBUF_ARRAY_SIZE) {
+      wuffs_base__image_decoder__workbuf_len(c->image_decoder).max_incl;
+  if ((workbuf_len > WORKBUF_ARRAY_SIZE) ||
+      !grow(c, &c->workbuf_array, workbuf_len)) {
     return "main: image is too large (to configure work buffer)";
   }
-  g_workbuf_slice.ptr = &g_workbuf_array[0];
-  g_workbuf_slice.len = workbuf_len;
+  c->workbuf_slice =
+      wuffs_base__make_slice_u8(c->workbuf_array.ptr, (size_t)workbuf_len);
+  return NULL;
+}
 
-  // Configure the pixel buffer and (if there's capacity) its backup buffer.
-  uint64_t num_pixels = ((uint64_t)w) * ((uint64_t)h);
-  if (num_pixels > (PIXBUF_ARRAY_SIZE / BYTES_PER_PIXEL)) {
+// load_pixbuf configures the full-frame pixel buffer. Streaming in bands does
+// not always need it, so it is separate from load_image_config.
+const char*  //
+load_pixbuf(converter* c) {
+  uint64_t num_pixels = ((uint64_t)c->width) * ((uint64_t)c->height);
+  if ((num_pixels > (PIXBUF_ARRAY_SIZE / BYTES_PER_PIXEL)) ||
+      !grow(c, &c->pixbuf_array, num_pixels * BYTES_PER_PIXEL)) {
     return "main: image is too large (to configure pixel buffer)";
   }
-  g_pixbuf_slice.ptr = &g_pixbuf_array[0];
-  g_pixbuf_slice.len = num_pixels * BYTES_PER_PIXEL;
-  size_t pixbuf_array_remaining = PIXBUF_ARRAY_SIZE - g_pixbuf_slice.len;
-  if (pixbuf_array_remaining >= g_pixbuf_slice.len) {
-    g_pixbuf_backup_slice.ptr = &g_pixbuf_array[g_pixbuf_slice.len];
-    g_pixbuf_backup_slice.len = g_pixbuf_slice.len;
-  }
+  c->pixbuf_slice = wuffs_base__make_slice_u8(
+      c->pixbuf_array.ptr, (size_t)(num_pixels * BYTES_PER_PIXEL));
 
   // Configure the wuffs_base__pixel_buffer struct.
   wuffs_base__status status = wuffs_base__pixel_buffer__set_from_slice(
-      &g_pixbuf, &g_image_config.pixcfg, g_pixbuf_slice);
+      &c->pixbuf, &c->image_config.pixcfg, c->pixbuf_slice);
   TRY(wuffs_base__status__message(&status));
 
-  wuffs_base__table_u8 tab = wuffs_base__pixel_buffer__plane(&g_pixbuf, 0);
-  if ((tab.width != (g_width * BYTES_PER_PIXEL)) || (tab.height != g_height)) {
+  wuffs_base__table_u8 tab = wuffs_base__pixel_buffer__plane(&c->pixbuf, 0);
+  if ((tab.width != (c->width * BYTES_PER_PIXEL)) ||
+      (tab.height != c->height)) {
     return "main: inconsistent pixel buffer dimensions";
   }
+  return NULL;
+}
 
+const char*  //
+load_pixbuf_backup(converter* c) {
+  size_t n = c->pixbuf_slice.len;
+  if (c->pixbuf_backup_slice.ptr && (c->pixbuf_backup_slice.len == n)) {
+    return NULL;
+  } else if (c->growable) {
+    if (!grow(c, &c->backup_array, n)) {
+      return "main: image is too large (to configure pixel backup buffer)";
+    }
+    c->pixbuf_backup_slice = wuffs_base__make_slice_u8(c->backup_array.ptr, n);
+  } else {
+    if ((c->pixbuf_array.len - n) < n) {
+      return "main: image is too large (to configure pixel backup buffer)";
+    }
+    c->pixbuf_backup_slice =
+        wuffs_base__make_slice_u8(c->pixbuf_array.ptr + n, n);
+  }
   return NULL;
 }
 
+// decode_frame_config decodes the next wuffs_base__frame_config, setting
+// *end_of_data instead if there are no more frames.
+const char*  //
+decode_frame_config(converter* c, bool* end_of_data) {
+  while (true) {
+    wuffs_base__status status = wuffs_base__image_decoder__decode_frame_config(
+        c->image_decoder, &c->frame_config, &c->src);
+    if (status.repr == NULL) {
+      *end_of_data = false;
+      return NULL;
+    } else if (status.repr == wuffs_base__note__end_of_data) {
+      *end_of_data = true;
+      return NULL;
+    } else if (status.repr != wuffs_base__suspension__short_read) {
+      return wuffs_base__status__message(&status);
+    }
+    TRY(read_more_src(c));
+  }
+}
+
 void  //
-fill_rectangle(wuffs_base__rect_ie_u32 rect,
+fill_pixels(uint8_t* p, size_t num_pixels, uint32_t nonpremul) {
+  if (nonpremul == 0) {
+    memset(p, 0, num_pixels * BYTES_PER_PIXEL);
+    return;
+  }
+  for (; num_pixels > 0; num_pixels--) {
+    wuffs_base__store_u32le__no_bounds_check(p, nonpremul);
+    p += BYTES_PER_PIXEL;
+  }
+}
+
+void  //
+fill_rectangle(converter* c,
+               wuffs_base__rect_ie_u32 rect,
                wuffs_base__color_u32_argb_premul color) {
-  if (rect.max_excl_x > g_width) {
-    rect.max_excl_x = g_width;
+  if (rect.max_excl_x > c->width) {
+    rect.max_excl_x = c->width;
+  }
+  if (rect.max_excl_y > c->height) {
+    rect.max_excl_y = c->height;
   }
-  if (rect.max_excl_y > g_height) {
-    rect.max_excl_y = g_height;
+  if (rect.min_incl_x >= rect.max_excl_x) {
+    return;
   }
   uint32_t nonpremul =
       wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(color);
-  wuffs_base__table_u8 tab = wuffs_base__pixel_buffer__plane(&g_pixbuf, 0);
+  wuffs_base__table_u8 tab = wuffs_base__pixel_buffer__plane(&c->pixbuf, 0);
 
   uint32_t y;
   for (y = rect.min_incl_y; y < rect.max_excl_y; y++) {
-    uint8_t* p =
-        tab.ptr + (y * tab.stride) + (rect.min_incl_x * BYTES_PER_PIXEL);
-    uint32_t x;
-    for (x = rect.min_incl_x; x < rect.max_excl_x; x++) {
-      wuffs_base__store_u32le__no_bounds_check(p, nonpremul);
-      p += BYTES_PER_PIXEL;
-    }
+    fill_pixels(
+        tab.ptr + (y * tab.stride) + (rect.min_incl_x * BYTES_PER_PIXEL),
+        rect.max_excl_x - rect.min_incl_x, nonpremul);
   }
 }
 
 void  //
-print_nix_header(uint32_t magic_u32le) {
+make_nix_header(converter* c, uint8_t* data, uint32_t magic_u32le) {
   static const uint32_t version1_bn4_u32le = 0x346E62FF;
-  uint8_t data[16];
   wuffs_base__store_u32le__no_bounds_check(data + 0x00, magic_u32le);
   wuffs_base__store_u32le__no_bounds_check(data + 0x04, version1_bn4_u32le);
-  wuffs_base__store_u32le__no_bounds_check(data + 0x08, g_width);
-  wuffs_base__store_u32le__no_bounds_check(data + 0x0C, g_height);
-  ignore_return_value(write(STDOUT_FD, &data[0], 16));
+  wuffs_base__store_u32le__no_bounds_check(data + 0x08, c->width);
+  wuffs_base__store_u32le__no_bounds_check(data + 0x0C, c->height);
 }
 
-void  //
-print_nia_duration(wuffs_base__flicks duration) {
+const char*  //
+print_nix_header(converter* c, uint32_t magic_u32le) {
+  uint8_t data[NIX_HEADER_SIZE];
+  make_nix_header(c, &data[0], magic_u32le);
+  return write_dst(c, &data[0], NIX_HEADER_SIZE);
+}
+
+const char*  //
+print_nia_duration(converter* c, wuffs_base__flicks duration) {
   uint8_t data[8];
   wuffs_base__store_u64le__no_bounds_check(data + 0x00, duration);
-  ignore_return_value(write(STDOUT_FD, &data[0], 8));
+  return write_dst(c, &data[0], 8);
 }
 
-void  //
-print_nie_frame() {
-  print_nix_header(0x45AFC36E);  // "nïE" as a u32le.
-  wuffs_base__table_u8 tab = wuffs_base__pixel_buffer__plane(&g_pixbuf, 0);
+const char*  //
+print_nie_frame(converter* c) {
+  TRY(print_nix_header(c, 0x45AFC36E));  // "nïE" as a u32le.
+  wuffs_base__table_u8 tab = wuffs_base__pixel_buffer__plane(&c->pixbuf, 0);
   if (tab.width == tab.stride) {
-    ignore_return_value(write(STDOUT_FD, tab.ptr, tab.width * tab.height));
-  } else {
-    size_t y;
-    for (y = 0; y < tab.height; y++) {
-      ignore_return_value(
-          write(STDOUT_FD, tab.ptr + (y * tab.stride), tab.width));
-      break;
-    }
+    return write_dst(c, tab.ptr, tab.width * tab.height);
+  }
+  size_t y;
+  for (y = 0; y < tab.height; y++) {
+    TRY(write_dst(c, tab.ptr + (y * tab.stride), tab.width));
   }
+  return NULL;
 }
 
-void  //
-print_nia_padding() {
-  if (g_width & g_height & 1) {
+const char*  //
+print_nia_padding(converter* c) {
+  if (c->width & c->height & 1) {
     uint8_t data[4];
     wuffs_base__store_u32le__no_bounds_check(data + 0x00, 0);
-    ignore_return_value(write(STDOUT_FD, &data[0], 4));
+    return write_dst(c, &data[0], 4);
   }
+  return NULL;
 }
 
-void  //
-print_nia_footer() {
+const char*  //
+print_nia_footer(converter* c) {
   uint8_t data[8];
   wuffs_base__store_u32le__no_bounds_check(
       data + 0x00,
-      wuffs_base__image_decoder__num_animation_loops(g_image_decoder));
+      wuffs_base__image_decoder__num_animation_loops(c->image_decoder));
   wuffs_base__store_u32le__no_bounds_check(data + 0x04, 0x80000000);
-  ignore_return_value(write(STDOUT_FD, &data[0], 8));
+  return write_dst(c, &data[0], 8);
 }
 
+// convert_nie_in_bands converts the first frame to NIE, using the
+// decode_frame_options band_height option. Each band of rows is decoded
+// directly into the dst buffer, just after the NIE header, and written out as
+// soon as it is complete. Bands that complete out of order (e.g. for a
+// bottom-up BMP image) are set aside in the full-frame pixel buffer until the
+// rows above them have been written.
 const char*  //
-main1(int argc, char** argv) {
-  TRY(parse_flags(argc, argv));
-  if (g_flags.fail_if_unsandboxed && !g_sandboxed) {
-    return "main: unsandboxed";
+convert_nie_in_bands(converter* c) {
+  bool end_of_data = false;
+  TRY(decode_frame_config(c, &end_of_data));
+  if (end_of_data) {
+    return print_nia_footer(c);
   }
 
-  g_src.data.ptr = g_src_buffer_array;
-  g_src.data.len = SRC_BUFFER_ARRAY_SIZE;
+  size_t row_size = ((size_t)c->width) * BYTES_PER_PIXEL;
+  uint32_t band_height =
+      (uint32_t)((c->dst.data.len - NIX_HEADER_SIZE) / row_size);
+  if (band_height > c->height) {
+    band_height = c->height;
+  }
+  uint8_t* band_ptr = c->dst.data.ptr + NIX_HEADER_SIZE;
+  size_t band_num_pixels = ((size_t)c->width) * band_height;
+  uint32_t background =
+      wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(
+          wuffs_base__frame_config__background_color(&c->frame_config));
+
+  wuffs_base__pixel_config band_pixcfg = c->image_config.pixcfg;
+  wuffs_base__pixel_config__set(&band_pixcfg,
+                                WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+                                WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, c->width,
+                                band_height);
+  wuffs_base__pixel_buffer band_pixbuf = {0};
+  wuffs_base__status status = wuffs_base__pixel_buffer__set_from_slice(
+      &band_pixbuf, &band_pixcfg,
+      wuffs_base__make_slice_u8(band_ptr, row_size * band_height));
+  TRY(wuffs_base__status__message(&status));
+
+  wuffs_base__decode_frame_options opts =
+      wuffs_base__null_decode_frame_options();
+  wuffs_base__decode_frame_options__set_band_height(&opts, band_height);
+
+  // Rows [0, next_y) have been written. The NIE header is at the start of the
+  // dst buffer and is written along with the first band that is written.
+  uint32_t next_y = 0;
+  bool wrote_header = false;
+  make_nix_header(c, c->dst.data.ptr, 0x45AFC36E);  // "nïE" as a u32le.
+  fill_pixels(band_ptr, band_num_pixels, background);
+
+  while (true) {
+    status = wuffs_base__image_decoder__decode_frame(
+        c->image_decoder, &band_pixbuf, &c->src,
+        wuffs_base__frame_config__overwrite_instead_of_blend(&c->frame_config)
+            ? WUFFS_BASE__PIXEL_BLEND__SRC
+            : WUFFS_BASE__PIXEL_BLEND__SRC_OVER,
+        c->workbuf_slice, &opts);
+    if (status.repr == wuffs_base__suspension__short_read) {
+      TRY(read_more_src(c));
+      continue;
+    } else if ((status.repr != NULL) &&
+               (status.repr != wuffs_base__suspension__short_write)) {
+      return wuffs_base__status__message(&status);
+    }
+
+    wuffs_base__rect_ie_u32 band =
+        wuffs_base__image_decoder__frame_dirty_rect(c->image_decoder);
+    if (band.max_excl_y > c->height) {
+      return "main: internal error: band is out of bounds";
+    } else if (band.min_incl_y < band.max_excl_y) {
+      size_t n = row_size * (band.max_excl_y - band.min_incl_y);
+      if (band.min_incl_y == next_y) {
+        TRY(wrote_header ? write_all(c->dst_fd, band_ptr, n)
+                         : write_all(c->dst_fd, c->dst.data.ptr,
+                                     NIX_HEADER_SIZE + n));
+        wrote_header = true;
+        next_y = band.max_excl_y;
+      } else {
+        if (!c->pixbuf_slice.ptr) {
+          TRY(load_pixbuf(c));
+        }
+        memcpy(c->pixbuf_slice.ptr + (row_size * band.min_incl_y), band_ptr,
+               n);
+      }
+      fill_pixels(band_ptr, band_num_pixels, background);
+    }
 
-  TRY(load_image_type());
-  TRY(load_image_config());
+    if (status.repr == NULL) {
+      break;
+    }
+  }
+
+  if (!wrote_header) {
+    TRY(write_all(c->dst_fd, c->dst.data.ptr, NIX_HEADER_SIZE));
+  }
+  if (next_y < c->height) {
+    if (!c->pixbuf_slice.ptr) {
+      return "main: internal error: missing bands";
+    }
+    TRY(write_all(c->dst_fd, c->pixbuf_slice.ptr + (row_size * next_y),
+                  row_size * (c->height - next_y)));
+  }
+  return NULL;
+}
+
+// convert converts the image read from c->src_fd, writing to the dst buffer
+// (which the caller should flush afterwards).
+const char*  //
+convert(converter* c) {
+  TRY(load_image_type(c));
+  TRY(load_image_config(c));
+  if (g_flags.first_frame_only && c->image_decoder_supports_bands &&
+      (c->width > 0) && (c->height > 0) &&
+      (c->dst.data.len > NIX_HEADER_SIZE) &&
+      ((c->dst.data.len - NIX_HEADER_SIZE) >=
+       (((size_t)c->width) * BYTES_PER_PIXEL))) {
+    return convert_nie_in_bands(c);
+  }
+  TRY(load_pixbuf(c));
   if (!g_flags.first_frame_only) {
-    print_nix_header(0x41AFC36E);  // "nïA" as a u32le.
+    TRY(print_nix_header(c, 0x41AFC36E));  // "nïA" as a u32le.
   }
 
   wuffs_base__flicks total_duration = 0;
   while (true) {
     // Decode the wuffs_base__frame_config.
-    while (true) {
-      wuffs_base__status dfc_status =
-          wuffs_base__image_decoder__decode_frame_config(
-              g_image_decoder, &g_frame_config, &g_src);
-      if (dfc_status.repr == NULL) {
-        break;
-      } else if (dfc_status.repr == wuffs_base__note__end_of_data) {
-        goto done;
-      } else if (dfc_status.repr != wuffs_base__suspension__short_read) {
-        return wuffs_base__status__message(&dfc_status);
-      }
-      TRY(read_more_src());
+    bool end_of_data = false;
+    TRY(decode_frame_config(c, &end_of_data));
+    if (end_of_data) {
+      break;
     }
 
     wuffs_base__flicks duration =
-        wuffs_base__frame_config__duration(&g_frame_config);
+        wuffs_base__frame_config__duration(&c->frame_config);
     if (duration < 0) {
       return "main: animation frame duration is negative";
     } else if (total_duration > (INT64_MAX - duration)) {
@@ -441,22 +738,20 @@ main1(int argc, char** argv) {
     }
     total_duration += duration;
     if (!g_flags.first_frame_only) {
-      print_nia_duration(total_duration);
+      TRY(print_nia_duration(c, total_duration));
     }
 
-    if (wuffs_base__frame_config__index(&g_frame_config) == 0) {
+    if (wuffs_base__frame_config__index(&c->frame_config) == 0) {
       fill_rectangle(
-          wuffs_base__pixel_config__bounds(&g_image_config.pixcfg),
-          wuffs_base__frame_config__background_color(&g_frame_config));
+          c, wuffs_base__pixel_config__bounds(&c->image_config.pixcfg),
+          wuffs_base__frame_config__background_color(&c->frame_config));
     }
 
-    switch (wuffs_base__frame_config__disposal(&g_frame_config)) {
+    switch (wuffs_base__frame_config__disposal(&c->frame_config)) {
       case WUFFS_BASE__ANIMATION_DISPOSAL__RESTORE_PREVIOUS: {
-        if (g_pixbuf_slice.len != g_pixbuf_backup_slice.len) {
-          return "main: image is too large (to configure pixel backup buffer)";
-        }
-        memcpy(g_pixbuf_backup_slice.ptr, g_pixbuf_slice.ptr,
-               g_pixbuf_slice.len);
+        TRY(load_pixbuf_backup(c));
+        memcpy(c->pixbuf_backup_slice.ptr, c->pixbuf_slice.ptr,
+               c->pixbuf_slice.len);
         break;
       }
     }
@@ -465,49 +760,230 @@ main1(int argc, char** argv) {
     wuffs_base__status df_status;
     while (true) {
       df_status = wuffs_base__image_decoder__decode_frame(
-          g_image_decoder, &g_pixbuf, &g_src,
-          wuffs_base__frame_config__overwrite_instead_of_blend(&g_frame_config)
+          c->image_decoder, &c->pixbuf, &c->src,
+          wuffs_base__frame_config__overwrite_instead_of_blend(
+              &c->frame_config)
               ? WUFFS_BASE__PIXEL_BLEND__SRC
               : WUFFS_BASE__PIXEL_BLEND__SRC_OVER,
-          g_workbuf_slice, NULL);
+          c->workbuf_slice, NULL);
       if (df_status.repr != wuffs_base__suspension__short_read) {
         break;
       }
-      TRY(read_more_src());
+      TRY(read_more_src(c));
     }
 
-    print_nie_frame();
+    TRY(print_nie_frame(c));
 
     if (df_status.repr != NULL) {
       return wuffs_base__status__message(&df_status);
     } else if (g_flags.first_frame_only) {
       return NULL;
     }
-    print_nia_padding();
+    TRY(print_nia_padding(c));
 
-    switch (wuffs_base__frame_config__disposal(&g_frame_config)) {
+    switch (wuffs_base__frame_config__disposal(&c->frame_config)) {
       case WUFFS_BASE__ANIMATION_DISPOSAL__RESTORE_BACKGROUND: {
         fill_rectangle(
-            wuffs_base__frame_config__bounds(&g_frame_config),
-            wuffs_base__frame_config__background_color(&g_frame_config));
+            c, wuffs_base__frame_config__bounds(&c->frame_config),
+            wuffs_base__frame_config__background_color(&c->frame_config));
         break;
       }
       case WUFFS_BASE__ANIMATION_DISPOSAL__RESTORE_PREVIOUS: {
-        if (g_pixbuf_slice.len != g_pixbuf_backup_slice.len) {
-          return "main: image is too large (to configure pixel backup buffer)";
-        }
-        memcpy(g_pixbuf_slice.ptr, g_pixbuf_backup_slice.ptr,
-               g_pixbuf_slice.len);
+        TRY(load_pixbuf_backup(c));
+        memcpy(c->pixbuf_slice.ptr, c->pixbuf_backup_slice.ptr,
+               c->pixbuf_slice.len);
         break;
       }
     }
   }
 
-done:
-  print_nia_footer();
+  return print_nia_footer(c);
+}
+
+// reset_converter prepares a converter for its next image.
+void  //
+reset_converter(converter* c, int src_fd, int dst_fd) {
+  c->src_fd = src_fd;
+  c->dst_fd = dst_fd;
+  c->src.meta = wuffs_base__empty_io_buffer_meta();
+  c->dst.meta = wuffs_base__empty_io_buffer_meta();
+  c->pixbuf_slice = wuffs_base__empty_slice_u8();
+  c->pixbuf_backup_slice = wuffs_base__empty_slice_u8();
+  c->workbuf_slice = wuffs_base__empty_slice_u8();
+  c->image_decoder = NULL;
+}
+
+// ----
+
+// g_batch is the batch mode's shared state, guarded by the mutex.
+struct {
+  pthread_mutex_t mutex;
+  int next_file;
+  int num_failures;
+  bool had_internal_error;
+} g_batch;
+
+void  //
+report_failure(const char* filename, const char* status_msg) {
+  // Assemble the line first, so that each is written in one piece.
+  char line[4096];
+  int n = snprintf(line, sizeof line, "%s: %s\n", filename, status_msg);
+  if ((n < 0) || (n >= (int)(sizeof line))) {
+    n = sizeof line - 1;
+    line[n - 1] = '\n';
+  }
+
+  pthread_mutex_lock(&g_batch.mutex);
+  ignore_return_value(write(STDERR_FD, line, n));
+  g_batch.num_failures++;
+  if (strstr(status_msg, "internal error:")) {
+    g_batch.had_internal_error = true;
+  }
+  pthread_mutex_unlock(&g_batch.mutex);
+}
+
+const char*  //
+convert_file(converter* c, const char* src_filename) {
+  char dst_filename[4096];
+  const char* ext = g_flags.first_frame_only ? ".nie" : ".nia";
+  int n;
+  if (g_flags.output_directory) {
+    const char* base = strrchr(src_filename, '/');
+    n = snprintf(dst_filename, sizeof dst_filename, "%s/%s%s",
+                 g_flags.output_directory, base ? (base + 1) : src_filename,
+                 ext);
+  } else {
+    n = snprintf(dst_filename, sizeof dst_filename, "%s%s", src_filename, ext);
+  }
+  if ((n < 0) || (n >= (int)(sizeof dst_filename))) {
+    return "main: output file name is too long";
+  }
+
+  int src_fd = open(src_filename, O_RDONLY);
+  if (src_fd < 0) {
+    return strerror(errno);
+  }
+  int dst_fd = open(dst_filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (dst_fd < 0) {
+    const char* z = strerror(errno);
+    close(src_fd);
+    return z;
+  }
+
+  reset_converter(c, src_fd, dst_fd);
+  const char* z = convert(c);
+  const char* z2 = flush_dst(c);
+  if (!z) {
+    z = z2;
+  }
+  close(src_fd);
+  if (close(dst_fd) && !z) {
+    z = strerror(errno);
+  }
+  if (z) {
+    unlink(dst_filename);
+  }
+  return z;
+}
+
+void*  //
+batch_worker(void* arg) {
+  converter* c = (converter*)calloc(1, sizeof(converter));
+  uint8_t* src_array = (uint8_t*)malloc(SRC_BUFFER_ARRAY_SIZE);
+  uint8_t* dst_array = (uint8_t*)malloc(DST_BUFFER_ARRAY_SIZE);
+  if (c && src_array && dst_array) {
+    c->growable = true;
+    c->src.data = wuffs_base__make_slice_u8(src_array, SRC_BUFFER_ARRAY_SIZE);
+    c->dst.data = wuffs_base__make_slice_u8(dst_array, DST_BUFFER_ARRAY_SIZE);
+  }
+
+  while (true) {
+    pthread_mutex_lock(&g_batch.mutex);
+    int i = g_batch.next_file++;
+    pthread_mutex_unlock(&g_batch.mutex);
+    if (i >= g_flags.remaining_argc) {
+      break;
+    }
+    const char* filename = g_flags.remaining_argv[i];
+    const char* z = (c && c->growable) ? convert_file(c, filename)
+                                       : "main: out of memory";
+    if (z) {
+      report_failure(filename, z);
+    }
+  }
+
+  if (c) {
+    free(c->workbuf_array.ptr);
+    free(c->pixbuf_array.ptr);
+    free(c->backup_array.ptr);
+    free(c);
+  }
+  free(src_array);
+  free(dst_array);
+  return NULL;
+}
+
+const char*  //
+main_batch() {
+  uint32_t num_threads = g_flags.num_threads;
+  if (num_threads == 0) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    num_threads = (n < 1)                 ? 1
+                  : (n > MAX_NUM_THREADS) ? MAX_NUM_THREADS
+                                          : (uint32_t)(n);
+  }
+  if (num_threads > (uint32_t)(g_flags.remaining_argc)) {
+    num_threads = (uint32_t)(g_flags.remaining_argc);
+  }
+
+  pthread_mutex_init(&g_batch.mutex, NULL);
+  pthread_t threads[MAX_NUM_THREADS];
+  uint32_t t = 0;
+  for (; t < num_threads; t++) {
+    if (pthread_create(&threads[t], NULL, batch_worker, NULL)) {
+      break;
+    }
+  }
+  if (t == 0) {
+    return "main: could not create worker threads";
+  }
+  while (t > 0) {
+    pthread_join(threads[--t], NULL);
+  }
+  pthread_mutex_destroy(&g_batch.mutex);
+
+  if (g_batch.had_internal_error) {
+    return "main: internal error: some files could not be converted";
+  } else if (g_batch.num_failures > 0) {
+    return "main: some files could not be converted";
+  }
   return NULL;
 }
 
+const char*  //
+main1() {
+  if (g_flags.fail_if_unsandboxed && !g_sandboxed) {
+    return "main: unsandboxed";
+  } else if (g_flags.remaining_argc > 0) {
+    return main_batch();
+  }
+
+  converter* c = &g_converter;
+  c->src.data = wuffs_base__make_slice_u8(g_src_buffer_array,
+                                          SRC_BUFFER_ARRAY_SIZE);
+  c->dst.data = wuffs_base__make_slice_u8(g_dst_buffer_array,
+                                          DST_BUFFER_ARRAY_SIZE);
+  c->workbuf_array =
+      wuffs_base__make_slice_u8(g_workbuf_array, WORKBUF_ARRAY_SIZE);
+  c->pixbuf_array =
+      wuffs_base__make_slice_u8(g_pixbuf_array, PIXBUF_ARRAY_SIZE);
+  reset_converter(c, STDIN_FD, STDOUT_FD);
+
+  const char* z = convert(c);
+  const char* z2 = flush_dst(c);
+  return z ? z : z2;
+}
+
 int  //
 compute_exit_code(const char* status_msg) {
   if (!status_msg) {
@@ -541,18 +1017,27 @@ compute_exit_code(const char* status_msg) {
 
 int  //
 main(int argc, char** argv) {
+  // Parsing the flags makes no system calls, so it can precede sandboxing.
+  // Batch mode opens files and starts threads, which SECCOMP_MODE_STRICT
+  // disallows, so only the stdin-to-stdout mode is sandboxed.
+  const char* z = parse_flags(argc, argv);
+
 #if defined(WUFFS_EXAMPLE_USE_SECCOMP)
-  prctl(PR_SET_SECCOMP, SECCOMP_MODE_STRICT);
-  g_sandboxed = true;
+  if (z || (g_flags.remaining_argc == 0)) {
+    prctl(PR_SET_SECCOMP, SECCOMP_MODE_STRICT);
+    g_sandboxed = true;
+  }
 #endif
 
-  int exit_code = compute_exit_code(main1(argc, argv));
+  int exit_code = compute_exit_code(z ? z : main1());
 
 #if defined(WUFFS_EXAMPLE_USE_SECCOMP)
   // Call SYS_exit explicitly, instead of calling SYS_exit_group implicitly by
   // either calling _exit or returning from main. SECCOMP_MODE_STRICT allows
   // only SYS_exit.
-  syscall(SYS_exit, exit_code);
+  if (g_sandboxed) {
+    syscall(SYS_exit, exit_code);
+  }
 #endif
   return exit_code;
 }
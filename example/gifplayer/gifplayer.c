@@ -25,9 +25,16 @@ for a C compiler $CC, such as clang or gcc.
 Add the -color flag to a.out to get 24 bit color ("true color") terminal output
 (in the UTF-8 format) instead of plain ASCII output. Not all terminal emulators
 support true color: https://gist.github.com/XVilka/8346728
+
+The first frame is printed in full. After that, only the part of the canvas
+that changed (the previous frame's disposal plus the decoder's
+frame_dirty_rect) is re-printed in place, moving the terminal's cursor with
+ANSI escape codes. Each frame is decoded directly onto that one persistent
+canvas, using the SRC_OVER blend.
 */
 
 #include <errno.h>
+#include <inttypes.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -120,10 +127,15 @@ wuffs_base__slice_u8 g_workbuf = {0};
 wuffs_base__slice_u8 g_printbuf = {0};
 
 bool g_first_play = true;
+bool g_printed_once = false;
 uint32_t g_num_loops_remaining = 0;
 wuffs_base__image_config g_ic = {0};
 wuffs_base__pixel_buffer g_pb = {0};
 
+// g_disposed_rect is the part of the canvas that the previous frame's
+// disposal changed, which has not been re-printed yet.
+wuffs_base__rect_ie_u32 g_disposed_rect = {0};
+
 wuffs_base__flicks g_cumulative_delay_micros = 0;
 
 const char*  //
@@ -216,62 +228,89 @@ restore_background(wuffs_base__pixel_buffer* pb,
   }
 }
 
+// copy_rect copies the bounds part of the src canvas to the dst canvas.
+void  //
+copy_rect(wuffs_base__pixel_buffer* pb,
+          wuffs_base__rect_ie_u32 bounds,
+          uint8_t* dst,
+          const uint8_t* src) {
+  size_t width4 = (size_t)(wuffs_base__pixel_config__width(&pb->pixcfg)) * 4;
+  size_t n = (size_t)(wuffs_base__rect_ie_u32__width(&bounds)) * 4;
+  size_t y;
+  for (y = bounds.min_incl_y; y < bounds.max_excl_y; y++) {
+    size_t offset = (y * width4) + (bounds.min_incl_x * 4);
+    memcpy(dst + offset, src + offset, n);
+  }
+}
+
+// print_art prints the rect part of the canvas to g_printbuf, returning the
+// number of bytes printed. The first call prints the whole canvas. Later calls
+// assume that the previous output is still on screen, with the cursor on the
+// line below it, and overwrite just the rect part of it.
 size_t  //
-print_ascii_art(wuffs_base__pixel_buffer* pb) {
+print_art(wuffs_base__pixel_buffer* pb, wuffs_base__rect_ie_u32 rect) {
   uint32_t width = wuffs_base__pixel_config__width(&pb->pixcfg);
   uint32_t height = wuffs_base__pixel_config__height(&pb->pixcfg);
+  bool in_place = g_printed_once;
+  if (!in_place) {
+    rect = wuffs_base__pixel_config__bounds(&pb->pixcfg);
+  } else if (wuffs_base__rect_ie_u32__is_empty(&rect)) {
+    return 0;
+  }
+  g_printed_once = true;
 
-  uint8_t* d = g_curr_dst_buffer;
   uint8_t* p = g_printbuf.ptr;
-  *p++ = '\n';
+  if (!in_place) {
+    *p++ = '\n';
+  }
+  if (g_flags.color) {
+    p += sprintf((char*)p, "%s", g_reset_color);
+  }
+  if (in_place) {
+    // Move the cursor up to the first row of rect.
+    p += sprintf((char*)p, "\x1B[%" PRIu32 "A", height - rect.min_incl_y);
+  }
+
+  size_t width4 = ((size_t)width) * 4;
   uint32_t y;
-  for (y = 0; y < height; y++) {
+  for (y = rect.min_incl_y; y < rect.max_excl_y; y++) {
+    if (in_place && (rect.min_incl_x > 0)) {
+      // Move the cursor right to the first column of rect.
+      p += sprintf((char*)p, "\x1B[%" PRIu32 "G", rect.min_incl_x + 1);
+    }
+    uint8_t* d = g_curr_dst_buffer + (y * width4) + (rect.min_incl_x * 4);
     uint32_t x;
-    for (x = 0; x < width; x++) {
+    for (x = rect.min_incl_x; x < rect.max_excl_x; x++) {
       wuffs_base__color_u32_argb_premul c =
           wuffs_base__load_u32le__no_bounds_check(d);
       d += sizeof(wuffs_base__color_u32_argb_premul);
-      // Convert to grayscale via the formula
-      //  Y = (0.299 * R) + (0.587 * G) + (0.114 * B)
-      // translated into fixed point arithmetic.
       uint32_t b = 0xFF & (c >> 0);
       uint32_t g = 0xFF & (c >> 8);
       uint32_t r = 0xFF & (c >> 16);
-      uint32_t gray =
-          ((19595 * r) + (38470 * g) + (7471 * b) + (1 << 15)) >> 16;
-      *p++ = "-:=+IOX@"[(gray & 0xFF) >> 5];
+      if (g_flags.color) {
+        // "\xE2\x96\x88" is U+2588 FULL BLOCK. Before that is a true color
+        // terminal escape code.
+        p += sprintf((char*)p, "\x1B[38;2;%d;%d;%dm\xE2\x96\x88", (int)r,
+                     (int)g, (int)b);
+      } else {
+        // Convert to grayscale via the formula
+        //  Y = (0.299 * R) + (0.587 * G) + (0.114 * B)
+        // translated into fixed point arithmetic.
+        uint32_t gray =
+            ((19595 * r) + (38470 * g) + (7471 * b) + (1 << 15)) >> 16;
+        *p++ = "-:=+IOX@"[(gray & 0xFF) >> 5];
+      }
     }
     *p++ = '\n';
   }
-  return p - g_printbuf.ptr;
-}
 
-size_t  //
-print_color_art(wuffs_base__pixel_buffer* pb) {
-  uint32_t width = wuffs_base__pixel_config__width(&pb->pixcfg);
-  uint32_t height = wuffs_base__pixel_config__height(&pb->pixcfg);
-
-  uint8_t* d = g_curr_dst_buffer;
-  uint8_t* p = g_printbuf.ptr;
-  *p++ = '\n';
-  p += sprintf((char*)p, "%s", g_reset_color);
-  uint32_t y;
-  for (y = 0; y < height; y++) {
-    uint32_t x;
-    for (x = 0; x < width; x++) {
-      wuffs_base__color_u32_argb_premul c =
-          wuffs_base__load_u32le__no_bounds_check(d);
-      d += sizeof(wuffs_base__color_u32_argb_premul);
-      int b = 0xFF & (c >> 0);
-      int g = 0xFF & (c >> 8);
-      int r = 0xFF & (c >> 16);
-      // "\xE2\x96\x88" is U+2588 FULL BLOCK. Before that is a true color
-      // terminal escape code.
-      p += sprintf((char*)p, "\x1B[38;2;%d;%d;%dm\xE2\x96\x88", r, g, b);
-    }
-    *p++ = '\n';
+  if (in_place && (rect.max_excl_y < height)) {
+    // Move the cursor back down to the line below the canvas.
+    p += sprintf((char*)p, "\x1B[%" PRIu32 "B", height - rect.max_excl_y);
+  }
+  if (g_flags.color) {
+    p += sprintf((char*)p, "%s", g_reset_color);
   }
-  p += sprintf((char*)p, "%s", g_reset_color);
   return p - g_printbuf.ptr;
 }
 
@@ -308,7 +347,9 @@ try_allocate(wuffs_gif__decoder* dec) {
     g_workbuf = wuffs_base__make_slice_u8(NULL, 0);
   }
 
-  uint64_t plen = 1 + ((uint64_t)(width) + 1) * (uint64_t)(height);
+  // Each row needs one byte per pixel and a '\n', plus (when printing in
+  // place) a cursor movement escape code. Reserve more slack than that.
+  uint64_t plen = 64 + ((uint64_t)(width) + 16) * (uint64_t)(height);
   uint64_t bytes_per_print_pixel = g_flags.color ? BYTES_PER_COLOR_PIXEL : 1;
   if (plen <= ((uint64_t)SIZE_MAX) / bytes_per_print_pixel) {
     g_printbuf =
@@ -403,7 +444,11 @@ play() {
       return wuffs_base__status__message(&dfc_status);
     }
 
+    wuffs_base__rect_ie_u32 changed = g_disposed_rect;
+    g_disposed_rect = wuffs_base__empty_rect_ie_u32();
+
     if (wuffs_base__frame_config__index(&fc) == 0) {
+      changed = wuffs_base__pixel_config__bounds(&g_ic.pixcfg);
       wuffs_base__color_u32_argb_premul background_color =
           wuffs_base__frame_config__background_color(&fc);
       size_t i;
@@ -417,7 +462,8 @@ play() {
 
     switch (wuffs_base__frame_config__disposal(&fc)) {
       case WUFFS_BASE__ANIMATION_DISPOSAL__RESTORE_PREVIOUS: {
-        memcpy(g_prev_dst_buffer, g_curr_dst_buffer, g_dst_len);
+        copy_rect(&g_pb, wuffs_base__frame_config__bounds(&fc),
+                  g_prev_dst_buffer, g_curr_dst_buffer);
         break;
       }
     }
@@ -432,26 +478,20 @@ play() {
       break;
     }
 
-    size_t n = g_flags.color ? print_color_art(&g_pb) : print_ascii_art(&g_pb);
+    changed = wuffs_base__rect_ie_u32__unite(
+        &changed, wuffs_gif__decoder__frame_dirty_rect(&dec));
+    size_t n = print_art(&g_pb, changed);
 
     switch (wuffs_base__frame_config__disposal(&fc)) {
       case WUFFS_BASE__ANIMATION_DISPOSAL__RESTORE_BACKGROUND: {
-        restore_background(&g_pb, wuffs_base__frame_config__bounds(&fc),
+        g_disposed_rect = wuffs_base__frame_config__bounds(&fc);
+        restore_background(&g_pb, g_disposed_rect,
                            wuffs_base__frame_config__background_color(&fc));
         break;
       }
       case WUFFS_BASE__ANIMATION_DISPOSAL__RESTORE_PREVIOUS: {
-        uint8_t* swap = g_curr_dst_buffer;
-        g_curr_dst_buffer = g_prev_dst_buffer;
-        g_prev_dst_buffer = swap;
-
-        wuffs_base__status sfs1_status =
-            wuffs_base__pixel_buffer__set_from_slice(
-                &g_pb, &g_ic.pixcfg,
-                wuffs_base__make_slice_u8(g_curr_dst_buffer, g_dst_len));
-        if (!wuffs_base__status__is_ok(&sfs1_status)) {
-          return wuffs_base__status__message(&sfs1_status);
-        }
+        g_disposed_rect = wuffs_base__frame_config__bounds(&fc);
+        copy_rect(&g_pb, g_disposed_rect, g_curr_dst_buffer, g_prev_dst_buffer);
         break;
       }
     }
@@ -22,15 +22,19 @@ See the "const char* g_usage" string below for details.
 
 ----
 
-This program uses Wuffs' JSON decoder at a relatively high level, building
-in-memory representations of JSON 'things' (e.g. numbers, strings, objects).
-After the entire input has been converted, walking the tree prints the output
-(in sorted order). The core conversion mechanism is to call JsonThing::parse,
-which consumes a variable number of tokens (the output of Wuffs' JSON decoder).
-JsonThing::parse can call itself recursively, as JSON values can nest.
-
-This approach is centered around JSON things. Each JSON thing comprises one or
-more JSON tokens.
+This program uses Wuffs' JSON decoder at a relatively high level. It reads the
+entire input into memory and converts its tokens (the output of Wuffs' JSON
+decoder) into a tape: a flat array of JSON 'things' (e.g. numbers, strings,
+objects) in document order, built by a wuffs_base__tape_builder. Each thing
+comprises one or more JSON tokens. Walking the tape prints the output (in
+sorted order). The decoding loop itself (handling the decoder's suspensions)
+is wuffs_aux::decode_tokens, part of Wuffs' auxiliary C++ API.
+
+A tape node for a container (an array or object) knows how many nodes its
+sub-tree spans, so that skipping over a container is O(1), and its strings
+point into the input, without copying, unless they need un-escaping. Compared
+to a tree of separately allocated nodes (e.g. using std::map and std::vector),
+there are far fewer allocations and the memory access is more cache friendly.
 
 An alternative, lower-level approach is in the sibling example/jsonptr program.
 Neither approach is better or worse per se, but when studying this program, be
@@ -64,8 +68,9 @@ for a C++ compiler $CXX, such as clang++ or g++.
 #include <errno.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <algorithm>
 #include <iostream>
-#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -240,449 +245,231 @@ parse_flags(int argc, char** argv) {
 #define WORK_BUFFER_ARRAY_SIZE \
   WUFFS_JSON__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE
 
-#ifndef SRC_BUFFER_ARRAY_SIZE
-#define SRC_BUFFER_ARRAY_SIZE (4 * 1024)
+#ifndef SRC_READ_SIZE
+#define SRC_READ_SIZE (64 * 1024)
 #endif
 #ifndef TOKEN_BUFFER_ARRAY_SIZE
-#define TOKEN_BUFFER_ARRAY_SIZE (1 * 1024)
+#define TOKEN_BUFFER_ARRAY_SIZE (4 * 1024)
 #endif
 
-class TokenStream {
+// Tape holds the entire input (the source) and its wuffs_base__tape_node's.
+// The nodes' strings point into the source or, for strings that aren't just
+// a copy of their source bytes (e.g. they contain backslash-escapes), into
+// one of the arenas.
+class Tape {
  public:
-  struct Result {
-    std::string status_msg;
-    wuffs_base__token token;
-    // src_data is a sub-slice of m_src (a slice is a pointer-length pair).
-    // Calling TokenStream::peek or TokenStream::next may change the backing
-    // array's contents, so handling a TokenStream::Result may require copying
-    // this src_data slice's contents.
-    wuffs_base__slice_u8 src_data;
-
-    Result(std::string s)
-        : status_msg(s),
-          token(wuffs_base__make_token(0)),
-          src_data(wuffs_base__empty_slice_u8()) {}
-
-    Result(std::string s, wuffs_base__token t, wuffs_base__slice_u8 d)
-        : status_msg(s), token(t), src_data(d) {}
-  };
-
-  TokenStream(int input_file_descriptor)
-      : m_status(wuffs_base__make_status(nullptr)),
-        m_src(wuffs_base__make_io_buffer(
-            wuffs_base__make_slice_u8(m_src_array, SRC_BUFFER_ARRAY_SIZE),
-            wuffs_base__empty_io_buffer_meta())),
-        m_tok(wuffs_base__make_token_buffer(
-            wuffs_base__make_slice_token(m_tok_array, TOKEN_BUFFER_ARRAY_SIZE),
-            wuffs_base__empty_token_buffer_meta())),
-        m_input_file_descriptor(input_file_descriptor),
-        m_curr_token_end_src_index(0) {
-    m_status =
-        m_dec.initialize(sizeof__wuffs_json__decoder(), WUFFS_VERSION, 0);
-
-    // Uncomment these lines to enable the WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_X
-    // option, discussed in a separate comment.
-    //
-    // if (m_status.is_ok()) {
-    //   m_dec.set_quirk_enabled(WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_X, true);
-    // }
-  }
-
-  Result peek() { return peek_or_next(false); }
-  Result next() { return peek_or_next(true); }
-
- private:
-  Result peek_or_next(bool next) {
-    while (m_tok.meta.ri >= m_tok.meta.wi) {
-      if (m_status.repr == nullptr) {
-        // No-op.
-      } else if (m_status.repr == wuffs_base__suspension__short_read) {
-        if (m_curr_token_end_src_index != m_src.meta.ri) {
-          return Result(
-              "TokenStream: internal error: inconsistent src indexes");
-        }
-        const char* z = read_src();
-        m_curr_token_end_src_index = m_src.meta.ri;
-        if (z) {
-          return Result(z);
-        }
-      } else if (m_status.repr == wuffs_base__suspension__short_write) {
-        m_tok.compact();
-      } else {
-        return Result(m_status.message());
-      }
+  Tape() : m_num_nodes(0) {}
 
-      m_status =
-          m_dec.decode_tokens(&m_tok, &m_src,
-                              wuffs_base__make_slice_u8(
-                                  m_work_buffer_array, WORK_BUFFER_ARRAY_SIZE));
-    }
+  std::string load(int input_file_descriptor);
 
-    wuffs_base__token t = m_tok.data.ptr[m_tok.meta.ri];
-    size_t i = m_curr_token_end_src_index;
-    uint64_t n = t.length();
-    if ((m_src.meta.ri < i) || ((m_src.meta.ri - i) < n)) {
-      return Result("TokenStream: internal error: inconsistent src indexes");
-    }
-    if (next) {
-      m_tok.meta.ri++;
-      m_curr_token_end_src_index += n;
-    }
-    return Result("", t, wuffs_base__make_slice_u8(m_src.data.ptr + i, n));
-  }
+  size_t size() const { return m_num_nodes; }
+  const wuffs_base__tape_node& operator[](size_t i) const { return m_nodes[i]; }
 
-  const char*  //
-  read_src() {
-    if (m_src.meta.closed) {
-      return "main: internal error: read requested on a closed source";
-    }
-    m_src.compact();
-    if (m_src.meta.wi >= m_src.data.len) {
-      return "main: src buffer is full";
-    }
-    while (true) {
-      ssize_t n = read(m_input_file_descriptor, m_src.data.ptr + m_src.meta.wi,
-                       m_src.data.len - m_src.meta.wi);
-      if (n >= 0) {
-        m_src.meta.wi += n;
-        m_src.meta.closed = n == 0;
-        break;
-      } else if (errno != EINTR) {
-        return strerror(errno);
-      }
-    }
-    return nullptr;
-  }
+ private:
+  std::string read_src(int input_file_descriptor);
 
-  wuffs_base__status m_status;
-  wuffs_base__io_buffer m_src;
-  wuffs_base__token_buffer m_tok;
-  int m_input_file_descriptor;
-  // m_curr_token_end_src_index is the m_src.data.ptr index of the end of the
-  // current token. An invariant is that (m_curr_token_end_src_index <=
-  // m_src.meta.ri).
-  size_t m_curr_token_end_src_index;
+  std::vector<uint8_t> m_src;
+  std::vector<wuffs_base__tape_node> m_nodes;
+  std::vector<std::vector<uint8_t>> m_arenas;
+  size_t m_num_nodes;
 
   wuffs_base__token m_tok_array[TOKEN_BUFFER_ARRAY_SIZE];
-  uint8_t m_src_array[SRC_BUFFER_ARRAY_SIZE];
 #if WORK_BUFFER_ARRAY_SIZE > 0
   uint8_t m_work_buffer_array[WORK_BUFFER_ARRAY_SIZE];
 #else
   // Not all C/C++ compilers support 0-length arrays.
   uint8_t m_work_buffer_array[1];
 #endif
-  wuffs_json__decoder m_dec;
 };
 
-// ----
-
-class JsonThing {
- public:
-  struct Result;
-
-  using Vector = std::vector<JsonThing>;
+using JsonDecoderPool =
+    wuffs_aux::decoder_pool<wuffs_json__decoder, sizeof__wuffs_json__decoder>;
 
-  // We use a std::map in this example program to avoid dependencies outside of
-  // the C++ standard library. If you're copy/pasting this JsonThing code,
-  // consider a more efficient data structure such as an absl::btree_map.
-  //
-  // See CppCon 2014: Chandler Carruth "Efficiency with Algorithms, Performance
-  // with Data Structures" at https://www.youtube.com/watch?v=fHNmRkzxHWs
-  using Map = std::map<std::string, JsonThing>;
-
-  enum class Kind {
-    Null,
-    Bool,
-    Int64,
-    Float64,
-    String,
-    Array,
-    Object,
-  } kind = Kind::Null;
-
-  struct Value {
-    bool b = false;
-    int64_t i = 0;
-    double f = 0;
-    std::string s;
-    Vector a;
-    Map o;
-  } value;
-
-  static JsonThing::Result parse(TokenStream& ts);
-
- private:
-  static JsonThing::Result parse_array(TokenStream& ts);
-  static JsonThing::Result parse_literal(TokenStream::Result tsr);
-  static JsonThing::Result parse_number(TokenStream::Result tsr);
-  static JsonThing::Result parse_object(TokenStream& ts);
-  static JsonThing::Result parse_string(TokenStream& ts,
-                                        TokenStream::Result tsr);
-};
-
-struct JsonThing::Result {
-  std::string status_msg;
-  JsonThing thing;
-
-  Result(std::string s) : status_msg(s), thing(JsonThing()) {}
-
-  Result(std::string s, JsonThing t) : status_msg(s), thing(t) {}
-};
-
-JsonThing::Result  //
-JsonThing::parse(TokenStream& ts) {
+std::string  //
+Tape::read_src(int input_file_descriptor) {
   while (true) {
-    TokenStream::Result tsr = ts.next();
-    if (!tsr.status_msg.empty()) {
-      return Result(std::move(tsr.status_msg));
+    size_t n0 = m_src.size();
+    m_src.resize(n0 + SRC_READ_SIZE);
+    ssize_t n = read(input_file_descriptor, m_src.data() + n0, SRC_READ_SIZE);
+    if (n >= 0) {
+      m_src.resize(n0 + n);
+      if (n == 0) {
+        return "";
+      }
+    } else if (errno != EINTR) {
+      m_src.resize(n0);
+      return strerror(errno);
+    } else {
+      m_src.resize(n0);
     }
+  }
+}
 
-    int64_t vbc = tsr.token.value_base_category();
-    uint64_t vbd = tsr.token.value_base_detail();
-    switch (vbc) {
-      case WUFFS_BASE__TOKEN__VBC__FILLER:
-        continue;
-      case WUFFS_BASE__TOKEN__VBC__STRUCTURE:
-        if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__PUSH) {
-          if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_LIST) {
-            return parse_array(ts);
-          } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_DICT) {
-            return parse_object(ts);
+std::string  //
+Tape::load(int input_file_descriptor) {
+  TRY(read_src(input_file_descriptor));
+
+  // A one-shot program doesn't gain much from pooling its one decoder, but a
+  // long-running service that decodes many inputs, on many threads, would.
+  JsonDecoderPool::handle dec = JsonDecoderPool::acquire(0);
+  if (!dec) {
+    return "main: out of memory";
+  }
+
+  // Uncomment this line to enable the WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_X
+  // option. The tape builder converts "\x"-escaped strings to bytes.
+  //
+  // dec->set_quirk_enabled(WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_X, true);
+
+  wuffs_aux::input_span src(m_src);
+  wuffs_base__token_buffer tok = wuffs_base__slice_token__writer(
+      wuffs_base__make_slice_token(m_tok_array, TOKEN_BUFFER_ARRAY_SIZE));
+
+  // Without QUIRK_REPLACE_INVALID_UNICODE, converted strings are no longer
+  // than their source, so the first arena is (more than) enough. The nodes
+  // start small and grow (by copying) as needed.
+  wuffs_base__tape_builder builder;
+  builder.initialize(src.slice());
+  m_nodes.resize(1024);
+  m_arenas.emplace_back(m_src.size());
+  builder.set_nodes(
+      wuffs_base__make_slice_tape_node(m_nodes.data(), m_nodes.size()));
+  builder.set_arena(wuffs_base__make_slice_u8(m_arenas.back().data(),
+                                              m_arenas.back().size()));
+
+  // The src is entirely in memory, so decode_tokens never needs to refill or
+  // compact it, and the tape's strings can point directly into m_src.
+  wuffs_base__status status = wuffs_aux::decode_tokens(
+      dec.get(), &tok, src,
+      wuffs_base__make_slice_u8(m_work_buffer_array, WORK_BUFFER_ARRAY_SIZE),
+      [this, &builder](wuffs_base__token_buffer* tok,
+                       wuffs_base__io_buffer*) -> wuffs_base__status {
+        while (true) {
+          wuffs_base__status z = builder.append_tokens(tok);
+          if (z.repr != wuffs_base__error__bad_argument_length_too_short) {
+            return z;
+          } else if (builder.nodes().len >= m_nodes.size()) {
+            std::vector<wuffs_base__tape_node> nodes(2 * m_nodes.size());
+            builder.set_nodes(
+                wuffs_base__make_slice_tape_node(nodes.data(), nodes.size()));
+            m_nodes.swap(nodes);
+          } else {
+            // Completed nodes still point into the previous arenas, so keep
+            // them.
+            m_arenas.emplace_back(4096 + 2 * m_arenas.back().size());
+            z = builder.set_arena(wuffs_base__make_slice_u8(
+                m_arenas.back().data(), m_arenas.back().size()));
+            if (!z.is_ok()) {
+              return z;
+            }
           }
         }
-        break;
-      case WUFFS_BASE__TOKEN__VBC__STRING:
-        return parse_string(ts, tsr);
-      case WUFFS_BASE__TOKEN__VBC__LITERAL:
-        return parse_literal(tsr);
-      case WUFFS_BASE__TOKEN__VBC__NUMBER:
-        return parse_number(tsr);
-    }
-
-    return Result("main: internal error: unexpected token");
+      });
+  if (!status.is_ok()) {
+    return status.message();
+  } else if (!builder.is_complete()) {
+    return "main: internal error: incomplete tape";
   }
+  m_num_nodes = builder.nodes().len;
+  return "";
 }
 
-JsonThing::Result  //
-JsonThing::parse_array(TokenStream& ts) {
-  JsonThing jt;
-  jt.kind = Kind::Array;
-  while (true) {
-    TokenStream::Result tsr = ts.peek();
-    if (!tsr.status_msg.empty()) {
-      return Result(std::move(tsr.status_msg));
-    }
-    int64_t vbc = tsr.token.value_base_category();
-    uint64_t vbd = tsr.token.value_base_detail();
-    if (vbc == WUFFS_BASE__TOKEN__VBC__FILLER) {
-      ts.next();
-      continue;
-    } else if ((vbc == WUFFS_BASE__TOKEN__VBC__STRUCTURE) &&
-               (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__POP)) {
-      ts.next();
-      break;
-    }
+// ----
 
-    JsonThing::Result jtr = JsonThing::parse(ts);
-    if (!jtr.status_msg.empty()) {
-      return Result(std::move(jtr.status_msg));
-    }
-    jt.value.a.push_back(std::move(jtr.thing));
-  }
-  return Result("", jt);
+// g_sorted_keys holds, for each dict node, the number of its keys followed by
+// their tape indexes in sorted order. For the dict node at tape index i, that
+// number is at g_sorted_keys[g_sorted_keys_begin[i]].
+std::vector<uint32_t> g_sorted_keys;
+std::vector<uint32_t> g_sorted_keys_begin;
+
+bool  //
+key_less(const Tape& tape, uint32_t a, uint32_t b) {
+  const wuffs_base__slice_u8& x = tape[a].data;
+  const wuffs_base__slice_u8& y = tape[b].data;
+  int c = memcmp(x.ptr, y.ptr, (x.len < y.len) ? x.len : y.len);
+  return (c != 0) ? (c < 0) : (x.len < y.len);
 }
 
-JsonThing::Result  //
-JsonThing::parse_literal(TokenStream::Result tsr) {
-  uint64_t vbd = tsr.token.value_base_detail();
-  if (vbd & WUFFS_BASE__TOKEN__VBD__LITERAL__NULL) {
-    JsonThing jt;
-    jt.kind = Kind::Null;
-    return Result("", jt);
-  } else if (vbd & WUFFS_BASE__TOKEN__VBD__LITERAL__FALSE) {
-    JsonThing jt;
-    jt.kind = Kind::Bool;
-    jt.value.b = false;
-    return Result("", jt);
-  } else if (vbd & WUFFS_BASE__TOKEN__VBD__LITERAL__TRUE) {
-    JsonThing jt;
-    jt.kind = Kind::Bool;
-    jt.value.b = true;
-    return Result("", jt);
-  }
-  return Result("main: internal error: unexpected token");
+bool  //
+key_equal(const Tape& tape, uint32_t a, uint32_t b) {
+  const wuffs_base__slice_u8& x = tape[a].data;
+  const wuffs_base__slice_u8& y = tape[b].data;
+  return (x.len == y.len) && !memcmp(x.ptr, y.ptr, x.len);
+}
+
+std::string  //
+key_string(const Tape& tape, uint32_t i) {
+  const char* ptr =  // Convert from (uint8_t*).
+      static_cast<const char*>(static_cast<void*>(tape[i].data.ptr));
+  return std::string(ptr, tape[i].data.len);
 }
 
-JsonThing::Result  //
-JsonThing::parse_number(TokenStream::Result tsr) {
+std::string  //
+validate_number(const wuffs_base__tape_node& node) {
   // Parsing the number from its string representation (converting from "123"
-  // to 123) isn't necessary for the jsonfindptrs program, but if you're
-  // copy/pasting this JsonThing code, here's how to do it.
-  uint64_t vbd = tsr.token.value_base_detail();
-  if (vbd & WUFFS_BASE__TOKEN__VBD__NUMBER__FORMAT_TEXT) {
-    if (vbd & WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_INTEGER_SIGNED) {
+  // to 123) isn't necessary for the jsonfindptrs program, other than to
+  // reject out-of-range integers, but if you're copy/pasting this code,
+  // here's how to do it.
+  uint32_t detail = node.detail();
+  if (detail & WUFFS_BASE__TOKEN__VBD__NUMBER__FORMAT_TEXT) {
+    if (detail & WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_INTEGER_SIGNED) {
       static constexpr int64_t m = 0x001FFFFFFFFFFFFF;  // ((1<<53) - 1).
-      wuffs_base__result_i64 r = wuffs_base__parse_number_i64(tsr.src_data);
+      wuffs_base__result_i64 r = wuffs_base__parse_number_i64(node.data);
       if (!r.status.is_ok()) {
-        return Result(r.status.message());
+        return r.status.message();
       } else if ((r.value < -m) || (+m < r.value)) {
-        return Result(wuffs_base__error__out_of_bounds);
+        return wuffs_base__error__out_of_bounds;
       }
-      JsonThing jt;
-      jt.kind = Kind::Int64;
-      jt.value.i = r.value;
-      return Result("", jt);
-    } else if (vbd & WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_FLOATING_POINT) {
-      wuffs_base__result_f64 r = wuffs_base__parse_number_f64(tsr.src_data);
+      return "";
+    } else if (detail &
+               WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_FLOATING_POINT) {
+      wuffs_base__result_f64 r = wuffs_base__parse_number_f64(node.data);
       if (!r.status.is_ok()) {
-        return Result(r.status.message());
+        return r.status.message();
       }
-      JsonThing jt;
-      jt.kind = Kind::Float64;
-      jt.value.f = r.value;
-      return Result("", jt);
+      return "";
     }
   }
-  return Result("main: internal error: unexpected number");
+  return "main: internal error: unexpected number";
 }
 
-JsonThing::Result  //
-JsonThing::parse_object(TokenStream& ts) {
-  JsonThing jt;
-  jt.kind = Kind::Object;
-
-  std::string key;
-  bool have_key = false;
-
-  while (true) {
-    TokenStream::Result tsr = ts.peek();
-    if (!tsr.status_msg.empty()) {
-      return Result(std::move(tsr.status_msg));
-    }
-    int64_t vbc = tsr.token.value_base_category();
-    uint64_t vbd = tsr.token.value_base_detail();
-    if (vbc == WUFFS_BASE__TOKEN__VBC__FILLER) {
-      ts.next();
+// validate walks the tape (in tape order, not recursively), rejecting
+// out-of-range numbers and duplicate keys, and sorting each dict's keys.
+std::string  //
+validate(const Tape& tape) {
+  g_sorted_keys.clear();
+  g_sorted_keys_begin.assign(tape.size(), 0);
+  for (uint32_t i = 0; i < tape.size(); i++) {
+    const wuffs_base__tape_node& node = tape[i];
+    if (node.kind() == WUFFS_BASE__TAPE_NODE__KIND__NUMBER) {
+      TRY(validate_number(node));
+      continue;
+    } else if (node.kind() != WUFFS_BASE__TAPE_NODE__KIND__DICT) {
       continue;
-    } else if ((vbc == WUFFS_BASE__TOKEN__VBC__STRUCTURE) &&
-               (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__POP)) {
-      ts.next();
-      break;
-    }
-
-    JsonThing::Result jtr = JsonThing::parse(ts);
-    if (!jtr.status_msg.empty()) {
-      return Result(std::move(jtr.status_msg));
     }
 
-    if (have_key) {
-      have_key = false;
-      auto iter = jt.value.o.find(key);
-      if (iter == jt.value.o.end()) {
-        jt.value.o.insert(
-            iter, Map::value_type(std::move(key), std::move(jtr.thing)));
-      } else {
-        return Result("main: duplicate key: " + key);
+    // A dict's children alternate between keys (each a single node) and
+    // values (each a sub-tree).
+    g_sorted_keys_begin[i] = (uint32_t)(g_sorted_keys.size());
+    g_sorted_keys.push_back(0);
+    size_t begin = g_sorted_keys.size();
+    for (uint32_t j = i + 1; j < i + node.skip; j += 1 + tape[j + 1].skip) {
+      if ((tape[j].kind() != WUFFS_BASE__TAPE_NODE__KIND__STRING) ||
+          ((j + 1) >= (i + node.skip))) {
+        return "main: internal error: unexpected non-string key";
       }
-    } else if (jtr.thing.kind == Kind::String) {
-      have_key = true;
-      key = std::move(jtr.thing.value.s);
-    } else {
-      return Result("main: internal error: unexpected non-string key");
+      g_sorted_keys.push_back(j);
     }
-  }
-  if (have_key) {
-    return Result("main: internal error: unpaired key");
-  }
-  return Result("", jt);
-}
-
-JsonThing::Result  //
-JsonThing::parse_string(TokenStream& ts, TokenStream::Result tsr) {
-  JsonThing jt;
-  jt.kind = Kind::String;
-  while (true) {
-    int64_t vbc = tsr.token.value_base_category();
-    uint64_t vbd = tsr.token.value_base_detail();
-
-    switch (vbc) {
-      case WUFFS_BASE__TOKEN__VBC__STRING: {
-        if (vbd & WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_0_DST_1_SRC_DROP) {
-          // No-op.
-
-        } else if (vbd &
-                   WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY) {
-          const char* ptr =  // Convert from (uint8_t*).
-              static_cast<const char*>(static_cast<void*>(tsr.src_data.ptr));
-          jt.value.s.append(ptr, tsr.src_data.len);
-
-        } else if (
-            vbd &
-            WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_4_SRC_BACKSLASH_X) {
-          // We shouldn't get here unless we enable the
-          // WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_X option. The jsonfindptrs
-          // program doesn't enable that by default, but if you're copy/pasting
-          // this JsonThing code and your program does enable that option,
-          // here's how to handle it.
-          //
-          // As per the quirk documentation, there are two options for how to
-          // interpret a backslash-x: as a byte or as a Unicode code point.
-          // This implementation chooses as a byte.
-          wuffs_base__slice_u8 encoded = tsr.src_data;
-          if (encoded.len & 3) {
-            return Result(
-                "main: internal error: \\x token length not a multiple of 4",
-                JsonThing());
-          }
-          while (encoded.len) {
-            uint8_t decoded[64];
-            size_t len = wuffs_base__hexadecimal__decode4(
-                wuffs_base__make_slice_u8(&decoded[0], 64), encoded);
-            if ((len > 64) || ((len * 4) > encoded.len)) {
-              return Result(
-                  "main: internal error: inconsistent hexadecimal decoding",
-                  JsonThing());
-            }
-            const char* ptr =  // Convert from (uint8_t*).
-                static_cast<const char*>(static_cast<void*>(&decoded[0]));
-            jt.value.s.append(ptr, len);
-            encoded.ptr += len * 4;
-            encoded.len -= len * 4;
-          }
-
-        } else {
-          return Result(
-              "main: internal error: unexpected string-token conversion",
-              JsonThing());
-        }
-        break;
+    g_sorted_keys[begin - 1] = (uint32_t)(g_sorted_keys.size() - begin);
+    std::sort(g_sorted_keys.begin() + begin, g_sorted_keys.end(),
+              [&tape](uint32_t a, uint32_t b) { return key_less(tape, a, b); });
+    for (size_t k = begin + 1; k < g_sorted_keys.size(); k++) {
+      if (key_equal(tape, g_sorted_keys[k - 1], g_sorted_keys[k])) {
+        return "main: duplicate key: " + key_string(tape, g_sorted_keys[k]);
       }
-
-      case WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT: {
-        uint8_t u[WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL];
-        size_t n = wuffs_base__utf_8__encode(
-            wuffs_base__make_slice_u8(&u[0],
-                                      WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL),
-            vbd);
-        const char* ptr =  // Convert from (uint8_t*).
-            static_cast<const char*>(static_cast<void*>(&u[0]));
-        jt.value.s.append(ptr, n);
-        break;
-      }
-
-      default:
-        return Result("main: internal error: unexpected token");
-    }
-
-    if (!tsr.token.continued()) {
-      break;
-    }
-    tsr = ts.next();
-    if (!tsr.status_msg.empty()) {
-      return Result(std::move(tsr.status_msg));
     }
   }
-  return Result("", jt);
+  return "";
 }
 
 // ----
@@ -728,29 +515,39 @@ escape_needed:
 }
 
 std::string  //
-print_json_pointers(JsonThing& jt, std::string s, uint32_t depth) {
-  std::cout << s << std::endl;
+print_json_pointers(const Tape& tape,
+                    uint32_t i,
+                    std::string s,
+                    uint32_t depth) {
+  std::cout << s << '\n';
   if (depth++ >= g_flags.max_output_depth) {
     return "";
   }
 
-  switch (jt.kind) {
-    case JsonThing::Kind::Array:
+  const wuffs_base__tape_node& node = tape[i];
+  switch (node.kind()) {
+    case WUFFS_BASE__TAPE_NODE__KIND__LIST: {
       s += "/";
-      for (size_t i = 0; i < jt.value.a.size(); i++) {
-        TRY(print_json_pointers(jt.value.a[i], s + std::to_string(i), depth));
+      size_t n = 0;
+      for (uint32_t j = i + 1; j < i + node.skip; j += tape[j].skip) {
+        TRY(print_json_pointers(tape, j, s + std::to_string(n++), depth));
       }
       break;
-    case JsonThing::Kind::Object:
+    }
+    case WUFFS_BASE__TAPE_NODE__KIND__DICT: {
       s += "/";
-      for (auto& kv : jt.value.o) {
-        std::string e = escape(kv.first);
-        if (e.empty() && !kv.first.empty()) {
+      const uint32_t* keys = &g_sorted_keys[g_sorted_keys_begin[i]];
+      for (uint32_t k = 1; k <= keys[0]; k++) {
+        uint32_t j = keys[k];
+        std::string key = key_string(tape, j);
+        std::string e = escape(key);
+        if (e.empty() && !key.empty()) {
           return "main: unsupported \"\\u000A\" or \"\\u000D\" in object key";
         }
-        TRY(print_json_pointers(kv.second, s + e, depth));
+        TRY(print_json_pointers(tape, j + 1, s + e, depth));
       }
       break;
+    }
     default:
       break;
   }
@@ -772,12 +569,12 @@ main1(int argc, char** argv) {
     }
   }
 
-  TokenStream ts(input_file_descriptor);
-  JsonThing::Result jtr = JsonThing::parse(ts);
-  if (!jtr.status_msg.empty()) {
-    return jtr.status_msg;
-  }
-  return print_json_pointers(jtr.thing, "", 0);
+  // The Tape is large (it contains arrays of tokens and of work buffer
+  // bytes) so allocate it on the heap, not the stack.
+  std::unique_ptr<Tape> tape(new Tape());
+  TRY(tape->load(input_file_descriptor));
+  TRY(validate(*tape));
+  return print_json_pointers(*tape, 0, "", 0);
 }
 
 // ----
@@ -31,7 +31,9 @@ One benefit of simplicity is that this program's JSON and JSON Pointer
 implementations do not dynamically allocate or free memory (yet it does not
 require that the entire input fits in memory at once). They are therefore
 trivially protected against certain bug classes: memory leaks, double-frees and
-use-after-frees.
+use-after-frees. The one exception is the -jobs=NUM flag (see the g_usage
+string), which allocates a fixed amount of memory once, up front, before any
+input is processed.
 
 The core JSON implementation is also written in the Wuffs programming language
 (and then transpiled to C/C++), which is memory-safe (e.g. array indexing is
@@ -89,7 +91,8 @@ it runs in a SECCOMP_MODE_STRICT sandbox.
 This example program differs from most other example Wuffs programs in that it
 is written in C++, not C.
 
-$CXX jsonptr.cc && ./a.out < ../../test/data/github-tags.json; rm -f a.out
+$CXX jsonptr.cc -lpthread && ./a.out < ../../test/data/github-tags.json; \
+rm -f a.out
 
 for a C++ compiler $CXX, such as clang++ or g++.
 */
@@ -100,8 +103,12 @@ for a C++ compiler $CXX, such as clang++ or g++.
 
 #include <errno.h>
 #include <fcntl.h>
+#include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 // Wuffs ships as a "single file C library" or "header file library" as per
@@ -153,6 +160,8 @@ static const char* g_usage =
     "    -c      -compact-output\n"
     "    -d=NUM  -max-output-depth=NUM\n"
     "    -i=NUM  -indent=NUM\n"
+    "    -j=NUM  -jobs=NUM\n"
+    "    -l      -json-lines\n"
     "    -q=STR  -query=STR\n"
     "    -s      -strict-json-pointer-syntax\n"
     "    -t      -tabs\n"
@@ -230,9 +239,25 @@ static const char* g_usage =
     "\n"
     "----\n"
     "\n"
+    "The -l or -json-lines flag treats the input as JSON Lines\n"
+    "(http://jsonlines.org/): a sequence of top-level values (records), each\n"
+    "followed by a new line. Each record is formatted (and, with -query,\n"
+    "queried) separately, and its output is followed by a new line. Combine\n"
+    "with -c / -compact-output to also write JSON Lines.\n"
+    "\n"
+    "The -j=NUM or -jobs=NUM flag (for NUM ranging from 1 to 64) only\n"
+    "affects -json-lines input from a named file. That file is memory-mapped,\n"
+    "split at new lines into chunks and the chunks are tokenized on NUM\n"
+    "worker threads, concurrently. The output is the same, and in the same\n"
+    "order, as without the flag, provided that no record spans multiple\n"
+    "lines. Lines longer than 192 KiB may be rejected.\n"
+    "\n"
+    "----\n"
+    "\n"
     "The -fail-if-unsandboxed flag causes the program to exit if it does not\n"
     "self-impose a sandbox. On Linux, it self-imposes a SECCOMP_MODE_STRICT\n"
-    "sandbox, regardless of whether this flag was set.";
+    "sandbox, regardless of whether this flag was set. With -jobs=NUM, each\n"
+    "worker thread also self-imposes that sandbox.";
 
 // ----
 
@@ -251,10 +276,21 @@ bool g_sandboxed = false;
 
 int g_input_file_descriptor = 0;  // A 0 default means stdin.
 
+// g_mmap_src_ptr and g_mmap_src_len, if non-zero, hold the entire input,
+// memory-mapped before the sandbox is self-imposed. See mmap_input.
+const uint8_t* g_mmap_src_ptr = nullptr;
+size_t g_mmap_src_len = 0;
+
 #define MAX_INDENT 8
+#define MAX_JOBS 64
 #define INDENT_SPACES_STRING "        "
 #define INDENT_TAB_STRING "\t"
 
+// The buffer sizes can be overridden at compile time, e.g. by passing
+// -DTOKEN_BUFFER_ARRAY_SIZE=16384 to the compiler. Larger buffers mean fewer
+// decode_tokens suspensions, but the benefit flattens out once the token
+// buffer holds a few thousand tokens. See "Buffer Sizes" in
+// doc/note/tokens.md.
 #ifndef DST_BUFFER_ARRAY_SIZE
 #define DST_BUFFER_ARRAY_SIZE (32 * 1024)
 #endif
@@ -298,6 +334,14 @@ in_dict_before_key() {
 uint32_t g_suppress_write_dst;
 bool g_wrote_to_dst;
 
+// g_record_done is whether, in -json-lines mode, the current record's output
+// is complete. Its remaining tokens are then ignored.
+bool g_record_done;
+
+// g_compact_fast_path is whether to use handle_tokens_compact instead of
+// handle_token. See initialize_globals for when it applies.
+bool g_compact_fast_path;
+
 wuffs_json__decoder g_dec;
 
 // ----
@@ -393,6 +437,8 @@ class Query {
 
   void restart_fragment(bool enable) { m_frag_j = enable ? m_frag_i : nullptr; }
 
+  uint32_t depth() { return m_depth; }
+
   bool is_at(uint32_t depth) { return m_depth == depth; }
 
   // tick returns whether the fragment is a valid array index whose value is
@@ -558,6 +604,8 @@ struct {
   bool compact_output;
   bool fail_if_unsandboxed;
   size_t indent;
+  uint32_t jobs;
+  bool json_lines;
   uint32_t max_output_depth;
   char* query_c_string;
   bool strict_json_pointer_syntax;
@@ -621,6 +669,22 @@ parse_flags(int argc, char** argv) {
       }
       return g_usage;
     }
+    if (!strncmp(arg, "j=", 2) || !strncmp(arg, "jobs=", 5)) {
+      while (*arg++ != '=') {
+      }
+      wuffs_base__result_u64 u = wuffs_base__parse_number_u64(
+          wuffs_base__make_slice_u8((uint8_t*)arg, strlen(arg)));
+      if (wuffs_base__status__is_ok(&u.status) && (u.value >= 1) &&
+          (u.value <= MAX_JOBS)) {
+        g_flags.jobs = (uint32_t)(u.value);
+        continue;
+      }
+      return g_usage;
+    }
+    if (!strcmp(arg, "l") || !strcmp(arg, "json-lines")) {
+      g_flags.json_lines = true;
+      continue;
+    }
     if (!strncmp(arg, "q=", 2) || !strncmp(arg, "query=", 6)) {
       while (*arg++ != '=') {
       }
@@ -650,15 +714,38 @@ parse_flags(int argc, char** argv) {
   return nullptr;
 }
 
+// start_top_level_value resets the state that is per top-level value: once
+// per input, or once per record in -json-lines mode.
+void  //
+start_top_level_value() {
+  g_depth = 0;
+  g_ctx = context::none;
+  g_record_done = false;
+
+  g_query.reset(g_flags.query_c_string);
+
+  // If the query is non-empty, suprress writing to stdout until we've
+  // completed the query.
+  g_suppress_write_dst = g_query.next_fragment() ? 1 : 0;
+}
+
 const char*  //
 initialize_globals(int argc, char** argv) {
   g_dst = wuffs_base__make_io_buffer(
       wuffs_base__make_slice_u8(g_dst_array, DST_BUFFER_ARRAY_SIZE),
       wuffs_base__empty_io_buffer_meta());
 
-  g_src = wuffs_base__make_io_buffer(
-      wuffs_base__make_slice_u8(g_src_array, SRC_BUFFER_ARRAY_SIZE),
-      wuffs_base__empty_io_buffer_meta());
+  // A memory-mapped input is a closed g_src that already holds the entire
+  // input, so that read_src (and its compaction) is never needed and the
+  // decoder can stay in its fast loops until close to the end of the input.
+  // The mapping is read-only, but Wuffs' io_reader never writes to g_src.
+  g_src =
+      g_mmap_src_ptr
+          ? wuffs_base__ptr_u8__reader(const_cast<uint8_t*>(g_mmap_src_ptr),
+                                       g_mmap_src_len, true)
+          : wuffs_base__make_io_buffer(
+                wuffs_base__make_slice_u8(g_src_array, SRC_BUFFER_ARRAY_SIZE),
+                wuffs_base__empty_io_buffer_meta());
 
   g_tok = wuffs_base__make_token_buffer(
       wuffs_base__make_slice_token(g_tok_array, TOKEN_BUFFER_ARRAY_SIZE),
@@ -666,10 +753,6 @@ initialize_globals(int argc, char** argv) {
 
   g_curr_token_end_src_index = 0;
 
-  g_depth = 0;
-
-  g_ctx = context::none;
-
   TRY(parse_flags(argc, argv));
   if (g_flags.fail_if_unsandboxed && !g_sandboxed) {
     return "main: unsandboxed";
@@ -680,15 +763,14 @@ initialize_globals(int argc, char** argv) {
     return g_usage;
   }
 
-  g_query.reset(g_flags.query_c_string);
-
-  // If the query is non-empty, suprress writing to stdout until we've
-  // completed the query.
-  g_suppress_write_dst = g_query.next_fragment() ? 1 : 0;
+  start_top_level_value();
   g_wrote_to_dst = false;
 
   TRY(g_dec.initialize(sizeof__wuffs_json__decoder(), WUFFS_VERSION, 0)
           .message());
+  if (g_flags.json_lines) {
+    g_dec.set_quirk_enabled(WUFFS_JSON__QUIRK_ALLOW_JSON_LINES, true);
+  }
 
   // Consume an optional whitespace trailer. This isn't part of the JSON spec,
   // but it works better with line oriented Unix tools (such as "echo 123 |
@@ -696,6 +778,12 @@ initialize_globals(int argc, char** argv) {
   // can accidentally contain trailing whitespace.
   g_dec.set_quirk_enabled(WUFFS_JSON__QUIRK_ALLOW_TRAILING_NEW_LINE, true);
 
+  // Plain -compact-output, with no -query or -max-output-depth to select
+  // which parts of the input to write, is just minification.
+  g_compact_fast_path = g_flags.compact_output && !g_flags.json_lines &&
+                        (g_flags.max_output_depth == 0xFFFFFFFF) &&
+                        !(g_flags.query_c_string && *g_flags.query_c_string);
+
   return nullptr;
 }
 
@@ -837,12 +925,25 @@ handle_unicode_code_point(uint32_t ucp) {
   return "main: internal error: unexpected Unicode code point";
 }
 
+// is_string_copy returns whether t is a string token whose source bytes
+// convert verbatim to the destination.
+inline bool  //
+is_string_copy(wuffs_base__token t) {
+  return (t.value_base_category() == WUFFS_BASE__TOKEN__VBC__STRING) &&
+         (t.value_base_detail() &
+          WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY);
+}
+
+// handle_token handles the token t, whose source bytes are the len bytes
+// ending at g_curr_token_end_src_index. The len can exceed t.length() when the
+// caller has coalesced a run of string-copy tokens (see
+// wuffs_base__token_buffer__reader_copy_run), in which case t is the last
+// token of that run.
 const char*  //
-handle_token(wuffs_base__token t, bool start_of_token_chain) {
+handle_token(wuffs_base__token t, uint64_t len, bool start_of_token_chain) {
   do {
     int64_t vbc = t.value_base_category();
     uint64_t vbd = t.value_base_detail();
-    uint64_t len = t.length();
 
     // Handle ']' or '}'.
     if ((vbc == WUFFS_BASE__TOKEN__VBC__STRUCTURE) &&
@@ -1029,42 +1130,530 @@ after_value:
   return nullptr;
 }
 
+// end_record is called, in -json-lines mode, when handle_token returns g_eod.
+// Each record's output is followed by a "\n".
+const char*  //
+end_record() {
+  g_record_done = true;
+  if (g_wrote_to_dst) {
+    TRY(write_dst("\n", 1));
+    g_wrote_to_dst = false;
+  }
+  return nullptr;
+}
+
+// handle_tokens_compact handles all of g_tok's readable tokens, like calling
+// handle_token on each of them, when g_compact_fast_path is in effect. The
+// output is then the input minus its whitespace, other than backslash-escaped
+// strings being canonicalized, since ',' and ':' are their own filler tokens
+// and the other non-whitespace tokens are written verbatim. This function
+// writes each contiguous span of verbatim source bytes with a single write_dst
+// call, instead of dispatching per token. Like handle_token, it returns g_eod
+// at the end of the top-level value.
+const char*  //
+handle_tokens_compact() {
+  // The source bytes in [span_start, g_curr_token_end_src_index) have been
+  // handled but not yet written.
+  size_t span_start = g_curr_token_end_src_index;
+  while (g_tok.meta.ri < g_tok.meta.wi) {
+    wuffs_base__token t = g_tok.data.ptr[g_tok.meta.ri++];
+    int64_t vbc = t.value_base_category();
+    uint64_t vbd = t.value_base_detail();
+    uint64_t n = t.length();
+    if ((g_src.meta.ri - g_curr_token_end_src_index) < n) {
+      return "main: internal error: inconsistent g_src indexes";
+    }
+    uint8_t* ptr = g_src.data.ptr + g_curr_token_end_src_index;
+    g_curr_token_end_src_index += n;
+
+    bool verbatim = true;
+    switch (vbc) {
+      case WUFFS_BASE__TOKEN__VBC__FILLER:
+        verbatim = (n == 1) && ((*ptr == ',') || (*ptr == ':'));
+        break;
+      case WUFFS_BASE__TOKEN__VBC__STRUCTURE:
+        if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__PUSH) {
+          g_depth++;
+        } else if (g_depth > 0) {
+          g_depth--;
+        }
+        break;
+      case WUFFS_BASE__TOKEN__VBC__STRING:
+        // Other than its copied bytes, a string's source bytes are its
+        // dropped '"' quotes.
+        if (!(vbd & WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY) &&
+            ((n != 1) || (*ptr != '"'))) {
+          return "main: internal error: unexpected string-token conversion";
+        }
+        break;
+      case WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT:
+        verbatim = false;
+        break;
+      case WUFFS_BASE__TOKEN__VBC__LITERAL:
+      case WUFFS_BASE__TOKEN__VBC__NUMBER:
+        break;
+      default:
+        return "main: internal error: unexpected token";
+    }
+
+    if (!verbatim) {
+      TRY(write_dst(g_src.data.ptr + span_start,
+                    ptr - g_src.data.ptr - span_start));
+      span_start = g_curr_token_end_src_index;
+      if (vbc == WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT) {
+        TRY(handle_unicode_code_point(vbd));
+      }
+    } else if ((g_depth == 0) && !t.continued() &&
+               (vbc != WUFFS_BASE__TOKEN__VBC__FILLER)) {
+      TRY(write_dst(g_src.data.ptr + span_start,
+                    g_curr_token_end_src_index - span_start));
+      return g_eod;
+    }
+  }
+  return write_dst(g_src.data.ptr + span_start,
+                   g_curr_token_end_src_index - span_start);
+}
+
+// ----
+
+// The -jobs=NUM flag splits a memory-mapped -json-lines file into chunks.
+// Each chunk is a whole number of lines, of at least JOB_CHUNK_SIZE bytes
+// (other than the final chunk) and at most JOB_CHUNK_SIZE_MAX_INCL bytes.
+//
+// Worker threads tokenize the chunks, each with its own decoder, into job
+// slots. The main thread then handles each slot's tokens in order, as if they
+// came from a single decoder. There are two slots per worker, so that workers
+// can tokenize one chunk while the main thread handles another.
+//
+// Each worker self-imposes a SECCOMP_MODE_STRICT sandbox, which does not allow
+// futexes (and hence mutexes or condition variables). The main thread instead
+// sends each worker slot indexes, and receives them back when done, over a
+// pair of pipes.
+
+#define JOB_CHUNK_SIZE (64 * 1024)
+#define JOB_CHUNK_SIZE_MAX_INCL (256 * 1024)
+#define JOB_QUIT 0xFFFFFFFF
+
+struct JobSlot {
+  // These fields are set by the main thread.
+  const uint8_t* src_ptr;
+  size_t src_len;
+  bool dispatched;
+
+  // These fields are set by the worker thread, if dispatched. A record ends
+  // (and the next record starts) after record_ends[i] tokens.
+  const char* status_msg;
+  size_t num_tokens;
+  size_t num_records;
+  wuffs_base__token tokens[JOB_CHUNK_SIZE_MAX_INCL];
+  uint32_t record_ends[JOB_CHUNK_SIZE_MAX_INCL / 2];
+};
+
+struct JobWorker {
+  pthread_t thread;
+  int req_fds[2];
+  int done_fds[2];
+  wuffs_json__decoder dec;
+};
+
+JobSlot* g_job_slots;
+uint32_t g_num_job_slots;
+
+JobWorker g_job_workers[MAX_JOBS];
+uint32_t g_num_job_workers;  // Zero means that -jobs=NUM is not in effect.
+
+bool  //
+read_u32(int fd, uint32_t* x) {
+  while (true) {
+    ssize_t n = read(fd, x, sizeof(*x));
+    if (n == sizeof(*x)) {
+      return true;
+    } else if ((n >= 0) || (errno != EINTR)) {
+      return false;
+    }
+  }
+}
+
+bool  //
+write_u32(int fd, uint32_t x) {
+  while (true) {
+    ssize_t n = write(fd, &x, sizeof(x));
+    if (n == sizeof(x)) {
+      return true;
+    } else if ((n >= 0) || (errno != EINTR)) {
+      return false;
+    }
+  }
+}
+
+void  //
+tokenize_job_slot(wuffs_json__decoder* dec, JobSlot* slot) {
+  slot->status_msg = nullptr;
+  slot->num_tokens = 0;
+  slot->num_records = 0;
+
+  wuffs_base__status status =
+      dec->initialize(sizeof__wuffs_json__decoder(), WUFFS_VERSION, 0);
+  if (!status.is_ok()) {
+    slot->status_msg = status.message();
+    return;
+  }
+  dec->set_quirk_enabled(WUFFS_JSON__QUIRK_ALLOW_JSON_LINES, true);
+
+  wuffs_base__io_buffer src = wuffs_base__make_io_buffer(
+      wuffs_base__make_slice_u8(const_cast<uint8_t*>(slot->src_ptr),
+                                slot->src_len),
+      wuffs_base__make_io_buffer_meta(slot->src_len, 0, 0, true));
+  wuffs_base__token_buffer tok = wuffs_base__make_token_buffer(
+      wuffs_base__make_slice_token(slot->tokens, JOB_CHUNK_SIZE_MAX_INCL),
+      wuffs_base__empty_token_buffer_meta());
+
+  while (true) {
+    status = dec->decode_tokens(
+        &tok, &src,
+        wuffs_base__make_slice_u8(g_work_buffer_array, WORK_BUFFER_ARRAY_SIZE));
+    if (status.repr == nullptr) {
+      if (slot->num_records >= (JOB_CHUNK_SIZE_MAX_INCL / 2)) {
+        slot->status_msg = "main: too many records for -jobs";
+        break;
+      }
+      slot->record_ends[slot->num_records++] = (uint32_t)(tok.meta.wi);
+      continue;
+    } else if (status.repr == wuffs_base__note__end_of_data) {
+      break;
+    } else if (status.repr == wuffs_base__suspension__short_write) {
+      slot->status_msg = "main: token buffer is full for -jobs";
+      break;
+    }
+    slot->status_msg = status.message();
+    break;
+  }
+  slot->num_tokens = tok.meta.wi;
+}
+
+void*  //
+job_worker_main(void* arg) {
+  JobWorker* w = static_cast<JobWorker*>(arg);
+#if defined(WUFFS_EXAMPLE_USE_SECCOMP)
+  prctl(PR_SET_SECCOMP, SECCOMP_MODE_STRICT);
+#endif
+
+  uint32_t i;
+  while (read_u32(w->req_fds[0], &i) && (i < g_num_job_slots)) {
+    tokenize_job_slot(&w->dec, &g_job_slots[i]);
+    if (!write_u32(w->done_fds[1], i)) {
+      break;
+    }
+  }
+
+#if defined(WUFFS_EXAMPLE_USE_SECCOMP)
+  // As for the main thread, SECCOMP_MODE_STRICT allows only SYS_exit.
+  syscall(SYS_exit, 0);
+#endif
+  return nullptr;
+}
+
+// mmap_input is called before the main thread self-imposes a sandbox. It
+// memory-maps the input, if it is a non-empty regular file read from its
+// start. On failure, it leaves g_mmap_src_ptr as nullptr, falling back to
+// read_src.
+void  //
+mmap_input() {
+  struct stat st;
+  if ((fstat(g_input_file_descriptor, &st) != 0) || !S_ISREG(st.st_mode) ||
+      (st.st_size <= 0) || ((uint64_t)(st.st_size) > SIZE_MAX) ||
+      (lseek(g_input_file_descriptor, 0, SEEK_CUR) != 0)) {
+    return;
+  }
+  void* ptr = mmap(nullptr, (size_t)(st.st_size), PROT_READ, MAP_SHARED,
+                   g_input_file_descriptor, 0);
+  if (ptr == MAP_FAILED) {
+    return;
+  }
+  g_mmap_src_ptr = static_cast<const uint8_t*>(ptr);
+  g_mmap_src_len = (size_t)(st.st_size);
+}
+
+// start_jobs is called, after mmap_input, before the main thread self-imposes
+// a sandbox. It leaves g_num_job_workers at zero, falling back to handling
+// the input on the main thread alone, if -jobs=NUM does not apply or if any
+// of the set-up (memory-mapping, allocating or creating threads) fails.
+void  //
+start_jobs(int argc, char** argv) {
+  const int stdin_fd = 0;
+  if (parse_flags(argc, argv) || !g_flags.json_lines || (g_flags.jobs <= 1) ||
+      (g_input_file_descriptor == stdin_fd) || !g_mmap_src_ptr) {
+    return;
+  }
+
+  g_num_job_slots = 2 * g_flags.jobs;
+  g_job_slots =
+      static_cast<JobSlot*>(malloc(g_num_job_slots * sizeof(JobSlot)));
+  if (!g_job_slots) {
+    return;
+  }
+
+  for (uint32_t j = 0; j < g_flags.jobs; j++) {
+    JobWorker* w = &g_job_workers[j];
+    if (pipe(w->req_fds) != 0) {
+      break;
+    } else if (pipe(w->done_fds) != 0) {
+      close(w->req_fds[0]);
+      close(w->req_fds[1]);
+      break;
+    } else if (pthread_create(&w->thread, nullptr, job_worker_main, w) != 0) {
+      close(w->req_fds[0]);
+      close(w->req_fds[1]);
+      close(w->done_fds[0]);
+      close(w->done_fds[1]);
+      break;
+    }
+    g_num_job_workers++;
+  }
+  if (g_num_job_workers == 0) {
+    free(g_job_slots);
+    g_job_slots = nullptr;
+    return;
+  }
+
+  // Spread the slots across the workers that we have, even if that's fewer
+  // than g_flags.jobs.
+  g_num_job_slots = 2 * g_num_job_workers;
+}
+
+// stop_jobs tells the worker threads to exit. It does not wait for them to do
+// so, as the sandboxed main thread cannot call pthread_join.
+void  //
+stop_jobs() {
+  for (uint32_t j = 0; j < g_num_job_workers; j++) {
+    write_u32(g_job_workers[j].req_fds[1], JOB_QUIT);
+  }
+  g_num_job_workers = 0;
+}
+
+// dispatch_job_slot assigns the next chunk, starting at g_mmap_src_ptr[*pos],
+// to the s'th slot and sends that slot to its worker.
+const char*  //
+dispatch_job_slot(uint32_t s, size_t* pos) {
+  JobSlot* slot = &g_job_slots[s];
+  size_t remaining = g_mmap_src_len - *pos;
+  size_t len = remaining;
+  if (remaining > JOB_CHUNK_SIZE) {
+    const void* nl = memchr(g_mmap_src_ptr + *pos + (JOB_CHUNK_SIZE - 1), '\n',
+                            remaining - (JOB_CHUNK_SIZE - 1));
+    if (nl) {
+      len = 1 +
+            (size_t)(static_cast<const uint8_t*>(nl) - (g_mmap_src_ptr + *pos));
+    }
+  }
+
+  slot->src_ptr = g_mmap_src_ptr + *pos;
+  slot->src_len = len;
+  slot->dispatched = false;
+  if (len > JOB_CHUNK_SIZE_MAX_INCL) {
+    // Don't dispatch any further chunks. This slot's (unset) results are
+    // replaced by an error.
+    slot->status_msg = "main: line is too long for -jobs";
+    slot->num_tokens = 0;
+    slot->num_records = 0;
+    *pos = g_mmap_src_len;
+    return nullptr;
+  }
+  *pos += len;
+
+  if (!write_u32(g_job_workers[s % g_num_job_workers].req_fds[1], s)) {
+    return "main: could not dispatch -jobs work";
+  }
+  slot->dispatched = true;
+  return nullptr;
+}
+
+// handle_job_slot waits for the s'th slot's worker to finish and then handles
+// that slot's tokens, the same as main1 handles g_dec's tokens.
+const char*  //
+handle_job_slot(uint32_t s) {
+  JobSlot* slot = &g_job_slots[s];
+  if (slot->dispatched) {
+    uint32_t i;
+    if (!read_u32(g_job_workers[s % g_num_job_workers].done_fds[0], &i) ||
+        (i != s)) {
+      return "main: internal error: inconsistent -jobs slot";
+    }
+  }
+
+  g_src = wuffs_base__make_io_buffer(
+      wuffs_base__make_slice_u8(const_cast<uint8_t*>(slot->src_ptr),
+                                slot->src_len),
+      wuffs_base__make_io_buffer_meta(slot->src_len, slot->src_len, 0, true));
+  g_curr_token_end_src_index = 0;
+
+  wuffs_base__token_buffer tok = wuffs_base__slice_token__reader(
+      wuffs_base__make_slice_token(slot->tokens, slot->num_tokens), true);
+  bool start_of_token_chain = true;
+  size_t r = 0;
+  while (tok.meta.ri < tok.meta.wi) {
+    // As for main1, coalesce a run of string-copy tokens. A run ends with a
+    // token that is not continued, so it cannot straddle a record end.
+    wuffs_base__token t = tok.data.ptr[tok.meta.ri];
+    tok.meta.ri++;
+    uint64_t n = t.length();
+    if (t.continued() && is_string_copy(t) && (tok.meta.ri < tok.meta.wi) &&
+        is_string_copy(tok.data.ptr[tok.meta.ri])) {
+      for (uint64_t run = tok.reader_copy_run(); run > 0; run--) {
+        t = tok.data.ptr[tok.meta.ri++];
+        n += t.length();
+      }
+    }
+    if ((g_src.meta.ri - g_curr_token_end_src_index) < n) {
+      return "main: internal error: inconsistent g_src indexes";
+    }
+    g_curr_token_end_src_index += n;
+
+    if ((t.value() != 0) && !g_record_done) {
+      const char* z = handle_token(t, n, start_of_token_chain);
+      if (z == g_eod) {
+        TRY(end_record());
+      } else if (z) {
+        return z;
+      }
+    }
+    start_of_token_chain = !t.continued();
+
+    if ((r < slot->num_records) && (slot->record_ends[r] == tok.meta.ri)) {
+      if (!g_record_done) {
+        return "main: internal error: unexpected end of token stream";
+      }
+      start_top_level_value();
+      r++;
+    }
+  }
+  return slot->status_msg;
+}
+
+const char*  //
+main1_jobs() {
+  size_t pos = 0;
+  uint64_t num_dispatched = 0;
+  uint64_t num_handled = 0;
+  while (true) {
+    while ((pos < g_mmap_src_len) &&
+           ((num_dispatched - num_handled) < g_num_job_slots)) {
+      TRY(dispatch_job_slot((uint32_t)(num_dispatched % g_num_job_slots),
+                            &pos));
+      num_dispatched++;
+    }
+    if (num_handled == num_dispatched) {
+      break;
+    }
+    TRY(handle_job_slot((uint32_t)(num_handled % g_num_job_slots)));
+    num_handled++;
+  }
+  return nullptr;
+}
+
+// ----
+
 const char*  //
 main1(int argc, char** argv) {
   TRY(initialize_globals(argc, argv));
+  if (g_num_job_workers > 0) {
+    return main1_jobs();
+  }
 
-  bool start_of_token_chain = false;
+  bool start_of_token_chain = true;
   while (true) {
     wuffs_base__status status = g_dec.decode_tokens(
         &g_tok, &g_src,
         wuffs_base__make_slice_u8(g_work_buffer_array, WORK_BUFFER_ARRAY_SIZE));
 
+    if (g_compact_fast_path) {
+      const char* z = handle_tokens_compact();
+      if (z == g_eod) {
+        goto end_of_data;
+      } else if (z) {
+        return z;
+      }
+    }
+
     while (g_tok.meta.ri < g_tok.meta.wi) {
-      wuffs_base__token t = g_tok.data.ptr[g_tok.meta.ri++];
+      wuffs_base__token t = g_tok.data.ptr[g_tok.meta.ri];
+
+      // Skip filler tokens (e.g. whitespace), as well as the rest of a
+      // -json-lines record whose output is complete. Do so in batches, a run
+      // of tokens at a time, with no per-token dispatch.
+      if (g_record_done ||
+          (t.value_base_category() == WUFFS_BASE__TOKEN__VBC__FILLER)) {
+        uint64_t run = g_record_done ? g_tok.reader_available()
+                                     : g_tok.reader_category_run();
+        uint64_t n = 0;
+        for (; run > 0; run--) {
+          t = g_tok.data.ptr[g_tok.meta.ri++];
+          n += t.length();
+        }
+        if ((g_src.meta.ri - g_curr_token_end_src_index) < n) {
+          return "main: internal error: inconsistent g_src indexes";
+        }
+        g_curr_token_end_src_index += n;
+        start_of_token_chain = !t.continued();
+        continue;
+      }
+
+      // Coalesce a run of string-copy tokens, which is a single span of
+      // source bytes, so that handle_token writes it all at once.
+      g_tok.meta.ri++;
       uint64_t n = t.length();
+      if (t.continued() && is_string_copy(t) &&
+          (g_tok.meta.ri < g_tok.meta.wi) &&
+          is_string_copy(g_tok.data.ptr[g_tok.meta.ri])) {
+        for (uint64_t run = g_tok.reader_copy_run(); run > 0; run--) {
+          t = g_tok.data.ptr[g_tok.meta.ri++];
+          n += t.length();
+        }
+      }
       if ((g_src.meta.ri - g_curr_token_end_src_index) < n) {
         return "main: internal error: inconsistent g_src indexes";
       }
       g_curr_token_end_src_index += n;
 
-      // Skip filler tokens (e.g. whitespace).
-      if (t.value() == 0) {
-        start_of_token_chain = !t.continued();
-        continue;
-      }
-
-      const char* z = handle_token(t, start_of_token_chain);
+      const char* z = handle_token(t, n, start_of_token_chain);
       start_of_token_chain = !t.continued();
       if (z == nullptr) {
         continue;
       } else if (z == g_eod) {
-        goto end_of_data;
+        if (!g_flags.json_lines) {
+          goto end_of_data;
+        }
+        TRY(end_record());
+        continue;
       }
       return z;
     }
 
+    // All of the decoded tokens have been handled, so the decoder's position
+    // matches ours. The remainder of any containers that are deeper than the
+    // query (for an incomplete match) or than -max-output-depth (for a
+    // complete match) won't be written to stdout, so the decoder can skip
+    // over them instead of producing their tokens. Likewise for all of the
+    // remainder of a completed -json-lines record.
+    if (g_record_done) {
+      g_dec.skip_remainder_of_containers(1024);
+    } else {
+      uint32_t skip_depth =
+          g_query.matched_all() ? g_flags.max_output_depth : g_query.depth();
+      g_dec.skip_remainder_of_containers(
+          (g_depth > skip_depth) ? (g_depth - skip_depth) : 0);
+    }
+
     if (status.repr == nullptr) {
-      return "main: internal error: unexpected end of token stream";
+      // In -json-lines mode, the decoder returns OK after each record.
+      if (!g_record_done) {
+        return "main: internal error: unexpected end of token stream";
+      }
+      start_top_level_value();
+    } else if (status.repr == wuffs_base__note__end_of_data) {
+      // In -json-lines mode, the decoder has consumed all of the input,
+      // including any trailing whitespace.
+      return nullptr;
     } else if (status.repr == wuffs_base__suspension__short_read) {
       if (g_curr_token_end_src_index != g_src.meta.ri) {
         return "main: internal error: inconsistent g_src indexes";
@@ -1163,17 +1752,21 @@ main(int argc, char** argv) {
     }
   }
 
+  mmap_input();
+  start_jobs(argc, argv);
+
 #if defined(WUFFS_EXAMPLE_USE_SECCOMP)
   prctl(PR_SET_SECCOMP, SECCOMP_MODE_STRICT);
   g_sandboxed = true;
 #endif
 
   const char* z = main1(argc, argv);
-  if (g_wrote_to_dst) {
-    const char* z1 = write_dst("\n", 1);
-    const char* z2 = flush_dst();
-    z = z ? z : (z1 ? z1 : z2);
-  }
+  stop_jobs();
+  // In -json-lines mode, end_record has already written each record's
+  // trailing "\n", but g_dst may still need flushing.
+  const char* z1 = g_wrote_to_dst ? write_dst("\n", 1) : nullptr;
+  const char* z2 = flush_dst();
+  z = z ? z : (z1 ? z1 : z2);
   int exit_code = compute_exit_code(z);
 
 #if defined(WUFFS_EXAMPLE_USE_SECCOMP)
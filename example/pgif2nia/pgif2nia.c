@@ -0,0 +1,709 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+pgif2nia converts an animated GIF image to the NIA format, like
+example/convert-to-nia, but decodes the frames' pixels using multiple threads.
+It reads from the named file (which it memory-maps), or from stdin if no file
+is named. To run:
+
+$CC -O3 pgif2nia.c -lpthread && \
+  ./a.out < ../../test/data/muybridge.gif > /tmp/muybridge.nia; rm -f a.out
+
+for a C compiler $CC, such as clang or gcc.
+
+Compositing an animation is inherently serial: each frame is drawn on top of
+the previous frame (after that previous frame's disposal). But decoding each
+frame's pixels (the LZW decompression and palette lookup) does not depend on
+the previous frames. This program therefore works in three phases:
+
+  - The main thread builds a frame index: the wuffs_base__frame_config of
+    every frame, which includes its I/O position. Calling decode_frame_config
+    repeatedly, without calling decode_frame, skips over each frame's
+    compressed pixel data without decompressing it.
+  - A pool of worker threads decodes the frames concurrently. Each thread has
+    its own decoder (and work buffer), which jumps to a frame via
+    wuffs_gif__decoder__restart_frame. Each frame is decoded onto its own
+    transparent black pixel buffer.
+  - The main thread composites the decoded frames in order, applying each
+    frame's disposal, and writes the NIA output.
+
+The output is the same as example/convert-to-nia's for valid GIF input.
+Compositing a decoded frame only needs to copy its non-transparent pixels,
+because every GIF pixel is either fully opaque or fully transparent.
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c whitelist which parts of Wuffs to build. That file contains
+// the entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__GIF
+#define WUFFS_CONFIG__MODULE__LZW
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../release/c/wuffs-unsupported-snapshot.c"
+
+#define BYTES_PER_PIXEL 4
+#define MAX_NUM_THREADS 256
+
+#ifndef MAX_DIMENSION
+#define MAX_DIMENSION 65535
+#endif
+
+// ----
+
+struct {
+  int remaining_argc;
+  char** remaining_argv;
+
+  uint32_t num_threads;
+} g_flags = {0};
+
+const char*  //
+parse_flags(int argc, char** argv) {
+  int c = (argc > 0) ? 1 : 0;  // Skip argv[0], the program name.
+  for (; c < argc; c++) {
+    char* arg = argv[c];
+    if (*arg++ != '-') {
+      break;
+    }
+
+    // A double-dash "--foo" is equivalent to a single-dash "-foo". As special
+    // cases, a bare "-" is not a flag (some programs may interpret it as
+    // stdin) and a bare "--" means to stop parsing flags.
+    if (*arg == '\x00') {
+      break;
+    } else if (*arg == '-') {
+      arg++;
+      if (*arg == '\x00') {
+        c++;
+        break;
+      }
+    }
+
+    if (!strncmp(arg, "j=", 2)) {
+      wuffs_base__result_u64 r = wuffs_base__parse_number_u64(
+          wuffs_base__make_slice_u8((uint8_t*)(arg + 2), strlen(arg + 2)));
+      if (r.status.repr || (r.value < 1) || (r.value > MAX_NUM_THREADS)) {
+        return "main: bad -j flag value";
+      }
+      g_flags.num_threads = (uint32_t)(r.value);
+      continue;
+    }
+
+    return "main: unrecognized flag argument";
+  }
+
+  g_flags.remaining_argc = argc - c;
+  g_flags.remaining_argv = argv + c;
+  return NULL;
+}
+
+// ----
+
+// ignore_return_value suppresses errors from -Wall -Werror.
+static void  //
+ignore_return_value(int ignored) {}
+
+typedef struct {
+  // Set by the main thread before any worker thread starts.
+  wuffs_base__frame_config fc;
+
+  // Set by the worker thread.
+  wuffs_base__status status;
+  uint8_t* pixels;
+  bool done;
+} frame;
+
+struct {
+  const uint8_t* src_ptr;
+  size_t src_len;
+
+  wuffs_base__image_config ic;
+  uint32_t width;
+  uint32_t height;
+  size_t pixbuf_len;
+  uint64_t workbuf_len;
+  uint32_t num_animation_loops;
+
+  // frames[.. num_frames] is the frame index. index_status_message is the
+  // error, if any, that stopped the main thread from indexing more frames.
+  frame* frames;
+  size_t num_frames;
+  const char* index_status_message;
+
+  // The mutex guards next_frame, num_released and each frame's done field.
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  size_t next_frame;
+  size_t num_released;
+  size_t window;
+
+  uint8_t* canvas;
+  uint8_t* backup;
+} g;
+
+// ----
+
+static void*  //
+checked_malloc(size_t n) {
+  void* p = malloc(n ? n : 1);
+  if (!p) {
+    fprintf(stderr, "main: out of memory\n");
+    exit(2);
+  }
+  return p;
+}
+
+static wuffs_gif__decoder*  //
+new_decoder() {
+  wuffs_gif__decoder* dec = wuffs_gif__decoder__alloc();
+  if (!dec) {
+    fprintf(stderr, "main: out of memory\n");
+    exit(2);
+  }
+  return dec;
+}
+
+static wuffs_base__io_buffer  //
+make_src() {
+  return wuffs_base__ptr_u8__reader((uint8_t*)(uintptr_t)(g.src_ptr), g.src_len,
+                                    true);
+}
+
+// status_message converts a status to an error message. The entire input is
+// available up front, so a short read means that the input was truncated.
+static const char*  //
+status_message(const wuffs_base__status* status) {
+  if (status->repr == wuffs_base__suspension__short_read) {
+    return "main: unexpected end of file";
+  }
+  return wuffs_base__status__message(status);
+}
+
+// ----
+
+// build_index runs on the main thread, decoding the image config and every
+// frame config (but no frames' pixels).
+static const char*  //
+build_index() {
+  wuffs_gif__decoder* dec = new_decoder();
+  wuffs_base__io_buffer src = make_src();
+  const char* ret = NULL;
+
+  wuffs_base__status status =
+      wuffs_gif__decoder__decode_image_config(dec, &g.ic, &src);
+  if (!wuffs_base__status__is_ok(&status)) {
+    ret = status_message(&status);
+    goto exit;
+  }
+
+  uint32_t w = wuffs_base__pixel_config__width(&g.ic.pixcfg);
+  uint32_t h = wuffs_base__pixel_config__height(&g.ic.pixcfg);
+  if ((w > MAX_DIMENSION) || (h > MAX_DIMENSION)) {
+    ret = "main: image is too large";
+    goto exit;
+  }
+  g.width = w;
+  g.height = h;
+  wuffs_base__pixel_config__set(&g.ic.pixcfg,
+                                WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+                                WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, w, h);
+  g.pixbuf_len = (size_t)(w) * (size_t)(h)*BYTES_PER_PIXEL;
+  g.workbuf_len = wuffs_gif__decoder__workbuf_len(dec).max_incl;
+
+  size_t cap = 16;
+  g.frames = (frame*)checked_malloc(cap * sizeof(frame));
+  while (true) {
+    wuffs_base__frame_config fc = ((wuffs_base__frame_config){});
+    status = wuffs_gif__decoder__decode_frame_config(dec, &fc, &src);
+    if (status.repr == wuffs_base__note__end_of_data) {
+      break;
+    } else if (!wuffs_base__status__is_ok(&status)) {
+      g.index_status_message = status_message(&status);
+      break;
+    }
+
+    if (g.num_frames == cap) {
+      cap *= 2;
+      g.frames = (frame*)realloc(g.frames, cap * sizeof(frame));
+      if (!g.frames) {
+        fprintf(stderr, "main: out of memory\n");
+        exit(2);
+      }
+    }
+    frame* f = &g.frames[g.num_frames++];
+    memset(f, 0, sizeof(*f));
+    f->fc = fc;
+  }
+  g.num_animation_loops = wuffs_gif__decoder__num_animation_loops(dec);
+
+exit:
+  free(dec);
+  return ret;
+}
+
+// ----
+
+// decode_frame decodes f's pixels onto a newly allocated pixel buffer. Pixels
+// outside of f's bounds are left uninitialized, as they are never read.
+static void  //
+decode_frame(wuffs_gif__decoder* dec, wuffs_base__slice_u8 workbuf, frame* f) {
+  wuffs_base__rect_ie_u32 r = wuffs_base__frame_config__bounds(&f->fc);
+  f->pixels = (uint8_t*)checked_malloc(g.pixbuf_len);
+  size_t stride = (size_t)(g.width) * BYTES_PER_PIXEL;
+  size_t y;
+  for (y = r.min_incl_y; y < r.max_excl_y; y++) {
+    memset(f->pixels + (y * stride) + (r.min_incl_x * BYTES_PER_PIXEL), 0,
+           wuffs_base__rect_ie_u32__width(&r) * BYTES_PER_PIXEL);
+  }
+
+  wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+  f->status = wuffs_base__pixel_buffer__set_from_slice(
+      &pb, &g.ic.pixcfg, wuffs_base__make_slice_u8(f->pixels, g.pixbuf_len));
+  if (!wuffs_base__status__is_ok(&f->status)) {
+    return;
+  }
+
+  // Jump to the frame. The src has to be positioned at the frame's I/O
+  // position, matching the restart_frame call's io_position argument.
+  uint64_t pos = wuffs_base__frame_config__io_position(&f->fc);
+  f->status = wuffs_gif__decoder__restart_frame(
+      dec, wuffs_base__frame_config__index(&f->fc), pos);
+  if (!wuffs_base__status__is_ok(&f->status)) {
+    return;
+  }
+  wuffs_base__io_buffer src = make_src();
+  src.meta.ri = (size_t)(pos);
+
+  f->status = wuffs_gif__decoder__decode_frame(
+      dec, &pb, &src, WUFFS_BASE__PIXEL_BLEND__SRC_OVER, workbuf, NULL);
+}
+
+static void*  //
+worker(void* arg) {
+  // Each worker has its own decoder and work buffer. A decoder can only
+  // restart_frame after decode_image_config, which re-reads the GIF header
+  // (including the global palette) but no frames.
+  wuffs_gif__decoder* dec = new_decoder();
+  wuffs_base__slice_u8 workbuf = wuffs_base__make_slice_u8(
+      (uint8_t*)checked_malloc((size_t)(g.workbuf_len)),
+      (size_t)(g.workbuf_len));
+  wuffs_base__io_buffer src = make_src();
+  wuffs_base__status dic_status =
+      wuffs_gif__decoder__decode_image_config(dec, NULL, &src);
+
+  pthread_mutex_lock(&g.mutex);
+  while (g.next_frame < g.num_frames) {
+    // Bound the memory used by decoded-but-not-yet-composited frames.
+    if (g.next_frame >= (g.num_released + g.window)) {
+      pthread_cond_wait(&g.cond, &g.mutex);
+      continue;
+    }
+    frame* f = &g.frames[g.next_frame++];
+    pthread_mutex_unlock(&g.mutex);
+
+    if (wuffs_base__status__is_ok(&dic_status)) {
+      decode_frame(dec, workbuf, f);
+    } else {
+      f->status = dic_status;
+    }
+
+    pthread_mutex_lock(&g.mutex);
+    f->done = true;
+    pthread_cond_broadcast(&g.cond);
+  }
+  pthread_mutex_unlock(&g.mutex);
+
+  free(workbuf.ptr);
+  free(dec);
+  return NULL;
+}
+
+static frame*  //
+wait_for_frame(size_t i) {
+  frame* f = &g.frames[i];
+  pthread_mutex_lock(&g.mutex);
+  while (!f->done) {
+    pthread_cond_wait(&g.cond, &g.mutex);
+  }
+  pthread_mutex_unlock(&g.mutex);
+  return f;
+}
+
+static void  //
+release_frame(frame* f) {
+  free(f->pixels);
+  f->pixels = NULL;
+  pthread_mutex_lock(&g.mutex);
+  g.num_released++;
+  pthread_cond_broadcast(&g.cond);
+  pthread_mutex_unlock(&g.mutex);
+}
+
+// ----
+
+static const char*  //
+write_all(const uint8_t* ptr, size_t len) {
+  while (len > 0) {
+    const int stdout_fd = 1;
+    ssize_t n = write(stdout_fd, ptr, len);
+    if (n < 0) {
+      if (errno != EINTR) {
+        return strerror(errno);
+      }
+      continue;
+    }
+    ptr += n;
+    len -= (size_t)n;
+  }
+  return NULL;
+}
+
+static const char*  //
+print_nix_header(uint32_t magic_u32le) {
+  static const uint32_t version1_bn4_u32le = 0x346E62FF;
+  uint8_t data[16];
+  wuffs_base__store_u32le__no_bounds_check(data + 0x00, magic_u32le);
+  wuffs_base__store_u32le__no_bounds_check(data + 0x04, version1_bn4_u32le);
+  wuffs_base__store_u32le__no_bounds_check(data + 0x08, g.width);
+  wuffs_base__store_u32le__no_bounds_check(data + 0x0C, g.height);
+  return write_all(&data[0], 16);
+}
+
+static const char*  //
+print_nia_duration(wuffs_base__flicks duration) {
+  uint8_t data[8];
+  wuffs_base__store_u64le__no_bounds_check(data + 0x00, duration);
+  return write_all(&data[0], 8);
+}
+
+static const char*  //
+print_nie_frame() {
+  const char* z = print_nix_header(0x45AFC36E);  // "nïE" as a u32le.
+  if (z) {
+    return z;
+  }
+  return write_all(g.canvas, g.pixbuf_len);
+}
+
+static const char*  //
+print_nia_padding() {
+  if (g.width & g.height & 1) {
+    uint8_t data[4];
+    wuffs_base__store_u32le__no_bounds_check(data + 0x00, 0);
+    return write_all(&data[0], 4);
+  }
+  return NULL;
+}
+
+static const char*  //
+print_nia_footer() {
+  uint8_t data[8];
+  wuffs_base__store_u32le__no_bounds_check(data + 0x00, g.num_animation_loops);
+  wuffs_base__store_u32le__no_bounds_check(data + 0x04, 0x80000000);
+  return write_all(&data[0], 8);
+}
+
+static void  //
+fill_rectangle(wuffs_base__rect_ie_u32 rect,
+               wuffs_base__color_u32_argb_premul color) {
+  if (rect.max_excl_x > g.width) {
+    rect.max_excl_x = g.width;
+  }
+  if (rect.max_excl_y > g.height) {
+    rect.max_excl_y = g.height;
+  }
+  uint32_t nonpremul =
+      wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(color);
+  size_t stride = (size_t)(g.width) * BYTES_PER_PIXEL;
+
+  uint32_t y;
+  for (y = rect.min_incl_y; y < rect.max_excl_y; y++) {
+    uint8_t* p = g.canvas + (y * stride) + (rect.min_incl_x * BYTES_PER_PIXEL);
+    uint32_t x;
+    for (x = rect.min_incl_x; x < rect.max_excl_x; x++) {
+      wuffs_base__store_u32le__no_bounds_check(p, nonpremul);
+      p += BYTES_PER_PIXEL;
+    }
+  }
+}
+
+// composite copies f's non-transparent pixels, within f's bounds, onto the
+// canvas. This is equivalent to decoding f directly onto the canvas with the
+// WUFFS_BASE__PIXEL_BLEND__SRC_OVER blend.
+static void  //
+composite(frame* f) {
+  wuffs_base__rect_ie_u32 r = wuffs_base__frame_config__bounds(&f->fc);
+  size_t stride = (size_t)(g.width) * BYTES_PER_PIXEL;
+
+  uint32_t y;
+  for (y = r.min_incl_y; y < r.max_excl_y; y++) {
+    size_t offset = (y * stride) + (r.min_incl_x * BYTES_PER_PIXEL);
+    const uint8_t* s = f->pixels + offset;
+    uint8_t* d = g.canvas + offset;
+    uint32_t x;
+    for (x = r.min_incl_x; x < r.max_excl_x; x++) {
+      if (s[3]) {  // The BGRA_NONPREMUL alpha channel.
+        memcpy(d, s, BYTES_PER_PIXEL);
+      }
+      s += BYTES_PER_PIXEL;
+      d += BYTES_PER_PIXEL;
+    }
+  }
+}
+
+// assemble runs on the main thread, compositing the decoded frames in order
+// and writing the NIA output.
+static const char*  //
+assemble() {
+  const char* ret = print_nix_header(0x41AFC36E);  // "nïA" as a u32le.
+  if (ret) {
+    goto exit;
+  }
+
+  wuffs_base__flicks total_duration = 0;
+  size_t i = 0;
+  for (; i < g.num_frames; i++) {
+    frame* f = wait_for_frame(i);
+
+    wuffs_base__flicks duration = wuffs_base__frame_config__duration(&f->fc);
+    if (duration < 0) {
+      ret = "main: animation frame duration is negative";
+      goto exit;
+    } else if (total_duration > (INT64_MAX - duration)) {
+      ret = "main: animation frame duration overflow";
+      goto exit;
+    }
+    total_duration += duration;
+    ret = print_nia_duration(total_duration);
+    if (ret) {
+      goto exit;
+    }
+
+    // Like example/convert-to-nia, a truncated frame is not printed at all.
+    if (f->status.repr == wuffs_base__suspension__short_read) {
+      ret = status_message(&f->status);
+      goto exit;
+    }
+
+    if (i == 0) {
+      fill_rectangle(wuffs_base__pixel_config__bounds(&g.ic.pixcfg),
+                     wuffs_base__frame_config__background_color(&f->fc));
+    }
+
+    switch (wuffs_base__frame_config__disposal(&f->fc)) {
+      case WUFFS_BASE__ANIMATION_DISPOSAL__RESTORE_PREVIOUS: {
+        if (!g.backup) {
+          g.backup = (uint8_t*)checked_malloc(g.pixbuf_len);
+        }
+        memcpy(g.backup, g.canvas, g.pixbuf_len);
+        break;
+      }
+    }
+
+    if (f->pixels) {
+      composite(f);
+    }
+    ret = print_nie_frame();
+    if (ret) {
+      goto exit;
+    } else if (!wuffs_base__status__is_ok(&f->status)) {
+      ret = status_message(&f->status);
+      goto exit;
+    }
+    ret = print_nia_padding();
+    if (ret) {
+      goto exit;
+    }
+
+    switch (wuffs_base__frame_config__disposal(&f->fc)) {
+      case WUFFS_BASE__ANIMATION_DISPOSAL__RESTORE_BACKGROUND: {
+        fill_rectangle(wuffs_base__frame_config__bounds(&f->fc),
+                       wuffs_base__frame_config__background_color(&f->fc));
+        break;
+      }
+      case WUFFS_BASE__ANIMATION_DISPOSAL__RESTORE_PREVIOUS: {
+        memcpy(g.canvas, g.backup, g.pixbuf_len);
+        break;
+      }
+    }
+    release_frame(f);
+  }
+
+  ret = g.index_status_message;
+  if (!ret) {
+    ret = print_nia_footer();
+  }
+
+exit:
+  // Let any worker threads finish promptly.
+  pthread_mutex_lock(&g.mutex);
+  g.next_frame = g.num_frames;
+  pthread_cond_broadcast(&g.cond);
+  pthread_mutex_unlock(&g.mutex);
+  return ret;
+}
+
+// ----
+
+static const char*  //
+read_input() {
+  int fd = 0;  // stdin.
+  if (g_flags.remaining_argc > 0) {
+    fd = open(g_flags.remaining_argv[0], O_RDONLY);
+    if (fd < 0) {
+      return strerror(errno);
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && (st.st_size > 0)) {
+      void* m = mmap(NULL, (size_t)(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if (m != MAP_FAILED) {
+        g.src_ptr = (const uint8_t*)m;
+        g.src_len = (size_t)(st.st_size);
+        return NULL;
+      }
+    }
+  }
+
+  size_t cap = 0;
+  uint8_t* buf = NULL;
+  while (true) {
+    if (g.src_len == cap) {
+      cap = cap ? (2 * cap) : (1024 * 1024);
+      buf = (uint8_t*)realloc(buf, cap);
+      if (!buf) {
+        return "main: out of memory";
+      }
+    }
+    ssize_t n = read(fd, buf + g.src_len, cap - g.src_len);
+    if (n < 0) {
+      if (errno != EINTR) {
+        return strerror(errno);
+      }
+      continue;
+    } else if (n == 0) {
+      break;
+    }
+    g.src_len += (size_t)n;
+  }
+  g.src_ptr = buf;
+  return NULL;
+}
+
+const char*  //
+main1(int argc, char** argv) {
+  const char* z = parse_flags(argc, argv);
+  if (z) {
+    return z;
+  }
+  if (g_flags.num_threads == 0) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    g_flags.num_threads = (n < 1)                 ? 1
+                          : (n > MAX_NUM_THREADS) ? MAX_NUM_THREADS
+                                                  : (uint32_t)(n);
+  }
+
+  z = read_input();
+  if (z) {
+    return z;
+  }
+  z = build_index();
+  if (z) {
+    return z;
+  }
+  g.canvas = (uint8_t*)checked_malloc(g.pixbuf_len);
+
+  pthread_mutex_init(&g.mutex, NULL);
+  pthread_cond_init(&g.cond, NULL);
+  g.window = 2 * (size_t)(g_flags.num_threads);
+
+  pthread_t threads[MAX_NUM_THREADS];
+  uint32_t num_threads = 0;
+  for (; num_threads < g_flags.num_threads; num_threads++) {
+    if (pthread_create(&threads[num_threads], NULL, worker, NULL)) {
+      break;
+    }
+  }
+  if (num_threads == 0) {
+    return "main: could not create worker threads";
+  }
+
+  z = assemble();
+
+  uint32_t t;
+  for (t = 0; t < num_threads; t++) {
+    pthread_join(threads[t], NULL);
+  }
+  return z;
+}
+
+int  //
+compute_exit_code(const char* status_msg) {
+  if (!status_msg) {
+    return 0;
+  }
+  size_t n = strnlen(status_msg, 2047);
+  if (n >= 2047) {
+    status_msg = "main: internal error: error message is too long";
+    n = strnlen(status_msg, 2047);
+  }
+  const int stderr_fd = 2;
+  ignore_return_value(write(stderr_fd, status_msg, n));
+  ignore_return_value(write(stderr_fd, "\n", 1));
+  // Return an exit code of 1 for regular (forseen) errors, e.g. badly
+  // formatted or unsupported input.
+  //
+  // Return an exit code of 2 for internal (exceptional) errors, e.g. defensive
+  // run-time checks found that an internal invariant did not hold.
+  //
+  // Automated testing, including badly formatted inputs, can therefore
+  // discriminate between expected failure (exit code 1) and unexpected failure
+  // (other non-zero exit codes). Specifically, exit code 2 for internal
+  // invariant violation, exit code 139 (which is 128 + SIGSEGV on x86_64
+  // linux) for a segmentation fault (e.g. null pointer dereference).
+  return strstr(status_msg, "internal error:") ? 2 : 1;
+}
+
+int  //
+main(int argc, char** argv) {
+  return compute_exit_code(main1(argc, argv));
+}
@@ -0,0 +1,835 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+pinflate decodes gzip, zlib or raw deflate data to stdout, using multiple
+threads. It reads from the named file (which it memory-maps), or from stdin if
+no file is named. To run:
+
+$CC -O3 pinflate.c -lpthread && ./a.out < ../../test/data/romeo.txt.gz; \
+rm -f a.out
+
+for a C compiler $CC, such as clang or gcc.
+
+A deflate stream is inherently serial: every block can refer back to the
+previous 32 KiB of output. But some encoders, such as "pigz --independent",
+or zlib with Z_FULL_FLUSH, emit full-flush points. Each one is an empty stored
+block (whose final 4 bytes are "\x00\x00\xFF\xFF") followed by data that makes
+no back-references to before that point. This program splits the input at
+candidate full-flush points (roughly every -chunk-size bytes) and decodes the
+chunks concurrently on a pool of worker threads. The output is then assembled
+in order, on the main thread.
+
+Candidates found by scanning for "\x00\x00\xFF\xFF" are only guesses. Those
+bytes can also occur in the middle of a block, and a Z_SYNC_FLUSH point
+looks the same as a Z_FULL_FLUSH point but does not reset the back-reference
+window. Each guess is therefore verified:
+
+  - After a worker decodes a chunk, a copy of its decoder is fed a synthetic
+    final empty stored block, "\x01\x00\x00\xFF\xFF". That decodes cleanly
+    if and only if the chunk ended on a block boundary.
+  - A chunk whose decoding needed history (a "#bad distance" error when
+    decoded speculatively, with no history) is re-decoded on the main thread,
+    after seeding the decoder with the previous 32 KiB of output via
+    wuffs_deflate__decoder__add_history.
+  - When a boundary turns out to be bogus, the main thread keeps decoding
+    serially (with the decoder that stopped there) until it reaches the next
+    verified boundary.
+
+The result is always the same as serial decoding. It is only faster when the
+input has genuine full-flush points.
+
+For gzip and zlib input, each chunk's checksum is computed on its worker
+thread and the results are merged with the crc32 and adler32 hashers'
+combine_u32 methods, so that verifying the trailer is also parallel.
+
+Multi-member gzip files are not supported: decoding stops after the first
+member.
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c whitelist which parts of Wuffs to build. That file contains
+// the entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__CRC32
+#define WUFFS_CONFIG__MODULE__DEFLATE
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../release/c/wuffs-unsupported-snapshot.c"
+
+#ifndef DEFAULT_CHUNK_SIZE
+#define DEFAULT_CHUNK_SIZE (1024 * 1024)
+#endif
+
+#define HISTORY_SIZE 32768
+#define MAX_NUM_THREADS 256
+
+// The deflate decoder's workbuf_len is at most 1 byte.
+uint8_t
+    g_work_buffer_array[WUFFS_DEFLATE__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE];
+
+// ----
+
+struct {
+  int remaining_argc;
+  char** remaining_argv;
+
+  uint64_t chunk_size;
+  uint32_t num_threads;
+  bool raw;
+} g_flags = {0};
+
+const char*  //
+parse_flags(int argc, char** argv) {
+  g_flags.chunk_size = DEFAULT_CHUNK_SIZE;
+
+  int c = (argc > 0) ? 1 : 0;  // Skip argv[0], the program name.
+  for (; c < argc; c++) {
+    char* arg = argv[c];
+    if (*arg++ != '-') {
+      break;
+    }
+
+    // A double-dash "--foo" is equivalent to a single-dash "-foo". As special
+    // cases, a bare "-" is not a flag (some programs may interpret it as
+    // stdin) and a bare "--" means to stop parsing flags.
+    if (*arg == '\x00') {
+      break;
+    } else if (*arg == '-') {
+      arg++;
+      if (*arg == '\x00') {
+        c++;
+        break;
+      }
+    }
+
+    if (!strncmp(arg, "chunk-size=", 11)) {
+      wuffs_base__result_u64 r = wuffs_base__parse_number_u64(
+          wuffs_base__make_slice_u8((uint8_t*)(arg + 11), strlen(arg + 11)));
+      if (r.status.repr || (r.value < 64)) {
+        return "main: bad -chunk-size flag value";
+      }
+      g_flags.chunk_size = r.value;
+      continue;
+    }
+    if (!strncmp(arg, "j=", 2)) {
+      wuffs_base__result_u64 r = wuffs_base__parse_number_u64(
+          wuffs_base__make_slice_u8((uint8_t*)(arg + 2), strlen(arg + 2)));
+      if (r.status.repr || (r.value < 1) || (r.value > MAX_NUM_THREADS)) {
+        return "main: bad -j flag value";
+      }
+      g_flags.num_threads = (uint32_t)(r.value);
+      continue;
+    }
+    if (!strcmp(arg, "raw")) {
+      g_flags.raw = true;
+      continue;
+    }
+
+    return "main: unrecognized flag argument";
+  }
+
+  g_flags.remaining_argc = argc - c;
+  g_flags.remaining_argv = argv + c;
+  return NULL;
+}
+
+// ----
+
+// ignore_return_value suppresses errors from -Wall -Werror.
+static void  //
+ignore_return_value(int ignored) {}
+
+typedef enum {
+  FORMAT_RAW,
+  FORMAT_GZIP,
+  FORMAT_ZLIB,
+} format;
+
+typedef enum {
+  // CHUNK_STATE_VERIFIED means that decoding the chunk (starting with no
+  // history) consumed all of its input and finished on a block boundary.
+  CHUNK_STATE_VERIFIED,
+  // CHUNK_STATE_UNVERIFIED means that decoding the chunk (starting with no
+  // history) consumed all of its input without error, but did not finish on
+  // a block boundary. The chunk's decoder can carry on into the next chunk.
+  CHUNK_STATE_UNVERIFIED,
+  // CHUNK_STATE_ENDED means that the deflate stream's final block ended
+  // within this chunk, at src_end.
+  CHUNK_STATE_ENDED,
+  // CHUNK_STATE_FAILED means that decoding the chunk (starting with no
+  // history) failed. It might need history or its start might be bogus.
+  CHUNK_STATE_FAILED,
+} chunk_state;
+
+typedef struct {
+  // Set by the main thread before any worker thread starts.
+  size_t src_lo;
+  size_t src_hi;
+  bool last;
+
+  // Set by the worker thread.
+  chunk_state state;
+  const char* status_message;
+  size_t src_end;
+  wuffs_deflate__decoder* dec;
+  uint8_t* dst_ptr;
+  size_t dst_len;
+  uint32_t checksum;
+  bool done;
+} chunk;
+
+struct {
+  format fmt;
+  const uint8_t* src_ptr;
+  size_t src_len;
+  size_t deflate_lo;
+
+  chunk* chunks;
+  size_t num_chunks;
+
+  // The mutex guards next_chunk, num_released and each chunk's done field.
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  size_t next_chunk;
+  size_t num_released;
+  size_t window;
+
+  // The combine_u32 methods don't read or modify the hashers' state.
+  wuffs_crc32__ieee_hasher crc32_combiner;
+  wuffs_adler32__hasher adler32_combiner;
+
+  uint32_t checksum;
+  uint64_t total_len;
+  uint8_t history[HISTORY_SIZE];
+  size_t history_len;
+} g;
+
+// ----
+
+static void  //
+check_initialize(wuffs_base__status status) {
+  if (!wuffs_base__status__is_ok(&status)) {
+    fprintf(stderr, "main: internal error: %s\n",
+            wuffs_base__status__message(&status));
+    exit(2);
+  }
+}
+
+// checksum_of returns the CRC-32 (for gzip) or Adler-32 (for zlib) checksum of
+// ptr[.. len]. It is safe to call concurrently.
+static uint32_t  //
+checksum_of(const uint8_t* ptr, size_t len) {
+  wuffs_base__slice_u8 data =
+      wuffs_base__make_slice_u8((uint8_t*)(uintptr_t)(ptr), len);
+  if (g.fmt == FORMAT_GZIP) {
+    wuffs_crc32__ieee_hasher h;
+    check_initialize(wuffs_crc32__ieee_hasher__initialize(
+        &h, sizeof h, WUFFS_VERSION,
+        WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    return wuffs_crc32__ieee_hasher__update_u32(&h, data);
+  } else if (g.fmt == FORMAT_ZLIB) {
+    wuffs_adler32__hasher h;
+    check_initialize(wuffs_adler32__hasher__initialize(
+        &h, sizeof h, WUFFS_VERSION,
+        WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    return wuffs_adler32__hasher__update_u32(&h, data);
+  }
+  return 0;
+}
+
+static uint32_t  //
+checksum_combine(uint32_t first, uint32_t second, size_t second_len) {
+  if (g.fmt == FORMAT_GZIP) {
+    return wuffs_crc32__ieee_hasher__combine_u32(&g.crc32_combiner, first,
+                                                 second, second_len);
+  } else if (g.fmt == FORMAT_ZLIB) {
+    return wuffs_adler32__hasher__combine_u32(&g.adler32_combiner, first,
+                                              second, second_len);
+  }
+  return 0;
+}
+
+// ----
+
+static wuffs_deflate__decoder*  //
+new_decoder() {
+  wuffs_deflate__decoder* dec = wuffs_deflate__decoder__alloc();
+  if (!dec) {
+    fprintf(stderr, "main: out of memory\n");
+    exit(2);
+  }
+  return dec;
+}
+
+// decode runs dec over src_ptr[.. src_len], appending to the heap-allocated
+// *dst_ptr buffer (of length *dst_len and capacity *dst_cap), reallocating as
+// necessary. It sets *src_consumed to the number of src bytes read.
+static wuffs_base__status  //
+decode(wuffs_deflate__decoder* dec,
+       const uint8_t* src_ptr,
+       size_t src_len,
+       bool src_closed,
+       uint8_t** dst_ptr,
+       size_t* dst_len,
+       size_t* dst_cap,
+       size_t* src_consumed) {
+  wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+      (uint8_t*)(uintptr_t)(src_ptr), src_len, src_closed);
+  while (true) {
+    if (*dst_len == *dst_cap) {
+      size_t n = (*dst_cap < 65536) ? 65536 : (2 * *dst_cap);
+      uint8_t* p = (uint8_t*)realloc(*dst_ptr, n);
+      if (!p) {
+        fprintf(stderr, "main: out of memory\n");
+        exit(2);
+      }
+      *dst_ptr = p;
+      *dst_cap = n;
+    }
+
+    // Each call gets a fresh view of the unwritten part of the dst buffer.
+    // The decoder treats any bytes before dst.meta.wi as history, but the
+    // bytes we have already written (in previous calls) are already in the
+    // decoder's own history ringbuffer.
+    wuffs_base__io_buffer dst =
+        wuffs_base__ptr_u8__writer(*dst_ptr + *dst_len, *dst_cap - *dst_len);
+    wuffs_base__status status = wuffs_deflate__decoder__transform_io(
+        dec, &dst, &src,
+        wuffs_base__make_slice_u8(
+            g_work_buffer_array,
+            WUFFS_DEFLATE__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE));
+    *dst_len += dst.meta.wi;
+    if (status.repr != wuffs_base__suspension__short_write) {
+      *src_consumed = src.meta.ri;
+      return status;
+    }
+  }
+}
+
+// is_at_block_boundary returns whether dec, having just consumed all of the
+// src it was given, is positioned on a deflate block boundary. It works on a
+// copy of dec, so that dec itself is unchanged. Wuffs decoders are plain old
+// data (with no internal pointers), so memcpy'ing one is valid.
+static bool  //
+is_at_block_boundary(const wuffs_deflate__decoder* dec) {
+  static const uint8_t terminator[5] = {0x01, 0x00, 0x00, 0xFF, 0xFF};
+  uint8_t dummy[1];
+
+  wuffs_deflate__decoder* probe = new_decoder();
+  memcpy(probe, dec, sizeof__wuffs_deflate__decoder());
+  wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+      (uint8_t*)(uintptr_t)(terminator), sizeof terminator, true);
+  wuffs_base__io_buffer dst = wuffs_base__ptr_u8__writer(dummy, 0);
+  wuffs_base__status status = wuffs_deflate__decoder__transform_io(
+      probe, &dst, &src,
+      wuffs_base__make_slice_u8(
+          g_work_buffer_array,
+          WUFFS_DEFLATE__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE));
+  free(probe);
+  return wuffs_base__status__is_ok(&status) &&
+         (src.meta.ri == sizeof terminator) && (dst.meta.wi == 0);
+}
+
+static void  //
+decode_chunk(chunk* c) {
+  c->dec = new_decoder();
+  size_t dst_cap = 0;
+  size_t src_consumed = 0;
+  wuffs_base__status status =
+      decode(c->dec, g.src_ptr + c->src_lo, c->src_hi - c->src_lo, c->last,
+             &c->dst_ptr, &c->dst_len, &dst_cap, &src_consumed);
+
+  if (wuffs_base__status__is_ok(&status)) {
+    c->state = CHUNK_STATE_ENDED;
+    c->src_end = c->src_lo + src_consumed;
+  } else if ((status.repr == wuffs_base__suspension__short_read) &&
+             (src_consumed == (c->src_hi - c->src_lo))) {
+    c->state = is_at_block_boundary(c->dec) ? CHUNK_STATE_VERIFIED
+                                            : CHUNK_STATE_UNVERIFIED;
+  } else {
+    c->state = CHUNK_STATE_FAILED;
+    c->status_message = wuffs_base__status__message(&status);
+  }
+
+  if (c->state != CHUNK_STATE_FAILED) {
+    c->checksum = checksum_of(c->dst_ptr, c->dst_len);
+  }
+  if (c->state != CHUNK_STATE_UNVERIFIED) {
+    free(c->dec);
+    c->dec = NULL;
+  }
+}
+
+static void*  //
+worker(void* arg) {
+  pthread_mutex_lock(&g.mutex);
+  while (g.next_chunk < g.num_chunks) {
+    // Bound the memory used by decoded-but-not-yet-written chunks.
+    if (g.next_chunk >= (g.num_released + g.window)) {
+      pthread_cond_wait(&g.cond, &g.mutex);
+      continue;
+    }
+    chunk* c = &g.chunks[g.next_chunk++];
+    pthread_mutex_unlock(&g.mutex);
+
+    decode_chunk(c);
+
+    pthread_mutex_lock(&g.mutex);
+    c->done = true;
+    pthread_cond_broadcast(&g.cond);
+  }
+  pthread_mutex_unlock(&g.mutex);
+  return NULL;
+}
+
+static chunk*  //
+wait_for_chunk(size_t i) {
+  chunk* c = &g.chunks[i];
+  pthread_mutex_lock(&g.mutex);
+  while (!c->done) {
+    pthread_cond_wait(&g.cond, &g.mutex);
+  }
+  pthread_mutex_unlock(&g.mutex);
+  return c;
+}
+
+static void  //
+release_chunk(chunk* c) {
+  free(c->dst_ptr);
+  c->dst_ptr = NULL;
+  free(c->dec);
+  c->dec = NULL;
+  pthread_mutex_lock(&g.mutex);
+  g.num_released++;
+  pthread_cond_broadcast(&g.cond);
+  pthread_mutex_unlock(&g.mutex);
+}
+
+// ----
+
+// emit writes ptr[.. len] to stdout and also updates the running checksum,
+// total length and the last 32 KiB of history.
+static const char*  //
+emit(const uint8_t* ptr, size_t len, uint32_t checksum) {
+  g.checksum = checksum_combine(g.checksum, checksum, len);
+  g.total_len += len;
+
+  if (len >= HISTORY_SIZE) {
+    memcpy(g.history, ptr + len - HISTORY_SIZE, HISTORY_SIZE);
+    g.history_len = HISTORY_SIZE;
+  } else {
+    size_t keep = HISTORY_SIZE - len;
+    if (keep > g.history_len) {
+      keep = g.history_len;
+    }
+    memmove(g.history, g.history + g.history_len - keep, keep);
+    memcpy(g.history + keep, ptr, len);
+    g.history_len = keep + len;
+  }
+
+  while (len > 0) {
+    const int stdout_fd = 1;
+    ssize_t n = write(stdout_fd, ptr, len);
+    if (n < 0) {
+      if (errno != EINTR) {
+        return strerror(errno);
+      }
+      continue;
+    }
+    ptr += n;
+    len -= (size_t)n;
+  }
+  return NULL;
+}
+
+// assemble runs on the main thread, writing the chunks' output in order. It
+// sets *deflate_hi to the end of the deflate stream.
+static const char*  //
+assemble(size_t* deflate_hi) {
+  // serial is non-NULL when we are decoding serially. It is a decoder that
+  // has consumed all of the input up to the start of chunk i.
+  wuffs_deflate__decoder* serial = NULL;
+  uint8_t* serial_dst = NULL;
+  size_t serial_cap = 0;
+  const char* ret = NULL;
+
+  size_t i = 0;
+  for (; i < g.num_chunks; i++) {
+    chunk* c = wait_for_chunk(i);
+
+    // If decoding serially, switch back to the speculative results if we are
+    // on a block boundary and the chunk didn't need any history.
+    if (serial && (c->state != CHUNK_STATE_FAILED) &&
+        is_at_block_boundary(serial)) {
+      free(serial);
+      serial = NULL;
+    }
+
+    if (!serial) {
+      if (c->state != CHUNK_STATE_FAILED) {
+        ret = emit(c->dst_ptr, c->dst_len, c->checksum);
+        if (ret) {
+          goto exit;
+        }
+        if (c->state == CHUNK_STATE_ENDED) {
+          *deflate_hi = c->src_end;
+          release_chunk(c);
+          goto exit;
+        } else if (c->state == CHUNK_STATE_UNVERIFIED) {
+          // Carry on with the decoder that stopped mid-block.
+          serial = c->dec;
+          c->dec = NULL;
+        }
+        release_chunk(c);
+        continue;
+      }
+
+      // The chunk starts on a block boundary but needs history.
+      serial = new_decoder();
+      wuffs_deflate__decoder__add_history(
+          serial, wuffs_base__make_slice_u8(g.history, g.history_len));
+    }
+
+    size_t serial_len = 0;
+    size_t src_consumed = 0;
+    wuffs_base__status status =
+        decode(serial, g.src_ptr + c->src_lo, c->src_hi - c->src_lo, c->last,
+               &serial_dst, &serial_len, &serial_cap, &src_consumed);
+    ret = emit(serial_dst, serial_len, checksum_of(serial_dst, serial_len));
+    if (ret) {
+      goto exit;
+    } else if (wuffs_base__status__is_ok(&status)) {
+      *deflate_hi = c->src_lo + src_consumed;
+      release_chunk(c);
+      goto exit;
+    } else if (status.repr != wuffs_base__suspension__short_read) {
+      ret = wuffs_base__status__message(&status);
+      goto exit;
+    }
+    release_chunk(c);
+  }
+  ret = "main: unexpected end of deflate stream";
+
+exit:
+  free(serial);
+  free(serial_dst);
+  // Let any worker threads finish promptly.
+  pthread_mutex_lock(&g.mutex);
+  g.next_chunk = g.num_chunks;
+  pthread_cond_broadcast(&g.cond);
+  pthread_mutex_unlock(&g.mutex);
+  return ret;
+}
+
+// ----
+
+static const char*  //
+parse_header() {
+  const uint8_t* p = g.src_ptr;
+  size_t n = g.src_len;
+
+  if (g_flags.raw) {
+    g.fmt = FORMAT_RAW;
+    g.deflate_lo = 0;
+    return NULL;
+  }
+
+  if ((n >= 10) && (p[0] == 0x1F) && (p[1] == 0x8B)) {
+    g.fmt = FORMAT_GZIP;
+    if (p[2] != 0x08) {
+      return "main: unsupported gzip compression method";
+    }
+    uint8_t flags = p[3];
+    size_t i = 10;
+    if (flags & 0x04) {  // FEXTRA.
+      if ((n - i) < 2) {
+        return "main: truncated gzip header";
+      }
+      size_t xlen = ((size_t)(p[i + 0]) << 0) | ((size_t)(p[i + 1]) << 8);
+      i += 2;
+      if ((n - i) < xlen) {
+        return "main: truncated gzip header";
+      }
+      i += xlen;
+    }
+    int j;
+    for (j = 0; j < 2; j++) {
+      if (flags & ((j == 0) ? 0x08 : 0x10)) {  // FNAME, FCOMMENT.
+        while (true) {
+          if (i >= n) {
+            return "main: truncated gzip header";
+          }
+          if (p[i++] == 0x00) {
+            break;
+          }
+        }
+      }
+    }
+    if (flags & 0x02) {  // FHCRC.
+      if ((n - i) < 2) {
+        return "main: truncated gzip header";
+      }
+      i += 2;
+    }
+    g.deflate_lo = i;
+    return NULL;
+  }
+
+  if ((n >= 2) && ((p[0] & 0x0F) == 0x08) && ((p[0] >> 4) <= 7) &&
+      ((((uint32_t)(p[0]) << 8) | ((uint32_t)(p[1]))) % 31) == 0) {
+    g.fmt = FORMAT_ZLIB;
+    if (p[1] & 0x20) {
+      return "main: unsupported zlib dictionary";
+    }
+    g.deflate_lo = 2;
+    return NULL;
+  }
+
+  return "main: unrecognized input format (try -raw for raw deflate)";
+}
+
+static const char*  //
+check_trailer(size_t deflate_hi) {
+  const uint8_t* p = g.src_ptr + deflate_hi;
+  size_t n = g.src_len - deflate_hi;
+  if (g.fmt == FORMAT_GZIP) {
+    if (n < 8) {
+      return "main: truncated gzip trailer";
+    }
+    uint32_t want_checksum = wuffs_base__load_u32le__no_bounds_check(p + 0);
+    uint32_t want_length = wuffs_base__load_u32le__no_bounds_check(p + 4);
+    if (g.checksum != want_checksum) {
+      return "main: bad gzip checksum";
+    } else if ((uint32_t)(g.total_len) != want_length) {
+      return "main: bad gzip length";
+    }
+  } else if (g.fmt == FORMAT_ZLIB) {
+    if (n < 4) {
+      return "main: truncated zlib trailer";
+    }
+    if (g.checksum != wuffs_base__load_u32be__no_bounds_check(p)) {
+      return "main: bad zlib checksum";
+    }
+  }
+  return NULL;
+}
+
+// make_chunks splits the deflate data at candidate full-flush points: just
+// after a "\x00\x00\xFF\xFF", at least g_flags.chunk_size bytes apart.
+static void  //
+make_chunks() {
+  static const uint8_t marker[4] = {0x00, 0x00, 0xFF, 0xFF};
+  size_t cap = 16;
+  g.chunks = (chunk*)calloc(cap, sizeof(chunk));
+  g.num_chunks = 0;
+
+  size_t lo = g.deflate_lo;
+  while (true) {
+    size_t hi = g.src_len;
+    if ((hi - lo) > g_flags.chunk_size) {
+      size_t j = lo + g_flags.chunk_size - 4;
+      while ((j + 4) <= g.src_len) {
+        const uint8_t* q =
+            (const uint8_t*)memchr(g.src_ptr + j, 0x00, g.src_len - (j + 3));
+        if (!q) {
+          break;
+        }
+        j = (size_t)(q - g.src_ptr);
+        if (!memcmp(q, marker, 4)) {
+          hi = j + 4;
+          break;
+        }
+        j++;
+      }
+    }
+
+    if (g.num_chunks == cap) {
+      cap *= 2;
+      g.chunks = (chunk*)realloc(g.chunks, cap * sizeof(chunk));
+    }
+    if (!g.chunks) {
+      fprintf(stderr, "main: out of memory\n");
+      exit(2);
+    }
+    chunk* c = &g.chunks[g.num_chunks++];
+    memset(c, 0, sizeof(*c));
+    c->src_lo = lo;
+    c->src_hi = hi;
+    c->last = hi == g.src_len;
+    if (c->last) {
+      break;
+    }
+    lo = hi;
+  }
+}
+
+static const char*  //
+read_input() {
+  int fd = 0;  // stdin.
+  if (g_flags.remaining_argc > 0) {
+    fd = open(g_flags.remaining_argv[0], O_RDONLY);
+    if (fd < 0) {
+      return strerror(errno);
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && (st.st_size > 0)) {
+      void* m = mmap(NULL, (size_t)(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if (m != MAP_FAILED) {
+        g.src_ptr = (const uint8_t*)m;
+        g.src_len = (size_t)(st.st_size);
+        return NULL;
+      }
+    }
+  }
+
+  size_t cap = 0;
+  uint8_t* buf = NULL;
+  while (true) {
+    if (g.src_len == cap) {
+      cap = cap ? (2 * cap) : (1024 * 1024);
+      buf = (uint8_t*)realloc(buf, cap);
+      if (!buf) {
+        return "main: out of memory";
+      }
+    }
+    ssize_t n = read(fd, buf + g.src_len, cap - g.src_len);
+    if (n < 0) {
+      if (errno != EINTR) {
+        return strerror(errno);
+      }
+      continue;
+    } else if (n == 0) {
+      break;
+    }
+    g.src_len += (size_t)n;
+  }
+  g.src_ptr = buf;
+  return NULL;
+}
+
+const char*  //
+main1(int argc, char** argv) {
+  const char* z = parse_flags(argc, argv);
+  if (z) {
+    return z;
+  }
+  if (g_flags.num_threads == 0) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    g_flags.num_threads = (n < 1)                 ? 1
+                          : (n > MAX_NUM_THREADS) ? MAX_NUM_THREADS
+                                                  : (uint32_t)(n);
+  }
+
+  z = read_input();
+  if (z) {
+    return z;
+  }
+  z = parse_header();
+  if (z) {
+    return z;
+  }
+  make_chunks();
+
+  pthread_mutex_init(&g.mutex, NULL);
+  pthread_cond_init(&g.cond, NULL);
+  g.window = 2 * (size_t)(g_flags.num_threads);
+  check_initialize(wuffs_crc32__ieee_hasher__initialize(
+      &g.crc32_combiner, sizeof g.crc32_combiner, WUFFS_VERSION, 0));
+  check_initialize(wuffs_adler32__hasher__initialize(
+      &g.adler32_combiner, sizeof g.adler32_combiner, WUFFS_VERSION, 0));
+  g.checksum = (g.fmt == FORMAT_ZLIB) ? 1 : 0;
+
+  pthread_t threads[MAX_NUM_THREADS];
+  uint32_t num_threads = 0;
+  for (; num_threads < g_flags.num_threads; num_threads++) {
+    if (pthread_create(&threads[num_threads], NULL, worker, NULL)) {
+      break;
+    }
+  }
+  if (num_threads == 0) {
+    return "main: could not create worker threads";
+  }
+
+  size_t deflate_hi = 0;
+  z = assemble(&deflate_hi);
+
+  uint32_t t;
+  for (t = 0; t < num_threads; t++) {
+    pthread_join(threads[t], NULL);
+  }
+  if (z) {
+    return z;
+  }
+  return check_trailer(deflate_hi);
+}
+
+int  //
+compute_exit_code(const char* status_msg) {
+  if (!status_msg) {
+    return 0;
+  }
+  size_t n = strnlen(status_msg, 2047);
+  if (n >= 2047) {
+    status_msg = "main: internal error: error message is too long";
+    n = strnlen(status_msg, 2047);
+  }
+  const int stderr_fd = 2;
+  ignore_return_value(write(stderr_fd, status_msg, n));
+  ignore_return_value(write(stderr_fd, "\n", 1));
+  // Return an exit code of 1 for regular (forseen) errors, e.g. badly
+  // formatted or unsupported input.
+  //
+  // Return an exit code of 2 for internal (exceptional) errors, e.g. defensive
+  // run-time checks found that an internal invariant did not hold.
+  //
+  // Automated testing, including badly formatted inputs, can therefore
+  // discriminate between expected failure (exit code 1) and unexpected failure
+  // (other non-zero exit codes). Specifically, exit code 2 for internal
+  // invariant violation, exit code 139 (which is 128 + SIGSEGV on x86_64
+  // linux) for a segmentation fault (e.g. null pointer dereference).
+  return strstr(status_msg, "internal error:") ? 2 : 1;
+}
+
+int  //
+main(int argc, char** argv) {
+  return compute_exit_code(main1(argc, argv));
+}
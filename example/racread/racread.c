@@ -0,0 +1,1400 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+racread decodes a RAC (Random Access Compression) file to stdout, using
+multiple threads. It reads from the named file (which it memory-maps), or from
+stdin if no file is named. To run:
+
+$CC -O3 racread.c -lpthread && ./a.out ../../test/data/sheep-more.rac; \
+rm -f a.out
+
+for a C compiler $CC, such as clang or gcc.
+
+The -drange=i..j flag restricts the output to that DSpace (decompressed)
+range, with the same syntax as "ractool -decode -drange=i..j". Either end can
+be omitted. The -j=N flag sets the number of worker threads, defaulting to the
+number of online processors.
+
+The RAC file format is specified in /doc/spec/rac-spec.md and the reference
+implementation is the Go github.com/google/wuffs/lib/rac package. This program
+is a C port of the reading half of that package, so that C and C++ software
+can serve RAC files without a Go runtime. It is in three parts, each of which
+only depends on the ones before it:
+
+  - rac_chunk_reader mirrors the Go rac.ChunkReader. It walks the index nodes
+    of an in-memory (e.g. memory-mapped) RAC file, via the
+    rac_chunk_reader__seek_to_chunk_containing and rac_chunk_reader__next_chunk
+    functions. It never copies or allocates: index nodes are read in place.
+  - rac_codec is a pluggable decompressor. This file provides rac_codec__zlib
+    (implemented by Wuffs' std/zlib, including RAC shared dictionaries). The
+    Zeroes codec is built in. Other codecs can be added by defining another
+    rac_codec value and passing it to rac_pool__initialize.
+  - rac_pool is a thread pool. rac_pool__read_at fills a caller-supplied
+    buffer with a DSpace range, decompressing the chunks that overlap that
+    range in parallel. It is safe to call concurrently, so a multi-threaded
+    server can share one rac_pool per RAC file.
+
+Those parts are plain C (that also compiles as C++) and can be lifted into
+another program as is. The rest of this file is the command line tool.
+
+Unlike the Go package, a RAC file here must be wholly in memory, as the
+rac_chunk_reader returns pointers into it instead of io.ReadSeeker reads.
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c whitelist which parts of Wuffs to build. That file contains
+// the entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__CRC32
+#define WUFFS_CONFIG__MODULE__DEFLATE
+#define WUFFS_CONFIG__MODULE__ZLIB
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../release/c/wuffs-unsupported-snapshot.c"
+
+#ifndef DEFAULT_WINDOW_SIZE
+#define DEFAULT_WINDOW_SIZE (16 * 1024 * 1024)
+#endif
+
+#define MAX_NUM_THREADS 256
+
+// ---------------- RAC Chunk Reader
+
+#define RAC_CODEC__ZEROES ((uint64_t)0x0000000000000000)
+#define RAC_CODEC__ZLIB ((uint64_t)0x0100000000000000)
+#define RAC_CODEC__LZ4 ((uint64_t)0x0200000000000000)
+#define RAC_CODEC__ZSTANDARD ((uint64_t)0x0300000000000000)
+
+#define RAC_CODEC__LONG_ZEROES ((uint64_t)0x8000000000000000)
+#define RAC_CODEC__INVALID ((uint64_t)0xFFFFFFFFFFFFFFFF)
+
+const char rac_error__internal_error_inconsistent_state[] =
+    "rac: internal error: inconsistent state";
+const char rac_error__invalid_chunk[] = "rac: invalid chunk";
+const char rac_error__invalid_chunk_too_large[] =
+    "rac: invalid chunk (too large)";
+const char rac_error__invalid_chunk_truncated[] =
+    "rac: invalid chunk (truncated)";
+const char rac_error__invalid_compressed_size[] =
+    "rac: invalid CompressedSize";
+const char rac_error__invalid_dictionary[] = "rac: invalid dictionary";
+const char rac_error__invalid_index_node[] = "rac: invalid index node";
+const char rac_error__invalid_input_missing_magic_bytes[] =
+    "rac: invalid input: missing magic bytes";
+const char rac_error__invalid_input_missing_root_node[] =
+    "rac: invalid input: missing root node";
+const char rac_error__invalid_range[] = "rac: invalid range";
+const char rac_error__out_of_memory[] = "rac: out of memory";
+const char rac_error__unsupported_codec[] = "rac: unsupported codec";
+const char rac_error__unsupported_rac_file_version[] =
+    "rac: unsupported RAC file version";
+
+// rac_note__end_of_data is returned by rac_chunk_reader__next_chunk when there
+// are no more chunks. Like io.EOF in Go, it is not an error per se.
+const char rac_note__end_of_data[] = "rac: end of data";
+
+// rac_chunk is a compressed chunk returned by a rac_chunk_reader. Its ranges
+// are absolute offsets: drange in DSpace and the other three in CSpace.
+//
+// See the RAC specification for further discussion.
+typedef struct {
+  wuffs_base__range_ie_u64 drange;
+  wuffs_base__range_ie_u64 cprimary;
+  wuffs_base__range_ie_u64 csecondary;
+  wuffs_base__range_ie_u64 ctertiary;
+  uint8_t stag;
+  uint8_t ttag;
+  // codec does not have the Mix Bit set.
+  uint64_t codec;
+} rac_chunk;
+
+// rac_chunk_reader parses an in-memory RAC file. It is the C equivalent of
+// the Go rac.ChunkReader type.
+//
+// It is not safe for concurrent use, but it holds no resources (other than a
+// pointer to the RAC file's bytes), so after rac_chunk_reader__initialize
+// succeeds, a copy (by assignment or memcpy) is an independent reader.
+typedef struct {
+  const uint8_t* src_ptr;
+  uint64_t src_len;
+
+  // status_message is the first error encountered. It is sticky: once it is
+  // non-NULL, all functions will return that error.
+  const char* status_message;
+
+  uint64_t decompressed_size;
+  const uint8_t* root_node;
+
+  // seek_position gives, if need_to_resolve_seek_position is true, the
+  // position in DSpace that rac_chunk_reader__next_chunk needs to find.
+  uint64_t seek_position;
+  bool need_to_resolve_seek_position;
+
+  // The i (as in "the i'th child of curr_node") that denotes the next chunk
+  // to be returned by rac_chunk_reader__next_chunk. If next_chunk equals
+  // curr_node's arity, then curr_node is exhausted.
+  uint32_t next_chunk;
+
+  // The CBias and DBias of curr_node.
+  uint64_t curr_node_cbias;
+  uint64_t curr_node_dbias;
+
+  const uint8_t* curr_node;
+} rac_chunk_reader;
+
+// The rac_node__etc functions take a pointer to a node's bytes. None of them,
+// other than rac_node__valid, should be called unless rac_node__valid returns
+// true.
+
+static inline uint32_t  //
+rac_node__size(uint8_t arity) {
+  return (16 * (uint32_t)(arity)) + 16;
+}
+
+static inline uint32_t  //
+rac_node__arity(const uint8_t* b) {
+  return b[3];
+}
+
+static inline bool  //
+rac_node__codec_has_mix_bit(const uint8_t* b) {
+  return b[(8 * b[3]) + 7] & 0x40;
+}
+
+static inline uint64_t  //
+rac_node__cptr_max(const uint8_t* b) {
+  return wuffs_base__load_u48le__no_bounds_check(b + (16 * b[3]) + 8);
+}
+
+static inline uint64_t  //
+rac_node__dptr_max(const uint8_t* b) {
+  return wuffs_base__load_u48le__no_bounds_check(b + (8 * b[3]));
+}
+
+static inline uint8_t  //
+rac_node__version(const uint8_t* b) {
+  return b[(16 * b[3]) + 14];
+}
+
+static inline uint8_t  //
+rac_node__clen(const uint8_t* b, uint32_t i) {
+  return b[(8 * i) + (8 * b[3]) + 14];
+}
+
+static inline uint8_t  //
+rac_node__stag(const uint8_t* b, uint32_t i) {
+  return b[(8 * i) + (8 * b[3]) + 15];
+}
+
+static inline uint8_t  //
+rac_node__ttag(const uint8_t* b, uint32_t i) {
+  return b[(8 * i) + 7];
+}
+
+static inline bool  //
+rac_node__is_leaf(const uint8_t* b, uint32_t i) {
+  return b[(8 * i) + 7] != 0xFE;
+}
+
+static inline uint64_t  //
+rac_node__coff(const uint8_t* b, uint32_t i, uint64_t cbias) {
+  return cbias +
+         wuffs_base__load_u48le__no_bounds_check(b + (8 * i) + (8 * b[3]) + 8);
+}
+
+static inline uint64_t  //
+rac_node__doff(const uint8_t* b, uint32_t i, uint64_t dbias) {
+  if (i == 0) {
+    return dbias;
+  }
+  return dbias + wuffs_base__load_u48le__no_bounds_check(b + (8 * i));
+}
+
+static inline uint64_t  //
+rac_node__dsize(const uint8_t* b, uint32_t i) {
+  return rac_node__doff(b, i + 1, 0) - rac_node__doff(b, i, 0);
+}
+
+static wuffs_base__range_ie_u64  //
+rac_node__coff_range(const uint8_t* b, uint32_t i, uint64_t cbias) {
+  uint64_t m = cbias + rac_node__cptr_max(b);
+  if (i >= rac_node__arity(b)) {
+    return wuffs_base__make_range_ie_u64(m, m);
+  }
+  uint64_t coff = rac_node__coff(b, i, cbias);
+  uint8_t clen = rac_node__clen(b, i);
+  if (clen != 0) {
+    uint64_t n = coff + ((uint64_t)(clen) * 1024);
+    if (m > n) {
+      m = n;
+    }
+  }
+  return wuffs_base__make_range_ie_u64(coff, m);
+}
+
+static bool  //
+rac_codec__valid(uint64_t c) {
+  if ((c >> 63) == 0) {
+    return ((c << 8) == 0) && ((c >> 62) == 0);
+  }
+  return (c >> 56) == 0x80;
+}
+
+// rac_node__codec returns the 1-byte (short) or 7-byte (long) codec, without
+// the Mix Bit, or RAC_CODEC__INVALID.
+static uint64_t  //
+rac_node__codec(const uint8_t* b) {
+  uint32_t arity = b[3];
+  uint8_t c_byte = b[(8 * arity) + 7];
+
+  // Look for a short codec.
+  if ((c_byte & 0x80) == 0) {
+    return ((uint64_t)(c_byte & 0x3F)) << 56;
+  }
+  c_byte &= 0x3F;
+
+  // Look for a long codec.
+  uint32_t j;
+  for (j = 0; j < 4; j++) {
+    uint32_t i = c_byte | (j << 6);
+    if ((i < arity) && (rac_node__ttag(b, i) == 0xFD)) {
+      uint64_t c =
+          wuffs_base__load_u64le__no_bounds_check(b + (8 * i) + (8 * arity) + 8);
+      return (c & 0x00FFFFFFFFFFFFFF) | 0x8000000000000000;
+    }
+  }
+  return RAC_CODEC__INVALID;
+}
+
+// rac_node__find_chunk_containing returns the largest i < arity such that the
+// i'th DOff is less than or equal to doff, or arity if there is no such i
+// (which should not happen for a valid node and an in-range doff).
+static uint32_t  //
+rac_node__find_chunk_containing(const uint8_t* b,
+                                uint64_t doff,
+                                uint64_t dbias) {
+  // Binary search for the smallest x such that the x'th DOff is greater than
+  // doff. The DOff values are non-decreasing.
+  uint32_t lo = 0;
+  uint32_t hi = rac_node__arity(b);
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) >> 1;
+    if (rac_node__doff(b, mid, dbias) <= doff) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return (lo > 0) ? (lo - 1) : rac_node__arity(b);
+}
+
+static rac_chunk  //
+rac_node__chunk(const uint8_t* b, uint32_t i, uint64_t cbias, uint64_t dbias) {
+  rac_chunk c;
+  c.stag = rac_node__stag(b, i);
+  c.ttag = rac_node__ttag(b, i);
+  c.drange = wuffs_base__make_range_ie_u64(rac_node__doff(b, i, dbias),
+                                           rac_node__doff(b, i + 1, dbias));
+  c.cprimary = rac_node__coff_range(b, i, cbias);
+  c.csecondary = rac_node__coff_range(b, c.stag, cbias);
+  c.ctertiary = rac_node__coff_range(b, c.ttag, cbias);
+  c.codec = rac_node__codec(b);
+  return c;
+}
+
+// rac_node__valid returns whether the node is valid, in isolation. The caller
+// must ensure that b[0 .. rac_node__size(b[3])] is readable.
+static bool  //
+rac_node__valid(const uint8_t* b) {
+  // Check the magic and arity.
+  if ((b[0] != 0x72) || (b[1] != 0xC3) || (b[2] != 0x63) || (b[3] == 0)) {
+    return false;
+  }
+  uint32_t arity = b[3];
+  uint32_t size = rac_node__size(b[3]);
+  if (b[3] != b[size - 1]) {
+    return false;
+  }
+
+  // Check that the "Reserved (0)" bytes are zero and that the TTag values
+  // aren't in the reserved range [0xC0, 0xFD).
+  bool has_children = false;
+  uint32_t i;
+  for (i = 0; i < arity; i++) {
+    if (b[(8 * i) + 6] != 0) {
+      return false;
+    }
+    uint8_t ttag = b[(8 * i) + 7];
+    if ((0xC0 <= ttag) && (ttag < 0xFD)) {
+      return false;
+    } else if (ttag != 0xFD) {
+      has_children = true;
+    }
+  }
+  if (!has_children || (b[(8 * arity) + 6] != 0)) {
+    return false;
+  }
+
+  // Check that the DPtr values are non-decreasing. The first DPtr value is
+  // implicitly zero.
+  uint64_t prev = 0;
+  for (i = 1; i <= arity; i++) {
+    uint64_t curr = wuffs_base__load_u48le__no_bounds_check(b + (8 * i));
+    if (curr < prev) {
+      return false;
+    } else if ((curr != prev) && (b[(8 * i) + 7] == 0xFD)) {
+      return false;
+    }
+    prev = curr;
+  }
+
+  // Check that no CPtr value exceeds CPtrMax (the final CPtr value), other
+  // than 0xFD Codec Entries.
+  uint64_t cptr_max = wuffs_base__load_u48le__no_bounds_check(b + size - 8);
+  for (i = 0; i < arity; i++) {
+    uint64_t cptr =
+        wuffs_base__load_u48le__no_bounds_check(b + (8 * i) + (8 * arity) + 8);
+    if ((cptr > cptr_max) && (b[(8 * i) + 7] != 0xFD)) {
+      return false;
+    }
+  }
+
+  // Check the the version is non-zero.
+  if (b[(16 * arity) + 14] == 0) {
+    return false;
+  }
+
+  // Check the checksum.
+  wuffs_crc32__ieee_hasher h;
+  if (wuffs_crc32__ieee_hasher__initialize(
+          &h, sizeof h, WUFFS_VERSION,
+          WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED)
+          .repr) {
+    return false;
+  }
+  uint32_t checksum = wuffs_crc32__ieee_hasher__update_u32(
+      &h, wuffs_base__make_slice_u8((uint8_t*)(uintptr_t)(b + 6), size - 6));
+  checksum ^= checksum >> 16;
+  if ((b[4] != (uint8_t)(checksum >> 0)) ||
+      (b[5] != (uint8_t)(checksum >> 8))) {
+    return false;
+  }
+
+  // Further checking of the codec, version, COffMax and DOffMax requires
+  // more context, and is done in rac_chunk_reader__load_and_validate.
+
+  return rac_codec__valid(rac_node__codec(b));
+}
+
+// rac_chunk_reader__try_root_node sets r->root_node and returns true if there
+// is a valid root node with the given arity at the start (or end) of the file.
+static bool  //
+rac_chunk_reader__try_root_node(rac_chunk_reader* r,
+                                uint8_t arity,
+                                bool from_end) {
+  if (arity == 0) {
+    return false;
+  }
+  uint64_t size = rac_node__size(arity);
+  if (r->src_len < size) {
+    return false;
+  }
+  const uint8_t* b = r->src_ptr + (from_end ? (r->src_len - size) : 0);
+  if ((b[3] != arity) || !rac_node__valid(b) ||
+      (rac_node__cptr_max(b) != r->src_len)) {
+    return false;
+  }
+  r->root_node = b;
+  r->decompressed_size = rac_node__dptr_max(b);
+  return true;
+}
+
+// rac_chunk_reader__initialize sets up r to read the RAC file held in
+// src_ptr[.. src_len], which must outlive r (and any copies of r). It returns
+// NULL on success or an error message.
+const char*  //
+rac_chunk_reader__initialize(rac_chunk_reader* r,
+                             const uint8_t* src_ptr,
+                             size_t src_len) {
+  memset(r, 0, sizeof(*r));
+  r->src_ptr = src_ptr;
+  r->src_len = src_len;
+
+  // The smallest valid RAC file is 32 bytes long.
+  if (!src_ptr || (src_len < 32)) {
+    r->status_message = rac_error__invalid_compressed_size;
+    return r->status_message;
+  }
+
+  // Look at the start of the compressed file, then at the end.
+  if ((src_ptr[0] != 0x72) || (src_ptr[1] != 0xC3) || (src_ptr[2] != 0x63)) {
+    r->status_message = rac_error__invalid_input_missing_magic_bytes;
+    return r->status_message;
+  }
+  if (!rac_chunk_reader__try_root_node(r, src_ptr[3], false) &&
+      !rac_chunk_reader__try_root_node(r, src_ptr[src_len - 1], true)) {
+    r->status_message = rac_error__invalid_input_missing_root_node;
+    return r->status_message;
+  }
+  if (rac_node__version(r->root_node) != 1) {
+    r->status_message = rac_error__unsupported_rac_file_version;
+    return r->status_message;
+  }
+  r->need_to_resolve_seek_position = true;
+  return NULL;
+}
+
+// rac_chunk_reader__load_and_validate returns the child node at coffset, or
+// NULL if it is invalid (in isolation or relative to its parent).
+static const uint8_t*  //
+rac_chunk_reader__load_and_validate(const rac_chunk_reader* r,
+                                    uint64_t coffset,
+                                    uint64_t parent_codec,
+                                    bool parent_codec_has_mix_bit,
+                                    uint8_t parent_version,
+                                    uint64_t parent_coff_max,
+                                    uint64_t child_cbias,
+                                    uint64_t child_dsize) {
+  if ((r->src_len < 4) || ((r->src_len - 4) < coffset)) {
+    return NULL;
+  }
+  const uint8_t* b = r->src_ptr + coffset;
+  if (b[3] == 0) {
+    return NULL;
+  }
+  uint64_t size = rac_node__size(b[3]);
+  if ((r->src_len < size) || ((r->src_len - size) < coffset) ||
+      !rac_node__valid(b)) {
+    return NULL;
+  }
+
+  // Validate the parent and child codec, version, COffMax and DOffMax.
+  if (((parent_codec != rac_node__codec(b)) && !parent_codec_has_mix_bit) ||
+      (parent_version < rac_node__version(b)) ||
+      (parent_coff_max < (child_cbias + rac_node__cptr_max(b))) ||
+      (child_dsize != rac_node__dptr_max(b))) {
+    return NULL;
+  }
+  return b;
+}
+
+static const char*  //
+rac_chunk_reader__resolve_seek_position(rac_chunk_reader* r) {
+  // Start at the root node. It has already been validated, during
+  // rac_chunk_reader__initialize.
+  const uint8_t* b = r->root_node;
+
+  // Walk the branch nodes until we find the leaf node containing the
+  // seek_position.
+  uint64_t cbias = 0;
+  uint64_t dbias = 0;
+  while (true) {
+    uint32_t i = rac_node__find_chunk_containing(b, r->seek_position, dbias);
+    if (i >= rac_node__arity(b)) {
+      return rac_error__internal_error_inconsistent_state;
+    } else if (rac_node__is_leaf(b, i)) {
+      r->curr_node = b;
+      r->next_chunk = i;
+      r->curr_node_cbias = cbias;
+      r->curr_node_dbias = dbias;
+      return NULL;
+    }
+
+    uint64_t child_cbias = cbias;
+    uint8_t stag = rac_node__stag(b, i);
+    if (stag < rac_node__arity(b)) {
+      child_cbias = rac_node__coff(b, stag, cbias);
+    }
+    const uint8_t* child = rac_chunk_reader__load_and_validate(
+        r, rac_node__coff(b, i, cbias), rac_node__codec(b),
+        rac_node__codec_has_mix_bit(b), rac_node__version(b),
+        cbias + rac_node__cptr_max(b), child_cbias, rac_node__dsize(b, i));
+    if (!child) {
+      return rac_error__invalid_index_node;
+    }
+
+    dbias = rac_node__doff(b, i, dbias);
+    cbias = child_cbias;
+    b = child;
+  }
+}
+
+// rac_chunk_reader__seek_to_chunk_containing sets up
+// rac_chunk_reader__next_chunk to return the chunk containing dspace_offset.
+// That chunk does not necessarily start at dspace_offset.
+const char*  //
+rac_chunk_reader__seek_to_chunk_containing(rac_chunk_reader* r,
+                                           uint64_t dspace_offset) {
+  if (r->status_message) {
+    return r->status_message;
+  }
+  r->need_to_resolve_seek_position = true;
+  r->seek_position = dspace_offset;
+  return NULL;
+}
+
+// rac_chunk_reader__next_chunk sets *c to the next independently compressed
+// chunk and returns NULL, or returns rac_note__end_of_data if there are no
+// more chunks, or returns an error message.
+//
+// Empty chunks (those that contain no decompressed data, only metadata) are
+// skipped.
+const char*  //
+rac_chunk_reader__next_chunk(rac_chunk_reader* r, rac_chunk* c) {
+  if (r->status_message) {
+    return r->status_message;
+  }
+  while (true) {
+    if (r->need_to_resolve_seek_position) {
+      if (r->seek_position >= r->decompressed_size) {
+        return rac_note__end_of_data;
+      }
+      r->need_to_resolve_seek_position = false;
+      const char* z = rac_chunk_reader__resolve_seek_position(r);
+      if (z) {
+        r->status_message = z;
+        return z;
+      }
+    }
+    uint32_t n = rac_node__arity(r->curr_node);
+    while (r->next_chunk < n) {
+      *c = rac_node__chunk(r->curr_node, r->next_chunk++, r->curr_node_cbias,
+                           r->curr_node_dbias);
+      r->seek_position = c->drange.max_excl;
+      if (c->drange.min_incl < c->drange.max_excl) {
+        return NULL;
+      }
+    }
+    r->need_to_resolve_seek_position = true;
+  }
+}
+
+// ---------------- RAC Codecs
+
+// rac_codec is a pluggable decompressor for the chunks whose (Mix Bit free)
+// codec equals the codec field.
+//
+// new_context returns a newly allocated decompressor (or NULL on allocation
+// failure), which delete_context frees. Contexts are not shared across
+// threads, so each rac_pool worker thread creates its own, once.
+//
+// decompress decodes the chunk, reading from the RAC file held in
+// src_ptr[.. src_len] and writing to dst_ptr[.. dst_len], where dst_len is
+// the chunk's DRange size. It sets *num_written to the number of bytes
+// written, which may be less than dst_len: the remaining (implicit) bytes are
+// zero. Decoding more than dst_len bytes is an error.
+typedef struct {
+  uint64_t codec;
+  void* (*new_context)(void);
+  void (*delete_context)(void* context);
+  const char* (*decompress)(void* context,
+                            const uint8_t* src_ptr,
+                            size_t src_len,
+                            const rac_chunk* chunk,
+                            uint8_t* dst_ptr,
+                            size_t dst_len,
+                            size_t* num_written);
+} rac_codec;
+
+// rac_load_dictionary sets *dict to the shared dictionary, if any, in the
+// chunk's CSecondary range, and verifies its checksum. The RAC file format
+// does not mandate any particular dictionary format, but this is the one used
+// by the Go raczlib and raczstd packages: a uint32le length (whose high 2 bits
+// are zero), the dictionary bytes and then their uint32le CRC-32 IEEE checksum.
+//
+// The checksum is skipped if the CSecondary range equals *verified, which is
+// updated on success.
+static const char*  //
+rac_load_dictionary(const uint8_t* src_ptr,
+                    size_t src_len,
+                    const rac_chunk* chunk,
+                    wuffs_base__range_ie_u64* verified,
+                    wuffs_base__slice_u8* dict) {
+  *dict = wuffs_base__empty_slice_u8();
+  wuffs_base__range_ie_u64 c = chunk->csecondary;
+  if (chunk->ctertiary.min_incl != chunk->ctertiary.max_excl) {
+    return rac_error__invalid_dictionary;
+  } else if (c.min_incl == c.max_excl) {
+    return NULL;
+  } else if ((c.max_excl > src_len) || (c.min_incl > c.max_excl) ||
+             ((c.max_excl - c.min_incl) < 8) || (chunk->ttag != 0xFF)) {
+    return rac_error__invalid_dictionary;
+  }
+
+  const uint8_t* p = src_ptr + c.min_incl;
+  uint64_t n = wuffs_base__load_u32le__no_bounds_check(p);
+  if (((n >> 30) != 0) || ((n + 8) > (c.max_excl - c.min_incl))) {
+    return rac_error__invalid_dictionary;
+  }
+  *dict = wuffs_base__make_slice_u8((uint8_t*)(uintptr_t)(p + 4), n);
+
+  if ((verified->min_incl != c.min_incl) ||
+      (verified->max_excl != c.max_excl)) {
+    wuffs_crc32__ieee_hasher h;
+    wuffs_base__status status = wuffs_crc32__ieee_hasher__initialize(
+        &h, sizeof h, WUFFS_VERSION,
+        WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED);
+    if (status.repr) {
+      return wuffs_base__status__message(&status);
+    } else if (wuffs_crc32__ieee_hasher__update_u32(&h, *dict) !=
+               wuffs_base__load_u32le__no_bounds_check(p + 4 + n)) {
+      *dict = wuffs_base__empty_slice_u8();
+      return rac_error__invalid_dictionary;
+    }
+    *verified = c;
+  }
+  return NULL;
+}
+
+typedef struct {
+  wuffs_zlib__decoder dec;
+  wuffs_base__range_ie_u64 verified_dictionary;
+  uint8_t work_buffer[WUFFS_ZLIB__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE];
+} rac_zlib_context;
+
+static void*  //
+rac_zlib__new_context(void) {
+  rac_zlib_context* ctx = (rac_zlib_context*)calloc(1, sizeof(*ctx));
+  return ctx;
+}
+
+static void  //
+rac_zlib__delete_context(void* context) {
+  free(context);
+}
+
+static const char*  //
+rac_zlib__decompress(void* context,
+                     const uint8_t* src_ptr,
+                     size_t src_len,
+                     const rac_chunk* chunk,
+                     uint8_t* dst_ptr,
+                     size_t dst_len,
+                     size_t* num_written) {
+  rac_zlib_context* ctx = (rac_zlib_context*)context;
+  wuffs_base__slice_u8 dict;
+  const char* z = rac_load_dictionary(src_ptr, src_len, chunk,
+                                      &ctx->verified_dictionary, &dict);
+  if (z) {
+    return z;
+  }
+
+  wuffs_base__range_ie_u64 c = chunk->cprimary;
+  if ((c.max_excl > src_len) || (c.min_incl > c.max_excl)) {
+    return rac_error__invalid_chunk;
+  }
+  wuffs_base__status status = wuffs_zlib__decoder__initialize(
+      &ctx->dec, sizeof ctx->dec, WUFFS_VERSION,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED);
+  if (status.repr) {
+    return wuffs_base__status__message(&status);
+  }
+
+  wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+      (uint8_t*)(uintptr_t)(src_ptr + c.min_incl), c.max_excl - c.min_incl,
+      true);
+  wuffs_base__io_buffer dst = wuffs_base__ptr_u8__writer(dst_ptr, dst_len);
+
+  // Once dst is full, keep decoding into a 1-byte spare buffer, to tell
+  // whether the chunk ends there or is too large.
+  uint8_t spare[1];
+  bool full = false;
+  while (true) {
+    status = wuffs_zlib__decoder__transform_io(
+        &ctx->dec, &dst, &src,
+        wuffs_base__make_slice_u8(
+            ctx->work_buffer,
+            WUFFS_ZLIB__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE));
+    if (!full) {
+      *num_written = dst.meta.wi;
+    }
+
+    if (status.repr == NULL) {
+      break;
+    } else if (status.repr == wuffs_zlib__note__dictionary_required) {
+      if (dict.len == 0) {
+        return rac_error__invalid_dictionary;
+      }
+      wuffs_zlib__decoder__add_dictionary(&ctx->dec, dict);
+    } else if (status.repr == wuffs_base__suspension__short_write) {
+      if (full) {
+        return rac_error__invalid_chunk_too_large;
+      }
+      full = true;
+      dst = wuffs_base__ptr_u8__writer(spare, sizeof spare);
+    } else if (status.repr == wuffs_base__suspension__short_read) {
+      return rac_error__invalid_chunk_truncated;
+    } else {
+      return wuffs_base__status__message(&status);
+    }
+  }
+  return (full && (dst.meta.wi > 0)) ? rac_error__invalid_chunk_too_large
+                                     : NULL;
+}
+
+const rac_codec rac_codec__zlib = {
+    RAC_CODEC__ZLIB,
+    &rac_zlib__new_context,
+    &rac_zlib__delete_context,
+    &rac_zlib__decompress,
+};
+
+// ---------------- RAC Thread Pool
+
+#define RAC_POOL__MAX_NUM_CODECS 16
+
+struct rac_job__struct;
+
+typedef struct rac_task__struct {
+  struct rac_task__struct* next;
+  struct rac_job__struct* job;
+  rac_chunk chunk;
+} rac_task;
+
+// rac_job is one rac_pool__read_at call. Its num_remaining and status_message
+// fields are guarded by the pool's mutex.
+typedef struct rac_job__struct {
+  uint8_t* dst_ptr;
+  wuffs_base__range_ie_u64 drange;
+  size_t num_remaining;
+  const char* status_message;
+} rac_job;
+
+struct rac_pool__struct;
+
+typedef struct {
+  struct rac_pool__struct* pool;
+  pthread_t thread;
+
+  // contexts[i] is this worker's context for the pool's codecs[i], created
+  // on first use.
+  void* contexts[RAC_POOL__MAX_NUM_CODECS];
+
+  // scratch holds a whole chunk, when only part of it is wanted.
+  uint8_t* scratch_ptr;
+  size_t scratch_cap;
+} rac_pool_worker;
+
+// rac_pool decompresses a RAC file's chunks on a pool of worker threads.
+typedef struct rac_pool__struct {
+  rac_chunk_reader chunk_reader;
+  const rac_codec* codecs[RAC_POOL__MAX_NUM_CODECS];
+  size_t num_codecs;
+
+  // The mutex guards the task queue, the closing field and every in-flight
+  // rac_job. Workers wait on work_cond and rac_pool__read_at callers wait on
+  // done_cond.
+  pthread_mutex_t mutex;
+  pthread_cond_t work_cond;
+  pthread_cond_t done_cond;
+  rac_task* head;
+  rac_task* tail;
+  bool closing;
+
+  rac_pool_worker* workers;
+  uint32_t num_workers;
+} rac_pool;
+
+static const char*  //
+rac_pool_worker__decode(rac_pool_worker* w, const rac_task* t) {
+  rac_pool* p = w->pool;
+  const rac_chunk* c = &t->chunk;
+  const rac_job* job = t->job;
+
+  // Write the intersection of the chunk's and the job's DRange.
+  uint64_t lo = wuffs_base__u64__max(c->drange.min_incl, job->drange.min_incl);
+  uint64_t hi = wuffs_base__u64__min(c->drange.max_excl, job->drange.max_excl);
+  uint8_t* dst_ptr = job->dst_ptr + (lo - job->drange.min_incl);
+  uint64_t dsize = c->drange.max_excl - c->drange.min_incl;
+
+  if ((c->codec == RAC_CODEC__ZEROES) ||
+      (c->codec == RAC_CODEC__LONG_ZEROES)) {
+    memset(dst_ptr, 0, hi - lo);
+    return NULL;
+  }
+
+  size_t i = 0;
+  while ((i < p->num_codecs) && (p->codecs[i]->codec != c->codec)) {
+    i++;
+  }
+  if (i == p->num_codecs) {
+    return rac_error__unsupported_codec;
+  } else if (!w->contexts[i]) {
+    w->contexts[i] = (*p->codecs[i]->new_context)();
+    if (!w->contexts[i]) {
+      return rac_error__out_of_memory;
+    }
+  }
+
+  // Decompress straight into the job's buffer if it wants the whole chunk.
+  // Otherwise, decompress into scratch space and copy the part it wants.
+  uint8_t* d = dst_ptr;
+  if ((lo != c->drange.min_incl) || (hi != c->drange.max_excl)) {
+    if (dsize > SIZE_MAX) {
+      return rac_error__out_of_memory;
+    } else if (w->scratch_cap < dsize) {
+      free(w->scratch_ptr);
+      w->scratch_cap = 0;
+      w->scratch_ptr = (uint8_t*)malloc(dsize);
+      if (!w->scratch_ptr) {
+        return rac_error__out_of_memory;
+      }
+      w->scratch_cap = dsize;
+    }
+    d = w->scratch_ptr;
+  }
+
+  size_t n = 0;
+  const char* z = (*p->codecs[i]->decompress)(
+      w->contexts[i], p->chunk_reader.src_ptr, p->chunk_reader.src_len, c, d,
+      dsize, &n);
+  if (z) {
+    return z;
+  } else if (n > dsize) {
+    return rac_error__invalid_chunk_too_large;
+  }
+  memset(d + n, 0, dsize - n);
+
+  if (d != dst_ptr) {
+    memcpy(dst_ptr, d + (lo - c->drange.min_incl), hi - lo);
+  }
+  return NULL;
+}
+
+static void*  //
+rac_pool_worker__run(void* arg) {
+  rac_pool_worker* w = (rac_pool_worker*)arg;
+  rac_pool* p = w->pool;
+  pthread_mutex_lock(&p->mutex);
+  while (true) {
+    rac_task* t = p->head;
+    if (!t) {
+      if (p->closing) {
+        break;
+      }
+      pthread_cond_wait(&p->work_cond, &p->mutex);
+      continue;
+    }
+    p->head = t->next;
+    if (!p->head) {
+      p->tail = NULL;
+    }
+
+    // Skip the work if another of the job's tasks has already failed.
+    const char* z = t->job->status_message;
+    if (!z) {
+      pthread_mutex_unlock(&p->mutex);
+      z = rac_pool_worker__decode(w, t);
+      pthread_mutex_lock(&p->mutex);
+      if (z && !t->job->status_message) {
+        t->job->status_message = z;
+      }
+    }
+    if (--t->job->num_remaining == 0) {
+      pthread_cond_broadcast(&p->done_cond);
+    }
+  }
+  pthread_mutex_unlock(&p->mutex);
+  return NULL;
+}
+
+// rac_pool__destroy stops and joins the worker threads and frees their
+// resources. The rac_pool must be idle: no rac_pool__read_at calls can be in
+// flight.
+void  //
+rac_pool__destroy(rac_pool* p) {
+  if (!p->workers) {
+    return;
+  }
+  pthread_mutex_lock(&p->mutex);
+  p->closing = true;
+  pthread_cond_broadcast(&p->work_cond);
+  pthread_mutex_unlock(&p->mutex);
+
+  uint32_t t;
+  for (t = 0; t < p->num_workers; t++) {
+    rac_pool_worker* w = &p->workers[t];
+    pthread_join(w->thread, NULL);
+    size_t i;
+    for (i = 0; i < p->num_codecs; i++) {
+      if (w->contexts[i]) {
+        (*p->codecs[i]->delete_context)(w->contexts[i]);
+      }
+    }
+    free(w->scratch_ptr);
+  }
+  free(p->workers);
+  p->workers = NULL;
+  p->num_workers = 0;
+
+  pthread_cond_destroy(&p->done_cond);
+  pthread_cond_destroy(&p->work_cond);
+  pthread_mutex_destroy(&p->mutex);
+}
+
+// rac_pool__initialize parses the RAC file held in src_ptr[.. src_len] (which
+// must outlive p) and starts num_threads worker threads. The codecs (at most
+// RAC_POOL__MAX_NUM_CODECS of them) are the non-Zeroes codecs to support.
+//
+// On success, rac_pool__destroy must eventually be called.
+const char*  //
+rac_pool__initialize(rac_pool* p,
+                     const uint8_t* src_ptr,
+                     size_t src_len,
+                     const rac_codec* const* codecs,
+                     size_t num_codecs,
+                     uint32_t num_threads) {
+  memset(p, 0, sizeof(*p));
+  const char* z =
+      rac_chunk_reader__initialize(&p->chunk_reader, src_ptr, src_len);
+  if (z) {
+    return z;
+  } else if ((num_codecs > RAC_POOL__MAX_NUM_CODECS) || (num_threads == 0)) {
+    return "rac: invalid argument";
+  }
+  memcpy(p->codecs, codecs, num_codecs * sizeof(codecs[0]));
+  p->num_codecs = num_codecs;
+
+  p->workers = (rac_pool_worker*)calloc(num_threads, sizeof(rac_pool_worker));
+  if (!p->workers) {
+    return rac_error__out_of_memory;
+  }
+  pthread_mutex_init(&p->mutex, NULL);
+  pthread_cond_init(&p->work_cond, NULL);
+  pthread_cond_init(&p->done_cond, NULL);
+  for (; p->num_workers < num_threads; p->num_workers++) {
+    rac_pool_worker* w = &p->workers[p->num_workers];
+    w->pool = p;
+    if (pthread_create(&w->thread, NULL, rac_pool_worker__run, w)) {
+      break;
+    }
+  }
+  if (p->num_workers == 0) {
+    rac_pool__destroy(p);
+    return "rac: could not create worker threads";
+  }
+  return NULL;
+}
+
+// rac_pool__decompressed_size returns the size of the RAC file in DSpace.
+uint64_t  //
+rac_pool__decompressed_size(const rac_pool* p) {
+  return p->chunk_reader.decompressed_size;
+}
+
+// rac_pool__read_at fills dst_ptr[.. hi - lo] with the DSpace range [lo, hi),
+// which must be within rac_pool__decompressed_size. The chunks overlapping
+// that range are decompressed in parallel. It blocks until they are done.
+//
+// It is safe to call concurrently, from multiple threads.
+const char*  //
+rac_pool__read_at(rac_pool* p, uint8_t* dst_ptr, uint64_t lo, uint64_t hi) {
+  if ((lo > hi) || (hi > p->chunk_reader.decompressed_size)) {
+    return rac_error__invalid_range;
+  } else if (lo == hi) {
+    return NULL;
+  }
+
+  rac_job job;
+  job.dst_ptr = dst_ptr;
+  job.drange = wuffs_base__make_range_ie_u64(lo, hi);
+  job.num_remaining = 0;
+  job.status_message = NULL;
+
+  // Find the chunks. The chunk reader only reads the index, so it's cheap
+  // compared to decompression, and this thread does it on its own copy.
+  rac_chunk_reader r = p->chunk_reader;
+  rac_task* tasks = NULL;
+  size_t num_tasks = 0;
+  size_t cap = 0;
+  const char* z = rac_chunk_reader__seek_to_chunk_containing(&r, lo);
+  while (!z) {
+    rac_chunk c;
+    z = rac_chunk_reader__next_chunk(&r, &c);
+    if (z) {
+      break;
+    } else if (c.drange.min_incl >= hi) {
+      z = rac_note__end_of_data;
+      break;
+    }
+    if (num_tasks == cap) {
+      cap = cap ? (2 * cap) : 16;
+      rac_task* t = (rac_task*)realloc(tasks, cap * sizeof(rac_task));
+      if (!t) {
+        z = rac_error__out_of_memory;
+        break;
+      }
+      tasks = t;
+    }
+    tasks[num_tasks].next = NULL;
+    tasks[num_tasks].job = &job;
+    tasks[num_tasks].chunk = c;
+    num_tasks++;
+  }
+  if (z != rac_note__end_of_data) {
+    free(tasks);
+    return z;
+  } else if ((num_tasks == 0) ||
+             (tasks[0].chunk.drange.min_incl > lo) ||
+             (tasks[num_tasks - 1].chunk.drange.max_excl < hi)) {
+    free(tasks);
+    return rac_error__internal_error_inconsistent_state;
+  }
+  size_t i;
+  for (i = 1; i < num_tasks; i++) {
+    tasks[i - 1].next = &tasks[i];
+  }
+
+  pthread_mutex_lock(&p->mutex);
+  job.num_remaining = num_tasks;
+  if (p->tail) {
+    p->tail->next = &tasks[0];
+  } else {
+    p->head = &tasks[0];
+  }
+  p->tail = &tasks[num_tasks - 1];
+  pthread_cond_broadcast(&p->work_cond);
+  while (job.num_remaining > 0) {
+    pthread_cond_wait(&p->done_cond, &p->mutex);
+  }
+  pthread_mutex_unlock(&p->mutex);
+
+  free(tasks);
+  return job.status_message;
+}
+
+// ---------------- Command Line Tool
+
+struct {
+  int remaining_argc;
+  char** remaining_argv;
+
+  uint64_t drange_lo;
+  uint64_t drange_hi;
+  bool has_drange_lo;
+  bool has_drange_hi;
+  uint32_t num_threads;
+} g_flags = {0};
+
+// parse_drange parses "i..j", where either or both of i and j can be omitted.
+static const char*  //
+parse_drange(char* arg) {
+  char* dots = strstr(arg, "..");
+  if (!dots) {
+    return "main: bad -drange flag value";
+  }
+  if (dots > arg) {
+    wuffs_base__result_u64 r = wuffs_base__parse_number_u64(
+        wuffs_base__make_slice_u8((uint8_t*)arg, (size_t)(dots - arg)));
+    if (r.status.repr) {
+      return "main: bad -drange flag value";
+    }
+    g_flags.drange_lo = r.value;
+    g_flags.has_drange_lo = true;
+  }
+  if (dots[2] != '\x00') {
+    wuffs_base__result_u64 r = wuffs_base__parse_number_u64(
+        wuffs_base__make_slice_u8((uint8_t*)(dots + 2), strlen(dots + 2)));
+    if (r.status.repr) {
+      return "main: bad -drange flag value";
+    }
+    g_flags.drange_hi = r.value;
+    g_flags.has_drange_hi = true;
+  }
+  if (g_flags.has_drange_lo && g_flags.has_drange_hi &&
+      (g_flags.drange_lo > g_flags.drange_hi)) {
+    return "main: bad -drange flag value";
+  }
+  return NULL;
+}
+
+const char*  //
+parse_flags(int argc, char** argv) {
+  int c = (argc > 0) ? 1 : 0;  // Skip argv[0], the program name.
+  for (; c < argc; c++) {
+    char* arg = argv[c];
+    if (*arg++ != '-') {
+      break;
+    }
+
+    // A double-dash "--foo" is equivalent to a single-dash "-foo". As special
+    // cases, a bare "-" is not a flag (some programs may interpret it as
+    // stdin) and a bare "--" means to stop parsing flags.
+    if (*arg == '\x00') {
+      break;
+    } else if (*arg == '-') {
+      arg++;
+      if (*arg == '\x00') {
+        c++;
+        break;
+      }
+    }
+
+    if (!strncmp(arg, "drange=", 7)) {
+      const char* z = parse_drange(arg + 7);
+      if (z) {
+        return z;
+      }
+      continue;
+    }
+    if (!strncmp(arg, "j=", 2)) {
+      wuffs_base__result_u64 r = wuffs_base__parse_number_u64(
+          wuffs_base__make_slice_u8((uint8_t*)(arg + 2), strlen(arg + 2)));
+      if (r.status.repr || (r.value < 1) || (r.value > MAX_NUM_THREADS)) {
+        return "main: bad -j flag value";
+      }
+      g_flags.num_threads = (uint32_t)(r.value);
+      continue;
+    }
+
+    return "main: unrecognized flag argument";
+  }
+
+  g_flags.remaining_argc = argc - c;
+  g_flags.remaining_argv = argv + c;
+  return NULL;
+}
+
+// ----
+
+// ignore_return_value suppresses errors from -Wall -Werror.
+static void  //
+ignore_return_value(int ignored) {}
+
+struct {
+  const uint8_t* src_ptr;
+  size_t src_len;
+
+  rac_pool pool;
+
+  uint8_t* window_ptr;
+  size_t window_cap;
+} g;
+
+static const char*  //
+write_to_stdout(const uint8_t* ptr, size_t len) {
+  while (len > 0) {
+    const int stdout_fd = 1;
+    ssize_t n = write(stdout_fd, ptr, len);
+    if (n < 0) {
+      if (errno != EINTR) {
+        return strerror(errno);
+      }
+      continue;
+    }
+    ptr += n;
+    len -= (size_t)n;
+  }
+  return NULL;
+}
+
+// next_window_hi returns the end of the next output window, which starts at
+// lo. It is the first chunk boundary at least DEFAULT_WINDOW_SIZE bytes after
+// lo (or hi, if that's sooner), so that no chunk is decompressed twice, by
+// two adjacent windows, unless it straddles lo or hi.
+static const char*  //
+next_window_hi(uint64_t lo, uint64_t hi, uint64_t* window_hi) {
+  rac_chunk_reader r = g.pool.chunk_reader;
+  const char* z = rac_chunk_reader__seek_to_chunk_containing(&r, lo);
+  while (!z) {
+    rac_chunk c;
+    z = rac_chunk_reader__next_chunk(&r, &c);
+    if (z) {
+      break;
+    } else if ((c.drange.max_excl >= hi) ||
+               ((c.drange.max_excl - lo) >= DEFAULT_WINDOW_SIZE)) {
+      *window_hi = wuffs_base__u64__min(c.drange.max_excl, hi);
+      return NULL;
+    }
+  }
+  if (z == rac_note__end_of_data) {
+    *window_hi = hi;
+    return NULL;
+  }
+  return z;
+}
+
+static const char*  //
+decode() {
+  uint64_t dsize = rac_pool__decompressed_size(&g.pool);
+  uint64_t lo = g_flags.has_drange_lo ? g_flags.drange_lo : 0;
+  uint64_t hi = g_flags.has_drange_hi ? g_flags.drange_hi : dsize;
+  hi = wuffs_base__u64__min(hi, dsize);
+  lo = wuffs_base__u64__min(lo, hi);
+
+  while (lo < hi) {
+    uint64_t window_hi = 0;
+    const char* z = next_window_hi(lo, hi, &window_hi);
+    if (z) {
+      return z;
+    }
+    uint64_t n = window_hi - lo;
+    if (n > SIZE_MAX) {
+      return "main: out of memory";
+    } else if (g.window_cap < n) {
+      free(g.window_ptr);
+      g.window_cap = 0;
+      g.window_ptr = (uint8_t*)malloc(n);
+      if (!g.window_ptr) {
+        return "main: out of memory";
+      }
+      g.window_cap = n;
+    }
+
+    z = rac_pool__read_at(&g.pool, g.window_ptr, lo, window_hi);
+    if (z) {
+      return z;
+    }
+    z = write_to_stdout(g.window_ptr, n);
+    if (z) {
+      return z;
+    }
+    lo = window_hi;
+  }
+  return NULL;
+}
+
+static const char*  //
+read_input() {
+  int fd = 0;  // stdin.
+  if (g_flags.remaining_argc > 0) {
+    fd = open(g_flags.remaining_argv[0], O_RDONLY);
+    if (fd < 0) {
+      return strerror(errno);
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && (st.st_size > 0)) {
+      void* m = mmap(NULL, (size_t)(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if (m != MAP_FAILED) {
+        g.src_ptr = (const uint8_t*)m;
+        g.src_len = (size_t)(st.st_size);
+        return NULL;
+      }
+    }
+  }
+
+  size_t cap = 0;
+  uint8_t* buf = NULL;
+  while (true) {
+    if (g.src_len == cap) {
+      cap = cap ? (2 * cap) : (1024 * 1024);
+      buf = (uint8_t*)realloc(buf, cap);
+      if (!buf) {
+        return "main: out of memory";
+      }
+    }
+    ssize_t n = read(fd, buf + g.src_len, cap - g.src_len);
+    if (n < 0) {
+      if (errno != EINTR) {
+        return strerror(errno);
+      }
+      continue;
+    } else if (n == 0) {
+      break;
+    }
+    g.src_len += (size_t)n;
+  }
+  g.src_ptr = buf;
+  return NULL;
+}
+
+const char*  //
+main1(int argc, char** argv) {
+  const char* z = parse_flags(argc, argv);
+  if (z) {
+    return z;
+  }
+  if (g_flags.num_threads == 0) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    g_flags.num_threads = (n < 1)                 ? 1
+                          : (n > MAX_NUM_THREADS) ? MAX_NUM_THREADS
+                                                  : (uint32_t)(n);
+  }
+
+  z = read_input();
+  if (z) {
+    return z;
+  }
+
+  const rac_codec* codecs[1] = {&rac_codec__zlib};
+  z = rac_pool__initialize(&g.pool, g.src_ptr, g.src_len, codecs, 1,
+                           g_flags.num_threads);
+  if (z) {
+    return z;
+  }
+  z = decode();
+  rac_pool__destroy(&g.pool);
+  free(g.window_ptr);
+  return z;
+}
+
+int  //
+compute_exit_code(const char* status_msg) {
+  if (!status_msg) {
+    return 0;
+  }
+  size_t n = strnlen(status_msg, 2047);
+  if (n >= 2047) {
+    status_msg = "main: internal error: error message is too long";
+    n = strnlen(status_msg, 2047);
+  }
+  const int stderr_fd = 2;
+  ignore_return_value(write(stderr_fd, status_msg, n));
+  ignore_return_value(write(stderr_fd, "\n", 1));
+  // Return an exit code of 1 for regular (forseen) errors, e.g. badly
+  // formatted or unsupported input.
+  //
+  // Return an exit code of 2 for internal (exceptional) errors, e.g. defensive
+  // run-time checks found that an internal invariant did not hold.
+  //
+  // Automated testing, including badly formatted inputs, can therefore
+  // discriminate between expected failure (exit code 1) and unexpected failure
+  // (other non-zero exit codes). Specifically, exit code 2 for internal
+  // invariant violation, exit code 139 (which is 128 + SIGSEGV on x86_64
+  // linux) for a segmentation fault (e.g. null pointer dereference).
+  return strstr(status_msg, "internal error:") ? 2 : 1;
+}
+
+int  //
+main(int argc, char** argv) {
+  return compute_exit_code(main1(argc, argv));
+}
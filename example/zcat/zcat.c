@@ -16,15 +16,42 @@
 
 /*
 zcat decodes gzip'ed data to stdout. It is similar to the standard /bin/zcat
-program, except that this example program only reads from stdin. On Linux, it
-also self-imposes a SECCOMP_MODE_STRICT sandbox. To run:
+program, except that this example program only reads from stdin. If stdin is
+a regular file, it is memory-mapped and decoded as a single closed io_buffer.
+On Linux, it also self-imposes a SECCOMP_MODE_STRICT sandbox. To run:
 
-$CC zcat.c && ./a.out < ../../test/data/romeo.txt.gz; rm -f a.out
+$CC zcat.c -lpthread && ./a.out < ../../test/data/romeo.txt.gz; rm -f a.out
 
 for a C compiler $CC, such as clang or gcc.
+
+Like /bin/zcat, it decodes a concatenation of gzip members (as produced by
+e.g. "cat a.gz b.gz" or by bgzip) as the concatenation of their contents.
+
+The -j=N flag (with N >= 2) decodes using N worker threads, unsandboxed, as
+separate members are independent (and each has its own CRC-32 checksum):
+
+  - The main thread reads the entire input and splits it into jobs of roughly
+    JOB_MIN_SRC_LEN compressed bytes, each starting at a candidate member
+    boundary. Candidates come from bgzip's per-member "BC" length field, if
+    present, or else from scanning for the gzip magic bytes.
+  - The worker threads decode each job (as a closed io_buffer, with the
+    WUFFS_GZIP__QUIRK_DECODE_MULTIPLE_MEMBERS quirk) into its own buffer.
+  - The main thread writes the jobs' output in order. A scanned candidate can
+    be a false positive (the magic bytes occurring within compressed data),
+    so that a job fails even though the input is valid. The main thread then
+    decodes that part of the input serially, one member at a time, until it
+    reaches the start of a later job.
+
+Either way, the output is the same. A single-member input (e.g. as produced by
+/bin/gzip) gets no faster with -j=N, as its decoding is inherently serial.
 */
 
 #include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 // Wuffs ships as a "single file C library" or "header file library" as per
@@ -72,6 +99,20 @@ for a C compiler $CC, such as clang or gcc.
 #define WORK_BUFFER_ARRAY_SIZE \
   WUFFS_GZIP__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE
 
+// JOB_MIN_SRC_LEN is the minimum compressed length of each -j=N job (other
+// than the last one), so that there are not too many jobs.
+#ifndef JOB_MIN_SRC_LEN
+#define JOB_MIN_SRC_LEN (1024 * 1024)
+#endif
+
+// MAX_JOB_DST_LEN is the maximum decompressed length of each -j=N job. A job
+// that would decompress to more than this is decoded serially instead.
+#ifndef MAX_JOB_DST_LEN
+#define MAX_JOB_DST_LEN (64 * 1024 * 1024)
+#endif
+
+#define MAX_NUM_THREADS 256
+
 uint8_t g_dst_buffer_array[DST_BUFFER_ARRAY_SIZE];
 uint8_t g_src_buffer_array[SRC_BUFFER_ARRAY_SIZE];
 #if WORK_BUFFER_ARRAY_SIZE > 0
@@ -85,11 +126,17 @@ uint8_t g_work_buffer_array[1];
 
 static bool g_sandboxed = false;
 
+// g_mmap_src_ptr and g_mmap_src_len, if non-zero, hold the entire stdin
+// contents, memory-mapped before the sandbox is self-imposed.
+static uint8_t* g_mmap_src_ptr = NULL;
+static size_t g_mmap_src_len = 0;
+
 struct {
   int remaining_argc;
   char** remaining_argv;
 
   bool fail_if_unsandboxed;
+  uint32_t num_threads;
 } g_flags = {0};
 
 const char*  //
@@ -118,6 +165,15 @@ parse_flags(int argc, char** argv) {
       g_flags.fail_if_unsandboxed = true;
       continue;
     }
+    if (!strncmp(arg, "j=", 2)) {
+      wuffs_base__result_u64 r = wuffs_base__parse_number_u64(
+          wuffs_base__make_slice_u8((uint8_t*)(arg + 2), strlen(arg + 2)));
+      if (r.status.repr || (r.value < 1) || (r.value > MAX_NUM_THREADS)) {
+        return "main: bad -j flag value";
+      }
+      g_flags.num_threads = (uint32_t)(r.value);
+      continue;
+    }
 
     return "main: unrecognized flag argument";
   }
@@ -129,18 +185,460 @@ parse_flags(int argc, char** argv) {
 
 // ----
 
+// mmap_stdin memory-maps stdin, if it is a non-empty regular file read from
+// its start. On failure, it leaves g_mmap_src_ptr as NULL and main1 falls
+// back to read'ing stdin into g_src_buffer_array.
+void  //
+mmap_stdin() {
+  const int stdin_fd = 0;
+  struct stat st;
+  if ((fstat(stdin_fd, &st) != 0) || !S_ISREG(st.st_mode) ||
+      (st.st_size <= 0) || ((uint64_t)(st.st_size) > SIZE_MAX) ||
+      (lseek(stdin_fd, 0, SEEK_CUR) != 0)) {
+    return;
+  }
+  void* ptr =
+      mmap(NULL, (size_t)(st.st_size), PROT_READ, MAP_SHARED, stdin_fd, 0);
+  if (ptr == MAP_FAILED) {
+    return;
+  }
+  g_mmap_src_ptr = (uint8_t*)ptr;
+  g_mmap_src_len = (size_t)(st.st_size);
+}
+
 // ignore_return_value suppresses errors from -Wall -Werror.
 static void  //
 ignore_return_value(int ignored) {}
 
-const char*  //
-main1(int argc, char** argv) {
-  const char* z = parse_flags(argc, argv);
+// ----
+
+static const char*  //
+write_all(const uint8_t* ptr, size_t len) {
+  while (len > 0) {
+    const int stdout_fd = 1;
+    ssize_t n = write(stdout_fd, ptr, len);
+    if (n < 0) {
+      if (errno != EINTR) {
+        return strerror(errno);
+      }
+      continue;
+    }
+    ptr += n;
+    len -= (size_t)n;
+  }
+  return NULL;
+}
+
+static void*  //
+checked_malloc(size_t n) {
+  void* p = malloc(n ? n : 1);
+  if (!p) {
+    fprintf(stderr, "main: out of memory\n");
+    exit(2);
+  }
+  return p;
+}
+
+typedef struct {
+  // Set by the main thread before any worker thread starts.
+  size_t src_start;
+  size_t src_end;
+
+  // Set by the worker thread. ok means that src[src_start .. src_end]
+  // decoded, without error, to exactly a whole number of gzip members.
+  bool ok;
+  uint8_t* dst_ptr;
+  size_t dst_len;
+  bool done;
+} job;
+
+struct {
+  const uint8_t* src_ptr;
+  size_t src_len;
+
+  job* jobs;
+  size_t num_jobs;
+
+  // The mutex guards next_job, num_released and each job's done field.
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  size_t next_job;
+  size_t num_released;
+  size_t window;
+} g;
+
+// read_input sets g.src_ptr and g.src_len to the entire stdin contents.
+static const char*  //
+read_input() {
+  mmap_stdin();
+  if (g_mmap_src_ptr) {
+    g.src_ptr = g_mmap_src_ptr;
+    g.src_len = g_mmap_src_len;
+    return NULL;
+  }
+
+  size_t cap = 0;
+  uint8_t* buf = NULL;
+  while (true) {
+    if (g.src_len == cap) {
+      cap = cap ? (2 * cap) : (1024 * 1024);
+      buf = (uint8_t*)realloc(buf, cap);
+      if (!buf) {
+        return "main: out of memory";
+      }
+    }
+    const int stdin_fd = 0;
+    ssize_t n = read(stdin_fd, buf + g.src_len, cap - g.src_len);
+    if (n < 0) {
+      if (errno != EINTR) {
+        return strerror(errno);
+      }
+      continue;
+    } else if (n == 0) {
+      break;
+    }
+    g.src_len += (size_t)n;
+  }
+  g.src_ptr = buf;
+  return NULL;
+}
+
+// is_member_start_candidate returns whether g.src_ptr[i ..] looks like the
+// start of a gzip header: the magic bytes, the DEFLATE compression method and
+// no reserved FLG bits.
+static bool  //
+is_member_start_candidate(size_t i) {
+  const uint8_t* p = g.src_ptr + i;
+  return ((g.src_len - i) >= 4) && (p[0] == 0x1F) && (p[1] == 0x8B) &&
+         (p[2] == 0x08) && !(p[3] & 0xE0);
+}
+
+// bgzip_member_length returns the length of the gzip member starting at
+// g.src_ptr[i], as recorded in bgzip's "BC" extra subfield, or 0 if there is
+// no such subfield.
+static size_t  //
+bgzip_member_length(size_t i) {
+  const uint8_t* p = g.src_ptr + i;
+  size_t n = g.src_len - i;
+  // The header's FLG byte must have the FEXTRA bit set.
+  if (!is_member_start_candidate(i) || (n < 12) || !(p[3] & 0x04)) {
+    return 0;
+  }
+  size_t xlen = wuffs_base__load_u16le__no_bounds_check(p + 10);
+  if (xlen > (n - 12)) {
+    return 0;
+  }
+  p += 12;
+  while (xlen >= 4) {
+    size_t slen = wuffs_base__load_u16le__no_bounds_check(p + 2);
+    if (slen > (xlen - 4)) {
+      break;
+    } else if ((p[0] == 'B') && (p[1] == 'C') && (slen == 2)) {
+      return 1 + (size_t)wuffs_base__load_u16le__no_bounds_check(p + 4);
+    }
+    p += 4 + slen;
+    xlen -= 4 + slen;
+  }
+  return 0;
+}
+
+// next_member_start_candidate returns the next candidate position, after the
+// member starting at g.src_ptr[i], for a job boundary that is at least
+// JOB_MIN_SRC_LEN bytes after g.src_ptr[job_start]. It returns g.src_len if
+// there is no such candidate.
+//
+// A bgzip member records its length, so that the next member's position is
+// exact. Otherwise, a candidate found by scanning for the magic bytes is only
+// a guess, as those bytes can also occur within the compressed data.
+static size_t  //
+next_member_start_candidate(size_t i, size_t job_start) {
+  size_t n = bgzip_member_length(i);
+  if (n > 0) {
+    return (n < (g.src_len - i)) ? (i + n) : g.src_len;
+  }
+
+  // The smallest gzip member is 20 bytes long: a 10 byte header, an empty
+  // DEFLATE stream (2 bytes) and an 8 byte footer.
+  size_t j = (job_start < (SIZE_MAX - JOB_MIN_SRC_LEN))
+                 ? (job_start + JOB_MIN_SRC_LEN)
+                 : SIZE_MAX;
+  if ((j < i) || ((j - i) < 20)) {
+    j = ((g.src_len - i) > 20) ? (i + 20) : g.src_len;
+  }
+  while (j < g.src_len) {
+    const uint8_t* p =
+        (const uint8_t*)memchr(g.src_ptr + j, 0x1F, g.src_len - j);
+    if (!p) {
+      break;
+    }
+    j = (size_t)(p - g.src_ptr);
+    if (is_member_start_candidate(j)) {
+      return j;
+    }
+    j++;
+  }
+  return g.src_len;
+}
+
+static void  //
+build_jobs() {
+  // Consecutive jobs start at least JOB_MIN_SRC_LEN bytes apart.
+  size_t cap = 1 + (g.src_len / JOB_MIN_SRC_LEN);
+  g.jobs = (job*)checked_malloc(cap * sizeof(job));
+  memset(g.jobs, 0, cap * sizeof(job));
+
+  size_t job_start = 0;
+  size_t i = 0;
+  while (true) {
+    i = next_member_start_candidate(i, job_start);
+    if ((i >= g.src_len) || (g.num_jobs + 1 >= cap)) {
+      break;
+    } else if ((i - job_start) >= JOB_MIN_SRC_LEN) {
+      g.jobs[g.num_jobs].src_start = job_start;
+      g.jobs[g.num_jobs].src_end = i;
+      g.num_jobs++;
+      job_start = i;
+    }
+  }
+  g.jobs[g.num_jobs].src_start = job_start;
+  g.jobs[g.num_jobs].src_end = g.src_len;
+  g.num_jobs++;
+}
+
+static void  //
+decode_job(wuffs_gzip__decoder* dec, wuffs_base__slice_u8 workbuf, job* j) {
+  wuffs_base__status status = wuffs_gzip__decoder__initialize(
+      dec, sizeof__wuffs_gzip__decoder(), WUFFS_VERSION,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED);
+  if (!wuffs_base__status__is_ok(&status)) {
+    return;
+  }
+  wuffs_gzip__decoder__set_quirk_enabled(
+      dec, WUFFS_GZIP__QUIRK_DECODE_MULTIPLE_MEMBERS, true);
+
+  size_t src_len = j->src_end - j->src_start;
+  wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+      (uint8_t*)(g.src_ptr + j->src_start), src_len, true);
+
+  // Start with a guess of a 4:1 compression ratio.
+  size_t cap = (src_len < (MAX_JOB_DST_LEN / 4)) ? (4 * src_len)
+                                                  : MAX_JOB_DST_LEN;
+  if (cap < 65536) {
+    cap = 65536;
+  }
+  wuffs_base__io_buffer dst =
+      wuffs_base__ptr_u8__writer((uint8_t*)checked_malloc(cap), cap);
+
+  while (true) {
+    status = wuffs_gzip__decoder__transform_io(dec, &dst, &src, workbuf);
+    if ((status.repr != wuffs_base__suspension__short_write) ||
+        (dst.data.len >= MAX_JOB_DST_LEN)) {
+      break;
+    }
+    cap = (dst.data.len < (MAX_JOB_DST_LEN / 2)) ? (2 * dst.data.len)
+                                                 : MAX_JOB_DST_LEN;
+    uint8_t* ptr = (uint8_t*)realloc(dst.data.ptr, cap);
+    if (!ptr) {
+      break;
+    }
+    dst.data.ptr = ptr;
+    dst.data.len = cap;
+  }
+
+  if (wuffs_base__status__is_ok(&status)) {
+    j->ok = true;
+    j->dst_ptr = dst.data.ptr;
+    j->dst_len = dst.meta.wi;
+  } else {
+    free(dst.data.ptr);
+  }
+}
+
+static void*  //
+worker(void* arg) {
+  wuffs_gzip__decoder* dec = wuffs_gzip__decoder__alloc();
+  if (!dec) {
+    fprintf(stderr, "main: out of memory\n");
+    exit(2);
+  }
+  uint8_t workbuf_array[WORK_BUFFER_ARRAY_SIZE > 0 ? WORK_BUFFER_ARRAY_SIZE
+                                                   : 1];
+  wuffs_base__slice_u8 workbuf =
+      wuffs_base__make_slice_u8(workbuf_array, WORK_BUFFER_ARRAY_SIZE);
+
+  pthread_mutex_lock(&g.mutex);
+  while (g.next_job < g.num_jobs) {
+    // Bound the memory used by decoded-but-not-yet-written jobs.
+    if (g.next_job >= (g.num_released + g.window)) {
+      pthread_cond_wait(&g.cond, &g.mutex);
+      continue;
+    }
+    job* j = &g.jobs[g.next_job++];
+    pthread_mutex_unlock(&g.mutex);
+
+    decode_job(dec, workbuf, j);
+
+    pthread_mutex_lock(&g.mutex);
+    j->done = true;
+    pthread_cond_broadcast(&g.cond);
+  }
+  pthread_mutex_unlock(&g.mutex);
+
+  free(dec);
+  return NULL;
+}
+
+static job*  //
+wait_for_job(size_t i) {
+  job* j = &g.jobs[i];
+  pthread_mutex_lock(&g.mutex);
+  while (!j->done) {
+    pthread_cond_wait(&g.cond, &g.mutex);
+  }
+  pthread_mutex_unlock(&g.mutex);
+  return j;
+}
+
+static void  //
+release_job(job* j) {
+  free(j->dst_ptr);
+  j->dst_ptr = NULL;
+  pthread_mutex_lock(&g.mutex);
+  g.num_released++;
+  pthread_cond_broadcast(&g.cond);
+  pthread_mutex_unlock(&g.mutex);
+}
+
+// decode_member decodes the one gzip member starting at g.src_ptr[*i] to
+// stdout, advancing *i past that member.
+static const char*  //
+decode_member(wuffs_gzip__decoder* dec, size_t* i) {
+  wuffs_base__status status = wuffs_gzip__decoder__initialize(
+      dec, sizeof__wuffs_gzip__decoder(), WUFFS_VERSION,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED);
+  if (!wuffs_base__status__is_ok(&status)) {
+    return wuffs_base__status__message(&status);
+  }
+
+  wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+      (uint8_t*)(g.src_ptr + *i), g.src_len - *i, true);
+  wuffs_base__io_buffer dst =
+      wuffs_base__ptr_u8__writer(g_dst_buffer_array, DST_BUFFER_ARRAY_SIZE);
+
+  while (true) {
+    status = wuffs_gzip__decoder__transform_io(
+        dec, &dst, &src,
+        wuffs_base__make_slice_u8(g_work_buffer_array,
+                                  WORK_BUFFER_ARRAY_SIZE));
+    const char* z = write_all(dst.data.ptr, dst.meta.wi);
+    if (z) {
+      return z;
+    }
+    dst.meta.wi = 0;
+
+    if (status.repr == wuffs_base__suspension__short_write) {
+      continue;
+    } else if (status.repr == wuffs_base__suspension__short_read) {
+      return "main: truncated input";
+    } else if (!wuffs_base__status__is_ok(&status)) {
+      return wuffs_base__status__message(&status);
+    }
+    *i += src.meta.ri;
+    return NULL;
+  }
+}
+
+static const char*  //
+assemble() {
+  const char* ret = NULL;
+  wuffs_gzip__decoder* dec = wuffs_gzip__decoder__alloc();
+  if (!dec) {
+    ret = "main: out of memory";
+    goto exit;
+  }
+
+  size_t k = 0;
+  while (k < g.num_jobs) {
+    job* j = wait_for_job(k++);
+    size_t i = j->src_start;
+    if (j->ok) {
+      ret = write_all(j->dst_ptr, j->dst_len);
+      release_job(j);
+      if (ret) {
+        goto exit;
+      }
+      continue;
+    }
+    release_job(j);
+
+    // The job failed. Decode serially, one member at a time, until reaching
+    // the start of a later job (or the end of the input). Jobs that start
+    // before that are skipped, in order, so that the workers can move on.
+    while (true) {
+      ret = decode_member(dec, &i);
+      if (ret) {
+        goto exit;
+      }
+      while ((k < g.num_jobs) && (g.jobs[k].src_start < i)) {
+        release_job(wait_for_job(k++));
+      }
+      if ((i >= g.src_len) ||
+          ((k < g.num_jobs) && (g.jobs[k].src_start == i))) {
+        break;
+      }
+    }
+  }
+
+exit:
+  free(dec);
+  // Let any worker threads finish promptly.
+  pthread_mutex_lock(&g.mutex);
+  g.next_job = g.num_jobs;
+  pthread_cond_broadcast(&g.cond);
+  pthread_mutex_unlock(&g.mutex);
+  return ret;
+}
+
+static const char*  //
+main_parallel() {
+  const char* z = read_input();
   if (z) {
     return z;
   }
+  build_jobs();
+
+  pthread_mutex_init(&g.mutex, NULL);
+  pthread_cond_init(&g.cond, NULL);
+  g.window = 2 * (size_t)(g_flags.num_threads);
+
+  pthread_t threads[MAX_NUM_THREADS];
+  uint32_t num_threads = 0;
+  for (; num_threads < g_flags.num_threads; num_threads++) {
+    if (pthread_create(&threads[num_threads], NULL, worker, NULL)) {
+      break;
+    }
+  }
+  if (num_threads == 0) {
+    return "main: could not create worker threads";
+  }
+
+  z = assemble();
+
+  uint32_t t;
+  for (t = 0; t < num_threads; t++) {
+    pthread_join(threads[t], NULL);
+  }
+  return z;
+}
+
+// ----
+
+const char*  //
+main1() {
   if (g_flags.fail_if_unsandboxed && !g_sandboxed) {
     return "main: unsandboxed";
+  } else if (g_flags.num_threads > 1) {
+    return main_parallel();
   }
 
   wuffs_gzip__decoder dec;
@@ -149,6 +647,8 @@ main1(int argc, char** argv) {
   if (!wuffs_base__status__is_ok(&status)) {
     return wuffs_base__status__message(&status);
   }
+  wuffs_gzip__decoder__set_quirk_enabled(
+      &dec, WUFFS_GZIP__QUIRK_DECODE_MULTIPLE_MEMBERS, true);
 
   wuffs_base__io_buffer dst;
   dst.data.ptr = g_dst_buffer_array;
@@ -158,27 +658,37 @@ main1(int argc, char** argv) {
   dst.meta.pos = 0;
   dst.meta.closed = false;
 
+  // A memory-mapped stdin is a closed io_buffer that already holds the entire
+  // input. The decoder can then stay in its fast loops until close to the end
+  // of the input, and there is no need to read or compact. The mapping is
+  // read-only, so src must not be compacted.
   wuffs_base__io_buffer src;
-  src.data.ptr = g_src_buffer_array;
-  src.data.len = SRC_BUFFER_ARRAY_SIZE;
-  src.meta.wi = 0;
-  src.meta.ri = 0;
-  src.meta.pos = 0;
-  src.meta.closed = false;
+  if (g_mmap_src_ptr) {
+    src = wuffs_base__ptr_u8__reader(g_mmap_src_ptr, g_mmap_src_len, true);
+  } else {
+    src.data.ptr = g_src_buffer_array;
+    src.data.len = SRC_BUFFER_ARRAY_SIZE;
+    src.meta.wi = 0;
+    src.meta.ri = 0;
+    src.meta.pos = 0;
+    src.meta.closed = false;
+  }
 
   while (true) {
-    const int stdin_fd = 0;
-    ssize_t n =
-        read(stdin_fd, src.data.ptr + src.meta.wi, src.data.len - src.meta.wi);
-    if (n < 0) {
-      if (errno != EINTR) {
-        return strerror(errno);
+    if (!src.meta.closed) {
+      const int stdin_fd = 0;
+      ssize_t n = read(stdin_fd, src.data.ptr + src.meta.wi,
+                       src.data.len - src.meta.wi);
+      if (n < 0) {
+        if (errno != EINTR) {
+          return strerror(errno);
+        }
+        continue;
+      }
+      src.meta.wi += n;
+      if (n == 0) {
+        src.meta.closed = true;
       }
-      continue;
-    }
-    src.meta.wi += n;
-    if (n == 0) {
-      src.meta.closed = true;
     }
 
     while (true) {
@@ -196,6 +706,9 @@ main1(int argc, char** argv) {
       }
 
       if (status.repr == wuffs_base__suspension__short_read) {
+        if (src.meta.closed) {
+          return "main: truncated input";
+        }
         break;
       }
       if (status.repr == wuffs_base__suspension__short_write) {
@@ -240,18 +753,31 @@ compute_exit_code(const char* status_msg) {
 
 int  //
 main(int argc, char** argv) {
+  // Parsing the flags makes no system calls, so it can precede sandboxing.
+  // The -j=N mode starts threads, which SECCOMP_MODE_STRICT disallows, so
+  // only the serial mode is sandboxed.
+  const char* z = parse_flags(argc, argv);
+  bool serial = z || (g_flags.num_threads <= 1);
+  if (serial) {
+    mmap_stdin();
+  }
+
 #if defined(WUFFS_EXAMPLE_USE_SECCOMP)
-  prctl(PR_SET_SECCOMP, SECCOMP_MODE_STRICT);
-  g_sandboxed = true;
+  if (serial) {
+    prctl(PR_SET_SECCOMP, SECCOMP_MODE_STRICT);
+    g_sandboxed = true;
+  }
 #endif
 
-  int exit_code = compute_exit_code(main1(argc, argv));
+  int exit_code = compute_exit_code(z ? z : main1());
 
 #if defined(WUFFS_EXAMPLE_USE_SECCOMP)
   // Call SYS_exit explicitly, instead of calling SYS_exit_group implicitly by
   // either calling _exit or returning from main. SECCOMP_MODE_STRICT allows
   // only SYS_exit.
-  syscall(SYS_exit, exit_code);
+  if (g_sandboxed) {
+    syscall(SYS_exit, exit_code);
+  }
 #endif
   return exit_code;
 }
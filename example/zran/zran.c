@@ -0,0 +1,483 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+zran prints a byte range of gzip'ed data's decoded form to stdout, without
+decoding everything before that range. It is similar to the zlib library's
+examples/zran.c program. To run:
+
+$CC zran.c && ./a.out -offset=1000 -length=100 < ../../test/data/romeo.txt.gz;
+rm -f a.out
+
+for a C compiler $CC, such as clang or gcc.
+
+stdin must be a regular file (so that it can be memory-mapped), holding a
+single gzip member. The gzip header is parsed here, not by the std/gzip
+package, and the gzip footer's checksum is not verified, as only part of the
+decoded data is ever computed.
+
+The first pass builds an index: it decodes the whole DEFLATE stream once, with
+the std/deflate decoder suspending at every block boundary. Roughly every
+-interval bytes of decoded output, it records a checkpoint: the block's
+(possibly non-byte-aligned) position in the compressed data and the 32 KiB of
+decoded output immediately before it. The second pass then decodes only from
+the last checkpoint at or before -offset, so that its cost is O(interval)
+instead of O(offset).
+
+A real program would build the index once, save it and serve many byte ranges
+from it. This one only serves one.
+*/
+
+#include <errno.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c whitelist which parts of Wuffs to build. That file contains
+// the entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__DEFLATE
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../release/c/wuffs-unsupported-snapshot.c"
+
+// WINDOW_SIZE is the DEFLATE format's maximum back-reference distance.
+#define WINDOW_SIZE 32768
+
+#ifndef DST_BUFFER_ARRAY_SIZE
+#define DST_BUFFER_ARRAY_SIZE (128 * 1024)
+#endif
+
+#if DST_BUFFER_ARRAY_SIZE <= WINDOW_SIZE
+#error "DST_BUFFER_ARRAY_SIZE is too small"
+#endif
+
+#define WORK_BUFFER_ARRAY_SIZE \
+  WUFFS_DEFLATE__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE
+
+uint8_t g_dst_buffer_array[DST_BUFFER_ARRAY_SIZE];
+#if WORK_BUFFER_ARRAY_SIZE > 0
+uint8_t g_work_buffer_array[WORK_BUFFER_ARRAY_SIZE];
+#else
+// Not all C/C++ compilers support 0-length arrays.
+uint8_t g_work_buffer_array[1];
+#endif
+
+// g_src_ptr and g_src_len hold the entire stdin contents, memory-mapped.
+static uint8_t* g_src_ptr = NULL;
+static size_t g_src_len = 0;
+
+// ----
+
+static const char* g_usage =
+    "Usage: zran -flags < input.gz\n"
+    "\n"
+    "Flags:\n"
+    "    -interval=N  checkpoint every N decoded bytes (default 1048576)\n"
+    "    -length=N    print N decoded bytes (default 4096)\n"
+    "    -offset=N    start at the Nth decoded byte (default 0)\n";
+
+struct {
+  int remaining_argc;
+  char** remaining_argv;
+
+  uint64_t interval;
+  uint64_t length;
+  uint64_t offset;
+} g_flags = {0};
+
+const char*  //
+parse_flags(int argc, char** argv) {
+  g_flags.interval = 1048576;
+  g_flags.length = 4096;
+  g_flags.offset = 0;
+
+  int c = (argc > 0) ? 1 : 0;  // Skip argv[0], the program name.
+  for (; c < argc; c++) {
+    char* arg = argv[c];
+    if (*arg++ != '-') {
+      break;
+    }
+
+    // A double-dash "--foo" is equivalent to a single-dash "-foo". As special
+    // cases, a bare "-" is not a flag (some programs may interpret it as
+    // stdin) and a bare "--" means to stop parsing flags.
+    if (*arg == '\x00') {
+      break;
+    } else if (*arg == '-') {
+      arg++;
+      if (*arg == '\x00') {
+        c++;
+        break;
+      }
+    }
+
+    uint64_t* dst = NULL;
+    if (!strncmp(arg, "interval=", 9)) {
+      dst = &g_flags.interval;
+    } else if (!strncmp(arg, "length=", 7)) {
+      dst = &g_flags.length;
+    } else if (!strncmp(arg, "offset=", 7)) {
+      dst = &g_flags.offset;
+    } else {
+      return g_usage;
+    }
+    while (*arg++ != '=') {
+    }
+    wuffs_base__result_u64 u = wuffs_base__parse_number_u64(
+        wuffs_base__make_slice_u8((uint8_t*)arg, strlen(arg)));
+    if (!wuffs_base__status__is_ok(&u.status)) {
+      return g_usage;
+    }
+    *dst = u.value;
+  }
+
+  if (g_flags.interval == 0) {
+    return "main: -interval must be positive";
+  }
+  g_flags.remaining_argc = argc - c;
+  g_flags.remaining_argv = argv + c;
+  return NULL;
+}
+
+// ----
+
+// checkpoint is where decoding can restart, at the start of a DEFLATE block.
+// That block starts n_bits bits before the src_pos'th byte of the compressed
+// data: at the high n_bits bits of the byte at (src_pos - 1). window holds the
+// window_len bytes of decoded output immediately before dst_pos.
+typedef struct {
+  uint64_t src_pos;
+  uint64_t dst_pos;
+  uint32_t n_bits;
+  uint32_t window_len;
+  uint8_t window[WINDOW_SIZE];
+} checkpoint;
+
+static checkpoint* g_checkpoints = NULL;
+static size_t g_num_checkpoints = 0;
+static size_t g_cap_checkpoints = 0;
+
+const char*  //
+add_checkpoint(uint64_t src_pos,
+               uint64_t dst_pos,
+               uint32_t n_bits,
+               const uint8_t* window_ptr,
+               size_t window_len) {
+  if (g_num_checkpoints == g_cap_checkpoints) {
+    size_t new_cap = g_cap_checkpoints ? (2 * g_cap_checkpoints) : 16;
+    if (new_cap > (SIZE_MAX / sizeof(checkpoint))) {
+      return "main: out of memory";
+    }
+    checkpoint* p =
+        (checkpoint*)(realloc(g_checkpoints, new_cap * sizeof(checkpoint)));
+    if (!p) {
+      return "main: out of memory";
+    }
+    g_checkpoints = p;
+    g_cap_checkpoints = new_cap;
+  }
+  checkpoint* c = &g_checkpoints[g_num_checkpoints++];
+  c->src_pos = src_pos;
+  c->dst_pos = dst_pos;
+  c->n_bits = n_bits;
+  c->window_len = (uint32_t)window_len;
+  if (window_len > 0) {
+    memcpy(c->window, window_ptr, window_len);
+  }
+  return NULL;
+}
+
+// ----
+
+// parse_gzip_header returns the length of the gzip header (RFC 1952) at the
+// start of g_src_ptr, or zero if it is invalid or unsupported.
+size_t  //
+parse_gzip_header() {
+  const uint8_t* p = g_src_ptr;
+  size_t n = g_src_len;
+  if ((n < 10) || (p[0] != 0x1F) || (p[1] != 0x8B) || (p[2] != 0x08) ||
+      (p[3] & 0xE0)) {
+    return 0;
+  }
+  uint8_t flags = p[3];
+  size_t i = 10;
+  if (flags & 0x04) {  // FEXTRA.
+    if ((n - i) < 2) {
+      return 0;
+    }
+    size_t xlen = ((size_t)(p[i + 0]) << 0) | ((size_t)(p[i + 1]) << 8);
+    i += 2;
+    if ((n - i) < xlen) {
+      return 0;
+    }
+    i += xlen;
+  }
+  if (flags & 0x08) {  // FNAME.
+    while ((i < n) && (p[i] != 0x00)) {
+      i++;
+    }
+    if (i++ >= n) {
+      return 0;
+    }
+  }
+  if (flags & 0x10) {  // FCOMMENT.
+    while ((i < n) && (p[i] != 0x00)) {
+      i++;
+    }
+    if (i++ >= n) {
+      return 0;
+    }
+  }
+  if (flags & 0x02) {  // FHCRC.
+    if ((n - i) < 2) {
+      return 0;
+    }
+    i += 2;
+  }
+  return i;
+}
+
+// ----
+
+wuffs_base__io_buffer  //
+make_dst() {
+  wuffs_base__io_buffer dst;
+  dst.data.ptr = g_dst_buffer_array;
+  dst.data.len = DST_BUFFER_ARRAY_SIZE;
+  dst.meta.wi = 0;
+  dst.meta.ri = 0;
+  dst.meta.pos = 0;
+  dst.meta.closed = false;
+  return dst;
+}
+
+// compact_dst discards all but the last WINDOW_SIZE bytes of dst's contents.
+void  //
+compact_dst(wuffs_base__io_buffer* dst) {
+  if (dst->meta.wi > WINDOW_SIZE) {
+    dst->meta.ri = dst->meta.wi - WINDOW_SIZE;
+    wuffs_base__io_buffer__compact(dst);
+  }
+}
+
+const char*  //
+build_index(size_t header_len) {
+  wuffs_deflate__decoder dec;
+  wuffs_base__status status =
+      wuffs_deflate__decoder__initialize(&dec, sizeof dec, WUFFS_VERSION, 0);
+  if (!wuffs_base__status__is_ok(&status)) {
+    return wuffs_base__status__message(&status);
+  }
+  wuffs_deflate__decoder__set_suspend_at_block_boundaries(&dec, true);
+
+  wuffs_base__io_buffer dst = make_dst();
+  wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+      g_src_ptr + header_len, g_src_len - header_len, true);
+
+  const char* z = add_checkpoint(header_len, 0, 0, NULL, 0);
+  if (z) {
+    return z;
+  }
+
+  while (true) {
+    status = wuffs_deflate__decoder__transform_io(
+        &dec, &dst, &src,
+        wuffs_base__make_slice_u8(g_work_buffer_array, WORK_BUFFER_ARRAY_SIZE));
+
+    if (status.repr == wuffs_deflate__suspension__block_boundary) {
+      uint64_t dst_pos = dst.meta.pos + dst.meta.wi;
+      if ((dst_pos - g_checkpoints[g_num_checkpoints - 1].dst_pos) >=
+          g_flags.interval) {
+        size_t window_len =
+            (dst.meta.wi < WINDOW_SIZE) ? dst.meta.wi : WINDOW_SIZE;
+        z = add_checkpoint(header_len + src.meta.ri, dst_pos,
+                           wuffs_deflate__decoder__num_buffered_bits(&dec),
+                           dst.data.ptr + dst.meta.wi - window_len,
+                           window_len);
+        if (z) {
+          return z;
+        }
+      }
+      continue;
+    } else if (status.repr == wuffs_base__suspension__short_write) {
+      compact_dst(&dst);
+      continue;
+    } else if (status.repr == wuffs_base__suspension__short_read) {
+      return "main: truncated input";
+    }
+    return wuffs_base__status__message(&status);
+  }
+}
+
+const char*  //
+extract(uint64_t offset, uint64_t length) {
+  // Find the last checkpoint at or before offset.
+  size_t lo = 0;
+  size_t hi = g_num_checkpoints;
+  while ((hi - lo) > 1) {
+    size_t mid = lo + ((hi - lo) / 2);
+    if (g_checkpoints[mid].dst_pos <= offset) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  const checkpoint* c = &g_checkpoints[lo];
+
+  wuffs_deflate__decoder dec;
+  wuffs_base__status status =
+      wuffs_deflate__decoder__initialize(&dec, sizeof dec, WUFFS_VERSION, 0);
+  if (!wuffs_base__status__is_ok(&status)) {
+    return wuffs_base__status__message(&status);
+  }
+  wuffs_deflate__decoder__add_history(
+      &dec, wuffs_base__make_slice_u8((uint8_t*)(c->window), c->window_len));
+  if (c->n_bits > 0) {
+    wuffs_deflate__decoder__prime(&dec, c->n_bits,
+                                  g_src_ptr[c->src_pos - 1] >> (8 - c->n_bits));
+  }
+
+  wuffs_base__io_buffer dst = make_dst();
+  dst.meta.pos = c->dst_pos;
+  wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+      g_src_ptr + c->src_pos, g_src_len - c->src_pos, true);
+
+  while (length > 0) {
+    status = wuffs_deflate__decoder__transform_io(
+        &dec, &dst, &src,
+        wuffs_base__make_slice_u8(g_work_buffer_array, WORK_BUFFER_ARRAY_SIZE));
+
+    // Print whatever part of dst's contents overlaps [offset, offset+length).
+    uint64_t dst_pos = dst.meta.pos + dst.meta.wi;
+    if (offset < dst_pos) {
+      uint64_t i = (offset > dst.meta.pos) ? (offset - dst.meta.pos) : 0;
+      uint64_t n = dst.meta.wi - i;
+      if (n > length) {
+        n = length;
+      }
+      const int stdout_fd = 1;
+      while (n > 0) {
+        ssize_t w = write(stdout_fd, dst.data.ptr + i, n);
+        if (w < 0) {
+          if (errno != EINTR) {
+            return strerror(errno);
+          }
+          continue;
+        }
+        i += w;
+        n -= w;
+        offset += w;
+        length -= w;
+      }
+    }
+
+    if (status.repr == wuffs_base__suspension__short_write) {
+      dst.meta.ri = dst.meta.wi;
+      wuffs_base__io_buffer__compact(&dst);
+      continue;
+    } else if (status.repr == wuffs_base__suspension__short_read) {
+      return "main: truncated input";
+    }
+    return wuffs_base__status__message(&status);
+  }
+  return NULL;
+}
+
+const char*  //
+main1(int argc, char** argv) {
+  const char* z = parse_flags(argc, argv);
+  if (z) {
+    return z;
+  }
+
+  const int stdin_fd = 0;
+  struct stat st;
+  if ((fstat(stdin_fd, &st) != 0) || !S_ISREG(st.st_mode) ||
+      (st.st_size <= 0) || ((uint64_t)(st.st_size) > SIZE_MAX)) {
+    return "main: stdin is not a non-empty regular file";
+  }
+  void* ptr =
+      mmap(NULL, (size_t)(st.st_size), PROT_READ, MAP_SHARED, stdin_fd, 0);
+  if (ptr == MAP_FAILED) {
+    return strerror(errno);
+  }
+  g_src_ptr = (uint8_t*)ptr;
+  g_src_len = (size_t)(st.st_size);
+
+  size_t header_len = parse_gzip_header();
+  if (header_len == 0) {
+    return "main: invalid or unsupported gzip header";
+  }
+  z = build_index(header_len);
+  if (z) {
+    return z;
+  }
+  return extract(g_flags.offset, g_flags.length);
+}
+
+// ignore_return_value suppresses errors from -Wall -Werror.
+static void  //
+ignore_return_value(int ignored) {}
+
+int  //
+compute_exit_code(const char* status_msg) {
+  if (!status_msg) {
+    return 0;
+  }
+  size_t n = strnlen(status_msg, 2047);
+  if (n >= 2047) {
+    status_msg = "main: internal error: error message is too long";
+    n = strnlen(status_msg, 2047);
+  }
+  const int stderr_fd = 2;
+  ignore_return_value(write(stderr_fd, status_msg, n));
+  ignore_return_value(write(stderr_fd, "\n", 1));
+  // Return an exit code of 1 for regular (forseen) errors, e.g. badly
+  // formatted or unsupported input.
+  //
+  // Return an exit code of 2 for internal (exceptional) errors, e.g. defensive
+  // run-time checks found that an internal invariant did not hold.
+  //
+  // Automated testing, including badly formatted inputs, can therefore
+  // discriminate between expected failure (exit code 1) and unexpected failure
+  // (other non-zero exit codes). Specifically, exit code 2 for internal
+  // invariant violation, exit code 139 (which is 128 + SIGSEGV on x86_64
+  // linux) for a segmentation fault (e.g. null pointer dereference).
+  return strstr(status_msg, "internal error:") ? 2 : 1;
+}
+
+int  //
+main(int argc, char** argv) {
+  return compute_exit_code(main1(argc, argv));
+}
@@ -21,6 +21,24 @@
 #error "Wuffs' .h files need to be included before this file"
 #endif
 
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define WUFFS_FUZZLIB__ASAN
+#endif
+#if __has_feature(memory_sanitizer)
+#define WUFFS_FUZZLIB__MSAN
+#endif
+#elif defined(__SANITIZE_ADDRESS__)
+#define WUFFS_FUZZLIB__ASAN
+#endif
+
+#ifdef WUFFS_FUZZLIB__ASAN
+#include <sanitizer/asan_interface.h>
+#endif
+#ifdef WUFFS_FUZZLIB__MSAN
+#include <sanitizer/msan_interface.h>
+#endif
+
 void  //
 intentional_segfault() {
   static volatile int* ptr = NULL;
@@ -103,6 +121,67 @@ make_limited_reader(wuffs_base__io_buffer b, uint64_t limit) {
   return ret;
 }
 
+// ----
+
+#ifdef WUFFS_CONFIG__FUZZLIB_REUSE_MEMORY
+
+// In-process fuzzing frameworks, such as libFuzzer, call fuzz many times per
+// process. Fuzzers can re-use memory (such as decoders or pixel buffers)
+// across those calls, instead of allocating, zero-initializing and freeing it
+// for every input, which can otherwise cost more than decoding a small input.
+//
+// Re-used memory still holds the previous input's state. Re-initializing a
+// decoder (with the usual initialize function) resets it properly, but, when
+// MemorySanitizer is enabled, the helpers below also mark re-used memory as
+// uninitialized, so that reading it is still detected, as it would be for
+// freshly allocated memory. Likewise, when AddressSanitizer is enabled,
+// re-used buffers are poisoned beyond their requested length.
+//
+// These helpers are only compiled for fuzzers that #define
+// WUFFS_CONFIG__FUZZLIB_REUSE_MEMORY before #include'ing this file, so that
+// the other fuzzers don't get unused function warnings.
+
+// mark_as_uninitialized tells MemorySanitizer (if enabled) that the n bytes
+// starting at ptr hold no meaningful value. Call it on a re-used decoder
+// before re-initializing it.
+static void  //
+mark_as_uninitialized(void* ptr, size_t n) {
+#ifdef WUFFS_FUZZLIB__MSAN
+  __msan_allocated_memory(ptr, n);
+#endif
+}
+
+// reuse_slice_u8 returns a slice of length n, backed by heap memory that is
+// kept in *memory between calls and only re-allocated when it is too small.
+// Returning an empty slice (with a NULL ptr) means that n was zero or that
+// the allocation failed.
+//
+// The returned slice's contents are uninitialized (but may hold bytes from
+// previous calls). The memory is never freed, other than when re-allocated.
+static wuffs_base__slice_u8  //
+reuse_slice_u8(wuffs_base__slice_u8* memory, uint64_t n) {
+  if (n == 0) {
+    return wuffs_base__empty_slice_u8();
+  } else if (n > memory->len) {
+#ifdef WUFFS_FUZZLIB__ASAN
+    ASAN_UNPOISON_MEMORY_REGION(memory->ptr, memory->len);
+#endif
+    free(memory->ptr);
+    *memory = wuffs_base__malloc_slice_u8(malloc, n);
+    if (!memory->ptr) {
+      return wuffs_base__empty_slice_u8();
+    }
+  }
+#ifdef WUFFS_FUZZLIB__ASAN
+  ASAN_UNPOISON_MEMORY_REGION(memory->ptr, n);
+  ASAN_POISON_MEMORY_REGION(memory->ptr + n, memory->len - n);
+#endif
+  mark_as_uninitialized(memory->ptr, n);
+  return wuffs_base__make_slice_u8(memory->ptr, n);
+}
+
+#endif  // WUFFS_CONFIG__FUZZLIB_REUSE_MEMORY
+
 #ifdef WUFFS_CONFIG__FUZZLIB_MAIN
 
 #include <dirent.h>
@@ -111,13 +190,32 @@ make_limited_reader(wuffs_base__io_buffer b, uint64_t limit) {
 #include <stdbool.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/time.h>
 #include <unistd.h>
 
+// The -bench flag replays every input -reps=N times (with fuzz's result for
+// each input printed once, not N times), printing the total time spent in the
+// fuzz function and the number of executions per second. For example, to
+// measure the gif fuzzer's throughput over its seed corpus:
+//
+// gcc -O3 -DWUFFS_CONFIG__FUZZLIB_MAIN gif_fuzzer.c
+// ./a.out -bench ../../../test/data/*.gif ../../../test/data/artificial/*.gif
+//
+// The script/bench-c-fuzzers.sh script does this for every fuzzer and its
+// seed_corpora.txt entry. Each replay of an input must give the same result.
+// A different result, such as decoding OK only on the first replay, means
+// that state leaked from one fuzz call to another.
+
+#define WUFFS_FUZZLIB__REPS_DEFAULT 100
+#define WUFFS_FUZZLIB__REPS_MAX 1000000
+
 struct {
   int remaining_argc;
   char** remaining_argv;
 
+  bool bench;
   bool color;
+  uint32_t reps;
 } g_flags = {0};
 
 const char*  //
@@ -142,10 +240,24 @@ parse_flags(int argc, char** argv) {
       }
     }
 
+    if (!strcmp(arg, "bench")) {
+      g_flags.bench = true;
+      continue;
+    }
     if (!strcmp(arg, "c") || !strcmp(arg, "color")) {
       g_flags.color = true;
       continue;
     }
+    if (!strncmp(arg, "reps=", 5)) {
+      char* end = NULL;
+      long n = strtol(arg + 5, &end, 10);
+      if ((end == arg + 5) || (*end != '\x00') || (n <= 0) ||
+          (n > WUFFS_FUZZLIB__REPS_MAX)) {
+        return "main: invalid -reps=N value";
+      }
+      g_flags.reps = (uint32_t)n;
+      continue;
+    }
 
     return "main: unrecognized flag argument";
   }
@@ -157,6 +269,12 @@ parse_flags(int argc, char** argv) {
 
 static int g_num_files_processed;
 
+static struct {
+  uint64_t num_executions;
+  uint64_t num_bytes;
+  uint64_t micros;
+} g_bench_totals;
+
 static struct {
   char buf[PATH_MAX];
   size_t len;
@@ -190,7 +308,9 @@ visit_dir(int fd) {
     return 1;
   }
 
-  printf("dir\n");
+  if (!g_flags.bench) {
+    printf("dir\n");
+  }
   while (true) {
     struct dirent* e = readdir(d);
     if (!e) {
@@ -238,8 +358,30 @@ visit_reg(int fd, off_t size) {
     }
   }
 
+  struct timeval t0;
+  gettimeofday(&t0, NULL);
   const char* msg = llvmFuzzerTestOneInput((const uint8_t*)(data), size);
-  if (msg) {
+  uint32_t i;
+  for (i = 1; i < g_flags.reps; i++) {
+    const char* m = llvmFuzzerTestOneInput((const uint8_t*)(data), size);
+    if ((m != msg) && (!m || !msg || strcmp(m, msg))) {
+      errorf("failed");
+      fprintf(stderr, "FAIL: rep #%" PRIu32 " result differs from rep #0\n",
+              i);
+      return 1;
+    }
+  }
+  struct timeval t1;
+  gettimeofday(&t1, NULL);
+  g_bench_totals.num_executions += g_flags.reps;
+  g_bench_totals.num_bytes += ((uint64_t)size) * g_flags.reps;
+  int64_t micros = (int64_t)(t1.tv_sec - t0.tv_sec) * 1000000 +
+                   (int64_t)(t1.tv_usec - t0.tv_usec);
+  g_bench_totals.micros += (micros > 0) ? ((uint64_t)micros) : 0;
+
+  if (g_flags.bench) {
+    // No-op.
+  } else if (msg) {
     errorf(msg);
   } else if (g_flags.color) {
     printf("\e[32mok\e[0m\n");
@@ -265,9 +407,11 @@ visit(char* filename) {
     fprintf(stderr, "FAIL: invalid filename\n");
     return 1;
   }
-  int n = printf("- %s%s", g_relative_cwd.buf, filename);
-  printf("%*s", (60 > n) ? (60 - n) : 1, "");
-  fflush(stdout);
+  if (!g_flags.bench) {
+    int n = printf("- %s%s", g_relative_cwd.buf, filename);
+    printf("%*s", (60 > n) ? (60 - n) : 1, "");
+    fflush(stdout);
+  }
 
   struct stat z;
   int fd = open(filename, O_RDONLY, 0);
@@ -285,7 +429,9 @@ visit(char* filename) {
   if (S_ISREG(z.st_mode)) {
     return visit_reg(fd, z.st_size);
   } else if (!S_ISDIR(z.st_mode)) {
-    printf("skipped\n");
+    if (!g_flags.bench) {
+      printf("skipped\n");
+    }
     return 0;
   }
 
@@ -326,6 +472,9 @@ main(int argc, char** argv) {
     fprintf(stderr, "FAIL: %s\n", z);
     return 1;
   }
+  if (g_flags.reps == 0) {
+    g_flags.reps = g_flags.bench ? WUFFS_FUZZLIB__REPS_DEFAULT : 1;
+  }
   int i;
   for (i = 0; i < g_flags.remaining_argc; i++) {
     int v = visit(g_flags.remaining_argv[i]);
@@ -335,6 +484,15 @@ main(int argc, char** argv) {
   }
 
   printf("PASS: %d files processed\n", g_num_files_processed);
+  if (g_flags.bench) {
+    uint64_t micros = g_bench_totals.micros ? g_bench_totals.micros : 1;
+    printf("BENCH: %" PRIu64 " executions, %" PRIu64
+           " bytes, %.3f seconds, %.0f executions/s, %.3f MB/s\n",
+           g_bench_totals.num_executions, g_bench_totals.num_bytes,
+           ((double)micros) / 1e6,
+           ((double)g_bench_totals.num_executions) * 1e6 / ((double)micros),
+           ((double)g_bench_totals.num_bytes) / ((double)micros));
+  }
   return 0;
 }
 
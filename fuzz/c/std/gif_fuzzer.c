@@ -58,20 +58,26 @@ It should print "PASS", amongst other information, and exit(0).
 // relative includes, you can use the script/inline-c-relative-includes.go
 // program to generate a stand-alone C file.
 #include "../../../release/c/wuffs-unsupported-snapshot.c"
+#define WUFFS_CONFIG__FUZZLIB_REUSE_MEMORY
 #include "../fuzzlib/fuzzlib.c"
 
+// The decoder and the pixel and work buffers are re-used across fuzz calls.
+// See reuse_slice_u8 in fuzzlib.c for more discussion.
+wuffs_gif__decoder g_dec;
+wuffs_base__slice_u8 g_pixbuf_memory;
+wuffs_base__slice_u8 g_workbuf_memory;
+
 const char*  //
 fuzz(wuffs_base__io_buffer* src, uint32_t hash) {
   const char* ret = NULL;
-  wuffs_base__slice_u8 pixbuf = ((wuffs_base__slice_u8){});
-  wuffs_base__slice_u8 workbuf = ((wuffs_base__slice_u8){});
 
   // Use a {} code block so that "goto exit" doesn't trigger "jump bypasses
   // variable initialization" warnings.
   {
-    wuffs_gif__decoder dec;
+    wuffs_gif__decoder* dec = &g_dec;
+    mark_as_uninitialized(dec, sizeof *dec);
     wuffs_base__status status = wuffs_gif__decoder__initialize(
-        &dec, sizeof dec, WUFFS_VERSION,
+        dec, sizeof *dec, WUFFS_VERSION,
         (hash & 1) ? WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED
                    : 0);
     if (!wuffs_base__status__is_ok(&status)) {
@@ -80,7 +86,7 @@ fuzz(wuffs_base__io_buffer* src, uint32_t hash) {
     }
 
     wuffs_base__image_config ic = ((wuffs_base__image_config){});
-    status = wuffs_gif__decoder__decode_image_config(&dec, &ic, src);
+    status = wuffs_gif__decoder__decode_image_config(dec, &ic, src);
     if (!wuffs_base__status__is_ok(&status)) {
       ret = wuffs_base__status__message(&status);
       goto exit;
@@ -92,17 +98,15 @@ fuzz(wuffs_base__io_buffer* src, uint32_t hash) {
 
     // Wuffs allows either statically or dynamically allocated work buffers.
     // This program exercises dynamic allocation.
-    uint64_t n = wuffs_gif__decoder__workbuf_len(&dec).max_incl;
+    uint64_t n = wuffs_gif__decoder__workbuf_len(dec).max_incl;
     if (n > 64 * 1024 * 1024) {  // Don't allocate more than 64 MiB.
       ret = "image too large";
       goto exit;
     }
-    if (n > 0) {
-      workbuf = wuffs_base__malloc_slice_u8(malloc, n);
-      if (!workbuf.ptr) {
-        ret = "out of memory";
-        goto exit;
-      }
+    wuffs_base__slice_u8 workbuf = reuse_slice_u8(&g_workbuf_memory, n);
+    if ((n > 0) && !workbuf.ptr) {
+      ret = "out of memory";
+      goto exit;
     }
 
     n = wuffs_base__pixel_config__pixbuf_len(&ic.pixcfg);
@@ -110,12 +114,10 @@ fuzz(wuffs_base__io_buffer* src, uint32_t hash) {
       ret = "image too large";
       goto exit;
     }
-    if (n > 0) {
-      pixbuf = wuffs_base__malloc_slice_u8(malloc, n);
-      if (!pixbuf.ptr) {
-        ret = "out of memory";
-        goto exit;
-      }
+    wuffs_base__slice_u8 pixbuf = reuse_slice_u8(&g_pixbuf_memory, n);
+    if ((n > 0) && !pixbuf.ptr) {
+      ret = "out of memory";
+      goto exit;
     }
 
     wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
@@ -128,7 +130,7 @@ fuzz(wuffs_base__io_buffer* src, uint32_t hash) {
     bool seen_ok = false;
     while (true) {
       wuffs_base__frame_config fc = ((wuffs_base__frame_config){});
-      status = wuffs_gif__decoder__decode_frame_config(&dec, &fc, src);
+      status = wuffs_gif__decoder__decode_frame_config(dec, &fc, src);
       if (!wuffs_base__status__is_ok(&status)) {
         if ((status.repr != wuffs_base__note__end_of_data) || !seen_ok) {
           ret = wuffs_base__status__message(&status);
@@ -137,12 +139,12 @@ fuzz(wuffs_base__io_buffer* src, uint32_t hash) {
       }
 
       status = wuffs_gif__decoder__decode_frame(
-          &dec, &pb, src, WUFFS_BASE__PIXEL_BLEND__SRC, workbuf, NULL);
+          dec, &pb, src, WUFFS_BASE__PIXEL_BLEND__SRC, workbuf, NULL);
 
       wuffs_base__rect_ie_u32 frame_rect =
           wuffs_base__frame_config__bounds(&fc);
       wuffs_base__rect_ie_u32 dirty_rect =
-          wuffs_gif__decoder__frame_dirty_rect(&dec);
+          wuffs_gif__decoder__frame_dirty_rect(dec);
       if (!wuffs_base__rect_ie_u32__contains_rect(&frame_rect, dirty_rect)) {
         ret = "internal error: frame_rect does not contain dirty_rect";
         goto exit;
@@ -164,7 +166,5 @@ fuzz(wuffs_base__io_buffer* src, uint32_t hash) {
   }
 
 exit:
-  free(workbuf.ptr);
-  free(pixbuf.ptr);
   return ret;
 }
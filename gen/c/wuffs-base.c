@@ -0,0 +1,14734 @@
+#ifndef WUFFS_INCLUDE_GUARD__BASE
+#define WUFFS_INCLUDE_GUARD__BASE
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__BASE
+#endif
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+// Copyright 2017 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+#include <memory>
+#else
+#warning "Wuffs' C++ code requires -std=c++11 or later"
+#endif
+
+extern "C" {
+#endif
+
+// ---------------- Fundamentals
+
+// WUFFS_VERSION is the major.minor.patch version, as per https://semver.org/,
+// as a uint64_t. The major number is the high 32 bits. The minor number is the
+// middle 16 bits. The patch number is the low 16 bits. The pre-release label
+// and build metadata are part of the string representation (such as
+// "1.2.3-beta+456.20181231") but not the uint64_t representation.
+//
+// WUFFS_VERSION_PRE_RELEASE_LABEL (such as "", "beta" or "rc.1") being
+// non-empty denotes a developer preview, not a release version, and has no
+// backwards or forwards compatibility guarantees.
+//
+// WUFFS_VERSION_BUILD_METADATA_XXX, if non-zero, are the number of commits and
+// the last commit date in the repository used to build this library. Within
+// each major.minor branch, the commit count should increase monotonically.
+//
+// !! Some code generation programs can override WUFFS_VERSION.
+#define WUFFS_VERSION ((uint64_t)0)
+#define WUFFS_VERSION_MAJOR ((uint64_t)0)
+#define WUFFS_VERSION_MINOR ((uint64_t)0)
+#define WUFFS_VERSION_PATCH ((uint64_t)0)
+#define WUFFS_VERSION_PRE_RELEASE_LABEL "work.in.progress"
+#define WUFFS_VERSION_BUILD_METADATA_COMMIT_COUNT 0
+#define WUFFS_VERSION_BUILD_METADATA_COMMIT_DATE 0
+#define WUFFS_VERSION_STRING "0.0.0+0.00000000"
+
+// Define WUFFS_CONFIG__STATIC_FUNCTIONS to make all of Wuffs' functions have
+// static storage. The motivation is discussed in the "ALLOW STATIC
+// IMPLEMENTATION" section of
+// https://raw.githubusercontent.com/nothings/stb/master/docs/stb_howto.txt
+#ifdef WUFFS_CONFIG__STATIC_FUNCTIONS
+#define WUFFS_BASE__MAYBE_STATIC static
+#else
+#define WUFFS_BASE__MAYBE_STATIC
+#endif
+
+// --------
+
+// Wuffs assumes that:
+//  - converting a uint32_t to a size_t will never overflow.
+//  - converting a size_t to a uint64_t will never overflow.
+#ifdef __WORDSIZE
+#if (__WORDSIZE != 32) && (__WORDSIZE != 64)
+#error "Wuffs requires a word size of either 32 or 64 bits"
+#endif
+#endif
+
+#if defined(__clang__)
+#define WUFFS_BASE__POTENTIALLY_UNUSED_FIELD __attribute__((unused))
+#else
+#define WUFFS_BASE__POTENTIALLY_UNUSED_FIELD
+#endif
+
+// Clang also defines "__GNUC__".
+#if defined(__GNUC__)
+#define WUFFS_BASE__POTENTIALLY_UNUSED __attribute__((unused))
+#define WUFFS_BASE__WARN_UNUSED_RESULT __attribute__((warn_unused_result))
+#else
+#define WUFFS_BASE__POTENTIALLY_UNUSED
+#define WUFFS_BASE__WARN_UNUSED_RESULT
+#endif
+
+// Flags for wuffs_foo__bar__initialize functions.
+
+#define WUFFS_INITIALIZE__DEFAULT_OPTIONS ((uint32_t)0x00000000)
+
+// WUFFS_INITIALIZE__ALREADY_ZEROED means that the "self" receiver struct value
+// has already been set to all zeroes.
+#define WUFFS_INITIALIZE__ALREADY_ZEROED ((uint32_t)0x00000001)
+
+// WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED means that, absent
+// WUFFS_INITIALIZE__ALREADY_ZEROED, only some of the "self" receiver struct
+// value will be set to all zeroes. Internal buffers, which tend to be a large
+// proportion of the struct's size, will be left uninitialized. Internal means
+// that the buffer is contained by the receiver struct, as opposed to being
+// passed as a separately allocated "work buffer".
+//
+// For more detail, see:
+// https://github.com/google/wuffs/blob/master/doc/note/initialization.md
+#define WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED \
+  ((uint32_t)0x00000002)
+
+// --------
+
+// wuffs_base__empty_struct is used when a Wuffs function returns an empty
+// struct. In C, if a function f returns void, you can't say "x = f()", but in
+// Wuffs, if a function g returns empty, you can say "y = g()".
+typedef struct {
+  // private_impl is a placeholder field. It isn't explicitly used, except that
+  // without it, the sizeof a struct with no fields can differ across C/C++
+  // compilers, and it is undefined behavior in C99. For example, gcc says that
+  // the sizeof an empty struct is 0, and g++ says that it is 1. This leads to
+  // ABI incompatibility if a Wuffs .c file is processed by one compiler and
+  // its .h file with another compiler.
+  //
+  // Instead, we explicitly insert an otherwise unused field, so that the
+  // sizeof this struct is always 1.
+  uint8_t private_impl;
+} wuffs_base__empty_struct;
+
+static inline wuffs_base__empty_struct  //
+wuffs_base__make_empty_struct() {
+  wuffs_base__empty_struct ret;
+  ret.private_impl = 0;
+  return ret;
+}
+
+// wuffs_base__utility is a placeholder receiver type. It enables what Java
+// calls static methods, as opposed to regular methods.
+typedef struct {
+  // private_impl is a placeholder field. It isn't explicitly used, except that
+  // without it, the sizeof a struct with no fields can differ across C/C++
+  // compilers, and it is undefined behavior in C99. For example, gcc says that
+  // the sizeof an empty struct is 0, and g++ says that it is 1. This leads to
+  // ABI incompatibility if a Wuffs .c file is processed by one compiler and
+  // its .h file with another compiler.
+  //
+  // Instead, we explicitly insert an otherwise unused field, so that the
+  // sizeof this struct is always 1.
+  uint8_t private_impl;
+} wuffs_base__utility;
+
+typedef struct {
+  const char* vtable_name;
+  const void* function_pointers;
+} wuffs_base__vtable;
+
+// wuffs_base__func_stats holds one function's instrumentation counters. They
+// are only updated if WUFFS_CONFIG__ENABLE_STATS is defined, in which case
+// each wuffs_foo__bar struct has a wuffs_foo__bar__get_stats function.
+typedef struct {
+  // num_calls counts the calls to the function, including each resumption of
+  // a suspended coroutine.
+  uint64_t num_calls;
+  // num_written counts the bytes (or tokens) written to the function's dst
+  // argument, including those written by the functions that it calls. It is
+  // zero if the function has no io_writer (or token_writer) argument.
+  uint64_t num_written;
+} wuffs_base__func_stats;
+
+// --------
+
+// See https://github.com/google/wuffs/blob/master/doc/note/statuses.md
+typedef struct {
+  const char* repr;
+
+#ifdef __cplusplus
+  inline bool is_complete() const;
+  inline bool is_error() const;
+  inline bool is_note() const;
+  inline bool is_ok() const;
+  inline bool is_suspension() const;
+  inline const char* message() const;
+#endif  // __cplusplus
+
+} wuffs_base__status;
+
+extern const char* wuffs_base__note__i_o_redirect;
+extern const char* wuffs_base__note__end_of_data;
+extern const char* wuffs_base__note__metadata_reported;
+extern const char* wuffs_base__suspension__even_more_information;
+extern const char* wuffs_base__suspension__mispositioned_read;
+extern const char* wuffs_base__suspension__mispositioned_write;
+extern const char* wuffs_base__suspension__short_read;
+extern const char* wuffs_base__suspension__short_write;
+extern const char* wuffs_base__error__bad_i_o_position;
+extern const char* wuffs_base__error__bad_argument_length_too_short;
+extern const char* wuffs_base__error__bad_argument;
+extern const char* wuffs_base__error__bad_call_sequence;
+extern const char* wuffs_base__error__bad_receiver;
+extern const char* wuffs_base__error__bad_restart;
+extern const char* wuffs_base__error__bad_sizeof_receiver;
+extern const char* wuffs_base__error__bad_vtable;
+extern const char* wuffs_base__error__bad_workbuf_length;
+extern const char* wuffs_base__error__bad_wuffs_version;
+extern const char* wuffs_base__error__cannot_return_a_suspension;
+extern const char* wuffs_base__error__disabled_by_wuffs_config_dst_pixel_format_enable_allowlist;
+extern const char* wuffs_base__error__disabled_by_previous_error;
+extern const char* wuffs_base__error__initialize_falsely_claimed_already_zeroed;
+extern const char* wuffs_base__error__initialize_not_called;
+extern const char* wuffs_base__error__interleaved_coroutine_calls;
+extern const char* wuffs_base__error__no_more_information;
+extern const char* wuffs_base__error__not_enough_data;
+extern const char* wuffs_base__error__out_of_bounds;
+extern const char* wuffs_base__error__unsupported_method;
+extern const char* wuffs_base__error__unsupported_option;
+extern const char* wuffs_base__error__unsupported_pixel_swizzler_option;
+extern const char* wuffs_base__error__too_much_data;
+
+static inline wuffs_base__status  //
+wuffs_base__make_status(const char* repr) {
+  wuffs_base__status z;
+  z.repr = repr;
+  return z;
+}
+
+static inline bool  //
+wuffs_base__status__is_complete(const wuffs_base__status* z) {
+  return (z->repr == NULL) || ((*z->repr != '$') && (*z->repr != '#'));
+}
+
+static inline bool  //
+wuffs_base__status__is_error(const wuffs_base__status* z) {
+  return z->repr && (*z->repr == '#');
+}
+
+static inline bool  //
+wuffs_base__status__is_note(const wuffs_base__status* z) {
+  return z->repr && (*z->repr != '$') && (*z->repr != '#');
+}
+
+static inline bool  //
+wuffs_base__status__is_ok(const wuffs_base__status* z) {
+  return z->repr == NULL;
+}
+
+static inline bool  //
+wuffs_base__status__is_suspension(const wuffs_base__status* z) {
+  return z->repr && (*z->repr == '$');
+}
+
+// wuffs_base__status__message strips the leading '$', '#' or '@'.
+static inline const char*  //
+wuffs_base__status__message(const wuffs_base__status* z) {
+  if (z->repr) {
+    if ((*z->repr == '$') || (*z->repr == '#') || (*z->repr == '@')) {
+      return z->repr + 1;
+    }
+  }
+  return z->repr;
+}
+
+#ifdef __cplusplus
+
+inline bool  //
+wuffs_base__status::is_complete() const {
+  return wuffs_base__status__is_complete(this);
+}
+
+inline bool  //
+wuffs_base__status::is_error() const {
+  return wuffs_base__status__is_error(this);
+}
+
+inline bool  //
+wuffs_base__status::is_note() const {
+  return wuffs_base__status__is_note(this);
+}
+
+inline bool  //
+wuffs_base__status::is_ok() const {
+  return wuffs_base__status__is_ok(this);
+}
+
+inline bool  //
+wuffs_base__status::is_suspension() const {
+  return wuffs_base__status__is_suspension(this);
+}
+
+inline const char*  //
+wuffs_base__status::message() const {
+  return wuffs_base__status__message(this);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+// WUFFS_BASE__RESULT is a result type: either a status (an error) or a value.
+//
+// A result with all fields NULL or zero is as valid as a zero-valued T.
+#define WUFFS_BASE__RESULT(T)  \
+  struct {                     \
+    wuffs_base__status status; \
+    T value;                   \
+  }
+
+typedef WUFFS_BASE__RESULT(double) wuffs_base__result_f64;
+typedef WUFFS_BASE__RESULT(int64_t) wuffs_base__result_i64;
+typedef WUFFS_BASE__RESULT(uint64_t) wuffs_base__result_u64;
+
+// --------
+
+// FourCC constants.
+
+// International Color Consortium Profile.
+#define WUFFS_BASE__FOURCC__ICCP 0x49434350
+
+// Joint Photographic Experts Group.
+#define WUFFS_BASE__FOURCC__JPEG 0x4A504547
+
+// Portable Network Graphics.
+#define WUFFS_BASE__FOURCC__PNG 0x504E4720
+
+// Extensible Metadata Platform.
+#define WUFFS_BASE__FOURCC__XMP 0x584D5020
+
+
+// --------
+
+// Flicks are a unit of time. One flick (frame-tick) is 1 / 705_600_000 of a
+// second. See https://github.com/OculusVR/Flicks
+typedef int64_t wuffs_base__flicks;
+
+#define WUFFS_BASE__FLICKS_PER_SECOND ((uint64_t)705600000)
+#define WUFFS_BASE__FLICKS_PER_MILLISECOND ((uint64_t)705600)
+
+// ---------------- Numeric Types
+
+// The helpers below are functions, instead of macros, because their arguments
+// can be an expression that we shouldn't evaluate more than once.
+//
+// They are static, so that linking multiple wuffs .o files won't complain about
+// duplicate function definitions.
+//
+// They are explicitly marked inline, even if modern compilers don't use the
+// inline attribute to guide optimizations such as inlining, to avoid the
+// -Wunused-function warning, and we like to compile with -Wall -Werror.
+
+static inline uint8_t  //
+wuffs_base__u8__min(uint8_t x, uint8_t y) {
+  return x < y ? x : y;
+}
+
+static inline uint8_t  //
+wuffs_base__u8__max(uint8_t x, uint8_t y) {
+  return x > y ? x : y;
+}
+
+static inline uint16_t  //
+wuffs_base__u16__min(uint16_t x, uint16_t y) {
+  return x < y ? x : y;
+}
+
+static inline uint16_t  //
+wuffs_base__u16__max(uint16_t x, uint16_t y) {
+  return x > y ? x : y;
+}
+
+static inline uint32_t  //
+wuffs_base__u32__min(uint32_t x, uint32_t y) {
+  return x < y ? x : y;
+}
+
+static inline uint32_t  //
+wuffs_base__u32__max(uint32_t x, uint32_t y) {
+  return x > y ? x : y;
+}
+
+static inline uint64_t  //
+wuffs_base__u64__min(uint64_t x, uint64_t y) {
+  return x < y ? x : y;
+}
+
+static inline uint64_t  //
+wuffs_base__u64__max(uint64_t x, uint64_t y) {
+  return x > y ? x : y;
+}
+
+// --------
+
+// Saturating arithmetic (sat_add, sat_sub) branchless bit-twiddling algorithms
+// are per https://locklessinc.com/articles/sat_arithmetic/
+//
+// It is important that the underlying types are unsigned integers, as signed
+// integer arithmetic overflow is undefined behavior in C.
+
+static inline uint8_t  //
+wuffs_base__u8__sat_add(uint8_t x, uint8_t y) {
+  uint8_t res = (uint8_t)(x + y);
+  res |= (uint8_t)(-(res < x));
+  return res;
+}
+
+static inline uint8_t  //
+wuffs_base__u8__sat_sub(uint8_t x, uint8_t y) {
+  uint8_t res = (uint8_t)(x - y);
+  res &= (uint8_t)(-(res <= x));
+  return res;
+}
+
+static inline uint16_t  //
+wuffs_base__u16__sat_add(uint16_t x, uint16_t y) {
+  uint16_t res = (uint16_t)(x + y);
+  res |= (uint16_t)(-(res < x));
+  return res;
+}
+
+static inline uint16_t  //
+wuffs_base__u16__sat_sub(uint16_t x, uint16_t y) {
+  uint16_t res = (uint16_t)(x - y);
+  res &= (uint16_t)(-(res <= x));
+  return res;
+}
+
+static inline uint32_t  //
+wuffs_base__u32__sat_add(uint32_t x, uint32_t y) {
+  uint32_t res = (uint32_t)(x + y);
+  res |= (uint32_t)(-(res < x));
+  return res;
+}
+
+static inline uint32_t  //
+wuffs_base__u32__sat_sub(uint32_t x, uint32_t y) {
+  uint32_t res = (uint32_t)(x - y);
+  res &= (uint32_t)(-(res <= x));
+  return res;
+}
+
+static inline uint64_t  //
+wuffs_base__u64__sat_add(uint64_t x, uint64_t y) {
+  uint64_t res = (uint64_t)(x + y);
+  res |= (uint64_t)(-(res < x));
+  return res;
+}
+
+static inline uint64_t  //
+wuffs_base__u64__sat_sub(uint64_t x, uint64_t y) {
+  uint64_t res = (uint64_t)(x - y);
+  res &= (uint64_t)(-(res <= x));
+  return res;
+}
+
+// --------
+
+typedef struct {
+  uint64_t hi;
+  uint64_t lo;
+} wuffs_base__multiply_u64__output;
+
+// wuffs_base__multiply_u64 returns x*y as a 128-bit value.
+//
+// The maximum inclusive output hi_lo is 0xFFFFFFFFFFFFFFFE_0000000000000001.
+static inline wuffs_base__multiply_u64__output  //
+wuffs_base__multiply_u64(uint64_t x, uint64_t y) {
+  uint64_t x0 = x & 0xFFFFFFFF;
+  uint64_t x1 = x >> 32;
+  uint64_t y0 = y & 0xFFFFFFFF;
+  uint64_t y1 = y >> 32;
+  uint64_t w0 = x0 * y0;
+  uint64_t t = (x1 * y0) + (w0 >> 32);
+  uint64_t w1 = t & 0xFFFFFFFF;
+  uint64_t w2 = t >> 32;
+  w1 += x0 * y1;
+  wuffs_base__multiply_u64__output o;
+  o.hi = (x1 * y1) + w2 + (w1 >> 32);
+  o.lo = x * y;
+  return o;
+}
+
+  // --------
+
+#if defined(__GNUC__) && (__SIZEOF_LONG__ == 8)
+
+static inline uint32_t  //
+wuffs_base__count_leading_zeroes_u64(uint64_t u) {
+  return u ? ((uint32_t)(__builtin_clzl(u))) : 64u;
+}
+
+#else
+
+static inline uint32_t  //
+wuffs_base__count_leading_zeroes_u64(uint64_t u) {
+  if (u == 0) {
+    return 64;
+  }
+
+  uint32_t n = 0;
+  if ((u >> 32) == 0) {
+    n |= 32;
+    u <<= 32;
+  }
+  if ((u >> 48) == 0) {
+    n |= 16;
+    u <<= 16;
+  }
+  if ((u >> 56) == 0) {
+    n |= 8;
+    u <<= 8;
+  }
+  if ((u >> 60) == 0) {
+    n |= 4;
+    u <<= 4;
+  }
+  if ((u >> 62) == 0) {
+    n |= 2;
+    u <<= 2;
+  }
+  if ((u >> 63) == 0) {
+    n |= 1;
+    u <<= 1;
+  }
+  return n;
+}
+
+#endif  // defined(__GNUC__) && (__SIZEOF_LONG__ == 8)
+
+  // --------
+
+#define wuffs_base__load_u8be__no_bounds_check \
+  wuffs_base__load_u8__no_bounds_check
+#define wuffs_base__load_u8le__no_bounds_check \
+  wuffs_base__load_u8__no_bounds_check
+
+static inline uint8_t  //
+wuffs_base__load_u8__no_bounds_check(const uint8_t* p) {
+  return p[0];
+}
+
+static inline uint16_t  //
+wuffs_base__load_u16be__no_bounds_check(const uint8_t* p) {
+  return (uint16_t)(((uint16_t)(p[0]) << 8) | ((uint16_t)(p[1]) << 0));
+}
+
+static inline uint16_t  //
+wuffs_base__load_u16le__no_bounds_check(const uint8_t* p) {
+  return (uint16_t)(((uint16_t)(p[0]) << 0) | ((uint16_t)(p[1]) << 8));
+}
+
+static inline uint32_t  //
+wuffs_base__load_u24be__no_bounds_check(const uint8_t* p) {
+  return ((uint32_t)(p[0]) << 16) | ((uint32_t)(p[1]) << 8) |
+         ((uint32_t)(p[2]) << 0);
+}
+
+static inline uint32_t  //
+wuffs_base__load_u24le__no_bounds_check(const uint8_t* p) {
+  return ((uint32_t)(p[0]) << 0) | ((uint32_t)(p[1]) << 8) |
+         ((uint32_t)(p[2]) << 16);
+}
+
+static inline uint32_t  //
+wuffs_base__load_u32be__no_bounds_check(const uint8_t* p) {
+  return ((uint32_t)(p[0]) << 24) | ((uint32_t)(p[1]) << 16) |
+         ((uint32_t)(p[2]) << 8) | ((uint32_t)(p[3]) << 0);
+}
+
+static inline uint32_t  //
+wuffs_base__load_u32le__no_bounds_check(const uint8_t* p) {
+  return ((uint32_t)(p[0]) << 0) | ((uint32_t)(p[1]) << 8) |
+         ((uint32_t)(p[2]) << 16) | ((uint32_t)(p[3]) << 24);
+}
+
+static inline uint64_t  //
+wuffs_base__load_u40be__no_bounds_check(const uint8_t* p) {
+  return ((uint64_t)(p[0]) << 32) | ((uint64_t)(p[1]) << 24) |
+         ((uint64_t)(p[2]) << 16) | ((uint64_t)(p[3]) << 8) |
+         ((uint64_t)(p[4]) << 0);
+}
+
+static inline uint64_t  //
+wuffs_base__load_u40le__no_bounds_check(const uint8_t* p) {
+  return ((uint64_t)(p[0]) << 0) | ((uint64_t)(p[1]) << 8) |
+         ((uint64_t)(p[2]) << 16) | ((uint64_t)(p[3]) << 24) |
+         ((uint64_t)(p[4]) << 32);
+}
+
+static inline uint64_t  //
+wuffs_base__load_u48be__no_bounds_check(const uint8_t* p) {
+  return ((uint64_t)(p[0]) << 40) | ((uint64_t)(p[1]) << 32) |
+         ((uint64_t)(p[2]) << 24) | ((uint64_t)(p[3]) << 16) |
+         ((uint64_t)(p[4]) << 8) | ((uint64_t)(p[5]) << 0);
+}
+
+static inline uint64_t  //
+wuffs_base__load_u48le__no_bounds_check(const uint8_t* p) {
+  return ((uint64_t)(p[0]) << 0) | ((uint64_t)(p[1]) << 8) |
+         ((uint64_t)(p[2]) << 16) | ((uint64_t)(p[3]) << 24) |
+         ((uint64_t)(p[4]) << 32) | ((uint64_t)(p[5]) << 40);
+}
+
+static inline uint64_t  //
+wuffs_base__load_u56be__no_bounds_check(const uint8_t* p) {
+  return ((uint64_t)(p[0]) << 48) | ((uint64_t)(p[1]) << 40) |
+         ((uint64_t)(p[2]) << 32) | ((uint64_t)(p[3]) << 24) |
+         ((uint64_t)(p[4]) << 16) | ((uint64_t)(p[5]) << 8) |
+         ((uint64_t)(p[6]) << 0);
+}
+
+static inline uint64_t  //
+wuffs_base__load_u56le__no_bounds_check(const uint8_t* p) {
+  return ((uint64_t)(p[0]) << 0) | ((uint64_t)(p[1]) << 8) |
+         ((uint64_t)(p[2]) << 16) | ((uint64_t)(p[3]) << 24) |
+         ((uint64_t)(p[4]) << 32) | ((uint64_t)(p[5]) << 40) |
+         ((uint64_t)(p[6]) << 48);
+}
+
+static inline uint64_t  //
+wuffs_base__load_u64be__no_bounds_check(const uint8_t* p) {
+  return ((uint64_t)(p[0]) << 56) | ((uint64_t)(p[1]) << 48) |
+         ((uint64_t)(p[2]) << 40) | ((uint64_t)(p[3]) << 32) |
+         ((uint64_t)(p[4]) << 24) | ((uint64_t)(p[5]) << 16) |
+         ((uint64_t)(p[6]) << 8) | ((uint64_t)(p[7]) << 0);
+}
+
+static inline uint64_t  //
+wuffs_base__load_u64le__no_bounds_check(const uint8_t* p) {
+  return ((uint64_t)(p[0]) << 0) | ((uint64_t)(p[1]) << 8) |
+         ((uint64_t)(p[2]) << 16) | ((uint64_t)(p[3]) << 24) |
+         ((uint64_t)(p[4]) << 32) | ((uint64_t)(p[5]) << 40) |
+         ((uint64_t)(p[6]) << 48) | ((uint64_t)(p[7]) << 56);
+}
+
+  // --------
+
+#define wuffs_base__store_u8be__no_bounds_check \
+  wuffs_base__store_u8__no_bounds_check
+#define wuffs_base__store_u8le__no_bounds_check \
+  wuffs_base__store_u8__no_bounds_check
+
+static inline void  //
+wuffs_base__store_u8__no_bounds_check(uint8_t* p, uint8_t x) {
+  p[0] = x;
+}
+
+static inline void  //
+wuffs_base__store_u16be__no_bounds_check(uint8_t* p, uint16_t x) {
+  p[0] = (uint8_t)(x >> 8);
+  p[1] = (uint8_t)(x >> 0);
+}
+
+static inline void  //
+wuffs_base__store_u16le__no_bounds_check(uint8_t* p, uint16_t x) {
+  p[0] = (uint8_t)(x >> 0);
+  p[1] = (uint8_t)(x >> 8);
+}
+
+static inline void  //
+wuffs_base__store_u24be__no_bounds_check(uint8_t* p, uint32_t x) {
+  p[0] = (uint8_t)(x >> 16);
+  p[1] = (uint8_t)(x >> 8);
+  p[2] = (uint8_t)(x >> 0);
+}
+
+static inline void  //
+wuffs_base__store_u24le__no_bounds_check(uint8_t* p, uint32_t x) {
+  p[0] = (uint8_t)(x >> 0);
+  p[1] = (uint8_t)(x >> 8);
+  p[2] = (uint8_t)(x >> 16);
+}
+
+static inline void  //
+wuffs_base__store_u32be__no_bounds_check(uint8_t* p, uint32_t x) {
+  p[0] = (uint8_t)(x >> 24);
+  p[1] = (uint8_t)(x >> 16);
+  p[2] = (uint8_t)(x >> 8);
+  p[3] = (uint8_t)(x >> 0);
+}
+
+static inline void  //
+wuffs_base__store_u32le__no_bounds_check(uint8_t* p, uint32_t x) {
+  p[0] = (uint8_t)(x >> 0);
+  p[1] = (uint8_t)(x >> 8);
+  p[2] = (uint8_t)(x >> 16);
+  p[3] = (uint8_t)(x >> 24);
+}
+
+static inline void  //
+wuffs_base__store_u40be__no_bounds_check(uint8_t* p, uint64_t x) {
+  p[0] = (uint8_t)(x >> 32);
+  p[1] = (uint8_t)(x >> 24);
+  p[2] = (uint8_t)(x >> 16);
+  p[3] = (uint8_t)(x >> 8);
+  p[4] = (uint8_t)(x >> 0);
+}
+
+static inline void  //
+wuffs_base__store_u40le__no_bounds_check(uint8_t* p, uint64_t x) {
+  p[0] = (uint8_t)(x >> 0);
+  p[1] = (uint8_t)(x >> 8);
+  p[2] = (uint8_t)(x >> 16);
+  p[3] = (uint8_t)(x >> 24);
+  p[4] = (uint8_t)(x >> 32);
+}
+
+static inline void  //
+wuffs_base__store_u48be__no_bounds_check(uint8_t* p, uint64_t x) {
+  p[0] = (uint8_t)(x >> 40);
+  p[1] = (uint8_t)(x >> 32);
+  p[2] = (uint8_t)(x >> 24);
+  p[3] = (uint8_t)(x >> 16);
+  p[4] = (uint8_t)(x >> 8);
+  p[5] = (uint8_t)(x >> 0);
+}
+
+static inline void  //
+wuffs_base__store_u48le__no_bounds_check(uint8_t* p, uint64_t x) {
+  p[0] = (uint8_t)(x >> 0);
+  p[1] = (uint8_t)(x >> 8);
+  p[2] = (uint8_t)(x >> 16);
+  p[3] = (uint8_t)(x >> 24);
+  p[4] = (uint8_t)(x >> 32);
+  p[5] = (uint8_t)(x >> 40);
+}
+
+static inline void  //
+wuffs_base__store_u56be__no_bounds_check(uint8_t* p, uint64_t x) {
+  p[0] = (uint8_t)(x >> 48);
+  p[1] = (uint8_t)(x >> 40);
+  p[2] = (uint8_t)(x >> 32);
+  p[3] = (uint8_t)(x >> 24);
+  p[4] = (uint8_t)(x >> 16);
+  p[5] = (uint8_t)(x >> 8);
+  p[6] = (uint8_t)(x >> 0);
+}
+
+static inline void  //
+wuffs_base__store_u56le__no_bounds_check(uint8_t* p, uint64_t x) {
+  p[0] = (uint8_t)(x >> 0);
+  p[1] = (uint8_t)(x >> 8);
+  p[2] = (uint8_t)(x >> 16);
+  p[3] = (uint8_t)(x >> 24);
+  p[4] = (uint8_t)(x >> 32);
+  p[5] = (uint8_t)(x >> 40);
+  p[6] = (uint8_t)(x >> 48);
+}
+
+static inline void  //
+wuffs_base__store_u64be__no_bounds_check(uint8_t* p, uint64_t x) {
+  p[0] = (uint8_t)(x >> 56);
+  p[1] = (uint8_t)(x >> 48);
+  p[2] = (uint8_t)(x >> 40);
+  p[3] = (uint8_t)(x >> 32);
+  p[4] = (uint8_t)(x >> 24);
+  p[5] = (uint8_t)(x >> 16);
+  p[6] = (uint8_t)(x >> 8);
+  p[7] = (uint8_t)(x >> 0);
+}
+
+static inline void  //
+wuffs_base__store_u64le__no_bounds_check(uint8_t* p, uint64_t x) {
+  p[0] = (uint8_t)(x >> 0);
+  p[1] = (uint8_t)(x >> 8);
+  p[2] = (uint8_t)(x >> 16);
+  p[3] = (uint8_t)(x >> 24);
+  p[4] = (uint8_t)(x >> 32);
+  p[5] = (uint8_t)(x >> 40);
+  p[6] = (uint8_t)(x >> 48);
+  p[7] = (uint8_t)(x >> 56);
+}
+
+// ---------------- Slices and Tables
+
+// WUFFS_BASE__SLICE is a 1-dimensional buffer.
+//
+// len measures a number of elements, not necessarily a size in bytes.
+//
+// A value with all fields NULL or zero is a valid, empty slice.
+#define WUFFS_BASE__SLICE(T) \
+  struct {                   \
+    T* ptr;                  \
+    size_t len;              \
+  }
+
+// WUFFS_BASE__TABLE is a 2-dimensional buffer.
+//
+// width height, and stride measure a number of elements, not necessarily a
+// size in bytes.
+//
+// A value with all fields NULL or zero is a valid, empty table.
+#define WUFFS_BASE__TABLE(T) \
+  struct {                   \
+    T* ptr;                  \
+    size_t width;            \
+    size_t height;           \
+    size_t stride;           \
+  }
+
+typedef WUFFS_BASE__SLICE(uint8_t) wuffs_base__slice_u8;
+typedef WUFFS_BASE__SLICE(uint16_t) wuffs_base__slice_u16;
+typedef WUFFS_BASE__SLICE(uint32_t) wuffs_base__slice_u32;
+typedef WUFFS_BASE__SLICE(uint64_t) wuffs_base__slice_u64;
+
+typedef WUFFS_BASE__TABLE(uint8_t) wuffs_base__table_u8;
+typedef WUFFS_BASE__TABLE(uint16_t) wuffs_base__table_u16;
+typedef WUFFS_BASE__TABLE(uint32_t) wuffs_base__table_u32;
+typedef WUFFS_BASE__TABLE(uint64_t) wuffs_base__table_u64;
+
+static inline wuffs_base__slice_u8  //
+wuffs_base__make_slice_u8(uint8_t* ptr, size_t len) {
+  wuffs_base__slice_u8 ret;
+  ret.ptr = ptr;
+  ret.len = len;
+  return ret;
+}
+
+static inline wuffs_base__slice_u16  //
+wuffs_base__make_slice_u16(uint16_t* ptr, size_t len) {
+  wuffs_base__slice_u16 ret;
+  ret.ptr = ptr;
+  ret.len = len;
+  return ret;
+}
+
+static inline wuffs_base__slice_u32  //
+wuffs_base__make_slice_u32(uint32_t* ptr, size_t len) {
+  wuffs_base__slice_u32 ret;
+  ret.ptr = ptr;
+  ret.len = len;
+  return ret;
+}
+
+static inline wuffs_base__slice_u64  //
+wuffs_base__make_slice_u64(uint64_t* ptr, size_t len) {
+  wuffs_base__slice_u64 ret;
+  ret.ptr = ptr;
+  ret.len = len;
+  return ret;
+}
+
+static inline wuffs_base__slice_u8  //
+wuffs_base__empty_slice_u8() {
+  wuffs_base__slice_u8 ret;
+  ret.ptr = NULL;
+  ret.len = 0;
+  return ret;
+}
+
+static inline wuffs_base__table_u8  //
+wuffs_base__empty_table_u8() {
+  wuffs_base__table_u8 ret;
+  ret.ptr = NULL;
+  ret.width = 0;
+  ret.height = 0;
+  ret.stride = 0;
+  return ret;
+}
+
+// wuffs_base__slice_u8__subslice_i returns s[i:].
+//
+// It returns an empty slice if i is out of bounds.
+static inline wuffs_base__slice_u8  //
+wuffs_base__slice_u8__subslice_i(wuffs_base__slice_u8 s, uint64_t i) {
+  if ((i <= SIZE_MAX) && (i <= s.len)) {
+    return wuffs_base__make_slice_u8(s.ptr + i, s.len - i);
+  }
+  return wuffs_base__make_slice_u8(NULL, 0);
+}
+
+// wuffs_base__slice_u8__subslice_j returns s[:j].
+//
+// It returns an empty slice if j is out of bounds.
+static inline wuffs_base__slice_u8  //
+wuffs_base__slice_u8__subslice_j(wuffs_base__slice_u8 s, uint64_t j) {
+  if ((j <= SIZE_MAX) && (j <= s.len)) {
+    return wuffs_base__make_slice_u8(s.ptr, j);
+  }
+  return wuffs_base__make_slice_u8(NULL, 0);
+}
+
+// wuffs_base__slice_u8__subslice_ij returns s[i:j].
+//
+// It returns an empty slice if i or j is out of bounds.
+static inline wuffs_base__slice_u8  //
+wuffs_base__slice_u8__subslice_ij(wuffs_base__slice_u8 s,
+                                  uint64_t i,
+                                  uint64_t j) {
+  if ((i <= j) && (j <= SIZE_MAX) && (j <= s.len)) {
+    return wuffs_base__make_slice_u8(s.ptr + i, j - i);
+  }
+  return wuffs_base__make_slice_u8(NULL, 0);
+}
+
+// ---------------- Ranges and Rects
+
+// See https://github.com/google/wuffs/blob/master/doc/note/ranges-and-rects.md
+
+typedef struct wuffs_base__range_ii_u32__struct {
+  uint32_t min_incl;
+  uint32_t max_incl;
+
+#ifdef __cplusplus
+  inline bool is_empty() const;
+  inline bool equals(wuffs_base__range_ii_u32__struct s) const;
+  inline wuffs_base__range_ii_u32__struct intersect(
+      wuffs_base__range_ii_u32__struct s) const;
+  inline wuffs_base__range_ii_u32__struct unite(
+      wuffs_base__range_ii_u32__struct s) const;
+  inline bool contains(uint32_t x) const;
+  inline bool contains_range(wuffs_base__range_ii_u32__struct s) const;
+#endif  // __cplusplus
+
+} wuffs_base__range_ii_u32;
+
+static inline wuffs_base__range_ii_u32  //
+wuffs_base__empty_range_ii_u32() {
+  wuffs_base__range_ii_u32 ret;
+  ret.min_incl = 0;
+  ret.max_incl = 0;
+  return ret;
+}
+
+static inline wuffs_base__range_ii_u32  //
+wuffs_base__make_range_ii_u32(uint32_t min_incl, uint32_t max_incl) {
+  wuffs_base__range_ii_u32 ret;
+  ret.min_incl = min_incl;
+  ret.max_incl = max_incl;
+  return ret;
+}
+
+static inline bool  //
+wuffs_base__range_ii_u32__is_empty(const wuffs_base__range_ii_u32* r) {
+  return r->min_incl > r->max_incl;
+}
+
+static inline bool  //
+wuffs_base__range_ii_u32__equals(const wuffs_base__range_ii_u32* r,
+                                 wuffs_base__range_ii_u32 s) {
+  return (r->min_incl == s.min_incl && r->max_incl == s.max_incl) ||
+         (wuffs_base__range_ii_u32__is_empty(r) &&
+          wuffs_base__range_ii_u32__is_empty(&s));
+}
+
+static inline wuffs_base__range_ii_u32  //
+wuffs_base__range_ii_u32__intersect(const wuffs_base__range_ii_u32* r,
+                                    wuffs_base__range_ii_u32 s) {
+  wuffs_base__range_ii_u32 t;
+  t.min_incl = wuffs_base__u32__max(r->min_incl, s.min_incl);
+  t.max_incl = wuffs_base__u32__min(r->max_incl, s.max_incl);
+  return t;
+}
+
+static inline wuffs_base__range_ii_u32  //
+wuffs_base__range_ii_u32__unite(const wuffs_base__range_ii_u32* r,
+                                wuffs_base__range_ii_u32 s) {
+  if (wuffs_base__range_ii_u32__is_empty(r)) {
+    return s;
+  }
+  if (wuffs_base__range_ii_u32__is_empty(&s)) {
+    return *r;
+  }
+  wuffs_base__range_ii_u32 t;
+  t.min_incl = wuffs_base__u32__min(r->min_incl, s.min_incl);
+  t.max_incl = wuffs_base__u32__max(r->max_incl, s.max_incl);
+  return t;
+}
+
+static inline bool  //
+wuffs_base__range_ii_u32__contains(const wuffs_base__range_ii_u32* r,
+                                   uint32_t x) {
+  return (r->min_incl <= x) && (x <= r->max_incl);
+}
+
+static inline bool  //
+wuffs_base__range_ii_u32__contains_range(const wuffs_base__range_ii_u32* r,
+                                         wuffs_base__range_ii_u32 s) {
+  return wuffs_base__range_ii_u32__equals(
+      &s, wuffs_base__range_ii_u32__intersect(r, s));
+}
+
+#ifdef __cplusplus
+
+inline bool  //
+wuffs_base__range_ii_u32::is_empty() const {
+  return wuffs_base__range_ii_u32__is_empty(this);
+}
+
+inline bool  //
+wuffs_base__range_ii_u32::equals(wuffs_base__range_ii_u32 s) const {
+  return wuffs_base__range_ii_u32__equals(this, s);
+}
+
+inline wuffs_base__range_ii_u32  //
+wuffs_base__range_ii_u32::intersect(wuffs_base__range_ii_u32 s) const {
+  return wuffs_base__range_ii_u32__intersect(this, s);
+}
+
+inline wuffs_base__range_ii_u32  //
+wuffs_base__range_ii_u32::unite(wuffs_base__range_ii_u32 s) const {
+  return wuffs_base__range_ii_u32__unite(this, s);
+}
+
+inline bool  //
+wuffs_base__range_ii_u32::contains(uint32_t x) const {
+  return wuffs_base__range_ii_u32__contains(this, x);
+}
+
+inline bool  //
+wuffs_base__range_ii_u32::contains_range(wuffs_base__range_ii_u32 s) const {
+  return wuffs_base__range_ii_u32__contains_range(this, s);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+typedef struct wuffs_base__range_ie_u32__struct {
+  uint32_t min_incl;
+  uint32_t max_excl;
+
+#ifdef __cplusplus
+  inline bool is_empty() const;
+  inline bool equals(wuffs_base__range_ie_u32__struct s) const;
+  inline wuffs_base__range_ie_u32__struct intersect(
+      wuffs_base__range_ie_u32__struct s) const;
+  inline wuffs_base__range_ie_u32__struct unite(
+      wuffs_base__range_ie_u32__struct s) const;
+  inline bool contains(uint32_t x) const;
+  inline bool contains_range(wuffs_base__range_ie_u32__struct s) const;
+  inline uint32_t length() const;
+#endif  // __cplusplus
+
+} wuffs_base__range_ie_u32;
+
+static inline wuffs_base__range_ie_u32  //
+wuffs_base__empty_range_ie_u32() {
+  wuffs_base__range_ie_u32 ret;
+  ret.min_incl = 0;
+  ret.max_excl = 0;
+  return ret;
+}
+
+static inline wuffs_base__range_ie_u32  //
+wuffs_base__make_range_ie_u32(uint32_t min_incl, uint32_t max_excl) {
+  wuffs_base__range_ie_u32 ret;
+  ret.min_incl = min_incl;
+  ret.max_excl = max_excl;
+  return ret;
+}
+
+static inline bool  //
+wuffs_base__range_ie_u32__is_empty(const wuffs_base__range_ie_u32* r) {
+  return r->min_incl >= r->max_excl;
+}
+
+static inline bool  //
+wuffs_base__range_ie_u32__equals(const wuffs_base__range_ie_u32* r,
+                                 wuffs_base__range_ie_u32 s) {
+  return (r->min_incl == s.min_incl && r->max_excl == s.max_excl) ||
+         (wuffs_base__range_ie_u32__is_empty(r) &&
+          wuffs_base__range_ie_u32__is_empty(&s));
+}
+
+static inline wuffs_base__range_ie_u32  //
+wuffs_base__range_ie_u32__intersect(const wuffs_base__range_ie_u32* r,
+                                    wuffs_base__range_ie_u32 s) {
+  wuffs_base__range_ie_u32 t;
+  t.min_incl = wuffs_base__u32__max(r->min_incl, s.min_incl);
+  t.max_excl = wuffs_base__u32__min(r->max_excl, s.max_excl);
+  return t;
+}
+
+static inline wuffs_base__range_ie_u32  //
+wuffs_base__range_ie_u32__unite(const wuffs_base__range_ie_u32* r,
+                                wuffs_base__range_ie_u32 s) {
+  if (wuffs_base__range_ie_u32__is_empty(r)) {
+    return s;
+  }
+  if (wuffs_base__range_ie_u32__is_empty(&s)) {
+    return *r;
+  }
+  wuffs_base__range_ie_u32 t;
+  t.min_incl = wuffs_base__u32__min(r->min_incl, s.min_incl);
+  t.max_excl = wuffs_base__u32__max(r->max_excl, s.max_excl);
+  return t;
+}
+
+static inline bool  //
+wuffs_base__range_ie_u32__contains(const wuffs_base__range_ie_u32* r,
+                                   uint32_t x) {
+  return (r->min_incl <= x) && (x < r->max_excl);
+}
+
+static inline bool  //
+wuffs_base__range_ie_u32__contains_range(const wuffs_base__range_ie_u32* r,
+                                         wuffs_base__range_ie_u32 s) {
+  return wuffs_base__range_ie_u32__equals(
+      &s, wuffs_base__range_ie_u32__intersect(r, s));
+}
+
+static inline uint32_t  //
+wuffs_base__range_ie_u32__length(const wuffs_base__range_ie_u32* r) {
+  return wuffs_base__u32__sat_sub(r->max_excl, r->min_incl);
+}
+
+#ifdef __cplusplus
+
+inline bool  //
+wuffs_base__range_ie_u32::is_empty() const {
+  return wuffs_base__range_ie_u32__is_empty(this);
+}
+
+inline bool  //
+wuffs_base__range_ie_u32::equals(wuffs_base__range_ie_u32 s) const {
+  return wuffs_base__range_ie_u32__equals(this, s);
+}
+
+inline wuffs_base__range_ie_u32  //
+wuffs_base__range_ie_u32::intersect(wuffs_base__range_ie_u32 s) const {
+  return wuffs_base__range_ie_u32__intersect(this, s);
+}
+
+inline wuffs_base__range_ie_u32  //
+wuffs_base__range_ie_u32::unite(wuffs_base__range_ie_u32 s) const {
+  return wuffs_base__range_ie_u32__unite(this, s);
+}
+
+inline bool  //
+wuffs_base__range_ie_u32::contains(uint32_t x) const {
+  return wuffs_base__range_ie_u32__contains(this, x);
+}
+
+inline bool  //
+wuffs_base__range_ie_u32::contains_range(wuffs_base__range_ie_u32 s) const {
+  return wuffs_base__range_ie_u32__contains_range(this, s);
+}
+
+inline uint32_t  //
+wuffs_base__range_ie_u32::length() const {
+  return wuffs_base__range_ie_u32__length(this);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+typedef struct wuffs_base__range_ii_u64__struct {
+  uint64_t min_incl;
+  uint64_t max_incl;
+
+#ifdef __cplusplus
+  inline bool is_empty() const;
+  inline bool equals(wuffs_base__range_ii_u64__struct s) const;
+  inline wuffs_base__range_ii_u64__struct intersect(
+      wuffs_base__range_ii_u64__struct s) const;
+  inline wuffs_base__range_ii_u64__struct unite(
+      wuffs_base__range_ii_u64__struct s) const;
+  inline bool contains(uint64_t x) const;
+  inline bool contains_range(wuffs_base__range_ii_u64__struct s) const;
+#endif  // __cplusplus
+
+} wuffs_base__range_ii_u64;
+
+static inline wuffs_base__range_ii_u64  //
+wuffs_base__empty_range_ii_u64() {
+  wuffs_base__range_ii_u64 ret;
+  ret.min_incl = 0;
+  ret.max_incl = 0;
+  return ret;
+}
+
+static inline wuffs_base__range_ii_u64  //
+wuffs_base__make_range_ii_u64(uint64_t min_incl, uint64_t max_incl) {
+  wuffs_base__range_ii_u64 ret;
+  ret.min_incl = min_incl;
+  ret.max_incl = max_incl;
+  return ret;
+}
+
+static inline bool  //
+wuffs_base__range_ii_u64__is_empty(const wuffs_base__range_ii_u64* r) {
+  return r->min_incl > r->max_incl;
+}
+
+static inline bool  //
+wuffs_base__range_ii_u64__equals(const wuffs_base__range_ii_u64* r,
+                                 wuffs_base__range_ii_u64 s) {
+  return (r->min_incl == s.min_incl && r->max_incl == s.max_incl) ||
+         (wuffs_base__range_ii_u64__is_empty(r) &&
+          wuffs_base__range_ii_u64__is_empty(&s));
+}
+
+static inline wuffs_base__range_ii_u64  //
+wuffs_base__range_ii_u64__intersect(const wuffs_base__range_ii_u64* r,
+                                    wuffs_base__range_ii_u64 s) {
+  wuffs_base__range_ii_u64 t;
+  t.min_incl = wuffs_base__u64__max(r->min_incl, s.min_incl);
+  t.max_incl = wuffs_base__u64__min(r->max_incl, s.max_incl);
+  return t;
+}
+
+static inline wuffs_base__range_ii_u64  //
+wuffs_base__range_ii_u64__unite(const wuffs_base__range_ii_u64* r,
+                                wuffs_base__range_ii_u64 s) {
+  if (wuffs_base__range_ii_u64__is_empty(r)) {
+    return s;
+  }
+  if (wuffs_base__range_ii_u64__is_empty(&s)) {
+    return *r;
+  }
+  wuffs_base__range_ii_u64 t;
+  t.min_incl = wuffs_base__u64__min(r->min_incl, s.min_incl);
+  t.max_incl = wuffs_base__u64__max(r->max_incl, s.max_incl);
+  return t;
+}
+
+static inline bool  //
+wuffs_base__range_ii_u64__contains(const wuffs_base__range_ii_u64* r,
+                                   uint64_t x) {
+  return (r->min_incl <= x) && (x <= r->max_incl);
+}
+
+static inline bool  //
+wuffs_base__range_ii_u64__contains_range(const wuffs_base__range_ii_u64* r,
+                                         wuffs_base__range_ii_u64 s) {
+  return wuffs_base__range_ii_u64__equals(
+      &s, wuffs_base__range_ii_u64__intersect(r, s));
+}
+
+#ifdef __cplusplus
+
+inline bool  //
+wuffs_base__range_ii_u64::is_empty() const {
+  return wuffs_base__range_ii_u64__is_empty(this);
+}
+
+inline bool  //
+wuffs_base__range_ii_u64::equals(wuffs_base__range_ii_u64 s) const {
+  return wuffs_base__range_ii_u64__equals(this, s);
+}
+
+inline wuffs_base__range_ii_u64  //
+wuffs_base__range_ii_u64::intersect(wuffs_base__range_ii_u64 s) const {
+  return wuffs_base__range_ii_u64__intersect(this, s);
+}
+
+inline wuffs_base__range_ii_u64  //
+wuffs_base__range_ii_u64::unite(wuffs_base__range_ii_u64 s) const {
+  return wuffs_base__range_ii_u64__unite(this, s);
+}
+
+inline bool  //
+wuffs_base__range_ii_u64::contains(uint64_t x) const {
+  return wuffs_base__range_ii_u64__contains(this, x);
+}
+
+inline bool  //
+wuffs_base__range_ii_u64::contains_range(wuffs_base__range_ii_u64 s) const {
+  return wuffs_base__range_ii_u64__contains_range(this, s);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+typedef struct wuffs_base__range_ie_u64__struct {
+  uint64_t min_incl;
+  uint64_t max_excl;
+
+#ifdef __cplusplus
+  inline bool is_empty() const;
+  inline bool equals(wuffs_base__range_ie_u64__struct s) const;
+  inline wuffs_base__range_ie_u64__struct intersect(
+      wuffs_base__range_ie_u64__struct s) const;
+  inline wuffs_base__range_ie_u64__struct unite(
+      wuffs_base__range_ie_u64__struct s) const;
+  inline bool contains(uint64_t x) const;
+  inline bool contains_range(wuffs_base__range_ie_u64__struct s) const;
+  inline uint64_t length() const;
+#endif  // __cplusplus
+
+} wuffs_base__range_ie_u64;
+
+static inline wuffs_base__range_ie_u64  //
+wuffs_base__empty_range_ie_u64() {
+  wuffs_base__range_ie_u64 ret;
+  ret.min_incl = 0;
+  ret.max_excl = 0;
+  return ret;
+}
+
+static inline wuffs_base__range_ie_u64  //
+wuffs_base__make_range_ie_u64(uint64_t min_incl, uint64_t max_excl) {
+  wuffs_base__range_ie_u64 ret;
+  ret.min_incl = min_incl;
+  ret.max_excl = max_excl;
+  return ret;
+}
+
+static inline bool  //
+wuffs_base__range_ie_u64__is_empty(const wuffs_base__range_ie_u64* r) {
+  return r->min_incl >= r->max_excl;
+}
+
+static inline bool  //
+wuffs_base__range_ie_u64__equals(const wuffs_base__range_ie_u64* r,
+                                 wuffs_base__range_ie_u64 s) {
+  return (r->min_incl == s.min_incl && r->max_excl == s.max_excl) ||
+         (wuffs_base__range_ie_u64__is_empty(r) &&
+          wuffs_base__range_ie_u64__is_empty(&s));
+}
+
+static inline wuffs_base__range_ie_u64  //
+wuffs_base__range_ie_u64__intersect(const wuffs_base__range_ie_u64* r,
+                                    wuffs_base__range_ie_u64 s) {
+  wuffs_base__range_ie_u64 t;
+  t.min_incl = wuffs_base__u64__max(r->min_incl, s.min_incl);
+  t.max_excl = wuffs_base__u64__min(r->max_excl, s.max_excl);
+  return t;
+}
+
+static inline wuffs_base__range_ie_u64  //
+wuffs_base__range_ie_u64__unite(const wuffs_base__range_ie_u64* r,
+                                wuffs_base__range_ie_u64 s) {
+  if (wuffs_base__range_ie_u64__is_empty(r)) {
+    return s;
+  }
+  if (wuffs_base__range_ie_u64__is_empty(&s)) {
+    return *r;
+  }
+  wuffs_base__range_ie_u64 t;
+  t.min_incl = wuffs_base__u64__min(r->min_incl, s.min_incl);
+  t.max_excl = wuffs_base__u64__max(r->max_excl, s.max_excl);
+  return t;
+}
+
+static inline bool  //
+wuffs_base__range_ie_u64__contains(const wuffs_base__range_ie_u64* r,
+                                   uint64_t x) {
+  return (r->min_incl <= x) && (x < r->max_excl);
+}
+
+static inline bool  //
+wuffs_base__range_ie_u64__contains_range(const wuffs_base__range_ie_u64* r,
+                                         wuffs_base__range_ie_u64 s) {
+  return wuffs_base__range_ie_u64__equals(
+      &s, wuffs_base__range_ie_u64__intersect(r, s));
+}
+
+static inline uint64_t  //
+wuffs_base__range_ie_u64__length(const wuffs_base__range_ie_u64* r) {
+  return wuffs_base__u64__sat_sub(r->max_excl, r->min_incl);
+}
+
+#ifdef __cplusplus
+
+inline bool  //
+wuffs_base__range_ie_u64::is_empty() const {
+  return wuffs_base__range_ie_u64__is_empty(this);
+}
+
+inline bool  //
+wuffs_base__range_ie_u64::equals(wuffs_base__range_ie_u64 s) const {
+  return wuffs_base__range_ie_u64__equals(this, s);
+}
+
+inline wuffs_base__range_ie_u64  //
+wuffs_base__range_ie_u64::intersect(wuffs_base__range_ie_u64 s) const {
+  return wuffs_base__range_ie_u64__intersect(this, s);
+}
+
+inline wuffs_base__range_ie_u64  //
+wuffs_base__range_ie_u64::unite(wuffs_base__range_ie_u64 s) const {
+  return wuffs_base__range_ie_u64__unite(this, s);
+}
+
+inline bool  //
+wuffs_base__range_ie_u64::contains(uint64_t x) const {
+  return wuffs_base__range_ie_u64__contains(this, x);
+}
+
+inline bool  //
+wuffs_base__range_ie_u64::contains_range(wuffs_base__range_ie_u64 s) const {
+  return wuffs_base__range_ie_u64__contains_range(this, s);
+}
+
+inline uint64_t  //
+wuffs_base__range_ie_u64::length() const {
+  return wuffs_base__range_ie_u64__length(this);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+typedef struct wuffs_base__rect_ii_u32__struct {
+  uint32_t min_incl_x;
+  uint32_t min_incl_y;
+  uint32_t max_incl_x;
+  uint32_t max_incl_y;
+
+#ifdef __cplusplus
+  inline bool is_empty() const;
+  inline bool equals(wuffs_base__rect_ii_u32__struct s) const;
+  inline wuffs_base__rect_ii_u32__struct intersect(
+      wuffs_base__rect_ii_u32__struct s) const;
+  inline wuffs_base__rect_ii_u32__struct unite(
+      wuffs_base__rect_ii_u32__struct s) const;
+  inline bool contains(uint32_t x, uint32_t y) const;
+  inline bool contains_rect(wuffs_base__rect_ii_u32__struct s) const;
+#endif  // __cplusplus
+
+} wuffs_base__rect_ii_u32;
+
+static inline wuffs_base__rect_ii_u32  //
+wuffs_base__empty_rect_ii_u32() {
+  wuffs_base__rect_ii_u32 ret;
+  ret.min_incl_x = 0;
+  ret.min_incl_y = 0;
+  ret.max_incl_x = 0;
+  ret.max_incl_y = 0;
+  return ret;
+}
+
+static inline wuffs_base__rect_ii_u32  //
+wuffs_base__make_rect_ii_u32(uint32_t min_incl_x,
+                             uint32_t min_incl_y,
+                             uint32_t max_incl_x,
+                             uint32_t max_incl_y) {
+  wuffs_base__rect_ii_u32 ret;
+  ret.min_incl_x = min_incl_x;
+  ret.min_incl_y = min_incl_y;
+  ret.max_incl_x = max_incl_x;
+  ret.max_incl_y = max_incl_y;
+  return ret;
+}
+
+static inline bool  //
+wuffs_base__rect_ii_u32__is_empty(const wuffs_base__rect_ii_u32* r) {
+  return (r->min_incl_x > r->max_incl_x) || (r->min_incl_y > r->max_incl_y);
+}
+
+static inline bool  //
+wuffs_base__rect_ii_u32__equals(const wuffs_base__rect_ii_u32* r,
+                                wuffs_base__rect_ii_u32 s) {
+  return (r->min_incl_x == s.min_incl_x && r->min_incl_y == s.min_incl_y &&
+          r->max_incl_x == s.max_incl_x && r->max_incl_y == s.max_incl_y) ||
+         (wuffs_base__rect_ii_u32__is_empty(r) &&
+          wuffs_base__rect_ii_u32__is_empty(&s));
+}
+
+static inline wuffs_base__rect_ii_u32  //
+wuffs_base__rect_ii_u32__intersect(const wuffs_base__rect_ii_u32* r,
+                                   wuffs_base__rect_ii_u32 s) {
+  wuffs_base__rect_ii_u32 t;
+  t.min_incl_x = wuffs_base__u32__max(r->min_incl_x, s.min_incl_x);
+  t.min_incl_y = wuffs_base__u32__max(r->min_incl_y, s.min_incl_y);
+  t.max_incl_x = wuffs_base__u32__min(r->max_incl_x, s.max_incl_x);
+  t.max_incl_y = wuffs_base__u32__min(r->max_incl_y, s.max_incl_y);
+  return t;
+}
+
+static inline wuffs_base__rect_ii_u32  //
+wuffs_base__rect_ii_u32__unite(const wuffs_base__rect_ii_u32* r,
+                               wuffs_base__rect_ii_u32 s) {
+  if (wuffs_base__rect_ii_u32__is_empty(r)) {
+    return s;
+  }
+  if (wuffs_base__rect_ii_u32__is_empty(&s)) {
+    return *r;
+  }
+  wuffs_base__rect_ii_u32 t;
+  t.min_incl_x = wuffs_base__u32__min(r->min_incl_x, s.min_incl_x);
+  t.min_incl_y = wuffs_base__u32__min(r->min_incl_y, s.min_incl_y);
+  t.max_incl_x = wuffs_base__u32__max(r->max_incl_x, s.max_incl_x);
+  t.max_incl_y = wuffs_base__u32__max(r->max_incl_y, s.max_incl_y);
+  return t;
+}
+
+static inline bool  //
+wuffs_base__rect_ii_u32__contains(const wuffs_base__rect_ii_u32* r,
+                                  uint32_t x,
+                                  uint32_t y) {
+  return (r->min_incl_x <= x) && (x <= r->max_incl_x) && (r->min_incl_y <= y) &&
+         (y <= r->max_incl_y);
+}
+
+static inline bool  //
+wuffs_base__rect_ii_u32__contains_rect(const wuffs_base__rect_ii_u32* r,
+                                       wuffs_base__rect_ii_u32 s) {
+  return wuffs_base__rect_ii_u32__equals(
+      &s, wuffs_base__rect_ii_u32__intersect(r, s));
+}
+
+#ifdef __cplusplus
+
+inline bool  //
+wuffs_base__rect_ii_u32::is_empty() const {
+  return wuffs_base__rect_ii_u32__is_empty(this);
+}
+
+inline bool  //
+wuffs_base__rect_ii_u32::equals(wuffs_base__rect_ii_u32 s) const {
+  return wuffs_base__rect_ii_u32__equals(this, s);
+}
+
+inline wuffs_base__rect_ii_u32  //
+wuffs_base__rect_ii_u32::intersect(wuffs_base__rect_ii_u32 s) const {
+  return wuffs_base__rect_ii_u32__intersect(this, s);
+}
+
+inline wuffs_base__rect_ii_u32  //
+wuffs_base__rect_ii_u32::unite(wuffs_base__rect_ii_u32 s) const {
+  return wuffs_base__rect_ii_u32__unite(this, s);
+}
+
+inline bool  //
+wuffs_base__rect_ii_u32::contains(uint32_t x, uint32_t y) const {
+  return wuffs_base__rect_ii_u32__contains(this, x, y);
+}
+
+inline bool  //
+wuffs_base__rect_ii_u32::contains_rect(wuffs_base__rect_ii_u32 s) const {
+  return wuffs_base__rect_ii_u32__contains_rect(this, s);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+typedef struct wuffs_base__rect_ie_u32__struct {
+  uint32_t min_incl_x;
+  uint32_t min_incl_y;
+  uint32_t max_excl_x;
+  uint32_t max_excl_y;
+
+#ifdef __cplusplus
+  inline bool is_empty() const;
+  inline bool equals(wuffs_base__rect_ie_u32__struct s) const;
+  inline wuffs_base__rect_ie_u32__struct intersect(
+      wuffs_base__rect_ie_u32__struct s) const;
+  inline wuffs_base__rect_ie_u32__struct unite(
+      wuffs_base__rect_ie_u32__struct s) const;
+  inline bool contains(uint32_t x, uint32_t y) const;
+  inline bool contains_rect(wuffs_base__rect_ie_u32__struct s) const;
+  inline uint32_t width() const;
+  inline uint32_t height() const;
+#endif  // __cplusplus
+
+} wuffs_base__rect_ie_u32;
+
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__empty_rect_ie_u32() {
+  wuffs_base__rect_ie_u32 ret;
+  ret.min_incl_x = 0;
+  ret.min_incl_y = 0;
+  ret.max_excl_x = 0;
+  ret.max_excl_y = 0;
+  return ret;
+}
+
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__make_rect_ie_u32(uint32_t min_incl_x,
+                             uint32_t min_incl_y,
+                             uint32_t max_excl_x,
+                             uint32_t max_excl_y) {
+  wuffs_base__rect_ie_u32 ret;
+  ret.min_incl_x = min_incl_x;
+  ret.min_incl_y = min_incl_y;
+  ret.max_excl_x = max_excl_x;
+  ret.max_excl_y = max_excl_y;
+  return ret;
+}
+
+static inline bool  //
+wuffs_base__rect_ie_u32__is_empty(const wuffs_base__rect_ie_u32* r) {
+  return (r->min_incl_x >= r->max_excl_x) || (r->min_incl_y >= r->max_excl_y);
+}
+
+static inline bool  //
+wuffs_base__rect_ie_u32__equals(const wuffs_base__rect_ie_u32* r,
+                                wuffs_base__rect_ie_u32 s) {
+  return (r->min_incl_x == s.min_incl_x && r->min_incl_y == s.min_incl_y &&
+          r->max_excl_x == s.max_excl_x && r->max_excl_y == s.max_excl_y) ||
+         (wuffs_base__rect_ie_u32__is_empty(r) &&
+          wuffs_base__rect_ie_u32__is_empty(&s));
+}
+
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__rect_ie_u32__intersect(const wuffs_base__rect_ie_u32* r,
+                                   wuffs_base__rect_ie_u32 s) {
+  wuffs_base__rect_ie_u32 t;
+  t.min_incl_x = wuffs_base__u32__max(r->min_incl_x, s.min_incl_x);
+  t.min_incl_y = wuffs_base__u32__max(r->min_incl_y, s.min_incl_y);
+  t.max_excl_x = wuffs_base__u32__min(r->max_excl_x, s.max_excl_x);
+  t.max_excl_y = wuffs_base__u32__min(r->max_excl_y, s.max_excl_y);
+  return t;
+}
+
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__rect_ie_u32__unite(const wuffs_base__rect_ie_u32* r,
+                               wuffs_base__rect_ie_u32 s) {
+  if (wuffs_base__rect_ie_u32__is_empty(r)) {
+    return s;
+  }
+  if (wuffs_base__rect_ie_u32__is_empty(&s)) {
+    return *r;
+  }
+  wuffs_base__rect_ie_u32 t;
+  t.min_incl_x = wuffs_base__u32__min(r->min_incl_x, s.min_incl_x);
+  t.min_incl_y = wuffs_base__u32__min(r->min_incl_y, s.min_incl_y);
+  t.max_excl_x = wuffs_base__u32__max(r->max_excl_x, s.max_excl_x);
+  t.max_excl_y = wuffs_base__u32__max(r->max_excl_y, s.max_excl_y);
+  return t;
+}
+
+static inline bool  //
+wuffs_base__rect_ie_u32__contains(const wuffs_base__rect_ie_u32* r,
+                                  uint32_t x,
+                                  uint32_t y) {
+  return (r->min_incl_x <= x) && (x < r->max_excl_x) && (r->min_incl_y <= y) &&
+         (y < r->max_excl_y);
+}
+
+static inline bool  //
+wuffs_base__rect_ie_u32__contains_rect(const wuffs_base__rect_ie_u32* r,
+                                       wuffs_base__rect_ie_u32 s) {
+  return wuffs_base__rect_ie_u32__equals(
+      &s, wuffs_base__rect_ie_u32__intersect(r, s));
+}
+
+static inline uint32_t  //
+wuffs_base__rect_ie_u32__width(const wuffs_base__rect_ie_u32* r) {
+  return wuffs_base__u32__sat_sub(r->max_excl_x, r->min_incl_x);
+}
+
+static inline uint32_t  //
+wuffs_base__rect_ie_u32__height(const wuffs_base__rect_ie_u32* r) {
+  return wuffs_base__u32__sat_sub(r->max_excl_y, r->min_incl_y);
+}
+
+#ifdef __cplusplus
+
+inline bool  //
+wuffs_base__rect_ie_u32::is_empty() const {
+  return wuffs_base__rect_ie_u32__is_empty(this);
+}
+
+inline bool  //
+wuffs_base__rect_ie_u32::equals(wuffs_base__rect_ie_u32 s) const {
+  return wuffs_base__rect_ie_u32__equals(this, s);
+}
+
+inline wuffs_base__rect_ie_u32  //
+wuffs_base__rect_ie_u32::intersect(wuffs_base__rect_ie_u32 s) const {
+  return wuffs_base__rect_ie_u32__intersect(this, s);
+}
+
+inline wuffs_base__rect_ie_u32  //
+wuffs_base__rect_ie_u32::unite(wuffs_base__rect_ie_u32 s) const {
+  return wuffs_base__rect_ie_u32__unite(this, s);
+}
+
+inline bool  //
+wuffs_base__rect_ie_u32::contains(uint32_t x, uint32_t y) const {
+  return wuffs_base__rect_ie_u32__contains(this, x, y);
+}
+
+inline bool  //
+wuffs_base__rect_ie_u32::contains_rect(wuffs_base__rect_ie_u32 s) const {
+  return wuffs_base__rect_ie_u32__contains_rect(this, s);
+}
+
+inline uint32_t  //
+wuffs_base__rect_ie_u32::width() const {
+  return wuffs_base__rect_ie_u32__width(this);
+}
+
+inline uint32_t  //
+wuffs_base__rect_ie_u32::height() const {
+  return wuffs_base__rect_ie_u32__height(this);
+}
+
+#endif  // __cplusplus
+
+// ---------------- More Information
+
+// wuffs_base__more_information holds additional fields, typically when a Wuffs
+// method returns a [note status](/doc/note/statuses.md).
+//
+// The flavor field follows the base38 namespace
+// convention](/doc/note/base38-and-fourcc.md). The other fields' semantics
+// depends on the flavor.
+typedef struct {
+  uint32_t flavor;
+  uint32_t w;
+  uint64_t x;
+  uint64_t y;
+  uint64_t z;
+
+#ifdef __cplusplus
+  inline void set(uint32_t flavor_arg,
+                  uint32_t w_arg,
+                  uint64_t x_arg,
+                  uint64_t y_arg,
+                  uint64_t z_arg);
+  inline uint32_t io_redirect__fourcc() const;
+  inline wuffs_base__range_ie_u64 io_redirect__range() const;
+  inline uint64_t io_seek__position() const;
+  inline uint32_t metadata__fourcc() const;
+  inline wuffs_base__range_ie_u64 metadata__range() const;
+#endif  // __cplusplus
+
+} wuffs_base__more_information;
+
+#define WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_REDIRECT 1
+#define WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_SEEK 2
+#define WUFFS_BASE__MORE_INFORMATION__FLAVOR__METADATA 3
+
+static inline wuffs_base__more_information  //
+wuffs_base__empty_more_information() {
+  wuffs_base__more_information ret;
+  ret.flavor = 0;
+  ret.w = 0;
+  ret.x = 0;
+  ret.y = 0;
+  ret.z = 0;
+  return ret;
+}
+
+static inline void  //
+wuffs_base__more_information__set(wuffs_base__more_information* m,
+                                  uint32_t flavor,
+                                  uint32_t w,
+                                  uint64_t x,
+                                  uint64_t y,
+                                  uint64_t z) {
+  if (!m) {
+    return;
+  }
+  m->flavor = flavor;
+  m->w = w;
+  m->x = x;
+  m->y = y;
+  m->z = z;
+}
+
+static inline uint32_t  //
+wuffs_base__more_information__io_redirect__fourcc(
+    const wuffs_base__more_information* m) {
+  return m->w;
+}
+
+static inline wuffs_base__range_ie_u64  //
+wuffs_base__more_information__io_redirect__range(
+    const wuffs_base__more_information* m) {
+  wuffs_base__range_ie_u64 ret;
+  ret.min_incl = m->y;
+  ret.max_excl = m->z;
+  return ret;
+}
+
+static inline uint64_t  //
+wuffs_base__more_information__io_seek__position(
+    const wuffs_base__more_information* m) {
+  return m->x;
+}
+
+static inline uint32_t  //
+wuffs_base__more_information__metadata__fourcc(
+    const wuffs_base__more_information* m) {
+  return m->w;
+}
+
+static inline wuffs_base__range_ie_u64  //
+wuffs_base__more_information__metadata__range(
+    const wuffs_base__more_information* m) {
+  wuffs_base__range_ie_u64 ret;
+  ret.min_incl = m->y;
+  ret.max_excl = m->z;
+  return ret;
+}
+
+#ifdef __cplusplus
+
+inline void  //
+wuffs_base__more_information::set(uint32_t flavor_arg,
+                                  uint32_t w_arg,
+                                  uint64_t x_arg,
+                                  uint64_t y_arg,
+                                  uint64_t z_arg) {
+  wuffs_base__more_information__set(this, flavor_arg, w_arg, x_arg, y_arg,
+                                    z_arg);
+}
+
+inline uint32_t  //
+wuffs_base__more_information::io_redirect__fourcc() const {
+  return wuffs_base__more_information__io_redirect__fourcc(this);
+}
+
+inline wuffs_base__range_ie_u64  //
+wuffs_base__more_information::io_redirect__range() const {
+  return wuffs_base__more_information__io_redirect__range(this);
+}
+
+inline uint64_t  //
+wuffs_base__more_information::io_seek__position() const {
+  return wuffs_base__more_information__io_seek__position(this);
+}
+
+inline uint32_t  //
+wuffs_base__more_information::metadata__fourcc() const {
+  return wuffs_base__more_information__metadata__fourcc(this);
+}
+
+inline wuffs_base__range_ie_u64  //
+wuffs_base__more_information::metadata__range() const {
+  return wuffs_base__more_information__metadata__range(this);
+}
+
+#endif  // __cplusplus
+
+// ---------------- I/O
+//
+// See (/doc/note/io-input-output.md).
+
+// wuffs_base__io_buffer_meta is the metadata for a wuffs_base__io_buffer's
+// data.
+typedef struct {
+  size_t wi;     // Write index. Invariant: wi <= len.
+  size_t ri;     // Read  index. Invariant: ri <= wi.
+  uint64_t pos;  // Position of the buffer start relative to the stream start.
+  bool closed;   // No further writes are expected.
+} wuffs_base__io_buffer_meta;
+
+// wuffs_base__io_buffer is a 1-dimensional buffer (a pointer and length) plus
+// additional metadata.
+//
+// A value with all fields zero is a valid, empty buffer.
+typedef struct {
+  wuffs_base__slice_u8 data;
+  wuffs_base__io_buffer_meta meta;
+
+#ifdef __cplusplus
+  inline bool is_valid() const;
+  inline void compact();
+  inline uint64_t reader_available() const;
+  inline uint64_t reader_io_position() const;
+  inline uint64_t writer_available() const;
+  inline uint64_t writer_io_position() const;
+#endif  // __cplusplus
+
+} wuffs_base__io_buffer;
+
+static inline wuffs_base__io_buffer  //
+wuffs_base__make_io_buffer(wuffs_base__slice_u8 data,
+                           wuffs_base__io_buffer_meta meta) {
+  wuffs_base__io_buffer ret;
+  ret.data = data;
+  ret.meta = meta;
+  return ret;
+}
+
+static inline wuffs_base__io_buffer_meta  //
+wuffs_base__make_io_buffer_meta(size_t wi,
+                                size_t ri,
+                                uint64_t pos,
+                                bool closed) {
+  wuffs_base__io_buffer_meta ret;
+  ret.wi = wi;
+  ret.ri = ri;
+  ret.pos = pos;
+  ret.closed = closed;
+  return ret;
+}
+
+static inline wuffs_base__io_buffer  //
+wuffs_base__ptr_u8__reader(uint8_t* ptr, size_t len, bool closed) {
+  wuffs_base__io_buffer ret;
+  ret.data.ptr = ptr;
+  ret.data.len = len;
+  ret.meta.wi = len;
+  ret.meta.ri = 0;
+  ret.meta.pos = 0;
+  ret.meta.closed = closed;
+  return ret;
+}
+
+static inline wuffs_base__io_buffer  //
+wuffs_base__ptr_u8__writer(uint8_t* ptr, size_t len) {
+  wuffs_base__io_buffer ret;
+  ret.data.ptr = ptr;
+  ret.data.len = len;
+  ret.meta.wi = 0;
+  ret.meta.ri = 0;
+  ret.meta.pos = 0;
+  ret.meta.closed = false;
+  return ret;
+}
+
+static inline wuffs_base__io_buffer  //
+wuffs_base__slice_u8__reader(wuffs_base__slice_u8 s, bool closed) {
+  wuffs_base__io_buffer ret;
+  ret.data.ptr = s.ptr;
+  ret.data.len = s.len;
+  ret.meta.wi = s.len;
+  ret.meta.ri = 0;
+  ret.meta.pos = 0;
+  ret.meta.closed = closed;
+  return ret;
+}
+
+static inline wuffs_base__io_buffer  //
+wuffs_base__slice_u8__writer(wuffs_base__slice_u8 s) {
+  wuffs_base__io_buffer ret;
+  ret.data.ptr = s.ptr;
+  ret.data.len = s.len;
+  ret.meta.wi = 0;
+  ret.meta.ri = 0;
+  ret.meta.pos = 0;
+  ret.meta.closed = false;
+  return ret;
+}
+
+static inline wuffs_base__io_buffer  //
+wuffs_base__empty_io_buffer() {
+  wuffs_base__io_buffer ret;
+  ret.data.ptr = NULL;
+  ret.data.len = 0;
+  ret.meta.wi = 0;
+  ret.meta.ri = 0;
+  ret.meta.pos = 0;
+  ret.meta.closed = false;
+  return ret;
+}
+
+static inline wuffs_base__io_buffer_meta  //
+wuffs_base__empty_io_buffer_meta() {
+  wuffs_base__io_buffer_meta ret;
+  ret.wi = 0;
+  ret.ri = 0;
+  ret.pos = 0;
+  ret.closed = false;
+  return ret;
+}
+
+static inline bool  //
+wuffs_base__io_buffer__is_valid(const wuffs_base__io_buffer* buf) {
+  if (buf) {
+    if (buf->data.ptr) {
+      return (buf->meta.ri <= buf->meta.wi) && (buf->meta.wi <= buf->data.len);
+    } else {
+      return (buf->meta.ri == 0) && (buf->meta.wi == 0) && (buf->data.len == 0);
+    }
+  }
+  return false;
+}
+
+// wuffs_base__io_buffer__compact moves any written but unread bytes to the
+// start of the buffer.
+static inline void  //
+wuffs_base__io_buffer__compact(wuffs_base__io_buffer* buf) {
+  if (!buf || (buf->meta.ri == 0)) {
+    return;
+  }
+  buf->meta.pos = wuffs_base__u64__sat_add(buf->meta.pos, buf->meta.ri);
+  size_t n = buf->meta.wi - buf->meta.ri;
+  if (n != 0) {
+    memmove(buf->data.ptr, buf->data.ptr + buf->meta.ri, n);
+  }
+  buf->meta.wi = n;
+  buf->meta.ri = 0;
+}
+
+static inline uint64_t  //
+wuffs_base__io_buffer__reader_available(const wuffs_base__io_buffer* buf) {
+  return buf ? buf->meta.wi - buf->meta.ri : 0;
+}
+
+static inline uint64_t  //
+wuffs_base__io_buffer__reader_io_position(const wuffs_base__io_buffer* buf) {
+  return buf ? wuffs_base__u64__sat_add(buf->meta.pos, buf->meta.ri) : 0;
+}
+
+static inline uint64_t  //
+wuffs_base__io_buffer__writer_available(const wuffs_base__io_buffer* buf) {
+  return buf ? buf->data.len - buf->meta.wi : 0;
+}
+
+static inline uint64_t  //
+wuffs_base__io_buffer__writer_io_position(const wuffs_base__io_buffer* buf) {
+  return buf ? wuffs_base__u64__sat_add(buf->meta.pos, buf->meta.wi) : 0;
+}
+
+#ifdef __cplusplus
+
+inline bool  //
+wuffs_base__io_buffer::is_valid() const {
+  return wuffs_base__io_buffer__is_valid(this);
+}
+
+inline void  //
+wuffs_base__io_buffer::compact() {
+  wuffs_base__io_buffer__compact(this);
+}
+
+inline uint64_t  //
+wuffs_base__io_buffer::reader_available() const {
+  return wuffs_base__io_buffer__reader_available(this);
+}
+
+inline uint64_t  //
+wuffs_base__io_buffer::reader_io_position() const {
+  return wuffs_base__io_buffer__reader_io_position(this);
+}
+
+inline uint64_t  //
+wuffs_base__io_buffer::writer_available() const {
+  return wuffs_base__io_buffer__writer_available(this);
+}
+
+inline uint64_t  //
+wuffs_base__io_buffer::writer_io_position() const {
+  return wuffs_base__io_buffer__writer_io_position(this);
+}
+
+#endif  // __cplusplus
+
+// ---------------- Tokens
+
+// wuffs_base__token is an element of a byte stream's tokenization.
+//
+// See https://github.com/google/wuffs/blob/master/doc/note/tokens.md
+typedef struct {
+  uint64_t repr;
+
+#ifdef __cplusplus
+  inline int64_t value() const;
+  inline int64_t value_extension() const;
+  inline int64_t value_major() const;
+  inline int64_t value_base_category() const;
+  inline uint64_t value_minor() const;
+  inline uint64_t value_base_detail() const;
+  inline bool continued() const;
+  inline uint64_t length() const;
+#endif  // __cplusplus
+
+} wuffs_base__token;
+
+static inline wuffs_base__token  //
+wuffs_base__make_token(uint64_t repr) {
+  wuffs_base__token ret;
+  ret.repr = repr;
+  return ret;
+}
+
+  // --------
+
+#define WUFFS_BASE__TOKEN__LENGTH__MAX_INCL 0xFFFF
+
+#define WUFFS_BASE__TOKEN__VALUE__SHIFT 17
+#define WUFFS_BASE__TOKEN__VALUE_EXTENSION__SHIFT 17
+#define WUFFS_BASE__TOKEN__VALUE_MAJOR__SHIFT 42
+#define WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT 17
+#define WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT 38
+#define WUFFS_BASE__TOKEN__VALUE_BASE_DETAIL__SHIFT 17
+#define WUFFS_BASE__TOKEN__CONTINUED__SHIFT 16
+#define WUFFS_BASE__TOKEN__LENGTH__SHIFT 0
+
+  // --------
+
+#define WUFFS_BASE__TOKEN__VBC__FILLER 0
+#define WUFFS_BASE__TOKEN__VBC__STRUCTURE 1
+#define WUFFS_BASE__TOKEN__VBC__STRING 2
+#define WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT 3
+#define WUFFS_BASE__TOKEN__VBC__LITERAL 4
+#define WUFFS_BASE__TOKEN__VBC__NUMBER 5
+
+  // --------
+
+#define WUFFS_BASE__TOKEN__VBD__FILLER__COMMENT_LINE 0x00001
+#define WUFFS_BASE__TOKEN__VBD__FILLER__COMMENT_BLOCK 0x00002
+
+  // --------
+
+#define WUFFS_BASE__TOKEN__VBD__STRUCTURE__PUSH 0x00001
+#define WUFFS_BASE__TOKEN__VBD__STRUCTURE__POP 0x00002
+#define WUFFS_BASE__TOKEN__VBD__STRUCTURE__FROM_NONE 0x00010
+#define WUFFS_BASE__TOKEN__VBD__STRUCTURE__FROM_LIST 0x00020
+#define WUFFS_BASE__TOKEN__VBD__STRUCTURE__FROM_DICT 0x00040
+#define WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_NONE 0x01000
+#define WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_LIST 0x02000
+#define WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_DICT 0x04000
+
+// --------
+
+// "DEFINITELY_FOO" means that the destination bytes (and also the source
+// bytes, for 1_DST_1_SRC_COPY) are in the FOO format. Definitely means that
+// the lack of the bit is conservative: it is valid for all-ASCII strings to
+// have neither DEFINITELY_UTF_8 or DEFINITELY_ASCII bits set.
+#define WUFFS_BASE__TOKEN__VBD__STRING__DEFINITELY_UTF_8 0x00001
+#define WUFFS_BASE__TOKEN__VBD__STRING__DEFINITELY_ASCII 0x00002
+
+// "CONVERT_D_DST_S_SRC" means that multiples of S source bytes (possibly
+// padded) produces multiples of D destination bytes. For example,
+// CONVERT_1_DST_4_SRC_BACKSLASH_X means a source like "\\x23\\x67\\xAB", where
+// 12 src bytes encode 3 dst bytes.
+//
+// Post-processing may further transform those D destination bytes (e.g. treat
+// "\\xFF" as the Unicode code point U+00FF instead of the byte 0xFF), but that
+// is out of scope of this VBD's semantics.
+//
+// When src is the empty string, multiple conversion algorithms are applicable
+// (so these bits are not necessarily mutually exclusive), all producing the
+// same empty dst string.
+#define WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_0_DST_1_SRC_DROP 0x00010
+#define WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY 0x00020
+#define WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_2_SRC_HEXADECIMAL 0x00040
+#define WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_4_SRC_BACKSLASH_X 0x00080
+#define WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_3_DST_4_SRC_BASE_64_STD 0x00100
+#define WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_3_DST_4_SRC_BASE_64_URL 0x00200
+#define WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_4_DST_5_SRC_ASCII_85 0x00400
+
+  // --------
+
+#define WUFFS_BASE__TOKEN__VBD__LITERAL__UNDEFINED 0x00001
+#define WUFFS_BASE__TOKEN__VBD__LITERAL__NULL 0x00002
+#define WUFFS_BASE__TOKEN__VBD__LITERAL__FALSE 0x00004
+#define WUFFS_BASE__TOKEN__VBD__LITERAL__TRUE 0x00008
+
+  // --------
+
+// For a source string of "123" or "0x9A", it is valid for a tokenizer to
+// return any one of:
+//  - WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_FLOATING_POINT.
+//  - WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_INTEGER_SIGNED.
+//  - WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_INTEGER_UNSIGNED.
+//
+// For a source string of "+123" or "-0x9A", only the first two are valid.
+//
+// For a source string of "123.", only the first one is valid.
+#define WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_FLOATING_POINT 0x00001
+#define WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_INTEGER_SIGNED 0x00002
+#define WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_INTEGER_UNSIGNED 0x00004
+
+#define WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_NEG_INF 0x00010
+#define WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_POS_INF 0x00020
+#define WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_NEG_NAN 0x00040
+#define WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_POS_NAN 0x00080
+
+// The number 300 might be represented as "\x01\x2C", "\x2C\x01\x00\x00" or
+// "300", which are big-endian, little-endian or text. For binary formats, the
+// token length discriminates e.g. u16 little-endian vs u32 little-endian.
+#define WUFFS_BASE__TOKEN__VBD__NUMBER__FORMAT_BINARY_BIG_ENDIAN 0x00100
+#define WUFFS_BASE__TOKEN__VBD__NUMBER__FORMAT_BINARY_LITTLE_ENDIAN 0x00200
+#define WUFFS_BASE__TOKEN__VBD__NUMBER__FORMAT_TEXT 0x00400
+
+// --------
+
+// wuffs_base__token__value returns the token's high 46 bits, sign-extended. A
+// negative value means an extended token, non-negative means a simple token.
+static inline int64_t  //
+wuffs_base__token__value(const wuffs_base__token* t) {
+  return ((int64_t)(t->repr)) >> WUFFS_BASE__TOKEN__VALUE__SHIFT;
+}
+
+// wuffs_base__token__value_extension returns a negative value if the token was
+// not an extended token.
+static inline int64_t  //
+wuffs_base__token__value_extension(const wuffs_base__token* t) {
+  return (~(int64_t)(t->repr)) >> WUFFS_BASE__TOKEN__VALUE_EXTENSION__SHIFT;
+}
+
+// wuffs_base__token__value_major returns a negative value if the token was not
+// a simple token.
+static inline int64_t  //
+wuffs_base__token__value_major(const wuffs_base__token* t) {
+  return ((int64_t)(t->repr)) >> WUFFS_BASE__TOKEN__VALUE_MAJOR__SHIFT;
+}
+
+// wuffs_base__token__value_base_category returns a negative value if the token
+// was not a simple token.
+static inline int64_t  //
+wuffs_base__token__value_base_category(const wuffs_base__token* t) {
+  return ((int64_t)(t->repr)) >> WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT;
+}
+
+static inline uint64_t  //
+wuffs_base__token__value_minor(const wuffs_base__token* t) {
+  return (t->repr >> WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) & 0x1FFFFFF;
+}
+
+static inline uint64_t  //
+wuffs_base__token__value_base_detail(const wuffs_base__token* t) {
+  return (t->repr >> WUFFS_BASE__TOKEN__VALUE_BASE_DETAIL__SHIFT) & 0x1FFFFF;
+}
+
+static inline bool  //
+wuffs_base__token__continued(const wuffs_base__token* t) {
+  return t->repr & 0x10000;
+}
+
+static inline uint64_t  //
+wuffs_base__token__length(const wuffs_base__token* t) {
+  return (t->repr >> WUFFS_BASE__TOKEN__LENGTH__SHIFT) & 0xFFFF;
+}
+
+#ifdef __cplusplus
+
+inline int64_t  //
+wuffs_base__token::value() const {
+  return wuffs_base__token__value(this);
+}
+
+inline int64_t  //
+wuffs_base__token::value_extension() const {
+  return wuffs_base__token__value_extension(this);
+}
+
+inline int64_t  //
+wuffs_base__token::value_major() const {
+  return wuffs_base__token__value_major(this);
+}
+
+inline int64_t  //
+wuffs_base__token::value_base_category() const {
+  return wuffs_base__token__value_base_category(this);
+}
+
+inline uint64_t  //
+wuffs_base__token::value_minor() const {
+  return wuffs_base__token__value_minor(this);
+}
+
+inline uint64_t  //
+wuffs_base__token::value_base_detail() const {
+  return wuffs_base__token__value_base_detail(this);
+}
+
+inline bool  //
+wuffs_base__token::continued() const {
+  return wuffs_base__token__continued(this);
+}
+
+inline uint64_t  //
+wuffs_base__token::length() const {
+  return wuffs_base__token__length(this);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+typedef WUFFS_BASE__SLICE(wuffs_base__token) wuffs_base__slice_token;
+
+static inline wuffs_base__slice_token  //
+wuffs_base__make_slice_token(wuffs_base__token* ptr, size_t len) {
+  wuffs_base__slice_token ret;
+  ret.ptr = ptr;
+  ret.len = len;
+  return ret;
+}
+
+// --------
+
+// wuffs_base__token_buffer_meta is the metadata for a
+// wuffs_base__token_buffer's data.
+typedef struct {
+  size_t wi;     // Write index. Invariant: wi <= len.
+  size_t ri;     // Read  index. Invariant: ri <= wi.
+  uint64_t pos;  // Position of the buffer start relative to the stream start.
+  bool closed;   // No further writes are expected.
+} wuffs_base__token_buffer_meta;
+
+// wuffs_base__token_buffer is a 1-dimensional buffer (a pointer and length)
+// plus additional metadata.
+//
+// A value with all fields zero is a valid, empty buffer.
+typedef struct {
+  wuffs_base__slice_token data;
+  wuffs_base__token_buffer_meta meta;
+
+#ifdef __cplusplus
+  inline bool is_valid() const;
+  inline void compact();
+  inline uint64_t reader_available() const;
+  inline uint64_t reader_category_run() const;
+  inline uint64_t reader_copy_run() const;
+  inline uint64_t reader_token_position() const;
+  inline uint64_t writer_available() const;
+  inline uint64_t writer_token_position() const;
+#endif  // __cplusplus
+
+} wuffs_base__token_buffer;
+
+static inline wuffs_base__token_buffer  //
+wuffs_base__make_token_buffer(wuffs_base__slice_token data,
+                              wuffs_base__token_buffer_meta meta) {
+  wuffs_base__token_buffer ret;
+  ret.data = data;
+  ret.meta = meta;
+  return ret;
+}
+
+static inline wuffs_base__token_buffer_meta  //
+wuffs_base__make_token_buffer_meta(size_t wi,
+                                   size_t ri,
+                                   uint64_t pos,
+                                   bool closed) {
+  wuffs_base__token_buffer_meta ret;
+  ret.wi = wi;
+  ret.ri = ri;
+  ret.pos = pos;
+  ret.closed = closed;
+  return ret;
+}
+
+static inline wuffs_base__token_buffer  //
+wuffs_base__slice_token__reader(wuffs_base__slice_token s, bool closed) {
+  wuffs_base__token_buffer ret;
+  ret.data.ptr = s.ptr;
+  ret.data.len = s.len;
+  ret.meta.wi = s.len;
+  ret.meta.ri = 0;
+  ret.meta.pos = 0;
+  ret.meta.closed = closed;
+  return ret;
+}
+
+static inline wuffs_base__token_buffer  //
+wuffs_base__slice_token__writer(wuffs_base__slice_token s) {
+  wuffs_base__token_buffer ret;
+  ret.data.ptr = s.ptr;
+  ret.data.len = s.len;
+  ret.meta.wi = 0;
+  ret.meta.ri = 0;
+  ret.meta.pos = 0;
+  ret.meta.closed = false;
+  return ret;
+}
+
+static inline wuffs_base__token_buffer  //
+wuffs_base__empty_token_buffer() {
+  wuffs_base__token_buffer ret;
+  ret.data.ptr = NULL;
+  ret.data.len = 0;
+  ret.meta.wi = 0;
+  ret.meta.ri = 0;
+  ret.meta.pos = 0;
+  ret.meta.closed = false;
+  return ret;
+}
+
+static inline wuffs_base__token_buffer_meta  //
+wuffs_base__empty_token_buffer_meta() {
+  wuffs_base__token_buffer_meta ret;
+  ret.wi = 0;
+  ret.ri = 0;
+  ret.pos = 0;
+  ret.closed = false;
+  return ret;
+}
+
+static inline bool  //
+wuffs_base__token_buffer__is_valid(const wuffs_base__token_buffer* buf) {
+  if (buf) {
+    if (buf->data.ptr) {
+      return (buf->meta.ri <= buf->meta.wi) && (buf->meta.wi <= buf->data.len);
+    } else {
+      return (buf->meta.ri == 0) && (buf->meta.wi == 0) && (buf->data.len == 0);
+    }
+  }
+  return false;
+}
+
+// wuffs_base__token_buffer__compact moves any written but unread tokens to the
+// start of the buffer.
+static inline void  //
+wuffs_base__token_buffer__compact(wuffs_base__token_buffer* buf) {
+  if (!buf || (buf->meta.ri == 0)) {
+    return;
+  }
+  buf->meta.pos = wuffs_base__u64__sat_add(buf->meta.pos, buf->meta.ri);
+  size_t n = buf->meta.wi - buf->meta.ri;
+  if (n != 0) {
+    memmove(buf->data.ptr, buf->data.ptr + buf->meta.ri,
+            n * sizeof(wuffs_base__token));
+  }
+  buf->meta.wi = n;
+  buf->meta.ri = 0;
+}
+
+static inline uint64_t  //
+wuffs_base__token_buffer__reader_available(
+    const wuffs_base__token_buffer* buf) {
+  return buf ? buf->meta.wi - buf->meta.ri : 0;
+}
+
+// wuffs_base__token_buffer__reader_category_run returns the number of
+// readable tokens, starting at the read index, that have the same
+// value_base_category as the first one. For extended tokens and for tokens
+// with a non-zero value_major, this compares the value_major (and more) too.
+// It returns zero if and only if there are no readable tokens.
+//
+// Callers can use this to consume tokens in batches, handling a run of e.g.
+// filler tokens or string tokens in one step instead of dispatching on each
+// token's category. Runs do not stop at the end of a token chain, so callers
+// that care about chain boundaries still need to check each token's continued
+// bit.
+static inline uint64_t  //
+wuffs_base__token_buffer__reader_category_run(
+    const wuffs_base__token_buffer* buf) {
+  if (!buf || (buf->meta.ri >= buf->meta.wi)) {
+    return 0;
+  }
+  const wuffs_base__token* p = buf->data.ptr + buf->meta.ri;
+  const wuffs_base__token* q = buf->data.ptr + buf->meta.wi;
+  uint64_t c = p->repr >> WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT;
+  const wuffs_base__token* r = p + 1;
+  while ((r < q) &&
+         ((r->repr >> WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT) == c)) {
+    r++;
+  }
+  return (uint64_t)(r - p);
+}
+
+// wuffs_base__token_buffer__reader_copy_run returns the number of readable
+// tokens, starting at the read index, that are string tokens with the
+// CONVERT_1_DST_1_SRC_COPY conversion, stopping after (and including) the
+// first one that is not continued. It returns zero if the first readable
+// token (if any) is not such a token.
+//
+// Such a run is a single span of source bytes, whose length is the sum of its
+// tokens' lengths, and that span converts verbatim to the destination. The
+// maximum token length means that a decoder has to split a long run of
+// unescaped bytes into multiple tokens. A decoder (such as std/json's) may
+// also split runs when it suspends, e.g. when the source buffer is empty, but
+// when a run is decoded in one decode_tokens call, this lets a consumer
+// coalesce its tokens and then copy the whole span at once.
+static inline uint64_t  //
+wuffs_base__token_buffer__reader_copy_run(const wuffs_base__token_buffer* buf) {
+  if (!buf) {
+    return 0;
+  }
+  const wuffs_base__token* p = buf->data.ptr + buf->meta.ri;
+  const wuffs_base__token* q = buf->data.ptr + buf->meta.wi;
+  const wuffs_base__token* r = p;
+  for (; r < q; r++) {
+    uint64_t repr = r->repr;
+    if (((repr >> WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT) !=
+         WUFFS_BASE__TOKEN__VBC__STRING) ||
+        !(repr &
+          (((uint64_t)WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY)
+           << WUFFS_BASE__TOKEN__VALUE_BASE_DETAIL__SHIFT))) {
+      break;
+    } else if (!(repr &
+                 (((uint64_t)1) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT))) {
+      r++;
+      break;
+    }
+  }
+  return (uint64_t)(r - p);
+}
+
+static inline uint64_t  //
+wuffs_base__token_buffer__reader_token_position(
+    const wuffs_base__token_buffer* buf) {
+  return buf ? wuffs_base__u64__sat_add(buf->meta.pos, buf->meta.ri) : 0;
+}
+
+static inline uint64_t  //
+wuffs_base__token_buffer__writer_available(
+    const wuffs_base__token_buffer* buf) {
+  return buf ? buf->data.len - buf->meta.wi : 0;
+}
+
+static inline uint64_t  //
+wuffs_base__token_buffer__writer_token_position(
+    const wuffs_base__token_buffer* buf) {
+  return buf ? wuffs_base__u64__sat_add(buf->meta.pos, buf->meta.wi) : 0;
+}
+
+#ifdef __cplusplus
+
+inline bool  //
+wuffs_base__token_buffer::is_valid() const {
+  return wuffs_base__token_buffer__is_valid(this);
+}
+
+inline void  //
+wuffs_base__token_buffer::compact() {
+  wuffs_base__token_buffer__compact(this);
+}
+
+inline uint64_t  //
+wuffs_base__token_buffer::reader_available() const {
+  return wuffs_base__token_buffer__reader_available(this);
+}
+
+inline uint64_t  //
+wuffs_base__token_buffer::reader_category_run() const {
+  return wuffs_base__token_buffer__reader_category_run(this);
+}
+
+inline uint64_t  //
+wuffs_base__token_buffer::reader_copy_run() const {
+  return wuffs_base__token_buffer__reader_copy_run(this);
+}
+
+inline uint64_t  //
+wuffs_base__token_buffer::reader_token_position() const {
+  return wuffs_base__token_buffer__reader_token_position(this);
+}
+
+inline uint64_t  //
+wuffs_base__token_buffer::writer_available() const {
+  return wuffs_base__token_buffer__writer_available(this);
+}
+
+inline uint64_t  //
+wuffs_base__token_buffer::writer_token_position() const {
+  return wuffs_base__token_buffer__writer_token_position(this);
+}
+
+#endif  // __cplusplus
+
+// ---------------- Token Tapes
+
+// wuffs_base__tape_node is an element of a token tape: a flat array of the
+// values (not the tokens) of a fully buffered token stream, in pre-order.
+// Arrays and objects are "lists" and "dicts", as per the
+// WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_ETC bits. A dict node's children
+// alternate between keys and values.
+//
+// data is the node's bytes. For LITERAL and NUMBER nodes, they are the source
+// bytes, e.g. "true" or "-1.5e3". For LIST and DICT nodes, they are the source
+// bytes from the opening '[' or '{' to the closing ']' or '}' inclusive. For
+// STRING nodes, they are the converted string (without quotes or escapes).
+// This points into the source, without copying, unless the FLAG__CONVERTED
+// bit is set, in which case it points into the tape builder's arena.
+//
+// repr packs the kind (one of WUFFS_BASE__TAPE_NODE__KIND__ETC), the flags and
+// the value_base_detail of the node's first token. For example, that detail
+// discriminates true from false and integers from floating point numbers.
+//
+// skip is the number of nodes in the sub-tree rooted at this node, including
+// the node itself. It is 1 for everything other than non-empty lists and
+// dicts. If this node is at index i, then its first child (if any) is at index
+// (i + 1) and its next sibling (if any) is at index (i + skip).
+typedef struct {
+  wuffs_base__slice_u8 data;
+  uint32_t repr;
+  uint32_t skip;
+
+#ifdef __cplusplus
+  inline uint32_t kind() const;
+  inline uint32_t detail() const;
+  inline bool converted() const;
+#endif  // __cplusplus
+
+} wuffs_base__tape_node;
+
+#define WUFFS_BASE__TAPE_NODE__KIND__SHIFT 24
+
+#define WUFFS_BASE__TAPE_NODE__KIND__LIST 1
+#define WUFFS_BASE__TAPE_NODE__KIND__DICT 2
+#define WUFFS_BASE__TAPE_NODE__KIND__STRING 3
+#define WUFFS_BASE__TAPE_NODE__KIND__LITERAL 4
+#define WUFFS_BASE__TAPE_NODE__KIND__NUMBER 5
+
+#define WUFFS_BASE__TAPE_NODE__FLAG__CONVERTED 0x800000
+
+static inline uint32_t  //
+wuffs_base__tape_node__kind(const wuffs_base__tape_node* n) {
+  return n->repr >> WUFFS_BASE__TAPE_NODE__KIND__SHIFT;
+}
+
+static inline uint32_t  //
+wuffs_base__tape_node__detail(const wuffs_base__tape_node* n) {
+  return n->repr & 0x1FFFFF;
+}
+
+static inline bool  //
+wuffs_base__tape_node__converted(const wuffs_base__tape_node* n) {
+  return n->repr & WUFFS_BASE__TAPE_NODE__FLAG__CONVERTED;
+}
+
+#ifdef __cplusplus
+
+inline uint32_t  //
+wuffs_base__tape_node::kind() const {
+  return wuffs_base__tape_node__kind(this);
+}
+
+inline uint32_t  //
+wuffs_base__tape_node::detail() const {
+  return wuffs_base__tape_node__detail(this);
+}
+
+inline bool  //
+wuffs_base__tape_node::converted() const {
+  return wuffs_base__tape_node__converted(this);
+}
+
+#endif  // __cplusplus
+
+typedef WUFFS_BASE__SLICE(wuffs_base__tape_node) wuffs_base__slice_tape_node;
+
+static inline wuffs_base__slice_tape_node  //
+wuffs_base__make_slice_tape_node(wuffs_base__tape_node* ptr, size_t len) {
+  wuffs_base__slice_tape_node ret;
+  ret.ptr = ptr;
+  ret.len = len;
+  return ret;
+}
+
+// --------
+
+// wuffs_base__tape_builder converts a token stream into a tape.
+//
+// The entire source (the bytes that the tokens describe) must be in memory,
+// at a fixed address, for the lifetime of the tape, e.g. from reading a whole
+// file or memory-mapping it. The tokenizer should therefore be given a closed
+// wuffs_base__slice_u8__reader over that source, and the builder is given the
+// same source slice. Tokens can be fed to the builder in batches, e.g. after
+// every "$short write" suspension, before compacting the token buffer.
+//
+// The nodes and the arena (for converted strings) are caller-owned memory,
+// which can be replaced (e.g. with larger memory) part way through. Some, but
+// not all, tokenizers can produce converted strings that are longer than
+// their source, such as std/json's QUIRK_REPLACE_INVALID_UNICODE, where one
+// invalid source byte converts to the 3-byte UTF-8 encoding of U+FFFD. An
+// arena that is as long as the source is otherwise sufficient for std/json.
+//
+// The builder does not need any other memory. In particular, it has no fixed
+// maximum depth, as open containers are tracked within the tape itself.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// type requires the WUFFS_CONFIG__MODULE__BASE__TAPE sub-module, not just
+// WUFFS_CONFIG__MODULE__BASE__CORE.
+typedef struct {
+  // Do not access the private_impl's fields directly. There is no API/ABI
+  // compatibility or safety guarantee if you do so.
+  struct {
+    wuffs_base__slice_u8 src;
+    wuffs_base__slice_tape_node nodes;
+    wuffs_base__slice_u8 arena;
+    size_t src_ri;
+    size_t nodes_wi;
+    size_t arena_wi;
+    // open is 1 plus the index of the innermost open container, or 0 if there
+    // is none. Each open container's skip field holds its parent's open value.
+    size_t open;
+    // chain is 1 plus the index of the node whose multi-token chain is in
+    // progress, or 0 if there is none.
+    size_t chain;
+    size_t chain_copy_begin;
+    size_t chain_copy_end;
+    size_t chain_arena_begin;
+    uint32_t chain_state;
+  } private_impl;
+
+#ifdef __cplusplus
+  inline void initialize(wuffs_base__slice_u8 src);
+  inline wuffs_base__status set_nodes(wuffs_base__slice_tape_node nodes);
+  inline wuffs_base__status set_arena(wuffs_base__slice_u8 arena);
+  inline wuffs_base__status append_tokens(wuffs_base__token_buffer* tok);
+  inline bool is_complete() const;
+  inline size_t arena_length() const;
+  inline wuffs_base__slice_tape_node nodes() const;
+#endif  // __cplusplus
+
+} wuffs_base__tape_builder;
+
+// wuffs_base__tape_builder__initialize resets the builder to an empty tape,
+// with no nodes or arena memory.
+WUFFS_BASE__MAYBE_STATIC void  //
+wuffs_base__tape_builder__initialize(wuffs_base__tape_builder* b,
+                                     wuffs_base__slice_u8 src);
+
+// wuffs_base__tape_builder__set_nodes replaces the memory that holds the
+// nodes, copying the nodes built so far. It returns an error if the new
+// memory is too short to hold them.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__set_nodes(wuffs_base__tape_builder* b,
+                                    wuffs_base__slice_tape_node nodes);
+
+// wuffs_base__tape_builder__set_arena replaces the memory that holds
+// converted strings. Completed nodes still point into the previous arena, so
+// the caller must keep that alive for the lifetime of the tape. Only an
+// in-progress string (if any) is copied across. It returns an error if the new
+// memory is too short to hold that string.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__set_arena(wuffs_base__tape_builder* b,
+                                    wuffs_base__slice_u8 arena);
+
+// wuffs_base__tape_builder__append_tokens consumes tok's readable tokens,
+// advancing tok->meta.ri. It returns wuffs_base__error__bad_argument if the
+// tokens are inconsistent (e.g. an unbalanced pop) or longer than the source.
+// It returns wuffs_base__error__unsupported_option for extended tokens or
+// string conversions other than copy, drop, backslash-x and Unicode code
+// points.
+//
+// It returns wuffs_base__error__bad_argument_length_too_short if the nodes or
+// the arena are full. The tokens before that point have been consumed and the
+// builder is in a consistent state: the caller can retry after calling
+// set_nodes (if the number of nodes equals the nodes' length) or set_arena.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__append_tokens(wuffs_base__tape_builder* b,
+                                        wuffs_base__token_buffer* tok);
+
+// wuffs_base__tape_builder__is_complete returns whether the nodes so far hold
+// at least one complete top-level value, and no incomplete one.
+static inline bool  //
+wuffs_base__tape_builder__is_complete(const wuffs_base__tape_builder* b) {
+  return (b->private_impl.nodes_wi > 0) && (b->private_impl.open == 0) &&
+         (b->private_impl.chain == 0);
+}
+
+// wuffs_base__tape_builder__arena_length returns how many bytes of the
+// current arena have been used.
+static inline size_t  //
+wuffs_base__tape_builder__arena_length(const wuffs_base__tape_builder* b) {
+  return b->private_impl.arena_wi;
+}
+
+// wuffs_base__tape_builder__nodes returns the nodes built so far. Until the
+// tape is complete, open containers' skip fields are not yet meaningful.
+static inline wuffs_base__slice_tape_node  //
+wuffs_base__tape_builder__nodes(const wuffs_base__tape_builder* b) {
+  return wuffs_base__make_slice_tape_node(b->private_impl.nodes.ptr,
+                                          b->private_impl.nodes_wi);
+}
+
+#ifdef __cplusplus
+
+inline void  //
+wuffs_base__tape_builder::initialize(wuffs_base__slice_u8 src) {
+  wuffs_base__tape_builder__initialize(this, src);
+}
+
+inline wuffs_base__status  //
+wuffs_base__tape_builder::set_nodes(wuffs_base__slice_tape_node nodes) {
+  return wuffs_base__tape_builder__set_nodes(this, nodes);
+}
+
+inline wuffs_base__status  //
+wuffs_base__tape_builder::set_arena(wuffs_base__slice_u8 arena) {
+  return wuffs_base__tape_builder__set_arena(this, arena);
+}
+
+inline wuffs_base__status  //
+wuffs_base__tape_builder::append_tokens(wuffs_base__token_buffer* tok) {
+  return wuffs_base__tape_builder__append_tokens(this, tok);
+}
+
+inline bool  //
+wuffs_base__tape_builder::is_complete() const {
+  return wuffs_base__tape_builder__is_complete(this);
+}
+
+inline size_t  //
+wuffs_base__tape_builder::arena_length() const {
+  return wuffs_base__tape_builder__arena_length(this);
+}
+
+inline wuffs_base__slice_tape_node  //
+wuffs_base__tape_builder::nodes() const {
+  return wuffs_base__tape_builder__nodes(this);
+}
+
+#endif  // __cplusplus
+
+// ---------------- Memory Allocation
+
+// The memory allocation related functions in this section aren't used by Wuffs
+// per se, but they may be helpful to the code that uses Wuffs.
+
+// wuffs_base__malloc_slice_uxx wraps calling a malloc-like function, except
+// that it takes a uint64_t number of elements instead of a size_t size in
+// bytes, and it returns a slice (a pointer and a length) instead of just a
+// pointer.
+//
+// You can pass the C stdlib's malloc as the malloc_func.
+//
+// It returns an empty slice (containing a NULL ptr field) if (num_uxx *
+// sizeof(uintxx_t)) would overflow SIZE_MAX.
+
+static inline wuffs_base__slice_u8  //
+wuffs_base__malloc_slice_u8(void* (*malloc_func)(size_t), uint64_t num_u8) {
+  if (malloc_func && (num_u8 <= (SIZE_MAX / sizeof(uint8_t)))) {
+    void* p = (*malloc_func)(num_u8 * sizeof(uint8_t));
+    if (p) {
+      return wuffs_base__make_slice_u8((uint8_t*)(p), num_u8);
+    }
+  }
+  return wuffs_base__make_slice_u8(NULL, 0);
+}
+
+static inline wuffs_base__slice_u16  //
+wuffs_base__malloc_slice_u16(void* (*malloc_func)(size_t), uint64_t num_u16) {
+  if (malloc_func && (num_u16 <= (SIZE_MAX / sizeof(uint16_t)))) {
+    void* p = (*malloc_func)(num_u16 * sizeof(uint16_t));
+    if (p) {
+      return wuffs_base__make_slice_u16((uint16_t*)(p), num_u16);
+    }
+  }
+  return wuffs_base__make_slice_u16(NULL, 0);
+}
+
+static inline wuffs_base__slice_u32  //
+wuffs_base__malloc_slice_u32(void* (*malloc_func)(size_t), uint64_t num_u32) {
+  if (malloc_func && (num_u32 <= (SIZE_MAX / sizeof(uint32_t)))) {
+    void* p = (*malloc_func)(num_u32 * sizeof(uint32_t));
+    if (p) {
+      return wuffs_base__make_slice_u32((uint32_t*)(p), num_u32);
+    }
+  }
+  return wuffs_base__make_slice_u32(NULL, 0);
+}
+
+static inline wuffs_base__slice_u64  //
+wuffs_base__malloc_slice_u64(void* (*malloc_func)(size_t), uint64_t num_u64) {
+  if (malloc_func && (num_u64 <= (SIZE_MAX / sizeof(uint64_t)))) {
+    void* p = (*malloc_func)(num_u64 * sizeof(uint64_t));
+    if (p) {
+      return wuffs_base__make_slice_u64((uint64_t*)(p), num_u64);
+    }
+  }
+  return wuffs_base__make_slice_u64(NULL, 0);
+}
+
+// ---------------- Images
+
+// wuffs_base__color_u32_argb_premul is an 8 bit per channel premultiplied
+// Alpha, Red, Green, Blue color, as a uint32_t value. Its value is always
+// 0xAARRGGBB (Alpha most significant, Blue least), regardless of endianness.
+typedef uint32_t wuffs_base__color_u32_argb_premul;
+
+static inline uint16_t  //
+wuffs_base__color_u32_argb_premul__as__color_u16_rgb_565(
+    wuffs_base__color_u32_argb_premul c) {
+  uint32_t r5 = 0xF800 & (c >> 8);
+  uint32_t g6 = 0x07E0 & (c >> 5);
+  uint32_t b5 = 0x001F & (c >> 3);
+  return (uint16_t)(r5 | g6 | b5);
+}
+
+static inline wuffs_base__color_u32_argb_premul  //
+wuffs_base__color_u16_rgb_565__as__color_u32_argb_premul(uint16_t rgb_565) {
+  uint32_t b5 = 0x1F & (rgb_565 >> 0);
+  uint32_t b = (b5 << 3) | (b5 >> 2);
+  uint32_t g6 = 0x3F & (rgb_565 >> 5);
+  uint32_t g = (g6 << 2) | (g6 >> 4);
+  uint32_t r5 = 0x1F & (rgb_565 >> 11);
+  uint32_t r = (r5 << 3) | (r5 >> 2);
+  return 0xFF000000 | (r << 16) | (g << 8) | (b << 0);
+}
+
+static inline uint8_t  //
+wuffs_base__color_u32_argb_premul__as__color_u8_gray(
+    wuffs_base__color_u32_argb_premul c) {
+  // Work in 16-bit color.
+  uint32_t cr = 0x101 * (0xFF & (c >> 16));
+  uint32_t cg = 0x101 * (0xFF & (c >> 8));
+  uint32_t cb = 0x101 * (0xFF & (c >> 0));
+
+  // These coefficients (the fractions 0.299, 0.587 and 0.114) are the same
+  // as those given by the JFIF specification.
+  //
+  // Note that 19595 + 38470 + 7471 equals 65536, also known as (1 << 16). We
+  // shift by 24, not just by 16, because the return value is 8-bit color, not
+  // 16-bit color.
+  uint32_t weighted_average = (19595 * cr) + (38470 * cg) + (7471 * cb) + 32768;
+  return (uint8_t)(weighted_average >> 24);
+}
+
+// wuffs_base__color_ycc__as__color_u32_argb_premul converts from 8-bit YCbCr
+// (luma, chroma-blue, chroma-red) to opaque 8-bit RGB. The coefficients are
+// those given by the JFIF specification, for full range (0 ..= 255) luma.
+static inline wuffs_base__color_u32_argb_premul  //
+wuffs_base__color_ycc__as__color_u32_argb_premul(uint8_t yy,
+                                                 uint8_t cb,
+                                                 uint8_t cr) {
+  // The fractional parts of the coefficients (1.402, 0.344136, 0.714136 and
+  // 1.772) are scaled by (1 << 15) and each product is rounded separately,
+  // mimicking the x86 SIMD _mm_mulhrs_epi16 instruction, so that the SIMD and
+  // non-SIMD swizzlers produce the same output. Adding 0x40000000 (and
+  // subtracting 0x8000 after the shift) keeps the right shift's operand
+  // non-negative, as right-shifting a negative int32_t is implementation
+  // defined.
+  int32_t y1 = (int32_t)yy;
+  int32_t b1 = ((int32_t)cb) - 128;
+  int32_t r1 = ((int32_t)cr) - 128;
+  int32_t r = y1 + r1 + ((((r1 * +13173) + 0x40004000) >> 15) - 0x8000);
+  int32_t g = y1 + ((((b1 * -11277) + 0x40004000) >> 15) - 0x8000) +
+              ((((r1 * -23401) + 0x40004000) >> 15) - 0x8000);
+  int32_t b = y1 + b1 + ((((b1 * +25297) + 0x40004000) >> 15) - 0x8000);
+  r = (r < 0) ? 0 : ((r > 255) ? 255 : r);
+  g = (g < 0) ? 0 : ((g > 255) ? 255 : g);
+  b = (b < 0) ? 0 : ((b > 255) ? 255 : b);
+  return 0xFF000000 | (((uint32_t)r) << 16) | (((uint32_t)g) << 8) |
+         (((uint32_t)b) << 0);
+}
+
+// wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul converts
+// from non-premultiplied alpha to premultiplied alpha.
+static inline wuffs_base__color_u32_argb_premul  //
+wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+    uint32_t argb_nonpremul) {
+  // Multiplying by 0x101 (twice, once for alpha and once for color) converts
+  // from 8-bit to 16-bit color. Shifting right by 8 undoes that.
+  //
+  // Working in the higher bit depth can produce slightly different (and
+  // arguably slightly more accurate) results. For example, given 8-bit blue
+  // and alpha of 0x80 and 0x81:
+  //
+  //  - ((0x80   * 0x81  ) / 0xFF  )      = 0x40        = 0x40
+  //  - ((0x8080 * 0x8181) / 0xFFFF) >> 8 = 0x4101 >> 8 = 0x41
+  uint32_t a = 0xFF & (argb_nonpremul >> 24);
+  uint32_t a16 = a * (0x101 * 0x101);
+
+  uint32_t r = 0xFF & (argb_nonpremul >> 16);
+  r = ((r * a16) / 0xFFFF) >> 8;
+  uint32_t g = 0xFF & (argb_nonpremul >> 8);
+  g = ((g * a16) / 0xFFFF) >> 8;
+  uint32_t b = 0xFF & (argb_nonpremul >> 0);
+  b = ((b * a16) / 0xFFFF) >> 8;
+
+  return (a << 24) | (r << 16) | (g << 8) | (b << 0);
+}
+
+// wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul converts
+// from premultiplied alpha to non-premultiplied alpha.
+static inline uint32_t  //
+wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(
+    wuffs_base__color_u32_argb_premul c) {
+  uint32_t a = 0xFF & (c >> 24);
+  if (a == 0xFF) {
+    return c;
+  } else if (a == 0) {
+    return 0;
+  }
+  uint32_t a16 = a * 0x101;
+
+  uint32_t r = 0xFF & (c >> 16);
+  r = ((r * (0x101 * 0xFFFF)) / a16) >> 8;
+  uint32_t g = 0xFF & (c >> 8);
+  g = ((g * (0x101 * 0xFFFF)) / a16) >> 8;
+  uint32_t b = 0xFF & (c >> 0);
+  b = ((b * (0x101 * 0xFFFF)) / a16) >> 8;
+
+  return (a << 24) | (r << 16) | (g << 8) | (b << 0);
+}
+
+// wuffs_base__color_u32__as__color_u64 converts from 8-bit to 16-bit color,
+// with the same alpha premultiplication (or lack of it). Each 16-bit channel
+// in the uint64_t result is at four times the bit offset of the corresponding
+// 8-bit channel in the uint32_t argument.
+static inline uint64_t  //
+wuffs_base__color_u32__as__color_u64(uint32_t c) {
+  uint64_t a = 0x101 * (0xFF & (c >> 24));
+  uint64_t r = 0x101 * (0xFF & (c >> 16));
+  uint64_t g = 0x101 * (0xFF & (c >> 8));
+  uint64_t b = 0x101 * (0xFF & (c >> 0));
+  return (a << 48) | (r << 32) | (g << 16) | (b << 0);
+}
+
+// wuffs_base__color_u64__as__color_u32 converts from 16-bit to 8-bit color,
+// with the same alpha premultiplication (or lack of it).
+static inline uint32_t  //
+wuffs_base__color_u64__as__color_u32(uint64_t c) {
+  uint32_t a = ((uint32_t)(0xFF & (c >> 56)));
+  uint32_t r = ((uint32_t)(0xFF & (c >> 40)));
+  uint32_t g = ((uint32_t)(0xFF & (c >> 24)));
+  uint32_t b = ((uint32_t)(0xFF & (c >> 8)));
+  return (a << 24) | (r << 16) | (g << 8) | (b << 0);
+}
+
+// wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul converts
+// from 8-bit non-premultiplied alpha to 16-bit premultiplied alpha, without
+// the intermediate rounding to 8 bits that
+// wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul does.
+static inline uint64_t  //
+wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(
+    uint32_t argb_nonpremul) {
+  uint32_t a = 0xFF & (argb_nonpremul >> 24);
+  uint32_t a16 = a * (0x101 * 0x101);
+
+  uint32_t r = 0xFF & (argb_nonpremul >> 16);
+  r = (r * a16) / 0xFFFF;
+  uint32_t g = 0xFF & (argb_nonpremul >> 8);
+  g = (g * a16) / 0xFFFF;
+  uint32_t b = 0xFF & (argb_nonpremul >> 0);
+  b = (b * a16) / 0xFFFF;
+
+  return (((uint64_t)(a * 0x101)) << 48) | (((uint64_t)r) << 32) |
+         (((uint64_t)g) << 16) | (((uint64_t)b) << 0);
+}
+
+// --------
+
+typedef uint8_t wuffs_base__pixel_blend;
+
+// wuffs_base__pixel_blend encodes how to blend source and destination pixels,
+// accounting for transparency. It encompasses the Porter-Duff compositing
+// operators as well as the other blending modes defined by PDF.
+//
+// TODO: implement the other modes.
+#define WUFFS_BASE__PIXEL_BLEND__SRC ((wuffs_base__pixel_blend)0)
+#define WUFFS_BASE__PIXEL_BLEND__SRC_OVER ((wuffs_base__pixel_blend)1)
+
+// --------
+
+// wuffs_base__pixel_alpha_transparency is a pixel format's alpha channel
+// model. It is a property of the pixel format in general, not of a specific
+// pixel. An RGBA pixel format (with alpha) can still have fully opaque pixels.
+typedef uint32_t wuffs_base__pixel_alpha_transparency;
+
+#define WUFFS_BASE__PIXEL_ALPHA_TRANSPARENCY__OPAQUE 0
+#define WUFFS_BASE__PIXEL_ALPHA_TRANSPARENCY__NON_PREMULTIPLIED_ALPHA 1
+#define WUFFS_BASE__PIXEL_ALPHA_TRANSPARENCY__PREMULTIPLIED_ALPHA 2
+#define WUFFS_BASE__PIXEL_ALPHA_TRANSPARENCY__BINARY_ALPHA 3
+
+// --------
+
+#define WUFFS_BASE__PIXEL_FORMAT__NUM_PLANES_MAX 4
+
+#define WUFFS_BASE__PIXEL_FORMAT__INDEXED__INDEX_PLANE 0
+#define WUFFS_BASE__PIXEL_FORMAT__INDEXED__COLOR_PLANE 3
+
+// wuffs_base__pixel_format encodes the format of the bytes that constitute an
+// image frame's pixel data.
+//
+// See https://github.com/google/wuffs/blob/master/doc/note/pixel-formats.md
+//
+// Do not manipulate its bits directly; they are private implementation
+// details. Use methods such as wuffs_base__pixel_format__num_planes instead.
+typedef struct {
+  uint32_t repr;
+
+#ifdef __cplusplus
+  inline bool is_valid() const;
+  inline uint32_t bits_per_pixel() const;
+  inline bool is_direct() const;
+  inline bool is_indexed() const;
+  inline bool is_interleaved() const;
+  inline bool is_planar() const;
+  inline uint32_t num_planes() const;
+  inline wuffs_base__pixel_alpha_transparency transparency() const;
+#endif  // __cplusplus
+
+} wuffs_base__pixel_format;
+
+static inline wuffs_base__pixel_format  //
+wuffs_base__make_pixel_format(uint32_t repr) {
+  wuffs_base__pixel_format f;
+  f.repr = repr;
+  return f;
+}
+
+  // Common 8-bit-depth pixel formats. This list is not exhaustive; not all
+  // valid wuffs_base__pixel_format values are present.
+
+#define WUFFS_BASE__PIXEL_FORMAT__INVALID 0x00000000
+
+#define WUFFS_BASE__PIXEL_FORMAT__A 0x02000008
+
+#define WUFFS_BASE__PIXEL_FORMAT__Y 0x20000008
+#define WUFFS_BASE__PIXEL_FORMAT__YA_NONPREMUL 0x21000008
+#define WUFFS_BASE__PIXEL_FORMAT__YA_PREMUL 0x22000008
+
+#define WUFFS_BASE__PIXEL_FORMAT__YCBCR 0x40020888
+#define WUFFS_BASE__PIXEL_FORMAT__YCBCRA_NONPREMUL 0x41038888
+#define WUFFS_BASE__PIXEL_FORMAT__YCBCRK 0x50038888
+
+#define WUFFS_BASE__PIXEL_FORMAT__YCOCG 0x60020888
+#define WUFFS_BASE__PIXEL_FORMAT__YCOCGA_NONPREMUL 0x61038888
+#define WUFFS_BASE__PIXEL_FORMAT__YCOCGK 0x70038888
+
+#define WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL 0x81040008
+#define WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL 0x82040008
+#define WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY 0x83040008
+
+#define WUFFS_BASE__PIXEL_FORMAT__BGR_565 0x80000565
+#define WUFFS_BASE__PIXEL_FORMAT__BGR 0x80000888
+#define WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL 0x81008888
+#define WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL 0x82008888
+#define WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY 0x83008888
+#define WUFFS_BASE__PIXEL_FORMAT__BGRX 0x90008888
+
+#define WUFFS_BASE__PIXEL_FORMAT__RGB 0xA0000888
+#define WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL 0xA1008888
+#define WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL 0xA2008888
+#define WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY 0xA3008888
+#define WUFFS_BASE__PIXEL_FORMAT__RGBX 0xB0008888
+
+#define WUFFS_BASE__PIXEL_FORMAT__CMY 0xC0020888
+#define WUFFS_BASE__PIXEL_FORMAT__CMYK 0xD0038888
+
+  // Common 16-bit-depth pixel formats, whose channels are each a little-endian
+  // uint16_t. Like the 8-bit-depth formats, the channels are listed in memory
+  // order: BGRA means that blue is at the lowest address.
+
+#define WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE 0x8100BBBB
+#define WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE 0x8200BBBB
+
+#define WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL_4X16LE 0xA100BBBB
+#define WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE 0xA200BBBB
+
+extern const uint32_t wuffs_base__pixel_format__bits_per_channel[16];
+
+static inline bool  //
+wuffs_base__pixel_format__is_valid(const wuffs_base__pixel_format* f) {
+  return f->repr != 0;
+}
+
+// wuffs_base__pixel_format__bits_per_pixel returns the number of bits per
+// pixel for interleaved pixel formats, and returns 0 for planar pixel formats.
+static inline uint32_t  //
+wuffs_base__pixel_format__bits_per_pixel(const wuffs_base__pixel_format* f) {
+  if (((f->repr >> 16) & 0x03) != 0) {
+    return 0;
+  }
+  return wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 0)] +
+         wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 4)] +
+         wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 8)] +
+         wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 12)];
+}
+
+static inline bool  //
+wuffs_base__pixel_format__is_direct(const wuffs_base__pixel_format* f) {
+  return ((f->repr >> 18) & 0x01) == 0;
+}
+
+static inline bool  //
+wuffs_base__pixel_format__is_indexed(const wuffs_base__pixel_format* f) {
+  return ((f->repr >> 18) & 0x01) != 0;
+}
+
+static inline bool  //
+wuffs_base__pixel_format__is_interleaved(const wuffs_base__pixel_format* f) {
+  return ((f->repr >> 16) & 0x03) == 0;
+}
+
+static inline bool  //
+wuffs_base__pixel_format__is_planar(const wuffs_base__pixel_format* f) {
+  return ((f->repr >> 16) & 0x03) != 0;
+}
+
+static inline uint32_t  //
+wuffs_base__pixel_format__num_planes(const wuffs_base__pixel_format* f) {
+  return ((f->repr >> 16) & 0x03) + 1;
+}
+
+static inline wuffs_base__pixel_alpha_transparency  //
+wuffs_base__pixel_format__transparency(const wuffs_base__pixel_format* f) {
+  return (wuffs_base__pixel_alpha_transparency)((f->repr >> 24) & 0x03);
+}
+
+#ifdef __cplusplus
+
+inline bool  //
+wuffs_base__pixel_format::is_valid() const {
+  return wuffs_base__pixel_format__is_valid(this);
+}
+
+inline uint32_t  //
+wuffs_base__pixel_format::bits_per_pixel() const {
+  return wuffs_base__pixel_format__bits_per_pixel(this);
+}
+
+inline bool  //
+wuffs_base__pixel_format::is_direct() const {
+  return wuffs_base__pixel_format__is_direct(this);
+}
+
+inline bool  //
+wuffs_base__pixel_format::is_indexed() const {
+  return wuffs_base__pixel_format__is_indexed(this);
+}
+
+inline bool  //
+wuffs_base__pixel_format::is_interleaved() const {
+  return wuffs_base__pixel_format__is_interleaved(this);
+}
+
+inline bool  //
+wuffs_base__pixel_format::is_planar() const {
+  return wuffs_base__pixel_format__is_planar(this);
+}
+
+inline uint32_t  //
+wuffs_base__pixel_format::num_planes() const {
+  return wuffs_base__pixel_format__num_planes(this);
+}
+
+inline wuffs_base__pixel_alpha_transparency  //
+wuffs_base__pixel_format::transparency() const {
+  return wuffs_base__pixel_format__transparency(this);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+// wuffs_base__pixel_subsampling encodes whether sample values cover one pixel
+// or cover multiple pixels.
+//
+// See https://github.com/google/wuffs/blob/master/doc/note/pixel-subsampling.md
+//
+// Do not manipulate its bits directly; they are private implementation
+// details. Use methods such as wuffs_base__pixel_subsampling__bias_x instead.
+typedef struct {
+  uint32_t repr;
+
+#ifdef __cplusplus
+  inline uint32_t bias_x(uint32_t plane) const;
+  inline uint32_t denominator_x(uint32_t plane) const;
+  inline uint32_t bias_y(uint32_t plane) const;
+  inline uint32_t denominator_y(uint32_t plane) const;
+#endif  // __cplusplus
+
+} wuffs_base__pixel_subsampling;
+
+static inline wuffs_base__pixel_subsampling  //
+wuffs_base__make_pixel_subsampling(uint32_t repr) {
+  wuffs_base__pixel_subsampling s;
+  s.repr = repr;
+  return s;
+}
+
+#define WUFFS_BASE__PIXEL_SUBSAMPLING__NONE 0x00000000
+
+#define WUFFS_BASE__PIXEL_SUBSAMPLING__444 0x000000
+#define WUFFS_BASE__PIXEL_SUBSAMPLING__440 0x010100
+#define WUFFS_BASE__PIXEL_SUBSAMPLING__422 0x101000
+#define WUFFS_BASE__PIXEL_SUBSAMPLING__420 0x111100
+#define WUFFS_BASE__PIXEL_SUBSAMPLING__411 0x303000
+#define WUFFS_BASE__PIXEL_SUBSAMPLING__410 0x313100
+
+static inline uint32_t  //
+wuffs_base__pixel_subsampling__bias_x(const wuffs_base__pixel_subsampling* s,
+                                      uint32_t plane) {
+  uint32_t shift = ((plane & 0x03) * 8) + 6;
+  return (s->repr >> shift) & 0x03;
+}
+
+static inline uint32_t  //
+wuffs_base__pixel_subsampling__denominator_x(
+    const wuffs_base__pixel_subsampling* s,
+    uint32_t plane) {
+  uint32_t shift = ((plane & 0x03) * 8) + 4;
+  return ((s->repr >> shift) & 0x03) + 1;
+}
+
+static inline uint32_t  //
+wuffs_base__pixel_subsampling__bias_y(const wuffs_base__pixel_subsampling* s,
+                                      uint32_t plane) {
+  uint32_t shift = ((plane & 0x03) * 8) + 2;
+  return (s->repr >> shift) & 0x03;
+}
+
+static inline uint32_t  //
+wuffs_base__pixel_subsampling__denominator_y(
+    const wuffs_base__pixel_subsampling* s,
+    uint32_t plane) {
+  uint32_t shift = ((plane & 0x03) * 8) + 0;
+  return ((s->repr >> shift) & 0x03) + 1;
+}
+
+#ifdef __cplusplus
+
+inline uint32_t  //
+wuffs_base__pixel_subsampling::bias_x(uint32_t plane) const {
+  return wuffs_base__pixel_subsampling__bias_x(this, plane);
+}
+
+inline uint32_t  //
+wuffs_base__pixel_subsampling::denominator_x(uint32_t plane) const {
+  return wuffs_base__pixel_subsampling__denominator_x(this, plane);
+}
+
+inline uint32_t  //
+wuffs_base__pixel_subsampling::bias_y(uint32_t plane) const {
+  return wuffs_base__pixel_subsampling__bias_y(this, plane);
+}
+
+inline uint32_t  //
+wuffs_base__pixel_subsampling::denominator_y(uint32_t plane) const {
+  return wuffs_base__pixel_subsampling__denominator_y(this, plane);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+typedef struct {
+  // Do not access the private_impl's fields directly. There is no API/ABI
+  // compatibility or safety guarantee if you do so.
+  struct {
+    wuffs_base__pixel_format pixfmt;
+    wuffs_base__pixel_subsampling pixsub;
+    uint32_t width;
+    uint32_t height;
+  } private_impl;
+
+#ifdef __cplusplus
+  inline void set(uint32_t pixfmt_repr,
+                  uint32_t pixsub_repr,
+                  uint32_t width,
+                  uint32_t height);
+  inline void invalidate();
+  inline bool is_valid() const;
+  inline wuffs_base__pixel_format pixel_format() const;
+  inline wuffs_base__pixel_subsampling pixel_subsampling() const;
+  inline wuffs_base__rect_ie_u32 bounds() const;
+  inline uint32_t width() const;
+  inline uint32_t height() const;
+  inline uint64_t pixbuf_len() const;
+#endif  // __cplusplus
+
+} wuffs_base__pixel_config;
+
+static inline wuffs_base__pixel_config  //
+wuffs_base__null_pixel_config() {
+  wuffs_base__pixel_config ret;
+  ret.private_impl.pixfmt.repr = 0;
+  ret.private_impl.pixsub.repr = 0;
+  ret.private_impl.width = 0;
+  ret.private_impl.height = 0;
+  return ret;
+}
+
+// TODO: Should this function return bool? An error type?
+static inline void  //
+wuffs_base__pixel_config__set(wuffs_base__pixel_config* c,
+                              uint32_t pixfmt_repr,
+                              uint32_t pixsub_repr,
+                              uint32_t width,
+                              uint32_t height) {
+  if (!c) {
+    return;
+  }
+  if (pixfmt_repr) {
+    uint64_t wh = ((uint64_t)width) * ((uint64_t)height);
+    // TODO: handle things other than 1 byte per pixel.
+    if (wh <= ((uint64_t)SIZE_MAX)) {
+      c->private_impl.pixfmt.repr = pixfmt_repr;
+      c->private_impl.pixsub.repr = pixsub_repr;
+      c->private_impl.width = width;
+      c->private_impl.height = height;
+      return;
+    }
+  }
+
+  c->private_impl.pixfmt.repr = 0;
+  c->private_impl.pixsub.repr = 0;
+  c->private_impl.width = 0;
+  c->private_impl.height = 0;
+}
+
+static inline void  //
+wuffs_base__pixel_config__invalidate(wuffs_base__pixel_config* c) {
+  if (c) {
+    c->private_impl.pixfmt.repr = 0;
+    c->private_impl.pixsub.repr = 0;
+    c->private_impl.width = 0;
+    c->private_impl.height = 0;
+  }
+}
+
+static inline bool  //
+wuffs_base__pixel_config__is_valid(const wuffs_base__pixel_config* c) {
+  return c && c->private_impl.pixfmt.repr;
+}
+
+static inline wuffs_base__pixel_format  //
+wuffs_base__pixel_config__pixel_format(const wuffs_base__pixel_config* c) {
+  return c ? c->private_impl.pixfmt : wuffs_base__make_pixel_format(0);
+}
+
+static inline wuffs_base__pixel_subsampling  //
+wuffs_base__pixel_config__pixel_subsampling(const wuffs_base__pixel_config* c) {
+  return c ? c->private_impl.pixsub : wuffs_base__make_pixel_subsampling(0);
+}
+
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__pixel_config__bounds(const wuffs_base__pixel_config* c) {
+  if (c) {
+    wuffs_base__rect_ie_u32 ret;
+    ret.min_incl_x = 0;
+    ret.min_incl_y = 0;
+    ret.max_excl_x = c->private_impl.width;
+    ret.max_excl_y = c->private_impl.height;
+    return ret;
+  }
+
+  wuffs_base__rect_ie_u32 ret;
+  ret.min_incl_x = 0;
+  ret.min_incl_y = 0;
+  ret.max_excl_x = 0;
+  ret.max_excl_y = 0;
+  return ret;
+}
+
+static inline uint32_t  //
+wuffs_base__pixel_config__width(const wuffs_base__pixel_config* c) {
+  return c ? c->private_impl.width : 0;
+}
+
+static inline uint32_t  //
+wuffs_base__pixel_config__height(const wuffs_base__pixel_config* c) {
+  return c ? c->private_impl.height : 0;
+}
+
+// TODO: this is the right API for planar (not interleaved) pixbufs? Should it
+// allow decoding into a color model different from the format's intrinsic one?
+// For example, decoding a JPEG image straight to RGBA instead of to YCbCr?
+static inline uint64_t  //
+wuffs_base__pixel_config__pixbuf_len(const wuffs_base__pixel_config* c) {
+  if (!c) {
+    return 0;
+  }
+  if (wuffs_base__pixel_format__is_planar(&c->private_impl.pixfmt)) {
+    // Each plane holds one 8-bit channel, with one sample per macropixel.
+    // The planes are laid out one after the other.
+    uint64_t n = 0;
+    uint32_t num_planes =
+        wuffs_base__pixel_format__num_planes(&c->private_impl.pixfmt);
+    uint32_t p;
+    for (p = 0; p < num_planes; p++) {
+      if (((c->private_impl.pixfmt.repr >> (4 * p)) & 0x0F) != 0x08) {
+        // TODO: support other bit depths and multi-channel planes.
+        return 0;
+      }
+      uint64_t dx = wuffs_base__pixel_subsampling__denominator_x(
+          &c->private_impl.pixsub, p);
+      uint64_t dy = wuffs_base__pixel_subsampling__denominator_y(
+          &c->private_impl.pixsub, p);
+      uint64_t w =
+          (((uint64_t)c->private_impl.width) +
+           wuffs_base__pixel_subsampling__bias_x(&c->private_impl.pixsub, p) +
+           dx - 1) /
+          dx;
+      uint64_t h =
+          (((uint64_t)c->private_impl.height) +
+           wuffs_base__pixel_subsampling__bias_y(&c->private_impl.pixsub, p) +
+           dy - 1) /
+          dy;
+      n += w * h;
+    }
+    return n;
+  }
+  uint32_t bits_per_pixel =
+      wuffs_base__pixel_format__bits_per_pixel(&c->private_impl.pixfmt);
+  if ((bits_per_pixel == 0) || ((bits_per_pixel % 8) != 0)) {
+    // TODO: support fraction-of-byte pixels, e.g. 1 bit per pixel?
+    return 0;
+  }
+  uint64_t bytes_per_pixel = bits_per_pixel / 8;
+
+  uint64_t n =
+      ((uint64_t)c->private_impl.width) * ((uint64_t)c->private_impl.height);
+  if (n > (UINT64_MAX / bytes_per_pixel)) {
+    return 0;
+  }
+  n *= bytes_per_pixel;
+
+  if (wuffs_base__pixel_format__is_indexed(&c->private_impl.pixfmt)) {
+    if (n > (UINT64_MAX - 1024)) {
+      return 0;
+    }
+    n += 1024;
+  }
+
+  return n;
+}
+
+#ifdef __cplusplus
+
+inline void  //
+wuffs_base__pixel_config::set(uint32_t pixfmt_repr,
+                              uint32_t pixsub_repr,
+                              uint32_t width,
+                              uint32_t height) {
+  wuffs_base__pixel_config__set(this, pixfmt_repr, pixsub_repr, width, height);
+}
+
+inline void  //
+wuffs_base__pixel_config::invalidate() {
+  wuffs_base__pixel_config__invalidate(this);
+}
+
+inline bool  //
+wuffs_base__pixel_config::is_valid() const {
+  return wuffs_base__pixel_config__is_valid(this);
+}
+
+inline wuffs_base__pixel_format  //
+wuffs_base__pixel_config::pixel_format() const {
+  return wuffs_base__pixel_config__pixel_format(this);
+}
+
+inline wuffs_base__pixel_subsampling  //
+wuffs_base__pixel_config::pixel_subsampling() const {
+  return wuffs_base__pixel_config__pixel_subsampling(this);
+}
+
+inline wuffs_base__rect_ie_u32  //
+wuffs_base__pixel_config::bounds() const {
+  return wuffs_base__pixel_config__bounds(this);
+}
+
+inline uint32_t  //
+wuffs_base__pixel_config::width() const {
+  return wuffs_base__pixel_config__width(this);
+}
+
+inline uint32_t  //
+wuffs_base__pixel_config::height() const {
+  return wuffs_base__pixel_config__height(this);
+}
+
+inline uint64_t  //
+wuffs_base__pixel_config::pixbuf_len() const {
+  return wuffs_base__pixel_config__pixbuf_len(this);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+typedef struct {
+  wuffs_base__pixel_config pixcfg;
+
+  // Do not access the private_impl's fields directly. There is no API/ABI
+  // compatibility or safety guarantee if you do so.
+  struct {
+    uint64_t first_frame_io_position;
+    bool first_frame_is_opaque;
+  } private_impl;
+
+#ifdef __cplusplus
+  inline void set(uint32_t pixfmt_repr,
+                  uint32_t pixsub_repr,
+                  uint32_t width,
+                  uint32_t height,
+                  uint64_t first_frame_io_position,
+                  bool first_frame_is_opaque);
+  inline void invalidate();
+  inline bool is_valid() const;
+  inline uint64_t first_frame_io_position() const;
+  inline bool first_frame_is_opaque() const;
+#endif  // __cplusplus
+
+} wuffs_base__image_config;
+
+static inline wuffs_base__image_config  //
+wuffs_base__null_image_config() {
+  wuffs_base__image_config ret;
+  ret.pixcfg = wuffs_base__null_pixel_config();
+  ret.private_impl.first_frame_io_position = 0;
+  ret.private_impl.first_frame_is_opaque = false;
+  return ret;
+}
+
+// TODO: Should this function return bool? An error type?
+static inline void  //
+wuffs_base__image_config__set(wuffs_base__image_config* c,
+                              uint32_t pixfmt_repr,
+                              uint32_t pixsub_repr,
+                              uint32_t width,
+                              uint32_t height,
+                              uint64_t first_frame_io_position,
+                              bool first_frame_is_opaque) {
+  if (!c) {
+    return;
+  }
+  if (pixfmt_repr) {
+    c->pixcfg.private_impl.pixfmt.repr = pixfmt_repr;
+    c->pixcfg.private_impl.pixsub.repr = pixsub_repr;
+    c->pixcfg.private_impl.width = width;
+    c->pixcfg.private_impl.height = height;
+    c->private_impl.first_frame_io_position = first_frame_io_position;
+    c->private_impl.first_frame_is_opaque = first_frame_is_opaque;
+    return;
+  }
+
+  c->pixcfg.private_impl.pixfmt.repr = 0;
+  c->pixcfg.private_impl.pixsub.repr = 0;
+  c->pixcfg.private_impl.width = 0;
+  c->pixcfg.private_impl.height = 0;
+  c->private_impl.first_frame_io_position = 0;
+  c->private_impl.first_frame_is_opaque = 0;
+}
+
+static inline void  //
+wuffs_base__image_config__invalidate(wuffs_base__image_config* c) {
+  if (c) {
+    c->pixcfg.private_impl.pixfmt.repr = 0;
+    c->pixcfg.private_impl.pixsub.repr = 0;
+    c->pixcfg.private_impl.width = 0;
+    c->pixcfg.private_impl.height = 0;
+    c->private_impl.first_frame_io_position = 0;
+    c->private_impl.first_frame_is_opaque = 0;
+  }
+}
+
+static inline bool  //
+wuffs_base__image_config__is_valid(const wuffs_base__image_config* c) {
+  return c && wuffs_base__pixel_config__is_valid(&(c->pixcfg));
+}
+
+static inline uint64_t  //
+wuffs_base__image_config__first_frame_io_position(
+    const wuffs_base__image_config* c) {
+  return c ? c->private_impl.first_frame_io_position : 0;
+}
+
+static inline bool  //
+wuffs_base__image_config__first_frame_is_opaque(
+    const wuffs_base__image_config* c) {
+  return c ? c->private_impl.first_frame_is_opaque : false;
+}
+
+#ifdef __cplusplus
+
+inline void  //
+wuffs_base__image_config::set(uint32_t pixfmt_repr,
+                              uint32_t pixsub_repr,
+                              uint32_t width,
+                              uint32_t height,
+                              uint64_t first_frame_io_position,
+                              bool first_frame_is_opaque) {
+  wuffs_base__image_config__set(this, pixfmt_repr, pixsub_repr, width, height,
+                                first_frame_io_position, first_frame_is_opaque);
+}
+
+inline void  //
+wuffs_base__image_config::invalidate() {
+  wuffs_base__image_config__invalidate(this);
+}
+
+inline bool  //
+wuffs_base__image_config::is_valid() const {
+  return wuffs_base__image_config__is_valid(this);
+}
+
+inline uint64_t  //
+wuffs_base__image_config::first_frame_io_position() const {
+  return wuffs_base__image_config__first_frame_io_position(this);
+}
+
+inline bool  //
+wuffs_base__image_config::first_frame_is_opaque() const {
+  return wuffs_base__image_config__first_frame_is_opaque(this);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+// Deprecated: use wuffs_base__pixel_blend instead.
+//
+// wuffs_base__animation_blend encodes, for an animated image, how to blend the
+// transparent pixels of this frame with the existing canvas. In Porter-Duff
+// compositing operator terminology:
+//  - 0 means the frame may be transparent, and should be blended "src over
+//    dst", also known as just "over".
+//  - 1 means the frame may be transparent, and should be blended "src".
+//  - 2 means the frame is completely opaque, so that "src over dst" and "src"
+//    are equivalent.
+//
+// These semantics are conservative. It is valid for a completely opaque frame
+// to have a blend value other than 2.
+typedef uint8_t wuffs_base__animation_blend;
+
+#define WUFFS_BASE__ANIMATION_BLEND__SRC_OVER_DST \
+  ((wuffs_base__animation_blend)0)
+#define WUFFS_BASE__ANIMATION_BLEND__SRC ((wuffs_base__animation_blend)1)
+#define WUFFS_BASE__ANIMATION_BLEND__OPAQUE ((wuffs_base__animation_blend)2)
+
+// --------
+
+// wuffs_base__animation_disposal encodes, for an animated image, how to
+// dispose of a frame after displaying it:
+//  - None means to draw the next frame on top of this one.
+//  - Restore Background means to clear the frame's dirty rectangle to "the
+//    background color" (in practice, this means transparent black) before
+//    drawing the next frame.
+//  - Restore Previous means to undo the current frame, so that the next frame
+//    is drawn on top of the previous one.
+typedef uint8_t wuffs_base__animation_disposal;
+
+#define WUFFS_BASE__ANIMATION_DISPOSAL__NONE ((wuffs_base__animation_disposal)0)
+#define WUFFS_BASE__ANIMATION_DISPOSAL__RESTORE_BACKGROUND \
+  ((wuffs_base__animation_disposal)1)
+#define WUFFS_BASE__ANIMATION_DISPOSAL__RESTORE_PREVIOUS \
+  ((wuffs_base__animation_disposal)2)
+
+// --------
+
+typedef struct {
+  // Do not access the private_impl's fields directly. There is no API/ABI
+  // compatibility or safety guarantee if you do so.
+  struct {
+    wuffs_base__rect_ie_u32 bounds;
+    wuffs_base__flicks duration;
+    uint64_t index;
+    uint64_t io_position;
+    wuffs_base__animation_disposal disposal;
+    bool opaque_within_bounds;
+    bool overwrite_instead_of_blend;
+    wuffs_base__color_u32_argb_premul background_color;
+  } private_impl;
+
+#ifdef __cplusplus
+  inline void update(wuffs_base__rect_ie_u32 bounds,
+                     wuffs_base__flicks duration,
+                     uint64_t index,
+                     uint64_t io_position,
+                     wuffs_base__animation_disposal disposal,
+                     bool opaque_within_bounds,
+                     bool overwrite_instead_of_blend,
+                     wuffs_base__color_u32_argb_premul background_color);
+  inline wuffs_base__rect_ie_u32 bounds() const;
+  inline uint32_t width() const;
+  inline uint32_t height() const;
+  inline wuffs_base__flicks duration() const;
+  inline uint64_t index() const;
+  inline uint64_t io_position() const;
+  inline wuffs_base__animation_disposal disposal() const;
+  inline bool opaque_within_bounds() const;
+  inline bool overwrite_instead_of_blend() const;
+  inline wuffs_base__color_u32_argb_premul background_color() const;
+#endif  // __cplusplus
+
+} wuffs_base__frame_config;
+
+static inline wuffs_base__frame_config  //
+wuffs_base__null_frame_config() {
+  wuffs_base__frame_config ret;
+  ret.private_impl.bounds = wuffs_base__make_rect_ie_u32(0, 0, 0, 0);
+  ret.private_impl.duration = 0;
+  ret.private_impl.index = 0;
+  ret.private_impl.io_position = 0;
+  ret.private_impl.disposal = 0;
+  ret.private_impl.opaque_within_bounds = false;
+  ret.private_impl.overwrite_instead_of_blend = false;
+  return ret;
+}
+
+static inline void  //
+wuffs_base__frame_config__update(
+    wuffs_base__frame_config* c,
+    wuffs_base__rect_ie_u32 bounds,
+    wuffs_base__flicks duration,
+    uint64_t index,
+    uint64_t io_position,
+    wuffs_base__animation_disposal disposal,
+    bool opaque_within_bounds,
+    bool overwrite_instead_of_blend,
+    wuffs_base__color_u32_argb_premul background_color) {
+  if (!c) {
+    return;
+  }
+
+  c->private_impl.bounds = bounds;
+  c->private_impl.duration = duration;
+  c->private_impl.index = index;
+  c->private_impl.io_position = io_position;
+  c->private_impl.disposal = disposal;
+  c->private_impl.opaque_within_bounds = opaque_within_bounds;
+  c->private_impl.overwrite_instead_of_blend = overwrite_instead_of_blend;
+  c->private_impl.background_color = background_color;
+}
+
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__frame_config__bounds(const wuffs_base__frame_config* c) {
+  if (c) {
+    return c->private_impl.bounds;
+  }
+
+  wuffs_base__rect_ie_u32 ret;
+  ret.min_incl_x = 0;
+  ret.min_incl_y = 0;
+  ret.max_excl_x = 0;
+  ret.max_excl_y = 0;
+  return ret;
+}
+
+static inline uint32_t  //
+wuffs_base__frame_config__width(const wuffs_base__frame_config* c) {
+  return c ? wuffs_base__rect_ie_u32__width(&c->private_impl.bounds) : 0;
+}
+
+static inline uint32_t  //
+wuffs_base__frame_config__height(const wuffs_base__frame_config* c) {
+  return c ? wuffs_base__rect_ie_u32__height(&c->private_impl.bounds) : 0;
+}
+
+// wuffs_base__frame_config__duration returns the amount of time to display
+// this frame. Zero means to display forever - a still (non-animated) image.
+static inline wuffs_base__flicks  //
+wuffs_base__frame_config__duration(const wuffs_base__frame_config* c) {
+  return c ? c->private_impl.duration : 0;
+}
+
+// wuffs_base__frame_config__index returns the index of this frame. The first
+// frame in an image has index 0, the second frame has index 1, and so on.
+static inline uint64_t  //
+wuffs_base__frame_config__index(const wuffs_base__frame_config* c) {
+  return c ? c->private_impl.index : 0;
+}
+
+// wuffs_base__frame_config__io_position returns the I/O stream position before
+// the frame config.
+static inline uint64_t  //
+wuffs_base__frame_config__io_position(const wuffs_base__frame_config* c) {
+  return c ? c->private_impl.io_position : 0;
+}
+
+// wuffs_base__frame_config__disposal returns, for an animated image, how to
+// dispose of this frame after displaying it.
+static inline wuffs_base__animation_disposal  //
+wuffs_base__frame_config__disposal(const wuffs_base__frame_config* c) {
+  return c ? c->private_impl.disposal : 0;
+}
+
+// wuffs_base__frame_config__opaque_within_bounds returns whether all pixels
+// within the frame's bounds are fully opaque. It makes no claim about pixels
+// outside the frame bounds but still inside the overall image. The two
+// bounding rectangles can differ for animated images.
+//
+// Its semantics are conservative. It is valid for a fully opaque frame to have
+// this value be false: a false negative.
+//
+// If true, drawing the frame with WUFFS_BASE__PIXEL_BLEND__SRC and
+// WUFFS_BASE__PIXEL_BLEND__SRC_OVER should be equivalent, in terms of
+// resultant pixels, but the former may be faster.
+static inline bool  //
+wuffs_base__frame_config__opaque_within_bounds(
+    const wuffs_base__frame_config* c) {
+  return c && c->private_impl.opaque_within_bounds;
+}
+
+// wuffs_base__frame_config__overwrite_instead_of_blend returns, for an
+// animated image, whether to ignore the previous image state (within the frame
+// bounds) when drawing this incremental frame. Equivalently, whether to use
+// WUFFS_BASE__PIXEL_BLEND__SRC instead of WUFFS_BASE__PIXEL_BLEND__SRC_OVER.
+//
+// The WebP spec (https://developers.google.com/speed/webp/docs/riff_container)
+// calls this the "Blending method" bit. WebP's "Do not blend" corresponds to
+// Wuffs' "overwrite_instead_of_blend".
+static inline bool  //
+wuffs_base__frame_config__overwrite_instead_of_blend(
+    const wuffs_base__frame_config* c) {
+  return c && c->private_impl.overwrite_instead_of_blend;
+}
+
+static inline wuffs_base__color_u32_argb_premul  //
+wuffs_base__frame_config__background_color(const wuffs_base__frame_config* c) {
+  return c ? c->private_impl.background_color : 0;
+}
+
+#ifdef __cplusplus
+
+inline void  //
+wuffs_base__frame_config::update(
+    wuffs_base__rect_ie_u32 bounds,
+    wuffs_base__flicks duration,
+    uint64_t index,
+    uint64_t io_position,
+    wuffs_base__animation_disposal disposal,
+    bool opaque_within_bounds,
+    bool overwrite_instead_of_blend,
+    wuffs_base__color_u32_argb_premul background_color) {
+  wuffs_base__frame_config__update(
+      this, bounds, duration, index, io_position, disposal,
+      opaque_within_bounds, overwrite_instead_of_blend, background_color);
+}
+
+inline wuffs_base__rect_ie_u32  //
+wuffs_base__frame_config::bounds() const {
+  return wuffs_base__frame_config__bounds(this);
+}
+
+inline uint32_t  //
+wuffs_base__frame_config::width() const {
+  return wuffs_base__frame_config__width(this);
+}
+
+inline uint32_t  //
+wuffs_base__frame_config::height() const {
+  return wuffs_base__frame_config__height(this);
+}
+
+inline wuffs_base__flicks  //
+wuffs_base__frame_config::duration() const {
+  return wuffs_base__frame_config__duration(this);
+}
+
+inline uint64_t  //
+wuffs_base__frame_config::index() const {
+  return wuffs_base__frame_config__index(this);
+}
+
+inline uint64_t  //
+wuffs_base__frame_config::io_position() const {
+  return wuffs_base__frame_config__io_position(this);
+}
+
+inline wuffs_base__animation_disposal  //
+wuffs_base__frame_config::disposal() const {
+  return wuffs_base__frame_config__disposal(this);
+}
+
+inline bool  //
+wuffs_base__frame_config::opaque_within_bounds() const {
+  return wuffs_base__frame_config__opaque_within_bounds(this);
+}
+
+inline bool  //
+wuffs_base__frame_config::overwrite_instead_of_blend() const {
+  return wuffs_base__frame_config__overwrite_instead_of_blend(this);
+}
+
+inline wuffs_base__color_u32_argb_premul  //
+wuffs_base__frame_config::background_color() const {
+  return wuffs_base__frame_config__background_color(this);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+typedef struct {
+  wuffs_base__pixel_config pixcfg;
+
+  // Do not access the private_impl's fields directly. There is no API/ABI
+  // compatibility or safety guarantee if you do so.
+  struct {
+    wuffs_base__table_u8 planes[WUFFS_BASE__PIXEL_FORMAT__NUM_PLANES_MAX];
+    // TODO: color spaces.
+  } private_impl;
+
+#ifdef __cplusplus
+  inline wuffs_base__status set_from_slice(
+      const wuffs_base__pixel_config* pixcfg,
+      wuffs_base__slice_u8 pixbuf_memory);
+  inline wuffs_base__status set_from_table(
+      const wuffs_base__pixel_config* pixcfg,
+      wuffs_base__table_u8 pixbuf_memory);
+  inline wuffs_base__slice_u8 palette();
+  inline wuffs_base__pixel_format pixel_format() const;
+  inline wuffs_base__table_u8 plane(uint32_t p);
+  inline wuffs_base__color_u32_argb_premul color_u32_at(uint32_t x,
+                                                        uint32_t y) const;
+  inline wuffs_base__status set_color_u32_at(
+      uint32_t x,
+      uint32_t y,
+      wuffs_base__color_u32_argb_premul color);
+#endif  // __cplusplus
+
+} wuffs_base__pixel_buffer;
+
+static inline wuffs_base__pixel_buffer  //
+wuffs_base__null_pixel_buffer() {
+  wuffs_base__pixel_buffer ret;
+  ret.pixcfg = wuffs_base__null_pixel_config();
+  ret.private_impl.planes[0] = wuffs_base__empty_table_u8();
+  ret.private_impl.planes[1] = wuffs_base__empty_table_u8();
+  ret.private_impl.planes[2] = wuffs_base__empty_table_u8();
+  ret.private_impl.planes[3] = wuffs_base__empty_table_u8();
+  return ret;
+}
+
+static inline wuffs_base__status  //
+wuffs_base__pixel_buffer__set_from_slice(wuffs_base__pixel_buffer* pb,
+                                         const wuffs_base__pixel_config* pixcfg,
+                                         wuffs_base__slice_u8 pixbuf_memory) {
+  if (!pb) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  memset(pb, 0, sizeof(*pb));
+  if (!pixcfg) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  if (wuffs_base__pixel_format__is_planar(&pixcfg->private_impl.pixfmt)) {
+    // Split the pixbuf_memory into one table per plane, in the same layout
+    // as used by wuffs_base__pixel_config__pixbuf_len.
+    wuffs_base__table_u8 tabs[WUFFS_BASE__PIXEL_FORMAT__NUM_PLANES_MAX];
+    uint8_t* ptr = pixbuf_memory.ptr;
+    uint64_t len = pixbuf_memory.len;
+    uint32_t num_planes =
+        wuffs_base__pixel_format__num_planes(&pixcfg->private_impl.pixfmt);
+    uint32_t p;
+    for (p = 0; p < num_planes; p++) {
+      if (((pixcfg->private_impl.pixfmt.repr >> (4 * p)) & 0x0F) != 0x08) {
+        // TODO: support other bit depths and multi-channel planes.
+        return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+      }
+      uint64_t dx = wuffs_base__pixel_subsampling__denominator_x(
+          &pixcfg->private_impl.pixsub, p);
+      uint64_t dy = wuffs_base__pixel_subsampling__denominator_y(
+          &pixcfg->private_impl.pixsub, p);
+      uint64_t w = (((uint64_t)pixcfg->private_impl.width) +
+                    wuffs_base__pixel_subsampling__bias_x(
+                        &pixcfg->private_impl.pixsub, p) +
+                    dx - 1) /
+                   dx;
+      uint64_t h = (((uint64_t)pixcfg->private_impl.height) +
+                    wuffs_base__pixel_subsampling__bias_y(
+                        &pixcfg->private_impl.pixsub, p) +
+                    dy - 1) /
+                   dy;
+      uint64_t wh = w * h;
+      if ((w > SIZE_MAX) || (wh > len)) {
+        return wuffs_base__make_status(
+            wuffs_base__error__bad_argument_length_too_short);
+      }
+      tabs[p].ptr = ptr;
+      tabs[p].width = (size_t)w;
+      tabs[p].height = (size_t)h;
+      tabs[p].stride = (size_t)w;
+      ptr += wh;
+      len -= wh;
+    }
+
+    pb->pixcfg = *pixcfg;
+    for (p = 0; p < num_planes; p++) {
+      pb->private_impl.planes[p] = tabs[p];
+    }
+    return wuffs_base__make_status(NULL);
+  }
+  uint32_t bits_per_pixel =
+      wuffs_base__pixel_format__bits_per_pixel(&pixcfg->private_impl.pixfmt);
+  if ((bits_per_pixel == 0) || ((bits_per_pixel % 8) != 0)) {
+    // TODO: support fraction-of-byte pixels, e.g. 1 bit per pixel?
+    return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+  }
+  uint64_t bytes_per_pixel = bits_per_pixel / 8;
+
+  uint8_t* ptr = pixbuf_memory.ptr;
+  uint64_t len = pixbuf_memory.len;
+  if (wuffs_base__pixel_format__is_indexed(&pixcfg->private_impl.pixfmt)) {
+    // Split a 1024 byte chunk (256 palette entries × 4 bytes per entry) from
+    // the start of pixbuf_memory. We split from the start, not the end, so
+    // that the both chunks' pointers have the same alignment as the original
+    // pointer, up to an alignment of 1024.
+    if (len < 1024) {
+      return wuffs_base__make_status(
+          wuffs_base__error__bad_argument_length_too_short);
+    }
+    wuffs_base__table_u8* tab =
+        &pb->private_impl
+             .planes[WUFFS_BASE__PIXEL_FORMAT__INDEXED__COLOR_PLANE];
+    tab->ptr = ptr;
+    tab->width = 1024;
+    tab->height = 1;
+    tab->stride = 1024;
+    ptr += 1024;
+    len -= 1024;
+  }
+
+  uint64_t wh = ((uint64_t)pixcfg->private_impl.width) *
+                ((uint64_t)pixcfg->private_impl.height);
+  size_t width = (size_t)(pixcfg->private_impl.width);
+  if ((wh > (UINT64_MAX / bytes_per_pixel)) ||
+      (width > (SIZE_MAX / bytes_per_pixel))) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  wh *= bytes_per_pixel;
+  width *= bytes_per_pixel;
+  if (wh > len) {
+    return wuffs_base__make_status(
+        wuffs_base__error__bad_argument_length_too_short);
+  }
+
+  pb->pixcfg = *pixcfg;
+  wuffs_base__table_u8* tab = &pb->private_impl.planes[0];
+  tab->ptr = ptr;
+  tab->width = width;
+  tab->height = pixcfg->private_impl.height;
+  tab->stride = width;
+  return wuffs_base__make_status(NULL);
+}
+
+static inline wuffs_base__status  //
+wuffs_base__pixel_buffer__set_from_table(wuffs_base__pixel_buffer* pb,
+                                         const wuffs_base__pixel_config* pixcfg,
+                                         wuffs_base__table_u8 pixbuf_memory) {
+  if (!pb) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  memset(pb, 0, sizeof(*pb));
+  if (!pixcfg ||
+      wuffs_base__pixel_format__is_planar(&pixcfg->private_impl.pixfmt)) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  uint32_t bits_per_pixel =
+      wuffs_base__pixel_format__bits_per_pixel(&pixcfg->private_impl.pixfmt);
+  if ((bits_per_pixel == 0) || ((bits_per_pixel % 8) != 0)) {
+    // TODO: support fraction-of-byte pixels, e.g. 1 bit per pixel?
+    return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+  }
+  uint64_t bytes_per_pixel = bits_per_pixel / 8;
+
+  uint64_t width_in_bytes =
+      ((uint64_t)pixcfg->private_impl.width) * bytes_per_pixel;
+  if ((width_in_bytes > pixbuf_memory.width) ||
+      (pixcfg->private_impl.height > pixbuf_memory.height)) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+
+  pb->pixcfg = *pixcfg;
+  pb->private_impl.planes[0] = pixbuf_memory;
+  return wuffs_base__make_status(NULL);
+}
+
+// wuffs_base__pixel_buffer__palette returns the palette color data. If
+// non-empty, it will have length 1024.
+static inline wuffs_base__slice_u8  //
+wuffs_base__pixel_buffer__palette(wuffs_base__pixel_buffer* pb) {
+  if (pb &&
+      wuffs_base__pixel_format__is_indexed(&pb->pixcfg.private_impl.pixfmt)) {
+    wuffs_base__table_u8* tab =
+        &pb->private_impl
+             .planes[WUFFS_BASE__PIXEL_FORMAT__INDEXED__COLOR_PLANE];
+    if ((tab->width == 1024) && (tab->height == 1)) {
+      return wuffs_base__make_slice_u8(tab->ptr, 1024);
+    }
+  }
+  return wuffs_base__make_slice_u8(NULL, 0);
+}
+
+static inline wuffs_base__pixel_format  //
+wuffs_base__pixel_buffer__pixel_format(const wuffs_base__pixel_buffer* pb) {
+  if (pb) {
+    return pb->pixcfg.private_impl.pixfmt;
+  }
+  return wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__INVALID);
+}
+
+static inline wuffs_base__table_u8  //
+wuffs_base__pixel_buffer__plane(wuffs_base__pixel_buffer* pb, uint32_t p) {
+  if (pb && (p < WUFFS_BASE__PIXEL_FORMAT__NUM_PLANES_MAX)) {
+    return pb->private_impl.planes[p];
+  }
+
+  wuffs_base__table_u8 ret;
+  ret.ptr = NULL;
+  ret.width = 0;
+  ret.height = 0;
+  ret.stride = 0;
+  return ret;
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__color_u32_argb_premul  //
+wuffs_base__pixel_buffer__color_u32_at(const wuffs_base__pixel_buffer* pb,
+                                       uint32_t x,
+                                       uint32_t y);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_buffer__set_color_u32_at(
+    wuffs_base__pixel_buffer* pb,
+    uint32_t x,
+    uint32_t y,
+    wuffs_base__color_u32_argb_premul color);
+
+#ifdef __cplusplus
+
+inline wuffs_base__status  //
+wuffs_base__pixel_buffer::set_from_slice(
+    const wuffs_base__pixel_config* pixcfg_arg,
+    wuffs_base__slice_u8 pixbuf_memory) {
+  return wuffs_base__pixel_buffer__set_from_slice(this, pixcfg_arg,
+                                                  pixbuf_memory);
+}
+
+inline wuffs_base__status  //
+wuffs_base__pixel_buffer::set_from_table(
+    const wuffs_base__pixel_config* pixcfg_arg,
+    wuffs_base__table_u8 pixbuf_memory) {
+  return wuffs_base__pixel_buffer__set_from_table(this, pixcfg_arg,
+                                                  pixbuf_memory);
+}
+
+inline wuffs_base__slice_u8  //
+wuffs_base__pixel_buffer::palette() {
+  return wuffs_base__pixel_buffer__palette(this);
+}
+
+inline wuffs_base__pixel_format  //
+wuffs_base__pixel_buffer::pixel_format() const {
+  return wuffs_base__pixel_buffer__pixel_format(this);
+}
+
+inline wuffs_base__table_u8  //
+wuffs_base__pixel_buffer::plane(uint32_t p) {
+  return wuffs_base__pixel_buffer__plane(this, p);
+}
+
+inline wuffs_base__color_u32_argb_premul  //
+wuffs_base__pixel_buffer::color_u32_at(uint32_t x, uint32_t y) const {
+  return wuffs_base__pixel_buffer__color_u32_at(this, x, y);
+}
+
+inline wuffs_base__status  //
+wuffs_base__pixel_buffer::set_color_u32_at(
+    uint32_t x,
+    uint32_t y,
+    wuffs_base__color_u32_argb_premul color) {
+  return wuffs_base__pixel_buffer__set_color_u32_at(this, x, y, color);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+// wuffs_base__decode_frame_options are optional arguments to an image
+// decoder's decode_frame method. A NULL pointer is equivalent to the options
+// returned by wuffs_base__null_decode_frame_options.
+//
+// The scale_shift option, ranging from 0 to 3 inclusive, downscales the frame
+// by a factor of (1 << scale_shift) in each dimension, using nearest neighbor
+// sampling: the source pixel at (x, y) is written to the destination pixel at
+// ((x >> scale_shift), (y >> scale_shift)) if both x and y are multiples of
+// that factor, and is not written at all otherwise. The destination
+// pixel_buffer only needs to be as large as the scale_rect of the image
+// bounds. A decoder's frame_dirty_rect is also in scaled coordinates, but its
+// frame_config bounds are not, as they are decoded before the options apply.
+//
+// The crop_rect option, in source (image) coordinates, restricts decoding to
+// a region of interest. Source pixels outside of it are not written (or even
+// converted to the destination pixel format) and the source pixel at (x, y)
+// is written as if it were at ((x - crop.min_incl_x), (y - crop.min_incl_y)),
+// before any scaling. The destination pixel_buffer only needs to be as large
+// as the dst_rect of the image bounds. An empty crop_rect (the default) means
+// no cropping.
+//
+// The band_height option, if non-zero, lets the destination pixel_buffer hold
+// only band_height rows (of the dst_rect's width) instead of the whole frame,
+// so that peak memory use does not depend on the image height. The dst_rect
+// is partitioned into bands of band_height rows each (the last band may be
+// shorter) and the destination row y is written to the pixel_buffer row (y -
+// band.min_incl_y). Before writing the first row of the next band, the
+// decoder suspends with wuffs_base__suspension__short_write. The caller
+// should then consume the completed band, whose rows are given by the
+// decoder's frame_dirty_rect, and call decode_frame again with the same
+// arguments. Once decode_frame returns OK, frame_dirty_rect gives the final
+// band. Every band is reported exactly once, in the order that the image
+// format stores its rows (e.g. bottom-up for most BMP images), even if no
+// pixels in it were written, and pixels that the image data does not write
+// (e.g. those skipped over by BMP RLE deltas) are left as-is, so callers may
+// want to clear the pixel_buffer between bands. Decoders that cannot stream
+// bands (e.g. because they can revisit previous rows, as interlaced GIF frames
+// do) fail with wuffs_base__error__unsupported_option.
+typedef struct {
+  // Do not access the private_impl's fields directly. There is no API/ABI
+  // compatibility or safety guarantee if you do so.
+  struct {
+    uint32_t scale_shift;
+    wuffs_base__rect_ie_u32 crop_rect;
+    uint32_t band_height;
+  } private_impl;
+
+#ifdef __cplusplus
+  inline void set_scale_shift(uint32_t scale_shift);
+  inline uint32_t scale_shift() const;
+  inline wuffs_base__rect_ie_u32 scale_rect(wuffs_base__rect_ie_u32 r) const;
+  inline void set_crop_rect(wuffs_base__rect_ie_u32 crop_rect);
+  inline wuffs_base__rect_ie_u32 crop_rect() const;
+  inline uint32_t crop_min_incl_x() const;
+  inline uint32_t crop_min_incl_y() const;
+  inline uint32_t crop_max_excl_x() const;
+  inline uint32_t crop_max_excl_y() const;
+  inline wuffs_base__rect_ie_u32 dst_rect(wuffs_base__rect_ie_u32 r) const;
+  inline void set_band_height(uint32_t band_height);
+  inline uint32_t band_height() const;
+#endif  // __cplusplus
+
+} wuffs_base__decode_frame_options;
+
+#define WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL 3
+
+static inline wuffs_base__decode_frame_options  //
+wuffs_base__null_decode_frame_options() {
+  wuffs_base__decode_frame_options ret;
+  ret.private_impl.scale_shift = 0;
+  ret.private_impl.crop_rect = wuffs_base__empty_rect_ie_u32();
+  ret.private_impl.band_height = 0;
+  return ret;
+}
+
+// wuffs_base__decode_frame_options__set_scale_shift sets the scale_shift,
+// clamping it to WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL.
+static inline void  //
+wuffs_base__decode_frame_options__set_scale_shift(
+    wuffs_base__decode_frame_options* o,
+    uint32_t scale_shift) {
+  if (!o) {
+    return;
+  }
+  o->private_impl.scale_shift =
+      (scale_shift < WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL)
+          ? scale_shift
+          : WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL;
+}
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__scale_shift(
+    const wuffs_base__decode_frame_options* o) {
+  return o ? o->private_impl.scale_shift : 0;
+}
+
+// wuffs_base__decode_frame_options__scale_rect returns the rectangle, in
+// destination coordinates, that the source rectangle r is written to. Each
+// bound is divided by (1 << scale_shift), rounding up, so that e.g. a 5 pixel
+// wide image is scaled by a half to be 3 pixels wide.
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options__scale_rect(
+    const wuffs_base__decode_frame_options* o,
+    wuffs_base__rect_ie_u32 r) {
+  uint32_t s = wuffs_base__decode_frame_options__scale_shift(o);
+  uint64_t m = (((uint64_t)1) << s) - 1;
+  wuffs_base__rect_ie_u32 ret;
+  ret.min_incl_x = (uint32_t)((r.min_incl_x + m) >> s);
+  ret.min_incl_y = (uint32_t)((r.min_incl_y + m) >> s);
+  ret.max_excl_x = (uint32_t)((r.max_excl_x + m) >> s);
+  ret.max_excl_y = (uint32_t)((r.max_excl_y + m) >> s);
+  return ret;
+}
+
+static inline void  //
+wuffs_base__decode_frame_options__set_crop_rect(
+    wuffs_base__decode_frame_options* o,
+    wuffs_base__rect_ie_u32 crop_rect) {
+  if (!o) {
+    return;
+  }
+  o->private_impl.crop_rect = crop_rect;
+}
+
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options__crop_rect(
+    const wuffs_base__decode_frame_options* o) {
+  return o ? o->private_impl.crop_rect : wuffs_base__empty_rect_ie_u32();
+}
+
+// wuffs_base__decode_frame_options__crop_min_incl_x etc. return the crop_rect
+// bounds, treating an empty crop_rect (no cropping) as the largest possible
+// rectangle.
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__crop_min_incl_x(
+    const wuffs_base__decode_frame_options* o) {
+  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))
+             ? 0
+             : o->private_impl.crop_rect.min_incl_x;
+}
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__crop_min_incl_y(
+    const wuffs_base__decode_frame_options* o) {
+  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))
+             ? 0
+             : o->private_impl.crop_rect.min_incl_y;
+}
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__crop_max_excl_x(
+    const wuffs_base__decode_frame_options* o) {
+  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))
+             ? 0xFFFFFFFF
+             : o->private_impl.crop_rect.max_excl_x;
+}
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__crop_max_excl_y(
+    const wuffs_base__decode_frame_options* o) {
+  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))
+             ? 0xFFFFFFFF
+             : o->private_impl.crop_rect.max_excl_y;
+}
+
+// wuffs_base__decode_frame_options__dst_rect returns the rectangle, in
+// destination coordinates, that the source rectangle r is written to: r is
+// intersected with the crop_rect (if non-empty), translated so that the
+// crop_rect's top-left corner is the origin and then scaled.
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options__dst_rect(
+    const wuffs_base__decode_frame_options* o,
+    wuffs_base__rect_ie_u32 r) {
+  uint32_t x0 = wuffs_base__decode_frame_options__crop_min_incl_x(o);
+  uint32_t y0 = wuffs_base__decode_frame_options__crop_min_incl_y(o);
+  r = wuffs_base__rect_ie_u32__intersect(
+      &r, wuffs_base__make_rect_ie_u32(
+              x0, y0, wuffs_base__decode_frame_options__crop_max_excl_x(o),
+              wuffs_base__decode_frame_options__crop_max_excl_y(o)));
+  if (wuffs_base__rect_ie_u32__is_empty(&r)) {
+    return wuffs_base__empty_rect_ie_u32();
+  }
+  r.min_incl_x -= x0;
+  r.min_incl_y -= y0;
+  r.max_excl_x -= x0;
+  r.max_excl_y -= y0;
+  return wuffs_base__decode_frame_options__scale_rect(o, r);
+}
+
+// wuffs_base__decode_frame_options__set_band_height sets the band_height. Zero
+// (the default) means that the whole frame is decoded in one go.
+static inline void  //
+wuffs_base__decode_frame_options__set_band_height(
+    wuffs_base__decode_frame_options* o,
+    uint32_t band_height) {
+  if (!o) {
+    return;
+  }
+  o->private_impl.band_height = band_height;
+}
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__band_height(
+    const wuffs_base__decode_frame_options* o) {
+  return o ? o->private_impl.band_height : 0;
+}
+
+#ifdef __cplusplus
+
+inline void  //
+wuffs_base__decode_frame_options::set_scale_shift(uint32_t scale_shift) {
+  wuffs_base__decode_frame_options__set_scale_shift(this, scale_shift);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::scale_shift() const {
+  return wuffs_base__decode_frame_options__scale_shift(this);
+}
+
+inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options::scale_rect(wuffs_base__rect_ie_u32 r) const {
+  return wuffs_base__decode_frame_options__scale_rect(this, r);
+}
+
+inline void  //
+wuffs_base__decode_frame_options::set_crop_rect(
+    wuffs_base__rect_ie_u32 crop_rect) {
+  wuffs_base__decode_frame_options__set_crop_rect(this, crop_rect);
+}
+
+inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options::crop_rect() const {
+  return wuffs_base__decode_frame_options__crop_rect(this);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::crop_min_incl_x() const {
+  return wuffs_base__decode_frame_options__crop_min_incl_x(this);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::crop_min_incl_y() const {
+  return wuffs_base__decode_frame_options__crop_min_incl_y(this);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::crop_max_excl_x() const {
+  return wuffs_base__decode_frame_options__crop_max_excl_x(this);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::crop_max_excl_y() const {
+  return wuffs_base__decode_frame_options__crop_max_excl_y(this);
+}
+
+inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options::dst_rect(wuffs_base__rect_ie_u32 r) const {
+  return wuffs_base__decode_frame_options__dst_rect(this, r);
+}
+
+inline void  //
+wuffs_base__decode_frame_options::set_band_height(uint32_t band_height) {
+  wuffs_base__decode_frame_options__set_band_height(this, band_height);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::band_height() const {
+  return wuffs_base__decode_frame_options__band_height(this);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+// wuffs_base__pixel_palette__closest_element returns the index of the palette
+// element that minimizes the sum of squared differences of the four ARGB
+// channels, working in premultiplied alpha. Ties favor the smaller index.
+//
+// The palette_slice.len may equal (N*4), for N less than 256, which means that
+// only the first N palette elements are considered. It returns 0 when N is 0.
+//
+// Applying this function on a per-pixel basis will not produce whole-of-image
+// dithering.
+WUFFS_BASE__MAYBE_STATIC uint8_t  //
+wuffs_base__pixel_palette__closest_element(
+    wuffs_base__slice_u8 palette_slice,
+    wuffs_base__pixel_format palette_format,
+    wuffs_base__color_u32_argb_premul c);
+
+// --------
+
+#define WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE 4096
+
+// wuffs_base__pixel_palette_lookup speeds up repeatedly finding a palette's
+// closest element to a color. It is prepared once per palette and then gives
+// the same answers as wuffs_base__pixel_palette__closest_element, including
+// tie breaks, but faster: the palette is converted to premultiplied alpha and
+// sorted (by green) only once, so that a search can skip elements that are
+// too far away, and a direct-mapped cache remembers recently seen colors.
+//
+// Preparing a lookup copies the palette. Changing the palette afterwards
+// requires preparing the lookup again.
+//
+// It is about 25 KiB in size, which may be too large for some stacks.
+typedef struct {
+  // Do not access the private_impl's fields directly. There is no API/ABI
+  // compatibility or safety guarantee if you do so.
+  struct {
+    uint32_t num_elements;
+    // The elements are 16-bit premultiplied B, G, R and A values.
+    uint32_t elements[256][4];
+    uint8_t sorted_by_green[256];
+    uint32_t cache_colors[WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE];
+    uint8_t cache_indexes[WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE];
+  } private_impl;
+
+#ifdef __cplusplus
+  inline wuffs_base__status prepare(wuffs_base__slice_u8 palette_slice,
+                                    wuffs_base__pixel_format palette_format);
+  inline uint8_t closest_element(wuffs_base__color_u32_argb_premul c);
+#endif  // __cplusplus
+
+} wuffs_base__pixel_palette_lookup;
+
+// wuffs_base__pixel_palette_lookup__prepare readies the lookup for the given
+// palette, whose format should be one of the INDEXED__BGRA_ETC formats.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_palette_lookup__prepare(
+    wuffs_base__pixel_palette_lookup* p,
+    wuffs_base__slice_u8 palette_slice,
+    wuffs_base__pixel_format palette_format);
+
+// wuffs_base__pixel_palette_lookup__closest_element is like
+// wuffs_base__pixel_palette__closest_element for the prepared palette. It
+// updates the lookup's cache, so that p is not a const pointer.
+WUFFS_BASE__MAYBE_STATIC uint8_t  //
+wuffs_base__pixel_palette_lookup__closest_element(
+    wuffs_base__pixel_palette_lookup* p,
+    wuffs_base__color_u32_argb_premul c);
+
+#ifdef __cplusplus
+
+inline wuffs_base__status  //
+wuffs_base__pixel_palette_lookup::prepare(
+    wuffs_base__slice_u8 palette_slice,
+    wuffs_base__pixel_format palette_format) {
+  return wuffs_base__pixel_palette_lookup__prepare(this, palette_slice,
+                                                   palette_format);
+}
+
+inline uint8_t  //
+wuffs_base__pixel_palette_lookup::closest_element(
+    wuffs_base__color_u32_argb_premul c) {
+  return wuffs_base__pixel_palette_lookup__closest_element(this, c);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+// TODO: should the func type take restrict pointers?
+typedef uint64_t (*wuffs_base__pixel_swizzler__func)(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src);
+
+// wuffs_base__pixel_swizzler__planar_func converts one row of pixels whose
+// three planes (e.g. Y, Cb and Cr) have one sample per pixel. It returns the
+// number of pixels converted.
+typedef uint64_t (*wuffs_base__pixel_swizzler__planar_func)(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 src0,
+    wuffs_base__slice_u8 src1,
+    wuffs_base__slice_u8 src2);
+
+// wuffs_base__pixel_swizzler__quantize_func converts one row of pixels to
+// palette indexes. It returns the number of pixels converted.
+typedef uint64_t (*wuffs_base__pixel_swizzler__quantize_func)(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__slice_u8 src);
+
+typedef struct {
+  // Do not access the private_impl's fields directly. There is no API/ABI
+  // compatibility or safety guarantee if you do so.
+  struct {
+    wuffs_base__pixel_swizzler__func func;
+    wuffs_base__pixel_swizzler__planar_func planar_func;
+    wuffs_base__pixel_swizzler__quantize_func quantize_func;
+    wuffs_base__pixel_palette_lookup* lookup;
+  } private_impl;
+
+#ifdef __cplusplus
+  inline wuffs_base__status prepare(wuffs_base__pixel_format dst_format,
+                                    wuffs_base__slice_u8 dst_palette,
+                                    wuffs_base__pixel_format src_format,
+                                    wuffs_base__slice_u8 src_palette,
+                                    wuffs_base__pixel_blend blend);
+  inline wuffs_base__status prepare_quantizing(
+      wuffs_base__pixel_palette_lookup* lookup,
+      wuffs_base__pixel_format dst_format,
+      wuffs_base__slice_u8 dst_palette,
+      wuffs_base__pixel_format src_format,
+      wuffs_base__pixel_blend blend);
+  inline uint64_t swizzle_interleaved(wuffs_base__slice_u8 dst,
+                                      wuffs_base__slice_u8 dst_palette,
+                                      wuffs_base__slice_u8 src) const;
+  inline wuffs_base__status swizzle_planar(
+      wuffs_base__pixel_buffer* dst,
+      const wuffs_base__pixel_buffer* src) const;
+#endif  // __cplusplus
+
+} wuffs_base__pixel_swizzler;
+
+// wuffs_base__pixel_swizzler__prepare readies the pixel swizzler so that its
+// other methods may be called.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_swizzler__prepare(wuffs_base__pixel_swizzler* p,
+                                    wuffs_base__pixel_format dst_format,
+                                    wuffs_base__slice_u8 dst_palette,
+                                    wuffs_base__pixel_format src_format,
+                                    wuffs_base__slice_u8 src_palette,
+                                    wuffs_base__pixel_blend blend);
+
+// wuffs_base__pixel_swizzler__prepare_quantizing is like
+// wuffs_base__pixel_swizzler__prepare, for converting direct color (such as Y,
+// BGR or BGRA) to palette indexes. The dst_format should be one of the
+// INDEXED__BGRA_ETC formats and the dst_palette holds its palette. This
+// prepares the lookup for that palette (see
+// wuffs_base__pixel_palette_lookup__prepare), and the lookup must outlive the
+// swizzler's use. Each pixel is mapped to its closest palette element.
+//
+// Subsequent swizzle_interleaved calls ignore their dst_palette argument. The
+// palette is the one given here, via the lookup.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_swizzler__prepare_quantizing(
+    wuffs_base__pixel_swizzler* p,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__pixel_format dst_format,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__pixel_format src_format,
+    wuffs_base__pixel_blend blend);
+
+// wuffs_base__pixel_swizzler__swizzle_interleaved converts pixels from a
+// source format to a destination format.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC uint64_t  //
+wuffs_base__pixel_swizzler__swizzle_interleaved(
+    const wuffs_base__pixel_swizzler* p,
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src);
+
+// wuffs_base__pixel_swizzler__swizzle_planar converts a whole planar pixel
+// buffer, such as YCbCr, to an interleaved one, such as BGRA. The swizzler
+// must have been prepared with the src pixel buffer's (planar) pixel format,
+// and the dst pixel buffer's pixel format.
+//
+// The two pixel buffers' top-left corners are aligned. The pixels converted
+// are those in both pixel buffers: the minimum of their widths and heights.
+// Subsampled (chroma) planes are upsampled by sample replication, conscious
+// of the src pixel buffer's pixel subsampling.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_swizzler__swizzle_planar(const wuffs_base__pixel_swizzler* p,
+                                           wuffs_base__pixel_buffer* dst,
+                                           const wuffs_base__pixel_buffer* src);
+
+#ifdef __cplusplus
+
+inline wuffs_base__status  //
+wuffs_base__pixel_swizzler::prepare(wuffs_base__pixel_format dst_format,
+                                    wuffs_base__slice_u8 dst_palette,
+                                    wuffs_base__pixel_format src_format,
+                                    wuffs_base__slice_u8 src_palette,
+                                    wuffs_base__pixel_blend blend) {
+  return wuffs_base__pixel_swizzler__prepare(this, dst_format, dst_palette,
+                                             src_format, src_palette, blend);
+}
+
+inline wuffs_base__status  //
+wuffs_base__pixel_swizzler::prepare_quantizing(
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__pixel_format dst_format,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__pixel_format src_format,
+    wuffs_base__pixel_blend blend) {
+  return wuffs_base__pixel_swizzler__prepare_quantizing(
+      this, lookup, dst_format, dst_palette, src_format, blend);
+}
+
+uint64_t  //
+wuffs_base__pixel_swizzler::swizzle_interleaved(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) const {
+  return wuffs_base__pixel_swizzler__swizzle_interleaved(this, dst, dst_palette,
+                                                         src);
+}
+
+inline wuffs_base__status  //
+wuffs_base__pixel_swizzler::swizzle_planar(
+    wuffs_base__pixel_buffer* dst,
+    const wuffs_base__pixel_buffer* src) const {
+  return wuffs_base__pixel_swizzler__swizzle_planar(this, dst, src);
+}
+
+#endif  // __cplusplus
+
+// ---------------- String Conversions
+
+// wuffs_base__parse_number_i64 parses the ASCII integer in s. For example, if
+// s contains the bytes "-123" then it will return the int64_t -123.
+//
+// It returns an error if s does not contain an integer or if the integer
+// within would overflow an int64_t.
+//
+// It is similar to wuffs_base__parse_number_u64 but it returns a signed
+// integer, not an unsigned integer. It also allows a leading '+' or '-'.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__result_i64  //
+wuffs_base__parse_number_i64(wuffs_base__slice_u8 s);
+
+// wuffs_base__parse_number_u64 parses the ASCII integer in s. For example, if
+// s contains the bytes "123" then it will return the uint64_t 123.
+//
+// It returns an error if s does not contain an integer or if the integer
+// within would overflow a uint64_t.
+//
+// It is similar to the C standard library's strtoull function, but:
+//  - Errors are returned in-band (in a result type), not out-of-band (errno).
+//  - It takes a slice (a pointer and length), not a NUL-terminated C string.
+//  - It does not take an optional endptr argument. It does not allow a partial
+//    parse: it returns an error unless all of s is consumed.
+//  - It does not allow whitespace, leading or otherwise.
+//  - It does not allow a leading '+' or '-'.
+//  - It does not allow unnecessary leading zeroes ("0" is valid and its sole
+//    zero is necessary). All of "00", "0644" and "007" are invalid.
+//  - It does not take a base argument (e.g. base 10 vs base 16). Instead, it
+//    always accepts both decimal (e.g "1234", "0d5678") and hexadecimal (e.g.
+//    "0x9aBC"). The caller is responsible for prior filtering of e.g. hex
+//    numbers if they are unwanted. For example, Wuffs' JSON decoder will only
+//    produce a wuffs_base__token for decimal numbers, not hexadecimal.
+//  - It is not affected by i18n / l10n settings such as environment variables.
+//  - It does allow arbitrary underscores, except inside the optional 2-byte
+//    opening "0d" or "0X" that denotes base-10 or base-16. For example,
+//    "__0D_1_002" would successfully parse as "one thousand and two".
+WUFFS_BASE__MAYBE_STATIC wuffs_base__result_u64  //
+wuffs_base__parse_number_u64(wuffs_base__slice_u8 s);
+
+// --------
+
+// Options (bitwise or'ed together) for wuffs_base__render_number_xxx
+// functions. The XXX options apply to both integer and floating point. The FXX
+// options apply only to floating point.
+
+#define WUFFS_BASE__RENDER_NUMBER_XXX__DEFAULT_OPTIONS ((uint32_t)0x00000000)
+
+// WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN means to render a leading
+// "+" for non-negative numbers: "+0" and "+12.3" instead of "0" and "12.3".
+#define WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN ((uint32_t)0x00000001)
+
+// WUFFS_BASE__RENDER_NUMBER_FXX__INF_NAN_AS_NULL means to render infinities
+// and NaNs as "null" instead of "Infinity", "-Infinity" and "NaN". JSON has no
+// representation for non-finite numbers.
+#define WUFFS_BASE__RENDER_NUMBER_FXX__INF_NAN_AS_NULL ((uint32_t)0x00000100)
+
+// WUFFS_BASE__XXX__BYTE_LENGTH__MAX_INCL is the maximum number of bytes that
+// the corresponding wuffs_base__render_number_xxx function will write,
+// regardless of its options. For example, "-9223372036854775808" and
+// "+18446744073709551615" are 20 and 21 bytes long.
+#define WUFFS_BASE__I64__BYTE_LENGTH__MAX_INCL 20
+#define WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL 21
+#define WUFFS_BASE__F64__BYTE_LENGTH__MAX_INCL 25
+
+// wuffs_base__render_number_i64 writes the decimal representation of x to dst
+// and returns the number of bytes written. If dst is shorter than the entire
+// representation, it returns 0 (and no bytes are written).
+//
+// dst will never be too short if its length is at least 20, also known as
+// WUFFS_BASE__I64__BYTE_LENGTH__MAX_INCL.
+//
+// It is similar to wuffs_base__render_number_u64 but it takes a signed
+// integer, not an unsigned integer.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__render_number_i64(wuffs_base__slice_u8 dst,
+                              int64_t x,
+                              uint32_t options);
+
+// wuffs_base__render_number_u64 writes the decimal representation of x to dst
+// and returns the number of bytes written. If dst is shorter than the entire
+// representation, it returns 0 (and no bytes are written).
+//
+// dst will never be too short if its length is at least 21, also known as
+// WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL.
+//
+// Unlike snprintf, it does not write a trailing NUL byte.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__render_number_u64(wuffs_base__slice_u8 dst,
+                              uint64_t x,
+                              uint32_t options);
+
+// ---------------- IEEE 754 Floating Point
+
+// wuffs_base__parse_number_f64 parses the floating point number in s. For
+// example, if s contains the bytes "1.5" then it will return the double 1.5.
+//
+// It returns an error if s does not contain a floating point number.
+//
+// It does not necessarily return an error if the conversion is lossy, e.g. if
+// s is "0.3", which double-precision floating point cannot represent exactly.
+//
+// Similarly, the returned value may be infinite (and no error returned) even
+// if s was not "inf", when the input is nominally finite but sufficiently
+// larger than DBL_MAX, about 1.8e+308.
+//
+// It is similar to the C standard library's strtod function, but:
+//  - Errors are returned in-band (in a result type), not out-of-band (errno).
+//  - It takes a slice (a pointer and length), not a NUL-terminated C string.
+//  - It does not take an optional endptr argument. It does not allow a partial
+//    parse: it returns an error unless all of s is consumed.
+//  - It does not allow whitespace, leading or otherwise.
+//  - It does not allow unnecessary leading zeroes ("0" is valid and its sole
+//    zero is necessary). All of "00", "0644" and "00.7" are invalid.
+//  - It is not affected by i18n / l10n settings such as environment variables.
+//  - Conversely, it always accepts either ',' or '.' as a decimal separator.
+//    In particular, "3,141,592" is always invalid but "3,141" is always valid
+//    (and approximately π). The caller is responsible for e.g. previously
+//    rejecting or filtering s if it contains a comma, if that is unacceptable
+//    to the caller. For example, JSON numbers always use a dot '.' and never a
+//    comma ',', regardless of the LOCALE environment variable.
+//  - It does allow arbitrary underscores. For example, "_3.141_592" would
+//    successfully parse, again approximately π.
+//  - It does allow "inf", "+Infinity" and "-NAN", case insensitive, but it
+//    does not permit "nan" to be followed by an integer mantissa.
+//  - It does not allow hexadecimal floating point numbers.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__F64CONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__result_f64  //
+wuffs_base__parse_number_f64(wuffs_base__slice_u8 s);
+
+// wuffs_base__render_number_f64 writes the decimal representation of x to dst
+// and returns the number of bytes written. If dst is shorter than the entire
+// representation, it returns 0 (and no bytes are written).
+//
+// dst will never be too short if its length is at least 25, also known as
+// WUFFS_BASE__F64__BYTE_LENGTH__MAX_INCL.
+//
+// The representation has the fewest significant digits that still round-trip:
+// wuffs_base__parse_number_f64 of the rendered bytes produces exactly x. When
+// there is more than one such shortest representation, it picks the one
+// closest to x. For example, it renders 0.3 as "0.3", not
+// "0.299999999999999988898" or "0.30000000000000000".
+//
+// The layout otherwise follows ECMAScript's Number.prototype.toString: a
+// decimal separator is always '.', never ','; positional notation is used when
+// the base-10 exponent is in the range [-6 ..= 20]; otherwise it uses
+// exponential notation with an explicit exponent sign. For example, "123",
+// "0.000456" and "1.5e+300". Unlike ECMAScript, negative zero is rendered as
+// "-0", since "0" would not round-trip.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__F64CONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__render_number_f64(wuffs_base__slice_u8 dst,
+                              double x,
+                              uint32_t options);
+
+// wuffs_base__ieee_754_bit_representation__etc converts between a double
+// precision numerical value and its IEEE 754 64-bit representation (1 sign
+// bit, 11 exponent bits, 52 explicit significand bits).
+//
+// For example, it converts between:
+//  - +1.0 and 0x3FF0_0000_0000_0000.
+//  - +5.5 and 0x4016_0000_0000_0000.
+//  - -inf and 0xFFF0_0000_0000_0000.
+//
+// See https://en.wikipedia.org/wiki/Double-precision_floating-point_format
+
+static inline uint64_t  //
+wuffs_base__ieee_754_bit_representation__from_f64(double f) {
+  uint64_t u = 0;
+  if (sizeof(uint64_t) == sizeof(double)) {
+    memcpy(&u, &f, sizeof(uint64_t));
+  }
+  return u;
+}
+
+static inline double  //
+wuffs_base__ieee_754_bit_representation__to_f64(uint64_t u) {
+  double f = 0;
+  if (sizeof(uint64_t) == sizeof(double)) {
+    memcpy(&f, &u, sizeof(uint64_t));
+  }
+  return f;
+}
+
+// ---------------- Hexadecimal
+
+// wuffs_base__hexadecimal__decode2 converts "6A6b" to "jk", where e.g. 'j' is
+// U+006A. There are 2 source bytes for every destination byte.
+//
+// It returns the number of dst bytes written: the minimum of dst.len and
+// (src.len / 2). Excess source bytes are ignored.
+//
+// It assumes that the src bytes are two hexadecimal digits (0-9, A-F, a-f),
+// repeated. It may write nonsense bytes if not, although it will not read or
+// write out of bounds.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__hexadecimal__decode2(wuffs_base__slice_u8 dst,
+                                 wuffs_base__slice_u8 src);
+
+// wuffs_base__hexadecimal__decode4 converts "\\x6A\\x6b" to "jk", where e.g.
+// 'j' is U+006A. There are 4 source bytes for every destination byte.
+//
+// It returns the number of dst bytes written: the minimum of dst.len and
+// (src.len / 4). Excess source bytes are ignored.
+//
+// It assumes that the src bytes are two ignored bytes and then two hexadecimal
+// digits (0-9, A-F, a-f), repeated. It may write nonsense bytes if not,
+// although it will not read or write out of bounds.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__hexadecimal__decode4(wuffs_base__slice_u8 dst,
+                                 wuffs_base__slice_u8 src);
+
+// ---------------- Unicode and UTF-8
+
+#define WUFFS_BASE__UNICODE_CODE_POINT__MIN_INCL 0x00000000
+#define WUFFS_BASE__UNICODE_CODE_POINT__MAX_INCL 0x0010FFFF
+
+#define WUFFS_BASE__UNICODE_REPLACEMENT_CHARACTER 0x0000FFFD
+
+#define WUFFS_BASE__UNICODE_SURROGATE__MIN_INCL 0x0000D800
+#define WUFFS_BASE__UNICODE_SURROGATE__MAX_INCL 0x0000DFFF
+
+#define WUFFS_BASE__ASCII__MIN_INCL 0x00
+#define WUFFS_BASE__ASCII__MAX_INCL 0x7F
+
+#define WUFFS_BASE__UTF_8__BYTE_LENGTH__MIN_INCL 1
+#define WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL 4
+
+#define WUFFS_BASE__UTF_8__BYTE_LENGTH_1__CODE_POINT__MIN_INCL 0x00000000
+#define WUFFS_BASE__UTF_8__BYTE_LENGTH_1__CODE_POINT__MAX_INCL 0x0000007F
+#define WUFFS_BASE__UTF_8__BYTE_LENGTH_2__CODE_POINT__MIN_INCL 0x00000080
+#define WUFFS_BASE__UTF_8__BYTE_LENGTH_2__CODE_POINT__MAX_INCL 0x000007FF
+#define WUFFS_BASE__UTF_8__BYTE_LENGTH_3__CODE_POINT__MIN_INCL 0x00000800
+#define WUFFS_BASE__UTF_8__BYTE_LENGTH_3__CODE_POINT__MAX_INCL 0x0000FFFF
+#define WUFFS_BASE__UTF_8__BYTE_LENGTH_4__CODE_POINT__MIN_INCL 0x00010000
+#define WUFFS_BASE__UTF_8__BYTE_LENGTH_4__CODE_POINT__MAX_INCL 0x0010FFFF
+
+// --------
+
+// wuffs_base__utf_8__next__output is the type returned by
+// wuffs_base__utf_8__next.
+typedef struct {
+  uint32_t code_point;
+  uint32_t byte_length;
+
+#ifdef __cplusplus
+  inline bool is_valid() const;
+#endif  // __cplusplus
+
+} wuffs_base__utf_8__next__output;
+
+static inline wuffs_base__utf_8__next__output  //
+wuffs_base__make_utf_8__next__output(uint32_t code_point,
+                                     uint32_t byte_length) {
+  wuffs_base__utf_8__next__output ret;
+  ret.code_point = code_point;
+  ret.byte_length = byte_length;
+  return ret;
+}
+
+static inline bool  //
+wuffs_base__utf_8__next__output__is_valid(
+    const wuffs_base__utf_8__next__output* o) {
+  if (o) {
+    uint32_t cp = o->code_point;
+    switch (o->byte_length) {
+      case 1:
+        return (cp <= 0x7F);
+      case 2:
+        return (0x080 <= cp) && (cp <= 0x7FF);
+      case 3:
+        // Avoid the 0xD800 ..= 0xDFFF surrogate range.
+        return ((0x0800 <= cp) && (cp <= 0xD7FF)) ||
+               ((0xE000 <= cp) && (cp <= 0xFFFF));
+      case 4:
+        return (0x00010000 <= cp) && (cp <= 0x0010FFFF);
+    }
+  }
+  return false;
+}
+
+#ifdef __cplusplus
+
+inline bool  //
+wuffs_base__utf_8__next__output::is_valid() const {
+  return wuffs_base__utf_8__next__output__is_valid(this);
+}
+
+#endif  // __cplusplus
+
+// --------
+
+// wuffs_base__utf_8__encode writes the UTF-8 encoding of code_point to s and
+// returns the number of bytes written. If code_point is invalid, or if s is
+// shorter than the entire encoding, it returns 0 (and no bytes are written).
+//
+// s will never be too short if its length is at least 4, also known as
+// WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__utf_8__encode(wuffs_base__slice_u8 dst, uint32_t code_point);
+
+// wuffs_base__utf_8__next returns the next UTF-8 code point (and that code
+// point's byte length) at the start of s.
+//
+// There are exactly two cases in which this function returns something where
+// wuffs_base__utf_8__next__output__is_valid is false:
+//  - If s is empty then it returns {.code_point=0, .byte_length=0}.
+//  - If s is non-empty and starts with invalid UTF-8 then it returns
+//    {.code_point=WUFFS_BASE__UNICODE_REPLACEMENT_CHARACTER, .byte_length=1}.
+//
+// Otherwise, it returns something where
+// wuffs_base__utf_8__next__output__is_valid is true.
+//
+// In any case, it always returns an output that satisfies both of:
+//  - (output.code_point  <= WUFFS_BASE__UNICODE_CODE_POINT__MAX_INCL).
+//  - (output.byte_length <= s.len).
+//
+// If s is a sub-slice of a larger slice of valid UTF-8, but that sub-slice
+// boundary occurs in the middle of a multi-byte UTF-8 encoding of a single
+// code point, then this function may return something invalid. It is the
+// caller's responsibility to split on or otherwise manage UTF-8 boundaries.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__utf_8__next__output  //
+wuffs_base__utf_8__next(wuffs_base__slice_u8 s);
+
+// wuffs_base__utf_8__longest_valid_prefix returns the largest n such that the
+// sub-slice s[..n] is valid UTF-8.
+//
+// In particular, it returns s.len if and only if all of s is valid UTF-8.
+//
+// If s is a sub-slice of a larger slice of valid UTF-8, but that sub-slice
+// boundary occurs in the middle of a multi-byte UTF-8 encoding of a single
+// code point, then this function will return less than s.len. It is the
+// caller's responsibility to split on or otherwise manage UTF-8 boundaries.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__utf_8__longest_valid_prefix(wuffs_base__slice_u8 s);
+
+// wuffs_base__ascii__longest_valid_prefix returns the largest n such that the
+// sub-slice s[..n] is valid ASCII.
+//
+// In particular, it returns s.len if and only if all of s is valid ASCII.
+// Equivalently, when none of the bytes in s have the 0x80 high bit set.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__ascii__longest_valid_prefix(wuffs_base__slice_u8 s);
+
+
+// ---------------- Interface Declarations.
+
+// For modular builds that divide the base module into sub-modules, using these
+// functions require the WUFFS_CONFIG__MODULE__BASE__INTERFACES sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+
+// --------
+
+extern const char* wuffs_base__hasher_u32__vtable_name;
+
+typedef struct {
+
+wuffs_base__empty_struct (*set_quirk_enabled)(void* self,uint32_t a_quirk,bool a_enabled);
+uint32_t(*update_u32)(void* self,wuffs_base__slice_u8 a_x);
+} wuffs_base__hasher_u32__func_ptrs;
+
+typedef struct wuffs_base__hasher_u32__struct wuffs_base__hasher_u32;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_base__hasher_u32__set_quirk_enabled(wuffs_base__hasher_u32 *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_base__hasher_u32__update_u32(wuffs_base__hasher_u32 *self,wuffs_base__slice_u8 a_x);
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_base__hasher_u32__struct {struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable first_vtable;
+} private_impl;
+
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_base__hasher_u32, decltype(&free)>;#endif
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_base__hasher_u32__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline uint32_t//
+update_u32(wuffs_base__slice_u8 a_x){ return wuffs_base__hasher_u32__update_u32(this,a_x);}
+
+#endif  // __cplusplus
+
+};  // struct wuffs_base__hasher_u32__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+// --------
+
+extern const char* wuffs_base__image_decoder__vtable_name;
+
+typedef struct {
+
+wuffs_base__status (*decode_frame)(void* self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts);
+wuffs_base__status (*decode_frame_config)(void* self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src);
+wuffs_base__status (*decode_image_config)(void* self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src);
+wuffs_base__rect_ie_u32(*frame_dirty_rect)(const void* self);
+uint32_t(*num_animation_loops)(const void* self);
+uint64_t(*num_decoded_frame_configs)(const void* self);
+uint64_t(*num_decoded_frames)(const void* self);
+wuffs_base__status(*restart_frame)(void* self,uint64_t a_index,uint64_t a_io_position);
+wuffs_base__empty_struct (*set_quirk_enabled)(void* self,uint32_t a_quirk,bool a_enabled);
+wuffs_base__empty_struct (*set_report_metadata)(void* self,uint32_t a_fourcc,bool a_report);
+wuffs_base__status (*tell_me_more)(void* self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src);
+wuffs_base__range_ii_u64(*workbuf_len)(const void* self);
+} wuffs_base__image_decoder__func_ptrs;
+
+typedef struct wuffs_base__image_decoder__struct wuffs_base__image_decoder;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__image_decoder__decode_frame(wuffs_base__image_decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__image_decoder__decode_frame_config(wuffs_base__image_decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__image_decoder__decode_image_config(wuffs_base__image_decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_base__image_decoder__frame_dirty_rect(const wuffs_base__image_decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_base__image_decoder__num_animation_loops(const wuffs_base__image_decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_base__image_decoder__num_decoded_frame_configs(const wuffs_base__image_decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_base__image_decoder__num_decoded_frames(const wuffs_base__image_decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_base__image_decoder__restart_frame(wuffs_base__image_decoder *self,uint64_t a_index,uint64_t a_io_position);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_base__image_decoder__set_quirk_enabled(wuffs_base__image_decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_base__image_decoder__set_report_metadata(wuffs_base__image_decoder *self,uint32_t a_fourcc,bool a_report);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__image_decoder__tell_me_more(wuffs_base__image_decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_base__image_decoder__workbuf_len(const wuffs_base__image_decoder *self);
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_base__image_decoder__struct {struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable first_vtable;
+} private_impl;
+
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_base__image_decoder, decltype(&free)>;#endif
+
+inline wuffs_base__status //
+decode_frame(wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){ return wuffs_base__image_decoder__decode_frame(this,a_dst,a_src,a_blend,a_workbuf,a_opts);}
+
+inline wuffs_base__status //
+decode_frame_config(wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_base__image_decoder__decode_frame_config(this,a_dst,a_src);}
+
+inline wuffs_base__status //
+decode_image_config(wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_base__image_decoder__decode_image_config(this,a_dst,a_src);}
+
+inline wuffs_base__rect_ie_u32//
+frame_dirty_rect() const { return wuffs_base__image_decoder__frame_dirty_rect(this);}
+
+inline uint32_t//
+num_animation_loops() const { return wuffs_base__image_decoder__num_animation_loops(this);}
+
+inline uint64_t//
+num_decoded_frame_configs() const { return wuffs_base__image_decoder__num_decoded_frame_configs(this);}
+
+inline uint64_t//
+num_decoded_frames() const { return wuffs_base__image_decoder__num_decoded_frames(this);}
+
+inline wuffs_base__status//
+restart_frame(uint64_t a_index,uint64_t a_io_position){ return wuffs_base__image_decoder__restart_frame(this,a_index,a_io_position);}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_base__image_decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__empty_struct //
+set_report_metadata(uint32_t a_fourcc,bool a_report){ return wuffs_base__image_decoder__set_report_metadata(this,a_fourcc,a_report);}
+
+inline wuffs_base__status //
+tell_me_more(wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){ return wuffs_base__image_decoder__tell_me_more(this,a_dst,a_minfo,a_src);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_base__image_decoder__workbuf_len(this);}
+
+#endif  // __cplusplus
+
+};  // struct wuffs_base__image_decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+// --------
+
+extern const char* wuffs_base__io_transformer__vtable_name;
+
+typedef struct {
+
+wuffs_base__empty_struct (*set_quirk_enabled)(void* self,uint32_t a_quirk,bool a_enabled);
+wuffs_base__status (*transform_io)(void* self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+wuffs_base__range_ii_u64(*workbuf_len)(const void* self);
+} wuffs_base__io_transformer__func_ptrs;
+
+typedef struct wuffs_base__io_transformer__struct wuffs_base__io_transformer;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_base__io_transformer__set_quirk_enabled(wuffs_base__io_transformer *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__io_transformer__transform_io(wuffs_base__io_transformer *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_base__io_transformer__workbuf_len(const wuffs_base__io_transformer *self);
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_base__io_transformer__struct {struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable first_vtable;
+} private_impl;
+
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_base__io_transformer, decltype(&free)>;#endif
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_base__io_transformer__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__status //
+transform_io(wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){ return wuffs_base__io_transformer__transform_io(this,a_dst,a_src,a_workbuf);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_base__io_transformer__workbuf_len(this);}
+
+#endif  // __cplusplus
+
+};  // struct wuffs_base__io_transformer__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+// --------
+
+extern const char* wuffs_base__token_decoder__vtable_name;
+
+typedef struct {
+
+wuffs_base__status (*decode_tokens)(void* self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+wuffs_base__empty_struct (*set_quirk_enabled)(void* self,uint32_t a_quirk,bool a_enabled);
+wuffs_base__range_ii_u64(*workbuf_len)(const void* self);
+} wuffs_base__token_decoder__func_ptrs;
+
+typedef struct wuffs_base__token_decoder__struct wuffs_base__token_decoder;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__token_decoder__decode_tokens(wuffs_base__token_decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_base__token_decoder__set_quirk_enabled(wuffs_base__token_decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_base__token_decoder__workbuf_len(const wuffs_base__token_decoder *self);
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_base__token_decoder__struct {struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable first_vtable;
+} private_impl;
+
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_base__token_decoder, decltype(&free)>;#endif
+
+inline wuffs_base__status //
+decode_tokens(wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){ return wuffs_base__token_decoder__decode_tokens(this,a_dst,a_src,a_workbuf);}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_base__token_decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_base__token_decoder__workbuf_len(this);}
+
+#endif  // __cplusplus
+
+};  // struct wuffs_base__token_decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+
+// ----------------
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+
+// ---------------- Auxiliary C++ API
+
+// The wuffs_aux namespace is a higher level, C++ only layer over the C API
+// (and its thin C++ convenience methods). It holds the buffer management that
+// every C++ program would otherwise re-implement: driving a decoder through
+// its suspensions, refilling and compacting the source and flushing the
+// destination.
+//
+// Callbacks are template parameters, not std::function values, so that they
+// can be inlined and so that nothing here allocates. The one exception is a
+// decoder_pool, which allocates a decoder when its (thread-local) free list is
+// empty. The caller owns all of the buffers.
+//
+// Like the rest of Wuffs, nothing here throws exceptions.
+
+namespace wuffs_aux {
+
+// input_span is a read-only, non-owning view of contiguous bytes, like C++20's
+// std::span<const uint8_t>. It converts implicitly from a wuffs_base__slice_u8
+// or from any container (e.g. a std::string or std::vector<uint8_t>) that has
+// data() and size() methods and 1-byte elements. No bytes are copied.
+//
+// The viewed bytes must outlive the input_span and anything derived from it,
+// such as its reader().
+class input_span {
+ public:
+  input_span() : m_ptr(nullptr), m_len(0) {}
+
+  input_span(const void* ptr, size_t len)
+      : m_ptr(static_cast<const uint8_t*>(ptr)), m_len(ptr ? len : 0) {}
+
+  input_span(wuffs_base__slice_u8 s)
+      : m_ptr(s.ptr), m_len(s.ptr ? s.len : 0) {}
+
+  template <typename Container>
+  input_span(const Container& c)
+      : m_ptr(reinterpret_cast<const uint8_t*>(c.data())), m_len(c.size()) {
+    static_assert(sizeof(*c.data()) == 1,
+                  "wuffs_aux::input_span needs 1-byte elements");
+  }
+
+  inline const uint8_t* data() const { return m_ptr; }
+  inline size_t size() const { return m_len; }
+  inline bool empty() const { return m_len == 0; }
+
+  // slice returns the bytes as a wuffs_base__slice_u8. Its ptr field is not
+  // const-qualified (that's how the C API is), but the bytes must not be
+  // modified through it.
+  inline wuffs_base__slice_u8 slice() const {
+    return wuffs_base__make_slice_u8(const_cast<uint8_t*>(m_ptr), m_len);
+  }
+
+  // reader returns a closed io_buffer that holds the entire input. Wuffs'
+  // decoders only read from, never write to, their source io_buffer, so the
+  // bytes are not copied. A closed source never needs to be refilled or
+  // compacted, so the drivers below never call their read callback.
+  inline wuffs_base__io_buffer reader() const {
+    return wuffs_base__slice_u8__reader(slice(), true);
+  }
+
+ private:
+  const uint8_t* m_ptr;
+  size_t m_len;
+};
+
+// --------
+
+// decoder_pool recycles heap-allocated decoders (or other Wuffs objects),
+// such as wuffs_zlib__decoder objects, so that a thread that decodes many
+// small, independent inputs does not pay for a malloc and free per input.
+// Its template arguments are the object type T, its sizeof__T function and
+// the maximum number of idle objects (per thread) to keep for re-use:
+//
+//   using zlib_pool = wuffs_aux::decoder_pool<wuffs_zlib__decoder,
+//                                             sizeof__wuffs_zlib__decoder>;
+//
+//   zlib_pool::handle dec = zlib_pool::acquire();
+//   if (!dec) {
+//     etc;  // Handle the out-of-memory error.
+//   }
+//   wuffs_base__status status = dec->transform_io(etc);
+//
+// Each thread has its own free list, so acquiring and releasing need no
+// locking. Releasing a handle on a different thread to the one that acquired
+// it is safe, but the object then joins the releasing thread's free list.
+//
+// Every acquired object is (re-)initialized, by default with the
+// WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED flag, so that
+// re-initializing a recycled object does not have to zero its internal
+// buffers (e.g. a 32 KiB history ringbuffer). Pass 0 to acquire to fully
+// zero-initialize instead. See /doc/note/initialization.md for the trade-offs.
+template <typename T, size_t (*SizeOfT)(), size_t MaxIdle = 4>
+class decoder_pool {
+ public:
+  // handle is a move-only RAII handle to an acquired object. Its destructor
+  // releases the object back to the pool. An empty handle (one that is
+  // default constructed, moved from or from a failed acquire) holds nullptr.
+  class handle {
+   public:
+    handle() : m_ptr(nullptr) {}
+    explicit handle(T* ptr) : m_ptr(ptr) {}
+    handle(handle&& that) : m_ptr(that.m_ptr) { that.m_ptr = nullptr; }
+    handle(const handle&) = delete;
+    ~handle() { reset(); }
+
+    handle& operator=(handle&& that) {
+      if (this != &that) {
+        reset();
+        m_ptr = that.m_ptr;
+        that.m_ptr = nullptr;
+      }
+      return *this;
+    }
+    handle& operator=(const handle&) = delete;
+
+    inline T* get() const { return m_ptr; }
+    inline T* operator->() const { return m_ptr; }
+    inline T& operator*() const { return *m_ptr; }
+    inline explicit operator bool() const { return m_ptr != nullptr; }
+
+    // reset releases the object, if any, back to the pool.
+    inline void reset() {
+      if (m_ptr) {
+        decoder_pool::release(m_ptr);
+        m_ptr = nullptr;
+      }
+    }
+
+   private:
+    T* m_ptr;
+  };
+
+  // acquire returns a handle to an initialized object, re-using an idle one
+  // if the calling thread has any. On failure (out of memory, or bad
+  // initialize_flags), it returns an empty handle. It doesn't throw.
+  static handle  //
+  acquire(uint32_t initialize_flags =
+              WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) {
+    free_list& f = local_free_list();
+    T* ptr = (f.n > 0) ? f.ptrs[--f.n] : static_cast<T*>(malloc(SizeOfT()));
+    if (!ptr) {
+      return handle();
+    }
+    wuffs_base__status status =
+        ptr->initialize(SizeOfT(), WUFFS_VERSION, initialize_flags);
+    if (!status.is_ok()) {
+      free(ptr);
+      return handle();
+    }
+    return handle(ptr);
+  }
+
+ private:
+  struct free_list {
+    T* ptrs[MaxIdle];
+    size_t n;
+
+    free_list() : n(0) {}
+    ~free_list() {
+      while (n > 0) {
+        free(ptrs[--n]);
+      }
+    }
+  };
+
+  static free_list&  //
+  local_free_list() {
+    static thread_local free_list z;
+    return z;
+  }
+
+  static void  //
+  release(T* ptr) {
+    free_list& f = local_free_list();
+    if (f.n < MaxIdle) {
+      f.ptrs[f.n++] = ptr;
+    } else {
+      free(ptr);
+    }
+  }
+};
+
+// --------
+
+// The transform_io and decode_tokens functions drive a decoder (or other
+// coroutine) until it completes, handling its suspensions:
+//
+//  - On a short read, the src io_buffer is compacted (if it has consumed
+//    bytes) and refilled by calling read(src). The callback should append
+//    bytes to src (advancing src->meta.wi) and set src->meta.closed at the
+//    end of the input. A short read on a closed src is a
+//    wuffs_base__error__not_enough_data error. A short read on a full src
+//    (one that, even after compaction, has no room) is a
+//    wuffs_base__error__bad_argument_length_too_short error: the buffer is
+//    too small for that decoder.
+//  - A short write on a full dst (or tok) buffer (one that, even after
+//    compaction, has no room, e.g. a zero-length buffer) is also a
+//    wuffs_base__error__bad_argument_length_too_short error. Retrying could
+//    not make progress.
+//  - After every call that wrote to dst (not just those that suspended with
+//    a short write), the dst buffer's contents are handed to a callback and
+//    then the dst buffer is emptied. Carrying dst bytes over from one call
+//    to the next is not an option: decoders like std/deflate's take all of
+//    dst's written bytes to be their most recent output, when resolving
+//    back-references, so re-presenting already-seen output corrupts it.
+//
+// The src buffer is only compacted when it needs refilling. A src that is
+// already closed (e.g. an input_span's reader) is never copied, compacted or
+// refilled. For fewer, larger callback calls, use larger buffers.
+//
+// Callbacks return a wuffs_base__status. Any status other than OK (e.g. an
+// error or a custom message) stops the driver, which returns that status.
+// Likewise, any decoder status other than OK, short read or short write
+// (e.g. a decoding error) is returned as is.
+//
+// On success, the decoder may not have consumed all of src. For example, a
+// zlib stream may be followed by other data. Any unconsumed bytes remain in
+// src, starting at src->meta.ri.
+
+// transform_io drives an io_transformer, or a concrete type with a compatible
+// transform_io method, such as a wuffs_gzip__decoder. The write callback is
+// called as write(wuffs_base__slice_u8 bytes).
+template <typename Transformer, typename ReadFunc, typename WriteFunc>
+wuffs_base__status  //
+transform_io(Transformer* t,
+             wuffs_base__io_buffer* dst,
+             wuffs_base__io_buffer* src,
+             wuffs_base__slice_u8 workbuf,
+             ReadFunc&& read,
+             WriteFunc&& write) {
+  while (true) {
+    wuffs_base__status status = t->transform_io(dst, src, workbuf);
+
+    if (dst->meta.wi > dst->meta.ri) {
+      wuffs_base__status z = write(wuffs_base__make_slice_u8(
+          dst->data.ptr + dst->meta.ri, dst->meta.wi - dst->meta.ri));
+      if (z.repr) {
+        return z;
+      }
+      dst->meta.ri = dst->meta.wi;
+      dst->compact();
+    }
+
+    if (status.repr == nullptr) {
+      return status;
+    } else if (status.repr == wuffs_base__suspension__short_read) {
+      if (src->meta.closed) {
+        return wuffs_base__make_status(wuffs_base__error__not_enough_data);
+      }
+      src->compact();
+      if (src->meta.wi >= src->data.len) {
+        return wuffs_base__make_status(
+            wuffs_base__error__bad_argument_length_too_short);
+      }
+      wuffs_base__status z = read(src);
+      if (z.repr) {
+        return z;
+      }
+    } else if (status.repr == wuffs_base__suspension__short_write) {
+      dst->compact();
+      if (dst->meta.wi >= dst->data.len) {
+        return wuffs_base__make_status(
+            wuffs_base__error__bad_argument_length_too_short);
+      }
+    } else {
+      return status;
+    }
+  }
+}
+
+// transform_io, given an input_span instead of a src io_buffer, transforms
+// the whole input without copying it into an intermediate buffer.
+template <typename Transformer, typename WriteFunc>
+wuffs_base__status  //
+transform_io(Transformer* t,
+             wuffs_base__io_buffer* dst,
+             input_span src,
+             wuffs_base__slice_u8 workbuf,
+             WriteFunc&& write) {
+  wuffs_base__io_buffer r = src.reader();
+  return transform_io(
+      t, dst, &r, workbuf,
+      [](wuffs_base__io_buffer*) -> wuffs_base__status {
+        return wuffs_base__make_status(wuffs_base__error__not_enough_data);
+      },
+      write);
+}
+
+// decode_tokens drives a token_decoder, or a concrete type with a compatible
+// decode_tokens method, such as a wuffs_json__decoder. The token callback is
+// called as handle_tokens(tok, src) and should consume tok's readable tokens
+// (from tok->meta.ri to tok->meta.wi). Those tokens cover the src bytes that
+// immediately precede src->meta.ri. After the callback returns, any readable
+// tokens left over are discarded and tok is emptied.
+//
+// The src buffer is only compacted after its tokens were handled, so that a
+// token's bytes do not move while the callback is looking at them.
+template <typename TokenDecoder, typename ReadFunc, typename TokenFunc>
+wuffs_base__status  //
+decode_tokens(TokenDecoder* d,
+              wuffs_base__token_buffer* tok,
+              wuffs_base__io_buffer* src,
+              wuffs_base__slice_u8 workbuf,
+              ReadFunc&& read,
+              TokenFunc&& handle_tokens) {
+  while (true) {
+    wuffs_base__status status = d->decode_tokens(tok, src, workbuf);
+
+    if (tok->meta.wi > tok->meta.ri) {
+      wuffs_base__status z = handle_tokens(tok, src);
+      if (z.repr) {
+        return z;
+      }
+    }
+    tok->meta.ri = tok->meta.wi;
+    tok->compact();
+
+    if (status.repr == nullptr) {
+      return status;
+    } else if (status.repr == wuffs_base__suspension__short_read) {
+      if (src->meta.closed) {
+        return wuffs_base__make_status(wuffs_base__error__not_enough_data);
+      }
+      src->compact();
+      if (src->meta.wi >= src->data.len) {
+        return wuffs_base__make_status(
+            wuffs_base__error__bad_argument_length_too_short);
+      }
+      wuffs_base__status z = read(src);
+      if (z.repr) {
+        return z;
+      }
+    } else if (status.repr == wuffs_base__suspension__short_write) {
+      if (tok->meta.wi >= tok->data.len) {
+        return wuffs_base__make_status(
+            wuffs_base__error__bad_argument_length_too_short);
+      }
+    } else {
+      return status;
+    }
+  }
+}
+
+// decode_tokens, given an input_span instead of a src io_buffer, decodes the
+// whole input without copying it into an intermediate buffer. The src passed
+// to handle_tokens is a reader over the input_span, so that the src->data.ptr
+// indexes are also indexes into the input_span.
+template <typename TokenDecoder, typename TokenFunc>
+wuffs_base__status  //
+decode_tokens(TokenDecoder* d,
+              wuffs_base__token_buffer* tok,
+              input_span src,
+              wuffs_base__slice_u8 workbuf,
+              TokenFunc&& handle_tokens) {
+  wuffs_base__io_buffer r = src.reader();
+  return decode_tokens(
+      d, tok, &r, workbuf,
+      [](wuffs_base__io_buffer*) -> wuffs_base__status {
+        return wuffs_base__make_status(wuffs_base__error__not_enough_data);
+      },
+      handle_tokens);
+}
+
+}  // namespace wuffs_aux
+
+
+#endif  // defined(__cplusplus) && (__cplusplus >= 201103L)
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+// ---------------- CPU Architecture
+
+// WUFFS_BASE__CPU_ARCH__ETC is defined when the compiler can emit (and the
+// code below can call) CPU-specific instructions, such as SIMD intrinsics.
+// Whether the CPU that the program actually runs on supports them is checked
+// at run time, via wuffs_base__cpu_arch__have_etc functions. Every such fast
+// path has a portable fallback that produces identical output.
+//
+// Define WUFFS_CONFIG__AVOID_CPU_ARCH to only use the portable code, e.g. to
+// measure the difference when benchmarking.
+//
+// Clang also defines "__GNUC__".
+#if !defined(WUFFS_CONFIG__AVOID_CPU_ARCH)
+#if defined(__GNUC__) && defined(__x86_64__)
+#define WUFFS_BASE__CPU_ARCH__X86_64
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+#endif  // !defined(WUFFS_CONFIG__AVOID_CPU_ARCH)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline wuffs_base__empty_struct  //
+wuffs_base__ignore_status(wuffs_base__status z) {
+  return wuffs_base__make_empty_struct();
+}
+
+// WUFFS_BASE__MAGIC is a magic number to check that initializers are called.
+// It's not foolproof, given C doesn't automatically zero memory before use,
+// but it should catch 99.99% of cases.
+//
+// Its (non-zero) value is arbitrary, based on md5sum("wuffs").
+#define WUFFS_BASE__MAGIC ((uint32_t)0x3CCB6C71)
+
+// WUFFS_BASE__DISABLED is a magic number to indicate that a non-recoverable
+// error was previously encountered.
+//
+// Its (non-zero) value is arbitrary, based on md5sum("disabled").
+#define WUFFS_BASE__DISABLED ((uint32_t)0x075AE3D2)
+
+// Denote intentional fallthroughs for -Wimplicit-fallthrough.
+//
+// The order matters here. Clang also defines "__GNUC__".
+#if defined(__clang__) && defined(__cplusplus) && (__cplusplus >= 201103L)
+#define WUFFS_BASE__FALLTHROUGH [[clang::fallthrough]]
+#elif !defined(__clang__) && defined(__GNUC__) && (__GNUC__ >= 7)
+#define WUFFS_BASE__FALLTHROUGH __attribute__((fallthrough))
+#else
+#define WUFFS_BASE__FALLTHROUGH
+#endif
+
+// Use switch cases for coroutine suspension points, similar to the technique
+// in https://www.chiark.greenend.org.uk/~sgtatham/coroutines.html
+//
+// We use trivial macros instead of an explicit assignment and case statement
+// so that clang-format doesn't get confused by the unusual "case"s.
+#define WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0 case 0:;
+#define WUFFS_BASE__COROUTINE_SUSPENSION_POINT(n) \
+  coro_susp_point = n;                            \
+  WUFFS_BASE__FALLTHROUGH;                        \
+  case n:;
+
+#define WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(n) \
+  if (!status.repr) {                                           \
+    goto ok;                                                    \
+  } else if (*status.repr != '$') {                             \
+    goto exit;                                                  \
+  }                                                             \
+  coro_susp_point = n;                                          \
+  goto suspend;                                                 \
+  case n:;
+
+// Clang also defines "__GNUC__".
+#if defined(__GNUC__)
+#define WUFFS_BASE__LIKELY(expr) (__builtin_expect(!!(expr), 1))
+#define WUFFS_BASE__UNLIKELY(expr) (__builtin_expect(!!(expr), 0))
+#else
+#define WUFFS_BASE__LIKELY(expr) (expr)
+#define WUFFS_BASE__UNLIKELY(expr) (expr)
+#endif
+
+// The WUFFS_BASE__STATS__ETC macros update a wuffs_foo__bar struct's
+// instrumentation counters. Unless WUFFS_CONFIG__ENABLE_STATS is defined,
+// there are no counters and the macros compile to nothing.
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+#define WUFFS_BASE__STATS__CALL(self, f) \
+  ((self)->private_impl.stats.funcs[f].num_calls++)
+#define WUFFS_BASE__STATS__WRITTEN(self, f, n) \
+  ((self)->private_impl.stats.funcs[f].num_written += (uint64_t)(n))
+#define WUFFS_BASE__STATS__SUSPENSION(self, status) \
+  ((self)->private_impl.stats.num_suspensions +=    \
+   (wuffs_base__status__is_suspension(status) ? 1 : 0))
+#else
+#define WUFFS_BASE__STATS__CALL(self, f) ((void)0)
+#define WUFFS_BASE__STATS__WRITTEN(self, f, n) ((void)0)
+#define WUFFS_BASE__STATS__SUSPENSION(self, status) ((void)0)
+#endif
+
+// ---------------- Numeric Types
+
+extern const uint8_t wuffs_base__low_bits_mask__u8[9];
+extern const uint16_t wuffs_base__low_bits_mask__u16[17];
+extern const uint32_t wuffs_base__low_bits_mask__u32[33];
+extern const uint64_t wuffs_base__low_bits_mask__u64[65];
+
+#define WUFFS_BASE__LOW_BITS_MASK__U8(n) (wuffs_base__low_bits_mask__u8[n])
+#define WUFFS_BASE__LOW_BITS_MASK__U16(n) (wuffs_base__low_bits_mask__u16[n])
+#define WUFFS_BASE__LOW_BITS_MASK__U32(n) (wuffs_base__low_bits_mask__u32[n])
+#define WUFFS_BASE__LOW_BITS_MASK__U64(n) (wuffs_base__low_bits_mask__u64[n])
+
+// --------
+
+static inline void  //
+wuffs_base__u8__sat_add_indirect(uint8_t* x, uint8_t y) {
+  *x = wuffs_base__u8__sat_add(*x, y);
+}
+
+static inline void  //
+wuffs_base__u8__sat_sub_indirect(uint8_t* x, uint8_t y) {
+  *x = wuffs_base__u8__sat_sub(*x, y);
+}
+
+static inline void  //
+wuffs_base__u16__sat_add_indirect(uint16_t* x, uint16_t y) {
+  *x = wuffs_base__u16__sat_add(*x, y);
+}
+
+static inline void  //
+wuffs_base__u16__sat_sub_indirect(uint16_t* x, uint16_t y) {
+  *x = wuffs_base__u16__sat_sub(*x, y);
+}
+
+static inline void  //
+wuffs_base__u32__sat_add_indirect(uint32_t* x, uint32_t y) {
+  *x = wuffs_base__u32__sat_add(*x, y);
+}
+
+static inline void  //
+wuffs_base__u32__sat_sub_indirect(uint32_t* x, uint32_t y) {
+  *x = wuffs_base__u32__sat_sub(*x, y);
+}
+
+static inline void  //
+wuffs_base__u64__sat_add_indirect(uint64_t* x, uint64_t y) {
+  *x = wuffs_base__u64__sat_add(*x, y);
+}
+
+static inline void  //
+wuffs_base__u64__sat_sub_indirect(uint64_t* x, uint64_t y) {
+  *x = wuffs_base__u64__sat_sub(*x, y);
+}
+
+// ---------------- Slices and Tables
+
+// wuffs_base__slice_u8__prefix returns up to the first up_to bytes of s.
+static inline wuffs_base__slice_u8  //
+wuffs_base__slice_u8__prefix(wuffs_base__slice_u8 s, uint64_t up_to) {
+  if ((uint64_t)(s.len) > up_to) {
+    s.len = up_to;
+  }
+  return s;
+}
+
+// wuffs_base__slice_u8__suffix returns up to the last up_to bytes of s.
+static inline wuffs_base__slice_u8  //
+wuffs_base__slice_u8__suffix(wuffs_base__slice_u8 s, uint64_t up_to) {
+  if ((uint64_t)(s.len) > up_to) {
+    s.ptr += (uint64_t)(s.len) - up_to;
+    s.len = up_to;
+  }
+  return s;
+}
+
+// wuffs_base__slice_u8__copy_from_slice calls memmove(dst.ptr, src.ptr, len)
+// where len is the minimum of dst.len and src.len.
+//
+// Passing a wuffs_base__slice_u8 with all fields NULL or zero (a valid, empty
+// slice) is valid and results in a no-op.
+static inline uint64_t  //
+wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8 dst,
+                                      wuffs_base__slice_u8 src) {
+  size_t len = dst.len < src.len ? dst.len : src.len;
+  if (len > 0) {
+    memmove(dst.ptr, src.ptr, len);
+  }
+  return len;
+}
+
+// --------
+
+static inline wuffs_base__slice_u8  //
+wuffs_base__table_u8__row(wuffs_base__table_u8 t, uint32_t y) {
+  if (y < t.height) {
+    return wuffs_base__make_slice_u8(t.ptr + (t.stride * y), t.width);
+  }
+  return wuffs_base__make_slice_u8(NULL, 0);
+}
+
+  // ---------------- Slices and Tables (Utility)
+
+#define wuffs_base__utility__empty_slice_u8 wuffs_base__empty_slice_u8
+
+// ---------------- CPU Architecture
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42 lets a function use SSE4.2 (and
+// earlier, such as SSSE3 and SSE4.1) intrinsics, as well as the POPCNT and
+// PCLMULQDQ instructions, even if the rest of the program is compiled without
+// "-msse4.2". Only call such functions after checking
+// wuffs_base__cpu_arch__have_x86_sse42.
+#define WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42 \
+  __attribute__((target("pclmul,popcnt,sse4.2")))
+
+// wuffs_base__cpu_arch__have_x86_sse42 returns whether the CPU supports
+// SSE4.2 and the instruction sets it implies: SSE2, SSE3, SSSE3 and SSE4.1.
+// It also requires POPCNT and PCLMULQDQ, which every SSE4.2 capable x86_64 CPU
+// in practice also has.
+//
+// The CPUID instruction can be slow, especially in virtual machines, so the
+// result is memoized. Racing threads can only ever store the same value.
+static inline bool  //
+wuffs_base__cpu_arch__have_x86_sse42() {
+  // 0 means unknown, 1 means no and 2 means yes.
+  static int memo = 0;
+  int m = __atomic_load_n(&memo, __ATOMIC_RELAXED);
+  if (m == 0) {
+    m = 1;
+    unsigned int eax1 = 0;
+    unsigned int ebx1 = 0;
+    unsigned int ecx1 = 0;
+    unsigned int edx1 = 0;
+    if (__get_cpuid(1, &eax1, &ebx1, &ecx1, &edx1)) {
+      const unsigned int sse42_ecx1 = bit_PCLMUL | bit_POPCNT | bit_SSE3 |
+                                      bit_SSSE3 | bit_SSE4_1 | bit_SSE4_2;
+      if ((ecx1 & sse42_ecx1) == sse42_ecx1) {
+        m = 2;
+      }
+    }
+    __atomic_store_n(&memo, m, __ATOMIC_RELAXED);
+  }
+  return m == 2;
+}
+
+// wuffs_base__cpu_arch__utf_8_span_x86_sse42 returns the length of a prefix of
+// the 16 bytes x that is valid UTF-8 and does not contain any stop bytes. Bit
+// i of stops is set if x's i'th byte is a stop byte, which must be ASCII. The
+// x bytes must start at a code point boundary and the prefix ends at one.
+//
+// The prefix is usually the longest such prefix, but it can be shorter near
+// invalid UTF-8. In particular, returning zero does not imply that x starts
+// with invalid UTF-8, only that the caller should check its first code point
+// more carefully, e.g. with wuffs_base__utf_8__next.
+//
+// Validation uses the "lookup" algorithm from "Validating UTF-8 In Less Than
+// One Instruction Per Byte" by Keiser and Lemire (Software: Practice and
+// Experience, 2021). Three 16-entry tables, indexed by the high and low
+// nibbles of each byte's predecessor and the high nibble of the byte itself,
+// give bit sets of the errors possible given that nibble. Their bitwise-and is
+// non-zero where a pair of bytes is invalid. The bits are:
+//  - 0x01 too short: a lead byte followed by a non-continuation byte.
+//  - 0x02 too long: an ASCII byte followed by a continuation byte.
+//  - 0x04 overlong 3-byte encoding: 0xE0 followed by 0x80 ..= 0x9F.
+//  - 0x08 too large: 0xF4 ..= 0xFF followed by 0x90 ..= 0xBF.
+//  - 0x10 surrogate: 0xED followed by 0xA0 ..= 0xBF.
+//  - 0x20 overlong 2-byte encoding: 0xC0 or 0xC1.
+//  - 0x40 too large or overlong 4-byte encoding: 0xF0 or 0xF5 ..= 0xFF
+//    followed by 0x80 ..= 0x8F.
+//  - 0x80 two continuations, or that it is the 3rd or 4th byte of a code
+//    point. Exactly one of those should hold, so this bit is flipped where
+//    the byte two or three places earlier is a 3- or 4-byte lead.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__cpu_arch__utf_8_span_x86_sse42(__m128i x, uint32_t stops) {
+  const __m128i byte_1_high_table = _mm_setr_epi8(
+      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  //
+      -0x80, -0x80, -0x80, -0x80, 0x21, 0x01, 0x15, 0x49);
+  const __m128i byte_1_low_table = _mm_setr_epi8(
+      -0x19, -0x5D, -0x7D, -0x7D, -0x75, -0x35, -0x35, -0x35,  //
+      -0x35, -0x35, -0x35, -0x35, -0x35, -0x25, -0x35, -0x35);
+  const __m128i byte_2_high_table = _mm_setr_epi8(
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  //
+      -0x1A, -0x52, -0x46, -0x46, 0x01, 0x01, 0x01, 0x01);
+  const __m128i low_nibble = _mm_set1_epi8(0x0F);
+
+  // Zero bytes are shifted in before x. They act like ASCII.
+  __m128i prev1 = _mm_slli_si128(x, 1);
+  __m128i prev2 = _mm_slli_si128(x, 2);
+  __m128i prev3 = _mm_slli_si128(x, 3);
+
+  __m128i errs = _mm_and_si128(
+      _mm_and_si128(
+          _mm_shuffle_epi8(byte_1_high_table,
+                           _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble)),
+          _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, low_nibble))),
+      _mm_shuffle_epi8(byte_2_high_table,
+                       _mm_and_si128(_mm_srli_epi16(x, 4), low_nibble)));
+  errs = _mm_xor_si128(
+      errs, _mm_and_si128(
+                _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80)),
+                             _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80))),
+                _mm_set1_epi8(-0x80)));
+
+  // A code point that starts in x's last 3 bytes might not end within x.
+  __m128i incomplete = _mm_subs_epu8(
+      x, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,  //
+                       -1, -1, -1, -1, -1, -0x11, -0x21, -0x41));
+
+  // Bit i of bad is set if x's i'th byte is the first byte (in its pair or
+  // triple) that is invalid. Bits 16 and 17 are sentinels: bit 16 means that
+  // the last code point is incomplete.
+  uint32_t bad = 0xFFFFu & ~(uint32_t)_mm_movemask_epi8(
+                               _mm_cmpeq_epi8(errs, _mm_setzero_si128()));
+  bad |= (0xFFFFu == (uint32_t)_mm_movemask_epi8(
+                         _mm_cmpeq_epi8(incomplete, _mm_setzero_si128())))
+             ? 0x20000u
+             : 0x10000u;
+
+  // Bit i of boundaries is set if x's i'th byte is not a continuation byte.
+  // As signed 8-bit integers, continuation bytes are less than 0xC0.
+  uint32_t boundaries =
+      0x10000u | (0xFFFFu & ~(uint32_t)_mm_movemask_epi8(
+                                 _mm_cmplt_epi8(x, _mm_set1_epi8(-0x40))));
+
+  // Every code point that ends before the first bad byte is valid. Return the
+  // last boundary strictly before that byte, and not after the first stop.
+  uint32_t n = (uint32_t)__builtin_ctz(bad);
+  if (n == 0) {
+    return 0;
+  }
+  uint32_t m = (uint32_t)__builtin_ctz(stops | 0x10000u);
+  if (m > (n - 1)) {
+    m = n - 1;
+  }
+  boundaries &= (2u << m) - 1u;
+  return 31u - (uint32_t)__builtin_clz(boundaries | 1u);
+}
+
+#else  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static inline bool  //
+wuffs_base__cpu_arch__have_x86_sse42() {
+  return false;
+}
+
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// ---------------- CPU Architecture (Utility)
+
+// The wuffs_base__utility__etc functions below are called by Wuffs code (e.g.
+// in std/crc32) via "utility.etc" built-in functions. The Wuffs language
+// itself has no notion of SIMD, so these hand-written C implementations are
+// the bridge from Wuffs code to CPU-specific instructions.
+//
+// Wuffs code should only call the CPU-specific function (e.g.
+// utility.crc32_ieee_x86_sse42) after the corresponding check (e.g.
+// utility.cpu_arch_have_x86_sse42) returns true. On other CPU architectures,
+// the check always returns false and the CPU-specific function is an inert
+// placeholder, so that the generated C code still compiles.
+
+#define wuffs_base__utility__cpu_arch_have_x86_sse42 \
+  wuffs_base__cpu_arch__have_x86_sse42
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// wuffs_base__utility__crc32_ieee_x86_sse42 updates the CRC-32 (IEEE) state s
+// (the bitwise complement of the running checksum, as per std/crc32's
+// ieee_hasher) with the first (x.len & ~15) bytes of x, using carry-less
+// multiplication to fold 64 bytes at a time. The x.len must be at least 64.
+//
+// The algorithm is described in "Fast CRC Computation for Generic Polynomials
+// Using PCLMULQDQ Instruction" by Gopal, Ozturk, Guilford, Wolrich, Feghali,
+// Dixon and Karakoyunlu (Intel, 2009). The magic constants are powers of x
+// modulo the bit-reflected IEEE polynomial (0x1_DB71_0641), as well as that
+// polynomial's Barrett reduction constant (0x1_F701_1641).
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__crc32_ieee_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {
+  if (x.len < 64) {
+    return s;
+  }
+  uint8_t* p = x.ptr;
+  size_t n = x.len & ~((size_t)15);
+
+  __m128i k1k2 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+  __m128i k3k4 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+  __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163CD6124);
+  __m128i poly = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+  __m128i mask = _mm_setr_epi32(-1, 0, -1, 0);
+
+  __m128i x1 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00));
+  __m128i x2 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x10));
+  __m128i x3 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x20));
+  __m128i x4 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x30));
+  x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)s));
+  p += 64;
+  n -= 64;
+
+  // Fold 64 bytes (4 lanes of 128 bits) at a time.
+  while (n >= 64) {
+    __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+    __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+    __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+    __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+    x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+    x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+    x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+    x1 =
+        _mm_xor_si128(_mm_xor_si128(x1, x5),
+                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00)));
+    x2 =
+        _mm_xor_si128(_mm_xor_si128(x2, x6),
+                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x10)));
+    x3 =
+        _mm_xor_si128(_mm_xor_si128(x3, x7),
+                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x20)));
+    x4 =
+        _mm_xor_si128(_mm_xor_si128(x4, x8),
+                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x30)));
+    p += 64;
+    n -= 64;
+  }
+
+  // Fold the 4 lanes into 1.
+  __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+  x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+  x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+  x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+  x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+  x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+  x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+  x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+  x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+  // Fold 16 bytes (1 lane) at a time.
+  while (n >= 16) {
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 =
+        _mm_xor_si128(_mm_xor_si128(x1, x5),
+                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00)));
+    p += 16;
+    n -= 16;
+  }
+
+  // Fold 128 bits to 64 bits.
+  x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_and_si128(x1, mask);
+  x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // Barrett reduce to 32 bits.
+  x2 = _mm_and_si128(x1, mask);
+  x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+  x2 = _mm_and_si128(x2, mask);
+  x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+  return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+
+// wuffs_base__utility__crc32_castagnoli_x86_sse42 updates the CRC-32C
+// (Castagnoli) state s (the bitwise complement of the running checksum, as per
+// std/crc32's castagnoli_hasher) with all of x, using SSE4.2's dedicated
+// CRC32 instruction, 8 bytes at a time.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__crc32_castagnoli_x86_sse42(uint32_t s,
+                                                wuffs_base__slice_u8 x) {
+  uint8_t* p = x.ptr;
+  size_t n = x.len;
+
+  uint64_t s64 = s;
+  while (n >= 32) {
+    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 0));
+    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 8));
+    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 16));
+    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 24));
+    p += 32;
+    n -= 32;
+  }
+  while (n >= 8) {
+    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p));
+    p += 8;
+    n -= 8;
+  }
+
+  s = (uint32_t)s64;
+  while (n--) {
+    s = _mm_crc32_u8(s, *p++);
+  }
+  return s;
+}
+
+// wuffs_base__utility__adler32_x86_sse42 updates the Adler-32 state s (s2 in
+// the high 16 bits, s1 in the low 16 bits, as per std/adler32's hasher) with
+// the first (x.len & ~31) bytes of x, 32 bytes at a time.
+//
+// Within each 32 byte block, s1 gains the sum of the bytes (via PSADBW) and
+// s2 gains their sum weighted by 32, 31, ..., 1 (via PMADDUBSW and PMADDWD),
+// plus 32 times the previous s1. As with the portable code, both are reduced
+// modulo 65521 at least every 5552 bytes, so that they cannot overflow.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__adler32_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {
+  uint32_t s1 = s & 0xFFFF;
+  uint32_t s2 = s >> 16;
+  uint8_t* p = x.ptr;
+  size_t blocks = x.len / 32;
+
+  __m128i weights_hi = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25,  //
+                                     24, 23, 22, 21, 20, 19, 18, 17);
+  __m128i weights_lo = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9,  //
+                                     8, 7, 6, 5, 4, 3, 2, 1);
+  __m128i ones = _mm_set1_epi16(1);
+  __m128i zero = _mm_setzero_si128();
+
+  while (blocks > 0) {
+    // 5536 is the largest multiple of 32 that is at most 5552.
+    size_t n = 5536 / 32;
+    if (n > blocks) {
+      n = blocks;
+    }
+    blocks -= n;
+
+    // v_ps accumulates the sum of s1 over the n blocks, to be multiplied by
+    // 32 (the block size) and added to s2 afterwards.
+    __m128i v_ps = _mm_cvtsi32_si128((int)(s1 * n));
+    __m128i v_s1 = _mm_setzero_si128();
+    __m128i v_s2 = _mm_cvtsi32_si128((int)s2);
+
+    do {
+      __m128i hi = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00));
+      __m128i lo = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x10));
+      v_ps = _mm_add_epi32(v_ps, v_s1);
+      v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(hi, zero));
+      v_s2 = _mm_add_epi32(
+          v_s2, _mm_madd_epi16(_mm_maddubs_epi16(hi, weights_hi), ones));
+      v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(lo, zero));
+      v_s2 = _mm_add_epi32(
+          v_s2, _mm_madd_epi16(_mm_maddubs_epi16(lo, weights_lo), ones));
+      p += 32;
+    } while (--n);
+
+    v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));
+
+    // Horizontally sum the 4 lanes of v_s1 and of v_s2.
+    v_s1 =
+        _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(2, 3, 0, 1)));
+    v_s1 =
+        _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(1, 0, 3, 2)));
+    v_s2 =
+        _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(2, 3, 0, 1)));
+    v_s2 =
+        _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(1, 0, 3, 2)));
+
+    s1 = (s1 + (uint32_t)_mm_cvtsi128_si32(v_s1)) % 65521;
+    s2 = ((uint32_t)_mm_cvtsi128_si32(v_s2)) % 65521;
+  }
+  return (s2 << 16) | s1;
+}
+
+// wuffs_base__utility__json_string_span_x86_sse42 returns the number of
+// leading bytes, out of the 16 bytes given by lo and hi (in little-endian
+// order), that are valid UTF-8 but not '"', '\\' or a C0 control code. For
+// ASCII, these are the bytes that std/json's LUT_CHARS maps to 0x00. As signed
+// 8-bit integers, both C0 control codes and non-ASCII bytes are less than
+// 0x20, so the UTF-8 validation is skipped unless the first such byte is
+// non-ASCII. The span always ends at a code point boundary, but it can stop
+// short of the longest valid prefix, as per
+// wuffs_base__cpu_arch__utf_8_span_x86_sse42.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__json_string_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  __m128i x = _mm_set_epi64x((long long)hi, (long long)lo);
+  __m128i m = _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x22)),
+                           _mm_cmpeq_epi8(x, _mm_set1_epi8(0x5C)));
+  uint32_t stops = (uint32_t)_mm_movemask_epi8(
+      _mm_or_si128(m, _mm_cmplt_epi8(x, _mm_set1_epi8(0x20))));
+  uint32_t n = (uint32_t)__builtin_ctz(stops | 0x10000u);
+  if ((n >= 16) || (0 == ((1u << n) & (uint32_t)_mm_movemask_epi8(x)))) {
+    return n;
+  }
+  // Exclude the non-ASCII bytes from the stops, but include the C0 controls.
+  // As unsigned 8-bit integers, C0 control codes are at most 0x1F.
+  stops = (uint32_t)_mm_movemask_epi8(_mm_or_si128(
+      m, _mm_cmpeq_epi8(x, _mm_min_epu8(x, _mm_set1_epi8(0x1F)))));
+  return wuffs_base__cpu_arch__utf_8_span_x86_sse42(x, stops);
+}
+
+// wuffs_base__utility__json_whitespace_span_x86_sse42 returns the number of
+// leading bytes, out of the 16 bytes given by lo and hi (in little-endian
+// order), that are JSON whitespace: '\t', '\n', '\r' or ' '.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__json_whitespace_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  __m128i x = _mm_set_epi64x((long long)hi, (long long)lo);
+  __m128i m = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x09)),
+                   _mm_cmpeq_epi8(x, _mm_set1_epi8(0x0A))),
+      _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x0D)),
+                   _mm_cmpeq_epi8(x, _mm_set1_epi8(0x20))));
+  return (uint32_t)__builtin_ctz(~((unsigned int)_mm_movemask_epi8(m)));
+}
+
+// wuffs_base__utility__json_skip_span_x86_sse42 returns the number of leading
+// bytes, out of the 16 bytes given by lo and hi (in little-endian order), that
+// are not '"', '\\' or a bracket: '[', ']', '{' or '}'. As an optimization,
+// '|' is also excluded, as OR-ing with 0x20 maps "[\\]" to "{|}".
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__json_skip_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  __m128i x = _mm_set_epi64x((long long)hi, (long long)lo);
+  __m128i y = _mm_or_si128(x, _mm_set1_epi8(0x20));
+  __m128i m = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x22)),
+                   _mm_cmpeq_epi8(y, _mm_set1_epi8(0x7B))),
+      _mm_or_si128(_mm_cmpeq_epi8(y, _mm_set1_epi8(0x7C)),
+                   _mm_cmpeq_epi8(y, _mm_set1_epi8(0x7D))));
+  return (uint32_t)__builtin_ctz(((unsigned int)_mm_movemask_epi8(m)) |
+                                 0x10000u);
+}
+
+// The wuffs_base__utility__png_filter_etc_x86_sse42 functions reverse PNG
+// filtering, in place, for the first (curr.len / d) * d bytes of curr, where d
+// (the filter distance) is 3 or 4 bytes per pixel. prev is the previous row,
+// already unfiltered, and must be at least as long as curr. Every curr pixel
+// depends on its left neighbor, so the Average and Paeth filters work on one
+// pixel (all of its channels) at a time, but the Sub filter works on four
+// pixels at a time.
+
+// wuffs_base__utility__png_filter_1_distance_4_x86_sse42 reverses the PNG Sub
+// filter. Within each 16 byte block, two shift-and-add steps compute a prefix
+// sum of its four pixels, to which is added the previous block's last pixel.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_1_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr) {
+  uint8_t* p = curr.ptr;
+  size_t n = curr.len & ~(size_t)3;
+  __m128i a = _mm_setzero_si128();
+
+  for (; n >= 16; n -= 16, p += 16) {
+    __m128i x = _mm_lddqu_si128((const __m128i*)(const void*)p);
+    x = _mm_add_epi8(x, _mm_slli_si128(x, 4));
+    x = _mm_add_epi8(x, _mm_slli_si128(x, 8));
+    x = _mm_add_epi8(x, a);
+    _mm_storeu_si128((__m128i*)(void*)p, x);
+    a = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+  }
+
+  for (; n >= 4; n -= 4, p += 4) {
+    a = _mm_add_epi8(
+        a, _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(p)));
+    wuffs_base__store_u32le__no_bounds_check(p,
+                                             (uint32_t)_mm_cvtsi128_si32(a));
+  }
+}
+
+// wuffs_base__utility__png_filter_3_x86_sse42 reverses the PNG Average filter.
+// PAVGB rounds up, so the floor of the mean is PAVGB minus the low bit of the
+// XOR of its arguments.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_3_x86_sse42(wuffs_base__slice_u8 curr,
+                                            wuffs_base__slice_u8 prev,
+                                            size_t d) {
+  uint8_t* p = curr.ptr;
+  const uint8_t* q = prev.ptr;
+  size_t n = curr.len - (curr.len % d);
+  __m128i ones = _mm_set1_epi8(1);
+  __m128i a = _mm_setzero_si128();
+
+  for (; n >= d; n -= d, p += d, q += d) {
+    __m128i b;
+    __m128i x;
+    if (d == 4) {
+      b = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(q));
+      x = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(p));
+    } else {
+      b = _mm_cvtsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(q));
+      x = _mm_cvtsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(p));
+    }
+    __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b),
+                               _mm_and_si128(_mm_xor_si128(a, b), ones));
+    a = _mm_add_epi8(x, avg);
+    if (d == 4) {
+      wuffs_base__store_u32le__no_bounds_check(p,
+                                               (uint32_t)_mm_cvtsi128_si32(a));
+    } else {
+      wuffs_base__store_u24le__no_bounds_check(p,
+                                               (uint32_t)_mm_cvtsi128_si32(a));
+    }
+  }
+}
+
+// wuffs_base__utility__png_filter_4_x86_sse42 reverses the PNG Paeth filter,
+// in 16-bit lanes. With a, b and c being the left, up and up-left neighbors,
+// the predictor p = a + b - c is closest to a, b or c (in that order of
+// preference) when |b - c|, |a - c| or |a + b - 2c| is smallest.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_4_x86_sse42(wuffs_base__slice_u8 curr,
+                                            wuffs_base__slice_u8 prev,
+                                            size_t d) {
+  uint8_t* p = curr.ptr;
+  const uint8_t* q = prev.ptr;
+  size_t n = curr.len - (curr.len % d);
+  __m128i zero = _mm_setzero_si128();
+  __m128i mask = _mm_set1_epi16(0xFF);
+  __m128i a = _mm_setzero_si128();
+  __m128i c = _mm_setzero_si128();
+
+  for (; n >= d; n -= d, p += d, q += d) {
+    __m128i b;
+    __m128i x;
+    if (d == 4) {
+      b = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(q));
+      x = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(p));
+    } else {
+      b = _mm_cvtsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(q));
+      x = _mm_cvtsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(p));
+    }
+    b = _mm_unpacklo_epi8(b, zero);
+    x = _mm_unpacklo_epi8(x, zero);
+
+    __m128i b_c = _mm_sub_epi16(b, c);
+    __m128i a_c = _mm_sub_epi16(a, c);
+    __m128i pa = _mm_abs_epi16(b_c);
+    __m128i pb = _mm_abs_epi16(a_c);
+    __m128i pc = _mm_abs_epi16(_mm_add_epi16(b_c, a_c));
+    __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+    __m128i nearest = _mm_blendv_epi8(
+        _mm_blendv_epi8(c, b, _mm_cmpeq_epi16(smallest, pb)), a,
+        _mm_cmpeq_epi16(smallest, pa));
+
+    a = _mm_and_si128(_mm_add_epi16(x, nearest), mask);
+    c = b;
+    uint32_t v = (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(a, a));
+    if (d == 4) {
+      wuffs_base__store_u32le__no_bounds_check(p, v);
+    } else {
+      wuffs_base__store_u24le__no_bounds_check(p, v);
+    }
+  }
+}
+
+// The distance-specific wrappers let the compiler specialize the loops above
+// for a constant d.
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_3_distance_3_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {
+  wuffs_base__utility__png_filter_3_x86_sse42(curr, prev, 3);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_3_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {
+  wuffs_base__utility__png_filter_3_x86_sse42(curr, prev, 4);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_4_distance_3_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {
+  wuffs_base__utility__png_filter_4_x86_sse42(curr, prev, 3);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_4_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {
+  wuffs_base__utility__png_filter_4_x86_sse42(curr, prev, 4);
+}
+
+#else  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static inline uint32_t  //
+wuffs_base__utility__crc32_ieee_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {
+  return s;
+}
+
+static inline uint32_t  //
+wuffs_base__utility__crc32_castagnoli_x86_sse42(uint32_t s,
+                                                wuffs_base__slice_u8 x) {
+  return s;
+}
+
+static inline uint32_t  //
+wuffs_base__utility__adler32_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {
+  return s;
+}
+
+static inline uint32_t  //
+wuffs_base__utility__json_string_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  return 0;
+}
+
+static inline uint32_t  //
+wuffs_base__utility__json_skip_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  return 0;
+}
+
+static inline uint32_t  //
+wuffs_base__utility__json_whitespace_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  return 0;
+}
+
+static inline void  //
+wuffs_base__utility__png_filter_1_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr) {}
+
+static inline void  //
+wuffs_base__utility__png_filter_3_distance_3_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {}
+
+static inline void  //
+wuffs_base__utility__png_filter_3_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {}
+
+static inline void  //
+wuffs_base__utility__png_filter_4_distance_3_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {}
+
+static inline void  //
+wuffs_base__utility__png_filter_4_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {}
+
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// ---------------- Ranges and Rects
+
+static inline uint32_t  //
+wuffs_base__range_ii_u32__get_min_incl(const wuffs_base__range_ii_u32* r) {
+  return r->min_incl;
+}
+
+static inline uint32_t  //
+wuffs_base__range_ii_u32__get_max_incl(const wuffs_base__range_ii_u32* r) {
+  return r->max_incl;
+}
+
+static inline uint32_t  //
+wuffs_base__range_ie_u32__get_min_incl(const wuffs_base__range_ie_u32* r) {
+  return r->min_incl;
+}
+
+static inline uint32_t  //
+wuffs_base__range_ie_u32__get_max_excl(const wuffs_base__range_ie_u32* r) {
+  return r->max_excl;
+}
+
+static inline uint64_t  //
+wuffs_base__range_ii_u64__get_min_incl(const wuffs_base__range_ii_u64* r) {
+  return r->min_incl;
+}
+
+static inline uint64_t  //
+wuffs_base__range_ii_u64__get_max_incl(const wuffs_base__range_ii_u64* r) {
+  return r->max_incl;
+}
+
+static inline uint64_t  //
+wuffs_base__range_ie_u64__get_min_incl(const wuffs_base__range_ie_u64* r) {
+  return r->min_incl;
+}
+
+static inline uint64_t  //
+wuffs_base__range_ie_u64__get_max_excl(const wuffs_base__range_ie_u64* r) {
+  return r->max_excl;
+}
+
+// ---------------- Ranges and Rects (Utility)
+
+#define wuffs_base__utility__empty_range_ii_u32 wuffs_base__empty_range_ii_u32
+#define wuffs_base__utility__empty_range_ie_u32 wuffs_base__empty_range_ie_u32
+#define wuffs_base__utility__empty_range_ii_u64 wuffs_base__empty_range_ii_u64
+#define wuffs_base__utility__empty_range_ie_u64 wuffs_base__empty_range_ie_u64
+#define wuffs_base__utility__empty_rect_ii_u32 wuffs_base__empty_rect_ii_u32
+#define wuffs_base__utility__empty_rect_ie_u32 wuffs_base__empty_rect_ie_u32
+#define wuffs_base__utility__make_range_ii_u32 wuffs_base__make_range_ii_u32
+#define wuffs_base__utility__make_range_ie_u32 wuffs_base__make_range_ie_u32
+#define wuffs_base__utility__make_range_ii_u64 wuffs_base__make_range_ii_u64
+#define wuffs_base__utility__make_range_ie_u64 wuffs_base__make_range_ie_u64
+#define wuffs_base__utility__make_rect_ii_u32 wuffs_base__make_rect_ii_u32
+#define wuffs_base__utility__make_rect_ie_u32 wuffs_base__make_rect_ie_u32
+
+// ---------------- I/O
+
+static inline uint64_t  //
+wuffs_base__io__count_since(uint64_t mark, uint64_t index) {
+  if (index >= mark) {
+    return index - mark;
+  }
+  return 0;
+}
+
+static inline wuffs_base__slice_u8  //
+wuffs_base__io__since(uint64_t mark, uint64_t index, uint8_t* ptr) {
+  if (index >= mark) {
+    return wuffs_base__make_slice_u8(ptr + mark, index - mark);
+  }
+  return wuffs_base__make_slice_u8(NULL, 0);
+}
+
+static inline uint32_t  //
+wuffs_base__io_writer__copy_n32_from_history(uint8_t** ptr_iop_w,
+                                             uint8_t* io1_w,
+                                             uint8_t* io2_w,
+                                             uint32_t length,
+                                             uint32_t distance) {
+  if (!distance) {
+    return 0;
+  }
+  uint8_t* p = *ptr_iop_w;
+  if ((size_t)(p - io1_w) < (size_t)(distance)) {
+    return 0;
+  }
+  uint8_t* q = p - distance;
+  size_t n = (size_t)(io2_w - p);
+  if ((size_t)(length) > n) {
+    length = (uint32_t)(n);
+  } else {
+    n = (size_t)(length);
+  }
+  // TODO: unrolling by 3 seems best for the std/deflate benchmarks, but that
+  // is mostly because 3 is the minimum length for the deflate format. This
+  // function implementation shouldn't overfit to that one format. Perhaps the
+  // copy_n32_from_history Wuffs method should also take an unroll hint
+  // argument, and the cgen can look if that argument is the constant
+  // expression '3'.
+  //
+  // See also wuffs_base__io_writer__copy_n32_from_history_fast below, and its
+  // _8_byte_chunks_etc variants that copy 8 bytes at a time.
+  for (; n >= 3; n -= 3) {
+    *p++ = *q++;
+    *p++ = *q++;
+    *p++ = *q++;
+  }
+  for (; n; n--) {
+    *p++ = *q++;
+  }
+  *ptr_iop_w = p;
+  return length;
+}
+
+// wuffs_base__io_writer__copy_n32_from_history_fast is like the
+// wuffs_base__io_writer__copy_n32_from_history function above, but has
+// stronger pre-conditions. The caller needs to prove that:
+//  - distance >  0
+//  - distance <= (*ptr_iop_w - io1_w)
+//  - length   <= (io2_w      - *ptr_iop_w)
+static inline uint32_t  //
+wuffs_base__io_writer__copy_n32_from_history_fast(uint8_t** ptr_iop_w,
+                                                  uint8_t* io1_w,
+                                                  uint8_t* io2_w,
+                                                  uint32_t length,
+                                                  uint32_t distance) {
+  uint8_t* p = *ptr_iop_w;
+  uint8_t* q = p - distance;
+  uint32_t n = length;
+  for (; n >= 3; n -= 3) {
+    *p++ = *q++;
+    *p++ = *q++;
+    *p++ = *q++;
+  }
+  for (; n; n--) {
+    *p++ = *q++;
+  }
+  *ptr_iop_w = p;
+  return length;
+}
+
+// wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast is like the
+// wuffs_base__io_writer__copy_n32_from_history_fast function above, but
+// copies 8 bytes at a time. It can write up to 8 bytes past length (but only
+// advances *ptr_iop_w by length), so the caller needs to prove that:
+//  - distance >= 8
+//  - distance <= (*ptr_iop_w - io1_w)
+//  - (length + 8) <= (io2_w - *ptr_iop_w)
+//
+// A distance of at least 8 means that each 8 byte chunk's source does not
+// overlap its destination, even though a match can overlap itself.
+static inline uint32_t  //
+wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast(
+    uint8_t** ptr_iop_w,
+    uint8_t* io1_w,
+    uint8_t* io2_w,
+    uint32_t length,
+    uint32_t distance) {
+  uint8_t* p = *ptr_iop_w;
+  uint8_t* q = p - distance;
+  uint32_t n = length;
+  while (true) {
+    memcpy(p, q, 8);
+    if (n <= 8) {
+      p += n;
+      break;
+    }
+    p += 8;
+    q += 8;
+    n -= 8;
+  }
+  *ptr_iop_w = p;
+  return length;
+}
+
+// wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_distance_1_fast
+// is like the wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast
+// function above, but for a distance of 1: a run of the previous byte. The
+// caller needs to prove that:
+//  - distance == 1
+//  - distance <= (*ptr_iop_w - io1_w)
+//  - (length + 8) <= (io2_w - *ptr_iop_w)
+static inline uint32_t  //
+wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_distance_1_fast(
+    uint8_t** ptr_iop_w,
+    uint8_t* io1_w,
+    uint8_t* io2_w,
+    uint32_t length,
+    uint32_t distance) {
+  uint8_t* p = *ptr_iop_w;
+  uint64_t x = p[-1];
+  x |= x << 8;
+  x |= x << 16;
+  x |= x << 32;
+  uint32_t n = length;
+  while (true) {
+    wuffs_base__store_u64le__no_bounds_check(p, x);
+    if (n <= 8) {
+      p += n;
+      break;
+    }
+    p += 8;
+    n -= 8;
+  }
+  *ptr_iop_w = p;
+  return length;
+}
+
+static inline uint32_t  //
+wuffs_base__io_writer__copy_n32_from_reader(uint8_t** ptr_iop_w,
+                                            uint8_t* io2_w,
+                                            uint32_t length,
+                                            const uint8_t** ptr_iop_r,
+                                            const uint8_t* io2_r) {
+  uint8_t* iop_w = *ptr_iop_w;
+  size_t n = length;
+  if (n > ((size_t)(io2_w - iop_w))) {
+    n = (size_t)(io2_w - iop_w);
+  }
+  const uint8_t* iop_r = *ptr_iop_r;
+  if (n > ((size_t)(io2_r - iop_r))) {
+    n = (size_t)(io2_r - iop_r);
+  }
+  if (n > 0) {
+    memmove(iop_w, iop_r, n);
+    *ptr_iop_w += n;
+    *ptr_iop_r += n;
+  }
+  return (uint32_t)(n);
+}
+
+// wuffs_base__io_writer__copy_n32_from_reader_16_byte_chunks_fast is like the
+// wuffs_base__io_writer__copy_n32_from_reader function above, but copies 16
+// bytes at a time. It can read and write up to 16 bytes past length (but only
+// advances *ptr_iop_w and *ptr_iop_r by length), so the caller needs to prove
+// that:
+//  - (length + 16) <= (io2_w - *ptr_iop_w)
+//  - (length + 16) <= (io2_r - *ptr_iop_r)
+//
+// Unlike wuffs_base__io_writer__copy_n32_from_reader, it uses memcpy instead
+// of memmove. Short copies are then a single (unaligned) 16 byte load and
+// store. The reader's and writer's buffers may still alias (e.g. decompressing
+// in place), so if the two (length + 16) byte ranges intersect, it falls back
+// to a memmove of exactly length bytes, which neither writes past length nor
+// clobbers source bytes that are yet to be read.
+static inline uint32_t  //
+wuffs_base__io_writer__copy_n32_from_reader_16_byte_chunks_fast(
+    uint8_t** ptr_iop_w,
+    uint8_t* io2_w,
+    uint32_t length,
+    const uint8_t** ptr_iop_r,
+    const uint8_t* io2_r) {
+  uint8_t* p = *ptr_iop_w;
+  const uint8_t* q = *ptr_iop_r;
+  uint32_t n = length;
+  // With m = (length + 16), the two ranges intersect if and only if -m < (q -
+  // p) < m, which is one unsigned comparison.
+  uintptr_t m = ((uintptr_t)length) + 16;
+  if (WUFFS_BASE__UNLIKELY(((uintptr_t)q - (uintptr_t)p + m - 1) <
+                           ((2 * m) - 1))) {
+    memmove(p, q, length);
+    *ptr_iop_w += length;
+    *ptr_iop_r += length;
+    return length;
+  }
+  while (true) {
+    memcpy(p, q, 16);
+    if (n <= 16) {
+      break;
+    }
+    p += 16;
+    q += 16;
+    n -= 16;
+  }
+  *ptr_iop_w += length;
+  *ptr_iop_r += length;
+  return length;
+}
+
+static inline uint64_t  //
+wuffs_base__io_writer__copy_from_slice(uint8_t** ptr_iop_w,
+                                       uint8_t* io2_w,
+                                       wuffs_base__slice_u8 src) {
+  uint8_t* iop_w = *ptr_iop_w;
+  size_t n = src.len;
+  if (n > ((size_t)(io2_w - iop_w))) {
+    n = (size_t)(io2_w - iop_w);
+  }
+  if (n > 0) {
+    memmove(iop_w, src.ptr, n);
+    *ptr_iop_w += n;
+  }
+  return (uint64_t)(n);
+}
+
+static inline uint32_t  //
+wuffs_base__io_writer__copy_n32_from_slice(uint8_t** ptr_iop_w,
+                                           uint8_t* io2_w,
+                                           uint32_t length,
+                                           wuffs_base__slice_u8 src) {
+  uint8_t* iop_w = *ptr_iop_w;
+  size_t n = src.len;
+  if (n > length) {
+    n = length;
+  }
+  if (n > ((size_t)(io2_w - iop_w))) {
+    n = (size_t)(io2_w - iop_w);
+  }
+  if (n > 0) {
+    memmove(iop_w, src.ptr, n);
+    *ptr_iop_w += n;
+  }
+  return (uint32_t)(n);
+}
+
+// wuffs_base__io_reader__match7 returns whether the io_reader's upcoming bytes
+// start with the given prefix (up to 7 bytes long). It is peek-like, not
+// read-like, in that there are no side-effects.
+//
+// The low 3 bits of a hold the prefix length, n.
+//
+// The high 56 bits of a hold the prefix itself, in little-endian order. The
+// first prefix byte is in bits 8..=15, the second prefix byte is in bits
+// 16..=23, etc. The high (8 * (7 - n)) bits are ignored.
+//
+// There are three possible return values:
+//  - 0 means success.
+//  - 1 means inconclusive, equivalent to "$short read".
+//  - 2 means failure.
+static inline uint32_t  //
+wuffs_base__io_reader__match7(const uint8_t* iop_r,
+                              const uint8_t* io2_r,
+                              wuffs_base__io_buffer* r,
+                              uint64_t a) {
+  uint32_t n = a & 7;
+  a >>= 8;
+  if ((io2_r - iop_r) >= 8) {
+    uint64_t x = wuffs_base__load_u64le__no_bounds_check(iop_r);
+    uint32_t shift = 8 * (8 - n);
+    return ((a << shift) == (x << shift)) ? 0 : 2;
+  }
+  for (; n > 0; n--) {
+    if (iop_r >= io2_r) {
+      return (r && r->meta.closed) ? 2 : 1;
+    } else if (*iop_r != ((uint8_t)(a))) {
+      return 2;
+    }
+    iop_r++;
+    a >>= 8;
+  }
+  return 0;
+}
+
+static inline wuffs_base__io_buffer*  //
+wuffs_base__io_reader__set(wuffs_base__io_buffer* b,
+                           const uint8_t** ptr_iop_r,
+                           const uint8_t** ptr_io0_r,
+                           const uint8_t** ptr_io1_r,
+                           const uint8_t** ptr_io2_r,
+                           wuffs_base__slice_u8 data) {
+  b->data = data;
+  b->meta.wi = data.len;
+  b->meta.ri = 0;
+  b->meta.pos = 0;
+  b->meta.closed = false;
+
+  *ptr_iop_r = data.ptr;
+  *ptr_io0_r = data.ptr;
+  *ptr_io1_r = data.ptr;
+  *ptr_io2_r = data.ptr + data.len;
+
+  return b;
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+static inline wuffs_base__slice_u8  //
+wuffs_base__io_reader__since(uint64_t mark,
+                             uint64_t index,
+                             const uint8_t* ptr) {
+  if (index >= mark) {
+    // The arg is what C calls C++'s "const_cast<uint8_t*>(ptr)".
+    return wuffs_base__make_slice_u8(((uint8_t*)(ptr)) + mark, index - mark);
+  }
+  return wuffs_base__make_slice_u8(NULL, 0);
+}
+#pragma GCC diagnostic pop
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+// TODO: can we avoid the const_cast (by deleting this function)? This might
+// involve converting the call sites to take an io_reader instead of a slice u8
+// (the result of io_reader.take).
+static inline wuffs_base__slice_u8  //
+wuffs_base__io_reader__take(const uint8_t** ptr_iop_r,
+                            const uint8_t* io2_r,
+                            uint64_t n) {
+  if (n <= ((size_t)(io2_r - *ptr_iop_r))) {
+    const uint8_t* p = *ptr_iop_r;
+    *ptr_iop_r += n;
+    // The arg is what C calls C++'s "const_cast<uint8_t*>(p)".
+    return wuffs_base__make_slice_u8((uint8_t*)(p), n);
+  }
+  return wuffs_base__make_slice_u8(NULL, 0);
+}
+#pragma GCC diagnostic pop
+
+static inline wuffs_base__io_buffer*  //
+wuffs_base__io_writer__set(wuffs_base__io_buffer* b,
+                           uint8_t** ptr_iop_w,
+                           uint8_t** ptr_io0_w,
+                           uint8_t** ptr_io1_w,
+                           uint8_t** ptr_io2_w,
+                           wuffs_base__slice_u8 data) {
+  b->data = data;
+  b->meta.wi = 0;
+  b->meta.ri = 0;
+  b->meta.pos = 0;
+  b->meta.closed = false;
+
+  *ptr_iop_w = data.ptr;
+  *ptr_io0_w = data.ptr;
+  *ptr_io1_w = data.ptr;
+  *ptr_io2_w = data.ptr + data.len;
+
+  return b;
+}
+
+  // ---------------- I/O (Utility)
+
+#define wuffs_base__utility__empty_io_reader wuffs_base__empty_io_reader
+#define wuffs_base__utility__empty_io_writer wuffs_base__empty_io_writer
+
+// ---------------- Tokens
+
+// ---------------- Tokens (Utility)
+
+// ---------------- Memory Allocation
+
+// ---------------- Images
+
+// ---------------- Images (Utility)
+
+#define wuffs_base__utility__make_pixel_format wuffs_base__make_pixel_format
+
+// ---------------- String Conversions
+
+// ---------------- Unicode and UTF-8
+
+
+// ----------------
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \
+    defined(WUFFS_CONFIG__MODULE__BASE__CORE)
+
+const uint8_t wuffs_base__low_bits_mask__u8[9] = {
+    0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF,
+};
+
+const uint16_t wuffs_base__low_bits_mask__u16[17] = {
+    0x0000, 0x0001, 0x0003, 0x0007, 0x000F, 0x001F, 0x003F, 0x007F, 0x00FF,
+    0x01FF, 0x03FF, 0x07FF, 0x0FFF, 0x1FFF, 0x3FFF, 0x7FFF, 0xFFFF,
+};
+
+const uint32_t wuffs_base__low_bits_mask__u32[33] = {
+    0x00000000, 0x00000001, 0x00000003, 0x00000007, 0x0000000F, 0x0000001F,
+    0x0000003F, 0x0000007F, 0x000000FF, 0x000001FF, 0x000003FF, 0x000007FF,
+    0x00000FFF, 0x00001FFF, 0x00003FFF, 0x00007FFF, 0x0000FFFF, 0x0001FFFF,
+    0x0003FFFF, 0x0007FFFF, 0x000FFFFF, 0x001FFFFF, 0x003FFFFF, 0x007FFFFF,
+    0x00FFFFFF, 0x01FFFFFF, 0x03FFFFFF, 0x07FFFFFF, 0x0FFFFFFF, 0x1FFFFFFF,
+    0x3FFFFFFF, 0x7FFFFFFF, 0xFFFFFFFF,
+};
+
+const uint64_t wuffs_base__low_bits_mask__u64[65] = {
+    0x0000000000000000, 0x0000000000000001, 0x0000000000000003,
+    0x0000000000000007, 0x000000000000000F, 0x000000000000001F,
+    0x000000000000003F, 0x000000000000007F, 0x00000000000000FF,
+    0x00000000000001FF, 0x00000000000003FF, 0x00000000000007FF,
+    0x0000000000000FFF, 0x0000000000001FFF, 0x0000000000003FFF,
+    0x0000000000007FFF, 0x000000000000FFFF, 0x000000000001FFFF,
+    0x000000000003FFFF, 0x000000000007FFFF, 0x00000000000FFFFF,
+    0x00000000001FFFFF, 0x00000000003FFFFF, 0x00000000007FFFFF,
+    0x0000000000FFFFFF, 0x0000000001FFFFFF, 0x0000000003FFFFFF,
+    0x0000000007FFFFFF, 0x000000000FFFFFFF, 0x000000001FFFFFFF,
+    0x000000003FFFFFFF, 0x000000007FFFFFFF, 0x00000000FFFFFFFF,
+    0x00000001FFFFFFFF, 0x00000003FFFFFFFF, 0x00000007FFFFFFFF,
+    0x0000000FFFFFFFFF, 0x0000001FFFFFFFFF, 0x0000003FFFFFFFFF,
+    0x0000007FFFFFFFFF, 0x000000FFFFFFFFFF, 0x000001FFFFFFFFFF,
+    0x000003FFFFFFFFFF, 0x000007FFFFFFFFFF, 0x00000FFFFFFFFFFF,
+    0x00001FFFFFFFFFFF, 0x00003FFFFFFFFFFF, 0x00007FFFFFFFFFFF,
+    0x0000FFFFFFFFFFFF, 0x0001FFFFFFFFFFFF, 0x0003FFFFFFFFFFFF,
+    0x0007FFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x001FFFFFFFFFFFFF,
+    0x003FFFFFFFFFFFFF, 0x007FFFFFFFFFFFFF, 0x00FFFFFFFFFFFFFF,
+    0x01FFFFFFFFFFFFFF, 0x03FFFFFFFFFFFFFF, 0x07FFFFFFFFFFFFFF,
+    0x0FFFFFFFFFFFFFFF, 0x1FFFFFFFFFFFFFFF, 0x3FFFFFFFFFFFFFFF,
+    0x7FFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+};
+
+const uint32_t wuffs_base__pixel_format__bits_per_channel[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x0A, 0x0C, 0x10, 0x18, 0x20, 0x30, 0x40,
+};
+
+const char* wuffs_base__note__i_o_redirect = "@base: I/O redirect";
+const char* wuffs_base__note__end_of_data = "@base: end of data";
+const char* wuffs_base__note__metadata_reported = "@base: metadata reported";
+const char* wuffs_base__suspension__even_more_information = "$base: even more information";
+const char* wuffs_base__suspension__mispositioned_read = "$base: mispositioned read";
+const char* wuffs_base__suspension__mispositioned_write = "$base: mispositioned write";
+const char* wuffs_base__suspension__short_read = "$base: short read";
+const char* wuffs_base__suspension__short_write = "$base: short write";
+const char* wuffs_base__error__bad_i_o_position = "#base: bad I/O position";
+const char* wuffs_base__error__bad_argument_length_too_short = "#base: bad argument (length too short)";
+const char* wuffs_base__error__bad_argument = "#base: bad argument";
+const char* wuffs_base__error__bad_call_sequence = "#base: bad call sequence";
+const char* wuffs_base__error__bad_receiver = "#base: bad receiver";
+const char* wuffs_base__error__bad_restart = "#base: bad restart";
+const char* wuffs_base__error__bad_sizeof_receiver = "#base: bad sizeof receiver";
+const char* wuffs_base__error__bad_vtable = "#base: bad vtable";
+const char* wuffs_base__error__bad_workbuf_length = "#base: bad workbuf length";
+const char* wuffs_base__error__bad_wuffs_version = "#base: bad wuffs version";
+const char* wuffs_base__error__cannot_return_a_suspension = "#base: cannot return a suspension";
+const char* wuffs_base__error__disabled_by_wuffs_config_dst_pixel_format_enable_allowlist = "#base: disabled by WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST";
+const char* wuffs_base__error__disabled_by_previous_error = "#base: disabled by previous error";
+const char* wuffs_base__error__initialize_falsely_claimed_already_zeroed = "#base: initialize falsely claimed already zeroed";
+const char* wuffs_base__error__initialize_not_called = "#base: initialize not called";
+const char* wuffs_base__error__interleaved_coroutine_calls = "#base: interleaved coroutine calls";
+const char* wuffs_base__error__no_more_information = "#base: no more information";
+const char* wuffs_base__error__not_enough_data = "#base: not enough data";
+const char* wuffs_base__error__out_of_bounds = "#base: out of bounds";
+const char* wuffs_base__error__unsupported_method = "#base: unsupported method";
+const char* wuffs_base__error__unsupported_option = "#base: unsupported option";
+const char* wuffs_base__error__unsupported_pixel_swizzler_option = "#base: unsupported pixel swizzler option";
+const char* wuffs_base__error__too_much_data = "#base: too much data";
+
+const char* wuffs_base__hasher_u32__vtable_name = "{vtable}wuffs_base__hasher_u32";
+
+const char* wuffs_base__image_decoder__vtable_name = "{vtable}wuffs_base__image_decoder";
+
+const char* wuffs_base__io_transformer__vtable_name = "{vtable}wuffs_base__io_transformer";
+
+const char* wuffs_base__token_decoder__vtable_name = "{vtable}wuffs_base__token_decoder";
+
+
+// ---------------- String Conversions
+
+// wuffs_base__parse_number__foo_digits entries are 0x00 for invalid digits,
+// and (0x80 | v) for valid digits, where v is the 4 bit value.
+
+static const uint8_t wuffs_base__parse_number__decimal_digits[256] = {
+    // 0     1     2     3     4     5     6     7
+    // 8     9     A     B     C     D     E     F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x00 ..= 0x07.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x08 ..= 0x0F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x10 ..= 0x17.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x18 ..= 0x1F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x20 ..= 0x27.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x28 ..= 0x2F.
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,  // 0x30 ..= 0x37. '0'-'7'.
+    0x88, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x38 ..= 0x3F. '8'-'9'.
+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x40 ..= 0x47.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x48 ..= 0x4F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x50 ..= 0x57.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x58 ..= 0x5F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x60 ..= 0x67.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x68 ..= 0x6F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x70 ..= 0x77.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x78 ..= 0x7F.
+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x80 ..= 0x87.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x88 ..= 0x8F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x90 ..= 0x97.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x98 ..= 0x9F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xA0 ..= 0xA7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xA8 ..= 0xAF.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xB0 ..= 0xB7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xB8 ..= 0xBF.
+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xC0 ..= 0xC7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xC8 ..= 0xCF.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xD0 ..= 0xD7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xD8 ..= 0xDF.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xE0 ..= 0xE7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xE8 ..= 0xEF.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xF0 ..= 0xF7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xF8 ..= 0xFF.
+    // 0     1     2     3     4     5     6     7
+    // 8     9     A     B     C     D     E     F
+};
+
+static const uint8_t wuffs_base__parse_number__hexadecimal_digits[256] = {
+    // 0     1     2     3     4     5     6     7
+    // 8     9     A     B     C     D     E     F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x00 ..= 0x07.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x08 ..= 0x0F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x10 ..= 0x17.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x18 ..= 0x1F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x20 ..= 0x27.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x28 ..= 0x2F.
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,  // 0x30 ..= 0x37. '0'-'7'.
+    0x88, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x38 ..= 0x3F. '8'-'9'.
+
+    0x00, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x00,  // 0x40 ..= 0x47. 'A'-'F'.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x48 ..= 0x4F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x50 ..= 0x57.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x58 ..= 0x5F.
+    0x00, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x00,  // 0x60 ..= 0x67. 'a'-'f'.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x68 ..= 0x6F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x70 ..= 0x77.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x78 ..= 0x7F.
+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x80 ..= 0x87.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x88 ..= 0x8F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x90 ..= 0x97.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x98 ..= 0x9F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xA0 ..= 0xA7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xA8 ..= 0xAF.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xB0 ..= 0xB7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xB8 ..= 0xBF.
+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xC0 ..= 0xC7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xC8 ..= 0xCF.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xD0 ..= 0xD7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xD8 ..= 0xDF.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xE0 ..= 0xE7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xE8 ..= 0xEF.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xF0 ..= 0xF7.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xF8 ..= 0xFF.
+    // 0     1     2     3     4     5     6     7
+    // 8     9     A     B     C     D     E     F
+};
+
+// --------
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__result_i64  //
+wuffs_base__parse_number_i64(wuffs_base__slice_u8 s) {
+  uint8_t* p = s.ptr;
+  uint8_t* q = s.ptr + s.len;
+
+  for (; (p < q) && (*p == '_'); p++) {
+  }
+
+  bool negative = false;
+  if (p >= q) {
+    goto fail_bad_argument;
+  } else if (*p == '-') {
+    p++;
+    negative = true;
+  } else if (*p == '+') {
+    p++;
+  }
+
+  do {
+    wuffs_base__result_u64 r = wuffs_base__parse_number_u64(
+        wuffs_base__make_slice_u8(p, (size_t)(q - p)));
+    if (r.status.repr != NULL) {
+      wuffs_base__result_i64 ret;
+      ret.status.repr = r.status.repr;
+      ret.value = 0;
+      return ret;
+    } else if (negative) {
+      if (r.value > 0x8000000000000000) {
+        goto fail_out_of_bounds;
+      }
+      wuffs_base__result_i64 ret;
+      ret.status.repr = NULL;
+      ret.value = -(int64_t)(r.value);
+      return ret;
+    } else if (r.value > 0x7FFFFFFFFFFFFFFF) {
+      goto fail_out_of_bounds;
+    } else {
+      wuffs_base__result_i64 ret;
+      ret.status.repr = NULL;
+      ret.value = +(int64_t)(r.value);
+      return ret;
+    }
+  } while (0);
+
+fail_bad_argument:
+  do {
+    wuffs_base__result_i64 ret;
+    ret.status.repr = wuffs_base__error__bad_argument;
+    ret.value = 0;
+    return ret;
+  } while (0);
+
+fail_out_of_bounds:
+  do {
+    wuffs_base__result_i64 ret;
+    ret.status.repr = wuffs_base__error__out_of_bounds;
+    ret.value = 0;
+    return ret;
+  } while (0);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__result_u64  //
+wuffs_base__parse_number_u64(wuffs_base__slice_u8 s) {
+  uint8_t* p = s.ptr;
+  uint8_t* q = s.ptr + s.len;
+
+  for (; (p < q) && (*p == '_'); p++) {
+  }
+
+  if (p >= q) {
+    goto fail_bad_argument;
+
+  } else if (*p == '0') {
+    p++;
+    if (p >= q) {
+      goto ok_zero;
+    }
+    if (*p == '_') {
+      p++;
+      for (; p < q; p++) {
+        if (*p != '_') {
+          goto fail_bad_argument;
+        }
+      }
+      goto ok_zero;
+    }
+
+    if ((*p == 'x') || (*p == 'X')) {
+      p++;
+      for (; (p < q) && (*p == '_'); p++) {
+      }
+      if (p < q) {
+        goto hexadecimal;
+      }
+
+    } else if ((*p == 'd') || (*p == 'D')) {
+      p++;
+      for (; (p < q) && (*p == '_'); p++) {
+      }
+      if (p < q) {
+        goto decimal;
+      }
+    }
+
+    goto fail_bad_argument;
+  }
+
+decimal:
+  do {
+    uint64_t v = wuffs_base__parse_number__decimal_digits[*p++];
+    if (v == 0) {
+      goto fail_bad_argument;
+    }
+    v &= 0x0F;
+
+    // UINT64_MAX is 18446744073709551615, which is ((10 * max10) + max1).
+    const uint64_t max10 = 1844674407370955161u;
+    const uint8_t max1 = 5;
+
+    for (; p < q; p++) {
+      if (*p == '_') {
+        continue;
+      }
+      uint8_t digit = wuffs_base__parse_number__decimal_digits[*p];
+      if (digit == 0) {
+        goto fail_bad_argument;
+      }
+      digit &= 0x0F;
+      if ((v > max10) || ((v == max10) && (digit > max1))) {
+        goto fail_out_of_bounds;
+      }
+      v = (10 * v) + ((uint64_t)(digit));
+    }
+
+    wuffs_base__result_u64 ret;
+    ret.status.repr = NULL;
+    ret.value = v;
+    return ret;
+  } while (0);
+
+hexadecimal:
+  do {
+    uint64_t v = wuffs_base__parse_number__hexadecimal_digits[*p++];
+    if (v == 0) {
+      goto fail_bad_argument;
+    }
+    v &= 0x0F;
+
+    for (; p < q; p++) {
+      if (*p == '_') {
+        continue;
+      }
+      uint8_t digit = wuffs_base__parse_number__hexadecimal_digits[*p];
+      if (digit == 0) {
+        goto fail_bad_argument;
+      }
+      digit &= 0x0F;
+      if ((v >> 60) != 0) {
+        goto fail_out_of_bounds;
+      }
+      v = (v << 4) | ((uint64_t)(digit));
+    }
+
+    wuffs_base__result_u64 ret;
+    ret.status.repr = NULL;
+    ret.value = v;
+    return ret;
+  } while (0);
+
+ok_zero:
+  do {
+    wuffs_base__result_u64 ret;
+    ret.status.repr = NULL;
+    ret.value = 0;
+    return ret;
+  } while (0);
+
+fail_bad_argument:
+  do {
+    wuffs_base__result_u64 ret;
+    ret.status.repr = wuffs_base__error__bad_argument;
+    ret.value = 0;
+    return ret;
+  } while (0);
+
+fail_out_of_bounds:
+  do {
+    wuffs_base__result_u64 ret;
+    ret.status.repr = wuffs_base__error__out_of_bounds;
+    ret.value = 0;
+    return ret;
+  } while (0);
+}
+
+// --------
+
+// wuffs_base__render_number__two_digits holds "00", "01", ..., "99".
+static const char wuffs_base__render_number__two_digits[200] = {
+    '0', '0', '0', '1', '0', '2', '0', '3', '0', '4',  //
+    '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',  //
+    '1', '0', '1', '1', '1', '2', '1', '3', '1', '4',  //
+    '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',  //
+    '2', '0', '2', '1', '2', '2', '2', '3', '2', '4',  //
+    '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',  //
+    '3', '0', '3', '1', '3', '2', '3', '3', '3', '4',  //
+    '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',  //
+    '4', '0', '4', '1', '4', '2', '4', '3', '4', '4',  //
+    '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',  //
+    '5', '0', '5', '1', '5', '2', '5', '3', '5', '4',  //
+    '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',  //
+    '6', '0', '6', '1', '6', '2', '6', '3', '6', '4',  //
+    '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',  //
+    '7', '0', '7', '1', '7', '2', '7', '3', '7', '4',  //
+    '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',  //
+    '8', '0', '8', '1', '8', '2', '8', '3', '8', '4',  //
+    '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',  //
+    '9', '0', '9', '1', '9', '2', '9', '3', '9', '4',  //
+    '9', '5', '9', '6', '9', '7', '9', '8', '9', '9',  //
+};
+
+// wuffs_base__private_implementation__render_number_u64 writes x's decimal
+// digits, with an optional leading sign, to dst. It works backwards, from the
+// least significant digit, using a stack-allocated buffer.
+static size_t  //
+wuffs_base__private_implementation__render_number_u64(wuffs_base__slice_u8 dst,
+                                                      uint64_t x,
+                                                      uint8_t sign) {
+  uint8_t buf[WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL];
+  uint8_t* const end = buf + WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL;
+  uint8_t* p = end;
+
+  while (x >= 100) {
+    const char* q = &wuffs_base__render_number__two_digits[2 * (x % 100)];
+    x /= 100;
+    p -= 2;
+    p[0] = (uint8_t)(q[0]);
+    p[1] = (uint8_t)(q[1]);
+  }
+  if (x >= 10) {
+    const char* q = &wuffs_base__render_number__two_digits[2 * x];
+    p -= 2;
+    p[0] = (uint8_t)(q[0]);
+    p[1] = (uint8_t)(q[1]);
+  } else {
+    *--p = (uint8_t)('0' + x);
+  }
+  if (sign) {
+    *--p = sign;
+  }
+
+  size_t n = (size_t)(end - p);
+  if (n > dst.len) {
+    return 0;
+  }
+  memcpy(dst.ptr, p, n);
+  return n;
+}
+
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__render_number_i64(wuffs_base__slice_u8 dst,
+                              int64_t x,
+                              uint32_t options) {
+  // Negating in uint64_t arithmetic avoids undefined behavior when x is
+  // INT64_MIN.
+  if (x < 0) {
+    return wuffs_base__private_implementation__render_number_u64(
+        dst, 1 + ~((uint64_t)(x)), '-');
+  }
+  return wuffs_base__private_implementation__render_number_u64(
+      dst, (uint64_t)(x),
+      (options & WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN) ? '+' : 0);
+}
+
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__render_number_u64(wuffs_base__slice_u8 dst,
+                              uint64_t x,
+                              uint32_t options) {
+  return wuffs_base__private_implementation__render_number_u64(
+      dst, x,
+      (options & WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN) ? '+' : 0);
+}
+
+// ---------------- Hexadecimal
+
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__hexadecimal__decode2(wuffs_base__slice_u8 dst,
+                                 wuffs_base__slice_u8 src) {
+  size_t src_len2 = src.len / 2;
+  size_t len = dst.len < src_len2 ? dst.len : src_len2;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n--) {
+    *d = (uint8_t)((wuffs_base__parse_number__hexadecimal_digits[s[0]] << 4) |
+                   (wuffs_base__parse_number__hexadecimal_digits[s[1]] & 0x0F));
+    d += 1;
+    s += 2;
+  }
+
+  return len;
+}
+
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__hexadecimal__decode4(wuffs_base__slice_u8 dst,
+                                 wuffs_base__slice_u8 src) {
+  size_t src_len4 = src.len / 4;
+  size_t len = dst.len < src_len4 ? dst.len : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n--) {
+    *d = (uint8_t)((wuffs_base__parse_number__hexadecimal_digits[s[2]] << 4) |
+                   (wuffs_base__parse_number__hexadecimal_digits[s[3]] & 0x0F));
+    d += 1;
+    s += 4;
+  }
+
+  return len;
+}
+
+// ---------------- Unicode and UTF-8
+
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__utf_8__encode(wuffs_base__slice_u8 dst, uint32_t code_point) {
+  if (code_point <= 0x7F) {
+    if (dst.len >= 1) {
+      dst.ptr[0] = (uint8_t)(code_point);
+      return 1;
+    }
+
+  } else if (code_point <= 0x07FF) {
+    if (dst.len >= 2) {
+      dst.ptr[0] = (uint8_t)(0xC0 | ((code_point >> 6)));
+      dst.ptr[1] = (uint8_t)(0x80 | ((code_point >> 0) & 0x3F));
+      return 2;
+    }
+
+  } else if (code_point <= 0xFFFF) {
+    if ((dst.len >= 3) && ((code_point < 0xD800) || (0xDFFF < code_point))) {
+      dst.ptr[0] = (uint8_t)(0xE0 | ((code_point >> 12)));
+      dst.ptr[1] = (uint8_t)(0x80 | ((code_point >> 6) & 0x3F));
+      dst.ptr[2] = (uint8_t)(0x80 | ((code_point >> 0) & 0x3F));
+      return 3;
+    }
+
+  } else if (code_point <= 0x10FFFF) {
+    if (dst.len >= 4) {
+      dst.ptr[0] = (uint8_t)(0xF0 | ((code_point >> 18)));
+      dst.ptr[1] = (uint8_t)(0x80 | ((code_point >> 12) & 0x3F));
+      dst.ptr[2] = (uint8_t)(0x80 | ((code_point >> 6) & 0x3F));
+      dst.ptr[3] = (uint8_t)(0x80 | ((code_point >> 0) & 0x3F));
+      return 4;
+    }
+  }
+
+  return 0;
+}
+
+// wuffs_base__utf_8__byte_length_minus_1 is the byte length (minus 1) of a
+// UTF-8 encoded code point, based on the encoding's initial byte.
+//  - 0x00 is 1-byte UTF-8 (ASCII).
+//  - 0x01 is the start of 2-byte UTF-8.
+//  - 0x02 is the start of 3-byte UTF-8.
+//  - 0x03 is the start of 4-byte UTF-8.
+//  - 0x40 is a UTF-8 tail byte.
+//  - 0x80 is invalid UTF-8.
+//
+// RFC 3629 (UTF-8) gives this grammar for valid UTF-8:
+//    UTF8-1      = %x00-7F
+//    UTF8-2      = %xC2-DF UTF8-tail
+//    UTF8-3      = %xE0 %xA0-BF UTF8-tail / %xE1-EC 2( UTF8-tail ) /
+//                  %xED %x80-9F UTF8-tail / %xEE-EF 2( UTF8-tail )
+//    UTF8-4      = %xF0 %x90-BF 2( UTF8-tail ) / %xF1-F3 3( UTF8-tail ) /
+//                  %xF4 %x80-8F 2( UTF8-tail )
+//    UTF8-tail   = %x80-BF
+static const uint8_t wuffs_base__utf_8__byte_length_minus_1[256] = {
+    // 0     1     2     3     4     5     6     7
+    // 8     9     A     B     C     D     E     F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x00 ..= 0x07.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x08 ..= 0x0F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x10 ..= 0x17.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x18 ..= 0x1F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x20 ..= 0x27.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x28 ..= 0x2F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x30 ..= 0x37.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x38 ..= 0x3F.
+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x40 ..= 0x47.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x48 ..= 0x4F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x50 ..= 0x57.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x58 ..= 0x5F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x60 ..= 0x67.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x68 ..= 0x6F.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x70 ..= 0x77.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x78 ..= 0x7F.
+
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0x80 ..= 0x87.
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0x88 ..= 0x8F.
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0x90 ..= 0x97.
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0x98 ..= 0x9F.
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xA0 ..= 0xA7.
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xA8 ..= 0xAF.
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xB0 ..= 0xB7.
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xB8 ..= 0xBF.
+
+    0x80, 0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // 0xC0 ..= 0xC7.
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // 0xC8 ..= 0xCF.
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // 0xD0 ..= 0xD7.
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // 0xD8 ..= 0xDF.
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  // 0xE0 ..= 0xE7.
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  // 0xE8 ..= 0xEF.
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x80, 0x80, 0x80,  // 0xF0 ..= 0xF7.
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,  // 0xF8 ..= 0xFF.
+    // 0     1     2     3     4     5     6     7
+    // 8     9     A     B     C     D     E     F
+};
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__utf_8__next__output  //
+wuffs_base__utf_8__next(wuffs_base__slice_u8 s) {
+  if (s.len == 0) {
+    return wuffs_base__make_utf_8__next__output(0, 0);
+  }
+  uint32_t c = s.ptr[0];
+  switch (wuffs_base__utf_8__byte_length_minus_1[c & 0xFF]) {
+    case 0:
+      return wuffs_base__make_utf_8__next__output(c, 1);
+
+    case 1:
+      if (s.len < 2) {
+        break;
+      }
+      c = wuffs_base__load_u16le__no_bounds_check(s.ptr);
+      if ((c & 0xC000) != 0x8000) {
+        break;
+      }
+      c = (0x0007C0 & (c << 6)) | (0x00003F & (c >> 8));
+      return wuffs_base__make_utf_8__next__output(c, 2);
+
+    case 2:
+      if (s.len < 3) {
+        break;
+      }
+      c = wuffs_base__load_u24le__no_bounds_check(s.ptr);
+      if ((c & 0xC0C000) != 0x808000) {
+        break;
+      }
+      c = (0x00F000 & (c << 12)) | (0x000FC0 & (c >> 2)) |
+          (0x00003F & (c >> 16));
+      if ((c <= 0x07FF) || ((0xD800 <= c) && (c <= 0xDFFF))) {
+        break;
+      }
+      return wuffs_base__make_utf_8__next__output(c, 3);
+
+    case 3:
+      if (s.len < 4) {
+        break;
+      }
+      c = wuffs_base__load_u32le__no_bounds_check(s.ptr);
+      if ((c & 0xC0C0C000) != 0x80808000) {
+        break;
+      }
+      c = (0x1C0000 & (c << 18)) | (0x03F000 & (c << 4)) |
+          (0x000FC0 & (c >> 10)) | (0x00003F & (c >> 24));
+      if ((c <= 0xFFFF) || (0x110000 <= c)) {
+        break;
+      }
+      return wuffs_base__make_utf_8__next__output(c, 4);
+  }
+
+  return wuffs_base__make_utf_8__next__output(
+      WUFFS_BASE__UNICODE_REPLACEMENT_CHARACTER, 1);
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// wuffs_base__private_implementation__utf_8__longest_valid_prefix_x86_sse42
+// returns a length n such that s[..n] is valid UTF-8 and either s[n..] starts
+// with invalid UTF-8 or fewer than 16 bytes remain. It validates 16 bytes at a
+// time, falling back to wuffs_base__utf_8__next when that stops short. The
+// caller finishes the job from s[n..].
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static size_t  //
+wuffs_base__private_implementation__utf_8__longest_valid_prefix_x86_sse42(
+    wuffs_base__slice_u8 s) {
+  uint8_t* p = s.ptr;
+  uint8_t* q = s.ptr + s.len;
+  while ((q - p) >= 16) {
+    __m128i x = _mm_lddqu_si128((const __m128i*)(const void*)p);
+    if (_mm_movemask_epi8(x) == 0) {
+      p += 16;
+      continue;
+    }
+    uint32_t n = wuffs_base__cpu_arch__utf_8_span_x86_sse42(x, 0);
+    if (n == 0) {
+      wuffs_base__utf_8__next__output o = wuffs_base__utf_8__next(
+          wuffs_base__make_slice_u8(p, (size_t)(q - p)));
+      if ((o.code_point > 0x7F) && (o.byte_length == 1)) {
+        break;
+      }
+      n = o.byte_length;
+    }
+    p += n;
+  }
+  return (size_t)(p - s.ptr);
+}
+
+// wuffs_base__private_implementation__ascii__longest_valid_prefix_x86_sse42
+// returns a length n, a multiple of 16, such that s[..n] is valid ASCII and
+// either s[n..n+16] is not or there are fewer than 16 bytes remaining.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static size_t  //
+wuffs_base__private_implementation__ascii__longest_valid_prefix_x86_sse42(
+    wuffs_base__slice_u8 s) {
+  uint8_t* p = s.ptr;
+  uint8_t* q = s.ptr + s.len;
+  for (; (q - p) >= 16; p += 16) {
+    if (_mm_movemask_epi8(_mm_lddqu_si128((const __m128i*)(const void*)p)) !=
+        0) {
+      break;
+    }
+  }
+  return (size_t)(p - s.ptr);
+}
+
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__utf_8__longest_valid_prefix(wuffs_base__slice_u8 s) {
+  size_t original_len = s.len;
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+  if ((s.len >= 16) && wuffs_base__cpu_arch__have_x86_sse42()) {
+    size_t n =
+        wuffs_base__private_implementation__utf_8__longest_valid_prefix_x86_sse42(
+            s);
+    s.ptr += n;
+    s.len -= n;
+  }
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+  while (s.len > 0) {
+    // Consume ASCII 8 bytes at a time.
+    if ((s.len >= 8) && ((wuffs_base__load_u64le__no_bounds_check(s.ptr) &
+                          0x8080808080808080) == 0)) {
+      s.ptr += 8;
+      s.len -= 8;
+      continue;
+    }
+    wuffs_base__utf_8__next__output o = wuffs_base__utf_8__next(s);
+    if ((o.code_point > 0x7F) && (o.byte_length == 1)) {
+      break;
+    }
+    s.ptr += o.byte_length;
+    s.len -= o.byte_length;
+  }
+  return original_len - s.len;
+}
+
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__ascii__longest_valid_prefix(wuffs_base__slice_u8 s) {
+  uint8_t* original_ptr = s.ptr;
+  uint8_t* p = s.ptr;
+  uint8_t* q = s.ptr + s.len;
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+  if ((s.len >= 16) && wuffs_base__cpu_arch__have_x86_sse42()) {
+    p +=
+        wuffs_base__private_implementation__ascii__longest_valid_prefix_x86_sse42(
+            s);
+  }
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+  // Consume ASCII 8 bytes at a time, then 1 byte at a time.
+  for (;
+       ((q - p) >= 8) &&
+       ((wuffs_base__load_u64le__no_bounds_check(p) & 0x8080808080808080) == 0);
+       p += 8) {
+  }
+  for (; (p != q) && ((*p & 0x80) == 0); p++) {
+  }
+  return (size_t)(p - original_ptr);
+}
+
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) ||
+        // defined(WUFFS_CONFIG__MODULE__BASE)  ||
+        // defined(WUFFS_CONFIG__MODULE__BASE__CORE)
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \
+    defined(WUFFS_CONFIG__MODULE__BASE__INTERFACES)
+
+// ---------------- Interface Definitions.
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_base__hasher_u32__set_quirk_enabled(wuffs_base__hasher_u32 *self,uint32_t a_quirk,bool a_enabled){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__hasher_u32__vtable_name) {
+const wuffs_base__hasher_u32__func_ptrs* func_ptrs = (const wuffs_base__hasher_u32__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->set_quirk_enabled)(self,a_quirk,a_enabled);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_empty_struct();
+}
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_base__hasher_u32__update_u32(wuffs_base__hasher_u32 *self,wuffs_base__slice_u8 a_x){
+if (!self) { return 0;}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return 0;}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__hasher_u32__vtable_name) {
+const wuffs_base__hasher_u32__func_ptrs* func_ptrs = (const wuffs_base__hasher_u32__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->update_u32)(self,a_x);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return 0;
+}
+
+// --------
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__image_decoder__decode_frame(wuffs_base__image_decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->decode_frame)(self,a_dst,a_src,a_blend,a_workbuf,a_opts);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_status(wuffs_base__error__bad_vtable);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__image_decoder__decode_frame_config(wuffs_base__image_decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->decode_frame_config)(self,a_dst,a_src);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_status(wuffs_base__error__bad_vtable);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__image_decoder__decode_image_config(wuffs_base__image_decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->decode_image_config)(self,a_dst,a_src);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_status(wuffs_base__error__bad_vtable);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_base__image_decoder__frame_dirty_rect(const wuffs_base__image_decoder *self){
+if (!self) { return wuffs_base__utility__empty_rect_ie_u32();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_rect_ie_u32();}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->frame_dirty_rect)(self);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__utility__empty_rect_ie_u32();
+}
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_base__image_decoder__num_animation_loops(const wuffs_base__image_decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->num_animation_loops)(self);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return 0;
+}
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_base__image_decoder__num_decoded_frame_configs(const wuffs_base__image_decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->num_decoded_frame_configs)(self);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return 0;
+}
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_base__image_decoder__num_decoded_frames(const wuffs_base__image_decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->num_decoded_frames)(self);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return 0;
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_base__image_decoder__restart_frame(wuffs_base__image_decoder *self,uint64_t a_index,uint64_t a_io_position){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->restart_frame)(self,a_index,a_io_position);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_status(wuffs_base__error__bad_vtable);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_base__image_decoder__set_quirk_enabled(wuffs_base__image_decoder *self,uint32_t a_quirk,bool a_enabled){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->set_quirk_enabled)(self,a_quirk,a_enabled);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_empty_struct();
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_base__image_decoder__set_report_metadata(wuffs_base__image_decoder *self,uint32_t a_fourcc,bool a_report){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->set_report_metadata)(self,a_fourcc,a_report);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_empty_struct();
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__image_decoder__tell_me_more(wuffs_base__image_decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->tell_me_more)(self,a_dst,a_minfo,a_src);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_status(wuffs_base__error__bad_vtable);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_base__image_decoder__workbuf_len(const wuffs_base__image_decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__image_decoder__vtable_name) {
+const wuffs_base__image_decoder__func_ptrs* func_ptrs = (const wuffs_base__image_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->workbuf_len)(self);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__utility__empty_range_ii_u64();
+}
+
+// --------
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_base__io_transformer__set_quirk_enabled(wuffs_base__io_transformer *self,uint32_t a_quirk,bool a_enabled){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__io_transformer__vtable_name) {
+const wuffs_base__io_transformer__func_ptrs* func_ptrs = (const wuffs_base__io_transformer__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->set_quirk_enabled)(self,a_quirk,a_enabled);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_empty_struct();
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__io_transformer__transform_io(wuffs_base__io_transformer *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__io_transformer__vtable_name) {
+const wuffs_base__io_transformer__func_ptrs* func_ptrs = (const wuffs_base__io_transformer__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->transform_io)(self,a_dst,a_src,a_workbuf);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_status(wuffs_base__error__bad_vtable);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_base__io_transformer__workbuf_len(const wuffs_base__io_transformer *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__io_transformer__vtable_name) {
+const wuffs_base__io_transformer__func_ptrs* func_ptrs = (const wuffs_base__io_transformer__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->workbuf_len)(self);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__utility__empty_range_ii_u64();
+}
+
+// --------
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_base__token_decoder__decode_tokens(wuffs_base__token_decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__token_decoder__vtable_name) {
+const wuffs_base__token_decoder__func_ptrs* func_ptrs = (const wuffs_base__token_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->decode_tokens)(self,a_dst,a_src,a_workbuf);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_status(wuffs_base__error__bad_vtable);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_base__token_decoder__set_quirk_enabled(wuffs_base__token_decoder *self,uint32_t a_quirk,bool a_enabled){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__token_decoder__vtable_name) {
+const wuffs_base__token_decoder__func_ptrs* func_ptrs = (const wuffs_base__token_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->set_quirk_enabled)(self,a_quirk,a_enabled);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__make_empty_struct();
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_base__token_decoder__workbuf_len(const wuffs_base__token_decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+const wuffs_base__vtable* v = &self->private_impl.first_vtable;
+int i;
+for (i = 0; i < 63; i++) {
+if (v->vtable_name == wuffs_base__token_decoder__vtable_name) {
+const wuffs_base__token_decoder__func_ptrs* func_ptrs = (const wuffs_base__token_decoder__func_ptrs*)(v->function_pointers);
+return (*func_ptrs->workbuf_len)(self);
+} else if (v->vtable_name == NULL) {
+break;
+}
+v++;
+}
+
+return wuffs_base__utility__empty_range_ii_u64();
+}
+
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) ||
+        // defined(WUFFS_CONFIG__MODULE__BASE) ||
+        // defined(WUFFS_CONFIG__MODULE__BASE__INTERFACES)
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \
+    defined(WUFFS_CONFIG__MODULE__BASE__F64CONV)
+
+// ---------------- IEEE 754 Floating Point
+
+#define WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE 1023
+#define WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION 500
+
+// WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL is the largest N
+// such that ((10 << N) < (1 << 64)).
+#define WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL 60
+
+// wuffs_base__private_implementation__high_prec_dec (abbreviated as HPD) is a
+// fixed precision floating point decimal number, augmented with ±infinity
+// values, but it cannot represent NaN (Not a Number).
+//
+// "High precision" means that the mantissa holds 500 decimal digits. 500 is
+// WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION.
+//
+// An HPD isn't for general purpose arithmetic, only for conversions to and
+// from IEEE 754 double-precision floating point, where the largest and
+// smallest positive, finite values are approximately 1.8e+308 and 4.9e-324.
+// HPD exponents above +1023 mean infinity, below -1023 mean zero. The ±1023
+// bounds are further away from zero than ±(324 + 500), where 500 and 1023 is
+// WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION and
+// WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE.
+//
+// digits[.. num_digits] are the number's digits in big-endian order. The
+// uint8_t values are in the range [0 ..= 9], not ['0' ..= '9'], where e.g. '7'
+// is the ASCII value 0x37.
+//
+// decimal_point is the index (within digits) of the decimal point. It may be
+// negative or be larger than num_digits, in which case the explicit digits are
+// padded with implicit zeroes.
+//
+// For example, if num_digits is 3 and digits is "\x07\x08\x09":
+//   - A decimal_point of -2 means ".00789"
+//   - A decimal_point of -1 means ".0789"
+//   - A decimal_point of +0 means ".789"
+//   - A decimal_point of +1 means "7.89"
+//   - A decimal_point of +2 means "78.9"
+//   - A decimal_point of +3 means "789."
+//   - A decimal_point of +4 means "7890."
+//   - A decimal_point of +5 means "78900."
+//
+// As above, a decimal_point higher than +1023 means that the overall value is
+// infinity, lower than -1023 means zero.
+//
+// negative is a sign bit. An HPD can distinguish positive and negative zero.
+//
+// truncated is whether there are more than
+// WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION digits, and at
+// least one of those extra digits are non-zero. The existence of long-tail
+// digits can affect rounding.
+//
+// The "all fields are zero" value is valid, and represents the number +0.
+typedef struct {
+  uint32_t num_digits;
+  int32_t decimal_point;
+  bool negative;
+  bool truncated;
+  uint8_t digits[WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION];
+} wuffs_base__private_implementation__high_prec_dec;
+
+// wuffs_base__private_implementation__high_prec_dec__trim trims trailing
+// zeroes from the h->digits[.. h->num_digits] slice. They have no benefit,
+// since we explicitly track h->decimal_point.
+//
+// Preconditions:
+//  - h is non-NULL.
+static inline void  //
+wuffs_base__private_implementation__high_prec_dec__trim(
+    wuffs_base__private_implementation__high_prec_dec* h) {
+  while ((h->num_digits > 0) && (h->digits[h->num_digits - 1] == 0)) {
+    h->num_digits--;
+  }
+}
+
+static wuffs_base__status  //
+wuffs_base__private_implementation__high_prec_dec__parse(
+    wuffs_base__private_implementation__high_prec_dec* h,
+    wuffs_base__slice_u8 s) {
+  if (!h) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  h->num_digits = 0;
+  h->decimal_point = 0;
+  h->negative = false;
+  h->truncated = false;
+
+  uint8_t* p = s.ptr;
+  uint8_t* q = s.ptr + s.len;
+
+  for (; (p < q) && (*p == '_'); p++) {
+  }
+  if (p >= q) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+
+  // Parse sign.
+  do {
+    if (*p == '+') {
+      p++;
+    } else if (*p == '-') {
+      h->negative = true;
+      p++;
+    } else {
+      break;
+    }
+    for (; (p < q) && (*p == '_'); p++) {
+    }
+  } while (0);
+
+  // Parse digits.
+  uint32_t nd = 0;
+  int32_t dp = 0;
+  bool saw_digits = false;
+  bool saw_non_zero_digits = false;
+  bool saw_dot = false;
+  for (; p < q; p++) {
+    if (*p == '_') {
+      // No-op.
+
+    } else if ((*p == '.') || (*p == ',')) {
+      // As per https://en.wikipedia.org/wiki/Decimal_separator, both '.' or
+      // ',' are commonly used. We just parse either, regardless of LOCALE.
+      if (saw_dot) {
+        return wuffs_base__make_status(wuffs_base__error__bad_argument);
+      }
+      saw_dot = true;
+      dp = (int32_t)nd;
+
+    } else if ('0' == *p) {
+      if (!saw_dot && !saw_non_zero_digits && saw_digits) {
+        // We don't allow unnecessary leading zeroes: "000123" or "0644".
+        return wuffs_base__make_status(wuffs_base__error__bad_argument);
+      }
+      saw_digits = true;
+      if (nd == 0) {
+        // Track leading zeroes implicitly.
+        dp--;
+      } else if (nd <
+                 WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION) {
+        h->digits[nd++] = 0;
+      } else {
+        // Long-tail zeroes are ignored.
+      }
+
+    } else if (('0' < *p) && (*p <= '9')) {
+      if (!saw_dot && !saw_non_zero_digits && saw_digits) {
+        // We don't allow unnecessary leading zeroes: "000123" or "0644".
+        return wuffs_base__make_status(wuffs_base__error__bad_argument);
+      }
+      saw_digits = true;
+      saw_non_zero_digits = true;
+      if (nd < WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION) {
+        h->digits[nd++] = (uint8_t)(*p - '0');
+      } else {
+        // Long-tail non-zeroes set the truncated bit.
+        h->truncated = true;
+      }
+
+    } else {
+      break;
+    }
+  }
+
+  if (!saw_digits) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  if (!saw_dot) {
+    dp = (int32_t)nd;
+  }
+
+  // Parse exponent.
+  if ((p < q) && ((*p == 'E') || (*p == 'e'))) {
+    p++;
+    for (; (p < q) && (*p == '_'); p++) {
+    }
+    if (p >= q) {
+      return wuffs_base__make_status(wuffs_base__error__bad_argument);
+    }
+
+    int32_t exp_sign = +1;
+    if (*p == '+') {
+      p++;
+    } else if (*p == '-') {
+      exp_sign = -1;
+      p++;
+    }
+
+    int32_t exp = 0;
+    const int32_t exp_large =
+        WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE +
+        WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION;
+    bool saw_exp_digits = false;
+    for (; p < q; p++) {
+      if (*p == '_') {
+        // No-op.
+      } else if (('0' <= *p) && (*p <= '9')) {
+        saw_exp_digits = true;
+        if (exp < exp_large) {
+          exp = (10 * exp) + ((int32_t)(*p - '0'));
+        }
+      } else {
+        break;
+      }
+    }
+    if (!saw_exp_digits) {
+      return wuffs_base__make_status(wuffs_base__error__bad_argument);
+    }
+    dp += exp_sign * exp;
+  }
+
+  // Finish.
+  if (p != q) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  h->num_digits = nd;
+  if (nd == 0) {
+    h->decimal_point = 0;
+  } else if (dp <
+             -WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE) {
+    h->decimal_point =
+        -WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE - 1;
+  } else if (dp >
+             +WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE) {
+    h->decimal_point =
+        +WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE + 1;
+  } else {
+    h->decimal_point = dp;
+  }
+  wuffs_base__private_implementation__high_prec_dec__trim(h);
+  return wuffs_base__make_status(NULL);
+}
+
+// --------
+
+// The etc__hpd_left_shift and etc__powers_of_5 tables were printed by
+// script/print-hpd-left-shift.go. That script has an optional -comments flag,
+// whose output is not copied here, which prints further detail.
+//
+// These tables are used in
+// wuffs_base__private_implementation__high_prec_dec__lshift_num_new_digits.
+
+// wuffs_base__private_implementation__hpd_left_shift[i] encodes the number of
+// new digits created after multiplying a positive integer by (1 << i): the
+// additional length in the decimal representation. For example, shifting "234"
+// by 3 (equivalent to multiplying by 8) will produce "1872". Going from a
+// 3-length string to a 4-length string means that 1 new digit was added (and
+// existing digits may have changed).
+//
+// Shifting by i can add either N or N-1 new digits, depending on whether the
+// original positive integer compares >= or < to the i'th power of 5 (as 10
+// equals 2 * 5). Comparison is lexicographic, not numerical.
+//
+// For example, shifting by 4 (i.e. multiplying by 16) can add 1 or 2 new
+// digits, depending on a lexicographic comparison to (5 ** 4), i.e. "625":
+//  - ("1"      << 4) is "16",       which adds 1 new digit.
+//  - ("5678"   << 4) is "90848",    which adds 1 new digit.
+//  - ("624"    << 4) is "9984",     which adds 1 new digit.
+//  - ("62498"  << 4) is "999968",   which adds 1 new digit.
+//  - ("625"    << 4) is "10000",    which adds 2 new digits.
+//  - ("625001" << 4) is "10000016", which adds 2 new digits.
+//  - ("7008"   << 4) is "112128",   which adds 2 new digits.
+//  - ("99"     << 4) is "1584",     which adds 2 new digits.
+//
+// Thus, when i is 4, N is 2 and (5 ** i) is "625". This etc__hpd_left_shift
+// array encodes this as:
+//  - etc__hpd_left_shift[4] is 0x1006 = (2 << 11) | 0x0006.
+//  - etc__hpd_left_shift[5] is 0x1009 = (? << 11) | 0x0009.
+// where the ? isn't relevant for i == 4.
+//
+// The high 5 bits of etc__hpd_left_shift[i] is N, the higher of the two
+// possible number of new digits. The low 11 bits are an offset into the
+// etc__powers_of_5 array (of length 0x051C, so offsets fit in 11 bits). When i
+// is 4, its offset and the next one is 6 and 9, and etc__powers_of_5[6 .. 9]
+// is the string "\x06\x02\x05", so the relevant power of 5 is "625".
+//
+// Thanks to Ken Thompson for the original idea.
+static const uint16_t wuffs_base__private_implementation__hpd_left_shift[65] = {
+    0x0000, 0x0800, 0x0801, 0x0803, 0x1006, 0x1009, 0x100D, 0x1812, 0x1817,
+    0x181D, 0x2024, 0x202B, 0x2033, 0x203C, 0x2846, 0x2850, 0x285B, 0x3067,
+    0x3073, 0x3080, 0x388E, 0x389C, 0x38AB, 0x38BB, 0x40CC, 0x40DD, 0x40EF,
+    0x4902, 0x4915, 0x4929, 0x513E, 0x5153, 0x5169, 0x5180, 0x5998, 0x59B0,
+    0x59C9, 0x61E3, 0x61FD, 0x6218, 0x6A34, 0x6A50, 0x6A6D, 0x6A8B, 0x72AA,
+    0x72C9, 0x72E9, 0x7B0A, 0x7B2B, 0x7B4D, 0x8370, 0x8393, 0x83B7, 0x83DC,
+    0x8C02, 0x8C28, 0x8C4F, 0x9477, 0x949F, 0x94C8, 0x9CF2, 0x051C, 0x051C,
+    0x051C, 0x051C,
+};
+
+// wuffs_base__private_implementation__powers_of_5 contains the powers of 5,
+// concatenated together: "5", "25", "125", "625", "3125", etc.
+static const uint8_t wuffs_base__private_implementation__powers_of_5[0x051C] = {
+    5, 2, 5, 1, 2, 5, 6, 2, 5, 3, 1, 2, 5, 1, 5, 6, 2, 5, 7, 8, 1, 2, 5, 3, 9,
+    0, 6, 2, 5, 1, 9, 5, 3, 1, 2, 5, 9, 7, 6, 5, 6, 2, 5, 4, 8, 8, 2, 8, 1, 2,
+    5, 2, 4, 4, 1, 4, 0, 6, 2, 5, 1, 2, 2, 0, 7, 0, 3, 1, 2, 5, 6, 1, 0, 3, 5,
+    1, 5, 6, 2, 5, 3, 0, 5, 1, 7, 5, 7, 8, 1, 2, 5, 1, 5, 2, 5, 8, 7, 8, 9, 0,
+    6, 2, 5, 7, 6, 2, 9, 3, 9, 4, 5, 3, 1, 2, 5, 3, 8, 1, 4, 6, 9, 7, 2, 6, 5,
+    6, 2, 5, 1, 9, 0, 7, 3, 4, 8, 6, 3, 2, 8, 1, 2, 5, 9, 5, 3, 6, 7, 4, 3, 1,
+    6, 4, 0, 6, 2, 5, 4, 7, 6, 8, 3, 7, 1, 5, 8, 2, 0, 3, 1, 2, 5, 2, 3, 8, 4,
+    1, 8, 5, 7, 9, 1, 0, 1, 5, 6, 2, 5, 1, 1, 9, 2, 0, 9, 2, 8, 9, 5, 5, 0, 7,
+    8, 1, 2, 5, 5, 9, 6, 0, 4, 6, 4, 4, 7, 7, 5, 3, 9, 0, 6, 2, 5, 2, 9, 8, 0,
+    2, 3, 2, 2, 3, 8, 7, 6, 9, 5, 3, 1, 2, 5, 1, 4, 9, 0, 1, 1, 6, 1, 1, 9, 3,
+    8, 4, 7, 6, 5, 6, 2, 5, 7, 4, 5, 0, 5, 8, 0, 5, 9, 6, 9, 2, 3, 8, 2, 8, 1,
+    2, 5, 3, 7, 2, 5, 2, 9, 0, 2, 9, 8, 4, 6, 1, 9, 1, 4, 0, 6, 2, 5, 1, 8, 6,
+    2, 6, 4, 5, 1, 4, 9, 2, 3, 0, 9, 5, 7, 0, 3, 1, 2, 5, 9, 3, 1, 3, 2, 2, 5,
+    7, 4, 6, 1, 5, 4, 7, 8, 5, 1, 5, 6, 2, 5, 4, 6, 5, 6, 6, 1, 2, 8, 7, 3, 0,
+    7, 7, 3, 9, 2, 5, 7, 8, 1, 2, 5, 2, 3, 2, 8, 3, 0, 6, 4, 3, 6, 5, 3, 8, 6,
+    9, 6, 2, 8, 9, 0, 6, 2, 5, 1, 1, 6, 4, 1, 5, 3, 2, 1, 8, 2, 6, 9, 3, 4, 8,
+    1, 4, 4, 5, 3, 1, 2, 5, 5, 8, 2, 0, 7, 6, 6, 0, 9, 1, 3, 4, 6, 7, 4, 0, 7,
+    2, 2, 6, 5, 6, 2, 5, 2, 9, 1, 0, 3, 8, 3, 0, 4, 5, 6, 7, 3, 3, 7, 0, 3, 6,
+    1, 3, 2, 8, 1, 2, 5, 1, 4, 5, 5, 1, 9, 1, 5, 2, 2, 8, 3, 6, 6, 8, 5, 1, 8,
+    0, 6, 6, 4, 0, 6, 2, 5, 7, 2, 7, 5, 9, 5, 7, 6, 1, 4, 1, 8, 3, 4, 2, 5, 9,
+    0, 3, 3, 2, 0, 3, 1, 2, 5, 3, 6, 3, 7, 9, 7, 8, 8, 0, 7, 0, 9, 1, 7, 1, 2,
+    9, 5, 1, 6, 6, 0, 1, 5, 6, 2, 5, 1, 8, 1, 8, 9, 8, 9, 4, 0, 3, 5, 4, 5, 8,
+    5, 6, 4, 7, 5, 8, 3, 0, 0, 7, 8, 1, 2, 5, 9, 0, 9, 4, 9, 4, 7, 0, 1, 7, 7,
+    2, 9, 2, 8, 2, 3, 7, 9, 1, 5, 0, 3, 9, 0, 6, 2, 5, 4, 5, 4, 7, 4, 7, 3, 5,
+    0, 8, 8, 6, 4, 6, 4, 1, 1, 8, 9, 5, 7, 5, 1, 9, 5, 3, 1, 2, 5, 2, 2, 7, 3,
+    7, 3, 6, 7, 5, 4, 4, 3, 2, 3, 2, 0, 5, 9, 4, 7, 8, 7, 5, 9, 7, 6, 5, 6, 2,
+    5, 1, 1, 3, 6, 8, 6, 8, 3, 7, 7, 2, 1, 6, 1, 6, 0, 2, 9, 7, 3, 9, 3, 7, 9,
+    8, 8, 2, 8, 1, 2, 5, 5, 6, 8, 4, 3, 4, 1, 8, 8, 6, 0, 8, 0, 8, 0, 1, 4, 8,
+    6, 9, 6, 8, 9, 9, 4, 1, 4, 0, 6, 2, 5, 2, 8, 4, 2, 1, 7, 0, 9, 4, 3, 0, 4,
+    0, 4, 0, 0, 7, 4, 3, 4, 8, 4, 4, 9, 7, 0, 7, 0, 3, 1, 2, 5, 1, 4, 2, 1, 0,
+    8, 5, 4, 7, 1, 5, 2, 0, 2, 0, 0, 3, 7, 1, 7, 4, 2, 2, 4, 8, 5, 3, 5, 1, 5,
+    6, 2, 5, 7, 1, 0, 5, 4, 2, 7, 3, 5, 7, 6, 0, 1, 0, 0, 1, 8, 5, 8, 7, 1, 1,
+    2, 4, 2, 6, 7, 5, 7, 8, 1, 2, 5, 3, 5, 5, 2, 7, 1, 3, 6, 7, 8, 8, 0, 0, 5,
+    0, 0, 9, 2, 9, 3, 5, 5, 6, 2, 1, 3, 3, 7, 8, 9, 0, 6, 2, 5, 1, 7, 7, 6, 3,
+    5, 6, 8, 3, 9, 4, 0, 0, 2, 5, 0, 4, 6, 4, 6, 7, 7, 8, 1, 0, 6, 6, 8, 9, 4,
+    5, 3, 1, 2, 5, 8, 8, 8, 1, 7, 8, 4, 1, 9, 7, 0, 0, 1, 2, 5, 2, 3, 2, 3, 3,
+    8, 9, 0, 5, 3, 3, 4, 4, 7, 2, 6, 5, 6, 2, 5, 4, 4, 4, 0, 8, 9, 2, 0, 9, 8,
+    5, 0, 0, 6, 2, 6, 1, 6, 1, 6, 9, 4, 5, 2, 6, 6, 7, 2, 3, 6, 3, 2, 8, 1, 2,
+    5, 2, 2, 2, 0, 4, 4, 6, 0, 4, 9, 2, 5, 0, 3, 1, 3, 0, 8, 0, 8, 4, 7, 2, 6,
+    3, 3, 3, 6, 1, 8, 1, 6, 4, 0, 6, 2, 5, 1, 1, 1, 0, 2, 2, 3, 0, 2, 4, 6, 2,
+    5, 1, 5, 6, 5, 4, 0, 4, 2, 3, 6, 3, 1, 6, 6, 8, 0, 9, 0, 8, 2, 0, 3, 1, 2,
+    5, 5, 5, 5, 1, 1, 1, 5, 1, 2, 3, 1, 2, 5, 7, 8, 2, 7, 0, 2, 1, 1, 8, 1, 5,
+    8, 3, 4, 0, 4, 5, 4, 1, 0, 1, 5, 6, 2, 5, 2, 7, 7, 5, 5, 5, 7, 5, 6, 1, 5,
+    6, 2, 8, 9, 1, 3, 5, 1, 0, 5, 9, 0, 7, 9, 1, 7, 0, 2, 2, 7, 0, 5, 0, 7, 8,
+    1, 2, 5, 1, 3, 8, 7, 7, 7, 8, 7, 8, 0, 7, 8, 1, 4, 4, 5, 6, 7, 5, 5, 2, 9,
+    5, 3, 9, 5, 8, 5, 1, 1, 3, 5, 2, 5, 3, 9, 0, 6, 2, 5, 6, 9, 3, 8, 8, 9, 3,
+    9, 0, 3, 9, 0, 7, 2, 2, 8, 3, 7, 7, 6, 4, 7, 6, 9, 7, 9, 2, 5, 5, 6, 7, 6,
+    2, 6, 9, 5, 3, 1, 2, 5, 3, 4, 6, 9, 4, 4, 6, 9, 5, 1, 9, 5, 3, 6, 1, 4, 1,
+    8, 8, 8, 2, 3, 8, 4, 8, 9, 6, 2, 7, 8, 3, 8, 1, 3, 4, 7, 6, 5, 6, 2, 5, 1,
+    7, 3, 4, 7, 2, 3, 4, 7, 5, 9, 7, 6, 8, 0, 7, 0, 9, 4, 4, 1, 1, 9, 2, 4, 4,
+    8, 1, 3, 9, 1, 9, 0, 6, 7, 3, 8, 2, 8, 1, 2, 5, 8, 6, 7, 3, 6, 1, 7, 3, 7,
+    9, 8, 8, 4, 0, 3, 5, 4, 7, 2, 0, 5, 9, 6, 2, 2, 4, 0, 6, 9, 5, 9, 5, 3, 3,
+    6, 9, 1, 4, 0, 6, 2, 5,
+};
+
+// wuffs_base__private_implementation__high_prec_dec__lshift_num_new_digits
+// returns the number of additional decimal digits when left-shifting by shift.
+//
+// See below for preconditions.
+static uint32_t  //
+wuffs_base__private_implementation__high_prec_dec__lshift_num_new_digits(
+    wuffs_base__private_implementation__high_prec_dec* h,
+    uint32_t shift) {
+  // Masking with 0x3F should be unnecessary (assuming the preconditions) but
+  // it's cheap and ensures that we don't overflow the
+  // wuffs_base__private_implementation__hpd_left_shift array.
+  shift &= 63;
+
+  uint32_t x_a = wuffs_base__private_implementation__hpd_left_shift[shift];
+  uint32_t x_b = wuffs_base__private_implementation__hpd_left_shift[shift + 1];
+  uint32_t num_new_digits = x_a >> 11;
+  uint32_t pow5_a = 0x7FF & x_a;
+  uint32_t pow5_b = 0x7FF & x_b;
+
+  const uint8_t* pow5 =
+      &wuffs_base__private_implementation__powers_of_5[pow5_a];
+  uint32_t i = 0;
+  uint32_t n = pow5_b - pow5_a;
+  for (; i < n; i++) {
+    if (i >= h->num_digits) {
+      return num_new_digits - 1;
+    } else if (h->digits[i] == pow5[i]) {
+      continue;
+    } else if (h->digits[i] < pow5[i]) {
+      return num_new_digits - 1;
+    } else {
+      return num_new_digits;
+    }
+  }
+  return num_new_digits;
+}
+
+// --------
+
+// wuffs_base__private_implementation__high_prec_dec__rounded_integer returns
+// the integral (non-fractional) part of h, provided that it is 18 or fewer
+// decimal digits. For 19 or more digits, it returns UINT64_MAX. Note that:
+//   - (1 << 53) is    9007199254740992, which has 16 decimal digits.
+//   - (1 << 56) is   72057594037927936, which has 17 decimal digits.
+//   - (1 << 59) is  576460752303423488, which has 18 decimal digits.
+//   - (1 << 63) is 9223372036854775808, which has 19 decimal digits.
+// and that IEEE 754 double precision has 52 mantissa bits.
+//
+// That integral part is rounded-to-even: rounding 7.5 or 8.5 both give 8.
+//
+// h's negative bit is ignored: rounding -8.6 returns 9.
+//
+// See below for preconditions.
+static uint64_t  //
+wuffs_base__private_implementation__high_prec_dec__rounded_integer(
+    wuffs_base__private_implementation__high_prec_dec* h) {
+  if ((h->num_digits == 0) || (h->decimal_point < 0)) {
+    return 0;
+  } else if (h->decimal_point > 18) {
+    return UINT64_MAX;
+  }
+
+  uint32_t dp = (uint32_t)(h->decimal_point);
+  uint64_t n = 0;
+  uint32_t i = 0;
+  for (; i < dp; i++) {
+    n = (10 * n) + ((i < h->num_digits) ? h->digits[i] : 0);
+  }
+
+  bool round_up = false;
+  if (dp < h->num_digits) {
+    round_up = h->digits[dp] >= 5;
+    if ((h->digits[dp] == 5) && (dp + 1 == h->num_digits)) {
+      // We are exactly halfway. If we're truncated, round up, otherwise round
+      // to even.
+      round_up = h->truncated ||  //
+                 ((dp > 0) && (1 & h->digits[dp - 1]));
+    }
+  }
+  if (round_up) {
+    n++;
+  }
+
+  return n;
+}
+
+// wuffs_base__private_implementation__high_prec_dec__small_xshift shifts h's
+// number (where 'x' is 'l' or 'r' for left or right) by a small shift value.
+//
+// Preconditions:
+//  - h is non-NULL.
+//  - h->decimal_point is "not extreme".
+//  - shift is non-zero.
+//  - shift is "a small shift".
+//
+// "Not extreme" means within
+// ±WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE.
+//
+// "A small shift" means not more than
+// WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL.
+//
+// wuffs_base__private_implementation__high_prec_dec__rounded_integer and
+// wuffs_base__private_implementation__high_prec_dec__lshift_num_new_digits
+// have the same preconditions.
+
+static void  //
+wuffs_base__private_implementation__high_prec_dec__small_lshift(
+    wuffs_base__private_implementation__high_prec_dec* h,
+    uint32_t shift) {
+  if (h->num_digits == 0) {
+    return;
+  }
+  uint32_t num_new_digits =
+      wuffs_base__private_implementation__high_prec_dec__lshift_num_new_digits(
+          h, shift);
+  uint32_t rx = h->num_digits - 1;                   // Read  index.
+  uint32_t wx = h->num_digits - 1 + num_new_digits;  // Write index.
+  uint64_t n = 0;
+
+  // Repeat: pick up a digit, put down a digit, right to left.
+  while (((int32_t)rx) >= 0) {
+    n += ((uint64_t)(h->digits[rx])) << shift;
+    uint64_t quo = n / 10;
+    uint64_t rem = n - (10 * quo);
+    if (wx < WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION) {
+      h->digits[wx] = (uint8_t)rem;
+    } else if (rem > 0) {
+      h->truncated = true;
+    }
+    n = quo;
+    wx--;
+    rx--;
+  }
+
+  // Put down leading digits, right to left.
+  while (n > 0) {
+    uint64_t quo = n / 10;
+    uint64_t rem = n - (10 * quo);
+    if (wx < WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION) {
+      h->digits[wx] = (uint8_t)rem;
+    } else if (rem > 0) {
+      h->truncated = true;
+    }
+    n = quo;
+    wx--;
+  }
+
+  // Finish.
+  h->num_digits += num_new_digits;
+  if (h->num_digits >
+      WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION) {
+    h->num_digits = WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION;
+  }
+  h->decimal_point += (int32_t)num_new_digits;
+  wuffs_base__private_implementation__high_prec_dec__trim(h);
+}
+
+static void  //
+wuffs_base__private_implementation__high_prec_dec__small_rshift(
+    wuffs_base__private_implementation__high_prec_dec* h,
+    uint32_t shift) {
+  uint32_t rx = 0;  // Read  index.
+  uint32_t wx = 0;  // Write index.
+  uint64_t n = 0;
+
+  // Pick up enough leading digits to cover the first shift.
+  while ((n >> shift) == 0) {
+    if (rx < h->num_digits) {
+      // Read a digit.
+      n = (10 * n) + h->digits[rx++];
+    } else if (n == 0) {
+      // h's number used to be zero and remains zero.
+      return;
+    } else {
+      // Read sufficient implicit trailing zeroes.
+      while ((n >> shift) == 0) {
+        n = 10 * n;
+        rx++;
+      }
+      break;
+    }
+  }
+  h->decimal_point -= ((int32_t)(rx - 1));
+  if (h->decimal_point <
+      -WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE) {
+    // After the shift, h's number is effectively zero.
+    h->num_digits = 0;
+    h->decimal_point = 0;
+    h->negative = false;
+    h->truncated = false;
+    return;
+  }
+
+  // Repeat: pick up a digit, put down a digit, left to right.
+  uint64_t mask = (((uint64_t)(1)) << shift) - 1;
+  while (rx < h->num_digits) {
+    uint8_t new_digit = ((uint8_t)(n >> shift));
+    n = (10 * (n & mask)) + h->digits[rx++];
+    h->digits[wx++] = new_digit;
+  }
+
+  // Put down trailing digits, left to right.
+  while (n > 0) {
+    uint8_t new_digit = ((uint8_t)(n >> shift));
+    n = 10 * (n & mask);
+    if (wx < WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DIGITS_PRECISION) {
+      h->digits[wx++] = new_digit;
+    } else if (new_digit > 0) {
+      h->truncated = true;
+    }
+  }
+
+  // Finish.
+  h->num_digits = wx;
+  wuffs_base__private_implementation__high_prec_dec__trim(h);
+}
+
+// --------
+
+// The wuffs_base__private_implementation__etc_powers_of_10 tables were printed
+// by script/print-mpb-powers-of-10.go. That script has an optional -comments
+// flag, whose output is not copied here, which prints further detail.
+//
+// These tables are used in
+// wuffs_base__private_implementation__medium_prec_bin__assign_from_hpd.
+
+// wuffs_base__private_implementation__big_powers_of_10 contains approximations
+// to the powers of 10, ranging from 1e-348 to 1e+340, with the exponent
+// stepping by 8: -348, -340, -332, ..., -12, -4, +4, +12, ..., +340. Each step
+// consists of three uint32_t elements. There are 87 triples, 87 * 3 = 261.
+//
+// For example, the third approximation, for 1e-332, consists of the uint32_t
+// triple (0x3055AC76, 0x8B16FB20, 0xFFFFFB72). The first two of that triple
+// are a little-endian uint64_t value: 0x8B16FB203055AC76. The last one is an
+// int32_t value: -1166. Together, they represent the approximation:
+//   1e-332 ≈ 0x8B16FB203055AC76 * (2 ** -1166)
+// Similarly, the (0x00000000, 0x9C400000, 0xFFFFFFCE) uint32_t triple means:
+//   1e+4   ≈ 0x9C40000000000000 * (2 **   -50)  // This approx'n is exact.
+// Similarly, the (0xD4C4FB27, 0xED63A231, 0x000000A2) uint32_t triple means:
+//   1e+68  ≈ 0xED63A231D4C4FB27 * (2 **   162)
+static const uint32_t
+    wuffs_base__private_implementation__big_powers_of_10[261] = {
+        0x081C0288, 0xFA8FD5A0, 0xFFFFFB3C, 0xA23EBF76, 0xBAAEE17F, 0xFFFFFB57,
+        0x3055AC76, 0x8B16FB20, 0xFFFFFB72, 0x5DCE35EA, 0xCF42894A, 0xFFFFFB8C,
+        0x55653B2D, 0x9A6BB0AA, 0xFFFFFBA7, 0x3D1A45DF, 0xE61ACF03, 0xFFFFFBC1,
+        0xC79AC6CA, 0xAB70FE17, 0xFFFFFBDC, 0xBEBCDC4F, 0xFF77B1FC, 0xFFFFFBF6,
+        0x416BD60C, 0xBE5691EF, 0xFFFFFC11, 0x907FFC3C, 0x8DD01FAD, 0xFFFFFC2C,
+        0x31559A83, 0xD3515C28, 0xFFFFFC46, 0xADA6C9B5, 0x9D71AC8F, 0xFFFFFC61,
+        0x23EE8BCB, 0xEA9C2277, 0xFFFFFC7B, 0x4078536D, 0xAECC4991, 0xFFFFFC96,
+        0x5DB6CE57, 0x823C1279, 0xFFFFFCB1, 0x4DFB5637, 0xC2109436, 0xFFFFFCCB,
+        0x3848984F, 0x9096EA6F, 0xFFFFFCE6, 0x25823AC7, 0xD77485CB, 0xFFFFFD00,
+        0x97BF97F4, 0xA086CFCD, 0xFFFFFD1B, 0x172AACE5, 0xEF340A98, 0xFFFFFD35,
+        0x2A35B28E, 0xB23867FB, 0xFFFFFD50, 0xD2C63F3B, 0x84C8D4DF, 0xFFFFFD6B,
+        0x1AD3CDBA, 0xC5DD4427, 0xFFFFFD85, 0xBB25C996, 0x936B9FCE, 0xFFFFFDA0,
+        0x7D62A584, 0xDBAC6C24, 0xFFFFFDBA, 0x0D5FDAF6, 0xA3AB6658, 0xFFFFFDD5,
+        0xDEC3F126, 0xF3E2F893, 0xFFFFFDEF, 0xAAFF80B8, 0xB5B5ADA8, 0xFFFFFE0A,
+        0x6C7C4A8B, 0x87625F05, 0xFFFFFE25, 0x34C13053, 0xC9BCFF60, 0xFFFFFE3F,
+        0x91BA2655, 0x964E858C, 0xFFFFFE5A, 0x70297EBD, 0xDFF97724, 0xFFFFFE74,
+        0xB8E5B88F, 0xA6DFBD9F, 0xFFFFFE8F, 0x88747D94, 0xF8A95FCF, 0xFFFFFEA9,
+        0x8FA89BCF, 0xB9447093, 0xFFFFFEC4, 0xBF0F156B, 0x8A08F0F8, 0xFFFFFEDF,
+        0x653131B6, 0xCDB02555, 0xFFFFFEF9, 0xD07B7FAC, 0x993FE2C6, 0xFFFFFF14,
+        0x2A2B3B06, 0xE45C10C4, 0xFFFFFF2E, 0x697392D3, 0xAA242499, 0xFFFFFF49,
+        0x8300CA0E, 0xFD87B5F2, 0xFFFFFF63, 0x92111AEB, 0xBCE50864, 0xFFFFFF7E,
+        0x6F5088CC, 0x8CBCCC09, 0xFFFFFF99, 0xE219652C, 0xD1B71758, 0xFFFFFFB3,
+        0x00000000, 0x9C400000, 0xFFFFFFCE, 0x00000000, 0xE8D4A510, 0xFFFFFFE8,
+        0xAC620000, 0xAD78EBC5, 0x00000003, 0xF8940984, 0x813F3978, 0x0000001E,
+        0xC90715B3, 0xC097CE7B, 0x00000038, 0x7BEA5C70, 0x8F7E32CE, 0x00000053,
+        0xABE98068, 0xD5D238A4, 0x0000006D, 0x179A2245, 0x9F4F2726, 0x00000088,
+        0xD4C4FB27, 0xED63A231, 0x000000A2, 0x8CC8ADA8, 0xB0DE6538, 0x000000BD,
+        0x1AAB65DB, 0x83C7088E, 0x000000D8, 0x42711D9A, 0xC45D1DF9, 0x000000F2,
+        0xA61BE758, 0x924D692C, 0x0000010D, 0x1A708DEA, 0xDA01EE64, 0x00000127,
+        0x9AEF774A, 0xA26DA399, 0x00000142, 0xB47D6B85, 0xF209787B, 0x0000015C,
+        0x79DD1877, 0xB454E4A1, 0x00000177, 0x5B9BC5C2, 0x865B8692, 0x00000192,
+        0xC8965D3D, 0xC83553C5, 0x000001AC, 0xFA97A0B3, 0x952AB45C, 0x000001C7,
+        0x99A05FE3, 0xDE469FBD, 0x000001E1, 0xDB398C25, 0xA59BC234, 0x000001FC,
+        0xA3989F5C, 0xF6C69A72, 0x00000216, 0x54E9BECE, 0xB7DCBF53, 0x00000231,
+        0xF22241E2, 0x88FCF317, 0x0000024C, 0xD35C78A5, 0xCC20CE9B, 0x00000266,
+        0x7B2153DF, 0x98165AF3, 0x00000281, 0x971F303A, 0xE2A0B5DC, 0x0000029B,
+        0x5CE3B396, 0xA8D9D153, 0x000002B6, 0xA4A7443C, 0xFB9B7CD9, 0x000002D0,
+        0xA7A44410, 0xBB764C4C, 0x000002EB, 0xB6409C1A, 0x8BAB8EEF, 0x00000306,
+        0xA657842C, 0xD01FEF10, 0x00000320, 0xE9913129, 0x9B10A4E5, 0x0000033B,
+        0xA19C0C9D, 0xE7109BFB, 0x00000355, 0x623BF429, 0xAC2820D9, 0x00000370,
+        0x7AA7CF85, 0x80444B5E, 0x0000038B, 0x03ACDD2D, 0xBF21E440, 0x000003A5,
+        0x5E44FF8F, 0x8E679C2F, 0x000003C0, 0x9C8CB841, 0xD433179D, 0x000003DA,
+        0xB4E31BA9, 0x9E19DB92, 0x000003F5, 0xBADF77D9, 0xEB96BF6E, 0x0000040F,
+        0x9BF0EE6B, 0xAF87023B, 0x0000042A,
+};
+
+// wuffs_base__private_implementation__small_powers_of_10 contains
+// approximations to the powers of 10, ranging from 1e+0 to 1e+7, with the
+// exponent stepping by 1. Each step consists of three uint32_t elements.
+//
+// For example, the third approximation, for 1e+2, consists of the uint32_t
+// triple (0x00000000, 0xC8000000, 0xFFFFFFC7). The first two of that triple
+// are a little-endian uint64_t value: 0xC800000000000000. The last one is an
+// int32_t value: -57. Together, they represent the approximation:
+//   1e+2   ≈ 0xC800000000000000 * (2 **   -57)  // This approx'n is exact.
+// Similarly, the (0x00000000, 0x9C400000, 0xFFFFFFCE) uint32_t triple means:
+//   1e+4   ≈ 0x9C40000000000000 * (2 **   -50)  // This approx'n is exact.
+static const uint32_t
+    wuffs_base__private_implementation__small_powers_of_10[24] = {
+        0x00000000, 0x80000000, 0xFFFFFFC1, 0x00000000, 0xA0000000, 0xFFFFFFC4,
+        0x00000000, 0xC8000000, 0xFFFFFFC7, 0x00000000, 0xFA000000, 0xFFFFFFCA,
+        0x00000000, 0x9C400000, 0xFFFFFFCE, 0x00000000, 0xC3500000, 0xFFFFFFD1,
+        0x00000000, 0xF4240000, 0xFFFFFFD4, 0x00000000, 0x98968000, 0xFFFFFFD8,
+};
+
+// wuffs_base__private_implementation__f64_powers_of_10 holds powers of 10 that
+// can be exactly represented by a float64 (what C calls a double).
+static const double wuffs_base__private_implementation__f64_powers_of_10[23] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// wuffs_base__private_implementation__powers_of_10 contains truncated
+// approximations to the powers of 10, ranging from 1e-307 to 1e+324 inclusive,
+// as 632 pairs of uint64_t values (a 128-bit mantissa).
+//
+// There's also an implicit third column (implied by a linear formula involving
+// the base-10 exponent) that is the base-2 exponent, approximately
+// ((217706 * e) >> 16). See
+// wuffs_base__private_implementation__parse_number_f64_eisel_lemire.
+//
+// Parsing (Eisel-Lemire) uses the 1e-307 to 1e+288 range. Rendering
+// (Schubfach) uses the 1e-292 to 1e+324 range.
+//
+// The approximations are truncated (rounded down), not rounded to nearest,
+// and normalized, so that the high bit of the second (hi) uint64_t is set.
+// For example, the 1e+1 pair (0x0000000000000000, 0xA000000000000000) means:
+//   1e+1 ≈ 0xA000000000000000_0000000000000000 * (2 ** (3 - 127))
+//
+// This table was printed by script/print-eisel-lemire-powers-of-10.go
+static const uint64_t wuffs_base__private_implementation__powers_of_10[632][2] =
+    {
+        {0xA5D3B6D479F8E056, 0x8FD0C16206306BAB},  // 1e-307
+        {0x8F48A4899877186C, 0xB3C4F1BA87BC8696},  // 1e-306
+        {0x331ACDABFE94DE87, 0xE0B62E2929ABA83C},  // 1e-305
+        {0x9FF0C08B7F1D0B14, 0x8C71DCD9BA0B4925},  // 1e-304
+        {0x07ECF0AE5EE44DD9, 0xAF8E5410288E1B6F},  // 1e-303
+        {0xC9E82CD9F69D6150, 0xDB71E91432B1A24A},  // 1e-302
+        {0xBE311C083A225CD2, 0x892731AC9FAF056E},  // 1e-301
+        {0x6DBD630A48AAF406, 0xAB70FE17C79AC6CA},  // 1e-300
+        {0x092CBBCCDAD5B108, 0xD64D3D9DB981787D},  // 1e-299
+        {0x25BBF56008C58EA5, 0x85F0468293F0EB4E},  // 1e-298
+        {0xAF2AF2B80AF6F24E, 0xA76C582338ED2621},  // 1e-297
+        {0x1AF5AF660DB4AEE1, 0xD1476E2C07286FAA},  // 1e-296
+        {0x50D98D9FC890ED4D, 0x82CCA4DB847945CA},  // 1e-295
+        {0xE50FF107BAB528A0, 0xA37FCE126597973C},  // 1e-294
+        {0x1E53ED49A96272C8, 0xCC5FC196FEFD7D0C},  // 1e-293
+        {0x25E8E89C13BB0F7A, 0xFF77B1FCBEBCDC4F},  // 1e-292
+        {0x77B191618C54E9AC, 0x9FAACF3DF73609B1},  // 1e-291
+        {0xD59DF5B9EF6A2417, 0xC795830D75038C1D},  // 1e-290
+        {0x4B0573286B44AD1D, 0xF97AE3D0D2446F25},  // 1e-289
+        {0x4EE367F9430AEC32, 0x9BECCE62836AC577},  // 1e-288
+        {0x229C41F793CDA73F, 0xC2E801FB244576D5},  // 1e-287
+        {0x6B43527578C1110F, 0xF3A20279ED56D48A},  // 1e-286
+        {0x830A13896B78AAA9, 0x9845418C345644D6},  // 1e-285
+        {0x23CC986BC656D553, 0xBE5691EF416BD60C},  // 1e-284
+        {0x2CBFBE86B7EC8AA8, 0xEDEC366B11C6CB8F},  // 1e-283
+        {0x7BF7D71432F3D6A9, 0x94B3A202EB1C3F39},  // 1e-282
+        {0xDAF5CCD93FB0CC53, 0xB9E08A83A5E34F07},  // 1e-281
+        {0xD1B3400F8F9CFF68, 0xE858AD248F5C22C9},  // 1e-280
+        {0x23100809B9C21FA1, 0x91376C36D99995BE},  // 1e-279
+        {0xABD40A0C2832A78A, 0xB58547448FFFFB2D},  // 1e-278
+        {0x16C90C8F323F516C, 0xE2E69915B3FFF9F9},  // 1e-277
+        {0xAE3DA7D97F6792E3, 0x8DD01FAD907FFC3B},  // 1e-276
+        {0x99CD11CFDF41779C, 0xB1442798F49FFB4A},  // 1e-275
+        {0x40405643D711D583, 0xDD95317F31C7FA1D},  // 1e-274
+        {0x482835EA666B2572, 0x8A7D3EEF7F1CFC52},  // 1e-273
+        {0xDA3243650005EECF, 0xAD1C8EAB5EE43B66},  // 1e-272
+        {0x90BED43E40076A82, 0xD863B256369D4A40},  // 1e-271
+        {0x5A7744A6E804A291, 0x873E4F75E2224E68},  // 1e-270
+        {0x711515D0A205CB36, 0xA90DE3535AAAE202},  // 1e-269
+        {0x0D5A5B44CA873E03, 0xD3515C2831559A83},  // 1e-268
+        {0xE858790AFE9486C2, 0x8412D9991ED58091},  // 1e-267
+        {0x626E974DBE39A872, 0xA5178FFF668AE0B6},  // 1e-266
+        {0xFB0A3D212DC8128F, 0xCE5D73FF402D98E3},  // 1e-265
+        {0x7CE66634BC9D0B99, 0x80FA687F881C7F8E},  // 1e-264
+        {0x1C1FFFC1EBC44E80, 0xA139029F6A239F72},  // 1e-263
+        {0xA327FFB266B56220, 0xC987434744AC874E},  // 1e-262
+        {0x4BF1FF9F0062BAA8, 0xFBE9141915D7A922},  // 1e-261
+        {0x6F773FC3603DB4A9, 0x9D71AC8FADA6C9B5},  // 1e-260
+        {0xCB550FB4384D21D3, 0xC4CE17B399107C22},  // 1e-259
+        {0x7E2A53A146606A48, 0xF6019DA07F549B2B},  // 1e-258
+        {0x2EDA7444CBFC426D, 0x99C102844F94E0FB},  // 1e-257
+        {0xFA911155FEFB5308, 0xC0314325637A1939},  // 1e-256
+        {0x793555AB7EBA27CA, 0xF03D93EEBC589F88},  // 1e-255
+        {0x4BC1558B2F3458DE, 0x96267C7535B763B5},  // 1e-254
+        {0x9EB1AAEDFB016F16, 0xBBB01B9283253CA2},  // 1e-253
+        {0x465E15A979C1CADC, 0xEA9C227723EE8BCB},  // 1e-252
+        {0x0BFACD89EC191EC9, 0x92A1958A7675175F},  // 1e-251
+        {0xCEF980EC671F667B, 0xB749FAED14125D36},  // 1e-250
+        {0x82B7E12780E7401A, 0xE51C79A85916F484},  // 1e-249
+        {0xD1B2ECB8B0908810, 0x8F31CC0937AE58D2},  // 1e-248
+        {0x861FA7E6DCB4AA15, 0xB2FE3F0B8599EF07},  // 1e-247
+        {0x67A791E093E1D49A, 0xDFBDCECE67006AC9},  // 1e-246
+        {0xE0C8BB2C5C6D24E0, 0x8BD6A141006042BD},  // 1e-245
+        {0x58FAE9F773886E18, 0xAECC49914078536D},  // 1e-244
+        {0xAF39A475506A899E, 0xDA7F5BF590966848},  // 1e-243
+        {0x6D8406C952429603, 0x888F99797A5E012D},  // 1e-242
+        {0xC8E5087BA6D33B83, 0xAAB37FD7D8F58178},  // 1e-241
+        {0xFB1E4A9A90880A64, 0xD5605FCDCF32E1D6},  // 1e-240
+        {0x5CF2EEA09A55067F, 0x855C3BE0A17FCD26},  // 1e-239
+        {0xF42FAA48C0EA481E, 0xA6B34AD8C9DFC06F},  // 1e-238
+        {0xF13B94DAF124DA26, 0xD0601D8EFC57B08B},  // 1e-237
+        {0x76C53D08D6B70858, 0x823C12795DB6CE57},  // 1e-236
+        {0x54768C4B0C64CA6E, 0xA2CB1717B52481ED},  // 1e-235
+        {0xA9942F5DCF7DFD09, 0xCB7DDCDDA26DA268},  // 1e-234
+        {0xD3F93B35435D7C4C, 0xFE5D54150B090B02},  // 1e-233
+        {0xC47BC5014A1A6DAF, 0x9EFA548D26E5A6E1},  // 1e-232
+        {0x359AB6419CA1091B, 0xC6B8E9B0709F109A},  // 1e-231
+        {0xC30163D203C94B62, 0xF867241C8CC6D4C0},  // 1e-230
+        {0x79E0DE63425DCF1D, 0x9B407691D7FC44F8},  // 1e-229
+        {0x985915FC12F542E4, 0xC21094364DFB5636},  // 1e-228
+        {0x3E6F5B7B17B2939D, 0xF294B943E17A2BC4},  // 1e-227
+        {0xA705992CEECF9C42, 0x979CF3CA6CEC5B5A},  // 1e-226
+        {0x50C6FF782A838353, 0xBD8430BD08277231},  // 1e-225
+        {0xA4F8BF5635246428, 0xECE53CEC4A314EBD},  // 1e-224
+        {0x871B7795E136BE99, 0x940F4613AE5ED136},  // 1e-223
+        {0x28E2557B59846E3F, 0xB913179899F68584},  // 1e-222
+        {0x331AEADA2FE589CF, 0xE757DD7EC07426E5},  // 1e-221
+        {0x3FF0D2C85DEF7621, 0x9096EA6F3848984F},  // 1e-220
+        {0x0FED077A756B53A9, 0xB4BCA50B065ABE63},  // 1e-219
+        {0xD3E8495912C62894, 0xE1EBCE4DC7F16DFB},  // 1e-218
+        {0x64712DD7ABBBD95C, 0x8D3360F09CF6E4BD},  // 1e-217
+        {0xBD8D794D96AACFB3, 0xB080392CC4349DEC},  // 1e-216
+        {0xECF0D7A0FC5583A0, 0xDCA04777F541C567},  // 1e-215
+        {0xF41686C49DB57244, 0x89E42CAAF9491B60},  // 1e-214
+        {0x311C2875C522CED5, 0xAC5D37D5B79B6239},  // 1e-213
+        {0x7D633293366B828B, 0xD77485CB25823AC7},  // 1e-212
+        {0xAE5DFF9C02033197, 0x86A8D39EF77164BC},  // 1e-211
+        {0xD9F57F830283FDFC, 0xA8530886B54DBDEB},  // 1e-210
+        {0xD072DF63C324FD7B, 0xD267CAA862A12D66},  // 1e-209
+        {0x4247CB9E59F71E6D, 0x8380DEA93DA4BC60},  // 1e-208
+        {0x52D9BE85F074E608, 0xA46116538D0DEB78},  // 1e-207
+        {0x67902E276C921F8B, 0xCD795BE870516656},  // 1e-206
+        {0x00BA1CD8A3DB53B6, 0x806BD9714632DFF6},  // 1e-205
+        {0x80E8A40ECCD228A4, 0xA086CFCD97BF97F3},  // 1e-204
+        {0x6122CD128006B2CD, 0xC8A883C0FDAF7DF0},  // 1e-203
+        {0x796B805720085F81, 0xFAD2A4B13D1B5D6C},  // 1e-202
+        {0xCBE3303674053BB0, 0x9CC3A6EEC6311A63},  // 1e-201
+        {0xBEDBFC4411068A9C, 0xC3F490AA77BD60FC},  // 1e-200
+        {0xEE92FB5515482D44, 0xF4F1B4D515ACB93B},  // 1e-199
+        {0x751BDD152D4D1C4A, 0x991711052D8BF3C5},  // 1e-198
+        {0xD262D45A78A0635D, 0xBF5CD54678EEF0B6},  // 1e-197
+        {0x86FB897116C87C34, 0xEF340A98172AACE4},  // 1e-196
+        {0xD45D35E6AE3D4DA0, 0x9580869F0E7AAC0E},  // 1e-195
+        {0x8974836059CCA109, 0xBAE0A846D2195712},  // 1e-194
+        {0x2BD1A438703FC94B, 0xE998D258869FACD7},  // 1e-193
+        {0x7B6306A34627DDCF, 0x91FF83775423CC06},  // 1e-192
+        {0x1A3BC84C17B1D542, 0xB67F6455292CBF08},  // 1e-191
+        {0x20CABA5F1D9E4A93, 0xE41F3D6A7377EECA},  // 1e-190
+        {0x547EB47B7282EE9C, 0x8E938662882AF53E},  // 1e-189
+        {0xE99E619A4F23AA43, 0xB23867FB2A35B28D},  // 1e-188
+        {0x6405FA00E2EC94D4, 0xDEC681F9F4C31F31},  // 1e-187
+        {0xDE83BC408DD3DD04, 0x8B3C113C38F9F37E},  // 1e-186
+        {0x9624AB50B148D445, 0xAE0B158B4738705E},  // 1e-185
+        {0x3BADD624DD9B0957, 0xD98DDAEE19068C76},  // 1e-184
+        {0xE54CA5D70A80E5D6, 0x87F8A8D4CFA417C9},  // 1e-183
+        {0x5E9FCF4CCD211F4C, 0xA9F6D30A038D1DBC},  // 1e-182
+        {0x7647C3200069671F, 0xD47487CC8470652B},  // 1e-181
+        {0x29ECD9F40041E073, 0x84C8D4DFD2C63F3B},  // 1e-180
+        {0xF468107100525890, 0xA5FB0A17C777CF09},  // 1e-179
+        {0x7182148D4066EEB4, 0xCF79CC9DB955C2CC},  // 1e-178
+        {0xC6F14CD848405530, 0x81AC1FE293D599BF},  // 1e-177
+        {0xB8ADA00E5A506A7C, 0xA21727DB38CB002F},  // 1e-176
+        {0xA6D90811F0E4851C, 0xCA9CF1D206FDC03B},  // 1e-175
+        {0x908F4A166D1DA663, 0xFD442E4688BD304A},  // 1e-174
+        {0x9A598E4E043287FE, 0x9E4A9CEC15763E2E},  // 1e-173
+        {0x40EFF1E1853F29FD, 0xC5DD44271AD3CDBA},  // 1e-172
+        {0xD12BEE59E68EF47C, 0xF7549530E188C128},  // 1e-171
+        {0x82BB74F8301958CE, 0x9A94DD3E8CF578B9},  // 1e-170
+        {0xE36A52363C1FAF01, 0xC13A148E3032D6E7},  // 1e-169
+        {0xDC44E6C3CB279AC1, 0xF18899B1BC3F8CA1},  // 1e-168
+        {0x29AB103A5EF8C0B9, 0x96F5600F15A7B7E5},  // 1e-167
+        {0x7415D448F6B6F0E7, 0xBCB2B812DB11A5DE},  // 1e-166
+        {0x111B495B3464AD21, 0xEBDF661791D60F56},  // 1e-165
+        {0xCAB10DD900BEEC34, 0x936B9FCEBB25C995},  // 1e-164
+        {0x3D5D514F40EEA742, 0xB84687C269EF3BFB},  // 1e-163
+        {0x0CB4A5A3112A5112, 0xE65829B3046B0AFA},  // 1e-162
+        {0x47F0E785EABA72AB, 0x8FF71A0FE2C2E6DC},  // 1e-161
+        {0x59ED216765690F56, 0xB3F4E093DB73A093},  // 1e-160
+        {0x306869C13EC3532C, 0xE0F218B8D25088B8},  // 1e-159
+        {0x1E414218C73A13FB, 0x8C974F7383725573},  // 1e-158
+        {0xE5D1929EF90898FA, 0xAFBD2350644EEACF},  // 1e-157
+        {0xDF45F746B74ABF39, 0xDBAC6C247D62A583},  // 1e-156
+        {0x6B8BBA8C328EB783, 0x894BC396CE5DA772},  // 1e-155
+        {0x066EA92F3F326564, 0xAB9EB47C81F5114F},  // 1e-154
+        {0xC80A537B0EFEFEBD, 0xD686619BA27255A2},  // 1e-153
+        {0xBD06742CE95F5F36, 0x8613FD0145877585},  // 1e-152
+        {0x2C48113823B73704, 0xA798FC4196E952E7},  // 1e-151
+        {0xF75A15862CA504C5, 0xD17F3B51FCA3A7A0},  // 1e-150
+        {0x9A984D73DBE722FB, 0x82EF85133DE648C4},  // 1e-149
+        {0xC13E60D0D2E0EBBA, 0xA3AB66580D5FDAF5},  // 1e-148
+        {0x318DF905079926A8, 0xCC963FEE10B7D1B3},  // 1e-147
+        {0xFDF17746497F7052, 0xFFBBCFE994E5C61F},  // 1e-146
+        {0xFEB6EA8BEDEFA633, 0x9FD561F1FD0F9BD3},  // 1e-145
+        {0xFE64A52EE96B8FC0, 0xC7CABA6E7C5382C8},  // 1e-144
+        {0x3DFDCE7AA3C673B0, 0xF9BD690A1B68637B},  // 1e-143
+        {0x06BEA10CA65C084E, 0x9C1661A651213E2D},  // 1e-142
+        {0x486E494FCFF30A62, 0xC31BFA0FE5698DB8},  // 1e-141
+        {0x5A89DBA3C3EFCCFA, 0xF3E2F893DEC3F126},  // 1e-140
+        {0xF89629465A75E01C, 0x986DDB5C6B3A76B7},  // 1e-139
+        {0xF6BBB397F1135823, 0xBE89523386091465},  // 1e-138
+        {0x746AA07DED582E2C, 0xEE2BA6C0678B597F},  // 1e-137
+        {0xA8C2A44EB4571CDC, 0x94DB483840B717EF},  // 1e-136
+        {0x92F34D62616CE413, 0xBA121A4650E4DDEB},  // 1e-135
+        {0x77B020BAF9C81D17, 0xE896A0D7E51E1566},  // 1e-134
+        {0x0ACE1474DC1D122E, 0x915E2486EF32CD60},  // 1e-133
+        {0x0D819992132456BA, 0xB5B5ADA8AAFF80B8},  // 1e-132
+        {0x10E1FFF697ED6C69, 0xE3231912D5BF60E6},  // 1e-131
+        {0xCA8D3FFA1EF463C1, 0x8DF5EFABC5979C8F},  // 1e-130
+        {0xBD308FF8A6B17CB2, 0xB1736B96B6FD83B3},  // 1e-129
+        {0xAC7CB3F6D05DDBDE, 0xDDD0467C64BCE4A0},  // 1e-128
+        {0x6BCDF07A423AA96B, 0x8AA22C0DBEF60EE4},  // 1e-127
+        {0x86C16C98D2C953C6, 0xAD4AB7112EB3929D},  // 1e-126
+        {0xE871C7BF077BA8B7, 0xD89D64D57A607744},  // 1e-125
+        {0x11471CD764AD4972, 0x87625F056C7C4A8B},  // 1e-124
+        {0xD598E40D3DD89BCF, 0xA93AF6C6C79B5D2D},  // 1e-123
+        {0x4AFF1D108D4EC2C3, 0xD389B47879823479},  // 1e-122
+        {0xCEDF722A585139BA, 0x843610CB4BF160CB},  // 1e-121
+        {0xC2974EB4EE658828, 0xA54394FE1EEDB8FE},  // 1e-120
+        {0x733D226229FEEA32, 0xCE947A3DA6A9273E},  // 1e-119
+        {0x0806357D5A3F525F, 0x811CCC668829B887},  // 1e-118
+        {0xCA07C2DCB0CF26F7, 0xA163FF802A3426A8},  // 1e-117
+        {0xFC89B393DD02F0B5, 0xC9BCFF6034C13052},  // 1e-116
+        {0xBBAC2078D443ACE2, 0xFC2C3F3841F17C67},  // 1e-115
+        {0xD54B944B84AA4C0D, 0x9D9BA7832936EDC0},  // 1e-114
+        {0x0A9E795E65D4DF11, 0xC5029163F384A931},  // 1e-113
+        {0x4D4617B5FF4A16D5, 0xF64335BCF065D37D},  // 1e-112
+        {0x504BCED1BF8E4E45, 0x99EA0196163FA42E},  // 1e-111
+        {0xE45EC2862F71E1D6, 0xC06481FB9BCF8D39},  // 1e-110
+        {0x5D767327BB4E5A4C, 0xF07DA27A82C37088},  // 1e-109
+        {0x3A6A07F8D510F86F, 0x964E858C91BA2655},  // 1e-108
+        {0x890489F70A55368B, 0xBBE226EFB628AFEA},  // 1e-107
+        {0x2B45AC74CCEA842E, 0xEADAB0ABA3B2DBE5},  // 1e-106
+        {0x3B0B8BC90012929D, 0x92C8AE6B464FC96F},  // 1e-105
+        {0x09CE6EBB40173744, 0xB77ADA0617E3BBCB},  // 1e-104
+        {0xCC420A6A101D0515, 0xE55990879DDCAABD},  // 1e-103
+        {0x9FA946824A12232D, 0x8F57FA54C2A9EAB6},  // 1e-102
+        {0x47939822DC96ABF9, 0xB32DF8E9F3546564},  // 1e-101
+        {0x59787E2B93BC56F7, 0xDFF9772470297EBD},  // 1e-100
+        {0x57EB4EDB3C55B65A, 0x8BFBEA76C619EF36},  // 1e-99
+        {0xEDE622920B6B23F1, 0xAEFAE51477A06B03},  // 1e-98
+        {0xE95FAB368E45ECED, 0xDAB99E59958885C4},  // 1e-97
+        {0x11DBCB0218EBB414, 0x88B402F7FD75539B},  // 1e-96
+        {0xD652BDC29F26A119, 0xAAE103B5FCD2A881},  // 1e-95
+        {0x4BE76D3346F0495F, 0xD59944A37C0752A2},  // 1e-94
+        {0x6F70A4400C562DDB, 0x857FCAE62D8493A5},  // 1e-93
+        {0xCB4CCD500F6BB952, 0xA6DFBD9FB8E5B88E},  // 1e-92
+        {0x7E2000A41346A7A7, 0xD097AD07A71F26B2},  // 1e-91
+        {0x8ED400668C0C28C8, 0x825ECC24C873782F},  // 1e-90
+        {0x728900802F0F32FA, 0xA2F67F2DFA90563B},  // 1e-89
+        {0x4F2B40A03AD2FFB9, 0xCBB41EF979346BCA},  // 1e-88
+        {0xE2F610C84987BFA8, 0xFEA126B7D78186BC},  // 1e-87
+        {0x0DD9CA7D2DF4D7C9, 0x9F24B832E6B0F436},  // 1e-86
+        {0x91503D1C79720DBB, 0xC6EDE63FA05D3143},  // 1e-85
+        {0x75A44C6397CE912A, 0xF8A95FCF88747D94},  // 1e-84
+        {0xC986AFBE3EE11ABA, 0x9B69DBE1B548CE7C},  // 1e-83
+        {0xFBE85BADCE996168, 0xC24452DA229B021B},  // 1e-82
+        {0xFAE27299423FB9C3, 0xF2D56790AB41C2A2},  // 1e-81
+        {0xDCCD879FC967D41A, 0x97C560BA6B0919A5},  // 1e-80
+        {0x5400E987BBC1C920, 0xBDB6B8E905CB600F},  // 1e-79
+        {0x290123E9AAB23B68, 0xED246723473E3813},  // 1e-78
+        {0xF9A0B6720AAF6521, 0x9436C0760C86E30B},  // 1e-77
+        {0xF808E40E8D5B3E69, 0xB94470938FA89BCE},  // 1e-76
+        {0xB60B1D1230B20E04, 0xE7958CB87392C2C2},  // 1e-75
+        {0xB1C6F22B5E6F48C2, 0x90BD77F3483BB9B9},  // 1e-74
+        {0x1E38AEB6360B1AF3, 0xB4ECD5F01A4AA828},  // 1e-73
+        {0x25C6DA63C38DE1B0, 0xE2280B6C20DD5232},  // 1e-72
+        {0x579C487E5A38AD0E, 0x8D590723948A535F},  // 1e-71
+        {0x2D835A9DF0C6D851, 0xB0AF48EC79ACE837},  // 1e-70
+        {0xF8E431456CF88E65, 0xDCDB1B2798182244},  // 1e-69
+        {0x1B8E9ECB641B58FF, 0x8A08F0F8BF0F156B},  // 1e-68
+        {0xE272467E3D222F3F, 0xAC8B2D36EED2DAC5},  // 1e-67
+        {0x5B0ED81DCC6ABB0F, 0xD7ADF884AA879177},  // 1e-66
+        {0x98E947129FC2B4E9, 0x86CCBB52EA94BAEA},  // 1e-65
+        {0x3F2398D747B36224, 0xA87FEA27A539E9A5},  // 1e-64
+        {0x8EEC7F0D19A03AAD, 0xD29FE4B18E88640E},  // 1e-63
+        {0x1953CF68300424AC, 0x83A3EEEEF9153E89},  // 1e-62
+        {0x5FA8C3423C052DD7, 0xA48CEAAAB75A8E2B},  // 1e-61
+        {0x3792F412CB06794D, 0xCDB02555653131B6},  // 1e-60
+        {0xE2BBD88BBEE40BD0, 0x808E17555F3EBF11},  // 1e-59
+        {0x5B6ACEAEAE9D0EC4, 0xA0B19D2AB70E6ED6},  // 1e-58
+        {0xF245825A5A445275, 0xC8DE047564D20A8B},  // 1e-57
+        {0xEED6E2F0F0D56712, 0xFB158592BE068D2E},  // 1e-56
+        {0x55464DD69685606B, 0x9CED737BB6C4183D},  // 1e-55
+        {0xAA97E14C3C26B886, 0xC428D05AA4751E4C},  // 1e-54
+        {0xD53DD99F4B3066A8, 0xF53304714D9265DF},  // 1e-53
+        {0xE546A8038EFE4029, 0x993FE2C6D07B7FAB},  // 1e-52
+        {0xDE98520472BDD033, 0xBF8FDB78849A5F96},  // 1e-51
+        {0x963E66858F6D4440, 0xEF73D256A5C0F77C},  // 1e-50
+        {0xDDE7001379A44AA8, 0x95A8637627989AAD},  // 1e-49
+        {0x5560C018580D5D52, 0xBB127C53B17EC159},  // 1e-48
+        {0xAAB8F01E6E10B4A6, 0xE9D71B689DDE71AF},  // 1e-47
+        {0xCAB3961304CA70E8, 0x9226712162AB070D},  // 1e-46
+        {0x3D607B97C5FD0D22, 0xB6B00D69BB55C8D1},  // 1e-45
+        {0x8CB89A7DB77C506A, 0xE45C10C42A2B3B05},  // 1e-44
+        {0x77F3608E92ADB242, 0x8EB98A7A9A5B04E3},  // 1e-43
+        {0x55F038B237591ED3, 0xB267ED1940F1C61C},  // 1e-42
+        {0x6B6C46DEC52F6688, 0xDF01E85F912E37A3},  // 1e-41
+        {0x2323AC4B3B3DA015, 0x8B61313BBABCE2C6},  // 1e-40
+        {0xABEC975E0A0D081A, 0xAE397D8AA96C1B77},  // 1e-39
+        {0x96E7BD358C904A21, 0xD9C7DCED53C72255},  // 1e-38
+        {0x7E50D64177DA2E54, 0x881CEA14545C7575},  // 1e-37
+        {0xDDE50BD1D5D0B9E9, 0xAA242499697392D2},  // 1e-36
+        {0x955E4EC64B44E864, 0xD4AD2DBFC3D07787},  // 1e-35
+        {0xBD5AF13BEF0B113E, 0x84EC3C97DA624AB4},  // 1e-34
+        {0xECB1AD8AEACDD58E, 0xA6274BBDD0FADD61},  // 1e-33
+        {0x67DE18EDA5814AF2, 0xCFB11EAD453994BA},  // 1e-32
+        {0x80EACF948770CED7, 0x81CEB32C4B43FCF4},  // 1e-31
+        {0xA1258379A94D028D, 0xA2425FF75E14FC31},  // 1e-30
+        {0x096EE45813A04330, 0xCAD2F7F5359A3B3E},  // 1e-29
+        {0x8BCA9D6E188853FC, 0xFD87B5F28300CA0D},  // 1e-28
+        {0x775EA264CF55347D, 0x9E74D1B791E07E48},  // 1e-27
+        {0x95364AFE032A819D, 0xC612062576589DDA},  // 1e-26
+        {0x3A83DDBD83F52204, 0xF79687AED3EEC551},  // 1e-25
+        {0xC4926A9672793542, 0x9ABE14CD44753B52},  // 1e-24
+        {0x75B7053C0F178293, 0xC16D9A0095928A27},  // 1e-23
+        {0x5324C68B12DD6338, 0xF1C90080BAF72CB1},  // 1e-22
+        {0xD3F6FC16EBCA5E03, 0x971DA05074DA7BEE},  // 1e-21
+        {0x88F4BB1CA6BCF584, 0xBCE5086492111AEA},  // 1e-20
+        {0x2B31E9E3D06C32E5, 0xEC1E4A7DB69561A5},  // 1e-19
+        {0x3AFF322E62439FCF, 0x9392EE8E921D5D07},  // 1e-18
+        {0x09BEFEB9FAD487C2, 0xB877AA3236A4B449},  // 1e-17
+        {0x4C2EBE687989A9B3, 0xE69594BEC44DE15B},  // 1e-16
+        {0x0F9D37014BF60A10, 0x901D7CF73AB0ACD9},  // 1e-15
+        {0x538484C19EF38C94, 0xB424DC35095CD80F},  // 1e-14
+        {0x2865A5F206B06FB9, 0xE12E13424BB40E13},  // 1e-13
+        {0xF93F87B7442E45D3, 0x8CBCCC096F5088CB},  // 1e-12
+        {0xF78F69A51539D748, 0xAFEBFF0BCB24AAFE},  // 1e-11
+        {0xB573440E5A884D1B, 0xDBE6FECEBDEDD5BE},  // 1e-10
+        {0x31680A88F8953030, 0x89705F4136B4A597},  // 1e-9
+        {0xFDC20D2B36BA7C3D, 0xABCC77118461CEFC},  // 1e-8
+        {0x3D32907604691B4C, 0xD6BF94D5E57A42BC},  // 1e-7
+        {0xA63F9A49C2C1B10F, 0x8637BD05AF6C69B5},  // 1e-6
+        {0x0FCF80DC33721D53, 0xA7C5AC471B478423},  // 1e-5
+        {0xD3C36113404EA4A8, 0xD1B71758E219652B},  // 1e-4
+        {0x645A1CAC083126E9, 0x83126E978D4FDF3B},  // 1e-3
+        {0x3D70A3D70A3D70A3, 0xA3D70A3D70A3D70A},  // 1e-2
+        {0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCC},  // 1e-1
+        {0x0000000000000000, 0x8000000000000000},  // 1e0
+        {0x0000000000000000, 0xA000000000000000},  // 1e1
+        {0x0000000000000000, 0xC800000000000000},  // 1e2
+        {0x0000000000000000, 0xFA00000000000000},  // 1e3
+        {0x0000000000000000, 0x9C40000000000000},  // 1e4
+        {0x0000000000000000, 0xC350000000000000},  // 1e5
+        {0x0000000000000000, 0xF424000000000000},  // 1e6
+        {0x0000000000000000, 0x9896800000000000},  // 1e7
+        {0x0000000000000000, 0xBEBC200000000000},  // 1e8
+        {0x0000000000000000, 0xEE6B280000000000},  // 1e9
+        {0x0000000000000000, 0x9502F90000000000},  // 1e10
+        {0x0000000000000000, 0xBA43B74000000000},  // 1e11
+        {0x0000000000000000, 0xE8D4A51000000000},  // 1e12
+        {0x0000000000000000, 0x9184E72A00000000},  // 1e13
+        {0x0000000000000000, 0xB5E620F480000000},  // 1e14
+        {0x0000000000000000, 0xE35FA931A0000000},  // 1e15
+        {0x0000000000000000, 0x8E1BC9BF04000000},  // 1e16
+        {0x0000000000000000, 0xB1A2BC2EC5000000},  // 1e17
+        {0x0000000000000000, 0xDE0B6B3A76400000},  // 1e18
+        {0x0000000000000000, 0x8AC7230489E80000},  // 1e19
+        {0x0000000000000000, 0xAD78EBC5AC620000},  // 1e20
+        {0x0000000000000000, 0xD8D726B7177A8000},  // 1e21
+        {0x0000000000000000, 0x878678326EAC9000},  // 1e22
+        {0x0000000000000000, 0xA968163F0A57B400},  // 1e23
+        {0x0000000000000000, 0xD3C21BCECCEDA100},  // 1e24
+        {0x0000000000000000, 0x84595161401484A0},  // 1e25
+        {0x0000000000000000, 0xA56FA5B99019A5C8},  // 1e26
+        {0x0000000000000000, 0xCECB8F27F4200F3A},  // 1e27
+        {0x4000000000000000, 0x813F3978F8940984},  // 1e28
+        {0x5000000000000000, 0xA18F07D736B90BE5},  // 1e29
+        {0xA400000000000000, 0xC9F2C9CD04674EDE},  // 1e30
+        {0x4D00000000000000, 0xFC6F7C4045812296},  // 1e31
+        {0xF020000000000000, 0x9DC5ADA82B70B59D},  // 1e32
+        {0x6C28000000000000, 0xC5371912364CE305},  // 1e33
+        {0xC732000000000000, 0xF684DF56C3E01BC6},  // 1e34
+        {0x3C7F400000000000, 0x9A130B963A6C115C},  // 1e35
+        {0x4B9F100000000000, 0xC097CE7BC90715B3},  // 1e36
+        {0x1E86D40000000000, 0xF0BDC21ABB48DB20},  // 1e37
+        {0x1314448000000000, 0x96769950B50D88F4},  // 1e38
+        {0x17D955A000000000, 0xBC143FA4E250EB31},  // 1e39
+        {0x5DCFAB0800000000, 0xEB194F8E1AE525FD},  // 1e40
+        {0x5AA1CAE500000000, 0x92EFD1B8D0CF37BE},  // 1e41
+        {0xF14A3D9E40000000, 0xB7ABC627050305AD},  // 1e42
+        {0x6D9CCD05D0000000, 0xE596B7B0C643C719},  // 1e43
+        {0xE4820023A2000000, 0x8F7E32CE7BEA5C6F},  // 1e44
+        {0xDDA2802C8A800000, 0xB35DBF821AE4F38B},  // 1e45
+        {0xD50B2037AD200000, 0xE0352F62A19E306E},  // 1e46
+        {0x4526F422CC340000, 0x8C213D9DA502DE45},  // 1e47
+        {0x9670B12B7F410000, 0xAF298D050E4395D6},  // 1e48
+        {0x3C0CDD765F114000, 0xDAF3F04651D47B4C},  // 1e49
+        {0xA5880A69FB6AC800, 0x88D8762BF324CD0F},  // 1e50
+        {0x8EEA0D047A457A00, 0xAB0E93B6EFEE0053},  // 1e51
+        {0x72A4904598D6D880, 0xD5D238A4ABE98068},  // 1e52
+        {0x47A6DA2B7F864750, 0x85A36366EB71F041},  // 1e53
+        {0x999090B65F67D924, 0xA70C3C40A64E6C51},  // 1e54
+        {0xFFF4B4E3F741CF6D, 0xD0CF4B50CFE20765},  // 1e55
+        {0xBFF8F10E7A8921A4, 0x82818F1281ED449F},  // 1e56
+        {0xAFF72D52192B6A0D, 0xA321F2D7226895C7},  // 1e57
+        {0x9BF4F8A69F764490, 0xCBEA6F8CEB02BB39},  // 1e58
+        {0x02F236D04753D5B4, 0xFEE50B7025C36A08},  // 1e59
+        {0x01D762422C946590, 0x9F4F2726179A2245},  // 1e60
+        {0x424D3AD2B7B97EF5, 0xC722F0EF9D80AAD6},  // 1e61
+        {0xD2E0898765A7DEB2, 0xF8EBAD2B84E0D58B},  // 1e62
+        {0x63CC55F49F88EB2F, 0x9B934C3B330C8577},  // 1e63
+        {0x3CBF6B71C76B25FB, 0xC2781F49FFCFA6D5},  // 1e64
+        {0x8BEF464E3945EF7A, 0xF316271C7FC3908A},  // 1e65
+        {0x97758BF0E3CBB5AC, 0x97EDD871CFDA3A56},  // 1e66
+        {0x3D52EEED1CBEA317, 0xBDE94E8E43D0C8EC},  // 1e67
+        {0x4CA7AAA863EE4BDD, 0xED63A231D4C4FB27},  // 1e68
+        {0x8FE8CAA93E74EF6A, 0x945E455F24FB1CF8},  // 1e69
+        {0xB3E2FD538E122B44, 0xB975D6B6EE39E436},  // 1e70
+        {0x60DBBCA87196B616, 0xE7D34C64A9C85D44},  // 1e71
+        {0xBC8955E946FE31CD, 0x90E40FBEEA1D3A4A},  // 1e72
+        {0x6BABAB6398BDBE41, 0xB51D13AEA4A488DD},  // 1e73
+        {0xC696963C7EED2DD1, 0xE264589A4DCDAB14},  // 1e74
+        {0xFC1E1DE5CF543CA2, 0x8D7EB76070A08AEC},  // 1e75
+        {0x3B25A55F43294BCB, 0xB0DE65388CC8ADA8},  // 1e76
+        {0x49EF0EB713F39EBE, 0xDD15FE86AFFAD912},  // 1e77
+        {0x6E3569326C784337, 0x8A2DBF142DFCC7AB},  // 1e78
+        {0x49C2C37F07965404, 0xACB92ED9397BF996},  // 1e79
+        {0xDC33745EC97BE906, 0xD7E77A8F87DAF7FB},  // 1e80
+        {0x69A028BB3DED71A3, 0x86F0AC99B4E8DAFD},  // 1e81
+        {0xC40832EA0D68CE0C, 0xA8ACD7C0222311BC},  // 1e82
+        {0xF50A3FA490C30190, 0xD2D80DB02AABD62B},  // 1e83
+        {0x792667C6DA79E0FA, 0x83C7088E1AAB65DB},  // 1e84
+        {0x577001B891185938, 0xA4B8CAB1A1563F52},  // 1e85
+        {0xED4C0226B55E6F86, 0xCDE6FD5E09ABCF26},  // 1e86
+        {0x544F8158315B05B4, 0x80B05E5AC60B6178},  // 1e87
+        {0x696361AE3DB1C721, 0xA0DC75F1778E39D6},  // 1e88
+        {0x03BC3A19CD1E38E9, 0xC913936DD571C84C},  // 1e89
+        {0x04AB48A04065C723, 0xFB5878494ACE3A5F},  // 1e90
+        {0x62EB0D64283F9C76, 0x9D174B2DCEC0E47B},  // 1e91
+        {0x3BA5D0BD324F8394, 0xC45D1DF942711D9A},  // 1e92
+        {0xCA8F44EC7EE36479, 0xF5746577930D6500},  // 1e93
+        {0x7E998B13CF4E1ECB, 0x9968BF6ABBE85F20},  // 1e94
+        {0x9E3FEDD8C321A67E, 0xBFC2EF456AE276E8},  // 1e95
+        {0xC5CFE94EF3EA101E, 0xEFB3AB16C59B14A2},  // 1e96
+        {0xBBA1F1D158724A12, 0x95D04AEE3B80ECE5},  // 1e97
+        {0x2A8A6E45AE8EDC97, 0xBB445DA9CA61281F},  // 1e98
+        {0xF52D09D71A3293BD, 0xEA1575143CF97226},  // 1e99
+        {0x593C2626705F9C56, 0x924D692CA61BE758},  // 1e100
+        {0x6F8B2FB00C77836C, 0xB6E0C377CFA2E12E},  // 1e101
+        {0x0B6DFB9C0F956447, 0xE498F455C38B997A},  // 1e102
+        {0x4724BD4189BD5EAC, 0x8EDF98B59A373FEC},  // 1e103
+        {0x58EDEC91EC2CB657, 0xB2977EE300C50FE7},  // 1e104
+        {0x2F2967B66737E3ED, 0xDF3D5E9BC0F653E1},  // 1e105
+        {0xBD79E0D20082EE74, 0x8B865B215899F46C},  // 1e106
+        {0xECD8590680A3AA11, 0xAE67F1E9AEC07187},  // 1e107
+        {0xE80E6F4820CC9495, 0xDA01EE641A708DE9},  // 1e108
+        {0x3109058D147FDCDD, 0x884134FE908658B2},  // 1e109
+        {0xBD4B46F0599FD415, 0xAA51823E34A7EEDE},  // 1e110
+        {0x6C9E18AC7007C91A, 0xD4E5E2CDC1D1EA96},  // 1e111
+        {0x03E2CF6BC604DDB0, 0x850FADC09923329E},  // 1e112
+        {0x84DB8346B786151C, 0xA6539930BF6BFF45},  // 1e113
+        {0xE612641865679A63, 0xCFE87F7CEF46FF16},  // 1e114
+        {0x4FCB7E8F3F60C07E, 0x81F14FAE158C5F6E},  // 1e115
+        {0xE3BE5E330F38F09D, 0xA26DA3999AEF7749},  // 1e116
+        {0x5CADF5BFD3072CC5, 0xCB090C8001AB551C},  // 1e117
+        {0x73D9732FC7C8F7F6, 0xFDCB4FA002162A63},  // 1e118
+        {0x2867E7FDDCDD9AFA, 0x9E9F11C4014DDA7E},  // 1e119
+        {0xB281E1FD541501B8, 0xC646D63501A1511D},  // 1e120
+        {0x1F225A7CA91A4226, 0xF7D88BC24209A565},  // 1e121
+        {0x3375788DE9B06958, 0x9AE757596946075F},  // 1e122
+        {0x0052D6B1641C83AE, 0xC1A12D2FC3978937},  // 1e123
+        {0xC0678C5DBD23A49A, 0xF209787BB47D6B84},  // 1e124
+        {0xF840B7BA963646E0, 0x9745EB4D50CE6332},  // 1e125
+        {0xB650E5A93BC3D898, 0xBD176620A501FBFF},  // 1e126
+        {0xA3E51F138AB4CEBE, 0xEC5D3FA8CE427AFF},  // 1e127
+        {0xC66F336C36B10137, 0x93BA47C980E98CDF},  // 1e128
+        {0xB80B0047445D4184, 0xB8A8D9BBE123F017},  // 1e129
+        {0xA60DC059157491E5, 0xE6D3102AD96CEC1D},  // 1e130
+        {0x87C89837AD68DB2F, 0x9043EA1AC7E41392},  // 1e131
+        {0x29BABE4598C311FB, 0xB454E4A179DD1877},  // 1e132
+        {0xF4296DD6FEF3D67A, 0xE16A1DC9D8545E94},  // 1e133
+        {0x1899E4A65F58660C, 0x8CE2529E2734BB1D},  // 1e134
+        {0x5EC05DCFF72E7F8F, 0xB01AE745B101E9E4},  // 1e135
+        {0x76707543F4FA1F73, 0xDC21A1171D42645D},  // 1e136
+        {0x6A06494A791C53A8, 0x899504AE72497EBA},  // 1e137
+        {0x0487DB9D17636892, 0xABFA45DA0EDBDE69},  // 1e138
+        {0x45A9D2845D3C42B6, 0xD6F8D7509292D603},  // 1e139
+        {0x0B8A2392BA45A9B2, 0x865B86925B9BC5C2},  // 1e140
+        {0x8E6CAC7768D7141E, 0xA7F26836F282B732},  // 1e141
+        {0x3207D795430CD926, 0xD1EF0244AF2364FF},  // 1e142
+        {0x7F44E6BD49E807B8, 0x8335616AED761F1F},  // 1e143
+        {0x5F16206C9C6209A6, 0xA402B9C5A8D3A6E7},  // 1e144
+        {0x36DBA887C37A8C0F, 0xCD036837130890A1},  // 1e145
+        {0xC2494954DA2C9789, 0x802221226BE55A64},  // 1e146
+        {0xF2DB9BAA10B7BD6C, 0xA02AA96B06DEB0FD},  // 1e147
+        {0x6F92829494E5ACC7, 0xC83553C5C8965D3D},  // 1e148
+        {0xCB772339BA1F17F9, 0xFA42A8B73ABBF48C},  // 1e149
+        {0xFF2A760414536EFB, 0x9C69A97284B578D7},  // 1e150
+        {0xFEF5138519684ABA, 0xC38413CF25E2D70D},  // 1e151
+        {0x7EB258665FC25D69, 0xF46518C2EF5B8CD1},  // 1e152
+        {0xEF2F773FFBD97A61, 0x98BF2F79D5993802},  // 1e153
+        {0xAAFB550FFACFD8FA, 0xBEEEFB584AFF8603},  // 1e154
+        {0x95BA2A53F983CF38, 0xEEAABA2E5DBF6784},  // 1e155
+        {0xDD945A747BF26183, 0x952AB45CFA97A0B2},  // 1e156
+        {0x94F971119AEEF9E4, 0xBA756174393D88DF},  // 1e157
+        {0x7A37CD5601AAB85D, 0xE912B9D1478CEB17},  // 1e158
+        {0xAC62E055C10AB33A, 0x91ABB422CCB812EE},  // 1e159
+        {0x577B986B314D6009, 0xB616A12B7FE617AA},  // 1e160
+        {0xED5A7E85FDA0B80B, 0xE39C49765FDF9D94},  // 1e161
+        {0x14588F13BE847307, 0x8E41ADE9FBEBC27D},  // 1e162
+        {0x596EB2D8AE258FC8, 0xB1D219647AE6B31C},  // 1e163
+        {0x6FCA5F8ED9AEF3BB, 0xDE469FBD99A05FE3},  // 1e164
+        {0x25DE7BB9480D5854, 0x8AEC23D680043BEE},  // 1e165
+        {0xAF561AA79A10AE6A, 0xADA72CCC20054AE9},  // 1e166
+        {0x1B2BA1518094DA04, 0xD910F7FF28069DA4},  // 1e167
+        {0x90FB44D2F05D0842, 0x87AA9AFF79042286},  // 1e168
+        {0x353A1607AC744A53, 0xA99541BF57452B28},  // 1e169
+        {0x42889B8997915CE8, 0xD3FA922F2D1675F2},  // 1e170
+        {0x69956135FEBADA11, 0x847C9B5D7C2E09B7},  // 1e171
+        {0x43FAB9837E699095, 0xA59BC234DB398C25},  // 1e172
+        {0x94F967E45E03F4BB, 0xCF02B2C21207EF2E},  // 1e173
+        {0x1D1BE0EEBAC278F5, 0x8161AFB94B44F57D},  // 1e174
+        {0x6462D92A69731732, 0xA1BA1BA79E1632DC},  // 1e175
+        {0x7D7B8F7503CFDCFE, 0xCA28A291859BBF93},  // 1e176
+        {0x5CDA735244C3D43E, 0xFCB2CB35E702AF78},  // 1e177
+        {0x3A0888136AFA64A7, 0x9DEFBF01B061ADAB},  // 1e178
+        {0x088AAA1845B8FDD0, 0xC56BAEC21C7A1916},  // 1e179
+        {0x8AAD549E57273D45, 0xF6C69A72A3989F5B},  // 1e180
+        {0x36AC54E2F678864B, 0x9A3C2087A63F6399},  // 1e181
+        {0x84576A1BB416A7DD, 0xC0CB28A98FCF3C7F},  // 1e182
+        {0x656D44A2A11C51D5, 0xF0FDF2D3F3C30B9F},  // 1e183
+        {0x9F644AE5A4B1B325, 0x969EB7C47859E743},  // 1e184
+        {0x873D5D9F0DDE1FEE, 0xBC4665B596706114},  // 1e185
+        {0xA90CB506D155A7EA, 0xEB57FF22FC0C7959},  // 1e186
+        {0x09A7F12442D588F2, 0x9316FF75DD87CBD8},  // 1e187
+        {0x0C11ED6D538AEB2F, 0xB7DCBF5354E9BECE},  // 1e188
+        {0x8F1668C8A86DA5FA, 0xE5D3EF282A242E81},  // 1e189
+        {0xF96E017D694487BC, 0x8FA475791A569D10},  // 1e190
+        {0x37C981DCC395A9AC, 0xB38D92D760EC4455},  // 1e191
+        {0x85BBE253F47B1417, 0xE070F78D3927556A},  // 1e192
+        {0x93956D7478CCEC8E, 0x8C469AB843B89562},  // 1e193
+        {0x387AC8D1970027B2, 0xAF58416654A6BABB},  // 1e194
+        {0x06997B05FCC0319E, 0xDB2E51BFE9D0696A},  // 1e195
+        {0x441FECE3BDF81F03, 0x88FCF317F22241E2},  // 1e196
+        {0xD527E81CAD7626C3, 0xAB3C2FDDEEAAD25A},  // 1e197
+        {0x8A71E223D8D3B074, 0xD60B3BD56A5586F1},  // 1e198
+        {0xF6872D5667844E49, 0x85C7056562757456},  // 1e199
+        {0xB428F8AC016561DB, 0xA738C6BEBB12D16C},  // 1e200
+        {0xE13336D701BEBA52, 0xD106F86E69D785C7},  // 1e201
+        {0xECC0024661173473, 0x82A45B450226B39C},  // 1e202
+        {0x27F002D7F95D0190, 0xA34D721642B06084},  // 1e203
+        {0x31EC038DF7B441F4, 0xCC20CE9BD35C78A5},  // 1e204
+        {0x7E67047175A15271, 0xFF290242C83396CE},  // 1e205
+        {0x0F0062C6E984D386, 0x9F79A169BD203E41},  // 1e206
+        {0x52C07B78A3E60868, 0xC75809C42C684DD1},  // 1e207
+        {0xA7709A56CCDF8A82, 0xF92E0C3537826145},  // 1e208
+        {0x88A66076400BB691, 0x9BBCC7A142B17CCB},  // 1e209
+        {0x6ACFF893D00EA435, 0xC2ABF989935DDBFE},  // 1e210
+        {0x0583F6B8C4124D43, 0xF356F7EBF83552FE},  // 1e211
+        {0xC3727A337A8B704A, 0x98165AF37B2153DE},  // 1e212
+        {0x744F18C0592E4C5C, 0xBE1BF1B059E9A8D6},  // 1e213
+        {0x1162DEF06F79DF73, 0xEDA2EE1C7064130C},  // 1e214
+        {0x8ADDCB5645AC2BA8, 0x9485D4D1C63E8BE7},  // 1e215
+        {0x6D953E2BD7173692, 0xB9A74A0637CE2EE1},  // 1e216
+        {0xC8FA8DB6CCDD0437, 0xE8111C87C5C1BA99},  // 1e217
+        {0x1D9C9892400A22A2, 0x910AB1D4DB9914A0},  // 1e218
+        {0x2503BEB6D00CAB4B, 0xB54D5E4A127F59C8},  // 1e219
+        {0x2E44AE64840FD61D, 0xE2A0B5DC971F303A},  // 1e220
+        {0x5CEAECFED289E5D2, 0x8DA471A9DE737E24},  // 1e221
+        {0x7425A83E872C5F47, 0xB10D8E1456105DAD},  // 1e222
+        {0xD12F124E28F77719, 0xDD50F1996B947518},  // 1e223
+        {0x82BD6B70D99AAA6F, 0x8A5296FFE33CC92F},  // 1e224
+        {0x636CC64D1001550B, 0xACE73CBFDC0BFB7B},  // 1e225
+        {0x3C47F7E05401AA4E, 0xD8210BEFD30EFA5A},  // 1e226
+        {0x65ACFAEC34810A71, 0x8714A775E3E95C78},  // 1e227
+        {0x7F1839A741A14D0D, 0xA8D9D1535CE3B396},  // 1e228
+        {0x1EDE48111209A050, 0xD31045A8341CA07C},  // 1e229
+        {0x934AED0AAB460432, 0x83EA2B892091E44D},  // 1e230
+        {0xF81DA84D5617853F, 0xA4E4B66B68B65D60},  // 1e231
+        {0x36251260AB9D668E, 0xCE1DE40642E3F4B9},  // 1e232
+        {0xC1D72B7C6B426019, 0x80D2AE83E9CE78F3},  // 1e233
+        {0xB24CF65B8612F81F, 0xA1075A24E4421730},  // 1e234
+        {0xDEE033F26797B627, 0xC94930AE1D529CFC},  // 1e235
+        {0x169840EF017DA3B1, 0xFB9B7CD9A4A7443C},  // 1e236
+        {0x8E1F289560EE864E, 0x9D412E0806E88AA5},  // 1e237
+        {0xF1A6F2BAB92A27E2, 0xC491798A08A2AD4E},  // 1e238
+        {0xAE10AF696774B1DB, 0xF5B5D7EC8ACB58A2},  // 1e239
+        {0xACCA6DA1E0A8EF29, 0x9991A6F3D6BF1765},  // 1e240
+        {0x17FD090A58D32AF3, 0xBFF610B0CC6EDD3F},  // 1e241
+        {0xDDFC4B4CEF07F5B0, 0xEFF394DCFF8A948E},  // 1e242
+        {0x4ABDAF101564F98E, 0x95F83D0A1FB69CD9},  // 1e243
+        {0x9D6D1AD41ABE37F1, 0xBB764C4CA7A4440F},  // 1e244
+        {0x84C86189216DC5ED, 0xEA53DF5FD18D5513},  // 1e245
+        {0x32FD3CF5B4E49BB4, 0x92746B9BE2F8552C},  // 1e246
+        {0x3FBC8C33221DC2A1, 0xB7118682DBB66A77},  // 1e247
+        {0x0FABAF3FEAA5334A, 0xE4D5E82392A40515},  // 1e248
+        {0x29CB4D87F2A7400E, 0x8F05B1163BA6832D},  // 1e249
+        {0x743E20E9EF511012, 0xB2C71D5BCA9023F8},  // 1e250
+        {0x914DA9246B255416, 0xDF78E4B2BD342CF6},  // 1e251
+        {0x1AD089B6C2F7548E, 0x8BAB8EEFB6409C1A},  // 1e252
+        {0xA184AC2473B529B1, 0xAE9672ABA3D0C320},  // 1e253
+        {0xC9E5D72D90A2741E, 0xDA3C0F568CC4F3E8},  // 1e254
+        {0x7E2FA67C7A658892, 0x8865899617FB1871},  // 1e255
+        {0xDDBB901B98FEEAB7, 0xAA7EEBFB9DF9DE8D},  // 1e256
+        {0x552A74227F3EA565, 0xD51EA6FA85785631},  // 1e257
+        {0xD53A88958F87275F, 0x8533285C936B35DE},  // 1e258
+        {0x8A892ABAF368F137, 0xA67FF273B8460356},  // 1e259
+        {0x2D2B7569B0432D85, 0xD01FEF10A657842C},  // 1e260
+        {0x9C3B29620E29FC73, 0x8213F56A67F6B29B},  // 1e261
+        {0x8349F3BA91B47B8F, 0xA298F2C501F45F42},  // 1e262
+        {0x241C70A936219A73, 0xCB3F2F7642717713},  // 1e263
+        {0xED238CD383AA0110, 0xFE0EFB53D30DD4D7},  // 1e264
+        {0xF4363804324A40AA, 0x9EC95D1463E8A506},  // 1e265
+        {0xB143C6053EDCD0D5, 0xC67BB4597CE2CE48},  // 1e266
+        {0xDD94B7868E94050A, 0xF81AA16FDC1B81DA},  // 1e267
+        {0xCA7CF2B4191C8326, 0x9B10A4E5E9913128},  // 1e268
+        {0xFD1C2F611F63A3F0, 0xC1D4CE1F63F57D72},  // 1e269
+        {0xBC633B39673C8CEC, 0xF24A01A73CF2DCCF},  // 1e270
+        {0xD5BE0503E085D813, 0x976E41088617CA01},  // 1e271
+        {0x4B2D8644D8A74E18, 0xBD49D14AA79DBC82},  // 1e272
+        {0xDDF8E7D60ED1219E, 0xEC9C459D51852BA2},  // 1e273
+        {0xCABB90E5C942B503, 0x93E1AB8252F33B45},  // 1e274
+        {0x3D6A751F3B936243, 0xB8DA1662E7B00A17},  // 1e275
+        {0x0CC512670A783AD4, 0xE7109BFBA19C0C9D},  // 1e276
+        {0x27FB2B80668B24C5, 0x906A617D450187E2},  // 1e277
+        {0xB1F9F660802DEDF6, 0xB484F9DC9641E9DA},  // 1e278
+        {0x5E7873F8A0396973, 0xE1A63853BBD26451},  // 1e279
+        {0xDB0B487B6423E1E8, 0x8D07E33455637EB2},  // 1e280
+        {0x91CE1A9A3D2CDA62, 0xB049DC016ABC5E5F},  // 1e281
+        {0x7641A140CC7810FB, 0xDC5C5301C56B75F7},  // 1e282
+        {0xA9E904C87FCB0A9D, 0x89B9B3E11B6329BA},  // 1e283
+        {0x546345FA9FBDCD44, 0xAC2820D9623BF429},  // 1e284
+        {0xA97C177947AD4095, 0xD732290FBACAF133},  // 1e285
+        {0x49ED8EABCCCC485D, 0x867F59A9D4BED6C0},  // 1e286
+        {0x5C68F256BFFF5A74, 0xA81F301449EE8C70},  // 1e287
+        {0x73832EEC6FFF3111, 0xD226FC195C6A2F8C},  // 1e288
+        {0xC831FD53C5FF7EAB, 0x83585D8FD9C25DB7},  // 1e289
+        {0xBA3E7CA8B77F5E55, 0xA42E74F3D032F525},  // 1e290
+        {0x28CE1BD2E55F35EB, 0xCD3A1230C43FB26F},  // 1e291
+        {0x7980D163CF5B81B3, 0x80444B5E7AA7CF85},  // 1e292
+        {0xD7E105BCC332621F, 0xA0555E361951C366},  // 1e293
+        {0x8DD9472BF3FEFAA7, 0xC86AB5C39FA63440},  // 1e294
+        {0xB14F98F6F0FEB951, 0xFA856334878FC150},  // 1e295
+        {0x6ED1BF9A569F33D3, 0x9C935E00D4B9D8D2},  // 1e296
+        {0x0A862F80EC4700C8, 0xC3B8358109E84F07},  // 1e297
+        {0xCD27BB612758C0FA, 0xF4A642E14C6262C8},  // 1e298
+        {0x8038D51CB897789C, 0x98E7E9CCCFBD7DBD},  // 1e299
+        {0xE0470A63E6BD56C3, 0xBF21E44003ACDD2C},  // 1e300
+        {0x1858CCFCE06CAC74, 0xEEEA5D5004981478},  // 1e301
+        {0x0F37801E0C43EBC8, 0x95527A5202DF0CCB},  // 1e302
+        {0xD30560258F54E6BA, 0xBAA718E68396CFFD},  // 1e303
+        {0x47C6B82EF32A2069, 0xE950DF20247C83FD},  // 1e304
+        {0x4CDC331D57FA5441, 0x91D28B7416CDD27E},  // 1e305
+        {0xE0133FE4ADF8E952, 0xB6472E511C81471D},  // 1e306
+        {0x58180FDDD97723A6, 0xE3D8F9E563A198E5},  // 1e307
+        {0x570F09EAA7EA7648, 0x8E679C2F5E44FF8F},  // 1e308
+        {0x2CD2CC6551E513DA, 0xB201833B35D63F73},  // 1e309
+        {0xF8077F7EA65E58D1, 0xDE81E40A034BCF4F},  // 1e310
+        {0xFB04AFAF27FAF782, 0x8B112E86420F6191},  // 1e311
+        {0x79C5DB9AF1F9B563, 0xADD57A27D29339F6},  // 1e312
+        {0x18375281AE7822BC, 0xD94AD8B1C7380874},  // 1e313
+        {0x8F2293910D0B15B5, 0x87CEC76F1C830548},  // 1e314
+        {0xB2EB3875504DDB22, 0xA9C2794AE3A3C69A},  // 1e315
+        {0x5FA60692A46151EB, 0xD433179D9C8CB841},  // 1e316
+        {0xDBC7C41BA6BCD333, 0x849FEEC281D7F328},  // 1e317
+        {0x12B9B522906C0800, 0xA5C7EA73224DEFF3},  // 1e318
+        {0xD768226B34870A00, 0xCF39E50FEAE16BEF},  // 1e319
+        {0xE6A1158300D46640, 0x81842F29F2CCE375},  // 1e320
+        {0x60495AE3C1097FD0, 0xA1E53AF46F801C53},  // 1e321
+        {0x385BB19CB14BDFC4, 0xCA5E89B18B602368},  // 1e322
+        {0x46729E03DD9ED7B5, 0xFCF62C1DEE382C42},  // 1e323
+        {0x6C07A2C26A8346D1, 0x9E19DB92B4E31BA9},  // 1e324
+};
+
+// --------
+
+// wuffs_base__private_implementation__parse_number_f64_eisel_lemire produces
+// the IEEE 754 double-precision value for an exact mantissa and base-10
+// exponent. For example:
+//  - when parsing "12345.678e+02", man is 12345678 and exp10 is -1.
+//  - when parsing "-12", man is 12 and exp10 is 0. Processing the leading
+//    minus sign is the responsibility of the caller, not this function.
+//
+// On success, it returns a non-negative int64_t such that the low 63 bits hold
+// the 11-bit exponent and 52-bit mantissa.
+//
+// On failure, it returns a negative value.
+//
+// The algorithm is based on an original idea by Michael Eisel that was refined
+// by Daniel Lemire. See "Number Parsing at a Gigabyte per Second"
+// (https://arxiv.org/abs/2101.11408). It is usually much faster than the MPB
+// and HPD algorithms, but it gives up (instead of producing the wrong answer)
+// on rare, ambiguous inputs, such as those exactly halfway between two f64
+// values. Subnormal and infinite results are also left to the slower code.
+//
+// Preconditions:
+//  - man is non-zero.
+//  - exp10 is in the range [-307 ..= 288], a sub-range of the
+//    wuffs_base__private_implementation__powers_of_10 array.
+static int64_t  //
+wuffs_base__private_implementation__parse_number_f64_eisel_lemire(
+    uint64_t man,
+    int32_t exp10) {
+  // Look up the (possibly truncated) base-2 representation of (10 ** exp10).
+  // The look-up table was constructed so that it is already normalized: the
+  // table entry's mantissa's MSB (most significant bit) is on.
+  const uint64_t* po10 =
+      &wuffs_base__private_implementation__powers_of_10[exp10 + 307][0];
+
+  // Normalize the man argument. The (man != 0) precondition means that a
+  // non-zero bit exists.
+  uint32_t clz = wuffs_base__count_leading_zeroes_u64(man);
+  man <<= clz;
+
+  // Calculate the return value's base-2 exponent. We might tweak it by ±1
+  // later, but its initial value comes from a linear scaling of exp10,
+  // converting from power-of-10 to power-of-2, and adjusting by clz.
+  //
+  // The magic constants are:
+  //  - 1087 = 1023 + 64. The 1023 is the f64 exponent bias. The 64 is because
+  //    the look-up table uses 64-bit mantissas.
+  //  - 217706 is such that the ratio 217706 / 65536 ≈ 3.321930 is close
+  //    enough (over the practical range of exp10) to log(10) / log(2) ≈
+  //    3.321928.
+  //  - 65536 = 1<<16 is arbitrary but a power of 2, so division is a shift.
+  //
+  // Equality of the linearly-scaled value and the actual power-of-2, over the
+  // range of exp10 arguments that this function accepts, is confirmed by
+  // script/print-eisel-lemire-powers-of-10.go
+  uint64_t ret_exp2 =
+      ((uint64_t)(((217706 * exp10) >> 16) + 1087)) - ((uint64_t)clz);
+
+  // Multiply the two mantissas. Normalization means that both mantissas are
+  // at least (1<<63), so the 128-bit product must be at least (1<<126). The
+  // high 64 bits of the product, x_hi, must therefore be at least (1<<62).
+  //
+  // As a consequence, x_hi has either 0 or 1 leading zeroes. Shifting x_hi
+  // right by either 9 or 10 bits (depending on x_hi's MSB) will therefore
+  // leave the top 10 MSBs (bits 54 ..= 63) off and the 11th MSB (bit 53) on.
+  wuffs_base__multiply_u64__output x = wuffs_base__multiply_u64(man, po10[1]);
+  uint64_t x_hi = x.hi;
+  uint64_t x_lo = x.lo;
+
+  // Before we shift right by at least 9 bits, recall that the look-up table
+  // entry was possibly truncated. We have so far only calculated a lower bound
+  // for the product (man * e), where e is (10 ** exp10). The upper bound would
+  // add a further (man * 1) to the 128-bit product, which overflows the lower
+  // 64-bit limb if ((x_lo + man) < man).
+  //
+  // If overflow occurs, that adds 1 to x_hi. Since we're about to shift right
+  // by at least 9 bits, that carried 1 can be ignored unless the higher 64-bit
+  // limb's low 9 bits are all on.
+  if (((x_hi & 0x1FF) == 0x1FF) && ((x_lo + man) < man)) {
+    // Refine our calculation of (man * e). Before, our approximation of e used
+    // a "low resolution" 64-bit mantissa. Now use a "high resolution" 128-bit
+    // mantissa. We've already calculated x = (man * bits[0..64]). The 4 lines
+    // below calculate y = (man * bits[64..128]) and then add x and y
+    // together, shifting y right by 64 bits.
+    wuffs_base__multiply_u64__output y = wuffs_base__multiply_u64(man, po10[0]);
+    uint64_t merged_hi = x_hi;
+    uint64_t merged_lo = x_lo + y.hi;
+    if (merged_lo < x_lo) {
+      merged_hi++;  // Carry the overflow bit.
+    }
+
+    // The "high resolution" approximation of e is still a lower bound. Once
+    // again, see if the upper bound is large enough to produce a different
+    // result. This time, if it does, give up instead of reaching for an even
+    // more precise approximation to e.
+    //
+    // This three-part check is similar to the two-part check that guarded the
+    // if block that we're now in, but it has an extra term for the middle 64
+    // bits (checking that adding 1 to merged_lo would overflow).
+    if (((merged_hi & 0x1FF) == 0x1FF) && ((merged_lo + 1) == 0) &&
+        ((y.lo + man) < man)) {
+      return -1;
+    }
+
+    // Replace the 128-bit x with merged.
+    x_hi = merged_hi;
+    x_lo = merged_lo;
+  }
+
+  // As mentioned above, shifting x_hi right by either 9 or 10 bits will leave
+  // the top 10 MSBs (bits 54 ..= 63) off and the 11th MSB (bit 53) on. If the
+  // MSB (before shifting) was on, adjust ret_exp2 for the larger shift.
+  //
+  // Having bit 53 on (and higher bits off) means that ret_mantissa is a 54-bit
+  // number.
+  uint64_t msb = x_hi >> 63;
+  uint64_t ret_mantissa = x_hi >> (msb + 9);
+  ret_exp2 -= 1 ^ msb;
+
+  // IEEE 754 rounds to-nearest with ties rounded to-even. Rounding to-even can
+  // be tricky. If we're half-way between two exactly representable numbers
+  // (x's low 73 bits are zero and the next 2 bits that matter are "01"), give
+  // up instead of trying to pick the winner.
+  //
+  // Technically, we could tighten the condition by changing "73" to "73 or 74,
+  // depending on msb", but a flat "73" is simpler.
+  if ((x_lo == 0) && ((x_hi & 0x1FF) == 0) && ((ret_mantissa & 3) == 1)) {
+    return -1;
+  }
+
+  // If we're not halfway then it's rounding to-nearest. Starting with a 54-bit
+  // number, carry the lowest bit (bit 0) up if it's on. Regardless of whether
+  // it was on or off, shifting right by one then produces a 53-bit number. If
+  // carrying up overflowed, shift again.
+  ret_mantissa += ret_mantissa & 1;
+  ret_mantissa >>= 1;
+  if ((ret_mantissa >> 53) > 0) {
+    ret_mantissa >>= 1;
+    ret_exp2++;
+  }
+
+  // Starting with a 53-bit number, IEEE 754 double-precision normal numbers
+  // have an implicit mantissa bit. Mask that away and keep the low 52 bits.
+  ret_mantissa &= 0x000FFFFFFFFFFFFF;
+
+  // If the exponent is out of range (subnormal, denoted by a ret_exp2 of zero
+  // or less, which wraps around because it is unsigned, or infinite, denoted
+  // by 0x7FF or more), give up.
+  if ((ret_exp2 - 1) >= (0x7FF - 1)) {
+    return -1;
+  }
+
+  // Pack the bits and return.
+  return ((int64_t)(ret_mantissa | (ret_exp2 << 52)));
+}
+
+// --------
+
+// wuffs_base__private_implementation__medium_prec_bin (abbreviated as MPB) is
+// a fixed precision floating point binary number. Unlike IEEE 754 Floating
+// Point, it cannot represent infinity or NaN (Not a Number).
+//
+// "Medium precision" means that the mantissa holds 64 binary digits, a little
+// more than "double precision", and sizeof(MPB) > sizeof(double). 64 is
+// obviously the number of bits in a uint64_t.
+//
+// An MPB isn't for general purpose arithmetic, only for conversions to and
+// from IEEE 754 double-precision floating point.
+//
+// There is no implicit mantissa bit. The mantissa field is zero if and only if
+// the overall floating point value is ±0. An MPB is normalized if the mantissa
+// is zero or its high bit (the 1<<63 bit) is set.
+//
+// There is no negative bit. An MPB can only represent non-negative numbers.
+//
+// The "all fields are zero" value is valid, and represents the number +0.
+//
+// This is the "Do It Yourself Floating Point" data structure from Loitsch,
+// "Printing Floating-Point Numbers Quickly and Accurately with Integers"
+// (https://www.cs.tufts.edu/~nr/cs257/archive/florian-loitsch/printf.pdf).
+//
+// Florian Loitsch is also the primary contributor to
+// https://github.com/google/double-conversion
+typedef struct {
+  uint64_t mantissa;
+  int32_t exp2;
+} wuffs_base__private_implementation__medium_prec_bin;
+
+static uint32_t  //
+wuffs_base__private_implementation__medium_prec_bin__normalize(
+    wuffs_base__private_implementation__medium_prec_bin* m) {
+  if (m->mantissa == 0) {
+    return 0;
+  }
+  uint32_t shift = wuffs_base__count_leading_zeroes_u64(m->mantissa);
+  m->mantissa <<= shift;
+  m->exp2 -= (int32_t)shift;
+  return shift;
+}
+
+// wuffs_base__private_implementation__medium_prec_bin__mul_pow_10 sets m to be
+// (m * pow), where pow comes from an etc_powers_of_10 triple starting at p.
+//
+// The result is rounded, but not necessarily normalized.
+//
+// Preconditions:
+//  - m is non-NULL.
+//  - m->mantissa is non-zero.
+//  - m->mantissa's high bit is set (i.e. m is normalized).
+//
+// The etc_powers_of_10 triple is already normalized.
+static void  //
+wuffs_base__private_implementation__medium_prec_bin__mul_pow_10(
+    wuffs_base__private_implementation__medium_prec_bin* m,
+    const uint32_t* p) {
+  uint64_t p_mantissa = ((uint64_t)p[0]) | (((uint64_t)p[1]) << 32);
+  int32_t p_exp2 = (int32_t)p[2];
+
+  wuffs_base__multiply_u64__output o =
+      wuffs_base__multiply_u64(m->mantissa, p_mantissa);
+  // Round the mantissa up. It cannot overflow because the maximum possible
+  // value of o.hi is 0xFFFFFFFFFFFFFFFE.
+  m->mantissa = o.hi + (o.lo >> 63);
+  m->exp2 = m->exp2 + p_exp2 + 64;
+}
+
+// wuffs_base__private_implementation__medium_prec_bin__as_f64 converts m to a
+// double (what C calls a double-precision float64).
+//
+// Preconditions:
+//  - m is non-NULL.
+//  - m->mantissa is non-zero.
+//  - m->mantissa's high bit is set (i.e. m is normalized).
+static double  //
+wuffs_base__private_implementation__medium_prec_bin__as_f64(
+    const wuffs_base__private_implementation__medium_prec_bin* m,
+    bool negative) {
+  uint64_t mantissa64 = m->mantissa;
+  // An mpb's mantissa has the implicit (binary) decimal point at the right
+  // hand end of the mantissa's explicit digits. A double-precision's mantissa
+  // has that decimal point near the left hand end. There's also an explicit
+  // versus implicit leading 1 bit (binary digit). Together, the difference in
+  // semantics corresponds to adding 63.
+  int32_t exp2 = m->exp2 + 63;
+
+  // Ensure that exp2 is at least -1022, the minimum double-precision exponent
+  // for normal (as opposed to subnormal) numbers.
+  if (-1022 > exp2) {
+    uint32_t n = (uint32_t)(-1022 - exp2);
+    mantissa64 >>= n;
+    exp2 += (int32_t)n;
+  }
+
+  // Extract the (1 + 52) bits from the 64-bit mantissa64. 52 is the number of
+  // explicit mantissa bits in a double-precision f64.
+  //
+  // Before, we have 64 bits and due to normalization, the high bit 'H' is 1.
+  // 63        55        47       etc     15        7
+  // H210_9876_5432_1098_7654_etc_etc_etc_5432_1098_7654_3210
+  // ++++_++++_++++_++++_++++_etc_etc_etc_++++_+..._...._....  Kept bits.
+  // ...._...._...H_2109_8765_etc_etc_etc_6543_2109_8765_4321  After shifting.
+  // After, we have 53 bits (and bit #52 is this 'H' bit).
+  uint64_t mantissa53 = mantissa64 >> 11;
+
+  // Round up if the old bit #10 (the highest bit dropped by shifting) was set.
+  // We also fix any overflow from rounding up.
+  if (mantissa64 & 1024) {
+    mantissa53++;
+    if ((mantissa53 >> 53) != 0) {
+      mantissa53 >>= 1;
+      exp2++;
+    }
+  }
+
+  // Handle double-precision infinity (a nominal exponent of 1024) and
+  // subnormals (an exponent of -1023 and no implicit mantissa bit, bit #52).
+  if (exp2 >= 1024) {
+    mantissa53 = 0;
+    exp2 = 1024;
+  } else if ((mantissa53 >> 52) == 0) {
+    exp2 = -1023;
+  }
+
+  // Pack the bits and return.
+  const int32_t f64_bias = -1023;
+  uint64_t exp2_bits =
+      (uint64_t)((exp2 - f64_bias) & 0x07FF);           // (1 << 11) - 1.
+  uint64_t bits = (mantissa53 & 0x000FFFFFFFFFFFFF) |   // (1 << 52) - 1.
+                  (exp2_bits << 52) |                   //
+                  (negative ? 0x8000000000000000 : 0);  // (1 << 63).
+  return wuffs_base__ieee_754_bit_representation__to_f64(bits);
+}
+
+// wuffs_base__private_implementation__medium_prec_bin__parse_number_f64
+// converts from an HPD to a double, using an MPB as scratch space. It returns
+// a NULL status.repr if there is no ambiguity in the truncation or rounding to
+// a float64 (an IEEE 754 double-precision floating point value).
+//
+// It may modify m even if it returns a non-NULL status.repr.
+static wuffs_base__result_f64  //
+wuffs_base__private_implementation__medium_prec_bin__parse_number_f64(
+    wuffs_base__private_implementation__medium_prec_bin* m,
+    const wuffs_base__private_implementation__high_prec_dec* h,
+    bool skip_fast_path_for_tests) {
+  do {
+    // m->mantissa is a uint64_t, which is an integer approximation to a
+    // rational value - h's underlying digits after m's normalization. This
+    // error is an upper bound on the difference between the approximate and
+    // actual value.
+    //
+    // The DiyFpStrtod function in https://github.com/google/double-conversion
+    // uses a finer grain (1/8th of the ULP, Unit in the Last Place) when
+    // tracking error. This implementation is coarser (1 ULP) but simpler.
+    //
+    // It is an error in the "numerical approximation" sense, not in the
+    // typical programming sense (as in "bad input" or "a result type").
+    uint64_t error = 0;
+
+    // Convert up to 19 decimal digits (in h->digits) to 64 binary digits (in
+    // m->mantissa): (1e19 < (1<<64)) and ((1<<64) < 1e20). If we have more
+    // than 19 digits, we're truncating (with error).
+    uint32_t i;
+    uint32_t i_end = h->num_digits;
+    if (i_end > 19) {
+      i_end = 19;
+      error = 1;
+    }
+    uint64_t mantissa = 0;
+    for (i = 0; i < i_end; i++) {
+      mantissa = (10 * mantissa) + h->digits[i];
+    }
+    m->mantissa = mantissa;
+    m->exp2 = 0;
+
+    // Check that exp10 lies in the (big_powers_of_10 + small_powers_of_10)
+    // range, -348 ..= +347, stepping big_powers_of_10 by 8 (which is 87
+    // triples) and small_powers_of_10 by 1 (which is 8 triples).
+    int32_t exp10 = h->decimal_point - ((int32_t)(i_end));
+    if (exp10 < -348) {
+      goto fail;
+    }
+    uint32_t bpo10 = ((uint32_t)(exp10 + 348)) / 8;
+    uint32_t spo10 = ((uint32_t)(exp10 + 348)) % 8;
+    if (bpo10 >= 87) {
+      goto fail;
+    }
+
+    // Try a fast path, if float64 math would be exact.
+    //
+    // 15 is such that 1e15 can be losslessly represented in a float64
+    // mantissa: (1e15 < (1<<53)) and ((1<<53) < 1e16).
+    //
+    // 22 is the maximum valid index for the
+    // wuffs_base__private_implementation__f64_powers_of_10 array.
+    do {
+      if (skip_fast_path_for_tests || ((mantissa >> 52) != 0)) {
+        break;
+      }
+      double d = (double)mantissa;
+
+      if (exp10 == 0) {
+        wuffs_base__result_f64 ret;
+        ret.status.repr = NULL;
+        ret.value = h->negative ? -d : +d;
+        return ret;
+
+      } else if (exp10 > 0) {
+        if (exp10 > 22) {
+          if (exp10 > (15 + 22)) {
+            break;
+          }
+          // If exp10 is in the range 23 ..= 37, try moving a few of the zeroes
+          // from the exponent to the mantissa. If we're still under 1e15, we
+          // haven't truncated any mantissa bits.
+          if (exp10 > 22) {
+            d *= wuffs_base__private_implementation__f64_powers_of_10[exp10 -
+                                                                      22];
+            exp10 = 22;
+            if (d >= 1e15) {
+              break;
+            }
+          }
+        }
+        d *= wuffs_base__private_implementation__f64_powers_of_10[exp10];
+        wuffs_base__result_f64 ret;
+        ret.status.repr = NULL;
+        ret.value = h->negative ? -d : +d;
+        return ret;
+
+      } else {  // "if (exp10 < 0)" is effectively "if (true)" here.
+        if (exp10 < -22) {
+          break;
+        }
+        d /= wuffs_base__private_implementation__f64_powers_of_10[-exp10];
+        wuffs_base__result_f64 ret;
+        ret.status.repr = NULL;
+        ret.value = h->negative ? -d : +d;
+        return ret;
+      }
+    } while (0);
+
+    // Try the Eisel-Lemire algorithm next. It is exact when it succeeds, but
+    // it needs all of the digits (no truncation error) and it gives up on
+    // some inputs, such as those halfway between two f64 values.
+    //
+    // The fast path above may have modified exp10, so re-calculate it.
+    exp10 = h->decimal_point - ((int32_t)(i_end));
+    if (!skip_fast_path_for_tests && (error == 0) && (-307 <= exp10) &&
+        (exp10 <= 288)) {
+      int64_t r =
+          wuffs_base__private_implementation__parse_number_f64_eisel_lemire(
+              mantissa, exp10);
+      if (r >= 0) {
+        wuffs_base__result_f64 ret;
+        ret.status.repr = NULL;
+        ret.value = wuffs_base__ieee_754_bit_representation__to_f64(
+            ((uint64_t)r) | (h->negative ? 0x8000000000000000 : 0));
+        return ret;
+      }
+    }
+
+    // Normalize (and scale the error).
+    error <<= wuffs_base__private_implementation__medium_prec_bin__normalize(m);
+
+    // Multiplying two MPB values nominally multiplies two mantissas, call them
+    // A and B, which are integer approximations to the precise values (A+a)
+    // and (B+b) for some error terms a and b.
+    //
+    // MPB multiplication calculates (((A+a) * (B+b)) >> 64) to be ((A*B) >>
+    // 64). Shifting (truncating) and rounding introduces further error. The
+    // difference between the calculated result:
+    //  ((A*B                  ) >> 64)
+    // and the true result:
+    //  ((A*B + A*b + a*B + a*b) >> 64)   + rounding_error
+    // is:
+    //  ((      A*b + a*B + a*b) >> 64)   + rounding_error
+    // which can be re-grouped as:
+    //  ((A*b) >> 64) + ((a*(B+b)) >> 64) + rounding_error
+    //
+    // Now, let A and a be "m->mantissa" and "error", and B and b be the
+    // pre-calculated power of 10. A and B are both less than (1 << 64), a is
+    // the "error" local variable and b is less than 1.
+    //
+    // An upper bound (in absolute value) on ((A*b) >> 64) is therefore 1.
+    //
+    // An upper bound on ((a*(B+b)) >> 64) is a, also known as error.
+    //
+    // Finally, the rounding_error is at most 1.
+    //
+    // In total, calling mpb__mul_pow_10 will raise the worst-case error by 2.
+    // The subsequent re-normalization can multiply that by a further factor.
+
+    // Multiply by small_powers_of_10[etc].
+    wuffs_base__private_implementation__medium_prec_bin__mul_pow_10(
+        m, &wuffs_base__private_implementation__small_powers_of_10[3 * spo10]);
+    error += 2;
+    error <<= wuffs_base__private_implementation__medium_prec_bin__normalize(m);
+
+    // Multiply by big_powers_of_10[etc].
+    wuffs_base__private_implementation__medium_prec_bin__mul_pow_10(
+        m, &wuffs_base__private_implementation__big_powers_of_10[3 * bpo10]);
+    error += 2;
+    error <<= wuffs_base__private_implementation__medium_prec_bin__normalize(m);
+
+    // We have a good approximation of h, but we still have to check whether
+    // the error is small enough. Equivalently, whether the number of surplus
+    // mantissa bits (the bits dropped when going from m's 64 mantissa bits to
+    // the smaller number of double-precision mantissa bits) would always round
+    // up or down, even when perturbed by ±error. We start at 11 surplus bits
+    // (m has 64, double-precision has 1+52), but it can be higher for
+    // subnormals.
+    //
+    // In many cases, the error is small enough and we return true.
+    const int32_t f64_bias = -1023;
+    int32_t subnormal_exp2 = f64_bias - 63;
+    uint32_t surplus_bits = 11;
+    if (subnormal_exp2 >= m->exp2) {
+      surplus_bits += 1 + ((uint32_t)(subnormal_exp2 - m->exp2));
+    }
+
+    uint64_t surplus_mask =
+        (((uint64_t)1) << surplus_bits) - 1;  // e.g. 0x07FF.
+    uint64_t surplus = m->mantissa & surplus_mask;
+    uint64_t halfway = ((uint64_t)1) << (surplus_bits - 1);  // e.g. 0x0400.
+
+    // Do the final calculation in *signed* arithmetic.
+    int64_t i_surplus = (int64_t)surplus;
+    int64_t i_halfway = (int64_t)halfway;
+    int64_t i_error = (int64_t)error;
+
+    if ((i_surplus > (i_halfway - i_error)) &&
+        (i_surplus < (i_halfway + i_error))) {
+      goto fail;
+    }
+
+    wuffs_base__result_f64 ret;
+    ret.status.repr = NULL;
+    ret.value = wuffs_base__private_implementation__medium_prec_bin__as_f64(
+        m, h->negative);
+    return ret;
+  } while (0);
+
+fail:
+  do {
+    wuffs_base__result_f64 ret;
+    ret.status.repr = "#base: mpb__parse_number_f64 failed";
+    ret.value = 0;
+    return ret;
+  } while (0);
+}
+
+// --------
+
+static wuffs_base__result_f64  //
+wuffs_base__parse_number_f64_special(wuffs_base__slice_u8 s,
+                                     const char* fallback_status_repr) {
+  do {
+    uint8_t* p = s.ptr;
+    uint8_t* q = s.ptr + s.len;
+
+    for (; (p < q) && (*p == '_'); p++) {
+    }
+    if (p >= q) {
+      goto fallback;
+    }
+
+    // Parse sign.
+    bool negative = false;
+    do {
+      if (*p == '+') {
+        p++;
+      } else if (*p == '-') {
+        negative = true;
+        p++;
+      } else {
+        break;
+      }
+      for (; (p < q) && (*p == '_'); p++) {
+      }
+    } while (0);
+    if (p >= q) {
+      goto fallback;
+    }
+
+    bool nan = false;
+    switch (p[0]) {
+      case 'I':
+      case 'i':
+        if (((q - p) < 3) ||                     //
+            ((p[1] != 'N') && (p[1] != 'n')) ||  //
+            ((p[2] != 'F') && (p[2] != 'f'))) {
+          goto fallback;
+        }
+        p += 3;
+
+        if ((p >= q) || (*p == '_')) {
+          break;
+        } else if (((q - p) < 5) ||                     //
+                   ((p[0] != 'I') && (p[0] != 'i')) ||  //
+                   ((p[1] != 'N') && (p[1] != 'n')) ||  //
+                   ((p[2] != 'I') && (p[2] != 'i')) ||  //
+                   ((p[3] != 'T') && (p[3] != 't')) ||  //
+                   ((p[4] != 'Y') && (p[4] != 'y'))) {
+          goto fallback;
+        }
+        p += 5;
+
+        if ((p >= q) || (*p == '_')) {
+          break;
+        }
+        goto fallback;
+
+      case 'N':
+      case 'n':
+        if (((q - p) < 3) ||                     //
+            ((p[1] != 'A') && (p[1] != 'a')) ||  //
+            ((p[2] != 'N') && (p[2] != 'n'))) {
+          goto fallback;
+        }
+        p += 3;
+
+        if ((p >= q) || (*p == '_')) {
+          nan = true;
+          break;
+        }
+        goto fallback;
+
+      default:
+        goto fallback;
+    }
+
+    // Finish.
+    for (; (p < q) && (*p == '_'); p++) {
+    }
+    if (p != q) {
+      goto fallback;
+    }
+    wuffs_base__result_f64 ret;
+    ret.status.repr = NULL;
+    ret.value = wuffs_base__ieee_754_bit_representation__to_f64(
+        (nan ? 0x7FFFFFFFFFFFFFFF : 0x7FF0000000000000) |
+        (negative ? 0x8000000000000000 : 0));
+    return ret;
+  } while (0);
+
+fallback:
+  do {
+    wuffs_base__result_f64 ret;
+    ret.status.repr = fallback_status_repr;
+    ret.value = 0;
+    return ret;
+  } while (0);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__result_f64  //
+wuffs_base__parse_number_f64(wuffs_base__slice_u8 s) {
+  wuffs_base__private_implementation__medium_prec_bin m;
+  wuffs_base__private_implementation__high_prec_dec h;
+
+  do {
+    // powers converts decimal powers of 10 to binary powers of 2. For example,
+    // (10000 >> 13) is 1. It stops before the elements exceed 60, also known
+    // as WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL.
+    static const uint32_t num_powers = 19;
+    static const uint8_t powers[19] = {
+        0,  3,  6,  9,  13, 16, 19, 23, 26, 29,  //
+        33, 36, 39, 43, 46, 49, 53, 56, 59,      //
+    };
+
+    wuffs_base__status status =
+        wuffs_base__private_implementation__high_prec_dec__parse(&h, s);
+    if (status.repr) {
+      return wuffs_base__parse_number_f64_special(s, status.repr);
+    }
+
+    // Handle zero and obvious extremes. The largest and smallest positive
+    // finite f64 values are approximately 1.8e+308 and 4.9e-324.
+    if ((h.num_digits == 0) || (h.decimal_point < -326)) {
+      goto zero;
+    } else if (h.decimal_point > 310) {
+      goto infinity;
+    }
+
+    wuffs_base__result_f64 mpb_result =
+        wuffs_base__private_implementation__medium_prec_bin__parse_number_f64(
+            &m, &h, false);
+    if (mpb_result.status.repr == NULL) {
+      return mpb_result;
+    }
+
+    // Scale by powers of 2 until we're in the range [½ .. 1], which gives us
+    // our exponent (in base-2). First we shift right, possibly a little too
+    // far, ending with a value certainly below 1 and possibly below ½...
+    const int32_t f64_bias = -1023;
+    int32_t exp2 = 0;
+    while (h.decimal_point > 0) {
+      uint32_t n = (uint32_t)(+h.decimal_point);
+      uint32_t shift =
+          (n < num_powers)
+              ? powers[n]
+              : WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL;
+
+      wuffs_base__private_implementation__high_prec_dec__small_rshift(&h,
+                                                                      shift);
+      if (h.decimal_point <
+          -WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE) {
+        goto zero;
+      }
+      exp2 += (int32_t)shift;
+    }
+    // ...then we shift left, putting us in [½ .. 1].
+    while (h.decimal_point <= 0) {
+      uint32_t shift;
+      if (h.decimal_point == 0) {
+        if (h.digits[0] >= 5) {
+          break;
+        }
+        shift = (h.digits[0] < 2) ? 2 : 1;
+      } else {
+        uint32_t n = (uint32_t)(-h.decimal_point);
+        shift = (n < num_powers)
+                    ? powers[n]
+                    : WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL;
+      }
+
+      wuffs_base__private_implementation__high_prec_dec__small_lshift(&h,
+                                                                      shift);
+      if (h.decimal_point >
+          +WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE) {
+        goto infinity;
+      }
+      exp2 -= (int32_t)shift;
+    }
+
+    // We're in the range [½ .. 1] but f64 uses [1 .. 2].
+    exp2--;
+
+    // The minimum normal exponent is (f64_bias + 1).
+    while ((f64_bias + 1) > exp2) {
+      uint32_t n = (uint32_t)((f64_bias + 1) - exp2);
+      if (n > WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL) {
+        n = WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL;
+      }
+      wuffs_base__private_implementation__high_prec_dec__small_rshift(&h, n);
+      exp2 += (int32_t)n;
+    }
+
+    // Check for overflow.
+    if ((exp2 - f64_bias) >= 0x07FF) {  // (1 << 11) - 1.
+      goto infinity;
+    }
+
+    // Extract 53 bits for the mantissa (in base-2).
+    wuffs_base__private_implementation__high_prec_dec__small_lshift(&h, 53);
+    uint64_t man2 =
+        wuffs_base__private_implementation__high_prec_dec__rounded_integer(&h);
+
+    // Rounding might have added one bit. If so, shift and re-check overflow.
+    if ((man2 >> 53) != 0) {
+      man2 >>= 1;
+      exp2++;
+      if ((exp2 - f64_bias) >= 0x07FF) {  // (1 << 11) - 1.
+        goto infinity;
+      }
+    }
+
+    // Handle subnormal numbers.
+    if ((man2 >> 52) == 0) {
+      exp2 = f64_bias;
+    }
+
+    // Pack the bits and return.
+    uint64_t exp2_bits =
+        (uint64_t)((exp2 - f64_bias) & 0x07FF);             // (1 << 11) - 1.
+    uint64_t bits = (man2 & 0x000FFFFFFFFFFFFF) |           // (1 << 52) - 1.
+                    (exp2_bits << 52) |                     //
+                    (h.negative ? 0x8000000000000000 : 0);  // (1 << 63).
+
+    wuffs_base__result_f64 ret;
+    ret.status.repr = NULL;
+    ret.value = wuffs_base__ieee_754_bit_representation__to_f64(bits);
+    return ret;
+  } while (0);
+
+zero:
+  do {
+    uint64_t bits = h.negative ? 0x8000000000000000 : 0;
+
+    wuffs_base__result_f64 ret;
+    ret.status.repr = NULL;
+    ret.value = wuffs_base__ieee_754_bit_representation__to_f64(bits);
+    return ret;
+  } while (0);
+
+infinity:
+  do {
+    uint64_t bits = h.negative ? 0xFFF0000000000000 : 0x7FF0000000000000;
+
+    wuffs_base__result_f64 ret;
+    ret.status.repr = NULL;
+    ret.value = wuffs_base__ieee_754_bit_representation__to_f64(bits);
+    return ret;
+  } while (0);
+}
+
+// --------
+
+// wuffs_base__private_implementation__schubfach_rop returns the round-to-odd
+// approximation of ((g * cp) >> 127), where the 126-bit g is ((g1 << 63) |
+// g0). "Round to odd" means that the low bit of the result is set whenever the
+// shifted-out bits are non-zero, so that later comparisons remain exact.
+static inline uint64_t  //
+wuffs_base__private_implementation__schubfach_rop(uint64_t g1,
+                                                  uint64_t g0,
+                                                  uint64_t cp) {
+  uint64_t x1 = wuffs_base__multiply_u64(g0, cp).hi;
+  wuffs_base__multiply_u64__output y = wuffs_base__multiply_u64(g1, cp);
+  uint64_t z = (y.lo >> 1) + x1;
+  uint64_t vbp = y.hi + (z >> 63);
+  return vbp | (((z & 0x7FFFFFFFFFFFFFFF) + 0x7FFFFFFFFFFFFFFF) >> 63);
+}
+
+// wuffs_base__private_implementation__schubfach finds the shortest decimal,
+// (*digits * (10 ** *exp10)), that rounds to the f64 value (c * (2 ** q)). If
+// more than one decimal with that many significant digits rounds to that f64
+// value, it picks the closest one, breaking ties towards an even *digits.
+//
+// *digits may have trailing zeroes, which the caller may want to strip.
+//
+// The algorithm is Raffaello Giulietti's Schubfach, described in "The
+// Schubfach way to render doubles" and used by Java's Double.toString. Like
+// Ryu or Grisu, it needs only fixed-width integer arithmetic and a table of
+// powers of 10, but unlike Grisu it never needs a slow fallback.
+//
+// Preconditions:
+//  - c is at least 3 and less than (1 << 53).
+//  - q is in the range [-1074 ..= 971].
+static void  //
+wuffs_base__private_implementation__schubfach(uint64_t c,
+                                              int32_t q,
+                                              uint64_t* digits,
+                                              int32_t* exp10) {
+  // The rounding interval around (c * (2 ** q)) is [cbl, cbr] in units of
+  // (2 ** (q - 2)). It is asymmetric (narrower below) when c is the smallest
+  // normal mantissa, as the f64 value just below it has a smaller exponent.
+  //
+  // The magic constants approximate logarithms:
+  //  - 661971961083 / (1 << 41) ≈ log(2) / log(10).
+  //  - 274743187321 / (1 << 41) ≈ log(4/3) / log(10).
+  //  - 913124641741 / (1 << 38) ≈ log(10) / log(2).
+  uint64_t out = c & 1;
+  uint64_t cb = c << 2;
+  uint64_t cbr = cb + 2;
+  uint64_t cbl;
+  int32_t k;
+  if ((c != 0x0010000000000000) || (q == -1074)) {
+    cbl = cb - 2;
+    k = (int32_t)((((int64_t)q) * 661971961083) >> 41);
+  } else {
+    cbl = cb - 1;
+    k = (int32_t)(((((int64_t)q) * 661971961083) - 274743187321) >> 41);
+  }
+  int32_t h = q + ((int32_t)((((int64_t)(-k)) * 913124641741) >> 38)) + 2;
+
+  // Look up (10 ** -k) as the 126-bit g. The powers_of_10 table holds
+  // truncated 128-bit values, so shift right by 2 and then add 1 to make g a
+  // strict upper bound, as Schubfach requires. The precondition on q means
+  // that -k is in the range [-292 ..= 324].
+  const uint64_t* po10 =
+      &wuffs_base__private_implementation__powers_of_10[307 - k][0];
+  uint64_t g_lo = (po10[0] >> 2) | (po10[1] << 62);
+  uint64_t g_hi = po10[1] >> 2;
+  g_lo++;
+  if (g_lo == 0) {
+    g_hi++;
+  }
+  uint64_t g1 = (g_hi << 1) | (g_lo >> 63);
+  uint64_t g0 = g_lo & 0x7FFFFFFFFFFFFFFF;
+
+  uint64_t vb =
+      wuffs_base__private_implementation__schubfach_rop(g1, g0, cb << h);
+  uint64_t vbl =
+      wuffs_base__private_implementation__schubfach_rop(g1, g0, cbl << h);
+  uint64_t vbr =
+      wuffs_base__private_implementation__schubfach_rop(g1, g0, cbr << h);
+
+  // s is the scaled value, rounded down. First see if exactly one of the two
+  // multiples of 10 closest to s, sp10 and tp10, is inside the rounding
+  // interval. 0x19999999999999A0 is slightly more than ((1 << 64) / 10).
+  uint64_t s = vb >> 2;
+  if (s >= 100) {
+    uint64_t sp10 = 10 * wuffs_base__multiply_u64(s, 0x19999999999999A0).hi;
+    uint64_t tp10 = sp10 + 10;
+    bool upin = (vbl + out) <= (sp10 << 2);
+    bool wpin = ((tp10 << 2) + out) <= vbr;
+    if (upin != wpin) {
+      *digits = upin ? sp10 : tp10;
+      *exp10 = k;
+      return;
+    }
+  }
+
+  // Otherwise, see if exactly one of s and t = (s + 1) is inside the rounding
+  // interval. If both are, pick the closer one, breaking ties to even.
+  uint64_t t = s + 1;
+  bool uin = (vbl + out) <= (s << 2);
+  bool win = ((t << 2) + out) <= vbr;
+  if (uin != win) {
+    *digits = uin ? s : t;
+    *exp10 = k;
+    return;
+  }
+  int64_t cmp = (int64_t)(vb - ((s + t) << 1));
+  *digits = ((cmp < 0) || ((cmp == 0) && ((s & 1) == 0))) ? s : t;
+  *exp10 = k;
+}
+
+// wuffs_base__private_implementation__render_number_f64_finite writes the
+// non-zero, finite f64 value with the given bits, other than its sign bit, to
+// p and returns the advanced p. It writes at most 24 bytes.
+static uint8_t*  //
+wuffs_base__private_implementation__render_number_f64_finite(uint8_t* p,
+                                                             uint64_t bits) {
+  uint32_t biased_exp2 = (uint32_t)((bits >> 52) & 0x7FF);
+  uint64_t man = bits & 0x000FFFFFFFFFFFFF;
+
+  // Find the shortest decimal representation, (digits * (10 ** exp10)).
+  uint64_t digits = 0;
+  int32_t exp10 = 0;
+  if (biased_exp2 != 0) {
+    // Normal numbers have an implicit mantissa bit. The value is (c * (2 **
+    // -mq)). If that's a small integer, Schubfach isn't needed.
+    uint64_t c = man | 0x0010000000000000;
+    int32_t mq = 1075 - ((int32_t)biased_exp2);
+    if ((0 < mq) && (mq < 53) && (((c >> mq) << mq) == c)) {
+      digits = c >> mq;
+    } else {
+      wuffs_base__private_implementation__schubfach(c, -mq, &digits, &exp10);
+    }
+  } else if (man >= 3) {
+    wuffs_base__private_implementation__schubfach(man, -1074, &digits, &exp10);
+  } else {
+    // Schubfach needs more than one digit's worth of precision, which the two
+    // smallest subnormals, 4.94e-324 and 9.88e-324, don't have. Java's
+    // Double.toString works around that by rendering an extra digit, as
+    // "4.9E-324" and "9.9E-324", but "5e-324" and "1e-323" are shorter and
+    // still round-trip.
+    digits = (man == 1) ? 5 : 1;
+    exp10 = (man == 1) ? -324 : -323;
+  }
+  while ((digits % 10) == 0) {
+    digits /= 10;
+    exp10++;
+  }
+
+  // Convert digits to ASCII. There are at most 17 of them.
+  uint8_t d_buf[20];
+  uint8_t* const d_end = d_buf + 20;
+  uint8_t* d = d_end;
+  do {
+    *--d = (uint8_t)('0' + (digits % 10));
+    digits /= 10;
+  } while (digits > 0);
+  int32_t nd = (int32_t)(d_end - d);
+
+  // The value is (0.ddd * (10 ** n)). Lay out the digits as per ECMAScript's
+  // Number.prototype.toString.
+  int32_t n = exp10 + nd;
+  if ((nd <= n) && (n <= 21)) {
+    // Integers, such as "123" and "45600".
+    memcpy(p, d, (size_t)nd);
+    p += nd;
+    memset(p, '0', (size_t)(n - nd));
+    p += n - nd;
+  } else if ((0 < n) && (n <= 21)) {
+    // Positional notation with an integral part, such as "1.5".
+    memcpy(p, d, (size_t)n);
+    p += n;
+    *p++ = '.';
+    memcpy(p, d + n, (size_t)(nd - n));
+    p += nd - n;
+  } else if ((-6 < n) && (n <= 0)) {
+    // Positional notation without an integral part, such as "0.0025".
+    *p++ = '0';
+    *p++ = '.';
+    memset(p, '0', (size_t)(-n));
+    p += -n;
+    memcpy(p, d, (size_t)nd);
+    p += nd;
+  } else {
+    // Exponential notation, such as "1e+300" and "2.5e-7".
+    *p++ = d[0];
+    if (nd > 1) {
+      *p++ = '.';
+      memcpy(p, d + 1, (size_t)(nd - 1));
+      p += nd - 1;
+    }
+    *p++ = 'e';
+    int32_t e = n - 1;
+    if (e < 0) {
+      *p++ = '-';
+      e = -e;
+    } else {
+      *p++ = '+';
+    }
+    if (e >= 100) {
+      *p++ = (uint8_t)('0' + (e / 100));
+    }
+    if (e >= 10) {
+      *p++ = (uint8_t)('0' + ((e / 10) % 10));
+    }
+    *p++ = (uint8_t)('0' + (e % 10));
+  }
+  return p;
+}
+
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__render_number_f64(wuffs_base__slice_u8 dst,
+                              double x,
+                              uint32_t options) {
+  uint64_t bits = wuffs_base__ieee_754_bit_representation__from_f64(x);
+  bool is_nan = ((bits & 0x7FF0000000000000) == 0x7FF0000000000000) &&
+                ((bits & 0x000FFFFFFFFFFFFF) != 0);
+
+  uint8_t buf[WUFFS_BASE__F64__BYTE_LENGTH__MAX_INCL];
+  uint8_t* p = buf;
+
+  if (((bits & 0x7FF0000000000000) == 0x7FF0000000000000) &&
+      (options & WUFFS_BASE__RENDER_NUMBER_FXX__INF_NAN_AS_NULL)) {
+    memcpy(p, "null", 4);
+    p += 4;
+  } else if (is_nan) {
+    memcpy(p, "NaN", 3);
+    p += 3;
+  } else {
+    if (bits >> 63) {
+      *p++ = '-';
+    } else if (options & WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN) {
+      *p++ = '+';
+    }
+    bits &= 0x7FFFFFFFFFFFFFFF;
+    if (bits == 0) {
+      *p++ = '0';
+    } else if (bits == 0x7FF0000000000000) {
+      memcpy(p, "Infinity", 8);
+      p += 8;
+    } else {
+      p = wuffs_base__private_implementation__render_number_f64_finite(p, bits);
+    }
+  }
+
+  size_t len = (size_t)(p - buf);
+  if (len > dst.len) {
+    return 0;
+  }
+  memcpy(dst.ptr, buf, len);
+  return len;
+}
+
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) ||
+        // defined(WUFFS_CONFIG__MODULE__BASE) ||
+        // defined(WUFFS_CONFIG__MODULE__BASE__F64CONV)
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \
+    defined(WUFFS_CONFIG__MODULE__BASE__PIXCONV)
+
+// ---------------- Pixel Swizzler
+
+static inline uint32_t  //
+wuffs_base__swap_u32_argb_abgr(uint32_t u) {
+  uint32_t o = u & 0xFF00FF00;
+  uint32_t r = u & 0x00FF0000;
+  uint32_t b = u & 0x000000FF;
+  return o | (r >> 16) | (b << 16);
+}
+
+// --------
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__color_u32_argb_premul  //
+wuffs_base__pixel_buffer__color_u32_at(const wuffs_base__pixel_buffer* pb,
+                                       uint32_t x,
+                                       uint32_t y) {
+  if (!pb || (x >= pb->pixcfg.private_impl.width) ||
+      (y >= pb->pixcfg.private_impl.height)) {
+    return 0;
+  }
+
+  if (wuffs_base__pixel_format__is_planar(&pb->pixcfg.private_impl.pixfmt)) {
+    if (pb->pixcfg.private_impl.pixfmt.repr !=
+        WUFFS_BASE__PIXEL_FORMAT__YCBCR) {
+      // TODO: support more planar formats.
+      return 0;
+    }
+    uint8_t samples[3];
+    uint32_t p;
+    for (p = 0; p < 3; p++) {
+      const wuffs_base__pixel_subsampling* pixsub =
+          &pb->pixcfg.private_impl.pixsub;
+      const wuffs_base__table_u8* tab = &pb->private_impl.planes[p];
+      size_t i = (x + wuffs_base__pixel_subsampling__bias_x(pixsub, p)) /
+                 wuffs_base__pixel_subsampling__denominator_x(pixsub, p);
+      size_t j = (y + wuffs_base__pixel_subsampling__bias_y(pixsub, p)) /
+                 wuffs_base__pixel_subsampling__denominator_y(pixsub, p);
+      if ((i >= tab->width) || (j >= tab->height)) {
+        return 0;
+      }
+      samples[p] = tab->ptr[(j * tab->stride) + i];
+    }
+    return wuffs_base__color_ycc__as__color_u32_argb_premul(
+        samples[0], samples[1], samples[2]);
+  }
+
+  size_t stride = pb->private_impl.planes[0].stride;
+  uint8_t* row = pb->private_impl.planes[0].ptr + (stride * ((size_t)y));
+
+  switch (pb->pixcfg.private_impl.pixfmt.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
+      return wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x)));
+
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY: {
+      uint8_t* palette = pb->private_impl.planes[3].ptr;
+      return wuffs_base__load_u32le__no_bounds_check(palette +
+                                                     (4 * ((size_t)row[x])));
+    }
+
+      // Common formats above. Rarer formats below.
+
+    case WUFFS_BASE__PIXEL_FORMAT__Y:
+      return 0xFF000000 | (0x00010101 * ((uint32_t)(row[x])));
+
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL: {
+      uint8_t* palette = pb->private_impl.planes[3].ptr;
+      return wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+          wuffs_base__load_u32le__no_bounds_check(palette +
+                                                  (4 * ((size_t)row[x]))));
+    }
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:
+      return wuffs_base__color_u16_rgb_565__as__color_u32_argb_premul(
+          wuffs_base__load_u16le__no_bounds_check(row + (2 * ((size_t)x))));
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      return 0xFF000000 |
+             wuffs_base__load_u24le__no_bounds_check(row + (3 * ((size_t)x)));
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+      return wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+          wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x))));
+    case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+      return 0xFF000000 |
+             wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x)));
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE:
+      return wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+          wuffs_base__color_u64__as__color_u32(
+              wuffs_base__load_u64le__no_bounds_check(row +
+                                                      (8 * ((size_t)x)))));
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      return wuffs_base__color_u64__as__color_u32(
+          wuffs_base__load_u64le__no_bounds_check(row + (8 * ((size_t)x))));
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGB:
+      return wuffs_base__swap_u32_argb_abgr(
+          0xFF000000 |
+          wuffs_base__load_u24le__no_bounds_check(row + (3 * ((size_t)x))));
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+      return wuffs_base__swap_u32_argb_abgr(
+          wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+              wuffs_base__load_u32le__no_bounds_check(row +
+                                                      (4 * ((size_t)x)))));
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:
+      return wuffs_base__swap_u32_argb_abgr(
+          wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x))));
+    case WUFFS_BASE__PIXEL_FORMAT__RGBX:
+      return wuffs_base__swap_u32_argb_abgr(
+          0xFF000000 |
+          wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x))));
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL_4X16LE:
+      return wuffs_base__swap_u32_argb_abgr(
+          wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+              wuffs_base__color_u64__as__color_u32(
+                  wuffs_base__load_u64le__no_bounds_check(row +
+                                                          (8 * ((size_t)x))))));
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      return wuffs_base__swap_u32_argb_abgr(
+          wuffs_base__color_u64__as__color_u32(
+              wuffs_base__load_u64le__no_bounds_check(row +
+                                                      (8 * ((size_t)x)))));
+
+    default:
+      // TODO: support more formats.
+      break;
+  }
+
+  return 0;
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_buffer__set_color_u32_at(
+    wuffs_base__pixel_buffer* pb,
+    uint32_t x,
+    uint32_t y,
+    wuffs_base__color_u32_argb_premul color) {
+  if (!pb) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if ((x >= pb->pixcfg.private_impl.width) ||
+      (y >= pb->pixcfg.private_impl.height)) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+
+  if (wuffs_base__pixel_format__is_planar(&pb->pixcfg.private_impl.pixfmt)) {
+    // TODO: support planar formats.
+    return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+  }
+
+  size_t stride = pb->private_impl.planes[0].stride;
+  uint8_t* row = pb->private_impl.planes[0].ptr + (stride * ((size_t)y));
+
+  switch (pb->pixcfg.private_impl.pixfmt.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+      wuffs_base__store_u32le__no_bounds_check(row + (4 * ((size_t)x)), color);
+      break;
+
+      // Common formats above. Rarer formats below.
+
+    case WUFFS_BASE__PIXEL_FORMAT__Y:
+      wuffs_base__store_u8__no_bounds_check(
+          row + ((size_t)x),
+          wuffs_base__color_u32_argb_premul__as__color_u8_gray(color));
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:
+      wuffs_base__store_u8__no_bounds_check(
+          row + ((size_t)x), wuffs_base__pixel_palette__closest_element(
+                                 wuffs_base__pixel_buffer__palette(pb),
+                                 pb->pixcfg.private_impl.pixfmt, color));
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:
+      wuffs_base__store_u16le__no_bounds_check(
+          row + (2 * ((size_t)x)),
+          wuffs_base__color_u32_argb_premul__as__color_u16_rgb_565(color));
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      wuffs_base__store_u24le__no_bounds_check(row + (3 * ((size_t)x)), color);
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+      wuffs_base__store_u32le__no_bounds_check(
+          row + (4 * ((size_t)x)),
+          wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(
+              color));
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE:
+      wuffs_base__store_u64le__no_bounds_check(
+          row + (8 * ((size_t)x)),
+          wuffs_base__color_u32__as__color_u64(
+              wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(
+                  color)));
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      wuffs_base__store_u64le__no_bounds_check(
+          row + (8 * ((size_t)x)), wuffs_base__color_u32__as__color_u64(color));
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGB:
+      wuffs_base__store_u24le__no_bounds_check(
+          row + (3 * ((size_t)x)), wuffs_base__swap_u32_argb_abgr(color));
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+      wuffs_base__store_u32le__no_bounds_check(
+          row + (4 * ((size_t)x)),
+          wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(
+              wuffs_base__swap_u32_argb_abgr(color)));
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBX:
+      wuffs_base__store_u32le__no_bounds_check(
+          row + (4 * ((size_t)x)), wuffs_base__swap_u32_argb_abgr(color));
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL_4X16LE:
+      wuffs_base__store_u64le__no_bounds_check(
+          row + (8 * ((size_t)x)),
+          wuffs_base__color_u32__as__color_u64(
+              wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(
+                  wuffs_base__swap_u32_argb_abgr(color))));
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      wuffs_base__store_u64le__no_bounds_check(
+          row + (8 * ((size_t)x)), wuffs_base__color_u32__as__color_u64(
+                                       wuffs_base__swap_u32_argb_abgr(color)));
+      break;
+
+    default:
+      // TODO: support more formats.
+      return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+  }
+
+  return wuffs_base__make_status(NULL);
+}
+
+// --------
+
+WUFFS_BASE__MAYBE_STATIC uint8_t  //
+wuffs_base__pixel_palette__closest_element(
+    wuffs_base__slice_u8 palette_slice,
+    wuffs_base__pixel_format palette_format,
+    wuffs_base__color_u32_argb_premul c) {
+  size_t n = palette_slice.len / 4;
+  if (n > 256) {
+    n = 256;
+  }
+  size_t best_index = 0;
+  uint64_t best_score = 0xFFFFFFFFFFFFFFFF;
+
+  // Work in 16-bit color.
+  uint32_t ca = 0x101 * (0xFF & (c >> 24));
+  uint32_t cr = 0x101 * (0xFF & (c >> 16));
+  uint32_t cg = 0x101 * (0xFF & (c >> 8));
+  uint32_t cb = 0x101 * (0xFF & (c >> 0));
+
+  switch (palette_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY: {
+      bool nonpremul = palette_format.repr ==
+                       WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL;
+
+      size_t i;
+      for (i = 0; i < n; i++) {
+        // Work in 16-bit color.
+        uint32_t pb = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 0]));
+        uint32_t pg = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 1]));
+        uint32_t pr = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 2]));
+        uint32_t pa = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 3]));
+
+        // Convert to premultiplied alpha.
+        if (nonpremul && (pa != 0xFFFF)) {
+          pb = (pb * pa) / 0xFFFF;
+          pg = (pg * pa) / 0xFFFF;
+          pr = (pr * pa) / 0xFFFF;
+        }
+
+        // These deltas are conceptually int32_t (signed) but after squaring,
+        // it's equivalent to work in uint32_t (unsigned).
+        pb -= cb;
+        pg -= cg;
+        pr -= cr;
+        pa -= ca;
+        uint64_t score = ((uint64_t)(pb * pb)) + ((uint64_t)(pg * pg)) +
+                         ((uint64_t)(pr * pr)) + ((uint64_t)(pa * pa));
+        if (best_score > score) {
+          best_score = score;
+          best_index = i;
+        }
+      }
+      break;
+    }
+  }
+
+  return (uint8_t)best_index;
+}
+
+// --------
+
+static inline uint32_t  //
+wuffs_base__pixel_palette_lookup__cache_slot(
+    wuffs_base__color_u32_argb_premul c) {
+  // This is Fibonacci hashing, keeping the high bits of the product.
+  return (uint32_t)(((uint32_t)(c * 0x9E3779B1u)) >> 20) &
+         (WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE - 1);
+}
+
+static inline void  //
+wuffs_base__pixel_palette_lookup__consider(
+    const wuffs_base__pixel_palette_lookup* p,
+    uint32_t i,
+    uint32_t cb,
+    uint32_t cg,
+    uint32_t cr,
+    uint32_t ca,
+    uint64_t* best_score,
+    uint32_t* best_index) {
+  const uint32_t* e = &p->private_impl.elements[i][0];
+  // These deltas are conceptually int32_t (signed) but after squaring, it's
+  // equivalent to work in uint32_t (unsigned).
+  uint32_t pb = e[0] - cb;
+  uint32_t pg = e[1] - cg;
+  uint32_t pr = e[2] - cr;
+  uint32_t pa = e[3] - ca;
+  uint64_t score = ((uint64_t)(pb * pb)) + ((uint64_t)(pg * pg)) +
+                   ((uint64_t)(pr * pr)) + ((uint64_t)(pa * pa));
+  if ((*best_score > score) || ((*best_score == score) && (*best_index > i))) {
+    *best_score = score;
+    *best_index = i;
+  }
+}
+
+// wuffs_base__pixel_palette_lookup__search finds the same element as
+// wuffs_base__pixel_palette__closest_element would, but instead of scoring
+// every element, it walks outwards (in both directions) from c's green value
+// through the elements sorted by green. A walk stops once the green delta
+// alone, squared, exceeds the best score so far, as no further element in
+// that direction can then score better (or equal, which would also need a
+// smaller index comparison).
+static uint8_t  //
+wuffs_base__pixel_palette_lookup__search(
+    const wuffs_base__pixel_palette_lookup* p,
+    wuffs_base__color_u32_argb_premul c) {
+  uint32_t n = p->private_impl.num_elements;
+  if (n == 0) {
+    return 0;
+  }
+  uint64_t best_score = 0xFFFFFFFFFFFFFFFF;
+  uint32_t best_index = 0;
+
+  // Work in 16-bit color.
+  uint32_t ca = 0x101 * (0xFF & (c >> 24));
+  uint32_t cr = 0x101 * (0xFF & (c >> 16));
+  uint32_t cg = 0x101 * (0xFF & (c >> 8));
+  uint32_t cb = 0x101 * (0xFF & (c >> 0));
+
+  // Binary search for the first sorted position whose green is >= cg.
+  const uint8_t* sorted = &p->private_impl.sorted_by_green[0];
+  uint32_t lo = 0;
+  uint32_t hi = n;
+  while (lo < hi) {
+    uint32_t mid = lo + ((hi - lo) / 2);
+    if (p->private_impl.elements[sorted[mid]][1] < cg) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  // Walk upwards from hi and downwards from lo.
+  hi = lo;
+  bool up = hi < n;
+  bool down = lo > 0;
+  while (up || down) {
+    if (up) {
+      uint32_t i = sorted[hi];
+      uint64_t dg = p->private_impl.elements[i][1] - cg;
+      if ((dg * dg) > best_score) {
+        up = false;
+      } else {
+        wuffs_base__pixel_palette_lookup__consider(p, i, cb, cg, cr, ca,
+                                                   &best_score, &best_index);
+        hi++;
+        up = hi < n;
+      }
+    }
+    if (down) {
+      uint32_t i = sorted[lo - 1];
+      uint64_t dg = cg - p->private_impl.elements[i][1];
+      if ((dg * dg) > best_score) {
+        down = false;
+      } else {
+        wuffs_base__pixel_palette_lookup__consider(p, i, cb, cg, cr, ca,
+                                                   &best_score, &best_index);
+        lo--;
+        down = lo > 0;
+      }
+    }
+  }
+
+  return (uint8_t)best_index;
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_palette_lookup__prepare(
+    wuffs_base__pixel_palette_lookup* p,
+    wuffs_base__slice_u8 palette_slice,
+    wuffs_base__pixel_format palette_format) {
+  if (!p) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  p->private_impl.num_elements = 0;
+
+  bool nonpremul = false;
+  switch (palette_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL:
+      nonpremul = true;
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:
+      break;
+    default:
+      return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+  }
+
+  size_t n = palette_slice.len / 4;
+  if (n > 256) {
+    n = 256;
+  }
+  size_t i;
+  for (i = 0; i < n; i++) {
+    // Work in 16-bit color.
+    uint32_t pb = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 0]));
+    uint32_t pg = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 1]));
+    uint32_t pr = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 2]));
+    uint32_t pa = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 3]));
+
+    // Convert to premultiplied alpha.
+    if (nonpremul && (pa != 0xFFFF)) {
+      pb = (pb * pa) / 0xFFFF;
+      pg = (pg * pa) / 0xFFFF;
+      pr = (pr * pa) / 0xFFFF;
+    }
+
+    p->private_impl.elements[i][0] = pb;
+    p->private_impl.elements[i][1] = pg;
+    p->private_impl.elements[i][2] = pr;
+    p->private_impl.elements[i][3] = pa;
+  }
+  p->private_impl.num_elements = (uint32_t)n;
+
+  // Insertion sort the element indexes by green. The sort is stable, but the
+  // search doesn't rely on that, as it compares indexes to break ties.
+  uint8_t* sorted = &p->private_impl.sorted_by_green[0];
+  for (i = 0; i < n; i++) {
+    uint32_t g = p->private_impl.elements[i][1];
+    size_t j = i;
+    while ((j > 0) && (p->private_impl.elements[sorted[j - 1]][1] > g)) {
+      sorted[j] = sorted[j - 1];
+      j--;
+    }
+    sorted[j] = (uint8_t)i;
+  }
+
+  // Fill every cache slot with the answer for transparent black. Any other
+  // color doesn't match, regardless of which slot it hashes to, so this is
+  // equivalent to an empty cache, but without a separate "valid" bit.
+  uint8_t zero_index = wuffs_base__pixel_palette_lookup__search(p, 0);
+  for (i = 0; i < WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE; i++) {
+    p->private_impl.cache_colors[i] = 0;
+    p->private_impl.cache_indexes[i] = zero_index;
+  }
+
+  return wuffs_base__make_status(NULL);
+}
+
+WUFFS_BASE__MAYBE_STATIC uint8_t  //
+wuffs_base__pixel_palette_lookup__closest_element(
+    wuffs_base__pixel_palette_lookup* p,
+    wuffs_base__color_u32_argb_premul c) {
+  if (!p) {
+    return 0;
+  }
+  uint32_t slot = wuffs_base__pixel_palette_lookup__cache_slot(c);
+  if (p->private_impl.cache_colors[slot] != c) {
+    p->private_impl.cache_colors[slot] = c;
+    p->private_impl.cache_indexes[slot] =
+        wuffs_base__pixel_palette_lookup__search(p, c);
+  }
+  return p->private_impl.cache_indexes[slot];
+}
+
+// --------
+
+static inline uint32_t  //
+wuffs_base__composite_nonpremul_nonpremul_u32_axxx(uint32_t dst_nonpremul,
+                                                   uint32_t src_nonpremul) {
+  // Convert from 8-bit color to 16-bit color.
+  uint32_t sa = 0x101 * (0xFF & (src_nonpremul >> 24));
+  uint32_t sr = 0x101 * (0xFF & (src_nonpremul >> 16));
+  uint32_t sg = 0x101 * (0xFF & (src_nonpremul >> 8));
+  uint32_t sb = 0x101 * (0xFF & (src_nonpremul >> 0));
+  uint32_t da = 0x101 * (0xFF & (dst_nonpremul >> 24));
+  uint32_t dr = 0x101 * (0xFF & (dst_nonpremul >> 16));
+  uint32_t dg = 0x101 * (0xFF & (dst_nonpremul >> 8));
+  uint32_t db = 0x101 * (0xFF & (dst_nonpremul >> 0));
+
+  // Convert dst from nonpremul to premul.
+  dr = (dr * da) / 0xFFFF;
+  dg = (dg * da) / 0xFFFF;
+  db = (db * da) / 0xFFFF;
+
+  // Calculate the inverse of the src-alpha: how much of the dst to keep.
+  uint32_t ia = 0xFFFF - sa;
+
+  // Composite src (nonpremul) over dst (premul).
+  da = sa + ((da * ia) / 0xFFFF);
+  dr = ((sr * sa) + (dr * ia)) / 0xFFFF;
+  dg = ((sg * sa) + (dg * ia)) / 0xFFFF;
+  db = ((sb * sa) + (db * ia)) / 0xFFFF;
+
+  // Convert dst from premul to nonpremul.
+  if (da != 0) {
+    dr = (dr * 0xFFFF) / da;
+    dg = (dg * 0xFFFF) / da;
+    db = (db * 0xFFFF) / da;
+  }
+
+  // Convert from 16-bit color to 8-bit color and combine the components.
+  da >>= 8;
+  dr >>= 8;
+  dg >>= 8;
+  db >>= 8;
+  return (db << 0) | (dg << 8) | (dr << 16) | (da << 24);
+}
+
+static inline uint32_t  //
+wuffs_base__composite_nonpremul_premul_u32_axxx(uint32_t dst_nonpremul,
+                                                uint32_t src_premul) {
+  // Convert from 8-bit color to 16-bit color.
+  uint32_t sa = 0x101 * (0xFF & (src_premul >> 24));
+  uint32_t sr = 0x101 * (0xFF & (src_premul >> 16));
+  uint32_t sg = 0x101 * (0xFF & (src_premul >> 8));
+  uint32_t sb = 0x101 * (0xFF & (src_premul >> 0));
+  uint32_t da = 0x101 * (0xFF & (dst_nonpremul >> 24));
+  uint32_t dr = 0x101 * (0xFF & (dst_nonpremul >> 16));
+  uint32_t dg = 0x101 * (0xFF & (dst_nonpremul >> 8));
+  uint32_t db = 0x101 * (0xFF & (dst_nonpremul >> 0));
+
+  // Convert dst from nonpremul to premul.
+  dr = (dr * da) / 0xFFFF;
+  dg = (dg * da) / 0xFFFF;
+  db = (db * da) / 0xFFFF;
+
+  // Calculate the inverse of the src-alpha: how much of the dst to keep.
+  uint32_t ia = 0xFFFF - sa;
+
+  // Composite src (premul) over dst (premul).
+  da = sa + ((da * ia) / 0xFFFF);
+  dr = sr + ((dr * ia) / 0xFFFF);
+  dg = sg + ((dg * ia) / 0xFFFF);
+  db = sb + ((db * ia) / 0xFFFF);
+
+  // Convert dst from premul to nonpremul.
+  if (da != 0) {
+    dr = (dr * 0xFFFF) / da;
+    dg = (dg * 0xFFFF) / da;
+    db = (db * 0xFFFF) / da;
+  }
+
+  // Convert from 16-bit color to 8-bit color and combine the components.
+  da >>= 8;
+  dr >>= 8;
+  dg >>= 8;
+  db >>= 8;
+  return (db << 0) | (dg << 8) | (dr << 16) | (da << 24);
+}
+
+static inline uint32_t  //
+wuffs_base__composite_premul_nonpremul_u32_axxx(uint32_t dst_premul,
+                                                uint32_t src_nonpremul) {
+  // Convert from 8-bit color to 16-bit color.
+  uint32_t sa = 0x101 * (0xFF & (src_nonpremul >> 24));
+  uint32_t sr = 0x101 * (0xFF & (src_nonpremul >> 16));
+  uint32_t sg = 0x101 * (0xFF & (src_nonpremul >> 8));
+  uint32_t sb = 0x101 * (0xFF & (src_nonpremul >> 0));
+  uint32_t da = 0x101 * (0xFF & (dst_premul >> 24));
+  uint32_t dr = 0x101 * (0xFF & (dst_premul >> 16));
+  uint32_t dg = 0x101 * (0xFF & (dst_premul >> 8));
+  uint32_t db = 0x101 * (0xFF & (dst_premul >> 0));
+
+  // Calculate the inverse of the src-alpha: how much of the dst to keep.
+  uint32_t ia = 0xFFFF - sa;
+
+  // Composite src (nonpremul) over dst (premul).
+  da = sa + ((da * ia) / 0xFFFF);
+  dr = ((sr * sa) + (dr * ia)) / 0xFFFF;
+  dg = ((sg * sa) + (dg * ia)) / 0xFFFF;
+  db = ((sb * sa) + (db * ia)) / 0xFFFF;
+
+  // Convert from 16-bit color to 8-bit color and combine the components.
+  da >>= 8;
+  dr >>= 8;
+  dg >>= 8;
+  db >>= 8;
+  return (db << 0) | (dg << 8) | (dr << 16) | (da << 24);
+}
+
+static inline uint32_t  //
+wuffs_base__composite_premul_premul_u32_axxx(uint32_t dst_premul,
+                                             uint32_t src_premul) {
+  // Convert from 8-bit color to 16-bit color.
+  uint32_t sa = 0x101 * (0xFF & (src_premul >> 24));
+  uint32_t sr = 0x101 * (0xFF & (src_premul >> 16));
+  uint32_t sg = 0x101 * (0xFF & (src_premul >> 8));
+  uint32_t sb = 0x101 * (0xFF & (src_premul >> 0));
+  uint32_t da = 0x101 * (0xFF & (dst_premul >> 24));
+  uint32_t dr = 0x101 * (0xFF & (dst_premul >> 16));
+  uint32_t dg = 0x101 * (0xFF & (dst_premul >> 8));
+  uint32_t db = 0x101 * (0xFF & (dst_premul >> 0));
+
+  // Calculate the inverse of the src-alpha: how much of the dst to keep.
+  uint32_t ia = 0xFFFF - sa;
+
+  // Composite src (premul) over dst (premul).
+  da = sa + ((da * ia) / 0xFFFF);
+  dr = sr + ((dr * ia) / 0xFFFF);
+  dg = sg + ((dg * ia) / 0xFFFF);
+  db = sb + ((db * ia) / 0xFFFF);
+
+  // Convert from 16-bit color to 8-bit color and combine the components.
+  da >>= 8;
+  dr >>= 8;
+  dg >>= 8;
+  db >>= 8;
+  return (db << 0) | (dg << 8) | (dr << 16) | (da << 24);
+}
+
+static inline uint64_t  //
+wuffs_base__composite_premul_premul_u64_axxx(uint64_t dst_premul,
+                                             uint64_t src_premul) {
+  uint64_t sa = 0xFFFF & (src_premul >> 48);
+  uint64_t sr = 0xFFFF & (src_premul >> 32);
+  uint64_t sg = 0xFFFF & (src_premul >> 16);
+  uint64_t sb = 0xFFFF & (src_premul >> 0);
+  uint64_t da = 0xFFFF & (dst_premul >> 48);
+  uint64_t dr = 0xFFFF & (dst_premul >> 32);
+  uint64_t dg = 0xFFFF & (dst_premul >> 16);
+  uint64_t db = 0xFFFF & (dst_premul >> 0);
+
+  // Calculate the inverse of the src-alpha: how much of the dst to keep.
+  uint64_t ia = 0xFFFF - sa;
+
+  // Composite src (premul) over dst (premul). Unlike the u32_axxx functions,
+  // there's no conversion back to 8-bit color, so no rounding loss there.
+  da = sa + ((da * ia) / 0xFFFF);
+  dr = sr + ((dr * ia) / 0xFFFF);
+  dg = sg + ((dg * ia) / 0xFFFF);
+  db = sb + ((db * ia) / 0xFFFF);
+
+  return (db << 0) | (dg << 16) | (dr << 32) | (da << 48);
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+// wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff returns, for each 16-bit
+// lane m (which must be at most 0xFF * 0xFF), ((m * 0x101) / 0xFF), which
+// equals (m + ((2 * m) / 0xFF)), without overflowing 16 bits.
+//
+// The u32_axxx composite functions expand 8-bit values v to 16-bit values
+// (v * 0x101) and divide by 0xFFFF, which is (0x101 * 0xFF). For 8-bit a and
+// b, ((0x101 * a) * (0x101 * b)) / 0xFFFF therefore equals this function
+// applied to (a * b), so that this reproduces their rounding exactly.
+//
+// As for the bgra_premul__bgra_nonpremul__src__x86_sse42 function below,
+// dividing by 0xFF is done by computing u = (m + 1 + (m >> 8)) >> 8, and then
+// adjusting by the remainder r = (m - (0xFF * u)).
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline __m128i  //
+wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff(__m128i m) {
+  __m128i u = _mm_srli_epi16(
+      _mm_add_epi16(_mm_add_epi16(m, _mm_set1_epi16(0x0001)),
+                    _mm_srli_epi16(m, 8)),
+      8);
+  __m128i r = _mm_sub_epi16(m, _mm_mullo_epi16(u, _mm_set1_epi16(0x00FF)));
+  return _mm_sub_epi16(_mm_add_epi16(m, _mm_add_epi16(u, u)),
+                       _mm_cmpgt_epi16(r, _mm_set1_epi16(0x007F)));
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static inline uint64_t  //
+wuffs_base__swap_u64_argb_abgr(uint64_t c) {
+  uint64_t o = c & 0xFFFF0000FFFF0000;
+  uint64_t r = 0xFFFF & (c >> 32);
+  uint64_t b = 0xFFFF & (c >> 0);
+  return o | (r << 0) | (b << 32);
+}
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__squash_bgr_565_888(wuffs_base__slice_u8 dst,
+                                               wuffs_base__slice_u8 src) {
+  size_t len4 = (dst.len < src.len ? dst.len : src.len) / 4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+
+  size_t n = len4;
+  while (n--) {
+    uint32_t argb = wuffs_base__load_u32le__no_bounds_check(s);
+    uint32_t b5 = 0x1F & (argb >> (8 - 5));
+    uint32_t g6 = 0x3F & (argb >> (16 - 6));
+    uint32_t r5 = 0x1F & (argb >> (24 - 5));
+    uint32_t alpha = argb & 0xFF000000;
+    wuffs_base__store_u32le__no_bounds_check(
+        d, alpha | (r5 << 11) | (g6 << 5) | (b5 << 0));
+    s += 4;
+    d += 4;
+  }
+  return len4 * 4;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__swap_rgbx_bgrx(wuffs_base__slice_u8 dst,
+                                           wuffs_base__slice_u8 src) {
+  size_t len4 = (dst.len < src.len ? dst.len : src.len) / 4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+
+  size_t n = len4;
+  while (n--) {
+    uint8_t b0 = s[0];
+    uint8_t b1 = s[1];
+    uint8_t b2 = s[2];
+    uint8_t b3 = s[3];
+    d[0] = b2;
+    d[1] = b1;
+    d[2] = b0;
+    d[3] = b3;
+    s += 4;
+    d += 4;
+  }
+  return len4 * 4;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__swap_rgbx_bgrx__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 src) {
+  size_t len4 = (dst.len < src.len ? dst.len : src.len) / 4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len4;
+
+  __m128i shuffle = _mm_set_epi8(+0x0F, +0x0C, +0x0D, +0x0E,  //
+                                 +0x0B, +0x08, +0x09, +0x0A,  //
+                                 +0x07, +0x04, +0x05, +0x06,  //
+                                 +0x03, +0x00, +0x01, +0x02);
+
+  while (n >= 4) {
+    __m128i x;
+    x = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    x = _mm_shuffle_epi8(x, shuffle);
+    _mm_storeu_si128((__m128i*)(void*)d, x);
+
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n--) {
+    uint8_t b0 = s[0];
+    uint8_t b1 = s[1];
+    uint8_t b2 = s[2];
+    uint8_t b3 = s[3];
+    d[0] = b2;
+    d[1] = b1;
+    d[2] = b0;
+    d[3] = b3;
+    s += 4;
+    d += 4;
+  }
+  return len4 * 4;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__copy_1_1(wuffs_base__slice_u8 dst,
+                                     wuffs_base__slice_u8 dst_palette,
+                                     wuffs_base__slice_u8 src) {
+  return wuffs_base__slice_u8__copy_from_slice(dst, src);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__copy_3_3(wuffs_base__slice_u8 dst,
+                                     wuffs_base__slice_u8 dst_palette,
+                                     wuffs_base__slice_u8 src) {
+  size_t dst_len3 = dst.len / 3;
+  size_t src_len3 = src.len / 3;
+  size_t len = dst_len3 < src_len3 ? dst_len3 : src_len3;
+  if (len > 0) {
+    memmove(dst.ptr, src.ptr, len * 3);
+  }
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__copy_4_4(wuffs_base__slice_u8 dst,
+                                     wuffs_base__slice_u8 dst_palette,
+                                     wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  if (len > 0) {
+    memmove(dst.ptr, src.ptr, len * 4);
+  }
+  return len;
+}
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr_565__bgr(wuffs_base__slice_u8 dst,
+                                         wuffs_base__slice_u8 dst_palette,
+                                         wuffs_base__slice_u8 src) {
+  size_t dst_len2 = dst.len / 2;
+  size_t src_len3 = src.len / 3;
+  size_t len = dst_len2 < src_len3 ? dst_len2 : src_len3;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    uint32_t b5 = s[0] >> 3;
+    uint32_t g6 = s[1] >> 2;
+    uint32_t r5 = s[2] >> 3;
+    uint32_t rgb_565 = (r5 << 11) | (g6 << 5) | (b5 << 0);
+    wuffs_base__store_u16le__no_bounds_check(d + (0 * 2), (uint16_t)rgb_565);
+
+    s += 1 * 3;
+    d += 1 * 2;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr_565__bgra_nonpremul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len2 = dst.len / 2;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len2 < src_len4 ? dst_len2 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    wuffs_base__store_u16le__no_bounds_check(
+        d + (0 * 2),
+        wuffs_base__color_u32_argb_premul__as__color_u16_rgb_565(
+            wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+                wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)))));
+
+    s += 1 * 4;
+    d += 1 * 2;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr_565__bgra_nonpremul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len2 = dst.len / 2;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len2 < src_len4 ? dst_len2 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    // Convert from 8-bit color to 16-bit color.
+    uint32_t sa = 0x101 * ((uint32_t)s[3]);
+    uint32_t sr = 0x101 * ((uint32_t)s[2]);
+    uint32_t sg = 0x101 * ((uint32_t)s[1]);
+    uint32_t sb = 0x101 * ((uint32_t)s[0]);
+
+    // Convert from 565 color to 16-bit color.
+    uint32_t old_rgb_565 = wuffs_base__load_u16le__no_bounds_check(d + (0 * 2));
+    uint32_t old_r5 = 0x1F & (old_rgb_565 >> 11);
+    uint32_t dr = (0x8421 * old_r5) >> 4;
+    uint32_t old_g6 = 0x3F & (old_rgb_565 >> 5);
+    uint32_t dg = (0x1041 * old_g6) >> 2;
+    uint32_t old_b5 = 0x1F & (old_rgb_565 >> 0);
+    uint32_t db = (0x8421 * old_b5) >> 4;
+
+    // Calculate the inverse of the src-alpha: how much of the dst to keep.
+    uint32_t ia = 0xFFFF - sa;
+
+    // Composite src (nonpremul) over dst (premul).
+    dr = ((sr * sa) + (dr * ia)) / 0xFFFF;
+    dg = ((sg * sa) + (dg * ia)) / 0xFFFF;
+    db = ((sb * sa) + (db * ia)) / 0xFFFF;
+
+    // Convert from 16-bit color to 565 color and combine the components.
+    uint32_t new_r5 = 0x1F & (dr >> 11);
+    uint32_t new_g6 = 0x3F & (dg >> 10);
+    uint32_t new_b5 = 0x1F & (db >> 11);
+    uint32_t new_rgb_565 = (new_r5 << 11) | (new_g6 << 5) | (new_b5 << 0);
+    wuffs_base__store_u16le__no_bounds_check(d + (0 * 2),
+                                             (uint16_t)new_rgb_565);
+
+    s += 1 * 4;
+    d += 1 * 2;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr_565__y(wuffs_base__slice_u8 dst,
+                                       wuffs_base__slice_u8 dst_palette,
+                                       wuffs_base__slice_u8 src) {
+  size_t dst_len2 = dst.len / 2;
+  size_t len = dst_len2 < src.len ? dst_len2 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    uint32_t y5 = s[0] >> 3;
+    uint32_t y6 = s[0] >> 2;
+    uint32_t rgb_565 = (y5 << 11) | (y6 << 5) | (y5 << 0);
+    wuffs_base__store_u16le__no_bounds_check(d + (0 * 2), (uint16_t)rgb_565);
+
+    s += 1 * 1;
+    d += 1 * 2;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr_565__index__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len2 = dst.len / 2;
+  size_t len = dst_len2 < src.len ? dst_len2 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  const size_t loop_unroll_count = 4;
+
+  while (n >= loop_unroll_count) {
+    wuffs_base__store_u16le__no_bounds_check(
+        d + (0 * 2), wuffs_base__load_u16le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[0] * 4)));
+    wuffs_base__store_u16le__no_bounds_check(
+        d + (1 * 2), wuffs_base__load_u16le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[1] * 4)));
+    wuffs_base__store_u16le__no_bounds_check(
+        d + (2 * 2), wuffs_base__load_u16le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[2] * 4)));
+    wuffs_base__store_u16le__no_bounds_check(
+        d + (3 * 2), wuffs_base__load_u16le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[3] * 4)));
+
+    s += loop_unroll_count * 1;
+    d += loop_unroll_count * 2;
+    n -= loop_unroll_count;
+  }
+
+  while (n >= 1) {
+    wuffs_base__store_u16le__no_bounds_check(
+        d + (0 * 2), wuffs_base__load_u16le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[0] * 4)));
+
+    s += 1 * 1;
+    d += 1 * 2;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr_565__index_binary_alpha__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len2 = dst.len / 2;
+  size_t len = dst_len2 < src.len ? dst_len2 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    if (s0) {
+      wuffs_base__store_u16le__no_bounds_check(d + (0 * 2), (uint16_t)s0);
+    }
+
+    s += 1 * 1;
+    d += 1 * 2;
+    n -= 1;
+  }
+
+  return len;
+}
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr__bgra_nonpremul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len3 = dst.len / 3;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len3 < src_len4 ? dst_len3 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    uint32_t s0 =
+        wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+            wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
+
+    s += 1 * 4;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr__bgra_nonpremul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len3 = dst.len / 3;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len3 < src_len4 ? dst_len3 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    // Convert from 8-bit color to 16-bit color.
+    uint32_t sa = 0x101 * ((uint32_t)s[3]);
+    uint32_t sr = 0x101 * ((uint32_t)s[2]);
+    uint32_t sg = 0x101 * ((uint32_t)s[1]);
+    uint32_t sb = 0x101 * ((uint32_t)s[0]);
+    uint32_t dr = 0x101 * ((uint32_t)d[2]);
+    uint32_t dg = 0x101 * ((uint32_t)d[1]);
+    uint32_t db = 0x101 * ((uint32_t)d[0]);
+
+    // Calculate the inverse of the src-alpha: how much of the dst to keep.
+    uint32_t ia = 0xFFFF - sa;
+
+    // Composite src (nonpremul) over dst (premul).
+    dr = ((sr * sa) + (dr * ia)) / 0xFFFF;
+    dg = ((sg * sa) + (dg * ia)) / 0xFFFF;
+    db = ((sb * sa) + (db * ia)) / 0xFFFF;
+
+    // Convert from 16-bit color to 8-bit color.
+    d[0] = (uint8_t)(db >> 8);
+    d[1] = (uint8_t)(dg >> 8);
+    d[2] = (uint8_t)(dr >> 8);
+
+    s += 1 * 4;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4),
+        wuffs_base__composite_nonpremul_nonpremul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+// The SRC_OVER x86_sse42 functions below work on 4 pixels (16 bytes) at a
+// time. They produce exactly the same output as their scalar counterparts.
+// Runs of fully opaque or fully transparent src pixels, common for sprites
+// and animation frames, take a fast path: opaque src pixels simply replace
+// the dst and transparent ones leave it alone.
+//
+// For a nonpremul dst, compositing converts the dst to premul and back. That
+// round trip is lossy (it divides by the dst alpha), so a transparent src is
+// only a no-op when the dst is opaque. Mixed groups of 4 pixels fall back to
+// the scalar code.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);
+
+  while (n >= 4) {
+    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    __m128i sa4 = _mm_and_si128(s4, alpha_mask);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa4, alpha_mask)) == 0xFFFF) {
+      _mm_storeu_si128((__m128i*)(void*)d, s4);
+    } else {
+      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);
+      __m128i da4 = _mm_and_si128(d4, alpha_mask);
+      if (!_mm_testz_si128(sa4, sa4) ||
+          (_mm_movemask_epi8(_mm_cmpeq_epi32(da4, alpha_mask)) != 0xFFFF)) {
+        int i;
+        for (i = 0; i < 4; i++) {
+          uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (i * 4));
+          uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (i * 4));
+          wuffs_base__store_u32le__no_bounds_check(
+              d + (i * 4),
+              wuffs_base__composite_nonpremul_nonpremul_u32_axxx(d0, s0));
+        }
+      }
+    }
+
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4),
+        wuffs_base__composite_nonpremul_nonpremul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4),
+        wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // This computes the same (8-bit color) values as the
+  // wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul function,
+  // 4 pixels (16 bytes) at a time, using 16-bit lanes. For a color value c
+  // and alpha value a, with x = (c * a), that function calculates
+  // ((x * 0x101 * 0x101) / 0xFFFF) >> 8, which simplifies to
+  // (x + ((2 * x) / 0xFF)) >> 8.
+  //
+  // Dividing by 0xFF is done by computing u = (x + 1 + (x >> 8)) >> 8, which
+  // equals (x / 0xFF) for all x <= (0xFF * 0xFF), and then adjusting by the
+  // remainder r = (x - (0xFF * u)). None of the intermediate values overflow
+  // 16 bits.
+
+  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);
+  __m128i lo_alpha_shuffle = _mm_set_epi8(-0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x03, -0x80, +0x03,  //
+                                          -0x80, +0x03, -0x80, +0x03);
+  __m128i hi_alpha_shuffle = _mm_set_epi8(-0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0B, -0x80, +0x0B,  //
+                                          -0x80, +0x0B, -0x80, +0x0B);
+  __m128i u16_0x0001 = _mm_set1_epi16(0x0001);
+  __m128i u16_0x007F = _mm_set1_epi16(0x007F);
+  __m128i u16_0x00FF = _mm_set1_epi16(0x00FF);
+
+  while (n >= 4) {
+    __m128i x = _mm_lddqu_si128((const __m128i*)(const void*)s);
+
+    // Fast path: if all 4 pixels are opaque, premultiplication is a no-op.
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(x, alpha_mask),
+                                          alpha_mask)) != 0xFFFF) {
+      __m128i lo = _mm_cvtepu8_epi16(x);
+      __m128i hi = _mm_cvtepu8_epi16(_mm_srli_si128(x, 8));
+      __m128i lo_x = _mm_mullo_epi16(lo, _mm_shuffle_epi8(x, lo_alpha_shuffle));
+      __m128i hi_x = _mm_mullo_epi16(hi, _mm_shuffle_epi8(x, hi_alpha_shuffle));
+
+      __m128i lo_u =
+          _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo_x, u16_0x0001),
+                                       _mm_srli_epi16(lo_x, 8)),
+                         8);
+      __m128i hi_u =
+          _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi_x, u16_0x0001),
+                                       _mm_srli_epi16(hi_x, 8)),
+                         8);
+      __m128i lo_r = _mm_sub_epi16(lo_x, _mm_mullo_epi16(lo_u, u16_0x00FF));
+      __m128i hi_r = _mm_sub_epi16(hi_x, _mm_mullo_epi16(hi_u, u16_0x00FF));
+
+      // Subtracting a ((r > 0x7F) ? -1 : 0) mask adds 1 when the remainder
+      // rounds 2*x/0xFF up past the next integer.
+      __m128i lo_d = _mm_sub_epi16(_mm_add_epi16(lo_u, lo_u),
+                                   _mm_cmpgt_epi16(lo_r, u16_0x007F));
+      __m128i hi_d = _mm_sub_epi16(_mm_add_epi16(hi_u, hi_u),
+                                   _mm_cmpgt_epi16(hi_r, u16_0x007F));
+      lo_x = _mm_srli_epi16(_mm_add_epi16(lo_x, lo_d), 8);
+      hi_x = _mm_srli_epi16(_mm_add_epi16(hi_x, hi_d), 8);
+
+      // Restore the original alpha values (lanes 3 and 7) and narrow back
+      // down to 8 bits per channel.
+      lo_x = _mm_blend_epi16(lo_x, lo, 0x88);
+      hi_x = _mm_blend_epi16(hi_x, hi, 0x88);
+      x = _mm_packus_epi16(lo_x, hi_x);
+    }
+    _mm_storeu_si128((__m128i*)(void*)d, x);
+
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4),
+        wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__composite_premul_nonpremul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // With 8-bit values s (src), d (dst), sa (src alpha) and ia (0xFF - sa),
+  // and F being wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff, the
+  // wuffs_base__composite_premul_nonpremul_u32_axxx function calculates each
+  // color channel as F((s * sa) + (d * ia)) >> 8 and the alpha channel as
+  // ((0x101 * sa) + F(d * ia)) >> 8. Neither overflows 16 bits.
+
+  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);
+  __m128i lo_alpha_shuffle = _mm_set_epi8(-0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x03, -0x80, +0x03,  //
+                                          -0x80, +0x03, -0x80, +0x03);
+  __m128i hi_alpha_shuffle = _mm_set_epi8(-0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0B, -0x80, +0x0B,  //
+                                          -0x80, +0x0B, -0x80, +0x0B);
+  __m128i u16_0x00FF = _mm_set1_epi16(0x00FF);
+  __m128i u16_0x0101 = _mm_set1_epi16(0x0101);
+
+  while (n >= 4) {
+    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    __m128i sa4 = _mm_and_si128(s4, alpha_mask);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa4, alpha_mask)) == 0xFFFF) {
+      _mm_storeu_si128((__m128i*)(void*)d, s4);
+    } else if (!_mm_testz_si128(sa4, sa4)) {
+      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);
+      __m128i halves[2];
+      int h;
+      for (h = 0; h < 2; h++) {
+        __m128i sv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(s4, 8) : s4);
+        __m128i dv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(d4, 8) : d4);
+        __m128i sa =
+            _mm_shuffle_epi8(s4, h ? hi_alpha_shuffle : lo_alpha_shuffle);
+        __m128i dia = _mm_mullo_epi16(dv, _mm_sub_epi16(u16_0x00FF, sa));
+        __m128i c = wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff(
+            _mm_add_epi16(_mm_mullo_epi16(sv, sa), dia));
+        __m128i a = _mm_add_epi16(
+            _mm_mullo_epi16(sa, u16_0x0101),
+            wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff(dia));
+        halves[h] = _mm_srli_epi16(_mm_blend_epi16(c, a, 0x88), 8);
+      }
+      _mm_storeu_si128((__m128i*)(void*)d,
+                       _mm_packus_epi16(halves[0], halves[1]));
+    }
+
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__composite_premul_nonpremul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr_565__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len2 = dst.len / 2;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len2 < src_len4 ? dst_len2 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    wuffs_base__store_u16le__no_bounds_check(
+        d + (0 * 2), wuffs_base__color_u32_argb_premul__as__color_u16_rgb_565(
+                         wuffs_base__load_u32le__no_bounds_check(s + (0 * 4))));
+
+    s += 1 * 4;
+    d += 1 * 2;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr_565__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len2 = dst.len / 2;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len2 < src_len4 ? dst_len2 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__color_u16_rgb_565__as__color_u32_argb_premul(
+        wuffs_base__load_u16le__no_bounds_check(d + (0 * 2)));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u16le__no_bounds_check(
+        d + (0 * 2), wuffs_base__color_u32_argb_premul__as__color_u16_rgb_565(
+                         wuffs_base__composite_premul_premul_u32_axxx(d0, s0)));
+
+    s += 1 * 4;
+    d += 1 * 2;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len3 = dst.len / 3;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len3 < src_len4 ? dst_len3 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
+
+    s += 1 * 4;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len3 = dst.len / 3;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len3 < src_len4 ? dst_len3 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t d0 =
+        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(d + (0 * 3));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u24le__no_bounds_check(
+        d + (0 * 3), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4),
+        wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__composite_nonpremul_premul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);
+
+  while (n >= 4) {
+    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    __m128i sa4 = _mm_and_si128(s4, alpha_mask);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa4, alpha_mask)) == 0xFFFF) {
+      _mm_storeu_si128((__m128i*)(void*)d, s4);
+    } else {
+      // A premul src pixel is only a no-op if all of its channels are zero.
+      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);
+      __m128i da4 = _mm_and_si128(d4, alpha_mask);
+      if (!_mm_testz_si128(s4, s4) ||
+          (_mm_movemask_epi8(_mm_cmpeq_epi32(da4, alpha_mask)) != 0xFFFF)) {
+        int i;
+        for (i = 0; i < 4; i++) {
+          uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (i * 4));
+          uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (i * 4));
+          wuffs_base__store_u32le__no_bounds_check(
+              d + (i * 4),
+              wuffs_base__composite_nonpremul_premul_u32_axxx(d0, s0));
+        }
+      }
+    }
+
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__composite_nonpremul_premul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // With the same notation as for the bgra_premul__bgra_nonpremul__src_over
+  // function, wuffs_base__composite_premul_premul_u32_axxx calculates every
+  // channel (color or alpha) as ((0x101 * s) + F(d * ia)) >> 8. That does not
+  // overflow 16 bits if the src is valid premul (every color channel is at
+  // most the alpha channel). Groups of 4 pixels that aren't valid fall back
+  // to the scalar code, which can overflow (and so produce different bits).
+
+  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);
+  __m128i alpha_bytes_shuffle = _mm_set_epi8(+0x0F, +0x0F, +0x0F, +0x0F,  //
+                                             +0x0B, +0x0B, +0x0B, +0x0B,  //
+                                             +0x07, +0x07, +0x07, +0x07,  //
+                                             +0x03, +0x03, +0x03, +0x03);
+  __m128i lo_alpha_shuffle = _mm_set_epi8(-0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x03, -0x80, +0x03,  //
+                                          -0x80, +0x03, -0x80, +0x03);
+  __m128i hi_alpha_shuffle = _mm_set_epi8(-0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0B, -0x80, +0x0B,  //
+                                          -0x80, +0x0B, -0x80, +0x0B);
+  __m128i u16_0x00FF = _mm_set1_epi16(0x00FF);
+  __m128i u16_0x0101 = _mm_set1_epi16(0x0101);
+
+  while (n >= 4) {
+    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    __m128i sa4 = _mm_shuffle_epi8(s4, alpha_bytes_shuffle);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(s4, alpha_mask),
+                                          alpha_mask)) == 0xFFFF) {
+      _mm_storeu_si128((__m128i*)(void*)d, s4);
+    } else if (_mm_testz_si128(s4, s4)) {
+      // No-op.
+    } else if (_mm_movemask_epi8(
+                   _mm_cmpeq_epi8(_mm_max_epu8(s4, sa4), sa4)) == 0xFFFF) {
+      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);
+      __m128i halves[2];
+      int h;
+      for (h = 0; h < 2; h++) {
+        __m128i sv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(s4, 8) : s4);
+        __m128i dv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(d4, 8) : d4);
+        __m128i sa =
+            _mm_shuffle_epi8(s4, h ? hi_alpha_shuffle : lo_alpha_shuffle);
+        __m128i dia = _mm_mullo_epi16(dv, _mm_sub_epi16(u16_0x00FF, sa));
+        __m128i x = _mm_add_epi16(
+            _mm_mullo_epi16(sv, u16_0x0101),
+            wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff(dia));
+        halves[h] = _mm_srli_epi16(x, 8);
+      }
+      _mm_storeu_si128((__m128i*)(void*)d,
+                       _mm_packus_epi16(halves[0], halves[1]));
+    } else {
+      int i;
+      for (i = 0; i < 4; i++) {
+        uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (i * 4));
+        uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (i * 4));
+        wuffs_base__store_u32le__no_bounds_check(
+            d + (i * 4), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));
+      }
+    }
+
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxx__index__src(wuffs_base__slice_u8 dst,
+                                            wuffs_base__slice_u8 dst_palette,
+                                            wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len3 = dst.len / 3;
+  size_t len = dst_len3 < src.len ? dst_len3 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  const size_t loop_unroll_count = 4;
+
+  // The comparison in the while condition is ">", not ">=", because with
+  // ">=", the last 4-byte store could write past the end of the dst slice.
+  //
+  // Each 4-byte store writes one too many bytes, but a subsequent store
+  // will overwrite that with the correct byte. There is always another
+  // store, whether a 4-byte store in this loop or a 1-byte store in the
+  // next loop.
+  while (n > loop_unroll_count) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 3), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[0] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (1 * 3), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[1] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (2 * 3), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[2] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (3 * 3), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[3] * 4)));
+
+    s += loop_unroll_count * 1;
+    d += loop_unroll_count * 3;
+    n -= loop_unroll_count;
+  }
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
+
+    s += 1 * 1;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxx__index_binary_alpha__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len3 = dst.len / 3;
+  size_t len = dst_len3 < src.len ? dst_len3 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  const size_t loop_unroll_count = 4;
+
+  while (n >= loop_unroll_count) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    if (s0) {
+      wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
+    }
+    uint32_t s1 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[1] * 4));
+    if (s1) {
+      wuffs_base__store_u24le__no_bounds_check(d + (1 * 3), s1);
+    }
+    uint32_t s2 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[2] * 4));
+    if (s2) {
+      wuffs_base__store_u24le__no_bounds_check(d + (2 * 3), s2);
+    }
+    uint32_t s3 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[3] * 4));
+    if (s3) {
+      wuffs_base__store_u24le__no_bounds_check(d + (3 * 3), s3);
+    }
+
+    s += loop_unroll_count * 1;
+    d += loop_unroll_count * 3;
+    n -= loop_unroll_count;
+  }
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    if (s0) {
+      wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
+    }
+
+    s += 1 * 1;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxx__y(wuffs_base__slice_u8 dst,
+                                   wuffs_base__slice_u8 dst_palette,
+                                   wuffs_base__slice_u8 src) {
+  size_t dst_len3 = dst.len / 3;
+  size_t len = dst_len3 < src.len ? dst_len3 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    uint8_t s0 = s[0];
+    d[0] = s0;
+    d[1] = s0;
+    d[2] = s0;
+
+    s += 1 * 1;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__index__src(wuffs_base__slice_u8 dst,
+                                             wuffs_base__slice_u8 dst_palette,
+                                             wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len4 = dst.len / 4;
+  size_t len = dst_len4 < src.len ? dst_len4 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  const size_t loop_unroll_count = 4;
+
+  while (n >= loop_unroll_count) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[0] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (1 * 4), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[1] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (2 * 4), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[2] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (3 * 4), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[3] * 4)));
+
+    s += loop_unroll_count * 1;
+    d += loop_unroll_count * 4;
+    n -= loop_unroll_count;
+  }
+
+  while (n >= 1) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[0] * 4)));
+
+    s += 1 * 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len4 = dst.len / 4;
+  size_t len = dst_len4 < src.len ? dst_len4 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  const size_t loop_unroll_count = 4;
+
+  while (n >= loop_unroll_count) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    if (s0) {
+      wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), s0);
+    }
+    uint32_t s1 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[1] * 4));
+    if (s1) {
+      wuffs_base__store_u32le__no_bounds_check(d + (1 * 4), s1);
+    }
+    uint32_t s2 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[2] * 4));
+    if (s2) {
+      wuffs_base__store_u32le__no_bounds_check(d + (2 * 4), s2);
+    }
+    uint32_t s3 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[3] * 4));
+    if (s3) {
+      wuffs_base__store_u32le__no_bounds_check(d + (3 * 4), s3);
+    }
+
+    s += loop_unroll_count * 1;
+    d += loop_unroll_count * 4;
+    n -= loop_unroll_count;
+  }
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    if (s0) {
+      wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), s0);
+    }
+
+    s += 1 * 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__xxx(wuffs_base__slice_u8 dst,
+                                      wuffs_base__slice_u8 dst_palette,
+                                      wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len3 = src.len / 3;
+  size_t len = dst_len4 < src_len3 ? dst_len4 : src_len3;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4),
+        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s + (0 * 3)));
+
+    s += 1 * 3;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__xxx__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len3 = src.len / 3;
+  size_t len = dst_len4 < src_len3 ? dst_len4 : src_len3;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  __m128i shuffle = _mm_set_epi8(-0x80, +0x0B, +0x0A, +0x09,  //
+                                 -0x80, +0x08, +0x07, +0x06,  //
+                                 -0x80, +0x05, +0x04, +0x03,  //
+                                 -0x80, +0x02, +0x01, +0x00);
+  __m128i opaque = _mm_set1_epi32(-0x01000000);
+
+  // Each iteration reads 16 bytes but only uses (and advances by) 12 of them.
+  // The comparison in the while condition is ">= 6", not ">= 4", so that the
+  // 16-byte load does not read past the end of the src slice: 6 pixels is 18
+  // bytes, and 5 pixels (15 bytes) would be too few.
+  while (n >= 6) {
+    __m128i x;
+    x = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    x = _mm_or_si128(_mm_shuffle_epi8(x, shuffle), opaque);
+    _mm_storeu_si128((__m128i*)(void*)d, x);
+
+    s += 4 * 3;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4),
+        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s + (0 * 3)));
+
+    s += 1 * 3;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__swap_rgbx_bgrx(dst, src) / 4;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__swap_rgbx_bgrx__x86_sse42(dst, src) / 4;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__y(wuffs_base__slice_u8 dst,
+                                    wuffs_base__slice_u8 dst_palette,
+                                    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t len = dst_len4 < src.len ? dst_len4 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), 0xFF000000 | (0x010101 * (uint32_t)s[0]));
+
+    s += 1 * 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__y__x86_sse42(wuffs_base__slice_u8 dst,
+                                               wuffs_base__slice_u8 dst_palette,
+                                               wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t len = dst_len4 < src.len ? dst_len4 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  __m128i shuffle = _mm_set_epi8(-0x80, +0x03, +0x03, +0x03,  //
+                                 -0x80, +0x02, +0x02, +0x02,  //
+                                 -0x80, +0x01, +0x01, +0x01,  //
+                                 -0x80, +0x00, +0x00, +0x00);
+  __m128i opaque = _mm_set1_epi32(-0x01000000);
+
+  while (n >= 4) {
+    __m128i x;
+    x = _mm_cvtsi32_si128(
+        (int)(wuffs_base__load_u32le__no_bounds_check(s + (0 * 1))));
+    x = _mm_or_si128(_mm_shuffle_epi8(x, shuffle), opaque);
+    _mm_storeu_si128((__m128i*)(void*)d, x);
+
+    s += 4 * 1;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), 0xFF000000 | (0x010101 * (uint32_t)s[0]));
+
+    s += 1 * 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__y(wuffs_base__slice_u8 dst,
+                                        wuffs_base__slice_u8 dst_palette,
+                                        wuffs_base__slice_u8 src) {
+  size_t dst_len8 = dst.len / 8;
+  size_t len = dst_len8 < src.len ? dst_len8 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    wuffs_base__store_u64le__no_bounds_check(
+        d + (0 * 8),
+        0xFFFF000000000000 | (0x0000000100010001 * (0x101 * (uint64_t)s[0])));
+
+    s += 1 * 1;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__index__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len8 = dst.len / 8;
+  size_t len = dst_len8 < src.len ? dst_len8 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    wuffs_base__store_u64le__no_bounds_check(
+        d + (0 * 8), wuffs_base__color_u32__as__color_u64(s0));
+
+    s += 1 * 1;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__index_binary_alpha__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len8 = dst.len / 8;
+  size_t len = dst_len8 < src.len ? dst_len8 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    if (s0) {
+      wuffs_base__store_u64le__no_bounds_check(
+          d + (0 * 8), wuffs_base__color_u32__as__color_u64(s0));
+    }
+
+    s += 1 * 1;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgr(wuffs_base__slice_u8 dst,
+                                          wuffs_base__slice_u8 dst_palette,
+                                          wuffs_base__slice_u8 src,
+                                          bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len3 = src.len / 3;
+  size_t len = dst_len8 < src_len3 ? dst_len8 : src_len3;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint64_t c = wuffs_base__color_u32__as__color_u64(
+        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s + (0 * 3)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);
+
+    s += 1 * 3;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgr(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgr(dst, dst_palette, src,
+                                                   false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgr(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgr(dst, dst_palette, src, true);
+}
+
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint64_t c =
+        wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(
+            wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src(
+      dst, dst_palette, src, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src(
+      dst, dst_palette, src, true);
+}
+
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint64_t c =
+        wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(
+            wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    uint64_t d0 = wuffs_base__load_u64le__no_bounds_check(d + (0 * 8));
+    wuffs_base__store_u64le__no_bounds_check(
+        d + (0 * 8), wuffs_base__composite_premul_premul_u64_axxx(d0, c));
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src_over(
+      dst, dst_palette, src, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src_over(
+      dst, dst_palette, src, true);
+}
+
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint64_t c = wuffs_base__color_u32__as__color_u64(
+        wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src(
+      dst, dst_palette, src, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src(
+      dst, dst_palette, src, true);
+}
+
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint64_t c = wuffs_base__color_u32__as__color_u64(
+        wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    uint64_t d0 = wuffs_base__load_u64le__no_bounds_check(d + (0 * 8));
+    wuffs_base__store_u64le__no_bounds_check(
+        d + (0 * 8), wuffs_base__composite_premul_premul_u64_axxx(d0, c));
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src_over(
+      dst, dst_palette, src, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src_over(
+      dst, dst_palette, src, true);
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+// The SSE4.2 functions below convert four 8-bit BGRA pixels (16 bytes) to four
+// 16-bit pixels (32 bytes) per loop iteration.
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  __m128i shuffle = rgb ? _mm_set_epi8(+0x0F, +0x0C, +0x0D, +0x0E,  //
+                                       +0x0B, +0x08, +0x09, +0x0A,  //
+                                       +0x07, +0x04, +0x05, +0x06,  //
+                                       +0x03, +0x00, +0x01, +0x02)
+                        : _mm_set_epi8(+0x0F, +0x0E, +0x0D, +0x0C,  //
+                                       +0x0B, +0x0A, +0x09, +0x08,  //
+                                       +0x07, +0x06, +0x05, +0x04,  //
+                                       +0x03, +0x02, +0x01, +0x00);
+  __m128i k_8081 = _mm_set1_epi16((int16_t)0x8081);
+  __m128i k_00FF = _mm_set1_epi16(0x00FF);
+  __m128i k_0101 = _mm_set1_epi16(0x0101);
+
+  while (n >= 4) {
+    __m128i x = _mm_shuffle_epi8(
+        _mm_lddqu_si128((const __m128i*)(const void*)s), shuffle);
+
+    // Each 128-bit half holds two pixels' worth of 16-bit lanes.
+    __m128i halves[2];
+    halves[0] = _mm_cvtepu8_epi16(x);
+    halves[1] = _mm_cvtepu8_epi16(_mm_srli_si128(x, 8));
+    int h;
+    for (h = 0; h < 2; h++) {
+      __m128i c = halves[h];
+      __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(c, 0xFF), 0xFF);
+
+      // With p = (c * a), which fits in 16 bits, the scalar code's
+      // ((0x101 * c) * (0x101 * a)) / 0xFFFF equals (p + (p / 127.5)),
+      // rounded down, which is (p + 2*q + (r >> 7)) where q and r are the
+      // quotient and remainder of dividing p by 255. Also, (p / 255) equals
+      // ((p * 0x8081) >> 23) for all 16-bit p.
+      __m128i p = _mm_mullo_epi16(c, a);
+      __m128i q = _mm_srli_epi16(_mm_mulhi_epu16(p, k_8081), 7);
+      __m128i r = _mm_sub_epi16(p, _mm_mullo_epi16(q, k_00FF));
+      __m128i v = _mm_add_epi16(
+          p, _mm_add_epi16(_mm_slli_epi16(q, 1), _mm_srli_epi16(r, 7)));
+
+      // The alpha lanes are simply widened from 8 to 16 bits.
+      halves[h] = _mm_blend_epi16(v, _mm_mullo_epi16(a, k_0101), 0x88);
+    }
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x00), halves[0]);
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x10), halves[1]);
+
+    s += 4 * 4;
+    d += 4 * 8;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint64_t c =
+        wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(
+            wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  __m128i shuffle = rgb ? _mm_set_epi8(+0x0F, +0x0C, +0x0D, +0x0E,  //
+                                       +0x0B, +0x08, +0x09, +0x0A,  //
+                                       +0x07, +0x04, +0x05, +0x06,  //
+                                       +0x03, +0x00, +0x01, +0x02)
+                        : _mm_set_epi8(+0x0F, +0x0E, +0x0D, +0x0C,  //
+                                       +0x0B, +0x0A, +0x09, +0x08,  //
+                                       +0x07, +0x06, +0x05, +0x04,  //
+                                       +0x03, +0x02, +0x01, +0x00);
+
+  while (n >= 4) {
+    __m128i x = _mm_shuffle_epi8(
+        _mm_lddqu_si128((const __m128i*)(const void*)s), shuffle);
+
+    // Interleaving a byte with itself multiplies it by 0x101.
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x00), _mm_unpacklo_epi8(x, x));
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x10), _mm_unpackhi_epi8(x, x));
+
+    s += 4 * 4;
+    d += 4 * 8;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint64_t c = wuffs_base__color_u32__as__color_u64(
+        wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src__x86_sse42(
+      dst, dst_palette, src, false);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src__x86_sse42(
+      dst, dst_palette, src, true);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src__x86_sse42(
+      dst, dst_palette, src, false);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src__x86_sse42(
+      dst, dst_palette, src, true);
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxx__ycc(wuffs_base__slice_u8 dst,
+                                     wuffs_base__slice_u8 src0,
+                                     wuffs_base__slice_u8 src1,
+                                     wuffs_base__slice_u8 src2,
+                                     bool rgb) {
+  size_t len = dst.len / 3;
+  len = (len < src0.len) ? len : src0.len;
+  len = (len < src1.len) ? len : src1.len;
+  len = (len < src2.len) ? len : src2.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s0 = src0.ptr;
+  uint8_t* s1 = src1.ptr;
+  uint8_t* s2 = src2.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t c =
+        wuffs_base__color_ycc__as__color_u32_argb_premul(s0[0], s1[0], s2[0]);
+    if (rgb) {
+      c = wuffs_base__swap_u32_argb_abgr(c);
+    }
+    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), c);
+
+    s0 += 1;
+    s1 += 1;
+    s2 += 1;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr__ycc(wuffs_base__slice_u8 dst,
+                                     wuffs_base__slice_u8 src0,
+                                     wuffs_base__slice_u8 src1,
+                                     wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxx__ycc(dst, src0, src1, src2, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgb__ycc(wuffs_base__slice_u8 dst,
+                                     wuffs_base__slice_u8 src0,
+                                     wuffs_base__slice_u8 src1,
+                                     wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxx__ycc(dst, src0, src1, src2, true);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__ycc(wuffs_base__slice_u8 dst,
+                                      wuffs_base__slice_u8 src0,
+                                      wuffs_base__slice_u8 src1,
+                                      wuffs_base__slice_u8 src2,
+                                      bool rgb) {
+  size_t len = dst.len / 4;
+  len = (len < src0.len) ? len : src0.len;
+  len = (len < src1.len) ? len : src1.len;
+  len = (len < src2.len) ? len : src2.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s0 = src0.ptr;
+  uint8_t* s1 = src1.ptr;
+  uint8_t* s2 = src2.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t c =
+        wuffs_base__color_ycc__as__color_u32_argb_premul(s0[0], s1[0], s2[0]);
+    if (rgb) {
+      c = wuffs_base__swap_u32_argb_abgr(c);
+    }
+    wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), c);
+
+    s0 += 1;
+    s1 += 1;
+    s2 += 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgrx__ycc(wuffs_base__slice_u8 dst,
+                                      wuffs_base__slice_u8 src0,
+                                      wuffs_base__slice_u8 src1,
+                                      wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxxx__ycc(dst, src0, src1, src2, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgbx__ycc(wuffs_base__slice_u8 dst,
+                                      wuffs_base__slice_u8 src0,
+                                      wuffs_base__slice_u8 src1,
+                                      wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxxx__ycc(dst, src0, src1, src2, true);
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__ycc__x86_sse42(wuffs_base__slice_u8 dst,
+                                                 wuffs_base__slice_u8 src0,
+                                                 wuffs_base__slice_u8 src1,
+                                                 wuffs_base__slice_u8 src2,
+                                                 bool rgb) {
+  size_t len = dst.len / 4;
+  len = (len < src0.len) ? len : src0.len;
+  len = (len < src1.len) ? len : src1.len;
+  len = (len < src2.len) ? len : src2.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s0 = src0.ptr;
+  uint8_t* s1 = src1.ptr;
+  uint8_t* s2 = src2.ptr;
+  size_t n = len;
+
+  // The constants are the same as those in
+  // wuffs_base__color_ycc__as__color_u32_argb_premul, which also explains
+  // the _mm_mulhrs_epi16 rounding.
+  __m128i bias = _mm_set1_epi16(128);
+  __m128i k_r_cr = _mm_set1_epi16(+13173);
+  __m128i k_g_cb = _mm_set1_epi16(-11277);
+  __m128i k_g_cr = _mm_set1_epi16(-23401);
+  __m128i k_b_cb = _mm_set1_epi16(+25297);
+  __m128i opaque = _mm_set1_epi8(-1);
+
+  // Each iteration converts 16 pixels, in two halves of 8 16-bit lanes.
+  while (n >= 16) {
+    __m128i yy = _mm_lddqu_si128((const __m128i*)(const void*)s0);
+    __m128i cb = _mm_lddqu_si128((const __m128i*)(const void*)s1);
+    __m128i cr = _mm_lddqu_si128((const __m128i*)(const void*)s2);
+
+    __m128i y_lo = _mm_cvtepu8_epi16(yy);
+    __m128i y_hi = _mm_cvtepu8_epi16(_mm_srli_si128(yy, 8));
+    __m128i cb_lo = _mm_sub_epi16(_mm_cvtepu8_epi16(cb), bias);
+    __m128i cb_hi =
+        _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(cb, 8)), bias);
+    __m128i cr_lo = _mm_sub_epi16(_mm_cvtepu8_epi16(cr), bias);
+    __m128i cr_hi =
+        _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(cr, 8)), bias);
+
+    __m128i r_lo = _mm_add_epi16(_mm_add_epi16(y_lo, cr_lo),
+                                 _mm_mulhrs_epi16(cr_lo, k_r_cr));
+    __m128i r_hi = _mm_add_epi16(_mm_add_epi16(y_hi, cr_hi),
+                                 _mm_mulhrs_epi16(cr_hi, k_r_cr));
+    __m128i g_lo =
+        _mm_add_epi16(_mm_add_epi16(y_lo, _mm_mulhrs_epi16(cb_lo, k_g_cb)),
+                      _mm_mulhrs_epi16(cr_lo, k_g_cr));
+    __m128i g_hi =
+        _mm_add_epi16(_mm_add_epi16(y_hi, _mm_mulhrs_epi16(cb_hi, k_g_cb)),
+                      _mm_mulhrs_epi16(cr_hi, k_g_cr));
+    __m128i b_lo = _mm_add_epi16(_mm_add_epi16(y_lo, cb_lo),
+                                 _mm_mulhrs_epi16(cb_lo, k_b_cb));
+    __m128i b_hi = _mm_add_epi16(_mm_add_epi16(y_hi, cb_hi),
+                                 _mm_mulhrs_epi16(cb_hi, k_b_cb));
+
+    // Saturate to 8 bits and interleave, in memory order, as B, G, R, A (or
+    // as R, G, B, A).
+    __m128i r = _mm_packus_epi16(r_lo, r_hi);
+    __m128i g = _mm_packus_epi16(g_lo, g_hi);
+    __m128i b = _mm_packus_epi16(b_lo, b_hi);
+    if (rgb) {
+      __m128i t = r;
+      r = b;
+      b = t;
+    }
+    __m128i bg_lo = _mm_unpacklo_epi8(b, g);
+    __m128i bg_hi = _mm_unpackhi_epi8(b, g);
+    __m128i ra_lo = _mm_unpacklo_epi8(r, opaque);
+    __m128i ra_hi = _mm_unpackhi_epi8(r, opaque);
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x00),
+                     _mm_unpacklo_epi16(bg_lo, ra_lo));
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x10),
+                     _mm_unpackhi_epi16(bg_lo, ra_lo));
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x20),
+                     _mm_unpacklo_epi16(bg_hi, ra_hi));
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x30),
+                     _mm_unpackhi_epi16(bg_hi, ra_hi));
+
+    s0 += 16;
+    s1 += 16;
+    s2 += 16;
+    d += 16 * 4;
+    n -= 16;
+  }
+
+  while (n >= 1) {
+    uint32_t c =
+        wuffs_base__color_ycc__as__color_u32_argb_premul(s0[0], s1[0], s2[0]);
+    if (rgb) {
+      c = wuffs_base__swap_u32_argb_abgr(c);
+    }
+    wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), c);
+
+    s0 += 1;
+    s1 += 1;
+    s2 += 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgrx__ycc__x86_sse42(wuffs_base__slice_u8 dst,
+                                                 wuffs_base__slice_u8 src0,
+                                                 wuffs_base__slice_u8 src1,
+                                                 wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxxx__ycc__x86_sse42(dst, src0, src1, src2,
+                                                          false);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgbx__ycc__x86_sse42(wuffs_base__slice_u8 dst,
+                                                 wuffs_base__slice_u8 src0,
+                                                 wuffs_base__slice_u8 src1,
+                                                 wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxxx__ycc__x86_sse42(dst, src0, src1, src2,
+                                                          true);
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__index__y(wuffs_base__slice_u8 dst,
+                                     wuffs_base__pixel_palette_lookup* lookup,
+                                     wuffs_base__slice_u8 src) {
+  size_t len = (dst.len < src.len) ? dst.len : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    d[0] = wuffs_base__pixel_palette_lookup__closest_element(
+        lookup, 0xFF000000 | (0x00010101 * ((uint32_t)(s[0]))));
+
+    s += 1 * 1;
+    d += 1;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__index__bgr(wuffs_base__slice_u8 dst,
+                                       wuffs_base__pixel_palette_lookup* lookup,
+                                       wuffs_base__slice_u8 src) {
+  size_t src_len3 = src.len / 3;
+  size_t len = (dst.len < src_len3) ? dst.len : src_len3;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    d[0] = wuffs_base__pixel_palette_lookup__closest_element(
+        lookup, 0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s));
+
+    s += 1 * 3;
+    d += 1;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__index__bgra_nonpremul(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__slice_u8 src) {
+  size_t src_len4 = src.len / 4;
+  size_t len = (dst.len < src_len4) ? dst.len : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    d[0] = wuffs_base__pixel_palette_lookup__closest_element(
+        lookup, wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+                    wuffs_base__load_u32le__no_bounds_check(s)));
+
+    s += 1 * 4;
+    d += 1;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__index__bgra_premul(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__slice_u8 src) {
+  size_t src_len4 = src.len / 4;
+  size_t len = (dst.len < src_len4) ? dst.len : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    d[0] = wuffs_base__pixel_palette_lookup__closest_element(
+        lookup, wuffs_base__load_u32le__no_bounds_check(s));
+
+    s += 1 * 4;
+    d += 1;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__index__bgrx(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__slice_u8 src) {
+  size_t src_len4 = src.len / 4;
+  size_t len = (dst.len < src_len4) ? dst.len : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    d[0] = wuffs_base__pixel_palette_lookup__closest_element(
+        lookup, 0xFF000000 | wuffs_base__load_u32le__no_bounds_check(s));
+
+    s += 1 * 4;
+    d += 1;
+    n -= 1;
+  }
+
+  return len;
+}
+
+// --------
+
+static wuffs_base__pixel_swizzler__func  //
+wuffs_base__pixel_swizzler__prepare__y(wuffs_base__pixel_swizzler* p,
+                                       wuffs_base__pixel_format dst_format,
+                                       wuffs_base__slice_u8 dst_palette,
+                                       wuffs_base__slice_u8 src_palette,
+                                       wuffs_base__pixel_blend blend) {
+  switch (dst_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:
+      return wuffs_base__pixel_swizzler__bgr_565__y;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+    case WUFFS_BASE__PIXEL_FORMAT__RGB:
+      return wuffs_base__pixel_swizzler__xxx__y;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBX:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+      if (wuffs_base__cpu_arch__have_x86_sse42()) {
+        return wuffs_base__pixel_swizzler__xxxx__y__x86_sse42;
+      }
+#endif
+      return wuffs_base__pixel_swizzler__xxxx__y;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      return wuffs_base__pixel_swizzler__xxxxxxxx__y;
+  }
+  return NULL;
+}
+
+static wuffs_base__pixel_swizzler__func  //
+wuffs_base__pixel_swizzler__prepare__indexed__bgra_binary(
+    wuffs_base__pixel_swizzler* p,
+    wuffs_base__pixel_format dst_format,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src_palette,
+    wuffs_base__pixel_blend blend) {
+  switch (dst_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:
+      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_palette) !=
+          1024) {
+        return NULL;
+      }
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__copy_1_1;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:
+      if (wuffs_base__pixel_swizzler__squash_bgr_565_888(dst_palette,
+                                                         src_palette) != 1024) {
+        return NULL;
+      }
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__bgr_565__index__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__bgr_565__index_binary_alpha__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_palette) !=
+          1024) {
+        return NULL;
+      }
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__xxx__index__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__xxx__index_binary_alpha__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
+      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_palette) !=
+          1024) {
+        return NULL;
+      }
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__xxxx__index__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGB:
+      if (wuffs_base__pixel_swizzler__swap_rgbx_bgrx(dst_palette,
+                                                     src_palette) != 1024) {
+        return NULL;
+      }
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__xxx__index__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__xxx__index_binary_alpha__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:
+      if (wuffs_base__pixel_swizzler__swap_rgbx_bgrx(dst_palette,
+                                                     src_palette) != 1024) {
+        return NULL;
+      }
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__xxxx__index__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_palette) !=
+          1024) {
+        return NULL;
+      }
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__xxxxxxxx__index__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__xxxxxxxx__index_binary_alpha__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      if (wuffs_base__pixel_swizzler__swap_rgbx_bgrx(dst_palette,
+                                                     src_palette) != 1024) {
+        return NULL;
+      }
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__xxxxxxxx__index__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__xxxxxxxx__index_binary_alpha__src_over;
+      }
+      return NULL;
+  }
+  return NULL;
+}
+
+static wuffs_base__pixel_swizzler__func  //
+wuffs_base__pixel_swizzler__prepare__bgr(wuffs_base__pixel_swizzler* p,
+                                         wuffs_base__pixel_format dst_format,
+                                         wuffs_base__slice_u8 dst_palette,
+                                         wuffs_base__slice_u8 src_palette,
+                                         wuffs_base__pixel_blend blend) {
+  switch (dst_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:
+      return wuffs_base__pixel_swizzler__bgr_565__bgr;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      return wuffs_base__pixel_swizzler__copy_3_3;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+      if (wuffs_base__cpu_arch__have_x86_sse42()) {
+        return wuffs_base__pixel_swizzler__xxxx__xxx__x86_sse42;
+      }
+#endif
+      return wuffs_base__pixel_swizzler__xxxx__xxx;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGB:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBX:
+      // TODO.
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgr;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgr;
+  }
+  return NULL;
+}
+
+static wuffs_base__pixel_swizzler__func  //
+wuffs_base__pixel_swizzler__prepare__bgra_nonpremul(
+    wuffs_base__pixel_swizzler* p,
+    wuffs_base__pixel_format dst_format,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src_palette,
+    wuffs_base__pixel_blend blend) {
+  switch (dst_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__bgr_565__bgra_nonpremul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__bgr_565__bgra_nonpremul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__bgr__bgra_nonpremul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__bgr__bgra_nonpremul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__copy_4_4;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+      // TODO.
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx;
+      }
+      // TODO: SRC_OVER.
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGB:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBX:
+      // TODO.
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src_over;
+      }
+      return NULL;
+  }
+  return NULL;
+}
+
+static wuffs_base__pixel_swizzler__func  //
+wuffs_base__pixel_swizzler__prepare__bgra_premul(
+    wuffs_base__pixel_swizzler* p,
+    wuffs_base__pixel_format dst_format,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src_palette,
+    wuffs_base__pixel_blend blend) {
+  // Unlike a BGRA_NONPREMUL source, premultiplied destinations composite a
+  // BGRA_PREMUL source directly, without a round trip through non-premul.
+  switch (dst_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__bgr_565__bgra_premul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__bgr_565__bgra_premul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__bgr__bgra_premul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__bgr__bgra_premul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__copy_4_4;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx;
+      }
+      // TODO: SRC_OVER.
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src_over;
+      }
+      return NULL;
+  }
+  return NULL;
+}
+
+static wuffs_base__pixel_swizzler__planar_func  //
+wuffs_base__pixel_swizzler__prepare__ycc(wuffs_base__pixel_swizzler* p,
+                                         wuffs_base__pixel_format dst_format,
+                                         wuffs_base__slice_u8 dst_palette,
+                                         wuffs_base__slice_u8 src_palette,
+                                         wuffs_base__pixel_blend blend) {
+  // The source is opaque, so that SRC_OVER is equivalent to SRC.
+  switch (dst_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      return wuffs_base__pixel_swizzler__bgr__ycc;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+      if (wuffs_base__cpu_arch__have_x86_sse42()) {
+        return wuffs_base__pixel_swizzler__bgrx__ycc__x86_sse42;
+      }
+#endif
+      return wuffs_base__pixel_swizzler__bgrx__ycc;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGB:
+      return wuffs_base__pixel_swizzler__rgb__ycc;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBX:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+      if (wuffs_base__cpu_arch__have_x86_sse42()) {
+        return wuffs_base__pixel_swizzler__rgbx__ycc__x86_sse42;
+      }
+#endif
+      return wuffs_base__pixel_swizzler__rgbx__ycc;
+  }
+  return NULL;
+}
+
+// --------
+
+// wuffs_base__pixel_swizzler__dst_pixfmt_is_allowed returns whether dst_pixfmt
+// is allowed by the WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST build
+// configuration. If that macro is defined, only the destination pixel formats
+// whose WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_ETC macro is also defined are
+// allowed. For example, a program that only ever decodes to BGRA_PREMUL can
+// define WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST and
+// WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_PREMUL, and the compiler can then
+// discard the swizzlers for every other destination.
+static inline bool  //
+wuffs_base__pixel_swizzler__dst_pixfmt_is_allowed(
+    wuffs_base__pixel_format dst_pixfmt) {
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST)
+  switch (dst_pixfmt.repr) {
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_INDEXED__BGRA_NONPREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_INDEXED__BGRA_PREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_INDEXED__BGRA_BINARY)
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGR_565)
+    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGR)
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_NONPREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_PREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_BINARY)
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRX)
+    case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGB)
+    case WUFFS_BASE__PIXEL_FORMAT__RGB:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBA_NONPREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBA_PREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBA_BINARY)
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBX)
+    case WUFFS_BASE__PIXEL_FORMAT__RGBX:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_PREMUL_4X16LE)
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBA_PREMUL_4X16LE)
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+#endif
+      return true;
+  }
+  return false;
+#else
+  return true;
+#endif
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_swizzler__prepare(wuffs_base__pixel_swizzler* p,
+                                    wuffs_base__pixel_format dst_format,
+                                    wuffs_base__slice_u8 dst_palette,
+                                    wuffs_base__pixel_format src_format,
+                                    wuffs_base__slice_u8 src_palette,
+                                    wuffs_base__pixel_blend blend) {
+  if (!p) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+
+  // TODO: support many more formats.
+
+  wuffs_base__pixel_swizzler__func func = NULL;
+  wuffs_base__pixel_swizzler__planar_func planar_func = NULL;
+
+  if (!wuffs_base__pixel_swizzler__dst_pixfmt_is_allowed(dst_format)) {
+    p->private_impl.func = NULL;
+    p->private_impl.planar_func = NULL;
+    p->private_impl.quantize_func = NULL;
+    p->private_impl.lookup = NULL;
+    return wuffs_base__make_status(
+        wuffs_base__error__disabled_by_wuffs_config_dst_pixel_format_enable_allowlist);
+  }
+
+  switch (src_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__Y:
+      func = wuffs_base__pixel_swizzler__prepare__y(p, dst_format, dst_palette,
+                                                    src_palette, blend);
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:
+      func = wuffs_base__pixel_swizzler__prepare__indexed__bgra_binary(
+          p, dst_format, dst_palette, src_palette, blend);
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      func = wuffs_base__pixel_swizzler__prepare__bgr(
+          p, dst_format, dst_palette, src_palette, blend);
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+      func = wuffs_base__pixel_swizzler__prepare__bgra_nonpremul(
+          p, dst_format, dst_palette, src_palette, blend);
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+      func = wuffs_base__pixel_swizzler__prepare__bgra_premul(
+          p, dst_format, dst_palette, src_palette, blend);
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__YCBCR:
+      planar_func = wuffs_base__pixel_swizzler__prepare__ycc(
+          p, dst_format, dst_palette, src_palette, blend);
+      break;
+  }
+
+  p->private_impl.func = func;
+  p->private_impl.planar_func = planar_func;
+  p->private_impl.quantize_func = NULL;
+  p->private_impl.lookup = NULL;
+  if (func || planar_func) {
+    return wuffs_base__make_status(NULL);
+  }
+  return wuffs_base__make_status(
+      wuffs_base__error__unsupported_pixel_swizzler_option);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_swizzler__prepare_quantizing(
+    wuffs_base__pixel_swizzler* p,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__pixel_format dst_format,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__pixel_format src_format,
+    wuffs_base__pixel_blend blend) {
+  if (!p) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  p->private_impl.func = NULL;
+  p->private_impl.planar_func = NULL;
+  p->private_impl.quantize_func = NULL;
+  p->private_impl.lookup = NULL;
+  if (!lookup) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  } else if (!wuffs_base__pixel_swizzler__dst_pixfmt_is_allowed(dst_format)) {
+    return wuffs_base__make_status(
+        wuffs_base__error__disabled_by_wuffs_config_dst_pixel_format_enable_allowlist);
+  }
+
+  // Compositing onto palette indexes would need blending the existing dst
+  // color, so only SRC is supported unless the source is opaque, when
+  // SRC_OVER is equivalent to SRC.
+  wuffs_base__pixel_swizzler__quantize_func quantize_func = NULL;
+  bool opaque = true;
+  switch (src_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__Y:
+      quantize_func = wuffs_base__pixel_swizzler__index__y;
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      quantize_func = wuffs_base__pixel_swizzler__index__bgr;
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+      quantize_func = wuffs_base__pixel_swizzler__index__bgra_nonpremul;
+      opaque = false;
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
+      quantize_func = wuffs_base__pixel_swizzler__index__bgra_premul;
+      opaque = false;
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+      quantize_func = wuffs_base__pixel_swizzler__index__bgrx;
+      break;
+  }
+  if (!quantize_func ||
+      ((blend != WUFFS_BASE__PIXEL_BLEND__SRC) &&
+       ((blend != WUFFS_BASE__PIXEL_BLEND__SRC_OVER) || !opaque))) {
+    return wuffs_base__make_status(
+        wuffs_base__error__unsupported_pixel_swizzler_option);
+  }
+
+  wuffs_base__status status = wuffs_base__pixel_palette_lookup__prepare(
+      lookup, dst_palette, dst_format);
+  if (status.repr) {
+    return wuffs_base__make_status(
+        wuffs_base__error__unsupported_pixel_swizzler_option);
+  }
+  p->private_impl.quantize_func = quantize_func;
+  p->private_impl.lookup = lookup;
+  return wuffs_base__make_status(NULL);
+}
+
+WUFFS_BASE__MAYBE_STATIC uint64_t  //
+wuffs_base__pixel_swizzler__swizzle_interleaved(
+    const wuffs_base__pixel_swizzler* p,
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  if (p) {
+    if (p->private_impl.func) {
+      return (*p->private_impl.func)(dst, dst_palette, src);
+    } else if (p->private_impl.quantize_func) {
+      return (*p->private_impl.quantize_func)(dst, p->private_impl.lookup, src);
+    }
+  }
+  return 0;
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_swizzler__swizzle_planar(
+    const wuffs_base__pixel_swizzler* p,
+    wuffs_base__pixel_buffer* dst,
+    const wuffs_base__pixel_buffer* src) {
+  if (!p) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  } else if (!p->private_impl.planar_func) {
+    return wuffs_base__make_status(
+        wuffs_base__error__unsupported_pixel_swizzler_option);
+  } else if (!dst || !src ||
+             (wuffs_base__pixel_format__num_planes(
+                  &src->pixcfg.private_impl.pixfmt) < 3)) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+
+  uint32_t dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(
+      &dst->pixcfg.private_impl.pixfmt);
+  if ((dst_bits_per_pixel == 0) || ((dst_bits_per_pixel % 8) != 0)) {
+    return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+  }
+  size_t dst_bytes_per_pixel = dst_bits_per_pixel / 8;
+
+  uint32_t width = wuffs_base__u32__min(dst->pixcfg.private_impl.width,
+                                        src->pixcfg.private_impl.width);
+  uint32_t height = wuffs_base__u32__min(dst->pixcfg.private_impl.height,
+                                         src->pixcfg.private_impl.height);
+  const wuffs_base__pixel_subsampling* pixsub =
+      &src->pixcfg.private_impl.pixsub;
+  const wuffs_base__table_u8* src_tabs = &src->private_impl.planes[0];
+  const wuffs_base__table_u8* dst_tab = &dst->private_impl.planes[0];
+  uint32_t q;
+  for (q = 0; q < 3; q++) {
+    if ((width > 0) && (height > 0) &&
+        ((src_tabs[q].width == 0) || (src_tabs[q].height == 0))) {
+      return wuffs_base__make_status(wuffs_base__error__bad_argument);
+    }
+  }
+
+  // Samples that don't map one-to-one onto pixels (e.g. 4:2:2 or 4:2:0
+  // chroma) are replicated, one chunk at a time, into upsampled.
+  uint8_t upsampled[3][256];
+
+  uint32_t y;
+  for (y = 0; y < height; y++) {
+    const uint8_t* src_rows[3];
+    for (q = 0; q < 3; q++) {
+      size_t j = (y + wuffs_base__pixel_subsampling__bias_y(pixsub, q)) /
+                 wuffs_base__pixel_subsampling__denominator_y(pixsub, q);
+      if (j >= src_tabs[q].height) {
+        j = src_tabs[q].height - 1;
+      }
+      src_rows[q] = src_tabs[q].ptr + (j * src_tabs[q].stride);
+    }
+    uint8_t* dst_row = dst_tab->ptr + (((size_t)y) * dst_tab->stride);
+
+    uint32_t x = 0;
+    while (x < width) {
+      size_t n = wuffs_base__u32__min(width - x, 256);
+      wuffs_base__slice_u8 srcs[3];
+      for (q = 0; q < 3; q++) {
+        uint32_t bx = wuffs_base__pixel_subsampling__bias_x(pixsub, q);
+        uint32_t dx = wuffs_base__pixel_subsampling__denominator_x(pixsub, q);
+        size_t w = src_tabs[q].width;
+        if ((bx == 0) && (dx == 1)) {
+          srcs[q] = wuffs_base__make_slice_u8(
+              (uint8_t*)(src_rows[q] + x),
+              (x < w) ? wuffs_base__u64__min(n, w - x) : 0);
+          continue;
+        }
+        // Step i and its remainder r incrementally, instead of dividing
+        // (x + k + bx) by dx for every k.
+        size_t i = (x + bx) / dx;
+        uint32_t r = (x + bx) % dx;
+        size_t k;
+        for (k = 0; k < n; k++) {
+          upsampled[q][k] = src_rows[q][(i < w) ? i : (w - 1)];
+          if (++r == dx) {
+            r = 0;
+            i++;
+          }
+        }
+        srcs[q] = wuffs_base__make_slice_u8(&upsampled[q][0], n);
+      }
+
+      size_t dst_i = ((size_t)x) * dst_bytes_per_pixel;
+      if (dst_i >= dst_tab->width) {
+        break;
+      }
+      uint64_t m = (*p->private_impl.planar_func)(
+          wuffs_base__make_slice_u8(dst_row + dst_i, dst_tab->width - dst_i),
+          srcs[0], srcs[1], srcs[2]);
+      if (m < n) {
+        break;
+      }
+      x += (uint32_t)n;
+    }
+  }
+  return wuffs_base__make_status(NULL);
+}
+
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) ||
+        // defined(WUFFS_CONFIG__MODULE__BASE) ||
+        // defined(WUFFS_CONFIG__MODULE__BASE__PIXCONV)
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \
+    defined(WUFFS_CONFIG__MODULE__BASE__TAPE)
+
+// ---------------- Token Tapes
+
+// The chain_state of an in-progress STRING node is one of:
+//  - NONE_COPIED: only dropped bytes (e.g. an opening quote) so far.
+//  - COPYING: the converted string is a contiguous run of source bytes.
+//  - COPIED: as COPYING, but followed by dropped bytes (e.g. a closing quote).
+//  - CONVERTED: the converted string is in the arena.
+#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED 0
+#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING 1
+#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPIED 2
+#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED 3
+
+WUFFS_BASE__MAYBE_STATIC void  //
+wuffs_base__tape_builder__initialize(wuffs_base__tape_builder* b,
+                                     wuffs_base__slice_u8 src) {
+  if (!b) {
+    return;
+  }
+  memset(&b->private_impl, 0, sizeof(b->private_impl));
+  b->private_impl.src = src;
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__set_nodes(wuffs_base__tape_builder* b,
+                                    wuffs_base__slice_tape_node nodes) {
+  if (!b) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  } else if (nodes.len < b->private_impl.nodes_wi) {
+    return wuffs_base__make_status(
+        wuffs_base__error__bad_argument_length_too_short);
+  }
+  // Every node's skip (and every open container's parent link) fits in a
+  // uint32_t.
+  if (((uint64_t)(nodes.len)) > 0xFFFFFFFF) {
+    nodes.len = (size_t)(0xFFFFFFFF);
+  }
+  if ((nodes.ptr != b->private_impl.nodes.ptr) &&
+      (b->private_impl.nodes_wi > 0)) {
+    memmove(nodes.ptr, b->private_impl.nodes.ptr,
+            b->private_impl.nodes_wi * sizeof(wuffs_base__tape_node));
+  }
+  b->private_impl.nodes = nodes;
+  return wuffs_base__make_status(NULL);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__set_arena(wuffs_base__tape_builder* b,
+                                    wuffs_base__slice_u8 arena) {
+  if (!b) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  size_t n = 0;
+  if (b->private_impl.chain_state ==
+      WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED) {
+    n = b->private_impl.arena_wi - b->private_impl.chain_arena_begin;
+    if (arena.len < n) {
+      return wuffs_base__make_status(
+          wuffs_base__error__bad_argument_length_too_short);
+    } else if (n > 0) {
+      memmove(arena.ptr,
+              b->private_impl.arena.ptr + b->private_impl.chain_arena_begin, n);
+    }
+  }
+  b->private_impl.arena = arena;
+  b->private_impl.arena_wi = n;
+  b->private_impl.chain_arena_begin = 0;
+  return wuffs_base__make_status(NULL);
+}
+
+// wuffs_base__tape_builder__private_convert ensures that the in-progress
+// STRING node is in the CONVERTED state, with room for n more arena bytes.
+static const char*  //
+wuffs_base__tape_builder__private_convert(wuffs_base__tape_builder* b,
+                                          size_t n) {
+  size_t available = b->private_impl.arena.len - b->private_impl.arena_wi;
+  if (b->private_impl.chain_state ==
+      WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED) {
+    return (available >= n) ? NULL
+                            : wuffs_base__error__bad_argument_length_too_short;
+  }
+  size_t m = b->private_impl.chain_copy_end - b->private_impl.chain_copy_begin;
+  if ((available < m) || ((available - m) < n)) {
+    return wuffs_base__error__bad_argument_length_too_short;
+  } else if (m > 0) {
+    memcpy(b->private_impl.arena.ptr + b->private_impl.arena_wi,
+           b->private_impl.src.ptr + b->private_impl.chain_copy_begin, m);
+  }
+  b->private_impl.chain_arena_begin = b->private_impl.arena_wi;
+  b->private_impl.arena_wi += m;
+  b->private_impl.chain_state =
+      WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED;
+  return NULL;
+}
+
+// wuffs_base__tape_builder__private_append_string appends a STRING or
+// UNICODE_CODE_POINT token, at src index pos, to the in-progress STRING node.
+// On error, the builder's state (other than the arena's unused bytes) is
+// unchanged.
+static const char*  //
+wuffs_base__tape_builder__private_append_string(wuffs_base__tape_builder* b,
+                                                int64_t vbc,
+                                                uint64_t vbd,
+                                                size_t pos,
+                                                size_t len) {
+  if (vbc == WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT) {
+    uint8_t u[WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL];
+    size_t n = wuffs_base__utf_8__encode(
+        wuffs_base__make_slice_u8(&u[0],
+                                  WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL),
+        (uint32_t)(vbd));
+    if (n == 0) {
+      return wuffs_base__error__bad_argument;
+    }
+    const char* z = wuffs_base__tape_builder__private_convert(b, n);
+    if (z) {
+      return z;
+    }
+    memcpy(b->private_impl.arena.ptr + b->private_impl.arena_wi, &u[0], n);
+    b->private_impl.arena_wi += n;
+    return NULL;
+
+  } else if (len == 0) {
+    return NULL;
+
+  } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY) {
+    switch (b->private_impl.chain_state) {
+      case WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED:
+        b->private_impl.chain_copy_begin = pos;
+        b->private_impl.chain_copy_end = pos + len;
+        b->private_impl.chain_state =
+            WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING;
+        return NULL;
+      case WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING:
+        b->private_impl.chain_copy_end = pos + len;
+        return NULL;
+    }
+    const char* z = wuffs_base__tape_builder__private_convert(b, len);
+    if (z) {
+      return z;
+    }
+    memcpy(b->private_impl.arena.ptr + b->private_impl.arena_wi,
+           b->private_impl.src.ptr + pos, len);
+    b->private_impl.arena_wi += len;
+    return NULL;
+
+  } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_0_DST_1_SRC_DROP) {
+    switch (b->private_impl.chain_state) {
+      case WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED:
+        b->private_impl.chain_copy_begin = pos + len;
+        b->private_impl.chain_copy_end = pos + len;
+        break;
+      case WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING:
+        b->private_impl.chain_state =
+            WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPIED;
+        break;
+    }
+    return NULL;
+
+  } else if (vbd &
+             WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_4_SRC_BACKSLASH_X) {
+    if (len & 3) {
+      return wuffs_base__error__bad_argument;
+    }
+    const char* z = wuffs_base__tape_builder__private_convert(b, len / 4);
+    if (z) {
+      return z;
+    }
+    b->private_impl.arena_wi += wuffs_base__hexadecimal__decode4(
+        wuffs_base__make_slice_u8(
+            b->private_impl.arena.ptr + b->private_impl.arena_wi, len / 4),
+        wuffs_base__make_slice_u8(b->private_impl.src.ptr + pos, len));
+    return NULL;
+  }
+
+  return wuffs_base__error__unsupported_option;
+}
+
+// wuffs_base__tape_builder__private_end_chain completes the in-progress
+// chain's node, whose last token ends at src index end.
+static void  //
+wuffs_base__tape_builder__private_end_chain(wuffs_base__tape_builder* b,
+                                            size_t end) {
+  wuffs_base__tape_node* node =
+      &b->private_impl.nodes.ptr[b->private_impl.chain - 1];
+  if (wuffs_base__tape_node__kind(node) !=
+      WUFFS_BASE__TAPE_NODE__KIND__STRING) {
+    node->data.len = end - ((size_t)(node->data.ptr - b->private_impl.src.ptr));
+  } else if (b->private_impl.chain_state ==
+             WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED) {
+    node->data = wuffs_base__make_slice_u8(
+        b->private_impl.arena.ptr + b->private_impl.chain_arena_begin,
+        b->private_impl.arena_wi - b->private_impl.chain_arena_begin);
+    node->repr |= WUFFS_BASE__TAPE_NODE__FLAG__CONVERTED;
+  } else {
+    node->data = wuffs_base__make_slice_u8(
+        b->private_impl.src.ptr + b->private_impl.chain_copy_begin,
+        b->private_impl.chain_copy_end - b->private_impl.chain_copy_begin);
+  }
+  b->private_impl.chain = 0;
+  b->private_impl.chain_state =
+      WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED;
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__append_tokens(wuffs_base__tape_builder* b,
+                                        wuffs_base__token_buffer* tok) {
+  if (!b) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  } else if (!tok) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+
+  for (; tok->meta.ri < tok->meta.wi; tok->meta.ri++) {
+    wuffs_base__token t = tok->data.ptr[tok->meta.ri];
+    size_t pos = b->private_impl.src_ri;
+    size_t len = (size_t)(wuffs_base__token__length(&t));
+    if (len > (b->private_impl.src.len - pos)) {
+      return wuffs_base__make_status(wuffs_base__error__bad_argument);
+    } else if (wuffs_base__token__value_major(&t) != 0) {
+      return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+    }
+    int64_t vbc = wuffs_base__token__value_base_category(&t);
+    uint64_t vbd = wuffs_base__token__value_base_detail(&t);
+
+    // Continue the in-progress chain, if there is one.
+    if (b->private_impl.chain) {
+      wuffs_base__tape_node* node =
+          &b->private_impl.nodes.ptr[b->private_impl.chain - 1];
+      if (wuffs_base__tape_node__kind(node) ==
+          WUFFS_BASE__TAPE_NODE__KIND__STRING) {
+        if ((vbc != WUFFS_BASE__TOKEN__VBC__STRING) &&
+            (vbc != WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT)) {
+          return wuffs_base__make_status(wuffs_base__error__bad_argument);
+        }
+        const char* z = wuffs_base__tape_builder__private_append_string(
+            b, vbc, vbd, pos, len);
+        if (z) {
+          return wuffs_base__make_status(z);
+        }
+      } else {
+        int64_t want_vbc = (wuffs_base__tape_node__kind(node) ==
+                            WUFFS_BASE__TAPE_NODE__KIND__LITERAL)
+                               ? WUFFS_BASE__TOKEN__VBC__LITERAL
+                               : WUFFS_BASE__TOKEN__VBC__NUMBER;
+        if (vbc != want_vbc) {
+          return wuffs_base__make_status(wuffs_base__error__bad_argument);
+        }
+      }
+      b->private_impl.src_ri = pos + len;
+      if (!wuffs_base__token__continued(&t)) {
+        wuffs_base__tape_builder__private_end_chain(b, pos + len);
+      }
+      continue;
+    }
+
+    uint32_t kind = 0;
+    switch (vbc) {
+      case WUFFS_BASE__TOKEN__VBC__FILLER:
+        b->private_impl.src_ri = pos + len;
+        continue;
+
+      case WUFFS_BASE__TOKEN__VBC__STRUCTURE:
+        if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__POP) {
+          if (b->private_impl.open == 0) {
+            return wuffs_base__make_status(wuffs_base__error__bad_argument);
+          }
+          size_t i = b->private_impl.open - 1;
+          wuffs_base__tape_node* node = &b->private_impl.nodes.ptr[i];
+          b->private_impl.open = node->skip;
+          node->skip = (uint32_t)(b->private_impl.nodes_wi - i);
+          node->data.len =
+              pos + len - ((size_t)(node->data.ptr - b->private_impl.src.ptr));
+          b->private_impl.src_ri = pos + len;
+          continue;
+        } else if (!(vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__PUSH)) {
+          return wuffs_base__make_status(wuffs_base__error__bad_argument);
+        } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_LIST) {
+          kind = WUFFS_BASE__TAPE_NODE__KIND__LIST;
+        } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_DICT) {
+          kind = WUFFS_BASE__TAPE_NODE__KIND__DICT;
+        } else {
+          return wuffs_base__make_status(wuffs_base__error__bad_argument);
+        }
+        break;
+
+      case WUFFS_BASE__TOKEN__VBC__STRING:
+      case WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT:
+        kind = WUFFS_BASE__TAPE_NODE__KIND__STRING;
+        break;
+      case WUFFS_BASE__TOKEN__VBC__LITERAL:
+        kind = WUFFS_BASE__TAPE_NODE__KIND__LITERAL;
+        break;
+      case WUFFS_BASE__TOKEN__VBC__NUMBER:
+        kind = WUFFS_BASE__TAPE_NODE__KIND__NUMBER;
+        break;
+
+      default:
+        return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+    }
+
+    // Start a new node.
+    if (b->private_impl.nodes_wi >= b->private_impl.nodes.len) {
+      return wuffs_base__make_status(
+          wuffs_base__error__bad_argument_length_too_short);
+    }
+    size_t i = b->private_impl.nodes_wi;
+    wuffs_base__tape_node* node = &b->private_impl.nodes.ptr[i];
+    node->data = wuffs_base__make_slice_u8(b->private_impl.src.ptr + pos, len);
+    node->repr = (kind << WUFFS_BASE__TAPE_NODE__KIND__SHIFT) |
+                 ((uint32_t)(vbd & 0x1FFFFF));
+    node->skip = 1;
+
+    if (kind == WUFFS_BASE__TAPE_NODE__KIND__STRING) {
+      b->private_impl.chain_copy_begin = pos;
+      b->private_impl.chain_copy_end = pos;
+      b->private_impl.chain_state =
+          WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED;
+      const char* z = wuffs_base__tape_builder__private_append_string(
+          b, vbc, vbd, pos, len);
+      if (z) {
+        return wuffs_base__make_status(z);
+      }
+    } else if ((kind == WUFFS_BASE__TAPE_NODE__KIND__LIST) ||
+               (kind == WUFFS_BASE__TAPE_NODE__KIND__DICT)) {
+      // Until it is popped, an open container's skip field links to its
+      // parent.
+      node->skip = (uint32_t)(b->private_impl.open);
+      b->private_impl.open = i + 1;
+    }
+
+    b->private_impl.nodes_wi = i + 1;
+    b->private_impl.src_ri = pos + len;
+    if ((kind != WUFFS_BASE__TAPE_NODE__KIND__LIST) &&
+        (kind != WUFFS_BASE__TAPE_NODE__KIND__DICT)) {
+      b->private_impl.chain = i + 1;
+      if (!wuffs_base__token__continued(&t)) {
+        wuffs_base__tape_builder__private_end_chain(b, pos + len);
+      }
+    }
+  }
+  return wuffs_base__make_status(NULL);
+}
+
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) ||
+        // defined(WUFFS_CONFIG__MODULE__BASE) ||
+        // defined(WUFFS_CONFIG__MODULE__BASE__TAPE)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__BASE
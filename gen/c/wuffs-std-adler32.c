@@ -0,0 +1,406 @@
+#ifndef WUFFS_INCLUDE_GUARD__ADLER32
+#define WUFFS_INCLUDE_GUARD__ADLER32
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#endif
+
+#include "./wuffs-base.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+
+// ---------------- Public Consts
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_adler32__hasher__struct wuffs_adler32__hasher;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_adler32__hasher__initialize(wuffs_adler32__hasher *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_adler32__hasher();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_adler32__hasher*  //
+wuffs_adler32__hasher__alloc();
+
+static inline wuffs_base__hasher_u32*  //
+wuffs_adler32__hasher__alloc_as__wuffs_base__hasher_u32(){
+return (wuffs_base__hasher_u32*)(wuffs_adler32__hasher__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__hasher_u32*  //
+wuffs_adler32__hasher__upcast_as__wuffs_base__hasher_u32(wuffs_adler32__hasher* p){
+return (wuffs_base__hasher_u32*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_ADLER32__HASHER__STATS__FUNC__SET_QUIRK_ENABLED 0
+#define WUFFS_ADLER32__HASHER__STATS__FUNC__UPDATE_U32 1
+
+typedef struct wuffs_adler32__hasher__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[2];
+} wuffs_adler32__hasher__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_adler32__hasher__stats  //
+wuffs_adler32__hasher__get_stats(const wuffs_adler32__hasher* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_adler32__hasher__set_quirk_enabled(wuffs_adler32__hasher *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_adler32__hasher__update_u32(wuffs_adler32__hasher *self,wuffs_base__slice_u8 a_x);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_adler32__hasher__combine_u32(const wuffs_adler32__hasher *self,uint32_t a_first,uint32_t a_second,uint64_t a_second_length);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_adler32__hasher__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__hasher_u32;
+wuffs_base__vtable null_vtable;
+
+uint32_t f_state;
+bool f_started;
+bool f_cpu_arch_checked;
+bool f_have_x86_sse42;
+
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_adler32__hasher__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_adler32__hasher, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_adler32__hasher__alloc(), &free);
+}
+
+static inline wuffs_base__hasher_u32::unique_ptr  //
+alloc_as__wuffs_base__hasher_u32(){
+return wuffs_base__hasher_u32::unique_ptr(wuffs_adler32__hasher__alloc_as__wuffs_base__hasher_u32(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_adler32__hasher__struct() = delete;
+wuffs_adler32__hasher__struct(const wuffs_adler32__hasher__struct&) = delete;
+wuffs_adler32__hasher__struct& operator=(const wuffs_adler32__hasher__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_adler32__hasher__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__hasher_u32*  //
+upcast_as__wuffs_base__hasher_u32(){
+return (wuffs_base__hasher_u32*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_adler32__hasher__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline uint32_t//
+update_u32(wuffs_base__slice_u8 a_x){ return wuffs_adler32__hasher__update_u32(this,a_x);}
+
+inline uint32_t//
+combine_u32(uint32_t a_first,uint32_t a_second,uint64_t a_second_length) const { return wuffs_adler32__hasher__combine_u32(this,a_first,a_second,a_second_length);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_adler32__hasher__stats  //
+get_stats() const {
+return wuffs_adler32__hasher__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_adler32__hasher__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__ADLER32)
+
+// ---------------- Status Codes Implementations
+
+
+// ---------------- Private Consts
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+// ---------------- VTables
+
+const wuffs_base__hasher_u32__func_ptrs wuffs_adler32__hasher__func_ptrs_for__wuffs_base__hasher_u32 = {(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_adler32__hasher__set_quirk_enabled),
+(uint32_t(*)(void*,wuffs_base__slice_u8))(&wuffs_adler32__hasher__update_u32),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_adler32__hasher__initialize(wuffs_adler32__hasher *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__hasher_u32.vtable_name = wuffs_base__hasher_u32__vtable_name;
+self->private_impl.vtable_for__wuffs_base__hasher_u32.function_pointers = (const void*)(&wuffs_adler32__hasher__func_ptrs_for__wuffs_base__hasher_u32);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_adler32__hasher*  //
+wuffs_adler32__hasher__alloc(){
+wuffs_adler32__hasher* x = (wuffs_adler32__hasher*)(calloc(sizeof(wuffs_adler32__hasher), 1));
+if (!x) { return NULL; }
+if (wuffs_adler32__hasher__initialize(x, sizeof(wuffs_adler32__hasher), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_adler32__hasher(){ return sizeof(wuffs_adler32__hasher); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_adler32__hasher__stats  //
+wuffs_adler32__hasher__get_stats(const wuffs_adler32__hasher* self) {
+wuffs_adler32__hasher__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func adler32.hasher.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_adler32__hasher__set_quirk_enabled(wuffs_adler32__hasher *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func adler32.hasher.update_u32
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_adler32__hasher__update_u32(wuffs_adler32__hasher *self,wuffs_base__slice_u8 a_x){
+if (!self) { return 0;}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return 0;}
+WUFFS_BASE__STATS__CALL(self, 1);
+
+uint32_t v_s1 = 0;
+uint32_t v_s2 = 0;
+wuffs_base__slice_u8 v_remaining = {0};
+wuffs_base__slice_u8 v_p = {0};
+
+if ( ! self->private_impl.f_started) {
+self->private_impl.f_started = true;
+self->private_impl.f_state = 1;
+}
+if ( ! self->private_impl.f_cpu_arch_checked) {
+self->private_impl.f_cpu_arch_checked = true;
+self->private_impl.f_have_x86_sse42 = wuffs_base__utility__cpu_arch_have_x86_sse42();
+}
+if (self->private_impl.f_have_x86_sse42 && (((uint64_t)(a_x.len)) >= 64)) {
+self->private_impl.f_state = wuffs_base__utility__adler32_x86_sse42(self->private_impl.f_state,a_x);
+a_x = wuffs_base__slice_u8__suffix(a_x,(((uint64_t)(a_x.len)) & 31));
+}
+v_s1 = ((self->private_impl.f_state) & 0xFFFF);
+v_s2 = ((self->private_impl.f_state) >> (32 - (16)));
+while (((uint64_t)(a_x.len)) > 0) {
+v_remaining = wuffs_base__slice_u8__subslice_j(a_x,0);
+if (((uint64_t)(a_x.len)) > 5552) {
+v_remaining = wuffs_base__slice_u8__subslice_i(a_x,5552);
+a_x = wuffs_base__slice_u8__subslice_j(a_x,5552);
+}
+{
+wuffs_base__slice_u8 i_slice_p =a_x;
+v_p = i_slice_p;
+v_p.len = 1;
+uint8_t* i_end0_p = i_slice_p.ptr + (i_slice_p.len / 8) * 8;
+while (v_p.ptr < i_end0_p) {
+v_s1 += ((uint32_t)(v_p.ptr[0]));
+v_s2 += v_s1;
+v_p.ptr += 1;
+v_s1 += ((uint32_t)(v_p.ptr[0]));
+v_s2 += v_s1;
+v_p.ptr += 1;
+v_s1 += ((uint32_t)(v_p.ptr[0]));
+v_s2 += v_s1;
+v_p.ptr += 1;
+v_s1 += ((uint32_t)(v_p.ptr[0]));
+v_s2 += v_s1;
+v_p.ptr += 1;
+v_s1 += ((uint32_t)(v_p.ptr[0]));
+v_s2 += v_s1;
+v_p.ptr += 1;
+v_s1 += ((uint32_t)(v_p.ptr[0]));
+v_s2 += v_s1;
+v_p.ptr += 1;
+v_s1 += ((uint32_t)(v_p.ptr[0]));
+v_s2 += v_s1;
+v_p.ptr += 1;
+v_s1 += ((uint32_t)(v_p.ptr[0]));
+v_s2 += v_s1;
+v_p.ptr += 1;
+}
+v_p.len = 1;
+uint8_t* i_end1_p = i_slice_p.ptr + (i_slice_p.len / 1) * 1;
+while (v_p.ptr < i_end1_p) {
+v_s1 += ((uint32_t)(v_p.ptr[0]));
+v_s2 += v_s1;
+v_p.ptr += 1;
+}
+}
+v_s1 %= 65521;
+v_s2 %= 65521;
+a_x = v_remaining;
+}
+self->private_impl.f_state = (((v_s2 & 65535) << 16) | (v_s1 & 65535));
+return self->private_impl.f_state;}
+
+// -------- func adler32.hasher.combine_u32
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_adler32__hasher__combine_u32(const wuffs_adler32__hasher *self,uint32_t a_first,uint32_t a_second,uint64_t a_second_length){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+uint32_t v_n = 0;
+uint32_t v_s1 = 0;
+uint32_t v_s2 = 0;
+
+v_n = ((uint32_t)((a_second_length % 65521)));
+v_s1 = ((a_first) & 0xFFFF);
+v_s2 = ((v_n * v_s1) % 65521);
+v_s1 = ((v_s1 + ((a_second) & 0xFFFF) + 65520) % 65521);
+v_s2 = (((v_s2 + ((a_first) >> (32 - (16))) + ((a_second) >> (32 - (16))) + 65521) - v_n) % 65521);
+return ((v_s2 << 16) | v_s1);}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__ADLER32)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__ADLER32
+
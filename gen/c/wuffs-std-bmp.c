@@ -0,0 +1,1893 @@
+#ifndef WUFFS_INCLUDE_GUARD__BMP
+#define WUFFS_INCLUDE_GUARD__BMP
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__BMP
+#endif
+
+#include "./wuffs-base.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+extern const char* wuffs_bmp__error__bad_header;
+extern const char* wuffs_bmp__error__unsupported_bmp_file;
+
+// ---------------- Public Consts
+
+#define WUFFS_BMP__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 0
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_bmp__decoder__struct wuffs_bmp__decoder;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_bmp__decoder__initialize(wuffs_bmp__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_bmp__decoder();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_bmp__decoder*  //
+wuffs_bmp__decoder__alloc();
+
+static inline wuffs_base__image_decoder*  //
+wuffs_bmp__decoder__alloc_as__wuffs_base__image_decoder(){
+return (wuffs_base__image_decoder*)(wuffs_bmp__decoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__image_decoder*  //
+wuffs_bmp__decoder__upcast_as__wuffs_base__image_decoder(wuffs_bmp__decoder* p){
+return (wuffs_base__image_decoder*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_BMP__DECODER__STATS__FUNC__SET_QUIRK_ENABLED 0
+#define WUFFS_BMP__DECODER__STATS__FUNC__DECODE_IMAGE_CONFIG 1
+#define WUFFS_BMP__DECODER__STATS__FUNC__DECODE_FRAME_CONFIG 2
+#define WUFFS_BMP__DECODER__STATS__FUNC__DECODE_FRAME 3
+#define WUFFS_BMP__DECODER__STATS__FUNC__NEXT_BAND 4
+#define WUFFS_BMP__DECODER__STATS__FUNC__SWIZZLE 5
+#define WUFFS_BMP__DECODER__STATS__FUNC__SWIZZLE_SPARSE 6
+#define WUFFS_BMP__DECODER__STATS__FUNC__DECODE_RLE 7
+#define WUFFS_BMP__DECODER__STATS__FUNC__DECODE_BITFIELDS 8
+#define WUFFS_BMP__DECODER__STATS__FUNC__PROCESS_MASKS 9
+#define WUFFS_BMP__DECODER__STATS__FUNC__SWIZZLE_RUN 10
+#define WUFFS_BMP__DECODER__STATS__FUNC__SKIP_FRAME 11
+#define WUFFS_BMP__DECODER__STATS__FUNC__RESTART_FRAME 12
+#define WUFFS_BMP__DECODER__STATS__FUNC__SET_REPORT_METADATA 13
+#define WUFFS_BMP__DECODER__STATS__FUNC__TELL_ME_MORE 14
+
+typedef struct wuffs_bmp__decoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[15];
+} wuffs_bmp__decoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_bmp__decoder__stats  //
+wuffs_bmp__decoder__get_stats(const wuffs_bmp__decoder* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_bmp__decoder__set_quirk_enabled(wuffs_bmp__decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_bmp__decoder__decode_image_config(wuffs_bmp__decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_bmp__decoder__decode_frame_config(wuffs_bmp__decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_bmp__decoder__decode_frame(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_bmp__decoder__frame_dirty_rect(const wuffs_bmp__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_bmp__decoder__num_animation_loops(const wuffs_bmp__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_bmp__decoder__num_decoded_frame_configs(const wuffs_bmp__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_bmp__decoder__num_decoded_frames(const wuffs_bmp__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_bmp__decoder__restart_frame(wuffs_bmp__decoder *self,uint64_t a_index,uint64_t a_io_position);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_bmp__decoder__set_report_metadata(wuffs_bmp__decoder *self,uint32_t a_fourcc,bool a_report);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_bmp__decoder__tell_me_more(wuffs_bmp__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_bmp__decoder__workbuf_len(const wuffs_bmp__decoder *self);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_bmp__decoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__image_decoder;
+wuffs_base__vtable null_vtable;
+
+uint32_t f_width;
+uint32_t f_height;
+uint8_t f_call_sequence;
+bool f_top_down;
+uint8_t f_bits_per_pixel;
+uint32_t f_pad_per_row;
+uint64_t f_bytes_per_row;
+uint64_t f_bytes_total;
+wuffs_base__pixel_format f_pixfmt;
+uint32_t f_compression;
+uint32_t f_io_redirect_fourcc;
+uint64_t f_io_redirect_pos;
+uint32_t f_padding;
+uint32_t f_mask_r;
+uint32_t f_mask_g;
+uint32_t f_mask_b;
+uint32_t f_mask_a;
+uint32_t f_channel_shifts[4];
+uint32_t f_channel_widths[4];
+uint64_t f_frame_config_io_position;
+uint32_t f_dst_x;
+uint32_t f_dst_y;
+uint32_t f_dst_y_end;
+uint32_t f_dst_y_inc;
+uint8_t f_stash[4];
+uint8_t f_num_stashed;
+uint8_t f_pending_pad;
+uint32_t f_scale_shift;
+uint32_t f_crop_x0;
+uint32_t f_crop_y0;
+uint32_t f_crop_x1;
+uint32_t f_crop_y1;
+uint64_t f_pending_skip;
+uint32_t f_band_height;
+uint32_t f_band_y0;
+uint32_t f_band_y1;
+uint32_t f_dst_rect_y1;
+wuffs_base__pixel_swizzler f_swizzler;
+
+uint32_t p_decode_image_config[1];
+uint32_t p_decode_frame_config[1];
+uint32_t p_decode_frame[1];
+uint32_t p_decode_rle[1];
+uint32_t p_decode_bitfields[1];
+uint32_t p_skip_frame[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_bmp__decoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+uint8_t f_src_palette[1024];
+uint8_t f_dst_palette[1024];
+uint8_t f_scratch[2048];
+
+struct {
+uint32_t v_bitmap_info_len;
+uint32_t v_bits_per_pixel;
+uint32_t v_compression;
+uint32_t v_image_size;
+uint32_t v_num_colors;
+uint32_t v_i;
+uint64_t scratch;
+} s_decode_image_config[1];
+struct {
+uint64_t v_bytes_remaining;
+bool v_sparse;
+uint64_t scratch;
+} s_decode_frame[1];
+struct {
+uint8_t v_code;
+uint32_t v_n;
+uint32_t v_i;
+} s_decode_rle[1];
+struct {
+uint32_t v_n;
+uint32_t v_i;
+uint64_t scratch;
+} s_decode_bitfields[1];
+struct {
+uint64_t scratch;
+} s_skip_frame[1];
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_bmp__decoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_bmp__decoder__alloc(), &free);
+}
+
+static inline wuffs_base__image_decoder::unique_ptr  //
+alloc_as__wuffs_base__image_decoder(){
+return wuffs_base__image_decoder::unique_ptr(wuffs_bmp__decoder__alloc_as__wuffs_base__image_decoder(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_bmp__decoder__struct() = delete;
+wuffs_bmp__decoder__struct(const wuffs_bmp__decoder__struct&) = delete;
+wuffs_bmp__decoder__struct& operator=(const wuffs_bmp__decoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_bmp__decoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__image_decoder*  //
+upcast_as__wuffs_base__image_decoder(){
+return (wuffs_base__image_decoder*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_bmp__decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__status //
+decode_image_config(wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_bmp__decoder__decode_image_config(this,a_dst,a_src);}
+
+inline wuffs_base__status //
+decode_frame_config(wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_bmp__decoder__decode_frame_config(this,a_dst,a_src);}
+
+inline wuffs_base__status //
+decode_frame(wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){ return wuffs_bmp__decoder__decode_frame(this,a_dst,a_src,a_blend,a_workbuf,a_opts);}
+
+inline wuffs_base__rect_ie_u32//
+frame_dirty_rect() const { return wuffs_bmp__decoder__frame_dirty_rect(this);}
+
+inline uint32_t//
+num_animation_loops() const { return wuffs_bmp__decoder__num_animation_loops(this);}
+
+inline uint64_t//
+num_decoded_frame_configs() const { return wuffs_bmp__decoder__num_decoded_frame_configs(this);}
+
+inline uint64_t//
+num_decoded_frames() const { return wuffs_bmp__decoder__num_decoded_frames(this);}
+
+inline wuffs_base__status//
+restart_frame(uint64_t a_index,uint64_t a_io_position){ return wuffs_bmp__decoder__restart_frame(this,a_index,a_io_position);}
+
+inline wuffs_base__empty_struct //
+set_report_metadata(uint32_t a_fourcc,bool a_report){ return wuffs_bmp__decoder__set_report_metadata(this,a_fourcc,a_report);}
+
+inline wuffs_base__status //
+tell_me_more(wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){ return wuffs_bmp__decoder__tell_me_more(this,a_dst,a_minfo,a_src);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_bmp__decoder__workbuf_len(this);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_bmp__decoder__stats  //
+get_stats() const {
+return wuffs_bmp__decoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_bmp__decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BMP)
+
+// ---------------- Status Codes Implementations
+
+const char* wuffs_bmp__error__bad_header = "#bmp: bad header";
+const char* wuffs_bmp__error__unsupported_bmp_file = "#bmp: unsupported BMP file";
+const char* wuffs_bmp__error__internal_error_inconsistent_swizzle_count = "#bmp: internal error: inconsistent swizzle count";
+
+// ---------------- Private Consts
+
+static const uint32_t //
+WUFFS_BMP__BITFIELDS_MULS[33]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,255,85,73,17,33,65,129,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,};
+
+static const uint32_t //
+WUFFS_BMP__BITFIELDS_SHRS[33]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,0,0,1,0,2,4,6,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,};
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static bool//
+wuffs_bmp__decoder__band_is_done(const wuffs_bmp__decoder *self);
+
+static bool//
+wuffs_bmp__decoder__bands_remain(const wuffs_bmp__decoder *self);
+
+static wuffs_base__empty_struct //
+wuffs_bmp__decoder__next_band(wuffs_bmp__decoder *self);
+
+static uint64_t//
+wuffs_bmp__decoder__row_bytes_remaining(const wuffs_bmp__decoder *self,bool a_sparse);
+
+static wuffs_base__status//
+wuffs_bmp__decoder__swizzle(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__slice_u8 a_src);
+
+static wuffs_base__status//
+wuffs_bmp__decoder__swizzle_sparse(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__slice_u8 a_src);
+
+static wuffs_base__status //
+wuffs_bmp__decoder__decode_rle(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_bmp__decoder__decode_bitfields(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__empty_struct //
+wuffs_bmp__decoder__process_masks(wuffs_bmp__decoder *self);
+
+static wuffs_base__empty_struct //
+wuffs_bmp__decoder__swizzle_run(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__slice_u8 a_src,uint64_t a_src_bytes_per_pixel);
+
+static wuffs_base__status //
+wuffs_bmp__decoder__skip_frame(wuffs_bmp__decoder *self,wuffs_base__io_buffer* a_src);
+
+// ---------------- VTables
+
+const wuffs_base__image_decoder__func_ptrs wuffs_bmp__decoder__func_ptrs_for__wuffs_base__image_decoder = {(wuffs_base__status (*)(void*,wuffs_base__pixel_buffer*,wuffs_base__io_buffer*,wuffs_base__pixel_blend,wuffs_base__slice_u8,wuffs_base__decode_frame_options*))(&wuffs_bmp__decoder__decode_frame),
+(wuffs_base__status (*)(void*,wuffs_base__frame_config*,wuffs_base__io_buffer*))(&wuffs_bmp__decoder__decode_frame_config),
+(wuffs_base__status (*)(void*,wuffs_base__image_config*,wuffs_base__io_buffer*))(&wuffs_bmp__decoder__decode_image_config),
+(wuffs_base__rect_ie_u32(*)(const void*))(&wuffs_bmp__decoder__frame_dirty_rect),
+(uint32_t(*)(const void*))(&wuffs_bmp__decoder__num_animation_loops),
+(uint64_t(*)(const void*))(&wuffs_bmp__decoder__num_decoded_frame_configs),
+(uint64_t(*)(const void*))(&wuffs_bmp__decoder__num_decoded_frames),
+(wuffs_base__status(*)(void*,uint64_t,uint64_t))(&wuffs_bmp__decoder__restart_frame),
+(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_bmp__decoder__set_quirk_enabled),
+(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_bmp__decoder__set_report_metadata),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__more_information*,wuffs_base__io_buffer*))(&wuffs_bmp__decoder__tell_me_more),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_bmp__decoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_bmp__decoder__initialize(wuffs_bmp__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__image_decoder.vtable_name = wuffs_base__image_decoder__vtable_name;
+self->private_impl.vtable_for__wuffs_base__image_decoder.function_pointers = (const void*)(&wuffs_bmp__decoder__func_ptrs_for__wuffs_base__image_decoder);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_bmp__decoder*  //
+wuffs_bmp__decoder__alloc(){
+wuffs_bmp__decoder* x = (wuffs_bmp__decoder*)(calloc(sizeof(wuffs_bmp__decoder), 1));
+if (!x) { return NULL; }
+if (wuffs_bmp__decoder__initialize(x, sizeof(wuffs_bmp__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_bmp__decoder(){ return sizeof(wuffs_bmp__decoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_bmp__decoder__stats  //
+wuffs_bmp__decoder__get_stats(const wuffs_bmp__decoder* self) {
+wuffs_bmp__decoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func bmp.decoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_bmp__decoder__set_quirk_enabled(wuffs_bmp__decoder *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func bmp.decoder.decode_image_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_bmp__decoder__decode_image_config(wuffs_bmp__decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 1);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_magic = 0;
+uint32_t v_bitmap_info_len = 0;
+uint32_t v_width = 0;
+uint32_t v_height = 0;
+uint32_t v_planes = 0;
+uint32_t v_bits_per_pixel = 0;
+uint32_t v_compression = 0;
+uint32_t v_image_size = 0;
+uint32_t v_num_colors = 0;
+uint32_t v_i = 0;
+uint32_t v_c = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_image_config[0];
+if (coro_susp_point) {
+v_bitmap_info_len = self->private_data.s_decode_image_config[0].v_bitmap_info_len;
+v_bits_per_pixel = self->private_data.s_decode_image_config[0].v_bits_per_pixel;
+v_compression = self->private_data.s_decode_image_config[0].v_compression;
+v_image_size = self->private_data.s_decode_image_config[0].v_image_size;
+v_num_colors = self->private_data.s_decode_image_config[0].v_num_colors;
+v_i = self->private_data.s_decode_image_config[0].v_i;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if ((self->private_impl.f_call_sequence != 0) || (self->private_impl.f_io_redirect_fourcc == 1)) {
+status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);goto exit;} else if (self->private_impl.f_io_redirect_fourcc != 0) {
+status = wuffs_base__make_status(wuffs_base__note__i_o_redirect);goto ok;}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+uint32_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_0 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;if (num_bits_0 == 8) { t_0 = ((uint32_t)(*scratch));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0)) << 56;}}
+v_magic = t_0;
+}
+if (v_magic != 19778) {
+status = wuffs_base__make_status(wuffs_bmp__error__bad_header);goto exit;}
+self->private_data.s_decode_image_config[0].scratch = 8;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+if (self->private_data.s_decode_image_config[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_image_config[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_image_config[0].scratch;
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_1 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;if (num_bits_1 == 24) { t_1 = ((uint32_t)(*scratch));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1)) << 56;}}
+self->private_impl.f_padding = t_1;
+}
+if (self->private_impl.f_padding < 14) {
+status = wuffs_base__make_status(wuffs_bmp__error__bad_header);goto exit;}
+self->private_impl.f_padding -= 14;
+self->private_impl.f_io_redirect_pos = wuffs_base__u64__sat_add(((uint64_t)(self->private_impl.f_padding)),wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src))));
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+uint32_t t_2;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_2 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_2 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_2;if (num_bits_2 == 24) { t_2 = ((uint32_t)(*scratch));break;}num_bits_2 += 8;*scratch |= ((uint64_t)(num_bits_2)) << 56;}}
+v_bitmap_info_len = t_2;
+}
+if ((v_bitmap_info_len != 40) && (v_bitmap_info_len != 108) && (v_bitmap_info_len != 124)) {
+status = wuffs_base__make_status(wuffs_bmp__error__unsupported_bmp_file);goto exit;}
+if (self->private_impl.f_padding < v_bitmap_info_len) {
+status = wuffs_base__make_status(wuffs_bmp__error__bad_header);goto exit;}
+self->private_impl.f_padding -= v_bitmap_info_len;
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+uint32_t t_3;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_3 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_3 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_3;if (num_bits_3 == 24) { t_3 = ((uint32_t)(*scratch));break;}num_bits_3 += 8;*scratch |= ((uint64_t)(num_bits_3)) << 56;}}
+v_width = t_3;
+}
+if (v_width >= 2147483648) {
+status = wuffs_base__make_status(wuffs_bmp__error__bad_header);goto exit;}
+self->private_impl.f_width = v_width;
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(10);
+uint32_t t_4;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_4 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(11);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_4 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_4;if (num_bits_4 == 24) { t_4 = ((uint32_t)(*scratch));break;}num_bits_4 += 8;*scratch |= ((uint64_t)(num_bits_4)) << 56;}}
+v_height = t_4;
+}
+if (v_height == 2147483648) {
+status = wuffs_base__make_status(wuffs_bmp__error__bad_header);goto exit;} else if (v_height >= 2147483648) {
+self->private_impl.f_height = ((0 - v_height) & 2147483647);
+self->private_impl.f_top_down = true;
+} else {
+self->private_impl.f_height = v_height;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(12);
+uint32_t t_5;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_5 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(13);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_5 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_5;if (num_bits_5 == 8) { t_5 = ((uint32_t)(*scratch));break;}num_bits_5 += 8;*scratch |= ((uint64_t)(num_bits_5)) << 56;}}
+v_planes = t_5;
+}
+if (v_planes != 1) {
+status = wuffs_base__make_status(wuffs_bmp__error__unsupported_bmp_file);goto exit;}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(14);
+uint32_t t_6;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_6 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(15);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_6 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_6;if (num_bits_6 == 8) { t_6 = ((uint32_t)(*scratch));break;}num_bits_6 += 8;*scratch |= ((uint64_t)(num_bits_6)) << 56;}}
+v_bits_per_pixel = t_6;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(16);
+uint32_t t_7;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_7 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(17);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_7 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_7;if (num_bits_7 == 24) { t_7 = ((uint32_t)(*scratch));break;}num_bits_7 += 8;*scratch |= ((uint64_t)(num_bits_7)) << 56;}}
+v_compression = t_7;
+}
+if (v_bits_per_pixel == 0) {
+if (v_compression == 4) {
+self->private_impl.f_io_redirect_fourcc = 1246774599;
+status = wuffs_base__make_status(wuffs_base__note__i_o_redirect);goto ok;} else if (v_compression == 5) {
+self->private_impl.f_io_redirect_fourcc = 1347307296;
+status = wuffs_base__make_status(wuffs_base__note__i_o_redirect);goto ok;}
+status = wuffs_base__make_status(wuffs_bmp__error__unsupported_bmp_file);goto exit;}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(18);
+uint32_t t_8;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_8 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(19);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_8 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_8;if (num_bits_8 == 24) { t_8 = ((uint32_t)(*scratch));break;}num_bits_8 += 8;*scratch |= ((uint64_t)(num_bits_8)) << 56;}}
+v_image_size = t_8;
+}
+self->private_data.s_decode_image_config[0].scratch = 8;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(20);
+if (self->private_data.s_decode_image_config[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_image_config[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_image_config[0].scratch;
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(21);
+uint32_t t_9;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_9 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(22);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_9 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_9;if (num_bits_9 == 24) { t_9 = ((uint32_t)(*scratch));break;}num_bits_9 += 8;*scratch |= ((uint64_t)(num_bits_9)) << 56;}}
+v_num_colors = t_9;
+}
+self->private_data.s_decode_image_config[0].scratch = 4;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(23);
+if (self->private_data.s_decode_image_config[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_image_config[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_image_config[0].scratch;
+if (v_bitmap_info_len >= 108) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(24);
+uint32_t t_10;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_10 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(25);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_10 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_10;if (num_bits_10 == 24) { t_10 = ((uint32_t)(*scratch));break;}num_bits_10 += 8;*scratch |= ((uint64_t)(num_bits_10)) << 56;}}
+self->private_impl.f_mask_r = t_10;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(26);
+uint32_t t_11;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_11 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(27);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_11 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_11;if (num_bits_11 == 24) { t_11 = ((uint32_t)(*scratch));break;}num_bits_11 += 8;*scratch |= ((uint64_t)(num_bits_11)) << 56;}}
+self->private_impl.f_mask_g = t_11;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(28);
+uint32_t t_12;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_12 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(29);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_12 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_12;if (num_bits_12 == 24) { t_12 = ((uint32_t)(*scratch));break;}num_bits_12 += 8;*scratch |= ((uint64_t)(num_bits_12)) << 56;}}
+self->private_impl.f_mask_b = t_12;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(30);
+uint32_t t_13;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_13 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(31);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_13 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_13;if (num_bits_13 == 24) { t_13 = ((uint32_t)(*scratch));break;}num_bits_13 += 8;*scratch |= ((uint64_t)(num_bits_13)) << 56;}}
+self->private_impl.f_mask_a = t_13;
+}
+self->private_data.s_decode_image_config[0].scratch = (v_bitmap_info_len - 56);
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(32);
+if (self->private_data.s_decode_image_config[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_image_config[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_image_config[0].scratch;
+} else if (v_compression == 3) {
+if (self->private_impl.f_padding < 12) {
+status = wuffs_base__make_status(wuffs_bmp__error__bad_header);goto exit;}
+self->private_impl.f_padding -= 12;
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(33);
+uint32_t t_14;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_14 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(34);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_14 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_14;if (num_bits_14 == 24) { t_14 = ((uint32_t)(*scratch));break;}num_bits_14 += 8;*scratch |= ((uint64_t)(num_bits_14)) << 56;}}
+self->private_impl.f_mask_r = t_14;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(35);
+uint32_t t_15;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_15 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(36);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_15 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_15;if (num_bits_15 == 24) { t_15 = ((uint32_t)(*scratch));break;}num_bits_15 += 8;*scratch |= ((uint64_t)(num_bits_15)) << 56;}}
+self->private_impl.f_mask_g = t_15;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(37);
+uint32_t t_16;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_16 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(38);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_16 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_16;if (num_bits_16 == 24) { t_16 = ((uint32_t)(*scratch));break;}num_bits_16 += 8;*scratch |= ((uint64_t)(num_bits_16)) << 56;}}
+self->private_impl.f_mask_b = t_16;
+}
+self->private_impl.f_mask_a = 0;
+}
+if ((v_compression == 3) && (v_bits_per_pixel == 32) && (self->private_impl.f_mask_r == 16711680) && (self->private_impl.f_mask_g == 65280) && (self->private_impl.f_mask_b == 255) && (self->private_impl.f_mask_a == 4278190080)) {
+v_compression = 0;
+}
+if (v_compression == 0) {
+if (v_bits_per_pixel == 8) {
+self->private_impl.f_bits_per_pixel = 8;
+self->private_impl.f_bytes_per_row = (((((uint64_t)(self->private_impl.f_width)) + 3) >> 2) << 2);
+self->private_impl.f_pad_per_row = ((0 - self->private_impl.f_width) & 3);
+self->private_impl.f_pixfmt = wuffs_base__utility__make_pixel_format(2198077448);
+} else if (v_bits_per_pixel == 16) {
+v_compression = 3;
+self->private_impl.f_mask_r = 31744;
+self->private_impl.f_mask_g = 992;
+self->private_impl.f_mask_b = 31;
+self->private_impl.f_mask_a = 0;
+} else if (v_bits_per_pixel == 24) {
+self->private_impl.f_bits_per_pixel = 24;
+self->private_impl.f_bytes_per_row = ((((((uint64_t)(self->private_impl.f_width)) * 3) + 3) >> 2) << 2);
+self->private_impl.f_pad_per_row = (self->private_impl.f_width & 3);
+self->private_impl.f_pixfmt = wuffs_base__utility__make_pixel_format(2147485832);
+} else if (v_bits_per_pixel == 32) {
+self->private_impl.f_bits_per_pixel = 32;
+self->private_impl.f_bytes_per_row = (((uint64_t)(self->private_impl.f_width)) * 4);
+self->private_impl.f_pad_per_row = 0;
+self->private_impl.f_pixfmt = wuffs_base__utility__make_pixel_format(2164295816);
+} else {
+status = wuffs_base__make_status(wuffs_bmp__error__unsupported_bmp_file);goto exit;}
+self->private_impl.f_bytes_total = (self->private_impl.f_bytes_per_row * ((uint64_t)(self->private_impl.f_height)));
+} else if (v_compression == 1) {
+if (v_bits_per_pixel != 8) {
+status = wuffs_base__make_status(wuffs_bmp__error__unsupported_bmp_file);goto exit;}
+self->private_impl.f_bits_per_pixel = 8;
+} else if (v_compression == 2) {
+if (v_bits_per_pixel != 4) {
+status = wuffs_base__make_status(wuffs_bmp__error__unsupported_bmp_file);goto exit;}
+self->private_impl.f_bits_per_pixel = 4;
+} else if (v_compression != 3) {
+status = wuffs_base__make_status(wuffs_bmp__error__unsupported_bmp_file);goto exit;}
+self->private_impl.f_compression = (v_compression & 3);
+if ((v_compression == 1) || (v_compression == 2)) {
+self->private_impl.f_bytes_total = ((uint64_t)(v_image_size));
+self->private_impl.f_pixfmt = wuffs_base__utility__make_pixel_format(2198077448);
+} else if (v_compression == 3) {
+if (v_bits_per_pixel == 16) {
+self->private_impl.f_bits_per_pixel = 16;
+self->private_impl.f_bytes_per_row = (((((uint64_t)(self->private_impl.f_width)) + 1) >> 1) << 2);
+self->private_impl.f_pad_per_row = ((self->private_impl.f_width & 1) << 1);
+} else if (v_bits_per_pixel == 32) {
+self->private_impl.f_bits_per_pixel = 32;
+self->private_impl.f_bytes_per_row = (((uint64_t)(self->private_impl.f_width)) * 4);
+self->private_impl.f_pad_per_row = 0;
+} else {
+status = wuffs_base__make_status(wuffs_bmp__error__unsupported_bmp_file);goto exit;}
+self->private_impl.f_bytes_total = (self->private_impl.f_bytes_per_row * ((uint64_t)(self->private_impl.f_height)));
+self->private_impl.f_pixfmt = wuffs_base__utility__make_pixel_format(2164295816);
+wuffs_bmp__decoder__process_masks(self);
+}
+if (self->private_impl.f_bits_per_pixel <= 8) {
+v_c = (((uint32_t)(1)) << self->private_impl.f_bits_per_pixel);
+if ((v_num_colors == 0) || (v_num_colors > v_c)) {
+v_num_colors = v_c;
+}
+v_c = (wuffs_base__u32__min(v_num_colors,256) * 4);
+if (self->private_impl.f_padding < v_c) {
+status = wuffs_base__make_status(wuffs_bmp__error__bad_header);goto exit;}
+self->private_impl.f_padding -= v_c;
+v_i = 0;
+while (v_i < 256) {
+if (v_i < v_num_colors) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(39);
+uint32_t t_17;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_17 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(40);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_17 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_17;if (num_bits_17 == 24) { t_17 = ((uint32_t)(*scratch));break;}num_bits_17 += 8;*scratch |= ((uint64_t)(num_bits_17)) << 56;}}
+v_c = t_17;
+}
+v_c |= 4278190080;
+} else {
+v_c = 4278190080;
+}
+self->private_data.f_src_palette[((4 * v_i) + 0)] = ((uint8_t)(((v_c >> 0) & 255)));
+self->private_data.f_src_palette[((4 * v_i) + 1)] = ((uint8_t)(((v_c >> 8) & 255)));
+self->private_data.f_src_palette[((4 * v_i) + 2)] = ((uint8_t)(((v_c >> 16) & 255)));
+self->private_data.f_src_palette[((4 * v_i) + 3)] = ((uint8_t)(((v_c >> 24) & 255)));
+v_i += 1;
+}
+}
+self->private_impl.f_frame_config_io_position = wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)));
+if (a_dst != NULL) {
+wuffs_base__image_config__set(a_dst,2164295816,0,self->private_impl.f_width,self->private_impl.f_height,self->private_impl.f_frame_config_io_position,((self->private_impl.f_compression != 1) && (self->private_impl.f_compression != 2)));
+}
+self->private_impl.f_call_sequence = 1;
+
+goto ok;ok:self->private_impl.p_decode_image_config[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_image_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+self->private_data.s_decode_image_config[0].v_bitmap_info_len = v_bitmap_info_len;
+self->private_data.s_decode_image_config[0].v_bits_per_pixel = v_bits_per_pixel;
+self->private_data.s_decode_image_config[0].v_compression = v_compression;
+self->private_data.s_decode_image_config[0].v_image_size = v_image_size;
+self->private_data.s_decode_image_config[0].v_num_colors = v_num_colors;
+self->private_data.s_decode_image_config[0].v_i = v_i;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func bmp.decoder.decode_frame_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_bmp__decoder__decode_frame_config(wuffs_bmp__decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 2)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 2);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_frame_config[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence < 1) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_bmp__decoder__decode_image_config(self,NULL,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else if (self->private_impl.f_call_sequence == 1) {
+if (self->private_impl.f_frame_config_io_position != wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)))) {
+status = wuffs_base__make_status(wuffs_base__error__bad_restart);goto exit;}
+} else if (self->private_impl.f_call_sequence == 2) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_bmp__decoder__skip_frame(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;} else {
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;}
+if (a_dst != NULL) {
+wuffs_base__frame_config__update(a_dst,wuffs_base__utility__make_rect_ie_u32(0,0,self->private_impl.f_width,self->private_impl.f_height),((wuffs_base__flicks)(0)),0,self->private_impl.f_frame_config_io_position,0,((self->private_impl.f_compression != 1) && (self->private_impl.f_compression != 2)),false,4278190080);
+}
+self->private_impl.f_call_sequence = 2;
+
+goto ok;ok:self->private_impl.p_decode_frame_config[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_frame_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 2 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func bmp.decoder.decode_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_bmp__decoder__decode_frame(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 3)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 3);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+uint64_t v_bytes_remaining = 0;
+uint64_t v_n = 0;
+uint32_t v_m = 0;
+wuffs_base__slice_u8 v_src = {0};
+bool v_sparse = false;
+wuffs_base__slice_u8 v_dst_palette = {0};
+wuffs_base__pixel_format v_dst_pixfmt = {0};
+uint32_t v_dst_bits_per_pixel = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_frame[0];
+if (coro_susp_point) {
+v_bytes_remaining = self->private_data.s_decode_frame[0].v_bytes_remaining;
+v_sparse = self->private_data.s_decode_frame[0].v_sparse;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence < 2) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_bmp__decoder__decode_frame_config(self,NULL,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else if (self->private_impl.f_call_sequence == 2) {
+} else {
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;}
+self->private_data.s_decode_frame[0].scratch = self->private_impl.f_padding;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (self->private_data.s_decode_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_frame[0].scratch;
+self->private_impl.f_scale_shift = 0;
+self->private_impl.f_crop_x0 = 0;
+self->private_impl.f_crop_y0 = 0;
+self->private_impl.f_crop_x1 = self->private_impl.f_width;
+self->private_impl.f_crop_y1 = self->private_impl.f_height;
+if (a_opts != NULL) {
+self->private_impl.f_scale_shift = wuffs_base__decode_frame_options__scale_shift(a_opts);
+self->private_impl.f_crop_x1 = wuffs_base__u32__min(self->private_impl.f_width,wuffs_base__decode_frame_options__crop_max_excl_x(a_opts));
+self->private_impl.f_crop_y1 = wuffs_base__u32__min(self->private_impl.f_height,wuffs_base__decode_frame_options__crop_max_excl_y(a_opts));
+self->private_impl.f_crop_x0 = wuffs_base__u32__min(self->private_impl.f_crop_x1,wuffs_base__decode_frame_options__crop_min_incl_x(a_opts));
+self->private_impl.f_crop_y0 = wuffs_base__u32__min(self->private_impl.f_crop_y1,wuffs_base__decode_frame_options__crop_min_incl_y(a_opts));
+}
+v_sparse = ((self->private_impl.f_scale_shift != 0) || (self->private_impl.f_crop_x0 != 0) || (self->private_impl.f_crop_y0 != 0) || (self->private_impl.f_crop_x1 != self->private_impl.f_width) || (self->private_impl.f_crop_y1 != self->private_impl.f_height));
+v_m = ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1);
+self->private_impl.f_dst_rect_y1 = (wuffs_base__u32__sat_add((self->private_impl.f_crop_y1 - self->private_impl.f_crop_y0),v_m) >> self->private_impl.f_scale_shift);
+self->private_impl.f_band_height = 0;
+if (a_opts != NULL) {
+self->private_impl.f_band_height = wuffs_base__decode_frame_options__band_height(a_opts);
+}
+self->private_impl.f_band_y0 = 0;
+self->private_impl.f_band_y1 = self->private_impl.f_dst_rect_y1;
+if (self->private_impl.f_band_height > 0) {
+if (self->private_impl.f_top_down) {
+self->private_impl.f_band_y1 = wuffs_base__u32__min(self->private_impl.f_dst_rect_y1,self->private_impl.f_band_height);
+} else {
+self->private_impl.f_band_y0 = wuffs_base__u32__sat_sub(self->private_impl.f_dst_rect_y1,1);
+self->private_impl.f_band_y0 -= (self->private_impl.f_band_y0 % self->private_impl.f_band_height);
+}
+}
+if ((self->private_impl.f_width > 0) && (self->private_impl.f_height > 0)) {
+self->private_impl.f_dst_x = 0;
+self->private_impl.f_pending_skip = 0;
+if (self->private_impl.f_top_down) {
+self->private_impl.f_dst_y = 0;
+self->private_impl.f_dst_y_end = self->private_impl.f_height;
+self->private_impl.f_dst_y_inc = 1;
+} else {
+self->private_impl.f_dst_y = (self->private_impl.f_height - 1);
+self->private_impl.f_dst_y_end = 4294967295;
+self->private_impl.f_dst_y_inc = 4294967295;
+}
+v_dst_palette = wuffs_base__pixel_buffer__palette(a_dst);
+if (((uint64_t)(v_dst_palette.len)) == 0) {
+v_dst_palette = wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024);
+}
+v_status = wuffs_base__pixel_swizzler__prepare(&self->private_impl.f_swizzler,wuffs_base__pixel_buffer__pixel_format(a_dst),v_dst_palette,self->private_impl.f_pixfmt,wuffs_base__make_slice_u8(self->private_data.f_src_palette, 1024),a_blend);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+if (self->private_impl.f_compression != 0) {
+v_dst_pixfmt = wuffs_base__pixel_buffer__pixel_format(a_dst);
+v_dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(&v_dst_pixfmt);
+if ((v_dst_bits_per_pixel & 7) != 0) {
+status = wuffs_base__make_status(wuffs_base__error__unsupported_option);goto exit;}
+if (self->private_impl.f_compression == 3) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_bmp__decoder__decode_bitfields(self,a_dst,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+status = wuffs_bmp__decoder__decode_rle(self,a_dst,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+}
+} else {
+v_bytes_remaining = self->private_impl.f_bytes_total;
+label__0__continue:;
+while (true) {
+while (wuffs_bmp__decoder__band_is_done(self)) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(5);
+wuffs_bmp__decoder__next_band(self);
+}
+v_n = ((uint64_t)(io2_a_src - iop_a_src));
+if (self->private_impl.f_band_height > 0) {
+v_n = wuffs_base__u64__min(v_n,wuffs_bmp__decoder__row_bytes_remaining(self,v_sparse));
+}
+if (v_bytes_remaining >= v_n) {
+v_bytes_remaining -= v_n;
+} else {
+v_n = v_bytes_remaining;
+v_bytes_remaining = 0;
+}
+v_src = wuffs_base__io_reader__take(&iop_a_src, io2_a_src,v_n);
+if ( ! v_sparse) {
+v_status = wuffs_bmp__decoder__swizzle(self,a_dst,v_src);
+} else {
+v_status = wuffs_bmp__decoder__swizzle_sparse(self,a_dst,v_src);
+}
+if (wuffs_base__status__is_ok(&v_status)) {
+goto label__0__break;
+} else if ((self->private_impl.f_band_height > 0) && (v_bytes_remaining > 0) && (v_status.repr == wuffs_base__make_status(wuffs_base__suspension__short_read).repr) && (((uint64_t)(io2_a_src - iop_a_src)) > 0)) {
+goto label__0__continue;
+} else if (wuffs_base__status__is_suspension(&v_status)) {
+status = v_status;WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(6);
+} else {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+}
+label__0__break:;
+}
+}
+while (wuffs_bmp__decoder__bands_remain(self)) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(7);
+wuffs_bmp__decoder__next_band(self);
+}
+self->private_impl.f_call_sequence = 3;
+
+goto ok;ok:self->private_impl.p_decode_frame[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 3 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+self->private_data.s_decode_frame[0].v_bytes_remaining = v_bytes_remaining;
+self->private_data.s_decode_frame[0].v_sparse = v_sparse;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func bmp.decoder.band_is_done
+
+static bool//
+wuffs_bmp__decoder__band_is_done(const wuffs_bmp__decoder *self){
+
+uint32_t v_mask = 0;
+uint32_t v_y = 0;
+
+if ((self->private_impl.f_band_height == 0) || (self->private_impl.f_dst_y < self->private_impl.f_crop_y0) || (self->private_impl.f_crop_y1 <= self->private_impl.f_dst_y)) {
+return false;}
+v_mask = ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1);
+if (((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) & v_mask) != 0) {
+return false;}
+v_y = ((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) >> self->private_impl.f_scale_shift);
+if (self->private_impl.f_top_down) {
+return (v_y >= self->private_impl.f_band_y1);}
+return (v_y < self->private_impl.f_band_y0);}
+
+// -------- func bmp.decoder.bands_remain
+
+static bool//
+wuffs_bmp__decoder__bands_remain(const wuffs_bmp__decoder *self){
+
+
+if (self->private_impl.f_top_down) {
+return (self->private_impl.f_band_y1 < self->private_impl.f_dst_rect_y1);}
+return (self->private_impl.f_band_y0 > 0);}
+
+// -------- func bmp.decoder.next_band
+
+static wuffs_base__empty_struct //
+wuffs_bmp__decoder__next_band(wuffs_bmp__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 4);
+
+
+if (self->private_impl.f_top_down) {
+self->private_impl.f_band_y0 = self->private_impl.f_band_y1;
+self->private_impl.f_band_y1 = wuffs_base__u32__min(self->private_impl.f_dst_rect_y1,wuffs_base__u32__sat_add(self->private_impl.f_band_y0,self->private_impl.f_band_height));
+} else {
+self->private_impl.f_band_y1 = self->private_impl.f_band_y0;
+self->private_impl.f_band_y0 = wuffs_base__u32__sat_sub(self->private_impl.f_band_y0,self->private_impl.f_band_height);
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func bmp.decoder.row_bytes_remaining
+
+static uint64_t//
+wuffs_bmp__decoder__row_bytes_remaining(const wuffs_bmp__decoder *self,bool a_sparse){
+
+uint64_t v_n = 0;
+
+if (a_sparse) {
+if (self->private_impl.f_pending_skip > 0) {
+return self->private_impl.f_pending_skip;}
+} else if (self->private_impl.f_pending_pad > 0) {
+return ((uint64_t)(self->private_impl.f_pending_pad));} else {
+v_n = ((uint64_t)(self->private_impl.f_pad_per_row));
+}
+return wuffs_base__u64__sat_add(wuffs_base__u64__sat_sub((((uint64_t)(wuffs_base__u32__sat_sub(self->private_impl.f_width,self->private_impl.f_dst_x))) * ((uint64_t)((self->private_impl.f_bits_per_pixel / 8)))),((uint64_t)(self->private_impl.f_num_stashed))),v_n);}
+
+// -------- func bmp.decoder.swizzle
+
+static wuffs_base__status//
+wuffs_bmp__decoder__swizzle(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__slice_u8 a_src){
+WUFFS_BASE__STATS__CALL(self, 5);
+
+wuffs_base__pixel_format v_dst_pixfmt = {0};
+uint32_t v_dst_bits_per_pixel = 0;
+uint64_t v_dst_bytes_per_pixel = 0;
+uint64_t v_dst_bytes_per_row = 0;
+uint8_t v_src_bytes_per_pixel = 0;
+wuffs_base__table_u8 v_tab = {0};
+wuffs_base__slice_u8 v_dst = {0};
+uint64_t v_i = 0;
+uint64_t v_n = 0;
+
+v_dst_pixfmt = wuffs_base__pixel_buffer__pixel_format(a_dst);
+v_dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(&v_dst_pixfmt);
+if ((v_dst_bits_per_pixel & 7) != 0) {
+return wuffs_base__make_status(wuffs_base__error__unsupported_option);}
+v_dst_bytes_per_pixel = ((uint64_t)((v_dst_bits_per_pixel / 8)));
+v_dst_bytes_per_row = (((uint64_t)(self->private_impl.f_width)) * v_dst_bytes_per_pixel);
+v_src_bytes_per_pixel = ((uint8_t)((self->private_impl.f_bits_per_pixel / 8)));
+v_tab = wuffs_base__pixel_buffer__plane(a_dst,0);
+while (self->private_impl.f_pending_pad > 0) {
+if (((uint64_t)(a_src.len)) <= 0) {
+return wuffs_base__make_status(wuffs_base__suspension__short_read);}
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+self->private_impl.f_pending_pad -= 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+a_src = wuffs_base__slice_u8__subslice_i(a_src,1);
+}
+if (self->private_impl.f_num_stashed != 0) {
+while (self->private_impl.f_num_stashed < v_src_bytes_per_pixel) {
+if (((uint64_t)(a_src.len)) <= 0) {
+return wuffs_base__make_status(wuffs_base__suspension__short_read);}
+self->private_impl.f_stash[self->private_impl.f_num_stashed] = a_src.ptr[0];
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+self->private_impl.f_num_stashed += 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+a_src = wuffs_base__slice_u8__subslice_i(a_src,1);
+}
+v_dst = wuffs_base__table_u8__row(v_tab,(self->private_impl.f_dst_y - self->private_impl.f_band_y0));
+if (v_dst_bytes_per_row < ((uint64_t)(v_dst.len))) {
+v_dst = wuffs_base__slice_u8__subslice_j(v_dst,v_dst_bytes_per_row);
+}
+v_i = (((uint64_t)(self->private_impl.f_dst_x)) * v_dst_bytes_per_pixel);
+if (v_i < ((uint64_t)(v_dst.len))) {
+wuffs_base__pixel_swizzler__swizzle_interleaved(&self->private_impl.f_swizzler,wuffs_base__slice_u8__subslice_i(v_dst,v_i),wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024),wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_impl.f_stash, 4),self->private_impl.f_num_stashed));
+wuffs_base__u32__sat_add_indirect(&self->private_impl.f_dst_x,1);
+}
+self->private_impl.f_num_stashed = 0;
+}
+while (true) {
+if (self->private_impl.f_dst_x == self->private_impl.f_width) {
+self->private_impl.f_dst_x = 0;
+self->private_impl.f_dst_y += self->private_impl.f_dst_y_inc;
+if (self->private_impl.f_pad_per_row != 0) {
+v_n = ((uint64_t)(self->private_impl.f_pad_per_row));
+if (v_n <= ((uint64_t)(a_src.len))) {
+a_src = wuffs_base__slice_u8__subslice_i(a_src,v_n);
+} else {
+self->private_impl.f_pending_pad = ((uint8_t)(((v_n - ((uint64_t)(a_src.len))) & 3)));
+return wuffs_base__make_status(wuffs_base__suspension__short_read);}
+}
+}
+if (self->private_impl.f_dst_y == self->private_impl.f_dst_y_end) {
+goto label__0__break;
+}
+v_dst = wuffs_base__table_u8__row(v_tab,(self->private_impl.f_dst_y - self->private_impl.f_band_y0));
+if (v_dst_bytes_per_row < ((uint64_t)(v_dst.len))) {
+v_dst = wuffs_base__slice_u8__subslice_j(v_dst,v_dst_bytes_per_row);
+}
+v_i = (((uint64_t)(self->private_impl.f_dst_x)) * v_dst_bytes_per_pixel);
+if (v_i < ((uint64_t)(v_dst.len))) {
+v_n = wuffs_base__pixel_swizzler__swizzle_interleaved(&self->private_impl.f_swizzler,wuffs_base__slice_u8__subslice_i(v_dst,v_i),wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024),a_src);
+wuffs_base__u32__sat_add_indirect(&self->private_impl.f_dst_x,((uint32_t)((v_n & 4294967295))));
+v_n = ((v_n & 4294967295) * ((uint64_t)(v_src_bytes_per_pixel)));
+if (v_n <= ((uint64_t)(a_src.len))) {
+a_src = wuffs_base__slice_u8__subslice_i(a_src,v_n);
+} else {
+return wuffs_base__make_status(wuffs_bmp__error__internal_error_inconsistent_swizzle_count);}
+}
+if (self->private_impl.f_dst_x < self->private_impl.f_width) {
+while ((self->private_impl.f_num_stashed < v_src_bytes_per_pixel) && (((uint64_t)(a_src.len)) > 0)) {
+self->private_impl.f_stash[self->private_impl.f_num_stashed] = a_src.ptr[0];
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+self->private_impl.f_num_stashed += 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+a_src = wuffs_base__slice_u8__subslice_i(a_src,1);
+}
+return wuffs_base__make_status(wuffs_base__suspension__short_read);}
+}
+label__0__break:;
+return wuffs_base__make_status(NULL);}
+
+// -------- func bmp.decoder.swizzle_sparse
+
+static wuffs_base__status//
+wuffs_bmp__decoder__swizzle_sparse(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__slice_u8 a_src){
+WUFFS_BASE__STATS__CALL(self, 6);
+
+wuffs_base__pixel_format v_dst_pixfmt = {0};
+uint32_t v_dst_bits_per_pixel = 0;
+uint64_t v_dst_bytes_per_pixel = 0;
+uint8_t v_src_bytes_per_pixel = 0;
+uint32_t v_mask = 0;
+wuffs_base__table_u8 v_tab = {0};
+wuffs_base__slice_u8 v_dst = {0};
+wuffs_base__slice_u8 v_src = {0};
+uint64_t v_i = 0;
+uint64_t v_n = 0;
+uint32_t v_x = 0;
+uint32_t v_y = 0;
+uint32_t v_num_rows = 0;
+
+v_dst_pixfmt = wuffs_base__pixel_buffer__pixel_format(a_dst);
+v_dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(&v_dst_pixfmt);
+if ((v_dst_bits_per_pixel & 7) != 0) {
+return wuffs_base__make_status(wuffs_base__error__unsupported_option);}
+v_dst_bytes_per_pixel = ((uint64_t)((v_dst_bits_per_pixel / 8)));
+v_src_bytes_per_pixel = ((uint8_t)((self->private_impl.f_bits_per_pixel / 8)));
+v_mask = ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1);
+v_tab = wuffs_base__pixel_buffer__plane(a_dst,0);
+label__0__continue:;
+while (true) {
+if (self->private_impl.f_pending_skip > 0) {
+v_n = self->private_impl.f_pending_skip;
+if (v_n <= ((uint64_t)(a_src.len))) {
+a_src = wuffs_base__slice_u8__subslice_i(a_src,v_n);
+self->private_impl.f_pending_skip = 0;
+} else {
+self->private_impl.f_pending_skip = (v_n - ((uint64_t)(a_src.len)));
+return wuffs_base__make_status(wuffs_base__suspension__short_read);}
+}
+if (self->private_impl.f_dst_x >= self->private_impl.f_width) {
+self->private_impl.f_dst_x = 0;
+self->private_impl.f_dst_y += self->private_impl.f_dst_y_inc;
+self->private_impl.f_pending_skip = ((uint64_t)(self->private_impl.f_pad_per_row));
+goto label__0__continue;
+}
+if (self->private_impl.f_dst_y == self->private_impl.f_dst_y_end) {
+goto label__0__break;
+}
+if ((self->private_impl.f_dst_y < self->private_impl.f_crop_y0) || (self->private_impl.f_crop_y1 <= self->private_impl.f_dst_y)) {
+if (self->private_impl.f_top_down) {
+v_y = self->private_impl.f_dst_y_end;
+if (self->private_impl.f_dst_y < self->private_impl.f_crop_y0) {
+v_y = self->private_impl.f_crop_y0;
+}
+v_num_rows = (v_y - self->private_impl.f_dst_y);
+} else {
+v_y = self->private_impl.f_dst_y_end;
+if (self->private_impl.f_crop_y1 <= self->private_impl.f_dst_y) {
+v_y = (self->private_impl.f_crop_y1 - 1);
+}
+v_num_rows = (self->private_impl.f_dst_y - v_y);
+}
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_pending_skip,(((uint64_t)((v_num_rows & 2147483647))) * self->private_impl.f_bytes_per_row));
+self->private_impl.f_dst_y = v_y;
+goto label__0__continue;
+}
+if (((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) & v_mask) != 0) {
+v_x = self->private_impl.f_width;
+} else if (self->private_impl.f_dst_x < self->private_impl.f_crop_x0) {
+v_x = self->private_impl.f_crop_x0;
+} else if (self->private_impl.f_dst_x >= self->private_impl.f_crop_x1) {
+v_x = self->private_impl.f_width;
+} else if (((self->private_impl.f_dst_x - self->private_impl.f_crop_x0) & v_mask) != 0) {
+v_x = wuffs_base__u32__min(self->private_impl.f_crop_x1,wuffs_base__u32__sat_add(self->private_impl.f_crop_x0,wuffs_base__u32__sat_add(((self->private_impl.f_dst_x - self->private_impl.f_crop_x0) | v_mask),1)));
+} else {
+v_dst = wuffs_base__table_u8__row(v_tab,(((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) >> self->private_impl.f_scale_shift) - self->private_impl.f_band_y0));
+v_i = (((uint64_t)(((self->private_impl.f_dst_x - self->private_impl.f_crop_x0) >> self->private_impl.f_scale_shift))) * v_dst_bytes_per_pixel);
+if ((v_mask == 0) && (self->private_impl.f_num_stashed == 0) && (v_i < ((uint64_t)(v_dst.len)))) {
+v_src = a_src;
+v_n = (((uint64_t)((self->private_impl.f_crop_x1 - self->private_impl.f_dst_x))) * ((uint64_t)(v_src_bytes_per_pixel)));
+if (v_n < ((uint64_t)(v_src.len))) {
+v_src = wuffs_base__slice_u8__subslice_j(v_src,v_n);
+}
+v_n = wuffs_base__pixel_swizzler__swizzle_interleaved(&self->private_impl.f_swizzler,wuffs_base__slice_u8__subslice_i(v_dst,v_i),wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024),v_src);
+if (v_n > 0) {
+wuffs_base__u32__sat_add_indirect(&self->private_impl.f_dst_x,((uint32_t)((v_n & 4294967295))));
+v_n = ((v_n & 4294967295) * ((uint64_t)(v_src_bytes_per_pixel)));
+if (v_n <= ((uint64_t)(a_src.len))) {
+a_src = wuffs_base__slice_u8__subslice_i(a_src,v_n);
+} else {
+return wuffs_base__make_status(wuffs_bmp__error__internal_error_inconsistent_swizzle_count);}
+goto label__0__continue;
+}
+}
+while (self->private_impl.f_num_stashed < v_src_bytes_per_pixel) {
+if (((uint64_t)(a_src.len)) <= 0) {
+return wuffs_base__make_status(wuffs_base__suspension__short_read);}
+self->private_impl.f_stash[self->private_impl.f_num_stashed] = a_src.ptr[0];
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+self->private_impl.f_num_stashed += 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+a_src = wuffs_base__slice_u8__subslice_i(a_src,1);
+}
+if (v_i < ((uint64_t)(v_dst.len))) {
+wuffs_base__pixel_swizzler__swizzle_interleaved(&self->private_impl.f_swizzler,wuffs_base__slice_u8__subslice_i(v_dst,v_i),wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024),wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_impl.f_stash, 4),self->private_impl.f_num_stashed));
+}
+self->private_impl.f_num_stashed = 0;
+wuffs_base__u32__sat_add_indirect(&self->private_impl.f_dst_x,1);
+goto label__0__continue;
+}
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_pending_skip,(((uint64_t)((v_x - self->private_impl.f_dst_x))) * ((uint64_t)(v_src_bytes_per_pixel))));
+self->private_impl.f_dst_x = v_x;
+}
+label__0__break:;
+return wuffs_base__make_status(NULL);}
+
+// -------- func bmp.decoder.decode_rle
+
+static wuffs_base__status //
+wuffs_bmp__decoder__decode_rle(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 7);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_code = 0;
+uint8_t v_value = 0;
+uint32_t v_n = 0;
+uint32_t v_i = 0;
+uint32_t v_d = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_rle[0];
+if (coro_susp_point) {
+v_code = self->private_data.s_decode_rle[0].v_code;
+v_n = self->private_data.s_decode_rle[0].v_n;
+v_i = self->private_data.s_decode_rle[0].v_i;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (self->private_impl.f_dst_y != self->private_impl.f_dst_y_end) {
+while (wuffs_bmp__decoder__band_is_done(self)) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+wuffs_bmp__decoder__next_band(self);
+}
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_code = t_0;
+}
+{
+uint8_t t_1;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_1 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_1 = *iop_a_src++;
+}
+v_value = t_1;
+}
+if (v_code > 0) {
+v_n = ((uint32_t)(v_code));
+v_i = 0;
+if (self->private_impl.f_compression == 1) {
+while (v_i < v_n) {
+self->private_data.f_scratch[v_i] = v_value;
+v_i += 1;
+}
+} else {
+while (v_i < v_n) {
+if ((v_i & 1) == 0) {
+self->private_data.f_scratch[v_i] = (v_value >> 4);
+} else {
+self->private_data.f_scratch[v_i] = (v_value & 15);
+}
+v_i += 1;
+}
+}
+wuffs_bmp__decoder__swizzle_run(self,a_dst,wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_data.f_scratch, 2048),v_n),1);
+} else if (v_value == 0) {
+self->private_impl.f_dst_x = 0;
+self->private_impl.f_dst_y += self->private_impl.f_dst_y_inc;
+} else if (v_value == 1) {
+goto label__0__break;
+} else if (v_value == 2) {
+{
+uint32_t t_2;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_2 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_2 = *iop_a_src++;
+}
+v_d = t_2;
+}
+self->private_impl.f_dst_x = wuffs_base__u32__min(self->private_impl.f_width,wuffs_base__u32__sat_add(self->private_impl.f_dst_x,v_d));
+{
+uint32_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+v_d = t_3;
+}
+while ((v_d > 0) && (self->private_impl.f_dst_y != self->private_impl.f_dst_y_end)) {
+self->private_impl.f_dst_y += self->private_impl.f_dst_y_inc;
+v_d -= 1;
+}
+} else {
+v_n = ((uint32_t)(v_value));
+v_i = 0;
+if (self->private_impl.f_compression == 1) {
+while (v_i < v_n) {
+{
+uint8_t t_4;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_4 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_4 = *iop_a_src++;
+}
+self->private_data.f_scratch[v_i] = t_4;
+}
+v_i += 1;
+}
+if ((v_n & 1) != 0) {
+if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }iop_a_src++;
+}
+}
+} else {
+while (v_i < v_n) {
+{
+uint8_t t_5;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_5 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_5 = *iop_a_src++;
+}
+v_value = t_5;
+}
+self->private_data.f_scratch[v_i] = (v_value >> 4);
+v_i += 1;
+if (v_i < v_n) {
+self->private_data.f_scratch[v_i] = (v_value & 15);
+v_i += 1;
+}
+}
+if (((v_n & 3) == 1) || ((v_n & 3) == 2)) {
+if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }iop_a_src++;
+}
+}
+}
+wuffs_bmp__decoder__swizzle_run(self,a_dst,wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_data.f_scratch, 2048),v_n),1);
+}
+}
+label__0__break:;
+
+goto ok;ok:self->private_impl.p_decode_rle[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_rle[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_rle[0].v_code = v_code;
+self->private_data.s_decode_rle[0].v_n = v_n;
+self->private_data.s_decode_rle[0].v_i = v_i;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func bmp.decoder.decode_bitfields
+
+static wuffs_base__status //
+wuffs_bmp__decoder__decode_bitfields(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 8);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_n = 0;
+uint32_t v_i = 0;
+uint32_t v_p = 0;
+uint32_t v_c = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_bitfields[0];
+if (coro_susp_point) {
+v_n = self->private_data.s_decode_bitfields[0].v_n;
+v_i = self->private_data.s_decode_bitfields[0].v_i;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (self->private_impl.f_dst_y != self->private_impl.f_dst_y_end) {
+while (wuffs_bmp__decoder__band_is_done(self)) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+wuffs_bmp__decoder__next_band(self);
+}
+v_c = (self->private_impl.f_width - self->private_impl.f_dst_x);
+v_n = 512;
+if (v_c < 512) {
+v_n = v_c;
+}
+v_i = 0;
+while (v_i < v_n) {
+if (self->private_impl.f_bits_per_pixel == 16) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+uint32_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_0 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_bitfields[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_bitfields[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;if (num_bits_0 == 8) { t_0 = ((uint32_t)(*scratch));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0)) << 56;}}
+v_p = t_0;
+}
+} else {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_1 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_bitfields[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_bitfields[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;if (num_bits_1 == 24) { t_1 = ((uint32_t)(*scratch));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1)) << 56;}}
+v_p = t_1;
+}
+}
+v_c = ((v_p & self->private_impl.f_mask_b) >> self->private_impl.f_channel_shifts[0]);
+v_c = ((v_c * WUFFS_BMP__BITFIELDS_MULS[self->private_impl.f_channel_widths[0]]) >> WUFFS_BMP__BITFIELDS_SHRS[self->private_impl.f_channel_widths[0]]);
+self->private_data.f_scratch[((4 * v_i) + 0)] = ((uint8_t)((v_c & 255)));
+v_c = ((v_p & self->private_impl.f_mask_g) >> self->private_impl.f_channel_shifts[1]);
+v_c = ((v_c * WUFFS_BMP__BITFIELDS_MULS[self->private_impl.f_channel_widths[1]]) >> WUFFS_BMP__BITFIELDS_SHRS[self->private_impl.f_channel_widths[1]]);
+self->private_data.f_scratch[((4 * v_i) + 1)] = ((uint8_t)((v_c & 255)));
+v_c = ((v_p & self->private_impl.f_mask_r) >> self->private_impl.f_channel_shifts[2]);
+v_c = ((v_c * WUFFS_BMP__BITFIELDS_MULS[self->private_impl.f_channel_widths[2]]) >> WUFFS_BMP__BITFIELDS_SHRS[self->private_impl.f_channel_widths[2]]);
+self->private_data.f_scratch[((4 * v_i) + 2)] = ((uint8_t)((v_c & 255)));
+if (self->private_impl.f_mask_a == 0) {
+self->private_data.f_scratch[((4 * v_i) + 3)] = 255;
+} else {
+v_c = ((v_p & self->private_impl.f_mask_a) >> self->private_impl.f_channel_shifts[3]);
+v_c = ((v_c * WUFFS_BMP__BITFIELDS_MULS[self->private_impl.f_channel_widths[3]]) >> WUFFS_BMP__BITFIELDS_SHRS[self->private_impl.f_channel_widths[3]]);
+self->private_data.f_scratch[((4 * v_i) + 3)] = ((uint8_t)((v_c & 255)));
+}
+v_i += 1;
+}
+wuffs_bmp__decoder__swizzle_run(self,a_dst,wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_data.f_scratch, 2048),(4 * v_n)),4);
+if (self->private_impl.f_dst_x >= self->private_impl.f_width) {
+self->private_data.s_decode_bitfields[0].scratch = ((uint32_t)(self->private_impl.f_pad_per_row));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+if (self->private_data.s_decode_bitfields[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_bitfields[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_bitfields[0].scratch;
+self->private_impl.f_dst_x = 0;
+self->private_impl.f_dst_y += self->private_impl.f_dst_y_inc;
+}
+}
+
+goto ok;ok:self->private_impl.p_decode_bitfields[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_bitfields[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_bitfields[0].v_n = v_n;
+self->private_data.s_decode_bitfields[0].v_i = v_i;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func bmp.decoder.process_masks
+
+static wuffs_base__empty_struct //
+wuffs_bmp__decoder__process_masks(wuffs_bmp__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 9);
+
+uint32_t v_i = 0;
+uint32_t v_mask = 0;
+uint32_t v_shift = 0;
+uint32_t v_width = 0;
+
+while (v_i < 4) {
+if (v_i == 0) {
+v_mask = self->private_impl.f_mask_b;
+} else if (v_i == 1) {
+v_mask = self->private_impl.f_mask_g;
+} else if (v_i == 2) {
+v_mask = self->private_impl.f_mask_r;
+} else {
+v_mask = self->private_impl.f_mask_a;
+}
+v_shift = 0;
+v_width = 0;
+if (v_mask != 0) {
+while (v_shift < 31) {
+if (((v_mask >> v_shift) & 1) != 0) {
+goto label__0__break;
+}
+v_shift += 1;
+}
+label__0__break:;
+v_mask >>= v_shift;
+while (v_width < 32) {
+if ((v_mask >> v_width) == 0) {
+goto label__1__break;
+}
+v_width += 1;
+}
+label__1__break:;
+}
+self->private_impl.f_channel_shifts[v_i] = v_shift;
+self->private_impl.f_channel_widths[v_i] = v_width;
+v_i += 1;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func bmp.decoder.swizzle_run
+
+static wuffs_base__empty_struct //
+wuffs_bmp__decoder__swizzle_run(wuffs_bmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__slice_u8 a_src,uint64_t a_src_bytes_per_pixel){
+WUFFS_BASE__STATS__CALL(self, 10);
+
+wuffs_base__pixel_format v_dst_pixfmt = {0};
+uint32_t v_dst_bits_per_pixel = 0;
+uint64_t v_dst_bytes_per_pixel = 0;
+uint64_t v_mask = 0;
+wuffs_base__table_u8 v_tab = {0};
+wuffs_base__slice_u8 v_dst = {0};
+wuffs_base__slice_u8 v_src = {0};
+uint64_t v_x0 = 0;
+uint64_t v_x1 = 0;
+uint64_t v_x = 0;
+uint64_t v_i = 0;
+uint64_t v_j = 0;
+uint64_t v_n = 0;
+
+v_x0 = ((uint64_t)(self->private_impl.f_dst_x));
+v_x1 = wuffs_base__u64__sat_add(v_x0,(((uint64_t)(a_src.len)) / a_src_bytes_per_pixel));
+v_x1 = wuffs_base__u64__min(v_x1,((uint64_t)(self->private_impl.f_width)));
+if (v_x1 <= v_x0) {
+return wuffs_base__make_empty_struct();}
+self->private_impl.f_dst_x = ((uint32_t)((v_x1 & 4294967295)));
+v_mask = ((((uint64_t)(1)) << self->private_impl.f_scale_shift) - 1);
+if ((self->private_impl.f_dst_y < self->private_impl.f_crop_y0) || (self->private_impl.f_crop_y1 <= self->private_impl.f_dst_y) || (((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) & ((uint32_t)(v_mask))) != 0)) {
+return wuffs_base__make_empty_struct();}
+v_x = wuffs_base__u64__max(v_x0,((uint64_t)(self->private_impl.f_crop_x0)));
+v_x = ((v_x - ((uint64_t)(self->private_impl.f_crop_x0))) & 4294967295);
+v_x = (((uint64_t)(self->private_impl.f_crop_x0)) + ((v_x + v_mask) & (18446744073709551608u | (v_mask ^ 7))));
+v_x1 = wuffs_base__u64__min(v_x1,((uint64_t)(self->private_impl.f_crop_x1)));
+v_dst_pixfmt = wuffs_base__pixel_buffer__pixel_format(a_dst);
+v_dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(&v_dst_pixfmt);
+v_dst_bytes_per_pixel = ((uint64_t)((v_dst_bits_per_pixel / 8)));
+v_tab = wuffs_base__pixel_buffer__plane(a_dst,0);
+v_dst = wuffs_base__table_u8__row(v_tab,(((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) >> self->private_impl.f_scale_shift) - self->private_impl.f_band_y0));
+if (v_mask == 0) {
+v_i = (((v_x - ((uint64_t)(self->private_impl.f_crop_x0))) & 4294967295) * v_dst_bytes_per_pixel);
+v_j = (((v_x - v_x0) & 4294967295) * a_src_bytes_per_pixel);
+v_n = (((v_x1 - v_x0) & 4294967295) * a_src_bytes_per_pixel);
+if ((v_x < v_x1) && (v_j <= v_n) && (v_n <= ((uint64_t)(a_src.len))) && (v_i <= ((uint64_t)(v_dst.len)))) {
+wuffs_base__pixel_swizzler__swizzle_interleaved(&self->private_impl.f_swizzler,wuffs_base__slice_u8__subslice_i(v_dst,v_i),wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024),wuffs_base__slice_u8__subslice_ij(a_src,v_j,v_n));
+}
+return wuffs_base__make_empty_struct();}
+while (v_x < v_x1) {
+v_i = ((((v_x - ((uint64_t)(self->private_impl.f_crop_x0))) & 4294967295) >> self->private_impl.f_scale_shift) * v_dst_bytes_per_pixel);
+v_j = (((v_x - v_x0) & 4294967295) * a_src_bytes_per_pixel);
+if ((v_j <= ((uint64_t)(a_src.len))) && (v_i <= ((uint64_t)(v_dst.len)))) {
+v_src = wuffs_base__slice_u8__subslice_i(a_src,v_j);
+if (a_src_bytes_per_pixel <= ((uint64_t)(v_src.len))) {
+wuffs_base__pixel_swizzler__swizzle_interleaved(&self->private_impl.f_swizzler,wuffs_base__slice_u8__subslice_i(v_dst,v_i),wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024),wuffs_base__slice_u8__subslice_j(v_src,a_src_bytes_per_pixel));
+}
+}
+v_x += (v_mask + 1);
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func bmp.decoder.skip_frame
+
+static wuffs_base__status //
+wuffs_bmp__decoder__skip_frame(wuffs_bmp__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 11);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_skip_frame[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+self->private_data.s_skip_frame[0].scratch = self->private_impl.f_padding;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (self->private_data.s_skip_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_skip_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_skip_frame[0].scratch;
+self->private_data.s_skip_frame[0].scratch = self->private_impl.f_bytes_total;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (self->private_data.s_skip_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_skip_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_skip_frame[0].scratch;
+self->private_impl.f_call_sequence = 3;
+
+goto ok;ok:self->private_impl.p_skip_frame[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_skip_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func bmp.decoder.frame_dirty_rect
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_bmp__decoder__frame_dirty_rect(const wuffs_bmp__decoder *self){
+if (!self) { return wuffs_base__utility__empty_rect_ie_u32();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_rect_ie_u32();}
+
+uint32_t v_m = 0;
+
+v_m = ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1);
+return wuffs_base__utility__make_rect_ie_u32(0,self->private_impl.f_band_y0,(wuffs_base__u32__sat_add((self->private_impl.f_crop_x1 - self->private_impl.f_crop_x0),v_m) >> self->private_impl.f_scale_shift),self->private_impl.f_band_y1);}
+
+// -------- func bmp.decoder.num_animation_loops
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_bmp__decoder__num_animation_loops(const wuffs_bmp__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+return 0;}
+
+// -------- func bmp.decoder.num_decoded_frame_configs
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_bmp__decoder__num_decoded_frame_configs(const wuffs_bmp__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+if (self->private_impl.f_call_sequence > 1) {
+return 1;}
+return 0;}
+
+// -------- func bmp.decoder.num_decoded_frames
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_bmp__decoder__num_decoded_frames(const wuffs_bmp__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+if (self->private_impl.f_call_sequence > 2) {
+return 1;}
+return 0;}
+
+// -------- func bmp.decoder.restart_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_bmp__decoder__restart_frame(wuffs_bmp__decoder *self,uint64_t a_index,uint64_t a_io_position){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+WUFFS_BASE__STATS__CALL(self, 12);
+
+
+if (self->private_impl.f_call_sequence == 0) {
+return wuffs_base__make_status(wuffs_base__error__bad_call_sequence);}
+if (a_index != 0) {
+return wuffs_base__make_status(wuffs_base__error__bad_argument);}
+self->private_impl.f_call_sequence = 1;
+self->private_impl.f_frame_config_io_position = a_io_position;
+return wuffs_base__make_status(NULL);}
+
+// -------- func bmp.decoder.set_report_metadata
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_bmp__decoder__set_report_metadata(wuffs_bmp__decoder *self,uint32_t a_fourcc,bool a_report){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func bmp.decoder.tell_me_more
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_bmp__decoder__tell_me_more(wuffs_bmp__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 4)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 14);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+if (self->private_impl.f_io_redirect_fourcc <= 1) {
+status = wuffs_base__make_status(wuffs_base__error__no_more_information);goto exit;}
+if (a_minfo != NULL) {
+wuffs_base__more_information__set(a_minfo,1,self->private_impl.f_io_redirect_fourcc,0,self->private_impl.f_io_redirect_pos,18446744073709551615u);
+}
+self->private_impl.f_io_redirect_fourcc = 1;
+
+goto ok;ok:goto exit;exit:if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func bmp.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_bmp__decoder__workbuf_len(const wuffs_bmp__decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__make_range_ii_u64(0,0);}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BMP)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__BMP
+
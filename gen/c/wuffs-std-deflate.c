@@ -0,0 +1,3165 @@
+#ifndef WUFFS_INCLUDE_GUARD__DEFLATE
+#define WUFFS_INCLUDE_GUARD__DEFLATE
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__DEFLATE
+#endif
+
+#include "./wuffs-base.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+extern const char* wuffs_deflate__suspension__block_boundary;
+extern const char* wuffs_deflate__error__bad_huffman_code_over_subscribed;
+extern const char* wuffs_deflate__error__bad_huffman_code_under_subscribed;
+extern const char* wuffs_deflate__error__bad_huffman_code_length_count;
+extern const char* wuffs_deflate__error__bad_huffman_code_length_repetition;
+extern const char* wuffs_deflate__error__bad_huffman_code;
+extern const char* wuffs_deflate__error__bad_huffman_minimum_code_length;
+extern const char* wuffs_deflate__error__bad_block;
+extern const char* wuffs_deflate__error__bad_distance;
+extern const char* wuffs_deflate__error__bad_distance_code_count;
+extern const char* wuffs_deflate__error__bad_literal_length_code_count;
+extern const char* wuffs_deflate__error__inconsistent_stored_block_length;
+extern const char* wuffs_deflate__error__missing_end_of_block_code;
+extern const char* wuffs_deflate__error__no_huffman_codes;
+
+// ---------------- Public Consts
+
+#define WUFFS_DEFLATE__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 1
+
+#define WUFFS_DEFLATE__ENCODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 0
+
+#define WUFFS_DEFLATE__ENCODER_LEVEL_NONE 0
+
+#define WUFFS_DEFLATE__ENCODER_LEVEL_FAST 1
+
+#define WUFFS_DEFLATE__ENCODER_LEVEL_BALANCED 6
+
+#define WUFFS_DEFLATE__ENCODER_LEVEL_BEST 9
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_deflate__decoder__struct wuffs_deflate__decoder;
+
+typedef struct wuffs_deflate__encoder__struct wuffs_deflate__encoder;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_deflate__decoder__initialize(wuffs_deflate__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_deflate__decoder();
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_deflate__encoder__initialize(wuffs_deflate__encoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_deflate__encoder();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_deflate__decoder*  //
+wuffs_deflate__decoder__alloc();
+
+static inline wuffs_base__io_transformer*  //
+wuffs_deflate__decoder__alloc_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)(wuffs_deflate__decoder__alloc());
+}
+
+wuffs_deflate__encoder*  //
+wuffs_deflate__encoder__alloc();
+
+static inline wuffs_base__io_transformer*  //
+wuffs_deflate__encoder__alloc_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)(wuffs_deflate__encoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__io_transformer*  //
+wuffs_deflate__decoder__upcast_as__wuffs_base__io_transformer(wuffs_deflate__decoder* p){
+return (wuffs_base__io_transformer*)p;
+}
+
+static inline wuffs_base__io_transformer*  //
+wuffs_deflate__encoder__upcast_as__wuffs_base__io_transformer(wuffs_deflate__encoder* p){
+return (wuffs_base__io_transformer*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__ADD_HISTORY 0
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__SET_DST_HOLDS_HISTORY 1
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__SET_SUSPEND_AT_BLOCK_BOUNDARIES 2
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__PRIME 3
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__SET_QUIRK_ENABLED 4
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__TRANSFORM_IO 5
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__DECODE_BLOCKS 6
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__DECODE_UNCOMPRESSED 7
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__INIT_FIXED_HUFFMAN 8
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__INIT_DYNAMIC_HUFFMAN 9
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__INIT_HUFF 10
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__INIT_LITERAL_PAIRS 11
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__DECODE_HUFFMAN_FAST 12
+#define WUFFS_DEFLATE__DECODER__STATS__FUNC__DECODE_HUFFMAN_SLOW 13
+
+typedef struct wuffs_deflate__decoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[14];
+} wuffs_deflate__decoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_deflate__decoder__stats  //
+wuffs_deflate__decoder__get_stats(const wuffs_deflate__decoder* self);
+
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__SET_LEVEL 0
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__SET_QUIRK_ENABLED 1
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__TRANSFORM_IO 2
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__PUT_BITS 3
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__FLUSH_BITS 4
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__INSERT 5
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__LONGEST_MATCH 6
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__ADD_LITERAL 7
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__ADD_MATCH 8
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__LZ77_GREEDY 9
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__LZ77_LAZY 10
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__BUILD_HUFFMAN 11
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__ASSIGN_CODES 12
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__INIT_FIXED_CODES 13
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__ADD_CL_OP 14
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__BUILD_CODE_LENGTH_CODE 15
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__WRITE_DYNAMIC_HEADER 16
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__WRITE_SYMBOLS 17
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__WRITE_STORED_BLOCK 18
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__COMPRESS_BLOCK 19
+#define WUFFS_DEFLATE__ENCODER__STATS__FUNC__SLIDE_IF_FULL 20
+
+typedef struct wuffs_deflate__encoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[21];
+} wuffs_deflate__encoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_deflate__encoder__stats  //
+wuffs_deflate__encoder__get_stats(const wuffs_deflate__encoder* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__decoder__add_history(wuffs_deflate__decoder *self,wuffs_base__slice_u8 a_hist);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__decoder__set_dst_holds_history(wuffs_deflate__decoder *self,bool a_h);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__decoder__set_suspend_at_block_boundaries(wuffs_deflate__decoder *self,bool a_s);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_deflate__decoder__num_buffered_bits(const wuffs_deflate__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__decoder__prime(wuffs_deflate__decoder *self,uint32_t a_n_bits,uint32_t a_bits);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__decoder__set_quirk_enabled(wuffs_deflate__decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_deflate__decoder__workbuf_len(const wuffs_deflate__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_deflate__decoder__transform_io(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__encoder__set_level(wuffs_deflate__encoder *self,uint32_t a_level);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__encoder__set_quirk_enabled(wuffs_deflate__encoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_deflate__encoder__workbuf_len(const wuffs_deflate__encoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_deflate__encoder__transform_io(wuffs_deflate__encoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_deflate__decoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__io_transformer;
+wuffs_base__vtable null_vtable;
+
+uint32_t f_bits;
+uint32_t f_n_bits;
+uint32_t f_history_index;
+uint32_t f_n_huffs_bits[2];
+bool f_end_of_block;
+bool f_dst_holds_history;
+bool f_suspend_at_block_boundaries;
+
+uint32_t p_transform_io[1];
+uint32_t p_decode_blocks[1];
+uint32_t p_decode_uncompressed[1];
+uint32_t p_init_dynamic_huffman[1];
+uint32_t p_decode_huffman_slow[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_deflate__decoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+uint32_t f_huffs[2][1024];
+uint8_t f_history[33025];
+uint8_t f_code_lengths[320];
+
+struct {
+uint32_t v_final;
+bool v_seen_block;
+} s_decode_blocks[1];
+struct {
+uint32_t v_length;
+uint64_t scratch;
+} s_decode_uncompressed[1];
+struct {
+uint32_t v_bits;
+uint32_t v_n_bits;
+uint32_t v_n_lit;
+uint32_t v_n_dist;
+uint32_t v_n_clen;
+uint32_t v_i;
+uint32_t v_mask;
+uint32_t v_table_entry;
+uint32_t v_n_extra_bits;
+uint8_t v_rep_symbol;
+uint32_t v_rep_count;
+} s_init_dynamic_huffman[1];
+struct {
+uint32_t v_bits;
+uint32_t v_n_bits;
+uint32_t v_table_entry;
+uint32_t v_table_entry_n_bits;
+uint32_t v_lmask;
+uint32_t v_dmask;
+uint32_t v_redir_top;
+uint32_t v_redir_mask;
+uint32_t v_length;
+uint32_t v_dist_minus_1;
+uint32_t v_hlen;
+uint32_t v_hdist;
+uint64_t scratch;
+} s_decode_huffman_slow[1];
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_deflate__decoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_deflate__decoder__alloc(), &free);
+}
+
+static inline wuffs_base__io_transformer::unique_ptr  //
+alloc_as__wuffs_base__io_transformer(){
+return wuffs_base__io_transformer::unique_ptr(wuffs_deflate__decoder__alloc_as__wuffs_base__io_transformer(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_deflate__decoder__struct() = delete;
+wuffs_deflate__decoder__struct(const wuffs_deflate__decoder__struct&) = delete;
+wuffs_deflate__decoder__struct& operator=(const wuffs_deflate__decoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_deflate__decoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__io_transformer*  //
+upcast_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)this;
+}
+
+inline wuffs_base__empty_struct //
+add_history(wuffs_base__slice_u8 a_hist){ return wuffs_deflate__decoder__add_history(this,a_hist);}
+
+inline wuffs_base__empty_struct //
+set_dst_holds_history(bool a_h){ return wuffs_deflate__decoder__set_dst_holds_history(this,a_h);}
+
+inline wuffs_base__empty_struct //
+set_suspend_at_block_boundaries(bool a_s){ return wuffs_deflate__decoder__set_suspend_at_block_boundaries(this,a_s);}
+
+inline uint32_t//
+num_buffered_bits() const { return wuffs_deflate__decoder__num_buffered_bits(this);}
+
+inline wuffs_base__empty_struct //
+prime(uint32_t a_n_bits,uint32_t a_bits){ return wuffs_deflate__decoder__prime(this,a_n_bits,a_bits);}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_deflate__decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_deflate__decoder__workbuf_len(this);}
+
+inline wuffs_base__status //
+transform_io(wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){ return wuffs_deflate__decoder__transform_io(this,a_dst,a_src,a_workbuf);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_deflate__decoder__stats  //
+get_stats() const {
+return wuffs_deflate__decoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_deflate__decoder__struct
+
+struct wuffs_deflate__encoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__io_transformer;
+wuffs_base__vtable null_vtable;
+
+bool f_level_is_set;
+bool f_level_is_stored;
+bool f_level_is_lazy;
+uint32_t f_max_chain;
+uint32_t f_nice_length;
+uint32_t f_good_length;
+uint32_t f_max_lazy;
+uint64_t f_bits;
+uint32_t f_n_bits;
+uint32_t f_buf_len;
+uint32_t f_block_start;
+uint32_t f_n_syms;
+uint32_t f_match_distance;
+uint32_t f_hlit;
+uint32_t f_hdist;
+uint32_t f_hclen;
+uint32_t f_n_cl_ops;
+uint32_t f_out_ri;
+uint32_t f_out_wi;
+bool f_inconsistent;
+bool f_end_of_stream;
+uint16_t f_head[32768];
+uint16_t f_prev[32768];
+
+uint32_t p_transform_io[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_deflate__encoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+uint8_t f_buf[65794];
+uint32_t f_syms[16384];
+uint32_t f_freqs[3][288];
+uint8_t f_lengths[3][288];
+uint16_t f_codes[3][288];
+uint32_t f_hkeys[512];
+uint32_t f_hdepths[512];
+uint32_t f_bl_count[16];
+uint32_t f_next_codes[16];
+uint8_t f_cl_seq[316];
+uint16_t f_cl_ops[316];
+uint8_t f_out[32768];
+
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_deflate__encoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_deflate__encoder__alloc(), &free);
+}
+
+static inline wuffs_base__io_transformer::unique_ptr  //
+alloc_as__wuffs_base__io_transformer(){
+return wuffs_base__io_transformer::unique_ptr(wuffs_deflate__encoder__alloc_as__wuffs_base__io_transformer(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_deflate__encoder__struct() = delete;
+wuffs_deflate__encoder__struct(const wuffs_deflate__encoder__struct&) = delete;
+wuffs_deflate__encoder__struct& operator=(const wuffs_deflate__encoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_deflate__encoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__io_transformer*  //
+upcast_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_level(uint32_t a_level){ return wuffs_deflate__encoder__set_level(this,a_level);}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_deflate__encoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_deflate__encoder__workbuf_len(this);}
+
+inline wuffs_base__status //
+transform_io(wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){ return wuffs_deflate__encoder__transform_io(this,a_dst,a_src,a_workbuf);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_deflate__encoder__stats  //
+get_stats() const {
+return wuffs_deflate__encoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_deflate__encoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__DEFLATE)
+
+// ---------------- Status Codes Implementations
+
+const char* wuffs_deflate__suspension__block_boundary = "$deflate: block boundary";
+const char* wuffs_deflate__error__bad_huffman_code_over_subscribed = "#deflate: bad Huffman code (over-subscribed)";
+const char* wuffs_deflate__error__bad_huffman_code_under_subscribed = "#deflate: bad Huffman code (under-subscribed)";
+const char* wuffs_deflate__error__bad_huffman_code_length_count = "#deflate: bad Huffman code length count";
+const char* wuffs_deflate__error__bad_huffman_code_length_repetition = "#deflate: bad Huffman code length repetition";
+const char* wuffs_deflate__error__bad_huffman_code = "#deflate: bad Huffman code";
+const char* wuffs_deflate__error__bad_huffman_minimum_code_length = "#deflate: bad Huffman minimum code length";
+const char* wuffs_deflate__error__bad_block = "#deflate: bad block";
+const char* wuffs_deflate__error__bad_distance = "#deflate: bad distance";
+const char* wuffs_deflate__error__bad_distance_code_count = "#deflate: bad distance code count";
+const char* wuffs_deflate__error__bad_literal_length_code_count = "#deflate: bad literal/length code count";
+const char* wuffs_deflate__error__inconsistent_stored_block_length = "#deflate: inconsistent stored block length";
+const char* wuffs_deflate__error__missing_end_of_block_code = "#deflate: missing end-of-block code";
+const char* wuffs_deflate__error__no_huffman_codes = "#deflate: no Huffman codes";
+const char* wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state = "#deflate: internal error: inconsistent Huffman decoder state";
+const char* wuffs_deflate__error__internal_error_inconsistent_i_o = "#deflate: internal error: inconsistent I/O";
+const char* wuffs_deflate__error__internal_error_inconsistent_distance = "#deflate: internal error: inconsistent distance";
+const char* wuffs_deflate__error__internal_error_inconsistent_n_bits = "#deflate: internal error: inconsistent n_bits";
+const char* wuffs_deflate__error__internal_error_inconsistent_encoder_state = "#deflate: internal error: inconsistent encoder state";
+
+// ---------------- Private Consts
+
+static const uint8_t //
+WUFFS_DEFLATE__CODE_ORDER[19]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15,};
+
+static const uint8_t //
+WUFFS_DEFLATE__REVERSE8[256]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,128,64,192,32,160,96,224,16,144,80,208,48,176,112,240,8,136,72,200,40,168,104,232,24,152,88,216,56,184,120,248,4,132,68,196,36,164,100,228,20,148,84,212,52,180,116,244,12,140,76,204,44,172,108,236,28,156,92,220,60,188,124,252,2,130,66,194,34,162,98,226,18,146,82,210,50,178,114,242,10,138,74,202,42,170,106,234,26,154,90,218,58,186,122,250,6,134,70,198,38,166,102,230,22,150,86,214,54,182,118,246,14,142,78,206,46,174,110,238,30,158,94,222,62,190,126,254,1,129,65,193,33,161,97,225,17,145,81,209,49,177,113,241,9,137,73,201,41,169,105,233,25,153,89,217,57,185,121,249,5,133,69,197,37,165,101,229,21,149,85,213,53,181,117,245,13,141,77,205,45,173,109,237,29,157,93,221,61,189,125,253,3,131,67,195,35,163,99,227,19,147,83,211,51,179,115,243,11,139,75,203,43,171,107,235,27,155,91,219,59,187,123,251,7,135,71,199,39,167,103,231,23,151,87,215,55,183,119,247,15,143,79,207,47,175,111,239,31,159,95,223,63,191,127,255,};
+
+static const uint32_t //
+WUFFS_DEFLATE__LCODE_MAGIC_NUMBERS[32]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {1073741824,1073742080,1073742336,1073742592,1073742848,1073743104,1073743360,1073743616,1073743888,1073744400,1073744912,1073745424,1073745952,1073746976,1073748000,1073749024,1073750064,1073752112,1073754160,1073756208,1073758272,1073762368,1073766464,1073770560,1073774672,1073782864,1073791056,1073799248,1073807104,134217728,134217728,134217728,};
+
+static const uint32_t //
+WUFFS_DEFLATE__DCODE_MAGIC_NUMBERS[32]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {1073741824,1073742080,1073742336,1073742592,1073742864,1073743376,1073743904,1073744928,1073745968,1073748016,1073750080,1073754176,1073758288,1073766480,1073774688,1073791072,1073807472,1073840240,1073873024,1073938560,1074004112,1074135184,1074266272,1074528416,1074790576,1075314864,1075839168,1076887744,1077936336,1080033488,134217728,134217728,};
+
+static const uint32_t //
+WUFFS_DEFLATE__FIXED_LCODE_HUFFS[512]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {536870919,2147504136,2147487752,1073770568,1073749031,2147512328,2147495944,2147532809,1073743623,2147508232,2147491848,2147524617,2147483656,2147516424,2147500040,2147541001,1073742599,2147506184,2147489800,2147520521,1073756215,2147514376,2147497992,2147536905,1073745431,2147510280,2147493896,2147528713,2147485704,2147518472,2147502088,2147545097,1073742087,2147505160,2147488776,1073799256,1073752119,2147513352,2147496968,2147534857,1073744407,2147509256,2147492872,2147526665,2147484680,2147517448,2147501064,2147543049,1073743111,2147507208,2147490824,2147522569,1073762375,2147515400,2147499016,2147538953,1073746983,2147511304,2147494920,2147530761,2147486728,2147519496,2147503112,2147547145,1073741831,2147504648,2147488264,1073782872,1073750071,2147512840,2147496456,2147533833,1073743895,2147508744,2147492360,2147525641,2147484168,2147516936,2147500552,2147542025,1073742855,2147506696,2147490312,2147521545,1073758279,2147514888,2147498504,2147537929,1073745959,2147510792,2147494408,2147529737,2147486216,2147518984,2147502600,2147546121,1073742343,2147505672,2147489288,134217736,1073754167,2147513864,2147497480,2147535881,1073744919,2147509768,2147493384,2147527689,2147485192,2147517960,2147501576,2147544073,1073743367,2147507720,2147491336,2147523593,1073766471,2147515912,2147499528,2147539977,1073748007,2147511816,2147495432,2147531785,2147487240,2147520008,2147503624,2147548169,536870919,2147504392,2147488008,1073774680,1073749031,2147512584,2147496200,2147533321,1073743623,2147508488,2147492104,2147525129,2147483912,2147516680,2147500296,2147541513,1073742599,2147506440,2147490056,2147521033,1073756215,2147514632,2147498248,2147537417,1073745431,2147510536,2147494152,2147529225,2147485960,2147518728,2147502344,2147545609,1073742087,2147505416,2147489032,1073807112,1073752119,2147513608,2147497224,2147535369,1073744407,2147509512,2147493128,2147527177,2147484936,2147517704,2147501320,2147543561,1073743111,2147507464,2147491080,2147523081,1073762375,2147515656,2147499272,2147539465,1073746983,2147511560,2147495176,2147531273,2147486984,2147519752,2147503368,2147547657,1073741831,2147504904,2147488520,1073791064,1073750071,2147513096,2147496712,2147534345,1073743895,2147509000,2147492616,2147526153,2147484424,2147517192,2147500808,2147542537,1073742855,2147506952,2147490568,2147522057,1073758279,2147515144,2147498760,2147538441,1073745959,2147511048,2147494664,2147530249,2147486472,2147519240,2147502856,2147546633,1073742343,2147505928,2147489544,134217736,1073754167,2147514120,2147497736,2147536393,1073744919,2147510024,2147493640,2147528201,2147485448,2147518216,2147501832,2147544585,1073743367,2147507976,2147491592,2147524105,1073766471,2147516168,2147499784,2147540489,1073748007,2147512072,2147495688,2147532297,2147487496,2147520264,2147503880,2147548681,536870919,2147504136,2147487752,1073770568,1073749031,2147512328,2147495944,2147533065,1073743623,2147508232,2147491848,2147524873,2147483656,2147516424,2147500040,2147541257,1073742599,2147506184,2147489800,2147520777,1073756215,2147514376,2147497992,2147537161,1073745431,2147510280,2147493896,2147528969,2147485704,2147518472,2147502088,2147545353,1073742087,2147505160,2147488776,1073799256,1073752119,2147513352,2147496968,2147535113,1073744407,2147509256,2147492872,2147526921,2147484680,2147517448,2147501064,2147543305,1073743111,2147507208,2147490824,2147522825,1073762375,2147515400,2147499016,2147539209,1073746983,2147511304,2147494920,2147531017,2147486728,2147519496,2147503112,2147547401,1073741831,2147504648,2147488264,1073782872,1073750071,2147512840,2147496456,2147534089,1073743895,2147508744,2147492360,2147525897,2147484168,2147516936,2147500552,2147542281,1073742855,2147506696,2147490312,2147521801,1073758279,2147514888,2147498504,2147538185,1073745959,2147510792,2147494408,2147529993,2147486216,2147518984,2147502600,2147546377,1073742343,2147505672,2147489288,134217736,1073754167,2147513864,2147497480,2147536137,1073744919,2147509768,2147493384,2147527945,2147485192,2147517960,2147501576,2147544329,1073743367,2147507720,2147491336,2147523849,1073766471,2147515912,2147499528,2147540233,1073748007,2147511816,2147495432,2147532041,2147487240,2147520008,2147503624,2147548425,536870919,2147504392,2147488008,1073774680,1073749031,2147512584,2147496200,2147533577,1073743623,2147508488,2147492104,2147525385,2147483912,2147516680,2147500296,2147541769,1073742599,2147506440,2147490056,2147521289,1073756215,2147514632,2147498248,2147537673,1073745431,2147510536,2147494152,2147529481,2147485960,2147518728,2147502344,2147545865,1073742087,2147505416,2147489032,1073807112,1073752119,2147513608,2147497224,2147535625,1073744407,2147509512,2147493128,2147527433,2147484936,2147517704,2147501320,2147543817,1073743111,2147507464,2147491080,2147523337,1073762375,2147515656,2147499272,2147539721,1073746983,2147511560,2147495176,2147531529,2147486984,2147519752,2147503368,2147547913,1073741831,2147504904,2147488520,1073791064,1073750071,2147513096,2147496712,2147534601,1073743895,2147509000,2147492616,2147526409,2147484424,2147517192,2147500808,2147542793,1073742855,2147506952,2147490568,2147522313,1073758279,2147515144,2147498760,2147538697,1073745959,2147511048,2147494664,2147530505,2147486472,2147519240,2147502856,2147546889,1073742343,2147505928,2147489544,134217736,1073754167,2147514120,2147497736,2147536649,1073744919,2147510024,2147493640,2147528457,2147485448,2147518216,2147501832,2147544841,1073743367,2147507976,2147491592,2147524361,1073766471,2147516168,2147499784,2147540745,1073748007,2147512072,2147495688,2147532553,2147487496,2147520264,2147503880,2147548937,};
+
+static const uint32_t //
+WUFFS_DEFLATE__FIXED_DCODE_HUFFS[32]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {1073741829,1073807477,1073745973,1074790581,1073742869,1074004117,1073758293,1077936341,1073742341,1073873029,1073750085,1075839173,1073743909,1074266277,1073774693,134217733,1073742085,1073840245,1073748021,1075314869,1073743381,1074135189,1073766485,1080033493,1073742597,1073938565,1073754181,1076887749,1073744933,1074528421,1073791077,134217733,};
+
+#define WUFFS_DEFLATE__HUFFS_TABLE_SIZE 1024
+
+#define WUFFS_DEFLATE__HUFFS_TABLE_MASK 1023
+
+static const uint32_t //
+WUFFS_DEFLATE__LEVEL_MAX_CHAINS[10]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,4,8,32,16,32,128,256,1024,4096,};
+
+static const uint32_t //
+WUFFS_DEFLATE__LEVEL_NICE_LENGTHS[10]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,8,16,32,16,32,128,128,258,258,};
+
+static const uint32_t //
+WUFFS_DEFLATE__LEVEL_GOOD_LENGTHS[10]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,4,4,4,4,8,8,8,32,32,};
+
+static const uint32_t //
+WUFFS_DEFLATE__LEVEL_MAX_LAZYS[10]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,4,5,6,4,16,16,32,128,258,};
+
+static const uint8_t //
+WUFFS_DEFLATE__LENGTH_CODES[256]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,1,2,3,4,5,6,7,8,8,9,9,10,10,11,11,12,12,12,12,13,13,13,13,14,14,14,14,15,15,15,15,16,16,16,16,16,16,16,16,17,17,17,17,17,17,17,17,18,18,18,18,18,18,18,18,19,19,19,19,19,19,19,19,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,28,};
+
+static const uint8_t //
+WUFFS_DEFLATE__DISTANCE_CODES[512]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,1,2,3,4,4,5,5,6,6,6,6,7,7,7,7,8,8,8,8,8,8,8,8,9,9,9,9,9,9,9,9,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,0,14,16,17,18,18,19,19,20,20,20,20,21,21,21,21,22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,};
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static wuffs_base__status //
+wuffs_deflate__decoder__decode_blocks(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_deflate__decoder__decode_uncompressed(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__decoder__init_fixed_huffman(wuffs_deflate__decoder *self);
+
+static wuffs_base__status //
+wuffs_deflate__decoder__init_dynamic_huffman(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status//
+wuffs_deflate__decoder__init_huff(wuffs_deflate__decoder *self,uint32_t a_which,uint32_t a_n_codes0,uint32_t a_n_codes1,uint32_t a_base_symbol);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__decoder__init_literal_pairs(wuffs_deflate__decoder *self);
+
+static wuffs_base__status//
+wuffs_deflate__decoder__decode_huffman_fast(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_deflate__decoder__decode_huffman_slow(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__put_bits(wuffs_deflate__encoder *self,uint32_t a_value,uint32_t a_n);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__flush_bits(wuffs_deflate__encoder *self);
+
+static uint32_t//
+wuffs_deflate__encoder__insert(wuffs_deflate__encoder *self,uint32_t a_p);
+
+static uint32_t//
+wuffs_deflate__encoder__longest_match(wuffs_deflate__encoder *self,uint32_t a_p,uint32_t a_cand,uint32_t a_max_length,uint32_t a_prev_length);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__add_literal(wuffs_deflate__encoder *self,uint8_t a_x);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__add_match(wuffs_deflate__encoder *self,uint32_t a_length,uint32_t a_distance);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__lz77_greedy(wuffs_deflate__encoder *self,uint32_t a_end);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__lz77_lazy(wuffs_deflate__encoder *self,uint32_t a_end);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__build_huffman(wuffs_deflate__encoder *self,uint32_t a_which,uint32_t a_n,uint32_t a_max_bits);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__assign_codes(wuffs_deflate__encoder *self,uint32_t a_which,uint32_t a_n);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__init_fixed_codes(wuffs_deflate__encoder *self);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__add_cl_op(wuffs_deflate__encoder *self,uint32_t a_sym,uint32_t a_extra);
+
+static uint64_t//
+wuffs_deflate__encoder__build_code_length_code(wuffs_deflate__encoder *self);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__write_dynamic_header(wuffs_deflate__encoder *self);
+
+static uint64_t//
+wuffs_deflate__encoder__symbols_cost(const wuffs_deflate__encoder *self);
+
+static uint64_t//
+wuffs_deflate__encoder__extra_bits_cost(const wuffs_deflate__encoder *self);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__write_symbols(wuffs_deflate__encoder *self);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__write_stored_block(wuffs_deflate__encoder *self,uint32_t a_final,uint32_t a_end);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__compress_block(wuffs_deflate__encoder *self,bool a_final);
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__slide_if_full(wuffs_deflate__encoder *self);
+
+// ---------------- VTables
+
+const wuffs_base__io_transformer__func_ptrs wuffs_deflate__decoder__func_ptrs_for__wuffs_base__io_transformer = {(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_deflate__decoder__set_quirk_enabled),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__io_buffer*,wuffs_base__slice_u8))(&wuffs_deflate__decoder__transform_io),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_deflate__decoder__workbuf_len),
+};
+
+const wuffs_base__io_transformer__func_ptrs wuffs_deflate__encoder__func_ptrs_for__wuffs_base__io_transformer = {(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_deflate__encoder__set_quirk_enabled),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__io_buffer*,wuffs_base__slice_u8))(&wuffs_deflate__encoder__transform_io),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_deflate__encoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_deflate__decoder__initialize(wuffs_deflate__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__io_transformer.vtable_name = wuffs_base__io_transformer__vtable_name;
+self->private_impl.vtable_for__wuffs_base__io_transformer.function_pointers = (const void*)(&wuffs_deflate__decoder__func_ptrs_for__wuffs_base__io_transformer);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_deflate__decoder*  //
+wuffs_deflate__decoder__alloc(){
+wuffs_deflate__decoder* x = (wuffs_deflate__decoder*)(calloc(sizeof(wuffs_deflate__decoder), 1));
+if (!x) { return NULL; }
+if (wuffs_deflate__decoder__initialize(x, sizeof(wuffs_deflate__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_deflate__decoder(){ return sizeof(wuffs_deflate__decoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_deflate__decoder__stats  //
+wuffs_deflate__decoder__get_stats(const wuffs_deflate__decoder* self) {
+wuffs_deflate__decoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_deflate__encoder__initialize(wuffs_deflate__encoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__io_transformer.vtable_name = wuffs_base__io_transformer__vtable_name;
+self->private_impl.vtable_for__wuffs_base__io_transformer.function_pointers = (const void*)(&wuffs_deflate__encoder__func_ptrs_for__wuffs_base__io_transformer);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_deflate__encoder*  //
+wuffs_deflate__encoder__alloc(){
+wuffs_deflate__encoder* x = (wuffs_deflate__encoder*)(calloc(sizeof(wuffs_deflate__encoder), 1));
+if (!x) { return NULL; }
+if (wuffs_deflate__encoder__initialize(x, sizeof(wuffs_deflate__encoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_deflate__encoder(){ return sizeof(wuffs_deflate__encoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_deflate__encoder__stats  //
+wuffs_deflate__encoder__get_stats(const wuffs_deflate__encoder* self) {
+wuffs_deflate__encoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func deflate.decoder.add_history
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__decoder__add_history(wuffs_deflate__decoder *self,wuffs_base__slice_u8 a_hist){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 0);
+
+wuffs_base__slice_u8 v_s = {0};
+uint64_t v_n_copied = 0;
+uint32_t v_already_full = 0;
+
+v_s = a_hist;
+if (((uint64_t)(v_s.len)) >= 32768) {
+v_s = wuffs_base__slice_u8__suffix(v_s,32768);
+wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_data.f_history, 33025),32768),v_s);
+self->private_impl.f_history_index = 32768;
+} else {
+v_n_copied = wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_history, 33025),(self->private_impl.f_history_index & 32767),32768),v_s);
+if (v_n_copied < ((uint64_t)(v_s.len))) {
+v_s = wuffs_base__slice_u8__subslice_i(v_s,v_n_copied);
+v_n_copied = wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_data.f_history, 33025),32768),v_s);
+self->private_impl.f_history_index = (((uint32_t)((v_n_copied & 32767))) + 32768);
+} else {
+v_already_full = 0;
+if (self->private_impl.f_history_index >= 32768) {
+v_already_full = 32768;
+}
+self->private_impl.f_history_index = ((self->private_impl.f_history_index & 32767) + ((uint32_t)((v_n_copied & 32767))) + v_already_full);
+}
+}
+wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_i(wuffs_base__make_slice_u8(self->private_data.f_history, 33025),32768),wuffs_base__make_slice_u8(self->private_data.f_history, 33025));
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.decoder.set_dst_holds_history
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__decoder__set_dst_holds_history(wuffs_deflate__decoder *self,bool a_h){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 1);
+
+
+self->private_impl.f_dst_holds_history = a_h;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.decoder.set_suspend_at_block_boundaries
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__decoder__set_suspend_at_block_boundaries(wuffs_deflate__decoder *self,bool a_s){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 2);
+
+
+self->private_impl.f_suspend_at_block_boundaries = a_s;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.decoder.num_buffered_bits
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_deflate__decoder__num_buffered_bits(const wuffs_deflate__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+return self->private_impl.f_n_bits;}
+
+// -------- func deflate.decoder.prime
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__decoder__prime(wuffs_deflate__decoder *self,uint32_t a_n_bits,uint32_t a_bits){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+if (a_n_bits > 7) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_empty_struct();
+}
+WUFFS_BASE__STATS__CALL(self, 3);
+
+
+self->private_impl.f_n_bits = a_n_bits;
+self->private_impl.f_bits = ((a_bits) & WUFFS_BASE__LOW_BITS_MASK__U32(a_n_bits));
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.decoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__decoder__set_quirk_enabled(wuffs_deflate__decoder *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_deflate__decoder__workbuf_len(const wuffs_deflate__decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__make_range_ii_u64(1,1);}
+
+// -------- func deflate.decoder.transform_io
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_deflate__decoder__transform_io(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 5);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint64_t v_mark = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+
+uint32_t coro_susp_point = self->private_impl.p_transform_io[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (true) {
+v_mark = ((uint64_t)(iop_a_dst - io0_a_dst));
+{
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+wuffs_base__status t_0 = wuffs_deflate__decoder__decode_blocks(self,a_dst,a_src);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+v_status = t_0;
+}
+if ( ! wuffs_base__status__is_suspension(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+if ( ! self->private_impl.f_dst_holds_history) {
+wuffs_deflate__decoder__add_history(self,wuffs_base__io__since(v_mark, ((uint64_t)(iop_a_dst - io0_a_dst)), io0_a_dst));
+}
+status = v_status;WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+}
+
+goto ok;ok:self->private_impl.p_transform_io[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_transform_io[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 5, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func deflate.decoder.decode_blocks
+
+static wuffs_base__status //
+wuffs_deflate__decoder__decode_blocks(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 6);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_final = 0;
+uint32_t v_b0 = 0;
+uint32_t v_type = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+bool v_seen_block = false;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_blocks[0];
+if (coro_susp_point) {
+v_final = self->private_data.s_decode_blocks[0].v_final;
+v_seen_block = self->private_data.s_decode_blocks[0].v_seen_block;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+label__outer__continue:;
+while (v_final == 0) {
+if (v_seen_block && self->private_impl.f_suspend_at_block_boundaries) {
+status = wuffs_base__make_status(wuffs_deflate__suspension__block_boundary);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+}
+v_seen_block = true;
+while (self->private_impl.f_n_bits < 3) {
+{
+uint32_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_b0 = t_0;
+}
+self->private_impl.f_bits |= (v_b0 << self->private_impl.f_n_bits);
+self->private_impl.f_n_bits += 8;
+}
+v_final = (self->private_impl.f_bits & 1);
+v_type = ((self->private_impl.f_bits >> 1) & 3);
+self->private_impl.f_bits >>= 3;
+self->private_impl.f_n_bits -= 3;
+if (v_type == 0) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_deflate__decoder__decode_uncompressed(self,a_dst,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+goto label__outer__continue;
+} else if (v_type == 1) {
+wuffs_deflate__decoder__init_fixed_huffman(self);
+} else if (v_type == 2) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+status = wuffs_deflate__decoder__init_dynamic_huffman(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_block);goto exit;}
+self->private_impl.f_end_of_block = false;
+while (true) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+v_status = wuffs_deflate__decoder__decode_huffman_fast(self,a_dst,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (wuffs_base__status__is_error(&v_status)) {
+status = v_status;goto exit;}
+if (self->private_impl.f_end_of_block) {
+goto label__outer__continue;
+}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+status = wuffs_deflate__decoder__decode_huffman_slow(self,a_dst,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+if (self->private_impl.f_end_of_block) {
+goto label__outer__continue;
+}
+}
+}
+
+goto ok;ok:self->private_impl.p_decode_blocks[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_blocks[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_blocks[0].v_final = v_final;
+self->private_data.s_decode_blocks[0].v_seen_block = v_seen_block;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func deflate.decoder.decode_uncompressed
+
+static wuffs_base__status //
+wuffs_deflate__decoder__decode_uncompressed(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 7);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_length = 0;
+uint32_t v_n_copied = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_uncompressed[0];
+if (coro_susp_point) {
+v_length = self->private_data.s_decode_uncompressed[0].v_length;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if ((self->private_impl.f_n_bits >= 8) || ((self->private_impl.f_bits >> (self->private_impl.f_n_bits & 7)) != 0)) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_n_bits);goto exit;}
+self->private_impl.f_n_bits = 0;
+self->private_impl.f_bits = 0;
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+uint32_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_0 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_uncompressed[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_uncompressed[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;if (num_bits_0 == 24) { t_0 = ((uint32_t)(*scratch));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0)) << 56;}}
+v_length = t_0;
+}
+if ((((v_length) & 0xFFFF) + ((v_length) >> (32 - (16)))) != 65535) {
+status = wuffs_base__make_status(wuffs_deflate__error__inconsistent_stored_block_length);goto exit;}
+v_length = ((v_length) & 0xFFFF);
+while (true) {
+v_n_copied = wuffs_base__io_writer__copy_n32_from_reader(&iop_a_dst, io2_a_dst,v_length, &iop_a_src, io2_a_src);
+if (v_length <= v_n_copied) {
+status = wuffs_base__make_status(NULL);goto ok;}
+v_length -= v_n_copied;
+if (((uint64_t)(io2_a_dst - iop_a_dst)) == 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(3);
+} else {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(4);
+}
+}
+
+goto ok;ok:self->private_impl.p_decode_uncompressed[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_uncompressed[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_uncompressed[0].v_length = v_length;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 7, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func deflate.decoder.init_fixed_huffman
+
+static wuffs_base__empty_struct //
+wuffs_deflate__decoder__init_fixed_huffman(wuffs_deflate__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 8);
+
+uint32_t v_i = 0;
+
+while (v_i < 512) {
+self->private_data.f_huffs[0][v_i] = WUFFS_DEFLATE__FIXED_LCODE_HUFFS[v_i];
+v_i += 1;
+}
+v_i = 0;
+while (v_i < 32) {
+self->private_data.f_huffs[1][v_i] = WUFFS_DEFLATE__FIXED_DCODE_HUFFS[v_i];
+v_i += 1;
+}
+self->private_impl.f_n_huffs_bits[0] = 9;
+self->private_impl.f_n_huffs_bits[1] = 5;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.decoder.init_dynamic_huffman
+
+static wuffs_base__status //
+wuffs_deflate__decoder__init_dynamic_huffman(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 9);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_bits = 0;
+uint32_t v_n_bits = 0;
+uint32_t v_b0 = 0;
+uint32_t v_n_lit = 0;
+uint32_t v_n_dist = 0;
+uint32_t v_n_clen = 0;
+uint32_t v_i = 0;
+uint32_t v_b1 = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+uint32_t v_mask = 0;
+uint32_t v_table_entry = 0;
+uint32_t v_table_entry_n_bits = 0;
+uint32_t v_b2 = 0;
+uint32_t v_n_extra_bits = 0;
+uint8_t v_rep_symbol = 0;
+uint32_t v_rep_count = 0;
+uint32_t v_b3 = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_init_dynamic_huffman[0];
+if (coro_susp_point) {
+v_bits = self->private_data.s_init_dynamic_huffman[0].v_bits;
+v_n_bits = self->private_data.s_init_dynamic_huffman[0].v_n_bits;
+v_n_lit = self->private_data.s_init_dynamic_huffman[0].v_n_lit;
+v_n_dist = self->private_data.s_init_dynamic_huffman[0].v_n_dist;
+v_n_clen = self->private_data.s_init_dynamic_huffman[0].v_n_clen;
+v_i = self->private_data.s_init_dynamic_huffman[0].v_i;
+v_mask = self->private_data.s_init_dynamic_huffman[0].v_mask;
+v_table_entry = self->private_data.s_init_dynamic_huffman[0].v_table_entry;
+v_n_extra_bits = self->private_data.s_init_dynamic_huffman[0].v_n_extra_bits;
+v_rep_symbol = self->private_data.s_init_dynamic_huffman[0].v_rep_symbol;
+v_rep_count = self->private_data.s_init_dynamic_huffman[0].v_rep_count;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+v_bits = self->private_impl.f_bits;
+v_n_bits = self->private_impl.f_n_bits;
+while (v_n_bits < 14) {
+{
+uint32_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_b0 = t_0;
+}
+v_bits |= (v_b0 << v_n_bits);
+v_n_bits += 8;
+}
+v_n_lit = (((v_bits) & 0x1F) + 257);
+if (v_n_lit > 286) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_literal_length_code_count);goto exit;}
+v_bits >>= 5;
+v_n_dist = (((v_bits) & 0x1F) + 1);
+if (v_n_dist > 30) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_distance_code_count);goto exit;}
+v_bits >>= 5;
+v_n_clen = (((v_bits) & 0xF) + 4);
+v_bits >>= 4;
+v_n_bits -= 14;
+v_i = 0;
+while (v_i < v_n_clen) {
+while (v_n_bits < 3) {
+{
+uint32_t t_1;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_1 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_1 = *iop_a_src++;
+}
+v_b1 = t_1;
+}
+v_bits |= (v_b1 << v_n_bits);
+v_n_bits += 8;
+}
+self->private_data.f_code_lengths[WUFFS_DEFLATE__CODE_ORDER[v_i]] = ((uint8_t)((v_bits & 7)));
+v_bits >>= 3;
+v_n_bits -= 3;
+v_i += 1;
+}
+while (v_i < 19) {
+self->private_data.f_code_lengths[WUFFS_DEFLATE__CODE_ORDER[v_i]] = 0;
+v_i += 1;
+}
+v_status = wuffs_deflate__decoder__init_huff(self,0,0,19,4095);
+if (wuffs_base__status__is_error(&v_status)) {
+status = v_status;goto exit;}
+v_mask = ((((uint32_t)(1)) << self->private_impl.f_n_huffs_bits[0]) - 1);
+v_i = 0;
+label__0__continue:;
+while (v_i < (v_n_lit + v_n_dist)) {
+while (true) {
+v_table_entry = self->private_data.f_huffs[0][(v_bits & v_mask)];
+v_table_entry_n_bits = (v_table_entry & 15);
+if (v_n_bits >= v_table_entry_n_bits) {
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+goto label__1__break;
+}
+{
+uint32_t t_2;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_2 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_2 = *iop_a_src++;
+}
+v_b2 = t_2;
+}
+v_bits |= (v_b2 << v_n_bits);
+v_n_bits += 8;
+}
+label__1__break:;
+if ((v_table_entry >> 24) != 128) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);goto exit;}
+v_table_entry = ((v_table_entry >> 8) & 255);
+if (v_table_entry < 16) {
+self->private_data.f_code_lengths[v_i] = ((uint8_t)(v_table_entry));
+v_i += 1;
+goto label__0__continue;
+}
+v_n_extra_bits = 0;
+v_rep_symbol = 0;
+v_rep_count = 0;
+if (v_table_entry == 16) {
+v_n_extra_bits = 2;
+if (v_i <= 0) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_huffman_code_length_repetition);goto exit;}
+v_rep_symbol = (self->private_data.f_code_lengths[(v_i - 1)] & 15);
+v_rep_count = 3;
+} else if (v_table_entry == 17) {
+v_n_extra_bits = 3;
+v_rep_symbol = 0;
+v_rep_count = 3;
+} else if (v_table_entry == 18) {
+v_n_extra_bits = 7;
+v_rep_symbol = 0;
+v_rep_count = 11;
+} else {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);goto exit;}
+while (v_n_bits < v_n_extra_bits) {
+{
+uint32_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+v_b3 = t_3;
+}
+v_bits |= (v_b3 << v_n_bits);
+v_n_bits += 8;
+}
+v_rep_count += ((v_bits) & WUFFS_BASE__LOW_BITS_MASK__U32(v_n_extra_bits));
+v_bits >>= v_n_extra_bits;
+v_n_bits -= v_n_extra_bits;
+while (v_rep_count > 0) {
+if (v_i >= (v_n_lit + v_n_dist)) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_huffman_code_length_count);goto exit;}
+self->private_data.f_code_lengths[v_i] = v_rep_symbol;
+v_i += 1;
+v_rep_count -= 1;
+}
+}
+if (v_i != (v_n_lit + v_n_dist)) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_huffman_code_length_count);goto exit;}
+if (self->private_data.f_code_lengths[256] == 0) {
+status = wuffs_base__make_status(wuffs_deflate__error__missing_end_of_block_code);goto exit;}
+v_status = wuffs_deflate__decoder__init_huff(self,0,0,v_n_lit,257);
+if (wuffs_base__status__is_error(&v_status)) {
+status = v_status;goto exit;}
+v_status = wuffs_deflate__decoder__init_huff(self,1,v_n_lit,(v_n_lit + v_n_dist),0);
+if (wuffs_base__status__is_error(&v_status)) {
+status = v_status;goto exit;}
+self->private_impl.f_bits = v_bits;
+self->private_impl.f_n_bits = v_n_bits;
+
+goto ok;ok:self->private_impl.p_init_dynamic_huffman[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_init_dynamic_huffman[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_init_dynamic_huffman[0].v_bits = v_bits;
+self->private_data.s_init_dynamic_huffman[0].v_n_bits = v_n_bits;
+self->private_data.s_init_dynamic_huffman[0].v_n_lit = v_n_lit;
+self->private_data.s_init_dynamic_huffman[0].v_n_dist = v_n_dist;
+self->private_data.s_init_dynamic_huffman[0].v_n_clen = v_n_clen;
+self->private_data.s_init_dynamic_huffman[0].v_i = v_i;
+self->private_data.s_init_dynamic_huffman[0].v_mask = v_mask;
+self->private_data.s_init_dynamic_huffman[0].v_table_entry = v_table_entry;
+self->private_data.s_init_dynamic_huffman[0].v_n_extra_bits = v_n_extra_bits;
+self->private_data.s_init_dynamic_huffman[0].v_rep_symbol = v_rep_symbol;
+self->private_data.s_init_dynamic_huffman[0].v_rep_count = v_rep_count;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func deflate.decoder.init_huff
+
+static wuffs_base__status//
+wuffs_deflate__decoder__init_huff(wuffs_deflate__decoder *self,uint32_t a_which,uint32_t a_n_codes0,uint32_t a_n_codes1,uint32_t a_base_symbol){
+WUFFS_BASE__STATS__CALL(self, 10);
+
+uint16_t v_counts[16] = {0};
+uint32_t v_i = 0;
+uint32_t v_remaining = 0;
+uint16_t v_offsets[16] = {0};
+uint32_t v_n_symbols = 0;
+uint32_t v_count = 0;
+uint16_t v_symbols[320] = {0};
+uint32_t v_min_cl = 0;
+uint32_t v_max_cl = 0;
+uint32_t v_initial_high_bits = 0;
+uint32_t v_prev_cl = 0;
+uint32_t v_prev_redirect_key = 0;
+uint32_t v_top = 0;
+uint32_t v_next_top = 0;
+uint32_t v_code = 0;
+uint32_t v_key = 0;
+uint32_t v_value = 0;
+uint32_t v_cl = 0;
+uint32_t v_redirect_key = 0;
+uint32_t v_j = 0;
+uint32_t v_reversed_key = 0;
+uint32_t v_symbol = 0;
+uint32_t v_high_bits = 0;
+uint32_t v_delta = 0;
+
+v_i = a_n_codes0;
+while (v_i < a_n_codes1) {
+if (v_counts[(self->private_data.f_code_lengths[v_i] & 15)] >= 320) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+v_counts[(self->private_data.f_code_lengths[v_i] & 15)] += 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+v_i += 1;
+}
+if ((((uint32_t)(v_counts[0])) + a_n_codes0) == a_n_codes1) {
+return wuffs_base__make_status(wuffs_deflate__error__no_huffman_codes);}
+v_remaining = 1;
+v_i = 1;
+while (v_i <= 15) {
+if (v_remaining > 1073741824) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+v_remaining <<= 1;
+if (v_remaining < ((uint32_t)(v_counts[v_i]))) {
+return wuffs_base__make_status(wuffs_deflate__error__bad_huffman_code_over_subscribed);}
+v_remaining -= ((uint32_t)(v_counts[v_i]));
+v_i += 1;
+}
+if (v_remaining != 0) {
+if ((a_which == 1) && (v_counts[1] == 1) && ((((uint32_t)(v_counts[0])) + a_n_codes0 + 1) == a_n_codes1)) {
+v_i = a_n_codes0;
+while (v_i < a_n_codes1) {
+if (self->private_data.f_code_lengths[v_i] != 0) {
+goto label__0__break;
+}
+v_i += 1;
+}
+label__0__break:;
+self->private_impl.f_n_huffs_bits[1] = 1;
+self->private_data.f_huffs[1][0] = (WUFFS_DEFLATE__DCODE_MAGIC_NUMBERS[((v_i - a_n_codes0) & 31)] | 1);
+self->private_data.f_huffs[1][1] = (WUFFS_DEFLATE__DCODE_MAGIC_NUMBERS[31] | 1);
+return wuffs_base__make_status(NULL);}
+return wuffs_base__make_status(wuffs_deflate__error__bad_huffman_code_under_subscribed);}
+v_i = 1;
+while (v_i <= 15) {
+v_offsets[v_i] = ((uint16_t)(v_n_symbols));
+v_count = ((uint32_t)(v_counts[v_i]));
+if (v_n_symbols > (320 - v_count)) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+v_n_symbols = (v_n_symbols + v_count);
+v_i += 1;
+}
+if (v_n_symbols > 288) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+v_i = a_n_codes0;
+while (v_i < a_n_codes1) {
+if (v_i < a_n_codes0) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+if (self->private_data.f_code_lengths[v_i] != 0) {
+if (v_offsets[(self->private_data.f_code_lengths[v_i] & 15)] >= 320) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+v_symbols[v_offsets[(self->private_data.f_code_lengths[v_i] & 15)]] = ((uint16_t)((v_i - a_n_codes0)));
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+v_offsets[(self->private_data.f_code_lengths[v_i] & 15)] += 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+}
+v_i += 1;
+}
+v_min_cl = 1;
+while (true) {
+if (v_counts[v_min_cl] != 0) {
+goto label__1__break;
+}
+if (v_min_cl >= 9) {
+return wuffs_base__make_status(wuffs_deflate__error__bad_huffman_minimum_code_length);}
+v_min_cl += 1;
+}
+label__1__break:;
+v_max_cl = 15;
+while (true) {
+if (v_counts[v_max_cl] != 0) {
+goto label__2__break;
+}
+if (v_max_cl <= 1) {
+return wuffs_base__make_status(wuffs_deflate__error__no_huffman_codes);}
+v_max_cl -= 1;
+}
+label__2__break:;
+if (v_max_cl <= 9) {
+self->private_impl.f_n_huffs_bits[a_which] = v_max_cl;
+} else {
+self->private_impl.f_n_huffs_bits[a_which] = 9;
+}
+v_i = 0;
+if ((v_n_symbols != ((uint32_t)(v_offsets[v_max_cl]))) || (v_n_symbols != ((uint32_t)(v_offsets[15])))) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+if ((a_n_codes0 + ((uint32_t)(v_symbols[0]))) >= 320) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+v_initial_high_bits = 512;
+if (v_max_cl < 9) {
+v_initial_high_bits = (((uint32_t)(1)) << v_max_cl);
+}
+v_prev_cl = ((uint32_t)((self->private_data.f_code_lengths[(a_n_codes0 + ((uint32_t)(v_symbols[0])))] & 15)));
+v_prev_redirect_key = 4294967295;
+v_top = 0;
+v_next_top = 512;
+v_code = 0;
+v_key = 0;
+v_value = 0;
+while (true) {
+if ((a_n_codes0 + ((uint32_t)(v_symbols[v_i]))) >= 320) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+v_cl = ((uint32_t)((self->private_data.f_code_lengths[(a_n_codes0 + ((uint32_t)(v_symbols[v_i])))] & 15)));
+if (v_cl > v_prev_cl) {
+v_code <<= (v_cl - v_prev_cl);
+if (v_code >= 32768) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+}
+v_prev_cl = v_cl;
+v_key = v_code;
+if (v_cl > 9) {
+v_cl -= 9;
+v_redirect_key = ((v_key >> v_cl) & 511);
+v_key = ((v_key) & WUFFS_BASE__LOW_BITS_MASK__U32(v_cl));
+if (v_prev_redirect_key != v_redirect_key) {
+v_prev_redirect_key = v_redirect_key;
+v_remaining = (((uint32_t)(1)) << v_cl);
+v_j = v_prev_cl;
+while (v_j <= 15) {
+if (v_remaining <= ((uint32_t)(v_counts[v_j]))) {
+goto label__3__break;
+}
+v_remaining -= ((uint32_t)(v_counts[v_j]));
+if (v_remaining > 1073741824) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+v_remaining <<= 1;
+v_j += 1;
+}
+label__3__break:;
+if ((v_j <= 9) || (15 < v_j)) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+v_j -= 9;
+v_initial_high_bits = (((uint32_t)(1)) << v_j);
+v_top = v_next_top;
+if ((v_top + (((uint32_t)(1)) << v_j)) > 1024) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+v_next_top = (v_top + (((uint32_t)(1)) << v_j));
+v_redirect_key = (((uint32_t)(WUFFS_DEFLATE__REVERSE8[(v_redirect_key >> 1)])) | ((v_redirect_key & 1) << 8));
+self->private_data.f_huffs[a_which][v_redirect_key] = (268435465 | (v_top << 8) | (v_j << 4));
+}
+}
+if ((v_key >= 512) || (v_counts[v_prev_cl] <= 0)) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+v_counts[v_prev_cl] -= 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+v_reversed_key = (((uint32_t)(WUFFS_DEFLATE__REVERSE8[(v_key >> 1)])) | ((v_key & 1) << 8));
+v_reversed_key >>= (9 - v_cl);
+v_symbol = ((uint32_t)(v_symbols[v_i]));
+if (v_symbol == 256) {
+v_value = (536870912 | v_cl);
+} else if ((v_symbol < 256) && (a_which == 0)) {
+v_value = (2147483648 | (v_symbol << 8) | v_cl);
+} else if (v_symbol >= a_base_symbol) {
+v_symbol -= a_base_symbol;
+if (a_which == 0) {
+v_value = (WUFFS_DEFLATE__LCODE_MAGIC_NUMBERS[(v_symbol & 31)] | v_cl);
+} else {
+v_value = (WUFFS_DEFLATE__DCODE_MAGIC_NUMBERS[(v_symbol & 31)] | v_cl);
+}
+} else {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+v_high_bits = v_initial_high_bits;
+v_delta = (((uint32_t)(1)) << v_cl);
+while (v_high_bits >= v_delta) {
+v_high_bits -= v_delta;
+if ((v_top + ((v_high_bits | v_reversed_key) & 511)) >= 1024) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+self->private_data.f_huffs[a_which][(v_top + ((v_high_bits | v_reversed_key) & 511))] = v_value;
+}
+v_i += 1;
+if (v_i >= v_n_symbols) {
+goto label__4__break;
+}
+v_code += 1;
+if (v_code >= 32768) {
+return wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);}
+}
+label__4__break:;
+if ((a_which == 0) && (a_base_symbol == 257)) {
+wuffs_deflate__decoder__init_literal_pairs(self);
+}
+return wuffs_base__make_status(NULL);}
+
+// -------- func deflate.decoder.init_literal_pairs
+
+static wuffs_base__empty_struct //
+wuffs_deflate__decoder__init_literal_pairs(wuffs_deflate__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 11);
+
+uint32_t v_n_max = 0;
+uint32_t v_i = 0;
+uint32_t v_e0 = 0;
+uint32_t v_e1 = 0;
+uint32_t v_e0_bits = 0;
+uint32_t v_e1_bits = 0;
+
+v_n_max = self->private_impl.f_n_huffs_bits[0];
+v_i = (((uint32_t)(1)) << v_n_max);
+while (v_i > 0) {
+v_i -= 1;
+v_e0 = self->private_data.f_huffs[0][v_i];
+v_e0_bits = (v_e0 & 15);
+if (((v_e0 >> 24) == 128) && (v_e0_bits < v_n_max)) {
+v_e1 = self->private_data.f_huffs[0][(v_i >> v_e0_bits)];
+v_e1_bits = (v_e1 & 15);
+if (((v_e1 >> 24) == 128) && ((v_e0_bits + v_e1_bits) <= v_n_max)) {
+self->private_data.f_huffs[0][v_i] = (2214592512 | ((v_e1 & 65280) << 8) | (v_e0 & 65280) | (v_e0_bits << 4) | (v_e0_bits + v_e1_bits));
+}
+}
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.decoder.decode_huffman_fast
+
+static wuffs_base__status//
+wuffs_deflate__decoder__decode_huffman_fast(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 12);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint64_t v_bits = 0;
+uint32_t v_n_bits = 0;
+uint32_t v_table_entry = 0;
+uint32_t v_table_entry_n_bits = 0;
+uint64_t v_lmask = 0;
+uint64_t v_dmask = 0;
+uint32_t v_redir_top = 0;
+uint32_t v_redir_mask = 0;
+uint32_t v_length = 0;
+uint32_t v_dist_minus_1 = 0;
+uint32_t v_hlen = 0;
+uint32_t v_hdist = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+if ((self->private_impl.f_n_bits >= 8) || ((self->private_impl.f_bits >> (self->private_impl.f_n_bits & 7)) != 0)) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_n_bits);goto exit;}
+v_bits = ((uint64_t)(self->private_impl.f_bits));
+v_n_bits = self->private_impl.f_n_bits;
+v_lmask = ((((uint64_t)(1)) << self->private_impl.f_n_huffs_bits[0]) - 1);
+v_dmask = ((((uint64_t)(1)) << self->private_impl.f_n_huffs_bits[1]) - 1);
+label__loop__continue:;
+while ((((uint64_t)(io2_a_dst - iop_a_dst)) >= 266) && (((uint64_t)(io2_a_src - iop_a_src)) >= 8)) {
+v_bits |= (wuffs_base__load_u64le__no_bounds_check(iop_a_src) << (v_n_bits & 63));
+(iop_a_src += ((63 - (v_n_bits & 63)) >> 3), wuffs_base__make_empty_struct());
+v_n_bits |= 56;
+v_table_entry = self->private_data.f_huffs[0][(v_bits & v_lmask)];
+v_table_entry_n_bits = (v_table_entry & 15);
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+if ((v_table_entry >> 31) != 0) {
+if ((v_table_entry >> 26) == 33) {
+(wuffs_base__store_u16le__no_bounds_check(iop_a_dst,((uint16_t)(((v_table_entry >> 8) & 65535)))), iop_a_dst += 2, wuffs_base__make_empty_struct());
+} else {
+(wuffs_base__store_u8be__no_bounds_check(iop_a_dst,((uint8_t)(((v_table_entry >> 8) & 255)))), iop_a_dst += 1, wuffs_base__make_empty_struct());
+}
+goto label__loop__continue;
+} else if ((v_table_entry >> 30) != 0) {
+} else if ((v_table_entry >> 29) != 0) {
+self->private_impl.f_end_of_block = true;
+goto label__loop__break;
+} else if ((v_table_entry >> 28) != 0) {
+v_redir_top = ((v_table_entry >> 8) & 65535);
+v_redir_mask = ((((uint32_t)(1)) << ((v_table_entry >> 4) & 15)) - 1);
+v_table_entry = self->private_data.f_huffs[0][((v_redir_top + (((uint32_t)((v_bits & 32767))) & v_redir_mask)) & 1023)];
+v_table_entry_n_bits = (v_table_entry & 15);
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+if ((v_table_entry >> 31) != 0) {
+(wuffs_base__store_u8be__no_bounds_check(iop_a_dst,((uint8_t)(((v_table_entry >> 8) & 255)))), iop_a_dst += 1, wuffs_base__make_empty_struct());
+goto label__loop__continue;
+} else if ((v_table_entry >> 30) != 0) {
+} else if ((v_table_entry >> 29) != 0) {
+self->private_impl.f_end_of_block = true;
+goto label__loop__break;
+} else if ((v_table_entry >> 28) != 0) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);goto exit;} else if ((v_table_entry >> 27) != 0) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_huffman_code);goto exit;} else {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);goto exit;}
+} else if ((v_table_entry >> 27) != 0) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_huffman_code);goto exit;} else {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);goto exit;}
+v_length = (((v_table_entry >> 8) & 255) + 3);
+v_table_entry_n_bits = ((v_table_entry >> 4) & 15);
+if (v_table_entry_n_bits > 0) {
+v_length = (((v_length + 253 + ((uint32_t)(((v_bits) & WUFFS_BASE__LOW_BITS_MASK__U64(v_table_entry_n_bits))))) & 255) + 3);
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+}
+v_table_entry = self->private_data.f_huffs[1][(v_bits & v_dmask)];
+v_table_entry_n_bits = (v_table_entry & 15);
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+if ((v_table_entry >> 28) == 1) {
+v_redir_top = ((v_table_entry >> 8) & 65535);
+v_redir_mask = ((((uint32_t)(1)) << ((v_table_entry >> 4) & 15)) - 1);
+v_table_entry = self->private_data.f_huffs[1][((v_redir_top + (((uint32_t)((v_bits & 32767))) & v_redir_mask)) & 1023)];
+v_table_entry_n_bits = (v_table_entry & 15);
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+}
+if ((v_table_entry >> 24) != 64) {
+if ((v_table_entry >> 24) == 8) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_huffman_code);goto exit;}
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);goto exit;}
+v_dist_minus_1 = ((v_table_entry >> 8) & 32767);
+v_table_entry_n_bits = ((v_table_entry >> 4) & 15);
+v_dist_minus_1 = ((v_dist_minus_1 + ((uint32_t)(((v_bits) & WUFFS_BASE__LOW_BITS_MASK__U64(v_table_entry_n_bits))))) & 32767);
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+while (true) {
+if (((uint64_t)((v_dist_minus_1 + 1))) > ((uint64_t)(iop_a_dst - io0_a_dst))) {
+v_hlen = 0;
+v_hdist = ((uint32_t)((((uint64_t)((v_dist_minus_1 + 1))) - ((uint64_t)(iop_a_dst - io0_a_dst)))));
+if (v_length > v_hdist) {
+v_length -= v_hdist;
+v_hlen = v_hdist;
+} else {
+v_hlen = v_length;
+v_length = 0;
+}
+if (self->private_impl.f_history_index < v_hdist) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_distance);goto exit;}
+v_hdist = (self->private_impl.f_history_index - v_hdist);
+wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,v_hlen,wuffs_base__slice_u8__subslice_i(wuffs_base__make_slice_u8(self->private_data.f_history, 33025),(v_hdist & 32767)));
+if (v_length == 0) {
+goto label__loop__continue;
+}
+if (((uint64_t)((v_dist_minus_1 + 1))) > ((uint64_t)(iop_a_dst - io0_a_dst))) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_distance);goto exit;}
+}
+if ((v_dist_minus_1 + 1) >= 8) {
+wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast(&iop_a_dst, io0_a_dst, io2_a_dst,v_length,(v_dist_minus_1 + 1));
+} else if ((v_dist_minus_1 + 1) == 1) {
+wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_distance_1_fast(&iop_a_dst, io0_a_dst, io2_a_dst,v_length,(v_dist_minus_1 + 1));
+} else {
+wuffs_base__io_writer__copy_n32_from_history_fast(&iop_a_dst, io0_a_dst, io2_a_dst,v_length,(v_dist_minus_1 + 1));
+}
+goto label__0__break;
+}
+label__0__break:;
+}
+label__loop__break:;
+if (v_n_bits > 63) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_n_bits);goto exit;}
+while (v_n_bits >= 8) {
+v_n_bits -= 8;
+if (iop_a_src > io1_a_src) {
+(iop_a_src--, wuffs_base__make_empty_struct());
+} else {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_i_o);goto exit;}
+}
+self->private_impl.f_bits = ((uint32_t)((v_bits & ((((uint64_t)(1)) << v_n_bits) - 1))));
+self->private_impl.f_n_bits = v_n_bits;
+if ((self->private_impl.f_n_bits >= 8) || ((self->private_impl.f_bits >> self->private_impl.f_n_bits) != 0)) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_n_bits);goto exit;}
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 12, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func deflate.decoder.decode_huffman_slow
+
+static wuffs_base__status //
+wuffs_deflate__decoder__decode_huffman_slow(wuffs_deflate__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 13);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_bits = 0;
+uint32_t v_n_bits = 0;
+uint32_t v_table_entry = 0;
+uint32_t v_table_entry_n_bits = 0;
+uint32_t v_lmask = 0;
+uint32_t v_dmask = 0;
+uint32_t v_b0 = 0;
+uint32_t v_redir_top = 0;
+uint32_t v_redir_mask = 0;
+uint32_t v_b1 = 0;
+uint32_t v_length = 0;
+uint32_t v_b2 = 0;
+uint32_t v_b3 = 0;
+uint32_t v_b4 = 0;
+uint32_t v_dist_minus_1 = 0;
+uint32_t v_b5 = 0;
+uint32_t v_n_copied = 0;
+uint32_t v_hlen = 0;
+uint32_t v_hdist = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_huffman_slow[0];
+if (coro_susp_point) {
+v_bits = self->private_data.s_decode_huffman_slow[0].v_bits;
+v_n_bits = self->private_data.s_decode_huffman_slow[0].v_n_bits;
+v_table_entry = self->private_data.s_decode_huffman_slow[0].v_table_entry;
+v_table_entry_n_bits = self->private_data.s_decode_huffman_slow[0].v_table_entry_n_bits;
+v_lmask = self->private_data.s_decode_huffman_slow[0].v_lmask;
+v_dmask = self->private_data.s_decode_huffman_slow[0].v_dmask;
+v_redir_top = self->private_data.s_decode_huffman_slow[0].v_redir_top;
+v_redir_mask = self->private_data.s_decode_huffman_slow[0].v_redir_mask;
+v_length = self->private_data.s_decode_huffman_slow[0].v_length;
+v_dist_minus_1 = self->private_data.s_decode_huffman_slow[0].v_dist_minus_1;
+v_hlen = self->private_data.s_decode_huffman_slow[0].v_hlen;
+v_hdist = self->private_data.s_decode_huffman_slow[0].v_hdist;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if ((self->private_impl.f_n_bits >= 8) || ((self->private_impl.f_bits >> (self->private_impl.f_n_bits & 7)) != 0)) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_n_bits);goto exit;}
+v_bits = self->private_impl.f_bits;
+v_n_bits = self->private_impl.f_n_bits;
+v_lmask = ((((uint32_t)(1)) << self->private_impl.f_n_huffs_bits[0]) - 1);
+v_dmask = ((((uint32_t)(1)) << self->private_impl.f_n_huffs_bits[1]) - 1);
+label__loop__continue:;
+while ( ! (self->private_impl.p_decode_huffman_slow[0] != 0)) {
+while (true) {
+v_table_entry = self->private_data.f_huffs[0][(v_bits & v_lmask)];
+v_table_entry_n_bits = (v_table_entry & 15);
+if ((v_table_entry >> 26) == 33) {
+v_table_entry_n_bits = ((v_table_entry >> 4) & 15);
+}
+if (v_n_bits >= v_table_entry_n_bits) {
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+goto label__0__break;
+}
+{
+uint32_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_b0 = t_0;
+}
+v_bits |= (v_b0 << v_n_bits);
+v_n_bits += 8;
+}
+label__0__break:;
+if ((v_table_entry >> 31) != 0) {
+if (WUFFS_BASE__LIKELY(iop_a_dst < io2_a_dst)) {*iop_a_dst++ = ((uint8_t)(((v_table_entry >> 8) & 255)));
+} else {self->private_data.s_decode_huffman_slow[0].scratch = ((uint8_t)(((v_table_entry >> 8) & 255)));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (iop_a_dst == io2_a_dst) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write); goto suspend; }
+*iop_a_dst++ = ((uint8_t)(self->private_data.s_decode_huffman_slow[0].scratch));
+}
+goto label__loop__continue;
+} else if ((v_table_entry >> 30) != 0) {
+} else if ((v_table_entry >> 29) != 0) {
+self->private_impl.f_end_of_block = true;
+goto label__loop__break;
+} else if ((v_table_entry >> 28) != 0) {
+v_redir_top = ((v_table_entry >> 8) & 65535);
+v_redir_mask = ((((uint32_t)(1)) << ((v_table_entry >> 4) & 15)) - 1);
+while (true) {
+v_table_entry = self->private_data.f_huffs[0][((v_redir_top + (v_bits & v_redir_mask)) & 1023)];
+v_table_entry_n_bits = (v_table_entry & 15);
+if (v_n_bits >= v_table_entry_n_bits) {
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+goto label__1__break;
+}
+{
+uint32_t t_1;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_1 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_1 = *iop_a_src++;
+}
+v_b1 = t_1;
+}
+v_bits |= (v_b1 << v_n_bits);
+v_n_bits += 8;
+}
+label__1__break:;
+if ((v_table_entry >> 31) != 0) {
+if (WUFFS_BASE__LIKELY(iop_a_dst < io2_a_dst)) {*iop_a_dst++ = ((uint8_t)(((v_table_entry >> 8) & 255)));
+} else {self->private_data.s_decode_huffman_slow[0].scratch = ((uint8_t)(((v_table_entry >> 8) & 255)));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+if (iop_a_dst == io2_a_dst) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write); goto suspend; }
+*iop_a_dst++ = ((uint8_t)(self->private_data.s_decode_huffman_slow[0].scratch));
+}
+goto label__loop__continue;
+} else if ((v_table_entry >> 30) != 0) {
+} else if ((v_table_entry >> 29) != 0) {
+self->private_impl.f_end_of_block = true;
+goto label__loop__break;
+} else if ((v_table_entry >> 28) != 0) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);goto exit;} else if ((v_table_entry >> 27) != 0) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_huffman_code);goto exit;} else {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);goto exit;}
+} else if ((v_table_entry >> 27) != 0) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_huffman_code);goto exit;} else {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);goto exit;}
+v_length = (((v_table_entry >> 8) & 255) + 3);
+v_table_entry_n_bits = ((v_table_entry >> 4) & 15);
+if (v_table_entry_n_bits > 0) {
+while (v_n_bits < v_table_entry_n_bits) {
+{
+uint32_t t_2;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_2 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_2 = *iop_a_src++;
+}
+v_b2 = t_2;
+}
+v_bits |= (v_b2 << v_n_bits);
+v_n_bits += 8;
+}
+v_length = (((v_length + 253 + ((v_bits) & WUFFS_BASE__LOW_BITS_MASK__U32(v_table_entry_n_bits))) & 255) + 3);
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+}
+while (true) {
+v_table_entry = self->private_data.f_huffs[1][(v_bits & v_dmask)];
+v_table_entry_n_bits = (v_table_entry & 15);
+if (v_n_bits >= v_table_entry_n_bits) {
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+goto label__2__break;
+}
+{
+uint32_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+v_b3 = t_3;
+}
+v_bits |= (v_b3 << v_n_bits);
+v_n_bits += 8;
+}
+label__2__break:;
+if ((v_table_entry >> 28) == 1) {
+v_redir_top = ((v_table_entry >> 8) & 65535);
+v_redir_mask = ((((uint32_t)(1)) << ((v_table_entry >> 4) & 15)) - 1);
+while (true) {
+v_table_entry = self->private_data.f_huffs[1][((v_redir_top + (v_bits & v_redir_mask)) & 1023)];
+v_table_entry_n_bits = (v_table_entry & 15);
+if (v_n_bits >= v_table_entry_n_bits) {
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+goto label__3__break;
+}
+{
+uint32_t t_4;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_4 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_4 = *iop_a_src++;
+}
+v_b4 = t_4;
+}
+v_bits |= (v_b4 << v_n_bits);
+v_n_bits += 8;
+}
+label__3__break:;
+}
+if ((v_table_entry >> 24) != 64) {
+if ((v_table_entry >> 24) == 8) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_huffman_code);goto exit;}
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_huffman_decoder_state);goto exit;}
+v_dist_minus_1 = ((v_table_entry >> 8) & 32767);
+v_table_entry_n_bits = ((v_table_entry >> 4) & 15);
+if (v_table_entry_n_bits > 0) {
+while (v_n_bits < v_table_entry_n_bits) {
+{
+uint32_t t_5;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_5 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_5 = *iop_a_src++;
+}
+v_b5 = t_5;
+}
+v_bits |= (v_b5 << v_n_bits);
+v_n_bits += 8;
+}
+v_dist_minus_1 = ((v_dist_minus_1 + ((v_bits) & WUFFS_BASE__LOW_BITS_MASK__U32(v_table_entry_n_bits))) & 32767);
+v_bits >>= v_table_entry_n_bits;
+v_n_bits -= v_table_entry_n_bits;
+}
+while (true) {
+if (((uint64_t)((v_dist_minus_1 + 1))) > ((uint64_t)(iop_a_dst - io0_a_dst))) {
+v_hdist = ((uint32_t)((((uint64_t)((v_dist_minus_1 + 1))) - ((uint64_t)(iop_a_dst - io0_a_dst)))));
+if (v_length > v_hdist) {
+v_length -= v_hdist;
+v_hlen = v_hdist;
+} else {
+v_hlen = v_length;
+v_length = 0;
+}
+if (self->private_impl.f_history_index < v_hdist) {
+status = wuffs_base__make_status(wuffs_deflate__error__bad_distance);goto exit;}
+v_hdist = (self->private_impl.f_history_index - v_hdist);
+while (true) {
+v_n_copied = wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,v_hlen,wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_history, 33025),(v_hdist & 32767),32768));
+if (v_hlen <= v_n_copied) {
+v_hlen = 0;
+goto label__4__break;
+}
+if (v_n_copied > 0) {
+v_hlen -= v_n_copied;
+v_hdist = ((v_hdist + v_n_copied) & 32767);
+if (v_hdist == 0) {
+goto label__4__break;
+}
+}
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(9);
+}
+label__4__break:;
+if (v_hlen > 0) {
+while (true) {
+v_n_copied = wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,v_hlen,wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_history, 33025),(v_hdist & 32767),32768));
+if (v_hlen <= v_n_copied) {
+v_hlen = 0;
+goto label__5__break;
+}
+v_hlen -= v_n_copied;
+v_hdist += v_n_copied;
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(10);
+}
+label__5__break:;
+}
+if (v_length == 0) {
+goto label__loop__continue;
+}
+}
+v_n_copied = wuffs_base__io_writer__copy_n32_from_history(&iop_a_dst, io0_a_dst, io2_a_dst,v_length,(v_dist_minus_1 + 1));
+if (v_length <= v_n_copied) {
+v_length = 0;
+goto label__6__break;
+}
+v_length -= v_n_copied;
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(11);
+}
+label__6__break:;
+}
+label__loop__break:;
+self->private_impl.f_bits = v_bits;
+self->private_impl.f_n_bits = v_n_bits;
+if ((self->private_impl.f_n_bits >= 8) || ((self->private_impl.f_bits >> (self->private_impl.f_n_bits & 7)) != 0)) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_n_bits);goto exit;}
+
+goto ok;ok:self->private_impl.p_decode_huffman_slow[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_huffman_slow[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_huffman_slow[0].v_bits = v_bits;
+self->private_data.s_decode_huffman_slow[0].v_n_bits = v_n_bits;
+self->private_data.s_decode_huffman_slow[0].v_table_entry = v_table_entry;
+self->private_data.s_decode_huffman_slow[0].v_table_entry_n_bits = v_table_entry_n_bits;
+self->private_data.s_decode_huffman_slow[0].v_lmask = v_lmask;
+self->private_data.s_decode_huffman_slow[0].v_dmask = v_dmask;
+self->private_data.s_decode_huffman_slow[0].v_redir_top = v_redir_top;
+self->private_data.s_decode_huffman_slow[0].v_redir_mask = v_redir_mask;
+self->private_data.s_decode_huffman_slow[0].v_length = v_length;
+self->private_data.s_decode_huffman_slow[0].v_dist_minus_1 = v_dist_minus_1;
+self->private_data.s_decode_huffman_slow[0].v_hlen = v_hlen;
+self->private_data.s_decode_huffman_slow[0].v_hdist = v_hdist;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 13, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func deflate.encoder.set_level
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__encoder__set_level(wuffs_deflate__encoder *self,uint32_t a_level){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 0);
+
+uint32_t v_l = 0;
+
+v_l = 9;
+if (a_level < 9) {
+v_l = a_level;
+}
+self->private_impl.f_level_is_set = true;
+self->private_impl.f_level_is_stored = (v_l == 0);
+self->private_impl.f_level_is_lazy = (v_l >= 4);
+self->private_impl.f_max_chain = WUFFS_DEFLATE__LEVEL_MAX_CHAINS[v_l];
+self->private_impl.f_nice_length = WUFFS_DEFLATE__LEVEL_NICE_LENGTHS[v_l];
+self->private_impl.f_good_length = WUFFS_DEFLATE__LEVEL_GOOD_LENGTHS[v_l];
+self->private_impl.f_max_lazy = WUFFS_DEFLATE__LEVEL_MAX_LAZYS[v_l];
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_deflate__encoder__set_quirk_enabled(wuffs_deflate__encoder *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_deflate__encoder__workbuf_len(const wuffs_deflate__encoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__make_range_ii_u64(0,0);}
+
+// -------- func deflate.encoder.transform_io
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_deflate__encoder__transform_io(wuffs_deflate__encoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 2);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+wuffs_base__slice_u8 v_s = {0};
+uint64_t v_n = 0;
+uint32_t v_limit = 0;
+uint32_t v_x = 0;
+bool v_final = false;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_transform_io[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if ( ! self->private_impl.f_level_is_set) {
+wuffs_deflate__encoder__set_level(self,6);
+}
+label__0__continue:;
+while (true) {
+while (self->private_impl.f_out_wi > 0) {
+if (self->private_impl.f_out_ri > self->private_impl.f_out_wi) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_i_o);goto exit;}
+v_s = wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_out, 32768),self->private_impl.f_out_ri,self->private_impl.f_out_wi);
+v_n = wuffs_base__io_writer__copy_from_slice(&iop_a_dst, io2_a_dst,v_s);
+if (v_n == ((uint64_t)(v_s.len))) {
+self->private_impl.f_out_ri = 0;
+self->private_impl.f_out_wi = 0;
+goto label__1__break;
+}
+self->private_impl.f_out_ri = ((self->private_impl.f_out_ri + ((uint32_t)((v_n & 4294967295)))) & 32767);
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+}
+label__1__break:;
+if (self->private_impl.f_end_of_stream) {
+status = wuffs_base__make_status(NULL);goto ok;} else if (self->private_impl.f_inconsistent) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_encoder_state);goto exit;}
+v_limit = 65536;
+if (self->private_impl.f_block_start < 49152) {
+v_limit = (self->private_impl.f_block_start + 16384);
+}
+if (self->private_impl.f_buf_len < v_limit) {
+v_n = ((uint64_t)((v_limit - self->private_impl.f_buf_len)));
+v_n = wuffs_base__u64__min(v_n,((uint64_t)(io2_a_src - iop_a_src)));
+v_s = wuffs_base__io_reader__take(&iop_a_src, io2_a_src,v_n);
+v_n = wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_buf, 65794),self->private_impl.f_buf_len,v_limit),v_s);
+v_x = (self->private_impl.f_buf_len + ((uint32_t)((v_n & 65535))));
+if ((v_x > v_limit) || (v_x > 65536)) {
+status = wuffs_base__make_status(wuffs_deflate__error__internal_error_inconsistent_i_o);goto exit;}
+self->private_impl.f_buf_len = v_x;
+}
+v_final = false;
+if (self->private_impl.f_buf_len < v_limit) {
+if ( ! (a_src && a_src->meta.closed)) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+goto label__0__continue;
+}
+v_final = true;
+} else if ((a_src && a_src->meta.closed) && (((uint64_t)(io2_a_src - iop_a_src)) == 0)) {
+v_final = true;
+}
+wuffs_deflate__encoder__compress_block(self,v_final);
+if (v_final) {
+wuffs_deflate__encoder__flush_bits(self);
+self->private_impl.f_end_of_stream = true;
+}
+}
+
+goto ok;ok:self->private_impl.p_transform_io[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_transform_io[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 2, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func deflate.encoder.put_bits
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__put_bits(wuffs_deflate__encoder *self,uint32_t a_value,uint32_t a_n){
+WUFFS_BASE__STATS__CALL(self, 3);
+
+
+self->private_impl.f_bits |= (((uint64_t)(a_value)) << (self->private_impl.f_n_bits & 31));
+self->private_impl.f_n_bits = ((self->private_impl.f_n_bits & 31) + a_n);
+if (self->private_impl.f_n_bits >= 32) {
+if (self->private_impl.f_out_wi <= 32763) {
+self->private_data.f_out[(self->private_impl.f_out_wi + 0)] = ((uint8_t)((self->private_impl.f_bits & 255)));
+self->private_data.f_out[(self->private_impl.f_out_wi + 1)] = ((uint8_t)(((self->private_impl.f_bits >> 8) & 255)));
+self->private_data.f_out[(self->private_impl.f_out_wi + 2)] = ((uint8_t)(((self->private_impl.f_bits >> 16) & 255)));
+self->private_data.f_out[(self->private_impl.f_out_wi + 3)] = ((uint8_t)(((self->private_impl.f_bits >> 24) & 255)));
+self->private_impl.f_out_wi += 4;
+} else {
+self->private_impl.f_inconsistent = true;
+}
+self->private_impl.f_bits >>= 32;
+self->private_impl.f_n_bits -= 32;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.flush_bits
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__flush_bits(wuffs_deflate__encoder *self){
+WUFFS_BASE__STATS__CALL(self, 4);
+
+
+while (self->private_impl.f_n_bits > 0) {
+if (self->private_impl.f_out_wi <= 32766) {
+self->private_data.f_out[self->private_impl.f_out_wi] = ((uint8_t)((self->private_impl.f_bits & 255)));
+self->private_impl.f_out_wi += 1;
+} else {
+self->private_impl.f_inconsistent = true;
+}
+self->private_impl.f_bits >>= 8;
+if (self->private_impl.f_n_bits <= 8) {
+goto label__0__break;
+}
+self->private_impl.f_n_bits -= 8;
+}
+label__0__break:;
+self->private_impl.f_bits = 0;
+self->private_impl.f_n_bits = 0;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.insert
+
+static uint32_t//
+wuffs_deflate__encoder__insert(wuffs_deflate__encoder *self,uint32_t a_p){
+WUFFS_BASE__STATS__CALL(self, 5);
+
+uint32_t v_h = 0;
+
+v_h = (((((uint32_t)(self->private_data.f_buf[a_p])) | (((uint32_t)(self->private_data.f_buf[(a_p + 1)])) << 8) | (((uint32_t)(self->private_data.f_buf[(a_p + 2)])) << 16)) * 506832829) >> 17);
+self->private_impl.f_prev[(a_p & 32767)] = self->private_impl.f_head[v_h];
+self->private_impl.f_head[v_h] = ((uint16_t)(a_p));
+return ((uint32_t)(self->private_impl.f_prev[(a_p & 32767)]));}
+
+// -------- func deflate.encoder.longest_match
+
+static uint32_t//
+wuffs_deflate__encoder__longest_match(wuffs_deflate__encoder *self,uint32_t a_p,uint32_t a_cand,uint32_t a_max_length,uint32_t a_prev_length){
+WUFFS_BASE__STATS__CALL(self, 6);
+
+uint32_t v_c = 0;
+uint32_t v_next = 0;
+uint32_t v_limit = 0;
+uint32_t v_chain = 0;
+uint32_t v_best_len = 0;
+uint32_t v_k = 0;
+
+v_best_len = a_prev_length;
+if (v_best_len >= a_max_length) {
+return v_best_len;}
+v_chain = self->private_impl.f_max_chain;
+if (v_best_len >= self->private_impl.f_good_length) {
+v_chain = (v_chain >> 2);
+}
+if (a_p > 32768) {
+v_limit = (a_p - 32768);
+}
+v_c = (a_cand & 65535);
+while (true) {
+if ((v_c >= a_p) || (v_c < v_limit)) {
+goto label__0__break;
+}
+if ((self->private_data.f_buf[(v_c + v_best_len)] == self->private_data.f_buf[(a_p + v_best_len)]) && (self->private_data.f_buf[v_c] == self->private_data.f_buf[a_p])) {
+v_k = 1;
+while ((v_k < a_max_length) && (self->private_data.f_buf[(v_c + v_k)] == self->private_data.f_buf[(a_p + v_k)])) {
+v_k += 1;
+}
+if (v_k > v_best_len) {
+v_best_len = v_k;
+self->private_impl.f_match_distance = (a_p - v_c);
+if (v_k >= self->private_impl.f_nice_length) {
+goto label__0__break;
+}
+if (v_k >= a_max_length) {
+goto label__0__break;
+}
+}
+}
+if (v_chain <= 1) {
+goto label__0__break;
+}
+v_chain -= 1;
+v_next = ((uint32_t)(self->private_impl.f_prev[(v_c & 32767)]));
+if (v_next >= v_c) {
+goto label__0__break;
+}
+v_c = v_next;
+}
+label__0__break:;
+return v_best_len;}
+
+// -------- func deflate.encoder.add_literal
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__add_literal(wuffs_deflate__encoder *self,uint8_t a_x){
+WUFFS_BASE__STATS__CALL(self, 7);
+
+
+if (self->private_impl.f_n_syms >= 16384) {
+self->private_impl.f_inconsistent = true;
+return wuffs_base__make_empty_struct();}
+self->private_data.f_syms[self->private_impl.f_n_syms] = ((uint32_t)(a_x));
+self->private_impl.f_n_syms += 1;
+self->private_data.f_freqs[0][a_x] += 1;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.add_match
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__add_match(wuffs_deflate__encoder *self,uint32_t a_length,uint32_t a_distance){
+WUFFS_BASE__STATS__CALL(self, 8);
+
+uint32_t v_l3 = 0;
+uint32_t v_d1 = 0;
+
+if ((self->private_impl.f_n_syms >= 16384) || (a_length < 3)) {
+self->private_impl.f_inconsistent = true;
+return wuffs_base__make_empty_struct();}
+v_l3 = (a_length - 3);
+v_d1 = ((a_distance - 1) & 32767);
+self->private_data.f_syms[self->private_impl.f_n_syms] = (2147483648 | (v_l3 << 16) | v_d1);
+self->private_impl.f_n_syms += 1;
+self->private_data.f_freqs[0][(257 + ((uint32_t)(WUFFS_DEFLATE__LENGTH_CODES[v_l3])))] += 1;
+if (v_d1 < 256) {
+self->private_data.f_freqs[1][WUFFS_DEFLATE__DISTANCE_CODES[v_d1]] += 1;
+} else {
+self->private_data.f_freqs[1][WUFFS_DEFLATE__DISTANCE_CODES[(256 + (v_d1 >> 7))]] += 1;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.lz77_greedy
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__lz77_greedy(wuffs_deflate__encoder *self,uint32_t a_end){
+WUFFS_BASE__STATS__CALL(self, 9);
+
+uint32_t v_p = 0;
+uint32_t v_q = 0;
+uint32_t v_c = 0;
+uint32_t v_max_len = 0;
+uint32_t v_len = 0;
+
+v_p = self->private_impl.f_block_start;
+label__0__continue:;
+while ((v_p < a_end) && (v_p < 65536)) {
+v_max_len = 258;
+if ((a_end - v_p) < 258) {
+v_max_len = (a_end - v_p);
+}
+v_len = 2;
+if (v_max_len >= 3) {
+v_c = wuffs_deflate__encoder__insert(self,v_p);
+v_len = wuffs_deflate__encoder__longest_match(self,v_p,v_c,v_max_len,2);
+if ((v_len == 3) && (self->private_impl.f_match_distance > 4096)) {
+v_len = 2;
+}
+}
+if (v_len < 3) {
+wuffs_deflate__encoder__add_literal(self,self->private_data.f_buf[v_p]);
+v_p += 1;
+goto label__0__continue;
+}
+wuffs_deflate__encoder__add_match(self,v_len,self->private_impl.f_match_distance);
+if (v_len <= self->private_impl.f_max_lazy) {
+v_q = (v_p + 1);
+v_p += v_len;
+while ((v_q < v_p) && (v_q < 65534)) {
+if ((v_q + 3) <= a_end) {
+wuffs_deflate__encoder__insert(self,v_q);
+}
+v_q += 1;
+}
+} else {
+v_p += v_len;
+}
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.lz77_lazy
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__lz77_lazy(wuffs_deflate__encoder *self,uint32_t a_end){
+WUFFS_BASE__STATS__CALL(self, 10);
+
+uint32_t v_p = 0;
+uint32_t v_q = 0;
+uint32_t v_c = 0;
+uint32_t v_max_len = 0;
+uint32_t v_cur_len = 0;
+uint32_t v_cur_dist = 0;
+uint32_t v_prev_len = 0;
+uint32_t v_prev_dist = 0;
+bool v_have_prev = false;
+
+v_prev_len = 2;
+v_p = self->private_impl.f_block_start;
+while ((v_p < a_end) && (v_p < 65536)) {
+v_max_len = 258;
+if ((a_end - v_p) < 258) {
+v_max_len = (a_end - v_p);
+}
+v_cur_len = 2;
+if (v_max_len >= 3) {
+v_c = wuffs_deflate__encoder__insert(self,v_p);
+if (v_prev_len < self->private_impl.f_max_lazy) {
+v_cur_len = wuffs_deflate__encoder__longest_match(self,v_p,v_c,v_max_len,v_prev_len);
+v_cur_dist = self->private_impl.f_match_distance;
+if ((v_cur_len == 3) && (v_cur_dist > 4096)) {
+v_cur_len = 2;
+}
+}
+}
+if ((v_prev_len >= 3) && (v_cur_len <= v_prev_len)) {
+wuffs_deflate__encoder__add_match(self,v_prev_len,v_prev_dist);
+v_q = (v_p + 1);
+v_p = ((v_p + v_prev_len) - 1);
+while ((v_q < v_p) && (v_q < 65534)) {
+if ((v_q + 3) <= a_end) {
+wuffs_deflate__encoder__insert(self,v_q);
+}
+v_q += 1;
+}
+v_have_prev = false;
+v_prev_len = 2;
+} else {
+if (v_have_prev) {
+wuffs_deflate__encoder__add_literal(self,self->private_data.f_buf[((v_p - 1) & 65535)]);
+}
+v_have_prev = true;
+v_prev_len = v_cur_len;
+v_prev_dist = v_cur_dist;
+v_p += 1;
+}
+}
+if (v_have_prev) {
+wuffs_deflate__encoder__add_literal(self,self->private_data.f_buf[((v_p - 1) & 65535)]);
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.build_huffman
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__build_huffman(wuffs_deflate__encoder *self,uint32_t a_which,uint32_t a_n,uint32_t a_max_bits){
+WUFFS_BASE__STATS__CALL(self, 11);
+
+uint32_t v_i = 0;
+uint32_t v_j = 0;
+uint32_t v_f = 0;
+uint32_t v_key = 0;
+uint32_t v_n_used = 0;
+uint32_t v_m = 0;
+uint32_t v_m_minus_1 = 0;
+uint32_t v_m_minus_2 = 0;
+uint32_t v_root = 0;
+uint32_t v_leaf = 0;
+uint32_t v_next = 0;
+uint32_t v_avbl = 0;
+uint32_t v_used = 0;
+uint32_t v_depth = 0;
+uint32_t v_total = 0;
+bool v_too_long = false;
+uint32_t v_len = 0;
+uint8_t v_lv = 0;
+
+v_i = 0;
+while (v_i < a_n) {
+self->private_data.f_lengths[a_which][v_i] = 0;
+if (self->private_data.f_freqs[a_which][v_i] > 0) {
+v_n_used += 1;
+}
+v_i += 1;
+}
+v_i = 0;
+while ((v_n_used < 2) && (v_i < a_n)) {
+if (self->private_data.f_freqs[a_which][v_i] == 0) {
+self->private_data.f_freqs[a_which][v_i] = 1;
+v_n_used += 1;
+}
+v_i += 1;
+}
+if ((v_n_used < 2) || (v_n_used > 288)) {
+self->private_impl.f_inconsistent = true;
+return wuffs_base__make_empty_struct();}
+v_n_used = 0;
+v_i = 0;
+while (v_i < a_n) {
+v_f = self->private_data.f_freqs[a_which][v_i];
+v_key = (((v_f & 8388607) << 9) | v_i);
+v_i += 1;
+if (v_f > 0) {
+v_j = v_n_used;
+while (v_j > 0) {
+if (self->private_data.f_hkeys[((v_j - 1) & 511)] <= v_key) {
+goto label__0__break;
+}
+self->private_data.f_hkeys[(v_j & 511)] = self->private_data.f_hkeys[((v_j - 1) & 511)];
+v_j -= 1;
+}
+label__0__break:;
+self->private_data.f_hkeys[(v_j & 511)] = v_key;
+v_n_used += 1;
+}
+}
+if ((v_n_used < 2) || (v_n_used > 288)) {
+self->private_impl.f_inconsistent = true;
+return wuffs_base__make_empty_struct();}
+v_m = v_n_used;
+v_m_minus_1 = (v_m - 1);
+v_m_minus_2 = (v_m - 2);
+v_j = 0;
+while (v_j < v_m) {
+self->private_data.f_hdepths[(v_j & 511)] = (self->private_data.f_hkeys[(v_j & 511)] >> 9);
+v_j += 1;
+}
+self->private_data.f_hdepths[0] += self->private_data.f_hdepths[1];
+v_root = 0;
+v_leaf = 2;
+v_next = 1;
+while (v_next < v_m_minus_1) {
+if ((v_leaf >= v_m) || (self->private_data.f_hdepths[(v_root & 511)] < self->private_data.f_hdepths[(v_leaf & 511)])) {
+self->private_data.f_hdepths[(v_next & 511)] = self->private_data.f_hdepths[(v_root & 511)];
+self->private_data.f_hdepths[(v_root & 511)] = v_next;
+v_root += 1;
+} else {
+self->private_data.f_hdepths[(v_next & 511)] = self->private_data.f_hdepths[(v_leaf & 511)];
+v_leaf += 1;
+}
+if ((v_leaf >= v_m) || ((v_root < v_next) && (self->private_data.f_hdepths[(v_root & 511)] < self->private_data.f_hdepths[(v_leaf & 511)]))) {
+self->private_data.f_hdepths[(v_next & 511)] += self->private_data.f_hdepths[(v_root & 511)];
+self->private_data.f_hdepths[(v_root & 511)] = v_next;
+v_root += 1;
+} else {
+self->private_data.f_hdepths[(v_next & 511)] += self->private_data.f_hdepths[(v_leaf & 511)];
+v_leaf += 1;
+}
+v_next += 1;
+}
+self->private_data.f_hdepths[v_m_minus_2] = 0;
+v_j = v_m_minus_2;
+while (v_j > 0) {
+v_j -= 1;
+self->private_data.f_hdepths[(v_j & 511)] = (self->private_data.f_hdepths[(self->private_data.f_hdepths[(v_j & 511)] & 511)] + 1);
+}
+v_avbl = 1;
+v_used = 0;
+v_depth = 0;
+v_root = v_m_minus_1;
+v_next = v_m;
+while ((v_avbl > 0) && (v_depth < 288)) {
+while ((v_root > 0) && (self->private_data.f_hdepths[((v_root - 1) & 511)] == v_depth)) {
+v_used += 1;
+v_root -= 1;
+}
+while ((v_avbl > v_used) && (v_next > 0)) {
+self->private_data.f_hdepths[((v_next - 1) & 511)] = v_depth;
+v_next -= 1;
+v_avbl -= 1;
+}
+v_avbl = (v_used * 2);
+v_depth += 1;
+v_used = 0;
+}
+v_i = 0;
+while (v_i < 16) {
+self->private_data.f_bl_count[v_i] = 0;
+v_i += 1;
+}
+v_j = 0;
+while (v_j < v_m) {
+v_f = self->private_data.f_hdepths[(v_j & 511)];
+if (v_f > a_max_bits) {
+v_f = a_max_bits;
+v_too_long = true;
+}
+self->private_data.f_bl_count[(v_f & 15)] += 1;
+v_j += 1;
+}
+if (v_too_long) {
+v_total = 0;
+v_len = a_max_bits;
+while (v_len > 0) {
+v_total += (self->private_data.f_bl_count[v_len] << ((a_max_bits - v_len) & 15));
+v_len -= 1;
+}
+while (v_total > (((uint32_t)(1)) << a_max_bits)) {
+self->private_data.f_bl_count[a_max_bits] -= 1;
+v_len = a_max_bits;
+while (v_len > 1) {
+v_i = v_len;
+v_len -= 1;
+if (self->private_data.f_bl_count[v_len] > 0) {
+self->private_data.f_bl_count[v_len] -= 1;
+self->private_data.f_bl_count[v_i] += 2;
+goto label__1__break;
+}
+}
+label__1__break:;
+v_total -= 1;
+}
+}
+v_j = 0;
+v_len = a_max_bits;
+while (v_len > 0) {
+v_f = self->private_data.f_bl_count[v_len];
+v_lv = ((uint8_t)((v_len & 15)));
+v_len -= 1;
+while ((v_f > 0) && (v_j < v_m)) {
+v_i = (self->private_data.f_hkeys[(v_j & 511)] & 511);
+if (v_i < 288) {
+self->private_data.f_lengths[a_which][v_i] = v_lv;
+}
+v_f -= 1;
+v_j += 1;
+}
+}
+wuffs_deflate__encoder__assign_codes(self,a_which,a_n);
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.assign_codes
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__assign_codes(wuffs_deflate__encoder *self,uint32_t a_which,uint32_t a_n){
+WUFFS_BASE__STATS__CALL(self, 12);
+
+uint32_t v_i = 0;
+uint32_t v_len = 0;
+uint32_t v_code = 0;
+uint32_t v_r = 0;
+
+v_i = 0;
+while (v_i < 16) {
+self->private_data.f_bl_count[v_i] = 0;
+v_i += 1;
+}
+v_i = 0;
+while (v_i < a_n) {
+self->private_data.f_bl_count[(self->private_data.f_lengths[a_which][v_i] & 15)] += 1;
+v_i += 1;
+}
+self->private_data.f_bl_count[0] = 0;
+v_i = 0;
+while (v_i < 15) {
+v_code = ((v_code + self->private_data.f_bl_count[v_i]) << 1);
+self->private_data.f_next_codes[(v_i + 1)] = v_code;
+v_i += 1;
+}
+v_i = 0;
+while (v_i < a_n) {
+v_len = ((uint32_t)((self->private_data.f_lengths[a_which][v_i] & 15)));
+if (v_len > 0) {
+v_code = self->private_data.f_next_codes[v_len];
+self->private_data.f_next_codes[v_len] = (v_code + 1);
+v_r = ((((uint32_t)(WUFFS_DEFLATE__REVERSE8[(v_code & 255)])) << 8) | ((uint32_t)(WUFFS_DEFLATE__REVERSE8[((v_code >> 8) & 255)])));
+self->private_data.f_codes[a_which][v_i] = ((uint16_t)(((v_r >> (16 - v_len)) & 65535)));
+}
+v_i += 1;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.init_fixed_codes
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__init_fixed_codes(wuffs_deflate__encoder *self){
+WUFFS_BASE__STATS__CALL(self, 13);
+
+uint32_t v_i = 0;
+
+v_i = 0;
+while (v_i < 144) {
+self->private_data.f_lengths[0][v_i] = 8;
+v_i += 1;
+}
+while (v_i < 256) {
+self->private_data.f_lengths[0][v_i] = 9;
+v_i += 1;
+}
+while (v_i < 280) {
+self->private_data.f_lengths[0][v_i] = 7;
+v_i += 1;
+}
+while (v_i < 288) {
+self->private_data.f_lengths[0][v_i] = 8;
+v_i += 1;
+}
+wuffs_deflate__encoder__assign_codes(self,0,288);
+v_i = 0;
+while (v_i < 32) {
+self->private_data.f_lengths[1][v_i] = 5;
+v_i += 1;
+}
+wuffs_deflate__encoder__assign_codes(self,1,32);
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.add_cl_op
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__add_cl_op(wuffs_deflate__encoder *self,uint32_t a_sym,uint32_t a_extra){
+WUFFS_BASE__STATS__CALL(self, 14);
+
+
+if (self->private_impl.f_n_cl_ops >= 316) {
+self->private_impl.f_inconsistent = true;
+return wuffs_base__make_empty_struct();}
+self->private_data.f_cl_ops[self->private_impl.f_n_cl_ops] = ((uint16_t)(((a_extra << 8) | a_sym)));
+self->private_impl.f_n_cl_ops += 1;
+self->private_data.f_freqs[2][a_sym] += 1;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.build_code_length_code
+
+static uint64_t//
+wuffs_deflate__encoder__build_code_length_code(wuffs_deflate__encoder *self){
+WUFFS_BASE__STATS__CALL(self, 15);
+
+uint32_t v_i = 0;
+uint32_t v_j = 0;
+uint32_t v_n = 0;
+uint32_t v_v = 0;
+uint32_t v_run = 0;
+uint32_t v_r = 0;
+uint32_t v_op = 0;
+uint32_t v_sym = 0;
+uint64_t v_cost = 0;
+
+self->private_impl.f_hlit = 286;
+while ((self->private_impl.f_hlit > 257) && (self->private_data.f_lengths[0][(self->private_impl.f_hlit - 1)] == 0)) {
+self->private_impl.f_hlit -= 1;
+}
+self->private_impl.f_hdist = 30;
+while ((self->private_impl.f_hdist > 1) && (self->private_data.f_lengths[1][(self->private_impl.f_hdist - 1)] == 0)) {
+self->private_impl.f_hdist -= 1;
+}
+v_i = 0;
+while (v_i < self->private_impl.f_hlit) {
+self->private_data.f_cl_seq[v_i] = self->private_data.f_lengths[0][v_i];
+v_i += 1;
+}
+v_n = 0;
+while ((v_n < self->private_impl.f_hdist) && (v_i < 316)) {
+self->private_data.f_cl_seq[v_i] = self->private_data.f_lengths[1][v_n];
+v_i += 1;
+v_n += 1;
+}
+v_n = v_i;
+v_i = 0;
+while (v_i < 19) {
+self->private_data.f_freqs[2][v_i] = 0;
+v_i += 1;
+}
+self->private_impl.f_n_cl_ops = 0;
+v_i = 0;
+while ((v_i < v_n) && (v_i < 316)) {
+v_v = ((uint32_t)((self->private_data.f_cl_seq[v_i] & 15)));
+v_j = (v_i + 1);
+while ((v_j < v_n) && (v_j < 316)) {
+if (((uint32_t)((self->private_data.f_cl_seq[v_j] & 15))) != v_v) {
+goto label__0__break;
+}
+v_j += 1;
+}
+label__0__break:;
+v_run = ((v_j - v_i) & 511);
+v_i = v_j;
+if (v_v == 0) {
+while (v_run >= 11) {
+v_r = wuffs_base__u32__min(v_run,138);
+wuffs_deflate__encoder__add_cl_op(self,18,((v_r - 11) & 127));
+v_run -= v_r;
+}
+if (v_run >= 3) {
+wuffs_deflate__encoder__add_cl_op(self,17,((v_run - 3) & 7));
+v_run = 0;
+}
+} else {
+wuffs_deflate__encoder__add_cl_op(self,v_v,0);
+v_run -= 1;
+while (v_run >= 3) {
+v_r = wuffs_base__u32__min(v_run,6);
+wuffs_deflate__encoder__add_cl_op(self,16,((v_r - 3) & 3));
+v_run -= v_r;
+}
+}
+while (v_run > 0) {
+wuffs_deflate__encoder__add_cl_op(self,v_v,0);
+v_run -= 1;
+}
+}
+wuffs_deflate__encoder__build_huffman(self,2,19,7);
+self->private_impl.f_hclen = 19;
+while ((self->private_impl.f_hclen > 4) && (self->private_data.f_lengths[2][WUFFS_DEFLATE__CODE_ORDER[(self->private_impl.f_hclen - 1)]] == 0)) {
+self->private_impl.f_hclen -= 1;
+}
+v_cost = (14 + (((uint64_t)(self->private_impl.f_hclen)) * 3));
+v_i = 0;
+while (v_i < self->private_impl.f_n_cl_ops) {
+v_op = ((uint32_t)(self->private_data.f_cl_ops[v_i]));
+v_sym = 18;
+if ((v_op & 255) < 18) {
+v_sym = (v_op & 255);
+}
+v_cost += ((uint64_t)((self->private_data.f_lengths[2][v_sym] & 15)));
+if (v_sym == 16) {
+v_cost += 2;
+} else if (v_sym == 17) {
+v_cost += 3;
+} else if (v_sym == 18) {
+v_cost += 7;
+}
+v_i += 1;
+}
+return v_cost;}
+
+// -------- func deflate.encoder.write_dynamic_header
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__write_dynamic_header(wuffs_deflate__encoder *self){
+WUFFS_BASE__STATS__CALL(self, 16);
+
+uint32_t v_i = 0;
+uint32_t v_op = 0;
+uint32_t v_sym = 0;
+uint32_t v_n_xtra = 0;
+
+wuffs_deflate__encoder__put_bits(self,(self->private_impl.f_hlit - 257),5);
+wuffs_deflate__encoder__put_bits(self,(self->private_impl.f_hdist - 1),5);
+wuffs_deflate__encoder__put_bits(self,(self->private_impl.f_hclen - 4),4);
+v_i = 0;
+while (v_i < self->private_impl.f_hclen) {
+wuffs_deflate__encoder__put_bits(self,((uint32_t)((self->private_data.f_lengths[2][WUFFS_DEFLATE__CODE_ORDER[v_i]] & 15))),3);
+v_i += 1;
+}
+v_i = 0;
+while (v_i < self->private_impl.f_n_cl_ops) {
+v_op = ((uint32_t)(self->private_data.f_cl_ops[v_i]));
+v_sym = 18;
+if ((v_op & 255) < 18) {
+v_sym = (v_op & 255);
+}
+v_n_xtra = 0;
+if (v_sym == 16) {
+v_n_xtra = 2;
+} else if (v_sym == 17) {
+v_n_xtra = 3;
+} else if (v_sym == 18) {
+v_n_xtra = 7;
+}
+wuffs_deflate__encoder__put_bits(self,(((uint32_t)(self->private_data.f_codes[2][v_sym])) | ((v_op >> 8) << ((uint32_t)((self->private_data.f_lengths[2][v_sym] & 15))))),(((uint32_t)((self->private_data.f_lengths[2][v_sym] & 15))) + v_n_xtra));
+v_i += 1;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.symbols_cost
+
+static uint64_t//
+wuffs_deflate__encoder__symbols_cost(const wuffs_deflate__encoder *self){
+
+uint32_t v_i = 0;
+uint64_t v_cost = 0;
+
+v_i = 0;
+while (v_i < 286) {
+v_cost += (((uint64_t)(self->private_data.f_freqs[0][v_i])) * ((uint64_t)((self->private_data.f_lengths[0][v_i] & 15))));
+v_i += 1;
+}
+v_i = 0;
+while (v_i < 30) {
+v_cost += (((uint64_t)(self->private_data.f_freqs[1][v_i])) * ((uint64_t)((self->private_data.f_lengths[1][v_i] & 15))));
+v_i += 1;
+}
+return v_cost;}
+
+// -------- func deflate.encoder.extra_bits_cost
+
+static uint64_t//
+wuffs_deflate__encoder__extra_bits_cost(const wuffs_deflate__encoder *self){
+
+uint32_t v_i = 0;
+uint64_t v_cost = 0;
+
+v_i = 0;
+while (v_i < 29) {
+v_cost += (((uint64_t)(self->private_data.f_freqs[0][(257 + v_i)])) * ((uint64_t)(((WUFFS_DEFLATE__LCODE_MAGIC_NUMBERS[v_i] >> 4) & 15))));
+v_i += 1;
+}
+v_i = 0;
+while (v_i < 30) {
+v_cost += (((uint64_t)(self->private_data.f_freqs[1][v_i])) * ((uint64_t)(((WUFFS_DEFLATE__DCODE_MAGIC_NUMBERS[v_i] >> 4) & 15))));
+v_i += 1;
+}
+return v_cost;}
+
+// -------- func deflate.encoder.write_symbols
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__write_symbols(wuffs_deflate__encoder *self){
+WUFFS_BASE__STATS__CALL(self, 17);
+
+uint32_t v_i = 0;
+uint32_t v_x = 0;
+uint32_t v_lc = 0;
+uint32_t v_dc = 0;
+uint32_t v_l3 = 0;
+uint32_t v_d1 = 0;
+uint32_t v_magic = 0;
+uint32_t v_n_xtra = 0;
+uint32_t v_len = 0;
+
+v_i = 0;
+label__0__continue:;
+while (v_i < self->private_impl.f_n_syms) {
+v_x = self->private_data.f_syms[v_i];
+if ((v_x >> 31) == 0) {
+wuffs_deflate__encoder__put_bits(self,((uint32_t)(self->private_data.f_codes[0][(v_x & 255)])),((uint32_t)((self->private_data.f_lengths[0][(v_x & 255)] & 15))));
+v_i += 1;
+goto label__0__continue;
+}
+v_l3 = ((v_x >> 16) & 255);
+v_lc = ((uint32_t)(WUFFS_DEFLATE__LENGTH_CODES[v_l3]));
+v_magic = WUFFS_DEFLATE__LCODE_MAGIC_NUMBERS[v_lc];
+v_n_xtra = ((v_magic >> 4) & 15);
+v_len = ((uint32_t)((self->private_data.f_lengths[0][(257 + v_lc)] & 15)));
+wuffs_deflate__encoder__put_bits(self,(((uint32_t)(self->private_data.f_codes[0][(257 + v_lc)])) | ((v_l3 - ((v_magic >> 8) & 255)) << v_len)),(v_len + v_n_xtra));
+v_d1 = (v_x & 32767);
+if (v_d1 < 256) {
+v_dc = ((uint32_t)(WUFFS_DEFLATE__DISTANCE_CODES[v_d1]));
+} else {
+v_dc = ((uint32_t)(WUFFS_DEFLATE__DISTANCE_CODES[(256 + (v_d1 >> 7))]));
+}
+v_magic = WUFFS_DEFLATE__DCODE_MAGIC_NUMBERS[v_dc];
+v_n_xtra = ((v_magic >> 4) & 15);
+v_len = ((uint32_t)((self->private_data.f_lengths[1][v_dc] & 15)));
+wuffs_deflate__encoder__put_bits(self,(((uint32_t)(self->private_data.f_codes[1][v_dc])) | ((v_d1 - ((v_magic >> 8) & 32767)) << v_len)),(v_len + v_n_xtra));
+v_i += 1;
+}
+wuffs_deflate__encoder__put_bits(self,((uint32_t)(self->private_data.f_codes[0][256])),((uint32_t)((self->private_data.f_lengths[0][256] & 15))));
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.write_stored_block
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__write_stored_block(wuffs_deflate__encoder *self,uint32_t a_final,uint32_t a_end){
+WUFFS_BASE__STATS__CALL(self, 18);
+
+uint32_t v_start = 0;
+uint32_t v_len = 0;
+uint32_t v_wi = 0;
+
+wuffs_deflate__encoder__put_bits(self,a_final,3);
+wuffs_deflate__encoder__flush_bits(self);
+v_start = self->private_impl.f_block_start;
+v_wi = self->private_impl.f_out_wi;
+if ((v_start > a_end) || (v_wi > 12288)) {
+self->private_impl.f_inconsistent = true;
+return wuffs_base__make_empty_struct();}
+if ((a_end - v_start) > 16384) {
+self->private_impl.f_inconsistent = true;
+return wuffs_base__make_empty_struct();}
+v_len = (a_end - v_start);
+self->private_data.f_out[(v_wi + 0)] = ((uint8_t)((v_len & 255)));
+self->private_data.f_out[(v_wi + 1)] = ((uint8_t)(((v_len >> 8) & 255)));
+self->private_data.f_out[(v_wi + 2)] = ((uint8_t)(((v_len & 255) ^ 255)));
+self->private_data.f_out[(v_wi + 3)] = ((uint8_t)((((v_len >> 8) & 255) ^ 255)));
+v_wi += 4;
+wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_out, 32768),v_wi,(v_wi + v_len)),wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_buf, 65794),v_start,a_end));
+self->private_impl.f_out_wi = (v_wi + v_len);
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.compress_block
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__compress_block(wuffs_deflate__encoder *self,bool a_final){
+WUFFS_BASE__STATS__CALL(self, 19);
+
+uint32_t v_end = 0;
+uint32_t v_bfinal = 0;
+uint32_t v_i = 0;
+uint64_t v_stored_cost = 0;
+uint64_t v_fixed_cost = 0;
+uint64_t v_dynamic_cost = 0;
+uint64_t v_extra = 0;
+
+v_end = self->private_impl.f_buf_len;
+if (self->private_impl.f_block_start > v_end) {
+self->private_impl.f_inconsistent = true;
+return wuffs_base__make_empty_struct();}
+if (a_final) {
+v_bfinal = 1;
+}
+v_stored_cost = (3 + ((uint64_t)(((8 - ((self->private_impl.f_n_bits + 3) & 7)) & 7))));
+v_stored_cost += (32 + (((uint64_t)((v_end - self->private_impl.f_block_start))) * 8));
+if (self->private_impl.f_level_is_stored) {
+wuffs_deflate__encoder__write_stored_block(self,v_bfinal,v_end);
+self->private_impl.f_block_start = v_end;
+wuffs_deflate__encoder__slide_if_full(self);
+return wuffs_base__make_empty_struct();}
+v_i = 0;
+while (v_i < 288) {
+self->private_data.f_freqs[0][v_i] = 0;
+v_i += 1;
+}
+v_i = 0;
+while (v_i < 32) {
+self->private_data.f_freqs[1][v_i] = 0;
+v_i += 1;
+}
+self->private_impl.f_n_syms = 0;
+if (self->private_impl.f_level_is_lazy) {
+wuffs_deflate__encoder__lz77_lazy(self,v_end);
+} else {
+wuffs_deflate__encoder__lz77_greedy(self,v_end);
+}
+self->private_data.f_freqs[0][256] = 1;
+v_extra = wuffs_deflate__encoder__extra_bits_cost(self);
+v_fixed_cost = (3 + v_extra);
+v_i = 0;
+while (v_i < 286) {
+if (v_i < 144) {
+v_fixed_cost += (((uint64_t)(self->private_data.f_freqs[0][v_i])) * 8);
+} else if (v_i < 256) {
+v_fixed_cost += (((uint64_t)(self->private_data.f_freqs[0][v_i])) * 9);
+} else if (v_i < 280) {
+v_fixed_cost += (((uint64_t)(self->private_data.f_freqs[0][v_i])) * 7);
+} else {
+v_fixed_cost += (((uint64_t)(self->private_data.f_freqs[0][v_i])) * 8);
+}
+v_i += 1;
+}
+v_i = 0;
+while (v_i < 30) {
+v_fixed_cost += (((uint64_t)(self->private_data.f_freqs[1][v_i])) * 5);
+v_i += 1;
+}
+wuffs_deflate__encoder__build_huffman(self,0,288,15);
+wuffs_deflate__encoder__build_huffman(self,1,32,15);
+v_dynamic_cost = wuffs_deflate__encoder__build_code_length_code(self);
+v_dynamic_cost += (3 + v_extra);
+v_dynamic_cost += wuffs_deflate__encoder__symbols_cost(self);
+if ((v_stored_cost <= v_fixed_cost) && (v_stored_cost <= v_dynamic_cost)) {
+wuffs_deflate__encoder__write_stored_block(self,v_bfinal,v_end);
+} else if (v_fixed_cost <= v_dynamic_cost) {
+wuffs_deflate__encoder__init_fixed_codes(self);
+wuffs_deflate__encoder__put_bits(self,(v_bfinal | 2),3);
+wuffs_deflate__encoder__write_symbols(self);
+} else {
+wuffs_deflate__encoder__put_bits(self,(v_bfinal | 4),3);
+wuffs_deflate__encoder__write_dynamic_header(self);
+wuffs_deflate__encoder__write_symbols(self);
+}
+self->private_impl.f_block_start = v_end;
+wuffs_deflate__encoder__slide_if_full(self);
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func deflate.encoder.slide_if_full
+
+static wuffs_base__empty_struct //
+wuffs_deflate__encoder__slide_if_full(wuffs_deflate__encoder *self){
+WUFFS_BASE__STATS__CALL(self, 20);
+
+uint32_t v_i = 0;
+uint16_t v_x = 0;
+
+if ((self->private_impl.f_block_start < 65536) || (self->private_impl.f_buf_len < 65536)) {
+return wuffs_base__make_empty_struct();}
+wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_data.f_buf, 65794),32768),wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_buf, 65794),32768,65536));
+v_i = 0;
+while (v_i < 32768) {
+v_x = self->private_impl.f_head[v_i];
+if (v_x >= 32768) {
+self->private_impl.f_head[v_i] = (v_x - 32768);
+} else {
+self->private_impl.f_head[v_i] = 0;
+}
+v_x = self->private_impl.f_prev[v_i];
+if (v_x >= 32768) {
+self->private_impl.f_prev[v_i] = (v_x - 32768);
+} else {
+self->private_impl.f_prev[v_i] = 0;
+}
+v_i += 1;
+}
+self->private_impl.f_block_start = 32768;
+self->private_impl.f_buf_len = 32768;
+return wuffs_base__make_empty_struct();
+}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__DEFLATE)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__DEFLATE
+
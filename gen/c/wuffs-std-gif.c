@@ -0,0 +1,3747 @@
+#ifndef WUFFS_INCLUDE_GUARD__GIF
+#define WUFFS_INCLUDE_GUARD__GIF
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__GIF
+#endif
+
+#include "./wuffs-base.c"
+#include "./wuffs-std-lzw.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+extern const char* wuffs_gif__error__bad_extension_label;
+extern const char* wuffs_gif__error__bad_frame_size;
+extern const char* wuffs_gif__error__bad_graphic_control;
+extern const char* wuffs_gif__error__bad_header;
+extern const char* wuffs_gif__error__bad_literal_width;
+extern const char* wuffs_gif__error__bad_palette;
+
+// ---------------- Public Consts
+
+#define WUFFS_GIF__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 36864
+
+#define WUFFS_GIF__QUIRK_DELAY_NUM_DECODED_FRAMES 1041635328
+
+#define WUFFS_GIF__QUIRK_FIRST_FRAME_LOCAL_PALETTE_MEANS_BLACK_BACKGROUND 1041635329
+
+#define WUFFS_GIF__QUIRK_HONOR_BACKGROUND_COLOR 1041635330
+
+#define WUFFS_GIF__QUIRK_IGNORE_TOO_MUCH_PIXEL_DATA 1041635331
+
+#define WUFFS_GIF__QUIRK_IMAGE_BOUNDS_ARE_STRICT 1041635332
+
+#define WUFFS_GIF__QUIRK_REJECT_EMPTY_FRAME 1041635333
+
+#define WUFFS_GIF__QUIRK_REJECT_EMPTY_PALETTE 1041635334
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_gif__config_decoder__struct wuffs_gif__config_decoder;
+
+typedef struct wuffs_gif__decoder__struct wuffs_gif__decoder;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_gif__config_decoder__initialize(wuffs_gif__config_decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_gif__config_decoder();
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_gif__decoder__initialize(wuffs_gif__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_gif__decoder();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_gif__config_decoder*  //
+wuffs_gif__config_decoder__alloc();
+
+static inline wuffs_base__image_decoder*  //
+wuffs_gif__config_decoder__alloc_as__wuffs_base__image_decoder(){
+return (wuffs_base__image_decoder*)(wuffs_gif__config_decoder__alloc());
+}
+
+wuffs_gif__decoder*  //
+wuffs_gif__decoder__alloc();
+
+static inline wuffs_base__image_decoder*  //
+wuffs_gif__decoder__alloc_as__wuffs_base__image_decoder(){
+return (wuffs_base__image_decoder*)(wuffs_gif__decoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__image_decoder*  //
+wuffs_gif__config_decoder__upcast_as__wuffs_base__image_decoder(wuffs_gif__config_decoder* p){
+return (wuffs_base__image_decoder*)p;
+}
+
+static inline wuffs_base__image_decoder*  //
+wuffs_gif__decoder__upcast_as__wuffs_base__image_decoder(wuffs_gif__decoder* p){
+return (wuffs_base__image_decoder*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__SET_QUIRK_ENABLED 0
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__DECODE_IMAGE_CONFIG 1
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__SET_REPORT_METADATA 2
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__TELL_ME_MORE 3
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__RESTART_FRAME 4
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__DECODE_FRAME_CONFIG 5
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__SKIP_FRAME 6
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__DECODE_FRAME 7
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__RESET_GC 8
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__DECODE_UP_TO_ID_PART1 9
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__DECODE_HEADER 10
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__DECODE_LSD 11
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__DECODE_EXTENSION 12
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__SKIP_BLOCKS 13
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__DECODE_AE 14
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__DECODE_GC 15
+#define WUFFS_GIF__CONFIG_DECODER__STATS__FUNC__DECODE_ID_PART0 16
+
+typedef struct wuffs_gif__config_decoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[17];
+} wuffs_gif__config_decoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_gif__config_decoder__stats  //
+wuffs_gif__config_decoder__get_stats(const wuffs_gif__config_decoder* self);
+
+#define WUFFS_GIF__DECODER__STATS__FUNC__SET_QUIRK_ENABLED 0
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_IMAGE_CONFIG 1
+#define WUFFS_GIF__DECODER__STATS__FUNC__SET_REPORT_METADATA 2
+#define WUFFS_GIF__DECODER__STATS__FUNC__TELL_ME_MORE 3
+#define WUFFS_GIF__DECODER__STATS__FUNC__RESTART_FRAME 4
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_FRAME_CONFIG 5
+#define WUFFS_GIF__DECODER__STATS__FUNC__SKIP_FRAME 6
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_FRAME 7
+#define WUFFS_GIF__DECODER__STATS__FUNC__RESET_GC 8
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_UP_TO_ID_PART1 9
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_HEADER 10
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_LSD 11
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_EXTENSION 12
+#define WUFFS_GIF__DECODER__STATS__FUNC__SKIP_BLOCKS 13
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_AE 14
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_GC 15
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_ID_PART0 16
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_ID_PART1 17
+#define WUFFS_GIF__DECODER__STATS__FUNC__DECODE_ID_PART2 18
+#define WUFFS_GIF__DECODER__STATS__FUNC__COPY_TO_IMAGE_BUFFER 19
+#define WUFFS_GIF__DECODER__STATS__FUNC__COPY_TO_IMAGE_BUFFER_SPARSE 20
+#define WUFFS_GIF__DECODER__STATS__FUNC__NEXT_BAND 21
+
+typedef struct wuffs_gif__decoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[22];
+
+// The sub-structs' stats are filled in by the get_stats function.
+wuffs_lzw__decoder__stats lzw;
+} wuffs_gif__decoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_gif__decoder__stats  //
+wuffs_gif__decoder__get_stats(const wuffs_gif__decoder* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_gif__config_decoder__set_quirk_enabled(wuffs_gif__config_decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__config_decoder__decode_image_config(wuffs_gif__config_decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_gif__config_decoder__set_report_metadata(wuffs_gif__config_decoder *self,uint32_t a_fourcc,bool a_report);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__config_decoder__tell_me_more(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_gif__config_decoder__num_animation_loops(const wuffs_gif__config_decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_gif__config_decoder__num_decoded_frame_configs(const wuffs_gif__config_decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_gif__config_decoder__num_decoded_frames(const wuffs_gif__config_decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_gif__config_decoder__frame_dirty_rect(const wuffs_gif__config_decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_gif__config_decoder__workbuf_len(const wuffs_gif__config_decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_gif__config_decoder__restart_frame(wuffs_gif__config_decoder *self,uint64_t a_index,uint64_t a_io_position);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__config_decoder__decode_frame_config(wuffs_gif__config_decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__config_decoder__decode_frame(wuffs_gif__config_decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_gif__decoder__set_quirk_enabled(wuffs_gif__decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__decoder__decode_image_config(wuffs_gif__decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_gif__decoder__set_report_metadata(wuffs_gif__decoder *self,uint32_t a_fourcc,bool a_report);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__decoder__tell_me_more(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_gif__decoder__num_animation_loops(const wuffs_gif__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_gif__decoder__num_decoded_frame_configs(const wuffs_gif__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_gif__decoder__num_decoded_frames(const wuffs_gif__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_gif__decoder__frame_dirty_rect(const wuffs_gif__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_gif__decoder__workbuf_len(const wuffs_gif__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_gif__decoder__restart_frame(wuffs_gif__decoder *self,uint64_t a_index,uint64_t a_io_position);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__decoder__decode_frame_config(wuffs_gif__decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__decoder__decode_frame(wuffs_gif__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_gif__config_decoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__image_decoder;
+wuffs_base__vtable null_vtable;
+
+uint32_t f_width;
+uint32_t f_height;
+uint8_t f_call_sequence;
+bool f_ignore_metadata;
+bool f_report_metadata_iccp;
+bool f_report_metadata_xmp;
+uint32_t f_metadata_fourcc;
+uint64_t f_metadata_io_position;
+bool f_quirks[7];
+bool f_delayed_num_decoded_frames;
+bool f_end_of_data;
+bool f_restarted;
+bool f_previous_lzw_decode_ended_abruptly;
+bool f_has_global_palette;
+uint8_t f_interlace;
+bool f_seen_num_loops;
+uint32_t f_num_loops;
+uint32_t f_background_color_u32_argb_premul;
+uint32_t f_black_color_u32_argb_premul;
+bool f_gc_has_transparent_index;
+uint8_t f_gc_transparent_index;
+uint8_t f_gc_disposal;
+uint64_t f_gc_duration;
+uint64_t f_frame_config_io_position;
+uint64_t f_num_decoded_frame_configs_value;
+uint64_t f_num_decoded_frames_value;
+uint32_t f_frame_rect_x0;
+uint32_t f_frame_rect_y0;
+uint32_t f_frame_rect_x1;
+uint32_t f_frame_rect_y1;
+
+uint32_t p_decode_image_config[1];
+uint32_t p_tell_me_more[1];
+uint32_t p_decode_frame_config[1];
+uint32_t p_skip_frame[1];
+uint32_t p_decode_up_to_id_part1[1];
+uint32_t p_decode_header[1];
+uint32_t p_decode_lsd[1];
+uint32_t p_decode_extension[1];
+uint32_t p_skip_blocks[1];
+uint32_t p_decode_ae[1];
+uint32_t p_decode_gc[1];
+uint32_t p_decode_id_part0[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_gif__config_decoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+uint8_t f_palettes[1][1024];
+
+struct {
+uint32_t v_background_color;
+} s_decode_frame_config[1];
+struct {
+uint64_t scratch;
+} s_skip_frame[1];
+struct {
+uint8_t v_c[6];
+uint32_t v_i;
+} s_decode_header[1];
+struct {
+uint8_t v_flags;
+uint8_t v_background_color_index;
+uint32_t v_num_palette_entries;
+uint32_t v_i;
+uint64_t scratch;
+} s_decode_lsd[1];
+struct {
+uint64_t scratch;
+} s_skip_blocks[1];
+struct {
+uint8_t v_block_size;
+bool v_is_animexts;
+bool v_is_netscape;
+bool v_is_iccp;
+bool v_is_xmp;
+uint64_t scratch;
+} s_decode_ae[1];
+struct {
+uint64_t scratch;
+} s_decode_gc[1];
+struct {
+uint64_t scratch;
+} s_decode_id_part0[1];
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_gif__config_decoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_gif__config_decoder__alloc(), &free);
+}
+
+static inline wuffs_base__image_decoder::unique_ptr  //
+alloc_as__wuffs_base__image_decoder(){
+return wuffs_base__image_decoder::unique_ptr(wuffs_gif__config_decoder__alloc_as__wuffs_base__image_decoder(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_gif__config_decoder__struct() = delete;
+wuffs_gif__config_decoder__struct(const wuffs_gif__config_decoder__struct&) = delete;
+wuffs_gif__config_decoder__struct& operator=(const wuffs_gif__config_decoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_gif__config_decoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__image_decoder*  //
+upcast_as__wuffs_base__image_decoder(){
+return (wuffs_base__image_decoder*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_gif__config_decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__status //
+decode_image_config(wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_gif__config_decoder__decode_image_config(this,a_dst,a_src);}
+
+inline wuffs_base__empty_struct //
+set_report_metadata(uint32_t a_fourcc,bool a_report){ return wuffs_gif__config_decoder__set_report_metadata(this,a_fourcc,a_report);}
+
+inline wuffs_base__status //
+tell_me_more(wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){ return wuffs_gif__config_decoder__tell_me_more(this,a_dst,a_minfo,a_src);}
+
+inline uint32_t//
+num_animation_loops() const { return wuffs_gif__config_decoder__num_animation_loops(this);}
+
+inline uint64_t//
+num_decoded_frame_configs() const { return wuffs_gif__config_decoder__num_decoded_frame_configs(this);}
+
+inline uint64_t//
+num_decoded_frames() const { return wuffs_gif__config_decoder__num_decoded_frames(this);}
+
+inline wuffs_base__rect_ie_u32//
+frame_dirty_rect() const { return wuffs_gif__config_decoder__frame_dirty_rect(this);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_gif__config_decoder__workbuf_len(this);}
+
+inline wuffs_base__status//
+restart_frame(uint64_t a_index,uint64_t a_io_position){ return wuffs_gif__config_decoder__restart_frame(this,a_index,a_io_position);}
+
+inline wuffs_base__status //
+decode_frame_config(wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_gif__config_decoder__decode_frame_config(this,a_dst,a_src);}
+
+inline wuffs_base__status //
+decode_frame(wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){ return wuffs_gif__config_decoder__decode_frame(this,a_dst,a_src,a_blend,a_workbuf,a_opts);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_gif__config_decoder__stats  //
+get_stats() const {
+return wuffs_gif__config_decoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_gif__config_decoder__struct
+
+struct wuffs_gif__decoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__image_decoder;
+wuffs_base__vtable null_vtable;
+
+uint32_t f_width;
+uint32_t f_height;
+uint8_t f_call_sequence;
+bool f_ignore_metadata;
+bool f_report_metadata_iccp;
+bool f_report_metadata_xmp;
+uint32_t f_metadata_fourcc;
+uint64_t f_metadata_io_position;
+bool f_quirks[7];
+bool f_delayed_num_decoded_frames;
+bool f_end_of_data;
+bool f_restarted;
+bool f_previous_lzw_decode_ended_abruptly;
+bool f_has_global_palette;
+uint8_t f_interlace;
+bool f_seen_num_loops;
+uint32_t f_num_loops;
+uint32_t f_background_color_u32_argb_premul;
+uint32_t f_black_color_u32_argb_premul;
+bool f_gc_has_transparent_index;
+uint8_t f_gc_transparent_index;
+uint8_t f_gc_disposal;
+uint64_t f_gc_duration;
+uint64_t f_frame_config_io_position;
+uint64_t f_num_decoded_frame_configs_value;
+uint64_t f_num_decoded_frames_value;
+uint32_t f_frame_rect_x0;
+uint32_t f_frame_rect_y0;
+uint32_t f_frame_rect_x1;
+uint32_t f_frame_rect_y1;
+uint32_t f_dst_x;
+uint32_t f_dst_y;
+uint32_t f_dirty_max_excl_y;
+uint32_t f_scale_shift;
+uint32_t f_crop_x0;
+uint32_t f_crop_y0;
+uint32_t f_crop_x1;
+uint32_t f_crop_y1;
+bool f_sparse;
+uint32_t f_band_height;
+uint32_t f_band_y0;
+uint32_t f_band_y1;
+uint32_t f_dst_rect_y1;
+uint64_t f_compressed_ri;
+uint64_t f_compressed_wi;
+wuffs_base__pixel_swizzler f_swizzler;
+
+uint32_t p_decode_image_config[1];
+uint32_t p_tell_me_more[1];
+uint32_t p_decode_frame_config[1];
+uint32_t p_skip_frame[1];
+uint32_t p_decode_frame[1];
+uint32_t p_decode_up_to_id_part1[1];
+uint32_t p_decode_header[1];
+uint32_t p_decode_lsd[1];
+uint32_t p_decode_extension[1];
+uint32_t p_skip_blocks[1];
+uint32_t p_decode_ae[1];
+uint32_t p_decode_gc[1];
+uint32_t p_decode_id_part0[1];
+uint32_t p_decode_id_part1[1];
+uint32_t p_decode_id_part2[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_gif__decoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+uint8_t f_palettes[2][1024];
+uint8_t f_dst_palette[1024];
+wuffs_lzw__decoder f_lzw;
+
+struct {
+uint32_t v_background_color;
+} s_decode_frame_config[1];
+struct {
+uint64_t scratch;
+} s_skip_frame[1];
+struct {
+uint8_t v_c[6];
+uint32_t v_i;
+} s_decode_header[1];
+struct {
+uint8_t v_flags;
+uint8_t v_background_color_index;
+uint32_t v_num_palette_entries;
+uint32_t v_i;
+uint64_t scratch;
+} s_decode_lsd[1];
+struct {
+uint64_t scratch;
+} s_skip_blocks[1];
+struct {
+uint8_t v_block_size;
+bool v_is_animexts;
+bool v_is_netscape;
+bool v_is_iccp;
+bool v_is_xmp;
+uint64_t scratch;
+} s_decode_ae[1];
+struct {
+uint64_t scratch;
+} s_decode_gc[1];
+struct {
+uint64_t scratch;
+} s_decode_id_part0[1];
+struct {
+uint8_t v_which_palette;
+uint32_t v_num_palette_entries;
+uint32_t v_i;
+uint64_t scratch;
+} s_decode_id_part1[1];
+struct {
+uint64_t v_block_size;
+bool v_need_block_size;
+wuffs_base__status v_lzw_status;
+uint64_t scratch;
+} s_decode_id_part2[1];
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_gif__decoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_gif__decoder__alloc(), &free);
+}
+
+static inline wuffs_base__image_decoder::unique_ptr  //
+alloc_as__wuffs_base__image_decoder(){
+return wuffs_base__image_decoder::unique_ptr(wuffs_gif__decoder__alloc_as__wuffs_base__image_decoder(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_gif__decoder__struct() = delete;
+wuffs_gif__decoder__struct(const wuffs_gif__decoder__struct&) = delete;
+wuffs_gif__decoder__struct& operator=(const wuffs_gif__decoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_gif__decoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__image_decoder*  //
+upcast_as__wuffs_base__image_decoder(){
+return (wuffs_base__image_decoder*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_gif__decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__status //
+decode_image_config(wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_gif__decoder__decode_image_config(this,a_dst,a_src);}
+
+inline wuffs_base__empty_struct //
+set_report_metadata(uint32_t a_fourcc,bool a_report){ return wuffs_gif__decoder__set_report_metadata(this,a_fourcc,a_report);}
+
+inline wuffs_base__status //
+tell_me_more(wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){ return wuffs_gif__decoder__tell_me_more(this,a_dst,a_minfo,a_src);}
+
+inline uint32_t//
+num_animation_loops() const { return wuffs_gif__decoder__num_animation_loops(this);}
+
+inline uint64_t//
+num_decoded_frame_configs() const { return wuffs_gif__decoder__num_decoded_frame_configs(this);}
+
+inline uint64_t//
+num_decoded_frames() const { return wuffs_gif__decoder__num_decoded_frames(this);}
+
+inline wuffs_base__rect_ie_u32//
+frame_dirty_rect() const { return wuffs_gif__decoder__frame_dirty_rect(this);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_gif__decoder__workbuf_len(this);}
+
+inline wuffs_base__status//
+restart_frame(uint64_t a_index,uint64_t a_io_position){ return wuffs_gif__decoder__restart_frame(this,a_index,a_io_position);}
+
+inline wuffs_base__status //
+decode_frame_config(wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_gif__decoder__decode_frame_config(this,a_dst,a_src);}
+
+inline wuffs_base__status //
+decode_frame(wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){ return wuffs_gif__decoder__decode_frame(this,a_dst,a_src,a_blend,a_workbuf,a_opts);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_gif__decoder__stats  //
+get_stats() const {
+return wuffs_gif__decoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_gif__decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__GIF)
+
+// ---------------- Status Codes Implementations
+
+const char* wuffs_gif__error__bad_extension_label = "#gif: bad extension label";
+const char* wuffs_gif__error__bad_frame_size = "#gif: bad frame size";
+const char* wuffs_gif__error__bad_graphic_control = "#gif: bad graphic control";
+const char* wuffs_gif__error__bad_header = "#gif: bad header";
+const char* wuffs_gif__error__bad_literal_width = "#gif: bad literal width";
+const char* wuffs_gif__error__bad_palette = "#gif: bad palette";
+const char* wuffs_gif__error__internal_error_inconsistent_ri_wi = "#gif: internal error: inconsistent ri/wi";
+
+// ---------------- Private Consts
+
+static const uint32_t //
+WUFFS_GIF__INTERLACE_START[5]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {4294967295,1,2,4,0,};
+
+static const uint8_t //
+WUFFS_GIF__INTERLACE_DELTA[5]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {1,2,4,8,8,};
+
+static const uint8_t //
+WUFFS_GIF__INTERLACE_COUNT[5]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,1,2,4,8,};
+
+static const uint8_t //
+WUFFS_GIF__ANIMEXTS1DOT0[11]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {65,78,73,77,69,88,84,83,49,46,48,};
+
+static const uint8_t //
+WUFFS_GIF__NETSCAPE2DOT0[11]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {78,69,84,83,67,65,80,69,50,46,48,};
+
+static const uint8_t //
+WUFFS_GIF__ICCRGBG1012[11]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {73,67,67,82,71,66,71,49,48,49,50,};
+
+static const uint8_t //
+WUFFS_GIF__XMPDATAXMP[11]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {88,77,80,32,68,97,116,97,88,77,80,};
+
+#define WUFFS_GIF__QUIRKS_BASE 1041635328
+
+#define WUFFS_GIF__QUIRKS_COUNT 7
+
+// ---------------- Quirks
+
+#if defined(WUFFS_CONFIG__QUIRKS__ENABLE_ALLOWLIST)
+static const bool //
+WUFFS_GIF__QUIRKS_ALLOWED[7] //
+WUFFS_BASE__POTENTIALLY_UNUSED = {
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__GIF__DELAY_NUM_DECODED_FRAMES)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__GIF__FIRST_FRAME_LOCAL_PALETTE_MEANS_BLACK_BACKGROUND)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__GIF__HONOR_BACKGROUND_COLOR)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__GIF__IGNORE_TOO_MUCH_PIXEL_DATA)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__GIF__IMAGE_BOUNDS_ARE_STRICT)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__GIF__REJECT_EMPTY_FRAME)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__GIF__REJECT_EMPTY_PALETTE)
+true,
+#else
+false,
+#endif
+};
+
+#define WUFFS_GIF__QUIRK_ENABLED(self, q) \
+  (WUFFS_GIF__QUIRKS_ALLOWED[q] && (self)->private_impl.f_quirks[q])
+#else
+#define WUFFS_GIF__QUIRK_ENABLED(self, q) ((self)->private_impl.f_quirks[q])
+#endif  // defined(WUFFS_CONFIG__QUIRKS__ENABLE_ALLOWLIST)
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__skip_frame(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__empty_struct //
+wuffs_gif__config_decoder__reset_gc(wuffs_gif__config_decoder *self);
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_up_to_id_part1(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_header(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_lsd(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_extension(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__skip_blocks(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_ae(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_gc(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_id_part0(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__decoder__skip_frame(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__empty_struct //
+wuffs_gif__decoder__reset_gc(wuffs_gif__decoder *self);
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_up_to_id_part1(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_header(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_lsd(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_extension(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__decoder__skip_blocks(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_ae(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_gc(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_id_part0(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_id_part1(wuffs_gif__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend);
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_id_part2(wuffs_gif__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status//
+wuffs_gif__decoder__copy_to_image_buffer(wuffs_gif__decoder *self,wuffs_base__pixel_buffer* a_pb,wuffs_base__slice_u8 a_src);
+
+static wuffs_base__status//
+wuffs_gif__decoder__copy_to_image_buffer_sparse(wuffs_gif__decoder *self,wuffs_base__pixel_buffer* a_pb,wuffs_base__slice_u8 a_src);
+
+static bool//
+wuffs_gif__decoder__band_is_done(const wuffs_gif__decoder *self);
+
+static wuffs_base__empty_struct //
+wuffs_gif__decoder__next_band(wuffs_gif__decoder *self);
+
+static uint32_t//
+wuffs_gif__decoder__dst_coord(const wuffs_gif__decoder *self,uint32_t a_v,uint32_t a_c0,uint32_t a_c1);
+
+// ---------------- VTables
+
+const wuffs_base__image_decoder__func_ptrs wuffs_gif__config_decoder__func_ptrs_for__wuffs_base__image_decoder = {(wuffs_base__status (*)(void*,wuffs_base__pixel_buffer*,wuffs_base__io_buffer*,wuffs_base__pixel_blend,wuffs_base__slice_u8,wuffs_base__decode_frame_options*))(&wuffs_gif__config_decoder__decode_frame),
+(wuffs_base__status (*)(void*,wuffs_base__frame_config*,wuffs_base__io_buffer*))(&wuffs_gif__config_decoder__decode_frame_config),
+(wuffs_base__status (*)(void*,wuffs_base__image_config*,wuffs_base__io_buffer*))(&wuffs_gif__config_decoder__decode_image_config),
+(wuffs_base__rect_ie_u32(*)(const void*))(&wuffs_gif__config_decoder__frame_dirty_rect),
+(uint32_t(*)(const void*))(&wuffs_gif__config_decoder__num_animation_loops),
+(uint64_t(*)(const void*))(&wuffs_gif__config_decoder__num_decoded_frame_configs),
+(uint64_t(*)(const void*))(&wuffs_gif__config_decoder__num_decoded_frames),
+(wuffs_base__status(*)(void*,uint64_t,uint64_t))(&wuffs_gif__config_decoder__restart_frame),
+(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_gif__config_decoder__set_quirk_enabled),
+(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_gif__config_decoder__set_report_metadata),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__more_information*,wuffs_base__io_buffer*))(&wuffs_gif__config_decoder__tell_me_more),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_gif__config_decoder__workbuf_len),
+};
+
+const wuffs_base__image_decoder__func_ptrs wuffs_gif__decoder__func_ptrs_for__wuffs_base__image_decoder = {(wuffs_base__status (*)(void*,wuffs_base__pixel_buffer*,wuffs_base__io_buffer*,wuffs_base__pixel_blend,wuffs_base__slice_u8,wuffs_base__decode_frame_options*))(&wuffs_gif__decoder__decode_frame),
+(wuffs_base__status (*)(void*,wuffs_base__frame_config*,wuffs_base__io_buffer*))(&wuffs_gif__decoder__decode_frame_config),
+(wuffs_base__status (*)(void*,wuffs_base__image_config*,wuffs_base__io_buffer*))(&wuffs_gif__decoder__decode_image_config),
+(wuffs_base__rect_ie_u32(*)(const void*))(&wuffs_gif__decoder__frame_dirty_rect),
+(uint32_t(*)(const void*))(&wuffs_gif__decoder__num_animation_loops),
+(uint64_t(*)(const void*))(&wuffs_gif__decoder__num_decoded_frame_configs),
+(uint64_t(*)(const void*))(&wuffs_gif__decoder__num_decoded_frames),
+(wuffs_base__status(*)(void*,uint64_t,uint64_t))(&wuffs_gif__decoder__restart_frame),
+(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_gif__decoder__set_quirk_enabled),
+(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_gif__decoder__set_report_metadata),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__more_information*,wuffs_base__io_buffer*))(&wuffs_gif__decoder__tell_me_more),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_gif__decoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_gif__config_decoder__initialize(wuffs_gif__config_decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__image_decoder.vtable_name = wuffs_base__image_decoder__vtable_name;
+self->private_impl.vtable_for__wuffs_base__image_decoder.function_pointers = (const void*)(&wuffs_gif__config_decoder__func_ptrs_for__wuffs_base__image_decoder);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_gif__config_decoder*  //
+wuffs_gif__config_decoder__alloc(){
+wuffs_gif__config_decoder* x = (wuffs_gif__config_decoder*)(calloc(sizeof(wuffs_gif__config_decoder), 1));
+if (!x) { return NULL; }
+if (wuffs_gif__config_decoder__initialize(x, sizeof(wuffs_gif__config_decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_gif__config_decoder(){ return sizeof(wuffs_gif__config_decoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_gif__config_decoder__stats  //
+wuffs_gif__config_decoder__get_stats(const wuffs_gif__config_decoder* self) {
+wuffs_gif__config_decoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_gif__decoder__initialize(wuffs_gif__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+{
+wuffs_base__status z = wuffs_lzw__decoder__initialize(&self->private_data.f_lzw, sizeof(self->private_data.f_lzw), WUFFS_VERSION, initialize_flags);
+if (z.repr) { return z; }
+}
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__image_decoder.vtable_name = wuffs_base__image_decoder__vtable_name;
+self->private_impl.vtable_for__wuffs_base__image_decoder.function_pointers = (const void*)(&wuffs_gif__decoder__func_ptrs_for__wuffs_base__image_decoder);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_gif__decoder*  //
+wuffs_gif__decoder__alloc(){
+wuffs_gif__decoder* x = (wuffs_gif__decoder*)(calloc(sizeof(wuffs_gif__decoder), 1));
+if (!x) { return NULL; }
+if (wuffs_gif__decoder__initialize(x, sizeof(wuffs_gif__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_gif__decoder(){ return sizeof(wuffs_gif__decoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_gif__decoder__stats  //
+wuffs_gif__decoder__get_stats(const wuffs_gif__decoder* self) {
+wuffs_gif__decoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+ret.lzw = wuffs_lzw__decoder__get_stats(&self->private_data.f_lzw);
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func gif.config_decoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_gif__config_decoder__set_quirk_enabled(wuffs_gif__config_decoder *self,uint32_t a_quirk,bool a_enabled){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 0);
+
+
+if ((self->private_impl.f_call_sequence == 0) && (a_quirk >= 1041635328)) {
+a_quirk -= 1041635328;
+if (a_quirk < 7) {
+self->private_impl.f_quirks[a_quirk] = a_enabled;
+}
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func gif.config_decoder.decode_image_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__config_decoder__decode_image_config(wuffs_gif__config_decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 1);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+bool v_ffio = false;
+
+uint32_t coro_susp_point = self->private_impl.p_decode_image_config[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence == 0) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_gif__config_decoder__decode_header(self,a_src);
+if (status.repr) { goto suspend; }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_gif__config_decoder__decode_lsd(self,a_src);
+if (status.repr) { goto suspend; }
+} else if (self->private_impl.f_call_sequence != 2) {
+status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);goto exit;}
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_gif__config_decoder__decode_up_to_id_part1(self,a_src);
+if (status.repr) { goto suspend; }
+v_ffio =  ! self->private_impl.f_gc_has_transparent_index;
+if ( ! WUFFS_GIF__QUIRK_ENABLED(self, 2)) {
+v_ffio = (v_ffio && (self->private_impl.f_frame_rect_x0 == 0) && (self->private_impl.f_frame_rect_y0 == 0) && (self->private_impl.f_frame_rect_x1 == self->private_impl.f_width) && (self->private_impl.f_frame_rect_y1 == self->private_impl.f_height));
+} else if (v_ffio) {
+self->private_impl.f_black_color_u32_argb_premul = 4278190080;
+}
+if (self->private_impl.f_background_color_u32_argb_premul == 77) {
+self->private_impl.f_background_color_u32_argb_premul = self->private_impl.f_black_color_u32_argb_premul;
+}
+if (a_dst != NULL) {
+wuffs_base__image_config__set(a_dst,2198077448,0,self->private_impl.f_width,self->private_impl.f_height,self->private_impl.f_frame_config_io_position,v_ffio);
+}
+self->private_impl.f_call_sequence = 3;
+
+goto ok;ok:self->private_impl.p_decode_image_config[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_image_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func gif.config_decoder.set_report_metadata
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_gif__config_decoder__set_report_metadata(wuffs_gif__config_decoder *self,uint32_t a_fourcc,bool a_report){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 2);
+
+
+if (a_fourcc == 1229144912) {
+self->private_impl.f_report_metadata_iccp = a_report;
+} else if (a_fourcc == 1481461792) {
+self->private_impl.f_report_metadata_xmp = a_report;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func gif.config_decoder.tell_me_more
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__config_decoder__tell_me_more(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 2)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 3);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint64_t v_chunk_length = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_tell_me_more[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence != 1) {
+status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);goto exit;}
+if (self->private_impl.f_metadata_fourcc == 0) {
+status = wuffs_base__make_status(wuffs_base__error__no_more_information);goto exit;}
+while (true) {
+label__0__continue:;
+while (true) {
+if (wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src))) != self->private_impl.f_metadata_io_position) {
+if (a_minfo != NULL) {
+wuffs_base__more_information__set(a_minfo,2,0,self->private_impl.f_metadata_io_position,0,0);
+}
+status = wuffs_base__make_status(wuffs_base__suspension__mispositioned_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+goto label__0__continue;
+}
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if (a_minfo != NULL) {
+wuffs_base__more_information__set(a_minfo,0,0,0,0,0);
+}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+goto label__0__continue;
+}
+goto label__0__break;
+}
+label__0__break:;
+v_chunk_length = ((uint64_t)(wuffs_base__load_u8be__no_bounds_check(iop_a_src)));
+if (v_chunk_length <= 0) {
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+goto label__1__break;
+}
+if (self->private_impl.f_metadata_fourcc == 1481461792) {
+v_chunk_length += 1;
+} else {
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+}
+self->private_impl.f_metadata_io_position = wuffs_base__u64__sat_add(wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src))),v_chunk_length);
+if (a_minfo != NULL) {
+wuffs_base__more_information__set(a_minfo,3,self->private_impl.f_metadata_fourcc,0,wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src))),self->private_impl.f_metadata_io_position);
+}
+status = wuffs_base__make_status(wuffs_base__suspension__even_more_information);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(3);
+}
+label__1__break:;
+if (a_minfo != NULL) {
+wuffs_base__more_information__set(a_minfo,3,self->private_impl.f_metadata_fourcc,0,self->private_impl.f_metadata_io_position,self->private_impl.f_metadata_io_position);
+}
+self->private_impl.f_call_sequence = 2;
+self->private_impl.f_metadata_fourcc = 0;
+self->private_impl.f_metadata_io_position = 0;
+status = wuffs_base__make_status(NULL);goto ok;
+goto ok;ok:self->private_impl.p_tell_me_more[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_tell_me_more[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 2 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func gif.config_decoder.num_animation_loops
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_gif__config_decoder__num_animation_loops(const wuffs_gif__config_decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+if (self->private_impl.f_seen_num_loops) {
+return self->private_impl.f_num_loops;}
+return 1;}
+
+// -------- func gif.config_decoder.num_decoded_frame_configs
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_gif__config_decoder__num_decoded_frame_configs(const wuffs_gif__config_decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+return self->private_impl.f_num_decoded_frame_configs_value;}
+
+// -------- func gif.config_decoder.num_decoded_frames
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_gif__config_decoder__num_decoded_frames(const wuffs_gif__config_decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+return self->private_impl.f_num_decoded_frames_value;}
+
+// -------- func gif.config_decoder.frame_dirty_rect
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_gif__config_decoder__frame_dirty_rect(const wuffs_gif__config_decoder *self){
+if (!self) { return wuffs_base__utility__empty_rect_ie_u32();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_rect_ie_u32();}
+
+
+return wuffs_base__utility__empty_rect_ie_u32();}
+
+// -------- func gif.config_decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_gif__config_decoder__workbuf_len(const wuffs_gif__config_decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__empty_range_ii_u64();}
+
+// -------- func gif.config_decoder.restart_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_gif__config_decoder__restart_frame(wuffs_gif__config_decoder *self,uint64_t a_index,uint64_t a_io_position){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+WUFFS_BASE__STATS__CALL(self, 4);
+
+
+if (self->private_impl.f_call_sequence == 0) {
+return wuffs_base__make_status(wuffs_base__error__bad_call_sequence);}
+self->private_impl.f_delayed_num_decoded_frames = false;
+self->private_impl.f_end_of_data = false;
+self->private_impl.f_restarted = true;
+self->private_impl.f_frame_config_io_position = a_io_position;
+self->private_impl.f_num_decoded_frame_configs_value = a_index;
+self->private_impl.f_num_decoded_frames_value = a_index;
+wuffs_gif__config_decoder__reset_gc(self);
+return wuffs_base__make_status(NULL);}
+
+// -------- func gif.config_decoder.decode_frame_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__config_decoder__decode_frame_config(wuffs_gif__config_decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 3)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 5);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_background_color = 0;
+uint8_t v_flags = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_frame_config[0];
+if (coro_susp_point) {
+v_background_color = self->private_data.s_decode_frame_config[0].v_background_color;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+self->private_impl.f_ignore_metadata = true;
+if ( ! self->private_impl.f_end_of_data) {
+if (self->private_impl.f_call_sequence == 0) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_gif__config_decoder__decode_image_config(self,NULL,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else if (self->private_impl.f_call_sequence != 3) {
+if (self->private_impl.f_call_sequence == 4) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_gif__config_decoder__skip_frame(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_gif__config_decoder__decode_up_to_id_part1(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+}
+}
+if (self->private_impl.f_end_of_data) {
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;}
+v_background_color = self->private_impl.f_black_color_u32_argb_premul;
+if ( ! self->private_impl.f_gc_has_transparent_index) {
+v_background_color = self->private_impl.f_background_color_u32_argb_premul;
+if (WUFFS_GIF__QUIRK_ENABLED(self, 1) && (self->private_impl.f_num_decoded_frame_configs_value == 0)) {
+while (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(4);
+}
+v_flags = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+if ((v_flags & 128) != 0) {
+v_background_color = self->private_impl.f_black_color_u32_argb_premul;
+}
+}
+}
+if (a_dst != NULL) {
+wuffs_base__frame_config__update(a_dst,wuffs_base__utility__make_rect_ie_u32(wuffs_base__u32__min(self->private_impl.f_frame_rect_x0,self->private_impl.f_width),wuffs_base__u32__min(self->private_impl.f_frame_rect_y0,self->private_impl.f_height),wuffs_base__u32__min(self->private_impl.f_frame_rect_x1,self->private_impl.f_width),wuffs_base__u32__min(self->private_impl.f_frame_rect_y1,self->private_impl.f_height)),((wuffs_base__flicks)(self->private_impl.f_gc_duration)),self->private_impl.f_num_decoded_frame_configs_value,self->private_impl.f_frame_config_io_position,self->private_impl.f_gc_disposal, ! self->private_impl.f_gc_has_transparent_index,false,v_background_color);
+}
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frame_configs_value,1);
+self->private_impl.f_call_sequence = 4;
+
+goto ok;ok:self->private_impl.p_decode_frame_config[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_frame_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 3 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+self->private_data.s_decode_frame_config[0].v_background_color = v_background_color;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func gif.config_decoder.skip_frame
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__skip_frame(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 6);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_flags = 0;
+uint8_t v_lw = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_skip_frame[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_flags = t_0;
+}
+if ((v_flags & 128) != 0) {
+self->private_data.s_skip_frame[0].scratch = (((uint32_t)(3)) << (1 + (v_flags & 7)));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (self->private_data.s_skip_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_skip_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_skip_frame[0].scratch;
+}
+{
+uint8_t t_1;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_1 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_1 = *iop_a_src++;
+}
+v_lw = t_1;
+}
+if (v_lw > 8) {
+status = wuffs_base__make_status(wuffs_gif__error__bad_literal_width);goto exit;}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+status = wuffs_gif__config_decoder__skip_blocks(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+if (WUFFS_GIF__QUIRK_ENABLED(self, 0)) {
+self->private_impl.f_delayed_num_decoded_frames = true;
+} else {
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frames_value,1);
+}
+wuffs_gif__config_decoder__reset_gc(self);
+
+goto ok;ok:self->private_impl.p_skip_frame[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_skip_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.config_decoder.decode_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__config_decoder__decode_frame(wuffs_gif__config_decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 4)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 7);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+status = wuffs_base__make_status(wuffs_base__error__unsupported_method);goto exit;
+goto ok;ok:goto exit;exit:if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func gif.config_decoder.reset_gc
+
+static wuffs_base__empty_struct //
+wuffs_gif__config_decoder__reset_gc(wuffs_gif__config_decoder *self){
+WUFFS_BASE__STATS__CALL(self, 8);
+
+
+self->private_impl.f_call_sequence = 5;
+self->private_impl.f_gc_has_transparent_index = false;
+self->private_impl.f_gc_transparent_index = 0;
+self->private_impl.f_gc_disposal = 0;
+self->private_impl.f_gc_duration = 0;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func gif.config_decoder.decode_up_to_id_part1
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_up_to_id_part1(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 9);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_block_type = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_up_to_id_part1[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if ( ! self->private_impl.f_restarted) {
+if (self->private_impl.f_call_sequence != 2) {
+self->private_impl.f_frame_config_io_position = wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)));
+}
+} else if (self->private_impl.f_frame_config_io_position != wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)))) {
+status = wuffs_base__make_status(wuffs_base__error__bad_restart);goto exit;} else {
+self->private_impl.f_restarted = false;
+}
+while (true) {
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_block_type = t_0;
+}
+if (v_block_type == 33) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_gif__config_decoder__decode_extension(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else if (v_block_type == 44) {
+if (self->private_impl.f_delayed_num_decoded_frames) {
+self->private_impl.f_delayed_num_decoded_frames = false;
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frames_value,1);
+}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_gif__config_decoder__decode_id_part0(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+goto label__0__break;
+} else {
+if (self->private_impl.f_delayed_num_decoded_frames) {
+self->private_impl.f_delayed_num_decoded_frames = false;
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frames_value,1);
+}
+self->private_impl.f_end_of_data = true;
+goto label__0__break;
+}
+}
+label__0__break:;
+
+goto ok;ok:self->private_impl.p_decode_up_to_id_part1[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_up_to_id_part1[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.config_decoder.decode_header
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_header(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 10);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_c[6] = {0};
+uint32_t v_i = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_header[0];
+if (coro_susp_point) {
+memcpy(v_c, self->private_data.s_decode_header[0].v_c, sizeof(v_c));
+v_i = self->private_data.s_decode_header[0].v_i;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (v_i < 6) {
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_c[v_i] = t_0;
+}
+v_i += 1;
+}
+if ((v_c[0] != 71) || (v_c[1] != 73) || (v_c[2] != 70) || (v_c[3] != 56) || ((v_c[4] != 55) && (v_c[4] != 57)) || (v_c[5] != 97)) {
+status = wuffs_base__make_status(wuffs_gif__error__bad_header);goto exit;}
+
+goto ok;ok:self->private_impl.p_decode_header[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_header[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+memcpy(self->private_data.s_decode_header[0].v_c, v_c, sizeof(v_c));
+self->private_data.s_decode_header[0].v_i = v_i;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.config_decoder.decode_lsd
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_lsd(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 11);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_flags = 0;
+uint8_t v_background_color_index = 0;
+uint32_t v_num_palette_entries = 0;
+uint32_t v_i = 0;
+uint32_t v_j = 0;
+uint32_t v_argb = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_lsd[0];
+if (coro_susp_point) {
+v_flags = self->private_data.s_decode_lsd[0].v_flags;
+v_background_color_index = self->private_data.s_decode_lsd[0].v_background_color_index;
+v_num_palette_entries = self->private_data.s_decode_lsd[0].v_num_palette_entries;
+v_i = self->private_data.s_decode_lsd[0].v_i;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+uint32_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_0 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_lsd[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_lsd[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;if (num_bits_0 == 8) { t_0 = ((uint32_t)(*scratch));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0)) << 56;}}
+self->private_impl.f_width = t_0;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_1 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_lsd[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_lsd[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;if (num_bits_1 == 8) { t_1 = ((uint32_t)(*scratch));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1)) << 56;}}
+self->private_impl.f_height = t_1;
+}
+{
+uint8_t t_2;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_2 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_2 = *iop_a_src++;
+}
+v_flags = t_2;
+}
+{
+uint8_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+v_background_color_index = t_3;
+}
+if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }iop_a_src++;
+}
+v_i = 0;
+self->private_impl.f_has_global_palette = ((v_flags & 128) != 0);
+if (self->private_impl.f_has_global_palette) {
+v_num_palette_entries = (((uint32_t)(1)) << (1 + (v_flags & 7)));
+while (v_i < v_num_palette_entries) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+uint32_t t_4;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 3)) {t_4 =((uint32_t)(wuffs_base__load_u24be__no_bounds_check(iop_a_src))); iop_a_src += 3;
+} else {self->private_data.s_decode_lsd[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_lsd[0].scratch;uint32_t num_bits_4 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_4);if (num_bits_4 == 16) { t_4 = ((uint32_t)(*scratch >> 40));break;}num_bits_4 += 8;*scratch |= ((uint64_t)(num_bits_4));}}
+v_argb = t_4;
+}
+v_argb |= 4278190080;
+self->private_data.f_palettes[0][((4 * v_i) + 0)] = ((uint8_t)(((v_argb >> 0) & 255)));
+self->private_data.f_palettes[0][((4 * v_i) + 1)] = ((uint8_t)(((v_argb >> 8) & 255)));
+self->private_data.f_palettes[0][((4 * v_i) + 2)] = ((uint8_t)(((v_argb >> 16) & 255)));
+self->private_data.f_palettes[0][((4 * v_i) + 3)] = ((uint8_t)(((v_argb >> 24) & 255)));
+v_i += 1;
+}
+if (WUFFS_GIF__QUIRK_ENABLED(self, 2)) {
+if ((v_background_color_index != 0) && (((uint32_t)(v_background_color_index)) < v_num_palette_entries)) {
+v_j = (4 * ((uint32_t)(v_background_color_index)));
+self->private_impl.f_background_color_u32_argb_premul = ((((uint32_t)(self->private_data.f_palettes[0][(v_j + 0)])) << 0) | (((uint32_t)(self->private_data.f_palettes[0][(v_j + 1)])) << 8) | (((uint32_t)(self->private_data.f_palettes[0][(v_j + 2)])) << 16) | (((uint32_t)(self->private_data.f_palettes[0][(v_j + 3)])) << 24));
+} else {
+self->private_impl.f_background_color_u32_argb_premul = 77;
+}
+}
+}
+while (v_i < 256) {
+self->private_data.f_palettes[0][((4 * v_i) + 0)] = 0;
+self->private_data.f_palettes[0][((4 * v_i) + 1)] = 0;
+self->private_data.f_palettes[0][((4 * v_i) + 2)] = 0;
+self->private_data.f_palettes[0][((4 * v_i) + 3)] = 255;
+v_i += 1;
+}
+
+goto ok;ok:self->private_impl.p_decode_lsd[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_lsd[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_lsd[0].v_flags = v_flags;
+self->private_data.s_decode_lsd[0].v_background_color_index = v_background_color_index;
+self->private_data.s_decode_lsd[0].v_num_palette_entries = v_num_palette_entries;
+self->private_data.s_decode_lsd[0].v_i = v_i;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.config_decoder.decode_extension
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_extension(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 12);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_label = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_extension[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_label = t_0;
+}
+if (v_label == 249) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_gif__config_decoder__decode_gc(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+status = wuffs_base__make_status(NULL);goto ok;} else if (v_label == 255) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_gif__config_decoder__decode_ae(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+status = wuffs_base__make_status(NULL);goto ok;}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+status = wuffs_gif__config_decoder__skip_blocks(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+
+goto ok;ok:self->private_impl.p_decode_extension[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_extension[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.config_decoder.skip_blocks
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__skip_blocks(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 13);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_block_size = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_skip_blocks[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (true) {
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_block_size = t_0;
+}
+if (v_block_size == 0) {
+status = wuffs_base__make_status(NULL);goto ok;}
+self->private_data.s_skip_blocks[0].scratch = ((uint32_t)(v_block_size));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (self->private_data.s_skip_blocks[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_skip_blocks[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_skip_blocks[0].scratch;
+}
+
+goto ok;ok:self->private_impl.p_skip_blocks[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_skip_blocks[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.config_decoder.decode_ae
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_ae(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 14);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_c = 0;
+uint8_t v_block_size = 0;
+bool v_is_animexts = false;
+bool v_is_netscape = false;
+bool v_is_iccp = false;
+bool v_is_xmp = false;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_ae[0];
+if (coro_susp_point) {
+v_block_size = self->private_data.s_decode_ae[0].v_block_size;
+v_is_animexts = self->private_data.s_decode_ae[0].v_is_animexts;
+v_is_netscape = self->private_data.s_decode_ae[0].v_is_netscape;
+v_is_iccp = self->private_data.s_decode_ae[0].v_is_iccp;
+v_is_xmp = self->private_data.s_decode_ae[0].v_is_xmp;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (true) {
+if (self->private_impl.f_metadata_fourcc != 0) {
+status = wuffs_base__make_status(wuffs_base__note__metadata_reported);goto ok;}
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_block_size = t_0;
+}
+if (v_block_size == 0) {
+status = wuffs_base__make_status(NULL);goto ok;}
+if (v_block_size != 11) {
+self->private_data.s_decode_ae[0].scratch = ((uint32_t)(v_block_size));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (self->private_data.s_decode_ae[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_ae[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_ae[0].scratch;
+goto label__goto_done__break;
+}
+v_is_animexts = true;
+v_is_netscape = true;
+v_is_iccp = true;
+v_is_xmp = true;
+v_block_size = 0;
+while (v_block_size < 11) {
+{
+uint8_t t_1;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_1 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_1 = *iop_a_src++;
+}
+v_c = t_1;
+}
+v_is_animexts = (v_is_animexts && (v_c == WUFFS_GIF__ANIMEXTS1DOT0[v_block_size]));
+v_is_netscape = (v_is_netscape && (v_c == WUFFS_GIF__NETSCAPE2DOT0[v_block_size]));
+v_is_iccp = (v_is_iccp && (v_c == WUFFS_GIF__ICCRGBG1012[v_block_size]));
+v_is_xmp = (v_is_xmp && (v_c == WUFFS_GIF__XMPDATAXMP[v_block_size]));
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+v_block_size += 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+}
+if (v_is_animexts || v_is_netscape) {
+{
+uint8_t t_2;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_2 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_2 = *iop_a_src++;
+}
+v_block_size = t_2;
+}
+if (v_block_size != 3) {
+self->private_data.s_decode_ae[0].scratch = ((uint32_t)(v_block_size));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+if (self->private_data.s_decode_ae[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_ae[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_ae[0].scratch;
+goto label__goto_done__break;
+}
+{
+uint8_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+v_c = t_3;
+}
+if (v_c != 1) {
+self->private_data.s_decode_ae[0].scratch = 2;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+if (self->private_data.s_decode_ae[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_ae[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_ae[0].scratch;
+goto label__goto_done__break;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+uint32_t t_4;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_4 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_ae[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_ae[0].scratch;uint32_t num_bits_4 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_4;if (num_bits_4 == 8) { t_4 = ((uint32_t)(*scratch));break;}num_bits_4 += 8;*scratch |= ((uint64_t)(num_bits_4)) << 56;}}
+self->private_impl.f_num_loops = t_4;
+}
+self->private_impl.f_seen_num_loops = true;
+if ((0 < self->private_impl.f_num_loops) && (self->private_impl.f_num_loops <= 65535)) {
+self->private_impl.f_num_loops += 1;
+}
+} else if (self->private_impl.f_ignore_metadata) {
+} else if (v_is_iccp && self->private_impl.f_report_metadata_iccp) {
+self->private_impl.f_metadata_fourcc = 1229144912;
+self->private_impl.f_metadata_io_position = wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)));
+self->private_impl.f_call_sequence = 1;
+status = wuffs_base__make_status(wuffs_base__note__metadata_reported);goto ok;} else if (v_is_xmp && self->private_impl.f_report_metadata_xmp) {
+self->private_impl.f_metadata_fourcc = 1481461792;
+self->private_impl.f_metadata_io_position = wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)));
+self->private_impl.f_call_sequence = 1;
+status = wuffs_base__make_status(wuffs_base__note__metadata_reported);goto ok;}
+goto label__goto_done__break;
+}
+label__goto_done__break:;
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(10);
+status = wuffs_gif__config_decoder__skip_blocks(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+
+goto ok;ok:self->private_impl.p_decode_ae[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_ae[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_ae[0].v_block_size = v_block_size;
+self->private_data.s_decode_ae[0].v_is_animexts = v_is_animexts;
+self->private_data.s_decode_ae[0].v_is_netscape = v_is_netscape;
+self->private_data.s_decode_ae[0].v_is_iccp = v_is_iccp;
+self->private_data.s_decode_ae[0].v_is_xmp = v_is_xmp;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.config_decoder.decode_gc
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_gc(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 15);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_c = 0;
+uint8_t v_flags = 0;
+uint16_t v_gc_duration_centiseconds = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_gc[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_c = t_0;
+}
+if (v_c != 4) {
+status = wuffs_base__make_status(wuffs_gif__error__bad_graphic_control);goto exit;}
+{
+uint8_t t_1;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_1 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_1 = *iop_a_src++;
+}
+v_flags = t_1;
+}
+self->private_impl.f_gc_has_transparent_index = ((v_flags & 1) != 0);
+v_flags = ((v_flags >> 2) & 7);
+if (v_flags == 2) {
+self->private_impl.f_gc_disposal = 1;
+} else if ((v_flags == 3) || (v_flags == 4)) {
+self->private_impl.f_gc_disposal = 2;
+} else {
+self->private_impl.f_gc_disposal = 0;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+uint16_t t_2;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_2 =wuffs_base__load_u16le__no_bounds_check(iop_a_src); iop_a_src += 2;
+} else {self->private_data.s_decode_gc[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_gc[0].scratch;uint32_t num_bits_2 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_2;if (num_bits_2 == 8) { t_2 = ((uint16_t)(*scratch));break;}num_bits_2 += 8;*scratch |= ((uint64_t)(num_bits_2)) << 56;}}
+v_gc_duration_centiseconds = t_2;
+}
+self->private_impl.f_gc_duration = (((uint64_t)(v_gc_duration_centiseconds)) * 7056000);
+{
+uint8_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+self->private_impl.f_gc_transparent_index = t_3;
+}
+{
+uint8_t t_4;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_4 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_4 = *iop_a_src++;
+}
+v_c = t_4;
+}
+if (v_c != 0) {
+status = wuffs_base__make_status(wuffs_gif__error__bad_graphic_control);goto exit;}
+
+goto ok;ok:self->private_impl.p_decode_gc[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_gc[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.config_decoder.decode_id_part0
+
+static wuffs_base__status //
+wuffs_gif__config_decoder__decode_id_part0(wuffs_gif__config_decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 16);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_id_part0[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+uint32_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_0 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_id_part0[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_id_part0[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;if (num_bits_0 == 8) { t_0 = ((uint32_t)(*scratch));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0)) << 56;}}
+self->private_impl.f_frame_rect_x0 = t_0;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_1 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_id_part0[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_id_part0[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;if (num_bits_1 == 8) { t_1 = ((uint32_t)(*scratch));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1)) << 56;}}
+self->private_impl.f_frame_rect_y0 = t_1;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+uint32_t t_2;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_2 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_id_part0[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_id_part0[0].scratch;uint32_t num_bits_2 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_2;if (num_bits_2 == 8) { t_2 = ((uint32_t)(*scratch));break;}num_bits_2 += 8;*scratch |= ((uint64_t)(num_bits_2)) << 56;}}
+self->private_impl.f_frame_rect_x1 = t_2;
+}
+self->private_impl.f_frame_rect_x1 += self->private_impl.f_frame_rect_x0;
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+uint32_t t_3;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_3 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_id_part0[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_id_part0[0].scratch;uint32_t num_bits_3 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_3;if (num_bits_3 == 8) { t_3 = ((uint32_t)(*scratch));break;}num_bits_3 += 8;*scratch |= ((uint64_t)(num_bits_3)) << 56;}}
+self->private_impl.f_frame_rect_y1 = t_3;
+}
+self->private_impl.f_frame_rect_y1 += self->private_impl.f_frame_rect_y0;
+if ((self->private_impl.f_call_sequence == 0) &&  ! WUFFS_GIF__QUIRK_ENABLED(self, 4)) {
+self->private_impl.f_width = wuffs_base__u32__max(self->private_impl.f_width,self->private_impl.f_frame_rect_x1);
+self->private_impl.f_height = wuffs_base__u32__max(self->private_impl.f_height,self->private_impl.f_frame_rect_y1);
+}
+
+goto ok;ok:self->private_impl.p_decode_id_part0[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_id_part0[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_gif__decoder__set_quirk_enabled(wuffs_gif__decoder *self,uint32_t a_quirk,bool a_enabled){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 0);
+
+
+if ((self->private_impl.f_call_sequence == 0) && (a_quirk >= 1041635328)) {
+a_quirk -= 1041635328;
+if (a_quirk < 7) {
+self->private_impl.f_quirks[a_quirk] = a_enabled;
+}
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func gif.decoder.decode_image_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__decoder__decode_image_config(wuffs_gif__decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 1);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+bool v_ffio = false;
+
+uint32_t coro_susp_point = self->private_impl.p_decode_image_config[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence == 0) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_gif__decoder__decode_header(self,a_src);
+if (status.repr) { goto suspend; }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_gif__decoder__decode_lsd(self,a_src);
+if (status.repr) { goto suspend; }
+} else if (self->private_impl.f_call_sequence != 2) {
+status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);goto exit;}
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_gif__decoder__decode_up_to_id_part1(self,a_src);
+if (status.repr) { goto suspend; }
+v_ffio =  ! self->private_impl.f_gc_has_transparent_index;
+if ( ! WUFFS_GIF__QUIRK_ENABLED(self, 2)) {
+v_ffio = (v_ffio && (self->private_impl.f_frame_rect_x0 == 0) && (self->private_impl.f_frame_rect_y0 == 0) && (self->private_impl.f_frame_rect_x1 == self->private_impl.f_width) && (self->private_impl.f_frame_rect_y1 == self->private_impl.f_height));
+} else if (v_ffio) {
+self->private_impl.f_black_color_u32_argb_premul = 4278190080;
+}
+if (self->private_impl.f_background_color_u32_argb_premul == 77) {
+self->private_impl.f_background_color_u32_argb_premul = self->private_impl.f_black_color_u32_argb_premul;
+}
+if (a_dst != NULL) {
+wuffs_base__image_config__set(a_dst,2198077448,0,self->private_impl.f_width,self->private_impl.f_height,self->private_impl.f_frame_config_io_position,v_ffio);
+}
+self->private_impl.f_call_sequence = 3;
+
+goto ok;ok:self->private_impl.p_decode_image_config[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_image_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func gif.decoder.set_report_metadata
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_gif__decoder__set_report_metadata(wuffs_gif__decoder *self,uint32_t a_fourcc,bool a_report){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 2);
+
+
+if (a_fourcc == 1229144912) {
+self->private_impl.f_report_metadata_iccp = a_report;
+} else if (a_fourcc == 1481461792) {
+self->private_impl.f_report_metadata_xmp = a_report;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func gif.decoder.tell_me_more
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__decoder__tell_me_more(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 2)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 3);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint64_t v_chunk_length = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_tell_me_more[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence != 1) {
+status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);goto exit;}
+if (self->private_impl.f_metadata_fourcc == 0) {
+status = wuffs_base__make_status(wuffs_base__error__no_more_information);goto exit;}
+while (true) {
+label__0__continue:;
+while (true) {
+if (wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src))) != self->private_impl.f_metadata_io_position) {
+if (a_minfo != NULL) {
+wuffs_base__more_information__set(a_minfo,2,0,self->private_impl.f_metadata_io_position,0,0);
+}
+status = wuffs_base__make_status(wuffs_base__suspension__mispositioned_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+goto label__0__continue;
+}
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if (a_minfo != NULL) {
+wuffs_base__more_information__set(a_minfo,0,0,0,0,0);
+}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+goto label__0__continue;
+}
+goto label__0__break;
+}
+label__0__break:;
+v_chunk_length = ((uint64_t)(wuffs_base__load_u8be__no_bounds_check(iop_a_src)));
+if (v_chunk_length <= 0) {
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+goto label__1__break;
+}
+if (self->private_impl.f_metadata_fourcc == 1481461792) {
+v_chunk_length += 1;
+} else {
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+}
+self->private_impl.f_metadata_io_position = wuffs_base__u64__sat_add(wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src))),v_chunk_length);
+if (a_minfo != NULL) {
+wuffs_base__more_information__set(a_minfo,3,self->private_impl.f_metadata_fourcc,0,wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src))),self->private_impl.f_metadata_io_position);
+}
+status = wuffs_base__make_status(wuffs_base__suspension__even_more_information);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(3);
+}
+label__1__break:;
+if (a_minfo != NULL) {
+wuffs_base__more_information__set(a_minfo,3,self->private_impl.f_metadata_fourcc,0,self->private_impl.f_metadata_io_position,self->private_impl.f_metadata_io_position);
+}
+self->private_impl.f_call_sequence = 2;
+self->private_impl.f_metadata_fourcc = 0;
+self->private_impl.f_metadata_io_position = 0;
+status = wuffs_base__make_status(NULL);goto ok;
+goto ok;ok:self->private_impl.p_tell_me_more[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_tell_me_more[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 2 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func gif.decoder.num_animation_loops
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_gif__decoder__num_animation_loops(const wuffs_gif__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+if (self->private_impl.f_seen_num_loops) {
+return self->private_impl.f_num_loops;}
+return 1;}
+
+// -------- func gif.decoder.num_decoded_frame_configs
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_gif__decoder__num_decoded_frame_configs(const wuffs_gif__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+return self->private_impl.f_num_decoded_frame_configs_value;}
+
+// -------- func gif.decoder.num_decoded_frames
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_gif__decoder__num_decoded_frames(const wuffs_gif__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+return self->private_impl.f_num_decoded_frames_value;}
+
+// -------- func gif.decoder.frame_dirty_rect
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_gif__decoder__frame_dirty_rect(const wuffs_gif__decoder *self){
+if (!self) { return wuffs_base__utility__empty_rect_ie_u32();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_rect_ie_u32();}
+
+
+if (self->private_impl.f_band_height > 0) {
+return wuffs_base__utility__make_rect_ie_u32(0,self->private_impl.f_band_y0,wuffs_gif__decoder__dst_coord(self,self->private_impl.f_crop_x1,self->private_impl.f_crop_x0,self->private_impl.f_crop_x1),self->private_impl.f_band_y1);}
+return wuffs_base__utility__make_rect_ie_u32(wuffs_gif__decoder__dst_coord(self,self->private_impl.f_frame_rect_x0,self->private_impl.f_crop_x0,self->private_impl.f_crop_x1),wuffs_gif__decoder__dst_coord(self,self->private_impl.f_frame_rect_y0,self->private_impl.f_crop_y0,self->private_impl.f_crop_y1),wuffs_gif__decoder__dst_coord(self,self->private_impl.f_frame_rect_x1,self->private_impl.f_crop_x0,self->private_impl.f_crop_x1),wuffs_gif__decoder__dst_coord(self,self->private_impl.f_dirty_max_excl_y,self->private_impl.f_crop_y0,self->private_impl.f_crop_y1));}
+
+// -------- func gif.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_gif__decoder__workbuf_len(const wuffs_gif__decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__make_range_ii_u64(36864,36864);}
+
+// -------- func gif.decoder.restart_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_gif__decoder__restart_frame(wuffs_gif__decoder *self,uint64_t a_index,uint64_t a_io_position){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+WUFFS_BASE__STATS__CALL(self, 4);
+
+
+if (self->private_impl.f_call_sequence == 0) {
+return wuffs_base__make_status(wuffs_base__error__bad_call_sequence);}
+self->private_impl.f_delayed_num_decoded_frames = false;
+self->private_impl.f_end_of_data = false;
+self->private_impl.f_restarted = true;
+self->private_impl.f_frame_config_io_position = a_io_position;
+self->private_impl.f_num_decoded_frame_configs_value = a_index;
+self->private_impl.f_num_decoded_frames_value = a_index;
+wuffs_gif__decoder__reset_gc(self);
+return wuffs_base__make_status(NULL);}
+
+// -------- func gif.decoder.decode_frame_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__decoder__decode_frame_config(wuffs_gif__decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 3)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 5);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_background_color = 0;
+uint8_t v_flags = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_frame_config[0];
+if (coro_susp_point) {
+v_background_color = self->private_data.s_decode_frame_config[0].v_background_color;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+self->private_impl.f_ignore_metadata = true;
+self->private_impl.f_dirty_max_excl_y = 0;
+self->private_impl.f_band_height = 0;
+if ( ! self->private_impl.f_end_of_data) {
+if (self->private_impl.f_call_sequence == 0) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_gif__decoder__decode_image_config(self,NULL,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else if (self->private_impl.f_call_sequence != 3) {
+if (self->private_impl.f_call_sequence == 4) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_gif__decoder__skip_frame(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_gif__decoder__decode_up_to_id_part1(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+}
+}
+if (self->private_impl.f_end_of_data) {
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;}
+v_background_color = self->private_impl.f_black_color_u32_argb_premul;
+if ( ! self->private_impl.f_gc_has_transparent_index) {
+v_background_color = self->private_impl.f_background_color_u32_argb_premul;
+if (WUFFS_GIF__QUIRK_ENABLED(self, 1) && (self->private_impl.f_num_decoded_frame_configs_value == 0)) {
+while (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(4);
+}
+v_flags = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+if ((v_flags & 128) != 0) {
+v_background_color = self->private_impl.f_black_color_u32_argb_premul;
+}
+}
+}
+if (a_dst != NULL) {
+wuffs_base__frame_config__update(a_dst,wuffs_base__utility__make_rect_ie_u32(wuffs_base__u32__min(self->private_impl.f_frame_rect_x0,self->private_impl.f_width),wuffs_base__u32__min(self->private_impl.f_frame_rect_y0,self->private_impl.f_height),wuffs_base__u32__min(self->private_impl.f_frame_rect_x1,self->private_impl.f_width),wuffs_base__u32__min(self->private_impl.f_frame_rect_y1,self->private_impl.f_height)),((wuffs_base__flicks)(self->private_impl.f_gc_duration)),self->private_impl.f_num_decoded_frame_configs_value,self->private_impl.f_frame_config_io_position,self->private_impl.f_gc_disposal, ! self->private_impl.f_gc_has_transparent_index,false,v_background_color);
+}
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frame_configs_value,1);
+self->private_impl.f_call_sequence = 4;
+
+goto ok;ok:self->private_impl.p_decode_frame_config[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_frame_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 3 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+self->private_data.s_decode_frame_config[0].v_background_color = v_background_color;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func gif.decoder.skip_frame
+
+static wuffs_base__status //
+wuffs_gif__decoder__skip_frame(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 6);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_flags = 0;
+uint8_t v_lw = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_skip_frame[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_flags = t_0;
+}
+if ((v_flags & 128) != 0) {
+self->private_data.s_skip_frame[0].scratch = (((uint32_t)(3)) << (1 + (v_flags & 7)));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (self->private_data.s_skip_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_skip_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_skip_frame[0].scratch;
+}
+{
+uint8_t t_1;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_1 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_1 = *iop_a_src++;
+}
+v_lw = t_1;
+}
+if (v_lw > 8) {
+status = wuffs_base__make_status(wuffs_gif__error__bad_literal_width);goto exit;}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+status = wuffs_gif__decoder__skip_blocks(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+if (WUFFS_GIF__QUIRK_ENABLED(self, 0)) {
+self->private_impl.f_delayed_num_decoded_frames = true;
+} else {
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frames_value,1);
+}
+wuffs_gif__decoder__reset_gc(self);
+
+goto ok;ok:self->private_impl.p_skip_frame[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_skip_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.decode_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_gif__decoder__decode_frame(wuffs_gif__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 4)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 7);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+uint32_t coro_susp_point = self->private_impl.p_decode_frame[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+self->private_impl.f_ignore_metadata = true;
+if (self->private_impl.f_call_sequence != 4) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_gif__decoder__decode_frame_config(self,NULL,a_src);
+if (status.repr) { goto suspend; }
+}
+self->private_impl.f_scale_shift = 0;
+self->private_impl.f_crop_x0 = 0;
+self->private_impl.f_crop_y0 = 0;
+self->private_impl.f_crop_x1 = self->private_impl.f_width;
+self->private_impl.f_crop_y1 = self->private_impl.f_height;
+if (a_opts != NULL) {
+self->private_impl.f_scale_shift = wuffs_base__decode_frame_options__scale_shift(a_opts);
+self->private_impl.f_crop_x1 = wuffs_base__u32__min(self->private_impl.f_width,wuffs_base__decode_frame_options__crop_max_excl_x(a_opts));
+self->private_impl.f_crop_y1 = wuffs_base__u32__min(self->private_impl.f_height,wuffs_base__decode_frame_options__crop_max_excl_y(a_opts));
+self->private_impl.f_crop_x0 = wuffs_base__u32__min(self->private_impl.f_crop_x1,wuffs_base__decode_frame_options__crop_min_incl_x(a_opts));
+self->private_impl.f_crop_y0 = wuffs_base__u32__min(self->private_impl.f_crop_y1,wuffs_base__decode_frame_options__crop_min_incl_y(a_opts));
+}
+self->private_impl.f_sparse = ((self->private_impl.f_scale_shift != 0) || (self->private_impl.f_crop_x0 != 0) || (self->private_impl.f_crop_y0 != 0) || (self->private_impl.f_crop_x1 != self->private_impl.f_width) || (self->private_impl.f_crop_y1 != self->private_impl.f_height));
+self->private_impl.f_dst_rect_y1 = wuffs_gif__decoder__dst_coord(self,self->private_impl.f_crop_y1,self->private_impl.f_crop_y0,self->private_impl.f_crop_y1);
+self->private_impl.f_band_height = 0;
+if (a_opts != NULL) {
+self->private_impl.f_band_height = wuffs_base__decode_frame_options__band_height(a_opts);
+}
+self->private_impl.f_band_y0 = 0;
+self->private_impl.f_band_y1 = self->private_impl.f_dst_rect_y1;
+if (self->private_impl.f_band_height > 0) {
+self->private_impl.f_band_y1 = wuffs_base__u32__min(self->private_impl.f_dst_rect_y1,self->private_impl.f_band_height);
+}
+if (WUFFS_GIF__QUIRK_ENABLED(self, 5) && ((self->private_impl.f_frame_rect_x0 == self->private_impl.f_frame_rect_x1) || (self->private_impl.f_frame_rect_y0 == self->private_impl.f_frame_rect_y1))) {
+status = wuffs_base__make_status(wuffs_gif__error__bad_frame_size);goto exit;}
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_gif__decoder__decode_id_part1(self,a_dst,a_src,a_blend);
+if (status.repr) { goto suspend; }
+if ((self->private_impl.f_band_height > 0) && (self->private_impl.f_interlace != 0)) {
+status = wuffs_base__make_status(wuffs_base__error__unsupported_option);goto exit;}
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_gif__decoder__decode_id_part2(self,a_dst,a_src,a_workbuf);
+if (status.repr) { goto suspend; }
+while (self->private_impl.f_band_y1 < self->private_impl.f_dst_rect_y1) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(4);
+wuffs_gif__decoder__next_band(self);
+}
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frames_value,1);
+wuffs_gif__decoder__reset_gc(self);
+
+goto ok;ok:self->private_impl.p_decode_frame[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 4 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func gif.decoder.reset_gc
+
+static wuffs_base__empty_struct //
+wuffs_gif__decoder__reset_gc(wuffs_gif__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 8);
+
+
+self->private_impl.f_call_sequence = 5;
+self->private_impl.f_gc_has_transparent_index = false;
+self->private_impl.f_gc_transparent_index = 0;
+self->private_impl.f_gc_disposal = 0;
+self->private_impl.f_gc_duration = 0;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func gif.decoder.decode_up_to_id_part1
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_up_to_id_part1(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 9);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_block_type = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_up_to_id_part1[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if ( ! self->private_impl.f_restarted) {
+if (self->private_impl.f_call_sequence != 2) {
+self->private_impl.f_frame_config_io_position = wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)));
+}
+} else if (self->private_impl.f_frame_config_io_position != wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)))) {
+status = wuffs_base__make_status(wuffs_base__error__bad_restart);goto exit;} else {
+self->private_impl.f_restarted = false;
+}
+while (true) {
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_block_type = t_0;
+}
+if (v_block_type == 33) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_gif__decoder__decode_extension(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else if (v_block_type == 44) {
+if (self->private_impl.f_delayed_num_decoded_frames) {
+self->private_impl.f_delayed_num_decoded_frames = false;
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frames_value,1);
+}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_gif__decoder__decode_id_part0(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+goto label__0__break;
+} else {
+if (self->private_impl.f_delayed_num_decoded_frames) {
+self->private_impl.f_delayed_num_decoded_frames = false;
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frames_value,1);
+}
+self->private_impl.f_end_of_data = true;
+goto label__0__break;
+}
+}
+label__0__break:;
+
+goto ok;ok:self->private_impl.p_decode_up_to_id_part1[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_up_to_id_part1[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.decode_header
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_header(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 10);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_c[6] = {0};
+uint32_t v_i = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_header[0];
+if (coro_susp_point) {
+memcpy(v_c, self->private_data.s_decode_header[0].v_c, sizeof(v_c));
+v_i = self->private_data.s_decode_header[0].v_i;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (v_i < 6) {
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_c[v_i] = t_0;
+}
+v_i += 1;
+}
+if ((v_c[0] != 71) || (v_c[1] != 73) || (v_c[2] != 70) || (v_c[3] != 56) || ((v_c[4] != 55) && (v_c[4] != 57)) || (v_c[5] != 97)) {
+status = wuffs_base__make_status(wuffs_gif__error__bad_header);goto exit;}
+
+goto ok;ok:self->private_impl.p_decode_header[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_header[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+memcpy(self->private_data.s_decode_header[0].v_c, v_c, sizeof(v_c));
+self->private_data.s_decode_header[0].v_i = v_i;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.decode_lsd
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_lsd(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 11);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_flags = 0;
+uint8_t v_background_color_index = 0;
+uint32_t v_num_palette_entries = 0;
+uint32_t v_i = 0;
+uint32_t v_j = 0;
+uint32_t v_argb = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_lsd[0];
+if (coro_susp_point) {
+v_flags = self->private_data.s_decode_lsd[0].v_flags;
+v_background_color_index = self->private_data.s_decode_lsd[0].v_background_color_index;
+v_num_palette_entries = self->private_data.s_decode_lsd[0].v_num_palette_entries;
+v_i = self->private_data.s_decode_lsd[0].v_i;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+uint32_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_0 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_lsd[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_lsd[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;if (num_bits_0 == 8) { t_0 = ((uint32_t)(*scratch));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0)) << 56;}}
+self->private_impl.f_width = t_0;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_1 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_lsd[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_lsd[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;if (num_bits_1 == 8) { t_1 = ((uint32_t)(*scratch));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1)) << 56;}}
+self->private_impl.f_height = t_1;
+}
+{
+uint8_t t_2;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_2 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_2 = *iop_a_src++;
+}
+v_flags = t_2;
+}
+{
+uint8_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+v_background_color_index = t_3;
+}
+if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }iop_a_src++;
+}
+v_i = 0;
+self->private_impl.f_has_global_palette = ((v_flags & 128) != 0);
+if (self->private_impl.f_has_global_palette) {
+v_num_palette_entries = (((uint32_t)(1)) << (1 + (v_flags & 7)));
+while (v_i < v_num_palette_entries) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+uint32_t t_4;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 3)) {t_4 =((uint32_t)(wuffs_base__load_u24be__no_bounds_check(iop_a_src))); iop_a_src += 3;
+} else {self->private_data.s_decode_lsd[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_lsd[0].scratch;uint32_t num_bits_4 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_4);if (num_bits_4 == 16) { t_4 = ((uint32_t)(*scratch >> 40));break;}num_bits_4 += 8;*scratch |= ((uint64_t)(num_bits_4));}}
+v_argb = t_4;
+}
+v_argb |= 4278190080;
+self->private_data.f_palettes[0][((4 * v_i) + 0)] = ((uint8_t)(((v_argb >> 0) & 255)));
+self->private_data.f_palettes[0][((4 * v_i) + 1)] = ((uint8_t)(((v_argb >> 8) & 255)));
+self->private_data.f_palettes[0][((4 * v_i) + 2)] = ((uint8_t)(((v_argb >> 16) & 255)));
+self->private_data.f_palettes[0][((4 * v_i) + 3)] = ((uint8_t)(((v_argb >> 24) & 255)));
+v_i += 1;
+}
+if (WUFFS_GIF__QUIRK_ENABLED(self, 2)) {
+if ((v_background_color_index != 0) && (((uint32_t)(v_background_color_index)) < v_num_palette_entries)) {
+v_j = (4 * ((uint32_t)(v_background_color_index)));
+self->private_impl.f_background_color_u32_argb_premul = ((((uint32_t)(self->private_data.f_palettes[0][(v_j + 0)])) << 0) | (((uint32_t)(self->private_data.f_palettes[0][(v_j + 1)])) << 8) | (((uint32_t)(self->private_data.f_palettes[0][(v_j + 2)])) << 16) | (((uint32_t)(self->private_data.f_palettes[0][(v_j + 3)])) << 24));
+} else {
+self->private_impl.f_background_color_u32_argb_premul = 77;
+}
+}
+}
+while (v_i < 256) {
+self->private_data.f_palettes[0][((4 * v_i) + 0)] = 0;
+self->private_data.f_palettes[0][((4 * v_i) + 1)] = 0;
+self->private_data.f_palettes[0][((4 * v_i) + 2)] = 0;
+self->private_data.f_palettes[0][((4 * v_i) + 3)] = 255;
+v_i += 1;
+}
+
+goto ok;ok:self->private_impl.p_decode_lsd[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_lsd[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_lsd[0].v_flags = v_flags;
+self->private_data.s_decode_lsd[0].v_background_color_index = v_background_color_index;
+self->private_data.s_decode_lsd[0].v_num_palette_entries = v_num_palette_entries;
+self->private_data.s_decode_lsd[0].v_i = v_i;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.decode_extension
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_extension(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 12);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_label = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_extension[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_label = t_0;
+}
+if (v_label == 249) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_gif__decoder__decode_gc(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+status = wuffs_base__make_status(NULL);goto ok;} else if (v_label == 255) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_gif__decoder__decode_ae(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+status = wuffs_base__make_status(NULL);goto ok;}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+status = wuffs_gif__decoder__skip_blocks(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+
+goto ok;ok:self->private_impl.p_decode_extension[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_extension[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.skip_blocks
+
+static wuffs_base__status //
+wuffs_gif__decoder__skip_blocks(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 13);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_block_size = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_skip_blocks[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (true) {
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_block_size = t_0;
+}
+if (v_block_size == 0) {
+status = wuffs_base__make_status(NULL);goto ok;}
+self->private_data.s_skip_blocks[0].scratch = ((uint32_t)(v_block_size));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (self->private_data.s_skip_blocks[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_skip_blocks[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_skip_blocks[0].scratch;
+}
+
+goto ok;ok:self->private_impl.p_skip_blocks[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_skip_blocks[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.decode_ae
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_ae(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 14);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_c = 0;
+uint8_t v_block_size = 0;
+bool v_is_animexts = false;
+bool v_is_netscape = false;
+bool v_is_iccp = false;
+bool v_is_xmp = false;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_ae[0];
+if (coro_susp_point) {
+v_block_size = self->private_data.s_decode_ae[0].v_block_size;
+v_is_animexts = self->private_data.s_decode_ae[0].v_is_animexts;
+v_is_netscape = self->private_data.s_decode_ae[0].v_is_netscape;
+v_is_iccp = self->private_data.s_decode_ae[0].v_is_iccp;
+v_is_xmp = self->private_data.s_decode_ae[0].v_is_xmp;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (true) {
+if (self->private_impl.f_metadata_fourcc != 0) {
+status = wuffs_base__make_status(wuffs_base__note__metadata_reported);goto ok;}
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_block_size = t_0;
+}
+if (v_block_size == 0) {
+status = wuffs_base__make_status(NULL);goto ok;}
+if (v_block_size != 11) {
+self->private_data.s_decode_ae[0].scratch = ((uint32_t)(v_block_size));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (self->private_data.s_decode_ae[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_ae[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_ae[0].scratch;
+goto label__goto_done__break;
+}
+v_is_animexts = true;
+v_is_netscape = true;
+v_is_iccp = true;
+v_is_xmp = true;
+v_block_size = 0;
+while (v_block_size < 11) {
+{
+uint8_t t_1;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_1 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_1 = *iop_a_src++;
+}
+v_c = t_1;
+}
+v_is_animexts = (v_is_animexts && (v_c == WUFFS_GIF__ANIMEXTS1DOT0[v_block_size]));
+v_is_netscape = (v_is_netscape && (v_c == WUFFS_GIF__NETSCAPE2DOT0[v_block_size]));
+v_is_iccp = (v_is_iccp && (v_c == WUFFS_GIF__ICCRGBG1012[v_block_size]));
+v_is_xmp = (v_is_xmp && (v_c == WUFFS_GIF__XMPDATAXMP[v_block_size]));
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+v_block_size += 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+}
+if (v_is_animexts || v_is_netscape) {
+{
+uint8_t t_2;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_2 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_2 = *iop_a_src++;
+}
+v_block_size = t_2;
+}
+if (v_block_size != 3) {
+self->private_data.s_decode_ae[0].scratch = ((uint32_t)(v_block_size));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+if (self->private_data.s_decode_ae[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_ae[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_ae[0].scratch;
+goto label__goto_done__break;
+}
+{
+uint8_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+v_c = t_3;
+}
+if (v_c != 1) {
+self->private_data.s_decode_ae[0].scratch = 2;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+if (self->private_data.s_decode_ae[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_ae[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_ae[0].scratch;
+goto label__goto_done__break;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+uint32_t t_4;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_4 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_ae[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_ae[0].scratch;uint32_t num_bits_4 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_4;if (num_bits_4 == 8) { t_4 = ((uint32_t)(*scratch));break;}num_bits_4 += 8;*scratch |= ((uint64_t)(num_bits_4)) << 56;}}
+self->private_impl.f_num_loops = t_4;
+}
+self->private_impl.f_seen_num_loops = true;
+if ((0 < self->private_impl.f_num_loops) && (self->private_impl.f_num_loops <= 65535)) {
+self->private_impl.f_num_loops += 1;
+}
+} else if (self->private_impl.f_ignore_metadata) {
+} else if (v_is_iccp && self->private_impl.f_report_metadata_iccp) {
+self->private_impl.f_metadata_fourcc = 1229144912;
+self->private_impl.f_metadata_io_position = wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)));
+self->private_impl.f_call_sequence = 1;
+status = wuffs_base__make_status(wuffs_base__note__metadata_reported);goto ok;} else if (v_is_xmp && self->private_impl.f_report_metadata_xmp) {
+self->private_impl.f_metadata_fourcc = 1481461792;
+self->private_impl.f_metadata_io_position = wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)));
+self->private_impl.f_call_sequence = 1;
+status = wuffs_base__make_status(wuffs_base__note__metadata_reported);goto ok;}
+goto label__goto_done__break;
+}
+label__goto_done__break:;
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(10);
+status = wuffs_gif__decoder__skip_blocks(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+
+goto ok;ok:self->private_impl.p_decode_ae[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_ae[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_ae[0].v_block_size = v_block_size;
+self->private_data.s_decode_ae[0].v_is_animexts = v_is_animexts;
+self->private_data.s_decode_ae[0].v_is_netscape = v_is_netscape;
+self->private_data.s_decode_ae[0].v_is_iccp = v_is_iccp;
+self->private_data.s_decode_ae[0].v_is_xmp = v_is_xmp;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.decode_gc
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_gc(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 15);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_c = 0;
+uint8_t v_flags = 0;
+uint16_t v_gc_duration_centiseconds = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_gc[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_c = t_0;
+}
+if (v_c != 4) {
+status = wuffs_base__make_status(wuffs_gif__error__bad_graphic_control);goto exit;}
+{
+uint8_t t_1;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_1 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_1 = *iop_a_src++;
+}
+v_flags = t_1;
+}
+self->private_impl.f_gc_has_transparent_index = ((v_flags & 1) != 0);
+v_flags = ((v_flags >> 2) & 7);
+if (v_flags == 2) {
+self->private_impl.f_gc_disposal = 1;
+} else if ((v_flags == 3) || (v_flags == 4)) {
+self->private_impl.f_gc_disposal = 2;
+} else {
+self->private_impl.f_gc_disposal = 0;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+uint16_t t_2;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_2 =wuffs_base__load_u16le__no_bounds_check(iop_a_src); iop_a_src += 2;
+} else {self->private_data.s_decode_gc[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_gc[0].scratch;uint32_t num_bits_2 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_2;if (num_bits_2 == 8) { t_2 = ((uint16_t)(*scratch));break;}num_bits_2 += 8;*scratch |= ((uint64_t)(num_bits_2)) << 56;}}
+v_gc_duration_centiseconds = t_2;
+}
+self->private_impl.f_gc_duration = (((uint64_t)(v_gc_duration_centiseconds)) * 7056000);
+{
+uint8_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+self->private_impl.f_gc_transparent_index = t_3;
+}
+{
+uint8_t t_4;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_4 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_4 = *iop_a_src++;
+}
+v_c = t_4;
+}
+if (v_c != 0) {
+status = wuffs_base__make_status(wuffs_gif__error__bad_graphic_control);goto exit;}
+
+goto ok;ok:self->private_impl.p_decode_gc[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_gc[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.decode_id_part0
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_id_part0(wuffs_gif__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 16);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_id_part0[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+uint32_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_0 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_id_part0[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_id_part0[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;if (num_bits_0 == 8) { t_0 = ((uint32_t)(*scratch));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0)) << 56;}}
+self->private_impl.f_frame_rect_x0 = t_0;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_1 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_id_part0[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_id_part0[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;if (num_bits_1 == 8) { t_1 = ((uint32_t)(*scratch));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1)) << 56;}}
+self->private_impl.f_frame_rect_y0 = t_1;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+uint32_t t_2;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_2 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_id_part0[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_id_part0[0].scratch;uint32_t num_bits_2 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_2;if (num_bits_2 == 8) { t_2 = ((uint32_t)(*scratch));break;}num_bits_2 += 8;*scratch |= ((uint64_t)(num_bits_2)) << 56;}}
+self->private_impl.f_frame_rect_x1 = t_2;
+}
+self->private_impl.f_frame_rect_x1 += self->private_impl.f_frame_rect_x0;
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+uint32_t t_3;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_3 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_id_part0[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_id_part0[0].scratch;uint32_t num_bits_3 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_3;if (num_bits_3 == 8) { t_3 = ((uint32_t)(*scratch));break;}num_bits_3 += 8;*scratch |= ((uint64_t)(num_bits_3)) << 56;}}
+self->private_impl.f_frame_rect_y1 = t_3;
+}
+self->private_impl.f_frame_rect_y1 += self->private_impl.f_frame_rect_y0;
+self->private_impl.f_dst_x = self->private_impl.f_frame_rect_x0;
+self->private_impl.f_dst_y = self->private_impl.f_frame_rect_y0;
+if ((self->private_impl.f_call_sequence == 0) &&  ! WUFFS_GIF__QUIRK_ENABLED(self, 4)) {
+self->private_impl.f_width = wuffs_base__u32__max(self->private_impl.f_width,self->private_impl.f_frame_rect_x1);
+self->private_impl.f_height = wuffs_base__u32__max(self->private_impl.f_height,self->private_impl.f_frame_rect_y1);
+}
+
+goto ok;ok:self->private_impl.p_decode_id_part0[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_id_part0[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.decode_id_part1
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_id_part1(wuffs_gif__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend){
+WUFFS_BASE__STATS__CALL(self, 17);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_flags = 0;
+uint8_t v_which_palette = 0;
+uint32_t v_num_palette_entries = 0;
+uint32_t v_i = 0;
+uint32_t v_argb = 0;
+wuffs_base__slice_u8 v_dst_palette = {0};
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+uint8_t v_lw = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_id_part1[0];
+if (coro_susp_point) {
+v_which_palette = self->private_data.s_decode_id_part1[0].v_which_palette;
+v_num_palette_entries = self->private_data.s_decode_id_part1[0].v_num_palette_entries;
+v_i = self->private_data.s_decode_id_part1[0].v_i;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_flags = t_0;
+}
+if ((v_flags & 64) != 0) {
+self->private_impl.f_interlace = 4;
+} else {
+self->private_impl.f_interlace = 0;
+}
+v_which_palette = 1;
+if ((v_flags & 128) != 0) {
+v_num_palette_entries = (((uint32_t)(1)) << (1 + (v_flags & 7)));
+v_i = 0;
+while (v_i < v_num_palette_entries) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 3)) {t_1 =((uint32_t)(wuffs_base__load_u24be__no_bounds_check(iop_a_src))); iop_a_src += 3;
+} else {self->private_data.s_decode_id_part1[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_id_part1[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_1);if (num_bits_1 == 16) { t_1 = ((uint32_t)(*scratch >> 40));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1));}}
+v_argb = t_1;
+}
+v_argb |= 4278190080;
+self->private_data.f_palettes[1][((4 * v_i) + 0)] = ((uint8_t)(((v_argb >> 0) & 255)));
+self->private_data.f_palettes[1][((4 * v_i) + 1)] = ((uint8_t)(((v_argb >> 8) & 255)));
+self->private_data.f_palettes[1][((4 * v_i) + 2)] = ((uint8_t)(((v_argb >> 16) & 255)));
+self->private_data.f_palettes[1][((4 * v_i) + 3)] = ((uint8_t)(((v_argb >> 24) & 255)));
+v_i += 1;
+}
+while (v_i < 256) {
+self->private_data.f_palettes[1][((4 * v_i) + 0)] = 0;
+self->private_data.f_palettes[1][((4 * v_i) + 1)] = 0;
+self->private_data.f_palettes[1][((4 * v_i) + 2)] = 0;
+self->private_data.f_palettes[1][((4 * v_i) + 3)] = 255;
+v_i += 1;
+}
+} else if (WUFFS_GIF__QUIRK_ENABLED(self, 6) &&  ! self->private_impl.f_has_global_palette) {
+status = wuffs_base__make_status(wuffs_gif__error__bad_palette);goto exit;} else if (self->private_impl.f_gc_has_transparent_index) {
+wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8(self->private_data.f_palettes[1], 1024),wuffs_base__make_slice_u8(self->private_data.f_palettes[0], 1024));
+} else {
+v_which_palette = 0;
+}
+if (self->private_impl.f_gc_has_transparent_index) {
+self->private_data.f_palettes[1][((4 * ((uint32_t)(self->private_impl.f_gc_transparent_index))) + 0)] = 0;
+self->private_data.f_palettes[1][((4 * ((uint32_t)(self->private_impl.f_gc_transparent_index))) + 1)] = 0;
+self->private_data.f_palettes[1][((4 * ((uint32_t)(self->private_impl.f_gc_transparent_index))) + 2)] = 0;
+self->private_data.f_palettes[1][((4 * ((uint32_t)(self->private_impl.f_gc_transparent_index))) + 3)] = 0;
+}
+v_dst_palette = wuffs_base__pixel_buffer__palette(a_dst);
+if (((uint64_t)(v_dst_palette.len)) == 0) {
+v_dst_palette = wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024);
+}
+v_status = wuffs_base__pixel_swizzler__prepare(&self->private_impl.f_swizzler,wuffs_base__pixel_buffer__pixel_format(a_dst),v_dst_palette,wuffs_base__utility__make_pixel_format(2198077448),wuffs_base__make_slice_u8(self->private_data.f_palettes[v_which_palette], 1024),a_blend);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+if (self->private_impl.f_previous_lzw_decode_ended_abruptly) {
+wuffs_base__ignore_status(wuffs_lzw__decoder__initialize(&self->private_data.f_lzw, sizeof (wuffs_lzw__decoder), WUFFS_VERSION, 0));
+}
+{
+uint8_t t_2;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_2 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_2 = *iop_a_src++;
+}
+v_lw = t_2;
+}
+if (v_lw > 8) {
+status = wuffs_base__make_status(wuffs_gif__error__bad_literal_width);goto exit;}
+wuffs_lzw__decoder__set_literal_width(&self->private_data.f_lzw,((uint32_t)(v_lw)));
+self->private_impl.f_previous_lzw_decode_ended_abruptly = true;
+
+goto ok;ok:self->private_impl.p_decode_id_part1[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_id_part1[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_id_part1[0].v_which_palette = v_which_palette;
+self->private_data.s_decode_id_part1[0].v_num_palette_entries = v_num_palette_entries;
+self->private_data.s_decode_id_part1[0].v_i = v_i;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.decode_id_part2
+
+static wuffs_base__status //
+wuffs_gif__decoder__decode_id_part2(wuffs_gif__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+wuffs_base__io_buffer empty_io_buffer = wuffs_base__empty_io_buffer();
+
+WUFFS_BASE__STATS__CALL(self, 18);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint64_t v_block_size = 0;
+bool v_need_block_size = false;
+uint64_t v_n_compressed = 0;
+wuffs_base__slice_u8 v_compressed = {0};
+wuffs_base__io_buffer u_r = wuffs_base__empty_io_buffer();
+wuffs_base__io_buffer* v_r = &u_r;
+const uint8_t* iop_v_r WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+const uint8_t* io0_v_r WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+const uint8_t* io1_v_r WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+const uint8_t* io2_v_r WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+uint64_t v_mark = 0;
+wuffs_base__status v_lzw_status = wuffs_base__make_status(NULL);
+wuffs_base__status v_copy_status = wuffs_base__make_status(NULL);
+uint64_t v_n_uncompressed = 0;
+wuffs_base__slice_u8 v_uncompressed = {0};
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_id_part2[0];
+if (coro_susp_point) {
+v_block_size = self->private_data.s_decode_id_part2[0].v_block_size;
+v_need_block_size = self->private_data.s_decode_id_part2[0].v_need_block_size;
+v_lzw_status = self->private_data.s_decode_id_part2[0].v_lzw_status;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+v_need_block_size = true;
+label__outer__continue:;
+while (true) {
+if (v_need_block_size) {
+v_need_block_size = false;
+{
+uint64_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_block_size = t_0;
+}
+}
+if (v_block_size == 0) {
+goto label__outer__break;
+}
+while (((uint64_t)(io2_a_src - iop_a_src)) == 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+}
+if (((uint64_t)(a_workbuf.len)) < 36864) {
+status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);goto exit;}
+if (self->private_impl.f_compressed_ri == self->private_impl.f_compressed_wi) {
+self->private_impl.f_compressed_ri = 0;
+self->private_impl.f_compressed_wi = 0;
+}
+while (self->private_impl.f_compressed_wi <= 3841) {
+v_n_compressed = wuffs_base__u64__min(v_block_size,((uint64_t)(io2_a_src - iop_a_src)));
+if (v_n_compressed <= 0) {
+goto label__0__break;
+}
+v_compressed = wuffs_base__io_reader__take(&iop_a_src, io2_a_src,v_n_compressed);
+wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_i(a_workbuf,self->private_impl.f_compressed_wi),v_compressed);
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_compressed_wi,v_n_compressed);
+wuffs_base__u64__sat_sub_indirect(&v_block_size,v_n_compressed);
+if (v_block_size > 0) {
+goto label__0__break;
+}
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+v_need_block_size = true;
+goto label__0__break;
+}
+v_block_size = ((uint64_t)(wuffs_base__load_u8be__no_bounds_check(iop_a_src)));
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+}
+label__0__break:;
+label__inner__continue:;
+while (true) {
+if ((self->private_impl.f_compressed_ri > self->private_impl.f_compressed_wi) || (self->private_impl.f_compressed_wi > 4096)) {
+status = wuffs_base__make_status(wuffs_gif__error__internal_error_inconsistent_ri_wi);goto exit;} else if (((uint64_t)(a_workbuf.len)) < 36864) {
+status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);goto exit;}
+{
+wuffs_base__io_buffer* o_0_v_r = v_r;
+const uint8_t *o_0_iop_v_r = iop_v_r;
+const uint8_t *o_0_io0_v_r = io0_v_r;
+const uint8_t *o_0_io1_v_r = io1_v_r;
+const uint8_t *o_0_io2_v_r = io2_v_r;
+v_r = wuffs_base__io_reader__set(&u_r, &iop_v_r, &io0_v_r, &io1_v_r, &io2_v_r,wuffs_base__slice_u8__subslice_ij(a_workbuf,self->private_impl.f_compressed_ri,self->private_impl.f_compressed_wi));
+v_mark = ((uint64_t)(iop_v_r - io0_v_r));
+{
+u_r.meta.ri = ((size_t)(iop_v_r - u_r.data.ptr));
+wuffs_base__status t_1 = wuffs_lzw__decoder__transform_io(&self->private_data.f_lzw,&empty_io_buffer,v_r,wuffs_base__slice_u8__subslice_i(a_workbuf,4096));
+iop_v_r = u_r.data.ptr + u_r.meta.ri;
+v_lzw_status = t_1;
+}
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_compressed_ri,wuffs_base__io__count_since(v_mark, ((uint64_t)(iop_v_r - io0_v_r))));
+v_r = o_0_v_r;
+iop_v_r = o_0_iop_v_r;
+io0_v_r = o_0_io0_v_r;
+io1_v_r = o_0_io1_v_r;
+io2_v_r = o_0_io2_v_r;
+}
+while (true) {
+while (wuffs_gif__decoder__band_is_done(self)) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(3);
+wuffs_gif__decoder__next_band(self);
+}
+if (self->private_impl.f_band_height > 0) {
+v_n_uncompressed = ((uint64_t)((self->private_impl.f_frame_rect_x1 - self->private_impl.f_dst_x)));
+v_uncompressed = wuffs_lzw__decoder__flush_up_to(&self->private_data.f_lzw,wuffs_base__u64__max(v_n_uncompressed,1));
+} else {
+v_uncompressed = wuffs_lzw__decoder__flush(&self->private_data.f_lzw);
+}
+if (((uint64_t)(v_uncompressed.len)) <= 0) {
+goto label__1__break;
+}
+if ( ! self->private_impl.f_sparse) {
+v_copy_status = wuffs_gif__decoder__copy_to_image_buffer(self,a_dst,v_uncompressed);
+} else {
+v_copy_status = wuffs_gif__decoder__copy_to_image_buffer_sparse(self,a_dst,v_uncompressed);
+}
+if (wuffs_base__status__is_error(&v_copy_status)) {
+status = v_copy_status;goto exit;} else if (self->private_impl.f_band_height == 0) {
+goto label__1__break;
+}
+}
+label__1__break:;
+if (wuffs_base__status__is_ok(&v_lzw_status)) {
+self->private_impl.f_previous_lzw_decode_ended_abruptly = false;
+if (v_need_block_size || (v_block_size > 0)) {
+self->private_data.s_decode_id_part2[0].scratch = ((uint32_t)(v_block_size));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+if (self->private_data.s_decode_id_part2[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_id_part2[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_id_part2[0].scratch;
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+status = wuffs_gif__decoder__skip_blocks(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+}
+goto label__outer__break;
+} else if (v_lzw_status.repr == wuffs_base__make_status(wuffs_base__suspension__short_read).repr) {
+goto label__outer__continue;
+} else if (v_lzw_status.repr == wuffs_base__make_status(wuffs_base__suspension__short_write).repr) {
+goto label__inner__continue;
+}
+status = v_lzw_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+}
+label__outer__break:;
+self->private_impl.f_compressed_ri = 0;
+self->private_impl.f_compressed_wi = 0;
+if ((self->private_impl.f_dst_y < self->private_impl.f_frame_rect_y1) && (self->private_impl.f_frame_rect_x0 != self->private_impl.f_frame_rect_x1) && (self->private_impl.f_frame_rect_y0 != self->private_impl.f_frame_rect_y1)) {
+status = wuffs_base__make_status(wuffs_base__error__not_enough_data);goto exit;}
+
+goto ok;ok:self->private_impl.p_decode_id_part2[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_id_part2[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_id_part2[0].v_block_size = v_block_size;
+self->private_data.s_decode_id_part2[0].v_need_block_size = v_need_block_size;
+self->private_data.s_decode_id_part2[0].v_lzw_status = v_lzw_status;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func gif.decoder.copy_to_image_buffer
+
+static wuffs_base__status//
+wuffs_gif__decoder__copy_to_image_buffer(wuffs_gif__decoder *self,wuffs_base__pixel_buffer* a_pb,wuffs_base__slice_u8 a_src){
+WUFFS_BASE__STATS__CALL(self, 19);
+
+wuffs_base__slice_u8 v_dst = {0};
+wuffs_base__slice_u8 v_src = {0};
+uint64_t v_width_in_bytes = 0;
+uint64_t v_n = 0;
+uint64_t v_src_ri = 0;
+wuffs_base__pixel_format v_pixfmt = {0};
+uint32_t v_bytes_per_pixel = 0;
+uint32_t v_bits_per_pixel = 0;
+wuffs_base__table_u8 v_tab = {0};
+uint64_t v_i = 0;
+uint64_t v_j = 0;
+uint32_t v_replicate_y0 = 0;
+uint32_t v_replicate_y1 = 0;
+wuffs_base__slice_u8 v_replicate_dst = {0};
+wuffs_base__slice_u8 v_replicate_src = {0};
+
+v_pixfmt = wuffs_base__pixel_buffer__pixel_format(a_pb);
+v_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(&v_pixfmt);
+if ((v_bits_per_pixel & 7) != 0) {
+return wuffs_base__make_status(wuffs_base__error__unsupported_option);}
+v_bytes_per_pixel = (v_bits_per_pixel >> 3);
+v_width_in_bytes = (((uint64_t)(self->private_impl.f_width)) * ((uint64_t)(v_bytes_per_pixel)));
+v_tab = wuffs_base__pixel_buffer__plane(a_pb,0);
+label__0__continue:;
+while (v_src_ri < ((uint64_t)(a_src.len))) {
+v_src = wuffs_base__slice_u8__subslice_i(a_src,v_src_ri);
+if (self->private_impl.f_dst_y >= self->private_impl.f_frame_rect_y1) {
+if (WUFFS_GIF__QUIRK_ENABLED(self, 3)) {
+return wuffs_base__make_status(NULL);}
+return wuffs_base__make_status(wuffs_base__error__too_much_data);}
+v_dst = wuffs_base__table_u8__row(v_tab,(self->private_impl.f_dst_y - self->private_impl.f_band_y0));
+if (self->private_impl.f_dst_y >= self->private_impl.f_height) {
+v_dst = wuffs_base__slice_u8__subslice_j(v_dst,0);
+} else if (v_width_in_bytes < ((uint64_t)(v_dst.len))) {
+v_dst = wuffs_base__slice_u8__subslice_j(v_dst,v_width_in_bytes);
+}
+v_i = (((uint64_t)(self->private_impl.f_dst_x)) * ((uint64_t)(v_bytes_per_pixel)));
+if (v_i < ((uint64_t)(v_dst.len))) {
+v_j = (((uint64_t)(self->private_impl.f_frame_rect_x1)) * ((uint64_t)(v_bytes_per_pixel)));
+if ((v_i <= v_j) && (v_j <= ((uint64_t)(v_dst.len)))) {
+v_dst = wuffs_base__slice_u8__subslice_ij(v_dst,v_i,v_j);
+} else {
+v_dst = wuffs_base__slice_u8__subslice_i(v_dst,v_i);
+}
+v_n = wuffs_base__pixel_swizzler__swizzle_interleaved(&self->private_impl.f_swizzler,v_dst,wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024),v_src);
+wuffs_base__u64__sat_add_indirect(&v_src_ri,v_n);
+wuffs_base__u32__sat_add_indirect(&self->private_impl.f_dst_x,((uint32_t)((v_n & 4294967295))));
+self->private_impl.f_dirty_max_excl_y = wuffs_base__u32__max(self->private_impl.f_dirty_max_excl_y,wuffs_base__u32__sat_add(self->private_impl.f_dst_y,1));
+}
+if (self->private_impl.f_frame_rect_x1 <= self->private_impl.f_dst_x) {
+self->private_impl.f_dst_x = self->private_impl.f_frame_rect_x0;
+if (self->private_impl.f_interlace == 0) {
+wuffs_base__u32__sat_add_indirect(&self->private_impl.f_dst_y,1);
+goto label__0__continue;
+}
+if ((self->private_impl.f_num_decoded_frames_value == 0) &&  ! self->private_impl.f_gc_has_transparent_index && (self->private_impl.f_interlace > 1)) {
+v_replicate_src = wuffs_base__table_u8__row(v_tab,self->private_impl.f_dst_y);
+v_replicate_y0 = wuffs_base__u32__sat_add(self->private_impl.f_dst_y,1);
+v_replicate_y1 = wuffs_base__u32__sat_add(self->private_impl.f_dst_y,((uint32_t)(WUFFS_GIF__INTERLACE_COUNT[self->private_impl.f_interlace])));
+v_replicate_y1 = wuffs_base__u32__min(v_replicate_y1,self->private_impl.f_frame_rect_y1);
+while (v_replicate_y0 < v_replicate_y1) {
+v_replicate_dst = wuffs_base__table_u8__row(v_tab,v_replicate_y0);
+wuffs_base__slice_u8__copy_from_slice(v_replicate_dst,v_replicate_src);
+v_replicate_y0 += 1;
+}
+self->private_impl.f_dirty_max_excl_y = wuffs_base__u32__max(self->private_impl.f_dirty_max_excl_y,v_replicate_y1);
+}
+wuffs_base__u32__sat_add_indirect(&self->private_impl.f_dst_y,((uint32_t)(WUFFS_GIF__INTERLACE_DELTA[self->private_impl.f_interlace])));
+while ((self->private_impl.f_interlace > 0) && (self->private_impl.f_dst_y >= self->private_impl.f_frame_rect_y1)) {
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+self->private_impl.f_interlace -= 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+self->private_impl.f_dst_y = wuffs_base__u32__sat_add(self->private_impl.f_frame_rect_y0,WUFFS_GIF__INTERLACE_START[self->private_impl.f_interlace]);
+}
+goto label__0__continue;
+}
+if (((uint64_t)(a_src.len)) == v_src_ri) {
+goto label__0__break;
+} else if (((uint64_t)(a_src.len)) < v_src_ri) {
+return wuffs_base__make_status(wuffs_gif__error__internal_error_inconsistent_ri_wi);}
+v_n = ((uint64_t)((self->private_impl.f_frame_rect_x1 - self->private_impl.f_dst_x)));
+v_n = wuffs_base__u64__min(v_n,(((uint64_t)(a_src.len)) - v_src_ri));
+wuffs_base__u64__sat_add_indirect(&v_src_ri,v_n);
+wuffs_base__u32__sat_add_indirect(&self->private_impl.f_dst_x,((uint32_t)((v_n & 4294967295))));
+if (self->private_impl.f_frame_rect_x1 <= self->private_impl.f_dst_x) {
+self->private_impl.f_dst_x = self->private_impl.f_frame_rect_x0;
+wuffs_base__u32__sat_add_indirect(&self->private_impl.f_dst_y,((uint32_t)(WUFFS_GIF__INTERLACE_DELTA[self->private_impl.f_interlace])));
+while ((self->private_impl.f_interlace > 0) && (self->private_impl.f_dst_y >= self->private_impl.f_frame_rect_y1)) {
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+self->private_impl.f_interlace -= 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+self->private_impl.f_dst_y = wuffs_base__u32__sat_add(self->private_impl.f_frame_rect_y0,WUFFS_GIF__INTERLACE_START[self->private_impl.f_interlace]);
+}
+goto label__0__continue;
+}
+if (v_src_ri != ((uint64_t)(a_src.len))) {
+return wuffs_base__make_status(wuffs_gif__error__internal_error_inconsistent_ri_wi);}
+goto label__0__break;
+}
+label__0__break:;
+return wuffs_base__make_status(NULL);}
+
+// -------- func gif.decoder.copy_to_image_buffer_sparse
+
+static wuffs_base__status//
+wuffs_gif__decoder__copy_to_image_buffer_sparse(wuffs_gif__decoder *self,wuffs_base__pixel_buffer* a_pb,wuffs_base__slice_u8 a_src){
+WUFFS_BASE__STATS__CALL(self, 20);
+
+wuffs_base__slice_u8 v_dst = {0};
+wuffs_base__slice_u8 v_src = {0};
+uint64_t v_n = 0;
+uint64_t v_src_ri = 0;
+wuffs_base__pixel_format v_pixfmt = {0};
+uint32_t v_bytes_per_pixel = 0;
+uint32_t v_bits_per_pixel = 0;
+uint32_t v_mask = 0;
+wuffs_base__table_u8 v_tab = {0};
+uint64_t v_i = 0;
+uint32_t v_x = 0;
+bool v_keep_row = false;
+
+v_pixfmt = wuffs_base__pixel_buffer__pixel_format(a_pb);
+v_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(&v_pixfmt);
+if ((v_bits_per_pixel & 7) != 0) {
+return wuffs_base__make_status(wuffs_base__error__unsupported_option);}
+v_bytes_per_pixel = (v_bits_per_pixel >> 3);
+v_mask = ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1);
+v_tab = wuffs_base__pixel_buffer__plane(a_pb,0);
+while (v_src_ri < ((uint64_t)(a_src.len))) {
+v_src = wuffs_base__slice_u8__subslice_i(a_src,v_src_ri);
+if (self->private_impl.f_dst_y >= self->private_impl.f_frame_rect_y1) {
+if (WUFFS_GIF__QUIRK_ENABLED(self, 3)) {
+return wuffs_base__make_status(NULL);}
+return wuffs_base__make_status(wuffs_base__error__too_much_data);}
+v_keep_row = ((self->private_impl.f_crop_y0 <= self->private_impl.f_dst_y) && (self->private_impl.f_dst_y < self->private_impl.f_crop_y1) && (((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) & v_mask) == 0));
+if (v_keep_row && (self->private_impl.f_crop_x0 <= self->private_impl.f_dst_x) && (self->private_impl.f_dst_x < self->private_impl.f_crop_x1) && (((self->private_impl.f_dst_x - self->private_impl.f_crop_x0) & v_mask) == 0)) {
+v_n = 1;
+v_dst = wuffs_base__table_u8__row(v_tab,(((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) >> self->private_impl.f_scale_shift) - self->private_impl.f_band_y0));
+v_i = (((uint64_t)(((self->private_impl.f_dst_x - self->private_impl.f_crop_x0) >> self->private_impl.f_scale_shift))) * ((uint64_t)(v_bytes_per_pixel)));
+if (v_i < ((uint64_t)(v_dst.len))) {
+v_dst = wuffs_base__slice_u8__subslice_i(v_dst,v_i);
+if (v_mask == 0) {
+v_n = ((uint64_t)((wuffs_base__u32__min(self->private_impl.f_crop_x1,self->private_impl.f_frame_rect_x1) - self->private_impl.f_dst_x)));
+}
+v_i = ((v_n & 4294967295) * ((uint64_t)(v_bytes_per_pixel)));
+if (v_i < ((uint64_t)(v_dst.len))) {
+v_dst = wuffs_base__slice_u8__subslice_j(v_dst,v_i);
+}
+v_n = wuffs_base__pixel_swizzler__swizzle_interleaved(&self->private_impl.f_swizzler,v_dst,wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024),v_src);
+v_n = wuffs_base__u64__max(v_n,1);
+self->private_impl.f_dirty_max_excl_y = wuffs_base__u32__max(self->private_impl.f_dirty_max_excl_y,wuffs_base__u32__sat_add(self->private_impl.f_dst_y,1));
+}
+} else {
+v_x = self->private_impl.f_frame_rect_x1;
+if (v_keep_row && (self->private_impl.f_dst_x < self->private_impl.f_crop_x1)) {
+if (self->private_impl.f_dst_x < self->private_impl.f_crop_x0) {
+v_x = wuffs_base__u32__min(v_x,self->private_impl.f_crop_x0);
+} else {
+v_x = wuffs_base__u32__min(v_x,wuffs_base__u32__sat_add(self->private_impl.f_crop_x0,wuffs_base__u32__sat_add(((self->private_impl.f_dst_x - self->private_impl.f_crop_x0) | v_mask),1)));
+}
+}
+v_n = ((uint64_t)((v_x - self->private_impl.f_dst_x)));
+v_n = wuffs_base__u64__min(v_n,((uint64_t)(v_src.len)));
+}
+wuffs_base__u64__sat_add_indirect(&v_src_ri,v_n);
+wuffs_base__u32__sat_add_indirect(&self->private_impl.f_dst_x,((uint32_t)((v_n & 4294967295))));
+if (self->private_impl.f_frame_rect_x1 <= self->private_impl.f_dst_x) {
+self->private_impl.f_dst_x = self->private_impl.f_frame_rect_x0;
+wuffs_base__u32__sat_add_indirect(&self->private_impl.f_dst_y,((uint32_t)(WUFFS_GIF__INTERLACE_DELTA[self->private_impl.f_interlace])));
+while ((self->private_impl.f_interlace > 0) && (self->private_impl.f_dst_y >= self->private_impl.f_frame_rect_y1)) {
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+self->private_impl.f_interlace -= 1;
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+self->private_impl.f_dst_y = wuffs_base__u32__sat_add(self->private_impl.f_frame_rect_y0,WUFFS_GIF__INTERLACE_START[self->private_impl.f_interlace]);
+}
+}
+}
+return wuffs_base__make_status(NULL);}
+
+// -------- func gif.decoder.band_is_done
+
+static bool//
+wuffs_gif__decoder__band_is_done(const wuffs_gif__decoder *self){
+
+uint32_t v_mask = 0;
+
+if ((self->private_impl.f_band_height == 0) || (self->private_impl.f_frame_rect_y1 <= self->private_impl.f_dst_y) || (self->private_impl.f_dst_y < self->private_impl.f_crop_y0) || (self->private_impl.f_crop_y1 <= self->private_impl.f_dst_y)) {
+return false;}
+v_mask = ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1);
+if (((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) & v_mask) != 0) {
+return false;}
+return (((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) >> self->private_impl.f_scale_shift) >= self->private_impl.f_band_y1);}
+
+// -------- func gif.decoder.next_band
+
+static wuffs_base__empty_struct //
+wuffs_gif__decoder__next_band(wuffs_gif__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 21);
+
+
+self->private_impl.f_band_y0 = self->private_impl.f_band_y1;
+self->private_impl.f_band_y1 = wuffs_base__u32__min(self->private_impl.f_dst_rect_y1,wuffs_base__u32__sat_add(self->private_impl.f_band_y0,self->private_impl.f_band_height));
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func gif.decoder.dst_coord
+
+static uint32_t//
+wuffs_gif__decoder__dst_coord(const wuffs_gif__decoder *self,uint32_t a_v,uint32_t a_c0,uint32_t a_c1){
+
+
+return (wuffs_base__u32__sat_add((wuffs_base__u32__max(wuffs_base__u32__min(a_v,a_c1),a_c0) - a_c0),((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1)) >> self->private_impl.f_scale_shift);}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__GIF)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__GIF
+
@@ -0,0 +1,1983 @@
+#ifndef WUFFS_INCLUDE_GUARD__JSON
+#define WUFFS_INCLUDE_GUARD__JSON
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__JSON
+#endif
+
+#include "./wuffs-base.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+extern const char* wuffs_json__error__bad_c0_control_code;
+extern const char* wuffs_json__error__bad_utf_8;
+extern const char* wuffs_json__error__bad_backslash_escape;
+extern const char* wuffs_json__error__bad_input;
+extern const char* wuffs_json__error__unsupported_number_length;
+extern const char* wuffs_json__error__unsupported_recursion_depth;
+
+// ---------------- Public Consts
+
+#define WUFFS_JSON__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 0
+
+#define WUFFS_JSON__DECODER_DEPTH_MAX_INCL 1024
+
+#define WUFFS_JSON__DECODER_DST_TOKEN_BUFFER_LENGTH_MIN_INCL 1
+
+#define WUFFS_JSON__DECODER_SRC_IO_BUFFER_LENGTH_MIN_INCL 100
+
+#define WUFFS_JSON__QUIRK_ALLOW_ASCII_CONTROL_CODES 1225364480
+
+#define WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_A 1225364481
+
+#define WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_CAPITAL_U 1225364482
+
+#define WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_E 1225364483
+
+#define WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_NEW_LINE 1225364484
+
+#define WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_QUESTION_MARK 1225364485
+
+#define WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_SINGLE_QUOTE 1225364486
+
+#define WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_V 1225364487
+
+#define WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_X 1225364488
+
+#define WUFFS_JSON__QUIRK_ALLOW_BACKSLASH_ZERO 1225364489
+
+#define WUFFS_JSON__QUIRK_ALLOW_COMMENT_BLOCK 1225364490
+
+#define WUFFS_JSON__QUIRK_ALLOW_COMMENT_LINE 1225364491
+
+#define WUFFS_JSON__QUIRK_ALLOW_EXTRA_COMMA 1225364492
+
+#define WUFFS_JSON__QUIRK_ALLOW_INF_NAN_NUMBERS 1225364493
+
+#define WUFFS_JSON__QUIRK_ALLOW_LEADING_ASCII_RECORD_SEPARATOR 1225364494
+
+#define WUFFS_JSON__QUIRK_ALLOW_LEADING_UNICODE_BYTE_ORDER_MARK 1225364495
+
+#define WUFFS_JSON__QUIRK_ALLOW_TRAILING_NEW_LINE 1225364496
+
+#define WUFFS_JSON__QUIRK_REPLACE_INVALID_UNICODE 1225364497
+
+#define WUFFS_JSON__QUIRK_ALLOW_JSON_LINES 1225364498
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_json__decoder__struct wuffs_json__decoder;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_json__decoder__initialize(wuffs_json__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_json__decoder();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_json__decoder*  //
+wuffs_json__decoder__alloc();
+
+static inline wuffs_base__token_decoder*  //
+wuffs_json__decoder__alloc_as__wuffs_base__token_decoder(){
+return (wuffs_base__token_decoder*)(wuffs_json__decoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__token_decoder*  //
+wuffs_json__decoder__upcast_as__wuffs_base__token_decoder(wuffs_json__decoder* p){
+return (wuffs_base__token_decoder*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_JSON__DECODER__STATS__FUNC__SET_QUIRK_ENABLED 0
+#define WUFFS_JSON__DECODER__STATS__FUNC__SKIP_REMAINDER_OF_CONTAINERS 1
+#define WUFFS_JSON__DECODER__STATS__FUNC__DECODE_TOKENS 2
+#define WUFFS_JSON__DECODER__STATS__FUNC__DECODE_NUMBER 3
+#define WUFFS_JSON__DECODER__STATS__FUNC__DECODE_DIGITS 4
+#define WUFFS_JSON__DECODER__STATS__FUNC__DECODE_LEADING 5
+#define WUFFS_JSON__DECODER__STATS__FUNC__DECODE_COMMENT 6
+#define WUFFS_JSON__DECODER__STATS__FUNC__DECODE_INF_NAN 7
+#define WUFFS_JSON__DECODER__STATS__FUNC__DECODE_TRAILING_NEW_LINE 8
+
+typedef struct wuffs_json__decoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[9];
+} wuffs_json__decoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_json__decoder__stats  //
+wuffs_json__decoder__get_stats(const wuffs_json__decoder* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_json__decoder__set_quirk_enabled(wuffs_json__decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_json__decoder__skip_remainder_of_containers(wuffs_json__decoder *self,uint32_t a_n);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_json__decoder__workbuf_len(const wuffs_json__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_json__decoder__decode_tokens(wuffs_json__decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_json__decoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__token_decoder;
+wuffs_base__vtable null_vtable;
+
+bool f_quirks[19];
+bool f_allow_leading_ars;
+bool f_allow_leading_ubom;
+bool f_end_of_data;
+bool f_cpu_arch_checked;
+bool f_have_x86_sse42;
+uint32_t f_skip_count;
+
+uint32_t p_decode_tokens[1];
+uint32_t p_decode_leading[1];
+uint32_t p_decode_comment[1];
+uint32_t p_decode_inf_nan[1];
+uint32_t p_decode_trailing_new_line[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_json__decoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+uint32_t f_stack[32];
+
+struct {
+uint32_t v_depth;
+uint32_t v_skip_length;
+uint32_t v_skip_level;
+uint32_t v_skip_state;
+uint32_t v_expect;
+uint32_t v_expect_after_value;
+} s_decode_tokens[1];
+struct {
+uint32_t v_neg;
+} s_decode_inf_nan[1];
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_json__decoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_json__decoder__alloc(), &free);
+}
+
+static inline wuffs_base__token_decoder::unique_ptr  //
+alloc_as__wuffs_base__token_decoder(){
+return wuffs_base__token_decoder::unique_ptr(wuffs_json__decoder__alloc_as__wuffs_base__token_decoder(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_json__decoder__struct() = delete;
+wuffs_json__decoder__struct(const wuffs_json__decoder__struct&) = delete;
+wuffs_json__decoder__struct& operator=(const wuffs_json__decoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_json__decoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__token_decoder*  //
+upcast_as__wuffs_base__token_decoder(){
+return (wuffs_base__token_decoder*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_json__decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__empty_struct //
+skip_remainder_of_containers(uint32_t a_n){ return wuffs_json__decoder__skip_remainder_of_containers(this,a_n);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_json__decoder__workbuf_len(this);}
+
+inline wuffs_base__status //
+decode_tokens(wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){ return wuffs_json__decoder__decode_tokens(this,a_dst,a_src,a_workbuf);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_json__decoder__stats  //
+get_stats() const {
+return wuffs_json__decoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_json__decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__JSON)
+
+// ---------------- Status Codes Implementations
+
+const char* wuffs_json__error__bad_c0_control_code = "#json: bad C0 control code";
+const char* wuffs_json__error__bad_utf_8 = "#json: bad UTF-8";
+const char* wuffs_json__error__bad_backslash_escape = "#json: bad backslash-escape";
+const char* wuffs_json__error__bad_input = "#json: bad input";
+const char* wuffs_json__error__unsupported_number_length = "#json: unsupported number length";
+const char* wuffs_json__error__unsupported_recursion_depth = "#json: unsupported recursion depth";
+const char* wuffs_json__error__internal_error_inconsistent_i_o = "#json: internal error: inconsistent I/O";
+
+// ---------------- Private Consts
+
+#define WUFFS_JSON__DECODER_NUMBER_LENGTH_MAX_INCL 99
+
+static const uint8_t //
+WUFFS_JSON__LUT_BACKSLASHES[256]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,162,0,0,0,0,5,0,0,0,0,0,0,0,175,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,0,0,0,1,136,0,0,2,140,0,0,0,0,0,0,0,138,0,0,0,141,0,137,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,};
+
+static const uint8_t //
+WUFFS_JSON__LUT_QUIRKY_BACKSLASHES_QUIRKS[8]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,1,3,4,5,6,7,9,};
+
+static const uint8_t //
+WUFFS_JSON__LUT_QUIRKY_BACKSLASHES_CHARS[8]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,7,27,10,63,39,11,0,};
+
+static const uint8_t //
+WUFFS_JSON__LUT_CHARS[256]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,32,32,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,32,32,32,32,32,32,32,32,32,32,32,};
+
+#define WUFFS_JSON__CLASS_WHITESPACE 0
+
+#define WUFFS_JSON__CLASS_STRING 1
+
+#define WUFFS_JSON__CLASS_COMMA 2
+
+#define WUFFS_JSON__CLASS_COLON 3
+
+#define WUFFS_JSON__CLASS_NUMBER 4
+
+#define WUFFS_JSON__CLASS_OPEN_CURLY_BRACE 5
+
+#define WUFFS_JSON__CLASS_CLOSE_CURLY_BRACE 6
+
+#define WUFFS_JSON__CLASS_OPEN_SQUARE_BRACKET 7
+
+#define WUFFS_JSON__CLASS_CLOSE_SQUARE_BRACKET 8
+
+#define WUFFS_JSON__CLASS_FALSE 9
+
+#define WUFFS_JSON__CLASS_TRUE 10
+
+#define WUFFS_JSON__CLASS_NULL_NAN_INF 11
+
+#define WUFFS_JSON__CLASS_COMMENT 12
+
+static const uint8_t //
+WUFFS_JSON__LUT_CLASSES[256]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {15,15,15,15,15,15,15,15,15,0,0,15,15,0,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,0,15,1,15,15,15,15,15,15,15,15,11,2,4,15,12,4,4,4,4,4,4,4,4,4,4,3,15,15,15,15,15,15,15,15,15,15,15,15,15,15,11,15,15,15,15,11,15,15,15,15,15,15,15,15,15,15,15,15,7,15,8,15,15,15,15,15,15,15,15,9,15,15,11,15,15,15,15,11,15,15,15,15,15,10,15,15,15,15,15,15,5,15,6,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,};
+
+static const uint8_t //
+WUFFS_JSON__LUT_DECIMAL_DIGITS[256]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,129,130,131,132,133,134,135,136,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,};
+
+static const uint8_t //
+WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[256]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,129,130,131,132,133,134,135,136,137,0,0,0,0,0,0,0,138,139,140,141,142,143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,139,140,141,142,143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,};
+
+#define WUFFS_JSON__QUIRKS_BASE 1225364480
+
+#define WUFFS_JSON__QUIRKS_COUNT 19
+
+// ---------------- Quirks
+
+#if defined(WUFFS_CONFIG__QUIRKS__ENABLE_ALLOWLIST)
+static const bool //
+WUFFS_JSON__QUIRKS_ALLOWED[19] //
+WUFFS_BASE__POTENTIALLY_UNUSED = {
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_ASCII_CONTROL_CODES)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_BACKSLASH_A)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_BACKSLASH_CAPITAL_U)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_BACKSLASH_E)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_BACKSLASH_NEW_LINE)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_BACKSLASH_QUESTION_MARK)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_BACKSLASH_SINGLE_QUOTE)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_BACKSLASH_V)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_BACKSLASH_X)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_BACKSLASH_ZERO)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_COMMENT_BLOCK)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_COMMENT_LINE)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_EXTRA_COMMA)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_INF_NAN_NUMBERS)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_LEADING_ASCII_RECORD_SEPARATOR)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_LEADING_UNICODE_BYTE_ORDER_MARK)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_TRAILING_NEW_LINE)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__REPLACE_INVALID_UNICODE)
+true,
+#else
+false,
+#endif
+#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_JSON_LINES)
+true,
+#else
+false,
+#endif
+};
+
+#define WUFFS_JSON__QUIRK_ENABLED(self, q) \
+  (WUFFS_JSON__QUIRKS_ALLOWED[q] && (self)->private_impl.f_quirks[q])
+#else
+#define WUFFS_JSON__QUIRK_ENABLED(self, q) ((self)->private_impl.f_quirks[q])
+#endif  // defined(WUFFS_CONFIG__QUIRKS__ENABLE_ALLOWLIST)
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static uint32_t//
+wuffs_json__decoder__decode_number(wuffs_json__decoder *self,wuffs_base__io_buffer* a_src);
+
+static uint32_t//
+wuffs_json__decoder__decode_digits(wuffs_json__decoder *self,wuffs_base__io_buffer* a_src,uint32_t a_n);
+
+static wuffs_base__status //
+wuffs_json__decoder__decode_leading(wuffs_json__decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_json__decoder__decode_comment(wuffs_json__decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_json__decoder__decode_inf_nan(wuffs_json__decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_json__decoder__decode_trailing_new_line(wuffs_json__decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+// ---------------- VTables
+
+const wuffs_base__token_decoder__func_ptrs wuffs_json__decoder__func_ptrs_for__wuffs_base__token_decoder = {(wuffs_base__status (*)(void*,wuffs_base__token_buffer*,wuffs_base__io_buffer*,wuffs_base__slice_u8))(&wuffs_json__decoder__decode_tokens),
+(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_json__decoder__set_quirk_enabled),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_json__decoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_json__decoder__initialize(wuffs_json__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__token_decoder.vtable_name = wuffs_base__token_decoder__vtable_name;
+self->private_impl.vtable_for__wuffs_base__token_decoder.function_pointers = (const void*)(&wuffs_json__decoder__func_ptrs_for__wuffs_base__token_decoder);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_json__decoder*  //
+wuffs_json__decoder__alloc(){
+wuffs_json__decoder* x = (wuffs_json__decoder*)(calloc(sizeof(wuffs_json__decoder), 1));
+if (!x) { return NULL; }
+if (wuffs_json__decoder__initialize(x, sizeof(wuffs_json__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_json__decoder(){ return sizeof(wuffs_json__decoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_json__decoder__stats  //
+wuffs_json__decoder__get_stats(const wuffs_json__decoder* self) {
+wuffs_json__decoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func json.decoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_json__decoder__set_quirk_enabled(wuffs_json__decoder *self,uint32_t a_quirk,bool a_enabled){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 0);
+
+
+if (a_quirk >= 1225364480) {
+a_quirk -= 1225364480;
+if (a_quirk < 19) {
+self->private_impl.f_quirks[a_quirk] = a_enabled;
+}
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func json.decoder.skip_remainder_of_containers
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_json__decoder__skip_remainder_of_containers(wuffs_json__decoder *self,uint32_t a_n){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 1);
+
+
+if (a_n < 1024) {
+self->private_impl.f_skip_count = a_n;
+} else {
+self->private_impl.f_skip_count = 1024;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func json.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_json__decoder__workbuf_len(const wuffs_json__decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__empty_range_ii_u64();}
+
+// -------- func json.decoder.decode_tokens
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_json__decoder__decode_tokens(wuffs_json__decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 2);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_vminor = 0;
+uint32_t v_number_length = 0;
+uint32_t v_number_status = 0;
+uint32_t v_string_length = 0;
+uint32_t v_whitespace_length = 0;
+uint32_t v_depth = 0;
+uint32_t v_stack_byte = 0;
+uint32_t v_stack_bit = 0;
+uint32_t v_match = 0;
+uint32_t v_c4 = 0;
+uint8_t v_c = 0;
+uint8_t v_backslash = 0;
+uint8_t v_char = 0;
+uint8_t v_class = 0;
+uint32_t v_multi_byte_utf8 = 0;
+uint32_t v_span = 0;
+uint32_t v_skip_length = 0;
+uint32_t v_skip_level = 0;
+uint32_t v_skip_state = 0;
+uint32_t v_backslash_x_length = 0;
+uint8_t v_backslash_x_ok = 0;
+uint32_t v_backslash_x_string = 0;
+uint8_t v_uni4_ok = 0;
+uint64_t v_uni4_string = 0;
+uint32_t v_uni4_value = 0;
+uint32_t v_uni4_high_surrogate = 0;
+uint8_t v_uni8_ok = 0;
+uint64_t v_uni8_string = 0;
+uint32_t v_uni8_value = 0;
+uint32_t v_expect = 0;
+uint32_t v_expect_after_value = 0;
+
+wuffs_base__token* iop_a_dst = NULL;wuffs_base__token* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;wuffs_base__token* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;wuffs_base__token* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_tokens[0];
+if (coro_susp_point) {
+v_depth = self->private_data.s_decode_tokens[0].v_depth;
+v_skip_length = self->private_data.s_decode_tokens[0].v_skip_length;
+v_skip_level = self->private_data.s_decode_tokens[0].v_skip_level;
+v_skip_state = self->private_data.s_decode_tokens[0].v_skip_state;
+v_expect = self->private_data.s_decode_tokens[0].v_expect;
+v_expect_after_value = self->private_data.s_decode_tokens[0].v_expect_after_value;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_end_of_data) {
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;}
+if ( ! self->private_impl.f_cpu_arch_checked) {
+self->private_impl.f_cpu_arch_checked = true;
+self->private_impl.f_have_x86_sse42 = wuffs_base__utility__cpu_arch_have_x86_sse42();
+}
+if (WUFFS_JSON__QUIRK_ENABLED(self, 14) || WUFFS_JSON__QUIRK_ENABLED(self, 15)) {
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_json__decoder__decode_leading(self,a_dst,a_src);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+}
+v_expect = 7858;
+label__outer__continue:;
+while (true) {
+while (true) {
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+goto label__outer__continue;
+}
+if (self->private_impl.f_skip_count > 0) {
+if ((v_depth == 0) || WUFFS_JSON__QUIRK_ENABLED(self, 10) || WUFFS_JSON__QUIRK_ENABLED(self, 11)) {
+self->private_impl.f_skip_count = 0;
+} else {
+v_skip_level = 0;
+v_skip_state = 0;
+label__skip__continue:;
+while (true) {
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(3);
+goto label__skip__continue;
+}
+v_skip_length = 0;
+while (true) {
+if (self->private_impl.f_have_x86_sse42 && (v_skip_state == 0)) {
+while ((((uint64_t)(io2_a_src - iop_a_src)) >= 16) && (v_skip_length <= 65518)) {
+v_span = wuffs_base__utility__json_skip_span_x86_sse42(wuffs_base__load_u64le__no_bounds_check(iop_a_src),wuffs_base__load_u64le__no_bounds_check(iop_a_src + 8));
+(iop_a_src += v_span, wuffs_base__make_empty_struct());
+v_skip_length += v_span;
+if (v_span < 16) {
+goto label__0__break;
+}
+}
+label__0__break:;
+}
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if (v_skip_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(v_skip_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_skip_length = 0;
+}
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(4);
+goto label__skip__continue;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+if (v_skip_state == 2) {
+v_skip_state = 1;
+} else if (v_skip_state == 1) {
+if (v_c == 34) {
+v_skip_state = 0;
+} else if (v_c == 92) {
+v_skip_state = 2;
+}
+} else if (v_c == 34) {
+v_skip_state = 1;
+} else if ((v_c == 91) || (v_c == 123)) {
+if ((v_skip_level >= 1024) || ((v_depth + v_skip_level) >= 1024)) {
+status = wuffs_base__make_status(wuffs_json__error__unsupported_recursion_depth);goto exit;}
+v_skip_level += 1;
+} else if ((v_c == 93) || (v_c == 125)) {
+if (v_skip_level <= 0) {
+goto label__skip_inner__break;
+}
+v_skip_level -= 1;
+}
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+if (v_skip_length >= 65534) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(65535)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__skip__continue;
+}
+v_skip_length += 1;
+}
+label__skip_inner__break:;
+if (v_skip_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(v_skip_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_skip_length = 0;
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+goto label__skip__continue;
+}
+}
+goto label__skip__break;
+}
+label__skip__break:;
+if (self->private_impl.f_skip_count > 0) {
+self->private_impl.f_skip_count -= 1;
+}
+v_expect = v_expect_after_value;
+}
+}
+v_whitespace_length = 0;
+v_c = 0;
+v_class = 0;
+while (true) {
+if (self->private_impl.f_have_x86_sse42 && (v_whitespace_length > 0)) {
+while ((((uint64_t)(io2_a_src - iop_a_src)) >= 16) && (v_whitespace_length <= 65518)) {
+v_span = wuffs_base__utility__json_whitespace_span_x86_sse42(wuffs_base__load_u64le__no_bounds_check(iop_a_src),wuffs_base__load_u64le__no_bounds_check(iop_a_src + 8));
+(iop_a_src += v_span, wuffs_base__make_empty_struct());
+v_whitespace_length += v_span;
+if (v_span < 16) {
+goto label__1__break;
+}
+}
+label__1__break:;
+}
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if (v_whitespace_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(v_whitespace_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_whitespace_length = 0;
+}
+if (a_src && a_src->meta.closed) {
+if ((v_depth == 0) && WUFFS_JSON__QUIRK_ENABLED(self, 18)) {
+self->private_impl.f_end_of_data = true;
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;}
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(5);
+v_whitespace_length = 0;
+goto label__outer__continue;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+v_class = WUFFS_JSON__LUT_CLASSES[v_c];
+if (v_class != 0) {
+goto label__ws__break;
+}
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+if (v_whitespace_length >= 65534) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(65535)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_whitespace_length = 0;
+goto label__outer__continue;
+}
+v_whitespace_length += 1;
+}
+label__ws__break:;
+if (v_whitespace_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(v_whitespace_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_whitespace_length = 0;
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+goto label__outer__continue;
+}
+}
+if (0 == (v_expect & (((uint32_t)(1)) << v_class))) {
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+if (v_class == 1) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194323)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+label__string_loop_outer__continue:;
+while (true) {
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(6);
+goto label__string_loop_outer__continue;
+}
+v_string_length = 0;
+label__string_loop_inner__continue:;
+while (true) {
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if (v_string_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194337)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(v_string_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_string_length = 0;
+}
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(7);
+v_string_length = 0;
+goto label__string_loop_outer__continue;
+}
+if (self->private_impl.f_have_x86_sse42 && (((uint64_t)(io2_a_src - iop_a_src)) >= 16) && (v_string_length <= 65511)) {
+v_span = wuffs_base__utility__json_string_span_x86_sse42(wuffs_base__load_u64le__no_bounds_check(iop_a_src),wuffs_base__load_u64le__no_bounds_check(iop_a_src + 8));
+(iop_a_src += v_span, wuffs_base__make_empty_struct());
+v_string_length += v_span;
+if (v_span >= 16) {
+goto label__string_loop_inner__continue;
+}
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+goto label__string_loop_inner__continue;
+}
+} else {
+while ((((uint64_t)(io2_a_src - iop_a_src)) > 4) && (v_string_length <= 65527)) {
+v_c4 = wuffs_base__load_u32le__no_bounds_check(iop_a_src);
+if (0 != (WUFFS_JSON__LUT_CHARS[(255 & (v_c4 >> 0))] | WUFFS_JSON__LUT_CHARS[(255 & (v_c4 >> 8))] | WUFFS_JSON__LUT_CHARS[(255 & (v_c4 >> 16))] | WUFFS_JSON__LUT_CHARS[(255 & (v_c4 >> 24))])) {
+goto label__2__break;
+}
+(iop_a_src += 4, wuffs_base__make_empty_struct());
+v_string_length += 4;
+}
+label__2__break:;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+v_char = WUFFS_JSON__LUT_CHARS[v_c];
+if (v_char == 0) {
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+if (v_string_length >= 65531) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194337)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(65532)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_string_length = 0;
+goto label__string_loop_outer__continue;
+}
+v_string_length += 1;
+goto label__string_loop_inner__continue;
+} else if (v_char == 1) {
+if (v_string_length != 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194337)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(v_string_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_string_length = 0;
+}
+goto label__string_loop_outer__break;
+} else if (v_char == 2) {
+if (v_string_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194337)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(v_string_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_string_length = 0;
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+goto label__string_loop_outer__continue;
+}
+}
+if (((uint64_t)(io2_a_src - iop_a_src)) < 2) {
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_backslash_escape);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(8);
+v_string_length = 0;
+v_char = 0;
+goto label__string_loop_outer__continue;
+}
+v_c = ((uint8_t)((wuffs_base__load_u16le__no_bounds_check(iop_a_src) >> 8)));
+v_backslash = WUFFS_JSON__LUT_BACKSLASHES[v_c];
+if ((v_backslash & 128) != 0) {
+(iop_a_src += 2, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)((6291456 | ((uint32_t)((v_backslash & 127)))))) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(2)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__string_loop_outer__continue;
+} else if (v_backslash != 0) {
+if (WUFFS_JSON__QUIRK_ENABLED(self, WUFFS_JSON__LUT_QUIRKY_BACKSLASHES_QUIRKS[(v_backslash & 7)])) {
+(iop_a_src += 2, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)((6291456 | ((uint32_t)(WUFFS_JSON__LUT_QUIRKY_BACKSLASHES_CHARS[(v_backslash & 7)]))))) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(2)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__string_loop_outer__continue;
+}
+} else if (v_c == 117) {
+if (((uint64_t)(io2_a_src - iop_a_src)) < 6) {
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_backslash_escape);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(9);
+v_string_length = 0;
+v_char = 0;
+goto label__string_loop_outer__continue;
+}
+v_uni4_string = (((uint64_t)(wuffs_base__load_u48le__no_bounds_check(iop_a_src))) >> 16);
+v_uni4_value = 0;
+v_uni4_ok = 128;
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni4_string >> 0))];
+v_uni4_ok &= v_c;
+v_uni4_value |= (((uint32_t)((v_c & 15))) << 12);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni4_string >> 8))];
+v_uni4_ok &= v_c;
+v_uni4_value |= (((uint32_t)((v_c & 15))) << 8);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni4_string >> 16))];
+v_uni4_ok &= v_c;
+v_uni4_value |= (((uint32_t)((v_c & 15))) << 4);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni4_string >> 24))];
+v_uni4_ok &= v_c;
+v_uni4_value |= (((uint32_t)((v_c & 15))) << 0);
+if (v_uni4_ok == 0) {
+} else if ((v_uni4_value < 55296) || (57343 < v_uni4_value)) {
+(iop_a_src += 6, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)((6291456 | v_uni4_value))) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(6)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__string_loop_outer__continue;
+} else if (v_uni4_value >= 56320) {
+} else {
+if (((uint64_t)(io2_a_src - iop_a_src)) < 12) {
+if (a_src && a_src->meta.closed) {
+if (WUFFS_JSON__QUIRK_ENABLED(self, 17)) {
+(iop_a_src += 6, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(6356989)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(6)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__string_loop_outer__continue;
+}
+status = wuffs_base__make_status(wuffs_json__error__bad_backslash_escape);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(10);
+v_string_length = 0;
+v_uni4_value = 0;
+v_char = 0;
+goto label__string_loop_outer__continue;
+}
+v_uni4_string = (wuffs_base__load_u64le__no_bounds_check(iop_a_src + 4) >> 16);
+if (((255 & (v_uni4_string >> 0)) != 92) || ((255 & (v_uni4_string >> 8)) != 117)) {
+v_uni4_high_surrogate = 0;
+v_uni4_value = 0;
+v_uni4_ok = 0;
+} else {
+v_uni4_high_surrogate = (65536 + ((v_uni4_value - 55296) << 10));
+v_uni4_value = 0;
+v_uni4_ok = 128;
+v_uni4_string >>= 16;
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni4_string >> 0))];
+v_uni4_ok &= v_c;
+v_uni4_value |= (((uint32_t)((v_c & 15))) << 12);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni4_string >> 8))];
+v_uni4_ok &= v_c;
+v_uni4_value |= (((uint32_t)((v_c & 15))) << 8);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni4_string >> 16))];
+v_uni4_ok &= v_c;
+v_uni4_value |= (((uint32_t)((v_c & 15))) << 4);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni4_string >> 24))];
+v_uni4_ok &= v_c;
+v_uni4_value |= (((uint32_t)((v_c & 15))) << 0);
+}
+if ((v_uni4_ok != 0) && (56320 <= v_uni4_value) && (v_uni4_value <= 57343)) {
+v_uni4_value -= 56320;
+(iop_a_src += 12, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)((6291456 | v_uni4_high_surrogate | v_uni4_value))) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(12)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__string_loop_outer__continue;
+}
+}
+if (WUFFS_JSON__QUIRK_ENABLED(self, 17)) {
+if (((uint64_t)(io2_a_src - iop_a_src)) < 6) {
+status = wuffs_base__make_status(wuffs_json__error__internal_error_inconsistent_i_o);goto exit;}
+(iop_a_src += 6, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(6356989)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(6)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__string_loop_outer__continue;
+}
+} else if ((v_c == 85) && WUFFS_JSON__QUIRK_ENABLED(self, 2)) {
+if (((uint64_t)(io2_a_src - iop_a_src)) < 10) {
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_backslash_escape);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(11);
+v_string_length = 0;
+v_char = 0;
+goto label__string_loop_outer__continue;
+}
+v_uni8_string = wuffs_base__load_u64le__no_bounds_check(iop_a_src + 2);
+v_uni8_value = 0;
+v_uni8_ok = 128;
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni8_string >> 0))];
+v_uni8_ok &= v_c;
+v_uni8_value |= (((uint32_t)((v_c & 15))) << 28);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni8_string >> 8))];
+v_uni8_ok &= v_c;
+v_uni8_value |= (((uint32_t)((v_c & 15))) << 24);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni8_string >> 16))];
+v_uni8_ok &= v_c;
+v_uni8_value |= (((uint32_t)((v_c & 15))) << 20);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni8_string >> 24))];
+v_uni8_ok &= v_c;
+v_uni8_value |= (((uint32_t)((v_c & 15))) << 16);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni8_string >> 32))];
+v_uni8_ok &= v_c;
+v_uni8_value |= (((uint32_t)((v_c & 15))) << 12);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni8_string >> 40))];
+v_uni8_ok &= v_c;
+v_uni8_value |= (((uint32_t)((v_c & 15))) << 8);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni8_string >> 48))];
+v_uni8_ok &= v_c;
+v_uni8_value |= (((uint32_t)((v_c & 15))) << 4);
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_uni8_string >> 56))];
+v_uni8_ok &= v_c;
+v_uni8_value |= (((uint32_t)((v_c & 15))) << 0);
+if (v_uni8_ok == 0) {
+} else if ((v_uni8_value < 55296) || ((57343 < v_uni8_value) && (v_uni8_value <= 1114111))) {
+(iop_a_src += 10, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)((6291456 | (v_uni8_value & 2097151)))) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(10)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__string_loop_outer__continue;
+} else if (WUFFS_JSON__QUIRK_ENABLED(self, 17)) {
+(iop_a_src += 10, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(6356989)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(10)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__string_loop_outer__continue;
+}
+} else if ((v_c == 120) && WUFFS_JSON__QUIRK_ENABLED(self, 8)) {
+if (((uint64_t)(io2_a_src - iop_a_src)) < 4) {
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_backslash_escape);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(12);
+v_string_length = 0;
+v_char = 0;
+goto label__string_loop_outer__continue;
+}
+v_backslash_x_length = 0;
+while ((v_backslash_x_length <= 65531) && (((uint64_t)(io2_a_src - iop_a_src)) >= 4)) {
+v_backslash_x_string = wuffs_base__load_u32le__no_bounds_check(iop_a_src);
+v_backslash_x_ok = 128;
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_backslash_x_string >> 16))];
+v_backslash_x_ok &= v_c;
+v_c = WUFFS_JSON__LUT_HEXADECIMAL_DIGITS[(255 & (v_backslash_x_string >> 24))];
+v_backslash_x_ok &= v_c;
+if ((v_backslash_x_ok == 0) || ((v_backslash_x_string & 65535) != 30812)) {
+goto label__3__break;
+}
+(iop_a_src += 4, wuffs_base__make_empty_struct());
+v_backslash_x_length += 4;
+}
+label__3__break:;
+if (v_backslash_x_length == 0) {
+status = wuffs_base__make_status(wuffs_json__error__bad_backslash_escape);goto exit;}
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194432)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(v_backslash_x_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__string_loop_outer__continue;
+}
+status = wuffs_base__make_status(wuffs_json__error__bad_backslash_escape);goto exit;} else if (v_char == 3) {
+if (((uint64_t)(io2_a_src - iop_a_src)) < 2) {
+if (v_string_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194337)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(v_string_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_string_length = 0;
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+goto label__string_loop_outer__continue;
+}
+}
+if (a_src && a_src->meta.closed) {
+if (WUFFS_JSON__QUIRK_ENABLED(self, 17)) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(6356989)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+goto label__string_loop_outer__continue;
+}
+status = wuffs_base__make_status(wuffs_json__error__bad_utf_8);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(13);
+v_string_length = 0;
+v_char = 0;
+goto label__string_loop_outer__continue;
+}
+v_multi_byte_utf8 = ((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src)));
+if ((v_multi_byte_utf8 & 49152) == 32768) {
+v_multi_byte_utf8 = ((1984 & (v_multi_byte_utf8 << 6)) | (63 & (v_multi_byte_utf8 >> 8)));
+(iop_a_src += 2, wuffs_base__make_empty_struct());
+if (v_string_length >= 65528) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194337)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)((v_string_length + 2))) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_string_length = 0;
+goto label__string_loop_outer__continue;
+}
+v_string_length += 2;
+goto label__string_loop_inner__continue;
+}
+} else if (v_char == 4) {
+if (((uint64_t)(io2_a_src - iop_a_src)) < 3) {
+if (v_string_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194337)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(v_string_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_string_length = 0;
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+goto label__string_loop_outer__continue;
+}
+}
+if (a_src && a_src->meta.closed) {
+if (WUFFS_JSON__QUIRK_ENABLED(self, 17)) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(6356989)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+goto label__string_loop_outer__continue;
+}
+status = wuffs_base__make_status(wuffs_json__error__bad_utf_8);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(14);
+v_string_length = 0;
+v_char = 0;
+goto label__string_loop_outer__continue;
+}
+v_multi_byte_utf8 = ((uint32_t)(wuffs_base__load_u24le__no_bounds_check(iop_a_src)));
+if ((v_multi_byte_utf8 & 12632064) == 8421376) {
+v_multi_byte_utf8 = ((61440 & (v_multi_byte_utf8 << 12)) | (4032 & (v_multi_byte_utf8 >> 2)) | (63 & (v_multi_byte_utf8 >> 16)));
+if ((2047 < v_multi_byte_utf8) && ((v_multi_byte_utf8 < 55296) || (57343 < v_multi_byte_utf8))) {
+(iop_a_src += 3, wuffs_base__make_empty_struct());
+if (v_string_length >= 65528) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194337)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)((v_string_length + 3))) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_string_length = 0;
+goto label__string_loop_outer__continue;
+}
+v_string_length += 3;
+goto label__string_loop_inner__continue;
+}
+}
+} else if (v_char == 5) {
+if (((uint64_t)(io2_a_src - iop_a_src)) < 4) {
+if (v_string_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194337)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(v_string_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_string_length = 0;
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+goto label__string_loop_outer__continue;
+}
+}
+if (a_src && a_src->meta.closed) {
+if (WUFFS_JSON__QUIRK_ENABLED(self, 17)) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(6356989)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+goto label__string_loop_outer__continue;
+}
+status = wuffs_base__make_status(wuffs_json__error__bad_utf_8);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(15);
+v_string_length = 0;
+v_char = 0;
+goto label__string_loop_outer__continue;
+}
+v_multi_byte_utf8 = wuffs_base__load_u32le__no_bounds_check(iop_a_src);
+if ((v_multi_byte_utf8 & 3233857536) == 2155905024) {
+v_multi_byte_utf8 = ((1835008 & (v_multi_byte_utf8 << 18)) | (258048 & (v_multi_byte_utf8 << 4)) | (4032 & (v_multi_byte_utf8 >> 10)) | (63 & (v_multi_byte_utf8 >> 24)));
+if ((65535 < v_multi_byte_utf8) && (v_multi_byte_utf8 <= 1114111)) {
+(iop_a_src += 4, wuffs_base__make_empty_struct());
+if (v_string_length >= 65528) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194337)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)((v_string_length + 4))) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_string_length = 0;
+goto label__string_loop_outer__continue;
+}
+v_string_length += 4;
+goto label__string_loop_inner__continue;
+}
+}
+}
+if (v_string_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194337)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(v_string_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_string_length = 0;
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+goto label__string_loop_outer__continue;
+}
+}
+if ((v_char & 128) != 0) {
+if (WUFFS_JSON__QUIRK_ENABLED(self, 0)) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)((6291456 | ((uint32_t)((v_char & 127)))))) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+goto label__string_loop_outer__continue;
+}
+status = wuffs_base__make_status(wuffs_json__error__bad_c0_control_code);goto exit;}
+if (WUFFS_JSON__QUIRK_ENABLED(self, 17)) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(6356989)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+goto label__string_loop_outer__continue;
+}
+status = wuffs_base__make_status(wuffs_json__error__bad_utf_8);goto exit;}
+}
+label__string_loop_outer__break:;
+label__4__continue:;
+while (true) {
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(16);
+goto label__4__continue;
+}
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(17);
+goto label__4__continue;
+}
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(4194323)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__4__break;
+}
+label__4__break:;
+if (0 == (v_expect & (((uint32_t)(1)) << 4))) {
+v_expect = 4104;
+goto label__outer__continue;
+}
+goto label__goto_parsed_a_leaf_value__break;
+} else if (v_class == 2) {
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+if (0 == (v_expect & (((uint32_t)(1)) << 8))) {
+if (WUFFS_JSON__QUIRK_ENABLED(self, 12)) {
+v_expect = 4162;
+} else {
+v_expect = 4098;
+}
+} else {
+if (WUFFS_JSON__QUIRK_ENABLED(self, 12)) {
+v_expect = 8114;
+} else {
+v_expect = 7858;
+}
+}
+goto label__outer__continue;
+} else if (v_class == 3) {
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_expect = 7858;
+goto label__outer__continue;
+} else if (v_class == 4) {
+while (true) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+v_number_length = wuffs_json__decoder__decode_number(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+v_number_status = (v_number_length >> 8);
+v_vminor = 10486787;
+if ((v_number_length & 128) != 0) {
+v_vminor = 10486785;
+}
+v_number_length = (v_number_length & 127);
+if (v_number_status == 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(v_vminor)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(v_number_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__5__break;
+}
+while (v_number_length > 0) {
+v_number_length -= 1;
+if (iop_a_src > io1_a_src) {
+(iop_a_src--, wuffs_base__make_empty_struct());
+} else {
+status = wuffs_base__make_status(wuffs_json__error__internal_error_inconsistent_i_o);goto exit;}
+}
+if (v_number_status == 1) {
+if (WUFFS_JSON__QUIRK_ENABLED(self, 13)) {
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(18);
+status = wuffs_json__decoder__decode_inf_nan(self,a_dst,a_src);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+goto label__5__break;
+}
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;} else if (v_number_status == 2) {
+status = wuffs_base__make_status(wuffs_json__error__unsupported_number_length);goto exit;} else {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(19);
+while (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(20);
+}
+}
+}
+label__5__break:;
+goto label__goto_parsed_a_leaf_value__break;
+} else if (v_class == 5) {
+v_vminor = 2113553;
+if (v_depth == 0) {
+} else if (0 != (v_expect_after_value & (((uint32_t)(1)) << 6))) {
+v_vminor = 2113601;
+} else {
+v_vminor = 2113569;
+}
+if (v_depth >= 1024) {
+status = wuffs_base__make_status(wuffs_json__error__unsupported_recursion_depth);goto exit;}
+v_stack_byte = (v_depth / 32);
+v_stack_bit = (v_depth & 31);
+self->private_data.f_stack[v_stack_byte] |= (((uint32_t)(1)) << v_stack_bit);
+v_depth += 1;
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(v_vminor)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_expect = 4162;
+v_expect_after_value = 4164;
+goto label__outer__continue;
+} else if (v_class == 6) {
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+if (v_depth <= 1) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(2101314)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__outer__break;
+}
+v_depth -= 1;
+v_stack_byte = ((v_depth - 1) / 32);
+v_stack_bit = ((v_depth - 1) & 31);
+if (0 == (self->private_data.f_stack[v_stack_byte] & (((uint32_t)(1)) << v_stack_bit))) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(2105410)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_expect = 4356;
+v_expect_after_value = 4356;
+} else {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(2113602)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_expect = 4164;
+v_expect_after_value = 4164;
+}
+goto label__outer__continue;
+} else if (v_class == 7) {
+v_vminor = 2105361;
+if (v_depth == 0) {
+} else if (0 != (v_expect_after_value & (((uint32_t)(1)) << 6))) {
+v_vminor = 2105409;
+} else {
+v_vminor = 2105377;
+}
+if (v_depth >= 1024) {
+status = wuffs_base__make_status(wuffs_json__error__unsupported_recursion_depth);goto exit;}
+v_stack_byte = (v_depth / 32);
+v_stack_bit = (v_depth & 31);
+self->private_data.f_stack[v_stack_byte] &= (4294967295 ^ (((uint32_t)(1)) << v_stack_bit));
+v_depth += 1;
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(v_vminor)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_expect = 8114;
+v_expect_after_value = 4356;
+goto label__outer__continue;
+} else if (v_class == 8) {
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+if (v_depth <= 1) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(2101282)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__outer__break;
+}
+v_depth -= 1;
+v_stack_byte = ((v_depth - 1) / 32);
+v_stack_bit = ((v_depth - 1) & 31);
+if (0 == (self->private_data.f_stack[v_stack_byte] & (((uint32_t)(1)) << v_stack_bit))) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(2105378)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_expect = 4356;
+v_expect_after_value = 4356;
+} else {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(2113570)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_expect = 4164;
+v_expect_after_value = 4164;
+}
+goto label__outer__continue;
+} else if (v_class == 9) {
+v_match = wuffs_base__io_reader__match7(iop_a_src, io2_a_src, a_src,111546413966853);
+if (v_match == 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(8388612)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(5)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+if (((uint64_t)(io2_a_src - iop_a_src)) < 5) {
+status = wuffs_base__make_status(wuffs_json__error__internal_error_inconsistent_i_o);goto exit;}
+(iop_a_src += 5, wuffs_base__make_empty_struct());
+goto label__goto_parsed_a_leaf_value__break;
+} else if (v_match == 1) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(21);
+goto label__outer__continue;
+}
+} else if (v_class == 10) {
+v_match = wuffs_base__io_reader__match7(iop_a_src, io2_a_src, a_src,435762131972);
+if (v_match == 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(8388616)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(4)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+if (((uint64_t)(io2_a_src - iop_a_src)) < 4) {
+status = wuffs_base__make_status(wuffs_json__error__internal_error_inconsistent_i_o);goto exit;}
+(iop_a_src += 4, wuffs_base__make_empty_struct());
+goto label__goto_parsed_a_leaf_value__break;
+} else if (v_match == 1) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(22);
+goto label__outer__continue;
+}
+} else if (v_class == 11) {
+v_match = wuffs_base__io_reader__match7(iop_a_src, io2_a_src, a_src,465676103172);
+if (v_match == 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(8388610)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(4)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+if (((uint64_t)(io2_a_src - iop_a_src)) < 4) {
+status = wuffs_base__make_status(wuffs_json__error__internal_error_inconsistent_i_o);goto exit;}
+(iop_a_src += 4, wuffs_base__make_empty_struct());
+goto label__goto_parsed_a_leaf_value__break;
+} else if (v_match == 1) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(23);
+goto label__outer__continue;
+}
+if (WUFFS_JSON__QUIRK_ENABLED(self, 13)) {
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(24);
+status = wuffs_json__decoder__decode_inf_nan(self,a_dst,a_src);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+goto label__goto_parsed_a_leaf_value__break;
+}
+} else if (v_class == 12) {
+if (WUFFS_JSON__QUIRK_ENABLED(self, 10) || WUFFS_JSON__QUIRK_ENABLED(self, 11)) {
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(25);
+status = wuffs_json__decoder__decode_comment(self,a_dst,a_src);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+goto label__outer__continue;
+}
+}
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+label__goto_parsed_a_leaf_value__break:;
+if (v_depth == 0) {
+goto label__outer__break;
+}
+v_expect = v_expect_after_value;
+}
+label__outer__break:;
+if (WUFFS_JSON__QUIRK_ENABLED(self, 16) || WUFFS_JSON__QUIRK_ENABLED(self, 18)) {
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(26);
+status = wuffs_json__decoder__decode_trailing_new_line(self,a_dst,a_src);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+}
+self->private_impl.f_skip_count = 0;
+if ( ! WUFFS_JSON__QUIRK_ENABLED(self, 18)) {
+self->private_impl.f_end_of_data = true;
+}
+
+goto ok;ok:self->private_impl.p_decode_tokens[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_tokens[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+self->private_data.s_decode_tokens[0].v_depth = v_depth;
+self->private_data.s_decode_tokens[0].v_skip_length = v_skip_length;
+self->private_data.s_decode_tokens[0].v_skip_level = v_skip_level;
+self->private_data.s_decode_tokens[0].v_skip_state = v_skip_state;
+self->private_data.s_decode_tokens[0].v_expect = v_expect;
+self->private_data.s_decode_tokens[0].v_expect_after_value = v_expect_after_value;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 2, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func json.decoder.decode_number
+
+static uint32_t//
+wuffs_json__decoder__decode_number(wuffs_json__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 3);
+
+uint8_t v_c = 0;
+uint32_t v_n = 0;
+uint32_t v_floating_point = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+while (true) {
+v_n = 0;
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if ( ! (a_src && a_src->meta.closed)) {
+v_n |= 768;
+}
+goto label__goto_done__break;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+if (v_c != 45) {
+} else {
+v_n += 1;
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if ( ! (a_src && a_src->meta.closed)) {
+v_n |= 768;
+}
+v_n |= 256;
+goto label__goto_done__break;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+}
+if (v_c == 48) {
+v_n += 1;
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+} else {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+v_n = wuffs_json__decoder__decode_digits(self,a_src,v_n);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (v_n > 99) {
+goto label__goto_done__break;
+}
+}
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if ( ! (a_src && a_src->meta.closed)) {
+v_n |= 768;
+}
+goto label__goto_done__break;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+if (v_c != 46) {
+} else {
+if (v_n >= 99) {
+v_n |= 512;
+goto label__goto_done__break;
+}
+v_n += 1;
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+v_floating_point = 128;
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+v_n = wuffs_json__decoder__decode_digits(self,a_src,v_n);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (v_n > 99) {
+goto label__goto_done__break;
+}
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if ( ! (a_src && a_src->meta.closed)) {
+v_n |= 768;
+}
+goto label__goto_done__break;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+}
+if ((v_c != 69) && (v_c != 101)) {
+goto label__goto_done__break;
+}
+if (v_n >= 99) {
+v_n |= 512;
+goto label__goto_done__break;
+}
+v_n += 1;
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+v_floating_point = 128;
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if ( ! (a_src && a_src->meta.closed)) {
+v_n |= 768;
+}
+v_n |= 256;
+goto label__goto_done__break;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+if ((v_c != 43) && (v_c != 45)) {
+} else {
+if (v_n >= 99) {
+v_n |= 512;
+goto label__goto_done__break;
+}
+v_n += 1;
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+v_n = wuffs_json__decoder__decode_digits(self,a_src,v_n);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+goto label__goto_done__break;
+}
+label__goto_done__break:;
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+return (v_n | v_floating_point);}
+
+// -------- func json.decoder.decode_digits
+
+static uint32_t//
+wuffs_json__decoder__decode_digits(wuffs_json__decoder *self,wuffs_base__io_buffer* a_src,uint32_t a_n){
+WUFFS_BASE__STATS__CALL(self, 4);
+
+uint8_t v_c = 0;
+uint32_t v_n = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+v_n = a_n;
+while (true) {
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if ( ! (a_src && a_src->meta.closed)) {
+v_n |= 768;
+}
+goto label__0__break;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+if (0 == WUFFS_JSON__LUT_DECIMAL_DIGITS[v_c]) {
+goto label__0__break;
+}
+if (v_n >= 99) {
+v_n |= 512;
+goto label__0__break;
+}
+v_n += 1;
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+}
+label__0__break:;
+if (v_n == a_n) {
+v_n |= 256;
+}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+return v_n;}
+
+// -------- func json.decoder.decode_leading
+
+static wuffs_base__status //
+wuffs_json__decoder__decode_leading(wuffs_json__decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 5);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_c = 0;
+uint32_t v_u = 0;
+
+wuffs_base__token* iop_a_dst = NULL;wuffs_base__token* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;wuffs_base__token* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;wuffs_base__token* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_leading[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+self->private_impl.f_allow_leading_ars = WUFFS_JSON__QUIRK_ENABLED(self, 14);
+self->private_impl.f_allow_leading_ubom = WUFFS_JSON__QUIRK_ENABLED(self, 15);
+label__0__continue:;
+while (self->private_impl.f_allow_leading_ars || self->private_impl.f_allow_leading_ubom) {
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+goto label__0__continue;
+}
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if (a_src && a_src->meta.closed) {
+goto label__0__break;
+}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+goto label__0__continue;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+if ((v_c == 30) && self->private_impl.f_allow_leading_ars) {
+self->private_impl.f_allow_leading_ars = false;
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__0__continue;
+} else if ((v_c == 239) && self->private_impl.f_allow_leading_ubom) {
+if (((uint64_t)(io2_a_src - iop_a_src)) < 3) {
+if (a_src && a_src->meta.closed) {
+goto label__0__break;
+}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(3);
+goto label__0__continue;
+}
+v_u = ((uint32_t)(wuffs_base__load_u24le__no_bounds_check(iop_a_src)));
+if (v_u == 12565487) {
+self->private_impl.f_allow_leading_ubom = false;
+(iop_a_src += 3, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(3)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+goto label__0__continue;
+}
+}
+goto label__0__break;
+}
+label__0__break:;
+
+goto ok;ok:self->private_impl.p_decode_leading[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_leading[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 5, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func json.decoder.decode_comment
+
+static wuffs_base__status //
+wuffs_json__decoder__decode_comment(wuffs_json__decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 6);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_c = 0;
+uint16_t v_c2 = 0;
+uint32_t v_length = 0;
+
+wuffs_base__token* iop_a_dst = NULL;wuffs_base__token* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;wuffs_base__token* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;wuffs_base__token* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_comment[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+label__0__continue:;
+while ((((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) || (((uint64_t)(io2_a_src - iop_a_src)) <= 1)) {
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+goto label__0__continue;
+}
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+}
+v_c2 = wuffs_base__load_u16le__no_bounds_check(iop_a_src);
+if ((v_c2 == 10799) && WUFFS_JSON__QUIRK_ENABLED(self, 10)) {
+(iop_a_src += 2, wuffs_base__make_empty_struct());
+v_length = 2;
+label__comment_block__continue:;
+while (true) {
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(3);
+v_length = 0;
+goto label__comment_block__continue;
+}
+while (true) {
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 1) {
+if (v_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(2)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(v_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+}
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(4);
+v_length = 0;
+goto label__comment_block__continue;
+}
+v_c2 = wuffs_base__load_u16le__no_bounds_check(iop_a_src);
+if (v_c2 == 12074) {
+(iop_a_src += 2, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(2)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)((v_length + 2))) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+status = wuffs_base__make_status(NULL);goto ok;}
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+if (v_length >= 65533) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(2)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)((v_length + 1))) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_length = 0;
+goto label__comment_block__continue;
+}
+v_length += 1;
+}
+}
+} else if ((v_c2 == 12079) && WUFFS_JSON__QUIRK_ENABLED(self, 11)) {
+(iop_a_src += 2, wuffs_base__make_empty_struct());
+v_length = 2;
+label__comment_line__continue:;
+while (true) {
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(5);
+v_length = 0;
+goto label__comment_line__continue;
+}
+while (true) {
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if (v_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(1)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)(v_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+}
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(6);
+v_length = 0;
+goto label__comment_line__continue;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+if (v_c == 10) {
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(1)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)((v_length + 1))) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+status = wuffs_base__make_status(NULL);goto ok;}
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+if (v_length >= 65533) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(1)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) | (((uint64_t)((v_length + 1))) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_length = 0;
+goto label__comment_line__continue;
+}
+v_length += 1;
+}
+}
+}
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;
+goto ok;ok:self->private_impl.p_decode_comment[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_comment[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 6, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func json.decoder.decode_inf_nan
+
+static wuffs_base__status //
+wuffs_json__decoder__decode_inf_nan(wuffs_json__decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 7);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_c4 = 0;
+uint32_t v_neg = 0;
+
+wuffs_base__token* iop_a_dst = NULL;wuffs_base__token* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;wuffs_base__token* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;wuffs_base__token* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_inf_nan[0];
+if (coro_susp_point) {
+v_neg = self->private_data.s_decode_inf_nan[0].v_neg;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+label__0__continue:;
+while (true) {
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+goto label__0__continue;
+}
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 2) {
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+goto label__0__continue;
+}
+v_c4 = ((uint32_t)(wuffs_base__load_u24le__no_bounds_check(iop_a_src)));
+if ((v_c4 | 2105376) == 6712937) {
+if (((uint64_t)(io2_a_src - iop_a_src)) > 7) {
+if ((wuffs_base__load_u64le__no_bounds_check(iop_a_src) | 2314885530818453536) == 8751735898823356009) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(10485792)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(8)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 8, wuffs_base__make_empty_struct());
+status = wuffs_base__make_status(NULL);goto ok;}
+} else if ( ! (a_src && a_src->meta.closed)) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(3);
+goto label__0__continue;
+}
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(10485792)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(3)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 3, wuffs_base__make_empty_struct());
+status = wuffs_base__make_status(NULL);goto ok;} else if ((v_c4 | 2105376) == 7233902) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(10485888)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(3)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 3, wuffs_base__make_empty_struct());
+status = wuffs_base__make_status(NULL);goto ok;} else if ((v_c4 & 255) == 43) {
+v_neg = 0;
+} else if ((v_c4 & 255) == 45) {
+v_neg = 1;
+} else {
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 3) {
+if (a_src && a_src->meta.closed) {
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(4);
+goto label__0__continue;
+}
+v_c4 = (wuffs_base__load_u32le__no_bounds_check(iop_a_src) >> 8);
+if ((v_c4 | 2105376) == 6712937) {
+if (((uint64_t)(io2_a_src - iop_a_src)) > 8) {
+if ((wuffs_base__load_u64le__no_bounds_check(iop_a_src + 1) | 2314885530818453536) == 8751735898823356009) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)((10485760 | (((uint32_t)(32)) >> v_neg)))) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(9)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 9, wuffs_base__make_empty_struct());
+status = wuffs_base__make_status(NULL);goto ok;}
+} else if ( ! (a_src && a_src->meta.closed)) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(5);
+goto label__0__continue;
+}
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)((10485760 | (((uint32_t)(32)) >> v_neg)))) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(4)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 4, wuffs_base__make_empty_struct());
+status = wuffs_base__make_status(NULL);goto ok;} else if ((v_c4 | 2105376) == 7233902) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)((10485760 | (((uint32_t)(128)) >> v_neg)))) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(4)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+(iop_a_src += 4, wuffs_base__make_empty_struct());
+status = wuffs_base__make_status(NULL);goto ok;}
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+
+goto ok;ok:self->private_impl.p_decode_inf_nan[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_inf_nan[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_inf_nan[0].v_neg = v_neg;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 7, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func json.decoder.decode_trailing_new_line
+
+static wuffs_base__status //
+wuffs_json__decoder__decode_trailing_new_line(wuffs_json__decoder *self,wuffs_base__token_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 8);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_c = 0;
+uint32_t v_whitespace_length = 0;
+
+wuffs_base__token* iop_a_dst = NULL;wuffs_base__token* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;wuffs_base__token* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;wuffs_base__token* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_trailing_new_line[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+label__outer__continue:;
+while (true) {
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+v_whitespace_length = 0;
+goto label__outer__continue;
+}
+while (true) {
+if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+if (v_whitespace_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(v_whitespace_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_whitespace_length = 0;
+}
+if (a_src && a_src->meta.closed) {
+goto label__outer__break;
+}
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+v_whitespace_length = 0;
+goto label__outer__continue;
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+if (WUFFS_JSON__LUT_CLASSES[v_c] != 0) {
+if (v_whitespace_length > 0) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)(v_whitespace_length)) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_whitespace_length = 0;
+}
+status = wuffs_base__make_status(wuffs_json__error__bad_input);goto exit;}
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+if ((v_whitespace_length >= 65534) || (v_c == 10)) {
+*iop_a_dst++ = wuffs_base__make_token((((uint64_t)(0)) << WUFFS_BASE__TOKEN__VALUE_MINOR__SHIFT) | (((uint64_t)((v_whitespace_length + 1))) << WUFFS_BASE__TOKEN__LENGTH__SHIFT));
+v_whitespace_length = 0;
+if (v_c == 10) {
+goto label__outer__break;
+}
+goto label__outer__continue;
+}
+v_whitespace_length += 1;
+}
+}
+label__outer__break:;
+
+goto ok;ok:self->private_impl.p_decode_trailing_new_line[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_trailing_new_line[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 8, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__JSON)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__JSON
+
@@ -0,0 +1,1138 @@
+#ifndef WUFFS_INCLUDE_GUARD__LZ4
+#define WUFFS_INCLUDE_GUARD__LZ4
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__LZ4
+#endif
+
+#include "./wuffs-base.c"
+#include "./wuffs-std-xxhash32.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+extern const char* wuffs_lz4__error__bad_block;
+extern const char* wuffs_lz4__error__bad_checksum;
+extern const char* wuffs_lz4__error__bad_content_size;
+extern const char* wuffs_lz4__error__bad_header;
+extern const char* wuffs_lz4__error__bad_offset;
+extern const char* wuffs_lz4__error__unsupported_lz4_dictionary;
+
+// ---------------- Public Consts
+
+#define WUFFS_LZ4__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 0
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_lz4__decoder__struct wuffs_lz4__decoder;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_lz4__decoder__initialize(wuffs_lz4__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_lz4__decoder();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_lz4__decoder*  //
+wuffs_lz4__decoder__alloc();
+
+static inline wuffs_base__io_transformer*  //
+wuffs_lz4__decoder__alloc_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)(wuffs_lz4__decoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__io_transformer*  //
+wuffs_lz4__decoder__upcast_as__wuffs_base__io_transformer(wuffs_lz4__decoder* p){
+return (wuffs_base__io_transformer*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_LZ4__DECODER__STATS__FUNC__ADD_HISTORY 0
+#define WUFFS_LZ4__DECODER__STATS__FUNC__SET_IGNORE_CHECKSUM 1
+#define WUFFS_LZ4__DECODER__STATS__FUNC__SET_QUIRK_ENABLED 2
+#define WUFFS_LZ4__DECODER__STATS__FUNC__TRANSFORM_IO 3
+#define WUFFS_LZ4__DECODER__STATS__FUNC__DECODE_FRAME 4
+#define WUFFS_LZ4__DECODER__STATS__FUNC__DECODE_UNCOMPRESSED_BLOCK 5
+#define WUFFS_LZ4__DECODER__STATS__FUNC__DECODE_COMPRESSED_BLOCK 6
+#define WUFFS_LZ4__DECODER__STATS__FUNC__DECODE_SEQUENCES_FAST 7
+
+typedef struct wuffs_lz4__decoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[8];
+
+// The sub-structs' stats are filled in by the get_stats function.
+wuffs_xxhash32__hasher__stats block_checksum;
+wuffs_xxhash32__hasher__stats content_checksum;
+wuffs_xxhash32__hasher__stats header_checksum;
+} wuffs_lz4__decoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_lz4__decoder__stats  //
+wuffs_lz4__decoder__get_stats(const wuffs_lz4__decoder* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_lz4__decoder__add_history(wuffs_lz4__decoder *self,wuffs_base__slice_u8 a_hist);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_lz4__decoder__set_ignore_checksum(wuffs_lz4__decoder *self,bool a_ic);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_lz4__decoder__set_quirk_enabled(wuffs_lz4__decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_lz4__decoder__workbuf_len(const wuffs_lz4__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_lz4__decoder__transform_io(wuffs_lz4__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_lz4__decoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__io_transformer;
+wuffs_base__vtable null_vtable;
+
+uint32_t f_history_index;
+uint32_t f_block_remaining;
+uint32_t f_pending_offset;
+bool f_ignore_checksum;
+bool f_has_block_checksums;
+bool f_has_content_checksum;
+bool f_has_content_size;
+
+uint32_t p_transform_io[1];
+uint32_t p_decode_frame[1];
+uint32_t p_decode_uncompressed_block[1];
+uint32_t p_decode_compressed_block[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_lz4__decoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+wuffs_xxhash32__hasher f_block_checksum;
+wuffs_xxhash32__hasher f_content_checksum;
+wuffs_xxhash32__hasher f_header_checksum;
+uint8_t f_history[65536];
+uint8_t f_header[10];
+
+struct {
+uint8_t v_flags;
+uint32_t v_block_max_size;
+uint32_t v_header_len;
+uint32_t v_checksum_got;
+uint32_t v_block_len;
+bool v_uncompressed;
+uint64_t v_content_size_got;
+uint64_t v_content_size_want;
+uint32_t v_content_checksum_got;
+uint64_t scratch;
+} s_decode_frame[1];
+struct {
+uint32_t v_length;
+} s_decode_uncompressed_block[1];
+struct {
+uint32_t v_token;
+uint32_t v_lit_len;
+uint32_t v_match_len;
+uint32_t v_offset;
+uint32_t v_hlen;
+uint32_t v_hdist;
+uint64_t scratch;
+} s_decode_compressed_block[1];
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_lz4__decoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_lz4__decoder__alloc(), &free);
+}
+
+static inline wuffs_base__io_transformer::unique_ptr  //
+alloc_as__wuffs_base__io_transformer(){
+return wuffs_base__io_transformer::unique_ptr(wuffs_lz4__decoder__alloc_as__wuffs_base__io_transformer(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_lz4__decoder__struct() = delete;
+wuffs_lz4__decoder__struct(const wuffs_lz4__decoder__struct&) = delete;
+wuffs_lz4__decoder__struct& operator=(const wuffs_lz4__decoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_lz4__decoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__io_transformer*  //
+upcast_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)this;
+}
+
+inline wuffs_base__empty_struct //
+add_history(wuffs_base__slice_u8 a_hist){ return wuffs_lz4__decoder__add_history(this,a_hist);}
+
+inline wuffs_base__empty_struct //
+set_ignore_checksum(bool a_ic){ return wuffs_lz4__decoder__set_ignore_checksum(this,a_ic);}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_lz4__decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_lz4__decoder__workbuf_len(this);}
+
+inline wuffs_base__status //
+transform_io(wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){ return wuffs_lz4__decoder__transform_io(this,a_dst,a_src,a_workbuf);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_lz4__decoder__stats  //
+get_stats() const {
+return wuffs_lz4__decoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_lz4__decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__LZ4)
+
+// ---------------- Status Codes Implementations
+
+const char* wuffs_lz4__error__bad_block = "#lz4: bad block";
+const char* wuffs_lz4__error__bad_checksum = "#lz4: bad checksum";
+const char* wuffs_lz4__error__bad_content_size = "#lz4: bad content size";
+const char* wuffs_lz4__error__bad_header = "#lz4: bad header";
+const char* wuffs_lz4__error__bad_offset = "#lz4: bad offset";
+const char* wuffs_lz4__error__unsupported_lz4_dictionary = "#lz4: unsupported LZ4 dictionary";
+const char* wuffs_lz4__error__internal_error_inconsistent_i_o = "#lz4: internal error: inconsistent I/O";
+
+// ---------------- Private Consts
+
+static const uint32_t //
+WUFFS_LZ4__BLOCK_MAX_SIZES[8]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,0,0,0,65536,262144,1048576,4194304,};
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static wuffs_base__status //
+wuffs_lz4__decoder__decode_frame(wuffs_lz4__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_lz4__decoder__decode_uncompressed_block(wuffs_lz4__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,uint32_t a_n);
+
+static wuffs_base__status //
+wuffs_lz4__decoder__decode_compressed_block(wuffs_lz4__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,uint32_t a_n);
+
+static wuffs_base__status//
+wuffs_lz4__decoder__decode_sequences_fast(wuffs_lz4__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src);
+
+// ---------------- VTables
+
+const wuffs_base__io_transformer__func_ptrs wuffs_lz4__decoder__func_ptrs_for__wuffs_base__io_transformer = {(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_lz4__decoder__set_quirk_enabled),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__io_buffer*,wuffs_base__slice_u8))(&wuffs_lz4__decoder__transform_io),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_lz4__decoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_lz4__decoder__initialize(wuffs_lz4__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+{
+wuffs_base__status z = wuffs_xxhash32__hasher__initialize(&self->private_data.f_block_checksum, sizeof(self->private_data.f_block_checksum), WUFFS_VERSION, initialize_flags);
+if (z.repr) { return z; }
+}
+{
+wuffs_base__status z = wuffs_xxhash32__hasher__initialize(&self->private_data.f_content_checksum, sizeof(self->private_data.f_content_checksum), WUFFS_VERSION, initialize_flags);
+if (z.repr) { return z; }
+}
+{
+wuffs_base__status z = wuffs_xxhash32__hasher__initialize(&self->private_data.f_header_checksum, sizeof(self->private_data.f_header_checksum), WUFFS_VERSION, initialize_flags);
+if (z.repr) { return z; }
+}
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__io_transformer.vtable_name = wuffs_base__io_transformer__vtable_name;
+self->private_impl.vtable_for__wuffs_base__io_transformer.function_pointers = (const void*)(&wuffs_lz4__decoder__func_ptrs_for__wuffs_base__io_transformer);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_lz4__decoder*  //
+wuffs_lz4__decoder__alloc(){
+wuffs_lz4__decoder* x = (wuffs_lz4__decoder*)(calloc(sizeof(wuffs_lz4__decoder), 1));
+if (!x) { return NULL; }
+if (wuffs_lz4__decoder__initialize(x, sizeof(wuffs_lz4__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_lz4__decoder(){ return sizeof(wuffs_lz4__decoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_lz4__decoder__stats  //
+wuffs_lz4__decoder__get_stats(const wuffs_lz4__decoder* self) {
+wuffs_lz4__decoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+ret.block_checksum = wuffs_xxhash32__hasher__get_stats(&self->private_data.f_block_checksum);
+ret.content_checksum = wuffs_xxhash32__hasher__get_stats(&self->private_data.f_content_checksum);
+ret.header_checksum = wuffs_xxhash32__hasher__get_stats(&self->private_data.f_header_checksum);
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func lz4.decoder.add_history
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_lz4__decoder__add_history(wuffs_lz4__decoder *self,wuffs_base__slice_u8 a_hist){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 0);
+
+wuffs_base__slice_u8 v_s = {0};
+uint64_t v_n_copied = 0;
+uint32_t v_already_full = 0;
+
+v_s = a_hist;
+if (((uint64_t)(v_s.len)) >= 65536) {
+v_s = wuffs_base__slice_u8__suffix(v_s,65536);
+wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8(self->private_data.f_history, 65536),v_s);
+self->private_impl.f_history_index = 65536;
+} else {
+v_n_copied = wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_i(wuffs_base__make_slice_u8(self->private_data.f_history, 65536),(self->private_impl.f_history_index & 65535)),v_s);
+if (v_n_copied < ((uint64_t)(v_s.len))) {
+v_s = wuffs_base__slice_u8__subslice_i(v_s,v_n_copied);
+v_n_copied = wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8(self->private_data.f_history, 65536),v_s);
+self->private_impl.f_history_index = (((uint32_t)((v_n_copied & 65535))) + 65536);
+} else {
+v_already_full = 0;
+if (self->private_impl.f_history_index >= 65536) {
+v_already_full = 65536;
+}
+self->private_impl.f_history_index = ((self->private_impl.f_history_index & 65535) + ((uint32_t)((v_n_copied & 65535))) + v_already_full);
+}
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func lz4.decoder.set_ignore_checksum
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_lz4__decoder__set_ignore_checksum(wuffs_lz4__decoder *self,bool a_ic){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 1);
+
+
+self->private_impl.f_ignore_checksum = a_ic;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func lz4.decoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_lz4__decoder__set_quirk_enabled(wuffs_lz4__decoder *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func lz4.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_lz4__decoder__workbuf_len(const wuffs_lz4__decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__make_range_ii_u64(0,0);}
+
+// -------- func lz4.decoder.transform_io
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_lz4__decoder__transform_io(wuffs_lz4__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 3);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint64_t v_mark = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+
+uint32_t coro_susp_point = self->private_impl.p_transform_io[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (true) {
+v_mark = ((uint64_t)(iop_a_dst - io0_a_dst));
+{
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+wuffs_base__status t_0 = wuffs_lz4__decoder__decode_frame(self,a_dst,a_src);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+v_status = t_0;
+}
+if ( ! wuffs_base__status__is_suspension(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+wuffs_lz4__decoder__add_history(self,wuffs_base__io__since(v_mark, ((uint64_t)(iop_a_dst - io0_a_dst)), io0_a_dst));
+status = v_status;WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+}
+
+goto ok;ok:self->private_impl.p_transform_io[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_transform_io[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 3, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func lz4.decoder.decode_frame
+
+static wuffs_base__status //
+wuffs_lz4__decoder__decode_frame(wuffs_lz4__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 4);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_magic = 0;
+uint32_t v_n = 0;
+uint8_t v_flags = 0;
+uint8_t v_bd = 0;
+uint32_t v_block_max_size = 0;
+uint32_t v_header_len = 0;
+uint32_t v_i = 0;
+uint8_t v_c = 0;
+uint32_t v_checksum_got = 0;
+uint32_t v_checksum_want = 0;
+uint32_t v_block_size = 0;
+uint32_t v_block_len = 0;
+bool v_uncompressed = false;
+uint64_t v_dmark = 0;
+uint64_t v_smark = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+uint64_t v_content_size_got = 0;
+uint64_t v_content_size_want = 0;
+uint32_t v_content_checksum_got = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_frame[0];
+if (coro_susp_point) {
+v_flags = self->private_data.s_decode_frame[0].v_flags;
+v_block_max_size = self->private_data.s_decode_frame[0].v_block_max_size;
+v_header_len = self->private_data.s_decode_frame[0].v_header_len;
+v_checksum_got = self->private_data.s_decode_frame[0].v_checksum_got;
+v_block_len = self->private_data.s_decode_frame[0].v_block_len;
+v_uncompressed = self->private_data.s_decode_frame[0].v_uncompressed;
+v_content_size_got = self->private_data.s_decode_frame[0].v_content_size_got;
+v_content_size_want = self->private_data.s_decode_frame[0].v_content_size_want;
+v_content_checksum_got = self->private_data.s_decode_frame[0].v_content_checksum_got;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (true) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+uint32_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_0 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;if (num_bits_0 == 24) { t_0 = ((uint32_t)(*scratch));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0)) << 56;}}
+v_magic = t_0;
+}
+if (v_magic == 407708164) {
+goto label__0__break;
+} else if ((v_magic & 4294967280) != 407710288) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_header);goto exit;}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_1 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;if (num_bits_1 == 24) { t_1 = ((uint32_t)(*scratch));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1)) << 56;}}
+v_n = t_1;
+}
+self->private_data.s_decode_frame[0].scratch = v_n;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+if (self->private_data.s_decode_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_frame[0].scratch;
+}
+label__0__break:;
+wuffs_base__ignore_status(wuffs_xxhash32__hasher__initialize(&self->private_data.f_header_checksum, sizeof (wuffs_xxhash32__hasher), WUFFS_VERSION, 0));
+{
+uint8_t t_2;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_2 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_2 = *iop_a_src++;
+}
+v_flags = t_2;
+}
+if ((v_flags & 194) != 64) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_header);goto exit;}
+self->private_impl.f_has_block_checksums = ((v_flags & 16) != 0);
+self->private_impl.f_has_content_size = ((v_flags & 8) != 0);
+self->private_impl.f_has_content_checksum = ((v_flags & 4) != 0);
+if ((v_flags & 1) != 0) {
+status = wuffs_base__make_status(wuffs_lz4__error__unsupported_lz4_dictionary);goto exit;}
+{
+uint8_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+v_bd = t_3;
+}
+if ((v_bd & 143) != 0) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_header);goto exit;}
+v_block_max_size = WUFFS_LZ4__BLOCK_MAX_SIZES[((v_bd >> 4) & 7)];
+if (v_block_max_size == 0) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_header);goto exit;}
+self->private_data.f_header[0] = v_flags;
+self->private_data.f_header[1] = v_bd;
+v_header_len = 2;
+if (self->private_impl.f_has_content_size) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+uint64_t t_4;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 8)) {t_4 =wuffs_base__load_u64le__no_bounds_check(iop_a_src); iop_a_src += 8;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_4 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_4;if (num_bits_4 == 56) { t_4 = ((uint64_t)(*scratch));break;}num_bits_4 += 8;*scratch |= ((uint64_t)(num_bits_4)) << 56;}}
+v_content_size_want = t_4;
+}
+v_i = 0;
+while (v_i < 8) {
+self->private_data.f_header[(2 + v_i)] = ((uint8_t)(((v_content_size_want >> (8 * v_i)) & 255)));
+v_i += 1;
+}
+v_header_len = 10;
+}
+{
+uint8_t t_5;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_5 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(10);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_5 = *iop_a_src++;
+}
+v_c = t_5;
+}
+if ( ! self->private_impl.f_ignore_checksum) {
+v_checksum_got = wuffs_xxhash32__hasher__update_u32(&self->private_data.f_header_checksum,wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_data.f_header, 10),v_header_len));
+if (v_c != ((uint8_t)(((v_checksum_got >> 8) & 255)))) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_checksum);goto exit;}
+}
+wuffs_base__ignore_status(wuffs_xxhash32__hasher__initialize(&self->private_data.f_content_checksum, sizeof (wuffs_xxhash32__hasher), WUFFS_VERSION, 0));
+if (self->private_impl.f_has_content_checksum &&  ! self->private_impl.f_ignore_checksum) {
+v_content_checksum_got = wuffs_xxhash32__hasher__update_u32(&self->private_data.f_content_checksum,wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_data.f_header, 10),0));
+}
+while (true) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(11);
+uint32_t t_6;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_6 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(12);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_6 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_6;if (num_bits_6 == 24) { t_6 = ((uint32_t)(*scratch));break;}num_bits_6 += 8;*scratch |= ((uint64_t)(num_bits_6)) << 56;}}
+v_block_size = t_6;
+}
+if (v_block_size == 0) {
+goto label__1__break;
+}
+v_uncompressed = ((v_block_size >> 31) != 0);
+v_block_size &= 2147483647;
+if (v_block_size > v_block_max_size) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_block);goto exit;}
+v_block_len = v_block_size;
+wuffs_base__ignore_status(wuffs_xxhash32__hasher__initialize(&self->private_data.f_block_checksum, sizeof (wuffs_xxhash32__hasher), WUFFS_VERSION, 0));
+while (true) {
+v_dmark = ((uint64_t)(iop_a_dst - io0_a_dst));
+v_smark = ((uint64_t)(iop_a_src - io0_a_src));
+if (v_uncompressed) {
+{
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+wuffs_base__status t_7 = wuffs_lz4__decoder__decode_uncompressed_block(self,a_dst,a_src,v_block_len);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+v_status = t_7;
+}
+} else {
+{
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+wuffs_base__status t_8 = wuffs_lz4__decoder__decode_compressed_block(self,a_dst,a_src,v_block_len);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+v_status = t_8;
+}
+}
+if ( ! self->private_impl.f_ignore_checksum) {
+if (self->private_impl.f_has_block_checksums) {
+v_checksum_got = wuffs_xxhash32__hasher__update_u32(&self->private_data.f_block_checksum,wuffs_base__io_reader__since(v_smark, ((uint64_t)(iop_a_src - io0_a_src)), io0_a_src));
+}
+if (self->private_impl.f_has_content_checksum) {
+v_content_checksum_got = wuffs_xxhash32__hasher__update_u32(&self->private_data.f_content_checksum,wuffs_base__io__since(v_dmark, ((uint64_t)(iop_a_dst - io0_a_dst)), io0_a_dst));
+}
+}
+wuffs_base__u64__sat_add_indirect(&v_content_size_got,wuffs_base__io__count_since(v_dmark, ((uint64_t)(iop_a_dst - io0_a_dst))));
+if (wuffs_base__status__is_ok(&v_status)) {
+goto label__2__break;
+}
+status = v_status;WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(13);
+}
+label__2__break:;
+if (self->private_impl.f_has_block_checksums) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(14);
+uint32_t t_9;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_9 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(15);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_9 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_9;if (num_bits_9 == 24) { t_9 = ((uint32_t)(*scratch));break;}num_bits_9 += 8;*scratch |= ((uint64_t)(num_bits_9)) << 56;}}
+v_checksum_want = t_9;
+}
+if ( ! self->private_impl.f_ignore_checksum && (v_checksum_got != v_checksum_want)) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_checksum);goto exit;}
+}
+}
+label__1__break:;
+if (self->private_impl.f_has_content_size && (v_content_size_got != v_content_size_want)) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_content_size);goto exit;}
+if (self->private_impl.f_has_content_checksum) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(16);
+uint32_t t_10;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_10 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(17);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_10 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_10;if (num_bits_10 == 24) { t_10 = ((uint32_t)(*scratch));break;}num_bits_10 += 8;*scratch |= ((uint64_t)(num_bits_10)) << 56;}}
+v_checksum_want = t_10;
+}
+if ( ! self->private_impl.f_ignore_checksum && (v_content_checksum_got != v_checksum_want)) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_checksum);goto exit;}
+}
+
+goto ok;ok:self->private_impl.p_decode_frame[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_frame[0].v_flags = v_flags;
+self->private_data.s_decode_frame[0].v_block_max_size = v_block_max_size;
+self->private_data.s_decode_frame[0].v_header_len = v_header_len;
+self->private_data.s_decode_frame[0].v_checksum_got = v_checksum_got;
+self->private_data.s_decode_frame[0].v_block_len = v_block_len;
+self->private_data.s_decode_frame[0].v_uncompressed = v_uncompressed;
+self->private_data.s_decode_frame[0].v_content_size_got = v_content_size_got;
+self->private_data.s_decode_frame[0].v_content_size_want = v_content_size_want;
+self->private_data.s_decode_frame[0].v_content_checksum_got = v_content_checksum_got;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 4, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func lz4.decoder.decode_uncompressed_block
+
+static wuffs_base__status //
+wuffs_lz4__decoder__decode_uncompressed_block(wuffs_lz4__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,uint32_t a_n){
+WUFFS_BASE__STATS__CALL(self, 5);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_length = 0;
+uint32_t v_n_copied = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_uncompressed_block[0];
+if (coro_susp_point) {
+v_length = self->private_data.s_decode_uncompressed_block[0].v_length;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+v_length = a_n;
+while (true) {
+v_n_copied = wuffs_base__io_writer__copy_n32_from_reader(&iop_a_dst, io2_a_dst,v_length, &iop_a_src, io2_a_src);
+if (v_length <= v_n_copied) {
+status = wuffs_base__make_status(NULL);goto ok;}
+v_length -= v_n_copied;
+if (((uint64_t)(io2_a_src - iop_a_src)) == 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+} else {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+}
+}
+
+goto ok;ok:self->private_impl.p_decode_uncompressed_block[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_uncompressed_block[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_uncompressed_block[0].v_length = v_length;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 5, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func lz4.decoder.decode_compressed_block
+
+static wuffs_base__status //
+wuffs_lz4__decoder__decode_compressed_block(wuffs_lz4__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,uint32_t a_n){
+WUFFS_BASE__STATS__CALL(self, 6);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+uint32_t v_token = 0;
+uint32_t v_c = 0;
+uint32_t v_lit_len = 0;
+uint32_t v_match_len = 0;
+uint32_t v_offset = 0;
+uint32_t v_n_copied = 0;
+uint32_t v_hlen = 0;
+uint32_t v_hdist = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_compressed_block[0];
+if (coro_susp_point) {
+v_token = self->private_data.s_decode_compressed_block[0].v_token;
+v_lit_len = self->private_data.s_decode_compressed_block[0].v_lit_len;
+v_match_len = self->private_data.s_decode_compressed_block[0].v_match_len;
+v_offset = self->private_data.s_decode_compressed_block[0].v_offset;
+v_hlen = self->private_data.s_decode_compressed_block[0].v_hlen;
+v_hdist = self->private_data.s_decode_compressed_block[0].v_hdist;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+self->private_impl.f_block_remaining = a_n;
+self->private_impl.f_pending_offset = 0;
+label__loop__continue:;
+while (self->private_impl.f_block_remaining > 0) {
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+v_status = wuffs_lz4__decoder__decode_sequences_fast(self,a_dst,a_src);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (wuffs_base__status__is_error(&v_status)) {
+status = v_status;goto exit;}
+if (self->private_impl.f_pending_offset > 0) {
+v_offset = self->private_impl.f_pending_offset;
+self->private_impl.f_pending_offset = 0;
+v_match_len = 19;
+} else {
+if (self->private_impl.f_block_remaining == 0) {
+goto label__loop__break;
+}
+{
+uint32_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_token = t_0;
+}
+self->private_impl.f_block_remaining -= 1;
+v_lit_len = (v_token >> 4);
+if (v_lit_len == 15) {
+while (true) {
+if (self->private_impl.f_block_remaining == 0) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_block);goto exit;}
+{
+uint32_t t_1;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_1 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_1 = *iop_a_src++;
+}
+v_c = t_1;
+}
+self->private_impl.f_block_remaining -= 1;
+if (v_lit_len > self->private_impl.f_block_remaining) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_block);goto exit;}
+v_lit_len += v_c;
+if (v_c < 255) {
+goto label__0__break;
+}
+}
+label__0__break:;
+}
+if (self->private_impl.f_block_remaining < v_lit_len) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_block);goto exit;}
+self->private_impl.f_block_remaining -= v_lit_len;
+while (v_lit_len > 0) {
+v_n_copied = wuffs_base__io_writer__copy_n32_from_reader(&iop_a_dst, io2_a_dst,v_lit_len, &iop_a_src, io2_a_src);
+if (v_lit_len <= v_n_copied) {
+goto label__1__break;
+}
+v_lit_len -= v_n_copied;
+if (((uint64_t)(io2_a_dst - iop_a_dst)) == 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(3);
+} else {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(4);
+}
+}
+label__1__break:;
+if (self->private_impl.f_block_remaining == 0) {
+goto label__loop__break;
+} else if (self->private_impl.f_block_remaining < 2) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_block);goto exit;}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+uint32_t t_2;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_2 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_compressed_block[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_compressed_block[0].scratch;uint32_t num_bits_2 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_2;if (num_bits_2 == 8) { t_2 = ((uint32_t)(*scratch));break;}num_bits_2 += 8;*scratch |= ((uint64_t)(num_bits_2)) << 56;}}
+v_offset = t_2;
+}
+self->private_impl.f_block_remaining -= 2;
+if (v_offset == 0) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_offset);goto exit;}
+v_match_len = ((v_token & 15) + 4);
+}
+if (v_match_len == 19) {
+while (true) {
+if (self->private_impl.f_block_remaining == 0) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_block);goto exit;}
+{
+uint32_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+v_c = t_3;
+}
+self->private_impl.f_block_remaining -= 1;
+if (v_match_len > 4194304) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_block);goto exit;}
+v_match_len += v_c;
+if (v_c < 255) {
+goto label__2__break;
+}
+}
+label__2__break:;
+}
+while (true) {
+if (((uint64_t)(v_offset)) > ((uint64_t)(iop_a_dst - io0_a_dst))) {
+v_hdist = ((uint32_t)((((uint64_t)(v_offset)) - ((uint64_t)(iop_a_dst - io0_a_dst)))));
+if (v_match_len > v_hdist) {
+v_match_len -= v_hdist;
+v_hlen = v_hdist;
+} else {
+v_hlen = v_match_len;
+v_match_len = 0;
+}
+if (self->private_impl.f_history_index < v_hdist) {
+status = wuffs_base__make_status(wuffs_lz4__error__bad_offset);goto exit;}
+v_hdist = (self->private_impl.f_history_index - v_hdist);
+while (true) {
+v_n_copied = wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,v_hlen,wuffs_base__slice_u8__subslice_i(wuffs_base__make_slice_u8(self->private_data.f_history, 65536),(v_hdist & 65535)));
+if (v_hlen <= v_n_copied) {
+v_hlen = 0;
+goto label__3__break;
+}
+if (v_n_copied > 0) {
+v_hlen -= v_n_copied;
+v_hdist = ((v_hdist + v_n_copied) & 65535);
+if (v_hdist == 0) {
+goto label__3__break;
+}
+}
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(8);
+}
+label__3__break:;
+if (v_hlen > 0) {
+while (true) {
+v_n_copied = wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,v_hlen,wuffs_base__slice_u8__subslice_i(wuffs_base__make_slice_u8(self->private_data.f_history, 65536),(v_hdist & 65535)));
+if (v_hlen <= v_n_copied) {
+v_hlen = 0;
+goto label__4__break;
+}
+v_hlen -= v_n_copied;
+v_hdist += v_n_copied;
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(9);
+}
+label__4__break:;
+}
+if (v_match_len == 0) {
+goto label__loop__continue;
+}
+}
+v_n_copied = wuffs_base__io_writer__copy_n32_from_history(&iop_a_dst, io0_a_dst, io2_a_dst,v_match_len,v_offset);
+if (v_match_len <= v_n_copied) {
+v_match_len = 0;
+goto label__5__break;
+}
+v_match_len -= v_n_copied;
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(10);
+}
+label__5__break:;
+}
+label__loop__break:;
+
+goto ok;ok:self->private_impl.p_decode_compressed_block[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_compressed_block[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_compressed_block[0].v_token = v_token;
+self->private_data.s_decode_compressed_block[0].v_lit_len = v_lit_len;
+self->private_data.s_decode_compressed_block[0].v_match_len = v_match_len;
+self->private_data.s_decode_compressed_block[0].v_offset = v_offset;
+self->private_data.s_decode_compressed_block[0].v_hlen = v_hlen;
+self->private_data.s_decode_compressed_block[0].v_hdist = v_hdist;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 6, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func lz4.decoder.decode_sequences_fast
+
+static wuffs_base__status//
+wuffs_lz4__decoder__decode_sequences_fast(wuffs_lz4__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 7);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_remaining = 0;
+uint32_t v_token = 0;
+uint32_t v_n_header = 0;
+uint32_t v_lit_len = 0;
+uint32_t v_c = 0;
+uint32_t v_match_len = 0;
+uint32_t v_offset = 0;
+uint32_t v_n_copied = 0;
+uint32_t v_hlen = 0;
+uint32_t v_hdist = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+v_remaining = self->private_impl.f_block_remaining;
+label__loop__continue:;
+while ((((uint64_t)(io2_a_dst - iop_a_dst)) >= 550) && (((uint64_t)(io2_a_src - iop_a_src)) >= 287)) {
+v_token = ((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src)));
+v_n_header = 1;
+v_lit_len = ((v_token >> 4) & 15);
+if (v_lit_len == 15) {
+if ((v_token >> 8) == 255) {
+goto label__loop__break;
+}
+v_n_header = 2;
+v_lit_len = (15 + (v_token >> 8));
+}
+if (v_remaining <= (v_lit_len + v_n_header + 2)) {
+goto label__loop__break;
+}
+v_remaining -= (v_lit_len + v_n_header + 2);
+(iop_a_src += v_n_header, wuffs_base__make_empty_struct());
+if ((((uint64_t)(io2_a_src - iop_a_src)) < 285) || (((uint64_t)(io2_a_dst - iop_a_dst)) < 550)) {
+status = wuffs_base__make_status(wuffs_lz4__error__internal_error_inconsistent_i_o);goto exit;}
+wuffs_base__io_writer__copy_n32_from_reader_16_byte_chunks_fast(&iop_a_dst, io2_a_dst,v_lit_len, &iop_a_src, io2_a_src);
+if ((((uint64_t)(io2_a_src - iop_a_src)) < 3) || (((uint64_t)(io2_a_dst - iop_a_dst)) < 281)) {
+status = wuffs_base__make_status(wuffs_lz4__error__internal_error_inconsistent_i_o);goto exit;}
+v_offset = ((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src)));
+(iop_a_src += 2, wuffs_base__make_empty_struct());
+if (v_offset == 0) {
+self->private_impl.f_block_remaining = v_remaining;
+status = wuffs_base__make_status(wuffs_lz4__error__bad_offset);goto exit;}
+v_match_len = ((v_token & 15) + 4);
+if (v_match_len == 19) {
+v_c = ((uint32_t)(wuffs_base__load_u8be__no_bounds_check(iop_a_src)));
+if (v_c == 255) {
+self->private_impl.f_pending_offset = v_offset;
+goto label__loop__break;
+}
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+v_remaining -= 1;
+v_match_len = (19 + v_c);
+}
+if (((uint64_t)(v_offset)) > ((uint64_t)(iop_a_dst - io0_a_dst))) {
+v_hdist = ((uint32_t)((((uint64_t)(v_offset)) - ((uint64_t)(iop_a_dst - io0_a_dst)))));
+if (v_match_len > v_hdist) {
+v_match_len -= v_hdist;
+v_hlen = v_hdist;
+} else {
+v_hlen = v_match_len;
+v_match_len = 0;
+}
+if (self->private_impl.f_history_index < v_hdist) {
+self->private_impl.f_block_remaining = v_remaining;
+status = wuffs_base__make_status(wuffs_lz4__error__bad_offset);goto exit;}
+v_hdist = (self->private_impl.f_history_index - v_hdist);
+v_n_copied = wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,v_hlen,wuffs_base__slice_u8__subslice_i(wuffs_base__make_slice_u8(self->private_data.f_history, 65536),(v_hdist & 65535)));
+if (v_hlen > v_n_copied) {
+wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,(v_hlen - v_n_copied),wuffs_base__make_slice_u8(self->private_data.f_history, 65536));
+}
+if (v_match_len == 0) {
+goto label__loop__continue;
+}
+if (((uint64_t)(v_offset)) > ((uint64_t)(iop_a_dst - io0_a_dst))) {
+status = wuffs_base__make_status(wuffs_lz4__error__internal_error_inconsistent_i_o);goto exit;}
+}
+if (((uint64_t)(io2_a_dst - iop_a_dst)) < 281) {
+status = wuffs_base__make_status(wuffs_lz4__error__internal_error_inconsistent_i_o);goto exit;}
+if (v_offset >= 8) {
+wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast(&iop_a_dst, io0_a_dst, io2_a_dst,v_match_len,v_offset);
+} else if (v_offset == 1) {
+wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_distance_1_fast(&iop_a_dst, io0_a_dst, io2_a_dst,v_match_len,v_offset);
+} else {
+wuffs_base__io_writer__copy_n32_from_history_fast(&iop_a_dst, io0_a_dst, io2_a_dst,v_match_len,v_offset);
+}
+}
+label__loop__break:;
+self->private_impl.f_block_remaining = v_remaining;
+status = wuffs_base__make_status(NULL);goto ok;
+goto ok;ok:
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 7, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__LZ4)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__LZ4
+
@@ -0,0 +1,717 @@
+#ifndef WUFFS_INCLUDE_GUARD__LZW
+#define WUFFS_INCLUDE_GUARD__LZW
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__LZW
+#endif
+
+#include "./wuffs-base.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+extern const char* wuffs_lzw__error__bad_code;
+
+// ---------------- Public Consts
+
+#define WUFFS_LZW__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 32768
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_lzw__decoder__struct wuffs_lzw__decoder;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_lzw__decoder__initialize(wuffs_lzw__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_lzw__decoder();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_lzw__decoder*  //
+wuffs_lzw__decoder__alloc();
+
+static inline wuffs_base__io_transformer*  //
+wuffs_lzw__decoder__alloc_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)(wuffs_lzw__decoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__io_transformer*  //
+wuffs_lzw__decoder__upcast_as__wuffs_base__io_transformer(wuffs_lzw__decoder* p){
+return (wuffs_base__io_transformer*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_LZW__DECODER__STATS__FUNC__SET_QUIRK_ENABLED 0
+#define WUFFS_LZW__DECODER__STATS__FUNC__SET_LITERAL_WIDTH 1
+#define WUFFS_LZW__DECODER__STATS__FUNC__TRANSFORM_IO 2
+#define WUFFS_LZW__DECODER__STATS__FUNC__READ_FROM 3
+#define WUFFS_LZW__DECODER__STATS__FUNC__WRITE_TO 4
+#define WUFFS_LZW__DECODER__STATS__FUNC__FLUSH 5
+#define WUFFS_LZW__DECODER__STATS__FUNC__FLUSH_UP_TO 6
+
+typedef struct wuffs_lzw__decoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[7];
+} wuffs_lzw__decoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_lzw__decoder__stats  //
+wuffs_lzw__decoder__get_stats(const wuffs_lzw__decoder* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_lzw__decoder__set_quirk_enabled(wuffs_lzw__decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_lzw__decoder__set_literal_width(wuffs_lzw__decoder *self,uint32_t a_lw);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_lzw__decoder__workbuf_len(const wuffs_lzw__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_lzw__decoder__transform_io(wuffs_lzw__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__slice_u8//
+wuffs_lzw__decoder__flush(wuffs_lzw__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__slice_u8//
+wuffs_lzw__decoder__flush_up_to(wuffs_lzw__decoder *self,uint64_t a_n);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_lzw__decoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__io_transformer;
+wuffs_base__vtable null_vtable;
+
+uint32_t f_set_literal_width_arg;
+uint32_t f_literal_width;
+uint32_t f_clear_code;
+uint32_t f_end_code;
+uint32_t f_save_code;
+uint32_t f_prev_code;
+uint32_t f_width;
+uint32_t f_bits;
+uint32_t f_n_bits;
+uint32_t f_output_ri;
+uint32_t f_output_wi;
+uint32_t f_read_from_return_value;
+uint16_t f_prefixes[4096];
+
+uint32_t p_transform_io[1];
+uint32_t p_write_to[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_lzw__decoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+uint16_t f_lm1s[4096];
+uint8_t f_output[8199];
+
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_lzw__decoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_lzw__decoder__alloc(), &free);
+}
+
+static inline wuffs_base__io_transformer::unique_ptr  //
+alloc_as__wuffs_base__io_transformer(){
+return wuffs_base__io_transformer::unique_ptr(wuffs_lzw__decoder__alloc_as__wuffs_base__io_transformer(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_lzw__decoder__struct() = delete;
+wuffs_lzw__decoder__struct(const wuffs_lzw__decoder__struct&) = delete;
+wuffs_lzw__decoder__struct& operator=(const wuffs_lzw__decoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_lzw__decoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__io_transformer*  //
+upcast_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_lzw__decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__empty_struct //
+set_literal_width(uint32_t a_lw){ return wuffs_lzw__decoder__set_literal_width(this,a_lw);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_lzw__decoder__workbuf_len(this);}
+
+inline wuffs_base__status //
+transform_io(wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){ return wuffs_lzw__decoder__transform_io(this,a_dst,a_src,a_workbuf);}
+
+inline wuffs_base__slice_u8//
+flush(){ return wuffs_lzw__decoder__flush(this);}
+
+inline wuffs_base__slice_u8//
+flush_up_to(uint64_t a_n){ return wuffs_lzw__decoder__flush_up_to(this,a_n);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_lzw__decoder__stats  //
+get_stats() const {
+return wuffs_lzw__decoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_lzw__decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__LZW)
+
+// ---------------- Status Codes Implementations
+
+const char* wuffs_lzw__error__bad_code = "#lzw: bad code";
+const char* wuffs_lzw__error__internal_error_inconsistent_i_o = "#lzw: internal error: inconsistent I/O";
+
+// ---------------- Private Consts
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static wuffs_base__empty_struct //
+wuffs_lzw__decoder__read_from(wuffs_lzw__decoder *self,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_wb);
+
+static wuffs_base__status //
+wuffs_lzw__decoder__write_to(wuffs_lzw__decoder *self,wuffs_base__io_buffer* a_dst);
+
+// ---------------- VTables
+
+const wuffs_base__io_transformer__func_ptrs wuffs_lzw__decoder__func_ptrs_for__wuffs_base__io_transformer = {(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_lzw__decoder__set_quirk_enabled),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__io_buffer*,wuffs_base__slice_u8))(&wuffs_lzw__decoder__transform_io),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_lzw__decoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_lzw__decoder__initialize(wuffs_lzw__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__io_transformer.vtable_name = wuffs_base__io_transformer__vtable_name;
+self->private_impl.vtable_for__wuffs_base__io_transformer.function_pointers = (const void*)(&wuffs_lzw__decoder__func_ptrs_for__wuffs_base__io_transformer);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_lzw__decoder*  //
+wuffs_lzw__decoder__alloc(){
+wuffs_lzw__decoder* x = (wuffs_lzw__decoder*)(calloc(sizeof(wuffs_lzw__decoder), 1));
+if (!x) { return NULL; }
+if (wuffs_lzw__decoder__initialize(x, sizeof(wuffs_lzw__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_lzw__decoder(){ return sizeof(wuffs_lzw__decoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_lzw__decoder__stats  //
+wuffs_lzw__decoder__get_stats(const wuffs_lzw__decoder* self) {
+wuffs_lzw__decoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func lzw.decoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_lzw__decoder__set_quirk_enabled(wuffs_lzw__decoder *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func lzw.decoder.set_literal_width
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_lzw__decoder__set_literal_width(wuffs_lzw__decoder *self,uint32_t a_lw){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+if (a_lw > 8) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_empty_struct();
+}
+WUFFS_BASE__STATS__CALL(self, 1);
+
+
+self->private_impl.f_set_literal_width_arg = (a_lw + 1);
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func lzw.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_lzw__decoder__workbuf_len(const wuffs_lzw__decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__make_range_ii_u64(32768,32768);}
+
+// -------- func lzw.decoder.transform_io
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_lzw__decoder__transform_io(wuffs_lzw__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 2);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_i = 0;
+
+uint32_t coro_susp_point = self->private_impl.p_transform_io[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (((uint64_t)(a_workbuf.len)) < 32768) {
+status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);goto exit;}
+self->private_impl.f_literal_width = 8;
+if (self->private_impl.f_set_literal_width_arg > 0) {
+self->private_impl.f_literal_width = (self->private_impl.f_set_literal_width_arg - 1);
+}
+self->private_impl.f_clear_code = (((uint32_t)(1)) << self->private_impl.f_literal_width);
+self->private_impl.f_end_code = (self->private_impl.f_clear_code + 1);
+self->private_impl.f_save_code = self->private_impl.f_end_code;
+self->private_impl.f_prev_code = self->private_impl.f_end_code;
+self->private_impl.f_width = (self->private_impl.f_literal_width + 1);
+self->private_impl.f_bits = 0;
+self->private_impl.f_n_bits = 0;
+self->private_impl.f_output_ri = 0;
+self->private_impl.f_output_wi = 0;
+v_i = 0;
+while (v_i < self->private_impl.f_clear_code) {
+self->private_data.f_lm1s[v_i] = 0;
+a_workbuf.ptr[(((uint64_t)(v_i)) << 3)] = ((uint8_t)(v_i));
+v_i += 1;
+}
+label__0__continue:;
+while (true) {
+wuffs_lzw__decoder__read_from(self,a_src,a_workbuf);
+if (self->private_impl.f_output_wi > 0) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_lzw__decoder__write_to(self,a_dst);
+if (status.repr) { goto suspend; }
+}
+if (self->private_impl.f_read_from_return_value == 0) {
+goto label__0__break;
+} else if (self->private_impl.f_read_from_return_value == 1) {
+goto label__0__continue;
+} else if (self->private_impl.f_read_from_return_value == 2) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+} else if (self->private_impl.f_read_from_return_value == 3) {
+status = wuffs_base__make_status(wuffs_lzw__error__bad_code);goto exit;} else {
+status = wuffs_base__make_status(wuffs_lzw__error__internal_error_inconsistent_i_o);goto exit;}
+}
+label__0__break:;
+
+goto ok;ok:self->private_impl.p_transform_io[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_transform_io[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func lzw.decoder.read_from
+
+static wuffs_base__empty_struct //
+wuffs_lzw__decoder__read_from(wuffs_lzw__decoder *self,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_wb){
+WUFFS_BASE__STATS__CALL(self, 3);
+
+uint32_t v_clear_code = 0;
+uint32_t v_end_code = 0;
+uint32_t v_save_code = 0;
+uint32_t v_prev_code = 0;
+uint32_t v_width = 0;
+uint32_t v_bits = 0;
+uint32_t v_n_bits = 0;
+uint32_t v_output_wi = 0;
+uint32_t v_code = 0;
+uint32_t v_c = 0;
+uint32_t v_o = 0;
+uint32_t v_steps = 0;
+uint8_t v_first_byte = 0;
+uint16_t v_lm1_b = 0;
+uint16_t v_lm1_a = 0;
+uint64_t v_sx = 0;
+uint64_t v_prev_sx = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+if (((uint64_t)(a_wb.len)) < 32768) {
+self->private_impl.f_read_from_return_value = 4;
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+return wuffs_base__make_empty_struct();}
+v_clear_code = self->private_impl.f_clear_code;
+v_end_code = self->private_impl.f_end_code;
+v_save_code = self->private_impl.f_save_code;
+v_prev_code = self->private_impl.f_prev_code;
+v_width = self->private_impl.f_width;
+v_bits = self->private_impl.f_bits;
+v_n_bits = self->private_impl.f_n_bits;
+v_output_wi = self->private_impl.f_output_wi;
+while (true) {
+if (v_n_bits < v_width) {
+if (((uint64_t)(io2_a_src - iop_a_src)) >= 4) {
+v_bits |= (wuffs_base__load_u32le__no_bounds_check(iop_a_src) << v_n_bits);
+(iop_a_src += ((31 - v_n_bits) >> 3), wuffs_base__make_empty_struct());
+v_n_bits |= 24;
+} else if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+self->private_impl.f_read_from_return_value = 2;
+goto label__0__break;
+} else {
+v_bits |= (((uint32_t)(wuffs_base__load_u8be__no_bounds_check(iop_a_src))) << v_n_bits);
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+v_n_bits += 8;
+if (v_n_bits >= v_width) {
+} else if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+self->private_impl.f_read_from_return_value = 2;
+goto label__0__break;
+} else {
+v_bits |= (((uint32_t)(wuffs_base__load_u8be__no_bounds_check(iop_a_src))) << v_n_bits);
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+v_n_bits += 8;
+if (v_n_bits < v_width) {
+self->private_impl.f_read_from_return_value = 4;
+goto label__0__break;
+}
+}
+}
+}
+v_code = ((v_bits) & WUFFS_BASE__LOW_BITS_MASK__U32(v_width));
+v_bits >>= v_width;
+v_n_bits -= v_width;
+if (v_code < v_clear_code) {
+self->private_data.f_output[v_output_wi] = ((uint8_t)(v_code));
+v_output_wi = ((v_output_wi + 1) & 8191);
+if (v_save_code <= 4095) {
+v_lm1_a = ((self->private_data.f_lm1s[v_prev_code] + 1) & 4095);
+self->private_data.f_lm1s[v_save_code] = v_lm1_a;
+if ((v_lm1_a % 8) != 0) {
+self->private_impl.f_prefixes[v_save_code] = self->private_impl.f_prefixes[v_prev_code];
+v_prev_sx = (((uint64_t)(v_prev_code)) << 3);
+v_sx = ((((uint64_t)(v_save_code)) << 3) & 32760);
+memcpy((a_wb.ptr)+(v_sx),(a_wb.ptr)+(v_prev_sx), 8);
+a_wb.ptr[(v_sx + ((uint64_t)((v_lm1_a % 8))))] = ((uint8_t)(v_code));
+} else {
+self->private_impl.f_prefixes[v_save_code] = ((uint16_t)(v_prev_code));
+v_sx = ((((uint64_t)(v_save_code)) << 3) & 32760);
+a_wb.ptr[v_sx] = ((uint8_t)(v_code));
+}
+v_save_code += 1;
+if (v_width < 12) {
+v_width += (1 & (v_save_code >> v_width));
+}
+v_prev_code = v_code;
+}
+} else if (v_code <= v_end_code) {
+if (v_code == v_end_code) {
+self->private_impl.f_read_from_return_value = 0;
+goto label__0__break;
+}
+v_save_code = v_end_code;
+v_prev_code = v_end_code;
+v_width = (self->private_impl.f_literal_width + 1);
+} else if (v_code <= v_save_code) {
+v_c = v_code;
+if (v_code == v_save_code) {
+v_c = v_prev_code;
+}
+v_o = ((v_output_wi + (((uint32_t)(self->private_data.f_lm1s[v_c])) & 4294967288)) & 8191);
+v_output_wi = ((v_output_wi + 1 + ((uint32_t)(self->private_data.f_lm1s[v_c]))) & 8191);
+v_steps = (((uint32_t)(self->private_data.f_lm1s[v_c])) >> 3);
+while (true) {
+v_sx = (((uint64_t)(v_c)) << 3);
+memcpy((self->private_data.f_output)+(v_o),(a_wb.ptr)+(v_sx), 8);
+if (v_steps <= 0) {
+goto label__1__break;
+}
+v_steps -= 1;
+v_o = ((v_o - 8) & 8191);
+v_c = ((uint32_t)(self->private_impl.f_prefixes[v_c]));
+}
+label__1__break:;
+v_sx = (((uint64_t)(v_c)) << 3);
+v_first_byte = a_wb.ptr[v_sx];
+if (v_code == v_save_code) {
+self->private_data.f_output[v_output_wi] = v_first_byte;
+v_output_wi = ((v_output_wi + 1) & 8191);
+}
+if (v_save_code <= 4095) {
+v_lm1_b = ((self->private_data.f_lm1s[v_prev_code] + 1) & 4095);
+self->private_data.f_lm1s[v_save_code] = v_lm1_b;
+if ((v_lm1_b % 8) != 0) {
+self->private_impl.f_prefixes[v_save_code] = self->private_impl.f_prefixes[v_prev_code];
+v_prev_sx = (((uint64_t)(v_prev_code)) << 3);
+v_sx = ((((uint64_t)(v_save_code)) << 3) & 32760);
+memcpy((a_wb.ptr)+(v_sx),(a_wb.ptr)+(v_prev_sx), 8);
+a_wb.ptr[(v_sx + ((uint64_t)((v_lm1_b % 8))))] = v_first_byte;
+} else {
+self->private_impl.f_prefixes[v_save_code] = ((uint16_t)(v_prev_code));
+v_sx = ((((uint64_t)(v_save_code)) << 3) & 32760);
+a_wb.ptr[v_sx] = v_first_byte;
+}
+v_save_code += 1;
+if (v_width < 12) {
+v_width += (1 & (v_save_code >> v_width));
+}
+v_prev_code = v_code;
+}
+} else {
+self->private_impl.f_read_from_return_value = 3;
+goto label__0__break;
+}
+if (v_output_wi > 4095) {
+self->private_impl.f_read_from_return_value = 1;
+goto label__0__break;
+}
+}
+label__0__break:;
+if (self->private_impl.f_read_from_return_value != 2) {
+while (v_n_bits >= 8) {
+v_n_bits -= 8;
+if (iop_a_src > io1_a_src) {
+(iop_a_src--, wuffs_base__make_empty_struct());
+} else {
+self->private_impl.f_read_from_return_value = 4;
+goto label__2__break;
+}
+}
+label__2__break:;
+}
+self->private_impl.f_save_code = v_save_code;
+self->private_impl.f_prev_code = v_prev_code;
+self->private_impl.f_width = v_width;
+self->private_impl.f_bits = v_bits;
+self->private_impl.f_n_bits = v_n_bits;
+self->private_impl.f_output_wi = v_output_wi;
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func lzw.decoder.write_to
+
+static wuffs_base__status //
+wuffs_lzw__decoder__write_to(wuffs_lzw__decoder *self,wuffs_base__io_buffer* a_dst){
+WUFFS_BASE__STATS__CALL(self, 4);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+wuffs_base__slice_u8 v_s = {0};
+uint64_t v_n = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+
+uint32_t coro_susp_point = self->private_impl.p_write_to[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (self->private_impl.f_output_wi > 0) {
+if (self->private_impl.f_output_ri > self->private_impl.f_output_wi) {
+status = wuffs_base__make_status(wuffs_lzw__error__internal_error_inconsistent_i_o);goto exit;}
+v_s = wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_output, 8199),self->private_impl.f_output_ri,self->private_impl.f_output_wi);
+v_n = wuffs_base__io_writer__copy_from_slice(&iop_a_dst, io2_a_dst,v_s);
+if (v_n == ((uint64_t)(v_s.len))) {
+self->private_impl.f_output_ri = 0;
+self->private_impl.f_output_wi = 0;
+status = wuffs_base__make_status(NULL);goto ok;}
+self->private_impl.f_output_ri = ((self->private_impl.f_output_ri + ((uint32_t)((v_n & 4294967295)))) & 8191);
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+}
+
+goto ok;ok:self->private_impl.p_write_to[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_write_to[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 4, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+
+return status;
+}
+
+// -------- func lzw.decoder.flush
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__slice_u8//
+wuffs_lzw__decoder__flush(wuffs_lzw__decoder *self){
+if (!self) { return wuffs_base__make_slice_u8(NULL, 0);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_slice_u8(NULL, 0);}
+WUFFS_BASE__STATS__CALL(self, 5);
+
+wuffs_base__slice_u8 v_s = {0};
+
+if (self->private_impl.f_output_ri <= self->private_impl.f_output_wi) {
+v_s = wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_output, 8199),self->private_impl.f_output_ri,self->private_impl.f_output_wi);
+}
+self->private_impl.f_output_ri = 0;
+self->private_impl.f_output_wi = 0;
+return v_s;}
+
+// -------- func lzw.decoder.flush_up_to
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__slice_u8//
+wuffs_lzw__decoder__flush_up_to(wuffs_lzw__decoder *self,uint64_t a_n){
+if (!self) { return wuffs_base__make_slice_u8(NULL, 0);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_slice_u8(NULL, 0);}
+WUFFS_BASE__STATS__CALL(self, 6);
+
+wuffs_base__slice_u8 v_s = {0};
+
+if (self->private_impl.f_output_ri <= self->private_impl.f_output_wi) {
+v_s = wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_output, 8199),self->private_impl.f_output_ri,self->private_impl.f_output_wi);
+}
+if (a_n < ((uint64_t)(v_s.len))) {
+v_s = wuffs_base__slice_u8__subslice_j(v_s,a_n);
+self->private_impl.f_output_ri = ((self->private_impl.f_output_ri + ((uint32_t)((a_n & 4294967295)))) & 8191);
+return v_s;}
+self->private_impl.f_output_ri = 0;
+self->private_impl.f_output_wi = 0;
+return v_s;}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__LZW)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__LZW
+
@@ -0,0 +1,1975 @@
+#ifndef WUFFS_INCLUDE_GUARD__PNG
+#define WUFFS_INCLUDE_GUARD__PNG
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__PNG
+#endif
+
+#include "./wuffs-base.c"
+#include "./wuffs-std-crc32.c"
+#include "./wuffs-std-zlib.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+extern const char* wuffs_png__error__bad_checksum;
+extern const char* wuffs_png__error__bad_chunk;
+extern const char* wuffs_png__error__bad_filter;
+extern const char* wuffs_png__error__bad_header;
+extern const char* wuffs_png__error__missing_palette;
+extern const char* wuffs_png__error__unsupported_png_file;
+
+// ---------------- Public Consts
+
+#define WUFFS_PNG__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 0
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_png__decoder__struct wuffs_png__decoder;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_png__decoder__initialize(wuffs_png__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_png__decoder();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_png__decoder*  //
+wuffs_png__decoder__alloc();
+
+static inline wuffs_base__image_decoder*  //
+wuffs_png__decoder__alloc_as__wuffs_base__image_decoder(){
+return (wuffs_base__image_decoder*)(wuffs_png__decoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__image_decoder*  //
+wuffs_png__decoder__upcast_as__wuffs_base__image_decoder(wuffs_png__decoder* p){
+return (wuffs_base__image_decoder*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_PNG__DECODER__STATS__FUNC__SET_IGNORE_CHECKSUM 0
+#define WUFFS_PNG__DECODER__STATS__FUNC__SET_QUIRK_ENABLED 1
+#define WUFFS_PNG__DECODER__STATS__FUNC__DECODE_IMAGE_CONFIG 2
+#define WUFFS_PNG__DECODER__STATS__FUNC__DECODE_IHDR 3
+#define WUFFS_PNG__DECODER__STATS__FUNC__DECODE_PLTE 4
+#define WUFFS_PNG__DECODER__STATS__FUNC__DECODE_TRNS 5
+#define WUFFS_PNG__DECODER__STATS__FUNC__READ_SMALL_CHUNK 6
+#define WUFFS_PNG__DECODER__STATS__FUNC__SKIP_CHUNK 7
+#define WUFFS_PNG__DECODER__STATS__FUNC__START_CHECKSUM 8
+#define WUFFS_PNG__DECODER__STATS__FUNC__CHOOSE_SRC_PIXFMT 9
+#define WUFFS_PNG__DECODER__STATS__FUNC__DECODE_FRAME_CONFIG 10
+#define WUFFS_PNG__DECODER__STATS__FUNC__DECODE_FRAME 11
+#define WUFFS_PNG__DECODER__STATS__FUNC__DECODE_IDATS 12
+#define WUFFS_PNG__DECODER__STATS__FUNC__FILTER_AND_SWIZZLE 13
+#define WUFFS_PNG__DECODER__STATS__FUNC__FILTER_1 14
+#define WUFFS_PNG__DECODER__STATS__FUNC__FILTER_2 15
+#define WUFFS_PNG__DECODER__STATS__FUNC__FILTER_3 16
+#define WUFFS_PNG__DECODER__STATS__FUNC__FILTER_4 17
+#define WUFFS_PNG__DECODER__STATS__FUNC__SWIZZLE_ROW 18
+#define WUFFS_PNG__DECODER__STATS__FUNC__CONVERT_PIXELS 19
+#define WUFFS_PNG__DECODER__STATS__FUNC__NEXT_BAND 20
+#define WUFFS_PNG__DECODER__STATS__FUNC__SKIP_FRAME 21
+#define WUFFS_PNG__DECODER__STATS__FUNC__RESTART_FRAME 22
+#define WUFFS_PNG__DECODER__STATS__FUNC__SET_REPORT_METADATA 23
+#define WUFFS_PNG__DECODER__STATS__FUNC__TELL_ME_MORE 24
+
+typedef struct wuffs_png__decoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[25];
+
+// The sub-structs' stats are filled in by the get_stats function.
+wuffs_crc32__ieee_hasher__stats crc32;
+wuffs_zlib__decoder__stats zlib;
+} wuffs_png__decoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_png__decoder__stats  //
+wuffs_png__decoder__get_stats(const wuffs_png__decoder* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_png__decoder__set_ignore_checksum(wuffs_png__decoder *self,bool a_ic);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_png__decoder__set_quirk_enabled(wuffs_png__decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_png__decoder__decode_image_config(wuffs_png__decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_png__decoder__decode_frame_config(wuffs_png__decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_png__decoder__decode_frame(wuffs_png__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_png__decoder__frame_dirty_rect(const wuffs_png__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_png__decoder__num_animation_loops(const wuffs_png__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_png__decoder__num_decoded_frame_configs(const wuffs_png__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_png__decoder__num_decoded_frames(const wuffs_png__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_png__decoder__restart_frame(wuffs_png__decoder *self,uint64_t a_index,uint64_t a_io_position);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_png__decoder__set_report_metadata(wuffs_png__decoder *self,uint32_t a_fourcc,bool a_report);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_png__decoder__tell_me_more(wuffs_png__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_png__decoder__workbuf_len(const wuffs_png__decoder *self);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_png__decoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__image_decoder;
+wuffs_base__vtable null_vtable;
+
+uint32_t f_width;
+uint32_t f_height;
+uint8_t f_call_sequence;
+bool f_ignore_checksum;
+uint8_t f_depth;
+uint8_t f_color_type;
+uint8_t f_filter_distance;
+uint64_t f_pass_bytes_per_row;
+uint64_t f_workbuf_length;
+uint64_t f_workbuf_wi;
+wuffs_base__pixel_format f_src_pixfmt;
+uint32_t f_src_bytes_per_pixel;
+bool f_direct;
+bool f_opaque;
+bool f_have_trns;
+uint64_t f_trns_key;
+bool f_have_palette;
+uint32_t f_chunk_type;
+uint8_t f_chunk_type_array[4];
+uint32_t f_chunk_length;
+uint64_t f_frame_config_io_position;
+uint32_t f_first_idat_length;
+uint32_t f_dst_y;
+uint32_t f_scale_shift;
+uint32_t f_crop_x0;
+uint32_t f_crop_y0;
+uint32_t f_crop_x1;
+uint32_t f_crop_y1;
+uint32_t f_band_height;
+uint32_t f_band_y0;
+uint32_t f_band_y1;
+uint32_t f_dst_rect_y1;
+bool f_cpu_arch_checked;
+bool f_have_x86_sse42;
+wuffs_base__pixel_swizzler f_swizzler;
+
+uint32_t p_decode_image_config[1];
+uint32_t p_decode_ihdr[1];
+uint32_t p_decode_plte[1];
+uint32_t p_decode_trns[1];
+uint32_t p_read_small_chunk[1];
+uint32_t p_skip_chunk[1];
+uint32_t p_decode_frame_config[1];
+uint32_t p_decode_frame[1];
+uint32_t p_decode_idats[1];
+uint32_t p_skip_frame[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_png__decoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+wuffs_crc32__ieee_hasher f_crc32;
+wuffs_zlib__decoder f_zlib;
+uint8_t f_src_palette[1024];
+uint8_t f_dst_palette[1024];
+uint8_t f_scratch[4096];
+
+struct {
+uint64_t scratch;
+} s_decode_image_config[1];
+struct {
+uint32_t v_n;
+} s_decode_plte[1];
+struct {
+uint32_t v_n;
+} s_decode_trns[1];
+struct {
+uint32_t v_n;
+uint32_t v_i;
+uint64_t scratch;
+} s_read_small_chunk[1];
+struct {
+uint64_t v_n;
+uint64_t scratch;
+} s_skip_chunk[1];
+struct {
+uint64_t v_n;
+bool v_zlib_done;
+uint64_t scratch;
+} s_decode_idats[1];
+struct {
+uint64_t scratch;
+} s_skip_frame[1];
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_png__decoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_png__decoder__alloc(), &free);
+}
+
+static inline wuffs_base__image_decoder::unique_ptr  //
+alloc_as__wuffs_base__image_decoder(){
+return wuffs_base__image_decoder::unique_ptr(wuffs_png__decoder__alloc_as__wuffs_base__image_decoder(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_png__decoder__struct() = delete;
+wuffs_png__decoder__struct(const wuffs_png__decoder__struct&) = delete;
+wuffs_png__decoder__struct& operator=(const wuffs_png__decoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_png__decoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__image_decoder*  //
+upcast_as__wuffs_base__image_decoder(){
+return (wuffs_base__image_decoder*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_ignore_checksum(bool a_ic){ return wuffs_png__decoder__set_ignore_checksum(this,a_ic);}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_png__decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__status //
+decode_image_config(wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_png__decoder__decode_image_config(this,a_dst,a_src);}
+
+inline wuffs_base__status //
+decode_frame_config(wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_png__decoder__decode_frame_config(this,a_dst,a_src);}
+
+inline wuffs_base__status //
+decode_frame(wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){ return wuffs_png__decoder__decode_frame(this,a_dst,a_src,a_blend,a_workbuf,a_opts);}
+
+inline wuffs_base__rect_ie_u32//
+frame_dirty_rect() const { return wuffs_png__decoder__frame_dirty_rect(this);}
+
+inline uint32_t//
+num_animation_loops() const { return wuffs_png__decoder__num_animation_loops(this);}
+
+inline uint64_t//
+num_decoded_frame_configs() const { return wuffs_png__decoder__num_decoded_frame_configs(this);}
+
+inline uint64_t//
+num_decoded_frames() const { return wuffs_png__decoder__num_decoded_frames(this);}
+
+inline wuffs_base__status//
+restart_frame(uint64_t a_index,uint64_t a_io_position){ return wuffs_png__decoder__restart_frame(this,a_index,a_io_position);}
+
+inline wuffs_base__empty_struct //
+set_report_metadata(uint32_t a_fourcc,bool a_report){ return wuffs_png__decoder__set_report_metadata(this,a_fourcc,a_report);}
+
+inline wuffs_base__status //
+tell_me_more(wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){ return wuffs_png__decoder__tell_me_more(this,a_dst,a_minfo,a_src);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_png__decoder__workbuf_len(this);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_png__decoder__stats  //
+get_stats() const {
+return wuffs_png__decoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_png__decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__PNG)
+
+// ---------------- Status Codes Implementations
+
+const char* wuffs_png__error__bad_checksum = "#png: bad checksum";
+const char* wuffs_png__error__bad_chunk = "#png: bad chunk";
+const char* wuffs_png__error__bad_filter = "#png: bad filter";
+const char* wuffs_png__error__bad_header = "#png: bad header";
+const char* wuffs_png__error__missing_palette = "#png: missing palette";
+const char* wuffs_png__error__unsupported_png_file = "#png: unsupported PNG file";
+const char* wuffs_png__error__internal_error_inconsistent_workbuf_length = "#png: internal error: inconsistent workbuf length";
+
+// ---------------- Private Consts
+
+static const uint8_t //
+WUFFS_PNG__NUM_CHANNELS[8]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {1,0,3,1,2,0,4,0,};
+
+static const uint8_t //
+WUFFS_PNG__LOW_BIT_DEPTH_MULTIPLIERS[8]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,255,85,0,17,0,0,0,};
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static wuffs_base__status //
+wuffs_png__decoder__decode_ihdr(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_png__decoder__decode_plte(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_png__decoder__decode_trns(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_png__decoder__read_small_chunk(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status //
+wuffs_png__decoder__skip_chunk(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src);
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__start_checksum(wuffs_png__decoder *self);
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__choose_src_pixfmt(wuffs_png__decoder *self);
+
+static wuffs_base__status //
+wuffs_png__decoder__decode_idats(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status//
+wuffs_png__decoder__filter_and_swizzle(wuffs_png__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__filter_1(wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr);
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__filter_2(wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr,wuffs_base__slice_u8 a_prev);
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__filter_3(wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr,wuffs_base__slice_u8 a_prev);
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__filter_4(wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr,wuffs_base__slice_u8 a_prev);
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__swizzle_row(wuffs_png__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__slice_u8 a_curr);
+
+static uint32_t//
+wuffs_png__decoder__convert_pixels(wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr,uint32_t a_x);
+
+static uint32_t//
+wuffs_png__decoder__sample(const wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr,uint32_t a_x,uint32_t a_c);
+
+static uint8_t//
+wuffs_png__decoder__sample_to_u8(const wuffs_png__decoder *self,uint32_t a_s);
+
+static bool//
+wuffs_png__decoder__band_is_done(const wuffs_png__decoder *self);
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__next_band(wuffs_png__decoder *self);
+
+static wuffs_base__status //
+wuffs_png__decoder__skip_frame(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src);
+
+// ---------------- VTables
+
+const wuffs_base__image_decoder__func_ptrs wuffs_png__decoder__func_ptrs_for__wuffs_base__image_decoder = {(wuffs_base__status (*)(void*,wuffs_base__pixel_buffer*,wuffs_base__io_buffer*,wuffs_base__pixel_blend,wuffs_base__slice_u8,wuffs_base__decode_frame_options*))(&wuffs_png__decoder__decode_frame),
+(wuffs_base__status (*)(void*,wuffs_base__frame_config*,wuffs_base__io_buffer*))(&wuffs_png__decoder__decode_frame_config),
+(wuffs_base__status (*)(void*,wuffs_base__image_config*,wuffs_base__io_buffer*))(&wuffs_png__decoder__decode_image_config),
+(wuffs_base__rect_ie_u32(*)(const void*))(&wuffs_png__decoder__frame_dirty_rect),
+(uint32_t(*)(const void*))(&wuffs_png__decoder__num_animation_loops),
+(uint64_t(*)(const void*))(&wuffs_png__decoder__num_decoded_frame_configs),
+(uint64_t(*)(const void*))(&wuffs_png__decoder__num_decoded_frames),
+(wuffs_base__status(*)(void*,uint64_t,uint64_t))(&wuffs_png__decoder__restart_frame),
+(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_png__decoder__set_quirk_enabled),
+(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_png__decoder__set_report_metadata),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__more_information*,wuffs_base__io_buffer*))(&wuffs_png__decoder__tell_me_more),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_png__decoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_png__decoder__initialize(wuffs_png__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+{
+wuffs_base__status z = wuffs_crc32__ieee_hasher__initialize(&self->private_data.f_crc32, sizeof(self->private_data.f_crc32), WUFFS_VERSION, initialize_flags);
+if (z.repr) { return z; }
+}
+{
+wuffs_base__status z = wuffs_zlib__decoder__initialize(&self->private_data.f_zlib, sizeof(self->private_data.f_zlib), WUFFS_VERSION, initialize_flags);
+if (z.repr) { return z; }
+}
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__image_decoder.vtable_name = wuffs_base__image_decoder__vtable_name;
+self->private_impl.vtable_for__wuffs_base__image_decoder.function_pointers = (const void*)(&wuffs_png__decoder__func_ptrs_for__wuffs_base__image_decoder);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_png__decoder*  //
+wuffs_png__decoder__alloc(){
+wuffs_png__decoder* x = (wuffs_png__decoder*)(calloc(sizeof(wuffs_png__decoder), 1));
+if (!x) { return NULL; }
+if (wuffs_png__decoder__initialize(x, sizeof(wuffs_png__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_png__decoder(){ return sizeof(wuffs_png__decoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_png__decoder__stats  //
+wuffs_png__decoder__get_stats(const wuffs_png__decoder* self) {
+wuffs_png__decoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+ret.crc32 = wuffs_crc32__ieee_hasher__get_stats(&self->private_data.f_crc32);
+ret.zlib = wuffs_zlib__decoder__get_stats(&self->private_data.f_zlib);
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func png.decoder.set_ignore_checksum
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_png__decoder__set_ignore_checksum(wuffs_png__decoder *self,bool a_ic){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 0);
+
+
+self->private_impl.f_ignore_checksum = a_ic;
+wuffs_zlib__decoder__set_ignore_checksum(&self->private_data.f_zlib,a_ic);
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func png.decoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_png__decoder__set_quirk_enabled(wuffs_png__decoder *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func png.decoder.decode_image_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_png__decoder__decode_image_config(wuffs_png__decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 2);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint64_t v_magic = 0;
+uint32_t v_i = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_image_config[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence != 0) {
+status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);goto exit;}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+uint64_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 8)) {t_0 =wuffs_base__load_u64le__no_bounds_check(iop_a_src); iop_a_src += 8;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;if (num_bits_0 == 56) { t_0 = ((uint64_t)(*scratch));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0)) << 56;}}
+v_magic = t_0;
+}
+if (v_magic != 727905341920923785) {
+status = wuffs_base__make_status(wuffs_png__error__bad_header);goto exit;}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_1 =wuffs_base__load_u32be__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_1);if (num_bits_1 == 24) { t_1 = ((uint32_t)(*scratch >> 32));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1));}}
+self->private_impl.f_chunk_length = t_1;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+uint32_t t_2;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_2 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_2 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_2;if (num_bits_2 == 24) { t_2 = ((uint32_t)(*scratch));break;}num_bits_2 += 8;*scratch |= ((uint64_t)(num_bits_2)) << 56;}}
+self->private_impl.f_chunk_type = t_2;
+}
+if ((self->private_impl.f_chunk_length != 13) || (self->private_impl.f_chunk_type != 1380206665)) {
+status = wuffs_base__make_status(wuffs_png__error__bad_header);goto exit;}
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+status = wuffs_png__decoder__decode_ihdr(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+v_i = 0;
+while (v_i < 256) {
+self->private_data.f_src_palette[((4 * v_i) + 0)] = 0;
+self->private_data.f_src_palette[((4 * v_i) + 1)] = 0;
+self->private_data.f_src_palette[((4 * v_i) + 2)] = 0;
+self->private_data.f_src_palette[((4 * v_i) + 3)] = 255;
+v_i += 1;
+}
+while (true) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+uint32_t t_3;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_3 =wuffs_base__load_u32be__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_3 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_3);if (num_bits_3 == 24) { t_3 = ((uint32_t)(*scratch >> 32));break;}num_bits_3 += 8;*scratch |= ((uint64_t)(num_bits_3));}}
+self->private_impl.f_chunk_length = t_3;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(10);
+uint32_t t_4;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_4 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_image_config[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(11);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_image_config[0].scratch;uint32_t num_bits_4 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_4;if (num_bits_4 == 24) { t_4 = ((uint32_t)(*scratch));break;}num_bits_4 += 8;*scratch |= ((uint64_t)(num_bits_4)) << 56;}}
+self->private_impl.f_chunk_type = t_4;
+}
+if (self->private_impl.f_chunk_length > 2147483647) {
+status = wuffs_base__make_status(wuffs_png__error__bad_chunk);goto exit;} else if (self->private_impl.f_chunk_type == 1413563465) {
+goto label__0__break;
+} else if (self->private_impl.f_chunk_type == 1163152464) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(12);
+status = wuffs_png__decoder__decode_plte(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else if (self->private_impl.f_chunk_type == 1397641844) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(13);
+status = wuffs_png__decoder__decode_trns(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else if (((self->private_impl.f_chunk_type & 32) == 0) || (self->private_impl.f_chunk_type == 1145980233)) {
+status = wuffs_base__make_status(wuffs_png__error__unsupported_png_file);goto exit;} else {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(14);
+status = wuffs_png__decoder__skip_chunk(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+}
+}
+label__0__break:;
+if ((self->private_impl.f_color_type == 3) &&  ! self->private_impl.f_have_palette) {
+status = wuffs_base__make_status(wuffs_png__error__missing_palette);goto exit;}
+wuffs_png__decoder__choose_src_pixfmt(self);
+self->private_impl.f_first_idat_length = self->private_impl.f_chunk_length;
+self->private_impl.f_frame_config_io_position = wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)));
+if (a_dst != NULL) {
+wuffs_base__image_config__set(a_dst,2164295816,0,self->private_impl.f_width,self->private_impl.f_height,self->private_impl.f_frame_config_io_position,self->private_impl.f_opaque);
+}
+self->private_impl.f_call_sequence = 1;
+
+goto ok;ok:self->private_impl.p_decode_image_config[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_image_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func png.decoder.decode_ihdr
+
+static wuffs_base__status //
+wuffs_png__decoder__decode_ihdr(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 3);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_width = 0;
+uint32_t v_height = 0;
+uint8_t v_c = 0;
+uint8_t v_num_channels = 0;
+uint64_t v_bits = 0;
+
+uint32_t coro_susp_point = self->private_impl.p_decode_ihdr[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_png__decoder__read_small_chunk(self,a_src);
+if (status.repr) { goto suspend; }
+v_width = ((((uint32_t)(self->private_data.f_scratch[4])) << 24) | (((uint32_t)(self->private_data.f_scratch[5])) << 16) | (((uint32_t)(self->private_data.f_scratch[6])) << 8) | (((uint32_t)(self->private_data.f_scratch[7])) << 0));
+v_height = ((((uint32_t)(self->private_data.f_scratch[8])) << 24) | (((uint32_t)(self->private_data.f_scratch[9])) << 16) | (((uint32_t)(self->private_data.f_scratch[10])) << 8) | (((uint32_t)(self->private_data.f_scratch[11])) << 0));
+if ((v_width == 0) || (v_height == 0) || (v_width > 2147483647) || (v_height > 2147483647)) {
+status = wuffs_base__make_status(wuffs_png__error__bad_header);goto exit;} else if ((v_width > 16777215) || (v_height > 16777215)) {
+status = wuffs_base__make_status(wuffs_png__error__unsupported_png_file);goto exit;}
+self->private_impl.f_width = v_width;
+self->private_impl.f_height = v_height;
+v_c = self->private_data.f_scratch[12];
+if (v_c > 16) {
+status = wuffs_base__make_status(wuffs_png__error__bad_header);goto exit;} else if ((v_c != 1) && (v_c != 2) && (v_c != 4) && (v_c != 8) && (v_c != 16)) {
+status = wuffs_base__make_status(wuffs_png__error__bad_header);goto exit;}
+self->private_impl.f_depth = v_c;
+v_c = self->private_data.f_scratch[13];
+if (v_c == 0) {
+} else if ((v_c == 2) || (v_c == 4) || (v_c == 6)) {
+if (self->private_impl.f_depth < 8) {
+status = wuffs_base__make_status(wuffs_png__error__bad_header);goto exit;}
+} else if (v_c == 3) {
+if (self->private_impl.f_depth > 8) {
+status = wuffs_base__make_status(wuffs_png__error__bad_header);goto exit;}
+} else {
+status = wuffs_base__make_status(wuffs_png__error__bad_header);goto exit;}
+self->private_impl.f_color_type = (v_c & 7);
+if ((self->private_data.f_scratch[14] != 0) || (self->private_data.f_scratch[15] != 0)) {
+status = wuffs_base__make_status(wuffs_png__error__bad_header);goto exit;} else if (self->private_data.f_scratch[16] == 1) {
+status = wuffs_base__make_status(wuffs_png__error__unsupported_png_file);goto exit;} else if (self->private_data.f_scratch[16] != 0) {
+status = wuffs_base__make_status(wuffs_png__error__bad_header);goto exit;}
+v_num_channels = WUFFS_PNG__NUM_CHANNELS[self->private_impl.f_color_type];
+v_bits = (((uint64_t)(v_num_channels)) * ((uint64_t)(self->private_impl.f_depth)));
+self->private_impl.f_filter_distance = ((uint8_t)(((v_bits + 7) / 8)));
+self->private_impl.f_pass_bytes_per_row = (((((uint64_t)(self->private_impl.f_width)) * v_bits) + 7) / 8);
+self->private_impl.f_workbuf_length = (((uint64_t)(self->private_impl.f_height)) * (1 + self->private_impl.f_pass_bytes_per_row));
+
+goto ok;ok:self->private_impl.p_decode_ihdr[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_ihdr[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:return status;
+}
+
+// -------- func png.decoder.decode_plte
+
+static wuffs_base__status //
+wuffs_png__decoder__decode_plte(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 4);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_n = 0;
+uint32_t v_i = 0;
+
+uint32_t coro_susp_point = self->private_impl.p_decode_plte[0];
+if (coro_susp_point) {
+v_n = self->private_data.s_decode_plte[0].v_n;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_have_palette || (self->private_impl.f_color_type == 0) || (self->private_impl.f_color_type == 4)) {
+status = wuffs_base__make_status(wuffs_png__error__bad_chunk);goto exit;} else if ((self->private_impl.f_chunk_length > 768) || ((self->private_impl.f_chunk_length % 3) != 0)) {
+status = wuffs_base__make_status(wuffs_png__error__bad_chunk);goto exit;}
+v_n = (self->private_impl.f_chunk_length / 3);
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_png__decoder__read_small_chunk(self,a_src);
+if (status.repr) { goto suspend; }
+if (self->private_impl.f_color_type == 3) {
+v_i = 0;
+while (v_i < v_n) {
+self->private_data.f_src_palette[((4 * v_i) + 0)] = self->private_data.f_scratch[((3 * v_i) + 6)];
+self->private_data.f_src_palette[((4 * v_i) + 1)] = self->private_data.f_scratch[((3 * v_i) + 5)];
+self->private_data.f_src_palette[((4 * v_i) + 2)] = self->private_data.f_scratch[((3 * v_i) + 4)];
+self->private_data.f_src_palette[((4 * v_i) + 3)] = 255;
+v_i += 1;
+}
+}
+self->private_impl.f_have_palette = true;
+
+goto ok;ok:self->private_impl.p_decode_plte[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_plte[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_plte[0].v_n = v_n;
+
+goto exit;exit:return status;
+}
+
+// -------- func png.decoder.decode_trns
+
+static wuffs_base__status //
+wuffs_png__decoder__decode_trns(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 5);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_n = 0;
+uint32_t v_i = 0;
+
+uint32_t coro_susp_point = self->private_impl.p_decode_trns[0];
+if (coro_susp_point) {
+v_n = self->private_data.s_decode_trns[0].v_n;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_have_trns || (self->private_impl.f_color_type == 4) || (self->private_impl.f_color_type == 6)) {
+status = wuffs_base__make_status(wuffs_png__error__bad_chunk);goto exit;} else if (self->private_impl.f_color_type == 0) {
+if (self->private_impl.f_chunk_length != 2) {
+status = wuffs_base__make_status(wuffs_png__error__bad_chunk);goto exit;}
+} else if (self->private_impl.f_color_type == 2) {
+if (self->private_impl.f_chunk_length != 6) {
+status = wuffs_base__make_status(wuffs_png__error__bad_chunk);goto exit;}
+} else if ( ! self->private_impl.f_have_palette || (self->private_impl.f_chunk_length > 256)) {
+status = wuffs_base__make_status(wuffs_png__error__bad_chunk);goto exit;}
+v_n = wuffs_base__u32__min(self->private_impl.f_chunk_length,256);
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_png__decoder__read_small_chunk(self,a_src);
+if (status.repr) { goto suspend; }
+if (self->private_impl.f_color_type == 3) {
+v_i = 0;
+while (v_i < v_n) {
+self->private_data.f_src_palette[((4 * v_i) + 3)] = self->private_data.f_scratch[(v_i + 4)];
+v_i += 1;
+}
+} else {
+self->private_impl.f_trns_key = ((((uint64_t)(self->private_data.f_scratch[4])) << 8) | (((uint64_t)(self->private_data.f_scratch[5])) << 0));
+if (self->private_impl.f_color_type == 2) {
+self->private_impl.f_trns_key = ((self->private_impl.f_trns_key << 32) | (((uint64_t)(self->private_data.f_scratch[6])) << 24) | (((uint64_t)(self->private_data.f_scratch[7])) << 16) | (((uint64_t)(self->private_data.f_scratch[8])) << 8) | (((uint64_t)(self->private_data.f_scratch[9])) << 0));
+}
+self->private_impl.f_have_trns = true;
+}
+
+goto ok;ok:self->private_impl.p_decode_trns[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_trns[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_trns[0].v_n = v_n;
+
+goto exit;exit:return status;
+}
+
+// -------- func png.decoder.read_small_chunk
+
+static wuffs_base__status //
+wuffs_png__decoder__read_small_chunk(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 6);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_n = 0;
+uint32_t v_i = 0;
+uint32_t v_checksum_have = 0;
+uint32_t v_checksum_want = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_read_small_chunk[0];
+if (coro_susp_point) {
+v_n = self->private_data.s_read_small_chunk[0].v_n;
+v_i = self->private_data.s_read_small_chunk[0].v_i;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_chunk_length > 1020) {
+status = wuffs_base__make_status(wuffs_png__error__bad_chunk);goto exit;}
+v_n = self->private_impl.f_chunk_length;
+self->private_data.f_scratch[0] = ((uint8_t)(((self->private_impl.f_chunk_type >> 0) & 255)));
+self->private_data.f_scratch[1] = ((uint8_t)(((self->private_impl.f_chunk_type >> 8) & 255)));
+self->private_data.f_scratch[2] = ((uint8_t)(((self->private_impl.f_chunk_type >> 16) & 255)));
+self->private_data.f_scratch[3] = ((uint8_t)(((self->private_impl.f_chunk_type >> 24) & 255)));
+v_i = 0;
+while (v_i < v_n) {
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+self->private_data.f_scratch[(v_i + 4)] = t_0;
+}
+v_i += 1;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_1 =wuffs_base__load_u32be__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_read_small_chunk[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_read_small_chunk[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_1);if (num_bits_1 == 24) { t_1 = ((uint32_t)(*scratch >> 32));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1));}}
+v_checksum_want = t_1;
+}
+if ( ! self->private_impl.f_ignore_checksum) {
+wuffs_base__ignore_status(wuffs_crc32__ieee_hasher__initialize(&self->private_data.f_crc32, sizeof (wuffs_crc32__ieee_hasher), WUFFS_VERSION, 0));
+v_checksum_have = wuffs_crc32__ieee_hasher__update_u32(&self->private_data.f_crc32,wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_data.f_scratch, 4096),(v_n + 4)));
+if (v_checksum_have != v_checksum_want) {
+status = wuffs_base__make_status(wuffs_png__error__bad_checksum);goto exit;}
+}
+
+goto ok;ok:self->private_impl.p_read_small_chunk[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_read_small_chunk[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_read_small_chunk[0].v_n = v_n;
+self->private_data.s_read_small_chunk[0].v_i = v_i;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func png.decoder.skip_chunk
+
+static wuffs_base__status //
+wuffs_png__decoder__skip_chunk(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 7);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint64_t v_n = 0;
+wuffs_base__slice_u8 v_data = {0};
+uint32_t v_checksum_have = 0;
+uint32_t v_checksum_want = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_skip_chunk[0];
+if (coro_susp_point) {
+v_n = self->private_data.s_skip_chunk[0].v_n;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+wuffs_png__decoder__start_checksum(self);
+label__0__continue:;
+while (self->private_impl.f_chunk_length > 0) {
+v_n = ((uint64_t)(io2_a_src - iop_a_src));
+if (v_n <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+goto label__0__continue;
+} else if (v_n > ((uint64_t)(self->private_impl.f_chunk_length))) {
+v_n = ((uint64_t)(self->private_impl.f_chunk_length));
+}
+self->private_impl.f_chunk_length -= ((uint32_t)((v_n & 4294967295)));
+v_data = wuffs_base__io_reader__take(&iop_a_src, io2_a_src,v_n);
+if ( ! self->private_impl.f_ignore_checksum) {
+wuffs_crc32__ieee_hasher__update_u32(&self->private_data.f_crc32,v_data);
+}
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+uint32_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_0 =wuffs_base__load_u32be__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_skip_chunk[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_skip_chunk[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_0);if (num_bits_0 == 24) { t_0 = ((uint32_t)(*scratch >> 32));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0));}}
+v_checksum_want = t_0;
+}
+if ( ! self->private_impl.f_ignore_checksum) {
+v_checksum_have = wuffs_crc32__ieee_hasher__update_u32(&self->private_data.f_crc32,wuffs_base__utility__empty_slice_u8());
+if (v_checksum_have != v_checksum_want) {
+status = wuffs_base__make_status(wuffs_png__error__bad_checksum);goto exit;}
+}
+
+goto ok;ok:self->private_impl.p_skip_chunk[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_skip_chunk[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_skip_chunk[0].v_n = v_n;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func png.decoder.start_checksum
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__start_checksum(wuffs_png__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 8);
+
+
+if ( ! self->private_impl.f_ignore_checksum) {
+self->private_impl.f_chunk_type_array[0] = ((uint8_t)(((self->private_impl.f_chunk_type >> 0) & 255)));
+self->private_impl.f_chunk_type_array[1] = ((uint8_t)(((self->private_impl.f_chunk_type >> 8) & 255)));
+self->private_impl.f_chunk_type_array[2] = ((uint8_t)(((self->private_impl.f_chunk_type >> 16) & 255)));
+self->private_impl.f_chunk_type_array[3] = ((uint8_t)(((self->private_impl.f_chunk_type >> 24) & 255)));
+wuffs_base__ignore_status(wuffs_crc32__ieee_hasher__initialize(&self->private_data.f_crc32, sizeof (wuffs_crc32__ieee_hasher), WUFFS_VERSION, 0));
+wuffs_crc32__ieee_hasher__update_u32(&self->private_data.f_crc32,wuffs_base__make_slice_u8(self->private_impl.f_chunk_type_array, 4));
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func png.decoder.choose_src_pixfmt
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__choose_src_pixfmt(wuffs_png__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 9);
+
+uint32_t v_i = 0;
+uint8_t v_alpha = 0;
+
+if (self->private_impl.f_color_type == 0) {
+if ( ! self->private_impl.f_have_trns) {
+self->private_impl.f_src_pixfmt = wuffs_base__utility__make_pixel_format(536870920);
+self->private_impl.f_src_bytes_per_pixel = 1;
+self->private_impl.f_direct = (self->private_impl.f_depth == 8);
+self->private_impl.f_opaque = true;
+return wuffs_base__make_empty_struct();}
+} else if (self->private_impl.f_color_type == 2) {
+if ( ! self->private_impl.f_have_trns) {
+self->private_impl.f_src_pixfmt = wuffs_base__utility__make_pixel_format(2147485832);
+self->private_impl.f_src_bytes_per_pixel = 3;
+self->private_impl.f_direct = false;
+self->private_impl.f_opaque = true;
+return wuffs_base__make_empty_struct();}
+} else if (self->private_impl.f_color_type == 3) {
+self->private_impl.f_opaque = true;
+v_i = 0;
+while (v_i < 256) {
+v_alpha = self->private_data.f_src_palette[((4 * v_i) + 3)];
+if (v_alpha != 255) {
+self->private_impl.f_opaque = false;
+if (v_alpha != 0) {
+goto label__0__break;
+}
+}
+v_i += 1;
+}
+label__0__break:;
+if (v_i >= 256) {
+self->private_impl.f_src_pixfmt = wuffs_base__utility__make_pixel_format(2198077448);
+self->private_impl.f_src_bytes_per_pixel = 1;
+self->private_impl.f_direct = (self->private_impl.f_depth == 8);
+return wuffs_base__make_empty_struct();}
+}
+self->private_impl.f_src_pixfmt = wuffs_base__utility__make_pixel_format(2164295816);
+self->private_impl.f_src_bytes_per_pixel = 4;
+self->private_impl.f_direct = false;
+self->private_impl.f_opaque = false;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func png.decoder.decode_frame_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_png__decoder__decode_frame_config(wuffs_png__decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 2)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 10);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_frame_config[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence < 1) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_png__decoder__decode_image_config(self,NULL,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else if (self->private_impl.f_call_sequence == 1) {
+if (self->private_impl.f_frame_config_io_position != wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)))) {
+status = wuffs_base__make_status(wuffs_base__error__bad_restart);goto exit;}
+} else if (self->private_impl.f_call_sequence == 2) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_png__decoder__skip_frame(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;} else {
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;}
+if (a_dst != NULL) {
+wuffs_base__frame_config__update(a_dst,wuffs_base__utility__make_rect_ie_u32(0,0,self->private_impl.f_width,self->private_impl.f_height),((wuffs_base__flicks)(0)),0,self->private_impl.f_frame_config_io_position,0,self->private_impl.f_opaque,false,4278190080);
+}
+self->private_impl.f_call_sequence = 2;
+
+goto ok;ok:self->private_impl.p_decode_frame_config[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_frame_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 2 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func png.decoder.decode_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_png__decoder__decode_frame(wuffs_png__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 3)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 11);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+uint32_t v_m = 0;
+wuffs_base__slice_u8 v_dst_palette = {0};
+wuffs_base__pixel_format v_dst_pixfmt = {0};
+uint32_t v_dst_bits_per_pixel = 0;
+
+uint32_t coro_susp_point = self->private_impl.p_decode_frame[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence < 2) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_png__decoder__decode_frame_config(self,NULL,a_src);
+if (status.repr) { goto suspend; }
+} else if (self->private_impl.f_call_sequence == 2) {
+} else {
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;}
+if (((uint64_t)(a_workbuf.len)) < self->private_impl.f_workbuf_length) {
+status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);goto exit;}
+if ( ! self->private_impl.f_cpu_arch_checked) {
+self->private_impl.f_cpu_arch_checked = true;
+self->private_impl.f_have_x86_sse42 = wuffs_base__utility__cpu_arch_have_x86_sse42();
+}
+v_dst_palette = wuffs_base__pixel_buffer__palette(a_dst);
+if (((uint64_t)(v_dst_palette.len)) == 0) {
+v_dst_palette = wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024);
+}
+v_status = wuffs_base__pixel_swizzler__prepare(&self->private_impl.f_swizzler,wuffs_base__pixel_buffer__pixel_format(a_dst),v_dst_palette,self->private_impl.f_src_pixfmt,wuffs_base__make_slice_u8(self->private_data.f_src_palette, 1024),a_blend);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+v_dst_pixfmt = wuffs_base__pixel_buffer__pixel_format(a_dst);
+v_dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(&v_dst_pixfmt);
+if ((v_dst_bits_per_pixel & 7) != 0) {
+status = wuffs_base__make_status(wuffs_base__error__unsupported_option);goto exit;}
+self->private_impl.f_scale_shift = 0;
+self->private_impl.f_crop_x0 = 0;
+self->private_impl.f_crop_y0 = 0;
+self->private_impl.f_crop_x1 = self->private_impl.f_width;
+self->private_impl.f_crop_y1 = self->private_impl.f_height;
+if (a_opts != NULL) {
+self->private_impl.f_scale_shift = wuffs_base__decode_frame_options__scale_shift(a_opts);
+self->private_impl.f_crop_x1 = wuffs_base__u32__min(self->private_impl.f_width,wuffs_base__decode_frame_options__crop_max_excl_x(a_opts));
+self->private_impl.f_crop_y1 = wuffs_base__u32__min(self->private_impl.f_height,wuffs_base__decode_frame_options__crop_max_excl_y(a_opts));
+self->private_impl.f_crop_x0 = wuffs_base__u32__min(self->private_impl.f_crop_x1,wuffs_base__decode_frame_options__crop_min_incl_x(a_opts));
+self->private_impl.f_crop_y0 = wuffs_base__u32__min(self->private_impl.f_crop_y1,wuffs_base__decode_frame_options__crop_min_incl_y(a_opts));
+}
+v_m = ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1);
+self->private_impl.f_dst_rect_y1 = (wuffs_base__u32__sat_add((self->private_impl.f_crop_y1 - self->private_impl.f_crop_y0),v_m) >> self->private_impl.f_scale_shift);
+self->private_impl.f_band_height = 0;
+if (a_opts != NULL) {
+self->private_impl.f_band_height = wuffs_base__decode_frame_options__band_height(a_opts);
+}
+self->private_impl.f_band_y0 = 0;
+self->private_impl.f_band_y1 = self->private_impl.f_dst_rect_y1;
+if (self->private_impl.f_band_height > 0) {
+self->private_impl.f_band_y1 = wuffs_base__u32__min(self->private_impl.f_dst_rect_y1,self->private_impl.f_band_height);
+}
+self->private_impl.f_chunk_length = self->private_impl.f_first_idat_length;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_png__decoder__decode_idats(self,a_src,a_workbuf);
+if (status.repr) { goto suspend; }
+self->private_impl.f_dst_y = 0;
+while (self->private_impl.f_dst_y < self->private_impl.f_crop_y1) {
+v_status = wuffs_png__decoder__filter_and_swizzle(self,a_dst,a_workbuf);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+self->private_impl.f_dst_y += 1;
+while (wuffs_png__decoder__band_is_done(self)) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(3);
+wuffs_png__decoder__next_band(self);
+}
+}
+while (self->private_impl.f_band_y1 < self->private_impl.f_dst_rect_y1) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(4);
+wuffs_png__decoder__next_band(self);
+}
+self->private_impl.f_call_sequence = 3;
+
+goto ok;ok:self->private_impl.p_decode_frame[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 3 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func png.decoder.decode_idats
+
+static wuffs_base__status //
+wuffs_png__decoder__decode_idats(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+WUFFS_BASE__STATS__CALL(self, 12);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+wuffs_base__io_buffer u_r = wuffs_base__empty_io_buffer();
+wuffs_base__io_buffer* v_r = &u_r;
+const uint8_t* iop_v_r WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+const uint8_t* io0_v_r WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+const uint8_t* io1_v_r WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+const uint8_t* io2_v_r WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+wuffs_base__io_buffer u_w = wuffs_base__empty_io_buffer();
+wuffs_base__io_buffer* v_w = &u_w;
+uint8_t* iop_v_w WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+uint8_t* io0_v_w WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+uint8_t* io1_v_w WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+uint8_t* io2_v_w WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+uint64_t v_mark = 0;
+uint64_t v_n = 0;
+wuffs_base__slice_u8 v_compressed = {0};
+wuffs_base__status v_zlib_status = wuffs_base__make_status(NULL);
+bool v_zlib_done = false;
+uint32_t v_checksum_have = 0;
+uint32_t v_checksum_want = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_idats[0];
+if (coro_susp_point) {
+v_n = self->private_data.s_decode_idats[0].v_n;
+v_zlib_done = self->private_data.s_decode_idats[0].v_zlib_done;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+self->private_impl.f_workbuf_wi = 0;
+while (true) {
+self->private_impl.f_chunk_type = 1413563465;
+wuffs_png__decoder__start_checksum(self);
+label__0__continue:;
+while (self->private_impl.f_chunk_length > 0) {
+v_n = ((uint64_t)(io2_a_src - iop_a_src));
+if (v_n <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+goto label__0__continue;
+} else if (v_n > ((uint64_t)(self->private_impl.f_chunk_length))) {
+v_n = ((uint64_t)(self->private_impl.f_chunk_length));
+}
+self->private_impl.f_chunk_length -= ((uint32_t)((v_n & 4294967295)));
+v_compressed = wuffs_base__io_reader__take(&iop_a_src, io2_a_src,v_n);
+if ( ! self->private_impl.f_ignore_checksum) {
+wuffs_crc32__ieee_hasher__update_u32(&self->private_data.f_crc32,v_compressed);
+}
+if (v_zlib_done) {
+goto label__0__continue;
+}
+if ((self->private_impl.f_workbuf_wi > self->private_impl.f_workbuf_length) || (self->private_impl.f_workbuf_length > ((uint64_t)(a_workbuf.len)))) {
+status = wuffs_base__make_status(wuffs_png__error__internal_error_inconsistent_workbuf_length);goto exit;}
+{
+wuffs_base__io_buffer* o_0_v_r = v_r;
+const uint8_t *o_0_iop_v_r = iop_v_r;
+const uint8_t *o_0_io0_v_r = io0_v_r;
+const uint8_t *o_0_io1_v_r = io1_v_r;
+const uint8_t *o_0_io2_v_r = io2_v_r;
+v_r = wuffs_base__io_reader__set(&u_r, &iop_v_r, &io0_v_r, &io1_v_r, &io2_v_r,v_compressed);
+{
+wuffs_base__io_buffer* o_1_v_w = v_w;
+uint8_t *o_1_iop_v_w = iop_v_w;
+uint8_t *o_1_io0_v_w = io0_v_w;
+uint8_t *o_1_io1_v_w = io1_v_w;
+uint8_t *o_1_io2_v_w = io2_v_w;
+v_w = wuffs_base__io_writer__set(&u_w, &iop_v_w, &io0_v_w, &io1_v_w, &io2_v_w,wuffs_base__slice_u8__subslice_ij(a_workbuf,self->private_impl.f_workbuf_wi,self->private_impl.f_workbuf_length));
+v_mark = ((uint64_t)(iop_v_w - io0_v_w));
+{
+u_w.meta.wi = ((size_t)(iop_v_w - u_w.data.ptr));
+u_r.meta.ri = ((size_t)(iop_v_r - u_r.data.ptr));
+wuffs_base__status t_0 = wuffs_zlib__decoder__transform_io(&self->private_data.f_zlib,v_w,v_r,wuffs_base__utility__empty_slice_u8());
+iop_v_w = u_w.data.ptr + u_w.meta.wi;
+iop_v_r = u_r.data.ptr + u_r.meta.ri;
+v_zlib_status = t_0;
+}
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_workbuf_wi,wuffs_base__io__count_since(v_mark, ((uint64_t)(iop_v_w - io0_v_w))));
+v_w = o_1_v_w;
+iop_v_w = o_1_iop_v_w;
+io0_v_w = o_1_io0_v_w;
+io1_v_w = o_1_io1_v_w;
+io2_v_w = o_1_io2_v_w;
+}
+v_r = o_0_v_r;
+iop_v_r = o_0_iop_v_r;
+io0_v_r = o_0_io0_v_r;
+io1_v_r = o_0_io1_v_r;
+io2_v_r = o_0_io2_v_r;
+}
+if (wuffs_base__status__is_ok(&v_zlib_status)) {
+v_zlib_done = true;
+} else if (v_zlib_status.repr == wuffs_base__make_status(wuffs_base__suspension__short_write).repr) {
+v_zlib_done = true;
+} else if (v_zlib_status.repr != wuffs_base__make_status(wuffs_base__suspension__short_read).repr) {
+status = v_zlib_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_1 =wuffs_base__load_u32be__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_idats[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_idats[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_1);if (num_bits_1 == 24) { t_1 = ((uint32_t)(*scratch >> 32));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1));}}
+v_checksum_want = t_1;
+}
+if ( ! self->private_impl.f_ignore_checksum) {
+v_checksum_have = wuffs_crc32__ieee_hasher__update_u32(&self->private_data.f_crc32,wuffs_base__utility__empty_slice_u8());
+if (v_checksum_have != v_checksum_want) {
+status = wuffs_base__make_status(wuffs_png__error__bad_checksum);goto exit;}
+}
+if (v_zlib_done) {
+goto label__1__break;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+uint32_t t_2;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_2 =wuffs_base__load_u32be__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_idats[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_idats[0].scratch;uint32_t num_bits_2 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_2);if (num_bits_2 == 24) { t_2 = ((uint32_t)(*scratch >> 32));break;}num_bits_2 += 8;*scratch |= ((uint64_t)(num_bits_2));}}
+self->private_impl.f_chunk_length = t_2;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+uint32_t t_3;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_3 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_idats[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_idats[0].scratch;uint32_t num_bits_3 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_3;if (num_bits_3 == 24) { t_3 = ((uint32_t)(*scratch));break;}num_bits_3 += 8;*scratch |= ((uint64_t)(num_bits_3)) << 56;}}
+self->private_impl.f_chunk_type = t_3;
+}
+if (self->private_impl.f_chunk_length > 2147483647) {
+status = wuffs_base__make_status(wuffs_png__error__bad_chunk);goto exit;} else if (self->private_impl.f_chunk_type != 1413563465) {
+goto label__1__break;
+}
+}
+label__1__break:;
+if (self->private_impl.f_workbuf_wi != self->private_impl.f_workbuf_length) {
+status = wuffs_base__make_status(wuffs_base__error__not_enough_data);goto exit;}
+
+goto ok;ok:self->private_impl.p_decode_idats[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_idats[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_idats[0].v_n = v_n;
+self->private_data.s_decode_idats[0].v_zlib_done = v_zlib_done;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func png.decoder.filter_and_swizzle
+
+static wuffs_base__status//
+wuffs_png__decoder__filter_and_swizzle(wuffs_png__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__slice_u8 a_workbuf){
+WUFFS_BASE__STATS__CALL(self, 13);
+
+uint64_t v_row_length = 0;
+uint64_t v_i = 0;
+wuffs_base__slice_u8 v_curr = {0};
+wuffs_base__slice_u8 v_prev = {0};
+uint8_t v_filter = 0;
+
+v_row_length = (1 + self->private_impl.f_pass_bytes_per_row);
+v_i = (((uint64_t)(self->private_impl.f_dst_y)) * v_row_length);
+if (v_i > ((uint64_t)(a_workbuf.len))) {
+return wuffs_base__make_status(wuffs_png__error__internal_error_inconsistent_workbuf_length);}
+v_curr = wuffs_base__slice_u8__subslice_i(a_workbuf,v_i);
+if (v_row_length > ((uint64_t)(v_curr.len))) {
+return wuffs_base__make_status(wuffs_png__error__internal_error_inconsistent_workbuf_length);}
+v_curr = wuffs_base__slice_u8__subslice_j(v_curr,v_row_length);
+if (((uint64_t)(v_curr.len)) <= 0) {
+return wuffs_base__make_status(wuffs_png__error__internal_error_inconsistent_workbuf_length);}
+v_filter = v_curr.ptr[0];
+v_curr = wuffs_base__slice_u8__subslice_i(v_curr,1);
+v_prev = wuffs_base__utility__empty_slice_u8();
+if (self->private_impl.f_dst_y > 0) {
+v_prev = wuffs_base__slice_u8__suffix(wuffs_base__slice_u8__subslice_j(a_workbuf,v_i),self->private_impl.f_pass_bytes_per_row);
+}
+if (v_filter == 0) {
+} else if (v_filter == 1) {
+wuffs_png__decoder__filter_1(self,v_curr);
+} else if (v_filter == 2) {
+wuffs_png__decoder__filter_2(self,v_curr,v_prev);
+} else if (v_filter == 3) {
+wuffs_png__decoder__filter_3(self,v_curr,v_prev);
+} else if (v_filter == 4) {
+wuffs_png__decoder__filter_4(self,v_curr,v_prev);
+} else {
+return wuffs_base__make_status(wuffs_png__error__bad_filter);}
+if ((self->private_impl.f_dst_y >= self->private_impl.f_crop_y0) && (((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) & ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1)) == 0)) {
+wuffs_png__decoder__swizzle_row(self,a_dst,v_curr);
+}
+return wuffs_base__make_status(NULL);}
+
+// -------- func png.decoder.filter_1
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__filter_1(wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr){
+WUFFS_BASE__STATS__CALL(self, 14);
+
+uint64_t v_filter_distance = 0;
+uint64_t v_i_start = 0;
+uint64_t v_i = 0;
+uint8_t v_fa = 0;
+
+v_filter_distance = ((uint64_t)(self->private_impl.f_filter_distance));
+if (self->private_impl.f_have_x86_sse42 && (v_filter_distance == 4)) {
+wuffs_base__utility__png_filter_1_distance_4_x86_sse42(a_curr);
+return wuffs_base__make_empty_struct();}
+while (v_i_start < v_filter_distance) {
+v_fa = 0;
+v_i = v_i_start;
+while (v_i < ((uint64_t)(a_curr.len))) {
+v_fa += a_curr.ptr[v_i];
+a_curr.ptr[v_i] = v_fa;
+v_i += v_filter_distance;
+}
+v_i_start += 1;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func png.decoder.filter_2
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__filter_2(wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr,wuffs_base__slice_u8 a_prev){
+WUFFS_BASE__STATS__CALL(self, 15);
+
+uint64_t v_i = 0;
+
+while ((v_i < ((uint64_t)(a_curr.len))) && (v_i < ((uint64_t)(a_prev.len)))) {
+a_curr.ptr[v_i] += a_prev.ptr[v_i];
+v_i += 1;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func png.decoder.filter_3
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__filter_3(wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr,wuffs_base__slice_u8 a_prev){
+WUFFS_BASE__STATS__CALL(self, 16);
+
+uint64_t v_filter_distance = 0;
+uint64_t v_i_start = 0;
+uint64_t v_i = 0;
+uint8_t v_fa = 0;
+
+v_filter_distance = ((uint64_t)(self->private_impl.f_filter_distance));
+if (self->private_impl.f_have_x86_sse42 && (((uint64_t)(a_prev.len)) >= ((uint64_t)(a_curr.len)))) {
+if (v_filter_distance == 3) {
+wuffs_base__utility__png_filter_3_distance_3_x86_sse42(a_curr,a_prev);
+return wuffs_base__make_empty_struct();} else if (v_filter_distance == 4) {
+wuffs_base__utility__png_filter_3_distance_4_x86_sse42(a_curr,a_prev);
+return wuffs_base__make_empty_struct();}
+}
+while (v_i_start < v_filter_distance) {
+v_fa = 0;
+v_i = v_i_start;
+if (((uint64_t)(a_prev.len)) == 0) {
+while (v_i < ((uint64_t)(a_curr.len))) {
+v_fa = (a_curr.ptr[v_i] + (v_fa / 2));
+a_curr.ptr[v_i] = v_fa;
+v_i += v_filter_distance;
+}
+} else {
+while ((v_i < ((uint64_t)(a_curr.len))) && (v_i < ((uint64_t)(a_prev.len)))) {
+v_fa = (a_curr.ptr[v_i] + ((uint8_t)(((((uint32_t)(v_fa)) + ((uint32_t)(a_prev.ptr[v_i]))) / 2))));
+a_curr.ptr[v_i] = v_fa;
+v_i += v_filter_distance;
+}
+}
+v_i_start += 1;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func png.decoder.filter_4
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__filter_4(wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr,wuffs_base__slice_u8 a_prev){
+WUFFS_BASE__STATS__CALL(self, 17);
+
+uint64_t v_filter_distance = 0;
+uint64_t v_i_start = 0;
+uint64_t v_i = 0;
+uint8_t v_fa = 0;
+uint8_t v_fb = 0;
+uint8_t v_fc = 0;
+uint32_t v_p = 0;
+uint32_t v_pa = 0;
+uint32_t v_pb = 0;
+uint32_t v_pc = 0;
+
+if (((uint64_t)(a_prev.len)) == 0) {
+wuffs_png__decoder__filter_1(self,a_curr);
+return wuffs_base__make_empty_struct();}
+v_filter_distance = ((uint64_t)(self->private_impl.f_filter_distance));
+if (self->private_impl.f_have_x86_sse42 && (((uint64_t)(a_prev.len)) >= ((uint64_t)(a_curr.len)))) {
+if (v_filter_distance == 3) {
+wuffs_base__utility__png_filter_4_distance_3_x86_sse42(a_curr,a_prev);
+return wuffs_base__make_empty_struct();} else if (v_filter_distance == 4) {
+wuffs_base__utility__png_filter_4_distance_4_x86_sse42(a_curr,a_prev);
+return wuffs_base__make_empty_struct();}
+}
+while (v_i_start < v_filter_distance) {
+v_fa = 0;
+v_fc = 0;
+v_i = v_i_start;
+while ((v_i < ((uint64_t)(a_curr.len))) && (v_i < ((uint64_t)(a_prev.len)))) {
+v_fb = a_prev.ptr[v_i];
+v_p = ((((uint32_t)(v_fa)) + ((uint32_t)(v_fb))) - ((uint32_t)(v_fc)));
+v_pa = (v_p - ((uint32_t)(v_fa)));
+if (v_pa >= 2147483648) {
+v_pa = (0 - v_pa);
+}
+v_pb = (v_p - ((uint32_t)(v_fb)));
+if (v_pb >= 2147483648) {
+v_pb = (0 - v_pb);
+}
+v_pc = (v_p - ((uint32_t)(v_fc)));
+if (v_pc >= 2147483648) {
+v_pc = (0 - v_pc);
+}
+if ((v_pa <= v_pb) && (v_pa <= v_pc)) {
+} else if (v_pb <= v_pc) {
+v_fa = v_fb;
+} else {
+v_fa = v_fc;
+}
+v_fa += a_curr.ptr[v_i];
+a_curr.ptr[v_i] = v_fa;
+v_fc = v_fb;
+v_i += v_filter_distance;
+}
+v_i_start += 1;
+}
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func png.decoder.swizzle_row
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__swizzle_row(wuffs_png__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__slice_u8 a_curr){
+WUFFS_BASE__STATS__CALL(self, 18);
+
+wuffs_base__pixel_format v_dst_pixfmt = {0};
+uint32_t v_dst_bits_per_pixel = 0;
+uint64_t v_dst_bytes_per_pixel = 0;
+wuffs_base__table_u8 v_tab = {0};
+wuffs_base__slice_u8 v_dst = {0};
+wuffs_base__slice_u8 v_src = {0};
+uint32_t v_x = 0;
+uint32_t v_n = 0;
+uint64_t v_i = 0;
+
+v_dst_pixfmt = wuffs_base__pixel_buffer__pixel_format(a_dst);
+v_dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(&v_dst_pixfmt);
+v_dst_bytes_per_pixel = ((uint64_t)((v_dst_bits_per_pixel / 8)));
+v_tab = wuffs_base__pixel_buffer__plane(a_dst,0);
+v_dst = wuffs_base__table_u8__row(v_tab,(((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) >> self->private_impl.f_scale_shift) - self->private_impl.f_band_y0));
+if (self->private_impl.f_direct && (self->private_impl.f_scale_shift == 0)) {
+v_src = a_curr;
+if (((uint64_t)(self->private_impl.f_crop_x1)) <= ((uint64_t)(v_src.len))) {
+v_src = wuffs_base__slice_u8__subslice_j(v_src,((uint64_t)(self->private_impl.f_crop_x1)));
+}
+if (((uint64_t)(self->private_impl.f_crop_x0)) <= ((uint64_t)(v_src.len))) {
+v_src = wuffs_base__slice_u8__subslice_i(v_src,((uint64_t)(self->private_impl.f_crop_x0)));
+}
+wuffs_base__pixel_swizzler__swizzle_interleaved(&self->private_impl.f_swizzler,v_dst,wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024),v_src);
+return wuffs_base__make_empty_struct();}
+v_x = self->private_impl.f_crop_x0;
+while (v_x < self->private_impl.f_crop_x1) {
+v_n = wuffs_png__decoder__convert_pixels(self,a_curr,v_x);
+if (v_n <= 0) {
+goto label__0__break;
+}
+v_i = (((uint64_t)(v_n)) * ((uint64_t)(self->private_impl.f_src_bytes_per_pixel)));
+wuffs_base__pixel_swizzler__swizzle_interleaved(&self->private_impl.f_swizzler,v_dst,wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024),wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_data.f_scratch, 4096),v_i));
+v_i = (((uint64_t)(v_n)) * v_dst_bytes_per_pixel);
+if (v_i > ((uint64_t)(v_dst.len))) {
+goto label__0__break;
+}
+v_dst = wuffs_base__slice_u8__subslice_i(v_dst,v_i);
+wuffs_base__u32__sat_add_indirect(&v_x,(v_n << self->private_impl.f_scale_shift));
+}
+label__0__break:;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func png.decoder.convert_pixels
+
+static uint32_t//
+wuffs_png__decoder__convert_pixels(wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr,uint32_t a_x){
+WUFFS_BASE__STATS__CALL(self, 19);
+
+uint32_t v_n = 0;
+uint64_t v_o = 0;
+wuffs_base__slice_u8 v_p = {0};
+uint32_t v_j = 0;
+uint32_t v_c0 = 0;
+uint32_t v_c1 = 0;
+uint32_t v_c2 = 0;
+uint32_t v_c3 = 0;
+uint8_t v_alpha = 0;
+
+label__0__continue:;
+while ((v_n < 1024) && (a_x < self->private_impl.f_crop_x1)) {
+v_j = (4 * v_n);
+if (self->private_impl.f_depth == 8) {
+if ((self->private_impl.f_color_type == 2) &&  ! self->private_impl.f_have_trns) {
+v_o = (((uint64_t)(a_x)) * 3);
+if (v_o > ((uint64_t)(a_curr.len))) {
+goto label__0__break;
+}
+v_p = wuffs_base__slice_u8__subslice_i(a_curr,v_o);
+if (((uint64_t)(v_p.len)) < 3) {
+goto label__0__break;
+}
+v_j = (3 * v_n);
+self->private_data.f_scratch[(v_j + 0)] = v_p.ptr[2];
+self->private_data.f_scratch[(v_j + 1)] = v_p.ptr[1];
+self->private_data.f_scratch[(v_j + 2)] = v_p.ptr[0];
+v_n += 1;
+wuffs_base__u32__sat_add_indirect(&a_x,(((uint32_t)(1)) << self->private_impl.f_scale_shift));
+goto label__0__continue;
+} else if (self->private_impl.f_color_type == 6) {
+v_o = (((uint64_t)(a_x)) * 4);
+if (v_o > ((uint64_t)(a_curr.len))) {
+goto label__0__break;
+}
+v_p = wuffs_base__slice_u8__subslice_i(a_curr,v_o);
+if (((uint64_t)(v_p.len)) < 4) {
+goto label__0__break;
+}
+self->private_data.f_scratch[(v_j + 0)] = v_p.ptr[2];
+self->private_data.f_scratch[(v_j + 1)] = v_p.ptr[1];
+self->private_data.f_scratch[(v_j + 2)] = v_p.ptr[0];
+self->private_data.f_scratch[(v_j + 3)] = v_p.ptr[3];
+v_n += 1;
+wuffs_base__u32__sat_add_indirect(&a_x,(((uint32_t)(1)) << self->private_impl.f_scale_shift));
+goto label__0__continue;
+}
+}
+v_c0 = wuffs_png__decoder__sample(self,a_curr,a_x,0);
+if ((self->private_impl.f_color_type == 0) || (self->private_impl.f_color_type == 3)) {
+if (self->private_impl.f_src_bytes_per_pixel == 1) {
+self->private_data.f_scratch[(v_j / 4)] = wuffs_png__decoder__sample_to_u8(self,v_c0);
+} else if (self->private_impl.f_color_type == 3) {
+self->private_data.f_scratch[(v_j + 0)] = self->private_data.f_src_palette[(((v_c0 & 255) * 4) + 0)];
+self->private_data.f_scratch[(v_j + 1)] = self->private_data.f_src_palette[(((v_c0 & 255) * 4) + 1)];
+self->private_data.f_scratch[(v_j + 2)] = self->private_data.f_src_palette[(((v_c0 & 255) * 4) + 2)];
+self->private_data.f_scratch[(v_j + 3)] = self->private_data.f_src_palette[(((v_c0 & 255) * 4) + 3)];
+} else {
+v_alpha = 255;
+if (self->private_impl.f_trns_key == ((uint64_t)(v_c0))) {
+v_alpha = 0;
+}
+self->private_data.f_scratch[(v_j + 0)] = wuffs_png__decoder__sample_to_u8(self,v_c0);
+self->private_data.f_scratch[(v_j + 1)] = wuffs_png__decoder__sample_to_u8(self,v_c0);
+self->private_data.f_scratch[(v_j + 2)] = wuffs_png__decoder__sample_to_u8(self,v_c0);
+self->private_data.f_scratch[(v_j + 3)] = v_alpha;
+}
+} else if (self->private_impl.f_color_type == 4) {
+v_c1 = wuffs_png__decoder__sample(self,a_curr,a_x,1);
+self->private_data.f_scratch[(v_j + 0)] = wuffs_png__decoder__sample_to_u8(self,v_c0);
+self->private_data.f_scratch[(v_j + 1)] = wuffs_png__decoder__sample_to_u8(self,v_c0);
+self->private_data.f_scratch[(v_j + 2)] = wuffs_png__decoder__sample_to_u8(self,v_c0);
+self->private_data.f_scratch[(v_j + 3)] = wuffs_png__decoder__sample_to_u8(self,v_c1);
+} else {
+v_c1 = wuffs_png__decoder__sample(self,a_curr,a_x,1);
+v_c2 = wuffs_png__decoder__sample(self,a_curr,a_x,2);
+if (self->private_impl.f_color_type == 6) {
+v_c3 = wuffs_png__decoder__sample(self,a_curr,a_x,3);
+v_alpha = wuffs_png__decoder__sample_to_u8(self,v_c3);
+} else {
+v_alpha = 255;
+if (self->private_impl.f_trns_key == ((((uint64_t)(v_c0)) << 32) | (((uint64_t)(v_c1)) << 16) | ((uint64_t)(v_c2)))) {
+v_alpha = 0;
+}
+}
+if (self->private_impl.f_src_bytes_per_pixel == 3) {
+v_j = (3 * v_n);
+self->private_data.f_scratch[(v_j + 0)] = wuffs_png__decoder__sample_to_u8(self,v_c2);
+self->private_data.f_scratch[(v_j + 1)] = wuffs_png__decoder__sample_to_u8(self,v_c1);
+self->private_data.f_scratch[(v_j + 2)] = wuffs_png__decoder__sample_to_u8(self,v_c0);
+} else {
+self->private_data.f_scratch[(v_j + 0)] = wuffs_png__decoder__sample_to_u8(self,v_c2);
+self->private_data.f_scratch[(v_j + 1)] = wuffs_png__decoder__sample_to_u8(self,v_c1);
+self->private_data.f_scratch[(v_j + 2)] = wuffs_png__decoder__sample_to_u8(self,v_c0);
+self->private_data.f_scratch[(v_j + 3)] = v_alpha;
+}
+}
+v_n += 1;
+wuffs_base__u32__sat_add_indirect(&a_x,(((uint32_t)(1)) << self->private_impl.f_scale_shift));
+}
+label__0__break:;
+return v_n;}
+
+// -------- func png.decoder.sample
+
+static uint32_t//
+wuffs_png__decoder__sample(const wuffs_png__decoder *self,wuffs_base__slice_u8 a_curr,uint32_t a_x,uint32_t a_c){
+
+uint64_t v_bit_offset = 0;
+uint64_t v_o = 0;
+wuffs_base__slice_u8 v_p = {0};
+uint32_t v_s = 0;
+uint32_t v_v = 0;
+
+v_bit_offset = (((((uint64_t)(a_x)) * ((uint64_t)(WUFFS_PNG__NUM_CHANNELS[self->private_impl.f_color_type]))) + ((uint64_t)(a_c))) * ((uint64_t)(self->private_impl.f_depth)));
+v_o = (v_bit_offset / 8);
+if (v_o >= ((uint64_t)(a_curr.len))) {
+return 0;} else if (self->private_impl.f_depth == 16) {
+v_p = wuffs_base__slice_u8__subslice_i(a_curr,v_o);
+if (((uint64_t)(v_p.len)) >= 2) {
+return ((((uint32_t)(v_p.ptr[0])) << 8) | ((uint32_t)(v_p.ptr[1])));}
+return 0;}
+v_v = ((uint32_t)(a_curr.ptr[v_o]));
+if (self->private_impl.f_depth < 8) {
+v_s = (((8 - ((uint32_t)(self->private_impl.f_depth))) - ((uint32_t)((v_bit_offset & 7)))) & 7);
+v_v = ((v_v >> v_s) & ((((uint32_t)(1)) << self->private_impl.f_depth) - 1));
+}
+return v_v;}
+
+// -------- func png.decoder.sample_to_u8
+
+static uint8_t//
+wuffs_png__decoder__sample_to_u8(const wuffs_png__decoder *self,uint32_t a_s){
+
+
+if (self->private_impl.f_depth == 16) {
+return ((uint8_t)(((a_s >> 8) & 255)));} else if ((self->private_impl.f_depth < 8) && (self->private_impl.f_color_type == 0)) {
+return (((uint8_t)((a_s & 255))) * WUFFS_PNG__LOW_BIT_DEPTH_MULTIPLIERS[(self->private_impl.f_depth & 7)]);}
+return ((uint8_t)((a_s & 255)));}
+
+// -------- func png.decoder.band_is_done
+
+static bool//
+wuffs_png__decoder__band_is_done(const wuffs_png__decoder *self){
+
+uint32_t v_mask = 0;
+
+if ((self->private_impl.f_band_height == 0) || (self->private_impl.f_dst_y < self->private_impl.f_crop_y0) || (self->private_impl.f_crop_y1 <= self->private_impl.f_dst_y)) {
+return false;}
+v_mask = ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1);
+if (((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) & v_mask) != 0) {
+return false;}
+return (((self->private_impl.f_dst_y - self->private_impl.f_crop_y0) >> self->private_impl.f_scale_shift) >= self->private_impl.f_band_y1);}
+
+// -------- func png.decoder.next_band
+
+static wuffs_base__empty_struct //
+wuffs_png__decoder__next_band(wuffs_png__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 20);
+
+
+self->private_impl.f_band_y0 = self->private_impl.f_band_y1;
+self->private_impl.f_band_y1 = wuffs_base__u32__min(self->private_impl.f_dst_rect_y1,wuffs_base__u32__sat_add(self->private_impl.f_band_y0,self->private_impl.f_band_height));
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func png.decoder.skip_frame
+
+static wuffs_base__status //
+wuffs_png__decoder__skip_frame(wuffs_png__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 21);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_skip_frame[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+self->private_impl.f_chunk_length = self->private_impl.f_first_idat_length;
+while (true) {
+self->private_data.s_skip_frame[0].scratch = self->private_impl.f_chunk_length;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (self->private_data.s_skip_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_skip_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_skip_frame[0].scratch;
+self->private_data.s_skip_frame[0].scratch = 4;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (self->private_data.s_skip_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_skip_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_skip_frame[0].scratch;
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+uint32_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_0 =wuffs_base__load_u32be__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_skip_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_skip_frame[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_0);if (num_bits_0 == 24) { t_0 = ((uint32_t)(*scratch >> 32));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0));}}
+self->private_impl.f_chunk_length = t_0;
+}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_1 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_skip_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_skip_frame[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;if (num_bits_1 == 24) { t_1 = ((uint32_t)(*scratch));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1)) << 56;}}
+self->private_impl.f_chunk_type = t_1;
+}
+if (self->private_impl.f_chunk_type != 1413563465) {
+goto label__0__break;
+}
+}
+label__0__break:;
+self->private_impl.f_call_sequence = 3;
+
+goto ok;ok:self->private_impl.p_skip_frame[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_skip_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func png.decoder.frame_dirty_rect
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_png__decoder__frame_dirty_rect(const wuffs_png__decoder *self){
+if (!self) { return wuffs_base__utility__empty_rect_ie_u32();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_rect_ie_u32();}
+
+uint32_t v_m = 0;
+
+v_m = ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1);
+return wuffs_base__utility__make_rect_ie_u32(0,self->private_impl.f_band_y0,(wuffs_base__u32__sat_add((self->private_impl.f_crop_x1 - self->private_impl.f_crop_x0),v_m) >> self->private_impl.f_scale_shift),self->private_impl.f_band_y1);}
+
+// -------- func png.decoder.num_animation_loops
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_png__decoder__num_animation_loops(const wuffs_png__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+return 0;}
+
+// -------- func png.decoder.num_decoded_frame_configs
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_png__decoder__num_decoded_frame_configs(const wuffs_png__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+if (self->private_impl.f_call_sequence > 1) {
+return 1;}
+return 0;}
+
+// -------- func png.decoder.num_decoded_frames
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_png__decoder__num_decoded_frames(const wuffs_png__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+if (self->private_impl.f_call_sequence > 2) {
+return 1;}
+return 0;}
+
+// -------- func png.decoder.restart_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_png__decoder__restart_frame(wuffs_png__decoder *self,uint64_t a_index,uint64_t a_io_position){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+WUFFS_BASE__STATS__CALL(self, 22);
+
+
+if (self->private_impl.f_call_sequence == 0) {
+return wuffs_base__make_status(wuffs_base__error__bad_call_sequence);}
+if (a_index != 0) {
+return wuffs_base__make_status(wuffs_base__error__bad_argument);}
+self->private_impl.f_call_sequence = 1;
+self->private_impl.f_frame_config_io_position = a_io_position;
+return wuffs_base__make_status(NULL);}
+
+// -------- func png.decoder.set_report_metadata
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_png__decoder__set_report_metadata(wuffs_png__decoder *self,uint32_t a_fourcc,bool a_report){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func png.decoder.tell_me_more
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_png__decoder__tell_me_more(wuffs_png__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 4)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 24);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+status = wuffs_base__make_status(wuffs_base__error__no_more_information);goto exit;
+goto ok;ok:goto exit;exit:if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func png.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_png__decoder__workbuf_len(const wuffs_png__decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__make_range_ii_u64(self->private_impl.f_workbuf_length,self->private_impl.f_workbuf_length);}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__PNG)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__PNG
+
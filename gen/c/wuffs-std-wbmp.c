@@ -0,0 +1,913 @@
+#ifndef WUFFS_INCLUDE_GUARD__WBMP
+#define WUFFS_INCLUDE_GUARD__WBMP
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__WBMP
+#endif
+
+#include "./wuffs-base.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+extern const char* wuffs_wbmp__error__bad_header;
+
+// ---------------- Public Consts
+
+#define WUFFS_WBMP__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 0
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_wbmp__decoder__struct wuffs_wbmp__decoder;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_wbmp__decoder__initialize(wuffs_wbmp__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_wbmp__decoder();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_wbmp__decoder*  //
+wuffs_wbmp__decoder__alloc();
+
+static inline wuffs_base__image_decoder*  //
+wuffs_wbmp__decoder__alloc_as__wuffs_base__image_decoder(){
+return (wuffs_base__image_decoder*)(wuffs_wbmp__decoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__image_decoder*  //
+wuffs_wbmp__decoder__upcast_as__wuffs_base__image_decoder(wuffs_wbmp__decoder* p){
+return (wuffs_base__image_decoder*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_WBMP__DECODER__STATS__FUNC__SET_QUIRK_ENABLED 0
+#define WUFFS_WBMP__DECODER__STATS__FUNC__DECODE_IMAGE_CONFIG 1
+#define WUFFS_WBMP__DECODER__STATS__FUNC__DECODE_FRAME_CONFIG 2
+#define WUFFS_WBMP__DECODER__STATS__FUNC__DECODE_FRAME 3
+#define WUFFS_WBMP__DECODER__STATS__FUNC__SKIP_FRAME 4
+#define WUFFS_WBMP__DECODER__STATS__FUNC__RESTART_FRAME 5
+#define WUFFS_WBMP__DECODER__STATS__FUNC__SET_REPORT_METADATA 6
+#define WUFFS_WBMP__DECODER__STATS__FUNC__TELL_ME_MORE 7
+
+typedef struct wuffs_wbmp__decoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[8];
+} wuffs_wbmp__decoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_wbmp__decoder__stats  //
+wuffs_wbmp__decoder__get_stats(const wuffs_wbmp__decoder* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_wbmp__decoder__set_quirk_enabled(wuffs_wbmp__decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_wbmp__decoder__decode_image_config(wuffs_wbmp__decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_wbmp__decoder__decode_frame_config(wuffs_wbmp__decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_wbmp__decoder__decode_frame(wuffs_wbmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_wbmp__decoder__frame_dirty_rect(const wuffs_wbmp__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_wbmp__decoder__num_animation_loops(const wuffs_wbmp__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_wbmp__decoder__num_decoded_frame_configs(const wuffs_wbmp__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_wbmp__decoder__num_decoded_frames(const wuffs_wbmp__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_wbmp__decoder__restart_frame(wuffs_wbmp__decoder *self,uint64_t a_index,uint64_t a_io_position);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_wbmp__decoder__set_report_metadata(wuffs_wbmp__decoder *self,uint32_t a_fourcc,bool a_report);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_wbmp__decoder__tell_me_more(wuffs_wbmp__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_wbmp__decoder__workbuf_len(const wuffs_wbmp__decoder *self);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_wbmp__decoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__image_decoder;
+wuffs_base__vtable null_vtable;
+
+uint32_t f_width;
+uint32_t f_height;
+uint8_t f_call_sequence;
+uint64_t f_frame_config_io_position;
+uint32_t f_scale_shift;
+uint32_t f_crop_x0;
+uint32_t f_crop_y0;
+uint32_t f_crop_x1;
+uint32_t f_crop_y1;
+uint32_t f_band_height;
+uint32_t f_band_y0;
+uint32_t f_band_y1;
+wuffs_base__pixel_swizzler f_swizzler;
+
+uint32_t p_decode_image_config[1];
+uint32_t p_decode_frame_config[1];
+uint32_t p_decode_frame[1];
+uint32_t p_skip_frame[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_wbmp__decoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+struct {
+uint32_t v_i;
+uint32_t v_x32;
+} s_decode_image_config[1];
+struct {
+uint64_t v_dst_bytes_per_pixel;
+uint64_t v_bytes_per_row;
+uint32_t v_mask;
+uint32_t v_dst_x;
+uint32_t v_dst_y;
+uint32_t v_dst_h;
+uint8_t v_src[1];
+uint8_t v_c;
+uint64_t scratch;
+} s_decode_frame[1];
+struct {
+uint64_t scratch;
+} s_skip_frame[1];
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_wbmp__decoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_wbmp__decoder__alloc(), &free);
+}
+
+static inline wuffs_base__image_decoder::unique_ptr  //
+alloc_as__wuffs_base__image_decoder(){
+return wuffs_base__image_decoder::unique_ptr(wuffs_wbmp__decoder__alloc_as__wuffs_base__image_decoder(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_wbmp__decoder__struct() = delete;
+wuffs_wbmp__decoder__struct(const wuffs_wbmp__decoder__struct&) = delete;
+wuffs_wbmp__decoder__struct& operator=(const wuffs_wbmp__decoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_wbmp__decoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__image_decoder*  //
+upcast_as__wuffs_base__image_decoder(){
+return (wuffs_base__image_decoder*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_wbmp__decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__status //
+decode_image_config(wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_wbmp__decoder__decode_image_config(this,a_dst,a_src);}
+
+inline wuffs_base__status //
+decode_frame_config(wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){ return wuffs_wbmp__decoder__decode_frame_config(this,a_dst,a_src);}
+
+inline wuffs_base__status //
+decode_frame(wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){ return wuffs_wbmp__decoder__decode_frame(this,a_dst,a_src,a_blend,a_workbuf,a_opts);}
+
+inline wuffs_base__rect_ie_u32//
+frame_dirty_rect() const { return wuffs_wbmp__decoder__frame_dirty_rect(this);}
+
+inline uint32_t//
+num_animation_loops() const { return wuffs_wbmp__decoder__num_animation_loops(this);}
+
+inline uint64_t//
+num_decoded_frame_configs() const { return wuffs_wbmp__decoder__num_decoded_frame_configs(this);}
+
+inline uint64_t//
+num_decoded_frames() const { return wuffs_wbmp__decoder__num_decoded_frames(this);}
+
+inline wuffs_base__status//
+restart_frame(uint64_t a_index,uint64_t a_io_position){ return wuffs_wbmp__decoder__restart_frame(this,a_index,a_io_position);}
+
+inline wuffs_base__empty_struct //
+set_report_metadata(uint32_t a_fourcc,bool a_report){ return wuffs_wbmp__decoder__set_report_metadata(this,a_fourcc,a_report);}
+
+inline wuffs_base__status //
+tell_me_more(wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){ return wuffs_wbmp__decoder__tell_me_more(this,a_dst,a_minfo,a_src);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_wbmp__decoder__workbuf_len(this);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_wbmp__decoder__stats  //
+get_stats() const {
+return wuffs_wbmp__decoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_wbmp__decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__WBMP)
+
+// ---------------- Status Codes Implementations
+
+const char* wuffs_wbmp__error__bad_header = "#wbmp: bad header";
+
+// ---------------- Private Consts
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static wuffs_base__status //
+wuffs_wbmp__decoder__skip_frame(wuffs_wbmp__decoder *self,wuffs_base__io_buffer* a_src);
+
+// ---------------- VTables
+
+const wuffs_base__image_decoder__func_ptrs wuffs_wbmp__decoder__func_ptrs_for__wuffs_base__image_decoder = {(wuffs_base__status (*)(void*,wuffs_base__pixel_buffer*,wuffs_base__io_buffer*,wuffs_base__pixel_blend,wuffs_base__slice_u8,wuffs_base__decode_frame_options*))(&wuffs_wbmp__decoder__decode_frame),
+(wuffs_base__status (*)(void*,wuffs_base__frame_config*,wuffs_base__io_buffer*))(&wuffs_wbmp__decoder__decode_frame_config),
+(wuffs_base__status (*)(void*,wuffs_base__image_config*,wuffs_base__io_buffer*))(&wuffs_wbmp__decoder__decode_image_config),
+(wuffs_base__rect_ie_u32(*)(const void*))(&wuffs_wbmp__decoder__frame_dirty_rect),
+(uint32_t(*)(const void*))(&wuffs_wbmp__decoder__num_animation_loops),
+(uint64_t(*)(const void*))(&wuffs_wbmp__decoder__num_decoded_frame_configs),
+(uint64_t(*)(const void*))(&wuffs_wbmp__decoder__num_decoded_frames),
+(wuffs_base__status(*)(void*,uint64_t,uint64_t))(&wuffs_wbmp__decoder__restart_frame),
+(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_wbmp__decoder__set_quirk_enabled),
+(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_wbmp__decoder__set_report_metadata),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__more_information*,wuffs_base__io_buffer*))(&wuffs_wbmp__decoder__tell_me_more),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_wbmp__decoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_wbmp__decoder__initialize(wuffs_wbmp__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__image_decoder.vtable_name = wuffs_base__image_decoder__vtable_name;
+self->private_impl.vtable_for__wuffs_base__image_decoder.function_pointers = (const void*)(&wuffs_wbmp__decoder__func_ptrs_for__wuffs_base__image_decoder);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_wbmp__decoder*  //
+wuffs_wbmp__decoder__alloc(){
+wuffs_wbmp__decoder* x = (wuffs_wbmp__decoder*)(calloc(sizeof(wuffs_wbmp__decoder), 1));
+if (!x) { return NULL; }
+if (wuffs_wbmp__decoder__initialize(x, sizeof(wuffs_wbmp__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_wbmp__decoder(){ return sizeof(wuffs_wbmp__decoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_wbmp__decoder__stats  //
+wuffs_wbmp__decoder__get_stats(const wuffs_wbmp__decoder* self) {
+wuffs_wbmp__decoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func wbmp.decoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_wbmp__decoder__set_quirk_enabled(wuffs_wbmp__decoder *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func wbmp.decoder.decode_image_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_wbmp__decoder__decode_image_config(wuffs_wbmp__decoder *self,wuffs_base__image_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 1);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint8_t v_c = 0;
+uint32_t v_i = 0;
+uint32_t v_x32 = 0;
+uint64_t v_x64 = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_image_config[0];
+if (coro_susp_point) {
+v_i = self->private_data.s_decode_image_config[0].v_i;
+v_x32 = self->private_data.s_decode_image_config[0].v_x32;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence != 0) {
+status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);goto exit;}
+v_i = 0;
+while (v_i < 2) {
+{
+uint8_t t_0;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_0 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_0 = *iop_a_src++;
+}
+v_c = t_0;
+}
+if (v_c != 0) {
+status = wuffs_base__make_status(wuffs_wbmp__error__bad_header);goto exit;}
+v_i += 1;
+}
+v_i = 0;
+while (v_i < 2) {
+v_x32 = 0;
+while (true) {
+{
+uint8_t t_1;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_1 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_1 = *iop_a_src++;
+}
+v_c = t_1;
+}
+v_x32 |= ((uint32_t)((v_c & 127)));
+if ((v_c >> 7) == 0) {
+goto label__0__break;
+}
+v_x64 = (((uint64_t)(v_x32)) << 7);
+if (v_x64 > 4294967295) {
+status = wuffs_base__make_status(wuffs_wbmp__error__bad_header);goto exit;}
+v_x32 = ((uint32_t)(v_x64));
+}
+label__0__break:;
+if (v_i == 0) {
+self->private_impl.f_width = v_x32;
+} else {
+self->private_impl.f_height = v_x32;
+}
+v_i += 1;
+}
+self->private_impl.f_frame_config_io_position = wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)));
+if (a_dst != NULL) {
+wuffs_base__image_config__set(a_dst,2198077448,0,self->private_impl.f_width,self->private_impl.f_height,self->private_impl.f_frame_config_io_position,true);
+}
+self->private_impl.f_call_sequence = 1;
+
+goto ok;ok:self->private_impl.p_decode_image_config[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_image_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+self->private_data.s_decode_image_config[0].v_i = v_i;
+self->private_data.s_decode_image_config[0].v_x32 = v_x32;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func wbmp.decoder.decode_frame_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_wbmp__decoder__decode_frame_config(wuffs_wbmp__decoder *self,wuffs_base__frame_config* a_dst,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 2)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 2);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_frame_config[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence < 1) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_wbmp__decoder__decode_image_config(self,NULL,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else if (self->private_impl.f_call_sequence == 1) {
+if (self->private_impl.f_frame_config_io_position != wuffs_base__u64__sat_add(a_src->meta.pos, ((uint64_t)(iop_a_src - io0_a_src)))) {
+status = wuffs_base__make_status(wuffs_base__error__bad_restart);goto exit;}
+} else if (self->private_impl.f_call_sequence == 2) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_wbmp__decoder__skip_frame(self,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;} else {
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;}
+if (a_dst != NULL) {
+wuffs_base__frame_config__update(a_dst,wuffs_base__utility__make_rect_ie_u32(0,0,self->private_impl.f_width,self->private_impl.f_height),((wuffs_base__flicks)(0)),0,self->private_impl.f_frame_config_io_position,0,true,false,4278190080);
+}
+self->private_impl.f_call_sequence = 2;
+
+goto ok;ok:self->private_impl.p_decode_frame_config[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_frame_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 2 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func wbmp.decoder.decode_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_wbmp__decoder__decode_frame(wuffs_wbmp__decoder *self,wuffs_base__pixel_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__pixel_blend a_blend,wuffs_base__slice_u8 a_workbuf,wuffs_base__decode_frame_options* a_opts){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 3)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 3);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+wuffs_base__pixel_format v_dst_pixfmt = {0};
+uint32_t v_dst_bits_per_pixel = 0;
+uint64_t v_dst_bytes_per_pixel = 0;
+uint64_t v_dst_x_in_bytes = 0;
+uint64_t v_bytes_per_row = 0;
+uint32_t v_mask = 0;
+uint32_t v_dst_x = 0;
+uint32_t v_dst_y = 0;
+uint32_t v_dst_h = 0;
+wuffs_base__table_u8 v_tab = {0};
+wuffs_base__slice_u8 v_dst = {0};
+uint8_t v_src[1] = {0};
+uint8_t v_c = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_frame[0];
+if (coro_susp_point) {
+v_dst_bytes_per_pixel = self->private_data.s_decode_frame[0].v_dst_bytes_per_pixel;
+v_bytes_per_row = self->private_data.s_decode_frame[0].v_bytes_per_row;
+v_mask = self->private_data.s_decode_frame[0].v_mask;
+v_dst_x = self->private_data.s_decode_frame[0].v_dst_x;
+v_dst_y = self->private_data.s_decode_frame[0].v_dst_y;
+v_dst_h = self->private_data.s_decode_frame[0].v_dst_h;
+memcpy(v_src, self->private_data.s_decode_frame[0].v_src, sizeof(v_src));
+v_c = self->private_data.s_decode_frame[0].v_c;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_call_sequence < 2) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_wbmp__decoder__decode_frame_config(self,NULL,a_src);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+} else if (self->private_impl.f_call_sequence == 2) {
+} else {
+status = wuffs_base__make_status(wuffs_base__note__end_of_data);goto ok;}
+v_status = wuffs_base__pixel_swizzler__prepare(&self->private_impl.f_swizzler,wuffs_base__pixel_buffer__pixel_format(a_dst),wuffs_base__pixel_buffer__palette(a_dst),wuffs_base__utility__make_pixel_format(536870920),wuffs_base__utility__empty_slice_u8(),a_blend);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+v_dst_pixfmt = wuffs_base__pixel_buffer__pixel_format(a_dst);
+v_dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(&v_dst_pixfmt);
+if ((v_dst_bits_per_pixel & 7) != 0) {
+status = wuffs_base__make_status(wuffs_base__error__unsupported_option);goto exit;}
+v_dst_bytes_per_pixel = ((uint64_t)((v_dst_bits_per_pixel / 8)));
+self->private_impl.f_scale_shift = 0;
+self->private_impl.f_crop_x0 = 0;
+self->private_impl.f_crop_y0 = 0;
+self->private_impl.f_crop_x1 = self->private_impl.f_width;
+self->private_impl.f_crop_y1 = self->private_impl.f_height;
+if (a_opts != NULL) {
+self->private_impl.f_scale_shift = wuffs_base__decode_frame_options__scale_shift(a_opts);
+self->private_impl.f_crop_x1 = wuffs_base__u32__min(self->private_impl.f_width,wuffs_base__decode_frame_options__crop_max_excl_x(a_opts));
+self->private_impl.f_crop_y1 = wuffs_base__u32__min(self->private_impl.f_height,wuffs_base__decode_frame_options__crop_max_excl_y(a_opts));
+self->private_impl.f_crop_x0 = wuffs_base__u32__min(self->private_impl.f_crop_x1,wuffs_base__decode_frame_options__crop_min_incl_x(a_opts));
+self->private_impl.f_crop_y0 = wuffs_base__u32__min(self->private_impl.f_crop_y1,wuffs_base__decode_frame_options__crop_min_incl_y(a_opts));
+}
+v_mask = ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1);
+v_dst_h = (wuffs_base__u32__sat_add((self->private_impl.f_crop_y1 - self->private_impl.f_crop_y0),v_mask) >> self->private_impl.f_scale_shift);
+self->private_impl.f_band_height = 0;
+if (a_opts != NULL) {
+self->private_impl.f_band_height = wuffs_base__decode_frame_options__band_height(a_opts);
+}
+self->private_impl.f_band_y0 = 0;
+self->private_impl.f_band_y1 = v_dst_h;
+if (self->private_impl.f_band_height > 0) {
+self->private_impl.f_band_y1 = wuffs_base__u32__min(v_dst_h,self->private_impl.f_band_height);
+}
+if (self->private_impl.f_width > 0) {
+v_bytes_per_row = ((((uint64_t)(self->private_impl.f_width)) + 7) / 8);
+self->private_data.s_decode_frame[0].scratch = (v_bytes_per_row * ((uint64_t)(self->private_impl.f_crop_y0)));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+if (self->private_data.s_decode_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_frame[0].scratch;
+v_tab = wuffs_base__pixel_buffer__plane(a_dst,0);
+v_dst_y = self->private_impl.f_crop_y0;
+label__0__continue:;
+while (v_dst_y < self->private_impl.f_crop_y1) {
+if (((v_dst_y - self->private_impl.f_crop_y0) & v_mask) != 0) {
+self->private_data.s_decode_frame[0].scratch = v_bytes_per_row;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+if (self->private_data.s_decode_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_frame[0].scratch;
+v_dst_y += 1;
+goto label__0__continue;
+}
+while ((self->private_impl.f_band_height > 0) && (((v_dst_y - self->private_impl.f_crop_y0) >> self->private_impl.f_scale_shift) >= self->private_impl.f_band_y1)) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(4);
+self->private_impl.f_band_y0 = self->private_impl.f_band_y1;
+self->private_impl.f_band_y1 = wuffs_base__u32__min(v_dst_h,wuffs_base__u32__sat_add(self->private_impl.f_band_y0,self->private_impl.f_band_height));
+}
+self->private_data.s_decode_frame[0].scratch = (self->private_impl.f_crop_x0 >> 3);
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+if (self->private_data.s_decode_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_frame[0].scratch;
+v_tab = wuffs_base__pixel_buffer__plane(a_dst,0);
+v_dst = wuffs_base__table_u8__row(v_tab,(((v_dst_y - self->private_impl.f_crop_y0) >> self->private_impl.f_scale_shift) - self->private_impl.f_band_y0));
+v_dst_x = (self->private_impl.f_crop_x0 & 4294967288);
+while (v_dst_x < self->private_impl.f_crop_x1) {
+if ((v_dst_x & 7) == 0) {
+while (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(6);
+v_tab = wuffs_base__pixel_buffer__plane(a_dst,0);
+v_dst = wuffs_base__table_u8__row(v_tab,(((v_dst_y - self->private_impl.f_crop_y0) >> self->private_impl.f_scale_shift) - self->private_impl.f_band_y0));
+if (v_dst_x > self->private_impl.f_crop_x0) {
+v_dst_x_in_bytes = (((uint64_t)((wuffs_base__u32__sat_add((v_dst_x - self->private_impl.f_crop_x0),v_mask) >> self->private_impl.f_scale_shift))) * v_dst_bytes_per_pixel);
+if (v_dst_x_in_bytes <= ((uint64_t)(v_dst.len))) {
+v_dst = wuffs_base__slice_u8__subslice_i(v_dst,v_dst_x_in_bytes);
+}
+}
+}
+v_c = wuffs_base__load_u8be__no_bounds_check(iop_a_src);
+(iop_a_src += 1, wuffs_base__make_empty_struct());
+}
+if ((v_dst_x >= self->private_impl.f_crop_x0) && (((v_dst_x - self->private_impl.f_crop_x0) & v_mask) == 0)) {
+if ((v_c & 128) == 0) {
+v_src[0] = 0;
+} else {
+v_src[0] = 255;
+}
+wuffs_base__pixel_swizzler__swizzle_interleaved(&self->private_impl.f_swizzler,v_dst,wuffs_base__utility__empty_slice_u8(),wuffs_base__make_slice_u8(v_src, 1));
+if (v_dst_bytes_per_pixel <= ((uint64_t)(v_dst.len))) {
+v_dst = wuffs_base__slice_u8__subslice_i(v_dst,v_dst_bytes_per_pixel);
+}
+}
+v_c = ((uint8_t)(((((uint32_t)(v_c)) << 1) & 255)));
+v_dst_x += 1;
+}
+self->private_data.s_decode_frame[0].scratch = wuffs_base__u64__sat_sub(v_bytes_per_row,((((uint64_t)(self->private_impl.f_crop_x1)) + 7) / 8));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+if (self->private_data.s_decode_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_frame[0].scratch;
+v_dst_y += 1;
+}
+self->private_data.s_decode_frame[0].scratch = (v_bytes_per_row * ((uint64_t)(wuffs_base__u32__sat_sub(self->private_impl.f_height,self->private_impl.f_crop_y1))));
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+if (self->private_data.s_decode_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_frame[0].scratch;
+}
+while ((self->private_impl.f_band_height > 0) && (self->private_impl.f_band_y1 < v_dst_h)) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(9);
+self->private_impl.f_band_y0 = self->private_impl.f_band_y1;
+self->private_impl.f_band_y1 = wuffs_base__u32__min(v_dst_h,wuffs_base__u32__sat_add(self->private_impl.f_band_y0,self->private_impl.f_band_height));
+}
+self->private_impl.f_call_sequence = 3;
+
+goto ok;ok:self->private_impl.p_decode_frame[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 3 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+self->private_data.s_decode_frame[0].v_dst_bytes_per_pixel = v_dst_bytes_per_pixel;
+self->private_data.s_decode_frame[0].v_bytes_per_row = v_bytes_per_row;
+self->private_data.s_decode_frame[0].v_mask = v_mask;
+self->private_data.s_decode_frame[0].v_dst_x = v_dst_x;
+self->private_data.s_decode_frame[0].v_dst_y = v_dst_y;
+self->private_data.s_decode_frame[0].v_dst_h = v_dst_h;
+memcpy(self->private_data.s_decode_frame[0].v_src, v_src, sizeof(v_src));
+self->private_data.s_decode_frame[0].v_c = v_c;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func wbmp.decoder.skip_frame
+
+static wuffs_base__status //
+wuffs_wbmp__decoder__skip_frame(wuffs_wbmp__decoder *self,wuffs_base__io_buffer* a_src){
+WUFFS_BASE__STATS__CALL(self, 4);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint64_t v_bytes_per_row = 0;
+uint64_t v_total_bytes = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_skip_frame[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+v_bytes_per_row = ((((uint64_t)(self->private_impl.f_width)) + 7) / 8);
+v_total_bytes = (v_bytes_per_row * ((uint64_t)(self->private_impl.f_height)));
+self->private_data.s_skip_frame[0].scratch = v_total_bytes;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+if (self->private_data.s_skip_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_skip_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_skip_frame[0].scratch;
+self->private_impl.f_call_sequence = 3;
+
+goto ok;ok:self->private_impl.p_skip_frame[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_skip_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func wbmp.decoder.frame_dirty_rect
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32//
+wuffs_wbmp__decoder__frame_dirty_rect(const wuffs_wbmp__decoder *self){
+if (!self) { return wuffs_base__utility__empty_rect_ie_u32();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_rect_ie_u32();}
+
+uint32_t v_m = 0;
+
+v_m = ((((uint32_t)(1)) << self->private_impl.f_scale_shift) - 1);
+return wuffs_base__utility__make_rect_ie_u32(0,self->private_impl.f_band_y0,(wuffs_base__u32__sat_add((self->private_impl.f_crop_x1 - self->private_impl.f_crop_x0),v_m) >> self->private_impl.f_scale_shift),self->private_impl.f_band_y1);}
+
+// -------- func wbmp.decoder.num_animation_loops
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_wbmp__decoder__num_animation_loops(const wuffs_wbmp__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+return 0;}
+
+// -------- func wbmp.decoder.num_decoded_frame_configs
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_wbmp__decoder__num_decoded_frame_configs(const wuffs_wbmp__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+if (self->private_impl.f_call_sequence > 1) {
+return 1;}
+return 0;}
+
+// -------- func wbmp.decoder.num_decoded_frames
+
+WUFFS_BASE__MAYBE_STATIC uint64_t//
+wuffs_wbmp__decoder__num_decoded_frames(const wuffs_wbmp__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+if (self->private_impl.f_call_sequence > 2) {
+return 1;}
+return 0;}
+
+// -------- func wbmp.decoder.restart_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status//
+wuffs_wbmp__decoder__restart_frame(wuffs_wbmp__decoder *self,uint64_t a_index,uint64_t a_io_position){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+WUFFS_BASE__STATS__CALL(self, 5);
+
+
+if (self->private_impl.f_call_sequence == 0) {
+return wuffs_base__make_status(wuffs_base__error__bad_call_sequence);}
+if (a_index != 0) {
+return wuffs_base__make_status(wuffs_base__error__bad_argument);}
+self->private_impl.f_call_sequence = 1;
+self->private_impl.f_frame_config_io_position = a_io_position;
+return wuffs_base__make_status(NULL);}
+
+// -------- func wbmp.decoder.set_report_metadata
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_wbmp__decoder__set_report_metadata(wuffs_wbmp__decoder *self,uint32_t a_fourcc,bool a_report){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func wbmp.decoder.tell_me_more
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_wbmp__decoder__tell_me_more(wuffs_wbmp__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__more_information* a_minfo,wuffs_base__io_buffer* a_src){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 4)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 7);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+
+status = wuffs_base__make_status(wuffs_base__error__no_more_information);goto exit;
+goto ok;ok:goto exit;exit:if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func wbmp.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_wbmp__decoder__workbuf_len(const wuffs_wbmp__decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__make_range_ii_u64(0,0);}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__WBMP)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__WBMP
+
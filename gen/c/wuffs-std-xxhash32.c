@@ -0,0 +1,464 @@
+#ifndef WUFFS_INCLUDE_GUARD__XXHASH32
+#define WUFFS_INCLUDE_GUARD__XXHASH32
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__XXHASH32
+#endif
+
+#include "./wuffs-base.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+
+// ---------------- Public Consts
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_xxhash32__hasher__struct wuffs_xxhash32__hasher;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_xxhash32__hasher__initialize(wuffs_xxhash32__hasher *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_xxhash32__hasher();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_xxhash32__hasher*  //
+wuffs_xxhash32__hasher__alloc();
+
+static inline wuffs_base__hasher_u32*  //
+wuffs_xxhash32__hasher__alloc_as__wuffs_base__hasher_u32(){
+return (wuffs_base__hasher_u32*)(wuffs_xxhash32__hasher__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__hasher_u32*  //
+wuffs_xxhash32__hasher__upcast_as__wuffs_base__hasher_u32(wuffs_xxhash32__hasher* p){
+return (wuffs_base__hasher_u32*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_XXHASH32__HASHER__STATS__FUNC__SET_QUIRK_ENABLED 0
+#define WUFFS_XXHASH32__HASHER__STATS__FUNC__UPDATE_U32 1
+#define WUFFS_XXHASH32__HASHER__STATS__FUNC__CHECKSUM_U32 2
+
+typedef struct wuffs_xxhash32__hasher__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[3];
+} wuffs_xxhash32__hasher__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_xxhash32__hasher__stats  //
+wuffs_xxhash32__hasher__get_stats(const wuffs_xxhash32__hasher* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_xxhash32__hasher__set_quirk_enabled(wuffs_xxhash32__hasher *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_xxhash32__hasher__update_u32(wuffs_xxhash32__hasher *self,wuffs_base__slice_u8 a_x);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_xxhash32__hasher__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__hasher_u32;
+wuffs_base__vtable null_vtable;
+
+uint32_t f_length_modulo_u32;
+bool f_length_overflows_u32;
+bool f_started;
+uint32_t f_buf_len;
+uint8_t f_buf_data[16];
+uint32_t f_acc0;
+uint32_t f_acc1;
+uint32_t f_acc2;
+uint32_t f_acc3;
+
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_xxhash32__hasher__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_xxhash32__hasher, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_xxhash32__hasher__alloc(), &free);
+}
+
+static inline wuffs_base__hasher_u32::unique_ptr  //
+alloc_as__wuffs_base__hasher_u32(){
+return wuffs_base__hasher_u32::unique_ptr(wuffs_xxhash32__hasher__alloc_as__wuffs_base__hasher_u32(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_xxhash32__hasher__struct() = delete;
+wuffs_xxhash32__hasher__struct(const wuffs_xxhash32__hasher__struct&) = delete;
+wuffs_xxhash32__hasher__struct& operator=(const wuffs_xxhash32__hasher__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_xxhash32__hasher__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__hasher_u32*  //
+upcast_as__wuffs_base__hasher_u32(){
+return (wuffs_base__hasher_u32*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_xxhash32__hasher__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline uint32_t//
+update_u32(wuffs_base__slice_u8 a_x){ return wuffs_xxhash32__hasher__update_u32(this,a_x);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_xxhash32__hasher__stats  //
+get_stats() const {
+return wuffs_xxhash32__hasher__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_xxhash32__hasher__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__XXHASH32)
+
+// ---------------- Status Codes Implementations
+
+
+// ---------------- Private Consts
+
+#define WUFFS_XXHASH32__XXH_PRIME32_1 2654435761
+
+#define WUFFS_XXHASH32__XXH_PRIME32_2 2246822519
+
+#define WUFFS_XXHASH32__XXH_PRIME32_3 3266489917
+
+#define WUFFS_XXHASH32__XXH_PRIME32_4 668265263
+
+#define WUFFS_XXHASH32__XXH_PRIME32_5 374761393
+
+#define WUFFS_XXHASH32__INITIAL_ACC_0 606290984
+
+#define WUFFS_XXHASH32__INITIAL_ACC_1 2246822519
+
+#define WUFFS_XXHASH32__INITIAL_ACC_2 0
+
+#define WUFFS_XXHASH32__INITIAL_ACC_3 1640531535
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static uint32_t//
+wuffs_xxhash32__hasher__checksum_u32(wuffs_xxhash32__hasher *self);
+
+// ---------------- VTables
+
+const wuffs_base__hasher_u32__func_ptrs wuffs_xxhash32__hasher__func_ptrs_for__wuffs_base__hasher_u32 = {(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_xxhash32__hasher__set_quirk_enabled),
+(uint32_t(*)(void*,wuffs_base__slice_u8))(&wuffs_xxhash32__hasher__update_u32),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_xxhash32__hasher__initialize(wuffs_xxhash32__hasher *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__hasher_u32.vtable_name = wuffs_base__hasher_u32__vtable_name;
+self->private_impl.vtable_for__wuffs_base__hasher_u32.function_pointers = (const void*)(&wuffs_xxhash32__hasher__func_ptrs_for__wuffs_base__hasher_u32);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_xxhash32__hasher*  //
+wuffs_xxhash32__hasher__alloc(){
+wuffs_xxhash32__hasher* x = (wuffs_xxhash32__hasher*)(calloc(sizeof(wuffs_xxhash32__hasher), 1));
+if (!x) { return NULL; }
+if (wuffs_xxhash32__hasher__initialize(x, sizeof(wuffs_xxhash32__hasher), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_xxhash32__hasher(){ return sizeof(wuffs_xxhash32__hasher); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_xxhash32__hasher__stats  //
+wuffs_xxhash32__hasher__get_stats(const wuffs_xxhash32__hasher* self) {
+wuffs_xxhash32__hasher__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func xxhash32.hasher.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_xxhash32__hasher__set_quirk_enabled(wuffs_xxhash32__hasher *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func xxhash32.hasher.update_u32
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_xxhash32__hasher__update_u32(wuffs_xxhash32__hasher *self,wuffs_base__slice_u8 a_x){
+if (!self) { return 0;}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return 0;}
+WUFFS_BASE__STATS__CALL(self, 1);
+
+uint32_t v_new_lmu = 0;
+uint64_t v_n = 0;
+uint64_t v_buf_len = 0;
+wuffs_base__slice_u8 v_remaining = {0};
+uint32_t v_a0 = 0;
+uint32_t v_a1 = 0;
+uint32_t v_a2 = 0;
+uint32_t v_a3 = 0;
+uint32_t v_lane = 0;
+wuffs_base__slice_u8 v_p = {0};
+uint32_t v_ret = 0;
+
+if ( ! self->private_impl.f_started) {
+self->private_impl.f_started = true;
+self->private_impl.f_acc0 = 606290984;
+self->private_impl.f_acc1 = 2246822519;
+self->private_impl.f_acc2 = 0;
+self->private_impl.f_acc3 = 1640531535;
+}
+v_new_lmu = (self->private_impl.f_length_modulo_u32 + ((uint32_t)((((uint64_t)(a_x.len)) & 4294967295))));
+self->private_impl.f_length_overflows_u32 = (self->private_impl.f_length_overflows_u32 || (((uint64_t)(a_x.len)) > 4294967295) || (v_new_lmu < self->private_impl.f_length_modulo_u32));
+self->private_impl.f_length_modulo_u32 = v_new_lmu;
+v_a0 = self->private_impl.f_acc0;
+v_a1 = self->private_impl.f_acc1;
+v_a2 = self->private_impl.f_acc2;
+v_a3 = self->private_impl.f_acc3;
+if (self->private_impl.f_buf_len > 0) {
+v_buf_len = (16 - ((uint64_t)(self->private_impl.f_buf_len)));
+if (v_buf_len > ((uint64_t)(a_x.len))) {
+wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_i(wuffs_base__make_slice_u8(self->private_impl.f_buf_data, 16),self->private_impl.f_buf_len),a_x);
+self->private_impl.f_buf_len = ((self->private_impl.f_buf_len + ((uint32_t)((((uint64_t)(a_x.len)) & 15)))) & 15);
+v_ret = wuffs_xxhash32__hasher__checksum_u32(self);
+return v_ret;}
+wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_i(wuffs_base__make_slice_u8(self->private_impl.f_buf_data, 16),self->private_impl.f_buf_len),wuffs_base__slice_u8__subslice_j(a_x,v_buf_len));
+a_x = wuffs_base__slice_u8__subslice_i(a_x,v_buf_len);
+self->private_impl.f_buf_len = 0;
+v_lane = ((((uint32_t)(self->private_impl.f_buf_data[0])) << 0) | (((uint32_t)(self->private_impl.f_buf_data[1])) << 8) | (((uint32_t)(self->private_impl.f_buf_data[2])) << 16) | (((uint32_t)(self->private_impl.f_buf_data[3])) << 24));
+v_a0 += (v_lane * 2246822519);
+v_a0 = (((v_a0 << 13) | (v_a0 >> 19)) * 2654435761);
+v_lane = ((((uint32_t)(self->private_impl.f_buf_data[4])) << 0) | (((uint32_t)(self->private_impl.f_buf_data[5])) << 8) | (((uint32_t)(self->private_impl.f_buf_data[6])) << 16) | (((uint32_t)(self->private_impl.f_buf_data[7])) << 24));
+v_a1 += (v_lane * 2246822519);
+v_a1 = (((v_a1 << 13) | (v_a1 >> 19)) * 2654435761);
+v_lane = ((((uint32_t)(self->private_impl.f_buf_data[8])) << 0) | (((uint32_t)(self->private_impl.f_buf_data[9])) << 8) | (((uint32_t)(self->private_impl.f_buf_data[10])) << 16) | (((uint32_t)(self->private_impl.f_buf_data[11])) << 24));
+v_a2 += (v_lane * 2246822519);
+v_a2 = (((v_a2 << 13) | (v_a2 >> 19)) * 2654435761);
+v_lane = ((((uint32_t)(self->private_impl.f_buf_data[12])) << 0) | (((uint32_t)(self->private_impl.f_buf_data[13])) << 8) | (((uint32_t)(self->private_impl.f_buf_data[14])) << 16) | (((uint32_t)(self->private_impl.f_buf_data[15])) << 24));
+v_a3 += (v_lane * 2246822519);
+v_a3 = (((v_a3 << 13) | (v_a3 >> 19)) * 2654435761);
+}
+v_remaining = wuffs_base__slice_u8__suffix(a_x,(((uint64_t)(a_x.len)) & 15));
+{
+wuffs_base__slice_u8 i_slice_p =a_x;
+v_p = i_slice_p;
+v_p.len = 16;
+uint8_t* i_end0_p = i_slice_p.ptr + (i_slice_p.len / 16) * 16;
+while (v_p.ptr < i_end0_p) {
+v_lane = ((((uint32_t)(v_p.ptr[0])) << 0) | (((uint32_t)(v_p.ptr[1])) << 8) | (((uint32_t)(v_p.ptr[2])) << 16) | (((uint32_t)(v_p.ptr[3])) << 24));
+v_a0 += (v_lane * 2246822519);
+v_a0 = (((v_a0 << 13) | (v_a0 >> 19)) * 2654435761);
+v_lane = ((((uint32_t)(v_p.ptr[4])) << 0) | (((uint32_t)(v_p.ptr[5])) << 8) | (((uint32_t)(v_p.ptr[6])) << 16) | (((uint32_t)(v_p.ptr[7])) << 24));
+v_a1 += (v_lane * 2246822519);
+v_a1 = (((v_a1 << 13) | (v_a1 >> 19)) * 2654435761);
+v_lane = ((((uint32_t)(v_p.ptr[8])) << 0) | (((uint32_t)(v_p.ptr[9])) << 8) | (((uint32_t)(v_p.ptr[10])) << 16) | (((uint32_t)(v_p.ptr[11])) << 24));
+v_a2 += (v_lane * 2246822519);
+v_a2 = (((v_a2 << 13) | (v_a2 >> 19)) * 2654435761);
+v_lane = ((((uint32_t)(v_p.ptr[12])) << 0) | (((uint32_t)(v_p.ptr[13])) << 8) | (((uint32_t)(v_p.ptr[14])) << 16) | (((uint32_t)(v_p.ptr[15])) << 24));
+v_a3 += (v_lane * 2246822519);
+v_a3 = (((v_a3 << 13) | (v_a3 >> 19)) * 2654435761);
+v_p.ptr += 16;
+}
+}
+v_n = wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8(self->private_impl.f_buf_data, 16),v_remaining);
+self->private_impl.f_buf_len = ((uint32_t)((v_n & 15)));
+self->private_impl.f_acc0 = v_a0;
+self->private_impl.f_acc1 = v_a1;
+self->private_impl.f_acc2 = v_a2;
+self->private_impl.f_acc3 = v_a3;
+v_ret = wuffs_xxhash32__hasher__checksum_u32(self);
+return v_ret;}
+
+// -------- func xxhash32.hasher.checksum_u32
+
+static uint32_t//
+wuffs_xxhash32__hasher__checksum_u32(wuffs_xxhash32__hasher *self){
+WUFFS_BASE__STATS__CALL(self, 2);
+
+uint32_t v_ret = 0;
+uint32_t v_lane = 0;
+wuffs_base__slice_u8 v_p = {0};
+
+if (self->private_impl.f_length_overflows_u32 || (self->private_impl.f_length_modulo_u32 >= 16)) {
+v_ret = ((self->private_impl.f_acc0 << 1) | (self->private_impl.f_acc0 >> 31));
+v_ret += ((self->private_impl.f_acc1 << 7) | (self->private_impl.f_acc1 >> 25));
+v_ret += ((self->private_impl.f_acc2 << 12) | (self->private_impl.f_acc2 >> 20));
+v_ret += ((self->private_impl.f_acc3 << 18) | (self->private_impl.f_acc3 >> 14));
+} else {
+v_ret = 374761393;
+}
+v_ret += self->private_impl.f_length_modulo_u32;
+{
+wuffs_base__slice_u8 i_slice_p =wuffs_base__slice_u8__subslice_j(wuffs_base__make_slice_u8(self->private_impl.f_buf_data, 16),self->private_impl.f_buf_len);
+v_p = i_slice_p;
+v_p.len = 4;
+uint8_t* i_end0_p = i_slice_p.ptr + (i_slice_p.len / 4) * 4;
+while (v_p.ptr < i_end0_p) {
+v_lane = ((((uint32_t)(v_p.ptr[0])) << 0) | (((uint32_t)(v_p.ptr[1])) << 8) | (((uint32_t)(v_p.ptr[2])) << 16) | (((uint32_t)(v_p.ptr[3])) << 24));
+v_ret += (v_lane * 3266489917);
+v_ret = (((v_ret << 17) | (v_ret >> 15)) * 668265263);
+v_p.ptr += 4;
+}
+v_p.len = 1;
+uint8_t* i_end1_p = i_slice_p.ptr + (i_slice_p.len / 1) * 1;
+while (v_p.ptr < i_end1_p) {
+v_ret += (((uint32_t)(v_p.ptr[0])) * 374761393);
+v_ret = (((v_ret << 11) | (v_ret >> 21)) * 2654435761);
+v_p.ptr += 1;
+}
+}
+v_ret ^= (v_ret >> 15);
+v_ret *= 2246822519;
+v_ret ^= (v_ret >> 13);
+v_ret *= 3266489917;
+v_ret ^= (v_ret >> 16);
+return v_ret;}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__XXHASH32)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__XXHASH32
+
@@ -0,0 +1,942 @@
+#ifndef WUFFS_INCLUDE_GUARD__ZLIB
+#define WUFFS_INCLUDE_GUARD__ZLIB
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ZLIB
+#endif
+
+#include "./wuffs-base.c"
+#include "./wuffs-std-adler32.c"
+#include "./wuffs-std-deflate.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+extern const char* wuffs_zlib__note__dictionary_required;
+extern const char* wuffs_zlib__error__bad_checksum;
+extern const char* wuffs_zlib__error__bad_compression_method;
+extern const char* wuffs_zlib__error__bad_compression_window_size;
+extern const char* wuffs_zlib__error__bad_parity_check;
+extern const char* wuffs_zlib__error__incorrect_dictionary;
+
+// ---------------- Public Consts
+
+#define WUFFS_ZLIB__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 1
+
+#define WUFFS_ZLIB__ENCODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 0
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_zlib__decoder__struct wuffs_zlib__decoder;
+
+typedef struct wuffs_zlib__encoder__struct wuffs_zlib__encoder;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_zlib__decoder__initialize(wuffs_zlib__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_zlib__decoder();
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_zlib__encoder__initialize(wuffs_zlib__encoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_zlib__encoder();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_zlib__decoder*  //
+wuffs_zlib__decoder__alloc();
+
+static inline wuffs_base__io_transformer*  //
+wuffs_zlib__decoder__alloc_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)(wuffs_zlib__decoder__alloc());
+}
+
+wuffs_zlib__encoder*  //
+wuffs_zlib__encoder__alloc();
+
+static inline wuffs_base__io_transformer*  //
+wuffs_zlib__encoder__alloc_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)(wuffs_zlib__encoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__io_transformer*  //
+wuffs_zlib__decoder__upcast_as__wuffs_base__io_transformer(wuffs_zlib__decoder* p){
+return (wuffs_base__io_transformer*)p;
+}
+
+static inline wuffs_base__io_transformer*  //
+wuffs_zlib__encoder__upcast_as__wuffs_base__io_transformer(wuffs_zlib__encoder* p){
+return (wuffs_base__io_transformer*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_ZLIB__DECODER__STATS__FUNC__ADD_DICTIONARY 0
+#define WUFFS_ZLIB__DECODER__STATS__FUNC__SET_IGNORE_CHECKSUM 1
+#define WUFFS_ZLIB__DECODER__STATS__FUNC__SET_QUIRK_ENABLED 2
+#define WUFFS_ZLIB__DECODER__STATS__FUNC__TRANSFORM_IO 3
+
+typedef struct wuffs_zlib__decoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[4];
+
+// The sub-structs' stats are filled in by the get_stats function.
+wuffs_adler32__hasher__stats checksum;
+wuffs_adler32__hasher__stats dict_id_hasher;
+wuffs_deflate__decoder__stats flate;
+} wuffs_zlib__decoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_zlib__decoder__stats  //
+wuffs_zlib__decoder__get_stats(const wuffs_zlib__decoder* self);
+
+#define WUFFS_ZLIB__ENCODER__STATS__FUNC__SET_LEVEL 0
+#define WUFFS_ZLIB__ENCODER__STATS__FUNC__SET_QUIRK_ENABLED 1
+#define WUFFS_ZLIB__ENCODER__STATS__FUNC__TRANSFORM_IO 2
+#define WUFFS_ZLIB__ENCODER__STATS__FUNC__WRITE_U32BE 3
+
+typedef struct wuffs_zlib__encoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[4];
+
+// The sub-structs' stats are filled in by the get_stats function.
+wuffs_adler32__hasher__stats checksum;
+wuffs_deflate__encoder__stats flate;
+} wuffs_zlib__encoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_zlib__encoder__stats  //
+wuffs_zlib__encoder__get_stats(const wuffs_zlib__encoder* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_zlib__decoder__dictionary_id(const wuffs_zlib__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zlib__decoder__add_dictionary(wuffs_zlib__decoder *self,wuffs_base__slice_u8 a_dict);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zlib__decoder__set_ignore_checksum(wuffs_zlib__decoder *self,bool a_ic);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zlib__decoder__set_quirk_enabled(wuffs_zlib__decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_zlib__decoder__workbuf_len(const wuffs_zlib__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_zlib__decoder__transform_io(wuffs_zlib__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zlib__encoder__set_level(wuffs_zlib__encoder *self,uint32_t a_level);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zlib__encoder__set_quirk_enabled(wuffs_zlib__encoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_zlib__encoder__workbuf_len(const wuffs_zlib__encoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_zlib__encoder__transform_io(wuffs_zlib__encoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_zlib__decoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__io_transformer;
+wuffs_base__vtable null_vtable;
+
+bool f_bad_call_sequence;
+bool f_header_complete;
+bool f_got_dictionary;
+bool f_want_dictionary;
+bool f_ignore_checksum;
+uint32_t f_dict_id_got;
+uint32_t f_dict_id_want;
+
+uint32_t p_transform_io[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_zlib__decoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+wuffs_adler32__hasher f_checksum;
+wuffs_adler32__hasher f_dict_id_hasher;
+wuffs_deflate__decoder f_flate;
+
+struct {
+uint32_t v_checksum_got;
+uint64_t scratch;
+} s_transform_io[1];
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_zlib__decoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_zlib__decoder__alloc(), &free);
+}
+
+static inline wuffs_base__io_transformer::unique_ptr  //
+alloc_as__wuffs_base__io_transformer(){
+return wuffs_base__io_transformer::unique_ptr(wuffs_zlib__decoder__alloc_as__wuffs_base__io_transformer(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_zlib__decoder__struct() = delete;
+wuffs_zlib__decoder__struct(const wuffs_zlib__decoder__struct&) = delete;
+wuffs_zlib__decoder__struct& operator=(const wuffs_zlib__decoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_zlib__decoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__io_transformer*  //
+upcast_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)this;
+}
+
+inline uint32_t//
+dictionary_id() const { return wuffs_zlib__decoder__dictionary_id(this);}
+
+inline wuffs_base__empty_struct //
+add_dictionary(wuffs_base__slice_u8 a_dict){ return wuffs_zlib__decoder__add_dictionary(this,a_dict);}
+
+inline wuffs_base__empty_struct //
+set_ignore_checksum(bool a_ic){ return wuffs_zlib__decoder__set_ignore_checksum(this,a_ic);}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_zlib__decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_zlib__decoder__workbuf_len(this);}
+
+inline wuffs_base__status //
+transform_io(wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){ return wuffs_zlib__decoder__transform_io(this,a_dst,a_src,a_workbuf);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_zlib__decoder__stats  //
+get_stats() const {
+return wuffs_zlib__decoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_zlib__decoder__struct
+
+struct wuffs_zlib__encoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__io_transformer;
+wuffs_base__vtable null_vtable;
+
+bool f_level_is_set;
+uint32_t f_level;
+
+uint32_t p_transform_io[1];
+uint32_t p_write_u32be[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_zlib__encoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+wuffs_adler32__hasher f_checksum;
+wuffs_deflate__encoder f_flate;
+
+struct {
+uint32_t v_checksum;
+} s_transform_io[1];
+struct {
+uint32_t v_n;
+} s_write_u32be[1];
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_zlib__encoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_zlib__encoder__alloc(), &free);
+}
+
+static inline wuffs_base__io_transformer::unique_ptr  //
+alloc_as__wuffs_base__io_transformer(){
+return wuffs_base__io_transformer::unique_ptr(wuffs_zlib__encoder__alloc_as__wuffs_base__io_transformer(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_zlib__encoder__struct() = delete;
+wuffs_zlib__encoder__struct(const wuffs_zlib__encoder__struct&) = delete;
+wuffs_zlib__encoder__struct& operator=(const wuffs_zlib__encoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_zlib__encoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__io_transformer*  //
+upcast_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_level(uint32_t a_level){ return wuffs_zlib__encoder__set_level(this,a_level);}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_zlib__encoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_zlib__encoder__workbuf_len(this);}
+
+inline wuffs_base__status //
+transform_io(wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){ return wuffs_zlib__encoder__transform_io(this,a_dst,a_src,a_workbuf);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_zlib__encoder__stats  //
+get_stats() const {
+return wuffs_zlib__encoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_zlib__encoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__ZLIB)
+
+// ---------------- Status Codes Implementations
+
+const char* wuffs_zlib__note__dictionary_required = "@zlib: dictionary required";
+const char* wuffs_zlib__error__bad_checksum = "#zlib: bad checksum";
+const char* wuffs_zlib__error__bad_compression_method = "#zlib: bad compression method";
+const char* wuffs_zlib__error__bad_compression_window_size = "#zlib: bad compression window size";
+const char* wuffs_zlib__error__bad_parity_check = "#zlib: bad parity check";
+const char* wuffs_zlib__error__incorrect_dictionary = "#zlib: incorrect dictionary";
+
+// ---------------- Private Consts
+
+static const uint16_t //
+WUFFS_ZLIB__HEADERS[10]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {30721,30721,30814,30814,30814,30814,30876,30938,30938,30938,};
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static wuffs_base__status //
+wuffs_zlib__encoder__write_u32be(wuffs_zlib__encoder *self,wuffs_base__io_buffer* a_dst,uint32_t a_x,uint32_t a_n);
+
+// ---------------- VTables
+
+const wuffs_base__io_transformer__func_ptrs wuffs_zlib__decoder__func_ptrs_for__wuffs_base__io_transformer = {(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_zlib__decoder__set_quirk_enabled),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__io_buffer*,wuffs_base__slice_u8))(&wuffs_zlib__decoder__transform_io),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_zlib__decoder__workbuf_len),
+};
+
+const wuffs_base__io_transformer__func_ptrs wuffs_zlib__encoder__func_ptrs_for__wuffs_base__io_transformer = {(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_zlib__encoder__set_quirk_enabled),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__io_buffer*,wuffs_base__slice_u8))(&wuffs_zlib__encoder__transform_io),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_zlib__encoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_zlib__decoder__initialize(wuffs_zlib__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+{
+wuffs_base__status z = wuffs_adler32__hasher__initialize(&self->private_data.f_checksum, sizeof(self->private_data.f_checksum), WUFFS_VERSION, initialize_flags);
+if (z.repr) { return z; }
+}
+{
+wuffs_base__status z = wuffs_adler32__hasher__initialize(&self->private_data.f_dict_id_hasher, sizeof(self->private_data.f_dict_id_hasher), WUFFS_VERSION, initialize_flags);
+if (z.repr) { return z; }
+}
+{
+wuffs_base__status z = wuffs_deflate__decoder__initialize(&self->private_data.f_flate, sizeof(self->private_data.f_flate), WUFFS_VERSION, initialize_flags);
+if (z.repr) { return z; }
+}
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__io_transformer.vtable_name = wuffs_base__io_transformer__vtable_name;
+self->private_impl.vtable_for__wuffs_base__io_transformer.function_pointers = (const void*)(&wuffs_zlib__decoder__func_ptrs_for__wuffs_base__io_transformer);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_zlib__decoder*  //
+wuffs_zlib__decoder__alloc(){
+wuffs_zlib__decoder* x = (wuffs_zlib__decoder*)(calloc(sizeof(wuffs_zlib__decoder), 1));
+if (!x) { return NULL; }
+if (wuffs_zlib__decoder__initialize(x, sizeof(wuffs_zlib__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_zlib__decoder(){ return sizeof(wuffs_zlib__decoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_zlib__decoder__stats  //
+wuffs_zlib__decoder__get_stats(const wuffs_zlib__decoder* self) {
+wuffs_zlib__decoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+ret.checksum = wuffs_adler32__hasher__get_stats(&self->private_data.f_checksum);
+ret.dict_id_hasher = wuffs_adler32__hasher__get_stats(&self->private_data.f_dict_id_hasher);
+ret.flate = wuffs_deflate__decoder__get_stats(&self->private_data.f_flate);
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_zlib__encoder__initialize(wuffs_zlib__encoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+{
+wuffs_base__status z = wuffs_adler32__hasher__initialize(&self->private_data.f_checksum, sizeof(self->private_data.f_checksum), WUFFS_VERSION, initialize_flags);
+if (z.repr) { return z; }
+}
+{
+wuffs_base__status z = wuffs_deflate__encoder__initialize(&self->private_data.f_flate, sizeof(self->private_data.f_flate), WUFFS_VERSION, initialize_flags);
+if (z.repr) { return z; }
+}
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__io_transformer.vtable_name = wuffs_base__io_transformer__vtable_name;
+self->private_impl.vtable_for__wuffs_base__io_transformer.function_pointers = (const void*)(&wuffs_zlib__encoder__func_ptrs_for__wuffs_base__io_transformer);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_zlib__encoder*  //
+wuffs_zlib__encoder__alloc(){
+wuffs_zlib__encoder* x = (wuffs_zlib__encoder*)(calloc(sizeof(wuffs_zlib__encoder), 1));
+if (!x) { return NULL; }
+if (wuffs_zlib__encoder__initialize(x, sizeof(wuffs_zlib__encoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_zlib__encoder(){ return sizeof(wuffs_zlib__encoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_zlib__encoder__stats  //
+wuffs_zlib__encoder__get_stats(const wuffs_zlib__encoder* self) {
+wuffs_zlib__encoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+ret.checksum = wuffs_adler32__hasher__get_stats(&self->private_data.f_checksum);
+ret.flate = wuffs_deflate__encoder__get_stats(&self->private_data.f_flate);
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func zlib.decoder.dictionary_id
+
+WUFFS_BASE__MAYBE_STATIC uint32_t//
+wuffs_zlib__decoder__dictionary_id(const wuffs_zlib__decoder *self){
+if (!self) { return 0;}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return 0;}
+
+
+return self->private_impl.f_dict_id_want;}
+
+// -------- func zlib.decoder.add_dictionary
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zlib__decoder__add_dictionary(wuffs_zlib__decoder *self,wuffs_base__slice_u8 a_dict){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 0);
+
+
+if (self->private_impl.f_header_complete) {
+self->private_impl.f_bad_call_sequence = true;
+} else {
+self->private_impl.f_dict_id_got = wuffs_adler32__hasher__update_u32(&self->private_data.f_dict_id_hasher,a_dict);
+wuffs_deflate__decoder__add_history(&self->private_data.f_flate,a_dict);
+}
+self->private_impl.f_got_dictionary = true;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func zlib.decoder.set_ignore_checksum
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zlib__decoder__set_ignore_checksum(wuffs_zlib__decoder *self,bool a_ic){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 1);
+
+
+self->private_impl.f_ignore_checksum = a_ic;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func zlib.decoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zlib__decoder__set_quirk_enabled(wuffs_zlib__decoder *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func zlib.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_zlib__decoder__workbuf_len(const wuffs_zlib__decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__make_range_ii_u64(1,1);}
+
+// -------- func zlib.decoder.transform_io
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_zlib__decoder__transform_io(wuffs_zlib__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 3);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint16_t v_x = 0;
+uint32_t v_checksum_got = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+uint32_t v_checksum_want = 0;
+uint64_t v_mark = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_transform_io[0];
+if (coro_susp_point) {
+v_checksum_got = self->private_data.s_transform_io[0].v_checksum_got;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if (self->private_impl.f_bad_call_sequence) {
+status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);goto exit;} else if ( ! self->private_impl.f_want_dictionary) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+uint16_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_0 =wuffs_base__load_u16be__no_bounds_check(iop_a_src); iop_a_src += 2;
+} else {self->private_data.s_transform_io[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_transform_io[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_0);if (num_bits_0 == 8) { t_0 = ((uint16_t)(*scratch >> 48));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0));}}
+v_x = t_0;
+}
+if (((v_x >> 8) & 15) != 8) {
+status = wuffs_base__make_status(wuffs_zlib__error__bad_compression_method);goto exit;}
+if ((v_x >> 12) > 7) {
+status = wuffs_base__make_status(wuffs_zlib__error__bad_compression_window_size);goto exit;}
+if ((v_x % 31) != 0) {
+status = wuffs_base__make_status(wuffs_zlib__error__bad_parity_check);goto exit;}
+self->private_impl.f_want_dictionary = ((v_x & 32) != 0);
+if (self->private_impl.f_want_dictionary) {
+self->private_impl.f_dict_id_got = 1;
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_1 =wuffs_base__load_u32be__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_transform_io[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_transform_io[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_1);if (num_bits_1 == 24) { t_1 = ((uint32_t)(*scratch >> 32));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1));}}
+self->private_impl.f_dict_id_want = t_1;
+}
+status = wuffs_base__make_status(wuffs_zlib__note__dictionary_required);goto ok;} else if (self->private_impl.f_got_dictionary) {
+status = wuffs_base__make_status(wuffs_zlib__error__incorrect_dictionary);goto exit;}
+} else if (self->private_impl.f_dict_id_got != self->private_impl.f_dict_id_want) {
+if (self->private_impl.f_got_dictionary) {
+status = wuffs_base__make_status(wuffs_zlib__error__incorrect_dictionary);goto exit;}
+status = wuffs_base__make_status(wuffs_zlib__note__dictionary_required);goto ok;}
+self->private_impl.f_header_complete = true;
+while (true) {
+v_mark = ((uint64_t)(iop_a_dst - io0_a_dst));
+{
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+wuffs_base__status t_2 = wuffs_deflate__decoder__transform_io(&self->private_data.f_flate,a_dst,a_src,a_workbuf);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+v_status = t_2;
+}
+if ( ! self->private_impl.f_ignore_checksum) {
+v_checksum_got = wuffs_adler32__hasher__update_u32(&self->private_data.f_checksum,wuffs_base__io__since(v_mark, ((uint64_t)(iop_a_dst - io0_a_dst)), io0_a_dst));
+}
+if (wuffs_base__status__is_ok(&v_status)) {
+goto label__0__break;
+}
+status = v_status;WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(5);
+}
+label__0__break:;
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+uint32_t t_3;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_3 =wuffs_base__load_u32be__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_transform_io[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_transform_io[0].scratch;uint32_t num_bits_3 = ((uint32_t)(*scratch& 0xFF)); *scratch >>= 8; *scratch <<= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_3);if (num_bits_3 == 24) { t_3 = ((uint32_t)(*scratch >> 32));break;}num_bits_3 += 8;*scratch |= ((uint64_t)(num_bits_3));}}
+v_checksum_want = t_3;
+}
+if ( ! self->private_impl.f_ignore_checksum && (v_checksum_got != v_checksum_want)) {
+status = wuffs_base__make_status(wuffs_zlib__error__bad_checksum);goto exit;}
+
+goto ok;ok:self->private_impl.p_transform_io[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_transform_io[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+self->private_data.s_transform_io[0].v_checksum_got = v_checksum_got;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 3, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func zlib.encoder.set_level
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zlib__encoder__set_level(wuffs_zlib__encoder *self,uint32_t a_level){
+if (!self) { return wuffs_base__make_empty_struct();}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_empty_struct();}
+WUFFS_BASE__STATS__CALL(self, 0);
+
+
+self->private_impl.f_level = 9;
+if (a_level < 9) {
+self->private_impl.f_level = a_level;
+}
+self->private_impl.f_level_is_set = true;
+wuffs_deflate__encoder__set_level(&self->private_data.f_flate,self->private_impl.f_level);
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func zlib.encoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zlib__encoder__set_quirk_enabled(wuffs_zlib__encoder *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func zlib.encoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_zlib__encoder__workbuf_len(const wuffs_zlib__encoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__make_range_ii_u64(0,0);}
+
+// -------- func zlib.encoder.transform_io
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_zlib__encoder__transform_io(wuffs_zlib__encoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 2);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint64_t v_mark = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+uint32_t v_checksum = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_transform_io[0];
+if (coro_susp_point) {
+v_checksum = self->private_data.s_transform_io[0].v_checksum;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if ( ! self->private_impl.f_level_is_set) {
+wuffs_zlib__encoder__set_level(self,6);
+}
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_zlib__encoder__write_u32be(self,a_dst,((uint32_t)(WUFFS_ZLIB__HEADERS[self->private_impl.f_level])),2);
+if (status.repr) { goto suspend; }
+while (true) {
+v_mark = ((uint64_t)(iop_a_src - io0_a_src));
+{
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+wuffs_base__status t_0 = wuffs_deflate__encoder__transform_io(&self->private_data.f_flate,a_dst,a_src,a_workbuf);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+v_status = t_0;
+}
+v_checksum = wuffs_adler32__hasher__update_u32(&self->private_data.f_checksum,wuffs_base__io_reader__since(v_mark, ((uint64_t)(iop_a_src - io0_a_src)), io0_a_src));
+if (wuffs_base__status__is_ok(&v_status)) {
+goto label__0__break;
+}
+status = v_status;WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+}
+label__0__break:;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_zlib__encoder__write_u32be(self,a_dst,v_checksum,4);
+if (status.repr) { goto suspend; }
+
+goto ok;ok:self->private_impl.p_transform_io[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_transform_io[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+self->private_data.s_transform_io[0].v_checksum = v_checksum;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func zlib.encoder.write_u32be
+
+static wuffs_base__status //
+wuffs_zlib__encoder__write_u32be(wuffs_zlib__encoder *self,wuffs_base__io_buffer* a_dst,uint32_t a_x,uint32_t a_n){
+WUFFS_BASE__STATS__CALL(self, 3);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_n = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+
+uint32_t coro_susp_point = self->private_impl.p_write_u32be[0];
+if (coro_susp_point) {
+v_n = self->private_data.s_write_u32be[0].v_n;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+v_n = a_n;
+label__0__continue:;
+while (v_n > 0) {
+if (((uint64_t)(io2_a_dst - iop_a_dst)) <= 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+goto label__0__continue;
+}
+v_n -= 1;
+(wuffs_base__store_u8be__no_bounds_check(iop_a_dst,((uint8_t)(((a_x >> (8 * v_n)) & 255)))), iop_a_dst += 1, wuffs_base__make_empty_struct());
+}
+
+goto ok;ok:self->private_impl.p_write_u32be[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_write_u32be[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_write_u32be[0].v_n = v_n;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 3, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+
+return status;
+}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__ZLIB)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__ZLIB
+
@@ -0,0 +1,2136 @@
+#ifndef WUFFS_INCLUDE_GUARD__ZSTD
+#define WUFFS_INCLUDE_GUARD__ZSTD
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ZSTD
+#endif
+
+#include "./wuffs-base.c"
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Status Codes
+
+extern const char* wuffs_zstd__error__bad_block;
+extern const char* wuffs_zstd__error__bad_content_size;
+extern const char* wuffs_zstd__error__bad_fse_table;
+extern const char* wuffs_zstd__error__bad_header;
+extern const char* wuffs_zstd__error__bad_huffman_code;
+extern const char* wuffs_zstd__error__bad_literals;
+extern const char* wuffs_zstd__error__bad_offset;
+extern const char* wuffs_zstd__error__bad_sequences;
+extern const char* wuffs_zstd__error__unsupported_zstandard_dictionary;
+extern const char* wuffs_zstd__error__unsupported_zstandard_window_size;
+
+// ---------------- Public Consts
+
+#define WUFFS_ZSTD__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 8388608
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_zstd__decoder__struct wuffs_zstd__decoder;
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for initialize_flags.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_zstd__decoder__initialize(wuffs_zstd__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags);
+
+size_t  //
+sizeof__wuffs_zstd__decoder();
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_zstd__decoder*  //
+wuffs_zstd__decoder__alloc();
+
+static inline wuffs_base__io_transformer*  //
+wuffs_zstd__decoder__alloc_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)(wuffs_zstd__decoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__io_transformer*  //
+wuffs_zstd__decoder__upcast_as__wuffs_base__io_transformer(wuffs_zstd__decoder* p){
+return (wuffs_base__io_transformer*)p;
+}
+
+// ---------------- Stats
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__DECODE_LITERALS_SECTION 0
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__DECODE_HUFFMAN_TABLE 1
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__DECODE_HUFFMAN_STREAM 2
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__DECODE_SEQUENCES_HEADER 3
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__DECODE_FSE_TABLE 4
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__READ_FSE_DESCRIPTION 5
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__BUILD_FSE_TABLE 6
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__INIT_BITS 7
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__REFILL_BITS 8
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__READ_BITS 9
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__DECODE_SEQUENCE 10
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__DECODE_COMPRESSED_BLOCK 11
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__EXECUTE_SEQUENCES_FAST 12
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__COPY_MATCH 13
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__SET_QUIRK_ENABLED 14
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__TRANSFORM_IO 15
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__ADD_HISTORY 16
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__DECODE_FRAME 17
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__DECODE_RAW_BLOCK 18
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__READ_BLOCK 19
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__FILL_LITERALS 20
+#define WUFFS_ZSTD__DECODER__STATS__FUNC__COPY_LITERALS 21
+
+typedef struct wuffs_zstd__decoder__stats__struct {
+// num_suspensions counts the public coroutine calls that returned a
+// suspension status, e.g. "$short read".
+uint64_t num_suspensions;
+wuffs_base__func_stats funcs[22];
+} wuffs_zstd__decoder__stats;
+
+WUFFS_BASE__MAYBE_STATIC wuffs_zstd__decoder__stats  //
+wuffs_zstd__decoder__get_stats(const wuffs_zstd__decoder* self);
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zstd__decoder__set_quirk_enabled(wuffs_zstd__decoder *self,uint32_t a_quirk,bool a_enabled);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_zstd__decoder__workbuf_len(const wuffs_zstd__decoder *self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_zstd__decoder__transform_io(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_zstd__decoder__struct {
+// Do not access the private_impl's or private_data's fields directly. There
+// is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+// the wuffs_foo__bar__baz functions.
+//
+// It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+// can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+struct {
+uint32_t magic;
+uint32_t active_coroutine;
+wuffs_base__vtable vtable_for__wuffs_base__io_transformer;
+wuffs_base__vtable null_vtable;
+
+uint32_t f_history_index;
+uint32_t f_window_size;
+uint32_t f_block_max_size;
+uint64_t f_frame_produced;
+uint32_t f_block_len;
+uint32_t f_block_pos;
+uint32_t f_literals_len;
+uint32_t f_literals_pos;
+uint32_t f_huffman_log;
+uint32_t f_fse_log;
+uint32_t f_fse_n_symbols;
+uint32_t f_fse_logs[4];
+bool f_fse_valid[4];
+uint32_t f_ll_state;
+uint32_t f_of_state;
+uint32_t f_ml_state;
+uint32_t f_rep0;
+uint32_t f_rep1;
+uint32_t f_rep2;
+uint32_t f_n_sequences;
+uint32_t f_seq_budget;
+uint32_t f_seq_literal_len;
+uint32_t f_seq_match_len;
+uint32_t f_seq_offset;
+bool f_seq_pending;
+uint64_t f_bits;
+uint32_t f_n_bits;
+uint32_t f_bits_pos;
+uint32_t f_bits_start;
+
+uint32_t p_decode_compressed_block[1];
+uint32_t p_copy_match[1];
+uint32_t p_transform_io[1];
+uint32_t p_decode_frame[1];
+uint32_t p_decode_raw_block[1];
+uint32_t p_read_block[1];
+uint32_t p_copy_literals[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+wuffs_zstd__decoder__stats stats;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+} private_impl;
+
+struct {
+uint8_t f_block[131328];
+uint8_t f_literals[131072];
+uint16_t f_huffman_table[2048];
+uint64_t f_fse_tables[4][512];
+uint32_t f_norms[64];
+uint32_t f_symbol_next[64];
+uint8_t f_fse_symbols[512];
+uint8_t f_weights[256];
+
+struct {
+uint32_t v_fhd;
+bool v_single_segment;
+bool v_has_checksum;
+uint64_t v_window_size;
+uint32_t v_fcs_flag;
+uint64_t v_content_size;
+bool v_has_content_size;
+bool v_last_block;
+uint32_t v_block_size;
+uint64_t scratch;
+} s_decode_frame[1];
+struct {
+uint32_t v_length;
+} s_decode_raw_block[1];
+struct {
+uint64_t v_avail;
+} s_read_block[1];
+struct {
+uint32_t v_length;
+} s_copy_literals[1];
+} private_data;
+
+#ifdef __cplusplus
+#if __cplusplus >= 201103L
+using unique_ptr = std::unique_ptr<wuffs_zstd__decoder, decltype(&free)>;
+
+// On failure, the alloc_etc functions return nullptr. They don't throw.
+
+static inline unique_ptr  //
+alloc() {
+return unique_ptr(wuffs_zstd__decoder__alloc(), &free);
+}
+
+static inline wuffs_base__io_transformer::unique_ptr  //
+alloc_as__wuffs_base__io_transformer(){
+return wuffs_base__io_transformer::unique_ptr(wuffs_zstd__decoder__alloc_as__wuffs_base__io_transformer(), &free);
+}
+#endif  // __cplusplus >= 201103L
+
+#if (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+// Disallow constructing or copying an object via standard C++ mechanisms,
+// e.g. the "new" operator, as this struct is intentionally opaque. Its total
+// size and field layout is not part of the public, stable, memory-safe API.
+// Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+// call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+// their first argument) rather than tweaking bar.private_impl.qux fields.
+//
+// In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+// WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+// order to provide convenience methods. These forward on "this", so that you
+// can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+wuffs_zstd__decoder__struct() = delete;
+wuffs_zstd__decoder__struct(const wuffs_zstd__decoder__struct&) = delete;
+wuffs_zstd__decoder__struct& operator=(const wuffs_zstd__decoder__struct&) = delete;
+
+// As above, the size of the struct is not part of the public API, and unless
+// WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+// allocated, not stack allocated. Its size is not intended to be known at
+// compile time, but it is unfortunately divulged as a side effect of
+// defining C++ convenience methods. Use "sizeof__T()", calling the function,
+// instead of "sizeof T", invoking the operator. To make the two values
+// different, so that passing the latter will be rejected by the initialize
+// function, we add an arbitrary amount of dead weight.
+uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // (__cplusplus >= 201103L) && !defined(WUFFS_IMPLEMENTATION)
+
+inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+initialize(size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags) {
+return wuffs_zstd__decoder__initialize(this, sizeof_star_self, wuffs_version, initialize_flags);
+}
+
+inline wuffs_base__io_transformer*  //
+upcast_as__wuffs_base__io_transformer(){
+return (wuffs_base__io_transformer*)this;
+}
+
+inline wuffs_base__empty_struct //
+set_quirk_enabled(uint32_t a_quirk,bool a_enabled){ return wuffs_zstd__decoder__set_quirk_enabled(this,a_quirk,a_enabled);}
+
+inline wuffs_base__range_ii_u64//
+workbuf_len() const { return wuffs_zstd__decoder__workbuf_len(this);}
+
+inline wuffs_base__status //
+transform_io(wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){ return wuffs_zstd__decoder__transform_io(this,a_dst,a_src,a_workbuf);}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+inline wuffs_zstd__decoder__stats  //
+get_stats() const {
+return wuffs_zstd__decoder__get_stats(this);
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+#endif  // __cplusplus
+
+};  // struct wuffs_zstd__decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+
+// WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__ZSTD)
+
+// ---------------- Status Codes Implementations
+
+const char* wuffs_zstd__error__bad_block = "#zstd: bad block";
+const char* wuffs_zstd__error__bad_content_size = "#zstd: bad content size";
+const char* wuffs_zstd__error__bad_fse_table = "#zstd: bad FSE table";
+const char* wuffs_zstd__error__bad_header = "#zstd: bad header";
+const char* wuffs_zstd__error__bad_huffman_code = "#zstd: bad Huffman code";
+const char* wuffs_zstd__error__bad_literals = "#zstd: bad literals";
+const char* wuffs_zstd__error__bad_offset = "#zstd: bad offset";
+const char* wuffs_zstd__error__bad_sequences = "#zstd: bad sequences";
+const char* wuffs_zstd__error__unsupported_zstandard_dictionary = "#zstd: unsupported Zstandard dictionary";
+const char* wuffs_zstd__error__unsupported_zstandard_window_size = "#zstd: unsupported Zstandard window size";
+const char* wuffs_zstd__error__internal_error_inconsistent_i_o = "#zstd: internal error: inconsistent I/O";
+
+// ---------------- Private Consts
+
+#define WUFFS_ZSTD__FSE_TABLE_LITERAL_LENGTHS 0
+
+#define WUFFS_ZSTD__FSE_TABLE_OFFSETS 1
+
+#define WUFFS_ZSTD__FSE_TABLE_MATCH_LENGTHS 2
+
+#define WUFFS_ZSTD__FSE_TABLE_HUFFMAN_WEIGHTS 3
+
+static const uint32_t //
+WUFFS_ZSTD__FSE_MAX_LOGS[4]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {9,8,9,6,};
+
+static const uint32_t //
+WUFFS_ZSTD__FSE_MAX_SYMBOLS[4]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {35,31,52,63,};
+
+static const uint8_t //
+WUFFS_ZSTD__DEFAULT_LITERAL_LENGTH_NORMS[36]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {5,4,3,3,3,3,3,3,3,3,3,3,3,2,2,2,3,3,3,3,3,3,3,3,3,4,3,2,2,2,2,2,0,0,0,0,};
+
+static const uint8_t //
+WUFFS_ZSTD__DEFAULT_OFFSET_NORMS[29]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {2,2,2,2,2,2,3,3,3,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,};
+
+static const uint8_t //
+WUFFS_ZSTD__DEFAULT_MATCH_LENGTH_NORMS[53]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {2,5,4,3,3,3,3,3,3,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,};
+
+static const uint32_t //
+WUFFS_ZSTD__LITERAL_LENGTH_BASES[36]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,18,20,22,24,28,32,40,48,64,128,256,512,1024,2048,4096,8192,16384,32768,65536,};
+
+static const uint8_t //
+WUFFS_ZSTD__LITERAL_LENGTH_EXTRA_BITS[36]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,2,2,3,3,4,6,7,8,9,10,11,12,13,14,15,16,};
+
+static const uint32_t //
+WUFFS_ZSTD__MATCH_LENGTH_BASES[53]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,37,39,41,43,47,51,59,67,83,99,131,259,515,1027,2051,4099,8195,16387,32771,65539,};
+
+static const uint8_t //
+WUFFS_ZSTD__MATCH_LENGTH_EXTRA_BITS[53]//
+ WUFFS_BASE__POTENTIALLY_UNUSED = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,2,2,3,3,4,4,5,7,8,9,10,11,12,13,14,15,16,};
+
+#define WUFFS_ZSTD__BLOCK_SIZE_MAX 131072
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_literals_section(wuffs_zstd__decoder *self);
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_huffman_table(wuffs_zstd__decoder *self,uint32_t a_end);
+
+static uint32_t//
+wuffs_zstd__decoder__bit_length(const wuffs_zstd__decoder *self,uint32_t a_x);
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_huffman_stream(wuffs_zstd__decoder *self,uint32_t a_start,uint32_t a_end,uint32_t a_out_start,uint32_t a_out_end);
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_sequences_header(wuffs_zstd__decoder *self);
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_fse_table(wuffs_zstd__decoder *self,uint32_t a_which,uint32_t a_mode);
+
+static wuffs_base__status//
+wuffs_zstd__decoder__read_fse_description(wuffs_zstd__decoder *self,uint32_t a_end,uint32_t a_max_log,uint32_t a_max_symbol);
+
+static uint32_t//
+wuffs_zstd__decoder__peek_bits(const wuffs_zstd__decoder *self,uint32_t a_bit_pos);
+
+static wuffs_base__status//
+wuffs_zstd__decoder__build_fse_table(wuffs_zstd__decoder *self,uint32_t a_which,uint32_t a_log,uint32_t a_n_symbols);
+
+static uint64_t//
+wuffs_zstd__decoder__fse_value(const wuffs_zstd__decoder *self,uint32_t a_which,uint32_t a_symbol);
+
+static wuffs_base__status//
+wuffs_zstd__decoder__init_bits(wuffs_zstd__decoder *self,uint32_t a_start,uint32_t a_end);
+
+static wuffs_base__empty_struct //
+wuffs_zstd__decoder__refill_bits(wuffs_zstd__decoder *self);
+
+static uint32_t//
+wuffs_zstd__decoder__read_bits(wuffs_zstd__decoder *self,uint32_t a_n);
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_sequence(wuffs_zstd__decoder *self);
+
+static wuffs_base__status //
+wuffs_zstd__decoder__decode_compressed_block(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status//
+wuffs_zstd__decoder__execute_sequences_fast(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status //
+wuffs_zstd__decoder__copy_match(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__empty_struct //
+wuffs_zstd__decoder__add_history(wuffs_zstd__decoder *self,wuffs_base__slice_u8 a_hist,wuffs_base__slice_u8 a_ring);
+
+static wuffs_base__status //
+wuffs_zstd__decoder__decode_frame(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status //
+wuffs_zstd__decoder__decode_raw_block(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,uint32_t a_n);
+
+static wuffs_base__status //
+wuffs_zstd__decoder__read_block(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_src,uint32_t a_n);
+
+static wuffs_base__empty_struct //
+wuffs_zstd__decoder__fill_literals(wuffs_zstd__decoder *self,uint8_t a_c,uint32_t a_n);
+
+static wuffs_base__status //
+wuffs_zstd__decoder__copy_literals(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,uint32_t a_n);
+
+// ---------------- VTables
+
+const wuffs_base__io_transformer__func_ptrs wuffs_zstd__decoder__func_ptrs_for__wuffs_base__io_transformer = {(wuffs_base__empty_struct (*)(void*,uint32_t,bool))(&wuffs_zstd__decoder__set_quirk_enabled),
+(wuffs_base__status (*)(void*,wuffs_base__io_buffer*,wuffs_base__io_buffer*,wuffs_base__slice_u8))(&wuffs_zstd__decoder__transform_io),
+(wuffs_base__range_ii_u64(*)(const void*))(&wuffs_zstd__decoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT  //
+wuffs_zstd__decoder__initialize(wuffs_zstd__decoder *self, size_t sizeof_star_self, uint64_t wuffs_version, uint32_t initialize_flags){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver); }
+if (sizeof(*self) != sizeof_star_self) {
+  return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+}
+if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) || (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+  return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+}
+
+if ((initialize_flags & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+  // The whole point of this if-check is to detect an uninitialized *self.
+  // We disable the warning on GCC. Clang-5.0 does not have this warning.
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  if (self->private_impl.magic != 0) {
+    return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+  }
+  #if !defined(__clang__) && defined(__GNUC__)
+  #pragma GCC diagnostic pop
+  #endif
+} else {
+  if ((initialize_flags & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+    memset(self, 0, sizeof(*self));
+    initialize_flags |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+  } else {
+    memset(&(self->private_impl), 0, sizeof(self->private_impl));
+  }
+}
+
+self->private_impl.magic = WUFFS_BASE__MAGIC;
+self->private_impl.vtable_for__wuffs_base__io_transformer.vtable_name = wuffs_base__io_transformer__vtable_name;
+self->private_impl.vtable_for__wuffs_base__io_transformer.function_pointers = (const void*)(&wuffs_zstd__decoder__func_ptrs_for__wuffs_base__io_transformer);
+return wuffs_base__make_status(NULL);
+}
+
+wuffs_zstd__decoder*  //
+wuffs_zstd__decoder__alloc(){
+wuffs_zstd__decoder* x = (wuffs_zstd__decoder*)(calloc(sizeof(wuffs_zstd__decoder), 1));
+if (!x) { return NULL; }
+if (wuffs_zstd__decoder__initialize(x, sizeof(wuffs_zstd__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+free(x); return NULL; }
+return x;
+}
+
+size_t  //
+sizeof__wuffs_zstd__decoder(){ return sizeof(wuffs_zstd__decoder); }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+WUFFS_BASE__MAYBE_STATIC wuffs_zstd__decoder__stats  //
+wuffs_zstd__decoder__get_stats(const wuffs_zstd__decoder* self) {
+wuffs_zstd__decoder__stats ret;
+if (!self) {
+memset(&ret, 0, sizeof(ret));
+return ret;
+}
+ret = self->private_impl.stats;
+return ret;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func zstd.decoder.decode_literals_section
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_literals_section(wuffs_zstd__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 0);
+
+uint32_t v_pos = 0;
+uint32_t v_avail = 0;
+uint32_t v_b0 = 0;
+uint32_t v_type = 0;
+uint32_t v_size_fmt = 0;
+uint64_t v_header = 0;
+uint32_t v_n_header = 0;
+uint32_t v_n_bits = 0;
+uint32_t v_regen = 0;
+uint32_t v_comp = 0;
+uint32_t v_start = 0;
+uint32_t v_end = 0;
+uint32_t v_seg = 0;
+uint32_t v_s1 = 0;
+uint32_t v_s2 = 0;
+uint32_t v_s3 = 0;
+uint32_t v_p1 = 0;
+uint32_t v_p2 = 0;
+uint32_t v_p3 = 0;
+wuffs_base__slice_u8 v_s = {0};
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+v_pos = self->private_impl.f_block_pos;
+if (self->private_impl.f_block_len <= v_pos) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+v_avail = (self->private_impl.f_block_len - v_pos);
+v_b0 = ((uint32_t)(self->private_data.f_block[v_pos]));
+v_type = (v_b0 & 3);
+v_size_fmt = ((v_b0 >> 2) & 3);
+if (v_type <= 1) {
+if ((v_size_fmt & 1) == 0) {
+v_n_header = 1;
+v_regen = (v_b0 >> 3);
+} else if (v_size_fmt == 1) {
+v_n_header = 2;
+v_regen = ((v_b0 >> 4) | (((uint32_t)(self->private_data.f_block[(v_pos + 1)])) << 4));
+} else {
+v_n_header = 3;
+v_regen = ((v_b0 >> 4) | (((uint32_t)(self->private_data.f_block[(v_pos + 1)])) << 4) | (((uint32_t)(self->private_data.f_block[(v_pos + 2)])) << 12));
+}
+if ((v_avail < v_n_header) || (v_regen > 131072)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+v_avail -= v_n_header;
+if (v_type == 0) {
+if (v_avail < v_regen) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+v_s = wuffs_base__slice_u8__subslice_i(wuffs_base__make_slice_u8(self->private_data.f_block, 131328),(v_pos + v_n_header));
+wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8(self->private_data.f_literals, 131072),wuffs_base__slice_u8__prefix(v_s,((uint64_t)(v_regen))));
+self->private_impl.f_block_pos = wuffs_base__u32__min(self->private_impl.f_block_len,(v_pos + v_n_header + v_regen));
+} else {
+if (v_avail < 1) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+wuffs_zstd__decoder__fill_literals(self,self->private_data.f_block[(v_pos + v_n_header)],v_regen);
+self->private_impl.f_block_pos = wuffs_base__u32__min(self->private_impl.f_block_len,(v_pos + v_n_header + 1));
+}
+self->private_impl.f_literals_len = v_regen;
+self->private_impl.f_literals_pos = 0;
+return wuffs_base__make_status(NULL);}
+v_n_header = 3;
+v_n_bits = 10;
+if (v_size_fmt == 2) {
+v_n_header = 4;
+v_n_bits = 14;
+} else if (v_size_fmt == 3) {
+v_n_header = 5;
+v_n_bits = 18;
+}
+if (v_avail < v_n_header) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+v_avail -= v_n_header;
+v_header = (((uint64_t)(v_b0)) | (((uint64_t)(self->private_data.f_block[(v_pos + 1)])) << 8) | (((uint64_t)(self->private_data.f_block[(v_pos + 2)])) << 16) | (((uint64_t)(self->private_data.f_block[(v_pos + 3)])) << 24) | (((uint64_t)(self->private_data.f_block[(v_pos + 4)])) << 32));
+v_regen = (((uint32_t)(((v_header >> 4) & 262143))) & ((((uint32_t)(1)) << v_n_bits) - 1));
+v_comp = (((uint32_t)(((v_header >> (4 + v_n_bits)) & 262143))) & ((((uint32_t)(1)) << v_n_bits) - 1));
+if ((v_regen > 131072) || (v_avail < v_comp)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+v_start = wuffs_base__u32__min(self->private_impl.f_block_len,(v_pos + v_n_header));
+v_end = wuffs_base__u32__min(self->private_impl.f_block_len,(v_start + v_comp));
+if (v_type == 2) {
+self->private_impl.f_block_pos = v_start;
+v_status = wuffs_zstd__decoder__decode_huffman_table(self,v_end);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+if (self->private_impl.f_block_pos > v_end) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+v_start = self->private_impl.f_block_pos;
+} else if (self->private_impl.f_huffman_log == 0) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+if (v_size_fmt == 0) {
+v_status = wuffs_zstd__decoder__decode_huffman_stream(self,v_start,v_end,0,v_regen);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+} else {
+if (v_end < v_start) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+v_comp = (v_end - v_start);
+if (v_comp < 6) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+v_comp -= 6;
+v_s1 = (((uint32_t)(self->private_data.f_block[(v_start + 0)])) | (((uint32_t)(self->private_data.f_block[(v_start + 1)])) << 8));
+v_s2 = (((uint32_t)(self->private_data.f_block[(v_start + 2)])) | (((uint32_t)(self->private_data.f_block[(v_start + 3)])) << 8));
+v_s3 = (((uint32_t)(self->private_data.f_block[(v_start + 4)])) | (((uint32_t)(self->private_data.f_block[(v_start + 5)])) << 8));
+if (v_comp < v_s1) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+v_comp -= v_s1;
+if (v_comp < v_s2) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+v_comp -= v_s2;
+if (v_comp < v_s3) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+v_start = wuffs_base__u32__min(v_end,(v_start + 6));
+v_p1 = wuffs_base__u32__min(v_end,(v_start + v_s1));
+v_p2 = wuffs_base__u32__min(v_end,(v_p1 + v_s2));
+v_p3 = wuffs_base__u32__min(v_end,(v_p2 + v_s3));
+v_seg = ((v_regen + 3) / 4);
+if ((v_seg * 3) > v_regen) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_literals);}
+v_status = wuffs_zstd__decoder__decode_huffman_stream(self,v_start,v_p1,0,v_seg);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+v_status = wuffs_zstd__decoder__decode_huffman_stream(self,v_p1,v_p2,v_seg,(v_seg * 2));
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+v_status = wuffs_zstd__decoder__decode_huffman_stream(self,v_p2,v_p3,(v_seg * 2),(v_seg * 3));
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+v_status = wuffs_zstd__decoder__decode_huffman_stream(self,v_p3,v_end,(v_seg * 3),v_regen);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+}
+self->private_impl.f_literals_len = v_regen;
+self->private_impl.f_literals_pos = 0;
+self->private_impl.f_block_pos = v_end;
+return wuffs_base__make_status(NULL);}
+
+// -------- func zstd.decoder.decode_huffman_table
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_huffman_table(wuffs_zstd__decoder *self,uint32_t a_end){
+WUFFS_BASE__STATS__CALL(self, 1);
+
+uint32_t v_pos = 0;
+uint32_t v_avail = 0;
+uint32_t v_header = 0;
+uint32_t v_n = 0;
+uint32_t v_n_symbols = 0;
+uint32_t v_i = 0;
+uint32_t v_c = 0;
+uint32_t v_state1 = 0;
+uint32_t v_state2 = 0;
+uint64_t v_entry = 0;
+uint32_t v_x = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+uint32_t v_w = 0;
+uint32_t v_sum = 0;
+uint32_t v_log = 0;
+uint32_t v_left = 0;
+uint32_t v_start = 0;
+uint32_t v_length = 0;
+uint32_t v_j = 0;
+
+v_pos = self->private_impl.f_block_pos;
+if (a_end <= v_pos) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+v_avail = (a_end - v_pos);
+v_header = ((uint32_t)(self->private_data.f_block[v_pos]));
+if (v_header >= 128) {
+v_n = (v_header - 127);
+if (((v_n + 1) / 2) >= v_avail) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+v_i = 0;
+while (v_i < v_n) {
+v_c = ((uint32_t)(self->private_data.f_block[(v_pos + 1 + (v_i >> 1))]));
+if ((v_i & 1) == 0) {
+v_c >>= 4;
+}
+self->private_data.f_weights[v_i] = ((uint8_t)((v_c & 15)));
+v_i += 1;
+}
+v_pos = wuffs_base__u32__min(a_end,(v_pos + 1 + ((v_n + 1) / 2)));
+} else {
+if ((v_header == 0) || (v_header >= v_avail)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+self->private_impl.f_block_pos = wuffs_base__u32__min(a_end,(v_pos + 1));
+v_pos = wuffs_base__u32__min(a_end,(v_pos + 1 + v_header));
+v_status = wuffs_zstd__decoder__read_fse_description(self,v_pos,6,15);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+v_status = wuffs_zstd__decoder__build_fse_table(self,3,self->private_impl.f_fse_log,self->private_impl.f_fse_n_symbols);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+v_status = wuffs_zstd__decoder__init_bits(self,self->private_impl.f_block_pos,v_pos);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+v_x = wuffs_zstd__decoder__read_bits(self,self->private_impl.f_fse_log);
+v_state1 = (v_x & 63);
+v_x = wuffs_zstd__decoder__read_bits(self,self->private_impl.f_fse_log);
+v_state2 = (v_x & 63);
+v_n = 0;
+while (true) {
+if (v_n >= 253) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+v_entry = self->private_data.f_fse_tables[3][v_state1];
+self->private_data.f_weights[v_n] = ((uint8_t)((v_entry & 255)));
+wuffs_zstd__decoder__refill_bits(self);
+v_x = wuffs_zstd__decoder__read_bits(self,((uint32_t)(((v_entry >> 40) & 15))));
+v_state1 = ((((uint32_t)((v_entry >> 48))) + v_x) & 63);
+if (self->private_impl.f_n_bits > 64) {
+v_entry = self->private_data.f_fse_tables[3][v_state2];
+self->private_data.f_weights[(v_n + 1)] = ((uint8_t)((v_entry & 255)));
+v_n += 2;
+goto label__0__break;
+}
+v_entry = self->private_data.f_fse_tables[3][v_state2];
+self->private_data.f_weights[(v_n + 1)] = ((uint8_t)((v_entry & 255)));
+wuffs_zstd__decoder__refill_bits(self);
+v_x = wuffs_zstd__decoder__read_bits(self,((uint32_t)(((v_entry >> 40) & 15))));
+v_state2 = ((((uint32_t)((v_entry >> 48))) + v_x) & 63);
+if (self->private_impl.f_n_bits > 64) {
+v_entry = self->private_data.f_fse_tables[3][v_state1];
+self->private_data.f_weights[(v_n + 2)] = ((uint8_t)((v_entry & 255)));
+v_n += 3;
+goto label__0__break;
+}
+v_n += 2;
+}
+label__0__break:;
+}
+v_sum = 0;
+v_i = 0;
+while (v_i < v_n) {
+v_w = ((uint32_t)(self->private_data.f_weights[v_i]));
+if (v_w > 11) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);} else if (v_w > 0) {
+v_sum += (((uint32_t)(1)) << (v_w - 1));
+}
+v_i += 1;
+}
+v_x = wuffs_zstd__decoder__bit_length(self,v_sum);
+if ((v_x == 0) || (v_x > 11)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+v_log = v_x;
+v_left = ((((uint32_t)(1)) << v_log) - v_sum);
+if ((v_left == 0) || ((v_left & (v_left - 1)) != 0)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+self->private_data.f_weights[v_n] = ((uint8_t)(wuffs_zstd__decoder__bit_length(self,v_left)));
+v_n_symbols = (v_n + 1);
+v_i = 0;
+while (v_i < 16) {
+self->private_data.f_symbol_next[v_i] = 0;
+v_i += 1;
+}
+v_i = 0;
+while (v_i < v_n_symbols) {
+v_w = (((uint32_t)(self->private_data.f_weights[v_i])) & 15);
+self->private_data.f_symbol_next[v_w] += 1;
+v_i += 1;
+}
+v_start = 0;
+v_w = 1;
+while (v_w < 16) {
+v_x = self->private_data.f_symbol_next[v_w];
+self->private_data.f_symbol_next[v_w] = v_start;
+v_start += ((v_x << v_w) >> 1);
+v_w += 1;
+}
+if (v_start != (((uint32_t)(1)) << v_log)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+v_i = 0;
+while (v_i < v_n_symbols) {
+v_w = (((uint32_t)(self->private_data.f_weights[v_i])) & 15);
+if ((v_w > 0) && (v_w <= v_log)) {
+v_length = (((uint32_t)(1)) << (v_w - 1));
+v_start = self->private_data.f_symbol_next[v_w];
+self->private_data.f_symbol_next[v_w] = (v_start + v_length);
+v_j = 0;
+while (v_j < v_length) {
+self->private_data.f_huffman_table[((v_start + v_j) & 2047)] = ((uint16_t)((((v_i & 255) << 8) | (((v_log + 1) - v_w) & 15))));
+v_j += 1;
+}
+}
+v_i += 1;
+}
+self->private_impl.f_huffman_log = v_log;
+self->private_impl.f_block_pos = v_pos;
+return wuffs_base__make_status(NULL);}
+
+// -------- func zstd.decoder.bit_length
+
+static uint32_t//
+wuffs_zstd__decoder__bit_length(const wuffs_zstd__decoder *self,uint32_t a_x){
+
+uint32_t v_n = 0;
+uint32_t v_y = 0;
+
+v_y = a_x;
+while ((v_y > 0) && (v_n < 32)) {
+v_y >>= 1;
+v_n += 1;
+}
+return v_n;}
+
+// -------- func zstd.decoder.decode_huffman_stream
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_huffman_stream(wuffs_zstd__decoder *self,uint32_t a_start,uint32_t a_end,uint32_t a_out_start,uint32_t a_out_end){
+WUFFS_BASE__STATS__CALL(self, 2);
+
+uint64_t v_bits = 0;
+uint32_t v_n_bits = 0;
+uint32_t v_pos = 0;
+uint32_t v_log = 0;
+uint32_t v_out = 0;
+uint32_t v_entry = 0;
+uint32_t v_k = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+v_log = self->private_impl.f_huffman_log;
+if (v_log == 0) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+v_status = wuffs_zstd__decoder__init_bits(self,a_start,a_end);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+v_bits = self->private_impl.f_bits;
+v_n_bits = self->private_impl.f_n_bits;
+v_pos = self->private_impl.f_bits_pos;
+v_out = a_out_start;
+while (v_out < a_out_end) {
+if (v_n_bits <= 56) {
+if (v_pos >= (a_start + 8)) {
+v_bits |= (((((uint64_t)(self->private_data.f_block[(v_pos - 1)])) << 56) | (((uint64_t)(self->private_data.f_block[(v_pos - 2)])) << 48) | (((uint64_t)(self->private_data.f_block[(v_pos - 3)])) << 40) | (((uint64_t)(self->private_data.f_block[(v_pos - 4)])) << 32) | (((uint64_t)(self->private_data.f_block[(v_pos - 5)])) << 24) | (((uint64_t)(self->private_data.f_block[(v_pos - 6)])) << 16) | (((uint64_t)(self->private_data.f_block[(v_pos - 7)])) << 8) | (((uint64_t)(self->private_data.f_block[(v_pos - 8)])) << 0)) >> v_n_bits);
+v_k = ((64 - v_n_bits) >> 3);
+v_pos -= v_k;
+v_n_bits += (v_k * 8);
+} else {
+while ((v_n_bits <= 56) && (v_pos > a_start)) {
+v_pos -= 1;
+v_bits |= (((uint64_t)(self->private_data.f_block[v_pos])) << (56 - v_n_bits));
+v_n_bits += 8;
+}
+}
+}
+v_k = 0;
+while ((v_k < 4) && (v_out < a_out_end)) {
+v_entry = ((uint32_t)(self->private_data.f_huffman_table[(((v_bits >> 1) >> (63 - v_log)) & 2047)]));
+self->private_data.f_literals[v_out] = ((uint8_t)((v_entry >> 8)));
+v_bits <<= (v_entry & 15);
+v_n_bits -= (v_entry & 15);
+v_out += 1;
+v_k += 1;
+}
+}
+if ((v_n_bits != 0) || (v_pos != a_start)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_huffman_code);}
+return wuffs_base__make_status(NULL);}
+
+// -------- func zstd.decoder.decode_sequences_header
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_sequences_header(wuffs_zstd__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 3);
+
+uint32_t v_pos = 0;
+uint32_t v_avail = 0;
+uint32_t v_b0 = 0;
+uint32_t v_modes = 0;
+uint32_t v_x = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+v_pos = self->private_impl.f_block_pos;
+if (self->private_impl.f_block_len <= v_pos) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+v_avail = (self->private_impl.f_block_len - v_pos);
+v_b0 = ((uint32_t)(self->private_data.f_block[v_pos]));
+if (v_b0 < 128) {
+self->private_impl.f_n_sequences = v_b0;
+v_pos = wuffs_base__u32__min(self->private_impl.f_block_len,(v_pos + 1));
+} else if (v_b0 < 255) {
+if (v_avail < 2) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+self->private_impl.f_n_sequences = (((v_b0 - 128) << 8) | ((uint32_t)(self->private_data.f_block[(v_pos + 1)])));
+v_pos = wuffs_base__u32__min(self->private_impl.f_block_len,(v_pos + 2));
+} else {
+if (v_avail < 3) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+self->private_impl.f_n_sequences = ((((uint32_t)(self->private_data.f_block[(v_pos + 1)])) | (((uint32_t)(self->private_data.f_block[(v_pos + 2)])) << 8)) + 32512);
+v_pos = wuffs_base__u32__min(self->private_impl.f_block_len,(v_pos + 3));
+}
+if (self->private_impl.f_n_sequences == 0) {
+if (v_pos != self->private_impl.f_block_len) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+self->private_impl.f_block_pos = v_pos;
+return wuffs_base__make_status(NULL);}
+if (self->private_impl.f_block_len <= v_pos) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+v_modes = ((uint32_t)(self->private_data.f_block[v_pos]));
+if ((v_modes & 3) != 0) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+self->private_impl.f_block_pos = wuffs_base__u32__min(self->private_impl.f_block_len,(v_pos + 1));
+v_status = wuffs_zstd__decoder__decode_fse_table(self,0,(v_modes >> 6));
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+v_status = wuffs_zstd__decoder__decode_fse_table(self,1,((v_modes >> 4) & 3));
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+v_status = wuffs_zstd__decoder__decode_fse_table(self,2,((v_modes >> 2) & 3));
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+v_status = wuffs_zstd__decoder__init_bits(self,self->private_impl.f_block_pos,self->private_impl.f_block_len);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+v_x = wuffs_zstd__decoder__read_bits(self,self->private_impl.f_fse_logs[0]);
+self->private_impl.f_ll_state = (v_x & 511);
+v_x = wuffs_zstd__decoder__read_bits(self,self->private_impl.f_fse_logs[1]);
+self->private_impl.f_of_state = (v_x & 511);
+v_x = wuffs_zstd__decoder__read_bits(self,self->private_impl.f_fse_logs[2]);
+self->private_impl.f_ml_state = (v_x & 511);
+self->private_impl.f_block_pos = self->private_impl.f_block_len;
+return wuffs_base__make_status(NULL);}
+
+// -------- func zstd.decoder.decode_fse_table
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_fse_table(wuffs_zstd__decoder *self,uint32_t a_which,uint32_t a_mode){
+WUFFS_BASE__STATS__CALL(self, 4);
+
+uint32_t v_i = 0;
+uint32_t v_c = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+if (a_mode == 0) {
+v_i = 0;
+if (a_which == 0) {
+while (v_i < 36) {
+self->private_data.f_norms[v_i] = ((uint32_t)(WUFFS_ZSTD__DEFAULT_LITERAL_LENGTH_NORMS[v_i]));
+v_i += 1;
+}
+v_status = wuffs_zstd__decoder__build_fse_table(self,a_which,6,36);
+} else if (a_which == 1) {
+while (v_i < 29) {
+self->private_data.f_norms[v_i] = ((uint32_t)(WUFFS_ZSTD__DEFAULT_OFFSET_NORMS[v_i]));
+v_i += 1;
+}
+v_status = wuffs_zstd__decoder__build_fse_table(self,a_which,5,29);
+} else {
+while (v_i < 53) {
+self->private_data.f_norms[v_i] = ((uint32_t)(WUFFS_ZSTD__DEFAULT_MATCH_LENGTH_NORMS[v_i]));
+v_i += 1;
+}
+v_status = wuffs_zstd__decoder__build_fse_table(self,a_which,6,53);
+}
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+} else if (a_mode == 1) {
+if (self->private_impl.f_block_len <= self->private_impl.f_block_pos) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+v_c = ((uint32_t)(self->private_data.f_block[self->private_impl.f_block_pos]));
+self->private_impl.f_block_pos = wuffs_base__u32__min(self->private_impl.f_block_len,(self->private_impl.f_block_pos + 1));
+if (v_c > WUFFS_ZSTD__FSE_MAX_SYMBOLS[a_which]) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+self->private_data.f_fse_tables[a_which][0] = wuffs_zstd__decoder__fse_value(self,a_which,v_c);
+self->private_impl.f_fse_logs[a_which] = 0;
+} else if (a_mode == 2) {
+v_status = wuffs_zstd__decoder__read_fse_description(self,self->private_impl.f_block_len,WUFFS_ZSTD__FSE_MAX_LOGS[a_which],WUFFS_ZSTD__FSE_MAX_SYMBOLS[a_which]);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+v_status = wuffs_zstd__decoder__build_fse_table(self,a_which,self->private_impl.f_fse_log,self->private_impl.f_fse_n_symbols);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+return v_status;}
+} else if ( ! self->private_impl.f_fse_valid[a_which]) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+self->private_impl.f_fse_valid[a_which] = true;
+return wuffs_base__make_status(NULL);}
+
+// -------- func zstd.decoder.read_fse_description
+
+static wuffs_base__status//
+wuffs_zstd__decoder__read_fse_description(wuffs_zstd__decoder *self,uint32_t a_end,uint32_t a_max_log,uint32_t a_max_symbol){
+WUFFS_BASE__STATS__CALL(self, 5);
+
+uint32_t v_pos = 0;
+uint32_t v_x = 0;
+uint32_t v_log = 0;
+uint32_t v_remaining = 0;
+uint32_t v_threshold = 0;
+uint32_t v_mask2 = 0;
+uint32_t v_max = 0;
+uint32_t v_nb = 0;
+uint32_t v_symbol = 0;
+uint32_t v_n0 = 0;
+uint32_t v_v = 0;
+bool v_prev0 = false;
+
+v_pos = (self->private_impl.f_block_pos * 8);
+v_x = wuffs_zstd__decoder__peek_bits(self,v_pos);
+v_v = ((v_x & 15) + 5);
+v_pos += 4;
+if (v_v > a_max_log) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+v_log = v_v;
+v_remaining = ((((uint32_t)(1)) << v_log) + 1);
+v_threshold = (((uint32_t)(1)) << v_log);
+v_nb = (v_log + 1);
+while ((v_remaining > 1) && (v_symbol <= a_max_symbol)) {
+if ((v_pos >> 3) > a_end) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+if (v_prev0) {
+v_n0 = ((uint32_t)(v_symbol));
+while (true) {
+v_x = wuffs_zstd__decoder__peek_bits(self,v_pos);
+if ((v_x & 65535) != 65535) {
+goto label__0__break;
+}
+v_n0 += 24;
+v_pos += 16;
+if (v_n0 > 64) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+}
+label__0__break:;
+while ((v_x & 3) == 3) {
+v_n0 += 3;
+v_x >>= 2;
+v_pos += 2;
+}
+v_n0 += (v_x & 3);
+v_pos += 2;
+if (v_n0 > a_max_symbol) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+while (v_symbol < v_n0) {
+if (v_symbol >= 64) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+self->private_data.f_norms[v_symbol] = 1;
+v_symbol += 1;
+}
+if (v_symbol > a_max_symbol) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+}
+v_x = wuffs_zstd__decoder__peek_bits(self,v_pos);
+v_mask2 = ((v_threshold << 1) - 1);
+if (v_mask2 < v_remaining) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+v_max = (v_mask2 - v_remaining);
+if ((v_x & (v_threshold - 1)) < v_max) {
+v_v = (v_x & (v_threshold - 1));
+v_pos += (v_nb - 1);
+} else {
+v_v = (v_x & v_mask2);
+if (v_v >= v_threshold) {
+v_v -= v_max;
+}
+v_pos += v_nb;
+}
+if (v_v == 0) {
+v_remaining -= 1;
+} else if (v_remaining <= (v_v - 1)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);} else {
+v_remaining -= (v_v - 1);
+}
+self->private_data.f_norms[v_symbol] = v_v;
+v_symbol += 1;
+v_prev0 = (v_v == 1);
+while ((v_remaining < v_threshold) && (v_threshold > 1)) {
+v_threshold >>= 1;
+v_nb -= 1;
+}
+}
+if (v_remaining != 1) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+v_pos = ((v_pos + 7) >> 3);
+if (v_pos > a_end) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+self->private_impl.f_block_pos = wuffs_base__u32__min(v_pos,a_end);
+self->private_impl.f_fse_log = v_log;
+self->private_impl.f_fse_n_symbols = v_symbol;
+return wuffs_base__make_status(NULL);}
+
+// -------- func zstd.decoder.peek_bits
+
+static uint32_t//
+wuffs_zstd__decoder__peek_bits(const wuffs_zstd__decoder *self,uint32_t a_bit_pos){
+
+uint32_t v_i = 0;
+
+v_i = wuffs_base__u32__min(131072,(a_bit_pos >> 3));
+return ((((uint32_t)(self->private_data.f_block[v_i])) | (((uint32_t)(self->private_data.f_block[(v_i + 1)])) << 8) | (((uint32_t)(self->private_data.f_block[(v_i + 2)])) << 16) | (((uint32_t)(self->private_data.f_block[(v_i + 3)])) << 24)) >> (a_bit_pos & 7));}
+
+// -------- func zstd.decoder.build_fse_table
+
+static wuffs_base__status//
+wuffs_zstd__decoder__build_fse_table(wuffs_zstd__decoder *self,uint32_t a_which,uint32_t a_log,uint32_t a_n_symbols){
+WUFFS_BASE__STATS__CALL(self, 6);
+
+uint32_t v_size = 0;
+uint32_t v_high = 0;
+uint32_t v_s = 0;
+uint32_t v_norm = 0;
+uint32_t v_count = 0;
+uint32_t v_step = 0;
+uint32_t v_p = 0;
+uint32_t v_state = 0;
+uint32_t v_ns = 0;
+uint32_t v_nb = 0;
+
+v_size = (((uint32_t)(1)) << a_log);
+v_high = v_size;
+v_s = 0;
+while (v_s < a_n_symbols) {
+v_norm = self->private_data.f_norms[v_s];
+if (v_norm == 0) {
+if (v_high < 1) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+v_high -= 1;
+self->private_data.f_fse_symbols[v_high] = ((uint8_t)(v_s));
+self->private_data.f_symbol_next[v_s] = 1;
+} else {
+self->private_data.f_symbol_next[v_s] = (v_norm - 1);
+}
+v_s += 1;
+}
+v_step = ((v_size >> 1) + (v_size >> 3) + 3);
+v_p = 0;
+v_s = 0;
+while (v_s < a_n_symbols) {
+v_count = self->private_data.f_norms[v_s];
+while (v_count > 1) {
+self->private_data.f_fse_symbols[(v_p & 511)] = ((uint8_t)(v_s));
+v_p = ((v_p + v_step) & (v_size - 1));
+while (v_p >= v_high) {
+v_p = ((v_p + v_step) & (v_size - 1));
+}
+v_count -= 1;
+}
+v_s += 1;
+}
+if (v_p != 0) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_fse_table);}
+v_state = 0;
+while (v_state < v_size) {
+v_s = (((uint32_t)(self->private_data.f_fse_symbols[v_state])) & 63);
+v_ns = self->private_data.f_symbol_next[v_s];
+self->private_data.f_symbol_next[v_s] = (v_ns + 1);
+v_nb = 0;
+while (((v_ns << v_nb) < v_size) && (v_nb < 9)) {
+v_nb += 1;
+}
+self->private_data.f_fse_tables[a_which][v_state] = ((((uint64_t)((((v_ns << v_nb) - v_size) & 65535))) << 48) | (((uint64_t)(v_nb)) << 40) | wuffs_zstd__decoder__fse_value(self,a_which,v_s));
+v_state += 1;
+}
+self->private_impl.f_fse_logs[a_which] = a_log;
+return wuffs_base__make_status(NULL);}
+
+// -------- func zstd.decoder.fse_value
+
+static uint64_t//
+wuffs_zstd__decoder__fse_value(const wuffs_zstd__decoder *self,uint32_t a_which,uint32_t a_symbol){
+
+
+if (a_which == 0) {
+if (a_symbol < 36) {
+return (((uint64_t)(WUFFS_ZSTD__LITERAL_LENGTH_BASES[a_symbol])) | (((uint64_t)(WUFFS_ZSTD__LITERAL_LENGTH_EXTRA_BITS[a_symbol])) << 32));}
+} else if (a_which == 1) {
+if (a_symbol < 32) {
+return ((((uint64_t)(1)) << a_symbol) | (((uint64_t)(a_symbol)) << 32));}
+} else if (a_which == 2) {
+if (a_symbol < 53) {
+return (((uint64_t)(WUFFS_ZSTD__MATCH_LENGTH_BASES[a_symbol])) | (((uint64_t)(WUFFS_ZSTD__MATCH_LENGTH_EXTRA_BITS[a_symbol])) << 32));}
+}
+return ((uint64_t)(a_symbol));}
+
+// -------- func zstd.decoder.init_bits
+
+static wuffs_base__status//
+wuffs_zstd__decoder__init_bits(wuffs_zstd__decoder *self,uint32_t a_start,uint32_t a_end){
+WUFFS_BASE__STATS__CALL(self, 7);
+
+uint32_t v_c = 0;
+
+if (a_end <= a_start) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+v_c = ((uint32_t)(self->private_data.f_block[(a_end - 1)]));
+if (v_c == 0) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+self->private_impl.f_bits = (((uint64_t)(v_c)) << 56);
+self->private_impl.f_n_bits = 7;
+while ((self->private_impl.f_bits >> 63) == 0) {
+self->private_impl.f_bits <<= 1;
+self->private_impl.f_n_bits -= 1;
+}
+self->private_impl.f_bits <<= 1;
+self->private_impl.f_bits_pos = (a_end - 1);
+self->private_impl.f_bits_start = a_start;
+wuffs_zstd__decoder__refill_bits(self);
+return wuffs_base__make_status(NULL);}
+
+// -------- func zstd.decoder.refill_bits
+
+static wuffs_base__empty_struct //
+wuffs_zstd__decoder__refill_bits(wuffs_zstd__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 8);
+
+uint32_t v_pos = 0;
+uint32_t v_n_bits = 0;
+uint32_t v_k = 0;
+
+if (self->private_impl.f_n_bits > 56) {
+return wuffs_base__make_empty_struct();}
+v_n_bits = self->private_impl.f_n_bits;
+v_pos = self->private_impl.f_bits_pos;
+if (v_pos >= (self->private_impl.f_bits_start + 8)) {
+self->private_impl.f_bits |= (((((uint64_t)(self->private_data.f_block[(v_pos - 1)])) << 56) | (((uint64_t)(self->private_data.f_block[(v_pos - 2)])) << 48) | (((uint64_t)(self->private_data.f_block[(v_pos - 3)])) << 40) | (((uint64_t)(self->private_data.f_block[(v_pos - 4)])) << 32) | (((uint64_t)(self->private_data.f_block[(v_pos - 5)])) << 24) | (((uint64_t)(self->private_data.f_block[(v_pos - 6)])) << 16) | (((uint64_t)(self->private_data.f_block[(v_pos - 7)])) << 8) | (((uint64_t)(self->private_data.f_block[(v_pos - 8)])) << 0)) >> v_n_bits);
+v_k = ((64 - v_n_bits) >> 3);
+self->private_impl.f_bits_pos = (v_pos - v_k);
+self->private_impl.f_n_bits = (v_n_bits + (v_k * 8));
+return wuffs_base__make_empty_struct();}
+while ((v_n_bits <= 56) && (v_pos > self->private_impl.f_bits_start)) {
+v_pos -= 1;
+self->private_impl.f_bits |= (((uint64_t)(self->private_data.f_block[v_pos])) << (56 - v_n_bits));
+v_n_bits += 8;
+}
+self->private_impl.f_bits_pos = v_pos;
+self->private_impl.f_n_bits = v_n_bits;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func zstd.decoder.read_bits
+
+static uint32_t//
+wuffs_zstd__decoder__read_bits(wuffs_zstd__decoder *self,uint32_t a_n){
+WUFFS_BASE__STATS__CALL(self, 9);
+
+uint64_t v_x = 0;
+
+v_x = ((self->private_impl.f_bits >> 1) >> (63 - a_n));
+self->private_impl.f_bits <<= a_n;
+self->private_impl.f_n_bits -= a_n;
+return ((uint32_t)((v_x & 2147483647)));}
+
+// -------- func zstd.decoder.decode_sequence
+
+static wuffs_base__status//
+wuffs_zstd__decoder__decode_sequence(wuffs_zstd__decoder *self){
+WUFFS_BASE__STATS__CALL(self, 10);
+
+uint64_t v_ll_entry = 0;
+uint64_t v_of_entry = 0;
+uint64_t v_ml_entry = 0;
+uint64_t v_bits = 0;
+uint32_t v_n_bits = 0;
+uint32_t v_n = 0;
+uint32_t v_ll = 0;
+uint32_t v_ml = 0;
+uint32_t v_of = 0;
+
+if (self->private_impl.f_n_sequences <= 0) {
+return wuffs_base__make_status(wuffs_zstd__error__internal_error_inconsistent_i_o);}
+self->private_impl.f_n_sequences -= 1;
+v_ll_entry = self->private_data.f_fse_tables[0][self->private_impl.f_ll_state];
+v_of_entry = self->private_data.f_fse_tables[1][self->private_impl.f_of_state];
+v_ml_entry = self->private_data.f_fse_tables[2][self->private_impl.f_ml_state];
+wuffs_zstd__decoder__refill_bits(self);
+v_bits = self->private_impl.f_bits;
+v_n_bits = self->private_impl.f_n_bits;
+v_n = ((uint32_t)(((v_of_entry >> 32) & 31)));
+v_of = (((uint32_t)((v_of_entry & 4294967295))) + ((uint32_t)((((v_bits >> 1) >> (63 - v_n)) & 2147483647))));
+v_bits <<= v_n;
+v_n_bits -= v_n;
+v_n = ((uint32_t)(((v_ml_entry >> 32) & 31)));
+v_ml = (((uint32_t)((v_ml_entry & 4294967295))) + ((uint32_t)((((v_bits >> 1) >> (63 - v_n)) & 2147483647))));
+v_bits <<= v_n;
+v_n_bits -= v_n;
+self->private_impl.f_bits = v_bits;
+self->private_impl.f_n_bits = v_n_bits;
+wuffs_zstd__decoder__refill_bits(self);
+v_bits = self->private_impl.f_bits;
+v_n_bits = self->private_impl.f_n_bits;
+v_n = ((uint32_t)(((v_ll_entry >> 32) & 31)));
+v_ll = (((uint32_t)((v_ll_entry & 4294967295))) + ((uint32_t)((((v_bits >> 1) >> (63 - v_n)) & 2147483647))));
+v_bits <<= v_n;
+v_n_bits -= v_n;
+if (self->private_impl.f_n_sequences > 0) {
+v_n = ((uint32_t)(((v_ll_entry >> 40) & 15)));
+self->private_impl.f_ll_state = ((((uint32_t)((v_ll_entry >> 48))) + ((uint32_t)((((v_bits >> 1) >> (63 - v_n)) & 32767)))) & 511);
+v_bits <<= v_n;
+v_n_bits -= v_n;
+v_n = ((uint32_t)(((v_ml_entry >> 40) & 15)));
+self->private_impl.f_ml_state = ((((uint32_t)((v_ml_entry >> 48))) + ((uint32_t)((((v_bits >> 1) >> (63 - v_n)) & 32767)))) & 511);
+v_bits <<= v_n;
+v_n_bits -= v_n;
+v_n = ((uint32_t)(((v_of_entry >> 40) & 15)));
+self->private_impl.f_of_state = ((((uint32_t)((v_of_entry >> 48))) + ((uint32_t)((((v_bits >> 1) >> (63 - v_n)) & 32767)))) & 511);
+v_bits <<= v_n;
+v_n_bits -= v_n;
+} else if ((v_n_bits != 0) || (self->private_impl.f_bits_pos != self->private_impl.f_bits_start)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+self->private_impl.f_bits = v_bits;
+self->private_impl.f_n_bits = v_n_bits;
+if (v_of > 3) {
+v_of -= 3;
+self->private_impl.f_rep2 = self->private_impl.f_rep1;
+self->private_impl.f_rep1 = self->private_impl.f_rep0;
+self->private_impl.f_rep0 = v_of;
+} else {
+if (v_ll == 0) {
+v_of += 1;
+}
+if (v_of == 1) {
+v_of = self->private_impl.f_rep0;
+} else if (v_of == 2) {
+v_of = self->private_impl.f_rep1;
+self->private_impl.f_rep1 = self->private_impl.f_rep0;
+self->private_impl.f_rep0 = v_of;
+} else {
+if (v_of == 3) {
+v_of = self->private_impl.f_rep2;
+} else {
+v_of = (self->private_impl.f_rep0 - 1);
+if (v_of == 0) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_offset);}
+}
+self->private_impl.f_rep2 = self->private_impl.f_rep1;
+self->private_impl.f_rep1 = self->private_impl.f_rep0;
+self->private_impl.f_rep0 = v_of;
+}
+}
+if (self->private_impl.f_literals_len < self->private_impl.f_literals_pos) {
+return wuffs_base__make_status(wuffs_zstd__error__internal_error_inconsistent_i_o);}
+if (v_ll > (self->private_impl.f_literals_len - self->private_impl.f_literals_pos)) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+if (self->private_impl.f_seq_budget < v_ml) {
+return wuffs_base__make_status(wuffs_zstd__error__bad_sequences);}
+self->private_impl.f_seq_budget -= v_ml;
+self->private_impl.f_seq_literal_len = v_ll;
+self->private_impl.f_seq_match_len = v_ml;
+self->private_impl.f_seq_offset = v_of;
+return wuffs_base__make_status(NULL);}
+
+// -------- func zstd.decoder.decode_compressed_block
+
+static wuffs_base__status //
+wuffs_zstd__decoder__decode_compressed_block(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__slice_u8 a_workbuf){
+WUFFS_BASE__STATS__CALL(self, 11);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+uint32_t coro_susp_point = self->private_impl.p_decode_compressed_block[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+v_status = wuffs_zstd__decoder__decode_literals_section(self);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+if (self->private_impl.f_block_max_size < self->private_impl.f_literals_len) {
+status = wuffs_base__make_status(wuffs_zstd__error__bad_literals);goto exit;}
+self->private_impl.f_seq_budget = (self->private_impl.f_block_max_size - self->private_impl.f_literals_len);
+v_status = wuffs_zstd__decoder__decode_sequences_header(self);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+while (true) {
+v_status = wuffs_zstd__decoder__execute_sequences_fast(self,a_dst,a_workbuf);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+if ( ! self->private_impl.f_seq_pending) {
+goto label__0__break;
+}
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+status = wuffs_zstd__decoder__copy_literals(self,a_dst,self->private_impl.f_seq_literal_len);
+if (status.repr) { goto suspend; }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+status = wuffs_zstd__decoder__copy_match(self,a_dst,a_workbuf);
+if (status.repr) { goto suspend; }
+self->private_impl.f_seq_pending = false;
+}
+label__0__break:;
+if (self->private_impl.f_literals_len < self->private_impl.f_literals_pos) {
+status = wuffs_base__make_status(wuffs_zstd__error__internal_error_inconsistent_i_o);goto exit;}
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+status = wuffs_zstd__decoder__copy_literals(self,a_dst,(self->private_impl.f_literals_len - self->private_impl.f_literals_pos));
+if (status.repr) { goto suspend; }
+
+goto ok;ok:self->private_impl.p_decode_compressed_block[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_compressed_block[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:return status;
+}
+
+// -------- func zstd.decoder.execute_sequences_fast
+
+static wuffs_base__status//
+wuffs_zstd__decoder__execute_sequences_fast(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__slice_u8 a_workbuf){
+WUFFS_BASE__STATS__CALL(self, 12);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+uint32_t v_ll = 0;
+uint32_t v_ml = 0;
+uint32_t v_offset = 0;
+wuffs_base__slice_u8 v_ring = {0};
+uint64_t v_hdist = 0;
+uint64_t v_i = 0;
+uint32_t v_hlen = 0;
+uint32_t v_n_copied = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+
+v_ring = wuffs_base__slice_u8__prefix(a_workbuf,((uint64_t)(self->private_impl.f_window_size)));
+label__loop__continue:;
+while (self->private_impl.f_n_sequences > 0) {
+v_status = wuffs_zstd__decoder__decode_sequence(self);
+if ( ! wuffs_base__status__is_ok(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+v_ll = self->private_impl.f_seq_literal_len;
+v_ml = self->private_impl.f_seq_match_len;
+v_offset = self->private_impl.f_seq_offset;
+if ((((uint64_t)((v_ll + v_ml))) + 8) > ((uint64_t)(io2_a_dst - iop_a_dst))) {
+self->private_impl.f_seq_pending = true;
+status = wuffs_base__make_status(NULL);goto ok;}
+if (self->private_impl.f_literals_pos > self->private_impl.f_literals_len) {
+status = wuffs_base__make_status(wuffs_zstd__error__internal_error_inconsistent_i_o);goto exit;}
+v_n_copied = wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,v_ll,wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_literals, 131072),self->private_impl.f_literals_pos,self->private_impl.f_literals_len));
+self->private_impl.f_literals_pos = wuffs_base__u32__min(self->private_impl.f_literals_len,(self->private_impl.f_literals_pos + wuffs_base__u32__min(v_n_copied,131072)));
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_frame_produced,((uint64_t)(v_n_copied)));
+if ((((uint64_t)(v_offset)) > self->private_impl.f_frame_produced) || (v_offset > self->private_impl.f_window_size)) {
+status = wuffs_base__make_status(wuffs_zstd__error__bad_offset);goto exit;}
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_frame_produced,((uint64_t)(v_ml)));
+if (((uint64_t)(v_offset)) > ((uint64_t)(iop_a_dst - io0_a_dst))) {
+v_hdist = (((uint64_t)(v_offset)) - ((uint64_t)(iop_a_dst - io0_a_dst)));
+v_i = ((uint64_t)(self->private_impl.f_history_index));
+if (v_i >= v_hdist) {
+v_i -= v_hdist;
+} else {
+v_i = ((v_i + ((uint64_t)(v_ring.len))) - v_hdist);
+}
+if (v_i >= ((uint64_t)(v_ring.len))) {
+status = wuffs_base__make_status(wuffs_zstd__error__internal_error_inconsistent_i_o);goto exit;}
+v_hlen = wuffs_base__u32__min(v_ml,((uint32_t)(wuffs_base__u64__min(v_hdist,131072))));
+v_n_copied = wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,v_hlen,wuffs_base__slice_u8__subslice_i(v_ring,v_i));
+if (v_hlen > v_n_copied) {
+wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,(v_hlen - v_n_copied),v_ring);
+}
+if (v_ml <= v_hlen) {
+goto label__loop__continue;
+}
+v_ml -= v_hlen;
+if (((uint64_t)(v_offset)) > ((uint64_t)(iop_a_dst - io0_a_dst))) {
+status = wuffs_base__make_status(wuffs_zstd__error__internal_error_inconsistent_i_o);goto exit;}
+}
+if ((((uint64_t)(v_ml)) + 8) > ((uint64_t)(io2_a_dst - iop_a_dst))) {
+status = wuffs_base__make_status(wuffs_zstd__error__internal_error_inconsistent_i_o);goto exit;}
+if (v_offset >= 8) {
+wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast(&iop_a_dst, io0_a_dst, io2_a_dst,v_ml,v_offset);
+} else if (v_offset == 1) {
+wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_distance_1_fast(&iop_a_dst, io0_a_dst, io2_a_dst,v_ml,v_offset);
+} else if (v_offset > 0) {
+wuffs_base__io_writer__copy_n32_from_history_fast(&iop_a_dst, io0_a_dst, io2_a_dst,v_ml,v_offset);
+}
+}
+status = wuffs_base__make_status(NULL);goto ok;
+goto ok;ok:
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 12, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+
+return status;
+}
+
+// -------- func zstd.decoder.copy_match
+
+static wuffs_base__status //
+wuffs_zstd__decoder__copy_match(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__slice_u8 a_workbuf){
+WUFFS_BASE__STATS__CALL(self, 13);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+wuffs_base__slice_u8 v_ring = {0};
+uint64_t v_hdist = 0;
+uint64_t v_i = 0;
+uint32_t v_hlen = 0;
+uint32_t v_n_copied = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+
+uint32_t coro_susp_point = self->private_impl.p_copy_match[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+if ((((uint64_t)(self->private_impl.f_seq_offset)) > self->private_impl.f_frame_produced) || (self->private_impl.f_seq_offset > self->private_impl.f_window_size)) {
+status = wuffs_base__make_status(wuffs_zstd__error__bad_offset);goto exit;}
+while (self->private_impl.f_seq_match_len > 0) {
+v_ring = wuffs_base__slice_u8__prefix(a_workbuf,((uint64_t)(self->private_impl.f_window_size)));
+if (((uint64_t)(self->private_impl.f_seq_offset)) > ((uint64_t)(iop_a_dst - io0_a_dst))) {
+v_hdist = (((uint64_t)(self->private_impl.f_seq_offset)) - ((uint64_t)(iop_a_dst - io0_a_dst)));
+v_i = ((uint64_t)(self->private_impl.f_history_index));
+if (v_i >= v_hdist) {
+v_i -= v_hdist;
+} else {
+v_i = ((v_i + ((uint64_t)(v_ring.len))) - v_hdist);
+}
+if (v_i >= ((uint64_t)(v_ring.len))) {
+status = wuffs_base__make_status(wuffs_zstd__error__internal_error_inconsistent_i_o);goto exit;}
+v_hlen = wuffs_base__u32__min(self->private_impl.f_seq_match_len,((uint32_t)(wuffs_base__u64__min(v_hdist,131072))));
+v_n_copied = wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,v_hlen,wuffs_base__slice_u8__subslice_i(v_ring,v_i));
+} else {
+v_n_copied = wuffs_base__io_writer__copy_n32_from_history(&iop_a_dst, io0_a_dst, io2_a_dst,self->private_impl.f_seq_match_len,self->private_impl.f_seq_offset);
+}
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_frame_produced,((uint64_t)(v_n_copied)));
+if (self->private_impl.f_seq_match_len <= v_n_copied) {
+self->private_impl.f_seq_match_len = 0;
+goto label__0__break;
+}
+self->private_impl.f_seq_match_len -= v_n_copied;
+if (v_n_copied == 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+}
+}
+label__0__break:;
+
+goto ok;ok:self->private_impl.p_copy_match[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_copy_match[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 13, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+
+return status;
+}
+
+// -------- func zstd.decoder.set_quirk_enabled
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct //
+wuffs_zstd__decoder__set_quirk_enabled(wuffs_zstd__decoder *self,uint32_t a_quirk,bool a_enabled){
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func zstd.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64//
+wuffs_zstd__decoder__workbuf_len(const wuffs_zstd__decoder *self){
+if (!self) { return wuffs_base__utility__empty_range_ii_u64();}if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&    (self->private_impl.magic != WUFFS_BASE__DISABLED)) {return wuffs_base__utility__empty_range_ii_u64();}
+
+
+return wuffs_base__utility__make_range_ii_u64(8388608,8388608);}
+
+// -------- func zstd.decoder.transform_io
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status //
+wuffs_zstd__decoder__transform_io(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+if (!self) { return wuffs_base__make_status(wuffs_base__error__bad_receiver);}if (self->private_impl.magic != WUFFS_BASE__MAGIC) {return wuffs_base__make_status((self->private_impl.magic == WUFFS_BASE__DISABLED) ? wuffs_base__error__disabled_by_previous_error : wuffs_base__error__initialize_not_called);}
+if (!a_dst || !a_src) {self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__bad_argument);
+
+}
+if ((self->private_impl.active_coroutine != 0) && (self->private_impl.active_coroutine != 1)) {
+self->private_impl.magic = WUFFS_BASE__DISABLED;
+return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+}
+self->private_impl.active_coroutine = 0;
+WUFFS_BASE__STATS__CALL(self, 15);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint64_t v_mark = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+
+uint32_t coro_susp_point = self->private_impl.p_transform_io[0];
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (true) {
+v_mark = ((uint64_t)(iop_a_dst - io0_a_dst));
+{
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+wuffs_base__status t_0 = wuffs_zstd__decoder__decode_frame(self,a_dst,a_src,a_workbuf);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+v_status = t_0;
+}
+if ( ! wuffs_base__status__is_suspension(&v_status)) {
+status = v_status;if (wuffs_base__status__is_error(&status)) { goto exit; }else if (wuffs_base__status__is_suspension(&status)) { status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension); goto exit; } goto ok;}
+if (((uint64_t)(self->private_impl.f_window_size)) <= ((uint64_t)(a_workbuf.len))) {
+wuffs_zstd__decoder__add_history(self,wuffs_base__io__since(v_mark, ((uint64_t)(iop_a_dst - io0_a_dst)), io0_a_dst),wuffs_base__slice_u8__prefix(a_workbuf,((uint64_t)(self->private_impl.f_window_size))));
+}
+status = v_status;WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+}
+
+goto ok;ok:self->private_impl.p_transform_io[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_transform_io[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+WUFFS_BASE__STATS__SUSPENSION(self, &status);
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 15, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+
+if (wuffs_base__status__is_error(&status)) { self->private_impl.magic = WUFFS_BASE__DISABLED; }
+return status;
+}
+
+// -------- func zstd.decoder.add_history
+
+static wuffs_base__empty_struct //
+wuffs_zstd__decoder__add_history(wuffs_zstd__decoder *self,wuffs_base__slice_u8 a_hist,wuffs_base__slice_u8 a_ring){
+WUFFS_BASE__STATS__CALL(self, 16);
+
+wuffs_base__slice_u8 v_s = {0};
+uint64_t v_i = 0;
+uint64_t v_n_copied = 0;
+
+v_s = a_hist;
+if (((uint64_t)(v_s.len)) >= ((uint64_t)(a_ring.len))) {
+v_s = wuffs_base__slice_u8__suffix(v_s,((uint64_t)(a_ring.len)));
+wuffs_base__slice_u8__copy_from_slice(a_ring,v_s);
+self->private_impl.f_history_index = 0;
+return wuffs_base__make_empty_struct();}
+v_i = ((uint64_t)(self->private_impl.f_history_index));
+v_n_copied = 0;
+if (v_i < ((uint64_t)(a_ring.len))) {
+v_n_copied = wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_i(a_ring,v_i),v_s);
+}
+if (v_n_copied < ((uint64_t)(v_s.len))) {
+v_s = wuffs_base__slice_u8__subslice_i(v_s,v_n_copied);
+v_i = wuffs_base__slice_u8__copy_from_slice(a_ring,v_s);
+} else {
+v_i += v_n_copied;
+if (v_i >= ((uint64_t)(a_ring.len))) {
+v_i = 0;
+}
+}
+self->private_impl.f_history_index = ((uint32_t)(wuffs_base__u64__min(v_i,8388608)));
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func zstd.decoder.decode_frame
+
+static wuffs_base__status //
+wuffs_zstd__decoder__decode_frame(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,wuffs_base__slice_u8 a_workbuf){
+WUFFS_BASE__STATS__CALL(self, 17);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_magic = 0;
+uint32_t v_n = 0;
+uint32_t v_fhd = 0;
+bool v_single_segment = false;
+bool v_has_checksum = false;
+uint32_t v_wd = 0;
+uint32_t v_window_log = 0;
+uint64_t v_window_size = 0;
+uint32_t v_did = 0;
+uint32_t v_fcs_flag = 0;
+uint64_t v_content_size = 0;
+bool v_has_content_size = false;
+uint32_t v_block_header = 0;
+bool v_last_block = false;
+uint32_t v_block_type = 0;
+uint32_t v_block_size = 0;
+uint8_t v_c = 0;
+uint64_t v_dmark = 0;
+wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_frame[0];
+if (coro_susp_point) {
+v_fhd = self->private_data.s_decode_frame[0].v_fhd;
+v_single_segment = self->private_data.s_decode_frame[0].v_single_segment;
+v_has_checksum = self->private_data.s_decode_frame[0].v_has_checksum;
+v_window_size = self->private_data.s_decode_frame[0].v_window_size;
+v_fcs_flag = self->private_data.s_decode_frame[0].v_fcs_flag;
+v_content_size = self->private_data.s_decode_frame[0].v_content_size;
+v_has_content_size = self->private_data.s_decode_frame[0].v_has_content_size;
+v_last_block = self->private_data.s_decode_frame[0].v_last_block;
+v_block_size = self->private_data.s_decode_frame[0].v_block_size;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+while (true) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+uint32_t t_0;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_0 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_0 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;if (num_bits_0 == 24) { t_0 = ((uint32_t)(*scratch));break;}num_bits_0 += 8;*scratch |= ((uint64_t)(num_bits_0)) << 56;}}
+v_magic = t_0;
+}
+if (v_magic == 4247762216) {
+goto label__0__break;
+} else if ((v_magic & 4294967280) != 407710288) {
+status = wuffs_base__make_status(wuffs_zstd__error__bad_header);goto exit;}
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+uint32_t t_1;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_1 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_1 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;if (num_bits_1 == 24) { t_1 = ((uint32_t)(*scratch));break;}num_bits_1 += 8;*scratch |= ((uint64_t)(num_bits_1)) << 56;}}
+v_n = t_1;
+}
+self->private_data.s_decode_frame[0].scratch = v_n;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+if (self->private_data.s_decode_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_frame[0].scratch;
+}
+label__0__break:;
+{
+uint32_t t_2;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_2 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_2 = *iop_a_src++;
+}
+v_fhd = t_2;
+}
+if ((v_fhd & 8) != 0) {
+status = wuffs_base__make_status(wuffs_zstd__error__bad_header);goto exit;}
+v_fcs_flag = (v_fhd >> 6);
+v_single_segment = ((v_fhd & 32) != 0);
+v_has_checksum = ((v_fhd & 4) != 0);
+if ( ! v_single_segment) {
+{
+uint32_t t_3;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_3 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_3 = *iop_a_src++;
+}
+v_wd = t_3;
+}
+v_window_log = (10 + (v_wd >> 3));
+if (v_window_log > 23) {
+status = wuffs_base__make_status(wuffs_zstd__error__unsupported_zstandard_window_size);goto exit;}
+v_window_size = (((uint64_t)(1)) << v_window_log);
+v_window_size += ((v_window_size >> 3) * ((uint64_t)((v_wd & 7))));
+}
+v_did = 0;
+if ((v_fhd & 3) == 1) {
+{
+uint32_t t_4;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_4 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_4 = *iop_a_src++;
+}
+v_did = t_4;
+}
+} else if ((v_fhd & 3) == 2) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+uint32_t t_5;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_5 =((uint32_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(10);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_5 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_5;if (num_bits_5 == 8) { t_5 = ((uint32_t)(*scratch));break;}num_bits_5 += 8;*scratch |= ((uint64_t)(num_bits_5)) << 56;}}
+v_did = t_5;
+}
+} else if ((v_fhd & 3) == 3) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(11);
+uint32_t t_6;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_6 =wuffs_base__load_u32le__no_bounds_check(iop_a_src); iop_a_src += 4;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(12);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_6 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_6;if (num_bits_6 == 24) { t_6 = ((uint32_t)(*scratch));break;}num_bits_6 += 8;*scratch |= ((uint64_t)(num_bits_6)) << 56;}}
+v_did = t_6;
+}
+}
+if (v_did != 0) {
+status = wuffs_base__make_status(wuffs_zstd__error__unsupported_zstandard_dictionary);goto exit;}
+v_has_content_size = true;
+if (v_fcs_flag == 0) {
+if (v_single_segment) {
+{
+uint64_t t_7;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_7 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(13);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_7 = *iop_a_src++;
+}
+v_content_size = t_7;
+}
+} else {
+v_has_content_size = false;
+}
+} else if (v_fcs_flag == 1) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(14);
+uint64_t t_8;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {t_8 =((uint64_t)(wuffs_base__load_u16le__no_bounds_check(iop_a_src))); iop_a_src += 2;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(15);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_8 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_8;if (num_bits_8 == 8) { t_8 = ((uint64_t)(*scratch));break;}num_bits_8 += 8;*scratch |= ((uint64_t)(num_bits_8)) << 56;}}
+v_content_size = t_8;
+}
+v_content_size += 256;
+} else if (v_fcs_flag == 2) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(16);
+uint64_t t_9;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {t_9 =((uint64_t)(wuffs_base__load_u32le__no_bounds_check(iop_a_src))); iop_a_src += 4;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(17);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_9 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_9;if (num_bits_9 == 24) { t_9 = ((uint64_t)(*scratch));break;}num_bits_9 += 8;*scratch |= ((uint64_t)(num_bits_9)) << 56;}}
+v_content_size = t_9;
+}
+} else {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(18);
+uint64_t t_10;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 8)) {t_10 =wuffs_base__load_u64le__no_bounds_check(iop_a_src); iop_a_src += 8;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(19);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_10 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_10;if (num_bits_10 == 56) { t_10 = ((uint64_t)(*scratch));break;}num_bits_10 += 8;*scratch |= ((uint64_t)(num_bits_10)) << 56;}}
+v_content_size = t_10;
+}
+}
+if (v_single_segment) {
+v_window_size = v_content_size;
+}
+if (v_window_size > 8388608) {
+status = wuffs_base__make_status(wuffs_zstd__error__unsupported_zstandard_window_size);goto exit;} else if (v_window_size > ((uint64_t)(a_workbuf.len))) {
+status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);goto exit;}
+self->private_impl.f_window_size = ((uint32_t)(v_window_size));
+self->private_impl.f_block_max_size = 131072;
+if (self->private_impl.f_window_size < 131072) {
+self->private_impl.f_block_max_size = self->private_impl.f_window_size;
+}
+self->private_impl.f_history_index = 0;
+self->private_impl.f_frame_produced = 0;
+self->private_impl.f_huffman_log = 0;
+self->private_impl.f_fse_valid[0] = false;
+self->private_impl.f_fse_valid[1] = false;
+self->private_impl.f_fse_valid[2] = false;
+self->private_impl.f_rep0 = 1;
+self->private_impl.f_rep1 = 4;
+self->private_impl.f_rep2 = 8;
+while (true) {
+{
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(20);
+uint32_t t_11;if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 3)) {t_11 =((uint32_t)(wuffs_base__load_u24le__no_bounds_check(iop_a_src))); iop_a_src += 3;
+} else {self->private_data.s_decode_frame[0].scratch = 0;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(21);
+while (true) {if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }uint64_t *scratch = &self->private_data.s_decode_frame[0].scratch;uint32_t num_bits_11 = ((uint32_t)(*scratch>> 56)); *scratch <<= 8; *scratch >>= 8;*scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_11;if (num_bits_11 == 16) { t_11 = ((uint32_t)(*scratch));break;}num_bits_11 += 8;*scratch |= ((uint64_t)(num_bits_11)) << 56;}}
+v_block_header = t_11;
+}
+v_last_block = ((v_block_header & 1) != 0);
+v_block_type = ((v_block_header >> 1) & 3);
+v_block_size = (v_block_header >> 3);
+if (v_block_size > self->private_impl.f_block_max_size) {
+status = wuffs_base__make_status(wuffs_zstd__error__bad_block);goto exit;}
+if (v_block_type == 0) {
+while (true) {
+v_dmark = ((uint64_t)(iop_a_dst - io0_a_dst));
+{
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+wuffs_base__status t_12 = wuffs_zstd__decoder__decode_raw_block(self,a_dst,a_src,v_block_size);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+v_status = t_12;
+}
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_frame_produced,wuffs_base__io__count_since(v_dmark, ((uint64_t)(iop_a_dst - io0_a_dst))));
+if (wuffs_base__status__is_ok(&v_status)) {
+goto label__1__break;
+}
+status = v_status;WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(22);
+}
+label__1__break:;
+} else if (v_block_type == 1) {
+{
+uint8_t t_13;if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {t_13 = *iop_a_src++;
+} else {WUFFS_BASE__COROUTINE_SUSPENSION_POINT(23);
+if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }t_13 = *iop_a_src++;
+}
+v_c = t_13;
+}
+wuffs_zstd__decoder__fill_literals(self,v_c,v_block_size);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(24);
+status = wuffs_zstd__decoder__copy_literals(self,a_dst,v_block_size);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (status.repr) { goto suspend; }
+} else if (v_block_type == 2) {
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(25);
+status = wuffs_zstd__decoder__read_block(self,a_src,v_block_size);
+if (a_src) {iop_a_src = a_src->data.ptr + a_src->meta.ri;}
+if (status.repr) { goto suspend; }
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(26);
+status = wuffs_zstd__decoder__decode_compressed_block(self,a_dst,a_workbuf);
+if (a_dst) {iop_a_dst = a_dst->data.ptr + a_dst->meta.wi;}
+if (status.repr) { goto suspend; }
+} else {
+status = wuffs_base__make_status(wuffs_zstd__error__bad_block);goto exit;}
+if (v_last_block) {
+goto label__2__break;
+}
+}
+label__2__break:;
+if (v_has_checksum) {
+self->private_data.s_decode_frame[0].scratch = 4;
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT(27);
+if (self->private_data.s_decode_frame[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+self->private_data.s_decode_frame[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+iop_a_src = io2_a_src;
+status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }
+iop_a_src += self->private_data.s_decode_frame[0].scratch;
+}
+if (v_has_content_size && (v_content_size != self->private_impl.f_frame_produced)) {
+status = wuffs_base__make_status(wuffs_zstd__error__bad_content_size);goto exit;}
+
+goto ok;ok:self->private_impl.p_decode_frame[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_frame[0].v_fhd = v_fhd;
+self->private_data.s_decode_frame[0].v_single_segment = v_single_segment;
+self->private_data.s_decode_frame[0].v_has_checksum = v_has_checksum;
+self->private_data.s_decode_frame[0].v_window_size = v_window_size;
+self->private_data.s_decode_frame[0].v_fcs_flag = v_fcs_flag;
+self->private_data.s_decode_frame[0].v_content_size = v_content_size;
+self->private_data.s_decode_frame[0].v_has_content_size = v_has_content_size;
+self->private_data.s_decode_frame[0].v_last_block = v_last_block;
+self->private_data.s_decode_frame[0].v_block_size = v_block_size;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 17, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func zstd.decoder.decode_raw_block
+
+static wuffs_base__status //
+wuffs_zstd__decoder__decode_raw_block(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,wuffs_base__io_buffer* a_src,uint32_t a_n){
+WUFFS_BASE__STATS__CALL(self, 18);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_length = 0;
+uint32_t v_n_copied = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_decode_raw_block[0];
+if (coro_susp_point) {
+v_length = self->private_data.s_decode_raw_block[0].v_length;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+v_length = a_n;
+while (v_length > 0) {
+v_n_copied = wuffs_base__io_writer__copy_n32_from_reader(&iop_a_dst, io2_a_dst,v_length, &iop_a_src, io2_a_src);
+if (v_length <= v_n_copied) {
+status = wuffs_base__make_status(NULL);goto ok;}
+v_length -= v_n_copied;
+if (((uint64_t)(io2_a_src - iop_a_src)) == 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+} else {
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+}
+}
+
+goto ok;ok:self->private_impl.p_decode_raw_block[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_decode_raw_block[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_decode_raw_block[0].v_length = v_length;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 18, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func zstd.decoder.read_block
+
+static wuffs_base__status //
+wuffs_zstd__decoder__read_block(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_src,uint32_t a_n){
+WUFFS_BASE__STATS__CALL(self, 19);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+wuffs_base__slice_u8 v_s = {0};
+uint64_t v_avail = 0;
+uint64_t v_n_copied = 0;
+uint32_t v_n = 0;
+uint32_t v_i = 0;
+
+const uint8_t* iop_a_src = NULL;const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_src) {io0_a_src = a_src->data.ptr;io1_a_src = io0_a_src + a_src->meta.ri;iop_a_src = io1_a_src;io2_a_src = io0_a_src + a_src->meta.wi;}
+
+uint32_t coro_susp_point = self->private_impl.p_read_block[0];
+if (coro_susp_point) {
+v_avail = self->private_data.s_read_block[0].v_avail;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+self->private_impl.f_block_len = a_n;
+self->private_impl.f_block_pos = 0;
+label__0__continue:;
+while (true) {
+if (self->private_impl.f_block_len <= self->private_impl.f_block_pos) {
+goto label__0__break;
+}
+v_avail = ((uint64_t)(io2_a_src - iop_a_src));
+if (v_avail == 0) {
+status = wuffs_base__make_status(wuffs_base__suspension__short_read);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+goto label__0__continue;
+}
+v_s = wuffs_base__io_reader__take(&iop_a_src, io2_a_src,wuffs_base__u64__min(v_avail,((uint64_t)((self->private_impl.f_block_len - self->private_impl.f_block_pos)))));
+if (self->private_impl.f_block_pos > self->private_impl.f_block_len) {
+status = wuffs_base__make_status(wuffs_zstd__error__internal_error_inconsistent_i_o);goto exit;}
+v_n_copied = wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_block, 131328),self->private_impl.f_block_pos,self->private_impl.f_block_len),v_s);
+v_n = ((uint32_t)(wuffs_base__u64__min(v_n_copied,131072)));
+self->private_impl.f_block_pos = wuffs_base__u32__min(self->private_impl.f_block_len,(self->private_impl.f_block_pos + v_n));
+}
+label__0__break:;
+self->private_impl.f_block_pos = 0;
+v_i = 0;
+while (v_i < 16) {
+self->private_data.f_block[(self->private_impl.f_block_len + v_i)] = 0;
+v_i += 1;
+}
+
+goto ok;ok:self->private_impl.p_read_block[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_read_block[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_read_block[0].v_avail = v_avail;
+
+goto exit;exit:if (a_src) { a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr)); }
+
+return status;
+}
+
+// -------- func zstd.decoder.fill_literals
+
+static wuffs_base__empty_struct //
+wuffs_zstd__decoder__fill_literals(wuffs_zstd__decoder *self,uint8_t a_c,uint32_t a_n){
+WUFFS_BASE__STATS__CALL(self, 20);
+
+uint32_t v_i = 0;
+
+v_i = 0;
+while (v_i < a_n) {
+self->private_data.f_literals[v_i] = a_c;
+v_i += 1;
+}
+self->private_impl.f_literals_len = a_n;
+self->private_impl.f_literals_pos = 0;
+return wuffs_base__make_empty_struct();
+}
+
+// -------- func zstd.decoder.copy_literals
+
+static wuffs_base__status //
+wuffs_zstd__decoder__copy_literals(wuffs_zstd__decoder *self,wuffs_base__io_buffer* a_dst,uint32_t a_n){
+WUFFS_BASE__STATS__CALL(self, 21);
+wuffs_base__status status = wuffs_base__make_status(NULL);
+
+uint32_t v_length = 0;
+uint32_t v_n_copied = 0;
+
+uint8_t* iop_a_dst = NULL;uint8_t* io0_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io1_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;uint8_t* io2_a_dst WUFFS_BASE__POTENTIALLY_UNUSED = NULL;if (a_dst) {io0_a_dst = a_dst->data.ptr;io1_a_dst = io0_a_dst + a_dst->meta.wi;iop_a_dst = io1_a_dst;io2_a_dst = io0_a_dst + a_dst->data.len;if (a_dst->meta.closed) {io2_a_dst = iop_a_dst;}
+}
+
+uint32_t coro_susp_point = self->private_impl.p_copy_literals[0];
+if (coro_susp_point) {
+v_length = self->private_data.s_copy_literals[0].v_length;
+}
+switch (coro_susp_point) {
+WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+v_length = a_n;
+while (v_length > 0) {
+if (self->private_impl.f_literals_pos > self->private_impl.f_literals_len) {
+status = wuffs_base__make_status(wuffs_zstd__error__internal_error_inconsistent_i_o);goto exit;}
+v_n_copied = wuffs_base__io_writer__copy_n32_from_slice(&iop_a_dst, io2_a_dst,v_length,wuffs_base__slice_u8__subslice_ij(wuffs_base__make_slice_u8(self->private_data.f_literals, 131072),self->private_impl.f_literals_pos,self->private_impl.f_literals_len));
+if (v_n_copied > 0) {
+self->private_impl.f_literals_pos = wuffs_base__u32__min(self->private_impl.f_literals_len,(self->private_impl.f_literals_pos + wuffs_base__u32__min(v_n_copied,131072)));
+wuffs_base__u64__sat_add_indirect(&self->private_impl.f_frame_produced,((uint64_t)(v_n_copied)));
+if (v_length <= v_n_copied) {
+goto label__0__break;
+}
+v_length -= v_n_copied;
+} else if (self->private_impl.f_literals_pos >= self->private_impl.f_literals_len) {
+status = wuffs_base__make_status(wuffs_zstd__error__internal_error_inconsistent_i_o);goto exit;}
+status = wuffs_base__make_status(wuffs_base__suspension__short_write);WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+}
+label__0__break:;
+
+goto ok;ok:self->private_impl.p_copy_literals[0] = 0;
+goto exit; }
+
+goto suspend;suspend:self->private_impl.p_copy_literals[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+self->private_data.s_copy_literals[0].v_length = v_length;
+
+goto exit;exit:WUFFS_BASE__STATS__WRITTEN(self, 21, iop_a_dst - io1_a_dst);
+if (a_dst) { a_dst->meta.wi = ((size_t)(iop_a_dst - a_dst->data.ptr)); }
+
+return status;
+}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__ZSTD)
+
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__ZSTD
+
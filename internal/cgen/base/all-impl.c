@@ -51,9 +51,35 @@ extern "C" {
 }  // extern "C"
 #endif
 
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+
+// !! INSERT base/aux-public.h.
+
+#endif  // defined(__cplusplus) && (__cplusplus >= 201103L)
+
 // WUFFS C HEADER ENDS HERE.
 #ifdef WUFFS_IMPLEMENTATION
 
+// ---------------- CPU Architecture
+
+// WUFFS_BASE__CPU_ARCH__ETC is defined when the compiler can emit (and the
+// code below can call) CPU-specific instructions, such as SIMD intrinsics.
+// Whether the CPU that the program actually runs on supports them is checked
+// at run time, via wuffs_base__cpu_arch__have_etc functions. Every such fast
+// path has a portable fallback that produces identical output.
+//
+// Define WUFFS_CONFIG__AVOID_CPU_ARCH to only use the portable code, e.g. to
+// measure the difference when benchmarking.
+//
+// Clang also defines "__GNUC__".
+#if !defined(WUFFS_CONFIG__AVOID_CPU_ARCH)
+#if defined(__GNUC__) && defined(__x86_64__)
+#define WUFFS_BASE__CPU_ARCH__X86_64
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+#endif  // !defined(WUFFS_CONFIG__AVOID_CPU_ARCH)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -150,6 +176,15 @@ const uint32_t wuffs_base__pixel_format__bits_per_channel[16] = {
         // defined(WUFFS_CONFIG__MODULE__BASE) ||
         // defined(WUFFS_CONFIG__MODULE__BASE__PIXCONV)
 
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \
+    defined(WUFFS_CONFIG__MODULE__BASE__TAPE)
+
+// !! INSERT base/tape-submodule.c.
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) ||
+        // defined(WUFFS_CONFIG__MODULE__BASE) ||
+        // defined(WUFFS_CONFIG__MODULE__BASE__TAPE)
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -0,0 +1,380 @@
+// After editing this file, run "go generate" in the parent directory.
+
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ---------------- Auxiliary C++ API
+
+// The wuffs_aux namespace is a higher level, C++ only layer over the C API
+// (and its thin C++ convenience methods). It holds the buffer management that
+// every C++ program would otherwise re-implement: driving a decoder through
+// its suspensions, refilling and compacting the source and flushing the
+// destination.
+//
+// Callbacks are template parameters, not std::function values, so that they
+// can be inlined and so that nothing here allocates. The one exception is a
+// decoder_pool, which allocates a decoder when its (thread-local) free list is
+// empty. The caller owns all of the buffers.
+//
+// Like the rest of Wuffs, nothing here throws exceptions.
+
+namespace wuffs_aux {
+
+// input_span is a read-only, non-owning view of contiguous bytes, like C++20's
+// std::span<const uint8_t>. It converts implicitly from a wuffs_base__slice_u8
+// or from any container (e.g. a std::string or std::vector<uint8_t>) that has
+// data() and size() methods and 1-byte elements. No bytes are copied.
+//
+// The viewed bytes must outlive the input_span and anything derived from it,
+// such as its reader().
+class input_span {
+ public:
+  input_span() : m_ptr(nullptr), m_len(0) {}
+
+  input_span(const void* ptr, size_t len)
+      : m_ptr(static_cast<const uint8_t*>(ptr)), m_len(ptr ? len : 0) {}
+
+  input_span(wuffs_base__slice_u8 s)
+      : m_ptr(s.ptr), m_len(s.ptr ? s.len : 0) {}
+
+  template <typename Container>
+  input_span(const Container& c)
+      : m_ptr(reinterpret_cast<const uint8_t*>(c.data())), m_len(c.size()) {
+    static_assert(sizeof(*c.data()) == 1,
+                  "wuffs_aux::input_span needs 1-byte elements");
+  }
+
+  inline const uint8_t* data() const { return m_ptr; }
+  inline size_t size() const { return m_len; }
+  inline bool empty() const { return m_len == 0; }
+
+  // slice returns the bytes as a wuffs_base__slice_u8. Its ptr field is not
+  // const-qualified (that's how the C API is), but the bytes must not be
+  // modified through it.
+  inline wuffs_base__slice_u8 slice() const {
+    return wuffs_base__make_slice_u8(const_cast<uint8_t*>(m_ptr), m_len);
+  }
+
+  // reader returns a closed io_buffer that holds the entire input. Wuffs'
+  // decoders only read from, never write to, their source io_buffer, so the
+  // bytes are not copied. A closed source never needs to be refilled or
+  // compacted, so the drivers below never call their read callback.
+  inline wuffs_base__io_buffer reader() const {
+    return wuffs_base__slice_u8__reader(slice(), true);
+  }
+
+ private:
+  const uint8_t* m_ptr;
+  size_t m_len;
+};
+
+// --------
+
+// decoder_pool recycles heap-allocated decoders (or other Wuffs objects),
+// such as wuffs_zlib__decoder objects, so that a thread that decodes many
+// small, independent inputs does not pay for a malloc and free per input.
+// Its template arguments are the object type T, its sizeof__T function and
+// the maximum number of idle objects (per thread) to keep for re-use:
+//
+//   using zlib_pool = wuffs_aux::decoder_pool<wuffs_zlib__decoder,
+//                                             sizeof__wuffs_zlib__decoder>;
+//
+//   zlib_pool::handle dec = zlib_pool::acquire();
+//   if (!dec) {
+//     etc;  // Handle the out-of-memory error.
+//   }
+//   wuffs_base__status status = dec->transform_io(etc);
+//
+// Each thread has its own free list, so acquiring and releasing need no
+// locking. Releasing a handle on a different thread to the one that acquired
+// it is safe, but the object then joins the releasing thread's free list.
+//
+// Every acquired object is (re-)initialized, by default with the
+// WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED flag, so that
+// re-initializing a recycled object does not have to zero its internal
+// buffers (e.g. a 32 KiB history ringbuffer). Pass 0 to acquire to fully
+// zero-initialize instead. See /doc/note/initialization.md for the trade-offs.
+template <typename T, size_t (*SizeOfT)(), size_t MaxIdle = 4>
+class decoder_pool {
+ public:
+  // handle is a move-only RAII handle to an acquired object. Its destructor
+  // releases the object back to the pool. An empty handle (one that is
+  // default constructed, moved from or from a failed acquire) holds nullptr.
+  class handle {
+   public:
+    handle() : m_ptr(nullptr) {}
+    explicit handle(T* ptr) : m_ptr(ptr) {}
+    handle(handle&& that) : m_ptr(that.m_ptr) { that.m_ptr = nullptr; }
+    handle(const handle&) = delete;
+    ~handle() { reset(); }
+
+    handle& operator=(handle&& that) {
+      if (this != &that) {
+        reset();
+        m_ptr = that.m_ptr;
+        that.m_ptr = nullptr;
+      }
+      return *this;
+    }
+    handle& operator=(const handle&) = delete;
+
+    inline T* get() const { return m_ptr; }
+    inline T* operator->() const { return m_ptr; }
+    inline T& operator*() const { return *m_ptr; }
+    inline explicit operator bool() const { return m_ptr != nullptr; }
+
+    // reset releases the object, if any, back to the pool.
+    inline void reset() {
+      if (m_ptr) {
+        decoder_pool::release(m_ptr);
+        m_ptr = nullptr;
+      }
+    }
+
+   private:
+    T* m_ptr;
+  };
+
+  // acquire returns a handle to an initialized object, re-using an idle one
+  // if the calling thread has any. On failure (out of memory, or bad
+  // initialize_flags), it returns an empty handle. It doesn't throw.
+  static handle  //
+  acquire(uint32_t initialize_flags =
+              WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) {
+    free_list& f = local_free_list();
+    T* ptr = (f.n > 0) ? f.ptrs[--f.n] : static_cast<T*>(malloc(SizeOfT()));
+    if (!ptr) {
+      return handle();
+    }
+    wuffs_base__status status =
+        ptr->initialize(SizeOfT(), WUFFS_VERSION, initialize_flags);
+    if (!status.is_ok()) {
+      free(ptr);
+      return handle();
+    }
+    return handle(ptr);
+  }
+
+ private:
+  struct free_list {
+    T* ptrs[MaxIdle];
+    size_t n;
+
+    free_list() : n(0) {}
+    ~free_list() {
+      while (n > 0) {
+        free(ptrs[--n]);
+      }
+    }
+  };
+
+  static free_list&  //
+  local_free_list() {
+    static thread_local free_list z;
+    return z;
+  }
+
+  static void  //
+  release(T* ptr) {
+    free_list& f = local_free_list();
+    if (f.n < MaxIdle) {
+      f.ptrs[f.n++] = ptr;
+    } else {
+      free(ptr);
+    }
+  }
+};
+
+// --------
+
+// The transform_io and decode_tokens functions drive a decoder (or other
+// coroutine) until it completes, handling its suspensions:
+//
+//  - On a short read, the src io_buffer is compacted (if it has consumed
+//    bytes) and refilled by calling read(src). The callback should append
+//    bytes to src (advancing src->meta.wi) and set src->meta.closed at the
+//    end of the input. A short read on a closed src is a
+//    wuffs_base__error__not_enough_data error. A short read on a full src
+//    (one that, even after compaction, has no room) is a
+//    wuffs_base__error__bad_argument_length_too_short error: the buffer is
+//    too small for that decoder.
+//  - A short write on a full dst (or tok) buffer (one that, even after
+//    compaction, has no room, e.g. a zero-length buffer) is also a
+//    wuffs_base__error__bad_argument_length_too_short error. Retrying could
+//    not make progress.
+//  - After every call that wrote to dst (not just those that suspended with
+//    a short write), the dst buffer's contents are handed to a callback and
+//    then the dst buffer is emptied. Carrying dst bytes over from one call
+//    to the next is not an option: decoders like std/deflate's take all of
+//    dst's written bytes to be their most recent output, when resolving
+//    back-references, so re-presenting already-seen output corrupts it.
+//
+// The src buffer is only compacted when it needs refilling. A src that is
+// already closed (e.g. an input_span's reader) is never copied, compacted or
+// refilled. For fewer, larger callback calls, use larger buffers.
+//
+// Callbacks return a wuffs_base__status. Any status other than OK (e.g. an
+// error or a custom message) stops the driver, which returns that status.
+// Likewise, any decoder status other than OK, short read or short write
+// (e.g. a decoding error) is returned as is.
+//
+// On success, the decoder may not have consumed all of src. For example, a
+// zlib stream may be followed by other data. Any unconsumed bytes remain in
+// src, starting at src->meta.ri.
+
+// transform_io drives an io_transformer, or a concrete type with a compatible
+// transform_io method, such as a wuffs_gzip__decoder. The write callback is
+// called as write(wuffs_base__slice_u8 bytes).
+template <typename Transformer, typename ReadFunc, typename WriteFunc>
+wuffs_base__status  //
+transform_io(Transformer* t,
+             wuffs_base__io_buffer* dst,
+             wuffs_base__io_buffer* src,
+             wuffs_base__slice_u8 workbuf,
+             ReadFunc&& read,
+             WriteFunc&& write) {
+  while (true) {
+    wuffs_base__status status = t->transform_io(dst, src, workbuf);
+
+    if (dst->meta.wi > dst->meta.ri) {
+      wuffs_base__status z = write(wuffs_base__make_slice_u8(
+          dst->data.ptr + dst->meta.ri, dst->meta.wi - dst->meta.ri));
+      if (z.repr) {
+        return z;
+      }
+      dst->meta.ri = dst->meta.wi;
+      dst->compact();
+    }
+
+    if (status.repr == nullptr) {
+      return status;
+    } else if (status.repr == wuffs_base__suspension__short_read) {
+      if (src->meta.closed) {
+        return wuffs_base__make_status(wuffs_base__error__not_enough_data);
+      }
+      src->compact();
+      if (src->meta.wi >= src->data.len) {
+        return wuffs_base__make_status(
+            wuffs_base__error__bad_argument_length_too_short);
+      }
+      wuffs_base__status z = read(src);
+      if (z.repr) {
+        return z;
+      }
+    } else if (status.repr == wuffs_base__suspension__short_write) {
+      dst->compact();
+      if (dst->meta.wi >= dst->data.len) {
+        return wuffs_base__make_status(
+            wuffs_base__error__bad_argument_length_too_short);
+      }
+    } else {
+      return status;
+    }
+  }
+}
+
+// transform_io, given an input_span instead of a src io_buffer, transforms
+// the whole input without copying it into an intermediate buffer.
+template <typename Transformer, typename WriteFunc>
+wuffs_base__status  //
+transform_io(Transformer* t,
+             wuffs_base__io_buffer* dst,
+             input_span src,
+             wuffs_base__slice_u8 workbuf,
+             WriteFunc&& write) {
+  wuffs_base__io_buffer r = src.reader();
+  return transform_io(
+      t, dst, &r, workbuf,
+      [](wuffs_base__io_buffer*) -> wuffs_base__status {
+        return wuffs_base__make_status(wuffs_base__error__not_enough_data);
+      },
+      write);
+}
+
+// decode_tokens drives a token_decoder, or a concrete type with a compatible
+// decode_tokens method, such as a wuffs_json__decoder. The token callback is
+// called as handle_tokens(tok, src) and should consume tok's readable tokens
+// (from tok->meta.ri to tok->meta.wi). Those tokens cover the src bytes that
+// immediately precede src->meta.ri. After the callback returns, any readable
+// tokens left over are discarded and tok is emptied.
+//
+// The src buffer is only compacted after its tokens were handled, so that a
+// token's bytes do not move while the callback is looking at them.
+template <typename TokenDecoder, typename ReadFunc, typename TokenFunc>
+wuffs_base__status  //
+decode_tokens(TokenDecoder* d,
+              wuffs_base__token_buffer* tok,
+              wuffs_base__io_buffer* src,
+              wuffs_base__slice_u8 workbuf,
+              ReadFunc&& read,
+              TokenFunc&& handle_tokens) {
+  while (true) {
+    wuffs_base__status status = d->decode_tokens(tok, src, workbuf);
+
+    if (tok->meta.wi > tok->meta.ri) {
+      wuffs_base__status z = handle_tokens(tok, src);
+      if (z.repr) {
+        return z;
+      }
+    }
+    tok->meta.ri = tok->meta.wi;
+    tok->compact();
+
+    if (status.repr == nullptr) {
+      return status;
+    } else if (status.repr == wuffs_base__suspension__short_read) {
+      if (src->meta.closed) {
+        return wuffs_base__make_status(wuffs_base__error__not_enough_data);
+      }
+      src->compact();
+      if (src->meta.wi >= src->data.len) {
+        return wuffs_base__make_status(
+            wuffs_base__error__bad_argument_length_too_short);
+      }
+      wuffs_base__status z = read(src);
+      if (z.repr) {
+        return z;
+      }
+    } else if (status.repr == wuffs_base__suspension__short_write) {
+      if (tok->meta.wi >= tok->data.len) {
+        return wuffs_base__make_status(
+            wuffs_base__error__bad_argument_length_too_short);
+      }
+    } else {
+      return status;
+    }
+  }
+}
+
+// decode_tokens, given an input_span instead of a src io_buffer, decodes the
+// whole input without copying it into an intermediate buffer. The src passed
+// to handle_tokens is a reader over the input_span, so that the src->data.ptr
+// indexes are also indexes into the input_span.
+template <typename TokenDecoder, typename TokenFunc>
+wuffs_base__status  //
+decode_tokens(TokenDecoder* d,
+              wuffs_base__token_buffer* tok,
+              input_span src,
+              wuffs_base__slice_u8 workbuf,
+              TokenFunc&& handle_tokens) {
+  wuffs_base__io_buffer r = src.reader();
+  return decode_tokens(
+      d, tok, &r, workbuf,
+      [](wuffs_base__io_buffer*) -> wuffs_base__status {
+        return wuffs_base__make_status(wuffs_base__error__not_enough_data);
+      },
+      handle_tokens);
+}
+
+}  // namespace wuffs_aux
@@ -0,0 +1,656 @@
+// After editing this file, run "go generate" in the parent directory.
+
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ---------------- CPU Architecture
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42 lets a function use SSE4.2 (and
+// earlier, such as SSSE3 and SSE4.1) intrinsics, as well as the POPCNT and
+// PCLMULQDQ instructions, even if the rest of the program is compiled without
+// "-msse4.2". Only call such functions after checking
+// wuffs_base__cpu_arch__have_x86_sse42.
+#define WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42 \
+  __attribute__((target("pclmul,popcnt,sse4.2")))
+
+// wuffs_base__cpu_arch__have_x86_sse42 returns whether the CPU supports
+// SSE4.2 and the instruction sets it implies: SSE2, SSE3, SSSE3 and SSE4.1.
+// It also requires POPCNT and PCLMULQDQ, which every SSE4.2 capable x86_64 CPU
+// in practice also has.
+//
+// The CPUID instruction can be slow, especially in virtual machines, so the
+// result is memoized. Racing threads can only ever store the same value.
+static inline bool  //
+wuffs_base__cpu_arch__have_x86_sse42() {
+  // 0 means unknown, 1 means no and 2 means yes.
+  static int memo = 0;
+  int m = __atomic_load_n(&memo, __ATOMIC_RELAXED);
+  if (m == 0) {
+    m = 1;
+    unsigned int eax1 = 0;
+    unsigned int ebx1 = 0;
+    unsigned int ecx1 = 0;
+    unsigned int edx1 = 0;
+    if (__get_cpuid(1, &eax1, &ebx1, &ecx1, &edx1)) {
+      const unsigned int sse42_ecx1 = bit_PCLMUL | bit_POPCNT | bit_SSE3 |
+                                      bit_SSSE3 | bit_SSE4_1 | bit_SSE4_2;
+      if ((ecx1 & sse42_ecx1) == sse42_ecx1) {
+        m = 2;
+      }
+    }
+    __atomic_store_n(&memo, m, __ATOMIC_RELAXED);
+  }
+  return m == 2;
+}
+
+// wuffs_base__cpu_arch__utf_8_span_x86_sse42 returns the length of a prefix of
+// the 16 bytes x that is valid UTF-8 and does not contain any stop bytes. Bit
+// i of stops is set if x's i'th byte is a stop byte, which must be ASCII. The
+// x bytes must start at a code point boundary and the prefix ends at one.
+//
+// The prefix is usually the longest such prefix, but it can be shorter near
+// invalid UTF-8. In particular, returning zero does not imply that x starts
+// with invalid UTF-8, only that the caller should check its first code point
+// more carefully, e.g. with wuffs_base__utf_8__next.
+//
+// Validation uses the "lookup" algorithm from "Validating UTF-8 In Less Than
+// One Instruction Per Byte" by Keiser and Lemire (Software: Practice and
+// Experience, 2021). Three 16-entry tables, indexed by the high and low
+// nibbles of each byte's predecessor and the high nibble of the byte itself,
+// give bit sets of the errors possible given that nibble. Their bitwise-and is
+// non-zero where a pair of bytes is invalid. The bits are:
+//  - 0x01 too short: a lead byte followed by a non-continuation byte.
+//  - 0x02 too long: an ASCII byte followed by a continuation byte.
+//  - 0x04 overlong 3-byte encoding: 0xE0 followed by 0x80 ..= 0x9F.
+//  - 0x08 too large: 0xF4 ..= 0xFF followed by 0x90 ..= 0xBF.
+//  - 0x10 surrogate: 0xED followed by 0xA0 ..= 0xBF.
+//  - 0x20 overlong 2-byte encoding: 0xC0 or 0xC1.
+//  - 0x40 too large or overlong 4-byte encoding: 0xF0 or 0xF5 ..= 0xFF
+//    followed by 0x80 ..= 0x8F.
+//  - 0x80 two continuations, or that it is the 3rd or 4th byte of a code
+//    point. Exactly one of those should hold, so this bit is flipped where
+//    the byte two or three places earlier is a 3- or 4-byte lead.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__cpu_arch__utf_8_span_x86_sse42(__m128i x, uint32_t stops) {
+  const __m128i byte_1_high_table = _mm_setr_epi8(
+      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  //
+      -0x80, -0x80, -0x80, -0x80, 0x21, 0x01, 0x15, 0x49);
+  const __m128i byte_1_low_table = _mm_setr_epi8(
+      -0x19, -0x5D, -0x7D, -0x7D, -0x75, -0x35, -0x35, -0x35,  //
+      -0x35, -0x35, -0x35, -0x35, -0x35, -0x25, -0x35, -0x35);
+  const __m128i byte_2_high_table = _mm_setr_epi8(
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  //
+      -0x1A, -0x52, -0x46, -0x46, 0x01, 0x01, 0x01, 0x01);
+  const __m128i low_nibble = _mm_set1_epi8(0x0F);
+
+  // Zero bytes are shifted in before x. They act like ASCII.
+  __m128i prev1 = _mm_slli_si128(x, 1);
+  __m128i prev2 = _mm_slli_si128(x, 2);
+  __m128i prev3 = _mm_slli_si128(x, 3);
+
+  __m128i errs = _mm_and_si128(
+      _mm_and_si128(
+          _mm_shuffle_epi8(byte_1_high_table,
+                           _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble)),
+          _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, low_nibble))),
+      _mm_shuffle_epi8(byte_2_high_table,
+                       _mm_and_si128(_mm_srli_epi16(x, 4), low_nibble)));
+  errs = _mm_xor_si128(
+      errs, _mm_and_si128(
+                _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80)),
+                             _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80))),
+                _mm_set1_epi8(-0x80)));
+
+  // A code point that starts in x's last 3 bytes might not end within x.
+  __m128i incomplete = _mm_subs_epu8(
+      x, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,  //
+                       -1, -1, -1, -1, -1, -0x11, -0x21, -0x41));
+
+  // Bit i of bad is set if x's i'th byte is the first byte (in its pair or
+  // triple) that is invalid. Bits 16 and 17 are sentinels: bit 16 means that
+  // the last code point is incomplete.
+  uint32_t bad = 0xFFFFu & ~(uint32_t)_mm_movemask_epi8(
+                               _mm_cmpeq_epi8(errs, _mm_setzero_si128()));
+  bad |= (0xFFFFu == (uint32_t)_mm_movemask_epi8(
+                         _mm_cmpeq_epi8(incomplete, _mm_setzero_si128())))
+             ? 0x20000u
+             : 0x10000u;
+
+  // Bit i of boundaries is set if x's i'th byte is not a continuation byte.
+  // As signed 8-bit integers, continuation bytes are less than 0xC0.
+  uint32_t boundaries =
+      0x10000u | (0xFFFFu & ~(uint32_t)_mm_movemask_epi8(
+                                 _mm_cmplt_epi8(x, _mm_set1_epi8(-0x40))));
+
+  // Every code point that ends before the first bad byte is valid. Return the
+  // last boundary strictly before that byte, and not after the first stop.
+  uint32_t n = (uint32_t)__builtin_ctz(bad);
+  if (n == 0) {
+    return 0;
+  }
+  uint32_t m = (uint32_t)__builtin_ctz(stops | 0x10000u);
+  if (m > (n - 1)) {
+    m = n - 1;
+  }
+  boundaries &= (2u << m) - 1u;
+  return 31u - (uint32_t)__builtin_clz(boundaries | 1u);
+}
+
+#else  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static inline bool  //
+wuffs_base__cpu_arch__have_x86_sse42() {
+  return false;
+}
+
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// ---------------- CPU Architecture (Utility)
+
+// The wuffs_base__utility__etc functions below are called by Wuffs code (e.g.
+// in std/crc32) via "utility.etc" built-in functions. The Wuffs language
+// itself has no notion of SIMD, so these hand-written C implementations are
+// the bridge from Wuffs code to CPU-specific instructions.
+//
+// Wuffs code should only call the CPU-specific function (e.g.
+// utility.crc32_ieee_x86_sse42) after the corresponding check (e.g.
+// utility.cpu_arch_have_x86_sse42) returns true. On other CPU architectures,
+// the check always returns false and the CPU-specific function is an inert
+// placeholder, so that the generated C code still compiles.
+
+#define wuffs_base__utility__cpu_arch_have_x86_sse42 \
+  wuffs_base__cpu_arch__have_x86_sse42
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// wuffs_base__utility__crc32_ieee_x86_sse42 updates the CRC-32 (IEEE) state s
+// (the bitwise complement of the running checksum, as per std/crc32's
+// ieee_hasher) with the first (x.len & ~15) bytes of x, using carry-less
+// multiplication to fold 64 bytes at a time. The x.len must be at least 64.
+//
+// The algorithm is described in "Fast CRC Computation for Generic Polynomials
+// Using PCLMULQDQ Instruction" by Gopal, Ozturk, Guilford, Wolrich, Feghali,
+// Dixon and Karakoyunlu (Intel, 2009). The magic constants are powers of x
+// modulo the bit-reflected IEEE polynomial (0x1_DB71_0641), as well as that
+// polynomial's Barrett reduction constant (0x1_F701_1641).
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__crc32_ieee_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {
+  if (x.len < 64) {
+    return s;
+  }
+  uint8_t* p = x.ptr;
+  size_t n = x.len & ~((size_t)15);
+
+  __m128i k1k2 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+  __m128i k3k4 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+  __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163CD6124);
+  __m128i poly = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+  __m128i mask = _mm_setr_epi32(-1, 0, -1, 0);
+
+  __m128i x1 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00));
+  __m128i x2 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x10));
+  __m128i x3 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x20));
+  __m128i x4 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x30));
+  x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)s));
+  p += 64;
+  n -= 64;
+
+  // Fold 64 bytes (4 lanes of 128 bits) at a time.
+  while (n >= 64) {
+    __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+    __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+    __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+    __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+    x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+    x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+    x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+    x1 =
+        _mm_xor_si128(_mm_xor_si128(x1, x5),
+                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00)));
+    x2 =
+        _mm_xor_si128(_mm_xor_si128(x2, x6),
+                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x10)));
+    x3 =
+        _mm_xor_si128(_mm_xor_si128(x3, x7),
+                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x20)));
+    x4 =
+        _mm_xor_si128(_mm_xor_si128(x4, x8),
+                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x30)));
+    p += 64;
+    n -= 64;
+  }
+
+  // Fold the 4 lanes into 1.
+  __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+  x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+  x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+  x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+  x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+  x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+  x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+  x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+  x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+  // Fold 16 bytes (1 lane) at a time.
+  while (n >= 16) {
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 =
+        _mm_xor_si128(_mm_xor_si128(x1, x5),
+                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00)));
+    p += 16;
+    n -= 16;
+  }
+
+  // Fold 128 bits to 64 bits.
+  x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_and_si128(x1, mask);
+  x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // Barrett reduce to 32 bits.
+  x2 = _mm_and_si128(x1, mask);
+  x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+  x2 = _mm_and_si128(x2, mask);
+  x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+  return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+
+// wuffs_base__utility__crc32_castagnoli_x86_sse42 updates the CRC-32C
+// (Castagnoli) state s (the bitwise complement of the running checksum, as per
+// std/crc32's castagnoli_hasher) with all of x, using SSE4.2's dedicated
+// CRC32 instruction, 8 bytes at a time.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__crc32_castagnoli_x86_sse42(uint32_t s,
+                                                wuffs_base__slice_u8 x) {
+  uint8_t* p = x.ptr;
+  size_t n = x.len;
+
+  uint64_t s64 = s;
+  while (n >= 32) {
+    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 0));
+    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 8));
+    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 16));
+    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 24));
+    p += 32;
+    n -= 32;
+  }
+  while (n >= 8) {
+    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p));
+    p += 8;
+    n -= 8;
+  }
+
+  s = (uint32_t)s64;
+  while (n--) {
+    s = _mm_crc32_u8(s, *p++);
+  }
+  return s;
+}
+
+// wuffs_base__utility__adler32_x86_sse42 updates the Adler-32 state s (s2 in
+// the high 16 bits, s1 in the low 16 bits, as per std/adler32's hasher) with
+// the first (x.len & ~31) bytes of x, 32 bytes at a time.
+//
+// Within each 32 byte block, s1 gains the sum of the bytes (via PSADBW) and
+// s2 gains their sum weighted by 32, 31, ..., 1 (via PMADDUBSW and PMADDWD),
+// plus 32 times the previous s1. As with the portable code, both are reduced
+// modulo 65521 at least every 5552 bytes, so that they cannot overflow.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__adler32_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {
+  uint32_t s1 = s & 0xFFFF;
+  uint32_t s2 = s >> 16;
+  uint8_t* p = x.ptr;
+  size_t blocks = x.len / 32;
+
+  __m128i weights_hi = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25,  //
+                                     24, 23, 22, 21, 20, 19, 18, 17);
+  __m128i weights_lo = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9,  //
+                                     8, 7, 6, 5, 4, 3, 2, 1);
+  __m128i ones = _mm_set1_epi16(1);
+  __m128i zero = _mm_setzero_si128();
+
+  while (blocks > 0) {
+    // 5536 is the largest multiple of 32 that is at most 5552.
+    size_t n = 5536 / 32;
+    if (n > blocks) {
+      n = blocks;
+    }
+    blocks -= n;
+
+    // v_ps accumulates the sum of s1 over the n blocks, to be multiplied by
+    // 32 (the block size) and added to s2 afterwards.
+    __m128i v_ps = _mm_cvtsi32_si128((int)(s1 * n));
+    __m128i v_s1 = _mm_setzero_si128();
+    __m128i v_s2 = _mm_cvtsi32_si128((int)s2);
+
+    do {
+      __m128i hi = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00));
+      __m128i lo = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x10));
+      v_ps = _mm_add_epi32(v_ps, v_s1);
+      v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(hi, zero));
+      v_s2 = _mm_add_epi32(
+          v_s2, _mm_madd_epi16(_mm_maddubs_epi16(hi, weights_hi), ones));
+      v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(lo, zero));
+      v_s2 = _mm_add_epi32(
+          v_s2, _mm_madd_epi16(_mm_maddubs_epi16(lo, weights_lo), ones));
+      p += 32;
+    } while (--n);
+
+    v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));
+
+    // Horizontally sum the 4 lanes of v_s1 and of v_s2.
+    v_s1 =
+        _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(2, 3, 0, 1)));
+    v_s1 =
+        _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(1, 0, 3, 2)));
+    v_s2 =
+        _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(2, 3, 0, 1)));
+    v_s2 =
+        _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(1, 0, 3, 2)));
+
+    s1 = (s1 + (uint32_t)_mm_cvtsi128_si32(v_s1)) % 65521;
+    s2 = ((uint32_t)_mm_cvtsi128_si32(v_s2)) % 65521;
+  }
+  return (s2 << 16) | s1;
+}
+
+// wuffs_base__utility__json_string_span_x86_sse42 returns the number of
+// leading bytes, out of the 16 bytes given by lo and hi (in little-endian
+// order), that are valid UTF-8 but not '"', '\\' or a C0 control code. For
+// ASCII, these are the bytes that std/json's LUT_CHARS maps to 0x00. As signed
+// 8-bit integers, both C0 control codes and non-ASCII bytes are less than
+// 0x20, so the UTF-8 validation is skipped unless the first such byte is
+// non-ASCII. The span always ends at a code point boundary, but it can stop
+// short of the longest valid prefix, as per
+// wuffs_base__cpu_arch__utf_8_span_x86_sse42.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__json_string_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  __m128i x = _mm_set_epi64x((long long)hi, (long long)lo);
+  __m128i m = _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x22)),
+                           _mm_cmpeq_epi8(x, _mm_set1_epi8(0x5C)));
+  uint32_t stops = (uint32_t)_mm_movemask_epi8(
+      _mm_or_si128(m, _mm_cmplt_epi8(x, _mm_set1_epi8(0x20))));
+  uint32_t n = (uint32_t)__builtin_ctz(stops | 0x10000u);
+  if ((n >= 16) || (0 == ((1u << n) & (uint32_t)_mm_movemask_epi8(x)))) {
+    return n;
+  }
+  // Exclude the non-ASCII bytes from the stops, but include the C0 controls.
+  // As unsigned 8-bit integers, C0 control codes are at most 0x1F.
+  stops = (uint32_t)_mm_movemask_epi8(_mm_or_si128(
+      m, _mm_cmpeq_epi8(x, _mm_min_epu8(x, _mm_set1_epi8(0x1F)))));
+  return wuffs_base__cpu_arch__utf_8_span_x86_sse42(x, stops);
+}
+
+// wuffs_base__utility__json_whitespace_span_x86_sse42 returns the number of
+// leading bytes, out of the 16 bytes given by lo and hi (in little-endian
+// order), that are JSON whitespace: '\t', '\n', '\r' or ' '.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__json_whitespace_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  __m128i x = _mm_set_epi64x((long long)hi, (long long)lo);
+  __m128i m = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x09)),
+                   _mm_cmpeq_epi8(x, _mm_set1_epi8(0x0A))),
+      _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x0D)),
+                   _mm_cmpeq_epi8(x, _mm_set1_epi8(0x20))));
+  return (uint32_t)__builtin_ctz(~((unsigned int)_mm_movemask_epi8(m)));
+}
+
+// wuffs_base__utility__json_skip_span_x86_sse42 returns the number of leading
+// bytes, out of the 16 bytes given by lo and hi (in little-endian order), that
+// are not '"', '\\' or a bracket: '[', ']', '{' or '}'. As an optimization,
+// '|' is also excluded, as OR-ing with 0x20 maps "[\\]" to "{|}".
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint32_t  //
+wuffs_base__utility__json_skip_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  __m128i x = _mm_set_epi64x((long long)hi, (long long)lo);
+  __m128i y = _mm_or_si128(x, _mm_set1_epi8(0x20));
+  __m128i m = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x22)),
+                   _mm_cmpeq_epi8(y, _mm_set1_epi8(0x7B))),
+      _mm_or_si128(_mm_cmpeq_epi8(y, _mm_set1_epi8(0x7C)),
+                   _mm_cmpeq_epi8(y, _mm_set1_epi8(0x7D))));
+  return (uint32_t)__builtin_ctz(((unsigned int)_mm_movemask_epi8(m)) |
+                                 0x10000u);
+}
+
+// The wuffs_base__utility__png_filter_etc_x86_sse42 functions reverse PNG
+// filtering, in place, for the first (curr.len / d) * d bytes of curr, where d
+// (the filter distance) is 3 or 4 bytes per pixel. prev is the previous row,
+// already unfiltered, and must be at least as long as curr. Every curr pixel
+// depends on its left neighbor, so the Average and Paeth filters work on one
+// pixel (all of its channels) at a time, but the Sub filter works on four
+// pixels at a time.
+
+// wuffs_base__utility__png_filter_1_distance_4_x86_sse42 reverses the PNG Sub
+// filter. Within each 16 byte block, two shift-and-add steps compute a prefix
+// sum of its four pixels, to which is added the previous block's last pixel.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_1_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr) {
+  uint8_t* p = curr.ptr;
+  size_t n = curr.len & ~(size_t)3;
+  __m128i a = _mm_setzero_si128();
+
+  for (; n >= 16; n -= 16, p += 16) {
+    __m128i x = _mm_lddqu_si128((const __m128i*)(const void*)p);
+    x = _mm_add_epi8(x, _mm_slli_si128(x, 4));
+    x = _mm_add_epi8(x, _mm_slli_si128(x, 8));
+    x = _mm_add_epi8(x, a);
+    _mm_storeu_si128((__m128i*)(void*)p, x);
+    a = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+  }
+
+  for (; n >= 4; n -= 4, p += 4) {
+    a = _mm_add_epi8(
+        a, _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(p)));
+    wuffs_base__store_u32le__no_bounds_check(p,
+                                             (uint32_t)_mm_cvtsi128_si32(a));
+  }
+}
+
+// wuffs_base__utility__png_filter_3_x86_sse42 reverses the PNG Average filter.
+// PAVGB rounds up, so the floor of the mean is PAVGB minus the low bit of the
+// XOR of its arguments.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_3_x86_sse42(wuffs_base__slice_u8 curr,
+                                            wuffs_base__slice_u8 prev,
+                                            size_t d) {
+  uint8_t* p = curr.ptr;
+  const uint8_t* q = prev.ptr;
+  size_t n = curr.len - (curr.len % d);
+  __m128i ones = _mm_set1_epi8(1);
+  __m128i a = _mm_setzero_si128();
+
+  for (; n >= d; n -= d, p += d, q += d) {
+    __m128i b;
+    __m128i x;
+    if (d == 4) {
+      b = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(q));
+      x = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(p));
+    } else {
+      b = _mm_cvtsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(q));
+      x = _mm_cvtsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(p));
+    }
+    __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b),
+                               _mm_and_si128(_mm_xor_si128(a, b), ones));
+    a = _mm_add_epi8(x, avg);
+    if (d == 4) {
+      wuffs_base__store_u32le__no_bounds_check(p,
+                                               (uint32_t)_mm_cvtsi128_si32(a));
+    } else {
+      wuffs_base__store_u24le__no_bounds_check(p,
+                                               (uint32_t)_mm_cvtsi128_si32(a));
+    }
+  }
+}
+
+// wuffs_base__utility__png_filter_4_x86_sse42 reverses the PNG Paeth filter,
+// in 16-bit lanes. With a, b and c being the left, up and up-left neighbors,
+// the predictor p = a + b - c is closest to a, b or c (in that order of
+// preference) when |b - c|, |a - c| or |a + b - 2c| is smallest.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_4_x86_sse42(wuffs_base__slice_u8 curr,
+                                            wuffs_base__slice_u8 prev,
+                                            size_t d) {
+  uint8_t* p = curr.ptr;
+  const uint8_t* q = prev.ptr;
+  size_t n = curr.len - (curr.len % d);
+  __m128i zero = _mm_setzero_si128();
+  __m128i mask = _mm_set1_epi16(0xFF);
+  __m128i a = _mm_setzero_si128();
+  __m128i c = _mm_setzero_si128();
+
+  for (; n >= d; n -= d, p += d, q += d) {
+    __m128i b;
+    __m128i x;
+    if (d == 4) {
+      b = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(q));
+      x = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(p));
+    } else {
+      b = _mm_cvtsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(q));
+      x = _mm_cvtsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(p));
+    }
+    b = _mm_unpacklo_epi8(b, zero);
+    x = _mm_unpacklo_epi8(x, zero);
+
+    __m128i b_c = _mm_sub_epi16(b, c);
+    __m128i a_c = _mm_sub_epi16(a, c);
+    __m128i pa = _mm_abs_epi16(b_c);
+    __m128i pb = _mm_abs_epi16(a_c);
+    __m128i pc = _mm_abs_epi16(_mm_add_epi16(b_c, a_c));
+    __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+    __m128i nearest = _mm_blendv_epi8(
+        _mm_blendv_epi8(c, b, _mm_cmpeq_epi16(smallest, pb)), a,
+        _mm_cmpeq_epi16(smallest, pa));
+
+    a = _mm_and_si128(_mm_add_epi16(x, nearest), mask);
+    c = b;
+    uint32_t v = (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(a, a));
+    if (d == 4) {
+      wuffs_base__store_u32le__no_bounds_check(p, v);
+    } else {
+      wuffs_base__store_u24le__no_bounds_check(p, v);
+    }
+  }
+}
+
+// The distance-specific wrappers let the compiler specialize the loops above
+// for a constant d.
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_3_distance_3_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {
+  wuffs_base__utility__png_filter_3_x86_sse42(curr, prev, 3);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_3_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {
+  wuffs_base__utility__png_filter_3_x86_sse42(curr, prev, 4);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_4_distance_3_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {
+  wuffs_base__utility__png_filter_4_x86_sse42(curr, prev, 3);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline void  //
+wuffs_base__utility__png_filter_4_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {
+  wuffs_base__utility__png_filter_4_x86_sse42(curr, prev, 4);
+}
+
+#else  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static inline uint32_t  //
+wuffs_base__utility__crc32_ieee_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {
+  return s;
+}
+
+static inline uint32_t  //
+wuffs_base__utility__crc32_castagnoli_x86_sse42(uint32_t s,
+                                                wuffs_base__slice_u8 x) {
+  return s;
+}
+
+static inline uint32_t  //
+wuffs_base__utility__adler32_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {
+  return s;
+}
+
+static inline uint32_t  //
+wuffs_base__utility__json_string_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  return 0;
+}
+
+static inline uint32_t  //
+wuffs_base__utility__json_skip_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  return 0;
+}
+
+static inline uint32_t  //
+wuffs_base__utility__json_whitespace_span_x86_sse42(uint64_t lo, uint64_t hi) {
+  return 0;
+}
+
+static inline void  //
+wuffs_base__utility__png_filter_1_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr) {}
+
+static inline void  //
+wuffs_base__utility__png_filter_3_distance_3_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {}
+
+static inline void  //
+wuffs_base__utility__png_filter_3_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {}
+
+static inline void  //
+wuffs_base__utility__png_filter_4_distance_3_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {}
+
+static inline void  //
+wuffs_base__utility__png_filter_4_distance_4_x86_sse42(
+    wuffs_base__slice_u8 curr,
+    wuffs_base__slice_u8 prev) {}
+
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
@@ -73,6 +73,23 @@ wuffs_base__ignore_status(wuffs_base__status z) {
 #define WUFFS_BASE__UNLIKELY(expr) (expr)
 #endif
 
+// The WUFFS_BASE__STATS__ETC macros update a wuffs_foo__bar struct's
+// instrumentation counters. Unless WUFFS_CONFIG__ENABLE_STATS is defined,
+// there are no counters and the macros compile to nothing.
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+#define WUFFS_BASE__STATS__CALL(self, f) \
+  ((self)->private_impl.stats.funcs[f].num_calls++)
+#define WUFFS_BASE__STATS__WRITTEN(self, f, n) \
+  ((self)->private_impl.stats.funcs[f].num_written += (uint64_t)(n))
+#define WUFFS_BASE__STATS__SUSPENSION(self, status) \
+  ((self)->private_impl.stats.num_suspensions +=    \
+   (wuffs_base__status__is_suspension(status) ? 1 : 0))
+#else
+#define WUFFS_BASE__STATS__CALL(self, f) ((void)0)
+#define WUFFS_BASE__STATS__WRITTEN(self, f, n) ((void)0)
+#define WUFFS_BASE__STATS__SUSPENSION(self, status) ((void)0)
+#endif
+
 // ---------------- Numeric Types
 
 extern const uint8_t wuffs_base__low_bits_mask__u8[9];
@@ -141,6 +141,19 @@ typedef struct {
   const void* function_pointers;
 } wuffs_base__vtable;
 
+// wuffs_base__func_stats holds one function's instrumentation counters. They
+// are only updated if WUFFS_CONFIG__ENABLE_STATS is defined, in which case
+// each wuffs_foo__bar struct has a wuffs_foo__bar__get_stats function.
+typedef struct {
+  // num_calls counts the calls to the function, including each resumption of
+  // a suspended coroutine.
+  uint64_t num_calls;
+  // num_written counts the bytes (or tokens) written to the function's dst
+  // argument, including those written by the functions that it calls. It is
+  // zero if the function has no io_writer (or token_writer) argument.
+  uint64_t num_written;
+} wuffs_base__func_stats;
+
 // --------
 
 // See https://github.com/google/wuffs/blob/master/doc/note/statuses.md
@@ -59,6 +59,34 @@ wuffs_base__color_u32_argb_premul__as__color_u8_gray(
   return (uint8_t)(weighted_average >> 24);
 }
 
+// wuffs_base__color_ycc__as__color_u32_argb_premul converts from 8-bit YCbCr
+// (luma, chroma-blue, chroma-red) to opaque 8-bit RGB. The coefficients are
+// those given by the JFIF specification, for full range (0 ..= 255) luma.
+static inline wuffs_base__color_u32_argb_premul  //
+wuffs_base__color_ycc__as__color_u32_argb_premul(uint8_t yy,
+                                                 uint8_t cb,
+                                                 uint8_t cr) {
+  // The fractional parts of the coefficients (1.402, 0.344136, 0.714136 and
+  // 1.772) are scaled by (1 << 15) and each product is rounded separately,
+  // mimicking the x86 SIMD _mm_mulhrs_epi16 instruction, so that the SIMD and
+  // non-SIMD swizzlers produce the same output. Adding 0x40000000 (and
+  // subtracting 0x8000 after the shift) keeps the right shift's operand
+  // non-negative, as right-shifting a negative int32_t is implementation
+  // defined.
+  int32_t y1 = (int32_t)yy;
+  int32_t b1 = ((int32_t)cb) - 128;
+  int32_t r1 = ((int32_t)cr) - 128;
+  int32_t r = y1 + r1 + ((((r1 * +13173) + 0x40004000) >> 15) - 0x8000);
+  int32_t g = y1 + ((((b1 * -11277) + 0x40004000) >> 15) - 0x8000) +
+              ((((r1 * -23401) + 0x40004000) >> 15) - 0x8000);
+  int32_t b = y1 + b1 + ((((b1 * +25297) + 0x40004000) >> 15) - 0x8000);
+  r = (r < 0) ? 0 : ((r > 255) ? 255 : r);
+  g = (g < 0) ? 0 : ((g > 255) ? 255 : g);
+  b = (b < 0) ? 0 : ((b > 255) ? 255 : b);
+  return 0xFF000000 | (((uint32_t)r) << 16) | (((uint32_t)g) << 8) |
+         (((uint32_t)b) << 0);
+}
+
 // wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul converts
 // from non-premultiplied alpha to premultiplied alpha.
 static inline wuffs_base__color_u32_argb_premul  //
@@ -109,6 +137,51 @@ wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(
   return (a << 24) | (r << 16) | (g << 8) | (b << 0);
 }
 
+// wuffs_base__color_u32__as__color_u64 converts from 8-bit to 16-bit color,
+// with the same alpha premultiplication (or lack of it). Each 16-bit channel
+// in the uint64_t result is at four times the bit offset of the corresponding
+// 8-bit channel in the uint32_t argument.
+static inline uint64_t  //
+wuffs_base__color_u32__as__color_u64(uint32_t c) {
+  uint64_t a = 0x101 * (0xFF & (c >> 24));
+  uint64_t r = 0x101 * (0xFF & (c >> 16));
+  uint64_t g = 0x101 * (0xFF & (c >> 8));
+  uint64_t b = 0x101 * (0xFF & (c >> 0));
+  return (a << 48) | (r << 32) | (g << 16) | (b << 0);
+}
+
+// wuffs_base__color_u64__as__color_u32 converts from 16-bit to 8-bit color,
+// with the same alpha premultiplication (or lack of it).
+static inline uint32_t  //
+wuffs_base__color_u64__as__color_u32(uint64_t c) {
+  uint32_t a = ((uint32_t)(0xFF & (c >> 56)));
+  uint32_t r = ((uint32_t)(0xFF & (c >> 40)));
+  uint32_t g = ((uint32_t)(0xFF & (c >> 24)));
+  uint32_t b = ((uint32_t)(0xFF & (c >> 8)));
+  return (a << 24) | (r << 16) | (g << 8) | (b << 0);
+}
+
+// wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul converts
+// from 8-bit non-premultiplied alpha to 16-bit premultiplied alpha, without
+// the intermediate rounding to 8 bits that
+// wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul does.
+static inline uint64_t  //
+wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(
+    uint32_t argb_nonpremul) {
+  uint32_t a = 0xFF & (argb_nonpremul >> 24);
+  uint32_t a16 = a * (0x101 * 0x101);
+
+  uint32_t r = 0xFF & (argb_nonpremul >> 16);
+  r = (r * a16) / 0xFFFF;
+  uint32_t g = 0xFF & (argb_nonpremul >> 8);
+  g = (g * a16) / 0xFFFF;
+  uint32_t b = 0xFF & (argb_nonpremul >> 0);
+  b = (b * a16) / 0xFFFF;
+
+  return (((uint64_t)(a * 0x101)) << 48) | (((uint64_t)r) << 32) |
+         (((uint64_t)g) << 16) | (((uint64_t)b) << 0);
+}
+
 // --------
 
 typedef uint8_t wuffs_base__pixel_blend;
@@ -209,6 +282,16 @@ wuffs_base__make_pixel_format(uint32_t repr) {
 #define WUFFS_BASE__PIXEL_FORMAT__CMY 0xC0020888
 #define WUFFS_BASE__PIXEL_FORMAT__CMYK 0xD0038888
 
+  // Common 16-bit-depth pixel formats, whose channels are each a little-endian
+  // uint16_t. Like the 8-bit-depth formats, the channels are listed in memory
+  // order: BGRA means that blue is at the lowest address.
+
+#define WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE 0x8100BBBB
+#define WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE 0x8200BBBB
+
+#define WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL_4X16LE 0xA100BBBB
+#define WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE 0xA200BBBB
+
 extern const uint32_t wuffs_base__pixel_format__bits_per_channel[16];
 
 static inline bool  //
@@ -524,8 +607,34 @@ wuffs_base__pixel_config__pixbuf_len(const wuffs_base__pixel_config* c) {
     return 0;
   }
   if (wuffs_base__pixel_format__is_planar(&c->private_impl.pixfmt)) {
-    // TODO: support planar pixel formats, concious of pixel subsampling.
-    return 0;
+    // Each plane holds one 8-bit channel, with one sample per macropixel.
+    // The planes are laid out one after the other.
+    uint64_t n = 0;
+    uint32_t num_planes =
+        wuffs_base__pixel_format__num_planes(&c->private_impl.pixfmt);
+    uint32_t p;
+    for (p = 0; p < num_planes; p++) {
+      if (((c->private_impl.pixfmt.repr >> (4 * p)) & 0x0F) != 0x08) {
+        // TODO: support other bit depths and multi-channel planes.
+        return 0;
+      }
+      uint64_t dx = wuffs_base__pixel_subsampling__denominator_x(
+          &c->private_impl.pixsub, p);
+      uint64_t dy = wuffs_base__pixel_subsampling__denominator_y(
+          &c->private_impl.pixsub, p);
+      uint64_t w =
+          (((uint64_t)c->private_impl.width) +
+           wuffs_base__pixel_subsampling__bias_x(&c->private_impl.pixsub, p) +
+           dx - 1) /
+          dx;
+      uint64_t h =
+          (((uint64_t)c->private_impl.height) +
+           wuffs_base__pixel_subsampling__bias_y(&c->private_impl.pixsub, p) +
+           dy - 1) /
+          dy;
+      n += w * h;
+    }
+    return n;
   }
   uint32_t bits_per_pixel =
       wuffs_base__pixel_format__bits_per_pixel(&c->private_impl.pixfmt);
@@ -1063,8 +1172,51 @@ wuffs_base__pixel_buffer__set_from_slice(wuffs_base__pixel_buffer* pb,
     return wuffs_base__make_status(wuffs_base__error__bad_argument);
   }
   if (wuffs_base__pixel_format__is_planar(&pixcfg->private_impl.pixfmt)) {
-    // TODO: support planar pixel formats, concious of pixel subsampling.
-    return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+    // Split the pixbuf_memory into one table per plane, in the same layout
+    // as used by wuffs_base__pixel_config__pixbuf_len.
+    wuffs_base__table_u8 tabs[WUFFS_BASE__PIXEL_FORMAT__NUM_PLANES_MAX];
+    uint8_t* ptr = pixbuf_memory.ptr;
+    uint64_t len = pixbuf_memory.len;
+    uint32_t num_planes =
+        wuffs_base__pixel_format__num_planes(&pixcfg->private_impl.pixfmt);
+    uint32_t p;
+    for (p = 0; p < num_planes; p++) {
+      if (((pixcfg->private_impl.pixfmt.repr >> (4 * p)) & 0x0F) != 0x08) {
+        // TODO: support other bit depths and multi-channel planes.
+        return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+      }
+      uint64_t dx = wuffs_base__pixel_subsampling__denominator_x(
+          &pixcfg->private_impl.pixsub, p);
+      uint64_t dy = wuffs_base__pixel_subsampling__denominator_y(
+          &pixcfg->private_impl.pixsub, p);
+      uint64_t w = (((uint64_t)pixcfg->private_impl.width) +
+                    wuffs_base__pixel_subsampling__bias_x(
+                        &pixcfg->private_impl.pixsub, p) +
+                    dx - 1) /
+                   dx;
+      uint64_t h = (((uint64_t)pixcfg->private_impl.height) +
+                    wuffs_base__pixel_subsampling__bias_y(
+                        &pixcfg->private_impl.pixsub, p) +
+                    dy - 1) /
+                   dy;
+      uint64_t wh = w * h;
+      if ((w > SIZE_MAX) || (wh > len)) {
+        return wuffs_base__make_status(
+            wuffs_base__error__bad_argument_length_too_short);
+      }
+      tabs[p].ptr = ptr;
+      tabs[p].width = (size_t)w;
+      tabs[p].height = (size_t)h;
+      tabs[p].stride = (size_t)w;
+      ptr += wh;
+      len -= wh;
+    }
+
+    pb->pixcfg = *pixcfg;
+    for (p = 0; p < num_planes; p++) {
+      pb->private_impl.planes[p] = tabs[p];
+    }
+    return wuffs_base__make_status(NULL);
   }
   uint32_t bits_per_pixel =
       wuffs_base__pixel_format__bits_per_pixel(&pixcfg->private_impl.pixfmt);
@@ -1251,20 +1403,277 @@ wuffs_base__pixel_buffer::set_color_u32_at(
 
 // --------
 
+// wuffs_base__decode_frame_options are optional arguments to an image
+// decoder's decode_frame method. A NULL pointer is equivalent to the options
+// returned by wuffs_base__null_decode_frame_options.
+//
+// The scale_shift option, ranging from 0 to 3 inclusive, downscales the frame
+// by a factor of (1 << scale_shift) in each dimension, using nearest neighbor
+// sampling: the source pixel at (x, y) is written to the destination pixel at
+// ((x >> scale_shift), (y >> scale_shift)) if both x and y are multiples of
+// that factor, and is not written at all otherwise. The destination
+// pixel_buffer only needs to be as large as the scale_rect of the image
+// bounds. A decoder's frame_dirty_rect is also in scaled coordinates, but its
+// frame_config bounds are not, as they are decoded before the options apply.
+//
+// The crop_rect option, in source (image) coordinates, restricts decoding to
+// a region of interest. Source pixels outside of it are not written (or even
+// converted to the destination pixel format) and the source pixel at (x, y)
+// is written as if it were at ((x - crop.min_incl_x), (y - crop.min_incl_y)),
+// before any scaling. The destination pixel_buffer only needs to be as large
+// as the dst_rect of the image bounds. An empty crop_rect (the default) means
+// no cropping.
+//
+// The band_height option, if non-zero, lets the destination pixel_buffer hold
+// only band_height rows (of the dst_rect's width) instead of the whole frame,
+// so that peak memory use does not depend on the image height. The dst_rect
+// is partitioned into bands of band_height rows each (the last band may be
+// shorter) and the destination row y is written to the pixel_buffer row (y -
+// band.min_incl_y). Before writing the first row of the next band, the
+// decoder suspends with wuffs_base__suspension__short_write. The caller
+// should then consume the completed band, whose rows are given by the
+// decoder's frame_dirty_rect, and call decode_frame again with the same
+// arguments. Once decode_frame returns OK, frame_dirty_rect gives the final
+// band. Every band is reported exactly once, in the order that the image
+// format stores its rows (e.g. bottom-up for most BMP images), even if no
+// pixels in it were written, and pixels that the image data does not write
+// (e.g. those skipped over by BMP RLE deltas) are left as-is, so callers may
+// want to clear the pixel_buffer between bands. Decoders that cannot stream
+// bands (e.g. because they can revisit previous rows, as interlaced GIF frames
+// do) fail with wuffs_base__error__unsupported_option.
 typedef struct {
   // Do not access the private_impl's fields directly. There is no API/ABI
   // compatibility or safety guarantee if you do so.
   struct {
-    uint8_t TODO;
+    uint32_t scale_shift;
+    wuffs_base__rect_ie_u32 crop_rect;
+    uint32_t band_height;
   } private_impl;
 
 #ifdef __cplusplus
+  inline void set_scale_shift(uint32_t scale_shift);
+  inline uint32_t scale_shift() const;
+  inline wuffs_base__rect_ie_u32 scale_rect(wuffs_base__rect_ie_u32 r) const;
+  inline void set_crop_rect(wuffs_base__rect_ie_u32 crop_rect);
+  inline wuffs_base__rect_ie_u32 crop_rect() const;
+  inline uint32_t crop_min_incl_x() const;
+  inline uint32_t crop_min_incl_y() const;
+  inline uint32_t crop_max_excl_x() const;
+  inline uint32_t crop_max_excl_y() const;
+  inline wuffs_base__rect_ie_u32 dst_rect(wuffs_base__rect_ie_u32 r) const;
+  inline void set_band_height(uint32_t band_height);
+  inline uint32_t band_height() const;
 #endif  // __cplusplus
 
 } wuffs_base__decode_frame_options;
 
+#define WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL 3
+
+static inline wuffs_base__decode_frame_options  //
+wuffs_base__null_decode_frame_options() {
+  wuffs_base__decode_frame_options ret;
+  ret.private_impl.scale_shift = 0;
+  ret.private_impl.crop_rect = wuffs_base__empty_rect_ie_u32();
+  ret.private_impl.band_height = 0;
+  return ret;
+}
+
+// wuffs_base__decode_frame_options__set_scale_shift sets the scale_shift,
+// clamping it to WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL.
+static inline void  //
+wuffs_base__decode_frame_options__set_scale_shift(
+    wuffs_base__decode_frame_options* o,
+    uint32_t scale_shift) {
+  if (!o) {
+    return;
+  }
+  o->private_impl.scale_shift =
+      (scale_shift < WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL)
+          ? scale_shift
+          : WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL;
+}
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__scale_shift(
+    const wuffs_base__decode_frame_options* o) {
+  return o ? o->private_impl.scale_shift : 0;
+}
+
+// wuffs_base__decode_frame_options__scale_rect returns the rectangle, in
+// destination coordinates, that the source rectangle r is written to. Each
+// bound is divided by (1 << scale_shift), rounding up, so that e.g. a 5 pixel
+// wide image is scaled by a half to be 3 pixels wide.
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options__scale_rect(
+    const wuffs_base__decode_frame_options* o,
+    wuffs_base__rect_ie_u32 r) {
+  uint32_t s = wuffs_base__decode_frame_options__scale_shift(o);
+  uint64_t m = (((uint64_t)1) << s) - 1;
+  wuffs_base__rect_ie_u32 ret;
+  ret.min_incl_x = (uint32_t)((r.min_incl_x + m) >> s);
+  ret.min_incl_y = (uint32_t)((r.min_incl_y + m) >> s);
+  ret.max_excl_x = (uint32_t)((r.max_excl_x + m) >> s);
+  ret.max_excl_y = (uint32_t)((r.max_excl_y + m) >> s);
+  return ret;
+}
+
+static inline void  //
+wuffs_base__decode_frame_options__set_crop_rect(
+    wuffs_base__decode_frame_options* o,
+    wuffs_base__rect_ie_u32 crop_rect) {
+  if (!o) {
+    return;
+  }
+  o->private_impl.crop_rect = crop_rect;
+}
+
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options__crop_rect(
+    const wuffs_base__decode_frame_options* o) {
+  return o ? o->private_impl.crop_rect : wuffs_base__empty_rect_ie_u32();
+}
+
+// wuffs_base__decode_frame_options__crop_min_incl_x etc. return the crop_rect
+// bounds, treating an empty crop_rect (no cropping) as the largest possible
+// rectangle.
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__crop_min_incl_x(
+    const wuffs_base__decode_frame_options* o) {
+  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))
+             ? 0
+             : o->private_impl.crop_rect.min_incl_x;
+}
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__crop_min_incl_y(
+    const wuffs_base__decode_frame_options* o) {
+  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))
+             ? 0
+             : o->private_impl.crop_rect.min_incl_y;
+}
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__crop_max_excl_x(
+    const wuffs_base__decode_frame_options* o) {
+  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))
+             ? 0xFFFFFFFF
+             : o->private_impl.crop_rect.max_excl_x;
+}
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__crop_max_excl_y(
+    const wuffs_base__decode_frame_options* o) {
+  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))
+             ? 0xFFFFFFFF
+             : o->private_impl.crop_rect.max_excl_y;
+}
+
+// wuffs_base__decode_frame_options__dst_rect returns the rectangle, in
+// destination coordinates, that the source rectangle r is written to: r is
+// intersected with the crop_rect (if non-empty), translated so that the
+// crop_rect's top-left corner is the origin and then scaled.
+static inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options__dst_rect(
+    const wuffs_base__decode_frame_options* o,
+    wuffs_base__rect_ie_u32 r) {
+  uint32_t x0 = wuffs_base__decode_frame_options__crop_min_incl_x(o);
+  uint32_t y0 = wuffs_base__decode_frame_options__crop_min_incl_y(o);
+  r = wuffs_base__rect_ie_u32__intersect(
+      &r, wuffs_base__make_rect_ie_u32(
+              x0, y0, wuffs_base__decode_frame_options__crop_max_excl_x(o),
+              wuffs_base__decode_frame_options__crop_max_excl_y(o)));
+  if (wuffs_base__rect_ie_u32__is_empty(&r)) {
+    return wuffs_base__empty_rect_ie_u32();
+  }
+  r.min_incl_x -= x0;
+  r.min_incl_y -= y0;
+  r.max_excl_x -= x0;
+  r.max_excl_y -= y0;
+  return wuffs_base__decode_frame_options__scale_rect(o, r);
+}
+
+// wuffs_base__decode_frame_options__set_band_height sets the band_height. Zero
+// (the default) means that the whole frame is decoded in one go.
+static inline void  //
+wuffs_base__decode_frame_options__set_band_height(
+    wuffs_base__decode_frame_options* o,
+    uint32_t band_height) {
+  if (!o) {
+    return;
+  }
+  o->private_impl.band_height = band_height;
+}
+
+static inline uint32_t  //
+wuffs_base__decode_frame_options__band_height(
+    const wuffs_base__decode_frame_options* o) {
+  return o ? o->private_impl.band_height : 0;
+}
+
 #ifdef __cplusplus
 
+inline void  //
+wuffs_base__decode_frame_options::set_scale_shift(uint32_t scale_shift) {
+  wuffs_base__decode_frame_options__set_scale_shift(this, scale_shift);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::scale_shift() const {
+  return wuffs_base__decode_frame_options__scale_shift(this);
+}
+
+inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options::scale_rect(wuffs_base__rect_ie_u32 r) const {
+  return wuffs_base__decode_frame_options__scale_rect(this, r);
+}
+
+inline void  //
+wuffs_base__decode_frame_options::set_crop_rect(
+    wuffs_base__rect_ie_u32 crop_rect) {
+  wuffs_base__decode_frame_options__set_crop_rect(this, crop_rect);
+}
+
+inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options::crop_rect() const {
+  return wuffs_base__decode_frame_options__crop_rect(this);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::crop_min_incl_x() const {
+  return wuffs_base__decode_frame_options__crop_min_incl_x(this);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::crop_min_incl_y() const {
+  return wuffs_base__decode_frame_options__crop_min_incl_y(this);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::crop_max_excl_x() const {
+  return wuffs_base__decode_frame_options__crop_max_excl_x(this);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::crop_max_excl_y() const {
+  return wuffs_base__decode_frame_options__crop_max_excl_y(this);
+}
+
+inline wuffs_base__rect_ie_u32  //
+wuffs_base__decode_frame_options::dst_rect(wuffs_base__rect_ie_u32 r) const {
+  return wuffs_base__decode_frame_options__dst_rect(this, r);
+}
+
+inline void  //
+wuffs_base__decode_frame_options::set_band_height(uint32_t band_height) {
+  wuffs_base__decode_frame_options__set_band_height(this, band_height);
+}
+
+inline uint32_t  //
+wuffs_base__decode_frame_options::band_height() const {
+  return wuffs_base__decode_frame_options__band_height(this);
+}
+
 #endif  // __cplusplus
 
 // --------
@@ -1286,17 +1695,109 @@ wuffs_base__pixel_palette__closest_element(
 
 // --------
 
+#define WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE 4096
+
+// wuffs_base__pixel_palette_lookup speeds up repeatedly finding a palette's
+// closest element to a color. It is prepared once per palette and then gives
+// the same answers as wuffs_base__pixel_palette__closest_element, including
+// tie breaks, but faster: the palette is converted to premultiplied alpha and
+// sorted (by green) only once, so that a search can skip elements that are
+// too far away, and a direct-mapped cache remembers recently seen colors.
+//
+// Preparing a lookup copies the palette. Changing the palette afterwards
+// requires preparing the lookup again.
+//
+// It is about 25 KiB in size, which may be too large for some stacks.
+typedef struct {
+  // Do not access the private_impl's fields directly. There is no API/ABI
+  // compatibility or safety guarantee if you do so.
+  struct {
+    uint32_t num_elements;
+    // The elements are 16-bit premultiplied B, G, R and A values.
+    uint32_t elements[256][4];
+    uint8_t sorted_by_green[256];
+    uint32_t cache_colors[WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE];
+    uint8_t cache_indexes[WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE];
+  } private_impl;
+
+#ifdef __cplusplus
+  inline wuffs_base__status prepare(wuffs_base__slice_u8 palette_slice,
+                                    wuffs_base__pixel_format palette_format);
+  inline uint8_t closest_element(wuffs_base__color_u32_argb_premul c);
+#endif  // __cplusplus
+
+} wuffs_base__pixel_palette_lookup;
+
+// wuffs_base__pixel_palette_lookup__prepare readies the lookup for the given
+// palette, whose format should be one of the INDEXED__BGRA_ETC formats.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_palette_lookup__prepare(
+    wuffs_base__pixel_palette_lookup* p,
+    wuffs_base__slice_u8 palette_slice,
+    wuffs_base__pixel_format palette_format);
+
+// wuffs_base__pixel_palette_lookup__closest_element is like
+// wuffs_base__pixel_palette__closest_element for the prepared palette. It
+// updates the lookup's cache, so that p is not a const pointer.
+WUFFS_BASE__MAYBE_STATIC uint8_t  //
+wuffs_base__pixel_palette_lookup__closest_element(
+    wuffs_base__pixel_palette_lookup* p,
+    wuffs_base__color_u32_argb_premul c);
+
+#ifdef __cplusplus
+
+inline wuffs_base__status  //
+wuffs_base__pixel_palette_lookup::prepare(
+    wuffs_base__slice_u8 palette_slice,
+    wuffs_base__pixel_format palette_format) {
+  return wuffs_base__pixel_palette_lookup__prepare(this, palette_slice,
+                                                   palette_format);
+}
+
+inline uint8_t  //
+wuffs_base__pixel_palette_lookup::closest_element(
+    wuffs_base__color_u32_argb_premul c) {
+  return wuffs_base__pixel_palette_lookup__closest_element(this, c);
+}
+
+#endif  // __cplusplus
+
+// --------
+
 // TODO: should the func type take restrict pointers?
 typedef uint64_t (*wuffs_base__pixel_swizzler__func)(
     wuffs_base__slice_u8 dst,
     wuffs_base__slice_u8 dst_palette,
     wuffs_base__slice_u8 src);
 
+// wuffs_base__pixel_swizzler__planar_func converts one row of pixels whose
+// three planes (e.g. Y, Cb and Cr) have one sample per pixel. It returns the
+// number of pixels converted.
+typedef uint64_t (*wuffs_base__pixel_swizzler__planar_func)(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 src0,
+    wuffs_base__slice_u8 src1,
+    wuffs_base__slice_u8 src2);
+
+// wuffs_base__pixel_swizzler__quantize_func converts one row of pixels to
+// palette indexes. It returns the number of pixels converted.
+typedef uint64_t (*wuffs_base__pixel_swizzler__quantize_func)(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__slice_u8 src);
+
 typedef struct {
   // Do not access the private_impl's fields directly. There is no API/ABI
   // compatibility or safety guarantee if you do so.
   struct {
     wuffs_base__pixel_swizzler__func func;
+    wuffs_base__pixel_swizzler__planar_func planar_func;
+    wuffs_base__pixel_swizzler__quantize_func quantize_func;
+    wuffs_base__pixel_palette_lookup* lookup;
   } private_impl;
 
 #ifdef __cplusplus
@@ -1305,9 +1806,18 @@ typedef struct {
                                     wuffs_base__pixel_format src_format,
                                     wuffs_base__slice_u8 src_palette,
                                     wuffs_base__pixel_blend blend);
+  inline wuffs_base__status prepare_quantizing(
+      wuffs_base__pixel_palette_lookup* lookup,
+      wuffs_base__pixel_format dst_format,
+      wuffs_base__slice_u8 dst_palette,
+      wuffs_base__pixel_format src_format,
+      wuffs_base__pixel_blend blend);
   inline uint64_t swizzle_interleaved(wuffs_base__slice_u8 dst,
                                       wuffs_base__slice_u8 dst_palette,
                                       wuffs_base__slice_u8 src) const;
+  inline wuffs_base__status swizzle_planar(
+      wuffs_base__pixel_buffer* dst,
+      const wuffs_base__pixel_buffer* src) const;
 #endif  // __cplusplus
 
 } wuffs_base__pixel_swizzler;
@@ -1326,6 +1836,29 @@ wuffs_base__pixel_swizzler__prepare(wuffs_base__pixel_swizzler* p,
                                     wuffs_base__slice_u8 src_palette,
                                     wuffs_base__pixel_blend blend);
 
+// wuffs_base__pixel_swizzler__prepare_quantizing is like
+// wuffs_base__pixel_swizzler__prepare, for converting direct color (such as Y,
+// BGR or BGRA) to palette indexes. The dst_format should be one of the
+// INDEXED__BGRA_ETC formats and the dst_palette holds its palette. This
+// prepares the lookup for that palette (see
+// wuffs_base__pixel_palette_lookup__prepare), and the lookup must outlive the
+// swizzler's use. Each pixel is mapped to its closest palette element.
+//
+// Subsequent swizzle_interleaved calls ignore their dst_palette argument. The
+// palette is the one given here, via the lookup.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_swizzler__prepare_quantizing(
+    wuffs_base__pixel_swizzler* p,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__pixel_format dst_format,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__pixel_format src_format,
+    wuffs_base__pixel_blend blend);
+
 // wuffs_base__pixel_swizzler__swizzle_interleaved converts pixels from a
 // source format to a destination format.
 //
@@ -1339,6 +1872,24 @@ wuffs_base__pixel_swizzler__swizzle_interleaved(
     wuffs_base__slice_u8 dst_palette,
     wuffs_base__slice_u8 src);
 
+// wuffs_base__pixel_swizzler__swizzle_planar converts a whole planar pixel
+// buffer, such as YCbCr, to an interleaved one, such as BGRA. The swizzler
+// must have been prepared with the src pixel buffer's (planar) pixel format,
+// and the dst pixel buffer's pixel format.
+//
+// The two pixel buffers' top-left corners are aligned. The pixels converted
+// are those in both pixel buffers: the minimum of their widths and heights.
+// Subsampled (chroma) planes are upsampled by sample replication, conscious
+// of the src pixel buffer's pixel subsampling.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_swizzler__swizzle_planar(const wuffs_base__pixel_swizzler* p,
+                                           wuffs_base__pixel_buffer* dst,
+                                           const wuffs_base__pixel_buffer* src);
+
 #ifdef __cplusplus
 
 inline wuffs_base__status  //
@@ -1351,6 +1902,17 @@ wuffs_base__pixel_swizzler::prepare(wuffs_base__pixel_format dst_format,
                                              src_format, src_palette, blend);
 }
 
+inline wuffs_base__status  //
+wuffs_base__pixel_swizzler::prepare_quantizing(
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__pixel_format dst_format,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__pixel_format src_format,
+    wuffs_base__pixel_blend blend) {
+  return wuffs_base__pixel_swizzler__prepare_quantizing(
+      this, lookup, dst_format, dst_palette, src_format, blend);
+}
+
 uint64_t  //
 wuffs_base__pixel_swizzler::swizzle_interleaved(
     wuffs_base__slice_u8 dst,
@@ -1360,4 +1922,11 @@ wuffs_base__pixel_swizzler::swizzle_interleaved(
                                                          src);
 }
 
+inline wuffs_base__status  //
+wuffs_base__pixel_swizzler::swizzle_planar(
+    wuffs_base__pixel_buffer* dst,
+    const wuffs_base__pixel_buffer* src) const {
+  return wuffs_base__pixel_swizzler__swizzle_planar(this, dst, src);
+}
+
 #endif  // __cplusplus
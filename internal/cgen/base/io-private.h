@@ -59,10 +59,8 @@ wuffs_base__io_writer__copy_n32_from_history(uint8_t** ptr_iop_w,
   // argument, and the cgen can look if that argument is the constant
   // expression '3'.
   //
-  // See also wuffs_base__io_writer__copy_n32_from_history_fast below.
-  //
-  // Alternatively, or additionally, have a sloppy_copy_n32_from_history method
-  // that copies 8 bytes at a time, possibly writing more than length bytes?
+  // See also wuffs_base__io_writer__copy_n32_from_history_fast below, and its
+  // _8_byte_chunks_etc variants that copy 8 bytes at a time.
   for (; n >= 3; n -= 3) {
     *p++ = *q++;
     *p++ = *q++;
@@ -102,6 +100,73 @@ wuffs_base__io_writer__copy_n32_from_history_fast(uint8_t** ptr_iop_w,
   return length;
 }
 
+// wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast is like the
+// wuffs_base__io_writer__copy_n32_from_history_fast function above, but
+// copies 8 bytes at a time. It can write up to 8 bytes past length (but only
+// advances *ptr_iop_w by length), so the caller needs to prove that:
+//  - distance >= 8
+//  - distance <= (*ptr_iop_w - io1_w)
+//  - (length + 8) <= (io2_w - *ptr_iop_w)
+//
+// A distance of at least 8 means that each 8 byte chunk's source does not
+// overlap its destination, even though a match can overlap itself.
+static inline uint32_t  //
+wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast(
+    uint8_t** ptr_iop_w,
+    uint8_t* io1_w,
+    uint8_t* io2_w,
+    uint32_t length,
+    uint32_t distance) {
+  uint8_t* p = *ptr_iop_w;
+  uint8_t* q = p - distance;
+  uint32_t n = length;
+  while (true) {
+    memcpy(p, q, 8);
+    if (n <= 8) {
+      p += n;
+      break;
+    }
+    p += 8;
+    q += 8;
+    n -= 8;
+  }
+  *ptr_iop_w = p;
+  return length;
+}
+
+// wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_distance_1_fast
+// is like the wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast
+// function above, but for a distance of 1: a run of the previous byte. The
+// caller needs to prove that:
+//  - distance == 1
+//  - distance <= (*ptr_iop_w - io1_w)
+//  - (length + 8) <= (io2_w - *ptr_iop_w)
+static inline uint32_t  //
+wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_distance_1_fast(
+    uint8_t** ptr_iop_w,
+    uint8_t* io1_w,
+    uint8_t* io2_w,
+    uint32_t length,
+    uint32_t distance) {
+  uint8_t* p = *ptr_iop_w;
+  uint64_t x = p[-1];
+  x |= x << 8;
+  x |= x << 16;
+  x |= x << 32;
+  uint32_t n = length;
+  while (true) {
+    wuffs_base__store_u64le__no_bounds_check(p, x);
+    if (n <= 8) {
+      p += n;
+      break;
+    }
+    p += 8;
+    n -= 8;
+  }
+  *ptr_iop_w = p;
+  return length;
+}
+
 static inline uint32_t  //
 wuffs_base__io_writer__copy_n32_from_reader(uint8_t** ptr_iop_w,
                                             uint8_t* io2_w,
@@ -125,6 +190,54 @@ wuffs_base__io_writer__copy_n32_from_reader(uint8_t** ptr_iop_w,
   return (uint32_t)(n);
 }
 
+// wuffs_base__io_writer__copy_n32_from_reader_16_byte_chunks_fast is like the
+// wuffs_base__io_writer__copy_n32_from_reader function above, but copies 16
+// bytes at a time. It can read and write up to 16 bytes past length (but only
+// advances *ptr_iop_w and *ptr_iop_r by length), so the caller needs to prove
+// that:
+//  - (length + 16) <= (io2_w - *ptr_iop_w)
+//  - (length + 16) <= (io2_r - *ptr_iop_r)
+//
+// Unlike wuffs_base__io_writer__copy_n32_from_reader, it uses memcpy instead
+// of memmove. Short copies are then a single (unaligned) 16 byte load and
+// store. The reader's and writer's buffers may still alias (e.g. decompressing
+// in place), so if the two (length + 16) byte ranges intersect, it falls back
+// to a memmove of exactly length bytes, which neither writes past length nor
+// clobbers source bytes that are yet to be read.
+static inline uint32_t  //
+wuffs_base__io_writer__copy_n32_from_reader_16_byte_chunks_fast(
+    uint8_t** ptr_iop_w,
+    uint8_t* io2_w,
+    uint32_t length,
+    const uint8_t** ptr_iop_r,
+    const uint8_t* io2_r) {
+  uint8_t* p = *ptr_iop_w;
+  const uint8_t* q = *ptr_iop_r;
+  uint32_t n = length;
+  // With m = (length + 16), the two ranges intersect if and only if -m < (q -
+  // p) < m, which is one unsigned comparison.
+  uintptr_t m = ((uintptr_t)length) + 16;
+  if (WUFFS_BASE__UNLIKELY(((uintptr_t)q - (uintptr_t)p + m - 1) <
+                           ((2 * m) - 1))) {
+    memmove(p, q, length);
+    *ptr_iop_w += length;
+    *ptr_iop_r += length;
+    return length;
+  }
+  while (true) {
+    memcpy(p, q, 16);
+    if (n <= 16) {
+      break;
+    }
+    p += 16;
+    q += 16;
+    n -= 16;
+  }
+  *ptr_iop_w += length;
+  *ptr_iop_r += length;
+  return length;
+}
+
 static inline uint64_t  //
 wuffs_base__io_writer__copy_from_slice(uint8_t** ptr_iop_w,
                                        uint8_t* io2_w,
@@ -220,6 +333,20 @@ wuffs_base__io_reader__set(wuffs_base__io_buffer* b,
   return b;
 }
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+static inline wuffs_base__slice_u8  //
+wuffs_base__io_reader__since(uint64_t mark,
+                             uint64_t index,
+                             const uint8_t* ptr) {
+  if (index >= mark) {
+    // The arg is what C calls C++'s "const_cast<uint8_t*>(ptr)".
+    return wuffs_base__make_slice_u8(((uint8_t*)(ptr)) + mark, index - mark);
+  }
+  return wuffs_base__make_slice_u8(NULL, 0);
+}
+#pragma GCC diagnostic pop
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-qual"
 // TODO: can we avoid the const_cast (by deleting this function)? This might
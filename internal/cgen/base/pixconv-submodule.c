@@ -36,8 +36,28 @@ wuffs_base__pixel_buffer__color_u32_at(const wuffs_base__pixel_buffer* pb,
   }
 
   if (wuffs_base__pixel_format__is_planar(&pb->pixcfg.private_impl.pixfmt)) {
-    // TODO: support planar formats.
-    return 0;
+    if (pb->pixcfg.private_impl.pixfmt.repr !=
+        WUFFS_BASE__PIXEL_FORMAT__YCBCR) {
+      // TODO: support more planar formats.
+      return 0;
+    }
+    uint8_t samples[3];
+    uint32_t p;
+    for (p = 0; p < 3; p++) {
+      const wuffs_base__pixel_subsampling* pixsub =
+          &pb->pixcfg.private_impl.pixsub;
+      const wuffs_base__table_u8* tab = &pb->private_impl.planes[p];
+      size_t i = (x + wuffs_base__pixel_subsampling__bias_x(pixsub, p)) /
+                 wuffs_base__pixel_subsampling__denominator_x(pixsub, p);
+      size_t j = (y + wuffs_base__pixel_subsampling__bias_y(pixsub, p)) /
+                 wuffs_base__pixel_subsampling__denominator_y(pixsub, p);
+      if ((i >= tab->width) || (j >= tab->height)) {
+        return 0;
+      }
+      samples[p] = tab->ptr[(j * tab->stride) + i];
+    }
+    return wuffs_base__color_ycc__as__color_u32_argb_premul(
+        samples[0], samples[1], samples[2]);
   }
 
   size_t stride = pb->private_impl.planes[0].stride;
@@ -80,6 +100,15 @@ wuffs_base__pixel_buffer__color_u32_at(const wuffs_base__pixel_buffer* pb,
       return 0xFF000000 |
              wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x)));
 
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE:
+      return wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+          wuffs_base__color_u64__as__color_u32(
+              wuffs_base__load_u64le__no_bounds_check(row +
+                                                      (8 * ((size_t)x)))));
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      return wuffs_base__color_u64__as__color_u32(
+          wuffs_base__load_u64le__no_bounds_check(row + (8 * ((size_t)x))));
+
     case WUFFS_BASE__PIXEL_FORMAT__RGB:
       return wuffs_base__swap_u32_argb_abgr(
           0xFF000000 |
@@ -97,6 +126,17 @@ wuffs_base__pixel_buffer__color_u32_at(const wuffs_base__pixel_buffer* pb,
       return wuffs_base__swap_u32_argb_abgr(
           0xFF000000 |
           wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x))));
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL_4X16LE:
+      return wuffs_base__swap_u32_argb_abgr(
+          wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+              wuffs_base__color_u64__as__color_u32(
+                  wuffs_base__load_u64le__no_bounds_check(row +
+                                                          (8 * ((size_t)x))))));
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      return wuffs_base__swap_u32_argb_abgr(
+          wuffs_base__color_u64__as__color_u32(
+              wuffs_base__load_u64le__no_bounds_check(row +
+                                                      (8 * ((size_t)x)))));
 
     default:
       // TODO: support more formats.
@@ -164,6 +204,18 @@ wuffs_base__pixel_buffer__set_color_u32_at(
               color));
       break;
 
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE:
+      wuffs_base__store_u64le__no_bounds_check(
+          row + (8 * ((size_t)x)),
+          wuffs_base__color_u32__as__color_u64(
+              wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(
+                  color)));
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      wuffs_base__store_u64le__no_bounds_check(
+          row + (8 * ((size_t)x)), wuffs_base__color_u32__as__color_u64(color));
+      break;
+
     case WUFFS_BASE__PIXEL_FORMAT__RGB:
       wuffs_base__store_u24le__no_bounds_check(
           row + (3 * ((size_t)x)), wuffs_base__swap_u32_argb_abgr(color));
@@ -179,6 +231,18 @@ wuffs_base__pixel_buffer__set_color_u32_at(
       wuffs_base__store_u32le__no_bounds_check(
           row + (4 * ((size_t)x)), wuffs_base__swap_u32_argb_abgr(color));
       break;
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL_4X16LE:
+      wuffs_base__store_u64le__no_bounds_check(
+          row + (8 * ((size_t)x)),
+          wuffs_base__color_u32__as__color_u64(
+              wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(
+                  wuffs_base__swap_u32_argb_abgr(color))));
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      wuffs_base__store_u64le__no_bounds_check(
+          row + (8 * ((size_t)x)), wuffs_base__color_u32__as__color_u64(
+                                       wuffs_base__swap_u32_argb_abgr(color)));
+      break;
 
     default:
       // TODO: support more formats.
@@ -252,6 +316,201 @@ wuffs_base__pixel_palette__closest_element(
 
 // --------
 
+static inline uint32_t  //
+wuffs_base__pixel_palette_lookup__cache_slot(
+    wuffs_base__color_u32_argb_premul c) {
+  // This is Fibonacci hashing, keeping the high bits of the product.
+  return (uint32_t)(((uint32_t)(c * 0x9E3779B1u)) >> 20) &
+         (WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE - 1);
+}
+
+static inline void  //
+wuffs_base__pixel_palette_lookup__consider(
+    const wuffs_base__pixel_palette_lookup* p,
+    uint32_t i,
+    uint32_t cb,
+    uint32_t cg,
+    uint32_t cr,
+    uint32_t ca,
+    uint64_t* best_score,
+    uint32_t* best_index) {
+  const uint32_t* e = &p->private_impl.elements[i][0];
+  // These deltas are conceptually int32_t (signed) but after squaring, it's
+  // equivalent to work in uint32_t (unsigned).
+  uint32_t pb = e[0] - cb;
+  uint32_t pg = e[1] - cg;
+  uint32_t pr = e[2] - cr;
+  uint32_t pa = e[3] - ca;
+  uint64_t score = ((uint64_t)(pb * pb)) + ((uint64_t)(pg * pg)) +
+                   ((uint64_t)(pr * pr)) + ((uint64_t)(pa * pa));
+  if ((*best_score > score) || ((*best_score == score) && (*best_index > i))) {
+    *best_score = score;
+    *best_index = i;
+  }
+}
+
+// wuffs_base__pixel_palette_lookup__search finds the same element as
+// wuffs_base__pixel_palette__closest_element would, but instead of scoring
+// every element, it walks outwards (in both directions) from c's green value
+// through the elements sorted by green. A walk stops once the green delta
+// alone, squared, exceeds the best score so far, as no further element in
+// that direction can then score better (or equal, which would also need a
+// smaller index comparison).
+static uint8_t  //
+wuffs_base__pixel_palette_lookup__search(
+    const wuffs_base__pixel_palette_lookup* p,
+    wuffs_base__color_u32_argb_premul c) {
+  uint32_t n = p->private_impl.num_elements;
+  if (n == 0) {
+    return 0;
+  }
+  uint64_t best_score = 0xFFFFFFFFFFFFFFFF;
+  uint32_t best_index = 0;
+
+  // Work in 16-bit color.
+  uint32_t ca = 0x101 * (0xFF & (c >> 24));
+  uint32_t cr = 0x101 * (0xFF & (c >> 16));
+  uint32_t cg = 0x101 * (0xFF & (c >> 8));
+  uint32_t cb = 0x101 * (0xFF & (c >> 0));
+
+  // Binary search for the first sorted position whose green is >= cg.
+  const uint8_t* sorted = &p->private_impl.sorted_by_green[0];
+  uint32_t lo = 0;
+  uint32_t hi = n;
+  while (lo < hi) {
+    uint32_t mid = lo + ((hi - lo) / 2);
+    if (p->private_impl.elements[sorted[mid]][1] < cg) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  // Walk upwards from hi and downwards from lo.
+  hi = lo;
+  bool up = hi < n;
+  bool down = lo > 0;
+  while (up || down) {
+    if (up) {
+      uint32_t i = sorted[hi];
+      uint64_t dg = p->private_impl.elements[i][1] - cg;
+      if ((dg * dg) > best_score) {
+        up = false;
+      } else {
+        wuffs_base__pixel_palette_lookup__consider(p, i, cb, cg, cr, ca,
+                                                   &best_score, &best_index);
+        hi++;
+        up = hi < n;
+      }
+    }
+    if (down) {
+      uint32_t i = sorted[lo - 1];
+      uint64_t dg = cg - p->private_impl.elements[i][1];
+      if ((dg * dg) > best_score) {
+        down = false;
+      } else {
+        wuffs_base__pixel_palette_lookup__consider(p, i, cb, cg, cr, ca,
+                                                   &best_score, &best_index);
+        lo--;
+        down = lo > 0;
+      }
+    }
+  }
+
+  return (uint8_t)best_index;
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_palette_lookup__prepare(
+    wuffs_base__pixel_palette_lookup* p,
+    wuffs_base__slice_u8 palette_slice,
+    wuffs_base__pixel_format palette_format) {
+  if (!p) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  p->private_impl.num_elements = 0;
+
+  bool nonpremul = false;
+  switch (palette_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL:
+      nonpremul = true;
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:
+      break;
+    default:
+      return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+  }
+
+  size_t n = palette_slice.len / 4;
+  if (n > 256) {
+    n = 256;
+  }
+  size_t i;
+  for (i = 0; i < n; i++) {
+    // Work in 16-bit color.
+    uint32_t pb = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 0]));
+    uint32_t pg = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 1]));
+    uint32_t pr = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 2]));
+    uint32_t pa = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 3]));
+
+    // Convert to premultiplied alpha.
+    if (nonpremul && (pa != 0xFFFF)) {
+      pb = (pb * pa) / 0xFFFF;
+      pg = (pg * pa) / 0xFFFF;
+      pr = (pr * pa) / 0xFFFF;
+    }
+
+    p->private_impl.elements[i][0] = pb;
+    p->private_impl.elements[i][1] = pg;
+    p->private_impl.elements[i][2] = pr;
+    p->private_impl.elements[i][3] = pa;
+  }
+  p->private_impl.num_elements = (uint32_t)n;
+
+  // Insertion sort the element indexes by green. The sort is stable, but the
+  // search doesn't rely on that, as it compares indexes to break ties.
+  uint8_t* sorted = &p->private_impl.sorted_by_green[0];
+  for (i = 0; i < n; i++) {
+    uint32_t g = p->private_impl.elements[i][1];
+    size_t j = i;
+    while ((j > 0) && (p->private_impl.elements[sorted[j - 1]][1] > g)) {
+      sorted[j] = sorted[j - 1];
+      j--;
+    }
+    sorted[j] = (uint8_t)i;
+  }
+
+  // Fill every cache slot with the answer for transparent black. Any other
+  // color doesn't match, regardless of which slot it hashes to, so this is
+  // equivalent to an empty cache, but without a separate "valid" bit.
+  uint8_t zero_index = wuffs_base__pixel_palette_lookup__search(p, 0);
+  for (i = 0; i < WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE; i++) {
+    p->private_impl.cache_colors[i] = 0;
+    p->private_impl.cache_indexes[i] = zero_index;
+  }
+
+  return wuffs_base__make_status(NULL);
+}
+
+WUFFS_BASE__MAYBE_STATIC uint8_t  //
+wuffs_base__pixel_palette_lookup__closest_element(
+    wuffs_base__pixel_palette_lookup* p,
+    wuffs_base__color_u32_argb_premul c) {
+  if (!p) {
+    return 0;
+  }
+  uint32_t slot = wuffs_base__pixel_palette_lookup__cache_slot(c);
+  if (p->private_impl.cache_colors[slot] != c) {
+    p->private_impl.cache_colors[slot] = c;
+    p->private_impl.cache_indexes[slot] =
+        wuffs_base__pixel_palette_lookup__search(p, c);
+  }
+  return p->private_impl.cache_indexes[slot];
+}
+
+// --------
+
 static inline uint32_t  //
 wuffs_base__composite_nonpremul_nonpremul_u32_axxx(uint32_t dst_nonpremul,
                                                    uint32_t src_nonpremul) {
@@ -396,6 +655,65 @@ wuffs_base__composite_premul_premul_u32_axxx(uint32_t dst_premul,
   return (db << 0) | (dg << 8) | (dr << 16) | (da << 24);
 }
 
+static inline uint64_t  //
+wuffs_base__composite_premul_premul_u64_axxx(uint64_t dst_premul,
+                                             uint64_t src_premul) {
+  uint64_t sa = 0xFFFF & (src_premul >> 48);
+  uint64_t sr = 0xFFFF & (src_premul >> 32);
+  uint64_t sg = 0xFFFF & (src_premul >> 16);
+  uint64_t sb = 0xFFFF & (src_premul >> 0);
+  uint64_t da = 0xFFFF & (dst_premul >> 48);
+  uint64_t dr = 0xFFFF & (dst_premul >> 32);
+  uint64_t dg = 0xFFFF & (dst_premul >> 16);
+  uint64_t db = 0xFFFF & (dst_premul >> 0);
+
+  // Calculate the inverse of the src-alpha: how much of the dst to keep.
+  uint64_t ia = 0xFFFF - sa;
+
+  // Composite src (premul) over dst (premul). Unlike the u32_axxx functions,
+  // there's no conversion back to 8-bit color, so no rounding loss there.
+  da = sa + ((da * ia) / 0xFFFF);
+  dr = sr + ((dr * ia) / 0xFFFF);
+  dg = sg + ((dg * ia) / 0xFFFF);
+  db = sb + ((db * ia) / 0xFFFF);
+
+  return (db << 0) | (dg << 16) | (dr << 32) | (da << 48);
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+// wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff returns, for each 16-bit
+// lane m (which must be at most 0xFF * 0xFF), ((m * 0x101) / 0xFF), which
+// equals (m + ((2 * m) / 0xFF)), without overflowing 16 bits.
+//
+// The u32_axxx composite functions expand 8-bit values v to 16-bit values
+// (v * 0x101) and divide by 0xFFFF, which is (0x101 * 0xFF). For 8-bit a and
+// b, ((0x101 * a) * (0x101 * b)) / 0xFFFF therefore equals this function
+// applied to (a * b), so that this reproduces their rounding exactly.
+//
+// As for the bgra_premul__bgra_nonpremul__src__x86_sse42 function below,
+// dividing by 0xFF is done by computing u = (m + 1 + (m >> 8)) >> 8, and then
+// adjusting by the remainder r = (m - (0xFF * u)).
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline __m128i  //
+wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff(__m128i m) {
+  __m128i u = _mm_srli_epi16(
+      _mm_add_epi16(_mm_add_epi16(m, _mm_set1_epi16(0x0001)),
+                    _mm_srli_epi16(m, 8)),
+      8);
+  __m128i r = _mm_sub_epi16(m, _mm_mullo_epi16(u, _mm_set1_epi16(0x00FF)));
+  return _mm_sub_epi16(_mm_add_epi16(m, _mm_add_epi16(u, u)),
+                       _mm_cmpgt_epi16(r, _mm_set1_epi16(0x007F)));
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static inline uint64_t  //
+wuffs_base__swap_u64_argb_abgr(uint64_t c) {
+  uint64_t o = c & 0xFFFF0000FFFF0000;
+  uint64_t r = 0xFFFF & (c >> 32);
+  uint64_t b = 0xFFFF & (c >> 0);
+  return o | (r << 0) | (b << 32);
+}
+
 // --------
 
 static uint64_t  //
@@ -443,6 +761,49 @@ wuffs_base__pixel_swizzler__swap_rgbx_bgrx(wuffs_base__slice_u8 dst,
   return len4 * 4;
 }
 
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__swap_rgbx_bgrx__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 src) {
+  size_t len4 = (dst.len < src.len ? dst.len : src.len) / 4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len4;
+
+  __m128i shuffle = _mm_set_epi8(+0x0F, +0x0C, +0x0D, +0x0E,  //
+                                 +0x0B, +0x08, +0x09, +0x0A,  //
+                                 +0x07, +0x04, +0x05, +0x06,  //
+                                 +0x03, +0x00, +0x01, +0x02);
+
+  while (n >= 4) {
+    __m128i x;
+    x = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    x = _mm_shuffle_epi8(x, shuffle);
+    _mm_storeu_si128((__m128i*)(void*)d, x);
+
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n--) {
+    uint8_t b0 = s[0];
+    uint8_t b1 = s[1];
+    uint8_t b2 = s[2];
+    uint8_t b3 = s[3];
+    d[0] = b2;
+    d[1] = b1;
+    d[2] = b0;
+    d[3] = b3;
+    s += 4;
+    d += 4;
+  }
+  return len4 * 4;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
 // --------
 
 static uint64_t  //
@@ -802,10 +1163,20 @@ wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over(
   return len;
 }
 
-// --------
-
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+// The SRC_OVER x86_sse42 functions below work on 4 pixels (16 bytes) at a
+// time. They produce exactly the same output as their scalar counterparts.
+// Runs of fully opaque or fully transparent src pixels, common for sprites
+// and animation frames, take a fast path: opaque src pixels simply replace
+// the dst and transparent ones leave it alone.
+//
+// For a nonpremul dst, compositing converts the dst to premul and back. That
+// round trip is lossy (it divides by the dst alpha), so a transparent src is
+// only a no-op when the dst is opaque. Mixed groups of 4 pixels fall back to
+// the scalar code.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
 static uint64_t  //
-wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src(
+wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over__x86_sse42(
     wuffs_base__slice_u8 dst,
     wuffs_base__slice_u8 dst_palette,
     wuffs_base__slice_u8 src) {
@@ -816,13 +1187,40 @@ wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src(
   uint8_t* s = src.ptr;
   size_t n = len;
 
-  // TODO: unroll.
+  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);
+
+  while (n >= 4) {
+    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    __m128i sa4 = _mm_and_si128(s4, alpha_mask);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa4, alpha_mask)) == 0xFFFF) {
+      _mm_storeu_si128((__m128i*)(void*)d, s4);
+    } else {
+      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);
+      __m128i da4 = _mm_and_si128(d4, alpha_mask);
+      if (!_mm_testz_si128(sa4, sa4) ||
+          (_mm_movemask_epi8(_mm_cmpeq_epi32(da4, alpha_mask)) != 0xFFFF)) {
+        int i;
+        for (i = 0; i < 4; i++) {
+          uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (i * 4));
+          uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (i * 4));
+          wuffs_base__store_u32le__no_bounds_check(
+              d + (i * 4),
+              wuffs_base__composite_nonpremul_nonpremul_u32_axxx(d0, s0));
+        }
+      }
+    }
+
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
+  }
 
   while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
     uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
     wuffs_base__store_u32le__no_bounds_check(
         d + (0 * 4),
-        wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(s0));
+        wuffs_base__composite_nonpremul_nonpremul_u32_axxx(d0, s0));
 
     s += 1 * 4;
     d += 1 * 4;
@@ -831,9 +1229,12 @@ wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src(
 
   return len;
 }
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// --------
 
 static uint64_t  //
-wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over(
+wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src(
     wuffs_base__slice_u8 dst,
     wuffs_base__slice_u8 dst_palette,
     wuffs_base__slice_u8 src) {
@@ -847,10 +1248,10 @@ wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over(
   // TODO: unroll.
 
   while (n >= 1) {
-    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
     uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
     wuffs_base__store_u32le__no_bounds_check(
-        d + (0 * 4), wuffs_base__composite_premul_nonpremul_u32_axxx(d0, s0));
+        d + (0 * 4),
+        wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(s0));
 
     s += 1 * 4;
     d += 1 * 4;
@@ -860,139 +1261,307 @@ wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over(
   return len;
 }
 
-// --------
-
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
 static uint64_t  //
-wuffs_base__pixel_swizzler__xxx__index__src(wuffs_base__slice_u8 dst,
-                                            wuffs_base__slice_u8 dst_palette,
-                                            wuffs_base__slice_u8 src) {
-  if (dst_palette.len != 1024) {
-    return 0;
-  }
-  size_t dst_len3 = dst.len / 3;
-  size_t len = dst_len3 < src.len ? dst_len3 : src.len;
+wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
   uint8_t* d = dst.ptr;
   uint8_t* s = src.ptr;
   size_t n = len;
 
-  const size_t loop_unroll_count = 4;
-
-  // The comparison in the while condition is ">", not ">=", because with
-  // ">=", the last 4-byte store could write past the end of the dst slice.
+  // This computes the same (8-bit color) values as the
+  // wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul function,
+  // 4 pixels (16 bytes) at a time, using 16-bit lanes. For a color value c
+  // and alpha value a, with x = (c * a), that function calculates
+  // ((x * 0x101 * 0x101) / 0xFFFF) >> 8, which simplifies to
+  // (x + ((2 * x) / 0xFF)) >> 8.
   //
-  // Each 4-byte store writes one too many bytes, but a subsequent store
-  // will overwrite that with the correct byte. There is always another
-  // store, whether a 4-byte store in this loop or a 1-byte store in the
-  // next loop.
-  while (n > loop_unroll_count) {
-    wuffs_base__store_u32le__no_bounds_check(
-        d + (0 * 3), wuffs_base__load_u32le__no_bounds_check(
-                         dst_palette.ptr + ((size_t)s[0] * 4)));
-    wuffs_base__store_u32le__no_bounds_check(
-        d + (1 * 3), wuffs_base__load_u32le__no_bounds_check(
-                         dst_palette.ptr + ((size_t)s[1] * 4)));
-    wuffs_base__store_u32le__no_bounds_check(
-        d + (2 * 3), wuffs_base__load_u32le__no_bounds_check(
-                         dst_palette.ptr + ((size_t)s[2] * 4)));
-    wuffs_base__store_u32le__no_bounds_check(
-        d + (3 * 3), wuffs_base__load_u32le__no_bounds_check(
-                         dst_palette.ptr + ((size_t)s[3] * 4)));
+  // Dividing by 0xFF is done by computing u = (x + 1 + (x >> 8)) >> 8, which
+  // equals (x / 0xFF) for all x <= (0xFF * 0xFF), and then adjusting by the
+  // remainder r = (x - (0xFF * u)). None of the intermediate values overflow
+  // 16 bits.
+
+  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);
+  __m128i lo_alpha_shuffle = _mm_set_epi8(-0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x03, -0x80, +0x03,  //
+                                          -0x80, +0x03, -0x80, +0x03);
+  __m128i hi_alpha_shuffle = _mm_set_epi8(-0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0B, -0x80, +0x0B,  //
+                                          -0x80, +0x0B, -0x80, +0x0B);
+  __m128i u16_0x0001 = _mm_set1_epi16(0x0001);
+  __m128i u16_0x007F = _mm_set1_epi16(0x007F);
+  __m128i u16_0x00FF = _mm_set1_epi16(0x00FF);
+
+  while (n >= 4) {
+    __m128i x = _mm_lddqu_si128((const __m128i*)(const void*)s);
+
+    // Fast path: if all 4 pixels are opaque, premultiplication is a no-op.
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(x, alpha_mask),
+                                          alpha_mask)) != 0xFFFF) {
+      __m128i lo = _mm_cvtepu8_epi16(x);
+      __m128i hi = _mm_cvtepu8_epi16(_mm_srli_si128(x, 8));
+      __m128i lo_x = _mm_mullo_epi16(lo, _mm_shuffle_epi8(x, lo_alpha_shuffle));
+      __m128i hi_x = _mm_mullo_epi16(hi, _mm_shuffle_epi8(x, hi_alpha_shuffle));
+
+      __m128i lo_u =
+          _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo_x, u16_0x0001),
+                                       _mm_srli_epi16(lo_x, 8)),
+                         8);
+      __m128i hi_u =
+          _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi_x, u16_0x0001),
+                                       _mm_srli_epi16(hi_x, 8)),
+                         8);
+      __m128i lo_r = _mm_sub_epi16(lo_x, _mm_mullo_epi16(lo_u, u16_0x00FF));
+      __m128i hi_r = _mm_sub_epi16(hi_x, _mm_mullo_epi16(hi_u, u16_0x00FF));
+
+      // Subtracting a ((r > 0x7F) ? -1 : 0) mask adds 1 when the remainder
+      // rounds 2*x/0xFF up past the next integer.
+      __m128i lo_d = _mm_sub_epi16(_mm_add_epi16(lo_u, lo_u),
+                                   _mm_cmpgt_epi16(lo_r, u16_0x007F));
+      __m128i hi_d = _mm_sub_epi16(_mm_add_epi16(hi_u, hi_u),
+                                   _mm_cmpgt_epi16(hi_r, u16_0x007F));
+      lo_x = _mm_srli_epi16(_mm_add_epi16(lo_x, lo_d), 8);
+      hi_x = _mm_srli_epi16(_mm_add_epi16(hi_x, hi_d), 8);
+
+      // Restore the original alpha values (lanes 3 and 7) and narrow back
+      // down to 8 bits per channel.
+      lo_x = _mm_blend_epi16(lo_x, lo, 0x88);
+      hi_x = _mm_blend_epi16(hi_x, hi, 0x88);
+      x = _mm_packus_epi16(lo_x, hi_x);
+    }
+    _mm_storeu_si128((__m128i*)(void*)d, x);
 
-    s += loop_unroll_count * 1;
-    d += loop_unroll_count * 3;
-    n -= loop_unroll_count;
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
   }
 
   while (n >= 1) {
-    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
-                                                          ((size_t)s[0] * 4));
-    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4),
+        wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(s0));
 
-    s += 1 * 1;
-    d += 1 * 3;
+    s += 1 * 4;
+    d += 1 * 4;
     n -= 1;
   }
 
   return len;
 }
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
 
 static uint64_t  //
-wuffs_base__pixel_swizzler__xxx__index_binary_alpha__src_over(
+wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over(
     wuffs_base__slice_u8 dst,
     wuffs_base__slice_u8 dst_palette,
     wuffs_base__slice_u8 src) {
-  if (dst_palette.len != 1024) {
-    return 0;
-  }
-  size_t dst_len3 = dst.len / 3;
-  size_t len = dst_len3 < src.len ? dst_len3 : src.len;
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
   uint8_t* d = dst.ptr;
   uint8_t* s = src.ptr;
   size_t n = len;
 
-  const size_t loop_unroll_count = 4;
-
-  while (n >= loop_unroll_count) {
-    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
-                                                          ((size_t)s[0] * 4));
-    if (s0) {
-      wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
-    }
-    uint32_t s1 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
-                                                          ((size_t)s[1] * 4));
-    if (s1) {
-      wuffs_base__store_u24le__no_bounds_check(d + (1 * 3), s1);
-    }
-    uint32_t s2 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
-                                                          ((size_t)s[2] * 4));
-    if (s2) {
-      wuffs_base__store_u24le__no_bounds_check(d + (2 * 3), s2);
-    }
-    uint32_t s3 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
-                                                          ((size_t)s[3] * 4));
-    if (s3) {
-      wuffs_base__store_u24le__no_bounds_check(d + (3 * 3), s3);
-    }
-
-    s += loop_unroll_count * 1;
-    d += loop_unroll_count * 3;
-    n -= loop_unroll_count;
-  }
+  // TODO: unroll.
 
   while (n >= 1) {
-    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
-                                                          ((size_t)s[0] * 4));
-    if (s0) {
-      wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
-    }
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__composite_premul_nonpremul_u32_axxx(d0, s0));
 
-    s += 1 * 1;
-    d += 1 * 3;
+    s += 1 * 4;
+    d += 1 * 4;
     n -= 1;
   }
 
   return len;
 }
 
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
 static uint64_t  //
-wuffs_base__pixel_swizzler__xxx__y(wuffs_base__slice_u8 dst,
-                                   wuffs_base__slice_u8 dst_palette,
-                                   wuffs_base__slice_u8 src) {
+wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // With 8-bit values s (src), d (dst), sa (src alpha) and ia (0xFF - sa),
+  // and F being wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff, the
+  // wuffs_base__composite_premul_nonpremul_u32_axxx function calculates each
+  // color channel as F((s * sa) + (d * ia)) >> 8 and the alpha channel as
+  // ((0x101 * sa) + F(d * ia)) >> 8. Neither overflows 16 bits.
+
+  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);
+  __m128i lo_alpha_shuffle = _mm_set_epi8(-0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x03, -0x80, +0x03,  //
+                                          -0x80, +0x03, -0x80, +0x03);
+  __m128i hi_alpha_shuffle = _mm_set_epi8(-0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0B, -0x80, +0x0B,  //
+                                          -0x80, +0x0B, -0x80, +0x0B);
+  __m128i u16_0x00FF = _mm_set1_epi16(0x00FF);
+  __m128i u16_0x0101 = _mm_set1_epi16(0x0101);
+
+  while (n >= 4) {
+    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    __m128i sa4 = _mm_and_si128(s4, alpha_mask);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa4, alpha_mask)) == 0xFFFF) {
+      _mm_storeu_si128((__m128i*)(void*)d, s4);
+    } else if (!_mm_testz_si128(sa4, sa4)) {
+      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);
+      __m128i halves[2];
+      int h;
+      for (h = 0; h < 2; h++) {
+        __m128i sv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(s4, 8) : s4);
+        __m128i dv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(d4, 8) : d4);
+        __m128i sa =
+            _mm_shuffle_epi8(s4, h ? hi_alpha_shuffle : lo_alpha_shuffle);
+        __m128i dia = _mm_mullo_epi16(dv, _mm_sub_epi16(u16_0x00FF, sa));
+        __m128i c = wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff(
+            _mm_add_epi16(_mm_mullo_epi16(sv, sa), dia));
+        __m128i a = _mm_add_epi16(
+            _mm_mullo_epi16(sa, u16_0x0101),
+            wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff(dia));
+        halves[h] = _mm_srli_epi16(_mm_blend_epi16(c, a, 0x88), 8);
+      }
+      _mm_storeu_si128((__m128i*)(void*)d,
+                       _mm_packus_epi16(halves[0], halves[1]));
+    }
+
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__composite_premul_nonpremul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr_565__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len2 = dst.len / 2;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len2 < src_len4 ? dst_len2 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    wuffs_base__store_u16le__no_bounds_check(
+        d + (0 * 2), wuffs_base__color_u32_argb_premul__as__color_u16_rgb_565(
+                         wuffs_base__load_u32le__no_bounds_check(s + (0 * 4))));
+
+    s += 1 * 4;
+    d += 1 * 2;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr_565__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len2 = dst.len / 2;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len2 < src_len4 ? dst_len2 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__color_u16_rgb_565__as__color_u32_argb_premul(
+        wuffs_base__load_u16le__no_bounds_check(d + (0 * 2)));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u16le__no_bounds_check(
+        d + (0 * 2), wuffs_base__color_u32_argb_premul__as__color_u16_rgb_565(
+                         wuffs_base__composite_premul_premul_u32_axxx(d0, s0)));
+
+    s += 1 * 4;
+    d += 1 * 2;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
   size_t dst_len3 = dst.len / 3;
-  size_t len = dst_len3 < src.len ? dst_len3 : src.len;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len3 < src_len4 ? dst_len3 : src_len4;
   uint8_t* d = dst.ptr;
   uint8_t* s = src.ptr;
   size_t n = len;
 
-  // TODO: unroll.
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
+
+    s += 1 * 4;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len3 = dst.len / 3;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len3 < src_len4 ? dst_len3 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
 
   while (n >= 1) {
-    uint8_t s0 = s[0];
-    d[0] = s0;
-    d[1] = s0;
-    d[2] = s0;
+    uint32_t d0 =
+        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(d + (0 * 3));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u24le__no_bounds_check(
+        d + (0 * 3), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));
 
-    s += 1 * 1;
+    s += 1 * 4;
     d += 1 * 3;
     n -= 1;
   }
@@ -1000,48 +1569,135 @@ wuffs_base__pixel_swizzler__xxx__y(wuffs_base__slice_u8 dst,
   return len;
 }
 
-// --------
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4),
+        wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
 
 static uint64_t  //
-wuffs_base__pixel_swizzler__xxxx__index__src(wuffs_base__slice_u8 dst,
-                                             wuffs_base__slice_u8 dst_palette,
-                                             wuffs_base__slice_u8 src) {
-  if (dst_palette.len != 1024) {
-    return 0;
+wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__composite_nonpremul_premul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
   }
+
+  return len;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
   size_t dst_len4 = dst.len / 4;
-  size_t len = dst_len4 < src.len ? dst_len4 : src.len;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
   uint8_t* d = dst.ptr;
   uint8_t* s = src.ptr;
   size_t n = len;
 
-  const size_t loop_unroll_count = 4;
+  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);
+
+  while (n >= 4) {
+    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    __m128i sa4 = _mm_and_si128(s4, alpha_mask);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa4, alpha_mask)) == 0xFFFF) {
+      _mm_storeu_si128((__m128i*)(void*)d, s4);
+    } else {
+      // A premul src pixel is only a no-op if all of its channels are zero.
+      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);
+      __m128i da4 = _mm_and_si128(d4, alpha_mask);
+      if (!_mm_testz_si128(s4, s4) ||
+          (_mm_movemask_epi8(_mm_cmpeq_epi32(da4, alpha_mask)) != 0xFFFF)) {
+        int i;
+        for (i = 0; i < 4; i++) {
+          uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (i * 4));
+          uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (i * 4));
+          wuffs_base__store_u32le__no_bounds_check(
+              d + (i * 4),
+              wuffs_base__composite_nonpremul_premul_u32_axxx(d0, s0));
+        }
+      }
+    }
 
-  while (n >= loop_unroll_count) {
-    wuffs_base__store_u32le__no_bounds_check(
-        d + (0 * 4), wuffs_base__load_u32le__no_bounds_check(
-                         dst_palette.ptr + ((size_t)s[0] * 4)));
-    wuffs_base__store_u32le__no_bounds_check(
-        d + (1 * 4), wuffs_base__load_u32le__no_bounds_check(
-                         dst_palette.ptr + ((size_t)s[1] * 4)));
-    wuffs_base__store_u32le__no_bounds_check(
-        d + (2 * 4), wuffs_base__load_u32le__no_bounds_check(
-                         dst_palette.ptr + ((size_t)s[2] * 4)));
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
     wuffs_base__store_u32le__no_bounds_check(
-        d + (3 * 4), wuffs_base__load_u32le__no_bounds_check(
-                         dst_palette.ptr + ((size_t)s[3] * 4)));
+        d + (0 * 4), wuffs_base__composite_nonpremul_premul_u32_axxx(d0, s0));
 
-    s += loop_unroll_count * 1;
-    d += loop_unroll_count * 4;
-    n -= loop_unroll_count;
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
   }
 
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
   while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
     wuffs_base__store_u32le__no_bounds_check(
-        d + (0 * 4), wuffs_base__load_u32le__no_bounds_check(
-                         dst_palette.ptr + ((size_t)s[0] * 4)));
+        d + (0 * 4), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));
 
-    s += 1 * 1;
+    s += 1 * 4;
     d += 1 * 4;
     n -= 1;
   }
@@ -1049,25 +1705,307 @@ wuffs_base__pixel_swizzler__xxxx__index__src(wuffs_base__slice_u8 dst,
   return len;
 }
 
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
 static uint64_t  //
-wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over(
+wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over__x86_sse42(
     wuffs_base__slice_u8 dst,
     wuffs_base__slice_u8 dst_palette,
     wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // With the same notation as for the bgra_premul__bgra_nonpremul__src_over
+  // function, wuffs_base__composite_premul_premul_u32_axxx calculates every
+  // channel (color or alpha) as ((0x101 * s) + F(d * ia)) >> 8. That does not
+  // overflow 16 bits if the src is valid premul (every color channel is at
+  // most the alpha channel). Groups of 4 pixels that aren't valid fall back
+  // to the scalar code, which can overflow (and so produce different bits).
+
+  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);
+  __m128i alpha_bytes_shuffle = _mm_set_epi8(+0x0F, +0x0F, +0x0F, +0x0F,  //
+                                             +0x0B, +0x0B, +0x0B, +0x0B,  //
+                                             +0x07, +0x07, +0x07, +0x07,  //
+                                             +0x03, +0x03, +0x03, +0x03);
+  __m128i lo_alpha_shuffle = _mm_set_epi8(-0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x07, -0x80, +0x07,  //
+                                          -0x80, +0x03, -0x80, +0x03,  //
+                                          -0x80, +0x03, -0x80, +0x03);
+  __m128i hi_alpha_shuffle = _mm_set_epi8(-0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0F, -0x80, +0x0F,  //
+                                          -0x80, +0x0B, -0x80, +0x0B,  //
+                                          -0x80, +0x0B, -0x80, +0x0B);
+  __m128i u16_0x00FF = _mm_set1_epi16(0x00FF);
+  __m128i u16_0x0101 = _mm_set1_epi16(0x0101);
+
+  while (n >= 4) {
+    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    __m128i sa4 = _mm_shuffle_epi8(s4, alpha_bytes_shuffle);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(s4, alpha_mask),
+                                          alpha_mask)) == 0xFFFF) {
+      _mm_storeu_si128((__m128i*)(void*)d, s4);
+    } else if (_mm_testz_si128(s4, s4)) {
+      // No-op.
+    } else if (_mm_movemask_epi8(
+                   _mm_cmpeq_epi8(_mm_max_epu8(s4, sa4), sa4)) == 0xFFFF) {
+      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);
+      __m128i halves[2];
+      int h;
+      for (h = 0; h < 2; h++) {
+        __m128i sv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(s4, 8) : s4);
+        __m128i dv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(d4, 8) : d4);
+        __m128i sa =
+            _mm_shuffle_epi8(s4, h ? hi_alpha_shuffle : lo_alpha_shuffle);
+        __m128i dia = _mm_mullo_epi16(dv, _mm_sub_epi16(u16_0x00FF, sa));
+        __m128i x = _mm_add_epi16(
+            _mm_mullo_epi16(sv, u16_0x0101),
+            wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff(dia));
+        halves[h] = _mm_srli_epi16(x, 8);
+      }
+      _mm_storeu_si128((__m128i*)(void*)d,
+                       _mm_packus_epi16(halves[0], halves[1]));
+    } else {
+      int i;
+      for (i = 0; i < 4; i++) {
+        uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (i * 4));
+        uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (i * 4));
+        wuffs_base__store_u32le__no_bounds_check(
+            d + (i * 4), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));
+      }
+    }
+
+    s += 4 * 4;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));
+
+    s += 1 * 4;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxx__index__src(wuffs_base__slice_u8 dst,
+                                            wuffs_base__slice_u8 dst_palette,
+                                            wuffs_base__slice_u8 src) {
   if (dst_palette.len != 1024) {
     return 0;
   }
-  size_t dst_len4 = dst.len / 4;
-  size_t len = dst_len4 < src.len ? dst_len4 : src.len;
+  size_t dst_len3 = dst.len / 3;
+  size_t len = dst_len3 < src.len ? dst_len3 : src.len;
   uint8_t* d = dst.ptr;
   uint8_t* s = src.ptr;
   size_t n = len;
 
   const size_t loop_unroll_count = 4;
 
-  while (n >= loop_unroll_count) {
-    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
-                                                          ((size_t)s[0] * 4));
+  // The comparison in the while condition is ">", not ">=", because with
+  // ">=", the last 4-byte store could write past the end of the dst slice.
+  //
+  // Each 4-byte store writes one too many bytes, but a subsequent store
+  // will overwrite that with the correct byte. There is always another
+  // store, whether a 4-byte store in this loop or a 1-byte store in the
+  // next loop.
+  while (n > loop_unroll_count) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 3), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[0] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (1 * 3), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[1] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (2 * 3), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[2] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (3 * 3), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[3] * 4)));
+
+    s += loop_unroll_count * 1;
+    d += loop_unroll_count * 3;
+    n -= loop_unroll_count;
+  }
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
+
+    s += 1 * 1;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxx__index_binary_alpha__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len3 = dst.len / 3;
+  size_t len = dst_len3 < src.len ? dst_len3 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  const size_t loop_unroll_count = 4;
+
+  while (n >= loop_unroll_count) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    if (s0) {
+      wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
+    }
+    uint32_t s1 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[1] * 4));
+    if (s1) {
+      wuffs_base__store_u24le__no_bounds_check(d + (1 * 3), s1);
+    }
+    uint32_t s2 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[2] * 4));
+    if (s2) {
+      wuffs_base__store_u24le__no_bounds_check(d + (2 * 3), s2);
+    }
+    uint32_t s3 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[3] * 4));
+    if (s3) {
+      wuffs_base__store_u24le__no_bounds_check(d + (3 * 3), s3);
+    }
+
+    s += loop_unroll_count * 1;
+    d += loop_unroll_count * 3;
+    n -= loop_unroll_count;
+  }
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    if (s0) {
+      wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);
+    }
+
+    s += 1 * 1;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxx__y(wuffs_base__slice_u8 dst,
+                                   wuffs_base__slice_u8 dst_palette,
+                                   wuffs_base__slice_u8 src) {
+  size_t dst_len3 = dst.len / 3;
+  size_t len = dst_len3 < src.len ? dst_len3 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    uint8_t s0 = s[0];
+    d[0] = s0;
+    d[1] = s0;
+    d[2] = s0;
+
+    s += 1 * 1;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__index__src(wuffs_base__slice_u8 dst,
+                                             wuffs_base__slice_u8 dst_palette,
+                                             wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len4 = dst.len / 4;
+  size_t len = dst_len4 < src.len ? dst_len4 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  const size_t loop_unroll_count = 4;
+
+  while (n >= loop_unroll_count) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[0] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (1 * 4), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[1] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (2 * 4), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[2] * 4)));
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (3 * 4), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[3] * 4)));
+
+    s += loop_unroll_count * 1;
+    d += loop_unroll_count * 4;
+    n -= loop_unroll_count;
+  }
+
+  while (n >= 1) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), wuffs_base__load_u32le__no_bounds_check(
+                         dst_palette.ptr + ((size_t)s[0] * 4)));
+
+    s += 1 * 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len4 = dst.len / 4;
+  size_t len = dst_len4 < src.len ? dst_len4 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  const size_t loop_unroll_count = 4;
+
+  while (n >= loop_unroll_count) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
     if (s0) {
       wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), s0);
     }
@@ -1093,14 +2031,970 @@ wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over(
   }
 
   while (n >= 1) {
-    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
-                                                          ((size_t)s[0] * 4));
-    if (s0) {
-      wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), s0);
-    }
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    if (s0) {
+      wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), s0);
+    }
+
+    s += 1 * 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__xxx(wuffs_base__slice_u8 dst,
+                                      wuffs_base__slice_u8 dst_palette,
+                                      wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len3 = src.len / 3;
+  size_t len = dst_len4 < src_len3 ? dst_len4 : src_len3;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4),
+        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s + (0 * 3)));
+
+    s += 1 * 3;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__xxx__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t src_len3 = src.len / 3;
+  size_t len = dst_len4 < src_len3 ? dst_len4 : src_len3;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  __m128i shuffle = _mm_set_epi8(-0x80, +0x0B, +0x0A, +0x09,  //
+                                 -0x80, +0x08, +0x07, +0x06,  //
+                                 -0x80, +0x05, +0x04, +0x03,  //
+                                 -0x80, +0x02, +0x01, +0x00);
+  __m128i opaque = _mm_set1_epi32(-0x01000000);
+
+  // Each iteration reads 16 bytes but only uses (and advances by) 12 of them.
+  // The comparison in the while condition is ">= 6", not ">= 4", so that the
+  // 16-byte load does not read past the end of the src slice: 6 pixels is 18
+  // bytes, and 5 pixels (15 bytes) would be too few.
+  while (n >= 6) {
+    __m128i x;
+    x = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    x = _mm_or_si128(_mm_shuffle_epi8(x, shuffle), opaque);
+    _mm_storeu_si128((__m128i*)(void*)d, x);
+
+    s += 4 * 3;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4),
+        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s + (0 * 3)));
+
+    s += 1 * 3;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__swap_rgbx_bgrx(dst, src) / 4;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__swap_rgbx_bgrx__x86_sse42(dst, src) / 4;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__y(wuffs_base__slice_u8 dst,
+                                    wuffs_base__slice_u8 dst_palette,
+                                    wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t len = dst_len4 < src.len ? dst_len4 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  // TODO: unroll.
+
+  while (n >= 1) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), 0xFF000000 | (0x010101 * (uint32_t)s[0]));
+
+    s += 1 * 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__y__x86_sse42(wuffs_base__slice_u8 dst,
+                                               wuffs_base__slice_u8 dst_palette,
+                                               wuffs_base__slice_u8 src) {
+  size_t dst_len4 = dst.len / 4;
+  size_t len = dst_len4 < src.len ? dst_len4 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  __m128i shuffle = _mm_set_epi8(-0x80, +0x03, +0x03, +0x03,  //
+                                 -0x80, +0x02, +0x02, +0x02,  //
+                                 -0x80, +0x01, +0x01, +0x01,  //
+                                 -0x80, +0x00, +0x00, +0x00);
+  __m128i opaque = _mm_set1_epi32(-0x01000000);
+
+  while (n >= 4) {
+    __m128i x;
+    x = _mm_cvtsi32_si128(
+        (int)(wuffs_base__load_u32le__no_bounds_check(s + (0 * 1))));
+    x = _mm_or_si128(_mm_shuffle_epi8(x, shuffle), opaque);
+    _mm_storeu_si128((__m128i*)(void*)d, x);
+
+    s += 4 * 1;
+    d += 4 * 4;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    wuffs_base__store_u32le__no_bounds_check(
+        d + (0 * 4), 0xFF000000 | (0x010101 * (uint32_t)s[0]));
+
+    s += 1 * 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__y(wuffs_base__slice_u8 dst,
+                                        wuffs_base__slice_u8 dst_palette,
+                                        wuffs_base__slice_u8 src) {
+  size_t dst_len8 = dst.len / 8;
+  size_t len = dst_len8 < src.len ? dst_len8 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    wuffs_base__store_u64le__no_bounds_check(
+        d + (0 * 8),
+        0xFFFF000000000000 | (0x0000000100010001 * (0x101 * (uint64_t)s[0])));
+
+    s += 1 * 1;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__index__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len8 = dst.len / 8;
+  size_t len = dst_len8 < src.len ? dst_len8 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    wuffs_base__store_u64le__no_bounds_check(
+        d + (0 * 8), wuffs_base__color_u32__as__color_u64(s0));
+
+    s += 1 * 1;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__index_binary_alpha__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  if (dst_palette.len != 1024) {
+    return 0;
+  }
+  size_t dst_len8 = dst.len / 8;
+  size_t len = dst_len8 < src.len ? dst_len8 : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +
+                                                          ((size_t)s[0] * 4));
+    if (s0) {
+      wuffs_base__store_u64le__no_bounds_check(
+          d + (0 * 8), wuffs_base__color_u32__as__color_u64(s0));
+    }
+
+    s += 1 * 1;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgr(wuffs_base__slice_u8 dst,
+                                          wuffs_base__slice_u8 dst_palette,
+                                          wuffs_base__slice_u8 src,
+                                          bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len3 = src.len / 3;
+  size_t len = dst_len8 < src_len3 ? dst_len8 : src_len3;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint64_t c = wuffs_base__color_u32__as__color_u64(
+        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s + (0 * 3)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);
+
+    s += 1 * 3;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgr(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgr(dst, dst_palette, src,
+                                                   false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgr(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgr(dst, dst_palette, src, true);
+}
+
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint64_t c =
+        wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(
+            wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src(
+      dst, dst_palette, src, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src(
+      dst, dst_palette, src, true);
+}
+
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint64_t c =
+        wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(
+            wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    uint64_t d0 = wuffs_base__load_u64le__no_bounds_check(d + (0 * 8));
+    wuffs_base__store_u64le__no_bounds_check(
+        d + (0 * 8), wuffs_base__composite_premul_premul_u64_axxx(d0, c));
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src_over(
+      dst, dst_palette, src, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src_over(
+      dst, dst_palette, src, true);
+}
+
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint64_t c = wuffs_base__color_u32__as__color_u64(
+        wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src(
+      dst, dst_palette, src, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src(
+      dst, dst_palette, src, true);
+}
+
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint64_t c = wuffs_base__color_u32__as__color_u64(
+        wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    uint64_t d0 = wuffs_base__load_u64le__no_bounds_check(d + (0 * 8));
+    wuffs_base__store_u64le__no_bounds_check(
+        d + (0 * 8), wuffs_base__composite_premul_premul_u64_axxx(d0, c));
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src_over(
+      dst, dst_palette, src, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src_over(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src_over(
+      dst, dst_palette, src, true);
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+// The SSE4.2 functions below convert four 8-bit BGRA pixels (16 bytes) to four
+// 16-bit pixels (32 bytes) per loop iteration.
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  __m128i shuffle = rgb ? _mm_set_epi8(+0x0F, +0x0C, +0x0D, +0x0E,  //
+                                       +0x0B, +0x08, +0x09, +0x0A,  //
+                                       +0x07, +0x04, +0x05, +0x06,  //
+                                       +0x03, +0x00, +0x01, +0x02)
+                        : _mm_set_epi8(+0x0F, +0x0E, +0x0D, +0x0C,  //
+                                       +0x0B, +0x0A, +0x09, +0x08,  //
+                                       +0x07, +0x06, +0x05, +0x04,  //
+                                       +0x03, +0x02, +0x01, +0x00);
+  __m128i k_8081 = _mm_set1_epi16((int16_t)0x8081);
+  __m128i k_00FF = _mm_set1_epi16(0x00FF);
+  __m128i k_0101 = _mm_set1_epi16(0x0101);
+
+  while (n >= 4) {
+    __m128i x = _mm_shuffle_epi8(
+        _mm_lddqu_si128((const __m128i*)(const void*)s), shuffle);
+
+    // Each 128-bit half holds two pixels' worth of 16-bit lanes.
+    __m128i halves[2];
+    halves[0] = _mm_cvtepu8_epi16(x);
+    halves[1] = _mm_cvtepu8_epi16(_mm_srli_si128(x, 8));
+    int h;
+    for (h = 0; h < 2; h++) {
+      __m128i c = halves[h];
+      __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(c, 0xFF), 0xFF);
+
+      // With p = (c * a), which fits in 16 bits, the scalar code's
+      // ((0x101 * c) * (0x101 * a)) / 0xFFFF equals (p + (p / 127.5)),
+      // rounded down, which is (p + 2*q + (r >> 7)) where q and r are the
+      // quotient and remainder of dividing p by 255. Also, (p / 255) equals
+      // ((p * 0x8081) >> 23) for all 16-bit p.
+      __m128i p = _mm_mullo_epi16(c, a);
+      __m128i q = _mm_srli_epi16(_mm_mulhi_epu16(p, k_8081), 7);
+      __m128i r = _mm_sub_epi16(p, _mm_mullo_epi16(q, k_00FF));
+      __m128i v = _mm_add_epi16(
+          p, _mm_add_epi16(_mm_slli_epi16(q, 1), _mm_srli_epi16(r, 7)));
+
+      // The alpha lanes are simply widened from 8 to 16 bits.
+      halves[h] = _mm_blend_epi16(v, _mm_mullo_epi16(a, k_0101), 0x88);
+    }
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x00), halves[0]);
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x10), halves[1]);
+
+    s += 4 * 4;
+    d += 4 * 8;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint64_t c =
+        wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(
+            wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src,
+    bool rgb) {
+  size_t dst_len8 = dst.len / 8;
+  size_t src_len4 = src.len / 4;
+  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  __m128i shuffle = rgb ? _mm_set_epi8(+0x0F, +0x0C, +0x0D, +0x0E,  //
+                                       +0x0B, +0x08, +0x09, +0x0A,  //
+                                       +0x07, +0x04, +0x05, +0x06,  //
+                                       +0x03, +0x00, +0x01, +0x02)
+                        : _mm_set_epi8(+0x0F, +0x0E, +0x0D, +0x0C,  //
+                                       +0x0B, +0x0A, +0x09, +0x08,  //
+                                       +0x07, +0x06, +0x05, +0x04,  //
+                                       +0x03, +0x02, +0x01, +0x00);
+
+  while (n >= 4) {
+    __m128i x = _mm_shuffle_epi8(
+        _mm_lddqu_si128((const __m128i*)(const void*)s), shuffle);
+
+    // Interleaving a byte with itself multiplies it by 0x101.
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x00), _mm_unpacklo_epi8(x, x));
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x10), _mm_unpackhi_epi8(x, x));
+
+    s += 4 * 4;
+    d += 4 * 8;
+    n -= 4;
+  }
+
+  while (n >= 1) {
+    uint64_t c = wuffs_base__color_u32__as__color_u64(
+        wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));
+    if (rgb) {
+      c = wuffs_base__swap_u64_argb_abgr(c);
+    }
+    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);
+
+    s += 1 * 4;
+    d += 1 * 8;
+    n -= 1;
+  }
+
+  return len;
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src__x86_sse42(
+      dst, dst_palette, src, false);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src__x86_sse42(
+      dst, dst_palette, src, true);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src__x86_sse42(
+      dst, dst_palette, src, false);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src__x86_sse42(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src) {
+  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src__x86_sse42(
+      dst, dst_palette, src, true);
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxx__ycc(wuffs_base__slice_u8 dst,
+                                     wuffs_base__slice_u8 src0,
+                                     wuffs_base__slice_u8 src1,
+                                     wuffs_base__slice_u8 src2,
+                                     bool rgb) {
+  size_t len = dst.len / 3;
+  len = (len < src0.len) ? len : src0.len;
+  len = (len < src1.len) ? len : src1.len;
+  len = (len < src2.len) ? len : src2.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s0 = src0.ptr;
+  uint8_t* s1 = src1.ptr;
+  uint8_t* s2 = src2.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t c =
+        wuffs_base__color_ycc__as__color_u32_argb_premul(s0[0], s1[0], s2[0]);
+    if (rgb) {
+      c = wuffs_base__swap_u32_argb_abgr(c);
+    }
+    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), c);
+
+    s0 += 1;
+    s1 += 1;
+    s2 += 1;
+    d += 1 * 3;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgr__ycc(wuffs_base__slice_u8 dst,
+                                     wuffs_base__slice_u8 src0,
+                                     wuffs_base__slice_u8 src1,
+                                     wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxx__ycc(dst, src0, src1, src2, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgb__ycc(wuffs_base__slice_u8 dst,
+                                     wuffs_base__slice_u8 src0,
+                                     wuffs_base__slice_u8 src1,
+                                     wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxx__ycc(dst, src0, src1, src2, true);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__ycc(wuffs_base__slice_u8 dst,
+                                      wuffs_base__slice_u8 src0,
+                                      wuffs_base__slice_u8 src1,
+                                      wuffs_base__slice_u8 src2,
+                                      bool rgb) {
+  size_t len = dst.len / 4;
+  len = (len < src0.len) ? len : src0.len;
+  len = (len < src1.len) ? len : src1.len;
+  len = (len < src2.len) ? len : src2.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s0 = src0.ptr;
+  uint8_t* s1 = src1.ptr;
+  uint8_t* s2 = src2.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    uint32_t c =
+        wuffs_base__color_ycc__as__color_u32_argb_premul(s0[0], s1[0], s2[0]);
+    if (rgb) {
+      c = wuffs_base__swap_u32_argb_abgr(c);
+    }
+    wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), c);
+
+    s0 += 1;
+    s1 += 1;
+    s2 += 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgrx__ycc(wuffs_base__slice_u8 dst,
+                                      wuffs_base__slice_u8 src0,
+                                      wuffs_base__slice_u8 src1,
+                                      wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxxx__ycc(dst, src0, src1, src2, false);
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgbx__ycc(wuffs_base__slice_u8 dst,
+                                      wuffs_base__slice_u8 src0,
+                                      wuffs_base__slice_u8 src1,
+                                      wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxxx__ycc(dst, src0, src1, src2, true);
+}
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static inline uint64_t  //
+wuffs_base__pixel_swizzler__xxxx__ycc__x86_sse42(wuffs_base__slice_u8 dst,
+                                                 wuffs_base__slice_u8 src0,
+                                                 wuffs_base__slice_u8 src1,
+                                                 wuffs_base__slice_u8 src2,
+                                                 bool rgb) {
+  size_t len = dst.len / 4;
+  len = (len < src0.len) ? len : src0.len;
+  len = (len < src1.len) ? len : src1.len;
+  len = (len < src2.len) ? len : src2.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s0 = src0.ptr;
+  uint8_t* s1 = src1.ptr;
+  uint8_t* s2 = src2.ptr;
+  size_t n = len;
+
+  // The constants are the same as those in
+  // wuffs_base__color_ycc__as__color_u32_argb_premul, which also explains
+  // the _mm_mulhrs_epi16 rounding.
+  __m128i bias = _mm_set1_epi16(128);
+  __m128i k_r_cr = _mm_set1_epi16(+13173);
+  __m128i k_g_cb = _mm_set1_epi16(-11277);
+  __m128i k_g_cr = _mm_set1_epi16(-23401);
+  __m128i k_b_cb = _mm_set1_epi16(+25297);
+  __m128i opaque = _mm_set1_epi8(-1);
+
+  // Each iteration converts 16 pixels, in two halves of 8 16-bit lanes.
+  while (n >= 16) {
+    __m128i yy = _mm_lddqu_si128((const __m128i*)(const void*)s0);
+    __m128i cb = _mm_lddqu_si128((const __m128i*)(const void*)s1);
+    __m128i cr = _mm_lddqu_si128((const __m128i*)(const void*)s2);
+
+    __m128i y_lo = _mm_cvtepu8_epi16(yy);
+    __m128i y_hi = _mm_cvtepu8_epi16(_mm_srli_si128(yy, 8));
+    __m128i cb_lo = _mm_sub_epi16(_mm_cvtepu8_epi16(cb), bias);
+    __m128i cb_hi =
+        _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(cb, 8)), bias);
+    __m128i cr_lo = _mm_sub_epi16(_mm_cvtepu8_epi16(cr), bias);
+    __m128i cr_hi =
+        _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(cr, 8)), bias);
+
+    __m128i r_lo = _mm_add_epi16(_mm_add_epi16(y_lo, cr_lo),
+                                 _mm_mulhrs_epi16(cr_lo, k_r_cr));
+    __m128i r_hi = _mm_add_epi16(_mm_add_epi16(y_hi, cr_hi),
+                                 _mm_mulhrs_epi16(cr_hi, k_r_cr));
+    __m128i g_lo =
+        _mm_add_epi16(_mm_add_epi16(y_lo, _mm_mulhrs_epi16(cb_lo, k_g_cb)),
+                      _mm_mulhrs_epi16(cr_lo, k_g_cr));
+    __m128i g_hi =
+        _mm_add_epi16(_mm_add_epi16(y_hi, _mm_mulhrs_epi16(cb_hi, k_g_cb)),
+                      _mm_mulhrs_epi16(cr_hi, k_g_cr));
+    __m128i b_lo = _mm_add_epi16(_mm_add_epi16(y_lo, cb_lo),
+                                 _mm_mulhrs_epi16(cb_lo, k_b_cb));
+    __m128i b_hi = _mm_add_epi16(_mm_add_epi16(y_hi, cb_hi),
+                                 _mm_mulhrs_epi16(cb_hi, k_b_cb));
+
+    // Saturate to 8 bits and interleave, in memory order, as B, G, R, A (or
+    // as R, G, B, A).
+    __m128i r = _mm_packus_epi16(r_lo, r_hi);
+    __m128i g = _mm_packus_epi16(g_lo, g_hi);
+    __m128i b = _mm_packus_epi16(b_lo, b_hi);
+    if (rgb) {
+      __m128i t = r;
+      r = b;
+      b = t;
+    }
+    __m128i bg_lo = _mm_unpacklo_epi8(b, g);
+    __m128i bg_hi = _mm_unpackhi_epi8(b, g);
+    __m128i ra_lo = _mm_unpacklo_epi8(r, opaque);
+    __m128i ra_hi = _mm_unpackhi_epi8(r, opaque);
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x00),
+                     _mm_unpacklo_epi16(bg_lo, ra_lo));
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x10),
+                     _mm_unpackhi_epi16(bg_lo, ra_lo));
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x20),
+                     _mm_unpacklo_epi16(bg_hi, ra_hi));
+    _mm_storeu_si128((__m128i*)(void*)(d + 0x30),
+                     _mm_unpackhi_epi16(bg_hi, ra_hi));
+
+    s0 += 16;
+    s1 += 16;
+    s2 += 16;
+    d += 16 * 4;
+    n -= 16;
+  }
+
+  while (n >= 1) {
+    uint32_t c =
+        wuffs_base__color_ycc__as__color_u32_argb_premul(s0[0], s1[0], s2[0]);
+    if (rgb) {
+      c = wuffs_base__swap_u32_argb_abgr(c);
+    }
+    wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), c);
+
+    s0 += 1;
+    s1 += 1;
+    s2 += 1;
+    d += 1 * 4;
+    n -= 1;
+  }
+
+  return len;
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__bgrx__ycc__x86_sse42(wuffs_base__slice_u8 dst,
+                                                 wuffs_base__slice_u8 src0,
+                                                 wuffs_base__slice_u8 src1,
+                                                 wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxxx__ycc__x86_sse42(dst, src0, src1, src2,
+                                                          false);
+}
+
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static uint64_t  //
+wuffs_base__pixel_swizzler__rgbx__ycc__x86_sse42(wuffs_base__slice_u8 dst,
+                                                 wuffs_base__slice_u8 src0,
+                                                 wuffs_base__slice_u8 src1,
+                                                 wuffs_base__slice_u8 src2) {
+  return wuffs_base__pixel_swizzler__xxxx__ycc__x86_sse42(dst, src0, src1, src2,
+                                                          true);
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// --------
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__index__y(wuffs_base__slice_u8 dst,
+                                     wuffs_base__pixel_palette_lookup* lookup,
+                                     wuffs_base__slice_u8 src) {
+  size_t len = (dst.len < src.len) ? dst.len : src.len;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    d[0] = wuffs_base__pixel_palette_lookup__closest_element(
+        lookup, 0xFF000000 | (0x00010101 * ((uint32_t)(s[0]))));
+
+    s += 1 * 1;
+    d += 1;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__index__bgr(wuffs_base__slice_u8 dst,
+                                       wuffs_base__pixel_palette_lookup* lookup,
+                                       wuffs_base__slice_u8 src) {
+  size_t src_len3 = src.len / 3;
+  size_t len = (dst.len < src_len3) ? dst.len : src_len3;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    d[0] = wuffs_base__pixel_palette_lookup__closest_element(
+        lookup, 0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s));
+
+    s += 1 * 3;
+    d += 1;
+    n -= 1;
+  }
+
+  return len;
+}
+
+static uint64_t  //
+wuffs_base__pixel_swizzler__index__bgra_nonpremul(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__slice_u8 src) {
+  size_t src_len4 = src.len / 4;
+  size_t len = (dst.len < src_len4) ? dst.len : src_len4;
+  uint8_t* d = dst.ptr;
+  uint8_t* s = src.ptr;
+  size_t n = len;
+
+  while (n >= 1) {
+    d[0] = wuffs_base__pixel_palette_lookup__closest_element(
+        lookup, wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(
+                    wuffs_base__load_u32le__no_bounds_check(s)));
 
-    s += 1 * 1;
-    d += 1 * 4;
+    s += 1 * 4;
+    d += 1;
     n -= 1;
   }
 
@@ -1108,25 +3002,22 @@ wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over(
 }
 
 static uint64_t  //
-wuffs_base__pixel_swizzler__xxxx__xxx(wuffs_base__slice_u8 dst,
-                                      wuffs_base__slice_u8 dst_palette,
-                                      wuffs_base__slice_u8 src) {
-  size_t dst_len4 = dst.len / 4;
-  size_t src_len3 = src.len / 3;
-  size_t len = dst_len4 < src_len3 ? dst_len4 : src_len3;
+wuffs_base__pixel_swizzler__index__bgra_premul(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__slice_u8 src) {
+  size_t src_len4 = src.len / 4;
+  size_t len = (dst.len < src_len4) ? dst.len : src_len4;
   uint8_t* d = dst.ptr;
   uint8_t* s = src.ptr;
   size_t n = len;
 
-  // TODO: unroll.
-
   while (n >= 1) {
-    wuffs_base__store_u32le__no_bounds_check(
-        d + (0 * 4),
-        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s + (0 * 3)));
+    d[0] = wuffs_base__pixel_palette_lookup__closest_element(
+        lookup, wuffs_base__load_u32le__no_bounds_check(s));
 
-    s += 1 * 3;
-    d += 1 * 4;
+    s += 1 * 4;
+    d += 1;
     n -= 1;
   }
 
@@ -1134,23 +3025,22 @@ wuffs_base__pixel_swizzler__xxxx__xxx(wuffs_base__slice_u8 dst,
 }
 
 static uint64_t  //
-wuffs_base__pixel_swizzler__xxxx__y(wuffs_base__slice_u8 dst,
-                                    wuffs_base__slice_u8 dst_palette,
-                                    wuffs_base__slice_u8 src) {
-  size_t dst_len4 = dst.len / 4;
-  size_t len = dst_len4 < src.len ? dst_len4 : src.len;
+wuffs_base__pixel_swizzler__index__bgrx(
+    wuffs_base__slice_u8 dst,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__slice_u8 src) {
+  size_t src_len4 = src.len / 4;
+  size_t len = (dst.len < src_len4) ? dst.len : src_len4;
   uint8_t* d = dst.ptr;
   uint8_t* s = src.ptr;
   size_t n = len;
 
-  // TODO: unroll.
-
   while (n >= 1) {
-    wuffs_base__store_u32le__no_bounds_check(
-        d + (0 * 4), 0xFF000000 | (0x010101 * (uint32_t)s[0]));
+    d[0] = wuffs_base__pixel_palette_lookup__closest_element(
+        lookup, 0xFF000000 | wuffs_base__load_u32le__no_bounds_check(s));
 
-    s += 1 * 1;
-    d += 1 * 4;
+    s += 1 * 4;
+    d += 1;
     n -= 1;
   }
 
@@ -1181,7 +3071,16 @@ wuffs_base__pixel_swizzler__prepare__y(wuffs_base__pixel_swizzler* p,
     case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
     case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:
     case WUFFS_BASE__PIXEL_FORMAT__RGBX:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+      if (wuffs_base__cpu_arch__have_x86_sse42()) {
+        return wuffs_base__pixel_swizzler__xxxx__y__x86_sse42;
+      }
+#endif
       return wuffs_base__pixel_swizzler__xxxx__y;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      return wuffs_base__pixel_swizzler__xxxxxxxx__y;
   }
   return NULL;
 }
@@ -1275,6 +3174,32 @@ wuffs_base__pixel_swizzler__prepare__indexed__bgra_binary(
           return wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over;
       }
       return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_palette) !=
+          1024) {
+        return NULL;
+      }
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__xxxxxxxx__index__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__xxxxxxxx__index_binary_alpha__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      if (wuffs_base__pixel_swizzler__swap_rgbx_bgrx(dst_palette,
+                                                     src_palette) != 1024) {
+        return NULL;
+      }
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__xxxxxxxx__index__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__xxxxxxxx__index_binary_alpha__src_over;
+      }
+      return NULL;
   }
   return NULL;
 }
@@ -1296,6 +3221,11 @@ wuffs_base__pixel_swizzler__prepare__bgr(wuffs_base__pixel_swizzler* p,
     case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
     case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
     case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+      if (wuffs_base__cpu_arch__have_x86_sse42()) {
+        return wuffs_base__pixel_swizzler__xxxx__xxx__x86_sse42;
+      }
+#endif
       return wuffs_base__pixel_swizzler__xxxx__xxx;
 
     case WUFFS_BASE__PIXEL_FORMAT__RGB:
@@ -1305,6 +3235,12 @@ wuffs_base__pixel_swizzler__prepare__bgr(wuffs_base__pixel_swizzler* p,
     case WUFFS_BASE__PIXEL_FORMAT__RGBX:
       // TODO.
       break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgr;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgr;
   }
   return NULL;
 }
@@ -1340,6 +3276,11 @@ wuffs_base__pixel_swizzler__prepare__bgra_nonpremul(
         case WUFFS_BASE__PIXEL_BLEND__SRC:
           return wuffs_base__pixel_swizzler__copy_4_4;
         case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over__x86_sse42;
+          }
+#endif
           return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over;
       }
       return NULL;
@@ -1347,8 +3288,18 @@ wuffs_base__pixel_swizzler__prepare__bgra_nonpremul(
     case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
       switch (blend) {
         case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src__x86_sse42;
+          }
+#endif
           return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src;
         case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over__x86_sse42;
+          }
+#endif
           return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over;
       }
       return NULL;
@@ -1358,19 +3309,267 @@ wuffs_base__pixel_swizzler__prepare__bgra_nonpremul(
       // TODO.
       break;
 
-    case WUFFS_BASE__PIXEL_FORMAT__RGB:
     case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx;
+      }
+      // TODO: SRC_OVER.
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGB:
     case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
     case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:
     case WUFFS_BASE__PIXEL_FORMAT__RGBX:
       // TODO.
       break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src_over;
+      }
+      return NULL;
+  }
+  return NULL;
+}
+
+static wuffs_base__pixel_swizzler__func  //
+wuffs_base__pixel_swizzler__prepare__bgra_premul(
+    wuffs_base__pixel_swizzler* p,
+    wuffs_base__pixel_format dst_format,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__slice_u8 src_palette,
+    wuffs_base__pixel_blend blend) {
+  // Unlike a BGRA_NONPREMUL source, premultiplied destinations composite a
+  // BGRA_PREMUL source directly, without a round trip through non-premul.
+  switch (dst_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__bgr_565__bgra_premul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__bgr_565__bgra_premul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__bgr__bgra_premul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__bgr__bgra_premul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+          return wuffs_base__pixel_swizzler__copy_4_4;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx;
+      }
+      // TODO: SRC_OVER.
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src_over;
+      }
+      return NULL;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+      switch (blend) {
+        case WUFFS_BASE__PIXEL_BLEND__SRC:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+          if (wuffs_base__cpu_arch__have_x86_sse42()) {
+            return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src__x86_sse42;
+          }
+#endif
+          return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src;
+        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+          return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src_over;
+      }
+      return NULL;
+  }
+  return NULL;
+}
+
+static wuffs_base__pixel_swizzler__planar_func  //
+wuffs_base__pixel_swizzler__prepare__ycc(wuffs_base__pixel_swizzler* p,
+                                         wuffs_base__pixel_format dst_format,
+                                         wuffs_base__slice_u8 dst_palette,
+                                         wuffs_base__slice_u8 src_palette,
+                                         wuffs_base__pixel_blend blend) {
+  // The source is opaque, so that SRC_OVER is equivalent to SRC.
+  switch (dst_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      return wuffs_base__pixel_swizzler__bgr__ycc;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+      if (wuffs_base__cpu_arch__have_x86_sse42()) {
+        return wuffs_base__pixel_swizzler__bgrx__ycc__x86_sse42;
+      }
+#endif
+      return wuffs_base__pixel_swizzler__bgrx__ycc;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGB:
+      return wuffs_base__pixel_swizzler__rgb__ycc;
+
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:
+    case WUFFS_BASE__PIXEL_FORMAT__RGBX:
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+      if (wuffs_base__cpu_arch__have_x86_sse42()) {
+        return wuffs_base__pixel_swizzler__rgbx__ycc__x86_sse42;
+      }
+#endif
+      return wuffs_base__pixel_swizzler__rgbx__ycc;
   }
   return NULL;
 }
 
 // --------
 
+// wuffs_base__pixel_swizzler__dst_pixfmt_is_allowed returns whether dst_pixfmt
+// is allowed by the WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST build
+// configuration. If that macro is defined, only the destination pixel formats
+// whose WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_ETC macro is also defined are
+// allowed. For example, a program that only ever decodes to BGRA_PREMUL can
+// define WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST and
+// WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_PREMUL, and the compiler can then
+// discard the swizzlers for every other destination.
+static inline bool  //
+wuffs_base__pixel_swizzler__dst_pixfmt_is_allowed(
+    wuffs_base__pixel_format dst_pixfmt) {
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST)
+  switch (dst_pixfmt.repr) {
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_INDEXED__BGRA_NONPREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_INDEXED__BGRA_PREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_INDEXED__BGRA_BINARY)
+    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGR_565)
+    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGR)
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_NONPREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_PREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_BINARY)
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRX)
+    case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGB)
+    case WUFFS_BASE__PIXEL_FORMAT__RGB:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBA_NONPREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBA_PREMUL)
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBA_BINARY)
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBX)
+    case WUFFS_BASE__PIXEL_FORMAT__RGBX:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_PREMUL_4X16LE)
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+#endif
+#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBA_PREMUL_4X16LE)
+    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:
+#endif
+      return true;
+  }
+  return false;
+#else
+  return true;
+#endif
+}
+
 WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
 wuffs_base__pixel_swizzler__prepare(wuffs_base__pixel_swizzler* p,
                                     wuffs_base__pixel_format dst_format,
@@ -1385,6 +3584,16 @@ wuffs_base__pixel_swizzler__prepare(wuffs_base__pixel_swizzler* p,
   // TODO: support many more formats.
 
   wuffs_base__pixel_swizzler__func func = NULL;
+  wuffs_base__pixel_swizzler__planar_func planar_func = NULL;
+
+  if (!wuffs_base__pixel_swizzler__dst_pixfmt_is_allowed(dst_format)) {
+    p->private_impl.func = NULL;
+    p->private_impl.planar_func = NULL;
+    p->private_impl.quantize_func = NULL;
+    p->private_impl.lookup = NULL;
+    return wuffs_base__make_status(
+        wuffs_base__error__disabled_by_wuffs_config_dst_pixel_format_enable_allowlist);
+  }
 
   switch (src_format.repr) {
     case WUFFS_BASE__PIXEL_FORMAT__Y:
@@ -1406,11 +3615,92 @@ wuffs_base__pixel_swizzler__prepare(wuffs_base__pixel_swizzler* p,
       func = wuffs_base__pixel_swizzler__prepare__bgra_nonpremul(
           p, dst_format, dst_palette, src_palette, blend);
       break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+      func = wuffs_base__pixel_swizzler__prepare__bgra_premul(
+          p, dst_format, dst_palette, src_palette, blend);
+      break;
+
+    case WUFFS_BASE__PIXEL_FORMAT__YCBCR:
+      planar_func = wuffs_base__pixel_swizzler__prepare__ycc(
+          p, dst_format, dst_palette, src_palette, blend);
+      break;
   }
 
   p->private_impl.func = func;
+  p->private_impl.planar_func = planar_func;
+  p->private_impl.quantize_func = NULL;
+  p->private_impl.lookup = NULL;
+  if (func || planar_func) {
+    return wuffs_base__make_status(NULL);
+  }
   return wuffs_base__make_status(
-      func ? NULL : wuffs_base__error__unsupported_pixel_swizzler_option);
+      wuffs_base__error__unsupported_pixel_swizzler_option);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_swizzler__prepare_quantizing(
+    wuffs_base__pixel_swizzler* p,
+    wuffs_base__pixel_palette_lookup* lookup,
+    wuffs_base__pixel_format dst_format,
+    wuffs_base__slice_u8 dst_palette,
+    wuffs_base__pixel_format src_format,
+    wuffs_base__pixel_blend blend) {
+  if (!p) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  p->private_impl.func = NULL;
+  p->private_impl.planar_func = NULL;
+  p->private_impl.quantize_func = NULL;
+  p->private_impl.lookup = NULL;
+  if (!lookup) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  } else if (!wuffs_base__pixel_swizzler__dst_pixfmt_is_allowed(dst_format)) {
+    return wuffs_base__make_status(
+        wuffs_base__error__disabled_by_wuffs_config_dst_pixel_format_enable_allowlist);
+  }
+
+  // Compositing onto palette indexes would need blending the existing dst
+  // color, so only SRC is supported unless the source is opaque, when
+  // SRC_OVER is equivalent to SRC.
+  wuffs_base__pixel_swizzler__quantize_func quantize_func = NULL;
+  bool opaque = true;
+  switch (src_format.repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__Y:
+      quantize_func = wuffs_base__pixel_swizzler__index__y;
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGR:
+      quantize_func = wuffs_base__pixel_swizzler__index__bgr;
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+      quantize_func = wuffs_base__pixel_swizzler__index__bgra_nonpremul;
+      opaque = false;
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:
+      quantize_func = wuffs_base__pixel_swizzler__index__bgra_premul;
+      opaque = false;
+      break;
+    case WUFFS_BASE__PIXEL_FORMAT__BGRX:
+      quantize_func = wuffs_base__pixel_swizzler__index__bgrx;
+      break;
+  }
+  if (!quantize_func ||
+      ((blend != WUFFS_BASE__PIXEL_BLEND__SRC) &&
+       ((blend != WUFFS_BASE__PIXEL_BLEND__SRC_OVER) || !opaque))) {
+    return wuffs_base__make_status(
+        wuffs_base__error__unsupported_pixel_swizzler_option);
+  }
+
+  wuffs_base__status status = wuffs_base__pixel_palette_lookup__prepare(
+      lookup, dst_palette, dst_format);
+  if (status.repr) {
+    return wuffs_base__make_status(
+        wuffs_base__error__unsupported_pixel_swizzler_option);
+  }
+  p->private_impl.quantize_func = quantize_func;
+  p->private_impl.lookup = lookup;
+  return wuffs_base__make_status(NULL);
 }
 
 WUFFS_BASE__MAYBE_STATIC uint64_t  //
@@ -1419,8 +3709,113 @@ wuffs_base__pixel_swizzler__swizzle_interleaved(
     wuffs_base__slice_u8 dst,
     wuffs_base__slice_u8 dst_palette,
     wuffs_base__slice_u8 src) {
-  if (p && p->private_impl.func) {
-    return (*p->private_impl.func)(dst, dst_palette, src);
+  if (p) {
+    if (p->private_impl.func) {
+      return (*p->private_impl.func)(dst, dst_palette, src);
+    } else if (p->private_impl.quantize_func) {
+      return (*p->private_impl.quantize_func)(dst, p->private_impl.lookup, src);
+    }
   }
   return 0;
 }
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__pixel_swizzler__swizzle_planar(
+    const wuffs_base__pixel_swizzler* p,
+    wuffs_base__pixel_buffer* dst,
+    const wuffs_base__pixel_buffer* src) {
+  if (!p) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  } else if (!p->private_impl.planar_func) {
+    return wuffs_base__make_status(
+        wuffs_base__error__unsupported_pixel_swizzler_option);
+  } else if (!dst || !src ||
+             (wuffs_base__pixel_format__num_planes(
+                  &src->pixcfg.private_impl.pixfmt) < 3)) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+
+  uint32_t dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(
+      &dst->pixcfg.private_impl.pixfmt);
+  if ((dst_bits_per_pixel == 0) || ((dst_bits_per_pixel % 8) != 0)) {
+    return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+  }
+  size_t dst_bytes_per_pixel = dst_bits_per_pixel / 8;
+
+  uint32_t width = wuffs_base__u32__min(dst->pixcfg.private_impl.width,
+                                        src->pixcfg.private_impl.width);
+  uint32_t height = wuffs_base__u32__min(dst->pixcfg.private_impl.height,
+                                         src->pixcfg.private_impl.height);
+  const wuffs_base__pixel_subsampling* pixsub =
+      &src->pixcfg.private_impl.pixsub;
+  const wuffs_base__table_u8* src_tabs = &src->private_impl.planes[0];
+  const wuffs_base__table_u8* dst_tab = &dst->private_impl.planes[0];
+  uint32_t q;
+  for (q = 0; q < 3; q++) {
+    if ((width > 0) && (height > 0) &&
+        ((src_tabs[q].width == 0) || (src_tabs[q].height == 0))) {
+      return wuffs_base__make_status(wuffs_base__error__bad_argument);
+    }
+  }
+
+  // Samples that don't map one-to-one onto pixels (e.g. 4:2:2 or 4:2:0
+  // chroma) are replicated, one chunk at a time, into upsampled.
+  uint8_t upsampled[3][256];
+
+  uint32_t y;
+  for (y = 0; y < height; y++) {
+    const uint8_t* src_rows[3];
+    for (q = 0; q < 3; q++) {
+      size_t j = (y + wuffs_base__pixel_subsampling__bias_y(pixsub, q)) /
+                 wuffs_base__pixel_subsampling__denominator_y(pixsub, q);
+      if (j >= src_tabs[q].height) {
+        j = src_tabs[q].height - 1;
+      }
+      src_rows[q] = src_tabs[q].ptr + (j * src_tabs[q].stride);
+    }
+    uint8_t* dst_row = dst_tab->ptr + (((size_t)y) * dst_tab->stride);
+
+    uint32_t x = 0;
+    while (x < width) {
+      size_t n = wuffs_base__u32__min(width - x, 256);
+      wuffs_base__slice_u8 srcs[3];
+      for (q = 0; q < 3; q++) {
+        uint32_t bx = wuffs_base__pixel_subsampling__bias_x(pixsub, q);
+        uint32_t dx = wuffs_base__pixel_subsampling__denominator_x(pixsub, q);
+        size_t w = src_tabs[q].width;
+        if ((bx == 0) && (dx == 1)) {
+          srcs[q] = wuffs_base__make_slice_u8(
+              (uint8_t*)(src_rows[q] + x),
+              (x < w) ? wuffs_base__u64__min(n, w - x) : 0);
+          continue;
+        }
+        // Step i and its remainder r incrementally, instead of dividing
+        // (x + k + bx) by dx for every k.
+        size_t i = (x + bx) / dx;
+        uint32_t r = (x + bx) % dx;
+        size_t k;
+        for (k = 0; k < n; k++) {
+          upsampled[q][k] = src_rows[q][(i < w) ? i : (w - 1)];
+          if (++r == dx) {
+            r = 0;
+            i++;
+          }
+        }
+        srcs[q] = wuffs_base__make_slice_u8(&upsampled[q][0], n);
+      }
+
+      size_t dst_i = ((size_t)x) * dst_bytes_per_pixel;
+      if (dst_i >= dst_tab->width) {
+        break;
+      }
+      uint64_t m = (*p->private_impl.planar_func)(
+          wuffs_base__make_slice_u8(dst_row + dst_i, dst_tab->width - dst_i),
+          srcs[0], srcs[1], srcs[2]);
+      if (m < n) {
+        break;
+      }
+      x += (uint32_t)n;
+    }
+  }
+  return wuffs_base__make_status(NULL);
+}
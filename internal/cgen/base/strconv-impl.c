@@ -299,6 +299,94 @@ fail_out_of_bounds:
   } while (0);
 }
 
+// --------
+
+// wuffs_base__render_number__two_digits holds "00", "01", ..., "99".
+static const char wuffs_base__render_number__two_digits[200] = {
+    '0', '0', '0', '1', '0', '2', '0', '3', '0', '4',  //
+    '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',  //
+    '1', '0', '1', '1', '1', '2', '1', '3', '1', '4',  //
+    '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',  //
+    '2', '0', '2', '1', '2', '2', '2', '3', '2', '4',  //
+    '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',  //
+    '3', '0', '3', '1', '3', '2', '3', '3', '3', '4',  //
+    '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',  //
+    '4', '0', '4', '1', '4', '2', '4', '3', '4', '4',  //
+    '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',  //
+    '5', '0', '5', '1', '5', '2', '5', '3', '5', '4',  //
+    '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',  //
+    '6', '0', '6', '1', '6', '2', '6', '3', '6', '4',  //
+    '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',  //
+    '7', '0', '7', '1', '7', '2', '7', '3', '7', '4',  //
+    '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',  //
+    '8', '0', '8', '1', '8', '2', '8', '3', '8', '4',  //
+    '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',  //
+    '9', '0', '9', '1', '9', '2', '9', '3', '9', '4',  //
+    '9', '5', '9', '6', '9', '7', '9', '8', '9', '9',  //
+};
+
+// wuffs_base__private_implementation__render_number_u64 writes x's decimal
+// digits, with an optional leading sign, to dst. It works backwards, from the
+// least significant digit, using a stack-allocated buffer.
+static size_t  //
+wuffs_base__private_implementation__render_number_u64(wuffs_base__slice_u8 dst,
+                                                      uint64_t x,
+                                                      uint8_t sign) {
+  uint8_t buf[WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL];
+  uint8_t* const end = buf + WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL;
+  uint8_t* p = end;
+
+  while (x >= 100) {
+    const char* q = &wuffs_base__render_number__two_digits[2 * (x % 100)];
+    x /= 100;
+    p -= 2;
+    p[0] = (uint8_t)(q[0]);
+    p[1] = (uint8_t)(q[1]);
+  }
+  if (x >= 10) {
+    const char* q = &wuffs_base__render_number__two_digits[2 * x];
+    p -= 2;
+    p[0] = (uint8_t)(q[0]);
+    p[1] = (uint8_t)(q[1]);
+  } else {
+    *--p = (uint8_t)('0' + x);
+  }
+  if (sign) {
+    *--p = sign;
+  }
+
+  size_t n = (size_t)(end - p);
+  if (n > dst.len) {
+    return 0;
+  }
+  memcpy(dst.ptr, p, n);
+  return n;
+}
+
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__render_number_i64(wuffs_base__slice_u8 dst,
+                              int64_t x,
+                              uint32_t options) {
+  // Negating in uint64_t arithmetic avoids undefined behavior when x is
+  // INT64_MIN.
+  if (x < 0) {
+    return wuffs_base__private_implementation__render_number_u64(
+        dst, 1 + ~((uint64_t)(x)), '-');
+  }
+  return wuffs_base__private_implementation__render_number_u64(
+      dst, (uint64_t)(x),
+      (options & WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN) ? '+' : 0);
+}
+
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__render_number_u64(wuffs_base__slice_u8 dst,
+                              uint64_t x,
+                              uint32_t options) {
+  return wuffs_base__private_implementation__render_number_u64(
+      dst, x,
+      (options & WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN) ? '+' : 0);
+}
+
 // ---------------- Hexadecimal
 
 WUFFS_BASE__MAYBE_STATIC size_t  //
@@ -492,14 +580,80 @@ wuffs_base__utf_8__next(wuffs_base__slice_u8 s) {
       WUFFS_BASE__UNICODE_REPLACEMENT_CHARACTER, 1);
 }
 
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+// wuffs_base__private_implementation__utf_8__longest_valid_prefix_x86_sse42
+// returns a length n such that s[..n] is valid UTF-8 and either s[n..] starts
+// with invalid UTF-8 or fewer than 16 bytes remain. It validates 16 bytes at a
+// time, falling back to wuffs_base__utf_8__next when that stops short. The
+// caller finishes the job from s[n..].
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static size_t  //
+wuffs_base__private_implementation__utf_8__longest_valid_prefix_x86_sse42(
+    wuffs_base__slice_u8 s) {
+  uint8_t* p = s.ptr;
+  uint8_t* q = s.ptr + s.len;
+  while ((q - p) >= 16) {
+    __m128i x = _mm_lddqu_si128((const __m128i*)(const void*)p);
+    if (_mm_movemask_epi8(x) == 0) {
+      p += 16;
+      continue;
+    }
+    uint32_t n = wuffs_base__cpu_arch__utf_8_span_x86_sse42(x, 0);
+    if (n == 0) {
+      wuffs_base__utf_8__next__output o = wuffs_base__utf_8__next(
+          wuffs_base__make_slice_u8(p, (size_t)(q - p)));
+      if ((o.code_point > 0x7F) && (o.byte_length == 1)) {
+        break;
+      }
+      n = o.byte_length;
+    }
+    p += n;
+  }
+  return (size_t)(p - s.ptr);
+}
+
+// wuffs_base__private_implementation__ascii__longest_valid_prefix_x86_sse42
+// returns a length n, a multiple of 16, such that s[..n] is valid ASCII and
+// either s[n..n+16] is not or there are fewer than 16 bytes remaining.
+WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42
+static size_t  //
+wuffs_base__private_implementation__ascii__longest_valid_prefix_x86_sse42(
+    wuffs_base__slice_u8 s) {
+  uint8_t* p = s.ptr;
+  uint8_t* q = s.ptr + s.len;
+  for (; (q - p) >= 16; p += 16) {
+    if (_mm_movemask_epi8(_mm_lddqu_si128((const __m128i*)(const void*)p)) !=
+        0) {
+      break;
+    }
+  }
+  return (size_t)(p - s.ptr);
+}
+
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
 WUFFS_BASE__MAYBE_STATIC size_t  //
 wuffs_base__utf_8__longest_valid_prefix(wuffs_base__slice_u8 s) {
-  // TODO: possibly optimize the all-ASCII case (4 or 8 bytes at a time).
-  //
-  // TODO: possibly optimize this by manually inlining the
-  // wuffs_base__utf_8__next calls.
   size_t original_len = s.len;
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+  if ((s.len >= 16) && wuffs_base__cpu_arch__have_x86_sse42()) {
+    size_t n =
+        wuffs_base__private_implementation__utf_8__longest_valid_prefix_x86_sse42(
+            s);
+    s.ptr += n;
+    s.len -= n;
+  }
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
   while (s.len > 0) {
+    // Consume ASCII 8 bytes at a time.
+    if ((s.len >= 8) && ((wuffs_base__load_u64le__no_bounds_check(s.ptr) &
+                          0x8080808080808080) == 0)) {
+      s.ptr += 8;
+      s.len -= 8;
+      continue;
+    }
     wuffs_base__utf_8__next__output o = wuffs_base__utf_8__next(s);
     if ((o.code_point > 0x7F) && (o.byte_length == 1)) {
       break;
@@ -512,10 +666,23 @@ wuffs_base__utf_8__longest_valid_prefix(wuffs_base__slice_u8 s) {
 
 WUFFS_BASE__MAYBE_STATIC size_t  //
 wuffs_base__ascii__longest_valid_prefix(wuffs_base__slice_u8 s) {
-  // TODO: possibly optimize this by checking 4 or 8 bytes at a time.
   uint8_t* original_ptr = s.ptr;
   uint8_t* p = s.ptr;
   uint8_t* q = s.ptr + s.len;
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+  if ((s.len >= 16) && wuffs_base__cpu_arch__have_x86_sse42()) {
+    p +=
+        wuffs_base__private_implementation__ascii__longest_valid_prefix_x86_sse42(
+            s);
+  }
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+
+  // Consume ASCII 8 bytes at a time, then 1 byte at a time.
+  for (;
+       ((q - p) >= 8) &&
+       ((wuffs_base__load_u64le__no_bounds_check(p) & 0x8080808080808080) == 0);
+       p += 8) {
+  }
   for (; (p != q) && ((*p & 0x80) == 0); p++) {
   }
   return (size_t)(p - original_ptr);
@@ -54,6 +54,58 @@ wuffs_base__parse_number_i64(wuffs_base__slice_u8 s);
 WUFFS_BASE__MAYBE_STATIC wuffs_base__result_u64  //
 wuffs_base__parse_number_u64(wuffs_base__slice_u8 s);
 
+// --------
+
+// Options (bitwise or'ed together) for wuffs_base__render_number_xxx
+// functions. The XXX options apply to both integer and floating point. The FXX
+// options apply only to floating point.
+
+#define WUFFS_BASE__RENDER_NUMBER_XXX__DEFAULT_OPTIONS ((uint32_t)0x00000000)
+
+// WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN means to render a leading
+// "+" for non-negative numbers: "+0" and "+12.3" instead of "0" and "12.3".
+#define WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN ((uint32_t)0x00000001)
+
+// WUFFS_BASE__RENDER_NUMBER_FXX__INF_NAN_AS_NULL means to render infinities
+// and NaNs as "null" instead of "Infinity", "-Infinity" and "NaN". JSON has no
+// representation for non-finite numbers.
+#define WUFFS_BASE__RENDER_NUMBER_FXX__INF_NAN_AS_NULL ((uint32_t)0x00000100)
+
+// WUFFS_BASE__XXX__BYTE_LENGTH__MAX_INCL is the maximum number of bytes that
+// the corresponding wuffs_base__render_number_xxx function will write,
+// regardless of its options. For example, "-9223372036854775808" and
+// "+18446744073709551615" are 20 and 21 bytes long.
+#define WUFFS_BASE__I64__BYTE_LENGTH__MAX_INCL 20
+#define WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL 21
+#define WUFFS_BASE__F64__BYTE_LENGTH__MAX_INCL 25
+
+// wuffs_base__render_number_i64 writes the decimal representation of x to dst
+// and returns the number of bytes written. If dst is shorter than the entire
+// representation, it returns 0 (and no bytes are written).
+//
+// dst will never be too short if its length is at least 20, also known as
+// WUFFS_BASE__I64__BYTE_LENGTH__MAX_INCL.
+//
+// It is similar to wuffs_base__render_number_u64 but it takes a signed
+// integer, not an unsigned integer.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__render_number_i64(wuffs_base__slice_u8 dst,
+                              int64_t x,
+                              uint32_t options);
+
+// wuffs_base__render_number_u64 writes the decimal representation of x to dst
+// and returns the number of bytes written. If dst is shorter than the entire
+// representation, it returns 0 (and no bytes are written).
+//
+// dst will never be too short if its length is at least 21, also known as
+// WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL.
+//
+// Unlike snprintf, it does not write a trailing NUL byte.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__render_number_u64(wuffs_base__slice_u8 dst,
+                              uint64_t x,
+                              uint32_t options);
+
 // ---------------- IEEE 754 Floating Point
 
 // wuffs_base__parse_number_f64 parses the floating point number in s. For
@@ -95,6 +147,34 @@ wuffs_base__parse_number_u64(wuffs_base__slice_u8 s);
 WUFFS_BASE__MAYBE_STATIC wuffs_base__result_f64  //
 wuffs_base__parse_number_f64(wuffs_base__slice_u8 s);
 
+// wuffs_base__render_number_f64 writes the decimal representation of x to dst
+// and returns the number of bytes written. If dst is shorter than the entire
+// representation, it returns 0 (and no bytes are written).
+//
+// dst will never be too short if its length is at least 25, also known as
+// WUFFS_BASE__F64__BYTE_LENGTH__MAX_INCL.
+//
+// The representation has the fewest significant digits that still round-trip:
+// wuffs_base__parse_number_f64 of the rendered bytes produces exactly x. When
+// there is more than one such shortest representation, it picks the one
+// closest to x. For example, it renders 0.3 as "0.3", not
+// "0.299999999999999988898" or "0.30000000000000000".
+//
+// The layout otherwise follows ECMAScript's Number.prototype.toString: a
+// decimal separator is always '.', never ','; positional notation is used when
+// the base-10 exponent is in the range [-6 ..= 20]; otherwise it uses
+// exponential notation with an explicit exponent sign. For example, "123",
+// "0.000456" and "1.5e+300". Unlike ECMAScript, negative zero is rendered as
+// "-0", since "0" would not round-trip.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__F64CONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__render_number_f64(wuffs_base__slice_u8 dst,
+                              double x,
+                              uint32_t options);
+
 // wuffs_base__ieee_754_bit_representation__etc converts between a double
 // precision numerical value and its IEEE 754 64-bit representation (1 sign
 // bit, 11 exponent bits, 52 explicit significand bits).
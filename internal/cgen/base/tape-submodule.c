@@ -0,0 +1,358 @@
+// After editing this file, run "go generate" in the parent directory.
+
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ---------------- Token Tapes
+
+// The chain_state of an in-progress STRING node is one of:
+//  - NONE_COPIED: only dropped bytes (e.g. an opening quote) so far.
+//  - COPYING: the converted string is a contiguous run of source bytes.
+//  - COPIED: as COPYING, but followed by dropped bytes (e.g. a closing quote).
+//  - CONVERTED: the converted string is in the arena.
+#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED 0
+#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING 1
+#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPIED 2
+#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED 3
+
+WUFFS_BASE__MAYBE_STATIC void  //
+wuffs_base__tape_builder__initialize(wuffs_base__tape_builder* b,
+                                     wuffs_base__slice_u8 src) {
+  if (!b) {
+    return;
+  }
+  memset(&b->private_impl, 0, sizeof(b->private_impl));
+  b->private_impl.src = src;
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__set_nodes(wuffs_base__tape_builder* b,
+                                    wuffs_base__slice_tape_node nodes) {
+  if (!b) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  } else if (nodes.len < b->private_impl.nodes_wi) {
+    return wuffs_base__make_status(
+        wuffs_base__error__bad_argument_length_too_short);
+  }
+  // Every node's skip (and every open container's parent link) fits in a
+  // uint32_t.
+  if (((uint64_t)(nodes.len)) > 0xFFFFFFFF) {
+    nodes.len = (size_t)(0xFFFFFFFF);
+  }
+  if ((nodes.ptr != b->private_impl.nodes.ptr) &&
+      (b->private_impl.nodes_wi > 0)) {
+    memmove(nodes.ptr, b->private_impl.nodes.ptr,
+            b->private_impl.nodes_wi * sizeof(wuffs_base__tape_node));
+  }
+  b->private_impl.nodes = nodes;
+  return wuffs_base__make_status(NULL);
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__set_arena(wuffs_base__tape_builder* b,
+                                    wuffs_base__slice_u8 arena) {
+  if (!b) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  size_t n = 0;
+  if (b->private_impl.chain_state ==
+      WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED) {
+    n = b->private_impl.arena_wi - b->private_impl.chain_arena_begin;
+    if (arena.len < n) {
+      return wuffs_base__make_status(
+          wuffs_base__error__bad_argument_length_too_short);
+    } else if (n > 0) {
+      memmove(arena.ptr,
+              b->private_impl.arena.ptr + b->private_impl.chain_arena_begin, n);
+    }
+  }
+  b->private_impl.arena = arena;
+  b->private_impl.arena_wi = n;
+  b->private_impl.chain_arena_begin = 0;
+  return wuffs_base__make_status(NULL);
+}
+
+// wuffs_base__tape_builder__private_convert ensures that the in-progress
+// STRING node is in the CONVERTED state, with room for n more arena bytes.
+static const char*  //
+wuffs_base__tape_builder__private_convert(wuffs_base__tape_builder* b,
+                                          size_t n) {
+  size_t available = b->private_impl.arena.len - b->private_impl.arena_wi;
+  if (b->private_impl.chain_state ==
+      WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED) {
+    return (available >= n) ? NULL
+                            : wuffs_base__error__bad_argument_length_too_short;
+  }
+  size_t m = b->private_impl.chain_copy_end - b->private_impl.chain_copy_begin;
+  if ((available < m) || ((available - m) < n)) {
+    return wuffs_base__error__bad_argument_length_too_short;
+  } else if (m > 0) {
+    memcpy(b->private_impl.arena.ptr + b->private_impl.arena_wi,
+           b->private_impl.src.ptr + b->private_impl.chain_copy_begin, m);
+  }
+  b->private_impl.chain_arena_begin = b->private_impl.arena_wi;
+  b->private_impl.arena_wi += m;
+  b->private_impl.chain_state =
+      WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED;
+  return NULL;
+}
+
+// wuffs_base__tape_builder__private_append_string appends a STRING or
+// UNICODE_CODE_POINT token, at src index pos, to the in-progress STRING node.
+// On error, the builder's state (other than the arena's unused bytes) is
+// unchanged.
+static const char*  //
+wuffs_base__tape_builder__private_append_string(wuffs_base__tape_builder* b,
+                                                int64_t vbc,
+                                                uint64_t vbd,
+                                                size_t pos,
+                                                size_t len) {
+  if (vbc == WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT) {
+    uint8_t u[WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL];
+    size_t n = wuffs_base__utf_8__encode(
+        wuffs_base__make_slice_u8(&u[0],
+                                  WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL),
+        (uint32_t)(vbd));
+    if (n == 0) {
+      return wuffs_base__error__bad_argument;
+    }
+    const char* z = wuffs_base__tape_builder__private_convert(b, n);
+    if (z) {
+      return z;
+    }
+    memcpy(b->private_impl.arena.ptr + b->private_impl.arena_wi, &u[0], n);
+    b->private_impl.arena_wi += n;
+    return NULL;
+
+  } else if (len == 0) {
+    return NULL;
+
+  } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY) {
+    switch (b->private_impl.chain_state) {
+      case WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED:
+        b->private_impl.chain_copy_begin = pos;
+        b->private_impl.chain_copy_end = pos + len;
+        b->private_impl.chain_state =
+            WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING;
+        return NULL;
+      case WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING:
+        b->private_impl.chain_copy_end = pos + len;
+        return NULL;
+    }
+    const char* z = wuffs_base__tape_builder__private_convert(b, len);
+    if (z) {
+      return z;
+    }
+    memcpy(b->private_impl.arena.ptr + b->private_impl.arena_wi,
+           b->private_impl.src.ptr + pos, len);
+    b->private_impl.arena_wi += len;
+    return NULL;
+
+  } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_0_DST_1_SRC_DROP) {
+    switch (b->private_impl.chain_state) {
+      case WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED:
+        b->private_impl.chain_copy_begin = pos + len;
+        b->private_impl.chain_copy_end = pos + len;
+        break;
+      case WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING:
+        b->private_impl.chain_state =
+            WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPIED;
+        break;
+    }
+    return NULL;
+
+  } else if (vbd &
+             WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_4_SRC_BACKSLASH_X) {
+    if (len & 3) {
+      return wuffs_base__error__bad_argument;
+    }
+    const char* z = wuffs_base__tape_builder__private_convert(b, len / 4);
+    if (z) {
+      return z;
+    }
+    b->private_impl.arena_wi += wuffs_base__hexadecimal__decode4(
+        wuffs_base__make_slice_u8(
+            b->private_impl.arena.ptr + b->private_impl.arena_wi, len / 4),
+        wuffs_base__make_slice_u8(b->private_impl.src.ptr + pos, len));
+    return NULL;
+  }
+
+  return wuffs_base__error__unsupported_option;
+}
+
+// wuffs_base__tape_builder__private_end_chain completes the in-progress
+// chain's node, whose last token ends at src index end.
+static void  //
+wuffs_base__tape_builder__private_end_chain(wuffs_base__tape_builder* b,
+                                            size_t end) {
+  wuffs_base__tape_node* node =
+      &b->private_impl.nodes.ptr[b->private_impl.chain - 1];
+  if (wuffs_base__tape_node__kind(node) !=
+      WUFFS_BASE__TAPE_NODE__KIND__STRING) {
+    node->data.len = end - ((size_t)(node->data.ptr - b->private_impl.src.ptr));
+  } else if (b->private_impl.chain_state ==
+             WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED) {
+    node->data = wuffs_base__make_slice_u8(
+        b->private_impl.arena.ptr + b->private_impl.chain_arena_begin,
+        b->private_impl.arena_wi - b->private_impl.chain_arena_begin);
+    node->repr |= WUFFS_BASE__TAPE_NODE__FLAG__CONVERTED;
+  } else {
+    node->data = wuffs_base__make_slice_u8(
+        b->private_impl.src.ptr + b->private_impl.chain_copy_begin,
+        b->private_impl.chain_copy_end - b->private_impl.chain_copy_begin);
+  }
+  b->private_impl.chain = 0;
+  b->private_impl.chain_state =
+      WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED;
+}
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__append_tokens(wuffs_base__tape_builder* b,
+                                        wuffs_base__token_buffer* tok) {
+  if (!b) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  } else if (!tok) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+
+  for (; tok->meta.ri < tok->meta.wi; tok->meta.ri++) {
+    wuffs_base__token t = tok->data.ptr[tok->meta.ri];
+    size_t pos = b->private_impl.src_ri;
+    size_t len = (size_t)(wuffs_base__token__length(&t));
+    if (len > (b->private_impl.src.len - pos)) {
+      return wuffs_base__make_status(wuffs_base__error__bad_argument);
+    } else if (wuffs_base__token__value_major(&t) != 0) {
+      return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+    }
+    int64_t vbc = wuffs_base__token__value_base_category(&t);
+    uint64_t vbd = wuffs_base__token__value_base_detail(&t);
+
+    // Continue the in-progress chain, if there is one.
+    if (b->private_impl.chain) {
+      wuffs_base__tape_node* node =
+          &b->private_impl.nodes.ptr[b->private_impl.chain - 1];
+      if (wuffs_base__tape_node__kind(node) ==
+          WUFFS_BASE__TAPE_NODE__KIND__STRING) {
+        if ((vbc != WUFFS_BASE__TOKEN__VBC__STRING) &&
+            (vbc != WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT)) {
+          return wuffs_base__make_status(wuffs_base__error__bad_argument);
+        }
+        const char* z = wuffs_base__tape_builder__private_append_string(
+            b, vbc, vbd, pos, len);
+        if (z) {
+          return wuffs_base__make_status(z);
+        }
+      } else {
+        int64_t want_vbc = (wuffs_base__tape_node__kind(node) ==
+                            WUFFS_BASE__TAPE_NODE__KIND__LITERAL)
+                               ? WUFFS_BASE__TOKEN__VBC__LITERAL
+                               : WUFFS_BASE__TOKEN__VBC__NUMBER;
+        if (vbc != want_vbc) {
+          return wuffs_base__make_status(wuffs_base__error__bad_argument);
+        }
+      }
+      b->private_impl.src_ri = pos + len;
+      if (!wuffs_base__token__continued(&t)) {
+        wuffs_base__tape_builder__private_end_chain(b, pos + len);
+      }
+      continue;
+    }
+
+    uint32_t kind = 0;
+    switch (vbc) {
+      case WUFFS_BASE__TOKEN__VBC__FILLER:
+        b->private_impl.src_ri = pos + len;
+        continue;
+
+      case WUFFS_BASE__TOKEN__VBC__STRUCTURE:
+        if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__POP) {
+          if (b->private_impl.open == 0) {
+            return wuffs_base__make_status(wuffs_base__error__bad_argument);
+          }
+          size_t i = b->private_impl.open - 1;
+          wuffs_base__tape_node* node = &b->private_impl.nodes.ptr[i];
+          b->private_impl.open = node->skip;
+          node->skip = (uint32_t)(b->private_impl.nodes_wi - i);
+          node->data.len =
+              pos + len - ((size_t)(node->data.ptr - b->private_impl.src.ptr));
+          b->private_impl.src_ri = pos + len;
+          continue;
+        } else if (!(vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__PUSH)) {
+          return wuffs_base__make_status(wuffs_base__error__bad_argument);
+        } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_LIST) {
+          kind = WUFFS_BASE__TAPE_NODE__KIND__LIST;
+        } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_DICT) {
+          kind = WUFFS_BASE__TAPE_NODE__KIND__DICT;
+        } else {
+          return wuffs_base__make_status(wuffs_base__error__bad_argument);
+        }
+        break;
+
+      case WUFFS_BASE__TOKEN__VBC__STRING:
+      case WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT:
+        kind = WUFFS_BASE__TAPE_NODE__KIND__STRING;
+        break;
+      case WUFFS_BASE__TOKEN__VBC__LITERAL:
+        kind = WUFFS_BASE__TAPE_NODE__KIND__LITERAL;
+        break;
+      case WUFFS_BASE__TOKEN__VBC__NUMBER:
+        kind = WUFFS_BASE__TAPE_NODE__KIND__NUMBER;
+        break;
+
+      default:
+        return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+    }
+
+    // Start a new node.
+    if (b->private_impl.nodes_wi >= b->private_impl.nodes.len) {
+      return wuffs_base__make_status(
+          wuffs_base__error__bad_argument_length_too_short);
+    }
+    size_t i = b->private_impl.nodes_wi;
+    wuffs_base__tape_node* node = &b->private_impl.nodes.ptr[i];
+    node->data = wuffs_base__make_slice_u8(b->private_impl.src.ptr + pos, len);
+    node->repr = (kind << WUFFS_BASE__TAPE_NODE__KIND__SHIFT) |
+                 ((uint32_t)(vbd & 0x1FFFFF));
+    node->skip = 1;
+
+    if (kind == WUFFS_BASE__TAPE_NODE__KIND__STRING) {
+      b->private_impl.chain_copy_begin = pos;
+      b->private_impl.chain_copy_end = pos;
+      b->private_impl.chain_state =
+          WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED;
+      const char* z = wuffs_base__tape_builder__private_append_string(
+          b, vbc, vbd, pos, len);
+      if (z) {
+        return wuffs_base__make_status(z);
+      }
+    } else if ((kind == WUFFS_BASE__TAPE_NODE__KIND__LIST) ||
+               (kind == WUFFS_BASE__TAPE_NODE__KIND__DICT)) {
+      // Until it is popped, an open container's skip field links to its
+      // parent.
+      node->skip = (uint32_t)(b->private_impl.open);
+      b->private_impl.open = i + 1;
+    }
+
+    b->private_impl.nodes_wi = i + 1;
+    b->private_impl.src_ri = pos + len;
+    if ((kind != WUFFS_BASE__TAPE_NODE__KIND__LIST) &&
+        (kind != WUFFS_BASE__TAPE_NODE__KIND__DICT)) {
+      b->private_impl.chain = i + 1;
+      if (!wuffs_base__token__continued(&t)) {
+        wuffs_base__tape_builder__private_end_chain(b, pos + len);
+      }
+    }
+  }
+  return wuffs_base__make_status(NULL);
+}
@@ -272,6 +272,8 @@ typedef struct {
   inline bool is_valid() const;
   inline void compact();
   inline uint64_t reader_available() const;
+  inline uint64_t reader_category_run() const;
+  inline uint64_t reader_copy_run() const;
   inline uint64_t reader_token_position() const;
   inline uint64_t writer_available() const;
   inline uint64_t writer_token_position() const;
@@ -382,6 +384,72 @@ wuffs_base__token_buffer__reader_available(
   return buf ? buf->meta.wi - buf->meta.ri : 0;
 }
 
+// wuffs_base__token_buffer__reader_category_run returns the number of
+// readable tokens, starting at the read index, that have the same
+// value_base_category as the first one. For extended tokens and for tokens
+// with a non-zero value_major, this compares the value_major (and more) too.
+// It returns zero if and only if there are no readable tokens.
+//
+// Callers can use this to consume tokens in batches, handling a run of e.g.
+// filler tokens or string tokens in one step instead of dispatching on each
+// token's category. Runs do not stop at the end of a token chain, so callers
+// that care about chain boundaries still need to check each token's continued
+// bit.
+static inline uint64_t  //
+wuffs_base__token_buffer__reader_category_run(
+    const wuffs_base__token_buffer* buf) {
+  if (!buf || (buf->meta.ri >= buf->meta.wi)) {
+    return 0;
+  }
+  const wuffs_base__token* p = buf->data.ptr + buf->meta.ri;
+  const wuffs_base__token* q = buf->data.ptr + buf->meta.wi;
+  uint64_t c = p->repr >> WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT;
+  const wuffs_base__token* r = p + 1;
+  while ((r < q) &&
+         ((r->repr >> WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT) == c)) {
+    r++;
+  }
+  return (uint64_t)(r - p);
+}
+
+// wuffs_base__token_buffer__reader_copy_run returns the number of readable
+// tokens, starting at the read index, that are string tokens with the
+// CONVERT_1_DST_1_SRC_COPY conversion, stopping after (and including) the
+// first one that is not continued. It returns zero if the first readable
+// token (if any) is not such a token.
+//
+// Such a run is a single span of source bytes, whose length is the sum of its
+// tokens' lengths, and that span converts verbatim to the destination. The
+// maximum token length means that a decoder has to split a long run of
+// unescaped bytes into multiple tokens. A decoder (such as std/json's) may
+// also split runs when it suspends, e.g. when the source buffer is empty, but
+// when a run is decoded in one decode_tokens call, this lets a consumer
+// coalesce its tokens and then copy the whole span at once.
+static inline uint64_t  //
+wuffs_base__token_buffer__reader_copy_run(const wuffs_base__token_buffer* buf) {
+  if (!buf) {
+    return 0;
+  }
+  const wuffs_base__token* p = buf->data.ptr + buf->meta.ri;
+  const wuffs_base__token* q = buf->data.ptr + buf->meta.wi;
+  const wuffs_base__token* r = p;
+  for (; r < q; r++) {
+    uint64_t repr = r->repr;
+    if (((repr >> WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT) !=
+         WUFFS_BASE__TOKEN__VBC__STRING) ||
+        !(repr &
+          (((uint64_t)WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY)
+           << WUFFS_BASE__TOKEN__VALUE_BASE_DETAIL__SHIFT))) {
+      break;
+    } else if (!(repr &
+                 (((uint64_t)1) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT))) {
+      r++;
+      break;
+    }
+  }
+  return (uint64_t)(r - p);
+}
+
 static inline uint64_t  //
 wuffs_base__token_buffer__reader_token_position(
     const wuffs_base__token_buffer* buf) {
@@ -417,6 +485,16 @@ wuffs_base__token_buffer::reader_available() const {
   return wuffs_base__token_buffer__reader_available(this);
 }
 
+inline uint64_t  //
+wuffs_base__token_buffer::reader_category_run() const {
+  return wuffs_base__token_buffer__reader_category_run(this);
+}
+
+inline uint64_t  //
+wuffs_base__token_buffer::reader_copy_run() const {
+  return wuffs_base__token_buffer__reader_copy_run(this);
+}
+
 inline uint64_t  //
 wuffs_base__token_buffer::reader_token_position() const {
   return wuffs_base__token_buffer__reader_token_position(this);
@@ -433,3 +511,250 @@ wuffs_base__token_buffer::writer_token_position() const {
 }
 
 #endif  // __cplusplus
+
+// ---------------- Token Tapes
+
+// wuffs_base__tape_node is an element of a token tape: a flat array of the
+// values (not the tokens) of a fully buffered token stream, in pre-order.
+// Arrays and objects are "lists" and "dicts", as per the
+// WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_ETC bits. A dict node's children
+// alternate between keys and values.
+//
+// data is the node's bytes. For LITERAL and NUMBER nodes, they are the source
+// bytes, e.g. "true" or "-1.5e3". For LIST and DICT nodes, they are the source
+// bytes from the opening '[' or '{' to the closing ']' or '}' inclusive. For
+// STRING nodes, they are the converted string (without quotes or escapes).
+// This points into the source, without copying, unless the FLAG__CONVERTED
+// bit is set, in which case it points into the tape builder's arena.
+//
+// repr packs the kind (one of WUFFS_BASE__TAPE_NODE__KIND__ETC), the flags and
+// the value_base_detail of the node's first token. For example, that detail
+// discriminates true from false and integers from floating point numbers.
+//
+// skip is the number of nodes in the sub-tree rooted at this node, including
+// the node itself. It is 1 for everything other than non-empty lists and
+// dicts. If this node is at index i, then its first child (if any) is at index
+// (i + 1) and its next sibling (if any) is at index (i + skip).
+typedef struct {
+  wuffs_base__slice_u8 data;
+  uint32_t repr;
+  uint32_t skip;
+
+#ifdef __cplusplus
+  inline uint32_t kind() const;
+  inline uint32_t detail() const;
+  inline bool converted() const;
+#endif  // __cplusplus
+
+} wuffs_base__tape_node;
+
+#define WUFFS_BASE__TAPE_NODE__KIND__SHIFT 24
+
+#define WUFFS_BASE__TAPE_NODE__KIND__LIST 1
+#define WUFFS_BASE__TAPE_NODE__KIND__DICT 2
+#define WUFFS_BASE__TAPE_NODE__KIND__STRING 3
+#define WUFFS_BASE__TAPE_NODE__KIND__LITERAL 4
+#define WUFFS_BASE__TAPE_NODE__KIND__NUMBER 5
+
+#define WUFFS_BASE__TAPE_NODE__FLAG__CONVERTED 0x800000
+
+static inline uint32_t  //
+wuffs_base__tape_node__kind(const wuffs_base__tape_node* n) {
+  return n->repr >> WUFFS_BASE__TAPE_NODE__KIND__SHIFT;
+}
+
+static inline uint32_t  //
+wuffs_base__tape_node__detail(const wuffs_base__tape_node* n) {
+  return n->repr & 0x1FFFFF;
+}
+
+static inline bool  //
+wuffs_base__tape_node__converted(const wuffs_base__tape_node* n) {
+  return n->repr & WUFFS_BASE__TAPE_NODE__FLAG__CONVERTED;
+}
+
+#ifdef __cplusplus
+
+inline uint32_t  //
+wuffs_base__tape_node::kind() const {
+  return wuffs_base__tape_node__kind(this);
+}
+
+inline uint32_t  //
+wuffs_base__tape_node::detail() const {
+  return wuffs_base__tape_node__detail(this);
+}
+
+inline bool  //
+wuffs_base__tape_node::converted() const {
+  return wuffs_base__tape_node__converted(this);
+}
+
+#endif  // __cplusplus
+
+typedef WUFFS_BASE__SLICE(wuffs_base__tape_node) wuffs_base__slice_tape_node;
+
+static inline wuffs_base__slice_tape_node  //
+wuffs_base__make_slice_tape_node(wuffs_base__tape_node* ptr, size_t len) {
+  wuffs_base__slice_tape_node ret;
+  ret.ptr = ptr;
+  ret.len = len;
+  return ret;
+}
+
+// --------
+
+// wuffs_base__tape_builder converts a token stream into a tape.
+//
+// The entire source (the bytes that the tokens describe) must be in memory,
+// at a fixed address, for the lifetime of the tape, e.g. from reading a whole
+// file or memory-mapping it. The tokenizer should therefore be given a closed
+// wuffs_base__slice_u8__reader over that source, and the builder is given the
+// same source slice. Tokens can be fed to the builder in batches, e.g. after
+// every "$short write" suspension, before compacting the token buffer.
+//
+// The nodes and the arena (for converted strings) are caller-owned memory,
+// which can be replaced (e.g. with larger memory) part way through. Some, but
+// not all, tokenizers can produce converted strings that are longer than
+// their source, such as std/json's QUIRK_REPLACE_INVALID_UNICODE, where one
+// invalid source byte converts to the 3-byte UTF-8 encoding of U+FFFD. An
+// arena that is as long as the source is otherwise sufficient for std/json.
+//
+// The builder does not need any other memory. In particular, it has no fixed
+// maximum depth, as open containers are tracked within the tape itself.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// type requires the WUFFS_CONFIG__MODULE__BASE__TAPE sub-module, not just
+// WUFFS_CONFIG__MODULE__BASE__CORE.
+typedef struct {
+  // Do not access the private_impl's fields directly. There is no API/ABI
+  // compatibility or safety guarantee if you do so.
+  struct {
+    wuffs_base__slice_u8 src;
+    wuffs_base__slice_tape_node nodes;
+    wuffs_base__slice_u8 arena;
+    size_t src_ri;
+    size_t nodes_wi;
+    size_t arena_wi;
+    // open is 1 plus the index of the innermost open container, or 0 if there
+    // is none. Each open container's skip field holds its parent's open value.
+    size_t open;
+    // chain is 1 plus the index of the node whose multi-token chain is in
+    // progress, or 0 if there is none.
+    size_t chain;
+    size_t chain_copy_begin;
+    size_t chain_copy_end;
+    size_t chain_arena_begin;
+    uint32_t chain_state;
+  } private_impl;
+
+#ifdef __cplusplus
+  inline void initialize(wuffs_base__slice_u8 src);
+  inline wuffs_base__status set_nodes(wuffs_base__slice_tape_node nodes);
+  inline wuffs_base__status set_arena(wuffs_base__slice_u8 arena);
+  inline wuffs_base__status append_tokens(wuffs_base__token_buffer* tok);
+  inline bool is_complete() const;
+  inline size_t arena_length() const;
+  inline wuffs_base__slice_tape_node nodes() const;
+#endif  // __cplusplus
+
+} wuffs_base__tape_builder;
+
+// wuffs_base__tape_builder__initialize resets the builder to an empty tape,
+// with no nodes or arena memory.
+WUFFS_BASE__MAYBE_STATIC void  //
+wuffs_base__tape_builder__initialize(wuffs_base__tape_builder* b,
+                                     wuffs_base__slice_u8 src);
+
+// wuffs_base__tape_builder__set_nodes replaces the memory that holds the
+// nodes, copying the nodes built so far. It returns an error if the new
+// memory is too short to hold them.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__set_nodes(wuffs_base__tape_builder* b,
+                                    wuffs_base__slice_tape_node nodes);
+
+// wuffs_base__tape_builder__set_arena replaces the memory that holds
+// converted strings. Completed nodes still point into the previous arena, so
+// the caller must keep that alive for the lifetime of the tape. Only an
+// in-progress string (if any) is copied across. It returns an error if the new
+// memory is too short to hold that string.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__set_arena(wuffs_base__tape_builder* b,
+                                    wuffs_base__slice_u8 arena);
+
+// wuffs_base__tape_builder__append_tokens consumes tok's readable tokens,
+// advancing tok->meta.ri. It returns wuffs_base__error__bad_argument if the
+// tokens are inconsistent (e.g. an unbalanced pop) or longer than the source.
+// It returns wuffs_base__error__unsupported_option for extended tokens or
+// string conversions other than copy, drop, backslash-x and Unicode code
+// points.
+//
+// It returns wuffs_base__error__bad_argument_length_too_short if the nodes or
+// the arena are full. The tokens before that point have been consumed and the
+// builder is in a consistent state: the caller can retry after calling
+// set_nodes (if the number of nodes equals the nodes' length) or set_arena.
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status  //
+wuffs_base__tape_builder__append_tokens(wuffs_base__tape_builder* b,
+                                        wuffs_base__token_buffer* tok);
+
+// wuffs_base__tape_builder__is_complete returns whether the nodes so far hold
+// at least one complete top-level value, and no incomplete one.
+static inline bool  //
+wuffs_base__tape_builder__is_complete(const wuffs_base__tape_builder* b) {
+  return (b->private_impl.nodes_wi > 0) && (b->private_impl.open == 0) &&
+         (b->private_impl.chain == 0);
+}
+
+// wuffs_base__tape_builder__arena_length returns how many bytes of the
+// current arena have been used.
+static inline size_t  //
+wuffs_base__tape_builder__arena_length(const wuffs_base__tape_builder* b) {
+  return b->private_impl.arena_wi;
+}
+
+// wuffs_base__tape_builder__nodes returns the nodes built so far. Until the
+// tape is complete, open containers' skip fields are not yet meaningful.
+static inline wuffs_base__slice_tape_node  //
+wuffs_base__tape_builder__nodes(const wuffs_base__tape_builder* b) {
+  return wuffs_base__make_slice_tape_node(b->private_impl.nodes.ptr,
+                                          b->private_impl.nodes_wi);
+}
+
+#ifdef __cplusplus
+
+inline void  //
+wuffs_base__tape_builder::initialize(wuffs_base__slice_u8 src) {
+  wuffs_base__tape_builder__initialize(this, src);
+}
+
+inline wuffs_base__status  //
+wuffs_base__tape_builder::set_nodes(wuffs_base__slice_tape_node nodes) {
+  return wuffs_base__tape_builder__set_nodes(this, nodes);
+}
+
+inline wuffs_base__status  //
+wuffs_base__tape_builder::set_arena(wuffs_base__slice_u8 arena) {
+  return wuffs_base__tape_builder__set_arena(this, arena);
+}
+
+inline wuffs_base__status  //
+wuffs_base__tape_builder::append_tokens(wuffs_base__token_buffer* tok) {
+  return wuffs_base__tape_builder__append_tokens(this, tok);
+}
+
+inline bool  //
+wuffs_base__tape_builder::is_complete() const {
+  return wuffs_base__tape_builder__is_complete(this);
+}
+
+inline size_t  //
+wuffs_base__tape_builder::arena_length() const {
+  return wuffs_base__tape_builder__arena_length(this);
+}
+
+inline wuffs_base__slice_tape_node  //
+wuffs_base__tape_builder::nodes() const {
+  return wuffs_base__tape_builder__nodes(this);
+}
+
+#endif  // __cplusplus
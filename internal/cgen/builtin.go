@@ -191,7 +191,7 @@ func (g *gen) writeBuiltinIOReader(b *buffer, recv *a.Expr, method t.ID, args []
 		return nil
 
 	case t.IDSince:
-		b.printf("wuffs_base__io__since(")
+		b.printf("wuffs_base__io_reader__since(")
 		if err := g.writeExpr(b, args[0].AsArg().Value(), depth); err != nil {
 			return err
 		}
@@ -241,10 +241,16 @@ func (g *gen) writeBuiltinIOWriter(b *buffer, recv *a.Expr, method t.ID, args []
 	}
 
 	switch method {
-	case t.IDCopyN32FromHistory, t.IDCopyN32FromHistoryFast:
+	case t.IDCopyN32FromHistory, t.IDCopyN32FromHistoryFast,
+		t.IDCopyN32FromHistory8ByteChunksFast, t.IDCopyN32FromHistory8ByteChunksDistance1Fast:
 		suffix := ""
-		if method == t.IDCopyN32FromHistoryFast {
+		switch method {
+		case t.IDCopyN32FromHistoryFast:
 			suffix = "_fast"
+		case t.IDCopyN32FromHistory8ByteChunksFast:
+			suffix = "_8_byte_chunks_fast"
+		case t.IDCopyN32FromHistory8ByteChunksDistance1Fast:
+			suffix = "_8_byte_chunks_distance_1_fast"
 		}
 		b.printf("wuffs_base__io_writer__copy_n32_from_history%s(&%s%s, %s%s, %s%s",
 			suffix, iopPrefix, name, io0Prefix, name, io2Prefix, name)
@@ -257,14 +263,18 @@ func (g *gen) writeBuiltinIOWriter(b *buffer, recv *a.Expr, method t.ID, args []
 		b.writeb(')')
 		return nil
 
-	case t.IDCopyN32FromReader:
+	case t.IDCopyN32FromReader, t.IDCopyN32FromReader16ByteChunksFast:
 		readerName, err := g.ioRecvName(args[1].AsArg().Value())
 		if err != nil {
 			return err
 		}
 
-		b.printf("wuffs_base__io_writer__copy_n32_from_reader(&%s%s, %s%s,",
-			iopPrefix, name, io2Prefix, name)
+		suffix := ""
+		if method == t.IDCopyN32FromReader16ByteChunksFast {
+			suffix = "_16_byte_chunks_fast"
+		}
+		b.printf("wuffs_base__io_writer__copy_n32_from_reader%s(&%s%s, %s%s,",
+			suffix, iopPrefix, name, io2Prefix, name)
 		if err := g.writeExpr(b, args[0].AsArg().Value(), depth); err != nil {
 			return err
 		}
@@ -476,9 +486,13 @@ func (g *gen) writeBuiltinSlice(b *buffer, recv *a.Expr, method t.ID, args []*a.
 		b.writes(".len))")
 		return nil
 
-	case t.IDSuffix:
+	case t.IDPrefix, t.IDSuffix:
 		// TODO: don't assume that the slice is a slice of base.u8.
-		b.writes("wuffs_base__slice_u8__suffix(")
+		if method == t.IDPrefix {
+			b.writes("wuffs_base__slice_u8__prefix(")
+		} else {
+			b.writes("wuffs_base__slice_u8__suffix(")
+		}
 		if err := g.writeExpr(b, recv, depth); err != nil {
 			return err
 		}
@@ -620,35 +634,47 @@ func (g *gen) writeBuiltinQuestionCall(b *buffer, n *a.Expr, depth uint32) error
 	case t.IDIOReader:
 		switch method.Ident() {
 		case t.IDReadU8, t.IDReadU8AsU32, t.IDReadU8AsU64:
-			if err := g.writeCoroSuspPoint(b, false); err != nil {
-				return err
-			}
 			if g.currFunk.tempW > maxTemp {
 				return fmt.Errorf("too many temporary variables required")
 			}
 			temp := g.currFunk.tempW
 			g.currFunk.tempW++
 
-			b.printf("if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {" +
-				"status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }")
-
 			// TODO: watch for passing an array type to writeCTypeName? In C, an
 			// array type can decay into a pointer.
 			if err := g.writeCTypeName(b, n.MType(), tPrefix, fmt.Sprint(temp)); err != nil {
 				return err
 			}
-			b.printf(" = *iop_a_src++;\n")
+			b.writes(";")
+
+			// The coroutine suspension point is only on the slow path, so that
+			// the common case (the source has a byte available) does not touch
+			// coro_susp_point.
+			b.writes("if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {")
+			b.printf("%s%d = *iop_a_src++;\n", tPrefix, temp)
+			b.writes("} else {")
+			if err := g.writeCoroSuspPoint(b, false); err != nil {
+				return err
+			}
+			b.printf("if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {" +
+				"status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }")
+			b.printf("%s%d = *iop_a_src++;\n", tPrefix, temp)
+			b.writes("}\n")
 			return nil
 
 		case t.IDSkip, t.IDSkip32:
 			x := n.Args()[0].AsArg().Value()
 			if cv := x.ConstValue(); cv != nil && cv.Cmp(one) == 0 {
+				b.writes("if (WUFFS_BASE__LIKELY(iop_a_src < io2_a_src)) {")
+				b.writes("iop_a_src++;\n")
+				b.writes("} else {")
 				if err := g.writeCoroSuspPoint(b, false); err != nil {
 					return err
 				}
 				b.printf("if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {" +
 					"status = wuffs_base__make_status(wuffs_base__suspension__short_read); goto suspend; }")
 				b.printf("iop_a_src++;\n")
+				b.writes("}\n")
 				return nil
 			}
 
@@ -695,8 +721,18 @@ func (g *gen) writeBuiltinQuestionCall(b *buffer, n *a.Expr, depth uint32) error
 			scratchName := fmt.Sprintf("self->private_data.%s%s[0].scratch",
 				sPrefix, g.currFunk.astFunc.FuncName().Str(g.tm))
 
-			b.printf("%s = ", scratchName)
+			// Only spill the argument to scratch on the slow path, when the
+			// destination is full and we might suspend.
 			x := n.Args()[0].AsArg().Value()
+			b.writes("if (WUFFS_BASE__LIKELY(iop_a_dst < io2_a_dst)) {")
+			b.writes("*iop_a_dst++ = ")
+			if err := g.writeExpr(b, x, depth); err != nil {
+				return err
+			}
+			b.writes(";\n")
+			b.writes("} else {")
+
+			b.printf("%s = ", scratchName)
 			if err := g.writeExpr(b, x, depth); err != nil {
 				return err
 			}
@@ -708,6 +744,7 @@ func (g *gen) writeBuiltinQuestionCall(b *buffer, n *a.Expr, depth uint32) error
 			b.printf("if (iop_a_dst == io2_a_dst) {\n"+
 				"status = wuffs_base__make_status(wuffs_base__suspension__short_write); goto suspend; }\n"+
 				"*iop_a_dst++ = ((uint8_t)(%s));\n", scratchName)
+			b.writes("}\n")
 			return nil
 		}
 
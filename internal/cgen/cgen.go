@@ -79,15 +79,16 @@ const (
 //
 // At the start of a function, these pointers are initialized from an
 // io_buffer's fields (ptr, ri, wi, len). For an io_reader:
-//  - io0_etc = ptr
-//  - io1_etc = ptr + ri
-//  - iop_etc = ptr + ri
-//  - io2_etc = ptr + wi
+//   - io0_etc = ptr
+//   - io1_etc = ptr + ri
+//   - iop_etc = ptr + ri
+//   - io2_etc = ptr + wi
+//
 // and for an io_writer:
-//  - io0_etc = ptr
-//  - io1_etc = ptr + wi
-//  - iop_etc = ptr + wi
-//  - io2_etc = ptr + len
+//   - io0_etc = ptr
+//   - io1_etc = ptr + wi
+//   - iop_etc = ptr + wi
+//   - io2_etc = ptr + len
 const (
 	io0Prefix = "io0_" // Base.
 	io1Prefix = "io1_" // Lower bound.
@@ -102,6 +103,7 @@ var BaseSubModules = []string{
 	"f64conv",
 	"interfaces",
 	"pixconv",
+	"tape",
 }
 
 // Do transpiles a Wuffs program to a C program.
@@ -131,10 +133,12 @@ func Do(args []string) error {
 				"// !! INSERT InterfaceDefinitions.\n":     insertInterfaceDefinitions,
 				"// !! INSERT base/all-private.h.\n":       insertBaseAllPrivateH,
 				"// !! INSERT base/all-public.h.\n":        insertBaseAllPublicH,
+				"// !! INSERT base/aux-public.h.\n":        insertBaseAuxPublicH,
 				"// !! INSERT base/copyright\n":            insertBaseCopyright,
 				"// !! INSERT base/f64conv-submodule.c.\n": insertBaseF64ConvSubmoduleC,
 				"// !! INSERT base/pixconv-submodule.c.\n": insertBasePixConvSubmoduleC,
 				"// !! INSERT base/strconv-impl.c.\n":      insertBaseStrConvImplC,
+				"// !! INSERT base/tape-submodule.c.\n":    insertBaseTapeSubmoduleC,
 				"// !! INSERT vtable names.\n": func(b *buffer) error {
 					for _, n := range builtin.Interfaces {
 						buf.printf("const char* wuffs_base__%s__vtable_name = "+
@@ -275,6 +279,8 @@ func expandBangBangInsert(b *buffer, s string, m map[string]func(*buffer) error)
 func insertBaseAllPrivateH(buf *buffer) error {
 	buf.writes(baseFundamentalPrivateH)
 	buf.writeb('\n')
+	buf.writes(baseCPUArchPrivateH)
+	buf.writeb('\n')
 	buf.writes(baseRangePrivateH)
 	buf.writeb('\n')
 	buf.writes(baseIOPrivateH)
@@ -341,6 +347,12 @@ func insertBaseAllPublicH(buf *buffer) error {
 	return nil
 }
 
+func insertBaseAuxPublicH(buf *buffer) error {
+	buf.writes(baseAuxPublicH)
+	buf.writeb('\n')
+	return nil
+}
+
 func insertBaseCopyright(buf *buffer) error {
 	buf.writes(baseCopyright)
 	buf.writeb('\n')
@@ -365,6 +377,12 @@ func insertBaseStrConvImplC(buf *buffer) error {
 	return nil
 }
 
+func insertBaseTapeSubmoduleC(buf *buffer) error {
+	buf.writes(baseTapeSubmoduleC)
+	buf.writeb('\n')
+	return nil
+}
+
 func insertInterfaceDeclarations(buf *buffer) error {
 	if err := parseBuiltInInterfaceMethods(); err != nil {
 		return err
@@ -539,7 +557,10 @@ type gen struct {
 	genlinenum bool
 
 	privateDataFields map[t.QQID]struct{}
+	quirkNames        []string // e.g. "ALLOW_COMMENT_BLOCK", indexed by (QUIRK_ETC - QUIRKS_BASE).
 	scalarConstsMap   map[t.QID]*a.Const
+	statsFuncs        map[t.QID][]*a.Func // Indexed by struct, e.g. "decoder".
+	statsIndexes      map[t.QQID]int      // Indexed by func, e.g. "decoder.decode_blocks".
 	statusList        []status
 	statusMap         map[t.QID]status
 	structList        []*a.Struct
@@ -576,6 +597,9 @@ func (g *gen) generate() ([]byte, error) {
 	if err := g.forEachConst(b, bothPubPri, (*gen).gatherScalarConsts); err != nil {
 		return nil, err
 	}
+	if err := g.gatherQuirks(); err != nil {
+		return nil, err
+	}
 
 	// Make a topologically sorted list of structs.
 	unsortedStructs := []*a.Struct(nil)
@@ -605,6 +629,12 @@ func (g *gen) generate() ([]byte, error) {
 		}
 	}
 
+	g.statsFuncs = map[t.QID][]*a.Func{}
+	g.statsIndexes = map[t.QQID]int{}
+	if err := g.forEachFunc(nil, bothPubPri, (*gen).gatherStats); err != nil {
+		return nil, err
+	}
+
 	g.funks = map[t.QQID]funk{}
 	if err := g.forEachFunc(nil, bothPubPri, (*gen).gatherFuncImpl); err != nil {
 		return nil, err
@@ -756,6 +786,17 @@ func (g *gen) genHeader(b *buffer) error {
 		}
 	}
 
+	if len(g.statsFuncs) > 0 {
+		b.writes("// ---------------- Stats\n\n")
+		b.writes("#if defined(WUFFS_CONFIG__ENABLE_STATS)\n\n")
+		for _, n := range g.structList {
+			if err := g.writeStatsDecls(b, n); err != nil {
+				return err
+			}
+		}
+		b.writes("#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)\n\n")
+	}
+
 	b.writes("// ---------------- Public Function Prototypes\n\n")
 	if err := g.forEachFunc(b, pubOnly, (*gen).writeFuncPrototype); err != nil {
 		return err
@@ -798,6 +839,13 @@ func (g *gen) genImpl(b *buffer) error {
 		return err
 	}
 
+	if len(g.quirkNames) > 0 {
+		b.writes("// ---------------- Quirks\n\n")
+		if err := g.writeQuirks(b); err != nil {
+			return err
+		}
+	}
+
 	b.writes("// ---------------- Private Initializer Prototypes\n\n")
 	for _, n := range g.structList {
 		if !n.Public() {
@@ -967,6 +1015,170 @@ func (g *gen) gatherScalarConsts(b *buffer, n *a.Const) error {
 	return nil
 }
 
+// gatherQuirks finds the package's "pub const QUIRK_ETC" values. By
+// convention, they are all at least QUIRKS_BASE and are stored, after
+// subtracting QUIRKS_BASE, in a "quirks : array[QUIRKS_COUNT] base.bool" field.
+func (g *gen) gatherQuirks() error {
+	base, ok := g.scalarConstsMap[t.QID{0, g.tm.ByName("QUIRKS_BASE")}]
+	if !ok {
+		return nil
+	}
+	baseValue := base.Value().ConstValue()
+
+	names := map[uint64]string{}
+	for qid, n := range g.scalarConstsMap {
+		name := qid[1].Str(g.tm)
+		if (qid[0] != 0) || !n.Public() || !strings.HasPrefix(name, "QUIRK_") {
+			continue
+		}
+		i := big.NewInt(0).Sub(n.Value().ConstValue(), baseValue)
+		if (i.Sign() < 0) || !i.IsUint64() || (i.Uint64() >= 256) {
+			return fmt.Errorf("quirk %s is out of range of QUIRKS_BASE", name)
+		}
+		names[i.Uint64()] = name[len("QUIRK_"):]
+	}
+
+	g.quirkNames = make([]string, len(names))
+	for i, name := range names {
+		if i >= uint64(len(names)) {
+			return fmt.Errorf("quirk %s is not contiguous", name)
+		}
+		g.quirkNames[i] = name
+	}
+	return nil
+}
+
+// writeQuirks writes the QUIRKS_ALLOWED table and the QUIRK_ENABLED macro.
+//
+// With WUFFS_CONFIG__QUIRKS__ENABLE_ALLOWLIST defined, a quirk is compiled out
+// (always disabled) unless its WUFFS_CONFIG__QUIRKS__ALLOW__PKG__NAME macro is
+// also defined. The compiler can then eliminate the code that only runs when
+// that quirk is enabled.
+func (g *gen) writeQuirks(b *buffer) error {
+	b.writes("#if defined(WUFFS_CONFIG__QUIRKS__ENABLE_ALLOWLIST)\n")
+	b.printf("static const bool //\n%sQUIRKS_ALLOWED[%d] //\n"+
+		"WUFFS_BASE__POTENTIALLY_UNUSED = {\n", g.PKGPREFIX, len(g.quirkNames))
+	for _, name := range g.quirkNames {
+		b.printf("#if defined(WUFFS_CONFIG__QUIRKS__ALLOW__%s__%s)\n", g.PKGNAME, name)
+		b.writes("true,\n#else\nfalse,\n#endif\n")
+	}
+	b.writes("};\n\n")
+	b.printf("#define %sQUIRK_ENABLED(self, q) \\\n"+
+		"  (%sQUIRKS_ALLOWED[q] && (self)->private_impl.%squirks[q])\n",
+		g.PKGPREFIX, g.PKGPREFIX, fPrefix)
+	b.writes("#else\n")
+	b.printf("#define %sQUIRK_ENABLED(self, q) ((self)->private_impl.%squirks[q])\n",
+		g.PKGPREFIX, fPrefix)
+	b.writes("#endif  // defined(WUFFS_CONFIG__QUIRKS__ENABLE_ALLOWLIST)\n\n")
+	return nil
+}
+
+// gatherStats assigns an index, into a wuffs_foo__bar__stats struct's funcs
+// array, to every method (other than pure ones, whose receiver is const) of
+// every public, classy struct.
+func (g *gen) gatherStats(b *buffer, n *a.Func) error {
+	recv := n.Receiver()
+	if recv.IsZero() || n.Effect().Pure() {
+		return nil
+	}
+	if s := g.structMap[recv]; (s == nil) || !s.Public() || !s.Classy() {
+		return nil
+	}
+	g.statsIndexes[n.QQID()] = len(g.statsFuncs[recv])
+	g.statsFuncs[recv] = append(g.statsFuncs[recv], n)
+	return nil
+}
+
+func (g *gen) hasStats(n *a.Struct) bool {
+	return len(g.statsFuncs[n.QID()]) > 0
+}
+
+type statsSubStruct struct {
+	cType     string // e.g. "wuffs_deflate__decoder".
+	fieldName string // e.g. "flate".
+	privData  bool   // Whether the field is in private_data or private_impl.
+}
+
+// statsSubStructs returns n's fields that are themselves structs with stats,
+// such as a gzip decoder's deflate decoder. It assumes that every struct from
+// another package (which must be public) has stats.
+func (g *gen) statsSubStructs(n *a.Struct) (ret []statsSubStruct) {
+	for _, f := range n.Fields() {
+		f := f.AsField()
+		x := f.XType()
+		if x != x.Innermost() {
+			continue
+		}
+		qid := x.QID()
+		cType := ""
+		if qid[0] == t.IDBase {
+			continue
+		} else if qid[0] != 0 {
+			cType = "wuffs_" + qid[0].Str(g.tm) + "__" + qid[1].Str(g.tm)
+		} else if s := g.structMap[qid]; (s != nil) && g.hasStats(s) {
+			cType = g.pkgPrefix + qid[1].Str(g.tm)
+		} else {
+			continue
+		}
+		_, privData := g.privateDataFields[t.QQID{n.QID()[0], n.QID()[1], f.Name()}]
+		ret = append(ret, statsSubStruct{cType, f.Name().Str(g.tm), privData})
+	}
+	return ret
+}
+
+// writeStatsDecls writes the wuffs_foo__bar__stats type, the indexes into its
+// funcs array and the wuffs_foo__bar__get_stats prototype.
+func (g *gen) writeStatsDecls(b *buffer, n *a.Struct) error {
+	if !g.hasStats(n) {
+		return nil
+	}
+	structName := n.QID().Str(g.tm)
+	fs := g.statsFuncs[n.QID()]
+	for i, f := range fs {
+		b.printf("#define %s%s__STATS__FUNC__%s %d\n", g.PKGPREFIX,
+			strings.ToUpper(structName), strings.ToUpper(f.FuncName().Str(g.tm)), i)
+	}
+	b.writes("\n")
+
+	b.printf("typedef struct %s%s__stats__struct {\n", g.pkgPrefix, structName)
+	b.writes("// num_suspensions counts the public coroutine calls that returned a\n")
+	b.writes("// suspension status, e.g. \"$short read\".\n")
+	b.writes("uint64_t num_suspensions;\n")
+	b.printf("wuffs_base__func_stats funcs[%d];\n", len(fs))
+	if subs := g.statsSubStructs(n); len(subs) > 0 {
+		b.writes("\n// The sub-structs' stats are filled in by the get_stats function.\n")
+		for _, sub := range subs {
+			b.printf("%s__stats %s;\n", sub.cType, sub.fieldName)
+		}
+	}
+	b.printf("} %s%s__stats;\n\n", g.pkgPrefix, structName)
+
+	b.printf("WUFFS_BASE__MAYBE_STATIC %s%s__stats  //\n", g.pkgPrefix, structName)
+	b.printf("%s%s__get_stats(const %s%s* self);\n\n", g.pkgPrefix, structName, g.pkgPrefix, structName)
+	return nil
+}
+
+func (g *gen) writeStatsImpl(b *buffer, n *a.Struct) error {
+	structName := n.QID().Str(g.tm)
+	b.writes("#if defined(WUFFS_CONFIG__ENABLE_STATS)\n")
+	b.printf("WUFFS_BASE__MAYBE_STATIC %s%s__stats  //\n", g.pkgPrefix, structName)
+	b.printf("%s%s__get_stats(const %s%s* self) {\n", g.pkgPrefix, structName, g.pkgPrefix, structName)
+	b.printf("%s%s__stats ret;\n", g.pkgPrefix, structName)
+	b.writes("if (!self) {\nmemset(&ret, 0, sizeof(ret));\nreturn ret;\n}\n")
+	b.writes("ret = self->private_impl.stats;\n")
+	for _, sub := range g.statsSubStructs(n) {
+		priv := "private_impl"
+		if sub.privData {
+			priv = "private_data"
+		}
+		b.printf("ret.%s = %s__get_stats(&self->%s.%s%s);\n",
+			sub.fieldName, sub.cType, priv, fPrefix, sub.fieldName)
+	}
+	b.writes("return ret;\n}\n")
+	b.writes("#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)\n\n")
+	return nil
+}
+
 func (g *gen) writeConst(b *buffer, n *a.Const) error {
 	if cv := n.Value().ConstValue(); cv != nil {
 		b.printf("#define %s%s %v\n\n", g.PKGPREFIX, n.QID()[1].Str(g.tm), cv)
@@ -1058,6 +1270,11 @@ func (g *gen) writeStructPrivateImpl(b *buffer, n *a.Struct) error {
 		}
 
 	}
+	if g.hasStats(n) {
+		b.writes("\n#if defined(WUFFS_CONFIG__ENABLE_STATS)\n")
+		b.printf("%s%s__stats stats;\n", g.pkgPrefix, n.QID().Str(g.tm))
+		b.writes("#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)\n")
+	}
 	b.writes("} private_impl;\n\n")
 
 	{
@@ -1234,6 +1451,13 @@ func (g *gen) writeCppMethods(b *buffer, n *a.Struct) error {
 		}
 	}
 
+	if g.hasStats(n) {
+		b.writes("#if defined(WUFFS_CONFIG__ENABLE_STATS)\n")
+		b.printf("inline %s%s__stats  //\n", g.pkgPrefix, structName)
+		b.printf("get_stats() const {\nreturn %s%s__get_stats(this);\n}\n", g.pkgPrefix, structName)
+		b.writes("#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)\n\n")
+	}
+
 	b.writes("#endif  // __cplusplus\n\n")
 	return nil
 }
@@ -1419,5 +1643,11 @@ func (g *gen) writeInitializerImpl(b *buffer, n *a.Struct) error {
 		}
 		b.printf("{ return sizeof(%s%s); }\n\n", g.pkgPrefix, structName)
 	}
+
+	if g.hasStats(n) {
+		if err := g.writeStatsImpl(b, n); err != nil {
+			return err
+		}
+	}
 	return nil
 }
@@ -19,12 +19,15 @@ package cgen
 const baseAllImplC = "" +
 	"#ifndef WUFFS_INCLUDE_GUARD__BASE\n#define WUFFS_INCLUDE_GUARD__BASE\n\n#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)\n#define WUFFS_CONFIG__MODULES\n#define WUFFS_CONFIG__MODULE__BASE\n#endif\n\n// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.\n\n// !! INSERT base/copyright\n\n#include <stdbool.h>\n#include <stdint.h>\n#include <stdlib.h>\n#include <string.h>\n\n#ifdef __cplusplus\n#if __cplusplus >= 201103L\n#include <memory>\n#else\n#warning \"Wuffs' C++ code requires -std=c++11 or later\"\n#endif\n\nextern \"C\" {\n#endif\n\n// !! INSERT base/all-public.h.\n\n// !! INSERT InterfaceDeclarations.\n\n" +
 	"" +
-	"// ----------------\n\n#ifdef __cplusplus\n}  // extern \"C\"\n#endif\n\n// WUFFS C HEADER ENDS HERE.\n#ifdef WUFFS_IMPLEMENTATION\n\n#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n// !! INSERT base/all-private.h.\n\n" +
+	"// ----------------\n\n#ifdef __cplusplus\n}  // extern \"C\"\n#endif\n\n#if defined(__cplusplus) && (__cplusplus >= 201103L)\n\n// !! INSERT base/aux-public.h.\n\n#endif  // defined(__cplusplus) && (__cplusplus >= 201103L)\n\n// WUFFS C HEADER ENDS HERE.\n#ifdef WUFFS_IMPLEMENTATION\n\n" +
+	"" +
+	"// ---------------- CPU Architecture\n\n// WUFFS_BASE__CPU_ARCH__ETC is defined when the compiler can emit (and the\n// code below can call) CPU-specific instructions, such as SIMD intrinsics.\n// Whether the CPU that the program actually runs on supports them is checked\n// at run time, via wuffs_base__cpu_arch__have_etc functions. Every such fast\n// path has a portable fallback that produces identical output.\n//\n// Define WUFFS_CONFIG__AVOID_CPU_ARCH to only use the portable code, e.g. to\n// measure the difference when benchmarking.\n//\n// Clang also defines \"__GNUC__\".\n#if !defined(WUFFS_CONFIG__AVOID_CPU_ARCH)\n#if defined(__GNUC__) && defined(__x86_64__)\n#define WUFFS_BASE__CPU_ARCH__X86_64\n#include <cpuid.h>\n#include <immintrin.h>\n#endif\n#endif  // !defined(WUFFS_CONFIG__AVOID_CPU_ARCH)\n\n#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n// !! INSERT base/all-private.h.\n\n" +
 	"" +
 	"// ----------------\n\n#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \\\n    defined(WUFFS_CONFIG__MODULE__BASE__CORE)\n\nconst uint8_t wuffs_base__low_bits_mask__u8[9] = {\n    0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF,\n};\n\nconst uint16_t wuffs_base__low_bits_mask__u16[17] = {\n    0x0000, 0x0001, 0x0003, 0x0007, 0x000F, 0x001F, 0x003F, 0x007F, 0x00FF,\n    0x01FF, 0x03FF, 0x07FF, 0x0FFF, 0x1FFF, 0x3FFF, 0x7FFF, 0xFFFF,\n};\n\nconst uint32_t wuffs_base__low_bits_mask__u32[33] = {\n    0x00000000, 0x00000001, 0x00000003, 0x00000007, 0x0000000F, 0x0000001F,\n    0x0000003F, 0x0000007F, 0x000000FF, 0x000001FF, 0x000003FF, 0x000007FF,\n    0x00000FFF, 0x00001FFF, 0x00003FFF, 0x00007FFF, 0x0000FFFF, 0x0001FFFF,\n    0x0003FFFF, 0x0007FFFF, 0x000FFFFF, 0x001FFFFF, 0x003FFFFF, 0x007FFFFF,\n    0x00FFFFFF, 0x01FFFFFF, 0x03FFFFFF, 0x07FFFFFF, 0x0FFFFFFF, 0x1FFFFFFF,\n    0x3FFFFFFF, 0x7FFFFFFF, 0xFFFFFFFF,\n};\n\nconst uint64_t wuffs_base__low_bits_mask__u64[65] = {\n    0x0000000000000000, 0x000" +
 	"0000000000001, 0x0000000000000003,\n    0x0000000000000007, 0x000000000000000F, 0x000000000000001F,\n    0x000000000000003F, 0x000000000000007F, 0x00000000000000FF,\n    0x00000000000001FF, 0x00000000000003FF, 0x00000000000007FF,\n    0x0000000000000FFF, 0x0000000000001FFF, 0x0000000000003FFF,\n    0x0000000000007FFF, 0x000000000000FFFF, 0x000000000001FFFF,\n    0x000000000003FFFF, 0x000000000007FFFF, 0x00000000000FFFFF,\n    0x00000000001FFFFF, 0x00000000003FFFFF, 0x00000000007FFFFF,\n    0x0000000000FFFFFF, 0x0000000001FFFFFF, 0x0000000003FFFFFF,\n    0x0000000007FFFFFF, 0x000000000FFFFFFF, 0x000000001FFFFFFF,\n    0x000000003FFFFFFF, 0x000000007FFFFFFF, 0x00000000FFFFFFFF,\n    0x00000001FFFFFFFF, 0x00000003FFFFFFFF, 0x00000007FFFFFFFF,\n    0x0000000FFFFFFFFF, 0x0000001FFFFFFFFF, 0x0000003FFFFFFFFF,\n    0x0000007FFFFFFFFF, 0x000000FFFFFFFFFF, 0x000001FFFFFFFFFF,\n    0x000003FFFFFFFFFF, 0x000007FFFFFFFFFF, 0x00000FFFFFFFFFFF,\n    0x00001FFFFFFFFFFF, 0x00003FFFFFFFFFFF, 0x00007FFFFFFFFFFF,\n    0x0000FFFFFFFFFFFF, 0x000" +
 	"1FFFFFFFFFFFF, 0x0003FFFFFFFFFFFF,\n    0x0007FFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x001FFFFFFFFFFFFF,\n    0x003FFFFFFFFFFFFF, 0x007FFFFFFFFFFFFF, 0x00FFFFFFFFFFFFFF,\n    0x01FFFFFFFFFFFFFF, 0x03FFFFFFFFFFFFFF, 0x07FFFFFFFFFFFFFF,\n    0x0FFFFFFFFFFFFFFF, 0x1FFFFFFFFFFFFFFF, 0x3FFFFFFFFFFFFFFF,\n    0x7FFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,\n};\n\nconst uint32_t wuffs_base__pixel_format__bits_per_channel[16] = {\n    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,\n    0x08, 0x0A, 0x0C, 0x10, 0x18, 0x20, 0x30, 0x40,\n};\n\n// !! INSERT wuffs_base__status strings.\n\n// !! INSERT vtable names.\n\n// !! INSERT base/strconv-impl.c.\n\n#endif  // !defined(WUFFS_CONFIG__MODULES) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE)  ||\n        // defined(WUFFS_CONFIG__MODULE__BASE__CORE)\n\n#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \\\n    defined(WUFFS_CONFIG__MODULE__BASE__INTERFACES)\n\n// !! INSERT InterfaceDefinitions.\n\n#endif  // !defined(WUFFS_CONFIG__MODULES) ||\n        // defined(WUFFS_CONFIG__MODULE_" +
-	"_BASE) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE__INTERFACES)\n\n#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \\\n    defined(WUFFS_CONFIG__MODULE__BASE__F64CONV)\n\n// !! INSERT base/f64conv-submodule.c.\n\n#endif  // !defined(WUFFS_CONFIG__MODULES) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE__F64CONV)\n\n#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \\\n    defined(WUFFS_CONFIG__MODULE__BASE__PIXCONV)\n\n// !! INSERT base/pixconv-submodule.c.\n\n#endif  // !defined(WUFFS_CONFIG__MODULES) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE__PIXCONV)\n\n#ifdef __cplusplus\n}  // extern \"C\"\n#endif\n\n#endif  // WUFFS_IMPLEMENTATION\n\n// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.\n\n#endif  // WUFFS_INCLUDE_GUARD__BASE\n" +
+	"_BASE) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE__INTERFACES)\n\n#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \\\n    defined(WUFFS_CONFIG__MODULE__BASE__F64CONV)\n\n// !! INSERT base/f64conv-submodule.c.\n\n#endif  // !defined(WUFFS_CONFIG__MODULES) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE__F64CONV)\n\n#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \\\n    defined(WUFFS_CONFIG__MODULE__BASE__PIXCONV)\n\n// !! INSERT base/pixconv-submodule.c.\n\n#endif  // !defined(WUFFS_CONFIG__MODULES) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE__PIXCONV)\n\n#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__BASE) || \\\n    defined(WUFFS_CONFIG__MODULE__BASE__TAPE)\n\n// !! INSERT base/tape-submodule.c.\n\n#endif  // !defined(WUFFS_CONFIG__MODULES) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE) ||\n        // defined(WUFFS_CONFIG__MODULE__BASE__T" +
+	"APE)\n\n#ifdef __cplusplus\n}  // extern \"C\"\n#endif\n\n#endif  // WUFFS_IMPLEMENTATION\n\n// !! WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.\n\n#endif  // WUFFS_INCLUDE_GUARD__BASE\n" +
 	""
 
 const baseStrConvImplC = "" +
@@ -41,6 +44,11 @@ const baseStrConvImplC = "" +
 	"} while (0);\n\nhexadecimal:\n  do {\n    uint64_t v = wuffs_base__parse_number__hexadecimal_digits[*p++];\n    if (v == 0) {\n      goto fail_bad_argument;\n    }\n    v &= 0x0F;\n\n    for (; p < q; p++) {\n      if (*p == '_') {\n        continue;\n      }\n      uint8_t digit = wuffs_base__parse_number__hexadecimal_digits[*p];\n      if (digit == 0) {\n        goto fail_bad_argument;\n      }\n      digit &= 0x0F;\n      if ((v >> 60) != 0) {\n        goto fail_out_of_bounds;\n      }\n      v = (v << 4) | ((uint64_t)(digit));\n    }\n\n    wuffs_base__result_u64 ret;\n    ret.status.repr = NULL;\n    ret.value = v;\n    return ret;\n  } while (0);\n\nok_zero:\n  do {\n    wuffs_base__result_u64 ret;\n    ret.status.repr = NULL;\n    ret.value = 0;\n    return ret;\n  } while (0);\n\nfail_bad_argument:\n  do {\n    wuffs_base__result_u64 ret;\n    ret.status.repr = wuffs_base__error__bad_argument;\n    ret.value = 0;\n    return ret;\n  } while (0);\n\nfail_out_of_bounds:\n  do {\n    wuffs_base__result_u64 ret;\n    ret.status.repr = wuffs_base__error__" +
 	"out_of_bounds;\n    ret.value = 0;\n    return ret;\n  } while (0);\n}\n\n" +
 	"" +
+	"// --------\n\n// wuffs_base__render_number__two_digits holds \"00\", \"01\", ..., \"99\".\nstatic const char wuffs_base__render_number__two_digits[200] = {\n    '0', '0', '0', '1', '0', '2', '0', '3', '0', '4',  //\n    '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',  //\n    '1', '0', '1', '1', '1', '2', '1', '3', '1', '4',  //\n    '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',  //\n    '2', '0', '2', '1', '2', '2', '2', '3', '2', '4',  //\n    '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',  //\n    '3', '0', '3', '1', '3', '2', '3', '3', '3', '4',  //\n    '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',  //\n    '4', '0', '4', '1', '4', '2', '4', '3', '4', '4',  //\n    '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',  //\n    '5', '0', '5', '1', '5', '2', '5', '3', '5', '4',  //\n    '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',  //\n    '6', '0', '6', '1', '6', '2', '6', '3', '6', '4',  //\n    '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',  //\n    '7', '0', '7', '1', '7', '2', '7', '3', '7', '4',  //\n    '7" +
+	"', '5', '7', '6', '7', '7', '7', '8', '7', '9',  //\n    '8', '0', '8', '1', '8', '2', '8', '3', '8', '4',  //\n    '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',  //\n    '9', '0', '9', '1', '9', '2', '9', '3', '9', '4',  //\n    '9', '5', '9', '6', '9', '7', '9', '8', '9', '9',  //\n};\n\n// wuffs_base__private_implementation__render_number_u64 writes x's decimal\n// digits, with an optional leading sign, to dst. It works backwards, from the\n// least significant digit, using a stack-allocated buffer.\nstatic size_t  //\nwuffs_base__private_implementation__render_number_u64(wuffs_base__slice_u8 dst,\n                                                      uint64_t x,\n                                                      uint8_t sign) {\n  uint8_t buf[WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL];\n  uint8_t* const end = buf + WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL;\n  uint8_t* p = end;\n\n  while (x >= 100) {\n    const char* q = &wuffs_base__render_number__two_digits[2 * (x % 100)];\n    x /= 100;\n    p -= 2;\n    p[0] = (uint8_t)" +
+	"(q[0]);\n    p[1] = (uint8_t)(q[1]);\n  }\n  if (x >= 10) {\n    const char* q = &wuffs_base__render_number__two_digits[2 * x];\n    p -= 2;\n    p[0] = (uint8_t)(q[0]);\n    p[1] = (uint8_t)(q[1]);\n  } else {\n    *--p = (uint8_t)('0' + x);\n  }\n  if (sign) {\n    *--p = sign;\n  }\n\n  size_t n = (size_t)(end - p);\n  if (n > dst.len) {\n    return 0;\n  }\n  memcpy(dst.ptr, p, n);\n  return n;\n}\n\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__render_number_i64(wuffs_base__slice_u8 dst,\n                              int64_t x,\n                              uint32_t options) {\n  // Negating in uint64_t arithmetic avoids undefined behavior when x is\n  // INT64_MIN.\n  if (x < 0) {\n    return wuffs_base__private_implementation__render_number_u64(\n        dst, 1 + ~((uint64_t)(x)), '-');\n  }\n  return wuffs_base__private_implementation__render_number_u64(\n      dst, (uint64_t)(x),\n      (options & WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN) ? '+' : 0);\n}\n\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__render_number_u64(wuf" +
+	"fs_base__slice_u8 dst,\n                              uint64_t x,\n                              uint32_t options) {\n  return wuffs_base__private_implementation__render_number_u64(\n      dst, x,\n      (options & WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN) ? '+' : 0);\n}\n\n" +
+	"" +
 	"// ---------------- Hexadecimal\n\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__hexadecimal__decode2(wuffs_base__slice_u8 dst,\n                                 wuffs_base__slice_u8 src) {\n  size_t src_len2 = src.len / 2;\n  size_t len = dst.len < src_len2 ? dst.len : src_len2;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n--) {\n    *d = (uint8_t)((wuffs_base__parse_number__hexadecimal_digits[s[0]] << 4) |\n                   (wuffs_base__parse_number__hexadecimal_digits[s[1]] & 0x0F));\n    d += 1;\n    s += 2;\n  }\n\n  return len;\n}\n\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__hexadecimal__decode4(wuffs_base__slice_u8 dst,\n                                 wuffs_base__slice_u8 src) {\n  size_t src_len4 = src.len / 4;\n  size_t len = dst.len < src_len4 ? dst.len : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n--) {\n    *d = (uint8_t)((wuffs_base__parse_number__hexadecimal_digits[s[2]] << 4) |\n                   (wuffs_base__parse_number__hexa" +
 	"decimal_digits[s[3]] & 0x0F));\n    d += 1;\n    s += 4;\n  }\n\n  return len;\n}\n\n" +
 	"" +
@@ -49,8 +57,31 @@ const baseStrConvImplC = "" +
 	"   6     7\n    // 8     9     A     B     C     D     E     F\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x00 ..= 0x07.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x08 ..= 0x0F.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x10 ..= 0x17.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x18 ..= 0x1F.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x20 ..= 0x27.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x28 ..= 0x2F.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x30 ..= 0x37.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x38 ..= 0x3F.\n\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x40 ..= 0x47.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x48 ..= 0x4F.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x50 ..= 0x57.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x58 ..= 0x5F.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x60 ..= 0x67.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00" +
 	", 0x00, 0x00,  // 0x68 ..= 0x6F.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x70 ..= 0x77.\n    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x78 ..= 0x7F.\n\n    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0x80 ..= 0x87.\n    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0x88 ..= 0x8F.\n    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0x90 ..= 0x97.\n    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0x98 ..= 0x9F.\n    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xA0 ..= 0xA7.\n    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xA8 ..= 0xAF.\n    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xB0 ..= 0xB7.\n    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // 0xB8 ..= 0xBF.\n\n    0x80, 0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // 0xC0 ..= 0xC7.\n    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // 0xC8 ..= 0xCF.\n    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // 0xD0 ..= 0xD7.\n    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // 0xD8 ..= 0" +
 	"xDF.\n    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  // 0xE0 ..= 0xE7.\n    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  // 0xE8 ..= 0xEF.\n    0x03, 0x03, 0x03, 0x03, 0x03, 0x80, 0x80, 0x80,  // 0xF0 ..= 0xF7.\n    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,  // 0xF8 ..= 0xFF.\n    // 0     1     2     3     4     5     6     7\n    // 8     9     A     B     C     D     E     F\n};\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__utf_8__next__output  //\nwuffs_base__utf_8__next(wuffs_base__slice_u8 s) {\n  if (s.len == 0) {\n    return wuffs_base__make_utf_8__next__output(0, 0);\n  }\n  uint32_t c = s.ptr[0];\n  switch (wuffs_base__utf_8__byte_length_minus_1[c & 0xFF]) {\n    case 0:\n      return wuffs_base__make_utf_8__next__output(c, 1);\n\n    case 1:\n      if (s.len < 2) {\n        break;\n      }\n      c = wuffs_base__load_u16le__no_bounds_check(s.ptr);\n      if ((c & 0xC000) != 0x8000) {\n        break;\n      }\n      c = (0x0007C0 & (c << 6)) | (0x00003F & (c >> 8));\n      return wuffs_base__make_utf_8__next__output(" +
-	"c, 2);\n\n    case 2:\n      if (s.len < 3) {\n        break;\n      }\n      c = wuffs_base__load_u24le__no_bounds_check(s.ptr);\n      if ((c & 0xC0C000) != 0x808000) {\n        break;\n      }\n      c = (0x00F000 & (c << 12)) | (0x000FC0 & (c >> 2)) |\n          (0x00003F & (c >> 16));\n      if ((c <= 0x07FF) || ((0xD800 <= c) && (c <= 0xDFFF))) {\n        break;\n      }\n      return wuffs_base__make_utf_8__next__output(c, 3);\n\n    case 3:\n      if (s.len < 4) {\n        break;\n      }\n      c = wuffs_base__load_u32le__no_bounds_check(s.ptr);\n      if ((c & 0xC0C0C000) != 0x80808000) {\n        break;\n      }\n      c = (0x1C0000 & (c << 18)) | (0x03F000 & (c << 4)) |\n          (0x000FC0 & (c >> 10)) | (0x00003F & (c >> 24));\n      if ((c <= 0xFFFF) || (0x110000 <= c)) {\n        break;\n      }\n      return wuffs_base__make_utf_8__next__output(c, 4);\n  }\n\n  return wuffs_base__make_utf_8__next__output(\n      WUFFS_BASE__UNICODE_REPLACEMENT_CHARACTER, 1);\n}\n\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__utf_8__longest_va" +
-	"lid_prefix(wuffs_base__slice_u8 s) {\n  // TODO: possibly optimize the all-ASCII case (4 or 8 bytes at a time).\n  //\n  // TODO: possibly optimize this by manually inlining the\n  // wuffs_base__utf_8__next calls.\n  size_t original_len = s.len;\n  while (s.len > 0) {\n    wuffs_base__utf_8__next__output o = wuffs_base__utf_8__next(s);\n    if ((o.code_point > 0x7F) && (o.byte_length == 1)) {\n      break;\n    }\n    s.ptr += o.byte_length;\n    s.len -= o.byte_length;\n  }\n  return original_len - s.len;\n}\n\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__ascii__longest_valid_prefix(wuffs_base__slice_u8 s) {\n  // TODO: possibly optimize this by checking 4 or 8 bytes at a time.\n  uint8_t* original_ptr = s.ptr;\n  uint8_t* p = s.ptr;\n  uint8_t* q = s.ptr + s.len;\n  for (; (p != q) && ((*p & 0x80) == 0); p++) {\n  }\n  return (size_t)(p - original_ptr);\n}\n" +
+	"c, 2);\n\n    case 2:\n      if (s.len < 3) {\n        break;\n      }\n      c = wuffs_base__load_u24le__no_bounds_check(s.ptr);\n      if ((c & 0xC0C000) != 0x808000) {\n        break;\n      }\n      c = (0x00F000 & (c << 12)) | (0x000FC0 & (c >> 2)) |\n          (0x00003F & (c >> 16));\n      if ((c <= 0x07FF) || ((0xD800 <= c) && (c <= 0xDFFF))) {\n        break;\n      }\n      return wuffs_base__make_utf_8__next__output(c, 3);\n\n    case 3:\n      if (s.len < 4) {\n        break;\n      }\n      c = wuffs_base__load_u32le__no_bounds_check(s.ptr);\n      if ((c & 0xC0C0C000) != 0x80808000) {\n        break;\n      }\n      c = (0x1C0000 & (c << 18)) | (0x03F000 & (c << 4)) |\n          (0x000FC0 & (c >> 10)) | (0x00003F & (c >> 24));\n      if ((c <= 0xFFFF) || (0x110000 <= c)) {\n        break;\n      }\n      return wuffs_base__make_utf_8__next__output(c, 4);\n  }\n\n  return wuffs_base__make_utf_8__next__output(\n      WUFFS_BASE__UNICODE_REPLACEMENT_CHARACTER, 1);\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\n// wuffs_base__private" +
+	"_implementation__utf_8__longest_valid_prefix_x86_sse42\n// returns a length n such that s[..n] is valid UTF-8 and either s[n..] starts\n// with invalid UTF-8 or fewer than 16 bytes remain. It validates 16 bytes at a\n// time, falling back to wuffs_base__utf_8__next when that stops short. The\n// caller finishes the job from s[n..].\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic size_t  //\nwuffs_base__private_implementation__utf_8__longest_valid_prefix_x86_sse42(\n    wuffs_base__slice_u8 s) {\n  uint8_t* p = s.ptr;\n  uint8_t* q = s.ptr + s.len;\n  while ((q - p) >= 16) {\n    __m128i x = _mm_lddqu_si128((const __m128i*)(const void*)p);\n    if (_mm_movemask_epi8(x) == 0) {\n      p += 16;\n      continue;\n    }\n    uint32_t n = wuffs_base__cpu_arch__utf_8_span_x86_sse42(x, 0);\n    if (n == 0) {\n      wuffs_base__utf_8__next__output o = wuffs_base__utf_8__next(\n          wuffs_base__make_slice_u8(p, (size_t)(q - p)));\n      if ((o.code_point > 0x7F) && (o.byte_length == 1)) {\n        break;\n      }\n      n = o.byte_lengt" +
+	"h;\n    }\n    p += n;\n  }\n  return (size_t)(p - s.ptr);\n}\n\n// wuffs_base__private_implementation__ascii__longest_valid_prefix_x86_sse42\n// returns a length n, a multiple of 16, such that s[..n] is valid ASCII and\n// either s[n..n+16] is not or there are fewer than 16 bytes remaining.\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic size_t  //\nwuffs_base__private_implementation__ascii__longest_valid_prefix_x86_sse42(\n    wuffs_base__slice_u8 s) {\n  uint8_t* p = s.ptr;\n  uint8_t* q = s.ptr + s.len;\n  for (; (q - p) >= 16; p += 16) {\n    if (_mm_movemask_epi8(_mm_lddqu_si128((const __m128i*)(const void*)p)) !=\n        0) {\n      break;\n    }\n  }\n  return (size_t)(p - s.ptr);\n}\n\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__utf_8__longest_valid_prefix(wuffs_base__slice_u8 s) {\n  size_t original_len = s.len;\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n  if ((s.len >= 16) && wuffs_base__cpu_arch__have_x86_sse42()) {\n    size_t n =\n        wuffs_base__private_implementa" +
+	"tion__utf_8__longest_valid_prefix_x86_sse42(\n            s);\n    s.ptr += n;\n    s.len -= n;\n  }\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\n  while (s.len > 0) {\n    // Consume ASCII 8 bytes at a time.\n    if ((s.len >= 8) && ((wuffs_base__load_u64le__no_bounds_check(s.ptr) &\n                          0x8080808080808080) == 0)) {\n      s.ptr += 8;\n      s.len -= 8;\n      continue;\n    }\n    wuffs_base__utf_8__next__output o = wuffs_base__utf_8__next(s);\n    if ((o.code_point > 0x7F) && (o.byte_length == 1)) {\n      break;\n    }\n    s.ptr += o.byte_length;\n    s.len -= o.byte_length;\n  }\n  return original_len - s.len;\n}\n\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__ascii__longest_valid_prefix(wuffs_base__slice_u8 s) {\n  uint8_t* original_ptr = s.ptr;\n  uint8_t* p = s.ptr;\n  uint8_t* q = s.ptr + s.len;\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n  if ((s.len >= 16) && wuffs_base__cpu_arch__have_x86_sse42()) {\n    p +=\n        wuffs_base__private_implementation__ascii__longest_valid_prefix_x86_sse42(\n   " +
+	"         s);\n  }\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\n  // Consume ASCII 8 bytes at a time, then 1 byte at a time.\n  for (;\n       ((q - p) >= 8) &&\n       ((wuffs_base__load_u64le__no_bounds_check(p) & 0x8080808080808080) == 0);\n       p += 8) {\n  }\n  for (; (p != q) && ((*p & 0x80) == 0); p++) {\n  }\n  return (size_t)(p - original_ptr);\n}\n" +
+	""
+
+const baseAuxPublicH = "" +
+	"// ---------------- Auxiliary C++ API\n\n// The wuffs_aux namespace is a higher level, C++ only layer over the C API\n// (and its thin C++ convenience methods). It holds the buffer management that\n// every C++ program would otherwise re-implement: driving a decoder through\n// its suspensions, refilling and compacting the source and flushing the\n// destination.\n//\n// Callbacks are template parameters, not std::function values, so that they\n// can be inlined and so that nothing here allocates. The one exception is a\n// decoder_pool, which allocates a decoder when its (thread-local) free list is\n// empty. The caller owns all of the buffers.\n//\n// Like the rest of Wuffs, nothing here throws exceptions.\n\nnamespace wuffs_aux {\n\n// input_span is a read-only, non-owning view of contiguous bytes, like C++20's\n// std::span<const uint8_t>. It converts implicitly from a wuffs_base__slice_u8\n// or from any container (e.g. a std::string or std::vector<uint8_t>) that has\n// data() and size() methods and 1-byte elements. No byt" +
+	"es are copied.\n//\n// The viewed bytes must outlive the input_span and anything derived from it,\n// such as its reader().\nclass input_span {\n public:\n  input_span() : m_ptr(nullptr), m_len(0) {}\n\n  input_span(const void* ptr, size_t len)\n      : m_ptr(static_cast<const uint8_t*>(ptr)), m_len(ptr ? len : 0) {}\n\n  input_span(wuffs_base__slice_u8 s)\n      : m_ptr(s.ptr), m_len(s.ptr ? s.len : 0) {}\n\n  template <typename Container>\n  input_span(const Container& c)\n      : m_ptr(reinterpret_cast<const uint8_t*>(c.data())), m_len(c.size()) {\n    static_assert(sizeof(*c.data()) == 1,\n                  \"wuffs_aux::input_span needs 1-byte elements\");\n  }\n\n  inline const uint8_t* data() const { return m_ptr; }\n  inline size_t size() const { return m_len; }\n  inline bool empty() const { return m_len == 0; }\n\n  // slice returns the bytes as a wuffs_base__slice_u8. Its ptr field is not\n  // const-qualified (that's how the C API is), but the bytes must not be\n  // modified through it.\n  inline wuffs_base__slice_u8 slice() c" +
+	"onst {\n    return wuffs_base__make_slice_u8(const_cast<uint8_t*>(m_ptr), m_len);\n  }\n\n  // reader returns a closed io_buffer that holds the entire input. Wuffs'\n  // decoders only read from, never write to, their source io_buffer, so the\n  // bytes are not copied. A closed source never needs to be refilled or\n  // compacted, so the drivers below never call their read callback.\n  inline wuffs_base__io_buffer reader() const {\n    return wuffs_base__slice_u8__reader(slice(), true);\n  }\n\n private:\n  const uint8_t* m_ptr;\n  size_t m_len;\n};\n\n" +
+	"" +
+	"// --------\n\n// decoder_pool recycles heap-allocated decoders (or other Wuffs objects),\n// such as wuffs_zlib__decoder objects, so that a thread that decodes many\n// small, independent inputs does not pay for a malloc and free per input.\n// Its template arguments are the object type T, its sizeof__T function and\n// the maximum number of idle objects (per thread) to keep for re-use:\n//\n//   using zlib_pool = wuffs_aux::decoder_pool<wuffs_zlib__decoder,\n//                                             sizeof__wuffs_zlib__decoder>;\n//\n//   zlib_pool::handle dec = zlib_pool::acquire();\n//   if (!dec) {\n//     etc;  // Handle the out-of-memory error.\n//   }\n//   wuffs_base__status status = dec->transform_io(etc);\n//\n// Each thread has its own free list, so acquiring and releasing need no\n// locking. Releasing a handle on a different thread to the one that acquired\n// it is safe, but the object then joins the releasing thread's free list.\n//\n// Every acquired object is (re-)initialized, by default with the\n// WUFFS_I" +
+	"NITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED flag, so that\n// re-initializing a recycled object does not have to zero its internal\n// buffers (e.g. a 32 KiB history ringbuffer). Pass 0 to acquire to fully\n// zero-initialize instead. See /doc/note/initialization.md for the trade-offs.\ntemplate <typename T, size_t (*SizeOfT)(), size_t MaxIdle = 4>\nclass decoder_pool {\n public:\n  // handle is a move-only RAII handle to an acquired object. Its destructor\n  // releases the object back to the pool. An empty handle (one that is\n  // default constructed, moved from or from a failed acquire) holds nullptr.\n  class handle {\n   public:\n    handle() : m_ptr(nullptr) {}\n    explicit handle(T* ptr) : m_ptr(ptr) {}\n    handle(handle&& that) : m_ptr(that.m_ptr) { that.m_ptr = nullptr; }\n    handle(const handle&) = delete;\n    ~handle() { reset(); }\n\n    handle& operator=(handle&& that) {\n      if (this != &that) {\n        reset();\n        m_ptr = that.m_ptr;\n        that.m_ptr = nullptr;\n      }\n      return *this;\n    }\n" +
+	"    handle& operator=(const handle&) = delete;\n\n    inline T* get() const { return m_ptr; }\n    inline T* operator->() const { return m_ptr; }\n    inline T& operator*() const { return *m_ptr; }\n    inline explicit operator bool() const { return m_ptr != nullptr; }\n\n    // reset releases the object, if any, back to the pool.\n    inline void reset() {\n      if (m_ptr) {\n        decoder_pool::release(m_ptr);\n        m_ptr = nullptr;\n      }\n    }\n\n   private:\n    T* m_ptr;\n  };\n\n  // acquire returns a handle to an initialized object, re-using an idle one\n  // if the calling thread has any. On failure (out of memory, or bad\n  // initialize_flags), it returns an empty handle. It doesn't throw.\n  static handle  //\n  acquire(uint32_t initialize_flags =\n              WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) {\n    free_list& f = local_free_list();\n    T* ptr = (f.n > 0) ? f.ptrs[--f.n] : static_cast<T*>(malloc(SizeOfT()));\n    if (!ptr) {\n      return handle();\n    }\n    wuffs_base__status status =\n    " +
+	"    ptr->initialize(SizeOfT(), WUFFS_VERSION, initialize_flags);\n    if (!status.is_ok()) {\n      free(ptr);\n      return handle();\n    }\n    return handle(ptr);\n  }\n\n private:\n  struct free_list {\n    T* ptrs[MaxIdle];\n    size_t n;\n\n    free_list() : n(0) {}\n    ~free_list() {\n      while (n > 0) {\n        free(ptrs[--n]);\n      }\n    }\n  };\n\n  static free_list&  //\n  local_free_list() {\n    static thread_local free_list z;\n    return z;\n  }\n\n  static void  //\n  release(T* ptr) {\n    free_list& f = local_free_list();\n    if (f.n < MaxIdle) {\n      f.ptrs[f.n++] = ptr;\n    } else {\n      free(ptr);\n    }\n  }\n};\n\n" +
+	"" +
+	"// --------\n\n// The transform_io and decode_tokens functions drive a decoder (or other\n// coroutine) until it completes, handling its suspensions:\n//\n//  - On a short read, the src io_buffer is compacted (if it has consumed\n//    bytes) and refilled by calling read(src). The callback should append\n//    bytes to src (advancing src->meta.wi) and set src->meta.closed at the\n//    end of the input. A short read on a closed src is a\n//    wuffs_base__error__not_enough_data error. A short read on a full src\n//    (one that, even after compaction, has no room) is a\n//    wuffs_base__error__bad_argument_length_too_short error: the buffer is\n//    too small for that decoder.\n//  - A short write on a full dst (or tok) buffer (one that, even after\n//    compaction, has no room, e.g. a zero-length buffer) is also a\n//    wuffs_base__error__bad_argument_length_too_short error. Retrying could\n//    not make progress.\n//  - After every call that wrote to dst (not just those that suspended with\n//    a short write), the dst" +
+	" buffer's contents are handed to a callback and\n//    then the dst buffer is emptied. Carrying dst bytes over from one call\n//    to the next is not an option: decoders like std/deflate's take all of\n//    dst's written bytes to be their most recent output, when resolving\n//    back-references, so re-presenting already-seen output corrupts it.\n//\n// The src buffer is only compacted when it needs refilling. A src that is\n// already closed (e.g. an input_span's reader) is never copied, compacted or\n// refilled. For fewer, larger callback calls, use larger buffers.\n//\n// Callbacks return a wuffs_base__status. Any status other than OK (e.g. an\n// error or a custom message) stops the driver, which returns that status.\n// Likewise, any decoder status other than OK, short read or short write\n// (e.g. a decoding error) is returned as is.\n//\n// On success, the decoder may not have consumed all of src. For example, a\n// zlib stream may be followed by other data. Any unconsumed bytes remain in\n// src, starting at src->m" +
+	"eta.ri.\n\n// transform_io drives an io_transformer, or a concrete type with a compatible\n// transform_io method, such as a wuffs_gzip__decoder. The write callback is\n// called as write(wuffs_base__slice_u8 bytes).\ntemplate <typename Transformer, typename ReadFunc, typename WriteFunc>\nwuffs_base__status  //\ntransform_io(Transformer* t,\n             wuffs_base__io_buffer* dst,\n             wuffs_base__io_buffer* src,\n             wuffs_base__slice_u8 workbuf,\n             ReadFunc&& read,\n             WriteFunc&& write) {\n  while (true) {\n    wuffs_base__status status = t->transform_io(dst, src, workbuf);\n\n    if (dst->meta.wi > dst->meta.ri) {\n      wuffs_base__status z = write(wuffs_base__make_slice_u8(\n          dst->data.ptr + dst->meta.ri, dst->meta.wi - dst->meta.ri));\n      if (z.repr) {\n        return z;\n      }\n      dst->meta.ri = dst->meta.wi;\n      dst->compact();\n    }\n\n    if (status.repr == nullptr) {\n      return status;\n    } else if (status.repr == wuffs_base__suspension__short_read) {\n      if" +
+	" (src->meta.closed) {\n        return wuffs_base__make_status(wuffs_base__error__not_enough_data);\n      }\n      src->compact();\n      if (src->meta.wi >= src->data.len) {\n        return wuffs_base__make_status(\n            wuffs_base__error__bad_argument_length_too_short);\n      }\n      wuffs_base__status z = read(src);\n      if (z.repr) {\n        return z;\n      }\n    } else if (status.repr == wuffs_base__suspension__short_write) {\n      dst->compact();\n      if (dst->meta.wi >= dst->data.len) {\n        return wuffs_base__make_status(\n            wuffs_base__error__bad_argument_length_too_short);\n      }\n    } else {\n      return status;\n    }\n  }\n}\n\n// transform_io, given an input_span instead of a src io_buffer, transforms\n// the whole input without copying it into an intermediate buffer.\ntemplate <typename Transformer, typename WriteFunc>\nwuffs_base__status  //\ntransform_io(Transformer* t,\n             wuffs_base__io_buffer* dst,\n             input_span src,\n             wuffs_base__slice_u8 workbuf,\n    " +
+	"         WriteFunc&& write) {\n  wuffs_base__io_buffer r = src.reader();\n  return transform_io(\n      t, dst, &r, workbuf,\n      [](wuffs_base__io_buffer*) -> wuffs_base__status {\n        return wuffs_base__make_status(wuffs_base__error__not_enough_data);\n      },\n      write);\n}\n\n// decode_tokens drives a token_decoder, or a concrete type with a compatible\n// decode_tokens method, such as a wuffs_json__decoder. The token callback is\n// called as handle_tokens(tok, src) and should consume tok's readable tokens\n// (from tok->meta.ri to tok->meta.wi). Those tokens cover the src bytes that\n// immediately precede src->meta.ri. After the callback returns, any readable\n// tokens left over are discarded and tok is emptied.\n//\n// The src buffer is only compacted after its tokens were handled, so that a\n// token's bytes do not move while the callback is looking at them.\ntemplate <typename TokenDecoder, typename ReadFunc, typename TokenFunc>\nwuffs_base__status  //\ndecode_tokens(TokenDecoder* d,\n              wuffs_base_" +
+	"_token_buffer* tok,\n              wuffs_base__io_buffer* src,\n              wuffs_base__slice_u8 workbuf,\n              ReadFunc&& read,\n              TokenFunc&& handle_tokens) {\n  while (true) {\n    wuffs_base__status status = d->decode_tokens(tok, src, workbuf);\n\n    if (tok->meta.wi > tok->meta.ri) {\n      wuffs_base__status z = handle_tokens(tok, src);\n      if (z.repr) {\n        return z;\n      }\n    }\n    tok->meta.ri = tok->meta.wi;\n    tok->compact();\n\n    if (status.repr == nullptr) {\n      return status;\n    } else if (status.repr == wuffs_base__suspension__short_read) {\n      if (src->meta.closed) {\n        return wuffs_base__make_status(wuffs_base__error__not_enough_data);\n      }\n      src->compact();\n      if (src->meta.wi >= src->data.len) {\n        return wuffs_base__make_status(\n            wuffs_base__error__bad_argument_length_too_short);\n      }\n      wuffs_base__status z = read(src);\n      if (z.repr) {\n        return z;\n      }\n    } else if (status.repr == wuffs_base__suspension__short" +
+	"_write) {\n      if (tok->meta.wi >= tok->data.len) {\n        return wuffs_base__make_status(\n            wuffs_base__error__bad_argument_length_too_short);\n      }\n    } else {\n      return status;\n    }\n  }\n}\n\n// decode_tokens, given an input_span instead of a src io_buffer, decodes the\n// whole input without copying it into an intermediate buffer. The src passed\n// to handle_tokens is a reader over the input_span, so that the src->data.ptr\n// indexes are also indexes into the input_span.\ntemplate <typename TokenDecoder, typename TokenFunc>\nwuffs_base__status  //\ndecode_tokens(TokenDecoder* d,\n              wuffs_base__token_buffer* tok,\n              input_span src,\n              wuffs_base__slice_u8 workbuf,\n              TokenFunc&& handle_tokens) {\n  wuffs_base__io_buffer r = src.reader();\n  return decode_tokens(\n      d, tok, &r, workbuf,\n      [](wuffs_base__io_buffer*) -> wuffs_base__status {\n        return wuffs_base__make_status(wuffs_base__error__not_enough_data);\n      },\n      handle_tokens);\n}\n\n" +
+	"}  // namespace wuffs_aux\n" +
 	""
 
 const baseF64ConvSubmoduleC = "" +
@@ -86,7 +117,53 @@ const baseF64ConvSubmoduleC = "" +
 	"x6F5088CC, 0x8CBCCC09, 0xFFFFFF99, 0xE219652C, 0xD1B71758, 0xFFFFFFB3,\n        0x00000000, 0x9C400000, 0xFFFFFFCE, 0x00000000, 0xE8D4A510, 0xFFFFFFE8,\n        0xAC620000, 0xAD78EBC5, 0x00000003, 0xF8940984, 0x813F3978, 0x0000001E,\n        0xC90715B3, 0xC097CE7B, 0x00000038, 0x7BEA5C70, 0x8F7E32CE, 0x00000053,\n        0xABE98068, 0xD5D238A4, 0x0000006D, 0x179A2245, 0x9F4F2726, 0x00000088,\n        0xD4C4FB27, 0xED63A231, 0x000000A2, 0x8CC8ADA8, 0xB0DE6538, 0x000000BD,\n        0x1AAB65DB, 0x83C7088E, 0x000000D8, 0x42711D9A, 0xC45D1DF9, 0x000000F2,\n        0xA61BE758, 0x924D692C, 0x0000010D, 0x1A708DEA, 0xDA01EE64, 0x00000127,\n        0x9AEF774A, 0xA26DA399, 0x00000142, 0xB47D6B85, 0xF209787B, 0x0000015C,\n        0x79DD1877, 0xB454E4A1, 0x00000177, 0x5B9BC5C2, 0x865B8692, 0x00000192,\n        0xC8965D3D, 0xC83553C5, 0x000001AC, 0xFA97A0B3, 0x952AB45C, 0x000001C7,\n        0x99A05FE3, 0xDE469FBD, 0x000001E1, 0xDB398C25, 0xA59BC234, 0x000001FC,\n        0xA3989F5C, 0xF6C69A72, 0x00000216, 0x54E9BECE, 0xB7DCBF53, 0x000" +
 	"00231,\n        0xF22241E2, 0x88FCF317, 0x0000024C, 0xD35C78A5, 0xCC20CE9B, 0x00000266,\n        0x7B2153DF, 0x98165AF3, 0x00000281, 0x971F303A, 0xE2A0B5DC, 0x0000029B,\n        0x5CE3B396, 0xA8D9D153, 0x000002B6, 0xA4A7443C, 0xFB9B7CD9, 0x000002D0,\n        0xA7A44410, 0xBB764C4C, 0x000002EB, 0xB6409C1A, 0x8BAB8EEF, 0x00000306,\n        0xA657842C, 0xD01FEF10, 0x00000320, 0xE9913129, 0x9B10A4E5, 0x0000033B,\n        0xA19C0C9D, 0xE7109BFB, 0x00000355, 0x623BF429, 0xAC2820D9, 0x00000370,\n        0x7AA7CF85, 0x80444B5E, 0x0000038B, 0x03ACDD2D, 0xBF21E440, 0x000003A5,\n        0x5E44FF8F, 0x8E679C2F, 0x000003C0, 0x9C8CB841, 0xD433179D, 0x000003DA,\n        0xB4E31BA9, 0x9E19DB92, 0x000003F5, 0xBADF77D9, 0xEB96BF6E, 0x0000040F,\n        0x9BF0EE6B, 0xAF87023B, 0x0000042A,\n};\n\n// wuffs_base__private_implementation__small_powers_of_10 contains\n// approximations to the powers of 10, ranging from 1e+0 to 1e+7, with the\n// exponent stepping by 1. Each step consists of three uint32_t elements.\n//\n// For example, the third appr" +
 	"oximation, for 1e+2, consists of the uint32_t\n// triple (0x00000000, 0xC8000000, 0xFFFFFFC7). The first two of that triple\n// are a little-endian uint64_t value: 0xC800000000000000. The last one is an\n// int32_t value: -57. Together, they represent the approximation:\n//   1e+2   ≈ 0xC800000000000000 * (2 **   -57)  // This approx'n is exact.\n// Similarly, the (0x00000000, 0x9C400000, 0xFFFFFFCE) uint32_t triple means:\n//   1e+4   ≈ 0x9C40000000000000 * (2 **   -50)  // This approx'n is exact.\nstatic const uint32_t\n    wuffs_base__private_implementation__small_powers_of_10[24] = {\n        0x00000000, 0x80000000, 0xFFFFFFC1, 0x00000000, 0xA0000000, 0xFFFFFFC4,\n        0x00000000, 0xC8000000, 0xFFFFFFC7, 0x00000000, 0xFA000000, 0xFFFFFFCA,\n        0x00000000, 0x9C400000, 0xFFFFFFCE, 0x00000000, 0xC3500000, 0xFFFFFFD1,\n        0x00000000, 0xF4240000, 0xFFFFFFD4, 0x00000000, 0x98968000, 0xFFFFFFD8,\n};\n\n// wuffs_base__private_implementation__f64_powers_of_10 holds powers of 10 that\n// can be exactly represented" +
-	" by a float64 (what C calls a double).\nstatic const double wuffs_base__private_implementation__f64_powers_of_10[23] = {\n    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,\n    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,\n};\n\n" +
+	" by a float64 (what C calls a double).\nstatic const double wuffs_base__private_implementation__f64_powers_of_10[23] = {\n    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,\n    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,\n};\n\n// wuffs_base__private_implementation__powers_of_10 contains truncated\n// approximations to the powers of 10, ranging from 1e-307 to 1e+324 inclusive,\n// as 632 pairs of uint64_t values (a 128-bit mantissa).\n//\n// There's also an implicit third column (implied by a linear formula involving\n// the base-10 exponent) that is the base-2 exponent, approximately\n// ((217706 * e) >> 16). See\n// wuffs_base__private_implementation__parse_number_f64_eisel_lemire.\n//\n// Parsing (Eisel-Lemire) uses the 1e-307 to 1e+288 range. Rendering\n// (Schubfach) uses the 1e-292 to 1e+324 range.\n//\n// The approximations are truncated (rounded down), not rounded to nearest,\n// and normalized, so that the high bit of the second (hi) uint64_t is set.\n// For example, the 1" +
+	"e+1 pair (0x0000000000000000, 0xA000000000000000) means:\n//   1e+1 ≈ 0xA000000000000000_0000000000000000 * (2 ** (3 - 127))\n//\n// This table was printed by script/print-eisel-lemire-powers-of-10.go\nstatic const uint64_t wuffs_base__private_implementation__powers_of_10[632][2] =\n    {\n        {0xA5D3B6D479F8E056, 0x8FD0C16206306BAB},  // 1e-307\n        {0x8F48A4899877186C, 0xB3C4F1BA87BC8696},  // 1e-306\n        {0x331ACDABFE94DE87, 0xE0B62E2929ABA83C},  // 1e-305\n        {0x9FF0C08B7F1D0B14, 0x8C71DCD9BA0B4925},  // 1e-304\n        {0x07ECF0AE5EE44DD9, 0xAF8E5410288E1B6F},  // 1e-303\n        {0xC9E82CD9F69D6150, 0xDB71E91432B1A24A},  // 1e-302\n        {0xBE311C083A225CD2, 0x892731AC9FAF056E},  // 1e-301\n        {0x6DBD630A48AAF406, 0xAB70FE17C79AC6CA},  // 1e-300\n        {0x092CBBCCDAD5B108, 0xD64D3D9DB981787D},  // 1e-299\n        {0x25BBF56008C58EA5, 0x85F0468293F0EB4E},  // 1e-298\n        {0xAF2AF2B80AF6F24E, 0xA76C582338ED2621},  // 1e-297\n        {0x1AF5AF660DB4AEE1, 0xD1476E2C07286FAA},  // 1e-296\n     " +
+	"   {0x50D98D9FC890ED4D, 0x82CCA4DB847945CA},  // 1e-295\n        {0xE50FF107BAB528A0, 0xA37FCE126597973C},  // 1e-294\n        {0x1E53ED49A96272C8, 0xCC5FC196FEFD7D0C},  // 1e-293\n        {0x25E8E89C13BB0F7A, 0xFF77B1FCBEBCDC4F},  // 1e-292\n        {0x77B191618C54E9AC, 0x9FAACF3DF73609B1},  // 1e-291\n        {0xD59DF5B9EF6A2417, 0xC795830D75038C1D},  // 1e-290\n        {0x4B0573286B44AD1D, 0xF97AE3D0D2446F25},  // 1e-289\n        {0x4EE367F9430AEC32, 0x9BECCE62836AC577},  // 1e-288\n        {0x229C41F793CDA73F, 0xC2E801FB244576D5},  // 1e-287\n        {0x6B43527578C1110F, 0xF3A20279ED56D48A},  // 1e-286\n        {0x830A13896B78AAA9, 0x9845418C345644D6},  // 1e-285\n        {0x23CC986BC656D553, 0xBE5691EF416BD60C},  // 1e-284\n        {0x2CBFBE86B7EC8AA8, 0xEDEC366B11C6CB8F},  // 1e-283\n        {0x7BF7D71432F3D6A9, 0x94B3A202EB1C3F39},  // 1e-282\n        {0xDAF5CCD93FB0CC53, 0xB9E08A83A5E34F07},  // 1e-281\n        {0xD1B3400F8F9CFF68, 0xE858AD248F5C22C9},  // 1e-280\n        {0x23100809B9C21FA1, 0x91376C36D99995BE},  //" +
+	" 1e-279\n        {0xABD40A0C2832A78A, 0xB58547448FFFFB2D},  // 1e-278\n        {0x16C90C8F323F516C, 0xE2E69915B3FFF9F9},  // 1e-277\n        {0xAE3DA7D97F6792E3, 0x8DD01FAD907FFC3B},  // 1e-276\n        {0x99CD11CFDF41779C, 0xB1442798F49FFB4A},  // 1e-275\n        {0x40405643D711D583, 0xDD95317F31C7FA1D},  // 1e-274\n        {0x482835EA666B2572, 0x8A7D3EEF7F1CFC52},  // 1e-273\n        {0xDA3243650005EECF, 0xAD1C8EAB5EE43B66},  // 1e-272\n        {0x90BED43E40076A82, 0xD863B256369D4A40},  // 1e-271\n        {0x5A7744A6E804A291, 0x873E4F75E2224E68},  // 1e-270\n        {0x711515D0A205CB36, 0xA90DE3535AAAE202},  // 1e-269\n        {0x0D5A5B44CA873E03, 0xD3515C2831559A83},  // 1e-268\n        {0xE858790AFE9486C2, 0x8412D9991ED58091},  // 1e-267\n        {0x626E974DBE39A872, 0xA5178FFF668AE0B6},  // 1e-266\n        {0xFB0A3D212DC8128F, 0xCE5D73FF402D98E3},  // 1e-265\n        {0x7CE66634BC9D0B99, 0x80FA687F881C7F8E},  // 1e-264\n        {0x1C1FFFC1EBC44E80, 0xA139029F6A239F72},  // 1e-263\n        {0xA327FFB266B56220, 0xC98743474" +
+	"4AC874E},  // 1e-262\n        {0x4BF1FF9F0062BAA8, 0xFBE9141915D7A922},  // 1e-261\n        {0x6F773FC3603DB4A9, 0x9D71AC8FADA6C9B5},  // 1e-260\n        {0xCB550FB4384D21D3, 0xC4CE17B399107C22},  // 1e-259\n        {0x7E2A53A146606A48, 0xF6019DA07F549B2B},  // 1e-258\n        {0x2EDA7444CBFC426D, 0x99C102844F94E0FB},  // 1e-257\n        {0xFA911155FEFB5308, 0xC0314325637A1939},  // 1e-256\n        {0x793555AB7EBA27CA, 0xF03D93EEBC589F88},  // 1e-255\n        {0x4BC1558B2F3458DE, 0x96267C7535B763B5},  // 1e-254\n        {0x9EB1AAEDFB016F16, 0xBBB01B9283253CA2},  // 1e-253\n        {0x465E15A979C1CADC, 0xEA9C227723EE8BCB},  // 1e-252\n        {0x0BFACD89EC191EC9, 0x92A1958A7675175F},  // 1e-251\n        {0xCEF980EC671F667B, 0xB749FAED14125D36},  // 1e-250\n        {0x82B7E12780E7401A, 0xE51C79A85916F484},  // 1e-249\n        {0xD1B2ECB8B0908810, 0x8F31CC0937AE58D2},  // 1e-248\n        {0x861FA7E6DCB4AA15, 0xB2FE3F0B8599EF07},  // 1e-247\n        {0x67A791E093E1D49A, 0xDFBDCECE67006AC9},  // 1e-246\n        {0xE0C8BB2C5C6D24E0" +
+	", 0x8BD6A141006042BD},  // 1e-245\n        {0x58FAE9F773886E18, 0xAECC49914078536D},  // 1e-244\n        {0xAF39A475506A899E, 0xDA7F5BF590966848},  // 1e-243\n        {0x6D8406C952429603, 0x888F99797A5E012D},  // 1e-242\n        {0xC8E5087BA6D33B83, 0xAAB37FD7D8F58178},  // 1e-241\n        {0xFB1E4A9A90880A64, 0xD5605FCDCF32E1D6},  // 1e-240\n        {0x5CF2EEA09A55067F, 0x855C3BE0A17FCD26},  // 1e-239\n        {0xF42FAA48C0EA481E, 0xA6B34AD8C9DFC06F},  // 1e-238\n        {0xF13B94DAF124DA26, 0xD0601D8EFC57B08B},  // 1e-237\n        {0x76C53D08D6B70858, 0x823C12795DB6CE57},  // 1e-236\n        {0x54768C4B0C64CA6E, 0xA2CB1717B52481ED},  // 1e-235\n        {0xA9942F5DCF7DFD09, 0xCB7DDCDDA26DA268},  // 1e-234\n        {0xD3F93B35435D7C4C, 0xFE5D54150B090B02},  // 1e-233\n        {0xC47BC5014A1A6DAF, 0x9EFA548D26E5A6E1},  // 1e-232\n        {0x359AB6419CA1091B, 0xC6B8E9B0709F109A},  // 1e-231\n        {0xC30163D203C94B62, 0xF867241C8CC6D4C0},  // 1e-230\n        {0x79E0DE63425DCF1D, 0x9B407691D7FC44F8},  // 1e-229\n        {0x985" +
+	"915FC12F542E4, 0xC21094364DFB5636},  // 1e-228\n        {0x3E6F5B7B17B2939D, 0xF294B943E17A2BC4},  // 1e-227\n        {0xA705992CEECF9C42, 0x979CF3CA6CEC5B5A},  // 1e-226\n        {0x50C6FF782A838353, 0xBD8430BD08277231},  // 1e-225\n        {0xA4F8BF5635246428, 0xECE53CEC4A314EBD},  // 1e-224\n        {0x871B7795E136BE99, 0x940F4613AE5ED136},  // 1e-223\n        {0x28E2557B59846E3F, 0xB913179899F68584},  // 1e-222\n        {0x331AEADA2FE589CF, 0xE757DD7EC07426E5},  // 1e-221\n        {0x3FF0D2C85DEF7621, 0x9096EA6F3848984F},  // 1e-220\n        {0x0FED077A756B53A9, 0xB4BCA50B065ABE63},  // 1e-219\n        {0xD3E8495912C62894, 0xE1EBCE4DC7F16DFB},  // 1e-218\n        {0x64712DD7ABBBD95C, 0x8D3360F09CF6E4BD},  // 1e-217\n        {0xBD8D794D96AACFB3, 0xB080392CC4349DEC},  // 1e-216\n        {0xECF0D7A0FC5583A0, 0xDCA04777F541C567},  // 1e-215\n        {0xF41686C49DB57244, 0x89E42CAAF9491B60},  // 1e-214\n        {0x311C2875C522CED5, 0xAC5D37D5B79B6239},  // 1e-213\n        {0x7D633293366B828B, 0xD77485CB25823AC7},  // 1e-212\n " +
+	"       {0xAE5DFF9C02033197, 0x86A8D39EF77164BC},  // 1e-211\n        {0xD9F57F830283FDFC, 0xA8530886B54DBDEB},  // 1e-210\n        {0xD072DF63C324FD7B, 0xD267CAA862A12D66},  // 1e-209\n        {0x4247CB9E59F71E6D, 0x8380DEA93DA4BC60},  // 1e-208\n        {0x52D9BE85F074E608, 0xA46116538D0DEB78},  // 1e-207\n        {0x67902E276C921F8B, 0xCD795BE870516656},  // 1e-206\n        {0x00BA1CD8A3DB53B6, 0x806BD9714632DFF6},  // 1e-205\n        {0x80E8A40ECCD228A4, 0xA086CFCD97BF97F3},  // 1e-204\n        {0x6122CD128006B2CD, 0xC8A883C0FDAF7DF0},  // 1e-203\n        {0x796B805720085F81, 0xFAD2A4B13D1B5D6C},  // 1e-202\n        {0xCBE3303674053BB0, 0x9CC3A6EEC6311A63},  // 1e-201\n        {0xBEDBFC4411068A9C, 0xC3F490AA77BD60FC},  // 1e-200\n        {0xEE92FB5515482D44, 0xF4F1B4D515ACB93B},  // 1e-199\n        {0x751BDD152D4D1C4A, 0x991711052D8BF3C5},  // 1e-198\n        {0xD262D45A78A0635D, 0xBF5CD54678EEF0B6},  // 1e-197\n        {0x86FB897116C87C34, 0xEF340A98172AACE4},  // 1e-196\n        {0xD45D35E6AE3D4DA0, 0x9580869F0E7AAC0E}," +
+	"  // 1e-195\n        {0x8974836059CCA109, 0xBAE0A846D2195712},  // 1e-194\n        {0x2BD1A438703FC94B, 0xE998D258869FACD7},  // 1e-193\n        {0x7B6306A34627DDCF, 0x91FF83775423CC06},  // 1e-192\n        {0x1A3BC84C17B1D542, 0xB67F6455292CBF08},  // 1e-191\n        {0x20CABA5F1D9E4A93, 0xE41F3D6A7377EECA},  // 1e-190\n        {0x547EB47B7282EE9C, 0x8E938662882AF53E},  // 1e-189\n        {0xE99E619A4F23AA43, 0xB23867FB2A35B28D},  // 1e-188\n        {0x6405FA00E2EC94D4, 0xDEC681F9F4C31F31},  // 1e-187\n        {0xDE83BC408DD3DD04, 0x8B3C113C38F9F37E},  // 1e-186\n        {0x9624AB50B148D445, 0xAE0B158B4738705E},  // 1e-185\n        {0x3BADD624DD9B0957, 0xD98DDAEE19068C76},  // 1e-184\n        {0xE54CA5D70A80E5D6, 0x87F8A8D4CFA417C9},  // 1e-183\n        {0x5E9FCF4CCD211F4C, 0xA9F6D30A038D1DBC},  // 1e-182\n        {0x7647C3200069671F, 0xD47487CC8470652B},  // 1e-181\n        {0x29ECD9F40041E073, 0x84C8D4DFD2C63F3B},  // 1e-180\n        {0xF468107100525890, 0xA5FB0A17C777CF09},  // 1e-179\n        {0x7182148D4066EEB4, 0xCF79C" +
+	"C9DB955C2CC},  // 1e-178\n        {0xC6F14CD848405530, 0x81AC1FE293D599BF},  // 1e-177\n        {0xB8ADA00E5A506A7C, 0xA21727DB38CB002F},  // 1e-176\n        {0xA6D90811F0E4851C, 0xCA9CF1D206FDC03B},  // 1e-175\n        {0x908F4A166D1DA663, 0xFD442E4688BD304A},  // 1e-174\n        {0x9A598E4E043287FE, 0x9E4A9CEC15763E2E},  // 1e-173\n        {0x40EFF1E1853F29FD, 0xC5DD44271AD3CDBA},  // 1e-172\n        {0xD12BEE59E68EF47C, 0xF7549530E188C128},  // 1e-171\n        {0x82BB74F8301958CE, 0x9A94DD3E8CF578B9},  // 1e-170\n        {0xE36A52363C1FAF01, 0xC13A148E3032D6E7},  // 1e-169\n        {0xDC44E6C3CB279AC1, 0xF18899B1BC3F8CA1},  // 1e-168\n        {0x29AB103A5EF8C0B9, 0x96F5600F15A7B7E5},  // 1e-167\n        {0x7415D448F6B6F0E7, 0xBCB2B812DB11A5DE},  // 1e-166\n        {0x111B495B3464AD21, 0xEBDF661791D60F56},  // 1e-165\n        {0xCAB10DD900BEEC34, 0x936B9FCEBB25C995},  // 1e-164\n        {0x3D5D514F40EEA742, 0xB84687C269EF3BFB},  // 1e-163\n        {0x0CB4A5A3112A5112, 0xE65829B3046B0AFA},  // 1e-162\n        {0x47F0E785EABA" +
+	"72AB, 0x8FF71A0FE2C2E6DC},  // 1e-161\n        {0x59ED216765690F56, 0xB3F4E093DB73A093},  // 1e-160\n        {0x306869C13EC3532C, 0xE0F218B8D25088B8},  // 1e-159\n        {0x1E414218C73A13FB, 0x8C974F7383725573},  // 1e-158\n        {0xE5D1929EF90898FA, 0xAFBD2350644EEACF},  // 1e-157\n        {0xDF45F746B74ABF39, 0xDBAC6C247D62A583},  // 1e-156\n        {0x6B8BBA8C328EB783, 0x894BC396CE5DA772},  // 1e-155\n        {0x066EA92F3F326564, 0xAB9EB47C81F5114F},  // 1e-154\n        {0xC80A537B0EFEFEBD, 0xD686619BA27255A2},  // 1e-153\n        {0xBD06742CE95F5F36, 0x8613FD0145877585},  // 1e-152\n        {0x2C48113823B73704, 0xA798FC4196E952E7},  // 1e-151\n        {0xF75A15862CA504C5, 0xD17F3B51FCA3A7A0},  // 1e-150\n        {0x9A984D73DBE722FB, 0x82EF85133DE648C4},  // 1e-149\n        {0xC13E60D0D2E0EBBA, 0xA3AB66580D5FDAF5},  // 1e-148\n        {0x318DF905079926A8, 0xCC963FEE10B7D1B3},  // 1e-147\n        {0xFDF17746497F7052, 0xFFBBCFE994E5C61F},  // 1e-146\n        {0xFEB6EA8BEDEFA633, 0x9FD561F1FD0F9BD3},  // 1e-145\n        {0" +
+	"xFE64A52EE96B8FC0, 0xC7CABA6E7C5382C8},  // 1e-144\n        {0x3DFDCE7AA3C673B0, 0xF9BD690A1B68637B},  // 1e-143\n        {0x06BEA10CA65C084E, 0x9C1661A651213E2D},  // 1e-142\n        {0x486E494FCFF30A62, 0xC31BFA0FE5698DB8},  // 1e-141\n        {0x5A89DBA3C3EFCCFA, 0xF3E2F893DEC3F126},  // 1e-140\n        {0xF89629465A75E01C, 0x986DDB5C6B3A76B7},  // 1e-139\n        {0xF6BBB397F1135823, 0xBE89523386091465},  // 1e-138\n        {0x746AA07DED582E2C, 0xEE2BA6C0678B597F},  // 1e-137\n        {0xA8C2A44EB4571CDC, 0x94DB483840B717EF},  // 1e-136\n        {0x92F34D62616CE413, 0xBA121A4650E4DDEB},  // 1e-135\n        {0x77B020BAF9C81D17, 0xE896A0D7E51E1566},  // 1e-134\n        {0x0ACE1474DC1D122E, 0x915E2486EF32CD60},  // 1e-133\n        {0x0D819992132456BA, 0xB5B5ADA8AAFF80B8},  // 1e-132\n        {0x10E1FFF697ED6C69, 0xE3231912D5BF60E6},  // 1e-131\n        {0xCA8D3FFA1EF463C1, 0x8DF5EFABC5979C8F},  // 1e-130\n        {0xBD308FF8A6B17CB2, 0xB1736B96B6FD83B3},  // 1e-129\n        {0xAC7CB3F6D05DDBDE, 0xDDD0467C64BCE4A0},  // 1e-1" +
+	"28\n        {0x6BCDF07A423AA96B, 0x8AA22C0DBEF60EE4},  // 1e-127\n        {0x86C16C98D2C953C6, 0xAD4AB7112EB3929D},  // 1e-126\n        {0xE871C7BF077BA8B7, 0xD89D64D57A607744},  // 1e-125\n        {0x11471CD764AD4972, 0x87625F056C7C4A8B},  // 1e-124\n        {0xD598E40D3DD89BCF, 0xA93AF6C6C79B5D2D},  // 1e-123\n        {0x4AFF1D108D4EC2C3, 0xD389B47879823479},  // 1e-122\n        {0xCEDF722A585139BA, 0x843610CB4BF160CB},  // 1e-121\n        {0xC2974EB4EE658828, 0xA54394FE1EEDB8FE},  // 1e-120\n        {0x733D226229FEEA32, 0xCE947A3DA6A9273E},  // 1e-119\n        {0x0806357D5A3F525F, 0x811CCC668829B887},  // 1e-118\n        {0xCA07C2DCB0CF26F7, 0xA163FF802A3426A8},  // 1e-117\n        {0xFC89B393DD02F0B5, 0xC9BCFF6034C13052},  // 1e-116\n        {0xBBAC2078D443ACE2, 0xFC2C3F3841F17C67},  // 1e-115\n        {0xD54B944B84AA4C0D, 0x9D9BA7832936EDC0},  // 1e-114\n        {0x0A9E795E65D4DF11, 0xC5029163F384A931},  // 1e-113\n        {0x4D4617B5FF4A16D5, 0xF64335BCF065D37D},  // 1e-112\n        {0x504BCED1BF8E4E45, 0x99EA0196163FA4" +
+	"2E},  // 1e-111\n        {0xE45EC2862F71E1D6, 0xC06481FB9BCF8D39},  // 1e-110\n        {0x5D767327BB4E5A4C, 0xF07DA27A82C37088},  // 1e-109\n        {0x3A6A07F8D510F86F, 0x964E858C91BA2655},  // 1e-108\n        {0x890489F70A55368B, 0xBBE226EFB628AFEA},  // 1e-107\n        {0x2B45AC74CCEA842E, 0xEADAB0ABA3B2DBE5},  // 1e-106\n        {0x3B0B8BC90012929D, 0x92C8AE6B464FC96F},  // 1e-105\n        {0x09CE6EBB40173744, 0xB77ADA0617E3BBCB},  // 1e-104\n        {0xCC420A6A101D0515, 0xE55990879DDCAABD},  // 1e-103\n        {0x9FA946824A12232D, 0x8F57FA54C2A9EAB6},  // 1e-102\n        {0x47939822DC96ABF9, 0xB32DF8E9F3546564},  // 1e-101\n        {0x59787E2B93BC56F7, 0xDFF9772470297EBD},  // 1e-100\n        {0x57EB4EDB3C55B65A, 0x8BFBEA76C619EF36},  // 1e-99\n        {0xEDE622920B6B23F1, 0xAEFAE51477A06B03},  // 1e-98\n        {0xE95FAB368E45ECED, 0xDAB99E59958885C4},  // 1e-97\n        {0x11DBCB0218EBB414, 0x88B402F7FD75539B},  // 1e-96\n        {0xD652BDC29F26A119, 0xAAE103B5FCD2A881},  // 1e-95\n        {0x4BE76D3346F0495F, 0xD59944" +
+	"A37C0752A2},  // 1e-94\n        {0x6F70A4400C562DDB, 0x857FCAE62D8493A5},  // 1e-93\n        {0xCB4CCD500F6BB952, 0xA6DFBD9FB8E5B88E},  // 1e-92\n        {0x7E2000A41346A7A7, 0xD097AD07A71F26B2},  // 1e-91\n        {0x8ED400668C0C28C8, 0x825ECC24C873782F},  // 1e-90\n        {0x728900802F0F32FA, 0xA2F67F2DFA90563B},  // 1e-89\n        {0x4F2B40A03AD2FFB9, 0xCBB41EF979346BCA},  // 1e-88\n        {0xE2F610C84987BFA8, 0xFEA126B7D78186BC},  // 1e-87\n        {0x0DD9CA7D2DF4D7C9, 0x9F24B832E6B0F436},  // 1e-86\n        {0x91503D1C79720DBB, 0xC6EDE63FA05D3143},  // 1e-85\n        {0x75A44C6397CE912A, 0xF8A95FCF88747D94},  // 1e-84\n        {0xC986AFBE3EE11ABA, 0x9B69DBE1B548CE7C},  // 1e-83\n        {0xFBE85BADCE996168, 0xC24452DA229B021B},  // 1e-82\n        {0xFAE27299423FB9C3, 0xF2D56790AB41C2A2},  // 1e-81\n        {0xDCCD879FC967D41A, 0x97C560BA6B0919A5},  // 1e-80\n        {0x5400E987BBC1C920, 0xBDB6B8E905CB600F},  // 1e-79\n        {0x290123E9AAB23B68, 0xED246723473E3813},  // 1e-78\n        {0xF9A0B6720AAF6521, 0x9436C0760C" +
+	"86E30B},  // 1e-77\n        {0xF808E40E8D5B3E69, 0xB94470938FA89BCE},  // 1e-76\n        {0xB60B1D1230B20E04, 0xE7958CB87392C2C2},  // 1e-75\n        {0xB1C6F22B5E6F48C2, 0x90BD77F3483BB9B9},  // 1e-74\n        {0x1E38AEB6360B1AF3, 0xB4ECD5F01A4AA828},  // 1e-73\n        {0x25C6DA63C38DE1B0, 0xE2280B6C20DD5232},  // 1e-72\n        {0x579C487E5A38AD0E, 0x8D590723948A535F},  // 1e-71\n        {0x2D835A9DF0C6D851, 0xB0AF48EC79ACE837},  // 1e-70\n        {0xF8E431456CF88E65, 0xDCDB1B2798182244},  // 1e-69\n        {0x1B8E9ECB641B58FF, 0x8A08F0F8BF0F156B},  // 1e-68\n        {0xE272467E3D222F3F, 0xAC8B2D36EED2DAC5},  // 1e-67\n        {0x5B0ED81DCC6ABB0F, 0xD7ADF884AA879177},  // 1e-66\n        {0x98E947129FC2B4E9, 0x86CCBB52EA94BAEA},  // 1e-65\n        {0x3F2398D747B36224, 0xA87FEA27A539E9A5},  // 1e-64\n        {0x8EEC7F0D19A03AAD, 0xD29FE4B18E88640E},  // 1e-63\n        {0x1953CF68300424AC, 0x83A3EEEEF9153E89},  // 1e-62\n        {0x5FA8C3423C052DD7, 0xA48CEAAAB75A8E2B},  // 1e-61\n        {0x3792F412CB06794D, 0xCDB02555653131" +
+	"B6},  // 1e-60\n        {0xE2BBD88BBEE40BD0, 0x808E17555F3EBF11},  // 1e-59\n        {0x5B6ACEAEAE9D0EC4, 0xA0B19D2AB70E6ED6},  // 1e-58\n        {0xF245825A5A445275, 0xC8DE047564D20A8B},  // 1e-57\n        {0xEED6E2F0F0D56712, 0xFB158592BE068D2E},  // 1e-56\n        {0x55464DD69685606B, 0x9CED737BB6C4183D},  // 1e-55\n        {0xAA97E14C3C26B886, 0xC428D05AA4751E4C},  // 1e-54\n        {0xD53DD99F4B3066A8, 0xF53304714D9265DF},  // 1e-53\n        {0xE546A8038EFE4029, 0x993FE2C6D07B7FAB},  // 1e-52\n        {0xDE98520472BDD033, 0xBF8FDB78849A5F96},  // 1e-51\n        {0x963E66858F6D4440, 0xEF73D256A5C0F77C},  // 1e-50\n        {0xDDE7001379A44AA8, 0x95A8637627989AAD},  // 1e-49\n        {0x5560C018580D5D52, 0xBB127C53B17EC159},  // 1e-48\n        {0xAAB8F01E6E10B4A6, 0xE9D71B689DDE71AF},  // 1e-47\n        {0xCAB3961304CA70E8, 0x9226712162AB070D},  // 1e-46\n        {0x3D607B97C5FD0D22, 0xB6B00D69BB55C8D1},  // 1e-45\n        {0x8CB89A7DB77C506A, 0xE45C10C42A2B3B05},  // 1e-44\n        {0x77F3608E92ADB242, 0x8EB98A7A9A5B04E3}," +
+	"  // 1e-43\n        {0x55F038B237591ED3, 0xB267ED1940F1C61C},  // 1e-42\n        {0x6B6C46DEC52F6688, 0xDF01E85F912E37A3},  // 1e-41\n        {0x2323AC4B3B3DA015, 0x8B61313BBABCE2C6},  // 1e-40\n        {0xABEC975E0A0D081A, 0xAE397D8AA96C1B77},  // 1e-39\n        {0x96E7BD358C904A21, 0xD9C7DCED53C72255},  // 1e-38\n        {0x7E50D64177DA2E54, 0x881CEA14545C7575},  // 1e-37\n        {0xDDE50BD1D5D0B9E9, 0xAA242499697392D2},  // 1e-36\n        {0x955E4EC64B44E864, 0xD4AD2DBFC3D07787},  // 1e-35\n        {0xBD5AF13BEF0B113E, 0x84EC3C97DA624AB4},  // 1e-34\n        {0xECB1AD8AEACDD58E, 0xA6274BBDD0FADD61},  // 1e-33\n        {0x67DE18EDA5814AF2, 0xCFB11EAD453994BA},  // 1e-32\n        {0x80EACF948770CED7, 0x81CEB32C4B43FCF4},  // 1e-31\n        {0xA1258379A94D028D, 0xA2425FF75E14FC31},  // 1e-30\n        {0x096EE45813A04330, 0xCAD2F7F5359A3B3E},  // 1e-29\n        {0x8BCA9D6E188853FC, 0xFD87B5F28300CA0D},  // 1e-28\n        {0x775EA264CF55347D, 0x9E74D1B791E07E48},  // 1e-27\n        {0x95364AFE032A819D, 0xC612062576589DDA},  //" +
+	" 1e-26\n        {0x3A83DDBD83F52204, 0xF79687AED3EEC551},  // 1e-25\n        {0xC4926A9672793542, 0x9ABE14CD44753B52},  // 1e-24\n        {0x75B7053C0F178293, 0xC16D9A0095928A27},  // 1e-23\n        {0x5324C68B12DD6338, 0xF1C90080BAF72CB1},  // 1e-22\n        {0xD3F6FC16EBCA5E03, 0x971DA05074DA7BEE},  // 1e-21\n        {0x88F4BB1CA6BCF584, 0xBCE5086492111AEA},  // 1e-20\n        {0x2B31E9E3D06C32E5, 0xEC1E4A7DB69561A5},  // 1e-19\n        {0x3AFF322E62439FCF, 0x9392EE8E921D5D07},  // 1e-18\n        {0x09BEFEB9FAD487C2, 0xB877AA3236A4B449},  // 1e-17\n        {0x4C2EBE687989A9B3, 0xE69594BEC44DE15B},  // 1e-16\n        {0x0F9D37014BF60A10, 0x901D7CF73AB0ACD9},  // 1e-15\n        {0x538484C19EF38C94, 0xB424DC35095CD80F},  // 1e-14\n        {0x2865A5F206B06FB9, 0xE12E13424BB40E13},  // 1e-13\n        {0xF93F87B7442E45D3, 0x8CBCCC096F5088CB},  // 1e-12\n        {0xF78F69A51539D748, 0xAFEBFF0BCB24AAFE},  // 1e-11\n        {0xB573440E5A884D1B, 0xDBE6FECEBDEDD5BE},  // 1e-10\n        {0x31680A88F8953030, 0x89705F4136B4A597},  // 1e-" +
+	"9\n        {0xFDC20D2B36BA7C3D, 0xABCC77118461CEFC},  // 1e-8\n        {0x3D32907604691B4C, 0xD6BF94D5E57A42BC},  // 1e-7\n        {0xA63F9A49C2C1B10F, 0x8637BD05AF6C69B5},  // 1e-6\n        {0x0FCF80DC33721D53, 0xA7C5AC471B478423},  // 1e-5\n        {0xD3C36113404EA4A8, 0xD1B71758E219652B},  // 1e-4\n        {0x645A1CAC083126E9, 0x83126E978D4FDF3B},  // 1e-3\n        {0x3D70A3D70A3D70A3, 0xA3D70A3D70A3D70A},  // 1e-2\n        {0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCC},  // 1e-1\n        {0x0000000000000000, 0x8000000000000000},  // 1e0\n        {0x0000000000000000, 0xA000000000000000},  // 1e1\n        {0x0000000000000000, 0xC800000000000000},  // 1e2\n        {0x0000000000000000, 0xFA00000000000000},  // 1e3\n        {0x0000000000000000, 0x9C40000000000000},  // 1e4\n        {0x0000000000000000, 0xC350000000000000},  // 1e5\n        {0x0000000000000000, 0xF424000000000000},  // 1e6\n        {0x0000000000000000, 0x9896800000000000},  // 1e7\n        {0x0000000000000000, 0xBEBC200000000000},  // 1e8\n        {0x0000000000000000," +
+	" 0xEE6B280000000000},  // 1e9\n        {0x0000000000000000, 0x9502F90000000000},  // 1e10\n        {0x0000000000000000, 0xBA43B74000000000},  // 1e11\n        {0x0000000000000000, 0xE8D4A51000000000},  // 1e12\n        {0x0000000000000000, 0x9184E72A00000000},  // 1e13\n        {0x0000000000000000, 0xB5E620F480000000},  // 1e14\n        {0x0000000000000000, 0xE35FA931A0000000},  // 1e15\n        {0x0000000000000000, 0x8E1BC9BF04000000},  // 1e16\n        {0x0000000000000000, 0xB1A2BC2EC5000000},  // 1e17\n        {0x0000000000000000, 0xDE0B6B3A76400000},  // 1e18\n        {0x0000000000000000, 0x8AC7230489E80000},  // 1e19\n        {0x0000000000000000, 0xAD78EBC5AC620000},  // 1e20\n        {0x0000000000000000, 0xD8D726B7177A8000},  // 1e21\n        {0x0000000000000000, 0x878678326EAC9000},  // 1e22\n        {0x0000000000000000, 0xA968163F0A57B400},  // 1e23\n        {0x0000000000000000, 0xD3C21BCECCEDA100},  // 1e24\n        {0x0000000000000000, 0x84595161401484A0},  // 1e25\n        {0x0000000000000000, 0xA56FA5B99019A5C8}, " +
+	" // 1e26\n        {0x0000000000000000, 0xCECB8F27F4200F3A},  // 1e27\n        {0x4000000000000000, 0x813F3978F8940984},  // 1e28\n        {0x5000000000000000, 0xA18F07D736B90BE5},  // 1e29\n        {0xA400000000000000, 0xC9F2C9CD04674EDE},  // 1e30\n        {0x4D00000000000000, 0xFC6F7C4045812296},  // 1e31\n        {0xF020000000000000, 0x9DC5ADA82B70B59D},  // 1e32\n        {0x6C28000000000000, 0xC5371912364CE305},  // 1e33\n        {0xC732000000000000, 0xF684DF56C3E01BC6},  // 1e34\n        {0x3C7F400000000000, 0x9A130B963A6C115C},  // 1e35\n        {0x4B9F100000000000, 0xC097CE7BC90715B3},  // 1e36\n        {0x1E86D40000000000, 0xF0BDC21ABB48DB20},  // 1e37\n        {0x1314448000000000, 0x96769950B50D88F4},  // 1e38\n        {0x17D955A000000000, 0xBC143FA4E250EB31},  // 1e39\n        {0x5DCFAB0800000000, 0xEB194F8E1AE525FD},  // 1e40\n        {0x5AA1CAE500000000, 0x92EFD1B8D0CF37BE},  // 1e41\n        {0xF14A3D9E40000000, 0xB7ABC627050305AD},  // 1e42\n        {0x6D9CCD05D0000000, 0xE596B7B0C643C719},  // 1e43\n        {0xE" +
+	"4820023A2000000, 0x8F7E32CE7BEA5C6F},  // 1e44\n        {0xDDA2802C8A800000, 0xB35DBF821AE4F38B},  // 1e45\n        {0xD50B2037AD200000, 0xE0352F62A19E306E},  // 1e46\n        {0x4526F422CC340000, 0x8C213D9DA502DE45},  // 1e47\n        {0x9670B12B7F410000, 0xAF298D050E4395D6},  // 1e48\n        {0x3C0CDD765F114000, 0xDAF3F04651D47B4C},  // 1e49\n        {0xA5880A69FB6AC800, 0x88D8762BF324CD0F},  // 1e50\n        {0x8EEA0D047A457A00, 0xAB0E93B6EFEE0053},  // 1e51\n        {0x72A4904598D6D880, 0xD5D238A4ABE98068},  // 1e52\n        {0x47A6DA2B7F864750, 0x85A36366EB71F041},  // 1e53\n        {0x999090B65F67D924, 0xA70C3C40A64E6C51},  // 1e54\n        {0xFFF4B4E3F741CF6D, 0xD0CF4B50CFE20765},  // 1e55\n        {0xBFF8F10E7A8921A4, 0x82818F1281ED449F},  // 1e56\n        {0xAFF72D52192B6A0D, 0xA321F2D7226895C7},  // 1e57\n        {0x9BF4F8A69F764490, 0xCBEA6F8CEB02BB39},  // 1e58\n        {0x02F236D04753D5B4, 0xFEE50B7025C36A08},  // 1e59\n        {0x01D762422C946590, 0x9F4F2726179A2245},  // 1e60\n        {0x424D3AD2B7B97EF5, 0xC7" +
+	"22F0EF9D80AAD6},  // 1e61\n        {0xD2E0898765A7DEB2, 0xF8EBAD2B84E0D58B},  // 1e62\n        {0x63CC55F49F88EB2F, 0x9B934C3B330C8577},  // 1e63\n        {0x3CBF6B71C76B25FB, 0xC2781F49FFCFA6D5},  // 1e64\n        {0x8BEF464E3945EF7A, 0xF316271C7FC3908A},  // 1e65\n        {0x97758BF0E3CBB5AC, 0x97EDD871CFDA3A56},  // 1e66\n        {0x3D52EEED1CBEA317, 0xBDE94E8E43D0C8EC},  // 1e67\n        {0x4CA7AAA863EE4BDD, 0xED63A231D4C4FB27},  // 1e68\n        {0x8FE8CAA93E74EF6A, 0x945E455F24FB1CF8},  // 1e69\n        {0xB3E2FD538E122B44, 0xB975D6B6EE39E436},  // 1e70\n        {0x60DBBCA87196B616, 0xE7D34C64A9C85D44},  // 1e71\n        {0xBC8955E946FE31CD, 0x90E40FBEEA1D3A4A},  // 1e72\n        {0x6BABAB6398BDBE41, 0xB51D13AEA4A488DD},  // 1e73\n        {0xC696963C7EED2DD1, 0xE264589A4DCDAB14},  // 1e74\n        {0xFC1E1DE5CF543CA2, 0x8D7EB76070A08AEC},  // 1e75\n        {0x3B25A55F43294BCB, 0xB0DE65388CC8ADA8},  // 1e76\n        {0x49EF0EB713F39EBE, 0xDD15FE86AFFAD912},  // 1e77\n        {0x6E3569326C784337, 0x8A2DBF142DFCC7AB},  // " +
+	"1e78\n        {0x49C2C37F07965404, 0xACB92ED9397BF996},  // 1e79\n        {0xDC33745EC97BE906, 0xD7E77A8F87DAF7FB},  // 1e80\n        {0x69A028BB3DED71A3, 0x86F0AC99B4E8DAFD},  // 1e81\n        {0xC40832EA0D68CE0C, 0xA8ACD7C0222311BC},  // 1e82\n        {0xF50A3FA490C30190, 0xD2D80DB02AABD62B},  // 1e83\n        {0x792667C6DA79E0FA, 0x83C7088E1AAB65DB},  // 1e84\n        {0x577001B891185938, 0xA4B8CAB1A1563F52},  // 1e85\n        {0xED4C0226B55E6F86, 0xCDE6FD5E09ABCF26},  // 1e86\n        {0x544F8158315B05B4, 0x80B05E5AC60B6178},  // 1e87\n        {0x696361AE3DB1C721, 0xA0DC75F1778E39D6},  // 1e88\n        {0x03BC3A19CD1E38E9, 0xC913936DD571C84C},  // 1e89\n        {0x04AB48A04065C723, 0xFB5878494ACE3A5F},  // 1e90\n        {0x62EB0D64283F9C76, 0x9D174B2DCEC0E47B},  // 1e91\n        {0x3BA5D0BD324F8394, 0xC45D1DF942711D9A},  // 1e92\n        {0xCA8F44EC7EE36479, 0xF5746577930D6500},  // 1e93\n        {0x7E998B13CF4E1ECB, 0x9968BF6ABBE85F20},  // 1e94\n        {0x9E3FEDD8C321A67E, 0xBFC2EF456AE276E8},  // 1e95\n        {0xC5CFE" +
+	"94EF3EA101E, 0xEFB3AB16C59B14A2},  // 1e96\n        {0xBBA1F1D158724A12, 0x95D04AEE3B80ECE5},  // 1e97\n        {0x2A8A6E45AE8EDC97, 0xBB445DA9CA61281F},  // 1e98\n        {0xF52D09D71A3293BD, 0xEA1575143CF97226},  // 1e99\n        {0x593C2626705F9C56, 0x924D692CA61BE758},  // 1e100\n        {0x6F8B2FB00C77836C, 0xB6E0C377CFA2E12E},  // 1e101\n        {0x0B6DFB9C0F956447, 0xE498F455C38B997A},  // 1e102\n        {0x4724BD4189BD5EAC, 0x8EDF98B59A373FEC},  // 1e103\n        {0x58EDEC91EC2CB657, 0xB2977EE300C50FE7},  // 1e104\n        {0x2F2967B66737E3ED, 0xDF3D5E9BC0F653E1},  // 1e105\n        {0xBD79E0D20082EE74, 0x8B865B215899F46C},  // 1e106\n        {0xECD8590680A3AA11, 0xAE67F1E9AEC07187},  // 1e107\n        {0xE80E6F4820CC9495, 0xDA01EE641A708DE9},  // 1e108\n        {0x3109058D147FDCDD, 0x884134FE908658B2},  // 1e109\n        {0xBD4B46F0599FD415, 0xAA51823E34A7EEDE},  // 1e110\n        {0x6C9E18AC7007C91A, 0xD4E5E2CDC1D1EA96},  // 1e111\n        {0x03E2CF6BC604DDB0, 0x850FADC09923329E},  // 1e112\n        {0x84DB8346B7861" +
+	"51C, 0xA6539930BF6BFF45},  // 1e113\n        {0xE612641865679A63, 0xCFE87F7CEF46FF16},  // 1e114\n        {0x4FCB7E8F3F60C07E, 0x81F14FAE158C5F6E},  // 1e115\n        {0xE3BE5E330F38F09D, 0xA26DA3999AEF7749},  // 1e116\n        {0x5CADF5BFD3072CC5, 0xCB090C8001AB551C},  // 1e117\n        {0x73D9732FC7C8F7F6, 0xFDCB4FA002162A63},  // 1e118\n        {0x2867E7FDDCDD9AFA, 0x9E9F11C4014DDA7E},  // 1e119\n        {0xB281E1FD541501B8, 0xC646D63501A1511D},  // 1e120\n        {0x1F225A7CA91A4226, 0xF7D88BC24209A565},  // 1e121\n        {0x3375788DE9B06958, 0x9AE757596946075F},  // 1e122\n        {0x0052D6B1641C83AE, 0xC1A12D2FC3978937},  // 1e123\n        {0xC0678C5DBD23A49A, 0xF209787BB47D6B84},  // 1e124\n        {0xF840B7BA963646E0, 0x9745EB4D50CE6332},  // 1e125\n        {0xB650E5A93BC3D898, 0xBD176620A501FBFF},  // 1e126\n        {0xA3E51F138AB4CEBE, 0xEC5D3FA8CE427AFF},  // 1e127\n        {0xC66F336C36B10137, 0x93BA47C980E98CDF},  // 1e128\n        {0xB80B0047445D4184, 0xB8A8D9BBE123F017},  // 1e129\n        {0xA60DC059157491E5," +
+	" 0xE6D3102AD96CEC1D},  // 1e130\n        {0x87C89837AD68DB2F, 0x9043EA1AC7E41392},  // 1e131\n        {0x29BABE4598C311FB, 0xB454E4A179DD1877},  // 1e132\n        {0xF4296DD6FEF3D67A, 0xE16A1DC9D8545E94},  // 1e133\n        {0x1899E4A65F58660C, 0x8CE2529E2734BB1D},  // 1e134\n        {0x5EC05DCFF72E7F8F, 0xB01AE745B101E9E4},  // 1e135\n        {0x76707543F4FA1F73, 0xDC21A1171D42645D},  // 1e136\n        {0x6A06494A791C53A8, 0x899504AE72497EBA},  // 1e137\n        {0x0487DB9D17636892, 0xABFA45DA0EDBDE69},  // 1e138\n        {0x45A9D2845D3C42B6, 0xD6F8D7509292D603},  // 1e139\n        {0x0B8A2392BA45A9B2, 0x865B86925B9BC5C2},  // 1e140\n        {0x8E6CAC7768D7141E, 0xA7F26836F282B732},  // 1e141\n        {0x3207D795430CD926, 0xD1EF0244AF2364FF},  // 1e142\n        {0x7F44E6BD49E807B8, 0x8335616AED761F1F},  // 1e143\n        {0x5F16206C9C6209A6, 0xA402B9C5A8D3A6E7},  // 1e144\n        {0x36DBA887C37A8C0F, 0xCD036837130890A1},  // 1e145\n        {0xC2494954DA2C9789, 0x802221226BE55A64},  // 1e146\n        {0xF2DB9BAA10B7BD6C, 0xA" +
+	"02AA96B06DEB0FD},  // 1e147\n        {0x6F92829494E5ACC7, 0xC83553C5C8965D3D},  // 1e148\n        {0xCB772339BA1F17F9, 0xFA42A8B73ABBF48C},  // 1e149\n        {0xFF2A760414536EFB, 0x9C69A97284B578D7},  // 1e150\n        {0xFEF5138519684ABA, 0xC38413CF25E2D70D},  // 1e151\n        {0x7EB258665FC25D69, 0xF46518C2EF5B8CD1},  // 1e152\n        {0xEF2F773FFBD97A61, 0x98BF2F79D5993802},  // 1e153\n        {0xAAFB550FFACFD8FA, 0xBEEEFB584AFF8603},  // 1e154\n        {0x95BA2A53F983CF38, 0xEEAABA2E5DBF6784},  // 1e155\n        {0xDD945A747BF26183, 0x952AB45CFA97A0B2},  // 1e156\n        {0x94F971119AEEF9E4, 0xBA756174393D88DF},  // 1e157\n        {0x7A37CD5601AAB85D, 0xE912B9D1478CEB17},  // 1e158\n        {0xAC62E055C10AB33A, 0x91ABB422CCB812EE},  // 1e159\n        {0x577B986B314D6009, 0xB616A12B7FE617AA},  // 1e160\n        {0xED5A7E85FDA0B80B, 0xE39C49765FDF9D94},  // 1e161\n        {0x14588F13BE847307, 0x8E41ADE9FBEBC27D},  // 1e162\n        {0x596EB2D8AE258FC8, 0xB1D219647AE6B31C},  // 1e163\n        {0x6FCA5F8ED9AEF3BB, 0xDE469" +
+	"FBD99A05FE3},  // 1e164\n        {0x25DE7BB9480D5854, 0x8AEC23D680043BEE},  // 1e165\n        {0xAF561AA79A10AE6A, 0xADA72CCC20054AE9},  // 1e166\n        {0x1B2BA1518094DA04, 0xD910F7FF28069DA4},  // 1e167\n        {0x90FB44D2F05D0842, 0x87AA9AFF79042286},  // 1e168\n        {0x353A1607AC744A53, 0xA99541BF57452B28},  // 1e169\n        {0x42889B8997915CE8, 0xD3FA922F2D1675F2},  // 1e170\n        {0x69956135FEBADA11, 0x847C9B5D7C2E09B7},  // 1e171\n        {0x43FAB9837E699095, 0xA59BC234DB398C25},  // 1e172\n        {0x94F967E45E03F4BB, 0xCF02B2C21207EF2E},  // 1e173\n        {0x1D1BE0EEBAC278F5, 0x8161AFB94B44F57D},  // 1e174\n        {0x6462D92A69731732, 0xA1BA1BA79E1632DC},  // 1e175\n        {0x7D7B8F7503CFDCFE, 0xCA28A291859BBF93},  // 1e176\n        {0x5CDA735244C3D43E, 0xFCB2CB35E702AF78},  // 1e177\n        {0x3A0888136AFA64A7, 0x9DEFBF01B061ADAB},  // 1e178\n        {0x088AAA1845B8FDD0, 0xC56BAEC21C7A1916},  // 1e179\n        {0x8AAD549E57273D45, 0xF6C69A72A3989F5B},  // 1e180\n        {0x36AC54E2F678864B, 0x9A3C2087A" +
+	"63F6399},  // 1e181\n        {0x84576A1BB416A7DD, 0xC0CB28A98FCF3C7F},  // 1e182\n        {0x656D44A2A11C51D5, 0xF0FDF2D3F3C30B9F},  // 1e183\n        {0x9F644AE5A4B1B325, 0x969EB7C47859E743},  // 1e184\n        {0x873D5D9F0DDE1FEE, 0xBC4665B596706114},  // 1e185\n        {0xA90CB506D155A7EA, 0xEB57FF22FC0C7959},  // 1e186\n        {0x09A7F12442D588F2, 0x9316FF75DD87CBD8},  // 1e187\n        {0x0C11ED6D538AEB2F, 0xB7DCBF5354E9BECE},  // 1e188\n        {0x8F1668C8A86DA5FA, 0xE5D3EF282A242E81},  // 1e189\n        {0xF96E017D694487BC, 0x8FA475791A569D10},  // 1e190\n        {0x37C981DCC395A9AC, 0xB38D92D760EC4455},  // 1e191\n        {0x85BBE253F47B1417, 0xE070F78D3927556A},  // 1e192\n        {0x93956D7478CCEC8E, 0x8C469AB843B89562},  // 1e193\n        {0x387AC8D1970027B2, 0xAF58416654A6BABB},  // 1e194\n        {0x06997B05FCC0319E, 0xDB2E51BFE9D0696A},  // 1e195\n        {0x441FECE3BDF81F03, 0x88FCF317F22241E2},  // 1e196\n        {0xD527E81CAD7626C3, 0xAB3C2FDDEEAAD25A},  // 1e197\n        {0x8A71E223D8D3B074, 0xD60B3BD56A558" +
+	"6F1},  // 1e198\n        {0xF6872D5667844E49, 0x85C7056562757456},  // 1e199\n        {0xB428F8AC016561DB, 0xA738C6BEBB12D16C},  // 1e200\n        {0xE13336D701BEBA52, 0xD106F86E69D785C7},  // 1e201\n        {0xECC0024661173473, 0x82A45B450226B39C},  // 1e202\n        {0x27F002D7F95D0190, 0xA34D721642B06084},  // 1e203\n        {0x31EC038DF7B441F4, 0xCC20CE9BD35C78A5},  // 1e204\n        {0x7E67047175A15271, 0xFF290242C83396CE},  // 1e205\n        {0x0F0062C6E984D386, 0x9F79A169BD203E41},  // 1e206\n        {0x52C07B78A3E60868, 0xC75809C42C684DD1},  // 1e207\n        {0xA7709A56CCDF8A82, 0xF92E0C3537826145},  // 1e208\n        {0x88A66076400BB691, 0x9BBCC7A142B17CCB},  // 1e209\n        {0x6ACFF893D00EA435, 0xC2ABF989935DDBFE},  // 1e210\n        {0x0583F6B8C4124D43, 0xF356F7EBF83552FE},  // 1e211\n        {0xC3727A337A8B704A, 0x98165AF37B2153DE},  // 1e212\n        {0x744F18C0592E4C5C, 0xBE1BF1B059E9A8D6},  // 1e213\n        {0x1162DEF06F79DF73, 0xEDA2EE1C7064130C},  // 1e214\n        {0x8ADDCB5645AC2BA8, 0x9485D4D1C63E8BE7}" +
+	",  // 1e215\n        {0x6D953E2BD7173692, 0xB9A74A0637CE2EE1},  // 1e216\n        {0xC8FA8DB6CCDD0437, 0xE8111C87C5C1BA99},  // 1e217\n        {0x1D9C9892400A22A2, 0x910AB1D4DB9914A0},  // 1e218\n        {0x2503BEB6D00CAB4B, 0xB54D5E4A127F59C8},  // 1e219\n        {0x2E44AE64840FD61D, 0xE2A0B5DC971F303A},  // 1e220\n        {0x5CEAECFED289E5D2, 0x8DA471A9DE737E24},  // 1e221\n        {0x7425A83E872C5F47, 0xB10D8E1456105DAD},  // 1e222\n        {0xD12F124E28F77719, 0xDD50F1996B947518},  // 1e223\n        {0x82BD6B70D99AAA6F, 0x8A5296FFE33CC92F},  // 1e224\n        {0x636CC64D1001550B, 0xACE73CBFDC0BFB7B},  // 1e225\n        {0x3C47F7E05401AA4E, 0xD8210BEFD30EFA5A},  // 1e226\n        {0x65ACFAEC34810A71, 0x8714A775E3E95C78},  // 1e227\n        {0x7F1839A741A14D0D, 0xA8D9D1535CE3B396},  // 1e228\n        {0x1EDE48111209A050, 0xD31045A8341CA07C},  // 1e229\n        {0x934AED0AAB460432, 0x83EA2B892091E44D},  // 1e230\n        {0xF81DA84D5617853F, 0xA4E4B66B68B65D60},  // 1e231\n        {0x36251260AB9D668E, 0xCE1DE40642E3F4B9},  /" +
+	"/ 1e232\n        {0xC1D72B7C6B426019, 0x80D2AE83E9CE78F3},  // 1e233\n        {0xB24CF65B8612F81F, 0xA1075A24E4421730},  // 1e234\n        {0xDEE033F26797B627, 0xC94930AE1D529CFC},  // 1e235\n        {0x169840EF017DA3B1, 0xFB9B7CD9A4A7443C},  // 1e236\n        {0x8E1F289560EE864E, 0x9D412E0806E88AA5},  // 1e237\n        {0xF1A6F2BAB92A27E2, 0xC491798A08A2AD4E},  // 1e238\n        {0xAE10AF696774B1DB, 0xF5B5D7EC8ACB58A2},  // 1e239\n        {0xACCA6DA1E0A8EF29, 0x9991A6F3D6BF1765},  // 1e240\n        {0x17FD090A58D32AF3, 0xBFF610B0CC6EDD3F},  // 1e241\n        {0xDDFC4B4CEF07F5B0, 0xEFF394DCFF8A948E},  // 1e242\n        {0x4ABDAF101564F98E, 0x95F83D0A1FB69CD9},  // 1e243\n        {0x9D6D1AD41ABE37F1, 0xBB764C4CA7A4440F},  // 1e244\n        {0x84C86189216DC5ED, 0xEA53DF5FD18D5513},  // 1e245\n        {0x32FD3CF5B4E49BB4, 0x92746B9BE2F8552C},  // 1e246\n        {0x3FBC8C33221DC2A1, 0xB7118682DBB66A77},  // 1e247\n        {0x0FABAF3FEAA5334A, 0xE4D5E82392A40515},  // 1e248\n        {0x29CB4D87F2A7400E, 0x8F05B1163BA6832D},  // 1e" +
+	"249\n        {0x743E20E9EF511012, 0xB2C71D5BCA9023F8},  // 1e250\n        {0x914DA9246B255416, 0xDF78E4B2BD342CF6},  // 1e251\n        {0x1AD089B6C2F7548E, 0x8BAB8EEFB6409C1A},  // 1e252\n        {0xA184AC2473B529B1, 0xAE9672ABA3D0C320},  // 1e253\n        {0xC9E5D72D90A2741E, 0xDA3C0F568CC4F3E8},  // 1e254\n        {0x7E2FA67C7A658892, 0x8865899617FB1871},  // 1e255\n        {0xDDBB901B98FEEAB7, 0xAA7EEBFB9DF9DE8D},  // 1e256\n        {0x552A74227F3EA565, 0xD51EA6FA85785631},  // 1e257\n        {0xD53A88958F87275F, 0x8533285C936B35DE},  // 1e258\n        {0x8A892ABAF368F137, 0xA67FF273B8460356},  // 1e259\n        {0x2D2B7569B0432D85, 0xD01FEF10A657842C},  // 1e260\n        {0x9C3B29620E29FC73, 0x8213F56A67F6B29B},  // 1e261\n        {0x8349F3BA91B47B8F, 0xA298F2C501F45F42},  // 1e262\n        {0x241C70A936219A73, 0xCB3F2F7642717713},  // 1e263\n        {0xED238CD383AA0110, 0xFE0EFB53D30DD4D7},  // 1e264\n        {0xF4363804324A40AA, 0x9EC95D1463E8A506},  // 1e265\n        {0xB143C6053EDCD0D5, 0xC67BB4597CE2CE48},  // 1e266\n" +
+	"        {0xDD94B7868E94050A, 0xF81AA16FDC1B81DA},  // 1e267\n        {0xCA7CF2B4191C8326, 0x9B10A4E5E9913128},  // 1e268\n        {0xFD1C2F611F63A3F0, 0xC1D4CE1F63F57D72},  // 1e269\n        {0xBC633B39673C8CEC, 0xF24A01A73CF2DCCF},  // 1e270\n        {0xD5BE0503E085D813, 0x976E41088617CA01},  // 1e271\n        {0x4B2D8644D8A74E18, 0xBD49D14AA79DBC82},  // 1e272\n        {0xDDF8E7D60ED1219E, 0xEC9C459D51852BA2},  // 1e273\n        {0xCABB90E5C942B503, 0x93E1AB8252F33B45},  // 1e274\n        {0x3D6A751F3B936243, 0xB8DA1662E7B00A17},  // 1e275\n        {0x0CC512670A783AD4, 0xE7109BFBA19C0C9D},  // 1e276\n        {0x27FB2B80668B24C5, 0x906A617D450187E2},  // 1e277\n        {0xB1F9F660802DEDF6, 0xB484F9DC9641E9DA},  // 1e278\n        {0x5E7873F8A0396973, 0xE1A63853BBD26451},  // 1e279\n        {0xDB0B487B6423E1E8, 0x8D07E33455637EB2},  // 1e280\n        {0x91CE1A9A3D2CDA62, 0xB049DC016ABC5E5F},  // 1e281\n        {0x7641A140CC7810FB, 0xDC5C5301C56B75F7},  // 1e282\n        {0xA9E904C87FCB0A9D, 0x89B9B3E11B6329BA},  // 1e283\n    " +
+	"    {0x546345FA9FBDCD44, 0xAC2820D9623BF429},  // 1e284\n        {0xA97C177947AD4095, 0xD732290FBACAF133},  // 1e285\n        {0x49ED8EABCCCC485D, 0x867F59A9D4BED6C0},  // 1e286\n        {0x5C68F256BFFF5A74, 0xA81F301449EE8C70},  // 1e287\n        {0x73832EEC6FFF3111, 0xD226FC195C6A2F8C},  // 1e288\n        {0xC831FD53C5FF7EAB, 0x83585D8FD9C25DB7},  // 1e289\n        {0xBA3E7CA8B77F5E55, 0xA42E74F3D032F525},  // 1e290\n        {0x28CE1BD2E55F35EB, 0xCD3A1230C43FB26F},  // 1e291\n        {0x7980D163CF5B81B3, 0x80444B5E7AA7CF85},  // 1e292\n        {0xD7E105BCC332621F, 0xA0555E361951C366},  // 1e293\n        {0x8DD9472BF3FEFAA7, 0xC86AB5C39FA63440},  // 1e294\n        {0xB14F98F6F0FEB951, 0xFA856334878FC150},  // 1e295\n        {0x6ED1BF9A569F33D3, 0x9C935E00D4B9D8D2},  // 1e296\n        {0x0A862F80EC4700C8, 0xC3B8358109E84F07},  // 1e297\n        {0xCD27BB612758C0FA, 0xF4A642E14C6262C8},  // 1e298\n        {0x8038D51CB897789C, 0x98E7E9CCCFBD7DBD},  // 1e299\n        {0xE0470A63E6BD56C3, 0xBF21E44003ACDD2C},  // 1e300\n        " +
+	"{0x1858CCFCE06CAC74, 0xEEEA5D5004981478},  // 1e301\n        {0x0F37801E0C43EBC8, 0x95527A5202DF0CCB},  // 1e302\n        {0xD30560258F54E6BA, 0xBAA718E68396CFFD},  // 1e303\n        {0x47C6B82EF32A2069, 0xE950DF20247C83FD},  // 1e304\n        {0x4CDC331D57FA5441, 0x91D28B7416CDD27E},  // 1e305\n        {0xE0133FE4ADF8E952, 0xB6472E511C81471D},  // 1e306\n        {0x58180FDDD97723A6, 0xE3D8F9E563A198E5},  // 1e307\n        {0x570F09EAA7EA7648, 0x8E679C2F5E44FF8F},  // 1e308\n        {0x2CD2CC6551E513DA, 0xB201833B35D63F73},  // 1e309\n        {0xF8077F7EA65E58D1, 0xDE81E40A034BCF4F},  // 1e310\n        {0xFB04AFAF27FAF782, 0x8B112E86420F6191},  // 1e311\n        {0x79C5DB9AF1F9B563, 0xADD57A27D29339F6},  // 1e312\n        {0x18375281AE7822BC, 0xD94AD8B1C7380874},  // 1e313\n        {0x8F2293910D0B15B5, 0x87CEC76F1C830548},  // 1e314\n        {0xB2EB3875504DDB22, 0xA9C2794AE3A3C69A},  // 1e315\n        {0x5FA60692A46151EB, 0xD433179D9C8CB841},  // 1e316\n        {0xDBC7C41BA6BCD333, 0x849FEEC281D7F328},  // 1e317\n        {0x1" +
+	"2B9B522906C0800, 0xA5C7EA73224DEFF3},  // 1e318\n        {0xD768226B34870A00, 0xCF39E50FEAE16BEF},  // 1e319\n        {0xE6A1158300D46640, 0x81842F29F2CCE375},  // 1e320\n        {0x60495AE3C1097FD0, 0xA1E53AF46F801C53},  // 1e321\n        {0x385BB19CB14BDFC4, 0xCA5E89B18B602368},  // 1e322\n        {0x46729E03DD9ED7B5, 0xFCF62C1DEE382C42},  // 1e323\n        {0x6C07A2C26A8346D1, 0x9E19DB92B4E31BA9},  // 1e324\n};\n\n" +
+	"" +
+	"// --------\n\n// wuffs_base__private_implementation__parse_number_f64_eisel_lemire produces\n// the IEEE 754 double-precision value for an exact mantissa and base-10\n// exponent. For example:\n//  - when parsing \"12345.678e+02\", man is 12345678 and exp10 is -1.\n//  - when parsing \"-12\", man is 12 and exp10 is 0. Processing the leading\n//    minus sign is the responsibility of the caller, not this function.\n//\n// On success, it returns a non-negative int64_t such that the low 63 bits hold\n// the 11-bit exponent and 52-bit mantissa.\n//\n// On failure, it returns a negative value.\n//\n// The algorithm is based on an original idea by Michael Eisel that was refined\n// by Daniel Lemire. See \"Number Parsing at a Gigabyte per Second\"\n// (https://arxiv.org/abs/2101.11408). It is usually much faster than the MPB\n// and HPD algorithms, but it gives up (instead of producing the wrong answer)\n// on rare, ambiguous inputs, such as those exactly halfway between two f64\n// values. Subnormal and infinite results are also left to t" +
+	"he slower code.\n//\n// Preconditions:\n//  - man is non-zero.\n//  - exp10 is in the range [-307 ..= 288], a sub-range of the\n//    wuffs_base__private_implementation__powers_of_10 array.\nstatic int64_t  //\nwuffs_base__private_implementation__parse_number_f64_eisel_lemire(\n    uint64_t man,\n    int32_t exp10) {\n  // Look up the (possibly truncated) base-2 representation of (10 ** exp10).\n  // The look-up table was constructed so that it is already normalized: the\n  // table entry's mantissa's MSB (most significant bit) is on.\n  const uint64_t* po10 =\n      &wuffs_base__private_implementation__powers_of_10[exp10 + 307][0];\n\n  // Normalize the man argument. The (man != 0) precondition means that a\n  // non-zero bit exists.\n  uint32_t clz = wuffs_base__count_leading_zeroes_u64(man);\n  man <<= clz;\n\n  // Calculate the return value's base-2 exponent. We might tweak it by ±1\n  // later, but its initial value comes from a linear scaling of exp10,\n  // converting from power-of-10 to power-of-2, and adjusting by clz.\n  " +
+	"//\n  // The magic constants are:\n  //  - 1087 = 1023 + 64. The 1023 is the f64 exponent bias. The 64 is because\n  //    the look-up table uses 64-bit mantissas.\n  //  - 217706 is such that the ratio 217706 / 65536 ≈ 3.321930 is close\n  //    enough (over the practical range of exp10) to log(10) / log(2) ≈\n  //    3.321928.\n  //  - 65536 = 1<<16 is arbitrary but a power of 2, so division is a shift.\n  //\n  // Equality of the linearly-scaled value and the actual power-of-2, over the\n  // range of exp10 arguments that this function accepts, is confirmed by\n  // script/print-eisel-lemire-powers-of-10.go\n  uint64_t ret_exp2 =\n      ((uint64_t)(((217706 * exp10) >> 16) + 1087)) - ((uint64_t)clz);\n\n  // Multiply the two mantissas. Normalization means that both mantissas are\n  // at least (1<<63), so the 128-bit product must be at least (1<<126). The\n  // high 64 bits of the product, x_hi, must therefore be at least (1<<62).\n  //\n  // As a consequence, x_hi has either 0 or 1 leading zeroes. Shifting x_hi\n  // rig" +
+	"ht by either 9 or 10 bits (depending on x_hi's MSB) will therefore\n  // leave the top 10 MSBs (bits 54 ..= 63) off and the 11th MSB (bit 53) on.\n  wuffs_base__multiply_u64__output x = wuffs_base__multiply_u64(man, po10[1]);\n  uint64_t x_hi = x.hi;\n  uint64_t x_lo = x.lo;\n\n  // Before we shift right by at least 9 bits, recall that the look-up table\n  // entry was possibly truncated. We have so far only calculated a lower bound\n  // for the product (man * e), where e is (10 ** exp10). The upper bound would\n  // add a further (man * 1) to the 128-bit product, which overflows the lower\n  // 64-bit limb if ((x_lo + man) < man).\n  //\n  // If overflow occurs, that adds 1 to x_hi. Since we're about to shift right\n  // by at least 9 bits, that carried 1 can be ignored unless the higher 64-bit\n  // limb's low 9 bits are all on.\n  if (((x_hi & 0x1FF) == 0x1FF) && ((x_lo + man) < man)) {\n    // Refine our calculation of (man * e). Before, our approximation of e used\n    // a \"low resolution\" 64-bit mantissa. Now use a \"h" +
+	"igh resolution\" 128-bit\n    // mantissa. We've already calculated x = (man * bits[0..64]). The 4 lines\n    // below calculate y = (man * bits[64..128]) and then add x and y\n    // together, shifting y right by 64 bits.\n    wuffs_base__multiply_u64__output y = wuffs_base__multiply_u64(man, po10[0]);\n    uint64_t merged_hi = x_hi;\n    uint64_t merged_lo = x_lo + y.hi;\n    if (merged_lo < x_lo) {\n      merged_hi++;  // Carry the overflow bit.\n    }\n\n    // The \"high resolution\" approximation of e is still a lower bound. Once\n    // again, see if the upper bound is large enough to produce a different\n    // result. This time, if it does, give up instead of reaching for an even\n    // more precise approximation to e.\n    //\n    // This three-part check is similar to the two-part check that guarded the\n    // if block that we're now in, but it has an extra term for the middle 64\n    // bits (checking that adding 1 to merged_lo would overflow).\n    if (((merged_hi & 0x1FF) == 0x1FF) && ((merged_lo + 1) == 0) &&\n    " +
+	"    ((y.lo + man) < man)) {\n      return -1;\n    }\n\n    // Replace the 128-bit x with merged.\n    x_hi = merged_hi;\n    x_lo = merged_lo;\n  }\n\n  // As mentioned above, shifting x_hi right by either 9 or 10 bits will leave\n  // the top 10 MSBs (bits 54 ..= 63) off and the 11th MSB (bit 53) on. If the\n  // MSB (before shifting) was on, adjust ret_exp2 for the larger shift.\n  //\n  // Having bit 53 on (and higher bits off) means that ret_mantissa is a 54-bit\n  // number.\n  uint64_t msb = x_hi >> 63;\n  uint64_t ret_mantissa = x_hi >> (msb + 9);\n  ret_exp2 -= 1 ^ msb;\n\n  // IEEE 754 rounds to-nearest with ties rounded to-even. Rounding to-even can\n  // be tricky. If we're half-way between two exactly representable numbers\n  // (x's low 73 bits are zero and the next 2 bits that matter are \"01\"), give\n  // up instead of trying to pick the winner.\n  //\n  // Technically, we could tighten the condition by changing \"73\" to \"73 or 74,\n  // depending on msb\", but a flat \"73\" is simpler.\n  if ((x_lo == 0) && ((x_hi & 0x1FF)" +
+	" == 0) && ((ret_mantissa & 3) == 1)) {\n    return -1;\n  }\n\n  // If we're not halfway then it's rounding to-nearest. Starting with a 54-bit\n  // number, carry the lowest bit (bit 0) up if it's on. Regardless of whether\n  // it was on or off, shifting right by one then produces a 53-bit number. If\n  // carrying up overflowed, shift again.\n  ret_mantissa += ret_mantissa & 1;\n  ret_mantissa >>= 1;\n  if ((ret_mantissa >> 53) > 0) {\n    ret_mantissa >>= 1;\n    ret_exp2++;\n  }\n\n  // Starting with a 53-bit number, IEEE 754 double-precision normal numbers\n  // have an implicit mantissa bit. Mask that away and keep the low 52 bits.\n  ret_mantissa &= 0x000FFFFFFFFFFFFF;\n\n  // If the exponent is out of range (subnormal, denoted by a ret_exp2 of zero\n  // or less, which wraps around because it is unsigned, or infinite, denoted\n  // by 0x7FF or more), give up.\n  if ((ret_exp2 - 1) >= (0x7FF - 1)) {\n    return -1;\n  }\n\n  // Pack the bits and return.\n  return ((int64_t)(ret_mantissa | (ret_exp2 << 52)));\n}\n\n" +
 	"" +
 	"// --------\n\n// wuffs_base__private_implementation__medium_prec_bin (abbreviated as MPB) is\n// a fixed precision floating point binary number. Unlike IEEE 754 Floating\n// Point, it cannot represent infinity or NaN (Not a Number).\n//\n// \"Medium precision\" means that the mantissa holds 64 binary digits, a little\n// more than \"double precision\", and sizeof(MPB) > sizeof(double). 64 is\n// obviously the number of bits in a uint64_t.\n//\n// An MPB isn't for general purpose arithmetic, only for conversions to and\n// from IEEE 754 double-precision floating point.\n//\n// There is no implicit mantissa bit. The mantissa field is zero if and only if\n// the overall floating point value is ±0. An MPB is normalized if the mantissa\n// is zero or its high bit (the 1<<63 bit) is set.\n//\n// There is no negative bit. An MPB can only represent non-negative numbers.\n//\n// The \"all fields are zero\" value is valid, and represents the number +0.\n//\n// This is the \"Do It Yourself Floating Point\" data structure from Loitsch,\n// \"Printin" +
 	"g Floating-Point Numbers Quickly and Accurately with Integers\"\n// (https://www.cs.tufts.edu/~nr/cs257/archive/florian-loitsch/printf.pdf).\n//\n// Florian Loitsch is also the primary contributor to\n// https://github.com/google/double-conversion\ntypedef struct {\n  uint64_t mantissa;\n  int32_t exp2;\n} wuffs_base__private_implementation__medium_prec_bin;\n\nstatic uint32_t  //\nwuffs_base__private_implementation__medium_prec_bin__normalize(\n    wuffs_base__private_implementation__medium_prec_bin* m) {\n  if (m->mantissa == 0) {\n    return 0;\n  }\n  uint32_t shift = wuffs_base__count_leading_zeroes_u64(m->mantissa);\n  m->mantissa <<= shift;\n  m->exp2 -= (int32_t)shift;\n  return shift;\n}\n\n// wuffs_base__private_implementation__medium_prec_bin__mul_pow_10 sets m to be\n// (m * pow), where pow comes from an etc_powers_of_10 triple starting at p.\n//\n// The result is rounded, but not necessarily normalized.\n//\n// Preconditions:\n//  - m is non-NULL.\n//  - m->mantissa is non-zero.\n//  - m->mantissa's high bit is set (i.e. m is " +
@@ -97,43 +174,69 @@ const baseF64ConvSubmoduleC = "" +
 	"e difference between the approximate and\n    // actual value.\n    //\n    // The DiyFpStrtod function in https://github.com/google/double-conversion\n    // uses a finer grain (1/8th of the ULP, Unit in the Last Place) when\n    // tracking error. This implementation is coarser (1 ULP) but simpler.\n    //\n    // It is an error in the \"numerical approximation\" sense, not in the\n    // typical programming sense (as in \"bad input\" or \"a result type\").\n    uint64_t error = 0;\n\n    // Convert up to 19 decimal digits (in h->digits) to 64 binary digits (in\n    // m->mantissa): (1e19 < (1<<64)) and ((1<<64) < 1e20). If we have more\n    // than 19 digits, we're truncating (with error).\n    uint32_t i;\n    uint32_t i_end = h->num_digits;\n    if (i_end > 19) {\n      i_end = 19;\n      error = 1;\n    }\n    uint64_t mantissa = 0;\n    for (i = 0; i < i_end; i++) {\n      mantissa = (10 * mantissa) + h->digits[i];\n    }\n    m->mantissa = mantissa;\n    m->exp2 = 0;\n\n    // Check that exp10 lies in the (big_powers_of_10 + small_po" +
 	"wers_of_10)\n    // range, -348 ..= +347, stepping big_powers_of_10 by 8 (which is 87\n    // triples) and small_powers_of_10 by 1 (which is 8 triples).\n    int32_t exp10 = h->decimal_point - ((int32_t)(i_end));\n    if (exp10 < -348) {\n      goto fail;\n    }\n    uint32_t bpo10 = ((uint32_t)(exp10 + 348)) / 8;\n    uint32_t spo10 = ((uint32_t)(exp10 + 348)) % 8;\n    if (bpo10 >= 87) {\n      goto fail;\n    }\n\n    // Try a fast path, if float64 math would be exact.\n    //\n    // 15 is such that 1e15 can be losslessly represented in a float64\n    // mantissa: (1e15 < (1<<53)) and ((1<<53) < 1e16).\n    //\n    // 22 is the maximum valid index for the\n    // wuffs_base__private_implementation__f64_powers_of_10 array.\n    do {\n      if (skip_fast_path_for_tests || ((mantissa >> 52) != 0)) {\n        break;\n      }\n      double d = (double)mantissa;\n\n      if (exp10 == 0) {\n        wuffs_base__result_f64 ret;\n        ret.status.repr = NULL;\n        ret.value = h->negative ? -d : +d;\n        return ret;\n\n      } else if (e" +
 	"xp10 > 0) {\n        if (exp10 > 22) {\n          if (exp10 > (15 + 22)) {\n            break;\n          }\n          // If exp10 is in the range 23 ..= 37, try moving a few of the zeroes\n          // from the exponent to the mantissa. If we're still under 1e15, we\n          // haven't truncated any mantissa bits.\n          if (exp10 > 22) {\n            d *= wuffs_base__private_implementation__f64_powers_of_10[exp10 -\n                                                                      22];\n            exp10 = 22;\n            if (d >= 1e15) {\n              break;\n            }\n          }\n        }\n        d *= wuffs_base__private_implementation__f64_powers_of_10[exp10];\n        wuffs_base__result_f64 ret;\n        ret.status.repr = NULL;\n        ret.value = h->negative ? -d : +d;\n        return ret;\n\n      } else {  // \"if (exp10 < 0)\" is effectively \"if (true)\" here.\n        if (exp10 < -22) {\n          break;\n        }\n        d /= wuffs_base__private_implementation__f64_powers_of_10[-exp10];\n        wuffs_bas" +
-	"e__result_f64 ret;\n        ret.status.repr = NULL;\n        ret.value = h->negative ? -d : +d;\n        return ret;\n      }\n    } while (0);\n\n    // Normalize (and scale the error).\n    error <<= wuffs_base__private_implementation__medium_prec_bin__normalize(m);\n\n    // Multiplying two MPB values nominally multiplies two mantissas, call them\n    // A and B, which are integer approximations to the precise values (A+a)\n    // and (B+b) for some error terms a and b.\n    //\n    // MPB multiplication calculates (((A+a) * (B+b)) >> 64) to be ((A*B) >>\n    // 64). Shifting (truncating) and rounding introduces further error. The\n    // difference between the calculated result:\n    //  ((A*B                  ) >> 64)\n    // and the true result:\n    //  ((A*B + A*b + a*B + a*b) >> 64)   + rounding_error\n    // is:\n    //  ((      A*b + a*B + a*b) >> 64)   + rounding_error\n    // which can be re-grouped as:\n    //  ((A*b) >> 64) + ((a*(B+b)) >> 64) + rounding_error\n    //\n    // Now, let A and a be \"m->mantissa\" and \"erro" +
-	"r\", and B and b be the\n    // pre-calculated power of 10. A and B are both less than (1 << 64), a is\n    // the \"error\" local variable and b is less than 1.\n    //\n    // An upper bound (in absolute value) on ((A*b) >> 64) is therefore 1.\n    //\n    // An upper bound on ((a*(B+b)) >> 64) is a, also known as error.\n    //\n    // Finally, the rounding_error is at most 1.\n    //\n    // In total, calling mpb__mul_pow_10 will raise the worst-case error by 2.\n    // The subsequent re-normalization can multiply that by a further factor.\n\n    // Multiply by small_powers_of_10[etc].\n    wuffs_base__private_implementation__medium_prec_bin__mul_pow_10(\n        m, &wuffs_base__private_implementation__small_powers_of_10[3 * spo10]);\n    error += 2;\n    error <<= wuffs_base__private_implementation__medium_prec_bin__normalize(m);\n\n    // Multiply by big_powers_of_10[etc].\n    wuffs_base__private_implementation__medium_prec_bin__mul_pow_10(\n        m, &wuffs_base__private_implementation__big_powers_of_10[3 * bpo10]);\n    err" +
-	"or += 2;\n    error <<= wuffs_base__private_implementation__medium_prec_bin__normalize(m);\n\n    // We have a good approximation of h, but we still have to check whether\n    // the error is small enough. Equivalently, whether the number of surplus\n    // mantissa bits (the bits dropped when going from m's 64 mantissa bits to\n    // the smaller number of double-precision mantissa bits) would always round\n    // up or down, even when perturbed by ±error. We start at 11 surplus bits\n    // (m has 64, double-precision has 1+52), but it can be higher for\n    // subnormals.\n    //\n    // In many cases, the error is small enough and we return true.\n    const int32_t f64_bias = -1023;\n    int32_t subnormal_exp2 = f64_bias - 63;\n    uint32_t surplus_bits = 11;\n    if (subnormal_exp2 >= m->exp2) {\n      surplus_bits += 1 + ((uint32_t)(subnormal_exp2 - m->exp2));\n    }\n\n    uint64_t surplus_mask =\n        (((uint64_t)1) << surplus_bits) - 1;  // e.g. 0x07FF.\n    uint64_t surplus = m->mantissa & surplus_mask;\n    uint64_t" +
-	" halfway = ((uint64_t)1) << (surplus_bits - 1);  // e.g. 0x0400.\n\n    // Do the final calculation in *signed* arithmetic.\n    int64_t i_surplus = (int64_t)surplus;\n    int64_t i_halfway = (int64_t)halfway;\n    int64_t i_error = (int64_t)error;\n\n    if ((i_surplus > (i_halfway - i_error)) &&\n        (i_surplus < (i_halfway + i_error))) {\n      goto fail;\n    }\n\n    wuffs_base__result_f64 ret;\n    ret.status.repr = NULL;\n    ret.value = wuffs_base__private_implementation__medium_prec_bin__as_f64(\n        m, h->negative);\n    return ret;\n  } while (0);\n\nfail:\n  do {\n    wuffs_base__result_f64 ret;\n    ret.status.repr = \"#base: mpb__parse_number_f64 failed\";\n    ret.value = 0;\n    return ret;\n  } while (0);\n}\n\n" +
+	"e__result_f64 ret;\n        ret.status.repr = NULL;\n        ret.value = h->negative ? -d : +d;\n        return ret;\n      }\n    } while (0);\n\n    // Try the Eisel-Lemire algorithm next. It is exact when it succeeds, but\n    // it needs all of the digits (no truncation error) and it gives up on\n    // some inputs, such as those halfway between two f64 values.\n    //\n    // The fast path above may have modified exp10, so re-calculate it.\n    exp10 = h->decimal_point - ((int32_t)(i_end));\n    if (!skip_fast_path_for_tests && (error == 0) && (-307 <= exp10) &&\n        (exp10 <= 288)) {\n      int64_t r =\n          wuffs_base__private_implementation__parse_number_f64_eisel_lemire(\n              mantissa, exp10);\n      if (r >= 0) {\n        wuffs_base__result_f64 ret;\n        ret.status.repr = NULL;\n        ret.value = wuffs_base__ieee_754_bit_representation__to_f64(\n            ((uint64_t)r) | (h->negative ? 0x8000000000000000 : 0));\n        return ret;\n      }\n    }\n\n    // Normalize (and scale the error).\n    error" +
+	" <<= wuffs_base__private_implementation__medium_prec_bin__normalize(m);\n\n    // Multiplying two MPB values nominally multiplies two mantissas, call them\n    // A and B, which are integer approximations to the precise values (A+a)\n    // and (B+b) for some error terms a and b.\n    //\n    // MPB multiplication calculates (((A+a) * (B+b)) >> 64) to be ((A*B) >>\n    // 64). Shifting (truncating) and rounding introduces further error. The\n    // difference between the calculated result:\n    //  ((A*B                  ) >> 64)\n    // and the true result:\n    //  ((A*B + A*b + a*B + a*b) >> 64)   + rounding_error\n    // is:\n    //  ((      A*b + a*B + a*b) >> 64)   + rounding_error\n    // which can be re-grouped as:\n    //  ((A*b) >> 64) + ((a*(B+b)) >> 64) + rounding_error\n    //\n    // Now, let A and a be \"m->mantissa\" and \"error\", and B and b be the\n    // pre-calculated power of 10. A and B are both less than (1 << 64), a is\n    // the \"error\" local variable and b is less than 1.\n    //\n    // An upper bound (in" +
+	" absolute value) on ((A*b) >> 64) is therefore 1.\n    //\n    // An upper bound on ((a*(B+b)) >> 64) is a, also known as error.\n    //\n    // Finally, the rounding_error is at most 1.\n    //\n    // In total, calling mpb__mul_pow_10 will raise the worst-case error by 2.\n    // The subsequent re-normalization can multiply that by a further factor.\n\n    // Multiply by small_powers_of_10[etc].\n    wuffs_base__private_implementation__medium_prec_bin__mul_pow_10(\n        m, &wuffs_base__private_implementation__small_powers_of_10[3 * spo10]);\n    error += 2;\n    error <<= wuffs_base__private_implementation__medium_prec_bin__normalize(m);\n\n    // Multiply by big_powers_of_10[etc].\n    wuffs_base__private_implementation__medium_prec_bin__mul_pow_10(\n        m, &wuffs_base__private_implementation__big_powers_of_10[3 * bpo10]);\n    error += 2;\n    error <<= wuffs_base__private_implementation__medium_prec_bin__normalize(m);\n\n    // We have a good approximation of h, but we still have to check whether\n    // the error is s" +
+	"mall enough. Equivalently, whether the number of surplus\n    // mantissa bits (the bits dropped when going from m's 64 mantissa bits to\n    // the smaller number of double-precision mantissa bits) would always round\n    // up or down, even when perturbed by ±error. We start at 11 surplus bits\n    // (m has 64, double-precision has 1+52), but it can be higher for\n    // subnormals.\n    //\n    // In many cases, the error is small enough and we return true.\n    const int32_t f64_bias = -1023;\n    int32_t subnormal_exp2 = f64_bias - 63;\n    uint32_t surplus_bits = 11;\n    if (subnormal_exp2 >= m->exp2) {\n      surplus_bits += 1 + ((uint32_t)(subnormal_exp2 - m->exp2));\n    }\n\n    uint64_t surplus_mask =\n        (((uint64_t)1) << surplus_bits) - 1;  // e.g. 0x07FF.\n    uint64_t surplus = m->mantissa & surplus_mask;\n    uint64_t halfway = ((uint64_t)1) << (surplus_bits - 1);  // e.g. 0x0400.\n\n    // Do the final calculation in *signed* arithmetic.\n    int64_t i_surplus = (int64_t)surplus;\n    int64_t i_halfway = (" +
+	"int64_t)halfway;\n    int64_t i_error = (int64_t)error;\n\n    if ((i_surplus > (i_halfway - i_error)) &&\n        (i_surplus < (i_halfway + i_error))) {\n      goto fail;\n    }\n\n    wuffs_base__result_f64 ret;\n    ret.status.repr = NULL;\n    ret.value = wuffs_base__private_implementation__medium_prec_bin__as_f64(\n        m, h->negative);\n    return ret;\n  } while (0);\n\nfail:\n  do {\n    wuffs_base__result_f64 ret;\n    ret.status.repr = \"#base: mpb__parse_number_f64 failed\";\n    ret.value = 0;\n    return ret;\n  } while (0);\n}\n\n" +
 	"" +
 	"// --------\n\nstatic wuffs_base__result_f64  //\nwuffs_base__parse_number_f64_special(wuffs_base__slice_u8 s,\n                                     const char* fallback_status_repr) {\n  do {\n    uint8_t* p = s.ptr;\n    uint8_t* q = s.ptr + s.len;\n\n    for (; (p < q) && (*p == '_'); p++) {\n    }\n    if (p >= q) {\n      goto fallback;\n    }\n\n    // Parse sign.\n    bool negative = false;\n    do {\n      if (*p == '+') {\n        p++;\n      } else if (*p == '-') {\n        negative = true;\n        p++;\n      } else {\n        break;\n      }\n      for (; (p < q) && (*p == '_'); p++) {\n      }\n    } while (0);\n    if (p >= q) {\n      goto fallback;\n    }\n\n    bool nan = false;\n    switch (p[0]) {\n      case 'I':\n      case 'i':\n        if (((q - p) < 3) ||                     //\n            ((p[1] != 'N') && (p[1] != 'n')) ||  //\n            ((p[2] != 'F') && (p[2] != 'f'))) {\n          goto fallback;\n        }\n        p += 3;\n\n        if ((p >= q) || (*p == '_')) {\n          break;\n        } else if (((q - p) < 5) ||    " +
 	"                 //\n                   ((p[0] != 'I') && (p[0] != 'i')) ||  //\n                   ((p[1] != 'N') && (p[1] != 'n')) ||  //\n                   ((p[2] != 'I') && (p[2] != 'i')) ||  //\n                   ((p[3] != 'T') && (p[3] != 't')) ||  //\n                   ((p[4] != 'Y') && (p[4] != 'y'))) {\n          goto fallback;\n        }\n        p += 5;\n\n        if ((p >= q) || (*p == '_')) {\n          break;\n        }\n        goto fallback;\n\n      case 'N':\n      case 'n':\n        if (((q - p) < 3) ||                     //\n            ((p[1] != 'A') && (p[1] != 'a')) ||  //\n            ((p[2] != 'N') && (p[2] != 'n'))) {\n          goto fallback;\n        }\n        p += 3;\n\n        if ((p >= q) || (*p == '_')) {\n          nan = true;\n          break;\n        }\n        goto fallback;\n\n      default:\n        goto fallback;\n    }\n\n    // Finish.\n    for (; (p < q) && (*p == '_'); p++) {\n    }\n    if (p != q) {\n      goto fallback;\n    }\n    wuffs_base__result_f64 ret;\n    ret.status.repr = NULL;\n    ret.va" +
 	"lue = wuffs_base__ieee_754_bit_representation__to_f64(\n        (nan ? 0x7FFFFFFFFFFFFFFF : 0x7FF0000000000000) |\n        (negative ? 0x8000000000000000 : 0));\n    return ret;\n  } while (0);\n\nfallback:\n  do {\n    wuffs_base__result_f64 ret;\n    ret.status.repr = fallback_status_repr;\n    ret.value = 0;\n    return ret;\n  } while (0);\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__result_f64  //\nwuffs_base__parse_number_f64(wuffs_base__slice_u8 s) {\n  wuffs_base__private_implementation__medium_prec_bin m;\n  wuffs_base__private_implementation__high_prec_dec h;\n\n  do {\n    // powers converts decimal powers of 10 to binary powers of 2. For example,\n    // (10000 >> 13) is 1. It stops before the elements exceed 60, also known\n    // as WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL.\n    static const uint32_t num_powers = 19;\n    static const uint8_t powers[19] = {\n        0,  3,  6,  9,  13, 16, 19, 23, 26, 29,  //\n        33, 36, 39, 43, 46, 49, 53, 56, 59,      //\n    };\n\n    wuffs_base__status status =\n       " +
 	" wuffs_base__private_implementation__high_prec_dec__parse(&h, s);\n    if (status.repr) {\n      return wuffs_base__parse_number_f64_special(s, status.repr);\n    }\n\n    // Handle zero and obvious extremes. The largest and smallest positive\n    // finite f64 values are approximately 1.8e+308 and 4.9e-324.\n    if ((h.num_digits == 0) || (h.decimal_point < -326)) {\n      goto zero;\n    } else if (h.decimal_point > 310) {\n      goto infinity;\n    }\n\n    wuffs_base__result_f64 mpb_result =\n        wuffs_base__private_implementation__medium_prec_bin__parse_number_f64(\n            &m, &h, false);\n    if (mpb_result.status.repr == NULL) {\n      return mpb_result;\n    }\n\n    // Scale by powers of 2 until we're in the range [½ .. 1], which gives us\n    // our exponent (in base-2). First we shift right, possibly a little too\n    // far, ending with a value certainly below 1 and possibly below ½...\n    const int32_t f64_bias = -1023;\n    int32_t exp2 = 0;\n    while (h.decimal_point > 0) {\n      uint32_t n = (uint32_t)(+h" +
-	".decimal_point);\n      uint32_t shift =\n          (n < num_powers)\n              ? powers[n]\n              : WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL;\n\n      wuffs_base__private_implementation__high_prec_dec__small_rshift(&h,\n                                                                      shift);\n      if (h.decimal_point <\n          -WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE) {\n        goto zero;\n      }\n      exp2 += (int32_t)shift;\n    }\n    // ...then we shift left, putting us in [½ .. 1].\n    while (h.decimal_point <= 0) {\n      uint32_t shift;\n      if (h.decimal_point == 0) {\n        if (h.digits[0] >= 5) {\n          break;\n        }\n        shift = (h.digits[0] <= 2) ? 2 : 1;\n      } else {\n        uint32_t n = (uint32_t)(-h.decimal_point);\n        shift = (n < num_powers)\n                    ? powers[n]\n                    : WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL;\n      }\n\n      wuffs_base__private_implementation__high_prec_dec__small_lshif" +
-	"t(&h,\n                                                                      shift);\n      if (h.decimal_point >\n          +WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE) {\n        goto infinity;\n      }\n      exp2 -= (int32_t)shift;\n    }\n\n    // We're in the range [½ .. 1] but f64 uses [1 .. 2].\n    exp2--;\n\n    // The minimum normal exponent is (f64_bias + 1).\n    while ((f64_bias + 1) > exp2) {\n      uint32_t n = (uint32_t)((f64_bias + 1) - exp2);\n      if (n > WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL) {\n        n = WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL;\n      }\n      wuffs_base__private_implementation__high_prec_dec__small_rshift(&h, n);\n      exp2 += (int32_t)n;\n    }\n\n    // Check for overflow.\n    if ((exp2 - f64_bias) >= 0x07FF) {  // (1 << 11) - 1.\n      goto infinity;\n    }\n\n    // Extract 53 bits for the mantissa (in base-2).\n    wuffs_base__private_implementation__high_prec_dec__small_lshift(&h, 53);\n    uint64_t man2 =\n        wuffs_base__privat" +
-	"e_implementation__high_prec_dec__rounded_integer(&h);\n\n    // Rounding might have added one bit. If so, shift and re-check overflow.\n    if ((man2 >> 53) != 0) {\n      man2 >>= 1;\n      exp2++;\n      if ((exp2 - f64_bias) >= 0x07FF) {  // (1 << 11) - 1.\n        goto infinity;\n      }\n    }\n\n    // Handle subnormal numbers.\n    if ((man2 >> 52) == 0) {\n      exp2 = f64_bias;\n    }\n\n    // Pack the bits and return.\n    uint64_t exp2_bits =\n        (uint64_t)((exp2 - f64_bias) & 0x07FF);             // (1 << 11) - 1.\n    uint64_t bits = (man2 & 0x000FFFFFFFFFFFFF) |           // (1 << 52) - 1.\n                    (exp2_bits << 52) |                     //\n                    (h.negative ? 0x8000000000000000 : 0);  // (1 << 63).\n\n    wuffs_base__result_f64 ret;\n    ret.status.repr = NULL;\n    ret.value = wuffs_base__ieee_754_bit_representation__to_f64(bits);\n    return ret;\n  } while (0);\n\nzero:\n  do {\n    uint64_t bits = h.negative ? 0x8000000000000000 : 0;\n\n    wuffs_base__result_f64 ret;\n    ret.status.repr = " +
-	"NULL;\n    ret.value = wuffs_base__ieee_754_bit_representation__to_f64(bits);\n    return ret;\n  } while (0);\n\ninfinity:\n  do {\n    uint64_t bits = h.negative ? 0xFFF0000000000000 : 0x7FF0000000000000;\n\n    wuffs_base__result_f64 ret;\n    ret.status.repr = NULL;\n    ret.value = wuffs_base__ieee_754_bit_representation__to_f64(bits);\n    return ret;\n  } while (0);\n}\n" +
+	".decimal_point);\n      uint32_t shift =\n          (n < num_powers)\n              ? powers[n]\n              : WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL;\n\n      wuffs_base__private_implementation__high_prec_dec__small_rshift(&h,\n                                                                      shift);\n      if (h.decimal_point <\n          -WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE) {\n        goto zero;\n      }\n      exp2 += (int32_t)shift;\n    }\n    // ...then we shift left, putting us in [½ .. 1].\n    while (h.decimal_point <= 0) {\n      uint32_t shift;\n      if (h.decimal_point == 0) {\n        if (h.digits[0] >= 5) {\n          break;\n        }\n        shift = (h.digits[0] < 2) ? 2 : 1;\n      } else {\n        uint32_t n = (uint32_t)(-h.decimal_point);\n        shift = (n < num_powers)\n                    ? powers[n]\n                    : WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL;\n      }\n\n      wuffs_base__private_implementation__high_prec_dec__small_lshift" +
+	"(&h,\n                                                                      shift);\n      if (h.decimal_point >\n          +WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__DECIMAL_POINT__RANGE) {\n        goto infinity;\n      }\n      exp2 -= (int32_t)shift;\n    }\n\n    // We're in the range [½ .. 1] but f64 uses [1 .. 2].\n    exp2--;\n\n    // The minimum normal exponent is (f64_bias + 1).\n    while ((f64_bias + 1) > exp2) {\n      uint32_t n = (uint32_t)((f64_bias + 1) - exp2);\n      if (n > WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL) {\n        n = WUFFS_BASE__PRIVATE_IMPLEMENTATION__HPD__SHIFT__MAX_INCL;\n      }\n      wuffs_base__private_implementation__high_prec_dec__small_rshift(&h, n);\n      exp2 += (int32_t)n;\n    }\n\n    // Check for overflow.\n    if ((exp2 - f64_bias) >= 0x07FF) {  // (1 << 11) - 1.\n      goto infinity;\n    }\n\n    // Extract 53 bits for the mantissa (in base-2).\n    wuffs_base__private_implementation__high_prec_dec__small_lshift(&h, 53);\n    uint64_t man2 =\n        wuffs_base__private" +
+	"_implementation__high_prec_dec__rounded_integer(&h);\n\n    // Rounding might have added one bit. If so, shift and re-check overflow.\n    if ((man2 >> 53) != 0) {\n      man2 >>= 1;\n      exp2++;\n      if ((exp2 - f64_bias) >= 0x07FF) {  // (1 << 11) - 1.\n        goto infinity;\n      }\n    }\n\n    // Handle subnormal numbers.\n    if ((man2 >> 52) == 0) {\n      exp2 = f64_bias;\n    }\n\n    // Pack the bits and return.\n    uint64_t exp2_bits =\n        (uint64_t)((exp2 - f64_bias) & 0x07FF);             // (1 << 11) - 1.\n    uint64_t bits = (man2 & 0x000FFFFFFFFFFFFF) |           // (1 << 52) - 1.\n                    (exp2_bits << 52) |                     //\n                    (h.negative ? 0x8000000000000000 : 0);  // (1 << 63).\n\n    wuffs_base__result_f64 ret;\n    ret.status.repr = NULL;\n    ret.value = wuffs_base__ieee_754_bit_representation__to_f64(bits);\n    return ret;\n  } while (0);\n\nzero:\n  do {\n    uint64_t bits = h.negative ? 0x8000000000000000 : 0;\n\n    wuffs_base__result_f64 ret;\n    ret.status.repr = N" +
+	"ULL;\n    ret.value = wuffs_base__ieee_754_bit_representation__to_f64(bits);\n    return ret;\n  } while (0);\n\ninfinity:\n  do {\n    uint64_t bits = h.negative ? 0xFFF0000000000000 : 0x7FF0000000000000;\n\n    wuffs_base__result_f64 ret;\n    ret.status.repr = NULL;\n    ret.value = wuffs_base__ieee_754_bit_representation__to_f64(bits);\n    return ret;\n  } while (0);\n}\n\n" +
+	"" +
+	"// --------\n\n// wuffs_base__private_implementation__schubfach_rop returns the round-to-odd\n// approximation of ((g * cp) >> 127), where the 126-bit g is ((g1 << 63) |\n// g0). \"Round to odd\" means that the low bit of the result is set whenever the\n// shifted-out bits are non-zero, so that later comparisons remain exact.\nstatic inline uint64_t  //\nwuffs_base__private_implementation__schubfach_rop(uint64_t g1,\n                                                  uint64_t g0,\n                                                  uint64_t cp) {\n  uint64_t x1 = wuffs_base__multiply_u64(g0, cp).hi;\n  wuffs_base__multiply_u64__output y = wuffs_base__multiply_u64(g1, cp);\n  uint64_t z = (y.lo >> 1) + x1;\n  uint64_t vbp = y.hi + (z >> 63);\n  return vbp | (((z & 0x7FFFFFFFFFFFFFFF) + 0x7FFFFFFFFFFFFFFF) >> 63);\n}\n\n// wuffs_base__private_implementation__schubfach finds the shortest decimal,\n// (*digits * (10 ** *exp10)), that rounds to the f64 value (c * (2 ** q)). If\n// more than one decimal with that many significant digits r" +
+	"ounds to that f64\n// value, it picks the closest one, breaking ties towards an even *digits.\n//\n// *digits may have trailing zeroes, which the caller may want to strip.\n//\n// The algorithm is Raffaello Giulietti's Schubfach, described in \"The\n// Schubfach way to render doubles\" and used by Java's Double.toString. Like\n// Ryu or Grisu, it needs only fixed-width integer arithmetic and a table of\n// powers of 10, but unlike Grisu it never needs a slow fallback.\n//\n// Preconditions:\n//  - c is at least 3 and less than (1 << 53).\n//  - q is in the range [-1074 ..= 971].\nstatic void  //\nwuffs_base__private_implementation__schubfach(uint64_t c,\n                                              int32_t q,\n                                              uint64_t* digits,\n                                              int32_t* exp10) {\n  // The rounding interval around (c * (2 ** q)) is [cbl, cbr] in units of\n  // (2 ** (q - 2)). It is asymmetric (narrower below) when c is the smallest\n  // normal mantissa, as the f64 value j" +
+	"ust below it has a smaller exponent.\n  //\n  // The magic constants approximate logarithms:\n  //  - 661971961083 / (1 << 41) ≈ log(2) / log(10).\n  //  - 274743187321 / (1 << 41) ≈ log(4/3) / log(10).\n  //  - 913124641741 / (1 << 38) ≈ log(10) / log(2).\n  uint64_t out = c & 1;\n  uint64_t cb = c << 2;\n  uint64_t cbr = cb + 2;\n  uint64_t cbl;\n  int32_t k;\n  if ((c != 0x0010000000000000) || (q == -1074)) {\n    cbl = cb - 2;\n    k = (int32_t)((((int64_t)q) * 661971961083) >> 41);\n  } else {\n    cbl = cb - 1;\n    k = (int32_t)(((((int64_t)q) * 661971961083) - 274743187321) >> 41);\n  }\n  int32_t h = q + ((int32_t)((((int64_t)(-k)) * 913124641741) >> 38)) + 2;\n\n  // Look up (10 ** -k) as the 126-bit g. The powers_of_10 table holds\n  // truncated 128-bit values, so shift right by 2 and then add 1 to make g a\n  // strict upper bound, as Schubfach requires. The precondition on q means\n  // that -k is in the range [-292 ..= 324].\n  const uint64_t* po10 =\n      &wuffs_base__private_implementation__powers_of_10[307 - " +
+	"k][0];\n  uint64_t g_lo = (po10[0] >> 2) | (po10[1] << 62);\n  uint64_t g_hi = po10[1] >> 2;\n  g_lo++;\n  if (g_lo == 0) {\n    g_hi++;\n  }\n  uint64_t g1 = (g_hi << 1) | (g_lo >> 63);\n  uint64_t g0 = g_lo & 0x7FFFFFFFFFFFFFFF;\n\n  uint64_t vb =\n      wuffs_base__private_implementation__schubfach_rop(g1, g0, cb << h);\n  uint64_t vbl =\n      wuffs_base__private_implementation__schubfach_rop(g1, g0, cbl << h);\n  uint64_t vbr =\n      wuffs_base__private_implementation__schubfach_rop(g1, g0, cbr << h);\n\n  // s is the scaled value, rounded down. First see if exactly one of the two\n  // multiples of 10 closest to s, sp10 and tp10, is inside the rounding\n  // interval. 0x19999999999999A0 is slightly more than ((1 << 64) / 10).\n  uint64_t s = vb >> 2;\n  if (s >= 100) {\n    uint64_t sp10 = 10 * wuffs_base__multiply_u64(s, 0x19999999999999A0).hi;\n    uint64_t tp10 = sp10 + 10;\n    bool upin = (vbl + out) <= (sp10 << 2);\n    bool wpin = ((tp10 << 2) + out) <= vbr;\n    if (upin != wpin) {\n      *digits = upin ? sp10 : tp10;\n  " +
+	"    *exp10 = k;\n      return;\n    }\n  }\n\n  // Otherwise, see if exactly one of s and t = (s + 1) is inside the rounding\n  // interval. If both are, pick the closer one, breaking ties to even.\n  uint64_t t = s + 1;\n  bool uin = (vbl + out) <= (s << 2);\n  bool win = ((t << 2) + out) <= vbr;\n  if (uin != win) {\n    *digits = uin ? s : t;\n    *exp10 = k;\n    return;\n  }\n  int64_t cmp = (int64_t)(vb - ((s + t) << 1));\n  *digits = ((cmp < 0) || ((cmp == 0) && ((s & 1) == 0))) ? s : t;\n  *exp10 = k;\n}\n\n// wuffs_base__private_implementation__render_number_f64_finite writes the\n// non-zero, finite f64 value with the given bits, other than its sign bit, to\n// p and returns the advanced p. It writes at most 24 bytes.\nstatic uint8_t*  //\nwuffs_base__private_implementation__render_number_f64_finite(uint8_t* p,\n                                                             uint64_t bits) {\n  uint32_t biased_exp2 = (uint32_t)((bits >> 52) & 0x7FF);\n  uint64_t man = bits & 0x000FFFFFFFFFFFFF;\n\n  // Find the shortest decimal re" +
+	"presentation, (digits * (10 ** exp10)).\n  uint64_t digits = 0;\n  int32_t exp10 = 0;\n  if (biased_exp2 != 0) {\n    // Normal numbers have an implicit mantissa bit. The value is (c * (2 **\n    // -mq)). If that's a small integer, Schubfach isn't needed.\n    uint64_t c = man | 0x0010000000000000;\n    int32_t mq = 1075 - ((int32_t)biased_exp2);\n    if ((0 < mq) && (mq < 53) && (((c >> mq) << mq) == c)) {\n      digits = c >> mq;\n    } else {\n      wuffs_base__private_implementation__schubfach(c, -mq, &digits, &exp10);\n    }\n  } else if (man >= 3) {\n    wuffs_base__private_implementation__schubfach(man, -1074, &digits, &exp10);\n  } else {\n    // Schubfach needs more than one digit's worth of precision, which the two\n    // smallest subnormals, 4.94e-324 and 9.88e-324, don't have. Java's\n    // Double.toString works around that by rendering an extra digit, as\n    // \"4.9E-324\" and \"9.9E-324\", but \"5e-324\" and \"1e-323\" are shorter and\n    // still round-trip.\n    digits = (man == 1) ? 5 : 1;\n    exp10 = (man == 1) ? " +
+	"-324 : -323;\n  }\n  while ((digits % 10) == 0) {\n    digits /= 10;\n    exp10++;\n  }\n\n  // Convert digits to ASCII. There are at most 17 of them.\n  uint8_t d_buf[20];\n  uint8_t* const d_end = d_buf + 20;\n  uint8_t* d = d_end;\n  do {\n    *--d = (uint8_t)('0' + (digits % 10));\n    digits /= 10;\n  } while (digits > 0);\n  int32_t nd = (int32_t)(d_end - d);\n\n  // The value is (0.ddd * (10 ** n)). Lay out the digits as per ECMAScript's\n  // Number.prototype.toString.\n  int32_t n = exp10 + nd;\n  if ((nd <= n) && (n <= 21)) {\n    // Integers, such as \"123\" and \"45600\".\n    memcpy(p, d, (size_t)nd);\n    p += nd;\n    memset(p, '0', (size_t)(n - nd));\n    p += n - nd;\n  } else if ((0 < n) && (n <= 21)) {\n    // Positional notation with an integral part, such as \"1.5\".\n    memcpy(p, d, (size_t)n);\n    p += n;\n    *p++ = '.';\n    memcpy(p, d + n, (size_t)(nd - n));\n    p += nd - n;\n  } else if ((-6 < n) && (n <= 0)) {\n    // Positional notation without an integral part, such as \"0.0025\".\n    *p++ = '0';\n    *p++ = '.';\n    " +
+	"memset(p, '0', (size_t)(-n));\n    p += -n;\n    memcpy(p, d, (size_t)nd);\n    p += nd;\n  } else {\n    // Exponential notation, such as \"1e+300\" and \"2.5e-7\".\n    *p++ = d[0];\n    if (nd > 1) {\n      *p++ = '.';\n      memcpy(p, d + 1, (size_t)(nd - 1));\n      p += nd - 1;\n    }\n    *p++ = 'e';\n    int32_t e = n - 1;\n    if (e < 0) {\n      *p++ = '-';\n      e = -e;\n    } else {\n      *p++ = '+';\n    }\n    if (e >= 100) {\n      *p++ = (uint8_t)('0' + (e / 100));\n    }\n    if (e >= 10) {\n      *p++ = (uint8_t)('0' + ((e / 10) % 10));\n    }\n    *p++ = (uint8_t)('0' + (e % 10));\n  }\n  return p;\n}\n\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__render_number_f64(wuffs_base__slice_u8 dst,\n                              double x,\n                              uint32_t options) {\n  uint64_t bits = wuffs_base__ieee_754_bit_representation__from_f64(x);\n  bool is_nan = ((bits & 0x7FF0000000000000) == 0x7FF0000000000000) &&\n                ((bits & 0x000FFFFFFFFFFFFF) != 0);\n\n  uint8_t buf[WUFFS_BASE__F64__BYTE_LENGTH__MAX_" +
+	"INCL];\n  uint8_t* p = buf;\n\n  if (((bits & 0x7FF0000000000000) == 0x7FF0000000000000) &&\n      (options & WUFFS_BASE__RENDER_NUMBER_FXX__INF_NAN_AS_NULL)) {\n    memcpy(p, \"null\", 4);\n    p += 4;\n  } else if (is_nan) {\n    memcpy(p, \"NaN\", 3);\n    p += 3;\n  } else {\n    if (bits >> 63) {\n      *p++ = '-';\n    } else if (options & WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN) {\n      *p++ = '+';\n    }\n    bits &= 0x7FFFFFFFFFFFFFFF;\n    if (bits == 0) {\n      *p++ = '0';\n    } else if (bits == 0x7FF0000000000000) {\n      memcpy(p, \"Infinity\", 8);\n      p += 8;\n    } else {\n      p = wuffs_base__private_implementation__render_number_f64_finite(p, bits);\n    }\n  }\n\n  size_t len = (size_t)(p - buf);\n  if (len > dst.len) {\n    return 0;\n  }\n  memcpy(dst.ptr, buf, len);\n  return len;\n}\n" +
 	""
 
 const basePixConvSubmoduleC = "" +
 	"// ---------------- Pixel Swizzler\n\nstatic inline uint32_t  //\nwuffs_base__swap_u32_argb_abgr(uint32_t u) {\n  uint32_t o = u & 0xFF00FF00;\n  uint32_t r = u & 0x00FF0000;\n  uint32_t b = u & 0x000000FF;\n  return o | (r >> 16) | (b << 16);\n}\n\n" +
 	"" +
-	"// --------\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__color_u32_argb_premul  //\nwuffs_base__pixel_buffer__color_u32_at(const wuffs_base__pixel_buffer* pb,\n                                       uint32_t x,\n                                       uint32_t y) {\n  if (!pb || (x >= pb->pixcfg.private_impl.width) ||\n      (y >= pb->pixcfg.private_impl.height)) {\n    return 0;\n  }\n\n  if (wuffs_base__pixel_format__is_planar(&pb->pixcfg.private_impl.pixfmt)) {\n    // TODO: support planar formats.\n    return 0;\n  }\n\n  size_t stride = pb->private_impl.planes[0].stride;\n  uint8_t* row = pb->private_impl.planes[0].ptr + (stride * ((size_t)y));\n\n  switch (pb->pixcfg.private_impl.pixfmt.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n      return wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x)));\n\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY: {\n      uint8_t* palette = pb->private_impl.plane" +
-	"s[3].ptr;\n      return wuffs_base__load_u32le__no_bounds_check(palette +\n                                                     (4 * ((size_t)row[x])));\n    }\n\n      // Common formats above. Rarer formats below.\n\n    case WUFFS_BASE__PIXEL_FORMAT__Y:\n      return 0xFF000000 | (0x00010101 * ((uint32_t)(row[x])));\n\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL: {\n      uint8_t* palette = pb->private_impl.planes[3].ptr;\n      return wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(\n          wuffs_base__load_u32le__no_bounds_check(palette +\n                                                  (4 * ((size_t)row[x]))));\n    }\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      return wuffs_base__color_u16_rgb_565__as__color_u32_argb_premul(\n          wuffs_base__load_u16le__no_bounds_check(row + (2 * ((size_t)x))));\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      return 0xFF000000 |\n             wuffs_base__load_u24le__no_bounds_check(row + (3 * ((size_t)x)));\n    case WUFFS_BASE__PIXEL_FORMAT_" +
-	"_BGRA_NONPREMUL:\n      return wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(\n          wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x))));\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n      return 0xFF000000 |\n             wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x)));\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n      return wuffs_base__swap_u32_argb_abgr(\n          0xFF000000 |\n          wuffs_base__load_u24le__no_bounds_check(row + (3 * ((size_t)x))));\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n      return wuffs_base__swap_u32_argb_abgr(\n          wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(\n              wuffs_base__load_u32le__no_bounds_check(row +\n                                                      (4 * ((size_t)x)))));\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:\n      return wuffs_base__swap_u32_argb_abgr(\n          wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x)" +
-	")));\n    case WUFFS_BASE__PIXEL_FORMAT__RGBX:\n      return wuffs_base__swap_u32_argb_abgr(\n          0xFF000000 |\n          wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x))));\n\n    default:\n      // TODO: support more formats.\n      break;\n  }\n\n  return 0;\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_buffer__set_color_u32_at(\n    wuffs_base__pixel_buffer* pb,\n    uint32_t x,\n    uint32_t y,\n    wuffs_base__color_u32_argb_premul color) {\n  if (!pb) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  }\n  if ((x >= pb->pixcfg.private_impl.width) ||\n      (y >= pb->pixcfg.private_impl.height)) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  }\n\n  if (wuffs_base__pixel_format__is_planar(&pb->pixcfg.private_impl.pixfmt)) {\n    // TODO: support planar formats.\n    return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n  }\n\n  size_t stride = pb->private_impl.planes[0].stride;\n  uint8_t* row = pb->private_impl.planes[0]" +
-	".ptr + (stride * ((size_t)y));\n\n  switch (pb->pixcfg.private_impl.pixfmt.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n      wuffs_base__store_u32le__no_bounds_check(row + (4 * ((size_t)x)), color);\n      break;\n\n      // Common formats above. Rarer formats below.\n\n    case WUFFS_BASE__PIXEL_FORMAT__Y:\n      wuffs_base__store_u8__no_bounds_check(\n          row + ((size_t)x),\n          wuffs_base__color_u32_argb_premul__as__color_u8_gray(color));\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:\n      wuffs_base__store_u8__no_bounds_check(\n          row + ((size_t)x), wuffs_base__pixel_palette__closest_element(\n                                 wuffs_base__pixel_buffer__palette(pb),\n                                 pb->pixcfg.private_impl.pixfmt, color));\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      wuffs_base__store_u16le__no_bounds_check(\n          row + (2 * ((size_t)x)),\n          wuffs_base__color_u32_argb_premul__as" +
-	"__color_u16_rgb_565(color));\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      wuffs_base__store_u24le__no_bounds_check(row + (3 * ((size_t)x)), color);\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n      wuffs_base__store_u32le__no_bounds_check(\n          row + (4 * ((size_t)x)),\n          wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(\n              color));\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n      wuffs_base__store_u24le__no_bounds_check(\n          row + (3 * ((size_t)x)), wuffs_base__swap_u32_argb_abgr(color));\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n      wuffs_base__store_u32le__no_bounds_check(\n          row + (4 * ((size_t)x)),\n          wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(\n              wuffs_base__swap_u32_argb_abgr(color)));\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBX:\n      wuffs_base__store_u32le__no_bounds_check(\n          row" +
-	" + (4 * ((size_t)x)), wuffs_base__swap_u32_argb_abgr(color));\n      break;\n\n    default:\n      // TODO: support more formats.\n      return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n  }\n\n  return wuffs_base__make_status(NULL);\n}\n\n" +
+	"// --------\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__color_u32_argb_premul  //\nwuffs_base__pixel_buffer__color_u32_at(const wuffs_base__pixel_buffer* pb,\n                                       uint32_t x,\n                                       uint32_t y) {\n  if (!pb || (x >= pb->pixcfg.private_impl.width) ||\n      (y >= pb->pixcfg.private_impl.height)) {\n    return 0;\n  }\n\n  if (wuffs_base__pixel_format__is_planar(&pb->pixcfg.private_impl.pixfmt)) {\n    if (pb->pixcfg.private_impl.pixfmt.repr !=\n        WUFFS_BASE__PIXEL_FORMAT__YCBCR) {\n      // TODO: support more planar formats.\n      return 0;\n    }\n    uint8_t samples[3];\n    uint32_t p;\n    for (p = 0; p < 3; p++) {\n      const wuffs_base__pixel_subsampling* pixsub =\n          &pb->pixcfg.private_impl.pixsub;\n      const wuffs_base__table_u8* tab = &pb->private_impl.planes[p];\n      size_t i = (x + wuffs_base__pixel_subsampling__bias_x(pixsub, p)) /\n                 wuffs_base__pixel_subsampling__denominator_x(pixsub, p);\n      size_t j = (y + wuffs_base__" +
+	"pixel_subsampling__bias_y(pixsub, p)) /\n                 wuffs_base__pixel_subsampling__denominator_y(pixsub, p);\n      if ((i >= tab->width) || (j >= tab->height)) {\n        return 0;\n      }\n      samples[p] = tab->ptr[(j * tab->stride) + i];\n    }\n    return wuffs_base__color_ycc__as__color_u32_argb_premul(\n        samples[0], samples[1], samples[2]);\n  }\n\n  size_t stride = pb->private_impl.planes[0].stride;\n  uint8_t* row = pb->private_impl.planes[0].ptr + (stride * ((size_t)y));\n\n  switch (pb->pixcfg.private_impl.pixfmt.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n      return wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x)));\n\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY: {\n      uint8_t* palette = pb->private_impl.planes[3].ptr;\n      return wuffs_base__load_u32le__no_bounds_check(palette +\n                                                     (4 * ((size_t)row[x]" +
+	")));\n    }\n\n      // Common formats above. Rarer formats below.\n\n    case WUFFS_BASE__PIXEL_FORMAT__Y:\n      return 0xFF000000 | (0x00010101 * ((uint32_t)(row[x])));\n\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL: {\n      uint8_t* palette = pb->private_impl.planes[3].ptr;\n      return wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(\n          wuffs_base__load_u32le__no_bounds_check(palette +\n                                                  (4 * ((size_t)row[x]))));\n    }\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      return wuffs_base__color_u16_rgb_565__as__color_u32_argb_premul(\n          wuffs_base__load_u16le__no_bounds_check(row + (2 * ((size_t)x))));\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      return 0xFF000000 |\n             wuffs_base__load_u24le__no_bounds_check(row + (3 * ((size_t)x)));\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n      return wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(\n          wuffs_base__load_u32le__no_bounds_check(r" +
+	"ow + (4 * ((size_t)x))));\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n      return 0xFF000000 |\n             wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x)));\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE:\n      return wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(\n          wuffs_base__color_u64__as__color_u32(\n              wuffs_base__load_u64le__no_bounds_check(row +\n                                                      (8 * ((size_t)x)))));\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:\n      return wuffs_base__color_u64__as__color_u32(\n          wuffs_base__load_u64le__no_bounds_check(row + (8 * ((size_t)x))));\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n      return wuffs_base__swap_u32_argb_abgr(\n          0xFF000000 |\n          wuffs_base__load_u24le__no_bounds_check(row + (3 * ((size_t)x))));\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n      return wuffs_base__swap_u32_argb_abgr(\n          wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb" +
+	"_premul(\n              wuffs_base__load_u32le__no_bounds_check(row +\n                                                      (4 * ((size_t)x)))));\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:\n      return wuffs_base__swap_u32_argb_abgr(\n          wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x))));\n    case WUFFS_BASE__PIXEL_FORMAT__RGBX:\n      return wuffs_base__swap_u32_argb_abgr(\n          0xFF000000 |\n          wuffs_base__load_u32le__no_bounds_check(row + (4 * ((size_t)x))));\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL_4X16LE:\n      return wuffs_base__swap_u32_argb_abgr(\n          wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(\n              wuffs_base__color_u64__as__color_u32(\n                  wuffs_base__load_u64le__no_bounds_check(row +\n                                                          (8 * ((size_t)x))))));\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:\n      return wuffs_base__swap_u32_argb_abgr(\n" +
+	"          wuffs_base__color_u64__as__color_u32(\n              wuffs_base__load_u64le__no_bounds_check(row +\n                                                      (8 * ((size_t)x)))));\n\n    default:\n      // TODO: support more formats.\n      break;\n  }\n\n  return 0;\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_buffer__set_color_u32_at(\n    wuffs_base__pixel_buffer* pb,\n    uint32_t x,\n    uint32_t y,\n    wuffs_base__color_u32_argb_premul color) {\n  if (!pb) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  }\n  if ((x >= pb->pixcfg.private_impl.width) ||\n      (y >= pb->pixcfg.private_impl.height)) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  }\n\n  if (wuffs_base__pixel_format__is_planar(&pb->pixcfg.private_impl.pixfmt)) {\n    // TODO: support planar formats.\n    return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n  }\n\n  size_t stride = pb->private_impl.planes[0].stride;\n  uint8_t* row = pb->private_impl.planes[0].ptr + " +
+	"(stride * ((size_t)y));\n\n  switch (pb->pixcfg.private_impl.pixfmt.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n      wuffs_base__store_u32le__no_bounds_check(row + (4 * ((size_t)x)), color);\n      break;\n\n      // Common formats above. Rarer formats below.\n\n    case WUFFS_BASE__PIXEL_FORMAT__Y:\n      wuffs_base__store_u8__no_bounds_check(\n          row + ((size_t)x),\n          wuffs_base__color_u32_argb_premul__as__color_u8_gray(color));\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:\n      wuffs_base__store_u8__no_bounds_check(\n          row + ((size_t)x), wuffs_base__pixel_palette__closest_element(\n                                 wuffs_base__pixel_buffer__palette(pb),\n                                 pb->pixcfg.private_impl.pixfmt, color));\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      wuffs_base__store_u16le__no_bounds_check(\n          row + (2 * ((size_t)x)),\n          wuffs_base__color_u32_argb_premul__as__color" +
+	"_u16_rgb_565(color));\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      wuffs_base__store_u24le__no_bounds_check(row + (3 * ((size_t)x)), color);\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n      wuffs_base__store_u32le__no_bounds_check(\n          row + (4 * ((size_t)x)),\n          wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(\n              color));\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE:\n      wuffs_base__store_u64le__no_bounds_check(\n          row + (8 * ((size_t)x)),\n          wuffs_base__color_u32__as__color_u64(\n              wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(\n                  color)));\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:\n      wuffs_base__store_u64le__no_bounds_check(\n          row + (8 * ((size_t)x)), wuffs_base__color_u32__as__color_u64(color));\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n      wuffs_base__store_u24le__no_bounds_check(\n          row +" +
+	" (3 * ((size_t)x)), wuffs_base__swap_u32_argb_abgr(color));\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n      wuffs_base__store_u32le__no_bounds_check(\n          row + (4 * ((size_t)x)),\n          wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(\n              wuffs_base__swap_u32_argb_abgr(color)));\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBX:\n      wuffs_base__store_u32le__no_bounds_check(\n          row + (4 * ((size_t)x)), wuffs_base__swap_u32_argb_abgr(color));\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL_4X16LE:\n      wuffs_base__store_u64le__no_bounds_check(\n          row + (8 * ((size_t)x)),\n          wuffs_base__color_u32__as__color_u64(\n              wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(\n                  wuffs_base__swap_u32_argb_abgr(color))));\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:\n      wuffs_base__store_u64le__no_bounds_check(\n     " +
+	"     row + (8 * ((size_t)x)), wuffs_base__color_u32__as__color_u64(\n                                       wuffs_base__swap_u32_argb_abgr(color)));\n      break;\n\n    default:\n      // TODO: support more formats.\n      return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n  }\n\n  return wuffs_base__make_status(NULL);\n}\n\n" +
 	"" +
 	"// --------\n\nWUFFS_BASE__MAYBE_STATIC uint8_t  //\nwuffs_base__pixel_palette__closest_element(\n    wuffs_base__slice_u8 palette_slice,\n    wuffs_base__pixel_format palette_format,\n    wuffs_base__color_u32_argb_premul c) {\n  size_t n = palette_slice.len / 4;\n  if (n > 256) {\n    n = 256;\n  }\n  size_t best_index = 0;\n  uint64_t best_score = 0xFFFFFFFFFFFFFFFF;\n\n  // Work in 16-bit color.\n  uint32_t ca = 0x101 * (0xFF & (c >> 24));\n  uint32_t cr = 0x101 * (0xFF & (c >> 16));\n  uint32_t cg = 0x101 * (0xFF & (c >> 8));\n  uint32_t cb = 0x101 * (0xFF & (c >> 0));\n\n  switch (palette_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY: {\n      bool nonpremul = palette_format.repr ==\n                       WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL;\n\n      size_t i;\n      for (i = 0; i < n; i++) {\n        // Work in 16-bit color.\n        uint32_t pb = 0x101 * ((uint32_t)(palette" +
 	"_slice.ptr[(4 * i) + 0]));\n        uint32_t pg = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 1]));\n        uint32_t pr = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 2]));\n        uint32_t pa = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 3]));\n\n        // Convert to premultiplied alpha.\n        if (nonpremul && (pa != 0xFFFF)) {\n          pb = (pb * pa) / 0xFFFF;\n          pg = (pg * pa) / 0xFFFF;\n          pr = (pr * pa) / 0xFFFF;\n        }\n\n        // These deltas are conceptually int32_t (signed) but after squaring,\n        // it's equivalent to work in uint32_t (unsigned).\n        pb -= cb;\n        pg -= cg;\n        pr -= cr;\n        pa -= ca;\n        uint64_t score = ((uint64_t)(pb * pb)) + ((uint64_t)(pg * pg)) +\n                         ((uint64_t)(pr * pr)) + ((uint64_t)(pa * pa));\n        if (best_score > score) {\n          best_score = score;\n          best_index = i;\n        }\n      }\n      break;\n    }\n  }\n\n  return (uint8_t)best_index;\n}\n\n" +
 	"" +
+	"// --------\n\nstatic inline uint32_t  //\nwuffs_base__pixel_palette_lookup__cache_slot(\n    wuffs_base__color_u32_argb_premul c) {\n  // This is Fibonacci hashing, keeping the high bits of the product.\n  return (uint32_t)(((uint32_t)(c * 0x9E3779B1u)) >> 20) &\n         (WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE - 1);\n}\n\nstatic inline void  //\nwuffs_base__pixel_palette_lookup__consider(\n    const wuffs_base__pixel_palette_lookup* p,\n    uint32_t i,\n    uint32_t cb,\n    uint32_t cg,\n    uint32_t cr,\n    uint32_t ca,\n    uint64_t* best_score,\n    uint32_t* best_index) {\n  const uint32_t* e = &p->private_impl.elements[i][0];\n  // These deltas are conceptually int32_t (signed) but after squaring, it's\n  // equivalent to work in uint32_t (unsigned).\n  uint32_t pb = e[0] - cb;\n  uint32_t pg = e[1] - cg;\n  uint32_t pr = e[2] - cr;\n  uint32_t pa = e[3] - ca;\n  uint64_t score = ((uint64_t)(pb * pb)) + ((uint64_t)(pg * pg)) +\n                   ((uint64_t)(pr * pr)) + ((uint64_t)(pa * pa));\n  if ((*best_score > score) |" +
+	"| ((*best_score == score) && (*best_index > i))) {\n    *best_score = score;\n    *best_index = i;\n  }\n}\n\n// wuffs_base__pixel_palette_lookup__search finds the same element as\n// wuffs_base__pixel_palette__closest_element would, but instead of scoring\n// every element, it walks outwards (in both directions) from c's green value\n// through the elements sorted by green. A walk stops once the green delta\n// alone, squared, exceeds the best score so far, as no further element in\n// that direction can then score better (or equal, which would also need a\n// smaller index comparison).\nstatic uint8_t  //\nwuffs_base__pixel_palette_lookup__search(\n    const wuffs_base__pixel_palette_lookup* p,\n    wuffs_base__color_u32_argb_premul c) {\n  uint32_t n = p->private_impl.num_elements;\n  if (n == 0) {\n    return 0;\n  }\n  uint64_t best_score = 0xFFFFFFFFFFFFFFFF;\n  uint32_t best_index = 0;\n\n  // Work in 16-bit color.\n  uint32_t ca = 0x101 * (0xFF & (c >> 24));\n  uint32_t cr = 0x101 * (0xFF & (c >> 16));\n  uint32_t cg = 0x101 * " +
+	"(0xFF & (c >> 8));\n  uint32_t cb = 0x101 * (0xFF & (c >> 0));\n\n  // Binary search for the first sorted position whose green is >= cg.\n  const uint8_t* sorted = &p->private_impl.sorted_by_green[0];\n  uint32_t lo = 0;\n  uint32_t hi = n;\n  while (lo < hi) {\n    uint32_t mid = lo + ((hi - lo) / 2);\n    if (p->private_impl.elements[sorted[mid]][1] < cg) {\n      lo = mid + 1;\n    } else {\n      hi = mid;\n    }\n  }\n\n  // Walk upwards from hi and downwards from lo.\n  hi = lo;\n  bool up = hi < n;\n  bool down = lo > 0;\n  while (up || down) {\n    if (up) {\n      uint32_t i = sorted[hi];\n      uint64_t dg = p->private_impl.elements[i][1] - cg;\n      if ((dg * dg) > best_score) {\n        up = false;\n      } else {\n        wuffs_base__pixel_palette_lookup__consider(p, i, cb, cg, cr, ca,\n                                                   &best_score, &best_index);\n        hi++;\n        up = hi < n;\n      }\n    }\n    if (down) {\n      uint32_t i = sorted[lo - 1];\n      uint64_t dg = cg - p->private_impl.elements[i][1];\n     " +
+	" if ((dg * dg) > best_score) {\n        down = false;\n      } else {\n        wuffs_base__pixel_palette_lookup__consider(p, i, cb, cg, cr, ca,\n                                                   &best_score, &best_index);\n        lo--;\n        down = lo > 0;\n      }\n    }\n  }\n\n  return (uint8_t)best_index;\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_palette_lookup__prepare(\n    wuffs_base__pixel_palette_lookup* p,\n    wuffs_base__slice_u8 palette_slice,\n    wuffs_base__pixel_format palette_format) {\n  if (!p) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  }\n  p->private_impl.num_elements = 0;\n\n  bool nonpremul = false;\n  switch (palette_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL:\n      nonpremul = true;\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:\n      break;\n    default:\n      return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n  " +
+	"}\n\n  size_t n = palette_slice.len / 4;\n  if (n > 256) {\n    n = 256;\n  }\n  size_t i;\n  for (i = 0; i < n; i++) {\n    // Work in 16-bit color.\n    uint32_t pb = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 0]));\n    uint32_t pg = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 1]));\n    uint32_t pr = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 2]));\n    uint32_t pa = 0x101 * ((uint32_t)(palette_slice.ptr[(4 * i) + 3]));\n\n    // Convert to premultiplied alpha.\n    if (nonpremul && (pa != 0xFFFF)) {\n      pb = (pb * pa) / 0xFFFF;\n      pg = (pg * pa) / 0xFFFF;\n      pr = (pr * pa) / 0xFFFF;\n    }\n\n    p->private_impl.elements[i][0] = pb;\n    p->private_impl.elements[i][1] = pg;\n    p->private_impl.elements[i][2] = pr;\n    p->private_impl.elements[i][3] = pa;\n  }\n  p->private_impl.num_elements = (uint32_t)n;\n\n  // Insertion sort the element indexes by green. The sort is stable, but the\n  // search doesn't rely on that, as it compares indexes to break ties.\n  uint8_t* sorted = &p->private_impl.sorted_by_gre" +
+	"en[0];\n  for (i = 0; i < n; i++) {\n    uint32_t g = p->private_impl.elements[i][1];\n    size_t j = i;\n    while ((j > 0) && (p->private_impl.elements[sorted[j - 1]][1] > g)) {\n      sorted[j] = sorted[j - 1];\n      j--;\n    }\n    sorted[j] = (uint8_t)i;\n  }\n\n  // Fill every cache slot with the answer for transparent black. Any other\n  // color doesn't match, regardless of which slot it hashes to, so this is\n  // equivalent to an empty cache, but without a separate \"valid\" bit.\n  uint8_t zero_index = wuffs_base__pixel_palette_lookup__search(p, 0);\n  for (i = 0; i < WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE; i++) {\n    p->private_impl.cache_colors[i] = 0;\n    p->private_impl.cache_indexes[i] = zero_index;\n  }\n\n  return wuffs_base__make_status(NULL);\n}\n\nWUFFS_BASE__MAYBE_STATIC uint8_t  //\nwuffs_base__pixel_palette_lookup__closest_element(\n    wuffs_base__pixel_palette_lookup* p,\n    wuffs_base__color_u32_argb_premul c) {\n  if (!p) {\n    return 0;\n  }\n  uint32_t slot = wuffs_base__pixel_palette_lookup__cache_" +
+	"slot(c);\n  if (p->private_impl.cache_colors[slot] != c) {\n    p->private_impl.cache_colors[slot] = c;\n    p->private_impl.cache_indexes[slot] =\n        wuffs_base__pixel_palette_lookup__search(p, c);\n  }\n  return p->private_impl.cache_indexes[slot];\n}\n\n" +
+	"" +
 	"// --------\n\nstatic inline uint32_t  //\nwuffs_base__composite_nonpremul_nonpremul_u32_axxx(uint32_t dst_nonpremul,\n                                                   uint32_t src_nonpremul) {\n  // Convert from 8-bit color to 16-bit color.\n  uint32_t sa = 0x101 * (0xFF & (src_nonpremul >> 24));\n  uint32_t sr = 0x101 * (0xFF & (src_nonpremul >> 16));\n  uint32_t sg = 0x101 * (0xFF & (src_nonpremul >> 8));\n  uint32_t sb = 0x101 * (0xFF & (src_nonpremul >> 0));\n  uint32_t da = 0x101 * (0xFF & (dst_nonpremul >> 24));\n  uint32_t dr = 0x101 * (0xFF & (dst_nonpremul >> 16));\n  uint32_t dg = 0x101 * (0xFF & (dst_nonpremul >> 8));\n  uint32_t db = 0x101 * (0xFF & (dst_nonpremul >> 0));\n\n  // Convert dst from nonpremul to premul.\n  dr = (dr * da) / 0xFFFF;\n  dg = (dg * da) / 0xFFFF;\n  db = (db * da) / 0xFFFF;\n\n  // Calculate the inverse of the src-alpha: how much of the dst to keep.\n  uint32_t ia = 0xFFFF - sa;\n\n  // Composite src (nonpremul) over dst (premul).\n  da = sa + ((da * ia) / 0xFFFF);\n  dr = ((sr * sa) + (dr * i" +
 	"a)) / 0xFFFF;\n  dg = ((sg * sa) + (dg * ia)) / 0xFFFF;\n  db = ((sb * sa) + (db * ia)) / 0xFFFF;\n\n  // Convert dst from premul to nonpremul.\n  if (da != 0) {\n    dr = (dr * 0xFFFF) / da;\n    dg = (dg * 0xFFFF) / da;\n    db = (db * 0xFFFF) / da;\n  }\n\n  // Convert from 16-bit color to 8-bit color and combine the components.\n  da >>= 8;\n  dr >>= 8;\n  dg >>= 8;\n  db >>= 8;\n  return (db << 0) | (dg << 8) | (dr << 16) | (da << 24);\n}\n\nstatic inline uint32_t  //\nwuffs_base__composite_nonpremul_premul_u32_axxx(uint32_t dst_nonpremul,\n                                                uint32_t src_premul) {\n  // Convert from 8-bit color to 16-bit color.\n  uint32_t sa = 0x101 * (0xFF & (src_premul >> 24));\n  uint32_t sr = 0x101 * (0xFF & (src_premul >> 16));\n  uint32_t sg = 0x101 * (0xFF & (src_premul >> 8));\n  uint32_t sb = 0x101 * (0xFF & (src_premul >> 0));\n  uint32_t da = 0x101 * (0xFF & (dst_nonpremul >> 24));\n  uint32_t dr = 0x101 * (0xFF & (dst_nonpremul >> 16));\n  uint32_t dg = 0x101 * (0xFF & (dst_nonpremul >> 8))" +
 	";\n  uint32_t db = 0x101 * (0xFF & (dst_nonpremul >> 0));\n\n  // Convert dst from nonpremul to premul.\n  dr = (dr * da) / 0xFFFF;\n  dg = (dg * da) / 0xFFFF;\n  db = (db * da) / 0xFFFF;\n\n  // Calculate the inverse of the src-alpha: how much of the dst to keep.\n  uint32_t ia = 0xFFFF - sa;\n\n  // Composite src (premul) over dst (premul).\n  da = sa + ((da * ia) / 0xFFFF);\n  dr = sr + ((dr * ia) / 0xFFFF);\n  dg = sg + ((dg * ia) / 0xFFFF);\n  db = sb + ((db * ia) / 0xFFFF);\n\n  // Convert dst from premul to nonpremul.\n  if (da != 0) {\n    dr = (dr * 0xFFFF) / da;\n    dg = (dg * 0xFFFF) / da;\n    db = (db * 0xFFFF) / da;\n  }\n\n  // Convert from 16-bit color to 8-bit color and combine the components.\n  da >>= 8;\n  dr >>= 8;\n  dg >>= 8;\n  db >>= 8;\n  return (db << 0) | (dg << 8) | (dr << 16) | (da << 24);\n}\n\nstatic inline uint32_t  //\nwuffs_base__composite_premul_nonpremul_u32_axxx(uint32_t dst_premul,\n                                                uint32_t src_nonpremul) {\n  // Convert from 8-bit color to 16-bit color.\n " +
 	" uint32_t sa = 0x101 * (0xFF & (src_nonpremul >> 24));\n  uint32_t sr = 0x101 * (0xFF & (src_nonpremul >> 16));\n  uint32_t sg = 0x101 * (0xFF & (src_nonpremul >> 8));\n  uint32_t sb = 0x101 * (0xFF & (src_nonpremul >> 0));\n  uint32_t da = 0x101 * (0xFF & (dst_premul >> 24));\n  uint32_t dr = 0x101 * (0xFF & (dst_premul >> 16));\n  uint32_t dg = 0x101 * (0xFF & (dst_premul >> 8));\n  uint32_t db = 0x101 * (0xFF & (dst_premul >> 0));\n\n  // Calculate the inverse of the src-alpha: how much of the dst to keep.\n  uint32_t ia = 0xFFFF - sa;\n\n  // Composite src (nonpremul) over dst (premul).\n  da = sa + ((da * ia) / 0xFFFF);\n  dr = ((sr * sa) + (dr * ia)) / 0xFFFF;\n  dg = ((sg * sa) + (dg * ia)) / 0xFFFF;\n  db = ((sb * sa) + (db * ia)) / 0xFFFF;\n\n  // Convert from 16-bit color to 8-bit color and combine the components.\n  da >>= 8;\n  dr >>= 8;\n  dg >>= 8;\n  db >>= 8;\n  return (db << 0) | (dg << 8) | (dr << 16) | (da << 24);\n}\n\nstatic inline uint32_t  //\nwuffs_base__composite_premul_premul_u32_axxx(uint32_t dst_premul,\n    " +
-	"                                         uint32_t src_premul) {\n  // Convert from 8-bit color to 16-bit color.\n  uint32_t sa = 0x101 * (0xFF & (src_premul >> 24));\n  uint32_t sr = 0x101 * (0xFF & (src_premul >> 16));\n  uint32_t sg = 0x101 * (0xFF & (src_premul >> 8));\n  uint32_t sb = 0x101 * (0xFF & (src_premul >> 0));\n  uint32_t da = 0x101 * (0xFF & (dst_premul >> 24));\n  uint32_t dr = 0x101 * (0xFF & (dst_premul >> 16));\n  uint32_t dg = 0x101 * (0xFF & (dst_premul >> 8));\n  uint32_t db = 0x101 * (0xFF & (dst_premul >> 0));\n\n  // Calculate the inverse of the src-alpha: how much of the dst to keep.\n  uint32_t ia = 0xFFFF - sa;\n\n  // Composite src (premul) over dst (premul).\n  da = sa + ((da * ia) / 0xFFFF);\n  dr = sr + ((dr * ia) / 0xFFFF);\n  dg = sg + ((dg * ia) / 0xFFFF);\n  db = sb + ((db * ia) / 0xFFFF);\n\n  // Convert from 16-bit color to 8-bit color and combine the components.\n  da >>= 8;\n  dr >>= 8;\n  dg >>= 8;\n  db >>= 8;\n  return (db << 0) | (dg << 8) | (dr << 16) | (da << 24);\n}\n\n" +
+	"                                         uint32_t src_premul) {\n  // Convert from 8-bit color to 16-bit color.\n  uint32_t sa = 0x101 * (0xFF & (src_premul >> 24));\n  uint32_t sr = 0x101 * (0xFF & (src_premul >> 16));\n  uint32_t sg = 0x101 * (0xFF & (src_premul >> 8));\n  uint32_t sb = 0x101 * (0xFF & (src_premul >> 0));\n  uint32_t da = 0x101 * (0xFF & (dst_premul >> 24));\n  uint32_t dr = 0x101 * (0xFF & (dst_premul >> 16));\n  uint32_t dg = 0x101 * (0xFF & (dst_premul >> 8));\n  uint32_t db = 0x101 * (0xFF & (dst_premul >> 0));\n\n  // Calculate the inverse of the src-alpha: how much of the dst to keep.\n  uint32_t ia = 0xFFFF - sa;\n\n  // Composite src (premul) over dst (premul).\n  da = sa + ((da * ia) / 0xFFFF);\n  dr = sr + ((dr * ia) / 0xFFFF);\n  dg = sg + ((dg * ia) / 0xFFFF);\n  db = sb + ((db * ia) / 0xFFFF);\n\n  // Convert from 16-bit color to 8-bit color and combine the components.\n  da >>= 8;\n  dr >>= 8;\n  dg >>= 8;\n  db >>= 8;\n  return (db << 0) | (dg << 8) | (dr << 16) | (da << 24);\n}\n\nstatic inline uint64_" +
+	"t  //\nwuffs_base__composite_premul_premul_u64_axxx(uint64_t dst_premul,\n                                             uint64_t src_premul) {\n  uint64_t sa = 0xFFFF & (src_premul >> 48);\n  uint64_t sr = 0xFFFF & (src_premul >> 32);\n  uint64_t sg = 0xFFFF & (src_premul >> 16);\n  uint64_t sb = 0xFFFF & (src_premul >> 0);\n  uint64_t da = 0xFFFF & (dst_premul >> 48);\n  uint64_t dr = 0xFFFF & (dst_premul >> 32);\n  uint64_t dg = 0xFFFF & (dst_premul >> 16);\n  uint64_t db = 0xFFFF & (dst_premul >> 0);\n\n  // Calculate the inverse of the src-alpha: how much of the dst to keep.\n  uint64_t ia = 0xFFFF - sa;\n\n  // Composite src (premul) over dst (premul). Unlike the u32_axxx functions,\n  // there's no conversion back to 8-bit color, so no rounding loss there.\n  da = sa + ((da * ia) / 0xFFFF);\n  dr = sr + ((dr * ia) / 0xFFFF);\n  dg = sg + ((dg * ia) / 0xFFFF);\n  db = sb + ((db * ia) / 0xFFFF);\n\n  return (db << 0) | (dg << 16) | (dr << 32) | (da << 48);\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n// wuffs_base__x86_sse42__u" +
+	"16x8__mul_0x101_div_0xff returns, for each 16-bit\n// lane m (which must be at most 0xFF * 0xFF), ((m * 0x101) / 0xFF), which\n// equals (m + ((2 * m) / 0xFF)), without overflowing 16 bits.\n//\n// The u32_axxx composite functions expand 8-bit values v to 16-bit values\n// (v * 0x101) and divide by 0xFFFF, which is (0x101 * 0xFF). For 8-bit a and\n// b, ((0x101 * a) * (0x101 * b)) / 0xFFFF therefore equals this function\n// applied to (a * b), so that this reproduces their rounding exactly.\n//\n// As for the bgra_premul__bgra_nonpremul__src__x86_sse42 function below,\n// dividing by 0xFF is done by computing u = (m + 1 + (m >> 8)) >> 8, and then\n// adjusting by the remainder r = (m - (0xFF * u)).\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline __m128i  //\nwuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff(__m128i m) {\n  __m128i u = _mm_srli_epi16(\n      _mm_add_epi16(_mm_add_epi16(m, _mm_set1_epi16(0x0001)),\n                    _mm_srli_epi16(m, 8)),\n      8);\n  __m128i r = _mm_sub_epi16(m, _mm_mullo_epi16(u, _mm_" +
+	"set1_epi16(0x00FF)));\n  return _mm_sub_epi16(_mm_add_epi16(m, _mm_add_epi16(u, u)),\n                       _mm_cmpgt_epi16(r, _mm_set1_epi16(0x007F)));\n}\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\nstatic inline uint64_t  //\nwuffs_base__swap_u64_argb_abgr(uint64_t c) {\n  uint64_t o = c & 0xFFFF0000FFFF0000;\n  uint64_t r = 0xFFFF & (c >> 32);\n  uint64_t b = 0xFFFF & (c >> 0);\n  return o | (r << 0) | (b << 32);\n}\n\n" +
 	"" +
 	"// --------\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__squash_bgr_565_888(wuffs_base__slice_u8 dst,\n                                               wuffs_base__slice_u8 src) {\n  size_t len4 = (dst.len < src.len ? dst.len : src.len) / 4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n\n  size_t n = len4;\n  while (n--) {\n    uint32_t argb = wuffs_base__load_u32le__no_bounds_check(s);\n    uint32_t b5 = 0x1F & (argb >> (8 - 5));\n    uint32_t g6 = 0x3F & (argb >> (16 - 6));\n    uint32_t r5 = 0x1F & (argb >> (24 - 5));\n    uint32_t alpha = argb & 0xFF000000;\n    wuffs_base__store_u32le__no_bounds_check(\n        d, alpha | (r5 << 11) | (g6 << 5) | (b5 << 0));\n    s += 4;\n    d += 4;\n  }\n  return len4 * 4;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__swap_rgbx_bgrx(wuffs_base__slice_u8 dst,\n                                           wuffs_base__slice_u8 src) {\n  size_t len4 = (dst.len < src.len ? dst.len : src.len) / 4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n\n  size_t n = len4;\n  while (n--) {\n   " +
-	" uint8_t b0 = s[0];\n    uint8_t b1 = s[1];\n    uint8_t b2 = s[2];\n    uint8_t b3 = s[3];\n    d[0] = b2;\n    d[1] = b1;\n    d[2] = b0;\n    d[3] = b3;\n    s += 4;\n    d += 4;\n  }\n  return len4 * 4;\n}\n\n" +
+	" uint8_t b0 = s[0];\n    uint8_t b1 = s[1];\n    uint8_t b2 = s[2];\n    uint8_t b3 = s[3];\n    d[0] = b2;\n    d[1] = b1;\n    d[2] = b0;\n    d[3] = b3;\n    s += 4;\n    d += 4;\n  }\n  return len4 * 4;\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__swap_rgbx_bgrx__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 src) {\n  size_t len4 = (dst.len < src.len ? dst.len : src.len) / 4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len4;\n\n  __m128i shuffle = _mm_set_epi8(+0x0F, +0x0C, +0x0D, +0x0E,  //\n                                 +0x0B, +0x08, +0x09, +0x0A,  //\n                                 +0x07, +0x04, +0x05, +0x06,  //\n                                 +0x03, +0x00, +0x01, +0x02);\n\n  while (n >= 4) {\n    __m128i x;\n    x = _mm_lddqu_si128((const __m128i*)(const void*)s);\n    x = _mm_shuffle_epi8(x, shuffle);\n    _mm_storeu_si128((__m128i*)(void*)d, x);\n\n    s += 4 * 4;\n    d += 4 * 4;\n    n -= 4;\n" +
+	"  }\n\n  while (n--) {\n    uint8_t b0 = s[0];\n    uint8_t b1 = s[1];\n    uint8_t b2 = s[2];\n    uint8_t b3 = s[3];\n    d[0] = b2;\n    d[1] = b1;\n    d[2] = b0;\n    d[3] = b3;\n    s += 4;\n    d += 4;\n  }\n  return len4 * 4;\n}\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\n" +
 	"" +
 	"// --------\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__copy_1_1(wuffs_base__slice_u8 dst,\n                                     wuffs_base__slice_u8 dst_palette,\n                                     wuffs_base__slice_u8 src) {\n  return wuffs_base__slice_u8__copy_from_slice(dst, src);\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__copy_3_3(wuffs_base__slice_u8 dst,\n                                     wuffs_base__slice_u8 dst_palette,\n                                     wuffs_base__slice_u8 src) {\n  size_t dst_len3 = dst.len / 3;\n  size_t src_len3 = src.len / 3;\n  size_t len = dst_len3 < src_len3 ? dst_len3 : src_len3;\n  if (len > 0) {\n    memmove(dst.ptr, src.ptr, len * 3);\n  }\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__copy_4_4(wuffs_base__slice_u8 dst,\n                                     wuffs_base__slice_u8 dst_palette,\n                                     wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 <" +
 	" src_len4 ? dst_len4 : src_len4;\n  if (len > 0) {\n    memmove(dst.ptr, src.ptr, len * 4);\n  }\n  return len;\n}\n\n" +
@@ -149,10 +252,31 @@ const basePixConvSubmoduleC = "" +
 	"// --------\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgr__bgra_nonpremul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len3 = dst.len / 3;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len3 < src_len4 ? dst_len3 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // TODO: unroll.\n\n  while (n >= 1) {\n    uint32_t s0 =\n        wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(\n            wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));\n    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);\n\n    s += 1 * 4;\n    d += 1 * 3;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgr__bgra_nonpremul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len3 = dst.len / 3;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len3 < src_len4 ? dst_len3 : src_len4;\n  uint8_t* d = d" +
 	"st.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // TODO: unroll.\n\n  while (n >= 1) {\n    // Convert from 8-bit color to 16-bit color.\n    uint32_t sa = 0x101 * ((uint32_t)s[3]);\n    uint32_t sr = 0x101 * ((uint32_t)s[2]);\n    uint32_t sg = 0x101 * ((uint32_t)s[1]);\n    uint32_t sb = 0x101 * ((uint32_t)s[0]);\n    uint32_t dr = 0x101 * ((uint32_t)d[2]);\n    uint32_t dg = 0x101 * ((uint32_t)d[1]);\n    uint32_t db = 0x101 * ((uint32_t)d[0]);\n\n    // Calculate the inverse of the src-alpha: how much of the dst to keep.\n    uint32_t ia = 0xFFFF - sa;\n\n    // Composite src (nonpremul) over dst (premul).\n    dr = ((sr * sa) + (dr * ia)) / 0xFFFF;\n    dg = ((sg * sa) + (dg * ia)) / 0xFFFF;\n    db = ((sb * sa) + (db * ia)) / 0xFFFF;\n\n    // Convert from 16-bit color to 8-bit color.\n    d[0] = (uint8_t)(db >> 8);\n    d[1] = (uint8_t)(dg >> 8);\n    d[2] = (uint8_t)(dr >> 8);\n\n    s += 1 * 4;\n    d += 1 * 3;\n    n -= 1;\n  }\n\n  return len;\n}\n\n" +
 	"" +
-	"// --------\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // TODO: unroll.\n\n  while (n >= 1) {\n    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4),\n        wuffs_base__composite_nonpremul_nonpremul_u32_axxx(d0, s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\n" +
-	"" +
-	"// --------\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // TODO: unroll.\n\n  while (n >= 1) {\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4),\n        wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  ui" +
-	"nt8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // TODO: unroll.\n\n  while (n >= 1) {\n    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4), wuffs_base__composite_premul_nonpremul_u32_axxx(d0, s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\n" +
+	"// --------\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // TODO: unroll.\n\n  while (n >= 1) {\n    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4),\n        wuffs_base__composite_nonpremul_nonpremul_u32_axxx(d0, s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n// The SRC_OVER x86_sse42 functions below work on 4 pixels (16 bytes) at a\n// time. They produce exactly the same output as their scalar counterparts.\n// Runs of fully opaque or fully transparent src pi" +
+	"xels, common for sprites\n// and animation frames, take a fast path: opaque src pixels simply replace\n// the dst and transparent ones leave it alone.\n//\n// For a nonpremul dst, compositing converts the dst to premul and back. That\n// round trip is lossy (it divides by the dst alpha), so a transparent src is\n// only a no-op when the dst is opaque. Mixed groups of 4 pixels fall back to\n// the scalar code.\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);\n\n  while (n >= 4) {\n    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);\n    __m128i sa4 = _mm_and_si128(s4, alpha_mask);" +
+	"\n    if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa4, alpha_mask)) == 0xFFFF) {\n      _mm_storeu_si128((__m128i*)(void*)d, s4);\n    } else {\n      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);\n      __m128i da4 = _mm_and_si128(d4, alpha_mask);\n      if (!_mm_testz_si128(sa4, sa4) ||\n          (_mm_movemask_epi8(_mm_cmpeq_epi32(da4, alpha_mask)) != 0xFFFF)) {\n        int i;\n        for (i = 0; i < 4; i++) {\n          uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (i * 4));\n          uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (i * 4));\n          wuffs_base__store_u32le__no_bounds_check(\n              d + (i * 4),\n              wuffs_base__composite_nonpremul_nonpremul_u32_axxx(d0, s0));\n        }\n      }\n    }\n\n    s += 4 * 4;\n    d += 4 * 4;\n    n -= 4;\n  }\n\n  while (n >= 1) {\n    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d +" +
+	" (0 * 4),\n        wuffs_base__composite_nonpremul_nonpremul_u32_axxx(d0, s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\n" +
+	"" +
+	"// --------\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // TODO: unroll.\n\n  while (n >= 1) {\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4),\n        wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_" +
+	"t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // This computes the same (8-bit color) values as the\n  // wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul function,\n  // 4 pixels (16 bytes) at a time, using 16-bit lanes. For a color value c\n  // and alpha value a, with x = (c * a), that function calculates\n  // ((x * 0x101 * 0x101) / 0xFFFF) >> 8, which simplifies to\n  // (x + ((2 * x) / 0xFF)) >> 8.\n  //\n  // Dividing by 0xFF is done by computing u = (x + 1 + (x >> 8)) >> 8, which\n  // equals (x / 0xFF) for all x <= (0xFF * 0xFF), and then adjusting by the\n  // remainder r = (x - (0xFF * u)). None of the intermediate values overflow\n  // 16 bits.\n\n  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);\n  __m128i lo_alpha_shuffle = _mm_set_epi8(-0x80, +0x07, -0x80, +0x07,  //\n                                          -0x80, +0x07, -0x80, +0x07,  //\n                                          -0x8" +
+	"0, +0x03, -0x80, +0x03,  //\n                                          -0x80, +0x03, -0x80, +0x03);\n  __m128i hi_alpha_shuffle = _mm_set_epi8(-0x80, +0x0F, -0x80, +0x0F,  //\n                                          -0x80, +0x0F, -0x80, +0x0F,  //\n                                          -0x80, +0x0B, -0x80, +0x0B,  //\n                                          -0x80, +0x0B, -0x80, +0x0B);\n  __m128i u16_0x0001 = _mm_set1_epi16(0x0001);\n  __m128i u16_0x007F = _mm_set1_epi16(0x007F);\n  __m128i u16_0x00FF = _mm_set1_epi16(0x00FF);\n\n  while (n >= 4) {\n    __m128i x = _mm_lddqu_si128((const __m128i*)(const void*)s);\n\n    // Fast path: if all 4 pixels are opaque, premultiplication is a no-op.\n    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(x, alpha_mask),\n                                          alpha_mask)) != 0xFFFF) {\n      __m128i lo = _mm_cvtepu8_epi16(x);\n      __m128i hi = _mm_cvtepu8_epi16(_mm_srli_si128(x, 8));\n      __m128i lo_x = _mm_mullo_epi16(lo, _mm_shuffle_epi8(x, lo_alpha_shuffle));\n      _" +
+	"_m128i hi_x = _mm_mullo_epi16(hi, _mm_shuffle_epi8(x, hi_alpha_shuffle));\n\n      __m128i lo_u =\n          _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo_x, u16_0x0001),\n                                       _mm_srli_epi16(lo_x, 8)),\n                         8);\n      __m128i hi_u =\n          _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi_x, u16_0x0001),\n                                       _mm_srli_epi16(hi_x, 8)),\n                         8);\n      __m128i lo_r = _mm_sub_epi16(lo_x, _mm_mullo_epi16(lo_u, u16_0x00FF));\n      __m128i hi_r = _mm_sub_epi16(hi_x, _mm_mullo_epi16(hi_u, u16_0x00FF));\n\n      // Subtracting a ((r > 0x7F) ? -1 : 0) mask adds 1 when the remainder\n      // rounds 2*x/0xFF up past the next integer.\n      __m128i lo_d = _mm_sub_epi16(_mm_add_epi16(lo_u, lo_u),\n                                   _mm_cmpgt_epi16(lo_r, u16_0x007F));\n      __m128i hi_d = _mm_sub_epi16(_mm_add_epi16(hi_u, hi_u),\n                                   _mm_cmpgt_epi16(hi_r, u16_0x007F));\n      lo_x = _mm_srli_epi16" +
+	"(_mm_add_epi16(lo_x, lo_d), 8);\n      hi_x = _mm_srli_epi16(_mm_add_epi16(hi_x, hi_d), 8);\n\n      // Restore the original alpha values (lanes 3 and 7) and narrow back\n      // down to 8 bits per channel.\n      lo_x = _mm_blend_epi16(lo_x, lo, 0x88);\n      hi_x = _mm_blend_epi16(hi_x, hi, 0x88);\n      x = _mm_packus_epi16(lo_x, hi_x);\n    }\n    _mm_storeu_si128((__m128i*)(void*)d, x);\n\n    s += 4 * 4;\n    d += 4 * 4;\n    n -= 4;\n  }\n\n  while (n >= 1) {\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4),\n        wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_le" +
+	"n4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // TODO: unroll.\n\n  while (n >= 1) {\n    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4), wuffs_base__composite_premul_nonpremul_u32_axxx(d0, s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // With 8-bit values s (src), d (" +
+	"dst), sa (src alpha) and ia (0xFF - sa),\n  // and F being wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff, the\n  // wuffs_base__composite_premul_nonpremul_u32_axxx function calculates each\n  // color channel as F((s * sa) + (d * ia)) >> 8 and the alpha channel as\n  // ((0x101 * sa) + F(d * ia)) >> 8. Neither overflows 16 bits.\n\n  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);\n  __m128i lo_alpha_shuffle = _mm_set_epi8(-0x80, +0x07, -0x80, +0x07,  //\n                                          -0x80, +0x07, -0x80, +0x07,  //\n                                          -0x80, +0x03, -0x80, +0x03,  //\n                                          -0x80, +0x03, -0x80, +0x03);\n  __m128i hi_alpha_shuffle = _mm_set_epi8(-0x80, +0x0F, -0x80, +0x0F,  //\n                                          -0x80, +0x0F, -0x80, +0x0F,  //\n                                          -0x80, +0x0B, -0x80, +0x0B,  //\n                                          -0x80, +0x0B, -0x80, +0x0B);\n  __m128i u16_0x00FF = _mm_set1_epi16(0x00FF);\n  __m128" +
+	"i u16_0x0101 = _mm_set1_epi16(0x0101);\n\n  while (n >= 4) {\n    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);\n    __m128i sa4 = _mm_and_si128(s4, alpha_mask);\n    if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa4, alpha_mask)) == 0xFFFF) {\n      _mm_storeu_si128((__m128i*)(void*)d, s4);\n    } else if (!_mm_testz_si128(sa4, sa4)) {\n      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);\n      __m128i halves[2];\n      int h;\n      for (h = 0; h < 2; h++) {\n        __m128i sv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(s4, 8) : s4);\n        __m128i dv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(d4, 8) : d4);\n        __m128i sa =\n            _mm_shuffle_epi8(s4, h ? hi_alpha_shuffle : lo_alpha_shuffle);\n        __m128i dia = _mm_mullo_epi16(dv, _mm_sub_epi16(u16_0x00FF, sa));\n        __m128i c = wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff(\n            _mm_add_epi16(_mm_mullo_epi16(sv, sa), dia));\n        __m128i a = _mm_add_epi16(\n            _mm_mullo_epi16(sa, u16_0x0101),\n            wuffs_base__" +
+	"x86_sse42__u16x8__mul_0x101_div_0xff(dia));\n        halves[h] = _mm_srli_epi16(_mm_blend_epi16(c, a, 0x88), 8);\n      }\n      _mm_storeu_si128((__m128i*)(void*)d,\n                       _mm_packus_epi16(halves[0], halves[1]));\n    }\n\n    s += 4 * 4;\n    d += 4 * 4;\n    n -= 4;\n  }\n\n  while (n >= 1) {\n    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4), wuffs_base__composite_premul_nonpremul_u32_axxx(d0, s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgr_565__bgra_premul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len2 = dst.len / 2;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len2 < src_len4 ? dst_len2 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s =" +
+	" src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    wuffs_base__store_u16le__no_bounds_check(\n        d + (0 * 2), wuffs_base__color_u32_argb_premul__as__color_u16_rgb_565(\n                         wuffs_base__load_u32le__no_bounds_check(s + (0 * 4))));\n\n    s += 1 * 4;\n    d += 1 * 2;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgr_565__bgra_premul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len2 = dst.len / 2;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len2 < src_len4 ? dst_len2 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint32_t d0 = wuffs_base__color_u16_rgb_565__as__color_u32_argb_premul(\n        wuffs_base__load_u16le__no_bounds_check(d + (0 * 2)));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u16le__no_bounds_check(\n        d + (0 * 2), wuffs_base__color_u32_argb_premul__" +
+	"as__color_u16_rgb_565(\n                         wuffs_base__composite_premul_premul_u32_axxx(d0, s0)));\n\n    s += 1 * 4;\n    d += 1 * 2;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgr__bgra_premul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len3 = dst.len / 3;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len3 < src_len4 ? dst_len3 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);\n\n    s += 1 * 4;\n    d += 1 * 3;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgr__bgra_premul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len3 = dst.len / 3;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len3 < sr" +
+	"c_len4 ? dst_len3 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint32_t d0 =\n        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(d + (0 * 3));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u24le__no_bounds_check(\n        d + (0 * 3), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));\n\n    s += 1 * 4;\n    d += 1 * 3;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4),\n        wuffs_base__col" +
+	"or_u32_argb_premul__as__color_u32_argb_nonpremul(s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4), wuffs_base__composite_nonpremul_premul_u32_axxx(d0, s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over__" +
+	"x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);\n\n  while (n >= 4) {\n    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);\n    __m128i sa4 = _mm_and_si128(s4, alpha_mask);\n    if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa4, alpha_mask)) == 0xFFFF) {\n      _mm_storeu_si128((__m128i*)(void*)d, s4);\n    } else {\n      // A premul src pixel is only a no-op if all of its channels are zero.\n      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);\n      __m128i da4 = _mm_and_si128(d4, alpha_mask);\n      if (!_mm_testz_si128(s4, s4) ||\n          (_mm_movemask_epi8(_mm_cmpeq_epi32(da4, alpha_mask)) != 0xFFFF)) {\n        int i;\n        for (i = 0; i < 4; i++) {\n          uint32_t d0 = wuffs_base__load_" +
+	"u32le__no_bounds_check(d + (i * 4));\n          uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (i * 4));\n          wuffs_base__store_u32le__no_bounds_check(\n              d + (i * 4),\n              wuffs_base__composite_nonpremul_premul_u32_axxx(d0, s0));\n        }\n      }\n    }\n\n    s += 4 * 4;\n    d += 4 * 4;\n    n -= 4;\n  }\n\n  while (n >= 1) {\n    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4), wuffs_base__composite_nonpremul_premul_u32_axxx(d0, s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_" +
+	"len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len4 < src_len4 ? dst_len4 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // With the same notation as for the bgra_premul__bgra_nonpremul__src_over\n  // function, wuffs_base__compo" +
+	"site_premul_premul_u32_axxx calculates every\n  // channel (color or alpha) as ((0x101 * s) + F(d * ia)) >> 8. That does not\n  // overflow 16 bits if the src is valid premul (every color channel is at\n  // most the alpha channel). Groups of 4 pixels that aren't valid fall back\n  // to the scalar code, which can overflow (and so produce different bits).\n\n  __m128i alpha_mask = _mm_set1_epi32(-0x01000000);\n  __m128i alpha_bytes_shuffle = _mm_set_epi8(+0x0F, +0x0F, +0x0F, +0x0F,  //\n                                             +0x0B, +0x0B, +0x0B, +0x0B,  //\n                                             +0x07, +0x07, +0x07, +0x07,  //\n                                             +0x03, +0x03, +0x03, +0x03);\n  __m128i lo_alpha_shuffle = _mm_set_epi8(-0x80, +0x07, -0x80, +0x07,  //\n                                          -0x80, +0x07, -0x80, +0x07,  //\n                                          -0x80, +0x03, -0x80, +0x03,  //\n                                          -0x80, +0x03, -0x80, +0x03);\n  __m128i hi_alpha_" +
+	"shuffle = _mm_set_epi8(-0x80, +0x0F, -0x80, +0x0F,  //\n                                          -0x80, +0x0F, -0x80, +0x0F,  //\n                                          -0x80, +0x0B, -0x80, +0x0B,  //\n                                          -0x80, +0x0B, -0x80, +0x0B);\n  __m128i u16_0x00FF = _mm_set1_epi16(0x00FF);\n  __m128i u16_0x0101 = _mm_set1_epi16(0x0101);\n\n  while (n >= 4) {\n    __m128i s4 = _mm_lddqu_si128((const __m128i*)(const void*)s);\n    __m128i sa4 = _mm_shuffle_epi8(s4, alpha_bytes_shuffle);\n    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(s4, alpha_mask),\n                                          alpha_mask)) == 0xFFFF) {\n      _mm_storeu_si128((__m128i*)(void*)d, s4);\n    } else if (_mm_testz_si128(s4, s4)) {\n      // No-op.\n    } else if (_mm_movemask_epi8(\n                   _mm_cmpeq_epi8(_mm_max_epu8(s4, sa4), sa4)) == 0xFFFF) {\n      __m128i d4 = _mm_lddqu_si128((const __m128i*)(const void*)d);\n      __m128i halves[2];\n      int h;\n      for (h = 0; h < 2; h++) {\n        __m128" +
+	"i sv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(s4, 8) : s4);\n        __m128i dv = _mm_cvtepu8_epi16(h ? _mm_srli_si128(d4, 8) : d4);\n        __m128i sa =\n            _mm_shuffle_epi8(s4, h ? hi_alpha_shuffle : lo_alpha_shuffle);\n        __m128i dia = _mm_mullo_epi16(dv, _mm_sub_epi16(u16_0x00FF, sa));\n        __m128i x = _mm_add_epi16(\n            _mm_mullo_epi16(sv, u16_0x0101),\n            wuffs_base__x86_sse42__u16x8__mul_0x101_div_0xff(dia));\n        halves[h] = _mm_srli_epi16(x, 8);\n      }\n      _mm_storeu_si128((__m128i*)(void*)d,\n                       _mm_packus_epi16(halves[0], halves[1]));\n    } else {\n      int i;\n      for (i = 0; i < 4; i++) {\n        uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (i * 4));\n        uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (i * 4));\n        wuffs_base__store_u32le__no_bounds_check(\n            d + (i * 4), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));\n      }\n    }\n\n    s += 4 * 4;\n    d += 4 * 4;\n    n -= 4;\n  }\n\n  while (n >= 1" +
+	") {\n    uint32_t d0 = wuffs_base__load_u32le__no_bounds_check(d + (0 * 4));\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(s + (0 * 4));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4), wuffs_base__composite_premul_premul_u32_axxx(d0, s0));\n\n    s += 1 * 4;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\n" +
 	"" +
 	"// --------\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxx__index__src(wuffs_base__slice_u8 dst,\n                                            wuffs_base__slice_u8 dst_palette,\n                                            wuffs_base__slice_u8 src) {\n  if (dst_palette.len != 1024) {\n    return 0;\n  }\n  size_t dst_len3 = dst.len / 3;\n  size_t len = dst_len3 < src.len ? dst_len3 : src.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  const size_t loop_unroll_count = 4;\n\n  // The comparison in the while condition is \">\", not \">=\", because with\n  // \">=\", the last 4-byte store could write past the end of the dst slice.\n  //\n  // Each 4-byte store writes one too many bytes, but a subsequent store\n  // will overwrite that with the correct byte. There is always another\n  // store, whether a 4-byte store in this loop or a 1-byte store in the\n  // next loop.\n  while (n > loop_unroll_count) {\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 3), wuffs_base__load_u32le__no_bounds_c" +
 	"heck(\n                         dst_palette.ptr + ((size_t)s[0] * 4)));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (1 * 3), wuffs_base__load_u32le__no_bounds_check(\n                         dst_palette.ptr + ((size_t)s[1] * 4)));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (2 * 3), wuffs_base__load_u32le__no_bounds_check(\n                         dst_palette.ptr + ((size_t)s[2] * 4)));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (3 * 3), wuffs_base__load_u32le__no_bounds_check(\n                         dst_palette.ptr + ((size_t)s[3] * 4)));\n\n    s += loop_unroll_count * 1;\n    d += loop_unroll_count * 3;\n    n -= loop_unroll_count;\n  }\n\n  while (n >= 1) {\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +\n                                                          ((size_t)s[0] * 4));\n    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), s0);\n\n    s += 1 * 1;\n    d += 1 * 3;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__" +
@@ -164,25 +288,128 @@ const basePixConvSubmoduleC = "" +
 	"tte.ptr + ((size_t)s[2] * 4)));\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (3 * 4), wuffs_base__load_u32le__no_bounds_check(\n                         dst_palette.ptr + ((size_t)s[3] * 4)));\n\n    s += loop_unroll_count * 1;\n    d += loop_unroll_count * 4;\n    n -= loop_unroll_count;\n  }\n\n  while (n >= 1) {\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4), wuffs_base__load_u32le__no_bounds_check(\n                         dst_palette.ptr + ((size_t)s[0] * 4)));\n\n    s += 1 * 1;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  if (dst_palette.len != 1024) {\n    return 0;\n  }\n  size_t dst_len4 = dst.len / 4;\n  size_t len = dst_len4 < src.len ? dst_len4 : src.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  const size_t loop_unroll_count = 4;\n\n  while (n >= loop_unroll_count)" +
 	" {\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +\n                                                          ((size_t)s[0] * 4));\n    if (s0) {\n      wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), s0);\n    }\n    uint32_t s1 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +\n                                                          ((size_t)s[1] * 4));\n    if (s1) {\n      wuffs_base__store_u32le__no_bounds_check(d + (1 * 4), s1);\n    }\n    uint32_t s2 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +\n                                                          ((size_t)s[2] * 4));\n    if (s2) {\n      wuffs_base__store_u32le__no_bounds_check(d + (2 * 4), s2);\n    }\n    uint32_t s3 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +\n                                                          ((size_t)s[3] * 4));\n    if (s3) {\n      wuffs_base__store_u32le__no_bounds_check(d + (3 * 4), s3);\n    }\n\n    s += loop_unroll_count * 1;\n    d += loop_unroll_count *" +
 	" 4;\n    n -= loop_unroll_count;\n  }\n\n  while (n >= 1) {\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +\n                                                          ((size_t)s[0] * 4));\n    if (s0) {\n      wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), s0);\n    }\n\n    s += 1 * 1;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxx__xxx(wuffs_base__slice_u8 dst,\n                                      wuffs_base__slice_u8 dst_palette,\n                                      wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len3 = src.len / 3;\n  size_t len = dst_len4 < src_len3 ? dst_len4 : src_len3;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // TODO: unroll.\n\n  while (n >= 1) {\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4),\n        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s + (0 * 3)));\n\n    s += 1 * 3;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n" +
-	"\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxx__y(wuffs_base__slice_u8 dst,\n                                    wuffs_base__slice_u8 dst_palette,\n                                    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t len = dst_len4 < src.len ? dst_len4 : src.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // TODO: unroll.\n\n  while (n >= 1) {\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4), 0xFF000000 | (0x010101 * (uint32_t)s[0]));\n\n    s += 1 * 1;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\n" +
+	"\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxx__xxx__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t src_len3 = src.len / 3;\n  size_t len = dst_len4 < src_len3 ? dst_len4 : src_len3;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  __m128i shuffle = _mm_set_epi8(-0x80, +0x0B, +0x0A, +0x09,  //\n                                 -0x80, +0x08, +0x07, +0x06,  //\n                                 -0x80, +0x05, +0x04, +0x03,  //\n                                 -0x80, +0x02, +0x01, +0x00);\n  __m128i opaque = _mm_set1_epi32(-0x01000000);\n\n  // Each iteration reads 16 bytes but only uses (and advances by) 12 of them.\n  // The comparison in the while condition is \">= 6\", not \">= 4\", so that the\n  // 16-byte load does not read past the end of the src slice: 6 pixels is 18\n  // bytes, and 5 pixels (15 bytes) wou" +
+	"ld be too few.\n  while (n >= 6) {\n    __m128i x;\n    x = _mm_lddqu_si128((const __m128i*)(const void*)s);\n    x = _mm_or_si128(_mm_shuffle_epi8(x, shuffle), opaque);\n    _mm_storeu_si128((__m128i*)(void*)d, x);\n\n    s += 4 * 3;\n    d += 4 * 4;\n    n -= 4;\n  }\n\n  while (n >= 1) {\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4),\n        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s + (0 * 3)));\n\n    s += 1 * 3;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__swap_rgbx_bgrx(dst, src) / 4;\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n  " +
+	"  wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__swap_rgbx_bgrx__x86_sse42(dst, src) / 4;\n}\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxx__y(wuffs_base__slice_u8 dst,\n                                    wuffs_base__slice_u8 dst_palette,\n                                    wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t len = dst_len4 < src.len ? dst_len4 : src.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  // TODO: unroll.\n\n  while (n >= 1) {\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4), 0xFF000000 | (0x010101 * (uint32_t)s[0]));\n\n    s += 1 * 1;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxx__y__x86_sse42(wuffs_base__slice_u8 dst,\n                                               wuffs_base__slice_u8 dst_palette,\n                    " +
+	"                           wuffs_base__slice_u8 src) {\n  size_t dst_len4 = dst.len / 4;\n  size_t len = dst_len4 < src.len ? dst_len4 : src.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  __m128i shuffle = _mm_set_epi8(-0x80, +0x03, +0x03, +0x03,  //\n                                 -0x80, +0x02, +0x02, +0x02,  //\n                                 -0x80, +0x01, +0x01, +0x01,  //\n                                 -0x80, +0x00, +0x00, +0x00);\n  __m128i opaque = _mm_set1_epi32(-0x01000000);\n\n  while (n >= 4) {\n    __m128i x;\n    x = _mm_cvtsi32_si128(\n        (int)(wuffs_base__load_u32le__no_bounds_check(s + (0 * 1))));\n    x = _mm_or_si128(_mm_shuffle_epi8(x, shuffle), opaque);\n    _mm_storeu_si128((__m128i*)(void*)d, x);\n\n    s += 4 * 1;\n    d += 4 * 4;\n    n -= 4;\n  }\n\n  while (n >= 1) {\n    wuffs_base__store_u32le__no_bounds_check(\n        d + (0 * 4), 0xFF000000 | (0x010101 * (uint32_t)s[0]));\n\n    s += 1 * 1;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n#endif  // defined(WUFFS_B" +
+	"ASE__CPU_ARCH__X86_64)\n\n" +
+	"" +
+	"// --------\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxxxxxx__y(wuffs_base__slice_u8 dst,\n                                        wuffs_base__slice_u8 dst_palette,\n                                        wuffs_base__slice_u8 src) {\n  size_t dst_len8 = dst.len / 8;\n  size_t len = dst_len8 < src.len ? dst_len8 : src.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    wuffs_base__store_u64le__no_bounds_check(\n        d + (0 * 8),\n        0xFFFF000000000000 | (0x0000000100010001 * (0x101 * (uint64_t)s[0])));\n\n    s += 1 * 1;\n    d += 1 * 8;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxxxxxx__index__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  if (dst_palette.len != 1024) {\n    return 0;\n  }\n  size_t dst_len8 = dst.len / 8;\n  size_t len = dst_len8 < src.len ? dst_len8 : src.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {" +
+	"\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +\n                                                          ((size_t)s[0] * 4));\n    wuffs_base__store_u64le__no_bounds_check(\n        d + (0 * 8), wuffs_base__color_u32__as__color_u64(s0));\n\n    s += 1 * 1;\n    d += 1 * 8;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxxxxxx__index_binary_alpha__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  if (dst_palette.len != 1024) {\n    return 0;\n  }\n  size_t dst_len8 = dst.len / 8;\n  size_t len = dst_len8 < src.len ? dst_len8 : src.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint32_t s0 = wuffs_base__load_u32le__no_bounds_check(dst_palette.ptr +\n                                                          ((size_t)s[0] * 4));\n    if (s0) {\n      wuffs_base__store_u64le__no_bounds_check(\n          d + (0 * 8), wuffs_base__color_u32__as__color_u64(" +
+	"s0));\n    }\n\n    s += 1 * 1;\n    d += 1 * 8;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic inline uint64_t  //\nwuffs_base__pixel_swizzler__xxxxxxxx__bgr(wuffs_base__slice_u8 dst,\n                                          wuffs_base__slice_u8 dst_palette,\n                                          wuffs_base__slice_u8 src,\n                                          bool rgb) {\n  size_t dst_len8 = dst.len / 8;\n  size_t src_len3 = src.len / 3;\n  size_t len = dst_len8 < src_len3 ? dst_len8 : src_len3;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint64_t c = wuffs_base__color_u32__as__color_u64(\n        0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s + (0 * 3)));\n    if (rgb) {\n      c = wuffs_base__swap_u64_argb_abgr(c);\n    }\n    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);\n\n    s += 1 * 3;\n    d += 1 * 8;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul_4x16le__bgr(\n    wuffs_base__slice_u8 dst,\n    wuffs_bas" +
+	"e__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgr(dst, dst_palette, src,\n                                                   false);\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__rgba_premul_4x16le__bgr(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgr(dst, dst_palette, src, true);\n}\n\nstatic inline uint64_t  //\nwuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src,\n    bool rgb) {\n  size_t dst_len8 = dst.len / 8;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint64_t c =\n        wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(\n            wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));\n    if " +
+	"(rgb) {\n      c = wuffs_base__swap_u64_argb_abgr(c);\n    }\n    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);\n\n    s += 1 * 4;\n    d += 1 * 8;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src(\n      dst, dst_palette, src, false);\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src(\n      dst, dst_palette, src, true);\n}\n\nstatic inline uint64_t  //\nwuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src,\n    bool rgb) {\n  size_t dst_len8 = dst.len / 8;\n  siz" +
+	"e_t src_len4 = src.len / 4;\n  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint64_t c =\n        wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(\n            wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));\n    if (rgb) {\n      c = wuffs_base__swap_u64_argb_abgr(c);\n    }\n    uint64_t d0 = wuffs_base__load_u64le__no_bounds_check(d + (0 * 8));\n    wuffs_base__store_u64le__no_bounds_check(\n        d + (0 * 8), wuffs_base__composite_premul_premul_u64_axxx(d0, c));\n\n    s += 1 * 4;\n    d += 1 * 8;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src_over(\n      dst, dst_palette, src, false);\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__rgba_premul_4x" +
+	"16le__bgra_nonpremul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src_over(\n      dst, dst_palette, src, true);\n}\n\nstatic inline uint64_t  //\nwuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src,\n    bool rgb) {\n  size_t dst_len8 = dst.len / 8;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint64_t c = wuffs_base__color_u32__as__color_u64(\n        wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));\n    if (rgb) {\n      c = wuffs_base__swap_u64_argb_abgr(c);\n    }\n    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);\n\n    s += 1 * 4;\n    d += 1 * 8;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul_" +
+	"4x16le__bgra_premul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src(\n      dst, dst_palette, src, false);\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src(\n      dst, dst_palette, src, true);\n}\n\nstatic inline uint64_t  //\nwuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src,\n    bool rgb) {\n  size_t dst_len8 = dst.len / 8;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint64_t c = wuffs_base__color_u32__as__color_u64(\n        wuffs_base__load_u32le__no_b" +
+	"ounds_check(s + (0 * 4)));\n    if (rgb) {\n      c = wuffs_base__swap_u64_argb_abgr(c);\n    }\n    uint64_t d0 = wuffs_base__load_u64le__no_bounds_check(d + (0 * 8));\n    wuffs_base__store_u64le__no_bounds_check(\n        d + (0 * 8), wuffs_base__composite_premul_premul_u64_axxx(d0, c));\n\n    s += 1 * 4;\n    d += 1 * 8;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src_over(\n      dst, dst_palette, src, false);\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src_over(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src_over(\n      dst, dst_palette, src, true);\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n// The SSE4.2 functions belo" +
+	"w convert four 8-bit BGRA pixels (16 bytes) to four\n// 16-bit pixels (32 bytes) per loop iteration.\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline uint64_t  //\nwuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src,\n    bool rgb) {\n  size_t dst_len8 = dst.len / 8;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  __m128i shuffle = rgb ? _mm_set_epi8(+0x0F, +0x0C, +0x0D, +0x0E,  //\n                                       +0x0B, +0x08, +0x09, +0x0A,  //\n                                       +0x07, +0x04, +0x05, +0x06,  //\n                                       +0x03, +0x00, +0x01, +0x02)\n                        : _mm_set_epi8(+0x0F, +0x0E, +0x0D, +0x0C,  //\n                                       +0x0B, +0x0A, +0x09, +0x08,  //\n                                       +0x07, +0x06, +0x05," +
+	" +0x04,  //\n                                       +0x03, +0x02, +0x01, +0x00);\n  __m128i k_8081 = _mm_set1_epi16((int16_t)0x8081);\n  __m128i k_00FF = _mm_set1_epi16(0x00FF);\n  __m128i k_0101 = _mm_set1_epi16(0x0101);\n\n  while (n >= 4) {\n    __m128i x = _mm_shuffle_epi8(\n        _mm_lddqu_si128((const __m128i*)(const void*)s), shuffle);\n\n    // Each 128-bit half holds two pixels' worth of 16-bit lanes.\n    __m128i halves[2];\n    halves[0] = _mm_cvtepu8_epi16(x);\n    halves[1] = _mm_cvtepu8_epi16(_mm_srli_si128(x, 8));\n    int h;\n    for (h = 0; h < 2; h++) {\n      __m128i c = halves[h];\n      __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(c, 0xFF), 0xFF);\n\n      // With p = (c * a), which fits in 16 bits, the scalar code's\n      // ((0x101 * c) * (0x101 * a)) / 0xFFFF equals (p + (p / 127.5)),\n      // rounded down, which is (p + 2*q + (r >> 7)) where q and r are the\n      // quotient and remainder of dividing p by 255. Also, (p / 255) equals\n      // ((p * 0x8081) >> 23) for all 16-bit p.\n      __m128i " +
+	"p = _mm_mullo_epi16(c, a);\n      __m128i q = _mm_srli_epi16(_mm_mulhi_epu16(p, k_8081), 7);\n      __m128i r = _mm_sub_epi16(p, _mm_mullo_epi16(q, k_00FF));\n      __m128i v = _mm_add_epi16(\n          p, _mm_add_epi16(_mm_slli_epi16(q, 1), _mm_srli_epi16(r, 7)));\n\n      // The alpha lanes are simply widened from 8 to 16 bits.\n      halves[h] = _mm_blend_epi16(v, _mm_mullo_epi16(a, k_0101), 0x88);\n    }\n    _mm_storeu_si128((__m128i*)(void*)(d + 0x00), halves[0]);\n    _mm_storeu_si128((__m128i*)(void*)(d + 0x10), halves[1]);\n\n    s += 4 * 4;\n    d += 4 * 8;\n    n -= 4;\n  }\n\n  while (n >= 1) {\n    uint64_t c =\n        wuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(\n            wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));\n    if (rgb) {\n      c = wuffs_base__swap_u64_argb_abgr(c);\n    }\n    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);\n\n    s += 1 * 4;\n    d += 1 * 8;\n    n -= 1;\n  }\n\n  return len;\n}\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline uint64_t  //\nwuffs_ba" +
+	"se__pixel_swizzler__xxxxxxxx__bgra_premul__src__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src,\n    bool rgb) {\n  size_t dst_len8 = dst.len / 8;\n  size_t src_len4 = src.len / 4;\n  size_t len = dst_len8 < src_len4 ? dst_len8 : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  __m128i shuffle = rgb ? _mm_set_epi8(+0x0F, +0x0C, +0x0D, +0x0E,  //\n                                       +0x0B, +0x08, +0x09, +0x0A,  //\n                                       +0x07, +0x04, +0x05, +0x06,  //\n                                       +0x03, +0x00, +0x01, +0x02)\n                        : _mm_set_epi8(+0x0F, +0x0E, +0x0D, +0x0C,  //\n                                       +0x0B, +0x0A, +0x09, +0x08,  //\n                                       +0x07, +0x06, +0x05, +0x04,  //\n                                       +0x03, +0x02, +0x01, +0x00);\n\n  while (n >= 4) {\n    __m128i x = _mm_shuffle_epi8(\n        _mm_lddqu_si128((const __m128i*)(cons" +
+	"t void*)s), shuffle);\n\n    // Interleaving a byte with itself multiplies it by 0x101.\n    _mm_storeu_si128((__m128i*)(void*)(d + 0x00), _mm_unpacklo_epi8(x, x));\n    _mm_storeu_si128((__m128i*)(void*)(d + 0x10), _mm_unpackhi_epi8(x, x));\n\n    s += 4 * 4;\n    d += 4 * 8;\n    n -= 4;\n  }\n\n  while (n >= 1) {\n    uint64_t c = wuffs_base__color_u32__as__color_u64(\n        wuffs_base__load_u32le__no_bounds_check(s + (0 * 4)));\n    if (rgb) {\n      c = wuffs_base__swap_u64_argb_abgr(c);\n    }\n    wuffs_base__store_u64le__no_bounds_check(d + (0 * 8), c);\n\n    s += 1 * 4;\n    d += 1 * 8;\n    n -= 1;\n  }\n\n  return len;\n}\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src__x86_sse42(\n      dst, dst_palette, src, false);\n}\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstati" +
+	"c uint64_t  //\nwuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_nonpremul__src__x86_sse42(\n      dst, dst_palette, src, true);\n}\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src__x86_sse42(\n      dst, dst_palette, src, false);\n}\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src__x86_sse42(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  return wuffs_base__pixel_swizzler__xxxxxxxx__bgra_premul__src__x86_sse42(\n      dst, dst_palette, src, true);\n}\n#endif " +
+	" // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\n" +
+	"" +
+	"// --------\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxx__ycc(wuffs_base__slice_u8 dst,\n                                     wuffs_base__slice_u8 src0,\n                                     wuffs_base__slice_u8 src1,\n                                     wuffs_base__slice_u8 src2,\n                                     bool rgb) {\n  size_t len = dst.len / 3;\n  len = (len < src0.len) ? len : src0.len;\n  len = (len < src1.len) ? len : src1.len;\n  len = (len < src2.len) ? len : src2.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s0 = src0.ptr;\n  uint8_t* s1 = src1.ptr;\n  uint8_t* s2 = src2.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint32_t c =\n        wuffs_base__color_ycc__as__color_u32_argb_premul(s0[0], s1[0], s2[0]);\n    if (rgb) {\n      c = wuffs_base__swap_u32_argb_abgr(c);\n    }\n    wuffs_base__store_u24le__no_bounds_check(d + (0 * 3), c);\n\n    s0 += 1;\n    s1 += 1;\n    s2 += 1;\n    d += 1 * 3;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgr__ycc(wuffs_base__slice_u" +
+	"8 dst,\n                                     wuffs_base__slice_u8 src0,\n                                     wuffs_base__slice_u8 src1,\n                                     wuffs_base__slice_u8 src2) {\n  return wuffs_base__pixel_swizzler__xxx__ycc(dst, src0, src1, src2, false);\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__rgb__ycc(wuffs_base__slice_u8 dst,\n                                     wuffs_base__slice_u8 src0,\n                                     wuffs_base__slice_u8 src1,\n                                     wuffs_base__slice_u8 src2) {\n  return wuffs_base__pixel_swizzler__xxx__ycc(dst, src0, src1, src2, true);\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__xxxx__ycc(wuffs_base__slice_u8 dst,\n                                      wuffs_base__slice_u8 src0,\n                                      wuffs_base__slice_u8 src1,\n                                      wuffs_base__slice_u8 src2,\n                                      bool rgb) {\n  size_t len = dst.len / 4;\n  len = (len < src0.len) ? len" +
+	" : src0.len;\n  len = (len < src1.len) ? len : src1.len;\n  len = (len < src2.len) ? len : src2.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s0 = src0.ptr;\n  uint8_t* s1 = src1.ptr;\n  uint8_t* s2 = src2.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    uint32_t c =\n        wuffs_base__color_ycc__as__color_u32_argb_premul(s0[0], s1[0], s2[0]);\n    if (rgb) {\n      c = wuffs_base__swap_u32_argb_abgr(c);\n    }\n    wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), c);\n\n    s0 += 1;\n    s1 += 1;\n    s2 += 1;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgrx__ycc(wuffs_base__slice_u8 dst,\n                                      wuffs_base__slice_u8 src0,\n                                      wuffs_base__slice_u8 src1,\n                                      wuffs_base__slice_u8 src2) {\n  return wuffs_base__pixel_swizzler__xxxx__ycc(dst, src0, src1, src2, false);\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__rgbx__ycc(wuffs_base__slice_u8 dst,\n                         " +
+	"             wuffs_base__slice_u8 src0,\n                                      wuffs_base__slice_u8 src1,\n                                      wuffs_base__slice_u8 src2) {\n  return wuffs_base__pixel_swizzler__xxxx__ycc(dst, src0, src1, src2, true);\n}\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline uint64_t  //\nwuffs_base__pixel_swizzler__xxxx__ycc__x86_sse42(wuffs_base__slice_u8 dst,\n                                                 wuffs_base__slice_u8 src0,\n                                                 wuffs_base__slice_u8 src1,\n                                                 wuffs_base__slice_u8 src2,\n                                                 bool rgb) {\n  size_t len = dst.len / 4;\n  len = (len < src0.len) ? len : src0.len;\n  len = (len < src1.len) ? len : src1.len;\n  len = (len < src2.len) ? len : src2.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s0 = src0.ptr;\n  uint8_t* s1 = src1.ptr;\n  uint8_t* s2 = src2.ptr;\n  size_t n = len;\n\n  // The constants ar" +
+	"e the same as those in\n  // wuffs_base__color_ycc__as__color_u32_argb_premul, which also explains\n  // the _mm_mulhrs_epi16 rounding.\n  __m128i bias = _mm_set1_epi16(128);\n  __m128i k_r_cr = _mm_set1_epi16(+13173);\n  __m128i k_g_cb = _mm_set1_epi16(-11277);\n  __m128i k_g_cr = _mm_set1_epi16(-23401);\n  __m128i k_b_cb = _mm_set1_epi16(+25297);\n  __m128i opaque = _mm_set1_epi8(-1);\n\n  // Each iteration converts 16 pixels, in two halves of 8 16-bit lanes.\n  while (n >= 16) {\n    __m128i yy = _mm_lddqu_si128((const __m128i*)(const void*)s0);\n    __m128i cb = _mm_lddqu_si128((const __m128i*)(const void*)s1);\n    __m128i cr = _mm_lddqu_si128((const __m128i*)(const void*)s2);\n\n    __m128i y_lo = _mm_cvtepu8_epi16(yy);\n    __m128i y_hi = _mm_cvtepu8_epi16(_mm_srli_si128(yy, 8));\n    __m128i cb_lo = _mm_sub_epi16(_mm_cvtepu8_epi16(cb), bias);\n    __m128i cb_hi =\n        _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(cb, 8)), bias);\n    __m128i cr_lo = _mm_sub_epi16(_mm_cvtepu8_epi16(cr), bias);\n    __m128i cr_hi =\n    " +
+	"    _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(cr, 8)), bias);\n\n    __m128i r_lo = _mm_add_epi16(_mm_add_epi16(y_lo, cr_lo),\n                                 _mm_mulhrs_epi16(cr_lo, k_r_cr));\n    __m128i r_hi = _mm_add_epi16(_mm_add_epi16(y_hi, cr_hi),\n                                 _mm_mulhrs_epi16(cr_hi, k_r_cr));\n    __m128i g_lo =\n        _mm_add_epi16(_mm_add_epi16(y_lo, _mm_mulhrs_epi16(cb_lo, k_g_cb)),\n                      _mm_mulhrs_epi16(cr_lo, k_g_cr));\n    __m128i g_hi =\n        _mm_add_epi16(_mm_add_epi16(y_hi, _mm_mulhrs_epi16(cb_hi, k_g_cb)),\n                      _mm_mulhrs_epi16(cr_hi, k_g_cr));\n    __m128i b_lo = _mm_add_epi16(_mm_add_epi16(y_lo, cb_lo),\n                                 _mm_mulhrs_epi16(cb_lo, k_b_cb));\n    __m128i b_hi = _mm_add_epi16(_mm_add_epi16(y_hi, cb_hi),\n                                 _mm_mulhrs_epi16(cb_hi, k_b_cb));\n\n    // Saturate to 8 bits and interleave, in memory order, as B, G, R, A (or\n    // as R, G, B, A).\n    __m128i r = _mm_packus_epi16(r_lo, r_" +
+	"hi);\n    __m128i g = _mm_packus_epi16(g_lo, g_hi);\n    __m128i b = _mm_packus_epi16(b_lo, b_hi);\n    if (rgb) {\n      __m128i t = r;\n      r = b;\n      b = t;\n    }\n    __m128i bg_lo = _mm_unpacklo_epi8(b, g);\n    __m128i bg_hi = _mm_unpackhi_epi8(b, g);\n    __m128i ra_lo = _mm_unpacklo_epi8(r, opaque);\n    __m128i ra_hi = _mm_unpackhi_epi8(r, opaque);\n    _mm_storeu_si128((__m128i*)(void*)(d + 0x00),\n                     _mm_unpacklo_epi16(bg_lo, ra_lo));\n    _mm_storeu_si128((__m128i*)(void*)(d + 0x10),\n                     _mm_unpackhi_epi16(bg_lo, ra_lo));\n    _mm_storeu_si128((__m128i*)(void*)(d + 0x20),\n                     _mm_unpacklo_epi16(bg_hi, ra_hi));\n    _mm_storeu_si128((__m128i*)(void*)(d + 0x30),\n                     _mm_unpackhi_epi16(bg_hi, ra_hi));\n\n    s0 += 16;\n    s1 += 16;\n    s2 += 16;\n    d += 16 * 4;\n    n -= 16;\n  }\n\n  while (n >= 1) {\n    uint32_t c =\n        wuffs_base__color_ycc__as__color_u32_argb_premul(s0[0], s1[0], s2[0]);\n    if (rgb) {\n      c = wuffs_base__swap_u32_argb_a" +
+	"bgr(c);\n    }\n    wuffs_base__store_u32le__no_bounds_check(d + (0 * 4), c);\n\n    s0 += 1;\n    s1 += 1;\n    s2 += 1;\n    d += 1 * 4;\n    n -= 1;\n  }\n\n  return len;\n}\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__bgrx__ycc__x86_sse42(wuffs_base__slice_u8 dst,\n                                                 wuffs_base__slice_u8 src0,\n                                                 wuffs_base__slice_u8 src1,\n                                                 wuffs_base__slice_u8 src2) {\n  return wuffs_base__pixel_swizzler__xxxx__ycc__x86_sse42(dst, src0, src1, src2,\n                                                          false);\n}\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__rgbx__ycc__x86_sse42(wuffs_base__slice_u8 dst,\n                                                 wuffs_base__slice_u8 src0,\n                                                 wuffs_base__slice_u8 src1,\n                                                 wuffs_b" +
+	"ase__slice_u8 src2) {\n  return wuffs_base__pixel_swizzler__xxxx__ycc__x86_sse42(dst, src0, src1, src2,\n                                                          true);\n}\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\n" +
+	"" +
+	"// --------\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__index__y(wuffs_base__slice_u8 dst,\n                                     wuffs_base__pixel_palette_lookup* lookup,\n                                     wuffs_base__slice_u8 src) {\n  size_t len = (dst.len < src.len) ? dst.len : src.len;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    d[0] = wuffs_base__pixel_palette_lookup__closest_element(\n        lookup, 0xFF000000 | (0x00010101 * ((uint32_t)(s[0]))));\n\n    s += 1 * 1;\n    d += 1;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__index__bgr(wuffs_base__slice_u8 dst,\n                                       wuffs_base__pixel_palette_lookup* lookup,\n                                       wuffs_base__slice_u8 src) {\n  size_t src_len3 = src.len / 3;\n  size_t len = (dst.len < src_len3) ? dst.len : src_len3;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    d[0] = wuffs_base__pixel_palette_looku" +
+	"p__closest_element(\n        lookup, 0xFF000000 | wuffs_base__load_u24le__no_bounds_check(s));\n\n    s += 1 * 3;\n    d += 1;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__index__bgra_nonpremul(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__pixel_palette_lookup* lookup,\n    wuffs_base__slice_u8 src) {\n  size_t src_len4 = src.len / 4;\n  size_t len = (dst.len < src_len4) ? dst.len : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    d[0] = wuffs_base__pixel_palette_lookup__closest_element(\n        lookup, wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(\n                    wuffs_base__load_u32le__no_bounds_check(s)));\n\n    s += 1 * 4;\n    d += 1;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__index__bgra_premul(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__pixel_palette_lookup* lookup,\n    wuffs_base__slice_u8 src) {\n  size_t src_len4 = src.len / 4;\n  size_t len = (dst.len < src_" +
+	"len4) ? dst.len : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    d[0] = wuffs_base__pixel_palette_lookup__closest_element(\n        lookup, wuffs_base__load_u32le__no_bounds_check(s));\n\n    s += 1 * 4;\n    d += 1;\n    n -= 1;\n  }\n\n  return len;\n}\n\nstatic uint64_t  //\nwuffs_base__pixel_swizzler__index__bgrx(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__pixel_palette_lookup* lookup,\n    wuffs_base__slice_u8 src) {\n  size_t src_len4 = src.len / 4;\n  size_t len = (dst.len < src_len4) ? dst.len : src_len4;\n  uint8_t* d = dst.ptr;\n  uint8_t* s = src.ptr;\n  size_t n = len;\n\n  while (n >= 1) {\n    d[0] = wuffs_base__pixel_palette_lookup__closest_element(\n        lookup, 0xFF000000 | wuffs_base__load_u32le__no_bounds_check(s));\n\n    s += 1 * 4;\n    d += 1;\n    n -= 1;\n  }\n\n  return len;\n}\n\n" +
 	"" +
 	"// --------\n\nstatic wuffs_base__pixel_swizzler__func  //\nwuffs_base__pixel_swizzler__prepare__y(wuffs_base__pixel_swizzler* p,\n                                       wuffs_base__pixel_format dst_format,\n                                       wuffs_base__slice_u8 dst_palette,\n                                       wuffs_base__slice_u8 src_palette,\n                                       wuffs_base__pixel_blend blend) {\n  switch (dst_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      return wuffs_base__pixel_swizzler__bgr_565__y;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n      return wuffs_base__pixel_swizzler__xxx__y;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:\n    case WU" +
-	"FFS_BASE__PIXEL_FORMAT__RGBX:\n      return wuffs_base__pixel_swizzler__xxxx__y;\n  }\n  return NULL;\n}\n\nstatic wuffs_base__pixel_swizzler__func  //\nwuffs_base__pixel_swizzler__prepare__indexed__bgra_binary(\n    wuffs_base__pixel_swizzler* p,\n    wuffs_base__pixel_format dst_format,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src_palette,\n    wuffs_base__pixel_blend blend) {\n  switch (dst_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:\n      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_palette) !=\n          1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__copy_1_1;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      if (wuffs_base__pixel_swizzler__squash_bgr_565_888(dst_palette,\n                                        " +
-	"                 src_palette) != 1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__bgr_565__index__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgr_565__index_binary_alpha__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_palette) !=\n          1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__xxx__index__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__xxx__index_binary_alpha__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_pa" +
-	"lette) !=\n          1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__xxxx__index__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n      if (wuffs_base__pixel_swizzler__swap_rgbx_bgrx(dst_palette,\n                                                     src_palette) != 1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__xxx__index__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__xxx__index_binary_alpha__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:\n      if (wuffs_base__pixel_swizzler__" +
-	"swap_rgbx_bgrx(dst_palette,\n                                                     src_palette) != 1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__xxxx__index__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over;\n      }\n      return NULL;\n  }\n  return NULL;\n}\n\nstatic wuffs_base__pixel_swizzler__func  //\nwuffs_base__pixel_swizzler__prepare__bgr(wuffs_base__pixel_swizzler* p,\n                                         wuffs_base__pixel_format dst_format,\n                                         wuffs_base__slice_u8 dst_palette,\n                                         wuffs_base__slice_u8 src_palette,\n                                         wuffs_base__pixel_blend blend) {\n  switch (dst_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      return wuffs_base__pixel_swizzler__bgr_565__bgr;\n\n    case WUFFS_BASE__PIXEL_FORMAT__B" +
-	"GR:\n      return wuffs_base__pixel_swizzler__copy_3_3;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n      return wuffs_base__pixel_swizzler__xxxx__xxx;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBX:\n      // TODO.\n      break;\n  }\n  return NULL;\n}\n\nstatic wuffs_base__pixel_swizzler__func  //\nwuffs_base__pixel_swizzler__prepare__bgra_nonpremul(\n    wuffs_base__pixel_swizzler* p,\n    wuffs_base__pixel_format dst_format,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src_palette,\n    wuffs_base__pixel_blend blend) {\n  switch (dst_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_b" +
-	"ase__pixel_swizzler__bgr_565__bgra_nonpremul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgr_565__bgra_nonpremul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__bgr__bgra_nonpremul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgr__bgra_nonpremul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__copy_4_4;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swiz" +
-	"zler__bgra_premul__bgra_nonpremul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n      // TODO.\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBX:\n      // TODO.\n      break;\n  }\n  return NULL;\n}\n\n" +
-	"" +
-	"// --------\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_swizzler__prepare(wuffs_base__pixel_swizzler* p,\n                                    wuffs_base__pixel_format dst_format,\n                                    wuffs_base__slice_u8 dst_palette,\n                                    wuffs_base__pixel_format src_format,\n                                    wuffs_base__slice_u8 src_palette,\n                                    wuffs_base__pixel_blend blend) {\n  if (!p) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  }\n\n  // TODO: support many more formats.\n\n  wuffs_base__pixel_swizzler__func func = NULL;\n\n  switch (src_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__Y:\n      func = wuffs_base__pixel_swizzler__prepare__y(p, dst_format, dst_palette,\n                                                    src_palette, blend);\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:\n      func = wuffs_base__pixel_swizzler__prepare__indexed__bgra_binary(\n    " +
-	"      p, dst_format, dst_palette, src_palette, blend);\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      func = wuffs_base__pixel_swizzler__prepare__bgr(\n          p, dst_format, dst_palette, src_palette, blend);\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n      func = wuffs_base__pixel_swizzler__prepare__bgra_nonpremul(\n          p, dst_format, dst_palette, src_palette, blend);\n      break;\n  }\n\n  p->private_impl.func = func;\n  return wuffs_base__make_status(\n      func ? NULL : wuffs_base__error__unsupported_pixel_swizzler_option);\n}\n\nWUFFS_BASE__MAYBE_STATIC uint64_t  //\nwuffs_base__pixel_swizzler__swizzle_interleaved(\n    const wuffs_base__pixel_swizzler* p,\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  if (p && p->private_impl.func) {\n    return (*p->private_impl.func)(dst, dst_palette, src);\n  }\n  return 0;\n}\n" +
+	"FFS_BASE__PIXEL_FORMAT__RGBX:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n      if (wuffs_base__cpu_arch__have_x86_sse42()) {\n        return wuffs_base__pixel_swizzler__xxxx__y__x86_sse42;\n      }\n#endif\n      return wuffs_base__pixel_swizzler__xxxx__y;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:\n      return wuffs_base__pixel_swizzler__xxxxxxxx__y;\n  }\n  return NULL;\n}\n\nstatic wuffs_base__pixel_swizzler__func  //\nwuffs_base__pixel_swizzler__prepare__indexed__bgra_binary(\n    wuffs_base__pixel_swizzler* p,\n    wuffs_base__pixel_format dst_format,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src_palette,\n    wuffs_base__pixel_blend blend) {\n  switch (dst_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:\n      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_palette) !=\n          102" +
+	"4) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__copy_1_1;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      if (wuffs_base__pixel_swizzler__squash_bgr_565_888(dst_palette,\n                                                         src_palette) != 1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__bgr_565__index__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgr_565__index_binary_alpha__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_palette) !=\n          1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__xxx__index__src;\n        case WUFFS_BASE__PIXEL_BL" +
+	"END__SRC_OVER:\n          return wuffs_base__pixel_swizzler__xxx__index_binary_alpha__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_palette) !=\n          1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__xxxx__index__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n      if (wuffs_base__pixel_swizzler__swap_rgbx_bgrx(dst_palette,\n                                                     src_palette) != 1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__xxx__index__src;\n    " +
+	"    case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__xxx__index_binary_alpha__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:\n      if (wuffs_base__pixel_swizzler__swap_rgbx_bgrx(dst_palette,\n                                                     src_palette) != 1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__xxxx__index__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__xxxx__index_binary_alpha__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:\n      if (wuffs_base__slice_u8__copy_from_slice(dst_palette, src_palette) !=\n          1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs" +
+	"_base__pixel_swizzler__xxxxxxxx__index__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__xxxxxxxx__index_binary_alpha__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:\n      if (wuffs_base__pixel_swizzler__swap_rgbx_bgrx(dst_palette,\n                                                     src_palette) != 1024) {\n        return NULL;\n      }\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__xxxxxxxx__index__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__xxxxxxxx__index_binary_alpha__src_over;\n      }\n      return NULL;\n  }\n  return NULL;\n}\n\nstatic wuffs_base__pixel_swizzler__func  //\nwuffs_base__pixel_swizzler__prepare__bgr(wuffs_base__pixel_swizzler* p,\n                                         wuffs_base__pixel_format dst_format,\n                                         wuffs_base__slice_u8 dst_palette,\n       " +
+	"                                  wuffs_base__slice_u8 src_palette,\n                                         wuffs_base__pixel_blend blend) {\n  switch (dst_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      return wuffs_base__pixel_swizzler__bgr_565__bgr;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      return wuffs_base__pixel_swizzler__copy_3_3;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n      if (wuffs_base__cpu_arch__have_x86_sse42()) {\n        return wuffs_base__pixel_swizzler__xxxx__xxx__x86_sse42;\n      }\n#endif\n      return wuffs_base__pixel_swizzler__xxxx__xxx;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBX:\n      // TODO.\n   " +
+	"   break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:\n      return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgr;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:\n      return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgr;\n  }\n  return NULL;\n}\n\nstatic wuffs_base__pixel_swizzler__func  //\nwuffs_base__pixel_swizzler__prepare__bgra_nonpremul(\n    wuffs_base__pixel_swizzler* p,\n    wuffs_base__pixel_format dst_format,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src_palette,\n    wuffs_base__pixel_blend blend) {\n  switch (dst_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__bgr_565__bgra_nonpremul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgr_565__bgra_nonpremul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      switch (blend) {\n        case WUFFS_BASE__PIXE" +
+	"L_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__bgr__bgra_nonpremul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgr__bgra_nonpremul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__copy_4_4;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n          if (wuffs_base__cpu_arch__have_x86_sse42()) {\n            return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over__x86_sse42;\n          }\n#endif\n          return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n          if (wuffs_base__cpu_arch__have_x86_sse42()) {\n            return wuff" +
+	"s_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src__x86_sse42;\n          }\n#endif\n          return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n          if (wuffs_base__cpu_arch__have_x86_sse42()) {\n            return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over__x86_sse42;\n          }\n#endif\n          return wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n      // TODO.\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n          if (wuffs_base__cpu_arch__have_x86_sse42()) {\n            return wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx__x86_sse42;\n          }\n#endif\n          return wuffs_base__pixel_swizzler__" +
+	"xxxx__xxxx__swap_rgbx_bgrx;\n      }\n      // TODO: SRC_OVER.\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBX:\n      // TODO.\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n          if (wuffs_base__cpu_arch__have_x86_sse42()) {\n            return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src__x86_sse42;\n          }\n#endif\n          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n#if defined(WUFFS_BASE__CP" +
+	"U_ARCH__X86_64)\n          if (wuffs_base__cpu_arch__have_x86_sse42()) {\n            return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src__x86_sse42;\n          }\n#endif\n          return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src_over;\n      }\n      return NULL;\n  }\n  return NULL;\n}\n\nstatic wuffs_base__pixel_swizzler__func  //\nwuffs_base__pixel_swizzler__prepare__bgra_premul(\n    wuffs_base__pixel_swizzler* p,\n    wuffs_base__pixel_format dst_format,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src_palette,\n    wuffs_base__pixel_blend blend) {\n  // Unlike a BGRA_NONPREMUL source, premultiplied destinations composite a\n  // BGRA_PREMUL source directly, without a round trip through non-premul.\n  switch (dst_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL" +
+	"_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__bgr_565__bgra_premul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgr_565__bgra_premul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__bgr__bgra_premul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgr__bgra_premul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n          if (wuffs_base__cpu_arch__have_x86_sse42()) {\n            return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over__x86_sse42;\n          }\n#endif\n     " +
+	"     return wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n          return wuffs_base__pixel_swizzler__copy_4_4;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n          if (wuffs_base__cpu_arch__have_x86_sse42()) {\n            return wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over__x86_sse42;\n          }\n#endif\n          return wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n          if (wuffs_base__cpu_arch__have_x86_sse42()) {\n            return wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx__x86_sse42;\n          }\n#endif\n          return wuffs_base__pixel_swizzler__xxxx__xxxx__swap_r" +
+	"gbx_bgrx;\n      }\n      // TODO: SRC_OVER.\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n          if (wuffs_base__cpu_arch__have_x86_sse42()) {\n            return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src__x86_sse42;\n          }\n#endif\n          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src_over;\n      }\n      return NULL;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:\n      switch (blend) {\n        case WUFFS_BASE__PIXEL_BLEND__SRC:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n          if (wuffs_base__cpu_arch__have_x86_sse42()) {\n            return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src__x86_sse42;\n          }\n#endif\n          return wuffs_base__pixel_swizzler__r" +
+	"gba_premul_4x16le__bgra_premul__src;\n        case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:\n          return wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src_over;\n      }\n      return NULL;\n  }\n  return NULL;\n}\n\nstatic wuffs_base__pixel_swizzler__planar_func  //\nwuffs_base__pixel_swizzler__prepare__ycc(wuffs_base__pixel_swizzler* p,\n                                         wuffs_base__pixel_format dst_format,\n                                         wuffs_base__slice_u8 dst_palette,\n                                         wuffs_base__slice_u8 src_palette,\n                                         wuffs_base__pixel_blend blend) {\n  // The source is opaque, so that SRC_OVER is equivalent to SRC.\n  switch (dst_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      return wuffs_base__pixel_swizzler__bgr__ycc;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n#i" +
+	"f defined(WUFFS_BASE__CPU_ARCH__X86_64)\n      if (wuffs_base__cpu_arch__have_x86_sse42()) {\n        return wuffs_base__pixel_swizzler__bgrx__ycc__x86_sse42;\n      }\n#endif\n      return wuffs_base__pixel_swizzler__bgrx__ycc;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n      return wuffs_base__pixel_swizzler__rgb__ycc;\n\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:\n    case WUFFS_BASE__PIXEL_FORMAT__RGBX:\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n      if (wuffs_base__cpu_arch__have_x86_sse42()) {\n        return wuffs_base__pixel_swizzler__rgbx__ycc__x86_sse42;\n      }\n#endif\n      return wuffs_base__pixel_swizzler__rgbx__ycc;\n  }\n  return NULL;\n}\n\n" +
+	"" +
+	"// --------\n\n// wuffs_base__pixel_swizzler__dst_pixfmt_is_allowed returns whether dst_pixfmt\n// is allowed by the WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST build\n// configuration. If that macro is defined, only the destination pixel formats\n// whose WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_ETC macro is also defined are\n// allowed. For example, a program that only ever decodes to BGRA_PREMUL can\n// define WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST and\n// WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_PREMUL, and the compiler can then\n// discard the swizzlers for every other destination.\nstatic inline bool  //\nwuffs_base__pixel_swizzler__dst_pixfmt_is_allowed(\n    wuffs_base__pixel_format dst_pixfmt) {\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST)\n  switch (dst_pixfmt.repr) {\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_INDEXED__BGRA_NONPREMUL)\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_INDEXED__BGRA_PREMUL)\n   " +
+	" case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_INDEXED__BGRA_BINARY)\n    case WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGR_565)\n    case WUFFS_BASE__PIXEL_FORMAT__BGR_565:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGR)\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_NONPREMUL)\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_PREMUL)\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_BINARY)\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRX)\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGB)\n    case WUFFS_BASE__PIXEL_FORMAT__RGB:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW" +
+	"_RGBA_NONPREMUL)\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBA_PREMUL)\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBA_BINARY)\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBX)\n    case WUFFS_BASE__PIXEL_FORMAT__RGBX:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_PREMUL_4X16LE)\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:\n#endif\n#if defined(WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_RGBA_PREMUL_4X16LE)\n    case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE:\n#endif\n      return true;\n  }\n  return false;\n#else\n  return true;\n#endif\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_swizzler__prepare(wuffs_base__pixel_swizzler* p,\n                                    wuffs_base__pixel_format dst_format,\n                                    wuffs_base__slice_u8 dst_palette,\n                 " +
+	"                   wuffs_base__pixel_format src_format,\n                                    wuffs_base__slice_u8 src_palette,\n                                    wuffs_base__pixel_blend blend) {\n  if (!p) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  }\n\n  // TODO: support many more formats.\n\n  wuffs_base__pixel_swizzler__func func = NULL;\n  wuffs_base__pixel_swizzler__planar_func planar_func = NULL;\n\n  if (!wuffs_base__pixel_swizzler__dst_pixfmt_is_allowed(dst_format)) {\n    p->private_impl.func = NULL;\n    p->private_impl.planar_func = NULL;\n    p->private_impl.quantize_func = NULL;\n    p->private_impl.lookup = NULL;\n    return wuffs_base__make_status(\n        wuffs_base__error__disabled_by_wuffs_config_dst_pixel_format_enable_allowlist);\n  }\n\n  switch (src_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__Y:\n      func = wuffs_base__pixel_swizzler__prepare__y(p, dst_format, dst_palette,\n                                                    src_palette, blend);\n      break;\n\n    case" +
+	" WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY:\n      func = wuffs_base__pixel_swizzler__prepare__indexed__bgra_binary(\n          p, dst_format, dst_palette, src_palette, blend);\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      func = wuffs_base__pixel_swizzler__prepare__bgr(\n          p, dst_format, dst_palette, src_palette, blend);\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n      func = wuffs_base__pixel_swizzler__prepare__bgra_nonpremul(\n          p, dst_format, dst_palette, src_palette, blend);\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n      func = wuffs_base__pixel_swizzler__prepare__bgra_premul(\n          p, dst_format, dst_palette, src_palette, blend);\n      break;\n\n    case WUFFS_BASE__PIXEL_FORMAT__YCBCR:\n      planar_func = wuffs_base__pixel_swizzler__prepare__ycc(\n          p, dst_format, dst_palette, src_palette, blend);\n      break;\n  }\n\n  p->private_impl.func = func;\n  p->private_impl.planar_func = planar_func;\n  p->private_impl.quantize_func" +
+	" = NULL;\n  p->private_impl.lookup = NULL;\n  if (func || planar_func) {\n    return wuffs_base__make_status(NULL);\n  }\n  return wuffs_base__make_status(\n      wuffs_base__error__unsupported_pixel_swizzler_option);\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_swizzler__prepare_quantizing(\n    wuffs_base__pixel_swizzler* p,\n    wuffs_base__pixel_palette_lookup* lookup,\n    wuffs_base__pixel_format dst_format,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__pixel_format src_format,\n    wuffs_base__pixel_blend blend) {\n  if (!p) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  }\n  p->private_impl.func = NULL;\n  p->private_impl.planar_func = NULL;\n  p->private_impl.quantize_func = NULL;\n  p->private_impl.lookup = NULL;\n  if (!lookup) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  } else if (!wuffs_base__pixel_swizzler__dst_pixfmt_is_allowed(dst_format)) {\n    return wuffs_base__make_status(\n        wuffs_base__error__disabled_by_wuffs_co" +
+	"nfig_dst_pixel_format_enable_allowlist);\n  }\n\n  // Compositing onto palette indexes would need blending the existing dst\n  // color, so only SRC is supported unless the source is opaque, when\n  // SRC_OVER is equivalent to SRC.\n  wuffs_base__pixel_swizzler__quantize_func quantize_func = NULL;\n  bool opaque = true;\n  switch (src_format.repr) {\n    case WUFFS_BASE__PIXEL_FORMAT__Y:\n      quantize_func = wuffs_base__pixel_swizzler__index__y;\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__BGR:\n      quantize_func = wuffs_base__pixel_swizzler__index__bgr;\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:\n      quantize_func = wuffs_base__pixel_swizzler__index__bgra_nonpremul;\n      opaque = false;\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:\n    case WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY:\n      quantize_func = wuffs_base__pixel_swizzler__index__bgra_premul;\n      opaque = false;\n      break;\n    case WUFFS_BASE__PIXEL_FORMAT__BGRX:\n      quantize_func = wuffs_base__pixel_swizzler__in" +
+	"dex__bgrx;\n      break;\n  }\n  if (!quantize_func ||\n      ((blend != WUFFS_BASE__PIXEL_BLEND__SRC) &&\n       ((blend != WUFFS_BASE__PIXEL_BLEND__SRC_OVER) || !opaque))) {\n    return wuffs_base__make_status(\n        wuffs_base__error__unsupported_pixel_swizzler_option);\n  }\n\n  wuffs_base__status status = wuffs_base__pixel_palette_lookup__prepare(\n      lookup, dst_palette, dst_format);\n  if (status.repr) {\n    return wuffs_base__make_status(\n        wuffs_base__error__unsupported_pixel_swizzler_option);\n  }\n  p->private_impl.quantize_func = quantize_func;\n  p->private_impl.lookup = lookup;\n  return wuffs_base__make_status(NULL);\n}\n\nWUFFS_BASE__MAYBE_STATIC uint64_t  //\nwuffs_base__pixel_swizzler__swizzle_interleaved(\n    const wuffs_base__pixel_swizzler* p,\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) {\n  if (p) {\n    if (p->private_impl.func) {\n      return (*p->private_impl.func)(dst, dst_palette, src);\n    } else if (p->private_impl.quantize_func) {\n     " +
+	" return (*p->private_impl.quantize_func)(dst, p->private_impl.lookup, src);\n    }\n  }\n  return 0;\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_swizzler__swizzle_planar(\n    const wuffs_base__pixel_swizzler* p,\n    wuffs_base__pixel_buffer* dst,\n    const wuffs_base__pixel_buffer* src) {\n  if (!p) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  } else if (!p->private_impl.planar_func) {\n    return wuffs_base__make_status(\n        wuffs_base__error__unsupported_pixel_swizzler_option);\n  } else if (!dst || !src ||\n             (wuffs_base__pixel_format__num_planes(\n                  &src->pixcfg.private_impl.pixfmt) < 3)) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  }\n\n  uint32_t dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(\n      &dst->pixcfg.private_impl.pixfmt);\n  if ((dst_bits_per_pixel == 0) || ((dst_bits_per_pixel % 8) != 0)) {\n    return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n  }\n  size_t" +
+	" dst_bytes_per_pixel = dst_bits_per_pixel / 8;\n\n  uint32_t width = wuffs_base__u32__min(dst->pixcfg.private_impl.width,\n                                        src->pixcfg.private_impl.width);\n  uint32_t height = wuffs_base__u32__min(dst->pixcfg.private_impl.height,\n                                         src->pixcfg.private_impl.height);\n  const wuffs_base__pixel_subsampling* pixsub =\n      &src->pixcfg.private_impl.pixsub;\n  const wuffs_base__table_u8* src_tabs = &src->private_impl.planes[0];\n  const wuffs_base__table_u8* dst_tab = &dst->private_impl.planes[0];\n  uint32_t q;\n  for (q = 0; q < 3; q++) {\n    if ((width > 0) && (height > 0) &&\n        ((src_tabs[q].width == 0) || (src_tabs[q].height == 0))) {\n      return wuffs_base__make_status(wuffs_base__error__bad_argument);\n    }\n  }\n\n  // Samples that don't map one-to-one onto pixels (e.g. 4:2:2 or 4:2:0\n  // chroma) are replicated, one chunk at a time, into upsampled.\n  uint8_t upsampled[3][256];\n\n  uint32_t y;\n  for (y = 0; y < height; y++) {\n    cons" +
+	"t uint8_t* src_rows[3];\n    for (q = 0; q < 3; q++) {\n      size_t j = (y + wuffs_base__pixel_subsampling__bias_y(pixsub, q)) /\n                 wuffs_base__pixel_subsampling__denominator_y(pixsub, q);\n      if (j >= src_tabs[q].height) {\n        j = src_tabs[q].height - 1;\n      }\n      src_rows[q] = src_tabs[q].ptr + (j * src_tabs[q].stride);\n    }\n    uint8_t* dst_row = dst_tab->ptr + (((size_t)y) * dst_tab->stride);\n\n    uint32_t x = 0;\n    while (x < width) {\n      size_t n = wuffs_base__u32__min(width - x, 256);\n      wuffs_base__slice_u8 srcs[3];\n      for (q = 0; q < 3; q++) {\n        uint32_t bx = wuffs_base__pixel_subsampling__bias_x(pixsub, q);\n        uint32_t dx = wuffs_base__pixel_subsampling__denominator_x(pixsub, q);\n        size_t w = src_tabs[q].width;\n        if ((bx == 0) && (dx == 1)) {\n          srcs[q] = wuffs_base__make_slice_u8(\n              (uint8_t*)(src_rows[q] + x),\n              (x < w) ? wuffs_base__u64__min(n, w - x) : 0);\n          continue;\n        }\n        // Step i and it" +
+	"s remainder r incrementally, instead of dividing\n        // (x + k + bx) by dx for every k.\n        size_t i = (x + bx) / dx;\n        uint32_t r = (x + bx) % dx;\n        size_t k;\n        for (k = 0; k < n; k++) {\n          upsampled[q][k] = src_rows[q][(i < w) ? i : (w - 1)];\n          if (++r == dx) {\n            r = 0;\n            i++;\n          }\n        }\n        srcs[q] = wuffs_base__make_slice_u8(&upsampled[q][0], n);\n      }\n\n      size_t dst_i = ((size_t)x) * dst_bytes_per_pixel;\n      if (dst_i >= dst_tab->width) {\n        break;\n      }\n      uint64_t m = (*p->private_impl.planar_func)(\n          wuffs_base__make_slice_u8(dst_row + dst_i, dst_tab->width - dst_i),\n          srcs[0], srcs[1], srcs[2]);\n      if (m < n) {\n        break;\n      }\n      x += (uint32_t)n;\n    }\n  }\n  return wuffs_base__make_status(NULL);\n}\n" +
+	""
+
+const baseTapeSubmoduleC = "" +
+	"// ---------------- Token Tapes\n\n// The chain_state of an in-progress STRING node is one of:\n//  - NONE_COPIED: only dropped bytes (e.g. an opening quote) so far.\n//  - COPYING: the converted string is a contiguous run of source bytes.\n//  - COPIED: as COPYING, but followed by dropped bytes (e.g. a closing quote).\n//  - CONVERTED: the converted string is in the arena.\n#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED 0\n#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING 1\n#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPIED 2\n#define WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED 3\n\nWUFFS_BASE__MAYBE_STATIC void  //\nwuffs_base__tape_builder__initialize(wuffs_base__tape_builder* b,\n                                     wuffs_base__slice_u8 src) {\n  if (!b) {\n    return;\n  }\n  memset(&b->private_impl, 0, sizeof(b->private_impl));\n  b->private_impl.src = src;\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__tape_builder__set_nodes(wuffs_base__tape_builder* b,\n                         " +
+	"           wuffs_base__slice_tape_node nodes) {\n  if (!b) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  } else if (nodes.len < b->private_impl.nodes_wi) {\n    return wuffs_base__make_status(\n        wuffs_base__error__bad_argument_length_too_short);\n  }\n  // Every node's skip (and every open container's parent link) fits in a\n  // uint32_t.\n  if (((uint64_t)(nodes.len)) > 0xFFFFFFFF) {\n    nodes.len = (size_t)(0xFFFFFFFF);\n  }\n  if ((nodes.ptr != b->private_impl.nodes.ptr) &&\n      (b->private_impl.nodes_wi > 0)) {\n    memmove(nodes.ptr, b->private_impl.nodes.ptr,\n            b->private_impl.nodes_wi * sizeof(wuffs_base__tape_node));\n  }\n  b->private_impl.nodes = nodes;\n  return wuffs_base__make_status(NULL);\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__tape_builder__set_arena(wuffs_base__tape_builder* b,\n                                    wuffs_base__slice_u8 arena) {\n  if (!b) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  }\n  size_t n " +
+	"= 0;\n  if (b->private_impl.chain_state ==\n      WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED) {\n    n = b->private_impl.arena_wi - b->private_impl.chain_arena_begin;\n    if (arena.len < n) {\n      return wuffs_base__make_status(\n          wuffs_base__error__bad_argument_length_too_short);\n    } else if (n > 0) {\n      memmove(arena.ptr,\n              b->private_impl.arena.ptr + b->private_impl.chain_arena_begin, n);\n    }\n  }\n  b->private_impl.arena = arena;\n  b->private_impl.arena_wi = n;\n  b->private_impl.chain_arena_begin = 0;\n  return wuffs_base__make_status(NULL);\n}\n\n// wuffs_base__tape_builder__private_convert ensures that the in-progress\n// STRING node is in the CONVERTED state, with room for n more arena bytes.\nstatic const char*  //\nwuffs_base__tape_builder__private_convert(wuffs_base__tape_builder* b,\n                                          size_t n) {\n  size_t available = b->private_impl.arena.len - b->private_impl.arena_wi;\n  if (b->private_impl.chain_state ==\n      WUFFS_BASE__TAPE_BUILDER_" +
+	"_CHAIN_STATE__CONVERTED) {\n    return (available >= n) ? NULL\n                            : wuffs_base__error__bad_argument_length_too_short;\n  }\n  size_t m = b->private_impl.chain_copy_end - b->private_impl.chain_copy_begin;\n  if ((available < m) || ((available - m) < n)) {\n    return wuffs_base__error__bad_argument_length_too_short;\n  } else if (m > 0) {\n    memcpy(b->private_impl.arena.ptr + b->private_impl.arena_wi,\n           b->private_impl.src.ptr + b->private_impl.chain_copy_begin, m);\n  }\n  b->private_impl.chain_arena_begin = b->private_impl.arena_wi;\n  b->private_impl.arena_wi += m;\n  b->private_impl.chain_state =\n      WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED;\n  return NULL;\n}\n\n// wuffs_base__tape_builder__private_append_string appends a STRING or\n// UNICODE_CODE_POINT token, at src index pos, to the in-progress STRING node.\n// On error, the builder's state (other than the arena's unused bytes) is\n// unchanged.\nstatic const char*  //\nwuffs_base__tape_builder__private_append_string(wuffs_bas" +
+	"e__tape_builder* b,\n                                                int64_t vbc,\n                                                uint64_t vbd,\n                                                size_t pos,\n                                                size_t len) {\n  if (vbc == WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT) {\n    uint8_t u[WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL];\n    size_t n = wuffs_base__utf_8__encode(\n        wuffs_base__make_slice_u8(&u[0],\n                                  WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL),\n        (uint32_t)(vbd));\n    if (n == 0) {\n      return wuffs_base__error__bad_argument;\n    }\n    const char* z = wuffs_base__tape_builder__private_convert(b, n);\n    if (z) {\n      return z;\n    }\n    memcpy(b->private_impl.arena.ptr + b->private_impl.arena_wi, &u[0], n);\n    b->private_impl.arena_wi += n;\n    return NULL;\n\n  } else if (len == 0) {\n    return NULL;\n\n  } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY) {\n    switch (b->private_impl.chai" +
+	"n_state) {\n      case WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED:\n        b->private_impl.chain_copy_begin = pos;\n        b->private_impl.chain_copy_end = pos + len;\n        b->private_impl.chain_state =\n            WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING;\n        return NULL;\n      case WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING:\n        b->private_impl.chain_copy_end = pos + len;\n        return NULL;\n    }\n    const char* z = wuffs_base__tape_builder__private_convert(b, len);\n    if (z) {\n      return z;\n    }\n    memcpy(b->private_impl.arena.ptr + b->private_impl.arena_wi,\n           b->private_impl.src.ptr + pos, len);\n    b->private_impl.arena_wi += len;\n    return NULL;\n\n  } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_0_DST_1_SRC_DROP) {\n    switch (b->private_impl.chain_state) {\n      case WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED:\n        b->private_impl.chain_copy_begin = pos + len;\n        b->private_impl.chain_copy_end = pos + len;\n        break;\n      case WU" +
+	"FFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPYING:\n        b->private_impl.chain_state =\n            WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__COPIED;\n        break;\n    }\n    return NULL;\n\n  } else if (vbd &\n             WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_4_SRC_BACKSLASH_X) {\n    if (len & 3) {\n      return wuffs_base__error__bad_argument;\n    }\n    const char* z = wuffs_base__tape_builder__private_convert(b, len / 4);\n    if (z) {\n      return z;\n    }\n    b->private_impl.arena_wi += wuffs_base__hexadecimal__decode4(\n        wuffs_base__make_slice_u8(\n            b->private_impl.arena.ptr + b->private_impl.arena_wi, len / 4),\n        wuffs_base__make_slice_u8(b->private_impl.src.ptr + pos, len));\n    return NULL;\n  }\n\n  return wuffs_base__error__unsupported_option;\n}\n\n// wuffs_base__tape_builder__private_end_chain completes the in-progress\n// chain's node, whose last token ends at src index end.\nstatic void  //\nwuffs_base__tape_builder__private_end_chain(wuffs_base__tape_builder* b,\n                     " +
+	"                       size_t end) {\n  wuffs_base__tape_node* node =\n      &b->private_impl.nodes.ptr[b->private_impl.chain - 1];\n  if (wuffs_base__tape_node__kind(node) !=\n      WUFFS_BASE__TAPE_NODE__KIND__STRING) {\n    node->data.len = end - ((size_t)(node->data.ptr - b->private_impl.src.ptr));\n  } else if (b->private_impl.chain_state ==\n             WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__CONVERTED) {\n    node->data = wuffs_base__make_slice_u8(\n        b->private_impl.arena.ptr + b->private_impl.chain_arena_begin,\n        b->private_impl.arena_wi - b->private_impl.chain_arena_begin);\n    node->repr |= WUFFS_BASE__TAPE_NODE__FLAG__CONVERTED;\n  } else {\n    node->data = wuffs_base__make_slice_u8(\n        b->private_impl.src.ptr + b->private_impl.chain_copy_begin,\n        b->private_impl.chain_copy_end - b->private_impl.chain_copy_begin);\n  }\n  b->private_impl.chain = 0;\n  b->private_impl.chain_state =\n      WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED;\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //" +
+	"\nwuffs_base__tape_builder__append_tokens(wuffs_base__tape_builder* b,\n                                        wuffs_base__token_buffer* tok) {\n  if (!b) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  } else if (!tok) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  }\n\n  for (; tok->meta.ri < tok->meta.wi; tok->meta.ri++) {\n    wuffs_base__token t = tok->data.ptr[tok->meta.ri];\n    size_t pos = b->private_impl.src_ri;\n    size_t len = (size_t)(wuffs_base__token__length(&t));\n    if (len > (b->private_impl.src.len - pos)) {\n      return wuffs_base__make_status(wuffs_base__error__bad_argument);\n    } else if (wuffs_base__token__value_major(&t) != 0) {\n      return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n    }\n    int64_t vbc = wuffs_base__token__value_base_category(&t);\n    uint64_t vbd = wuffs_base__token__value_base_detail(&t);\n\n    // Continue the in-progress chain, if there is one.\n    if (b->private_impl.chain) {\n      wuffs_base__tap" +
+	"e_node* node =\n          &b->private_impl.nodes.ptr[b->private_impl.chain - 1];\n      if (wuffs_base__tape_node__kind(node) ==\n          WUFFS_BASE__TAPE_NODE__KIND__STRING) {\n        if ((vbc != WUFFS_BASE__TOKEN__VBC__STRING) &&\n            (vbc != WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT)) {\n          return wuffs_base__make_status(wuffs_base__error__bad_argument);\n        }\n        const char* z = wuffs_base__tape_builder__private_append_string(\n            b, vbc, vbd, pos, len);\n        if (z) {\n          return wuffs_base__make_status(z);\n        }\n      } else {\n        int64_t want_vbc = (wuffs_base__tape_node__kind(node) ==\n                            WUFFS_BASE__TAPE_NODE__KIND__LITERAL)\n                               ? WUFFS_BASE__TOKEN__VBC__LITERAL\n                               : WUFFS_BASE__TOKEN__VBC__NUMBER;\n        if (vbc != want_vbc) {\n          return wuffs_base__make_status(wuffs_base__error__bad_argument);\n        }\n      }\n      b->private_impl.src_ri = pos + len;\n      if (!wuffs_b" +
+	"ase__token__continued(&t)) {\n        wuffs_base__tape_builder__private_end_chain(b, pos + len);\n      }\n      continue;\n    }\n\n    uint32_t kind = 0;\n    switch (vbc) {\n      case WUFFS_BASE__TOKEN__VBC__FILLER:\n        b->private_impl.src_ri = pos + len;\n        continue;\n\n      case WUFFS_BASE__TOKEN__VBC__STRUCTURE:\n        if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__POP) {\n          if (b->private_impl.open == 0) {\n            return wuffs_base__make_status(wuffs_base__error__bad_argument);\n          }\n          size_t i = b->private_impl.open - 1;\n          wuffs_base__tape_node* node = &b->private_impl.nodes.ptr[i];\n          b->private_impl.open = node->skip;\n          node->skip = (uint32_t)(b->private_impl.nodes_wi - i);\n          node->data.len =\n              pos + len - ((size_t)(node->data.ptr - b->private_impl.src.ptr));\n          b->private_impl.src_ri = pos + len;\n          continue;\n        } else if (!(vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__PUSH)) {\n          return wuffs_base__make_statu" +
+	"s(wuffs_base__error__bad_argument);\n        } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_LIST) {\n          kind = WUFFS_BASE__TAPE_NODE__KIND__LIST;\n        } else if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_DICT) {\n          kind = WUFFS_BASE__TAPE_NODE__KIND__DICT;\n        } else {\n          return wuffs_base__make_status(wuffs_base__error__bad_argument);\n        }\n        break;\n\n      case WUFFS_BASE__TOKEN__VBC__STRING:\n      case WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT:\n        kind = WUFFS_BASE__TAPE_NODE__KIND__STRING;\n        break;\n      case WUFFS_BASE__TOKEN__VBC__LITERAL:\n        kind = WUFFS_BASE__TAPE_NODE__KIND__LITERAL;\n        break;\n      case WUFFS_BASE__TOKEN__VBC__NUMBER:\n        kind = WUFFS_BASE__TAPE_NODE__KIND__NUMBER;\n        break;\n\n      default:\n        return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n    }\n\n    // Start a new node.\n    if (b->private_impl.nodes_wi >= b->private_impl.nodes.len) {\n      return wuffs_base__make_status(\n       " +
+	"   wuffs_base__error__bad_argument_length_too_short);\n    }\n    size_t i = b->private_impl.nodes_wi;\n    wuffs_base__tape_node* node = &b->private_impl.nodes.ptr[i];\n    node->data = wuffs_base__make_slice_u8(b->private_impl.src.ptr + pos, len);\n    node->repr = (kind << WUFFS_BASE__TAPE_NODE__KIND__SHIFT) |\n                 ((uint32_t)(vbd & 0x1FFFFF));\n    node->skip = 1;\n\n    if (kind == WUFFS_BASE__TAPE_NODE__KIND__STRING) {\n      b->private_impl.chain_copy_begin = pos;\n      b->private_impl.chain_copy_end = pos;\n      b->private_impl.chain_state =\n          WUFFS_BASE__TAPE_BUILDER__CHAIN_STATE__NONE_COPIED;\n      const char* z = wuffs_base__tape_builder__private_append_string(\n          b, vbc, vbd, pos, len);\n      if (z) {\n        return wuffs_base__make_status(z);\n      }\n    } else if ((kind == WUFFS_BASE__TAPE_NODE__KIND__LIST) ||\n               (kind == WUFFS_BASE__TAPE_NODE__KIND__DICT)) {\n      // Until it is popped, an open container's skip field links to its\n      // parent.\n      node->skip =" +
+	" (uint32_t)(b->private_impl.open);\n      b->private_impl.open = i + 1;\n    }\n\n    b->private_impl.nodes_wi = i + 1;\n    b->private_impl.src_ri = pos + len;\n    if ((kind != WUFFS_BASE__TAPE_NODE__KIND__LIST) &&\n        (kind != WUFFS_BASE__TAPE_NODE__KIND__DICT)) {\n      b->private_impl.chain = i + 1;\n      if (!wuffs_base__token__continued(&t)) {\n        wuffs_base__tape_builder__private_end_chain(b, pos + len);\n      }\n    }\n  }\n  return wuffs_base__make_status(NULL);\n}\n" +
+	""
+
+const baseCPUArchPrivateH = "" +
+	"// ---------------- CPU Architecture\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\n// WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42 lets a function use SSE4.2 (and\n// earlier, such as SSSE3 and SSE4.1) intrinsics, as well as the POPCNT and\n// PCLMULQDQ instructions, even if the rest of the program is compiled without\n// \"-msse4.2\". Only call such functions after checking\n// wuffs_base__cpu_arch__have_x86_sse42.\n#define WUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42 \\\n  __attribute__((target(\"pclmul,popcnt,sse4.2\")))\n\n// wuffs_base__cpu_arch__have_x86_sse42 returns whether the CPU supports\n// SSE4.2 and the instruction sets it implies: SSE2, SSE3, SSSE3 and SSE4.1.\n// It also requires POPCNT and PCLMULQDQ, which every SSE4.2 capable x86_64 CPU\n// in practice also has.\n//\n// The CPUID instruction can be slow, especially in virtual machines, so the\n// result is memoized. Racing threads can only ever store the same value.\nstatic inline bool  //\nwuffs_base__cpu_arch__have_x86_sse42() {\n  // 0 means unknown, 1 means no and 2 mean" +
+	"s yes.\n  static int memo = 0;\n  int m = __atomic_load_n(&memo, __ATOMIC_RELAXED);\n  if (m == 0) {\n    m = 1;\n    unsigned int eax1 = 0;\n    unsigned int ebx1 = 0;\n    unsigned int ecx1 = 0;\n    unsigned int edx1 = 0;\n    if (__get_cpuid(1, &eax1, &ebx1, &ecx1, &edx1)) {\n      const unsigned int sse42_ecx1 = bit_PCLMUL | bit_POPCNT | bit_SSE3 |\n                                      bit_SSSE3 | bit_SSE4_1 | bit_SSE4_2;\n      if ((ecx1 & sse42_ecx1) == sse42_ecx1) {\n        m = 2;\n      }\n    }\n    __atomic_store_n(&memo, m, __ATOMIC_RELAXED);\n  }\n  return m == 2;\n}\n\n// wuffs_base__cpu_arch__utf_8_span_x86_sse42 returns the length of a prefix of\n// the 16 bytes x that is valid UTF-8 and does not contain any stop bytes. Bit\n// i of stops is set if x's i'th byte is a stop byte, which must be ASCII. The\n// x bytes must start at a code point boundary and the prefix ends at one.\n//\n// The prefix is usually the longest such prefix, but it can be shorter near\n// invalid UTF-8. In particular, returning zero does not imp" +
+	"ly that x starts\n// with invalid UTF-8, only that the caller should check its first code point\n// more carefully, e.g. with wuffs_base__utf_8__next.\n//\n// Validation uses the \"lookup\" algorithm from \"Validating UTF-8 In Less Than\n// One Instruction Per Byte\" by Keiser and Lemire (Software: Practice and\n// Experience, 2021). Three 16-entry tables, indexed by the high and low\n// nibbles of each byte's predecessor and the high nibble of the byte itself,\n// give bit sets of the errors possible given that nibble. Their bitwise-and is\n// non-zero where a pair of bytes is invalid. The bits are:\n//  - 0x01 too short: a lead byte followed by a non-continuation byte.\n//  - 0x02 too long: an ASCII byte followed by a continuation byte.\n//  - 0x04 overlong 3-byte encoding: 0xE0 followed by 0x80 ..= 0x9F.\n//  - 0x08 too large: 0xF4 ..= 0xFF followed by 0x90 ..= 0xBF.\n//  - 0x10 surrogate: 0xED followed by 0xA0 ..= 0xBF.\n//  - 0x20 overlong 2-byte encoding: 0xC0 or 0xC1.\n//  - 0x40 too large or overlong 4-byte encoding: 0xF" +
+	"0 or 0xF5 ..= 0xFF\n//    followed by 0x80 ..= 0x8F.\n//  - 0x80 two continuations, or that it is the 3rd or 4th byte of a code\n//    point. Exactly one of those should hold, so this bit is flipped where\n//    the byte two or three places earlier is a 3- or 4-byte lead.\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline uint32_t  //\nwuffs_base__cpu_arch__utf_8_span_x86_sse42(__m128i x, uint32_t stops) {\n  const __m128i byte_1_high_table = _mm_setr_epi8(\n      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  //\n      -0x80, -0x80, -0x80, -0x80, 0x21, 0x01, 0x15, 0x49);\n  const __m128i byte_1_low_table = _mm_setr_epi8(\n      -0x19, -0x5D, -0x7D, -0x7D, -0x75, -0x35, -0x35, -0x35,  //\n      -0x35, -0x35, -0x35, -0x35, -0x35, -0x25, -0x35, -0x35);\n  const __m128i byte_2_high_table = _mm_setr_epi8(\n      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  //\n      -0x1A, -0x52, -0x46, -0x46, 0x01, 0x01, 0x01, 0x01);\n  const __m128i low_nibble = _mm_set1_epi8(0x0F);\n\n  // Zero bytes are shifted in before x. They act " +
+	"like ASCII.\n  __m128i prev1 = _mm_slli_si128(x, 1);\n  __m128i prev2 = _mm_slli_si128(x, 2);\n  __m128i prev3 = _mm_slli_si128(x, 3);\n\n  __m128i errs = _mm_and_si128(\n      _mm_and_si128(\n          _mm_shuffle_epi8(byte_1_high_table,\n                           _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble)),\n          _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, low_nibble))),\n      _mm_shuffle_epi8(byte_2_high_table,\n                       _mm_and_si128(_mm_srli_epi16(x, 4), low_nibble)));\n  errs = _mm_xor_si128(\n      errs, _mm_and_si128(\n                _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80)),\n                             _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80))),\n                _mm_set1_epi8(-0x80)));\n\n  // A code point that starts in x's last 3 bytes might not end within x.\n  __m128i incomplete = _mm_subs_epu8(\n      x, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,  //\n                       -1, -1, -1, -1, -1, -0x11, -0x21, -0x41));\n\n  // Bit i of bad is set " +
+	"if x's i'th byte is the first byte (in its pair or\n  // triple) that is invalid. Bits 16 and 17 are sentinels: bit 16 means that\n  // the last code point is incomplete.\n  uint32_t bad = 0xFFFFu & ~(uint32_t)_mm_movemask_epi8(\n                               _mm_cmpeq_epi8(errs, _mm_setzero_si128()));\n  bad |= (0xFFFFu == (uint32_t)_mm_movemask_epi8(\n                         _mm_cmpeq_epi8(incomplete, _mm_setzero_si128())))\n             ? 0x20000u\n             : 0x10000u;\n\n  // Bit i of boundaries is set if x's i'th byte is not a continuation byte.\n  // As signed 8-bit integers, continuation bytes are less than 0xC0.\n  uint32_t boundaries =\n      0x10000u | (0xFFFFu & ~(uint32_t)_mm_movemask_epi8(\n                                 _mm_cmplt_epi8(x, _mm_set1_epi8(-0x40))));\n\n  // Every code point that ends before the first bad byte is valid. Return the\n  // last boundary strictly before that byte, and not after the first stop.\n  uint32_t n = (uint32_t)__builtin_ctz(bad);\n  if (n == 0) {\n    return 0;\n  }\n  uint32" +
+	"_t m = (uint32_t)__builtin_ctz(stops | 0x10000u);\n  if (m > (n - 1)) {\n    m = n - 1;\n  }\n  boundaries &= (2u << m) - 1u;\n  return 31u - (uint32_t)__builtin_clz(boundaries | 1u);\n}\n\n#else  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\nstatic inline bool  //\nwuffs_base__cpu_arch__have_x86_sse42() {\n  return false;\n}\n\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\n" +
+	"" +
+	"// ---------------- CPU Architecture (Utility)\n\n// The wuffs_base__utility__etc functions below are called by Wuffs code (e.g.\n// in std/crc32) via \"utility.etc\" built-in functions. The Wuffs language\n// itself has no notion of SIMD, so these hand-written C implementations are\n// the bridge from Wuffs code to CPU-specific instructions.\n//\n// Wuffs code should only call the CPU-specific function (e.g.\n// utility.crc32_ieee_x86_sse42) after the corresponding check (e.g.\n// utility.cpu_arch_have_x86_sse42) returns true. On other CPU architectures,\n// the check always returns false and the CPU-specific function is an inert\n// placeholder, so that the generated C code still compiles.\n\n#define wuffs_base__utility__cpu_arch_have_x86_sse42 \\\n  wuffs_base__cpu_arch__have_x86_sse42\n\n#if defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\n// wuffs_base__utility__crc32_ieee_x86_sse42 updates the CRC-32 (IEEE) state s\n// (the bitwise complement of the running checksum, as per std/crc32's\n// ieee_hasher) with the first (x.len & ~15) by" +
+	"tes of x, using carry-less\n// multiplication to fold 64 bytes at a time. The x.len must be at least 64.\n//\n// The algorithm is described in \"Fast CRC Computation for Generic Polynomials\n// Using PCLMULQDQ Instruction\" by Gopal, Ozturk, Guilford, Wolrich, Feghali,\n// Dixon and Karakoyunlu (Intel, 2009). The magic constants are powers of x\n// modulo the bit-reflected IEEE polynomial (0x1_DB71_0641), as well as that\n// polynomial's Barrett reduction constant (0x1_F701_1641).\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline uint32_t  //\nwuffs_base__utility__crc32_ieee_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {\n  if (x.len < 64) {\n    return s;\n  }\n  uint8_t* p = x.ptr;\n  size_t n = x.len & ~((size_t)15);\n\n  __m128i k1k2 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);\n  __m128i k3k4 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);\n  __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163CD6124);\n  __m128i poly = _mm_set_epi64x(0x01F7011641, 0x01DB710641);\n  __m128i mask = _mm_setr_epi32(-1, 0, -1, 0);\n\n  __m128i x" +
+	"1 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00));\n  __m128i x2 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x10));\n  __m128i x3 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x20));\n  __m128i x4 = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x30));\n  x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)s));\n  p += 64;\n  n -= 64;\n\n  // Fold 64 bytes (4 lanes of 128 bits) at a time.\n  while (n >= 64) {\n    __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);\n    __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);\n    __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);\n    __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);\n    x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);\n    x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);\n    x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);\n    x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);\n    x1 =\n        _mm_xor_si128(_mm_xor_si128(x1, x5),\n                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00)));\n    x2 =\n        _mm_xor_si128(_mm_xor_si128(x2, x6)" +
+	",\n                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x10)));\n    x3 =\n        _mm_xor_si128(_mm_xor_si128(x3, x7),\n                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x20)));\n    x4 =\n        _mm_xor_si128(_mm_xor_si128(x4, x8),\n                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x30)));\n    p += 64;\n    n -= 64;\n  }\n\n  // Fold the 4 lanes into 1.\n  __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);\n  x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);\n  x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);\n  x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);\n  x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);\n  x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);\n  x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);\n  x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);\n  x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);\n\n  // Fold 16 bytes (1 lane) at a time.\n  while (n >= 16) {\n    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);\n    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);\n    x1 =\n        _mm_xor_si128(" +
+	"_mm_xor_si128(x1, x5),\n                      _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00)));\n    p += 16;\n    n -= 16;\n  }\n\n  // Fold 128 bits to 64 bits.\n  x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);\n  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);\n  x2 = _mm_srli_si128(x1, 4);\n  x1 = _mm_and_si128(x1, mask);\n  x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);\n  x1 = _mm_xor_si128(x1, x2);\n\n  // Barrett reduce to 32 bits.\n  x2 = _mm_and_si128(x1, mask);\n  x2 = _mm_clmulepi64_si128(x2, poly, 0x10);\n  x2 = _mm_and_si128(x2, mask);\n  x2 = _mm_clmulepi64_si128(x2, poly, 0x00);\n  x1 = _mm_xor_si128(x1, x2);\n  return (uint32_t)_mm_extract_epi32(x1, 1);\n}\n\n// wuffs_base__utility__crc32_castagnoli_x86_sse42 updates the CRC-32C\n// (Castagnoli) state s (the bitwise complement of the running checksum, as per\n// std/crc32's castagnoli_hasher) with all of x, using SSE4.2's dedicated\n// CRC32 instruction, 8 bytes at a time.\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline uint32_t  //\nwuffs_base__utility__crc32_ca" +
+	"stagnoli_x86_sse42(uint32_t s,\n                                                wuffs_base__slice_u8 x) {\n  uint8_t* p = x.ptr;\n  size_t n = x.len;\n\n  uint64_t s64 = s;\n  while (n >= 32) {\n    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 0));\n    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 8));\n    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 16));\n    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p + 24));\n    p += 32;\n    n -= 32;\n  }\n  while (n >= 8) {\n    s64 = _mm_crc32_u64(s64, wuffs_base__load_u64le__no_bounds_check(p));\n    p += 8;\n    n -= 8;\n  }\n\n  s = (uint32_t)s64;\n  while (n--) {\n    s = _mm_crc32_u8(s, *p++);\n  }\n  return s;\n}\n\n// wuffs_base__utility__adler32_x86_sse42 updates the Adler-32 state s (s2 in\n// the high 16 bits, s1 in the low 16 bits, as per std/adler32's hasher) with\n// the first (x.len & ~31) bytes of x, 32 bytes at a time.\n//\n// Within each 32 byte block, s1 gains the sum of the bytes (via " +
+	"PSADBW) and\n// s2 gains their sum weighted by 32, 31, ..., 1 (via PMADDUBSW and PMADDWD),\n// plus 32 times the previous s1. As with the portable code, both are reduced\n// modulo 65521 at least every 5552 bytes, so that they cannot overflow.\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline uint32_t  //\nwuffs_base__utility__adler32_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {\n  uint32_t s1 = s & 0xFFFF;\n  uint32_t s2 = s >> 16;\n  uint8_t* p = x.ptr;\n  size_t blocks = x.len / 32;\n\n  __m128i weights_hi = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25,  //\n                                     24, 23, 22, 21, 20, 19, 18, 17);\n  __m128i weights_lo = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9,  //\n                                     8, 7, 6, 5, 4, 3, 2, 1);\n  __m128i ones = _mm_set1_epi16(1);\n  __m128i zero = _mm_setzero_si128();\n\n  while (blocks > 0) {\n    // 5536 is the largest multiple of 32 that is at most 5552.\n    size_t n = 5536 / 32;\n    if (n > blocks) {\n      n = blocks;\n    }\n    blocks -= n;\n\n    " +
+	"// v_ps accumulates the sum of s1 over the n blocks, to be multiplied by\n    // 32 (the block size) and added to s2 afterwards.\n    __m128i v_ps = _mm_cvtsi32_si128((int)(s1 * n));\n    __m128i v_s1 = _mm_setzero_si128();\n    __m128i v_s2 = _mm_cvtsi32_si128((int)s2);\n\n    do {\n      __m128i hi = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x00));\n      __m128i lo = _mm_lddqu_si128((const __m128i*)(const void*)(p + 0x10));\n      v_ps = _mm_add_epi32(v_ps, v_s1);\n      v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(hi, zero));\n      v_s2 = _mm_add_epi32(\n          v_s2, _mm_madd_epi16(_mm_maddubs_epi16(hi, weights_hi), ones));\n      v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(lo, zero));\n      v_s2 = _mm_add_epi32(\n          v_s2, _mm_madd_epi16(_mm_maddubs_epi16(lo, weights_lo), ones));\n      p += 32;\n    } while (--n);\n\n    v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));\n\n    // Horizontally sum the 4 lanes of v_s1 and of v_s2.\n    v_s1 =\n        _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(2, 3, 0" +
+	", 1)));\n    v_s1 =\n        _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(1, 0, 3, 2)));\n    v_s2 =\n        _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(2, 3, 0, 1)));\n    v_s2 =\n        _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(1, 0, 3, 2)));\n\n    s1 = (s1 + (uint32_t)_mm_cvtsi128_si32(v_s1)) % 65521;\n    s2 = ((uint32_t)_mm_cvtsi128_si32(v_s2)) % 65521;\n  }\n  return (s2 << 16) | s1;\n}\n\n// wuffs_base__utility__json_string_span_x86_sse42 returns the number of\n// leading bytes, out of the 16 bytes given by lo and hi (in little-endian\n// order), that are valid UTF-8 but not '\"', '\\\\' or a C0 control code. For\n// ASCII, these are the bytes that std/json's LUT_CHARS maps to 0x00. As signed\n// 8-bit integers, both C0 control codes and non-ASCII bytes are less than\n// 0x20, so the UTF-8 validation is skipped unless the first such byte is\n// non-ASCII. The span always ends at a code point boundary, but it can stop\n// short of the longest valid prefix, as per\n// wuffs_base__cpu_arch_" +
+	"_utf_8_span_x86_sse42.\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline uint32_t  //\nwuffs_base__utility__json_string_span_x86_sse42(uint64_t lo, uint64_t hi) {\n  __m128i x = _mm_set_epi64x((long long)hi, (long long)lo);\n  __m128i m = _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x22)),\n                           _mm_cmpeq_epi8(x, _mm_set1_epi8(0x5C)));\n  uint32_t stops = (uint32_t)_mm_movemask_epi8(\n      _mm_or_si128(m, _mm_cmplt_epi8(x, _mm_set1_epi8(0x20))));\n  uint32_t n = (uint32_t)__builtin_ctz(stops | 0x10000u);\n  if ((n >= 16) || (0 == ((1u << n) & (uint32_t)_mm_movemask_epi8(x)))) {\n    return n;\n  }\n  // Exclude the non-ASCII bytes from the stops, but include the C0 controls.\n  // As unsigned 8-bit integers, C0 control codes are at most 0x1F.\n  stops = (uint32_t)_mm_movemask_epi8(_mm_or_si128(\n      m, _mm_cmpeq_epi8(x, _mm_min_epu8(x, _mm_set1_epi8(0x1F)))));\n  return wuffs_base__cpu_arch__utf_8_span_x86_sse42(x, stops);\n}\n\n// wuffs_base__utility__json_whitespace_span_x86_sse42 returns the nu" +
+	"mber of\n// leading bytes, out of the 16 bytes given by lo and hi (in little-endian\n// order), that are JSON whitespace: '\\t', '\\n', '\\r' or ' '.\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline uint32_t  //\nwuffs_base__utility__json_whitespace_span_x86_sse42(uint64_t lo, uint64_t hi) {\n  __m128i x = _mm_set_epi64x((long long)hi, (long long)lo);\n  __m128i m = _mm_or_si128(\n      _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x09)),\n                   _mm_cmpeq_epi8(x, _mm_set1_epi8(0x0A))),\n      _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x0D)),\n                   _mm_cmpeq_epi8(x, _mm_set1_epi8(0x20))));\n  return (uint32_t)__builtin_ctz(~((unsigned int)_mm_movemask_epi8(m)));\n}\n\n// wuffs_base__utility__json_skip_span_x86_sse42 returns the number of leading\n// bytes, out of the 16 bytes given by lo and hi (in little-endian order), that\n// are not '\"', '\\\\' or a bracket: '[', ']', '{' or '}'. As an optimization,\n// '|' is also excluded, as OR-ing with 0x20 maps \"[\\\\]\" to \"{|}\".\nWUFFS_BASE__ATTRIBUTE_TARG" +
+	"ET__X86_SSE42\nstatic inline uint32_t  //\nwuffs_base__utility__json_skip_span_x86_sse42(uint64_t lo, uint64_t hi) {\n  __m128i x = _mm_set_epi64x((long long)hi, (long long)lo);\n  __m128i y = _mm_or_si128(x, _mm_set1_epi8(0x20));\n  __m128i m = _mm_or_si128(\n      _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x22)),\n                   _mm_cmpeq_epi8(y, _mm_set1_epi8(0x7B))),\n      _mm_or_si128(_mm_cmpeq_epi8(y, _mm_set1_epi8(0x7C)),\n                   _mm_cmpeq_epi8(y, _mm_set1_epi8(0x7D))));\n  return (uint32_t)__builtin_ctz(((unsigned int)_mm_movemask_epi8(m)) |\n                                 0x10000u);\n}\n\n// The wuffs_base__utility__png_filter_etc_x86_sse42 functions reverse PNG\n// filtering, in place, for the first (curr.len / d) * d bytes of curr, where d\n// (the filter distance) is 3 or 4 bytes per pixel. prev is the previous row,\n// already unfiltered, and must be at least as long as curr. Every curr pixel\n// depends on its left neighbor, so the Average and Paeth filters work on one\n// pixel (all of its c" +
+	"hannels) at a time, but the Sub filter works on four\n// pixels at a time.\n\n// wuffs_base__utility__png_filter_1_distance_4_x86_sse42 reverses the PNG Sub\n// filter. Within each 16 byte block, two shift-and-add steps compute a prefix\n// sum of its four pixels, to which is added the previous block's last pixel.\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline void  //\nwuffs_base__utility__png_filter_1_distance_4_x86_sse42(\n    wuffs_base__slice_u8 curr) {\n  uint8_t* p = curr.ptr;\n  size_t n = curr.len & ~(size_t)3;\n  __m128i a = _mm_setzero_si128();\n\n  for (; n >= 16; n -= 16, p += 16) {\n    __m128i x = _mm_lddqu_si128((const __m128i*)(const void*)p);\n    x = _mm_add_epi8(x, _mm_slli_si128(x, 4));\n    x = _mm_add_epi8(x, _mm_slli_si128(x, 8));\n    x = _mm_add_epi8(x, a);\n    _mm_storeu_si128((__m128i*)(void*)p, x);\n    a = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));\n  }\n\n  for (; n >= 4; n -= 4, p += 4) {\n    a = _mm_add_epi8(\n        a, _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(p))" +
+	");\n    wuffs_base__store_u32le__no_bounds_check(p,\n                                             (uint32_t)_mm_cvtsi128_si32(a));\n  }\n}\n\n// wuffs_base__utility__png_filter_3_x86_sse42 reverses the PNG Average filter.\n// PAVGB rounds up, so the floor of the mean is PAVGB minus the low bit of the\n// XOR of its arguments.\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline void  //\nwuffs_base__utility__png_filter_3_x86_sse42(wuffs_base__slice_u8 curr,\n                                            wuffs_base__slice_u8 prev,\n                                            size_t d) {\n  uint8_t* p = curr.ptr;\n  const uint8_t* q = prev.ptr;\n  size_t n = curr.len - (curr.len % d);\n  __m128i ones = _mm_set1_epi8(1);\n  __m128i a = _mm_setzero_si128();\n\n  for (; n >= d; n -= d, p += d, q += d) {\n    __m128i b;\n    __m128i x;\n    if (d == 4) {\n      b = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(q));\n      x = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(p));\n    } else {\n      b = _mm_cv" +
+	"tsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(q));\n      x = _mm_cvtsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(p));\n    }\n    __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b),\n                               _mm_and_si128(_mm_xor_si128(a, b), ones));\n    a = _mm_add_epi8(x, avg);\n    if (d == 4) {\n      wuffs_base__store_u32le__no_bounds_check(p,\n                                               (uint32_t)_mm_cvtsi128_si32(a));\n    } else {\n      wuffs_base__store_u24le__no_bounds_check(p,\n                                               (uint32_t)_mm_cvtsi128_si32(a));\n    }\n  }\n}\n\n// wuffs_base__utility__png_filter_4_x86_sse42 reverses the PNG Paeth filter,\n// in 16-bit lanes. With a, b and c being the left, up and up-left neighbors,\n// the predictor p = a + b - c is closest to a, b or c (in that order of\n// preference) when |b - c|, |a - c| or |a + b - 2c| is smallest.\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline void  //\nwuffs_base__utility__png_filter_4_x86_sse42(wuffs_base__slice" +
+	"_u8 curr,\n                                            wuffs_base__slice_u8 prev,\n                                            size_t d) {\n  uint8_t* p = curr.ptr;\n  const uint8_t* q = prev.ptr;\n  size_t n = curr.len - (curr.len % d);\n  __m128i zero = _mm_setzero_si128();\n  __m128i mask = _mm_set1_epi16(0xFF);\n  __m128i a = _mm_setzero_si128();\n  __m128i c = _mm_setzero_si128();\n\n  for (; n >= d; n -= d, p += d, q += d) {\n    __m128i b;\n    __m128i x;\n    if (d == 4) {\n      b = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(q));\n      x = _mm_cvtsi32_si128((int)wuffs_base__load_u32le__no_bounds_check(p));\n    } else {\n      b = _mm_cvtsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(q));\n      x = _mm_cvtsi32_si128((int)wuffs_base__load_u24le__no_bounds_check(p));\n    }\n    b = _mm_unpacklo_epi8(b, zero);\n    x = _mm_unpacklo_epi8(x, zero);\n\n    __m128i b_c = _mm_sub_epi16(b, c);\n    __m128i a_c = _mm_sub_epi16(a, c);\n    __m128i pa = _mm_abs_epi16(b_c);\n    __m128i pb = _mm_abs_epi16(a_" +
+	"c);\n    __m128i pc = _mm_abs_epi16(_mm_add_epi16(b_c, a_c));\n    __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));\n    __m128i nearest = _mm_blendv_epi8(\n        _mm_blendv_epi8(c, b, _mm_cmpeq_epi16(smallest, pb)), a,\n        _mm_cmpeq_epi16(smallest, pa));\n\n    a = _mm_and_si128(_mm_add_epi16(x, nearest), mask);\n    c = b;\n    uint32_t v = (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(a, a));\n    if (d == 4) {\n      wuffs_base__store_u32le__no_bounds_check(p, v);\n    } else {\n      wuffs_base__store_u24le__no_bounds_check(p, v);\n    }\n  }\n}\n\n// The distance-specific wrappers let the compiler specialize the loops above\n// for a constant d.\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline void  //\nwuffs_base__utility__png_filter_3_distance_3_x86_sse42(\n    wuffs_base__slice_u8 curr,\n    wuffs_base__slice_u8 prev) {\n  wuffs_base__utility__png_filter_3_x86_sse42(curr, prev, 3);\n}\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline void  //\nwuffs_base__utility__png_filter_3_distance_4_x86_sse4" +
+	"2(\n    wuffs_base__slice_u8 curr,\n    wuffs_base__slice_u8 prev) {\n  wuffs_base__utility__png_filter_3_x86_sse42(curr, prev, 4);\n}\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline void  //\nwuffs_base__utility__png_filter_4_distance_3_x86_sse42(\n    wuffs_base__slice_u8 curr,\n    wuffs_base__slice_u8 prev) {\n  wuffs_base__utility__png_filter_4_x86_sse42(curr, prev, 3);\n}\n\nWUFFS_BASE__ATTRIBUTE_TARGET__X86_SSE42\nstatic inline void  //\nwuffs_base__utility__png_filter_4_distance_4_x86_sse42(\n    wuffs_base__slice_u8 curr,\n    wuffs_base__slice_u8 prev) {\n  wuffs_base__utility__png_filter_4_x86_sse42(curr, prev, 4);\n}\n\n#else  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n\nstatic inline uint32_t  //\nwuffs_base__utility__crc32_ieee_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {\n  return s;\n}\n\nstatic inline uint32_t  //\nwuffs_base__utility__crc32_castagnoli_x86_sse42(uint32_t s,\n                                                wuffs_base__slice_u8 x) {\n  return s;\n}\n\nstatic inline uint32_t  //\nwuffs_base__utility__a" +
+	"dler32_x86_sse42(uint32_t s, wuffs_base__slice_u8 x) {\n  return s;\n}\n\nstatic inline uint32_t  //\nwuffs_base__utility__json_string_span_x86_sse42(uint64_t lo, uint64_t hi) {\n  return 0;\n}\n\nstatic inline uint32_t  //\nwuffs_base__utility__json_skip_span_x86_sse42(uint64_t lo, uint64_t hi) {\n  return 0;\n}\n\nstatic inline uint32_t  //\nwuffs_base__utility__json_whitespace_span_x86_sse42(uint64_t lo, uint64_t hi) {\n  return 0;\n}\n\nstatic inline void  //\nwuffs_base__utility__png_filter_1_distance_4_x86_sse42(\n    wuffs_base__slice_u8 curr) {}\n\nstatic inline void  //\nwuffs_base__utility__png_filter_3_distance_3_x86_sse42(\n    wuffs_base__slice_u8 curr,\n    wuffs_base__slice_u8 prev) {}\n\nstatic inline void  //\nwuffs_base__utility__png_filter_3_distance_4_x86_sse42(\n    wuffs_base__slice_u8 curr,\n    wuffs_base__slice_u8 prev) {}\n\nstatic inline void  //\nwuffs_base__utility__png_filter_4_distance_3_x86_sse42(\n    wuffs_base__slice_u8 curr,\n    wuffs_base__slice_u8 prev) {}\n\nstatic inline void  //\nwuffs_base__utility__png_f" +
+	"ilter_4_distance_4_x86_sse42(\n    wuffs_base__slice_u8 curr,\n    wuffs_base__slice_u8 prev) {}\n\n#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)\n" +
 	""
 
 const baseFundamentalPrivateH = "" +
 	"static inline wuffs_base__empty_struct  //\nwuffs_base__ignore_status(wuffs_base__status z) {\n  return wuffs_base__make_empty_struct();\n}\n\n// WUFFS_BASE__MAGIC is a magic number to check that initializers are called.\n// It's not foolproof, given C doesn't automatically zero memory before use,\n// but it should catch 99.99% of cases.\n//\n// Its (non-zero) value is arbitrary, based on md5sum(\"wuffs\").\n#define WUFFS_BASE__MAGIC ((uint32_t)0x3CCB6C71)\n\n// WUFFS_BASE__DISABLED is a magic number to indicate that a non-recoverable\n// error was previously encountered.\n//\n// Its (non-zero) value is arbitrary, based on md5sum(\"disabled\").\n#define WUFFS_BASE__DISABLED ((uint32_t)0x075AE3D2)\n\n// Denote intentional fallthroughs for -Wimplicit-fallthrough.\n//\n// The order matters here. Clang also defines \"__GNUC__\".\n#if defined(__clang__) && defined(__cplusplus) && (__cplusplus >= 201103L)\n#define WUFFS_BASE__FALLTHROUGH [[clang::fallthrough]]\n#elif !defined(__clang__) && defined(__GNUC__) && (__GNUC__ >= 7)\n#define WUFFS_BAS" +
 	"E__FALLTHROUGH __attribute__((fallthrough))\n#else\n#define WUFFS_BASE__FALLTHROUGH\n#endif\n\n// Use switch cases for coroutine suspension points, similar to the technique\n// in https://www.chiark.greenend.org.uk/~sgtatham/coroutines.html\n//\n// We use trivial macros instead of an explicit assignment and case statement\n// so that clang-format doesn't get confused by the unusual \"case\"s.\n#define WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0 case 0:;\n#define WUFFS_BASE__COROUTINE_SUSPENSION_POINT(n) \\\n  coro_susp_point = n;                            \\\n  WUFFS_BASE__FALLTHROUGH;                        \\\n  case n:;\n\n#define WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(n) \\\n  if (!status.repr) {                                           \\\n    goto ok;                                                    \\\n  } else if (*status.repr != '$') {                             \\\n    goto exit;                                                  \\\n  }                                                             \\\n  coro_susp_point" +
-	" = n;                                          \\\n  goto suspend;                                                 \\\n  case n:;\n\n// Clang also defines \"__GNUC__\".\n#if defined(__GNUC__)\n#define WUFFS_BASE__LIKELY(expr) (__builtin_expect(!!(expr), 1))\n#define WUFFS_BASE__UNLIKELY(expr) (__builtin_expect(!!(expr), 0))\n#else\n#define WUFFS_BASE__LIKELY(expr) (expr)\n#define WUFFS_BASE__UNLIKELY(expr) (expr)\n#endif\n\n" +
+	" = n;                                          \\\n  goto suspend;                                                 \\\n  case n:;\n\n// Clang also defines \"__GNUC__\".\n#if defined(__GNUC__)\n#define WUFFS_BASE__LIKELY(expr) (__builtin_expect(!!(expr), 1))\n#define WUFFS_BASE__UNLIKELY(expr) (__builtin_expect(!!(expr), 0))\n#else\n#define WUFFS_BASE__LIKELY(expr) (expr)\n#define WUFFS_BASE__UNLIKELY(expr) (expr)\n#endif\n\n// The WUFFS_BASE__STATS__ETC macros update a wuffs_foo__bar struct's\n// instrumentation counters. Unless WUFFS_CONFIG__ENABLE_STATS is defined,\n// there are no counters and the macros compile to nothing.\n#if defined(WUFFS_CONFIG__ENABLE_STATS)\n#define WUFFS_BASE__STATS__CALL(self, f) \\\n  ((self)->private_impl.stats.funcs[f].num_calls++)\n#define WUFFS_BASE__STATS__WRITTEN(self, f, n) \\\n  ((self)->private_impl.stats.funcs[f].num_written += (uint64_t)(n))\n#define WUFFS_BASE__STATS__SUSPENSION(self, status) \\\n  ((self)->private_impl.stats.num_suspensions +=    \\\n   (wuffs_base__status__is_suspension(status) ?" +
+	" 1 : 0))\n#else\n#define WUFFS_BASE__STATS__CALL(self, f) ((void)0)\n#define WUFFS_BASE__STATS__WRITTEN(self, f, n) ((void)0)\n#define WUFFS_BASE__STATS__SUSPENSION(self, status) ((void)0)\n#endif\n\n" +
 	"" +
 	"// ---------------- Numeric Types\n\nextern const uint8_t wuffs_base__low_bits_mask__u8[9];\nextern const uint16_t wuffs_base__low_bits_mask__u16[17];\nextern const uint32_t wuffs_base__low_bits_mask__u32[33];\nextern const uint64_t wuffs_base__low_bits_mask__u64[65];\n\n#define WUFFS_BASE__LOW_BITS_MASK__U8(n) (wuffs_base__low_bits_mask__u8[n])\n#define WUFFS_BASE__LOW_BITS_MASK__U16(n) (wuffs_base__low_bits_mask__u16[n])\n#define WUFFS_BASE__LOW_BITS_MASK__U32(n) (wuffs_base__low_bits_mask__u32[n])\n#define WUFFS_BASE__LOW_BITS_MASK__U64(n) (wuffs_base__low_bits_mask__u64[n])\n\n" +
 	"" +
@@ -204,7 +431,8 @@ const baseFundamentalPublicH = "" +
 	"00000001)\n\n// WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED means that, absent\n// WUFFS_INITIALIZE__ALREADY_ZEROED, only some of the \"self\" receiver struct\n// value will be set to all zeroes. Internal buffers, which tend to be a large\n// proportion of the struct's size, will be left uninitialized. Internal means\n// that the buffer is contained by the receiver struct, as opposed to being\n// passed as a separately allocated \"work buffer\".\n//\n// For more detail, see:\n// https://github.com/google/wuffs/blob/master/doc/note/initialization.md\n#define WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED \\\n  ((uint32_t)0x00000002)\n\n" +
 	"" +
 	"// --------\n\n// wuffs_base__empty_struct is used when a Wuffs function returns an empty\n// struct. In C, if a function f returns void, you can't say \"x = f()\", but in\n// Wuffs, if a function g returns empty, you can say \"y = g()\".\ntypedef struct {\n  // private_impl is a placeholder field. It isn't explicitly used, except that\n  // without it, the sizeof a struct with no fields can differ across C/C++\n  // compilers, and it is undefined behavior in C99. For example, gcc says that\n  // the sizeof an empty struct is 0, and g++ says that it is 1. This leads to\n  // ABI incompatibility if a Wuffs .c file is processed by one compiler and\n  // its .h file with another compiler.\n  //\n  // Instead, we explicitly insert an otherwise unused field, so that the\n  // sizeof this struct is always 1.\n  uint8_t private_impl;\n} wuffs_base__empty_struct;\n\nstatic inline wuffs_base__empty_struct  //\nwuffs_base__make_empty_struct() {\n  wuffs_base__empty_struct ret;\n  ret.private_impl = 0;\n  return ret;\n}\n\n// wuffs_base__utility is" +
-	" a placeholder receiver type. It enables what Java\n// calls static methods, as opposed to regular methods.\ntypedef struct {\n  // private_impl is a placeholder field. It isn't explicitly used, except that\n  // without it, the sizeof a struct with no fields can differ across C/C++\n  // compilers, and it is undefined behavior in C99. For example, gcc says that\n  // the sizeof an empty struct is 0, and g++ says that it is 1. This leads to\n  // ABI incompatibility if a Wuffs .c file is processed by one compiler and\n  // its .h file with another compiler.\n  //\n  // Instead, we explicitly insert an otherwise unused field, so that the\n  // sizeof this struct is always 1.\n  uint8_t private_impl;\n} wuffs_base__utility;\n\ntypedef struct {\n  const char* vtable_name;\n  const void* function_pointers;\n} wuffs_base__vtable;\n\n" +
+	" a placeholder receiver type. It enables what Java\n// calls static methods, as opposed to regular methods.\ntypedef struct {\n  // private_impl is a placeholder field. It isn't explicitly used, except that\n  // without it, the sizeof a struct with no fields can differ across C/C++\n  // compilers, and it is undefined behavior in C99. For example, gcc says that\n  // the sizeof an empty struct is 0, and g++ says that it is 1. This leads to\n  // ABI incompatibility if a Wuffs .c file is processed by one compiler and\n  // its .h file with another compiler.\n  //\n  // Instead, we explicitly insert an otherwise unused field, so that the\n  // sizeof this struct is always 1.\n  uint8_t private_impl;\n} wuffs_base__utility;\n\ntypedef struct {\n  const char* vtable_name;\n  const void* function_pointers;\n} wuffs_base__vtable;\n\n// wuffs_base__func_stats holds one function's instrumentation counters. They\n// are only updated if WUFFS_CONFIG__ENABLE_STATS is defined, in which case\n// each wuffs_foo__bar struct has a wuffs_foo__bar" +
+	"__get_stats function.\ntypedef struct {\n  // num_calls counts the calls to the function, including each resumption of\n  // a suspended coroutine.\n  uint64_t num_calls;\n  // num_written counts the bytes (or tokens) written to the function's dst\n  // argument, including those written by the functions that it calls. It is\n  // zero if the function has no io_writer (or token_writer) argument.\n  uint64_t num_written;\n} wuffs_base__func_stats;\n\n" +
 	"" +
 	"// --------\n\n// See https://github.com/google/wuffs/blob/master/doc/note/statuses.md\ntypedef struct {\n  const char* repr;\n\n#ifdef __cplusplus\n  inline bool is_complete() const;\n  inline bool is_error() const;\n  inline bool is_note() const;\n  inline bool is_ok() const;\n  inline bool is_suspension() const;\n  inline const char* message() const;\n#endif  // __cplusplus\n\n} wuffs_base__status;\n\n// !! INSERT wuffs_base__status names.\n\nstatic inline wuffs_base__status  //\nwuffs_base__make_status(const char* repr) {\n  wuffs_base__status z;\n  z.repr = repr;\n  return z;\n}\n\nstatic inline bool  //\nwuffs_base__status__is_complete(const wuffs_base__status* z) {\n  return (z->repr == NULL) || ((*z->repr != '$') && (*z->repr != '#'));\n}\n\nstatic inline bool  //\nwuffs_base__status__is_error(const wuffs_base__status* z) {\n  return z->repr && (*z->repr == '#');\n}\n\nstatic inline bool  //\nwuffs_base__status__is_note(const wuffs_base__status* z) {\n  return z->repr && (*z->repr != '$') && (*z->repr != '#');\n}\n\nstatic inline bool  //\nwu" +
 	"ffs_base__status__is_ok(const wuffs_base__status* z) {\n  return z->repr == NULL;\n}\n\nstatic inline bool  //\nwuffs_base__status__is_suspension(const wuffs_base__status* z) {\n  return z->repr && (*z->repr == '$');\n}\n\n// wuffs_base__status__message strips the leading '$', '#' or '@'.\nstatic inline const char*  //\nwuffs_base__status__message(const wuffs_base__status* z) {\n  if (z->repr) {\n    if ((*z->repr == '$') || (*z->repr == '#') || (*z->repr == '@')) {\n      return z->repr + 1;\n    }\n  }\n  return z->repr;\n}\n\n#ifdef __cplusplus\n\ninline bool  //\nwuffs_base__status::is_complete() const {\n  return wuffs_base__status__is_complete(this);\n}\n\ninline bool  //\nwuffs_base__status::is_error() const {\n  return wuffs_base__status__is_error(this);\n}\n\ninline bool  //\nwuffs_base__status::is_note() const {\n  return wuffs_base__status__is_note(this);\n}\n\ninline bool  //\nwuffs_base__status::is_ok() const {\n  return wuffs_base__status__is_ok(this);\n}\n\ninline bool  //\nwuffs_base__status::is_suspension() const {\n  return wuffs_base" +
@@ -260,9 +488,12 @@ const baseImagePrivateH = "" +
 
 const baseImagePublicH = "" +
 	"// ---------------- Images\n\n// wuffs_base__color_u32_argb_premul is an 8 bit per channel premultiplied\n// Alpha, Red, Green, Blue color, as a uint32_t value. Its value is always\n// 0xAARRGGBB (Alpha most significant, Blue least), regardless of endianness.\ntypedef uint32_t wuffs_base__color_u32_argb_premul;\n\nstatic inline uint16_t  //\nwuffs_base__color_u32_argb_premul__as__color_u16_rgb_565(\n    wuffs_base__color_u32_argb_premul c) {\n  uint32_t r5 = 0xF800 & (c >> 8);\n  uint32_t g6 = 0x07E0 & (c >> 5);\n  uint32_t b5 = 0x001F & (c >> 3);\n  return (uint16_t)(r5 | g6 | b5);\n}\n\nstatic inline wuffs_base__color_u32_argb_premul  //\nwuffs_base__color_u16_rgb_565__as__color_u32_argb_premul(uint16_t rgb_565) {\n  uint32_t b5 = 0x1F & (rgb_565 >> 0);\n  uint32_t b = (b5 << 3) | (b5 >> 2);\n  uint32_t g6 = 0x3F & (rgb_565 >> 5);\n  uint32_t g = (g6 << 2) | (g6 >> 4);\n  uint32_t r5 = 0x1F & (rgb_565 >> 11);\n  uint32_t r = (r5 << 3) | (r5 >> 2);\n  return 0xFF000000 | (r << 16) | (g << 8) | (b << 0);\n}\n\nstatic inline uint8_t  //" +
-	"\nwuffs_base__color_u32_argb_premul__as__color_u8_gray(\n    wuffs_base__color_u32_argb_premul c) {\n  // Work in 16-bit color.\n  uint32_t cr = 0x101 * (0xFF & (c >> 16));\n  uint32_t cg = 0x101 * (0xFF & (c >> 8));\n  uint32_t cb = 0x101 * (0xFF & (c >> 0));\n\n  // These coefficients (the fractions 0.299, 0.587 and 0.114) are the same\n  // as those given by the JFIF specification.\n  //\n  // Note that 19595 + 38470 + 7471 equals 65536, also known as (1 << 16). We\n  // shift by 24, not just by 16, because the return value is 8-bit color, not\n  // 16-bit color.\n  uint32_t weighted_average = (19595 * cr) + (38470 * cg) + (7471 * cb) + 32768;\n  return (uint8_t)(weighted_average >> 24);\n}\n\n// wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul converts\n// from non-premultiplied alpha to premultiplied alpha.\nstatic inline wuffs_base__color_u32_argb_premul  //\nwuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(\n    uint32_t argb_nonpremul) {\n  // Multiplying by 0x101 (twice, once for alpha and onc" +
-	"e for color) converts\n  // from 8-bit to 16-bit color. Shifting right by 8 undoes that.\n  //\n  // Working in the higher bit depth can produce slightly different (and\n  // arguably slightly more accurate) results. For example, given 8-bit blue\n  // and alpha of 0x80 and 0x81:\n  //\n  //  - ((0x80   * 0x81  ) / 0xFF  )      = 0x40        = 0x40\n  //  - ((0x8080 * 0x8181) / 0xFFFF) >> 8 = 0x4101 >> 8 = 0x41\n  uint32_t a = 0xFF & (argb_nonpremul >> 24);\n  uint32_t a16 = a * (0x101 * 0x101);\n\n  uint32_t r = 0xFF & (argb_nonpremul >> 16);\n  r = ((r * a16) / 0xFFFF) >> 8;\n  uint32_t g = 0xFF & (argb_nonpremul >> 8);\n  g = ((g * a16) / 0xFFFF) >> 8;\n  uint32_t b = 0xFF & (argb_nonpremul >> 0);\n  b = ((b * a16) / 0xFFFF) >> 8;\n\n  return (a << 24) | (r << 16) | (g << 8) | (b << 0);\n}\n\n// wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul converts\n// from premultiplied alpha to non-premultiplied alpha.\nstatic inline uint32_t  //\nwuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(\n    wuffs_base_" +
-	"_color_u32_argb_premul c) {\n  uint32_t a = 0xFF & (c >> 24);\n  if (a == 0xFF) {\n    return c;\n  } else if (a == 0) {\n    return 0;\n  }\n  uint32_t a16 = a * 0x101;\n\n  uint32_t r = 0xFF & (c >> 16);\n  r = ((r * (0x101 * 0xFFFF)) / a16) >> 8;\n  uint32_t g = 0xFF & (c >> 8);\n  g = ((g * (0x101 * 0xFFFF)) / a16) >> 8;\n  uint32_t b = 0xFF & (c >> 0);\n  b = ((b * (0x101 * 0xFFFF)) / a16) >> 8;\n\n  return (a << 24) | (r << 16) | (g << 8) | (b << 0);\n}\n\n" +
+	"\nwuffs_base__color_u32_argb_premul__as__color_u8_gray(\n    wuffs_base__color_u32_argb_premul c) {\n  // Work in 16-bit color.\n  uint32_t cr = 0x101 * (0xFF & (c >> 16));\n  uint32_t cg = 0x101 * (0xFF & (c >> 8));\n  uint32_t cb = 0x101 * (0xFF & (c >> 0));\n\n  // These coefficients (the fractions 0.299, 0.587 and 0.114) are the same\n  // as those given by the JFIF specification.\n  //\n  // Note that 19595 + 38470 + 7471 equals 65536, also known as (1 << 16). We\n  // shift by 24, not just by 16, because the return value is 8-bit color, not\n  // 16-bit color.\n  uint32_t weighted_average = (19595 * cr) + (38470 * cg) + (7471 * cb) + 32768;\n  return (uint8_t)(weighted_average >> 24);\n}\n\n// wuffs_base__color_ycc__as__color_u32_argb_premul converts from 8-bit YCbCr\n// (luma, chroma-blue, chroma-red) to opaque 8-bit RGB. The coefficients are\n// those given by the JFIF specification, for full range (0 ..= 255) luma.\nstatic inline wuffs_base__color_u32_argb_premul  //\nwuffs_base__color_ycc__as__color_u32_argb_premul(uint8" +
+	"_t yy,\n                                                 uint8_t cb,\n                                                 uint8_t cr) {\n  // The fractional parts of the coefficients (1.402, 0.344136, 0.714136 and\n  // 1.772) are scaled by (1 << 15) and each product is rounded separately,\n  // mimicking the x86 SIMD _mm_mulhrs_epi16 instruction, so that the SIMD and\n  // non-SIMD swizzlers produce the same output. Adding 0x40000000 (and\n  // subtracting 0x8000 after the shift) keeps the right shift's operand\n  // non-negative, as right-shifting a negative int32_t is implementation\n  // defined.\n  int32_t y1 = (int32_t)yy;\n  int32_t b1 = ((int32_t)cb) - 128;\n  int32_t r1 = ((int32_t)cr) - 128;\n  int32_t r = y1 + r1 + ((((r1 * +13173) + 0x40004000) >> 15) - 0x8000);\n  int32_t g = y1 + ((((b1 * -11277) + 0x40004000) >> 15) - 0x8000) +\n              ((((r1 * -23401) + 0x40004000) >> 15) - 0x8000);\n  int32_t b = y1 + b1 + ((((b1 * +25297) + 0x40004000) >> 15) - 0x8000);\n  r = (r < 0) ? 0 : ((r > 255) ? 255 : r);\n  g = (" +
+	"g < 0) ? 0 : ((g > 255) ? 255 : g);\n  b = (b < 0) ? 0 : ((b > 255) ? 255 : b);\n  return 0xFF000000 | (((uint32_t)r) << 16) | (((uint32_t)g) << 8) |\n         (((uint32_t)b) << 0);\n}\n\n// wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul converts\n// from non-premultiplied alpha to premultiplied alpha.\nstatic inline wuffs_base__color_u32_argb_premul  //\nwuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul(\n    uint32_t argb_nonpremul) {\n  // Multiplying by 0x101 (twice, once for alpha and once for color) converts\n  // from 8-bit to 16-bit color. Shifting right by 8 undoes that.\n  //\n  // Working in the higher bit depth can produce slightly different (and\n  // arguably slightly more accurate) results. For example, given 8-bit blue\n  // and alpha of 0x80 and 0x81:\n  //\n  //  - ((0x80   * 0x81  ) / 0xFF  )      = 0x40        = 0x40\n  //  - ((0x8080 * 0x8181) / 0xFFFF) >> 8 = 0x4101 >> 8 = 0x41\n  uint32_t a = 0xFF & (argb_nonpremul >> 24);\n  uint32_t a16 = a * (0x101 * 0x101);\n\n  uint32_t r =" +
+	" 0xFF & (argb_nonpremul >> 16);\n  r = ((r * a16) / 0xFFFF) >> 8;\n  uint32_t g = 0xFF & (argb_nonpremul >> 8);\n  g = ((g * a16) / 0xFFFF) >> 8;\n  uint32_t b = 0xFF & (argb_nonpremul >> 0);\n  b = ((b * a16) / 0xFFFF) >> 8;\n\n  return (a << 24) | (r << 16) | (g << 8) | (b << 0);\n}\n\n// wuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul converts\n// from premultiplied alpha to non-premultiplied alpha.\nstatic inline uint32_t  //\nwuffs_base__color_u32_argb_premul__as__color_u32_argb_nonpremul(\n    wuffs_base__color_u32_argb_premul c) {\n  uint32_t a = 0xFF & (c >> 24);\n  if (a == 0xFF) {\n    return c;\n  } else if (a == 0) {\n    return 0;\n  }\n  uint32_t a16 = a * 0x101;\n\n  uint32_t r = 0xFF & (c >> 16);\n  r = ((r * (0x101 * 0xFFFF)) / a16) >> 8;\n  uint32_t g = 0xFF & (c >> 8);\n  g = ((g * (0x101 * 0xFFFF)) / a16) >> 8;\n  uint32_t b = 0xFF & (c >> 0);\n  b = ((b * (0x101 * 0xFFFF)) / a16) >> 8;\n\n  return (a << 24) | (r << 16) | (g << 8) | (b << 0);\n}\n\n// wuffs_base__color_u32__as__color_u64 converts from 8-bi" +
+	"t to 16-bit color,\n// with the same alpha premultiplication (or lack of it). Each 16-bit channel\n// in the uint64_t result is at four times the bit offset of the corresponding\n// 8-bit channel in the uint32_t argument.\nstatic inline uint64_t  //\nwuffs_base__color_u32__as__color_u64(uint32_t c) {\n  uint64_t a = 0x101 * (0xFF & (c >> 24));\n  uint64_t r = 0x101 * (0xFF & (c >> 16));\n  uint64_t g = 0x101 * (0xFF & (c >> 8));\n  uint64_t b = 0x101 * (0xFF & (c >> 0));\n  return (a << 48) | (r << 32) | (g << 16) | (b << 0);\n}\n\n// wuffs_base__color_u64__as__color_u32 converts from 16-bit to 8-bit color,\n// with the same alpha premultiplication (or lack of it).\nstatic inline uint32_t  //\nwuffs_base__color_u64__as__color_u32(uint64_t c) {\n  uint32_t a = ((uint32_t)(0xFF & (c >> 56)));\n  uint32_t r = ((uint32_t)(0xFF & (c >> 40)));\n  uint32_t g = ((uint32_t)(0xFF & (c >> 24)));\n  uint32_t b = ((uint32_t)(0xFF & (c >> 8)));\n  return (a << 24) | (r << 16) | (g << 8) | (b << 0);\n}\n\n// wuffs_base__color_u32_argb_nonpremul__a" +
+	"s__color_u64_argb_premul converts\n// from 8-bit non-premultiplied alpha to 16-bit premultiplied alpha, without\n// the intermediate rounding to 8 bits that\n// wuffs_base__color_u32_argb_nonpremul__as__color_u32_argb_premul does.\nstatic inline uint64_t  //\nwuffs_base__color_u32_argb_nonpremul__as__color_u64_argb_premul(\n    uint32_t argb_nonpremul) {\n  uint32_t a = 0xFF & (argb_nonpremul >> 24);\n  uint32_t a16 = a * (0x101 * 0x101);\n\n  uint32_t r = 0xFF & (argb_nonpremul >> 16);\n  r = (r * a16) / 0xFFFF;\n  uint32_t g = 0xFF & (argb_nonpremul >> 8);\n  g = (g * a16) / 0xFFFF;\n  uint32_t b = 0xFF & (argb_nonpremul >> 0);\n  b = (b * a16) / 0xFFFF;\n\n  return (((uint64_t)(a * 0x101)) << 48) | (((uint64_t)r) << 32) |\n         (((uint64_t)g) << 16) | (((uint64_t)b) << 0);\n}\n\n" +
 	"" +
 	"// --------\n\ntypedef uint8_t wuffs_base__pixel_blend;\n\n// wuffs_base__pixel_blend encodes how to blend source and destination pixels,\n// accounting for transparency. It encompasses the Porter-Duff compositing\n// operators as well as the other blending modes defined by PDF.\n//\n// TODO: implement the other modes.\n#define WUFFS_BASE__PIXEL_BLEND__SRC ((wuffs_base__pixel_blend)0)\n#define WUFFS_BASE__PIXEL_BLEND__SRC_OVER ((wuffs_base__pixel_blend)1)\n\n" +
 	"" +
@@ -270,10 +501,10 @@ const baseImagePublicH = "" +
 	"" +
 	"// --------\n\n#define WUFFS_BASE__PIXEL_FORMAT__NUM_PLANES_MAX 4\n\n#define WUFFS_BASE__PIXEL_FORMAT__INDEXED__INDEX_PLANE 0\n#define WUFFS_BASE__PIXEL_FORMAT__INDEXED__COLOR_PLANE 3\n\n// wuffs_base__pixel_format encodes the format of the bytes that constitute an\n// image frame's pixel data.\n//\n// See https://github.com/google/wuffs/blob/master/doc/note/pixel-formats.md\n//\n// Do not manipulate its bits directly; they are private implementation\n// details. Use methods such as wuffs_base__pixel_format__num_planes instead.\ntypedef struct {\n  uint32_t repr;\n\n#ifdef __cplusplus\n  inline bool is_valid() const;\n  inline uint32_t bits_per_pixel() const;\n  inline bool is_direct() const;\n  inline bool is_indexed() const;\n  inline bool is_interleaved() const;\n  inline bool is_planar() const;\n  inline uint32_t num_planes() const;\n  inline wuffs_base__pixel_alpha_transparency transparency() const;\n#endif  // __cplusplus\n\n} wuffs_base__pixel_format;\n\nstatic inline wuffs_base__pixel_format  //\nwuffs_base__make_pixel_format(uint3" +
 	"2_t repr) {\n  wuffs_base__pixel_format f;\n  f.repr = repr;\n  return f;\n}\n\n  // Common 8-bit-depth pixel formats. This list is not exhaustive; not all\n  // valid wuffs_base__pixel_format values are present.\n\n#define WUFFS_BASE__PIXEL_FORMAT__INVALID 0x00000000\n\n#define WUFFS_BASE__PIXEL_FORMAT__A 0x02000008\n\n#define WUFFS_BASE__PIXEL_FORMAT__Y 0x20000008\n#define WUFFS_BASE__PIXEL_FORMAT__YA_NONPREMUL 0x21000008\n#define WUFFS_BASE__PIXEL_FORMAT__YA_PREMUL 0x22000008\n\n#define WUFFS_BASE__PIXEL_FORMAT__YCBCR 0x40020888\n#define WUFFS_BASE__PIXEL_FORMAT__YCBCRA_NONPREMUL 0x41038888\n#define WUFFS_BASE__PIXEL_FORMAT__YCBCRK 0x50038888\n\n#define WUFFS_BASE__PIXEL_FORMAT__YCOCG 0x60020888\n#define WUFFS_BASE__PIXEL_FORMAT__YCOCGA_NONPREMUL 0x61038888\n#define WUFFS_BASE__PIXEL_FORMAT__YCOCGK 0x70038888\n\n#define WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL 0x81040008\n#define WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL 0x82040008\n#define WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY 0x83040008\n\n#define WUFFS_BASE__" +
-	"PIXEL_FORMAT__BGR_565 0x80000565\n#define WUFFS_BASE__PIXEL_FORMAT__BGR 0x80000888\n#define WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL 0x81008888\n#define WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL 0x82008888\n#define WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY 0x83008888\n#define WUFFS_BASE__PIXEL_FORMAT__BGRX 0x90008888\n\n#define WUFFS_BASE__PIXEL_FORMAT__RGB 0xA0000888\n#define WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL 0xA1008888\n#define WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL 0xA2008888\n#define WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY 0xA3008888\n#define WUFFS_BASE__PIXEL_FORMAT__RGBX 0xB0008888\n\n#define WUFFS_BASE__PIXEL_FORMAT__CMY 0xC0020888\n#define WUFFS_BASE__PIXEL_FORMAT__CMYK 0xD0038888\n\nextern const uint32_t wuffs_base__pixel_format__bits_per_channel[16];\n\nstatic inline bool  //\nwuffs_base__pixel_format__is_valid(const wuffs_base__pixel_format* f) {\n  return f->repr != 0;\n}\n\n// wuffs_base__pixel_format__bits_per_pixel returns the number of bits per\n// pixel for interleaved pixel formats, and returns 0 for planar pixel forma" +
-	"ts.\nstatic inline uint32_t  //\nwuffs_base__pixel_format__bits_per_pixel(const wuffs_base__pixel_format* f) {\n  if (((f->repr >> 16) & 0x03) != 0) {\n    return 0;\n  }\n  return wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 0)] +\n         wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 4)] +\n         wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 8)] +\n         wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 12)];\n}\n\nstatic inline bool  //\nwuffs_base__pixel_format__is_direct(const wuffs_base__pixel_format* f) {\n  return ((f->repr >> 18) & 0x01) == 0;\n}\n\nstatic inline bool  //\nwuffs_base__pixel_format__is_indexed(const wuffs_base__pixel_format* f) {\n  return ((f->repr >> 18) & 0x01) != 0;\n}\n\nstatic inline bool  //\nwuffs_base__pixel_format__is_interleaved(const wuffs_base__pixel_format* f) {\n  return ((f->repr >> 16) & 0x03) == 0;\n}\n\nstatic inline bool  //\nwuffs_base__pixel_format__is_planar(const wuffs_base__pixel_format* f) {\n  return ((f->repr >> 16) & " +
-	"0x03) != 0;\n}\n\nstatic inline uint32_t  //\nwuffs_base__pixel_format__num_planes(const wuffs_base__pixel_format* f) {\n  return ((f->repr >> 16) & 0x03) + 1;\n}\n\nstatic inline wuffs_base__pixel_alpha_transparency  //\nwuffs_base__pixel_format__transparency(const wuffs_base__pixel_format* f) {\n  return (wuffs_base__pixel_alpha_transparency)((f->repr >> 24) & 0x03);\n}\n\n#ifdef __cplusplus\n\ninline bool  //\nwuffs_base__pixel_format::is_valid() const {\n  return wuffs_base__pixel_format__is_valid(this);\n}\n\ninline uint32_t  //\nwuffs_base__pixel_format::bits_per_pixel() const {\n  return wuffs_base__pixel_format__bits_per_pixel(this);\n}\n\ninline bool  //\nwuffs_base__pixel_format::is_direct() const {\n  return wuffs_base__pixel_format__is_direct(this);\n}\n\ninline bool  //\nwuffs_base__pixel_format::is_indexed() const {\n  return wuffs_base__pixel_format__is_indexed(this);\n}\n\ninline bool  //\nwuffs_base__pixel_format::is_interleaved() const {\n  return wuffs_base__pixel_format__is_interleaved(this);\n}\n\ninline bool  //\nwuffs_base__pi" +
-	"xel_format::is_planar() const {\n  return wuffs_base__pixel_format__is_planar(this);\n}\n\ninline uint32_t  //\nwuffs_base__pixel_format::num_planes() const {\n  return wuffs_base__pixel_format__num_planes(this);\n}\n\ninline wuffs_base__pixel_alpha_transparency  //\nwuffs_base__pixel_format::transparency() const {\n  return wuffs_base__pixel_format__transparency(this);\n}\n\n#endif  // __cplusplus\n\n" +
+	"PIXEL_FORMAT__BGR_565 0x80000565\n#define WUFFS_BASE__PIXEL_FORMAT__BGR 0x80000888\n#define WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL 0x81008888\n#define WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL 0x82008888\n#define WUFFS_BASE__PIXEL_FORMAT__BGRA_BINARY 0x83008888\n#define WUFFS_BASE__PIXEL_FORMAT__BGRX 0x90008888\n\n#define WUFFS_BASE__PIXEL_FORMAT__RGB 0xA0000888\n#define WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL 0xA1008888\n#define WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL 0xA2008888\n#define WUFFS_BASE__PIXEL_FORMAT__RGBA_BINARY 0xA3008888\n#define WUFFS_BASE__PIXEL_FORMAT__RGBX 0xB0008888\n\n#define WUFFS_BASE__PIXEL_FORMAT__CMY 0xC0020888\n#define WUFFS_BASE__PIXEL_FORMAT__CMYK 0xD0038888\n\n  // Common 16-bit-depth pixel formats, whose channels are each a little-endian\n  // uint16_t. Like the 8-bit-depth formats, the channels are listed in memory\n  // order: BGRA means that blue is at the lowest address.\n\n#define WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE 0x8100BBBB\n#define WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE 0x82" +
+	"00BBBB\n\n#define WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL_4X16LE 0xA100BBBB\n#define WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE 0xA200BBBB\n\nextern const uint32_t wuffs_base__pixel_format__bits_per_channel[16];\n\nstatic inline bool  //\nwuffs_base__pixel_format__is_valid(const wuffs_base__pixel_format* f) {\n  return f->repr != 0;\n}\n\n// wuffs_base__pixel_format__bits_per_pixel returns the number of bits per\n// pixel for interleaved pixel formats, and returns 0 for planar pixel formats.\nstatic inline uint32_t  //\nwuffs_base__pixel_format__bits_per_pixel(const wuffs_base__pixel_format* f) {\n  if (((f->repr >> 16) & 0x03) != 0) {\n    return 0;\n  }\n  return wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 0)] +\n         wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 4)] +\n         wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 8)] +\n         wuffs_base__pixel_format__bits_per_channel[0x0F & (f->repr >> 12)];\n}\n\nstatic inline bool  //\nwuffs_base__pixel_format__is_direct(const" +
+	" wuffs_base__pixel_format* f) {\n  return ((f->repr >> 18) & 0x01) == 0;\n}\n\nstatic inline bool  //\nwuffs_base__pixel_format__is_indexed(const wuffs_base__pixel_format* f) {\n  return ((f->repr >> 18) & 0x01) != 0;\n}\n\nstatic inline bool  //\nwuffs_base__pixel_format__is_interleaved(const wuffs_base__pixel_format* f) {\n  return ((f->repr >> 16) & 0x03) == 0;\n}\n\nstatic inline bool  //\nwuffs_base__pixel_format__is_planar(const wuffs_base__pixel_format* f) {\n  return ((f->repr >> 16) & 0x03) != 0;\n}\n\nstatic inline uint32_t  //\nwuffs_base__pixel_format__num_planes(const wuffs_base__pixel_format* f) {\n  return ((f->repr >> 16) & 0x03) + 1;\n}\n\nstatic inline wuffs_base__pixel_alpha_transparency  //\nwuffs_base__pixel_format__transparency(const wuffs_base__pixel_format* f) {\n  return (wuffs_base__pixel_alpha_transparency)((f->repr >> 24) & 0x03);\n}\n\n#ifdef __cplusplus\n\ninline bool  //\nwuffs_base__pixel_format::is_valid() const {\n  return wuffs_base__pixel_format__is_valid(this);\n}\n\ninline uint32_t  //\nwuffs_base__pixel_for" +
+	"mat::bits_per_pixel() const {\n  return wuffs_base__pixel_format__bits_per_pixel(this);\n}\n\ninline bool  //\nwuffs_base__pixel_format::is_direct() const {\n  return wuffs_base__pixel_format__is_direct(this);\n}\n\ninline bool  //\nwuffs_base__pixel_format::is_indexed() const {\n  return wuffs_base__pixel_format__is_indexed(this);\n}\n\ninline bool  //\nwuffs_base__pixel_format::is_interleaved() const {\n  return wuffs_base__pixel_format__is_interleaved(this);\n}\n\ninline bool  //\nwuffs_base__pixel_format::is_planar() const {\n  return wuffs_base__pixel_format__is_planar(this);\n}\n\ninline uint32_t  //\nwuffs_base__pixel_format::num_planes() const {\n  return wuffs_base__pixel_format__num_planes(this);\n}\n\ninline wuffs_base__pixel_alpha_transparency  //\nwuffs_base__pixel_format::transparency() const {\n  return wuffs_base__pixel_format__transparency(this);\n}\n\n#endif  // __cplusplus\n\n" +
 	"" +
 	"// --------\n\n// wuffs_base__pixel_subsampling encodes whether sample values cover one pixel\n// or cover multiple pixels.\n//\n// See https://github.com/google/wuffs/blob/master/doc/note/pixel-subsampling.md\n//\n// Do not manipulate its bits directly; they are private implementation\n// details. Use methods such as wuffs_base__pixel_subsampling__bias_x instead.\ntypedef struct {\n  uint32_t repr;\n\n#ifdef __cplusplus\n  inline uint32_t bias_x(uint32_t plane) const;\n  inline uint32_t denominator_x(uint32_t plane) const;\n  inline uint32_t bias_y(uint32_t plane) const;\n  inline uint32_t denominator_y(uint32_t plane) const;\n#endif  // __cplusplus\n\n} wuffs_base__pixel_subsampling;\n\nstatic inline wuffs_base__pixel_subsampling  //\nwuffs_base__make_pixel_subsampling(uint32_t repr) {\n  wuffs_base__pixel_subsampling s;\n  s.repr = repr;\n  return s;\n}\n\n#define WUFFS_BASE__PIXEL_SUBSAMPLING__NONE 0x00000000\n\n#define WUFFS_BASE__PIXEL_SUBSAMPLING__444 0x000000\n#define WUFFS_BASE__PIXEL_SUBSAMPLING__440 0x010100\n#define WUFFS_BASE__" +
 	"PIXEL_SUBSAMPLING__422 0x101000\n#define WUFFS_BASE__PIXEL_SUBSAMPLING__420 0x111100\n#define WUFFS_BASE__PIXEL_SUBSAMPLING__411 0x303000\n#define WUFFS_BASE__PIXEL_SUBSAMPLING__410 0x313100\n\nstatic inline uint32_t  //\nwuffs_base__pixel_subsampling__bias_x(const wuffs_base__pixel_subsampling* s,\n                                      uint32_t plane) {\n  uint32_t shift = ((plane & 0x03) * 8) + 6;\n  return (s->repr >> shift) & 0x03;\n}\n\nstatic inline uint32_t  //\nwuffs_base__pixel_subsampling__denominator_x(\n    const wuffs_base__pixel_subsampling* s,\n    uint32_t plane) {\n  uint32_t shift = ((plane & 0x03) * 8) + 4;\n  return ((s->repr >> shift) & 0x03) + 1;\n}\n\nstatic inline uint32_t  //\nwuffs_base__pixel_subsampling__bias_y(const wuffs_base__pixel_subsampling* s,\n                                      uint32_t plane) {\n  uint32_t shift = ((plane & 0x03) * 8) + 2;\n  return (s->repr >> shift) & 0x03;\n}\n\nstatic inline uint32_t  //\nwuffs_base__pixel_subsampling__denominator_y(\n    const wuffs_base__pixel_subsampling* s," +
@@ -282,9 +513,10 @@ const baseImagePublicH = "" +
 	"// --------\n\ntypedef struct {\n  // Do not access the private_impl's fields directly. There is no API/ABI\n  // compatibility or safety guarantee if you do so.\n  struct {\n    wuffs_base__pixel_format pixfmt;\n    wuffs_base__pixel_subsampling pixsub;\n    uint32_t width;\n    uint32_t height;\n  } private_impl;\n\n#ifdef __cplusplus\n  inline void set(uint32_t pixfmt_repr,\n                  uint32_t pixsub_repr,\n                  uint32_t width,\n                  uint32_t height);\n  inline void invalidate();\n  inline bool is_valid() const;\n  inline wuffs_base__pixel_format pixel_format() const;\n  inline wuffs_base__pixel_subsampling pixel_subsampling() const;\n  inline wuffs_base__rect_ie_u32 bounds() const;\n  inline uint32_t width() const;\n  inline uint32_t height() const;\n  inline uint64_t pixbuf_len() const;\n#endif  // __cplusplus\n\n} wuffs_base__pixel_config;\n\nstatic inline wuffs_base__pixel_config  //\nwuffs_base__null_pixel_config() {\n  wuffs_base__pixel_config ret;\n  ret.private_impl.pixfmt.repr = 0;\n  ret.private" +
 	"_impl.pixsub.repr = 0;\n  ret.private_impl.width = 0;\n  ret.private_impl.height = 0;\n  return ret;\n}\n\n// TODO: Should this function return bool? An error type?\nstatic inline void  //\nwuffs_base__pixel_config__set(wuffs_base__pixel_config* c,\n                              uint32_t pixfmt_repr,\n                              uint32_t pixsub_repr,\n                              uint32_t width,\n                              uint32_t height) {\n  if (!c) {\n    return;\n  }\n  if (pixfmt_repr) {\n    uint64_t wh = ((uint64_t)width) * ((uint64_t)height);\n    // TODO: handle things other than 1 byte per pixel.\n    if (wh <= ((uint64_t)SIZE_MAX)) {\n      c->private_impl.pixfmt.repr = pixfmt_repr;\n      c->private_impl.pixsub.repr = pixsub_repr;\n      c->private_impl.width = width;\n      c->private_impl.height = height;\n      return;\n    }\n  }\n\n  c->private_impl.pixfmt.repr = 0;\n  c->private_impl.pixsub.repr = 0;\n  c->private_impl.width = 0;\n  c->private_impl.height = 0;\n}\n\nstatic inline void  //\nwuffs_base__pixel_config__inv" +
 	"alidate(wuffs_base__pixel_config* c) {\n  if (c) {\n    c->private_impl.pixfmt.repr = 0;\n    c->private_impl.pixsub.repr = 0;\n    c->private_impl.width = 0;\n    c->private_impl.height = 0;\n  }\n}\n\nstatic inline bool  //\nwuffs_base__pixel_config__is_valid(const wuffs_base__pixel_config* c) {\n  return c && c->private_impl.pixfmt.repr;\n}\n\nstatic inline wuffs_base__pixel_format  //\nwuffs_base__pixel_config__pixel_format(const wuffs_base__pixel_config* c) {\n  return c ? c->private_impl.pixfmt : wuffs_base__make_pixel_format(0);\n}\n\nstatic inline wuffs_base__pixel_subsampling  //\nwuffs_base__pixel_config__pixel_subsampling(const wuffs_base__pixel_config* c) {\n  return c ? c->private_impl.pixsub : wuffs_base__make_pixel_subsampling(0);\n}\n\nstatic inline wuffs_base__rect_ie_u32  //\nwuffs_base__pixel_config__bounds(const wuffs_base__pixel_config* c) {\n  if (c) {\n    wuffs_base__rect_ie_u32 ret;\n    ret.min_incl_x = 0;\n    ret.min_incl_y = 0;\n    ret.max_excl_x = c->private_impl.width;\n    ret.max_excl_y = c->private_impl.h" +
-	"eight;\n    return ret;\n  }\n\n  wuffs_base__rect_ie_u32 ret;\n  ret.min_incl_x = 0;\n  ret.min_incl_y = 0;\n  ret.max_excl_x = 0;\n  ret.max_excl_y = 0;\n  return ret;\n}\n\nstatic inline uint32_t  //\nwuffs_base__pixel_config__width(const wuffs_base__pixel_config* c) {\n  return c ? c->private_impl.width : 0;\n}\n\nstatic inline uint32_t  //\nwuffs_base__pixel_config__height(const wuffs_base__pixel_config* c) {\n  return c ? c->private_impl.height : 0;\n}\n\n// TODO: this is the right API for planar (not interleaved) pixbufs? Should it\n// allow decoding into a color model different from the format's intrinsic one?\n// For example, decoding a JPEG image straight to RGBA instead of to YCbCr?\nstatic inline uint64_t  //\nwuffs_base__pixel_config__pixbuf_len(const wuffs_base__pixel_config* c) {\n  if (!c) {\n    return 0;\n  }\n  if (wuffs_base__pixel_format__is_planar(&c->private_impl.pixfmt)) {\n    // TODO: support planar pixel formats, concious of pixel subsampling.\n    return 0;\n  }\n  uint32_t bits_per_pixel =\n      wuffs_base__pixel_" +
-	"format__bits_per_pixel(&c->private_impl.pixfmt);\n  if ((bits_per_pixel == 0) || ((bits_per_pixel % 8) != 0)) {\n    // TODO: support fraction-of-byte pixels, e.g. 1 bit per pixel?\n    return 0;\n  }\n  uint64_t bytes_per_pixel = bits_per_pixel / 8;\n\n  uint64_t n =\n      ((uint64_t)c->private_impl.width) * ((uint64_t)c->private_impl.height);\n  if (n > (UINT64_MAX / bytes_per_pixel)) {\n    return 0;\n  }\n  n *= bytes_per_pixel;\n\n  if (wuffs_base__pixel_format__is_indexed(&c->private_impl.pixfmt)) {\n    if (n > (UINT64_MAX - 1024)) {\n      return 0;\n    }\n    n += 1024;\n  }\n\n  return n;\n}\n\n#ifdef __cplusplus\n\ninline void  //\nwuffs_base__pixel_config::set(uint32_t pixfmt_repr,\n                              uint32_t pixsub_repr,\n                              uint32_t width,\n                              uint32_t height) {\n  wuffs_base__pixel_config__set(this, pixfmt_repr, pixsub_repr, width, height);\n}\n\ninline void  //\nwuffs_base__pixel_config::invalidate() {\n  wuffs_base__pixel_config__invalidate(this);\n}\n\ninline boo" +
-	"l  //\nwuffs_base__pixel_config::is_valid() const {\n  return wuffs_base__pixel_config__is_valid(this);\n}\n\ninline wuffs_base__pixel_format  //\nwuffs_base__pixel_config::pixel_format() const {\n  return wuffs_base__pixel_config__pixel_format(this);\n}\n\ninline wuffs_base__pixel_subsampling  //\nwuffs_base__pixel_config::pixel_subsampling() const {\n  return wuffs_base__pixel_config__pixel_subsampling(this);\n}\n\ninline wuffs_base__rect_ie_u32  //\nwuffs_base__pixel_config::bounds() const {\n  return wuffs_base__pixel_config__bounds(this);\n}\n\ninline uint32_t  //\nwuffs_base__pixel_config::width() const {\n  return wuffs_base__pixel_config__width(this);\n}\n\ninline uint32_t  //\nwuffs_base__pixel_config::height() const {\n  return wuffs_base__pixel_config__height(this);\n}\n\ninline uint64_t  //\nwuffs_base__pixel_config::pixbuf_len() const {\n  return wuffs_base__pixel_config__pixbuf_len(this);\n}\n\n#endif  // __cplusplus\n\n" +
+	"eight;\n    return ret;\n  }\n\n  wuffs_base__rect_ie_u32 ret;\n  ret.min_incl_x = 0;\n  ret.min_incl_y = 0;\n  ret.max_excl_x = 0;\n  ret.max_excl_y = 0;\n  return ret;\n}\n\nstatic inline uint32_t  //\nwuffs_base__pixel_config__width(const wuffs_base__pixel_config* c) {\n  return c ? c->private_impl.width : 0;\n}\n\nstatic inline uint32_t  //\nwuffs_base__pixel_config__height(const wuffs_base__pixel_config* c) {\n  return c ? c->private_impl.height : 0;\n}\n\n// TODO: this is the right API for planar (not interleaved) pixbufs? Should it\n// allow decoding into a color model different from the format's intrinsic one?\n// For example, decoding a JPEG image straight to RGBA instead of to YCbCr?\nstatic inline uint64_t  //\nwuffs_base__pixel_config__pixbuf_len(const wuffs_base__pixel_config* c) {\n  if (!c) {\n    return 0;\n  }\n  if (wuffs_base__pixel_format__is_planar(&c->private_impl.pixfmt)) {\n    // Each plane holds one 8-bit channel, with one sample per macropixel.\n    // The planes are laid out one after the other.\n    uint64_t n = " +
+	"0;\n    uint32_t num_planes =\n        wuffs_base__pixel_format__num_planes(&c->private_impl.pixfmt);\n    uint32_t p;\n    for (p = 0; p < num_planes; p++) {\n      if (((c->private_impl.pixfmt.repr >> (4 * p)) & 0x0F) != 0x08) {\n        // TODO: support other bit depths and multi-channel planes.\n        return 0;\n      }\n      uint64_t dx = wuffs_base__pixel_subsampling__denominator_x(\n          &c->private_impl.pixsub, p);\n      uint64_t dy = wuffs_base__pixel_subsampling__denominator_y(\n          &c->private_impl.pixsub, p);\n      uint64_t w =\n          (((uint64_t)c->private_impl.width) +\n           wuffs_base__pixel_subsampling__bias_x(&c->private_impl.pixsub, p) +\n           dx - 1) /\n          dx;\n      uint64_t h =\n          (((uint64_t)c->private_impl.height) +\n           wuffs_base__pixel_subsampling__bias_y(&c->private_impl.pixsub, p) +\n           dy - 1) /\n          dy;\n      n += w * h;\n    }\n    return n;\n  }\n  uint32_t bits_per_pixel =\n      wuffs_base__pixel_format__bits_per_pixel(&c->private_impl" +
+	".pixfmt);\n  if ((bits_per_pixel == 0) || ((bits_per_pixel % 8) != 0)) {\n    // TODO: support fraction-of-byte pixels, e.g. 1 bit per pixel?\n    return 0;\n  }\n  uint64_t bytes_per_pixel = bits_per_pixel / 8;\n\n  uint64_t n =\n      ((uint64_t)c->private_impl.width) * ((uint64_t)c->private_impl.height);\n  if (n > (UINT64_MAX / bytes_per_pixel)) {\n    return 0;\n  }\n  n *= bytes_per_pixel;\n\n  if (wuffs_base__pixel_format__is_indexed(&c->private_impl.pixfmt)) {\n    if (n > (UINT64_MAX - 1024)) {\n      return 0;\n    }\n    n += 1024;\n  }\n\n  return n;\n}\n\n#ifdef __cplusplus\n\ninline void  //\nwuffs_base__pixel_config::set(uint32_t pixfmt_repr,\n                              uint32_t pixsub_repr,\n                              uint32_t width,\n                              uint32_t height) {\n  wuffs_base__pixel_config__set(this, pixfmt_repr, pixsub_repr, width, height);\n}\n\ninline void  //\nwuffs_base__pixel_config::invalidate() {\n  wuffs_base__pixel_config__invalidate(this);\n}\n\ninline bool  //\nwuffs_base__pixel_config::is_vali" +
+	"d() const {\n  return wuffs_base__pixel_config__is_valid(this);\n}\n\ninline wuffs_base__pixel_format  //\nwuffs_base__pixel_config::pixel_format() const {\n  return wuffs_base__pixel_config__pixel_format(this);\n}\n\ninline wuffs_base__pixel_subsampling  //\nwuffs_base__pixel_config::pixel_subsampling() const {\n  return wuffs_base__pixel_config__pixel_subsampling(this);\n}\n\ninline wuffs_base__rect_ie_u32  //\nwuffs_base__pixel_config::bounds() const {\n  return wuffs_base__pixel_config__bounds(this);\n}\n\ninline uint32_t  //\nwuffs_base__pixel_config::width() const {\n  return wuffs_base__pixel_config__width(this);\n}\n\ninline uint32_t  //\nwuffs_base__pixel_config::height() const {\n  return wuffs_base__pixel_config__height(this);\n}\n\ninline uint64_t  //\nwuffs_base__pixel_config::pixbuf_len() const {\n  return wuffs_base__pixel_config__pixbuf_len(this);\n}\n\n#endif  // __cplusplus\n\n" +
 	"" +
 	"// --------\n\ntypedef struct {\n  wuffs_base__pixel_config pixcfg;\n\n  // Do not access the private_impl's fields directly. There is no API/ABI\n  // compatibility or safety guarantee if you do so.\n  struct {\n    uint64_t first_frame_io_position;\n    bool first_frame_is_opaque;\n  } private_impl;\n\n#ifdef __cplusplus\n  inline void set(uint32_t pixfmt_repr,\n                  uint32_t pixsub_repr,\n                  uint32_t width,\n                  uint32_t height,\n                  uint64_t first_frame_io_position,\n                  bool first_frame_is_opaque);\n  inline void invalidate();\n  inline bool is_valid() const;\n  inline uint64_t first_frame_io_position() const;\n  inline bool first_frame_is_opaque() const;\n#endif  // __cplusplus\n\n} wuffs_base__image_config;\n\nstatic inline wuffs_base__image_config  //\nwuffs_base__null_image_config() {\n  wuffs_base__image_config ret;\n  ret.pixcfg = wuffs_base__null_pixel_config();\n  ret.private_impl.first_frame_io_position = 0;\n  ret.private_impl.first_frame_is_opaque = false;" +
 	"\n  return ret;\n}\n\n// TODO: Should this function return bool? An error type?\nstatic inline void  //\nwuffs_base__image_config__set(wuffs_base__image_config* c,\n                              uint32_t pixfmt_repr,\n                              uint32_t pixsub_repr,\n                              uint32_t width,\n                              uint32_t height,\n                              uint64_t first_frame_io_position,\n                              bool first_frame_is_opaque) {\n  if (!c) {\n    return;\n  }\n  if (pixfmt_repr) {\n    c->pixcfg.private_impl.pixfmt.repr = pixfmt_repr;\n    c->pixcfg.private_impl.pixsub.repr = pixsub_repr;\n    c->pixcfg.private_impl.width = width;\n    c->pixcfg.private_impl.height = height;\n    c->private_impl.first_frame_io_position = first_frame_io_position;\n    c->private_impl.first_frame_is_opaque = first_frame_is_opaque;\n    return;\n  }\n\n  c->pixcfg.private_impl.pixfmt.repr = 0;\n  c->pixcfg.private_impl.pixsub.repr = 0;\n  c->pixcfg.private_impl.width = 0;\n  c->pixcfg.private_impl.he" +
@@ -306,33 +538,56 @@ const baseImagePublicH = "" +
 	"" +
 	"// --------\n\ntypedef struct {\n  wuffs_base__pixel_config pixcfg;\n\n  // Do not access the private_impl's fields directly. There is no API/ABI\n  // compatibility or safety guarantee if you do so.\n  struct {\n    wuffs_base__table_u8 planes[WUFFS_BASE__PIXEL_FORMAT__NUM_PLANES_MAX];\n    // TODO: color spaces.\n  } private_impl;\n\n#ifdef __cplusplus\n  inline wuffs_base__status set_from_slice(\n      const wuffs_base__pixel_config* pixcfg,\n      wuffs_base__slice_u8 pixbuf_memory);\n  inline wuffs_base__status set_from_table(\n      const wuffs_base__pixel_config* pixcfg,\n      wuffs_base__table_u8 pixbuf_memory);\n  inline wuffs_base__slice_u8 palette();\n  inline wuffs_base__pixel_format pixel_format() const;\n  inline wuffs_base__table_u8 plane(uint32_t p);\n  inline wuffs_base__color_u32_argb_premul color_u32_at(uint32_t x,\n                                                        uint32_t y) const;\n  inline wuffs_base__status set_color_u32_at(\n      uint32_t x,\n      uint32_t y,\n      wuffs_base__color_u32_argb_premul co" +
 	"lor);\n#endif  // __cplusplus\n\n} wuffs_base__pixel_buffer;\n\nstatic inline wuffs_base__pixel_buffer  //\nwuffs_base__null_pixel_buffer() {\n  wuffs_base__pixel_buffer ret;\n  ret.pixcfg = wuffs_base__null_pixel_config();\n  ret.private_impl.planes[0] = wuffs_base__empty_table_u8();\n  ret.private_impl.planes[1] = wuffs_base__empty_table_u8();\n  ret.private_impl.planes[2] = wuffs_base__empty_table_u8();\n  ret.private_impl.planes[3] = wuffs_base__empty_table_u8();\n  return ret;\n}\n\nstatic inline wuffs_base__status  //\nwuffs_base__pixel_buffer__set_from_slice(wuffs_base__pixel_buffer* pb,\n                                         const wuffs_base__pixel_config* pixcfg,\n                                         wuffs_base__slice_u8 pixbuf_memory) {\n  if (!pb) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  }\n  memset(pb, 0, sizeof(*pb));\n  if (!pixcfg) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  }\n  if (wuffs_base__pixel_format__is_planar(&pixcfg->private_impl.pixfmt)) " +
-	"{\n    // TODO: support planar pixel formats, concious of pixel subsampling.\n    return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n  }\n  uint32_t bits_per_pixel =\n      wuffs_base__pixel_format__bits_per_pixel(&pixcfg->private_impl.pixfmt);\n  if ((bits_per_pixel == 0) || ((bits_per_pixel % 8) != 0)) {\n    // TODO: support fraction-of-byte pixels, e.g. 1 bit per pixel?\n    return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n  }\n  uint64_t bytes_per_pixel = bits_per_pixel / 8;\n\n  uint8_t* ptr = pixbuf_memory.ptr;\n  uint64_t len = pixbuf_memory.len;\n  if (wuffs_base__pixel_format__is_indexed(&pixcfg->private_impl.pixfmt)) {\n    // Split a 1024 byte chunk (256 palette entries × 4 bytes per entry) from\n    // the start of pixbuf_memory. We split from the start, not the end, so\n    // that the both chunks' pointers have the same alignment as the original\n    // pointer, up to an alignment of 1024.\n    if (len < 1024) {\n      return wuffs_base__make_status(\n          wuffs_bas" +
-	"e__error__bad_argument_length_too_short);\n    }\n    wuffs_base__table_u8* tab =\n        &pb->private_impl\n             .planes[WUFFS_BASE__PIXEL_FORMAT__INDEXED__COLOR_PLANE];\n    tab->ptr = ptr;\n    tab->width = 1024;\n    tab->height = 1;\n    tab->stride = 1024;\n    ptr += 1024;\n    len -= 1024;\n  }\n\n  uint64_t wh = ((uint64_t)pixcfg->private_impl.width) *\n                ((uint64_t)pixcfg->private_impl.height);\n  size_t width = (size_t)(pixcfg->private_impl.width);\n  if ((wh > (UINT64_MAX / bytes_per_pixel)) ||\n      (width > (SIZE_MAX / bytes_per_pixel))) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  }\n  wh *= bytes_per_pixel;\n  width *= bytes_per_pixel;\n  if (wh > len) {\n    return wuffs_base__make_status(\n        wuffs_base__error__bad_argument_length_too_short);\n  }\n\n  pb->pixcfg = *pixcfg;\n  wuffs_base__table_u8* tab = &pb->private_impl.planes[0];\n  tab->ptr = ptr;\n  tab->width = width;\n  tab->height = pixcfg->private_impl.height;\n  tab->stride = width;\n  return wuffs_base__m" +
-	"ake_status(NULL);\n}\n\nstatic inline wuffs_base__status  //\nwuffs_base__pixel_buffer__set_from_table(wuffs_base__pixel_buffer* pb,\n                                         const wuffs_base__pixel_config* pixcfg,\n                                         wuffs_base__table_u8 pixbuf_memory) {\n  if (!pb) {\n    return wuffs_base__make_status(wuffs_base__error__bad_receiver);\n  }\n  memset(pb, 0, sizeof(*pb));\n  if (!pixcfg ||\n      wuffs_base__pixel_format__is_planar(&pixcfg->private_impl.pixfmt)) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  }\n  uint32_t bits_per_pixel =\n      wuffs_base__pixel_format__bits_per_pixel(&pixcfg->private_impl.pixfmt);\n  if ((bits_per_pixel == 0) || ((bits_per_pixel % 8) != 0)) {\n    // TODO: support fraction-of-byte pixels, e.g. 1 bit per pixel?\n    return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n  }\n  uint64_t bytes_per_pixel = bits_per_pixel / 8;\n\n  uint64_t width_in_bytes =\n      ((uint64_t)pixcfg->private_impl.width) * bytes_per_pixe" +
-	"l;\n  if ((width_in_bytes > pixbuf_memory.width) ||\n      (pixcfg->private_impl.height > pixbuf_memory.height)) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  }\n\n  pb->pixcfg = *pixcfg;\n  pb->private_impl.planes[0] = pixbuf_memory;\n  return wuffs_base__make_status(NULL);\n}\n\n// wuffs_base__pixel_buffer__palette returns the palette color data. If\n// non-empty, it will have length 1024.\nstatic inline wuffs_base__slice_u8  //\nwuffs_base__pixel_buffer__palette(wuffs_base__pixel_buffer* pb) {\n  if (pb &&\n      wuffs_base__pixel_format__is_indexed(&pb->pixcfg.private_impl.pixfmt)) {\n    wuffs_base__table_u8* tab =\n        &pb->private_impl\n             .planes[WUFFS_BASE__PIXEL_FORMAT__INDEXED__COLOR_PLANE];\n    if ((tab->width == 1024) && (tab->height == 1)) {\n      return wuffs_base__make_slice_u8(tab->ptr, 1024);\n    }\n  }\n  return wuffs_base__make_slice_u8(NULL, 0);\n}\n\nstatic inline wuffs_base__pixel_format  //\nwuffs_base__pixel_buffer__pixel_format(const wuffs_base__pixel_buffer* pb) {\n" +
-	"  if (pb) {\n    return pb->pixcfg.private_impl.pixfmt;\n  }\n  return wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__INVALID);\n}\n\nstatic inline wuffs_base__table_u8  //\nwuffs_base__pixel_buffer__plane(wuffs_base__pixel_buffer* pb, uint32_t p) {\n  if (pb && (p < WUFFS_BASE__PIXEL_FORMAT__NUM_PLANES_MAX)) {\n    return pb->private_impl.planes[p];\n  }\n\n  wuffs_base__table_u8 ret;\n  ret.ptr = NULL;\n  ret.width = 0;\n  ret.height = 0;\n  ret.stride = 0;\n  return ret;\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__color_u32_argb_premul  //\nwuffs_base__pixel_buffer__color_u32_at(const wuffs_base__pixel_buffer* pb,\n                                       uint32_t x,\n                                       uint32_t y);\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_buffer__set_color_u32_at(\n    wuffs_base__pixel_buffer* pb,\n    uint32_t x,\n    uint32_t y,\n    wuffs_base__color_u32_argb_premul color);\n\n#ifdef __cplusplus\n\ninline wuffs_base__status  //\nwuffs_base__pixel_buffer::set_from_slice(\n    const w" +
-	"uffs_base__pixel_config* pixcfg_arg,\n    wuffs_base__slice_u8 pixbuf_memory) {\n  return wuffs_base__pixel_buffer__set_from_slice(this, pixcfg_arg,\n                                                  pixbuf_memory);\n}\n\ninline wuffs_base__status  //\nwuffs_base__pixel_buffer::set_from_table(\n    const wuffs_base__pixel_config* pixcfg_arg,\n    wuffs_base__table_u8 pixbuf_memory) {\n  return wuffs_base__pixel_buffer__set_from_table(this, pixcfg_arg,\n                                                  pixbuf_memory);\n}\n\ninline wuffs_base__slice_u8  //\nwuffs_base__pixel_buffer::palette() {\n  return wuffs_base__pixel_buffer__palette(this);\n}\n\ninline wuffs_base__pixel_format  //\nwuffs_base__pixel_buffer::pixel_format() const {\n  return wuffs_base__pixel_buffer__pixel_format(this);\n}\n\ninline wuffs_base__table_u8  //\nwuffs_base__pixel_buffer::plane(uint32_t p) {\n  return wuffs_base__pixel_buffer__plane(this, p);\n}\n\ninline wuffs_base__color_u32_argb_premul  //\nwuffs_base__pixel_buffer::color_u32_at(uint32_t x, uint32_t y) con" +
-	"st {\n  return wuffs_base__pixel_buffer__color_u32_at(this, x, y);\n}\n\ninline wuffs_base__status  //\nwuffs_base__pixel_buffer::set_color_u32_at(\n    uint32_t x,\n    uint32_t y,\n    wuffs_base__color_u32_argb_premul color) {\n  return wuffs_base__pixel_buffer__set_color_u32_at(this, x, y, color);\n}\n\n#endif  // __cplusplus\n\n" +
-	"" +
-	"// --------\n\ntypedef struct {\n  // Do not access the private_impl's fields directly. There is no API/ABI\n  // compatibility or safety guarantee if you do so.\n  struct {\n    uint8_t TODO;\n  } private_impl;\n\n#ifdef __cplusplus\n#endif  // __cplusplus\n\n} wuffs_base__decode_frame_options;\n\n#ifdef __cplusplus\n\n#endif  // __cplusplus\n\n" +
+	"{\n    // Split the pixbuf_memory into one table per plane, in the same layout\n    // as used by wuffs_base__pixel_config__pixbuf_len.\n    wuffs_base__table_u8 tabs[WUFFS_BASE__PIXEL_FORMAT__NUM_PLANES_MAX];\n    uint8_t* ptr = pixbuf_memory.ptr;\n    uint64_t len = pixbuf_memory.len;\n    uint32_t num_planes =\n        wuffs_base__pixel_format__num_planes(&pixcfg->private_impl.pixfmt);\n    uint32_t p;\n    for (p = 0; p < num_planes; p++) {\n      if (((pixcfg->private_impl.pixfmt.repr >> (4 * p)) & 0x0F) != 0x08) {\n        // TODO: support other bit depths and multi-channel planes.\n        return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n      }\n      uint64_t dx = wuffs_base__pixel_subsampling__denominator_x(\n          &pixcfg->private_impl.pixsub, p);\n      uint64_t dy = wuffs_base__pixel_subsampling__denominator_y(\n          &pixcfg->private_impl.pixsub, p);\n      uint64_t w = (((uint64_t)pixcfg->private_impl.width) +\n                    wuffs_base__pixel_subsampling__bias_x(\n             " +
+	"           &pixcfg->private_impl.pixsub, p) +\n                    dx - 1) /\n                   dx;\n      uint64_t h = (((uint64_t)pixcfg->private_impl.height) +\n                    wuffs_base__pixel_subsampling__bias_y(\n                        &pixcfg->private_impl.pixsub, p) +\n                    dy - 1) /\n                   dy;\n      uint64_t wh = w * h;\n      if ((w > SIZE_MAX) || (wh > len)) {\n        return wuffs_base__make_status(\n            wuffs_base__error__bad_argument_length_too_short);\n      }\n      tabs[p].ptr = ptr;\n      tabs[p].width = (size_t)w;\n      tabs[p].height = (size_t)h;\n      tabs[p].stride = (size_t)w;\n      ptr += wh;\n      len -= wh;\n    }\n\n    pb->pixcfg = *pixcfg;\n    for (p = 0; p < num_planes; p++) {\n      pb->private_impl.planes[p] = tabs[p];\n    }\n    return wuffs_base__make_status(NULL);\n  }\n  uint32_t bits_per_pixel =\n      wuffs_base__pixel_format__bits_per_pixel(&pixcfg->private_impl.pixfmt);\n  if ((bits_per_pixel == 0) || ((bits_per_pixel % 8) != 0)) {\n    // TODO: sup" +
+	"port fraction-of-byte pixels, e.g. 1 bit per pixel?\n    return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n  }\n  uint64_t bytes_per_pixel = bits_per_pixel / 8;\n\n  uint8_t* ptr = pixbuf_memory.ptr;\n  uint64_t len = pixbuf_memory.len;\n  if (wuffs_base__pixel_format__is_indexed(&pixcfg->private_impl.pixfmt)) {\n    // Split a 1024 byte chunk (256 palette entries × 4 bytes per entry) from\n    // the start of pixbuf_memory. We split from the start, not the end, so\n    // that the both chunks' pointers have the same alignment as the original\n    // pointer, up to an alignment of 1024.\n    if (len < 1024) {\n      return wuffs_base__make_status(\n          wuffs_base__error__bad_argument_length_too_short);\n    }\n    wuffs_base__table_u8* tab =\n        &pb->private_impl\n             .planes[WUFFS_BASE__PIXEL_FORMAT__INDEXED__COLOR_PLANE];\n    tab->ptr = ptr;\n    tab->width = 1024;\n    tab->height = 1;\n    tab->stride = 1024;\n    ptr += 1024;\n    len -= 1024;\n  }\n\n  uint64_t wh = ((uint64_t)pixcfg->p" +
+	"rivate_impl.width) *\n                ((uint64_t)pixcfg->private_impl.height);\n  size_t width = (size_t)(pixcfg->private_impl.width);\n  if ((wh > (UINT64_MAX / bytes_per_pixel)) ||\n      (width > (SIZE_MAX / bytes_per_pixel))) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  }\n  wh *= bytes_per_pixel;\n  width *= bytes_per_pixel;\n  if (wh > len) {\n    return wuffs_base__make_status(\n        wuffs_base__error__bad_argument_length_too_short);\n  }\n\n  pb->pixcfg = *pixcfg;\n  wuffs_base__table_u8* tab = &pb->private_impl.planes[0];\n  tab->ptr = ptr;\n  tab->width = width;\n  tab->height = pixcfg->private_impl.height;\n  tab->stride = width;\n  return wuffs_base__make_status(NULL);\n}\n\nstatic inline wuffs_base__status  //\nwuffs_base__pixel_buffer__set_from_table(wuffs_base__pixel_buffer* pb,\n                                         const wuffs_base__pixel_config* pixcfg,\n                                         wuffs_base__table_u8 pixbuf_memory) {\n  if (!pb) {\n    return wuffs_base__make_status(wu" +
+	"ffs_base__error__bad_receiver);\n  }\n  memset(pb, 0, sizeof(*pb));\n  if (!pixcfg ||\n      wuffs_base__pixel_format__is_planar(&pixcfg->private_impl.pixfmt)) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  }\n  uint32_t bits_per_pixel =\n      wuffs_base__pixel_format__bits_per_pixel(&pixcfg->private_impl.pixfmt);\n  if ((bits_per_pixel == 0) || ((bits_per_pixel % 8) != 0)) {\n    // TODO: support fraction-of-byte pixels, e.g. 1 bit per pixel?\n    return wuffs_base__make_status(wuffs_base__error__unsupported_option);\n  }\n  uint64_t bytes_per_pixel = bits_per_pixel / 8;\n\n  uint64_t width_in_bytes =\n      ((uint64_t)pixcfg->private_impl.width) * bytes_per_pixel;\n  if ((width_in_bytes > pixbuf_memory.width) ||\n      (pixcfg->private_impl.height > pixbuf_memory.height)) {\n    return wuffs_base__make_status(wuffs_base__error__bad_argument);\n  }\n\n  pb->pixcfg = *pixcfg;\n  pb->private_impl.planes[0] = pixbuf_memory;\n  return wuffs_base__make_status(NULL);\n}\n\n// wuffs_base__pixel_buffer__palette re" +
+	"turns the palette color data. If\n// non-empty, it will have length 1024.\nstatic inline wuffs_base__slice_u8  //\nwuffs_base__pixel_buffer__palette(wuffs_base__pixel_buffer* pb) {\n  if (pb &&\n      wuffs_base__pixel_format__is_indexed(&pb->pixcfg.private_impl.pixfmt)) {\n    wuffs_base__table_u8* tab =\n        &pb->private_impl\n             .planes[WUFFS_BASE__PIXEL_FORMAT__INDEXED__COLOR_PLANE];\n    if ((tab->width == 1024) && (tab->height == 1)) {\n      return wuffs_base__make_slice_u8(tab->ptr, 1024);\n    }\n  }\n  return wuffs_base__make_slice_u8(NULL, 0);\n}\n\nstatic inline wuffs_base__pixel_format  //\nwuffs_base__pixel_buffer__pixel_format(const wuffs_base__pixel_buffer* pb) {\n  if (pb) {\n    return pb->pixcfg.private_impl.pixfmt;\n  }\n  return wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__INVALID);\n}\n\nstatic inline wuffs_base__table_u8  //\nwuffs_base__pixel_buffer__plane(wuffs_base__pixel_buffer* pb, uint32_t p) {\n  if (pb && (p < WUFFS_BASE__PIXEL_FORMAT__NUM_PLANES_MAX)) {\n    return pb->private_im" +
+	"pl.planes[p];\n  }\n\n  wuffs_base__table_u8 ret;\n  ret.ptr = NULL;\n  ret.width = 0;\n  ret.height = 0;\n  ret.stride = 0;\n  return ret;\n}\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__color_u32_argb_premul  //\nwuffs_base__pixel_buffer__color_u32_at(const wuffs_base__pixel_buffer* pb,\n                                       uint32_t x,\n                                       uint32_t y);\n\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_buffer__set_color_u32_at(\n    wuffs_base__pixel_buffer* pb,\n    uint32_t x,\n    uint32_t y,\n    wuffs_base__color_u32_argb_premul color);\n\n#ifdef __cplusplus\n\ninline wuffs_base__status  //\nwuffs_base__pixel_buffer::set_from_slice(\n    const wuffs_base__pixel_config* pixcfg_arg,\n    wuffs_base__slice_u8 pixbuf_memory) {\n  return wuffs_base__pixel_buffer__set_from_slice(this, pixcfg_arg,\n                                                  pixbuf_memory);\n}\n\ninline wuffs_base__status  //\nwuffs_base__pixel_buffer::set_from_table(\n    const wuffs_base__pixel_config* pixcfg_arg,\n   " +
+	" wuffs_base__table_u8 pixbuf_memory) {\n  return wuffs_base__pixel_buffer__set_from_table(this, pixcfg_arg,\n                                                  pixbuf_memory);\n}\n\ninline wuffs_base__slice_u8  //\nwuffs_base__pixel_buffer::palette() {\n  return wuffs_base__pixel_buffer__palette(this);\n}\n\ninline wuffs_base__pixel_format  //\nwuffs_base__pixel_buffer::pixel_format() const {\n  return wuffs_base__pixel_buffer__pixel_format(this);\n}\n\ninline wuffs_base__table_u8  //\nwuffs_base__pixel_buffer::plane(uint32_t p) {\n  return wuffs_base__pixel_buffer__plane(this, p);\n}\n\ninline wuffs_base__color_u32_argb_premul  //\nwuffs_base__pixel_buffer::color_u32_at(uint32_t x, uint32_t y) const {\n  return wuffs_base__pixel_buffer__color_u32_at(this, x, y);\n}\n\ninline wuffs_base__status  //\nwuffs_base__pixel_buffer::set_color_u32_at(\n    uint32_t x,\n    uint32_t y,\n    wuffs_base__color_u32_argb_premul color) {\n  return wuffs_base__pixel_buffer__set_color_u32_at(this, x, y, color);\n}\n\n#endif  // __cplusplus\n\n" +
+	"" +
+	"// --------\n\n// wuffs_base__decode_frame_options are optional arguments to an image\n// decoder's decode_frame method. A NULL pointer is equivalent to the options\n// returned by wuffs_base__null_decode_frame_options.\n//\n// The scale_shift option, ranging from 0 to 3 inclusive, downscales the frame\n// by a factor of (1 << scale_shift) in each dimension, using nearest neighbor\n// sampling: the source pixel at (x, y) is written to the destination pixel at\n// ((x >> scale_shift), (y >> scale_shift)) if both x and y are multiples of\n// that factor, and is not written at all otherwise. The destination\n// pixel_buffer only needs to be as large as the scale_rect of the image\n// bounds. A decoder's frame_dirty_rect is also in scaled coordinates, but its\n// frame_config bounds are not, as they are decoded before the options apply.\n//\n// The crop_rect option, in source (image) coordinates, restricts decoding to\n// a region of interest. Source pixels outside of it are not written (or even\n// converted to the destination p" +
+	"ixel format) and the source pixel at (x, y)\n// is written as if it were at ((x - crop.min_incl_x), (y - crop.min_incl_y)),\n// before any scaling. The destination pixel_buffer only needs to be as large\n// as the dst_rect of the image bounds. An empty crop_rect (the default) means\n// no cropping.\n//\n// The band_height option, if non-zero, lets the destination pixel_buffer hold\n// only band_height rows (of the dst_rect's width) instead of the whole frame,\n// so that peak memory use does not depend on the image height. The dst_rect\n// is partitioned into bands of band_height rows each (the last band may be\n// shorter) and the destination row y is written to the pixel_buffer row (y -\n// band.min_incl_y). Before writing the first row of the next band, the\n// decoder suspends with wuffs_base__suspension__short_write. The caller\n// should then consume the completed band, whose rows are given by the\n// decoder's frame_dirty_rect, and call decode_frame again with the same\n// arguments. Once decode_frame returns OK, fra" +
+	"me_dirty_rect gives the final\n// band. Every band is reported exactly once, in the order that the image\n// format stores its rows (e.g. bottom-up for most BMP images), even if no\n// pixels in it were written, and pixels that the image data does not write\n// (e.g. those skipped over by BMP RLE deltas) are left as-is, so callers may\n// want to clear the pixel_buffer between bands. Decoders that cannot stream\n// bands (e.g. because they can revisit previous rows, as interlaced GIF frames\n// do) fail with wuffs_base__error__unsupported_option.\ntypedef struct {\n  // Do not access the private_impl's fields directly. There is no API/ABI\n  // compatibility or safety guarantee if you do so.\n  struct {\n    uint32_t scale_shift;\n    wuffs_base__rect_ie_u32 crop_rect;\n    uint32_t band_height;\n  } private_impl;\n\n#ifdef __cplusplus\n  inline void set_scale_shift(uint32_t scale_shift);\n  inline uint32_t scale_shift() const;\n  inline wuffs_base__rect_ie_u32 scale_rect(wuffs_base__rect_ie_u32 r) const;\n  inline void set_crop_" +
+	"rect(wuffs_base__rect_ie_u32 crop_rect);\n  inline wuffs_base__rect_ie_u32 crop_rect() const;\n  inline uint32_t crop_min_incl_x() const;\n  inline uint32_t crop_min_incl_y() const;\n  inline uint32_t crop_max_excl_x() const;\n  inline uint32_t crop_max_excl_y() const;\n  inline wuffs_base__rect_ie_u32 dst_rect(wuffs_base__rect_ie_u32 r) const;\n  inline void set_band_height(uint32_t band_height);\n  inline uint32_t band_height() const;\n#endif  // __cplusplus\n\n} wuffs_base__decode_frame_options;\n\n#define WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL 3\n\nstatic inline wuffs_base__decode_frame_options  //\nwuffs_base__null_decode_frame_options() {\n  wuffs_base__decode_frame_options ret;\n  ret.private_impl.scale_shift = 0;\n  ret.private_impl.crop_rect = wuffs_base__empty_rect_ie_u32();\n  ret.private_impl.band_height = 0;\n  return ret;\n}\n\n// wuffs_base__decode_frame_options__set_scale_shift sets the scale_shift,\n// clamping it to WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL.\nstatic inline void  //\nwuff" +
+	"s_base__decode_frame_options__set_scale_shift(\n    wuffs_base__decode_frame_options* o,\n    uint32_t scale_shift) {\n  if (!o) {\n    return;\n  }\n  o->private_impl.scale_shift =\n      (scale_shift < WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL)\n          ? scale_shift\n          : WUFFS_BASE__DECODE_FRAME_OPTIONS__SCALE_SHIFT__MAX_INCL;\n}\n\nstatic inline uint32_t  //\nwuffs_base__decode_frame_options__scale_shift(\n    const wuffs_base__decode_frame_options* o) {\n  return o ? o->private_impl.scale_shift : 0;\n}\n\n// wuffs_base__decode_frame_options__scale_rect returns the rectangle, in\n// destination coordinates, that the source rectangle r is written to. Each\n// bound is divided by (1 << scale_shift), rounding up, so that e.g. a 5 pixel\n// wide image is scaled by a half to be 3 pixels wide.\nstatic inline wuffs_base__rect_ie_u32  //\nwuffs_base__decode_frame_options__scale_rect(\n    const wuffs_base__decode_frame_options* o,\n    wuffs_base__rect_ie_u32 r) {\n  uint32_t s = wuffs_base__decode_frame_options__s" +
+	"cale_shift(o);\n  uint64_t m = (((uint64_t)1) << s) - 1;\n  wuffs_base__rect_ie_u32 ret;\n  ret.min_incl_x = (uint32_t)((r.min_incl_x + m) >> s);\n  ret.min_incl_y = (uint32_t)((r.min_incl_y + m) >> s);\n  ret.max_excl_x = (uint32_t)((r.max_excl_x + m) >> s);\n  ret.max_excl_y = (uint32_t)((r.max_excl_y + m) >> s);\n  return ret;\n}\n\nstatic inline void  //\nwuffs_base__decode_frame_options__set_crop_rect(\n    wuffs_base__decode_frame_options* o,\n    wuffs_base__rect_ie_u32 crop_rect) {\n  if (!o) {\n    return;\n  }\n  o->private_impl.crop_rect = crop_rect;\n}\n\nstatic inline wuffs_base__rect_ie_u32  //\nwuffs_base__decode_frame_options__crop_rect(\n    const wuffs_base__decode_frame_options* o) {\n  return o ? o->private_impl.crop_rect : wuffs_base__empty_rect_ie_u32();\n}\n\n// wuffs_base__decode_frame_options__crop_min_incl_x etc. return the crop_rect\n// bounds, treating an empty crop_rect (no cropping) as the largest possible\n// rectangle.\n\nstatic inline uint32_t  //\nwuffs_base__decode_frame_options__crop_min_incl_x(\n    cons" +
+	"t wuffs_base__decode_frame_options* o) {\n  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))\n             ? 0\n             : o->private_impl.crop_rect.min_incl_x;\n}\n\nstatic inline uint32_t  //\nwuffs_base__decode_frame_options__crop_min_incl_y(\n    const wuffs_base__decode_frame_options* o) {\n  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))\n             ? 0\n             : o->private_impl.crop_rect.min_incl_y;\n}\n\nstatic inline uint32_t  //\nwuffs_base__decode_frame_options__crop_max_excl_x(\n    const wuffs_base__decode_frame_options* o) {\n  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))\n             ? 0xFFFFFFFF\n             : o->private_impl.crop_rect.max_excl_x;\n}\n\nstatic inline uint32_t  //\nwuffs_base__decode_frame_options__crop_max_excl_y(\n    const wuffs_base__decode_frame_options* o) {\n  return (!o || wuffs_base__rect_ie_u32__is_empty(&o->private_impl.crop_rect))\n             ? 0xFFFFFFFF\n             : o->private_impl.c" +
+	"rop_rect.max_excl_y;\n}\n\n// wuffs_base__decode_frame_options__dst_rect returns the rectangle, in\n// destination coordinates, that the source rectangle r is written to: r is\n// intersected with the crop_rect (if non-empty), translated so that the\n// crop_rect's top-left corner is the origin and then scaled.\nstatic inline wuffs_base__rect_ie_u32  //\nwuffs_base__decode_frame_options__dst_rect(\n    const wuffs_base__decode_frame_options* o,\n    wuffs_base__rect_ie_u32 r) {\n  uint32_t x0 = wuffs_base__decode_frame_options__crop_min_incl_x(o);\n  uint32_t y0 = wuffs_base__decode_frame_options__crop_min_incl_y(o);\n  r = wuffs_base__rect_ie_u32__intersect(\n      &r, wuffs_base__make_rect_ie_u32(\n              x0, y0, wuffs_base__decode_frame_options__crop_max_excl_x(o),\n              wuffs_base__decode_frame_options__crop_max_excl_y(o)));\n  if (wuffs_base__rect_ie_u32__is_empty(&r)) {\n    return wuffs_base__empty_rect_ie_u32();\n  }\n  r.min_incl_x -= x0;\n  r.min_incl_y -= y0;\n  r.max_excl_x -= x0;\n  r.max_excl_y -= y0;\n" +
+	"  return wuffs_base__decode_frame_options__scale_rect(o, r);\n}\n\n// wuffs_base__decode_frame_options__set_band_height sets the band_height. Zero\n// (the default) means that the whole frame is decoded in one go.\nstatic inline void  //\nwuffs_base__decode_frame_options__set_band_height(\n    wuffs_base__decode_frame_options* o,\n    uint32_t band_height) {\n  if (!o) {\n    return;\n  }\n  o->private_impl.band_height = band_height;\n}\n\nstatic inline uint32_t  //\nwuffs_base__decode_frame_options__band_height(\n    const wuffs_base__decode_frame_options* o) {\n  return o ? o->private_impl.band_height : 0;\n}\n\n#ifdef __cplusplus\n\ninline void  //\nwuffs_base__decode_frame_options::set_scale_shift(uint32_t scale_shift) {\n  wuffs_base__decode_frame_options__set_scale_shift(this, scale_shift);\n}\n\ninline uint32_t  //\nwuffs_base__decode_frame_options::scale_shift() const {\n  return wuffs_base__decode_frame_options__scale_shift(this);\n}\n\ninline wuffs_base__rect_ie_u32  //\nwuffs_base__decode_frame_options::scale_rect(wuffs_base__rect_" +
+	"ie_u32 r) const {\n  return wuffs_base__decode_frame_options__scale_rect(this, r);\n}\n\ninline void  //\nwuffs_base__decode_frame_options::set_crop_rect(\n    wuffs_base__rect_ie_u32 crop_rect) {\n  wuffs_base__decode_frame_options__set_crop_rect(this, crop_rect);\n}\n\ninline wuffs_base__rect_ie_u32  //\nwuffs_base__decode_frame_options::crop_rect() const {\n  return wuffs_base__decode_frame_options__crop_rect(this);\n}\n\ninline uint32_t  //\nwuffs_base__decode_frame_options::crop_min_incl_x() const {\n  return wuffs_base__decode_frame_options__crop_min_incl_x(this);\n}\n\ninline uint32_t  //\nwuffs_base__decode_frame_options::crop_min_incl_y() const {\n  return wuffs_base__decode_frame_options__crop_min_incl_y(this);\n}\n\ninline uint32_t  //\nwuffs_base__decode_frame_options::crop_max_excl_x() const {\n  return wuffs_base__decode_frame_options__crop_max_excl_x(this);\n}\n\ninline uint32_t  //\nwuffs_base__decode_frame_options::crop_max_excl_y() const {\n  return wuffs_base__decode_frame_options__crop_max_excl_y(this);\n}\n\ninline wuffs_b" +
+	"ase__rect_ie_u32  //\nwuffs_base__decode_frame_options::dst_rect(wuffs_base__rect_ie_u32 r) const {\n  return wuffs_base__decode_frame_options__dst_rect(this, r);\n}\n\ninline void  //\nwuffs_base__decode_frame_options::set_band_height(uint32_t band_height) {\n  wuffs_base__decode_frame_options__set_band_height(this, band_height);\n}\n\ninline uint32_t  //\nwuffs_base__decode_frame_options::band_height() const {\n  return wuffs_base__decode_frame_options__band_height(this);\n}\n\n#endif  // __cplusplus\n\n" +
 	"" +
 	"// --------\n\n// wuffs_base__pixel_palette__closest_element returns the index of the palette\n// element that minimizes the sum of squared differences of the four ARGB\n// channels, working in premultiplied alpha. Ties favor the smaller index.\n//\n// The palette_slice.len may equal (N*4), for N less than 256, which means that\n// only the first N palette elements are considered. It returns 0 when N is 0.\n//\n// Applying this function on a per-pixel basis will not produce whole-of-image\n// dithering.\nWUFFS_BASE__MAYBE_STATIC uint8_t  //\nwuffs_base__pixel_palette__closest_element(\n    wuffs_base__slice_u8 palette_slice,\n    wuffs_base__pixel_format palette_format,\n    wuffs_base__color_u32_argb_premul c);\n\n" +
 	"" +
-	"// --------\n\n// TODO: should the func type take restrict pointers?\ntypedef uint64_t (*wuffs_base__pixel_swizzler__func)(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src);\n\ntypedef struct {\n  // Do not access the private_impl's fields directly. There is no API/ABI\n  // compatibility or safety guarantee if you do so.\n  struct {\n    wuffs_base__pixel_swizzler__func func;\n  } private_impl;\n\n#ifdef __cplusplus\n  inline wuffs_base__status prepare(wuffs_base__pixel_format dst_format,\n                                    wuffs_base__slice_u8 dst_palette,\n                                    wuffs_base__pixel_format src_format,\n                                    wuffs_base__slice_u8 src_palette,\n                                    wuffs_base__pixel_blend blend);\n  inline uint64_t swizzle_interleaved(wuffs_base__slice_u8 dst,\n                                      wuffs_base__slice_u8 dst_palette,\n                                      wuffs_base__slice_u8 src) const;\n#endi" +
-	"f  // __cplusplus\n\n} wuffs_base__pixel_swizzler;\n\n// wuffs_base__pixel_swizzler__prepare readies the pixel swizzler so that its\n// other methods may be called.\n//\n// For modular builds that divide the base module into sub-modules, using this\n// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not\n// just WUFFS_CONFIG__MODULE__BASE__CORE.\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_swizzler__prepare(wuffs_base__pixel_swizzler* p,\n                                    wuffs_base__pixel_format dst_format,\n                                    wuffs_base__slice_u8 dst_palette,\n                                    wuffs_base__pixel_format src_format,\n                                    wuffs_base__slice_u8 src_palette,\n                                    wuffs_base__pixel_blend blend);\n\n// wuffs_base__pixel_swizzler__swizzle_interleaved converts pixels from a\n// source format to a destination format.\n//\n// For modular builds that divide the base module into sub-modules, using " +
-	"this\n// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not\n// just WUFFS_CONFIG__MODULE__BASE__CORE.\nWUFFS_BASE__MAYBE_STATIC uint64_t  //\nwuffs_base__pixel_swizzler__swizzle_interleaved(\n    const wuffs_base__pixel_swizzler* p,\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src);\n\n#ifdef __cplusplus\n\ninline wuffs_base__status  //\nwuffs_base__pixel_swizzler::prepare(wuffs_base__pixel_format dst_format,\n                                    wuffs_base__slice_u8 dst_palette,\n                                    wuffs_base__pixel_format src_format,\n                                    wuffs_base__slice_u8 src_palette,\n                                    wuffs_base__pixel_blend blend) {\n  return wuffs_base__pixel_swizzler__prepare(this, dst_format, dst_palette,\n                                             src_format, src_palette, blend);\n}\n\nuint64_t  //\nwuffs_base__pixel_swizzler::swizzle_interleaved(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__sl" +
-	"ice_u8 dst_palette,\n    wuffs_base__slice_u8 src) const {\n  return wuffs_base__pixel_swizzler__swizzle_interleaved(this, dst, dst_palette,\n                                                         src);\n}\n\n#endif  // __cplusplus\n" +
+	"// --------\n\n#define WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE 4096\n\n// wuffs_base__pixel_palette_lookup speeds up repeatedly finding a palette's\n// closest element to a color. It is prepared once per palette and then gives\n// the same answers as wuffs_base__pixel_palette__closest_element, including\n// tie breaks, but faster: the palette is converted to premultiplied alpha and\n// sorted (by green) only once, so that a search can skip elements that are\n// too far away, and a direct-mapped cache remembers recently seen colors.\n//\n// Preparing a lookup copies the palette. Changing the palette afterwards\n// requires preparing the lookup again.\n//\n// It is about 25 KiB in size, which may be too large for some stacks.\ntypedef struct {\n  // Do not access the private_impl's fields directly. There is no API/ABI\n  // compatibility or safety guarantee if you do so.\n  struct {\n    uint32_t num_elements;\n    // The elements are 16-bit premultiplied B, G, R and A values.\n    uint32_t elements[256][4];\n    uint8_t sorted" +
+	"_by_green[256];\n    uint32_t cache_colors[WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE];\n    uint8_t cache_indexes[WUFFS_BASE__PIXEL_PALETTE_LOOKUP__CACHE_SIZE];\n  } private_impl;\n\n#ifdef __cplusplus\n  inline wuffs_base__status prepare(wuffs_base__slice_u8 palette_slice,\n                                    wuffs_base__pixel_format palette_format);\n  inline uint8_t closest_element(wuffs_base__color_u32_argb_premul c);\n#endif  // __cplusplus\n\n} wuffs_base__pixel_palette_lookup;\n\n// wuffs_base__pixel_palette_lookup__prepare readies the lookup for the given\n// palette, whose format should be one of the INDEXED__BGRA_ETC formats.\n//\n// For modular builds that divide the base module into sub-modules, using this\n// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not\n// just WUFFS_CONFIG__MODULE__BASE__CORE.\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_palette_lookup__prepare(\n    wuffs_base__pixel_palette_lookup* p,\n    wuffs_base__slice_u8 palette_slice,\n    wuffs_base__pi" +
+	"xel_format palette_format);\n\n// wuffs_base__pixel_palette_lookup__closest_element is like\n// wuffs_base__pixel_palette__closest_element for the prepared palette. It\n// updates the lookup's cache, so that p is not a const pointer.\nWUFFS_BASE__MAYBE_STATIC uint8_t  //\nwuffs_base__pixel_palette_lookup__closest_element(\n    wuffs_base__pixel_palette_lookup* p,\n    wuffs_base__color_u32_argb_premul c);\n\n#ifdef __cplusplus\n\ninline wuffs_base__status  //\nwuffs_base__pixel_palette_lookup::prepare(\n    wuffs_base__slice_u8 palette_slice,\n    wuffs_base__pixel_format palette_format) {\n  return wuffs_base__pixel_palette_lookup__prepare(this, palette_slice,\n                                                   palette_format);\n}\n\ninline uint8_t  //\nwuffs_base__pixel_palette_lookup::closest_element(\n    wuffs_base__color_u32_argb_premul c) {\n  return wuffs_base__pixel_palette_lookup__closest_element(this, c);\n}\n\n#endif  // __cplusplus\n\n" +
+	"" +
+	"// --------\n\n// TODO: should the func type take restrict pointers?\ntypedef uint64_t (*wuffs_base__pixel_swizzler__func)(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src);\n\n// wuffs_base__pixel_swizzler__planar_func converts one row of pixels whose\n// three planes (e.g. Y, Cb and Cr) have one sample per pixel. It returns the\n// number of pixels converted.\ntypedef uint64_t (*wuffs_base__pixel_swizzler__planar_func)(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 src0,\n    wuffs_base__slice_u8 src1,\n    wuffs_base__slice_u8 src2);\n\n// wuffs_base__pixel_swizzler__quantize_func converts one row of pixels to\n// palette indexes. It returns the number of pixels converted.\ntypedef uint64_t (*wuffs_base__pixel_swizzler__quantize_func)(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__pixel_palette_lookup* lookup,\n    wuffs_base__slice_u8 src);\n\ntypedef struct {\n  // Do not access the private_impl's fields directly. There is no API/ABI\n  // compatibility or safety gu" +
+	"arantee if you do so.\n  struct {\n    wuffs_base__pixel_swizzler__func func;\n    wuffs_base__pixel_swizzler__planar_func planar_func;\n    wuffs_base__pixel_swizzler__quantize_func quantize_func;\n    wuffs_base__pixel_palette_lookup* lookup;\n  } private_impl;\n\n#ifdef __cplusplus\n  inline wuffs_base__status prepare(wuffs_base__pixel_format dst_format,\n                                    wuffs_base__slice_u8 dst_palette,\n                                    wuffs_base__pixel_format src_format,\n                                    wuffs_base__slice_u8 src_palette,\n                                    wuffs_base__pixel_blend blend);\n  inline wuffs_base__status prepare_quantizing(\n      wuffs_base__pixel_palette_lookup* lookup,\n      wuffs_base__pixel_format dst_format,\n      wuffs_base__slice_u8 dst_palette,\n      wuffs_base__pixel_format src_format,\n      wuffs_base__pixel_blend blend);\n  inline uint64_t swizzle_interleaved(wuffs_base__slice_u8 dst,\n                                      wuffs_base__slice_u8 dst_palet" +
+	"te,\n                                      wuffs_base__slice_u8 src) const;\n  inline wuffs_base__status swizzle_planar(\n      wuffs_base__pixel_buffer* dst,\n      const wuffs_base__pixel_buffer* src) const;\n#endif  // __cplusplus\n\n} wuffs_base__pixel_swizzler;\n\n// wuffs_base__pixel_swizzler__prepare readies the pixel swizzler so that its\n// other methods may be called.\n//\n// For modular builds that divide the base module into sub-modules, using this\n// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not\n// just WUFFS_CONFIG__MODULE__BASE__CORE.\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_swizzler__prepare(wuffs_base__pixel_swizzler* p,\n                                    wuffs_base__pixel_format dst_format,\n                                    wuffs_base__slice_u8 dst_palette,\n                                    wuffs_base__pixel_format src_format,\n                                    wuffs_base__slice_u8 src_palette,\n                                    wuffs_base__pix" +
+	"el_blend blend);\n\n// wuffs_base__pixel_swizzler__prepare_quantizing is like\n// wuffs_base__pixel_swizzler__prepare, for converting direct color (such as Y,\n// BGR or BGRA) to palette indexes. The dst_format should be one of the\n// INDEXED__BGRA_ETC formats and the dst_palette holds its palette. This\n// prepares the lookup for that palette (see\n// wuffs_base__pixel_palette_lookup__prepare), and the lookup must outlive the\n// swizzler's use. Each pixel is mapped to its closest palette element.\n//\n// Subsequent swizzle_interleaved calls ignore their dst_palette argument. The\n// palette is the one given here, via the lookup.\n//\n// For modular builds that divide the base module into sub-modules, using this\n// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not\n// just WUFFS_CONFIG__MODULE__BASE__CORE.\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_swizzler__prepare_quantizing(\n    wuffs_base__pixel_swizzler* p,\n    wuffs_base__pixel_palette_lookup* lookup,\n    wuffs_base__p" +
+	"ixel_format dst_format,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__pixel_format src_format,\n    wuffs_base__pixel_blend blend);\n\n// wuffs_base__pixel_swizzler__swizzle_interleaved converts pixels from a\n// source format to a destination format.\n//\n// For modular builds that divide the base module into sub-modules, using this\n// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not\n// just WUFFS_CONFIG__MODULE__BASE__CORE.\nWUFFS_BASE__MAYBE_STATIC uint64_t  //\nwuffs_base__pixel_swizzler__swizzle_interleaved(\n    const wuffs_base__pixel_swizzler* p,\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src);\n\n// wuffs_base__pixel_swizzler__swizzle_planar converts a whole planar pixel\n// buffer, such as YCbCr, to an interleaved one, such as BGRA. The swizzler\n// must have been prepared with the src pixel buffer's (planar) pixel format,\n// and the dst pixel buffer's pixel format.\n//\n// The two pixel buffers' top-left corners are aligned. The pi" +
+	"xels converted\n// are those in both pixel buffers: the minimum of their widths and heights.\n// Subsampled (chroma) planes are upsampled by sample replication, conscious\n// of the src pixel buffer's pixel subsampling.\n//\n// For modular builds that divide the base module into sub-modules, using this\n// function requires the WUFFS_CONFIG__MODULE__BASE__PIXCONV sub-module, not\n// just WUFFS_CONFIG__MODULE__BASE__CORE.\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__pixel_swizzler__swizzle_planar(const wuffs_base__pixel_swizzler* p,\n                                           wuffs_base__pixel_buffer* dst,\n                                           const wuffs_base__pixel_buffer* src);\n\n#ifdef __cplusplus\n\ninline wuffs_base__status  //\nwuffs_base__pixel_swizzler::prepare(wuffs_base__pixel_format dst_format,\n                                    wuffs_base__slice_u8 dst_palette,\n                                    wuffs_base__pixel_format src_format,\n                                    wuffs_base__slice_u8" +
+	" src_palette,\n                                    wuffs_base__pixel_blend blend) {\n  return wuffs_base__pixel_swizzler__prepare(this, dst_format, dst_palette,\n                                             src_format, src_palette, blend);\n}\n\ninline wuffs_base__status  //\nwuffs_base__pixel_swizzler::prepare_quantizing(\n    wuffs_base__pixel_palette_lookup* lookup,\n    wuffs_base__pixel_format dst_format,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__pixel_format src_format,\n    wuffs_base__pixel_blend blend) {\n  return wuffs_base__pixel_swizzler__prepare_quantizing(\n      this, lookup, dst_format, dst_palette, src_format, blend);\n}\n\nuint64_t  //\nwuffs_base__pixel_swizzler::swizzle_interleaved(\n    wuffs_base__slice_u8 dst,\n    wuffs_base__slice_u8 dst_palette,\n    wuffs_base__slice_u8 src) const {\n  return wuffs_base__pixel_swizzler__swizzle_interleaved(this, dst, dst_palette,\n                                                         src);\n}\n\ninline wuffs_base__status  //\nwuffs_base__pixel_swizzler::swizz" +
+	"le_planar(\n    wuffs_base__pixel_buffer* dst,\n    const wuffs_base__pixel_buffer* src) const {\n  return wuffs_base__pixel_swizzler__swizzle_planar(this, dst, src);\n}\n\n#endif  // __cplusplus\n" +
 	""
 
 const baseIOPrivateH = "" +
 	"// ---------------- I/O\n\nstatic inline uint64_t  //\nwuffs_base__io__count_since(uint64_t mark, uint64_t index) {\n  if (index >= mark) {\n    return index - mark;\n  }\n  return 0;\n}\n\nstatic inline wuffs_base__slice_u8  //\nwuffs_base__io__since(uint64_t mark, uint64_t index, uint8_t* ptr) {\n  if (index >= mark) {\n    return wuffs_base__make_slice_u8(ptr + mark, index - mark);\n  }\n  return wuffs_base__make_slice_u8(NULL, 0);\n}\n\nstatic inline uint32_t  //\nwuffs_base__io_writer__copy_n32_from_history(uint8_t** ptr_iop_w,\n                                             uint8_t* io1_w,\n                                             uint8_t* io2_w,\n                                             uint32_t length,\n                                             uint32_t distance) {\n  if (!distance) {\n    return 0;\n  }\n  uint8_t* p = *ptr_iop_w;\n  if ((size_t)(p - io1_w) < (size_t)(distance)) {\n    return 0;\n  }\n  uint8_t* q = p - distance;\n  size_t n = (size_t)(io2_w - p);\n  if ((size_t)(length) > n) {\n    length = (uint32_t)(n);\n " +
-	" } else {\n    n = (size_t)(length);\n  }\n  // TODO: unrolling by 3 seems best for the std/deflate benchmarks, but that\n  // is mostly because 3 is the minimum length for the deflate format. This\n  // function implementation shouldn't overfit to that one format. Perhaps the\n  // copy_n32_from_history Wuffs method should also take an unroll hint\n  // argument, and the cgen can look if that argument is the constant\n  // expression '3'.\n  //\n  // See also wuffs_base__io_writer__copy_n32_from_history_fast below.\n  //\n  // Alternatively, or additionally, have a sloppy_copy_n32_from_history method\n  // that copies 8 bytes at a time, possibly writing more than length bytes?\n  for (; n >= 3; n -= 3) {\n    *p++ = *q++;\n    *p++ = *q++;\n    *p++ = *q++;\n  }\n  for (; n; n--) {\n    *p++ = *q++;\n  }\n  *ptr_iop_w = p;\n  return length;\n}\n\n// wuffs_base__io_writer__copy_n32_from_history_fast is like the\n// wuffs_base__io_writer__copy_n32_from_history function above, but has\n// stronger pre-conditions. The caller needs to prove" +
-	" that:\n//  - distance >  0\n//  - distance <= (*ptr_iop_w - io1_w)\n//  - length   <= (io2_w      - *ptr_iop_w)\nstatic inline uint32_t  //\nwuffs_base__io_writer__copy_n32_from_history_fast(uint8_t** ptr_iop_w,\n                                                  uint8_t* io1_w,\n                                                  uint8_t* io2_w,\n                                                  uint32_t length,\n                                                  uint32_t distance) {\n  uint8_t* p = *ptr_iop_w;\n  uint8_t* q = p - distance;\n  uint32_t n = length;\n  for (; n >= 3; n -= 3) {\n    *p++ = *q++;\n    *p++ = *q++;\n    *p++ = *q++;\n  }\n  for (; n; n--) {\n    *p++ = *q++;\n  }\n  *ptr_iop_w = p;\n  return length;\n}\n\nstatic inline uint32_t  //\nwuffs_base__io_writer__copy_n32_from_reader(uint8_t** ptr_iop_w,\n                                            uint8_t* io2_w,\n                                            uint32_t length,\n                                            const uint8_t** ptr_iop_r,\n                       " +
-	"                     const uint8_t* io2_r) {\n  uint8_t* iop_w = *ptr_iop_w;\n  size_t n = length;\n  if (n > ((size_t)(io2_w - iop_w))) {\n    n = (size_t)(io2_w - iop_w);\n  }\n  const uint8_t* iop_r = *ptr_iop_r;\n  if (n > ((size_t)(io2_r - iop_r))) {\n    n = (size_t)(io2_r - iop_r);\n  }\n  if (n > 0) {\n    memmove(iop_w, iop_r, n);\n    *ptr_iop_w += n;\n    *ptr_iop_r += n;\n  }\n  return (uint32_t)(n);\n}\n\nstatic inline uint64_t  //\nwuffs_base__io_writer__copy_from_slice(uint8_t** ptr_iop_w,\n                                       uint8_t* io2_w,\n                                       wuffs_base__slice_u8 src) {\n  uint8_t* iop_w = *ptr_iop_w;\n  size_t n = src.len;\n  if (n > ((size_t)(io2_w - iop_w))) {\n    n = (size_t)(io2_w - iop_w);\n  }\n  if (n > 0) {\n    memmove(iop_w, src.ptr, n);\n    *ptr_iop_w += n;\n  }\n  return (uint64_t)(n);\n}\n\nstatic inline uint32_t  //\nwuffs_base__io_writer__copy_n32_from_slice(uint8_t** ptr_iop_w,\n                                           uint8_t* io2_w,\n                                 " +
-	"          uint32_t length,\n                                           wuffs_base__slice_u8 src) {\n  uint8_t* iop_w = *ptr_iop_w;\n  size_t n = src.len;\n  if (n > length) {\n    n = length;\n  }\n  if (n > ((size_t)(io2_w - iop_w))) {\n    n = (size_t)(io2_w - iop_w);\n  }\n  if (n > 0) {\n    memmove(iop_w, src.ptr, n);\n    *ptr_iop_w += n;\n  }\n  return (uint32_t)(n);\n}\n\n// wuffs_base__io_reader__match7 returns whether the io_reader's upcoming bytes\n// start with the given prefix (up to 7 bytes long). It is peek-like, not\n// read-like, in that there are no side-effects.\n//\n// The low 3 bits of a hold the prefix length, n.\n//\n// The high 56 bits of a hold the prefix itself, in little-endian order. The\n// first prefix byte is in bits 8..=15, the second prefix byte is in bits\n// 16..=23, etc. The high (8 * (7 - n)) bits are ignored.\n//\n// There are three possible return values:\n//  - 0 means success.\n//  - 1 means inconclusive, equivalent to \"$short read\".\n//  - 2 means failure.\nstatic inline uint32_t  //\nwuffs_base__io" +
-	"_reader__match7(const uint8_t* iop_r,\n                              const uint8_t* io2_r,\n                              wuffs_base__io_buffer* r,\n                              uint64_t a) {\n  uint32_t n = a & 7;\n  a >>= 8;\n  if ((io2_r - iop_r) >= 8) {\n    uint64_t x = wuffs_base__load_u64le__no_bounds_check(iop_r);\n    uint32_t shift = 8 * (8 - n);\n    return ((a << shift) == (x << shift)) ? 0 : 2;\n  }\n  for (; n > 0; n--) {\n    if (iop_r >= io2_r) {\n      return (r && r->meta.closed) ? 2 : 1;\n    } else if (*iop_r != ((uint8_t)(a))) {\n      return 2;\n    }\n    iop_r++;\n    a >>= 8;\n  }\n  return 0;\n}\n\nstatic inline wuffs_base__io_buffer*  //\nwuffs_base__io_reader__set(wuffs_base__io_buffer* b,\n                           const uint8_t** ptr_iop_r,\n                           const uint8_t** ptr_io0_r,\n                           const uint8_t** ptr_io1_r,\n                           const uint8_t** ptr_io2_r,\n                           wuffs_base__slice_u8 data) {\n  b->data = data;\n  b->meta.wi = data.len;\n  b->" +
-	"meta.ri = 0;\n  b->meta.pos = 0;\n  b->meta.closed = false;\n\n  *ptr_iop_r = data.ptr;\n  *ptr_io0_r = data.ptr;\n  *ptr_io1_r = data.ptr;\n  *ptr_io2_r = data.ptr + data.len;\n\n  return b;\n}\n\n#pragma GCC diagnostic push\n#pragma GCC diagnostic ignored \"-Wcast-qual\"\n// TODO: can we avoid the const_cast (by deleting this function)? This might\n// involve converting the call sites to take an io_reader instead of a slice u8\n// (the result of io_reader.take).\nstatic inline wuffs_base__slice_u8  //\nwuffs_base__io_reader__take(const uint8_t** ptr_iop_r,\n                            const uint8_t* io2_r,\n                            uint64_t n) {\n  if (n <= ((size_t)(io2_r - *ptr_iop_r))) {\n    const uint8_t* p = *ptr_iop_r;\n    *ptr_iop_r += n;\n    // The arg is what C calls C++'s \"const_cast<uint8_t*>(p)\".\n    return wuffs_base__make_slice_u8((uint8_t*)(p), n);\n  }\n  return wuffs_base__make_slice_u8(NULL, 0);\n}\n#pragma GCC diagnostic pop\n\nstatic inline wuffs_base__io_buffer*  //\nwuffs_base__io_writer__set(wuffs_base__io_buff" +
-	"er* b,\n                           uint8_t** ptr_iop_w,\n                           uint8_t** ptr_io0_w,\n                           uint8_t** ptr_io1_w,\n                           uint8_t** ptr_io2_w,\n                           wuffs_base__slice_u8 data) {\n  b->data = data;\n  b->meta.wi = 0;\n  b->meta.ri = 0;\n  b->meta.pos = 0;\n  b->meta.closed = false;\n\n  *ptr_iop_w = data.ptr;\n  *ptr_io0_w = data.ptr;\n  *ptr_io1_w = data.ptr;\n  *ptr_io2_w = data.ptr + data.len;\n\n  return b;\n}\n\n  " +
+	" } else {\n    n = (size_t)(length);\n  }\n  // TODO: unrolling by 3 seems best for the std/deflate benchmarks, but that\n  // is mostly because 3 is the minimum length for the deflate format. This\n  // function implementation shouldn't overfit to that one format. Perhaps the\n  // copy_n32_from_history Wuffs method should also take an unroll hint\n  // argument, and the cgen can look if that argument is the constant\n  // expression '3'.\n  //\n  // See also wuffs_base__io_writer__copy_n32_from_history_fast below, and its\n  // _8_byte_chunks_etc variants that copy 8 bytes at a time.\n  for (; n >= 3; n -= 3) {\n    *p++ = *q++;\n    *p++ = *q++;\n    *p++ = *q++;\n  }\n  for (; n; n--) {\n    *p++ = *q++;\n  }\n  *ptr_iop_w = p;\n  return length;\n}\n\n// wuffs_base__io_writer__copy_n32_from_history_fast is like the\n// wuffs_base__io_writer__copy_n32_from_history function above, but has\n// stronger pre-conditions. The caller needs to prove that:\n//  - distance >  0\n//  - distance <= (*ptr_iop_w - io1_w)\n//  - length   <= (io2_w  " +
+	"    - *ptr_iop_w)\nstatic inline uint32_t  //\nwuffs_base__io_writer__copy_n32_from_history_fast(uint8_t** ptr_iop_w,\n                                                  uint8_t* io1_w,\n                                                  uint8_t* io2_w,\n                                                  uint32_t length,\n                                                  uint32_t distance) {\n  uint8_t* p = *ptr_iop_w;\n  uint8_t* q = p - distance;\n  uint32_t n = length;\n  for (; n >= 3; n -= 3) {\n    *p++ = *q++;\n    *p++ = *q++;\n    *p++ = *q++;\n  }\n  for (; n; n--) {\n    *p++ = *q++;\n  }\n  *ptr_iop_w = p;\n  return length;\n}\n\n// wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast is like the\n// wuffs_base__io_writer__copy_n32_from_history_fast function above, but\n// copies 8 bytes at a time. It can write up to 8 bytes past length (but only\n// advances *ptr_iop_w by length), so the caller needs to prove that:\n//  - distance >= 8\n//  - distance <= (*ptr_iop_w - io1_w)\n//  - (length + 8) <= (io2_w - *ptr_iop_" +
+	"w)\n//\n// A distance of at least 8 means that each 8 byte chunk's source does not\n// overlap its destination, even though a match can overlap itself.\nstatic inline uint32_t  //\nwuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast(\n    uint8_t** ptr_iop_w,\n    uint8_t* io1_w,\n    uint8_t* io2_w,\n    uint32_t length,\n    uint32_t distance) {\n  uint8_t* p = *ptr_iop_w;\n  uint8_t* q = p - distance;\n  uint32_t n = length;\n  while (true) {\n    memcpy(p, q, 8);\n    if (n <= 8) {\n      p += n;\n      break;\n    }\n    p += 8;\n    q += 8;\n    n -= 8;\n  }\n  *ptr_iop_w = p;\n  return length;\n}\n\n// wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_distance_1_fast\n// is like the wuffs_base__io_writer__copy_n32_from_history_8_byte_chunks_fast\n// function above, but for a distance of 1: a run of the previous byte. The\n// caller needs to prove that:\n//  - distance == 1\n//  - distance <= (*ptr_iop_w - io1_w)\n//  - (length + 8) <= (io2_w - *ptr_iop_w)\nstatic inline uint32_t  //\nwuffs_base__io_writer__copy_n32_f" +
+	"rom_history_8_byte_chunks_distance_1_fast(\n    uint8_t** ptr_iop_w,\n    uint8_t* io1_w,\n    uint8_t* io2_w,\n    uint32_t length,\n    uint32_t distance) {\n  uint8_t* p = *ptr_iop_w;\n  uint64_t x = p[-1];\n  x |= x << 8;\n  x |= x << 16;\n  x |= x << 32;\n  uint32_t n = length;\n  while (true) {\n    wuffs_base__store_u64le__no_bounds_check(p, x);\n    if (n <= 8) {\n      p += n;\n      break;\n    }\n    p += 8;\n    n -= 8;\n  }\n  *ptr_iop_w = p;\n  return length;\n}\n\nstatic inline uint32_t  //\nwuffs_base__io_writer__copy_n32_from_reader(uint8_t** ptr_iop_w,\n                                            uint8_t* io2_w,\n                                            uint32_t length,\n                                            const uint8_t** ptr_iop_r,\n                                            const uint8_t* io2_r) {\n  uint8_t* iop_w = *ptr_iop_w;\n  size_t n = length;\n  if (n > ((size_t)(io2_w - iop_w))) {\n    n = (size_t)(io2_w - iop_w);\n  }\n  const uint8_t* iop_r = *ptr_iop_r;\n  if (n > ((size_t)(io2_r - iop_r))) {\n    n = (" +
+	"size_t)(io2_r - iop_r);\n  }\n  if (n > 0) {\n    memmove(iop_w, iop_r, n);\n    *ptr_iop_w += n;\n    *ptr_iop_r += n;\n  }\n  return (uint32_t)(n);\n}\n\n// wuffs_base__io_writer__copy_n32_from_reader_16_byte_chunks_fast is like the\n// wuffs_base__io_writer__copy_n32_from_reader function above, but copies 16\n// bytes at a time. It can read and write up to 16 bytes past length (but only\n// advances *ptr_iop_w and *ptr_iop_r by length), so the caller needs to prove\n// that:\n//  - (length + 16) <= (io2_w - *ptr_iop_w)\n//  - (length + 16) <= (io2_r - *ptr_iop_r)\n//\n// Unlike wuffs_base__io_writer__copy_n32_from_reader, it uses memcpy instead\n// of memmove. Short copies are then a single (unaligned) 16 byte load and\n// store. The reader's and writer's buffers may still alias (e.g. decompressing\n// in place), so if the two (length + 16) byte ranges intersect, it falls back\n// to a memmove of exactly length bytes, which neither writes past length nor\n// clobbers source bytes that are yet to be read.\nstatic inline uint32_t  " +
+	"//\nwuffs_base__io_writer__copy_n32_from_reader_16_byte_chunks_fast(\n    uint8_t** ptr_iop_w,\n    uint8_t* io2_w,\n    uint32_t length,\n    const uint8_t** ptr_iop_r,\n    const uint8_t* io2_r) {\n  uint8_t* p = *ptr_iop_w;\n  const uint8_t* q = *ptr_iop_r;\n  uint32_t n = length;\n  // With m = (length + 16), the two ranges intersect if and only if -m < (q -\n  // p) < m, which is one unsigned comparison.\n  uintptr_t m = ((uintptr_t)length) + 16;\n  if (WUFFS_BASE__UNLIKELY(((uintptr_t)q - (uintptr_t)p + m - 1) <\n                           ((2 * m) - 1))) {\n    memmove(p, q, length);\n    *ptr_iop_w += length;\n    *ptr_iop_r += length;\n    return length;\n  }\n  while (true) {\n    memcpy(p, q, 16);\n    if (n <= 16) {\n      break;\n    }\n    p += 16;\n    q += 16;\n    n -= 16;\n  }\n  *ptr_iop_w += length;\n  *ptr_iop_r += length;\n  return length;\n}\n\nstatic inline uint64_t  //\nwuffs_base__io_writer__copy_from_slice(uint8_t** ptr_iop_w,\n                                       uint8_t* io2_w,\n                                    " +
+	"   wuffs_base__slice_u8 src) {\n  uint8_t* iop_w = *ptr_iop_w;\n  size_t n = src.len;\n  if (n > ((size_t)(io2_w - iop_w))) {\n    n = (size_t)(io2_w - iop_w);\n  }\n  if (n > 0) {\n    memmove(iop_w, src.ptr, n);\n    *ptr_iop_w += n;\n  }\n  return (uint64_t)(n);\n}\n\nstatic inline uint32_t  //\nwuffs_base__io_writer__copy_n32_from_slice(uint8_t** ptr_iop_w,\n                                           uint8_t* io2_w,\n                                           uint32_t length,\n                                           wuffs_base__slice_u8 src) {\n  uint8_t* iop_w = *ptr_iop_w;\n  size_t n = src.len;\n  if (n > length) {\n    n = length;\n  }\n  if (n > ((size_t)(io2_w - iop_w))) {\n    n = (size_t)(io2_w - iop_w);\n  }\n  if (n > 0) {\n    memmove(iop_w, src.ptr, n);\n    *ptr_iop_w += n;\n  }\n  return (uint32_t)(n);\n}\n\n// wuffs_base__io_reader__match7 returns whether the io_reader's upcoming bytes\n// start with the given prefix (up to 7 bytes long). It is peek-like, not\n// read-like, in that there are no side-effects.\n//\n// The low" +
+	" 3 bits of a hold the prefix length, n.\n//\n// The high 56 bits of a hold the prefix itself, in little-endian order. The\n// first prefix byte is in bits 8..=15, the second prefix byte is in bits\n// 16..=23, etc. The high (8 * (7 - n)) bits are ignored.\n//\n// There are three possible return values:\n//  - 0 means success.\n//  - 1 means inconclusive, equivalent to \"$short read\".\n//  - 2 means failure.\nstatic inline uint32_t  //\nwuffs_base__io_reader__match7(const uint8_t* iop_r,\n                              const uint8_t* io2_r,\n                              wuffs_base__io_buffer* r,\n                              uint64_t a) {\n  uint32_t n = a & 7;\n  a >>= 8;\n  if ((io2_r - iop_r) >= 8) {\n    uint64_t x = wuffs_base__load_u64le__no_bounds_check(iop_r);\n    uint32_t shift = 8 * (8 - n);\n    return ((a << shift) == (x << shift)) ? 0 : 2;\n  }\n  for (; n > 0; n--) {\n    if (iop_r >= io2_r) {\n      return (r && r->meta.closed) ? 2 : 1;\n    } else if (*iop_r != ((uint8_t)(a))) {\n      return 2;\n    }\n    iop_r++;\n    " +
+	"a >>= 8;\n  }\n  return 0;\n}\n\nstatic inline wuffs_base__io_buffer*  //\nwuffs_base__io_reader__set(wuffs_base__io_buffer* b,\n                           const uint8_t** ptr_iop_r,\n                           const uint8_t** ptr_io0_r,\n                           const uint8_t** ptr_io1_r,\n                           const uint8_t** ptr_io2_r,\n                           wuffs_base__slice_u8 data) {\n  b->data = data;\n  b->meta.wi = data.len;\n  b->meta.ri = 0;\n  b->meta.pos = 0;\n  b->meta.closed = false;\n\n  *ptr_iop_r = data.ptr;\n  *ptr_io0_r = data.ptr;\n  *ptr_io1_r = data.ptr;\n  *ptr_io2_r = data.ptr + data.len;\n\n  return b;\n}\n\n#pragma GCC diagnostic push\n#pragma GCC diagnostic ignored \"-Wcast-qual\"\nstatic inline wuffs_base__slice_u8  //\nwuffs_base__io_reader__since(uint64_t mark,\n                             uint64_t index,\n                             const uint8_t* ptr) {\n  if (index >= mark) {\n    // The arg is what C calls C++'s \"const_cast<uint8_t*>(ptr)\".\n    return wuffs_base__make_slice_u8(((uint8_t*)(ptr)) " +
+	"+ mark, index - mark);\n  }\n  return wuffs_base__make_slice_u8(NULL, 0);\n}\n#pragma GCC diagnostic pop\n\n#pragma GCC diagnostic push\n#pragma GCC diagnostic ignored \"-Wcast-qual\"\n// TODO: can we avoid the const_cast (by deleting this function)? This might\n// involve converting the call sites to take an io_reader instead of a slice u8\n// (the result of io_reader.take).\nstatic inline wuffs_base__slice_u8  //\nwuffs_base__io_reader__take(const uint8_t** ptr_iop_r,\n                            const uint8_t* io2_r,\n                            uint64_t n) {\n  if (n <= ((size_t)(io2_r - *ptr_iop_r))) {\n    const uint8_t* p = *ptr_iop_r;\n    *ptr_iop_r += n;\n    // The arg is what C calls C++'s \"const_cast<uint8_t*>(p)\".\n    return wuffs_base__make_slice_u8((uint8_t*)(p), n);\n  }\n  return wuffs_base__make_slice_u8(NULL, 0);\n}\n#pragma GCC diagnostic pop\n\nstatic inline wuffs_base__io_buffer*  //\nwuffs_base__io_writer__set(wuffs_base__io_buffer* b,\n                           uint8_t** ptr_iop_w,\n                           ui" +
+	"nt8_t** ptr_io0_w,\n                           uint8_t** ptr_io1_w,\n                           uint8_t** ptr_io2_w,\n                           wuffs_base__slice_u8 data) {\n  b->data = data;\n  b->meta.wi = 0;\n  b->meta.ri = 0;\n  b->meta.pos = 0;\n  b->meta.closed = false;\n\n  *ptr_iop_w = data.ptr;\n  *ptr_io0_w = data.ptr;\n  *ptr_io1_w = data.ptr;\n  *ptr_io2_w = data.ptr + data.len;\n\n  return b;\n}\n\n  " +
 	"" +
 	"// ---------------- I/O (Utility)\n\n#define wuffs_base__utility__empty_io_reader wuffs_base__empty_io_reader\n#define wuffs_base__utility__empty_io_writer wuffs_base__empty_io_writer\n" +
 	""
@@ -403,10 +658,15 @@ const baseStrConvPublicH = "" +
 	"NUL-terminated C string.\n//  - It does not take an optional endptr argument. It does not allow a partial\n//    parse: it returns an error unless all of s is consumed.\n//  - It does not allow whitespace, leading or otherwise.\n//  - It does not allow a leading '+' or '-'.\n//  - It does not allow unnecessary leading zeroes (\"0\" is valid and its sole\n//    zero is necessary). All of \"00\", \"0644\" and \"007\" are invalid.\n//  - It does not take a base argument (e.g. base 10 vs base 16). Instead, it\n//    always accepts both decimal (e.g \"1234\", \"0d5678\") and hexadecimal (e.g.\n//    \"0x9aBC\"). The caller is responsible for prior filtering of e.g. hex\n//    numbers if they are unwanted. For example, Wuffs' JSON decoder will only\n//    produce a wuffs_base__token for decimal numbers, not hexadecimal.\n//  - It is not affected by i18n / l10n settings such as environment variables.\n//  - It does allow arbitrary underscores, except inside the optional 2-byte\n//    opening \"0d\" or \"0X\" that denotes base-10 or base-16. For ex" +
 	"ample,\n//    \"__0D_1_002\" would successfully parse as \"one thousand and two\".\nWUFFS_BASE__MAYBE_STATIC wuffs_base__result_u64  //\nwuffs_base__parse_number_u64(wuffs_base__slice_u8 s);\n\n" +
 	"" +
+	"// --------\n\n// Options (bitwise or'ed together) for wuffs_base__render_number_xxx\n// functions. The XXX options apply to both integer and floating point. The FXX\n// options apply only to floating point.\n\n#define WUFFS_BASE__RENDER_NUMBER_XXX__DEFAULT_OPTIONS ((uint32_t)0x00000000)\n\n// WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN means to render a leading\n// \"+\" for non-negative numbers: \"+0\" and \"+12.3\" instead of \"0\" and \"12.3\".\n#define WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN ((uint32_t)0x00000001)\n\n// WUFFS_BASE__RENDER_NUMBER_FXX__INF_NAN_AS_NULL means to render infinities\n// and NaNs as \"null\" instead of \"Infinity\", \"-Infinity\" and \"NaN\". JSON has no\n// representation for non-finite numbers.\n#define WUFFS_BASE__RENDER_NUMBER_FXX__INF_NAN_AS_NULL ((uint32_t)0x00000100)\n\n// WUFFS_BASE__XXX__BYTE_LENGTH__MAX_INCL is the maximum number of bytes that\n// the corresponding wuffs_base__render_number_xxx function will write,\n// regardless of its options. For example, \"-9223372036854775808\" and\n// \"+1" +
+	"8446744073709551615\" are 20 and 21 bytes long.\n#define WUFFS_BASE__I64__BYTE_LENGTH__MAX_INCL 20\n#define WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL 21\n#define WUFFS_BASE__F64__BYTE_LENGTH__MAX_INCL 25\n\n// wuffs_base__render_number_i64 writes the decimal representation of x to dst\n// and returns the number of bytes written. If dst is shorter than the entire\n// representation, it returns 0 (and no bytes are written).\n//\n// dst will never be too short if its length is at least 20, also known as\n// WUFFS_BASE__I64__BYTE_LENGTH__MAX_INCL.\n//\n// It is similar to wuffs_base__render_number_u64 but it takes a signed\n// integer, not an unsigned integer.\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__render_number_i64(wuffs_base__slice_u8 dst,\n                              int64_t x,\n                              uint32_t options);\n\n// wuffs_base__render_number_u64 writes the decimal representation of x to dst\n// and returns the number of bytes written. If dst is shorter than the entire\n// representation, it returns 0 (and" +
+	" no bytes are written).\n//\n// dst will never be too short if its length is at least 21, also known as\n// WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL.\n//\n// Unlike snprintf, it does not write a trailing NUL byte.\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__render_number_u64(wuffs_base__slice_u8 dst,\n                              uint64_t x,\n                              uint32_t options);\n\n" +
+	"" +
 	"// ---------------- IEEE 754 Floating Point\n\n// wuffs_base__parse_number_f64 parses the floating point number in s. For\n// example, if s contains the bytes \"1.5\" then it will return the double 1.5.\n//\n// It returns an error if s does not contain a floating point number.\n//\n// It does not necessarily return an error if the conversion is lossy, e.g. if\n// s is \"0.3\", which double-precision floating point cannot represent exactly.\n//\n// Similarly, the returned value may be infinite (and no error returned) even\n// if s was not \"inf\", when the input is nominally finite but sufficiently\n// larger than DBL_MAX, about 1.8e+308.\n//\n// It is similar to the C standard library's strtod function, but:\n//  - Errors are returned in-band (in a result type), not out-of-band (errno).\n//  - It takes a slice (a pointer and length), not a NUL-terminated C string.\n//  - It does not take an optional endptr argument. It does not allow a partial\n//    parse: it returns an error unless all of s is consumed.\n//  - It does not allow whi" +
 	"tespace, leading or otherwise.\n//  - It does not allow unnecessary leading zeroes (\"0\" is valid and its sole\n//    zero is necessary). All of \"00\", \"0644\" and \"00.7\" are invalid.\n//  - It is not affected by i18n / l10n settings such as environment variables.\n//  - Conversely, it always accepts either ',' or '.' as a decimal separator.\n//    In particular, \"3,141,592\" is always invalid but \"3,141\" is always valid\n//    (and approximately π). The caller is responsible for e.g. previously\n//    rejecting or filtering s if it contains a comma, if that is unacceptable\n//    to the caller. For example, JSON numbers always use a dot '.' and never a\n//    comma ',', regardless of the LOCALE environment variable.\n//  - It does allow arbitrary underscores. For example, \"_3.141_592\" would\n//    successfully parse, again approximately π.\n//  - It does allow \"inf\", \"+Infinity\" and \"-NAN\", case insensitive, but it\n//    does not permit \"nan\" to be followed by an integer mantissa.\n//  - It does not allow hexadecimal float" +
-	"ing point numbers.\n//\n// For modular builds that divide the base module into sub-modules, using this\n// function requires the WUFFS_CONFIG__MODULE__BASE__F64CONV sub-module, not\n// just WUFFS_CONFIG__MODULE__BASE__CORE.\nWUFFS_BASE__MAYBE_STATIC wuffs_base__result_f64  //\nwuffs_base__parse_number_f64(wuffs_base__slice_u8 s);\n\n// wuffs_base__ieee_754_bit_representation__etc converts between a double\n// precision numerical value and its IEEE 754 64-bit representation (1 sign\n// bit, 11 exponent bits, 52 explicit significand bits).\n//\n// For example, it converts between:\n//  - +1.0 and 0x3FF0_0000_0000_0000.\n//  - +5.5 and 0x4016_0000_0000_0000.\n//  - -inf and 0xFFF0_0000_0000_0000.\n//\n// See https://en.wikipedia.org/wiki/Double-precision_floating-point_format\n\nstatic inline uint64_t  //\nwuffs_base__ieee_754_bit_representation__from_f64(double f) {\n  uint64_t u = 0;\n  if (sizeof(uint64_t) == sizeof(double)) {\n    memcpy(&u, &f, sizeof(uint64_t));\n  }\n  return u;\n}\n\nstatic inline double  //\nwuffs_base__ieee_754_bi" +
-	"t_representation__to_f64(uint64_t u) {\n  double f = 0;\n  if (sizeof(uint64_t) == sizeof(double)) {\n    memcpy(&f, &u, sizeof(uint64_t));\n  }\n  return f;\n}\n\n" +
+	"ing point numbers.\n//\n// For modular builds that divide the base module into sub-modules, using this\n// function requires the WUFFS_CONFIG__MODULE__BASE__F64CONV sub-module, not\n// just WUFFS_CONFIG__MODULE__BASE__CORE.\nWUFFS_BASE__MAYBE_STATIC wuffs_base__result_f64  //\nwuffs_base__parse_number_f64(wuffs_base__slice_u8 s);\n\n// wuffs_base__render_number_f64 writes the decimal representation of x to dst\n// and returns the number of bytes written. If dst is shorter than the entire\n// representation, it returns 0 (and no bytes are written).\n//\n// dst will never be too short if its length is at least 25, also known as\n// WUFFS_BASE__F64__BYTE_LENGTH__MAX_INCL.\n//\n// The representation has the fewest significant digits that still round-trip:\n// wuffs_base__parse_number_f64 of the rendered bytes produces exactly x. When\n// there is more than one such shortest representation, it picks the one\n// closest to x. For example, it renders 0.3 as \"0.3\", not\n// \"0.299999999999999988898\" or \"0.30000000000000000\".\n//\n// The l" +
+	"ayout otherwise follows ECMAScript's Number.prototype.toString: a\n// decimal separator is always '.', never ','; positional notation is used when\n// the base-10 exponent is in the range [-6 ..= 20]; otherwise it uses\n// exponential notation with an explicit exponent sign. For example, \"123\",\n// \"0.000456\" and \"1.5e+300\". Unlike ECMAScript, negative zero is rendered as\n// \"-0\", since \"0\" would not round-trip.\n//\n// For modular builds that divide the base module into sub-modules, using this\n// function requires the WUFFS_CONFIG__MODULE__BASE__F64CONV sub-module, not\n// just WUFFS_CONFIG__MODULE__BASE__CORE.\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__render_number_f64(wuffs_base__slice_u8 dst,\n                              double x,\n                              uint32_t options);\n\n// wuffs_base__ieee_754_bit_representation__etc converts between a double\n// precision numerical value and its IEEE 754 64-bit representation (1 sign\n// bit, 11 exponent bits, 52 explicit significand bits).\n//\n// For example, it " +
+	"converts between:\n//  - +1.0 and 0x3FF0_0000_0000_0000.\n//  - +5.5 and 0x4016_0000_0000_0000.\n//  - -inf and 0xFFF0_0000_0000_0000.\n//\n// See https://en.wikipedia.org/wiki/Double-precision_floating-point_format\n\nstatic inline uint64_t  //\nwuffs_base__ieee_754_bit_representation__from_f64(double f) {\n  uint64_t u = 0;\n  if (sizeof(uint64_t) == sizeof(double)) {\n    memcpy(&u, &f, sizeof(uint64_t));\n  }\n  return u;\n}\n\nstatic inline double  //\nwuffs_base__ieee_754_bit_representation__to_f64(uint64_t u) {\n  double f = 0;\n  if (sizeof(uint64_t) == sizeof(double)) {\n    memcpy(&f, &u, sizeof(uint64_t));\n  }\n  return f;\n}\n\n" +
 	"" +
 	"// ---------------- Hexadecimal\n\n// wuffs_base__hexadecimal__decode2 converts \"6A6b\" to \"jk\", where e.g. 'j' is\n// U+006A. There are 2 source bytes for every destination byte.\n//\n// It returns the number of dst bytes written: the minimum of dst.len and\n// (src.len / 2). Excess source bytes are ignored.\n//\n// It assumes that the src bytes are two hexadecimal digits (0-9, A-F, a-f),\n// repeated. It may write nonsense bytes if not, although it will not read or\n// write out of bounds.\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__hexadecimal__decode2(wuffs_base__slice_u8 dst,\n                                 wuffs_base__slice_u8 src);\n\n// wuffs_base__hexadecimal__decode4 converts \"\\\\x6A\\\\x6b\" to \"jk\", where e.g.\n// 'j' is U+006A. There are 4 source bytes for every destination byte.\n//\n// It returns the number of dst bytes written: the minimum of dst.len and\n// (src.len / 4). Excess source bytes are ignored.\n//\n// It assumes that the src bytes are two ignored bytes and then two hexadecimal\n// digits (0-9, A-F, a" +
 	"-f), repeated. It may write nonsense bytes if not,\n// although it will not read or write out of bounds.\nWUFFS_BASE__MAYBE_STATIC size_t  //\nwuffs_base__hexadecimal__decode4(wuffs_base__slice_u8 dst,\n                                 wuffs_base__slice_u8 src);\n\n" +
@@ -453,11 +713,27 @@ const baseTokenPublicH = "" +
 	"" +
 	"// --------\n\ntypedef WUFFS_BASE__SLICE(wuffs_base__token) wuffs_base__slice_token;\n\nstatic inline wuffs_base__slice_token  //\nwuffs_base__make_slice_token(wuffs_base__token* ptr, size_t len) {\n  wuffs_base__slice_token ret;\n  ret.ptr = ptr;\n  ret.len = len;\n  return ret;\n}\n\n" +
 	"" +
-	"// --------\n\n// wuffs_base__token_buffer_meta is the metadata for a\n// wuffs_base__token_buffer's data.\ntypedef struct {\n  size_t wi;     // Write index. Invariant: wi <= len.\n  size_t ri;     // Read  index. Invariant: ri <= wi.\n  uint64_t pos;  // Position of the buffer start relative to the stream start.\n  bool closed;   // No further writes are expected.\n} wuffs_base__token_buffer_meta;\n\n// wuffs_base__token_buffer is a 1-dimensional buffer (a pointer and length)\n// plus additional metadata.\n//\n// A value with all fields zero is a valid, empty buffer.\ntypedef struct {\n  wuffs_base__slice_token data;\n  wuffs_base__token_buffer_meta meta;\n\n#ifdef __cplusplus\n  inline bool is_valid() const;\n  inline void compact();\n  inline uint64_t reader_available() const;\n  inline uint64_t reader_token_position() const;\n  inline uint64_t writer_available() const;\n  inline uint64_t writer_token_position() const;\n#endif  // __cplusplus\n\n} wuffs_base__token_buffer;\n\nstatic inline wuffs_base__token_buffer  //\nwuffs_base__make" +
-	"_token_buffer(wuffs_base__slice_token data,\n                              wuffs_base__token_buffer_meta meta) {\n  wuffs_base__token_buffer ret;\n  ret.data = data;\n  ret.meta = meta;\n  return ret;\n}\n\nstatic inline wuffs_base__token_buffer_meta  //\nwuffs_base__make_token_buffer_meta(size_t wi,\n                                   size_t ri,\n                                   uint64_t pos,\n                                   bool closed) {\n  wuffs_base__token_buffer_meta ret;\n  ret.wi = wi;\n  ret.ri = ri;\n  ret.pos = pos;\n  ret.closed = closed;\n  return ret;\n}\n\nstatic inline wuffs_base__token_buffer  //\nwuffs_base__slice_token__reader(wuffs_base__slice_token s, bool closed) {\n  wuffs_base__token_buffer ret;\n  ret.data.ptr = s.ptr;\n  ret.data.len = s.len;\n  ret.meta.wi = s.len;\n  ret.meta.ri = 0;\n  ret.meta.pos = 0;\n  ret.meta.closed = closed;\n  return ret;\n}\n\nstatic inline wuffs_base__token_buffer  //\nwuffs_base__slice_token__writer(wuffs_base__slice_token s) {\n  wuffs_base__token_buffer ret;\n  ret.data.ptr = s.ptr" +
-	";\n  ret.data.len = s.len;\n  ret.meta.wi = 0;\n  ret.meta.ri = 0;\n  ret.meta.pos = 0;\n  ret.meta.closed = false;\n  return ret;\n}\n\nstatic inline wuffs_base__token_buffer  //\nwuffs_base__empty_token_buffer() {\n  wuffs_base__token_buffer ret;\n  ret.data.ptr = NULL;\n  ret.data.len = 0;\n  ret.meta.wi = 0;\n  ret.meta.ri = 0;\n  ret.meta.pos = 0;\n  ret.meta.closed = false;\n  return ret;\n}\n\nstatic inline wuffs_base__token_buffer_meta  //\nwuffs_base__empty_token_buffer_meta() {\n  wuffs_base__token_buffer_meta ret;\n  ret.wi = 0;\n  ret.ri = 0;\n  ret.pos = 0;\n  ret.closed = false;\n  return ret;\n}\n\nstatic inline bool  //\nwuffs_base__token_buffer__is_valid(const wuffs_base__token_buffer* buf) {\n  if (buf) {\n    if (buf->data.ptr) {\n      return (buf->meta.ri <= buf->meta.wi) && (buf->meta.wi <= buf->data.len);\n    } else {\n      return (buf->meta.ri == 0) && (buf->meta.wi == 0) && (buf->data.len == 0);\n    }\n  }\n  return false;\n}\n\n// wuffs_base__token_buffer__compact moves any written but unread tokens to the\n// start of the " +
-	"buffer.\nstatic inline void  //\nwuffs_base__token_buffer__compact(wuffs_base__token_buffer* buf) {\n  if (!buf || (buf->meta.ri == 0)) {\n    return;\n  }\n  buf->meta.pos = wuffs_base__u64__sat_add(buf->meta.pos, buf->meta.ri);\n  size_t n = buf->meta.wi - buf->meta.ri;\n  if (n != 0) {\n    memmove(buf->data.ptr, buf->data.ptr + buf->meta.ri,\n            n * sizeof(wuffs_base__token));\n  }\n  buf->meta.wi = n;\n  buf->meta.ri = 0;\n}\n\nstatic inline uint64_t  //\nwuffs_base__token_buffer__reader_available(\n    const wuffs_base__token_buffer* buf) {\n  return buf ? buf->meta.wi - buf->meta.ri : 0;\n}\n\nstatic inline uint64_t  //\nwuffs_base__token_buffer__reader_token_position(\n    const wuffs_base__token_buffer* buf) {\n  return buf ? wuffs_base__u64__sat_add(buf->meta.pos, buf->meta.ri) : 0;\n}\n\nstatic inline uint64_t  //\nwuffs_base__token_buffer__writer_available(\n    const wuffs_base__token_buffer* buf) {\n  return buf ? buf->data.len - buf->meta.wi : 0;\n}\n\nstatic inline uint64_t  //\nwuffs_base__token_buffer__writer_token_p" +
-	"osition(\n    const wuffs_base__token_buffer* buf) {\n  return buf ? wuffs_base__u64__sat_add(buf->meta.pos, buf->meta.wi) : 0;\n}\n\n#ifdef __cplusplus\n\ninline bool  //\nwuffs_base__token_buffer::is_valid() const {\n  return wuffs_base__token_buffer__is_valid(this);\n}\n\ninline void  //\nwuffs_base__token_buffer::compact() {\n  wuffs_base__token_buffer__compact(this);\n}\n\ninline uint64_t  //\nwuffs_base__token_buffer::reader_available() const {\n  return wuffs_base__token_buffer__reader_available(this);\n}\n\ninline uint64_t  //\nwuffs_base__token_buffer::reader_token_position() const {\n  return wuffs_base__token_buffer__reader_token_position(this);\n}\n\ninline uint64_t  //\nwuffs_base__token_buffer::writer_available() const {\n  return wuffs_base__token_buffer__writer_available(this);\n}\n\ninline uint64_t  //\nwuffs_base__token_buffer::writer_token_position() const {\n  return wuffs_base__token_buffer__writer_token_position(this);\n}\n\n#endif  // __cplusplus\n" +
+	"// --------\n\n// wuffs_base__token_buffer_meta is the metadata for a\n// wuffs_base__token_buffer's data.\ntypedef struct {\n  size_t wi;     // Write index. Invariant: wi <= len.\n  size_t ri;     // Read  index. Invariant: ri <= wi.\n  uint64_t pos;  // Position of the buffer start relative to the stream start.\n  bool closed;   // No further writes are expected.\n} wuffs_base__token_buffer_meta;\n\n// wuffs_base__token_buffer is a 1-dimensional buffer (a pointer and length)\n// plus additional metadata.\n//\n// A value with all fields zero is a valid, empty buffer.\ntypedef struct {\n  wuffs_base__slice_token data;\n  wuffs_base__token_buffer_meta meta;\n\n#ifdef __cplusplus\n  inline bool is_valid() const;\n  inline void compact();\n  inline uint64_t reader_available() const;\n  inline uint64_t reader_category_run() const;\n  inline uint64_t reader_copy_run() const;\n  inline uint64_t reader_token_position() const;\n  inline uint64_t writer_available() const;\n  inline uint64_t writer_token_position() const;\n#endif  // __cplusplus" +
+	"\n\n} wuffs_base__token_buffer;\n\nstatic inline wuffs_base__token_buffer  //\nwuffs_base__make_token_buffer(wuffs_base__slice_token data,\n                              wuffs_base__token_buffer_meta meta) {\n  wuffs_base__token_buffer ret;\n  ret.data = data;\n  ret.meta = meta;\n  return ret;\n}\n\nstatic inline wuffs_base__token_buffer_meta  //\nwuffs_base__make_token_buffer_meta(size_t wi,\n                                   size_t ri,\n                                   uint64_t pos,\n                                   bool closed) {\n  wuffs_base__token_buffer_meta ret;\n  ret.wi = wi;\n  ret.ri = ri;\n  ret.pos = pos;\n  ret.closed = closed;\n  return ret;\n}\n\nstatic inline wuffs_base__token_buffer  //\nwuffs_base__slice_token__reader(wuffs_base__slice_token s, bool closed) {\n  wuffs_base__token_buffer ret;\n  ret.data.ptr = s.ptr;\n  ret.data.len = s.len;\n  ret.meta.wi = s.len;\n  ret.meta.ri = 0;\n  ret.meta.pos = 0;\n  ret.meta.closed = closed;\n  return ret;\n}\n\nstatic inline wuffs_base__token_buffer  //\nwuffs_base__slice_token__" +
+	"writer(wuffs_base__slice_token s) {\n  wuffs_base__token_buffer ret;\n  ret.data.ptr = s.ptr;\n  ret.data.len = s.len;\n  ret.meta.wi = 0;\n  ret.meta.ri = 0;\n  ret.meta.pos = 0;\n  ret.meta.closed = false;\n  return ret;\n}\n\nstatic inline wuffs_base__token_buffer  //\nwuffs_base__empty_token_buffer() {\n  wuffs_base__token_buffer ret;\n  ret.data.ptr = NULL;\n  ret.data.len = 0;\n  ret.meta.wi = 0;\n  ret.meta.ri = 0;\n  ret.meta.pos = 0;\n  ret.meta.closed = false;\n  return ret;\n}\n\nstatic inline wuffs_base__token_buffer_meta  //\nwuffs_base__empty_token_buffer_meta() {\n  wuffs_base__token_buffer_meta ret;\n  ret.wi = 0;\n  ret.ri = 0;\n  ret.pos = 0;\n  ret.closed = false;\n  return ret;\n}\n\nstatic inline bool  //\nwuffs_base__token_buffer__is_valid(const wuffs_base__token_buffer* buf) {\n  if (buf) {\n    if (buf->data.ptr) {\n      return (buf->meta.ri <= buf->meta.wi) && (buf->meta.wi <= buf->data.len);\n    } else {\n      return (buf->meta.ri == 0) && (buf->meta.wi == 0) && (buf->data.len == 0);\n    }\n  }\n  return false;\n}\n\n// wuf" +
+	"fs_base__token_buffer__compact moves any written but unread tokens to the\n// start of the buffer.\nstatic inline void  //\nwuffs_base__token_buffer__compact(wuffs_base__token_buffer* buf) {\n  if (!buf || (buf->meta.ri == 0)) {\n    return;\n  }\n  buf->meta.pos = wuffs_base__u64__sat_add(buf->meta.pos, buf->meta.ri);\n  size_t n = buf->meta.wi - buf->meta.ri;\n  if (n != 0) {\n    memmove(buf->data.ptr, buf->data.ptr + buf->meta.ri,\n            n * sizeof(wuffs_base__token));\n  }\n  buf->meta.wi = n;\n  buf->meta.ri = 0;\n}\n\nstatic inline uint64_t  //\nwuffs_base__token_buffer__reader_available(\n    const wuffs_base__token_buffer* buf) {\n  return buf ? buf->meta.wi - buf->meta.ri : 0;\n}\n\n// wuffs_base__token_buffer__reader_category_run returns the number of\n// readable tokens, starting at the read index, that have the same\n// value_base_category as the first one. For extended tokens and for tokens\n// with a non-zero value_major, this compares the value_major (and more) too.\n// It returns zero if and only if there are no " +
+	"readable tokens.\n//\n// Callers can use this to consume tokens in batches, handling a run of e.g.\n// filler tokens or string tokens in one step instead of dispatching on each\n// token's category. Runs do not stop at the end of a token chain, so callers\n// that care about chain boundaries still need to check each token's continued\n// bit.\nstatic inline uint64_t  //\nwuffs_base__token_buffer__reader_category_run(\n    const wuffs_base__token_buffer* buf) {\n  if (!buf || (buf->meta.ri >= buf->meta.wi)) {\n    return 0;\n  }\n  const wuffs_base__token* p = buf->data.ptr + buf->meta.ri;\n  const wuffs_base__token* q = buf->data.ptr + buf->meta.wi;\n  uint64_t c = p->repr >> WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT;\n  const wuffs_base__token* r = p + 1;\n  while ((r < q) &&\n         ((r->repr >> WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT) == c)) {\n    r++;\n  }\n  return (uint64_t)(r - p);\n}\n\n// wuffs_base__token_buffer__reader_copy_run returns the number of readable\n// tokens, starting at the read index, that are str" +
+	"ing tokens with the\n// CONVERT_1_DST_1_SRC_COPY conversion, stopping after (and including) the\n// first one that is not continued. It returns zero if the first readable\n// token (if any) is not such a token.\n//\n// Such a run is a single span of source bytes, whose length is the sum of its\n// tokens' lengths, and that span converts verbatim to the destination. The\n// maximum token length means that a decoder has to split a long run of\n// unescaped bytes into multiple tokens. A decoder (such as std/json's) may\n// also split runs when it suspends, e.g. when the source buffer is empty, but\n// when a run is decoded in one decode_tokens call, this lets a consumer\n// coalesce its tokens and then copy the whole span at once.\nstatic inline uint64_t  //\nwuffs_base__token_buffer__reader_copy_run(const wuffs_base__token_buffer* buf) {\n  if (!buf) {\n    return 0;\n  }\n  const wuffs_base__token* p = buf->data.ptr + buf->meta.ri;\n  const wuffs_base__token* q = buf->data.ptr + buf->meta.wi;\n  const wuffs_base__token* r = p;\n " +
+	" for (; r < q; r++) {\n    uint64_t repr = r->repr;\n    if (((repr >> WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT) !=\n         WUFFS_BASE__TOKEN__VBC__STRING) ||\n        !(repr &\n          (((uint64_t)WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY)\n           << WUFFS_BASE__TOKEN__VALUE_BASE_DETAIL__SHIFT))) {\n      break;\n    } else if (!(repr &\n                 (((uint64_t)1) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT))) {\n      r++;\n      break;\n    }\n  }\n  return (uint64_t)(r - p);\n}\n\nstatic inline uint64_t  //\nwuffs_base__token_buffer__reader_token_position(\n    const wuffs_base__token_buffer* buf) {\n  return buf ? wuffs_base__u64__sat_add(buf->meta.pos, buf->meta.ri) : 0;\n}\n\nstatic inline uint64_t  //\nwuffs_base__token_buffer__writer_available(\n    const wuffs_base__token_buffer* buf) {\n  return buf ? buf->data.len - buf->meta.wi : 0;\n}\n\nstatic inline uint64_t  //\nwuffs_base__token_buffer__writer_token_position(\n    const wuffs_base__token_buffer* buf) {\n  return buf ? wuffs_base__u64__sat_add(bu" +
+	"f->meta.pos, buf->meta.wi) : 0;\n}\n\n#ifdef __cplusplus\n\ninline bool  //\nwuffs_base__token_buffer::is_valid() const {\n  return wuffs_base__token_buffer__is_valid(this);\n}\n\ninline void  //\nwuffs_base__token_buffer::compact() {\n  wuffs_base__token_buffer__compact(this);\n}\n\ninline uint64_t  //\nwuffs_base__token_buffer::reader_available() const {\n  return wuffs_base__token_buffer__reader_available(this);\n}\n\ninline uint64_t  //\nwuffs_base__token_buffer::reader_category_run() const {\n  return wuffs_base__token_buffer__reader_category_run(this);\n}\n\ninline uint64_t  //\nwuffs_base__token_buffer::reader_copy_run() const {\n  return wuffs_base__token_buffer__reader_copy_run(this);\n}\n\ninline uint64_t  //\nwuffs_base__token_buffer::reader_token_position() const {\n  return wuffs_base__token_buffer__reader_token_position(this);\n}\n\ninline uint64_t  //\nwuffs_base__token_buffer::writer_available() const {\n  return wuffs_base__token_buffer__writer_available(this);\n}\n\ninline uint64_t  //\nwuffs_base__token_buffer::writer_token_positi" +
+	"on() const {\n  return wuffs_base__token_buffer__writer_token_position(this);\n}\n\n#endif  // __cplusplus\n\n" +
+	"" +
+	"// ---------------- Token Tapes\n\n// wuffs_base__tape_node is an element of a token tape: a flat array of the\n// values (not the tokens) of a fully buffered token stream, in pre-order.\n// Arrays and objects are \"lists\" and \"dicts\", as per the\n// WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_ETC bits. A dict node's children\n// alternate between keys and values.\n//\n// data is the node's bytes. For LITERAL and NUMBER nodes, they are the source\n// bytes, e.g. \"true\" or \"-1.5e3\". For LIST and DICT nodes, they are the source\n// bytes from the opening '[' or '{' to the closing ']' or '}' inclusive. For\n// STRING nodes, they are the converted string (without quotes or escapes).\n// This points into the source, without copying, unless the FLAG__CONVERTED\n// bit is set, in which case it points into the tape builder's arena.\n//\n// repr packs the kind (one of WUFFS_BASE__TAPE_NODE__KIND__ETC), the flags and\n// the value_base_detail of the node's first token. For example, that detail\n// discriminates true from false and integers fr" +
+	"om floating point numbers.\n//\n// skip is the number of nodes in the sub-tree rooted at this node, including\n// the node itself. It is 1 for everything other than non-empty lists and\n// dicts. If this node is at index i, then its first child (if any) is at index\n// (i + 1) and its next sibling (if any) is at index (i + skip).\ntypedef struct {\n  wuffs_base__slice_u8 data;\n  uint32_t repr;\n  uint32_t skip;\n\n#ifdef __cplusplus\n  inline uint32_t kind() const;\n  inline uint32_t detail() const;\n  inline bool converted() const;\n#endif  // __cplusplus\n\n} wuffs_base__tape_node;\n\n#define WUFFS_BASE__TAPE_NODE__KIND__SHIFT 24\n\n#define WUFFS_BASE__TAPE_NODE__KIND__LIST 1\n#define WUFFS_BASE__TAPE_NODE__KIND__DICT 2\n#define WUFFS_BASE__TAPE_NODE__KIND__STRING 3\n#define WUFFS_BASE__TAPE_NODE__KIND__LITERAL 4\n#define WUFFS_BASE__TAPE_NODE__KIND__NUMBER 5\n\n#define WUFFS_BASE__TAPE_NODE__FLAG__CONVERTED 0x800000\n\nstatic inline uint32_t  //\nwuffs_base__tape_node__kind(const wuffs_base__tape_node* n) {\n  return n->repr >> WUFFS_B" +
+	"ASE__TAPE_NODE__KIND__SHIFT;\n}\n\nstatic inline uint32_t  //\nwuffs_base__tape_node__detail(const wuffs_base__tape_node* n) {\n  return n->repr & 0x1FFFFF;\n}\n\nstatic inline bool  //\nwuffs_base__tape_node__converted(const wuffs_base__tape_node* n) {\n  return n->repr & WUFFS_BASE__TAPE_NODE__FLAG__CONVERTED;\n}\n\n#ifdef __cplusplus\n\ninline uint32_t  //\nwuffs_base__tape_node::kind() const {\n  return wuffs_base__tape_node__kind(this);\n}\n\ninline uint32_t  //\nwuffs_base__tape_node::detail() const {\n  return wuffs_base__tape_node__detail(this);\n}\n\ninline bool  //\nwuffs_base__tape_node::converted() const {\n  return wuffs_base__tape_node__converted(this);\n}\n\n#endif  // __cplusplus\n\ntypedef WUFFS_BASE__SLICE(wuffs_base__tape_node) wuffs_base__slice_tape_node;\n\nstatic inline wuffs_base__slice_tape_node  //\nwuffs_base__make_slice_tape_node(wuffs_base__tape_node* ptr, size_t len) {\n  wuffs_base__slice_tape_node ret;\n  ret.ptr = ptr;\n  ret.len = len;\n  return ret;\n}\n\n" +
+	"" +
+	"// --------\n\n// wuffs_base__tape_builder converts a token stream into a tape.\n//\n// The entire source (the bytes that the tokens describe) must be in memory,\n// at a fixed address, for the lifetime of the tape, e.g. from reading a whole\n// file or memory-mapping it. The tokenizer should therefore be given a closed\n// wuffs_base__slice_u8__reader over that source, and the builder is given the\n// same source slice. Tokens can be fed to the builder in batches, e.g. after\n// every \"$short write\" suspension, before compacting the token buffer.\n//\n// The nodes and the arena (for converted strings) are caller-owned memory,\n// which can be replaced (e.g. with larger memory) part way through. Some, but\n// not all, tokenizers can produce converted strings that are longer than\n// their source, such as std/json's QUIRK_REPLACE_INVALID_UNICODE, where one\n// invalid source byte converts to the 3-byte UTF-8 encoding of U+FFFD. An\n// arena that is as long as the source is otherwise sufficient for std/json.\n//\n// The builder " +
+	"does not need any other memory. In particular, it has no fixed\n// maximum depth, as open containers are tracked within the tape itself.\n//\n// For modular builds that divide the base module into sub-modules, using this\n// type requires the WUFFS_CONFIG__MODULE__BASE__TAPE sub-module, not just\n// WUFFS_CONFIG__MODULE__BASE__CORE.\ntypedef struct {\n  // Do not access the private_impl's fields directly. There is no API/ABI\n  // compatibility or safety guarantee if you do so.\n  struct {\n    wuffs_base__slice_u8 src;\n    wuffs_base__slice_tape_node nodes;\n    wuffs_base__slice_u8 arena;\n    size_t src_ri;\n    size_t nodes_wi;\n    size_t arena_wi;\n    // open is 1 plus the index of the innermost open container, or 0 if there\n    // is none. Each open container's skip field holds its parent's open value.\n    size_t open;\n    // chain is 1 plus the index of the node whose multi-token chain is in\n    // progress, or 0 if there is none.\n    size_t chain;\n    size_t chain_copy_begin;\n    size_t chain_copy_end;\n    size_t " +
+	"chain_arena_begin;\n    uint32_t chain_state;\n  } private_impl;\n\n#ifdef __cplusplus\n  inline void initialize(wuffs_base__slice_u8 src);\n  inline wuffs_base__status set_nodes(wuffs_base__slice_tape_node nodes);\n  inline wuffs_base__status set_arena(wuffs_base__slice_u8 arena);\n  inline wuffs_base__status append_tokens(wuffs_base__token_buffer* tok);\n  inline bool is_complete() const;\n  inline size_t arena_length() const;\n  inline wuffs_base__slice_tape_node nodes() const;\n#endif  // __cplusplus\n\n} wuffs_base__tape_builder;\n\n// wuffs_base__tape_builder__initialize resets the builder to an empty tape,\n// with no nodes or arena memory.\nWUFFS_BASE__MAYBE_STATIC void  //\nwuffs_base__tape_builder__initialize(wuffs_base__tape_builder* b,\n                                     wuffs_base__slice_u8 src);\n\n// wuffs_base__tape_builder__set_nodes replaces the memory that holds the\n// nodes, copying the nodes built so far. It returns an error if the new\n// memory is too short to hold them.\nWUFFS_BASE__MAYBE_STATIC wuffs_base_" +
+	"_status  //\nwuffs_base__tape_builder__set_nodes(wuffs_base__tape_builder* b,\n                                    wuffs_base__slice_tape_node nodes);\n\n// wuffs_base__tape_builder__set_arena replaces the memory that holds\n// converted strings. Completed nodes still point into the previous arena, so\n// the caller must keep that alive for the lifetime of the tape. Only an\n// in-progress string (if any) is copied across. It returns an error if the new\n// memory is too short to hold that string.\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__tape_builder__set_arena(wuffs_base__tape_builder* b,\n                                    wuffs_base__slice_u8 arena);\n\n// wuffs_base__tape_builder__append_tokens consumes tok's readable tokens,\n// advancing tok->meta.ri. It returns wuffs_base__error__bad_argument if the\n// tokens are inconsistent (e.g. an unbalanced pop) or longer than the source.\n// It returns wuffs_base__error__unsupported_option for extended tokens or\n// string conversions other than copy, drop," +
+	" backslash-x and Unicode code\n// points.\n//\n// It returns wuffs_base__error__bad_argument_length_too_short if the nodes or\n// the arena are full. The tokens before that point have been consumed and the\n// builder is in a consistent state: the caller can retry after calling\n// set_nodes (if the number of nodes equals the nodes' length) or set_arena.\nWUFFS_BASE__MAYBE_STATIC wuffs_base__status  //\nwuffs_base__tape_builder__append_tokens(wuffs_base__tape_builder* b,\n                                        wuffs_base__token_buffer* tok);\n\n// wuffs_base__tape_builder__is_complete returns whether the nodes so far hold\n// at least one complete top-level value, and no incomplete one.\nstatic inline bool  //\nwuffs_base__tape_builder__is_complete(const wuffs_base__tape_builder* b) {\n  return (b->private_impl.nodes_wi > 0) && (b->private_impl.open == 0) &&\n         (b->private_impl.chain == 0);\n}\n\n// wuffs_base__tape_builder__arena_length returns how many bytes of the\n// current arena have been used.\nstatic inline size_t" +
+	"  //\nwuffs_base__tape_builder__arena_length(const wuffs_base__tape_builder* b) {\n  return b->private_impl.arena_wi;\n}\n\n// wuffs_base__tape_builder__nodes returns the nodes built so far. Until the\n// tape is complete, open containers' skip fields are not yet meaningful.\nstatic inline wuffs_base__slice_tape_node  //\nwuffs_base__tape_builder__nodes(const wuffs_base__tape_builder* b) {\n  return wuffs_base__make_slice_tape_node(b->private_impl.nodes.ptr,\n                                          b->private_impl.nodes_wi);\n}\n\n#ifdef __cplusplus\n\ninline void  //\nwuffs_base__tape_builder::initialize(wuffs_base__slice_u8 src) {\n  wuffs_base__tape_builder__initialize(this, src);\n}\n\ninline wuffs_base__status  //\nwuffs_base__tape_builder::set_nodes(wuffs_base__slice_tape_node nodes) {\n  return wuffs_base__tape_builder__set_nodes(this, nodes);\n}\n\ninline wuffs_base__status  //\nwuffs_base__tape_builder::set_arena(wuffs_base__slice_u8 arena) {\n  return wuffs_base__tape_builder__set_arena(this, arena);\n}\n\ninline wuffs_base__s" +
+	"tatus  //\nwuffs_base__tape_builder::append_tokens(wuffs_base__token_buffer* tok) {\n  return wuffs_base__tape_builder__append_tokens(this, tok);\n}\n\ninline bool  //\nwuffs_base__tape_builder::is_complete() const {\n  return wuffs_base__tape_builder__is_complete(this);\n}\n\ninline size_t  //\nwuffs_base__tape_builder::arena_length() const {\n  return wuffs_base__tape_builder__arena_length(this);\n}\n\ninline wuffs_base__slice_tape_node  //\nwuffs_base__tape_builder::nodes() const {\n  return wuffs_base__tape_builder__nodes(this);\n}\n\n#endif  // __cplusplus\n" +
 	""
 
 const baseCopyright = "" +
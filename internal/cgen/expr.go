@@ -141,19 +141,17 @@ func (g *gen) writeExprOther(b *buffer, n *a.Expr, depth uint32) error {
 
 	case t.IDOpenBracket:
 		// n is an index.
-		if err := g.writeExpr(b, n.LHS().AsExpr(), depth); err != nil {
-			return err
-		}
-		if lTyp := n.LHS().AsExpr().MType(); lTyp.IsSliceType() {
-			// TODO: don't assume that the slice is a slice of base.u8.
-			b.writes(".ptr")
-		}
-		b.writeb('[')
-		if err := g.writeExpr(b, n.RHS().AsExpr(), depth); err != nil {
-			return err
+		if g.isQuirksIndex(n) {
+			// Reading "this.quirks[i]" goes through a macro, so that quirks
+			// can be compiled out. See gen.writeQuirks.
+			b.printf("%sQUIRK_ENABLED(self, ", g.PKGPREFIX)
+			if err := g.writeExpr(b, n.RHS().AsExpr(), depth); err != nil {
+				return err
+			}
+			b.writeb(')')
+			return nil
 		}
-		b.writeb(']')
-		return nil
+		return g.writeExprIndex(b, n, depth)
 
 	case t.IDDotDot:
 		// n is a slice.
@@ -224,6 +222,34 @@ func (g *gen) writeExprOther(b *buffer, n *a.Expr, depth uint32) error {
 	return fmt.Errorf("unrecognized token (0x%X) for writeExprOther", n.Operator())
 }
 
+func (g *gen) writeExprIndex(b *buffer, n *a.Expr, depth uint32) error {
+	if err := g.writeExpr(b, n.LHS().AsExpr(), depth); err != nil {
+		return err
+	}
+	if lTyp := n.LHS().AsExpr().MType(); lTyp.IsSliceType() {
+		// TODO: don't assume that the slice is a slice of base.u8.
+		b.writes(".ptr")
+	}
+	b.writeb('[')
+	if err := g.writeExpr(b, n.RHS().AsExpr(), depth); err != nil {
+		return err
+	}
+	b.writeb(']')
+	return nil
+}
+
+// isQuirksIndex returns whether n is "this.quirks[etc]", for a package that
+// has QUIRK_ETC consts.
+func (g *gen) isQuirksIndex(n *a.Expr) bool {
+	if (len(g.quirkNames) == 0) || (n.Operator() != t.IDOpenBracket) {
+		return false
+	}
+	lhs := n.LHS().AsExpr()
+	return (lhs.Operator() == t.IDDot) &&
+		(lhs.LHS().AsExpr().Ident() == t.IDThis) &&
+		(lhs.Ident() == g.tm.ByName("quirks"))
+}
+
 func (g *gen) privateImplData(typ *a.TypeExpr, fieldName t.ID) string {
 	if p := typ.Decorator(); p == t.IDNptr || p == t.IDPtr {
 		typ = typ.Inner()
@@ -348,6 +348,10 @@ func (g *gen) writeFuncImplPrologue(b *buffer) error {
 		}
 	}
 
+	if i, ok := g.statsIndexes[g.currFunk.astFunc.QQID()]; ok {
+		b.printf("WUFFS_BASE__STATS__CALL(self, %d);\n", i)
+	}
+
 	if g.currFunk.astFunc.Effect().Coroutine() ||
 		(g.currFunk.returnsStatus && (len(g.currFunk.derivedVars) > 0)) {
 		// TODO: rename the "status" variable to "ret"?
@@ -425,6 +429,9 @@ func (g *gen) writeFuncImplBodySuspend(b *buffer) error {
 		if g.currFunk.astFunc.Public() {
 			b.printf("self->private_impl.active_coroutine = "+
 				"wuffs_base__status__is_suspension(&status) ? %d : 0;\n", g.currFunk.coroID)
+			if _, ok := g.statsIndexes[g.currFunk.astFunc.QQID()]; ok {
+				b.writes("WUFFS_BASE__STATS__SUSPENSION(self, &status);\n")
+			}
 		}
 		if err := g.writeResumeSuspend(b, &g.currFunk, true); err != nil {
 			return err
@@ -458,6 +465,7 @@ func (g *gen) writeFuncImplEpilogue(b *buffer) error {
 	if (epilogue == "") && g.currFunk.astFunc.BodyEndsWithReturn() {
 		// No-op.
 	} else if g.currFunk.derivedVars != nil {
+		g.writeStatsWritten(b)
 		for _, o := range g.currFunk.astFunc.In().Fields() {
 			o := o.AsField()
 			if err := g.writeSaveDerivedVar(b, "", aPrefix, o.Name(), o.XType()); err != nil {
@@ -471,6 +479,29 @@ func (g *gen) writeFuncImplEpilogue(b *buffer) error {
 	return nil
 }
 
+// writeStatsWritten adds the number of bytes (or tokens) written to each
+// io_writer (or token_writer) argument, since the start of this call, to the
+// stats. It must be called before the derived variables are saved.
+func (g *gen) writeStatsWritten(b *buffer) {
+	i, ok := g.statsIndexes[g.currFunk.astFunc.QQID()]
+	if !ok || (g.currFunk.derivedVars == nil) {
+		return
+	}
+	for _, o := range g.currFunk.astFunc.In().Fields() {
+		o := o.AsField()
+		if typ := o.XType(); !typ.IsIOTokenType() {
+			continue
+		} else if q := typ.QID()[1]; (q != t.IDIOWriter) && (q != t.IDTokenWriter) {
+			continue
+		} else if _, ok := g.currFunk.derivedVars[o.Name()]; !ok {
+			continue
+		}
+		name := aPrefix + o.Name().Str(g.tm)
+		b.printf("WUFFS_BASE__STATS__WRITTEN(self, %d, %s%s - %s%s);\n",
+			i, iopPrefix, name, io1Prefix, name)
+	}
+}
+
 func (g *gen) writeFuncImplArgChecks(b *buffer, n *a.Func) error {
 	checks := []string(nil)
 
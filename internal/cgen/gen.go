@@ -76,9 +76,13 @@ func genBase(out *bytes.Buffer) error {
 		{"base/all-impl.c", "baseAllImplC"},
 		{"base/strconv-impl.c", "baseStrConvImplC"},
 
+		{"base/aux-public.h", "baseAuxPublicH"},
+
 		{"base/f64conv-submodule.c", "baseF64ConvSubmoduleC"},
 		{"base/pixconv-submodule.c", "basePixConvSubmoduleC"},
+		{"base/tape-submodule.c", "baseTapeSubmoduleC"},
 
+		{"base/cpu-arch-private.h", "baseCPUArchPrivateH"},
 		{"base/fundamental-private.h", "baseFundamentalPrivateH"},
 		{"base/fundamental-public.h", "baseFundamentalPublicH"},
 		{"base/memory-private.h", "baseMemoryPrivateH"},
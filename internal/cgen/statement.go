@@ -171,7 +171,12 @@ func (g *gen) writeStatementAssign0(b *buffer, op t.ID, lhs *a.Expr, rhs *a.Expr
 
 func (g *gen) writeStatementAssign1(b *buffer, op t.ID, lhs *a.Expr, rhs *a.Expr) error {
 	lhsBuf := buffer(nil)
-	if err := g.writeExpr(&lhsBuf, lhs, 0); err != nil {
+	if g.isQuirksIndex(lhs) {
+		// Writes to "this.quirks[i]" bypass the QUIRK_ENABLED macro.
+		if err := g.writeExprIndex(&lhsBuf, lhs, 0); err != nil {
+			return err
+		}
+	} else if err := g.writeExpr(&lhsBuf, lhs, 0); err != nil {
 		return err
 	}
 
@@ -472,6 +477,7 @@ func (g *gen) writeStatementRet(b *buffer, n *a.Ret, depth uint32) error {
 	}
 
 	if g.currFunk.derivedVars != nil {
+		g.writeStatsWritten(b)
 		for _, o := range g.currFunk.astFunc.In().Fields() {
 			o := o.AsField()
 			if err := g.writeSaveDerivedVar(b, "", aPrefix, o.Name(), o.XType()); err != nil {
@@ -57,6 +57,7 @@ var Statuses = [...]string{
 	`"#bad workbuf length"`,
 	`"#bad wuffs version"`,
 	`"#cannot return a suspension"`,
+	`"#disabled by WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST"`,
 	`"#disabled by previous error"`,
 	`"#initialize falsely claimed already zeroed"`,
 	`"#initialize not called"`,
@@ -134,6 +135,51 @@ var Funcs = []string{
 
 	// ---- utility
 
+	// The cpu_arch functions return whether the CPU that the program is
+	// running on supports a CPU-specific family of instructions. The
+	// CPU-specific utility methods below, such as crc32_ieee_x86_sse42, should
+	// only be called if the corresponding check returned true.
+	"utility.cpu_arch_have_x86_sse42() bool",
+
+	// crc32_ieee_x86_sse42 updates the (bitwise complemented) CRC-32 IEEE
+	// state s with the first (x.length() & ~15) bytes of x. It requires that
+	// x.length() >= 64, otherwise it does nothing.
+	"utility.crc32_ieee_x86_sse42(s: u32, x: slice u8) u32",
+
+	// crc32_castagnoli_x86_sse42 updates the (bitwise complemented) CRC-32C
+	// Castagnoli state s with all of x.
+	"utility.crc32_castagnoli_x86_sse42(s: u32, x: slice u8) u32",
+
+	// adler32_x86_sse42 updates the Adler-32 state s with the first
+	// (x.length() & ~31) bytes of x.
+	"utility.adler32_x86_sse42(s: u32, x: slice u8) u32",
+
+	// json_string_span_x86_sse42 returns how many of the 16 bytes lo and hi
+	// (in little-endian order) are, from the start, valid UTF-8 but not '"',
+	// '\\' or a C0 control code. It may stop early (but at a code point
+	// boundary) near invalid UTF-8.
+	"utility.json_string_span_x86_sse42(lo: u64, hi: u64) u32[..= 16]",
+
+	// json_whitespace_span_x86_sse42 returns how many of the 16 bytes lo and
+	// hi (in little-endian order) are, from the start, JSON whitespace.
+	"utility.json_whitespace_span_x86_sse42(lo: u64, hi: u64) u32[..= 16]",
+
+	// json_skip_span_x86_sse42 returns how many of the 16 bytes lo and hi (in
+	// little-endian order) are, from the start, not '"', '\\', '|' or one of
+	// "[]{}".
+	"utility.json_skip_span_x86_sse42(lo: u64, hi: u64) u32[..= 16]",
+
+	// The png_filter_etc_x86_sse42 methods reverse PNG filtering, in place,
+	// for the first (curr.length() / d) * d bytes of curr, where d is the
+	// filter distance (bytes per pixel) in the method name. The 1 (Sub), 3
+	// (Average) and 4 (Paeth) refer to the PNG filter type. prev is the
+	// previous row, already unfiltered, and must be at least as long as curr.
+	"utility.png_filter_1_distance_4_x86_sse42!(curr: slice u8)",
+	"utility.png_filter_3_distance_3_x86_sse42!(curr: slice u8, prev: slice u8)",
+	"utility.png_filter_3_distance_4_x86_sse42!(curr: slice u8, prev: slice u8)",
+	"utility.png_filter_4_distance_3_x86_sse42!(curr: slice u8, prev: slice u8)",
+	"utility.png_filter_4_distance_4_x86_sse42!(curr: slice u8, prev: slice u8)",
+
 	"utility.empty_io_reader() io_reader",
 	"utility.empty_io_writer() io_writer",
 	"utility.empty_range_ii_u32() range_ii_u32",
@@ -342,6 +388,28 @@ var Funcs = []string{
 	// For now, that's all implicitly checked (i.e. hard coded).
 	"io_writer.copy_n32_from_history_fast!(n: u32, distance: u32) u32",
 
+	// TODO: these should have explicit pre-conditions:
+	//  - (n + 8) <= this.available()
+	//  - distance >= 8 (or distance == 1 for the distance_1 version)
+	//  - distance <= this.since_mark().length()
+	// For now, that's all implicitly checked (i.e. hard coded).
+	//
+	// They copy 8 bytes at a time, possibly writing (but not advancing over)
+	// up to 8 bytes past the n copied bytes.
+	"io_writer.copy_n32_from_history_8_byte_chunks_fast!(n: u32, distance: u32) u32",
+	"io_writer.copy_n32_from_history_8_byte_chunks_distance_1_fast!(n: u32, distance: u32) u32",
+
+	// TODO: this should have explicit pre-conditions:
+	//  - (n + 16) <= this.available()
+	//  - (n + 16) <= r.available()
+	// For now, that's all implicitly checked (i.e. hard coded).
+	//
+	// It copies 16 bytes at a time, possibly reading and writing (but not
+	// advancing over) up to 16 bytes past the n copied bytes. If this's and
+	// r's buffers alias, such that those ranges intersect, it copies exactly
+	// n bytes instead, as if by memmove.
+	"io_writer.copy_n32_from_reader_16_byte_chunks_fast!(n: u32, r: io_reader) u32",
+
 	// ---- token_writer
 
 	"token_writer.write_simple_token_fast!(" +
@@ -350,6 +418,15 @@ var Funcs = []string{
 
 	"token_writer.available() u64",
 
+	// ---- decode_frame_options
+
+	"decode_frame_options.scale_shift() u32[..= 3]",
+	"decode_frame_options.crop_min_incl_x() u32",
+	"decode_frame_options.crop_min_incl_y() u32",
+	"decode_frame_options.crop_max_excl_x() u32",
+	"decode_frame_options.crop_max_excl_y() u32",
+	"decode_frame_options.band_height() u32",
+
 	// ---- frame_config
 	// Duration's upper bound is the maximum possible i64 value.
 
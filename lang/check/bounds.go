@@ -1020,7 +1020,22 @@ func (q *checker) bcheckExprCallSpecialCases(n *a.Expr, depth uint32) (bounds, e
 			}
 
 		} else if method == t.IDCopyN32FromHistoryFast {
-			if err := q.canCopyN32FromHistoryFast(recv, n.Args()); err != nil {
+			if err := q.canCopyN32FromHistoryFast(recv, n.Args(), 0, 1, false); err != nil {
+				return bounds{}, err
+			}
+
+		} else if method == t.IDCopyN32FromHistory8ByteChunksFast {
+			if err := q.canCopyN32FromHistoryFast(recv, n.Args(), 8, 8, false); err != nil {
+				return bounds{}, err
+			}
+
+		} else if method == t.IDCopyN32FromHistory8ByteChunksDistance1Fast {
+			if err := q.canCopyN32FromHistoryFast(recv, n.Args(), 8, 1, true); err != nil {
+				return bounds{}, err
+			}
+
+		} else if method == t.IDCopyN32FromReader16ByteChunksFast {
+			if err := q.canCopyN32FromReaderFast(recv, n.Args(), 16); err != nil {
 				return bounds{}, err
 			}
 
@@ -1100,10 +1115,14 @@ func (q *checker) canUndoByte(recv *a.Expr) error {
 	return fmt.Errorf("check: could not prove %s.can_undo_byte()", recv.Str(q.tm))
 }
 
-func (q *checker) canCopyN32FromHistoryFast(recv *a.Expr, args []*a.Node) error {
+// canCopyN32FromHistoryFast checks the copy_n32_from_history_etc_fast
+// pre-conditions. The slop is how many bytes past n the copy may write and
+// minDistance is the smallest distance that the copy handles correctly (or, if
+// exactDistance, the only such distance).
+func (q *checker) canCopyN32FromHistoryFast(recv *a.Expr, args []*a.Node, slop int64, minDistance int64, exactDistance bool) error {
 	// As per cgen's io-private.h, there are three pre-conditions:
-	//  - n <= this.available()
-	//  - distance > 0
+	//  - (n + slop) <= this.available()
+	//  - distance >= minDistance (and, for minDistance == 1, distance > 0)
 	//  - distance <= this.history_available()
 
 	if len(args) != 2 {
@@ -1112,54 +1131,49 @@ func (q *checker) canCopyN32FromHistoryFast(recv *a.Expr, args []*a.Node) error
 	n := args[0].AsArg().Value()
 	distance := args[1].AsArg().Value()
 
-	// Check "n <= this.available()".
-check0:
-	for {
-		for _, x := range q.facts {
-			if x.Operator() != t.IDXBinaryLessEq {
-				continue
-			}
-
-			// Check that the LHS is "n as base.u64".
-			lhs := x.LHS().AsExpr()
-			if lhs.Operator() != t.IDXBinaryAs {
-				continue
-			}
-			llhs, lrhs := lhs.LHS().AsExpr(), lhs.RHS().AsTypeExpr()
-			if !llhs.Eq(n) || !lrhs.Eq(typeExprU64) {
-				continue
-			}
-
-			// Check that the RHS is "recv.available()".
-			y, method, yArgs := splitReceiverMethodArgs(x.RHS().AsExpr())
-			if method != t.IDAvailable || len(yArgs) != 0 {
-				continue
-			}
-			if !y.Eq(recv) {
-				continue
-			}
-
-			break check0
-		}
-		return fmt.Errorf("check: could not prove n <= %s.available()", recv.Str(q.tm))
+	// Check "(n + slop) <= this.available()".
+	if err := q.canNPlusSlopFitInAvailable(recv, n, slop); err != nil {
+		return err
 	}
 
-	// Check "distance > 0".
+	// Check "distance > 0", "distance >= minDistance" or "distance ==
+	// minDistance".
 check1:
 	for {
 		for _, x := range q.facts {
-			if x.Operator() != t.IDXBinaryGreaterThan {
+			op := x.Operator()
+			if (op != t.IDXBinaryEqEq) && (op != t.IDXBinaryGreaterEq) && (op != t.IDXBinaryGreaterThan) {
 				continue
 			}
 			if lhs := x.LHS().AsExpr(); !lhs.Eq(distance) {
 				continue
 			}
-			if rcv := x.RHS().AsExpr().ConstValue(); rcv == nil || rcv.Sign() != 0 {
+			rcv := x.RHS().AsExpr().ConstValue()
+			if rcv == nil {
 				continue
 			}
-			break check1
+			c := rcv.Cmp(big.NewInt(minDistance))
+			switch op {
+			case t.IDXBinaryEqEq:
+				if c == 0 {
+					break check1
+				}
+			case t.IDXBinaryGreaterEq:
+				if (c >= 0) && !exactDistance {
+					break check1
+				}
+			case t.IDXBinaryGreaterThan:
+				if (rcv.Cmp(big.NewInt(minDistance-1)) >= 0) && !exactDistance {
+					break check1
+				}
+			}
+		}
+		if exactDistance {
+			return fmt.Errorf("check: could not prove distance == %d", minDistance)
+		} else if minDistance == 1 {
+			return fmt.Errorf("check: could not prove distance > 0")
 		}
-		return fmt.Errorf("check: could not prove distance > 0")
+		return fmt.Errorf("check: could not prove distance >= %d", minDistance)
 	}
 
 	// Check "distance <= this.history_available()".
@@ -1197,6 +1211,71 @@ check2:
 	return nil
 }
 
+// canCopyN32FromReaderFast checks the copy_n32_from_reader_etc_fast
+// pre-conditions. The slop is how many bytes past n the copy may read and
+// write.
+func (q *checker) canCopyN32FromReaderFast(recv *a.Expr, args []*a.Node, slop int64) error {
+	// As per cgen's io-private.h, there are two pre-conditions:
+	//  - (n + slop) <= this.available()
+	//  - (n + slop) <= r.available()
+
+	if len(args) != 2 {
+		return fmt.Errorf("check: internal error: inconsistent copy_n_from_reader_fast arguments")
+	}
+	n := args[0].AsArg().Value()
+	r := args[1].AsArg().Value()
+
+	if err := q.canNPlusSlopFitInAvailable(recv, n, slop); err != nil {
+		return err
+	}
+	return q.canNPlusSlopFitInAvailable(r, n, slop)
+}
+
+// canNPlusSlopFitInAvailable checks that "(n + slop) <= recv.available()" is
+// a known fact, where the "+ slop" is omitted when slop is zero.
+func (q *checker) canNPlusSlopFitInAvailable(recv *a.Expr, n *a.Expr, slop int64) error {
+	for _, x := range q.facts {
+		if x.Operator() != t.IDXBinaryLessEq {
+			continue
+		}
+
+		// Check that the LHS is "n as base.u64", or "(n as base.u64) +
+		// slop" when slop is non-zero.
+		lhs := x.LHS().AsExpr()
+		if slop != 0 {
+			if lhs.Operator() != t.IDXBinaryPlus {
+				continue
+			}
+			if cv := lhs.RHS().AsExpr().ConstValue(); (cv == nil) || (cv.Cmp(big.NewInt(slop)) != 0) {
+				continue
+			}
+			lhs = lhs.LHS().AsExpr()
+		}
+		if lhs.Operator() != t.IDXBinaryAs {
+			continue
+		}
+		llhs, lrhs := lhs.LHS().AsExpr(), lhs.RHS().AsTypeExpr()
+		if !llhs.Eq(n) || !lrhs.Eq(typeExprU64) {
+			continue
+		}
+
+		// Check that the RHS is "recv.available()".
+		y, method, yArgs := splitReceiverMethodArgs(x.RHS().AsExpr())
+		if method != t.IDAvailable || len(yArgs) != 0 {
+			continue
+		}
+		if !y.Eq(recv) {
+			continue
+		}
+
+		return nil
+	}
+	if slop != 0 {
+		return fmt.Errorf("check: could not prove (n + %d) <= %s.available()", slop, recv.Str(q.tm))
+	}
+	return fmt.Errorf("check: could not prove n <= %s.available()", recv.Str(q.tm))
+}
+
 var ioMethodAdvances = [...]struct {
 	advance *big.Int
 	update  bool
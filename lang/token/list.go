@@ -523,6 +523,10 @@ const (
 	IDCopyN32FromReader      = ID(0x173)
 	IDCopyN32FromSlice       = ID(0x174)
 
+	IDCopyN32FromHistory8ByteChunksFast          = ID(0x175)
+	IDCopyN32FromHistory8ByteChunksDistance1Fast = ID(0x176)
+	IDCopyN32FromReader16ByteChunksFast          = ID(0x177)
+
 	// -------- 0x180 block.
 
 	IDUndoByte = ID(0x180)
@@ -884,6 +888,10 @@ var builtInsByID = [nBuiltInIDs]string{
 	IDCopyN32FromReader:      "copy_n32_from_reader",
 	IDCopyN32FromSlice:       "copy_n32_from_slice",
 
+	IDCopyN32FromHistory8ByteChunksFast:          "copy_n32_from_history_8_byte_chunks_fast",
+	IDCopyN32FromHistory8ByteChunksDistance1Fast: "copy_n32_from_history_8_byte_chunks_distance_1_fast",
+	IDCopyN32FromReader16ByteChunksFast:          "copy_n32_from_reader_16_byte_chunks_fast",
+
 	// -------- 0x180 block.
 
 	IDUndoByte: "undo_byte",
@@ -0,0 +1,173 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package rac
+
+import (
+	"bytes"
+	"container/list"
+	"io"
+	"sync"
+)
+
+// ChunkCache is a size-bounded, least recently used cache of decompressed RAC
+// chunks, keyed by each chunk's CPrimary offset (in CSpace).
+//
+// It is safe for concurrent use. A single ChunkCache can be shared by multiple
+// Readers, such as the clones that a Reader with positive Concurrency creates,
+// or multiple Readers serving independent io.ReaderAt style requests, provided
+// that all of those Readers read the same RAC file.
+//
+// Repeatedly reading from the same (hot) chunks then only decompresses each
+// chunk once, until it is evicted. The trade-off is that, on a cache miss, a
+// chunk is decompressed in its entirety, even if only part of it is read.
+//
+// The zero value is a valid but useless ChunkCache, as its MaxSize is zero.
+type ChunkCache struct {
+	// MaxSize is the maximum total size, in bytes, of the cached chunks'
+	// decompressed data. A chunk larger than MaxSize is never cached.
+	//
+	// Non-positive values (including zero) mean that nothing is cached.
+	//
+	// Do not modify this field after calling any of this type's methods or
+	// after passing this ChunkCache to a Reader.
+	MaxSize int64
+
+	mu sync.Mutex
+
+	// lru holds *chunkCacheEntry values, most recently used first.
+	lru     list.List
+	entries map[int64]*list.Element
+	stats   ChunkCacheStats
+}
+
+// ChunkCacheStats are a ChunkCache's counters.
+type ChunkCacheStats struct {
+	// Hits and Misses count the chunk lookups that did and didn't find the
+	// chunk in the cache. A Reader looks up a chunk once each time it moves
+	// on to that chunk, however many Read calls it takes to consume it.
+	Hits   uint64
+	Misses uint64
+
+	// Evictions counts the chunks that were removed to make room for others.
+	Evictions uint64
+
+	// NumChunks and Size are the number of chunks currently cached and the
+	// total size, in bytes, of their decompressed data.
+	NumChunks int
+	Size      int64
+}
+
+type chunkCacheEntry struct {
+	cOffset int64
+	dRange  Range
+
+	// data holds the chunk's explicit (not implicitly zero) decompressed
+	// bytes. It is never modified after being added to the cache.
+	data []byte
+}
+
+// Stats returns a snapshot of c's counters.
+func (c *ChunkCache) Stats() ChunkCacheStats {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	return c.stats
+}
+
+// get returns the cached data for the chunk, if present.
+func (c *ChunkCache) get(chunk Chunk) ([]byte, bool) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	if elem := c.entries[chunk.CPrimary[0]]; elem != nil {
+		if e := elem.Value.(*chunkCacheEntry); e.dRange == chunk.DRange {
+			c.lru.MoveToFront(elem)
+			c.stats.Hits++
+			return e.data, true
+		}
+	}
+	c.stats.Misses++
+	return nil, false
+}
+
+// put adds the chunk's data to the cache, evicting the least recently used
+// chunks if necessary.
+func (c *ChunkCache) put(chunk Chunk, data []byte) {
+	size := int64(len(data))
+	if size > c.MaxSize {
+		return
+	}
+
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	if c.entries == nil {
+		c.entries = map[int64]*list.Element{}
+	}
+
+	// Another Reader may have added the same chunk since our get call missed.
+	if elem := c.entries[chunk.CPrimary[0]]; elem != nil {
+		c.remove(elem)
+	}
+
+	for (c.stats.Size + size) > c.MaxSize {
+		c.remove(c.lru.Back())
+		c.stats.Evictions++
+	}
+
+	c.entries[chunk.CPrimary[0]] = c.lru.PushFront(&chunkCacheEntry{
+		cOffset: chunk.CPrimary[0],
+		dRange:  chunk.DRange,
+		data:    data,
+	})
+	c.stats.NumChunks++
+	c.stats.Size += size
+}
+
+func (c *ChunkCache) remove(elem *list.Element) {
+	e := c.lru.Remove(elem).(*chunkCacheEntry)
+	delete(c.entries, e.cOffset)
+	c.stats.NumChunks--
+	c.stats.Size -= int64(len(e.data))
+}
+
+// readChunkData decompresses all of a chunk's explicit data. dSize is the
+// chunk's DRange size.
+func readChunkData(decompressor io.Reader, dSize int64) ([]byte, error) {
+	// Don't trust dSize (which comes from the RAC file) for more than a
+	// modest up-front allocation.
+	capacity := dSize
+	if capacity > rBufferSize {
+		capacity = rBufferSize
+	}
+	buf := bytes.NewBuffer(make([]byte, 0, capacity))
+	_, err := buf.ReadFrom(io.LimitReader(decompressor, dSize+1))
+	if err == io.ErrUnexpectedEOF {
+		err = errInvalidChunkTruncated
+	}
+
+	if c, ok := decompressor.(io.Closer); ok {
+		if cErr := c.Close(); err == nil {
+			err = cErr
+			if err == io.EOF {
+				err = io.ErrUnexpectedEOF
+			}
+		}
+	}
+
+	if err != nil {
+		return nil, err
+	} else if int64(buf.Len()) > dSize {
+		return nil, errInvalidChunkTooLarge
+	}
+	return buf.Bytes(), nil
+}
@@ -16,14 +16,71 @@ package rac
 
 import (
 	"io"
+	"sync"
+	"sync/atomic"
 )
 
 const (
+	// numRBuffersPerWorker is each Worker's initial read-ahead depth.
 	numRBuffersPerWorker = 2
-	rBufferSize          = 65536
+
+	// defaultReadAheadMax is the default Reader.ReadAhead value.
+	defaultReadAheadMax = 8
+
+	// rBufferSize is the default buffer size, if the RAC file's first chunk
+	// can't be used to pick one.
+	rBufferSize = 65536
+
+	// Buffer sizes are powers of 2, between 4 KiB and 1 MiB inclusive.
+	rBufferSizeLog2Min = 12
+	rBufferSizeLog2Max = 20
 )
 
-type rBuffer [rBufferSize]byte
+type rBuffer []byte
+
+// rBufferPools recycle buffers across concReaders (and therefore across
+// Readers). They are indexed by the buffers' log2 size.
+var rBufferPools [rBufferSizeLog2Max + 1]sync.Pool
+
+func getRBuffer(log2 uint32) *rBuffer {
+	if b, ok := rBufferPools[log2].Get().(*rBuffer); ok {
+		return b
+	}
+	b := make(rBuffer, 1<<log2)
+	return &b
+}
+
+func putRBuffer(log2 uint32, b *rBuffer) {
+	rBufferPools[log2].Put(b)
+}
+
+// rBufferSizeLog2 returns the log2 of the smallest valid buffer size that is
+// at least n.
+func rBufferSizeLog2(n int64) uint32 {
+	log2 := uint32(rBufferSizeLog2Min)
+	for (log2 < rBufferSizeLog2Max) && ((int64(1) << log2) < n) {
+		log2++
+	}
+	return log2
+}
+
+// rShared is the state shared by a concReader and its Workers.
+type rShared struct {
+	// readAhead is how many buffers each Worker may own, including those
+	// loaned to the concReader goroutine. It starts at numRBuffersPerWorker
+	// and is only ever increased, up to readAheadMax, by the concReader
+	// goroutine. It is accessed atomically.
+	readAhead    int32
+	readAheadMax int32
+
+	// bufferStarved is set to 1 by a Worker that has work to do but is at its
+	// read-ahead limit, and reset to 0 by the concReader goroutine. It is
+	// accessed atomically.
+	bufferStarved int32
+
+	// bufferLog2 is the log2 of each buffer's size.
+	bufferLog2 uint32
+}
 
 // rWork is a unit of work for concurrent reading. The Manager sends dRanges
 // for Workers to read. Workers send filled buffers to the concReader.
@@ -32,10 +89,11 @@ type rWork struct {
 
 	// dRange is set by the Manager goroutine, for a Worker's incoming work.
 	// That Worker may slice that dRange into smaller pieces of outgoing work.
-	// Each outgoing piece has a dRange.Size() of at most rBufferSize.
+	// Each outgoing piece has a dRange.Size() of at most 1<<c.shared.bufferLog2
+	// bytes.
 	dRange Range
 
-	// buffer[i:j] holds bytes decompressed from the underlying RAC file but
+	// (*buffer)[i:j] holds bytes decompressed from the underlying RAC file but
 	// not yet served onwards to concReader.Read's caller.
 	//
 	// j should equal dRange.Size().
@@ -103,6 +161,9 @@ type concReader struct {
 	// numWorkers is the number of concurrent Workers.
 	numWorkers int
 
+	// shared is the state shared with the Workers.
+	shared *rShared
+
 	// seekResolved means that Read does not have to seek to pos.
 	//
 	// Each Seek call is relatively cheap, only changing the pos field. The
@@ -134,6 +195,33 @@ func (c *concReader) initialize(racReader *Reader) {
 		c.numWorkers = 65536
 	}
 
+	// Pick the buffer size and read-ahead limits.
+	c.shared = &rShared{
+		readAhead:    numRBuffersPerWorker,
+		readAheadMax: defaultReadAheadMax,
+		bufferLog2:   rBufferSizeLog2(int64(racReader.BufferSize)),
+	}
+	if racReader.ReadAhead > 0 {
+		c.shared.readAheadMax = int32(racReader.ReadAhead)
+		if c.shared.readAheadMax > 1024 {
+			c.shared.readAheadMax = 1024
+		}
+		if c.shared.readAhead > c.shared.readAheadMax {
+			c.shared.readAhead = c.shared.readAheadMax
+		}
+	}
+	if racReader.BufferSize <= 0 {
+		c.shared.bufferLog2 = rBufferSizeLog2(rBufferSize)
+		// Match the first chunk's size in DSpace. The Manager re-positions
+		// the chunkReader before using it, so peeking here is harmless.
+		cr := &racReader.chunkReader
+		if err := cr.SeekToChunkContaining(0); err == nil {
+			if chunk, err := cr.NextChunk(); err == nil {
+				c.shared.bufferLog2 = rBufferSizeLog2(chunk.DRange.Size())
+			}
+		}
+	}
+
 	// Set up other state.
 	c.completedWorks = map[int64]rWork{}
 	c.posLimit = racReader.chunkReader.decompressedSize
@@ -142,7 +230,7 @@ func (c *concReader) initialize(racReader *Reader) {
 	// Set up the Manager and the Workers.
 	c.roic = make(chan Range)
 	c.reqc = make(chan rWork, c.numWorkers)
-	c.resc = make(chan rWork, c.numWorkers*numRBuffersPerWorker)
+	c.resc = make(chan rWork, c.numWorkers*int(c.shared.readAheadMax))
 
 	// Set up the channels used in stopAnyWorkInProgress. It is important that
 	// these are unbuffered, so that communication is also synchronization.
@@ -152,7 +240,7 @@ func (c *concReader) initialize(racReader *Reader) {
 	for i := 0; i < c.numWorkers; i++ {
 		rr := racReader.clone()
 		rr.Concurrency = 0
-		go runRWorker(c.stopc, c.resc, c.reqc, rr)
+		go runRWorker(c.stopc, c.resc, c.reqc, rr, c.shared)
 	}
 	go runRManager(c.stopc, c.roic, c.reqc, &racReader.chunkReader)
 }
@@ -240,7 +328,7 @@ func (c *concReader) Read(p []byte) (int, error) {
 		}
 
 		// Fill p from c.currWork.
-		n := copy(p, c.currWork.buffer[c.currWork.i:c.currWork.j])
+		n := copy(p, (*c.currWork.buffer)[c.currWork.i:c.currWork.j])
 		p = p[n:]
 		numRead += n
 		c.pos += int64(n)
@@ -254,6 +342,21 @@ func (c *concReader) nextWork() rWork {
 			delete(c.completedWorks, c.pos)
 			return work
 		}
+		select {
+		case work := <-c.resc:
+			c.completedWorks[work.dRange[0]] = work
+			continue
+		default:
+		}
+
+		// We're about to wait for the Workers. If any of them were held
+		// back by their read-ahead limit, raise that limit.
+		if atomic.SwapInt32(&c.shared.bufferStarved, 0) != 0 {
+			if ra := atomic.LoadInt32(&c.shared.readAhead); ra < c.shared.readAheadMax {
+				atomic.StoreInt32(&c.shared.readAhead, ra+1)
+			}
+		}
+
 		work := <-c.resc
 		c.completedWorks[work.dRange[0]] = work
 	}
@@ -302,7 +405,7 @@ func drainWorkChan(c chan rWork) {
 	}
 }
 
-func runRWorker(stopc <-chan stopWork, resc chan<- rWork, reqc <-chan rWork, racReader *Reader) {
+func runRWorker(stopc <-chan stopWork, resc chan<- rWork, reqc <-chan rWork, racReader *Reader, shared *rShared) {
 	input, output := reqc, (chan<- rWork)(nil)
 	outWork := rWork{}
 
@@ -310,11 +413,12 @@ func runRWorker(stopc <-chan stopWork, resc chan<- rWork, reqc <-chan rWork, rac
 	// racReader.
 	dRange := Range{}
 
-	// Each worker owns up to numRBuffersPerWorker buffers, some of which may
-	// be temporarily loaned to the concReader goroutine.
-	buffers := [numRBuffersPerWorker]*rBuffer{}
-	recyclec := make(chan *rBuffer, numRBuffersPerWorker)
-	canAlloc := numRBuffersPerWorker
+	// Each worker owns up to shared.readAhead buffers, some of which may be
+	// temporarily loaned to the concReader goroutine. The others are in
+	// buffers, ready for re-use. numOwned counts both.
+	buffers := make([]*rBuffer, 0, numRBuffersPerWorker)
+	recyclec := make(chan *rBuffer, shared.readAheadMax)
+	numOwned := int32(0)
 
 loop:
 	for {
@@ -326,6 +430,9 @@ loop:
 				// No need to ack. This is CloseWithoutWaiting.
 			}
 			if !stop.keepWorking {
+				for _, b := range buffers {
+					putRBuffer(shared.bufferLog2, b)
+				}
 				return
 			}
 			continue loop
@@ -352,15 +459,7 @@ loop:
 			output, outWork = nil, rWork{}
 
 		case recycledBuffer := <-recyclec:
-			for i := range buffers {
-				if buffers[i] == nil {
-					buffers[i], recycledBuffer = recycledBuffer, nil
-					break
-				}
-			}
-			if recycledBuffer != nil {
-				panic("unreachable")
-			}
+			buffers = append(buffers, recycledBuffer)
 		}
 
 		// If there's existing outWork, sending it trumps making new outWork.
@@ -376,28 +475,21 @@ loop:
 
 		// Find a new or recycled buffer.
 		buffer := (*rBuffer)(nil)
-		{
-			b := -1
-			if buffers[0] != nil {
-				b = 0
-			} else if buffers[1] != nil {
-				b = 1
-			}
-
-			if b >= 0 {
-				buffer, buffers[b] = buffers[b], nil
-			} else if canAlloc == 0 {
-				// Wait until we receive a recycled buffer.
-				continue loop
-			} else {
-				canAlloc--
-				buffer = &rBuffer{}
-			}
+		if n := len(buffers); n > 0 {
+			buffer, buffers = buffers[n-1], buffers[:n-1]
+		} else if numOwned >= atomic.LoadInt32(&shared.readAhead) {
+			// Wait until we receive a recycled buffer, and let the
+			// concReader know that we're waiting.
+			atomic.StoreInt32(&shared.bufferStarved, 1)
+			continue loop
+		} else {
+			numOwned++
+			buffer = getRBuffer(shared.bufferLog2)
 		}
 
 		// Make a new outWork, shrinking dRange to be whatever's left over.
 		{
-			n, err := racReader.Read(buffer[:])
+			n, err := racReader.Read(*buffer)
 			if err == io.EOF {
 				err = nil
 			}
@@ -0,0 +1,194 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package rac
+
+import (
+	"sync"
+)
+
+const (
+	numWWorksPerWorker = 2
+)
+
+// wWork is a unit of work for concurrent writing: one chunk's worth of
+// uncompressed bytes, sent from the concWriter to a Worker, and that chunk's
+// compressed form, sent back.
+type wWork struct {
+	// These fields are set by the concWriter, for a Worker's incoming work.
+	//
+	// dBytes holds the chunk's uncompressed bytes, shorn of any trailing
+	// zeroes. dBytes[:split] and dBytes[split:] are passed as the p and q
+	// arguments to CodecWriter.Compress, the same as a non-concurrent Writer
+	// would pass.
+	//
+	// dSize is the chunk's size in DSpace, including any trailing zeroes.
+	dBytes []byte
+	split  int
+	dSize  uint64
+
+	// These fields are set by a Worker, for the concWriter's outgoing work.
+	// They are the CodecWriter.Compress results, other than cBytes being a
+	// copy (owned by this wWork) instead of memory owned by the CodecWriter.
+	err            error
+	codec          Codec
+	cBytes         []byte
+	index2, index3 int
+
+	// donec is sent to, by a Worker, when the work is complete.
+	donec chan struct{}
+}
+
+// concWriter co-ordinates multiple Worker goroutines serving a Writer.
+//
+// The Writer's goroutine sends chunks to compress via reqc. Chunks are
+// compressed in parallel, but their results are added to the ChunkWriter in
+// their original order, so that the RAC file is byte-for-byte identical to
+// what a non-concurrent Writer would produce.
+type concWriter struct {
+	// reqc is the Work-Request channel. The Writer sends and each Worker
+	// recvs. Its capacity equals maxPending, so that sending never blocks.
+	reqc chan *wWork
+
+	// pendingWorks are the units of work sent to Workers but not yet added to
+	// the ChunkWriter, in chunk order. Its length is at most maxPending, which
+	// bounds the memory used by in-flight chunks.
+	pendingWorks []*wWork
+	maxPending   int
+
+	// freeWorks are units of work (and their buffers) available for re-use.
+	freeWorks []*wWork
+
+	// codecWriters are the Workers' CodecWriter clones.
+	codecWriters []CodecWriter
+
+	// numWorkers is the number of concurrent Workers.
+	numWorkers int
+
+	// waitGroup tracks the Workers' goroutines, so that close can wait for
+	// them to finish before closing their codecWriters.
+	waitGroup sync.WaitGroup
+}
+
+func (c *concWriter) initialize(racWriter *Writer) {
+	if (racWriter.Concurrency <= 1) || (racWriter.dChunkSize == 0) {
+		return
+	}
+	c.numWorkers = racWriter.Concurrency
+	if c.numWorkers > 65536 {
+		c.numWorkers = 65536
+	}
+	c.maxPending = c.numWorkers * numWWorksPerWorker
+	c.reqc = make(chan *wWork, c.maxPending)
+
+	c.codecWriters = make([]CodecWriter, c.numWorkers)
+	for i := range c.codecWriters {
+		c.codecWriters[i] = racWriter.CodecWriter.Clone()
+	}
+	c.waitGroup.Add(c.numWorkers)
+	for _, cw := range c.codecWriters {
+		go runWWorker(&c.waitGroup, c.reqc, cw, racWriter.ResourcesData)
+	}
+}
+
+func runWWorker(waitGroup *sync.WaitGroup, reqc <-chan *wWork, codecWriter CodecWriter, resourcesData [][]byte) {
+	defer waitGroup.Done()
+	for work := range reqc {
+		codec, cBytes, index2, index3, err := codecWriter.Compress(
+			work.dBytes[:work.split], work.dBytes[work.split:], resourcesData)
+		work.err = err
+		work.codec = codec
+		work.cBytes = append(work.cBytes[:0], cBytes...)
+		work.index2 = index2
+		work.index3 = index3
+		work.donec <- struct{}{}
+	}
+}
+
+// submit copies the chunk p+q, whose DSpace size is dSize, and sends it to a
+// Worker to compress. If there are already maxPending chunks in flight, it
+// first waits for the oldest one to complete and adds it to the ChunkWriter.
+func (c *concWriter) submit(racWriter *Writer, p []byte, q []byte, dSize uint64) error {
+	if len(c.pendingWorks) >= c.maxPending {
+		if err := c.addOldest(racWriter); err != nil {
+			return err
+		}
+	}
+
+	work := (*wWork)(nil)
+	if n := len(c.freeWorks); n > 0 {
+		work, c.freeWorks = c.freeWorks[n-1], c.freeWorks[:n-1]
+	} else {
+		work = &wWork{donec: make(chan struct{}, 1)}
+	}
+	work.dBytes = append(append(work.dBytes[:0], p...), q...)
+	work.split = len(p)
+	work.dSize = dSize
+
+	c.pendingWorks = append(c.pendingWorks, work)
+	c.reqc <- work
+	return nil
+}
+
+// addOldest waits for the oldest pending chunk to be compressed and then adds
+// it to the ChunkWriter.
+func (c *concWriter) addOldest(racWriter *Writer) error {
+	work := c.pendingWorks[0]
+	<-work.donec
+	copy(c.pendingWorks, c.pendingWorks[1:])
+	c.pendingWorks[len(c.pendingWorks)-1] = nil
+	c.pendingWorks = c.pendingWorks[:len(c.pendingWorks)-1]
+	defer func() {
+		c.freeWorks = append(c.freeWorks, work)
+	}()
+
+	if work.err != nil {
+		racWriter.err = work.err
+		return work.err
+	}
+	return racWriter.addChunk(work.dSize, work.codec, work.cBytes, work.index2, work.index3)
+}
+
+// flush waits for all pending chunks to be compressed and adds them to the
+// ChunkWriter.
+func (c *concWriter) flush(racWriter *Writer) error {
+	for len(c.pendingWorks) > 0 {
+		if err := c.addOldest(racWriter); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// close stops the Workers, waiting for them to finish, and closes their
+// CodecWriter clones.
+func (c *concWriter) close() error {
+	if c.reqc == nil {
+		return nil
+	}
+	close(c.reqc)
+	c.reqc = nil
+	c.waitGroup.Wait()
+
+	retErr := error(nil)
+	for _, cw := range c.codecWriters {
+		if err := cw.Close(); retErr == nil {
+			retErr = err
+		}
+	}
+	c.codecWriters = nil
+	c.pendingWorks = nil
+	c.freeWorks = nil
+	return retErr
+}
@@ -15,6 +15,7 @@
 package rac
 
 import (
+	"bytes"
 	"fmt"
 	"io"
 )
@@ -101,6 +102,32 @@ type Reader struct {
 	// (single-goroutine) reader.
 	Concurrency int
 
+	// ReadAhead is, when Concurrency is positive, the maximum number of
+	// decompressed buffers that each worker goroutine may fill ahead of the
+	// Read calls. Each worker starts with a smaller read-ahead depth, which
+	// deepens whenever Read has to wait for a worker that was itself waiting
+	// for its buffers to be consumed.
+	//
+	// Non-positive values (including zero) mean a default maximum of 8.
+	ReadAhead int
+
+	// BufferSize is, when Concurrency is positive, the size (in bytes) of
+	// each of those buffers. It is rounded up to a power of 2 between 4 KiB
+	// and 1 MiB inclusive. Buffers are pooled and re-used across Readers.
+	//
+	// Non-positive values (including zero) mean to match the size (in DSpace)
+	// of the RAC file's first chunk, as RAC files usually have uniformly
+	// sized chunks.
+	BufferSize int
+
+	// ChunkCache, if non-nil, caches decompressed chunks, so that re-reading
+	// (e.g. after seeking) a recently read chunk does not decompress it again.
+	//
+	// The same ChunkCache may be shared by multiple Readers (including any
+	// that are created internally when Concurrency is positive) provided that
+	// they all read the same RAC file.
+	ChunkCache *ChunkCache
+
 	// err is the first error encountered. It is sticky: once a non-nil error
 	// occurs, all public methods will return that error.
 	err error
@@ -165,6 +192,9 @@ type Reader struct {
 	// zeroes serves the Zeroes Codec.
 	zeroes zeroesReader
 
+	// cached serves chunks whose decompressed data is in the ChunkCache.
+	cached bytes.Reader
+
 	// concReader decodes the RAC-compressed data concurrently.
 	concReader concReader
 }
@@ -199,6 +229,9 @@ func (r *Reader) clone() *Reader {
 		CompressedSize: r.CompressedSize,
 		CodecReaders:   make([]CodecReader, len(r.CodecReaders)),
 		Concurrency:    r.Concurrency,
+		ReadAhead:      r.ReadAhead,
+		BufferSize:     r.BufferSize,
+		ChunkCache:     r.ChunkCache,
 	}
 	for i := range c.CodecReaders {
 		c.CodecReaders[i] = r.CodecReaders[i].Clone()
@@ -213,7 +246,9 @@ func (r *Reader) Read(p []byte) (int, error) {
 	}
 	if r.concReader.ready() {
 		n, err := r.concReader.Read(p)
-		r.err = err
+		if err != io.EOF {
+			r.err = err
+		}
 		return n, err
 	}
 
@@ -390,6 +425,10 @@ func (r *Reader) nextChunk() error {
 		return r.err
 	}
 
+	if r.ChunkCache != nil {
+		return r.nextCachedChunk(codecReader, chunk)
+	}
+
 	decompressor, err := codecReader.MakeDecompressor(r.chunkReader.readSeeker, chunk)
 	if err != nil {
 		if err == io.EOF {
@@ -403,6 +442,42 @@ func (r *Reader) nextChunk() error {
 	return nil
 }
 
+// nextCachedChunk is like nextChunk's final steps, but the chunk's
+// decompressed data comes from r.ChunkCache. On a cache miss, the whole chunk
+// is decompressed and added to the cache.
+func (r *Reader) nextCachedChunk(codecReader CodecReader, chunk Chunk) error {
+	data, ok := r.ChunkCache.get(chunk)
+	if !ok {
+		decompressor, err := codecReader.MakeDecompressor(r.chunkReader.readSeeker, chunk)
+		if err == nil {
+			data, err = readChunkData(decompressor, chunk.DRange.Size())
+		}
+		if err != nil {
+			if err == io.EOF {
+				err = io.ErrUnexpectedEOF
+			}
+			r.err = err
+			return r.err
+		}
+		r.ChunkCache.put(chunk, data)
+	}
+
+	// If the chunk started before r.pos, skip the opening bytes of the
+	// chunk's decompressed data directly, instead of via readExplicitData's
+	// decompress-and-discard loop.
+	r.dRange = chunk.DRange
+	if skip := r.pos - r.dRange[0]; skip > 0 {
+		if skip > int64(len(data)) {
+			skip = int64(len(data))
+		}
+		data = data[skip:]
+		r.dRange[0] += skip
+	}
+	r.cached.Reset(data)
+	r.decompressor = &r.cached
+	return nil
+}
+
 // Seek implements io.Seeker.
 func (r *Reader) Seek(offset int64, whence int) (int64, error) {
 	if err := r.initialize(); err != nil {
@@ -311,6 +311,24 @@ type Writer struct {
 	// https://github.com/google/brotli/blob/master/research/dictionary_generator.cc
 	ResourcesData [][]byte
 
+	// Concurrency is how many worker goroutines are used to compress RAC
+	// chunks. Bigger values often lead to faster throughput, up to a
+	// hardware-dependent point, but also larger memory requirements: up to
+	// (2 * Concurrency) chunks, compressed and uncompressed, can be in flight
+	// at any one time.
+	//
+	// The RAC file produced is identical to that of a non-concurrent Writer,
+	// provided that the CodecWriter's Compress output depends only on its
+	// arguments. Each worker uses its own CodecWriter.Clone.
+	//
+	// Concurrency only applies when the DChunkSize field is used. When the
+	// CChunkSize field is used, each chunk's DSpace extent depends on
+	// compressing the previous chunk, so compression is sequential.
+	//
+	// Values of 1 or less (including zero) mean a non-concurrent
+	// (single-goroutine) writer.
+	Concurrency int
+
 	// resourcesIDs is the OptResource for each ResourcesData element. Zero
 	// means that corresponding resource is not yet used (and not yet written
 	// to the RAC file).
@@ -333,6 +351,10 @@ type Writer struct {
 	// (via the Write method) but not yet compressed as a chunk.
 	uncompressed writeBuffer
 
+	// concWriter co-ordinates multiple worker goroutines, if Concurrency is
+	// greater than 1.
+	concWriter concWriter
+
 	// closed is whether this Writer is closed.
 	closed bool
 }
@@ -374,6 +396,7 @@ func (w *Writer) initialize() error {
 	w.chunkWriter.IndexLocation = w.IndexLocation
 	w.chunkWriter.TempFile = w.TempFile
 	w.chunkWriter.CPageSize = w.CPageSize
+	w.concWriter.initialize(w)
 	return nil
 }
 
@@ -444,28 +467,44 @@ func (w *Writer) writeDChunks(eof bool) error {
 			peek0 = stripTrailingZeroes(peek0)
 		}
 
+		if w.concWriter.numWorkers > 0 {
+			if err := w.concWriter.submit(w, peek0, peek1, dSize); err != nil {
+				return err
+			}
+			w.uncompressed.advance(dSize)
+			continue
+		}
+
 		codec, cBytes, index2, index3, err :=
 			w.CodecWriter.Compress(peek0, peek1, w.ResourcesData)
 		if err != nil {
 			return err
 		}
-		res2, err := w.useResource(index2)
-		if err != nil {
-			return err
-		}
-		res3, err := w.useResource(index3)
-		if err != nil {
-			return err
-		}
-
-		if err := w.chunkWriter.AddChunk(dSize, codec, cBytes, res2, res3); err != nil {
-			w.err = err
+		if err := w.addChunk(dSize, codec, cBytes, index2, index3); err != nil {
 			return err
 		}
 		w.uncompressed.advance(dSize)
 	}
 }
 
+// addChunk marks the chunk's secondary and tertiary resources (if any) as used
+// and then adds the chunk to the low-level chunk writer.
+func (w *Writer) addChunk(dSize uint64, codec Codec, cBytes []byte, index2 int, index3 int) error {
+	res2, err := w.useResource(index2)
+	if err != nil {
+		return err
+	}
+	res3, err := w.useResource(index3)
+	if err != nil {
+		return err
+	}
+	if err := w.chunkWriter.AddChunk(dSize, codec, cBytes, res2, res3); err != nil {
+		w.err = err
+		return err
+	}
+	return nil
+}
+
 func (w *Writer) writeCChunks(eof bool) error {
 	// Each outer loop iteration tries to write exactly one chunk.
 outer:
@@ -566,7 +605,8 @@ func (w *Writer) tryCChunk(targetDChunkSize uint64, force bool) error {
 // Close writes the RAC index to w.Writer and marks that w accepts no further
 // method calls.
 //
-// Calling Close will call Close on w's CodecWriter.
+// Calling Close will call Close on w's CodecWriter (and on its clones, if
+// Concurrency is greater than 1).
 //
 // For a one pass encoding, no further action is taken. For a two pass encoding
 // (i.e. IndexLocationAtStart), it then copies w.TempFile to w.Writer. Either
@@ -587,6 +627,12 @@ func (w *Writer) Close() error {
 	if w.err == nil {
 		w.err = w.write(true)
 	}
+	if w.err == nil {
+		w.err = w.concWriter.flush(w)
+	}
+	if err := w.concWriter.close(); w.err == nil {
+		w.err = err
+	}
 	if w.err == nil {
 		w.err = w.chunkWriter.Close()
 	}
@@ -20,6 +20,7 @@ import (
 	"fmt"
 	"hash/crc32"
 	"io"
+	"io/ioutil"
 	"strings"
 	"testing"
 
@@ -59,6 +60,15 @@ const (
 )
 
 func racCompress(original []byte, cChunkSize uint64, dChunkSize uint64, resourcesData [][]byte) ([]byte, error) {
+	return racCompressConcurrently(original, cChunkSize, dChunkSize, resourcesData, 0, len(original))
+}
+
+// racCompressConcurrently is like racCompress but with a rac.Writer.Concurrency
+// value and with the original bytes being presented to rac.Writer.Write in
+// pieces of at most writeSize bytes.
+func racCompressConcurrently(original []byte, cChunkSize uint64, dChunkSize uint64, resourcesData [][]byte,
+	concurrency int, writeSize int) ([]byte, error) {
+
 	buf := &bytes.Buffer{}
 	w := &rac.Writer{
 		Writer:        buf,
@@ -66,9 +76,17 @@ func racCompress(original []byte, cChunkSize uint64, dChunkSize uint64, resource
 		CChunkSize:    cChunkSize,
 		DChunkSize:    dChunkSize,
 		ResourcesData: resourcesData,
+		Concurrency:   concurrency,
 	}
-	if _, err := w.Write(original); err != nil {
-		return nil, fmt.Errorf("Write: %v", err)
+	for p := original; len(p) > 0; {
+		n := len(p)
+		if n > writeSize {
+			n = writeSize
+		}
+		if _, err := w.Write(p[:n]); err != nil {
+			return nil, fmt.Errorf("Write: %v", err)
+		}
+		p = p[n:]
 	}
 	if err := w.Close(); err != nil {
 		return nil, fmt.Errorf("Close: %v", err)
@@ -283,6 +301,59 @@ func TestSharedDictionary(tt *testing.T) {
 	}
 }
 
+func TestConcurrentWriter(tt *testing.T) {
+	// Make some original data: a mixture of text, zeroes (some of which are
+	// trailing zeroes of a chunk) and text that is better compressed with the
+	// shared dictionary.
+	dictionary := []byte(strings.Repeat("The quick brown fox jumps over the lazy dog. ", 8))
+	original := []byte(nil)
+	for i := 0; len(original) < 20000; i++ {
+		switch i % 4 {
+		case 0:
+			original = append(original, fmt.Sprintf("Line %d of some less compressible text.\n", i*i)...)
+		case 1:
+			original = append(original, make([]byte, i%97)...)
+		case 2:
+			original = append(original, dictionary[i%len(dictionary):]...)
+		case 3:
+			original = append(original, decodedMore...)
+		}
+	}
+
+	for _, resourcesData := range [][][]byte{nil, {dictionary}} {
+		for _, dChunkSize := range []uint64{100, 1000, 65536} {
+			want, err := racCompress(original, 0, dChunkSize, resourcesData)
+			if err != nil {
+				tt.Fatalf("dChunkSize=%d: racCompress: %v", dChunkSize, err)
+			}
+
+			for _, concurrency := range []int{2, 3, 8} {
+				for _, writeSize := range []int{777, len(original)} {
+					got, err := racCompressConcurrently(
+						original, 0, dChunkSize, resourcesData, concurrency, writeSize)
+					if err != nil {
+						tt.Fatalf("dChunkSize=%d, concurrency=%d, writeSize=%d: racCompressConcurrently: %v",
+							dChunkSize, concurrency, writeSize, err)
+					}
+					if !bytes.Equal(got, want) {
+						tt.Fatalf("dChunkSize=%d, concurrency=%d, writeSize=%d: "+
+							"output differs from the non-concurrent Writer's",
+							dChunkSize, concurrency, writeSize)
+					}
+				}
+			}
+
+			decompressed, err := racDecompress(want, 0)
+			if err != nil {
+				tt.Fatalf("dChunkSize=%d: racDecompress: %v", dChunkSize, err)
+			}
+			if !bytes.Equal(decompressed, original) {
+				tt.Fatalf("dChunkSize=%d: round trip did not match original", dChunkSize)
+			}
+		}
+	}
+}
+
 // rsSansReadAt wraps a strings.Reader to have only Read and Seek methods.
 type rsSansReadAt struct {
 	r *strings.Reader
@@ -328,3 +399,134 @@ func TestReadSeekerSansReadAt(tt *testing.T) {
 func TestReadSeekerWithReadAt(tt *testing.T) {
 	testReadSeeker(tt, &rsWithReadAt{strings.NewReader(encodedSheep)})
 }
+
+func TestChunkCache(tt *testing.T) {
+	const dChunkSize = 100
+	original := make([]byte, 8*dChunkSize)
+	for i := range original {
+		original[i] = byte(i%250) + 1
+	}
+	// Give the last chunk some implicit zeroes.
+	for i := 7*dChunkSize + 60; i < len(original); i++ {
+		original[i] = 0
+	}
+
+	compressed, err := racCompress(original, 0, dChunkSize, nil)
+	if err != nil {
+		tt.Fatalf("racCompress: %v", err)
+	}
+
+	cache := &rac.ChunkCache{MaxSize: 3 * dChunkSize}
+	readers := [2]*rac.Reader{}
+	for i := range readers {
+		readers[i] = &rac.Reader{
+			ReadSeeker:     bytes.NewReader(compressed),
+			CompressedSize: int64(len(compressed)),
+			CodecReaders:   []rac.CodecReader{&CodecReader{}},
+			ChunkCache:     cache,
+		}
+		defer readers[i].Close()
+	}
+
+	testCases := []struct {
+		reader int
+		pos    int
+		n      int
+		stats  rac.ChunkCacheStats
+	}{
+		{0, 10, 20, rac.ChunkCacheStats{Misses: 1, NumChunks: 1, Size: 100}},
+		{0, 150, 30, rac.ChunkCacheStats{Misses: 2, NumChunks: 2, Size: 200}},
+		{1, 50, 50, rac.ChunkCacheStats{Hits: 1, Misses: 2, NumChunks: 2, Size: 200}},
+		{1, 120, 5, rac.ChunkCacheStats{Hits: 2, Misses: 2, NumChunks: 2, Size: 200}},
+		{0, 299, 1, rac.ChunkCacheStats{Hits: 2, Misses: 3, NumChunks: 3, Size: 300}},
+		{0, 300, 1, rac.ChunkCacheStats{Hits: 2, Misses: 4, Evictions: 1, NumChunks: 3, Size: 300}},
+		{1, 0, 1, rac.ChunkCacheStats{Hits: 2, Misses: 5, Evictions: 2, NumChunks: 3, Size: 300}},
+		{1, 755, 45, rac.ChunkCacheStats{Hits: 2, Misses: 6, Evictions: 3, NumChunks: 3, Size: 260}},
+		{0, 790, 10, rac.ChunkCacheStats{Hits: 3, Misses: 6, Evictions: 3, NumChunks: 3, Size: 260}},
+	}
+
+	for i, tc := range testCases {
+		r := readers[tc.reader]
+		if _, err := r.Seek(int64(tc.pos), io.SeekStart); err != nil {
+			tt.Fatalf("i=%d: Seek: %v", i, err)
+		}
+		got := make([]byte, tc.n)
+		if _, err := io.ReadFull(r, got); err != nil {
+			tt.Fatalf("i=%d: ReadFull: %v", i, err)
+		}
+		if want := original[tc.pos : tc.pos+tc.n]; !bytes.Equal(got, want) {
+			tt.Fatalf("i=%d: got\n% 02x\nwant\n% 02x", i, got, want)
+		}
+		if got, want := cache.Stats(), tc.stats; got != want {
+			tt.Fatalf("i=%d: Stats: got %+v, want %+v", i, got, want)
+		}
+	}
+
+	// A Concurrent Reader's internal clones share the cache too.
+	buf := &bytes.Buffer{}
+	r := &rac.Reader{
+		ReadSeeker:     bytes.NewReader(compressed),
+		CompressedSize: int64(len(compressed)),
+		CodecReaders:   []rac.CodecReader{&CodecReader{}},
+		Concurrency:    2,
+		ChunkCache:     cache,
+	}
+	defer r.Close()
+	if _, err := io.Copy(buf, r); err != nil {
+		tt.Fatalf("io.Copy: %v", err)
+	}
+	if got, want := buf.Bytes(), original; !bytes.Equal(got, want) {
+		tt.Fatalf("Concurrent: got\n% 02x\nwant\n% 02x", got, want)
+	}
+	if got := cache.Stats(); got.Hits+got.Misses != 17 {
+		tt.Fatalf("Concurrent: Stats: got %+v, want 17 lookups", got)
+	}
+}
+
+func TestConcurrentReaderBufferSizes(tt *testing.T) {
+	original := make([]byte, 300000)
+	for i := range original {
+		original[i] = "abcdefghijklmnopqrstuvwxyz\n"[(i*i)%27]
+	}
+	compressed, err := racCompress(original, 0, 50000, nil)
+	if err != nil {
+		tt.Fatalf("racCompress: %v", err)
+	}
+
+	testCases := []struct {
+		bufferSize int
+		readAhead  int
+	}{
+		{0, 0},
+		{1, 1},
+		{5000, 3},
+		{70000, 0},
+		{1 << 30, 100},
+	}
+
+	for i, tc := range testCases {
+		r := &rac.Reader{
+			ReadSeeker:     bytes.NewReader(compressed),
+			CompressedSize: int64(len(compressed)),
+			CodecReaders:   []rac.CodecReader{&CodecReader{}},
+			Concurrency:    3,
+			BufferSize:     tc.bufferSize,
+			ReadAhead:      tc.readAhead,
+		}
+		for _, pos := range []int{0, 123456, 49999, 250000} {
+			if _, err := r.Seek(int64(pos), io.SeekStart); err != nil {
+				tt.Fatalf("i=%d, pos=%d: Seek: %v", i, pos, err)
+			}
+			got, err := ioutil.ReadAll(r)
+			if err != nil {
+				tt.Fatalf("i=%d, pos=%d: ReadAll: %v", i, pos, err)
+			}
+			if !bytes.Equal(got, original[pos:]) {
+				tt.Fatalf("i=%d, pos=%d: mismatch", i, pos)
+			}
+		}
+		if err := r.Close(); err != nil {
+			tt.Fatalf("i=%d: Close: %v", i, err)
+		}
+	}
+}
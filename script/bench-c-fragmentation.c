@@ -0,0 +1,604 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+// This file contains a hand-written C benchmark of decoding under fragmented
+// I/O, generalizing bench-c-deflate-fragmentation.c (which is specific to
+// PNG's zlib-compressed IDAT chunks) to every std/* decoder.
+//
+// Wuffs decoders are coroutines. When the source buffer runs dry (or the
+// destination buffer fills up), they suspend with a "$short read" (or "$short
+// write") status and resume where they left off on the next call. Data that
+// arrives over a network, or is written to a small fixed-size buffer, can
+// cause many such suspensions, and different codecs pay different costs for
+// each one.
+//
+// This program decodes stdin with a matrix of read chunk sizes (the input is
+// made available that many bytes at a time) and write chunk sizes (the output
+// buffer holds that many bytes or, for JSON, tokens). "full" means the entire
+// input or output at once. Image decoders write into a whole-image pixel
+// buffer, so they only have the "full" write chunk size.
+//
+// Usage:
+//
+// gcc -O3 bench-c-fragmentation.c && ./a.out gzip < ../test/data/pi.txt.gz
+//
+// where the codec name is one of bmp, deflate, gif, gzip, json, lz4, lzw, png,
+// wbmp, zlib or zstd. For lzw, the first byte of the input is the literal
+// width, as in the test/data/*.giflzw files.
+//
+// Each output line reports the time per decode, the throughput (measured in
+// compressed, or source, bytes per second) and the number of suspensions per
+// decode, e.g.:
+//
+// Benchmarkgzip_r1460_w1024/gcc  100  392910 ns/op  123.038 MB/s  123 susp/op
+//
+// Comparing a codec's r1460_w1024 line with its rfull_wfull line shows how
+// well it tolerates fragmented I/O.
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../release/c/wuffs-unsupported-snapshot.c"
+
+// The order matters here. Clang also defines "__GNUC__".
+#if defined(__clang__)
+const char* g_cc = "clang";
+const char* g_cc_version = __clang_version__;
+#elif defined(__GNUC__)
+const char* g_cc = "gcc";
+const char* g_cc_version = __VERSION__;
+#elif defined(_MSC_VER)
+const char* g_cc = "cl";
+const char* g_cc_version = "???";
+#else
+const char* g_cc = "cc";
+const char* g_cc_version = "???";
+#endif
+
+// Limit the input to (64 MiB - 1 byte) and the decoded output (for image
+// decoders, the BGRA pixel buffer) to 256 MiB. This is a limitation of this
+// program (which uses the Wuffs standard library), not a limitation of Wuffs
+// per se. Decoded bytes (other than pixels) and tokens are discarded whenever
+// the write chunk fills up, so their total length is not limited.
+#define DST_BUFFER_ARRAY_SIZE (256 * 1024 * 1024)
+#define SRC_BUFFER_ARRAY_SIZE (64 * 1024 * 1024)
+#define TOKEN_BUFFER_ARRAY_SIZE (1024 * 1024)
+
+uint8_t g_dst_buffer_array[DST_BUFFER_ARRAY_SIZE] = {0};
+uint8_t g_src_buffer_array[SRC_BUFFER_ARRAY_SIZE] = {0};
+size_t g_src_len = 0;
+wuffs_base__token g_token_buffer_array[TOKEN_BUFFER_ARRAY_SIZE] = {0};
+
+uint8_t* g_work_buffer_array = NULL;
+size_t g_work_buffer_len = 0;
+
+// A chunk size of 0 means "full": the entire input or output at once.
+size_t g_read_chunk_sizes[] = {0, 16384, 1460, 256};
+size_t g_write_chunk_sizes[] = {0, 16384, 1024};
+
+#define NUM_READ_CHUNK_SIZES \
+  (sizeof(g_read_chunk_sizes) / sizeof(g_read_chunk_sizes[0]))
+#define NUM_WRITE_CHUNK_SIZES \
+  (sizeof(g_write_chunk_sizes) / sizeof(g_write_chunk_sizes[0]))
+
+typedef enum {
+  KIND_IO_TRANSFORMER,
+  KIND_TOKEN_DECODER,
+  KIND_IMAGE_DECODER,
+} codec_kind;
+
+typedef struct {
+  const char* name;
+  codec_kind kind;
+} codec;
+
+codec g_codecs[] = {
+    {"bmp", KIND_IMAGE_DECODER},      //
+    {"deflate", KIND_IO_TRANSFORMER},  //
+    {"gif", KIND_IMAGE_DECODER},       //
+    {"gzip", KIND_IO_TRANSFORMER},     //
+    {"json", KIND_TOKEN_DECODER},      //
+    {"lz4", KIND_IO_TRANSFORMER},      //
+    {"lzw", KIND_IO_TRANSFORMER},      //
+    {"png", KIND_IMAGE_DECODER},       //
+    {"wbmp", KIND_IMAGE_DECODER},      //
+    {"zlib", KIND_IO_TRANSFORMER},     //
+    {"zstd", KIND_IO_TRANSFORMER},     //
+};
+
+const codec* g_codec = NULL;
+
+// ----
+
+// The counters are reset at the start of each decode_once call.
+uint64_t g_num_suspensions = 0;
+// g_num_outputs counts the decoded bytes, token lengths or frames. It should
+// be the same regardless of the chunk sizes.
+uint64_t g_num_outputs = 0;
+
+const char*  //
+read_stdin() {
+  while (g_src_len < SRC_BUFFER_ARRAY_SIZE) {
+    const int stdin_fd = 0;
+    ssize_t n = read(stdin_fd, g_src_buffer_array + g_src_len,
+                     SRC_BUFFER_ARRAY_SIZE - g_src_len);
+    if (n > 0) {
+      g_src_len += n;
+    } else if (n == 0) {
+      return NULL;
+    } else if (errno == EINTR) {
+      // No-op.
+    } else {
+      return strerror(errno);
+    }
+  }
+  return "input is too large";
+}
+
+const char*  //
+ensure_work_buffer(wuffs_base__range_ii_u64 workbuf_len) {
+  if (workbuf_len.max_incl > SIZE_MAX) {
+    return "work buffer is too large";
+  }
+  size_t n = (size_t)(workbuf_len.max_incl);
+  if (g_work_buffer_len < n) {
+    free(g_work_buffer_array);
+    g_work_buffer_array = (uint8_t*)malloc(n);
+    if (!g_work_buffer_array) {
+      g_work_buffer_len = 0;
+      return "out of memory";
+    }
+    g_work_buffer_len = n;
+  }
+  return NULL;
+}
+
+// make_src returns a reader over the first rchunk bytes (or all bytes, if
+// rchunk is zero) of g_src_buffer_array[skip:g_src_len].
+wuffs_base__io_buffer  //
+make_src(size_t skip, size_t rchunk) {
+  wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+      g_src_buffer_array + skip, g_src_len - skip, true);
+  if ((rchunk > 0) && (rchunk < src.meta.wi)) {
+    src.meta.wi = rchunk;
+    src.meta.closed = false;
+  }
+  return src;
+}
+
+// more_src makes the next rchunk bytes of input available, as if they had
+// just arrived. It returns false if there are no more bytes.
+bool  //
+more_src(wuffs_base__io_buffer* src, size_t rchunk) {
+  if (src->meta.closed) {
+    return false;
+  }
+  size_t n = src->data.len - src->meta.wi;
+  if (n > rchunk) {
+    n = rchunk;
+  }
+  src->meta.wi += n;
+  src->meta.closed = src->meta.wi == src->data.len;
+  return true;
+}
+
+// ----
+
+// count_token_lengths adds the total length of the tokens in tok to
+// g_num_outputs. The number of tokens can depend on the chunk sizes (e.g. a
+// string split across read chunks can be split into multiple tokens) but the
+// total length, the number of source bytes consumed, does not.
+void  //
+count_token_lengths(wuffs_base__token_buffer* tok) {
+  size_t i;
+  for (i = tok->meta.ri; i < tok->meta.wi; i++) {
+    g_num_outputs += wuffs_base__token__length(&tok->data.ptr[i]);
+  }
+}
+
+const char*  //
+decode_io_transformer(size_t rchunk, size_t wchunk) {
+  wuffs_base__io_transformer* dec = NULL;
+  size_t skip = 0;
+  if (!strcmp(g_codec->name, "deflate")) {
+    dec = wuffs_deflate__decoder__alloc_as__wuffs_base__io_transformer();
+  } else if (!strcmp(g_codec->name, "gzip")) {
+    dec = wuffs_gzip__decoder__alloc_as__wuffs_base__io_transformer();
+  } else if (!strcmp(g_codec->name, "lz4")) {
+    dec = wuffs_lz4__decoder__alloc_as__wuffs_base__io_transformer();
+  } else if (!strcmp(g_codec->name, "lzw")) {
+    if (g_src_len < 1) {
+      return "missing LZW literal width";
+    }
+    dec = wuffs_lzw__decoder__alloc_as__wuffs_base__io_transformer();
+    if (dec) {
+      wuffs_lzw__decoder__set_literal_width((wuffs_lzw__decoder*)dec,
+                                            g_src_buffer_array[0]);
+    }
+    skip = 1;
+  } else if (!strcmp(g_codec->name, "zlib")) {
+    dec = wuffs_zlib__decoder__alloc_as__wuffs_base__io_transformer();
+  } else if (!strcmp(g_codec->name, "zstd")) {
+    dec = wuffs_zstd__decoder__alloc_as__wuffs_base__io_transformer();
+  }
+  if (!dec) {
+    return "out of memory";
+  }
+
+  const char* ret = ensure_work_buffer(
+      wuffs_base__io_transformer__workbuf_len(dec));
+  if (ret) {
+    free(dec);
+    return ret;
+  }
+
+  wuffs_base__io_buffer dst = wuffs_base__ptr_u8__writer(
+      g_dst_buffer_array,
+      (wchunk > 0) ? wchunk : DST_BUFFER_ARRAY_SIZE);
+  wuffs_base__io_buffer src = make_src(skip, rchunk);
+  while (true) {
+    wuffs_base__status status = wuffs_base__io_transformer__transform_io(
+        dec, &dst, &src,
+        wuffs_base__make_slice_u8(g_work_buffer_array, g_work_buffer_len));
+    if (wuffs_base__status__is_ok(&status)) {
+      g_num_outputs += dst.meta.wi;
+      break;
+    } else if ((status.repr != wuffs_base__suspension__short_read) &&
+               ((status.repr != wuffs_base__suspension__short_write) ||
+                (wchunk == 0))) {
+      ret = wuffs_base__status__message(&status);
+      break;
+    }
+    g_num_suspensions++;
+
+    // Like example/zcat, flush the decoded bytes (discarding them, as if they
+    // were written to a sink) after every suspension, not just "$short
+    // write". The next transform_io call's dst then holds either all of the
+    // output so far or none of it, which the deflate decoder's history
+    // bookkeeping requires.
+    if (wchunk > 0) {
+      g_num_outputs += dst.meta.wi;
+      dst.meta.ri = dst.meta.wi;
+      wuffs_base__io_buffer__compact(&dst);
+    }
+
+    if ((status.repr == wuffs_base__suspension__short_read) &&
+        !more_src(&src, rchunk)) {
+      ret = "unexpected end of input";
+      break;
+    }
+  }
+  free(dec);
+  return ret;
+}
+
+const char*  //
+decode_token_decoder(size_t rchunk, size_t wchunk) {
+  wuffs_base__token_decoder* dec =
+      wuffs_json__decoder__alloc_as__wuffs_base__token_decoder();
+  if (!dec) {
+    return "out of memory";
+  }
+
+  const char* ret =
+      ensure_work_buffer(wuffs_base__token_decoder__workbuf_len(dec));
+  if (ret) {
+    free(dec);
+    return ret;
+  }
+
+  wuffs_base__token_buffer tok =
+      wuffs_base__slice_token__writer(wuffs_base__make_slice_token(
+          g_token_buffer_array,
+          (wchunk > 0) ? wchunk : TOKEN_BUFFER_ARRAY_SIZE));
+  wuffs_base__io_buffer src = make_src(0, rchunk);
+  while (true) {
+    wuffs_base__status status = wuffs_base__token_decoder__decode_tokens(
+        dec, &tok, &src,
+        wuffs_base__make_slice_u8(g_work_buffer_array, g_work_buffer_len));
+    if (wuffs_base__status__is_ok(&status)) {
+      count_token_lengths(&tok);
+      break;
+    } else if ((status.repr != wuffs_base__suspension__short_read) &&
+               ((status.repr != wuffs_base__suspension__short_write) ||
+                (wchunk == 0))) {
+      ret = wuffs_base__status__message(&status);
+      break;
+    }
+    g_num_suspensions++;
+
+    // Flush (discard) the decoded tokens, as for decode_io_transformer.
+    if (wchunk > 0) {
+      count_token_lengths(&tok);
+      tok.meta.ri = tok.meta.wi;
+      wuffs_base__token_buffer__compact(&tok);
+    }
+
+    if ((status.repr == wuffs_base__suspension__short_read) &&
+        !more_src(&src, rchunk)) {
+      ret = "unexpected end of input";
+      break;
+    }
+  }
+  free(dec);
+  return ret;
+}
+
+const char*  //
+decode_image_decoder(size_t rchunk) {
+  wuffs_base__image_decoder* dec = NULL;
+  if (!strcmp(g_codec->name, "bmp")) {
+    dec = wuffs_bmp__decoder__alloc_as__wuffs_base__image_decoder();
+  } else if (!strcmp(g_codec->name, "gif")) {
+    dec = wuffs_gif__decoder__alloc_as__wuffs_base__image_decoder();
+  } else if (!strcmp(g_codec->name, "png")) {
+    dec = wuffs_png__decoder__alloc_as__wuffs_base__image_decoder();
+  } else if (!strcmp(g_codec->name, "wbmp")) {
+    dec = wuffs_wbmp__decoder__alloc_as__wuffs_base__image_decoder();
+  }
+  if (!dec) {
+    return "out of memory";
+  }
+
+  const char* ret = NULL;
+  wuffs_base__io_buffer src = make_src(0, rchunk);
+  wuffs_base__image_config ic = {0};
+  wuffs_base__pixel_buffer pb = {0};
+  wuffs_base__frame_config fc = {0};
+  wuffs_base__status status;
+
+  while (true) {
+    status = wuffs_base__image_decoder__decode_image_config(dec, &ic, &src);
+    if (status.repr != wuffs_base__suspension__short_read) {
+      break;
+    }
+    g_num_suspensions++;
+    if (!more_src(&src, rchunk)) {
+      break;
+    }
+  }
+  if (!wuffs_base__status__is_ok(&status)) {
+    ret = wuffs_base__status__message(&status);
+    goto done;
+  }
+
+  // Decode to BGRA_PREMUL, as example/convert-to-nia does.
+  uint32_t width = wuffs_base__pixel_config__width(&ic.pixcfg);
+  uint32_t height = wuffs_base__pixel_config__height(&ic.pixcfg);
+  if ((uint64_t)width * height > (DST_BUFFER_ARRAY_SIZE / 4)) {
+    ret = "image is too large";
+    goto done;
+  }
+  wuffs_base__pixel_config__set(&ic.pixcfg,
+                                WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+                                WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, width,
+                                height);
+  status = wuffs_base__pixel_buffer__set_from_slice(
+      &pb, &ic.pixcfg,
+      wuffs_base__make_slice_u8(g_dst_buffer_array,
+                                (size_t)width * height * 4));
+  if (!wuffs_base__status__is_ok(&status)) {
+    ret = wuffs_base__status__message(&status);
+    goto done;
+  }
+  ret = ensure_work_buffer(wuffs_base__image_decoder__workbuf_len(dec));
+  if (ret) {
+    goto done;
+  }
+
+  while (true) {
+    status = wuffs_base__image_decoder__decode_frame_config(dec, &fc, &src);
+    if (status.repr == wuffs_base__suspension__short_read) {
+      g_num_suspensions++;
+      if (!more_src(&src, rchunk)) {
+        ret = "unexpected end of input";
+        goto done;
+      }
+      continue;
+    } else if (status.repr == wuffs_base__note__end_of_data) {
+      break;
+    } else if (!wuffs_base__status__is_ok(&status)) {
+      ret = wuffs_base__status__message(&status);
+      goto done;
+    }
+
+    while (true) {
+      status = wuffs_base__image_decoder__decode_frame(
+          dec, &pb, &src, WUFFS_BASE__PIXEL_BLEND__SRC,
+          wuffs_base__make_slice_u8(g_work_buffer_array, g_work_buffer_len),
+          NULL);
+      if (status.repr != wuffs_base__suspension__short_read) {
+        break;
+      }
+      g_num_suspensions++;
+      if (!more_src(&src, rchunk)) {
+        ret = "unexpected end of input";
+        goto done;
+      }
+    }
+    if (!wuffs_base__status__is_ok(&status)) {
+      ret = wuffs_base__status__message(&status);
+      goto done;
+    }
+    g_num_outputs++;
+  }
+
+done:
+  free(dec);
+  return ret;
+}
+
+const char*  //
+decode_once(size_t rchunk, size_t wchunk) {
+  g_num_suspensions = 0;
+  g_num_outputs = 0;
+  switch (g_codec->kind) {
+    case KIND_IO_TRANSFORMER:
+      return decode_io_transformer(rchunk, wchunk);
+    case KIND_TOKEN_DECODER:
+      return decode_token_decoder(rchunk, wchunk);
+    case KIND_IMAGE_DECODER:
+      return decode_image_decoder(rchunk);
+  }
+  return "unsupported codec kind";
+}
+
+// ----
+
+void  //
+format_chunk_size(char* buf, size_t buf_len, size_t chunk_size) {
+  if (chunk_size == 0) {
+    snprintf(buf, buf_len, "full");
+  } else {
+    snprintf(buf, buf_len, "%zu", chunk_size);
+  }
+}
+
+const char*  //
+decode(size_t rchunk, size_t wchunk, uint64_t want_num_outputs) {
+  int reps;
+  if (g_src_len < 10000) {
+    reps = 1000;
+  } else if (g_src_len < 100000) {
+    reps = 100;
+  } else if (g_src_len < 1000000) {
+    reps = 10;
+  } else {
+    reps = 1;
+  }
+
+  struct timeval bench_start_tv;
+  gettimeofday(&bench_start_tv, NULL);
+
+  int i;
+  for (i = 0; i < reps; i++) {
+    const char* msg = decode_once(rchunk, wchunk);
+    if (msg) {
+      return msg;
+    }
+  }
+
+  struct timeval bench_finish_tv;
+  gettimeofday(&bench_finish_tv, NULL);
+  int64_t micros =
+      (int64_t)(bench_finish_tv.tv_sec - bench_start_tv.tv_sec) * 1000000 +
+      (int64_t)(bench_finish_tv.tv_usec - bench_start_tv.tv_usec);
+  uint64_t nanos = 1;
+  if (micros > 0) {
+    nanos = (uint64_t)(micros)*1000;
+  }
+
+  if (g_num_outputs != want_num_outputs) {
+    return "inconsistent output across chunk sizes";
+  }
+
+  char rbuf[32];
+  char wbuf[32];
+  format_chunk_size(rbuf, sizeof(rbuf), rchunk);
+  format_chunk_size(wbuf, sizeof(wbuf), wchunk);
+  printf("Benchmark%s_r%s_w%s/%s\t%8d\t%8" PRIu64
+         " ns/op\t%8.3f MB/s\t%8" PRIu64 " susp/op\n",
+         g_codec->name, rbuf, wbuf, g_cc, reps, nanos / reps,
+         ((double)(g_src_len) * reps * 1000) / ((double)nanos),
+         g_num_suspensions);
+
+  return NULL;
+}
+
+int  //
+fail(const char* msg) {
+  const int stderr_fd = 2;
+  write(stderr_fd, msg, strnlen(msg, 4095));
+  write(stderr_fd, "\n", 1);
+  return 1;
+}
+
+int  //
+main(int argc, char** argv) {
+  if (argc == 2) {
+    size_t i;
+    for (i = 0; i < sizeof(g_codecs) / sizeof(g_codecs[0]); i++) {
+      if (!strcmp(argv[1], g_codecs[i].name)) {
+        g_codec = &g_codecs[i];
+        break;
+      }
+    }
+  }
+  if (!g_codec) {
+    return fail(
+        "usage: bench-c-fragmentation CODEC < input\n"
+        "CODEC is one of bmp, deflate, gif, gzip, json, lz4, lzw, png, wbmp, "
+        "zlib or zstd");
+  }
+
+  const char* msg = read_stdin();
+  if (msg) {
+    return fail(msg);
+  }
+
+  // Decode once, unfragmented, to check the input and to find the expected
+  // output length.
+  msg = decode_once(0, 0);
+  if (msg) {
+    return fail(msg);
+  }
+  uint64_t want_num_outputs = g_num_outputs;
+
+  size_t num_wchunks =
+      (g_codec->kind == KIND_IMAGE_DECODER) ? 1 : NUM_WRITE_CHUNK_SIZES;
+
+  printf("# %s version %s\n#\n", g_cc, g_cc_version);
+  printf(
+      "# The output format, including the \"Benchmark\" prefixes, is "
+      "compatible with the\n"
+      "# https://godoc.org/golang.org/x/perf/cmd/benchstat tool. To install "
+      "it, first\n"
+      "# install Go, then run \"go get golang.org/x/perf/cmd/benchstat\".\n");
+
+  int i;
+  for (i = 0; i < 5; i++) {
+    size_t r;
+    for (r = 0; r < NUM_READ_CHUNK_SIZES; r++) {
+      size_t w;
+      for (w = 0; w < num_wchunks; w++) {
+        msg = decode(g_read_chunk_sizes[r], g_write_chunk_sizes[w],
+                     want_num_outputs);
+        if (msg) {
+          return fail(msg);
+        }
+      }
+    }
+  }
+
+  free(g_work_buffer_array);
+  return 0;
+}
@@ -0,0 +1,67 @@
+#!/bin/bash -eu
+# Copyright 2020 The Wuffs Authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# ----------------
+
+# This script measures the throughput (executions per second) of the
+# fuzz/c/std/*_fuzzer.c programs, replaying each of their seed corpora (as
+# listed in fuzz/c/std/seed_corpora.txt) in-process, REPS times per file. For
+# example:
+#
+# script/bench-c-fuzzers.sh
+# script/bench-c-fuzzers.sh gif zlib
+#
+# With no arguments, it runs every fuzzer that has a seed_corpora.txt entry.
+# Seed files that are not present (such as externally sourced "../" ones) are
+# skipped. Set CC and CFLAGS to build the fuzzers with e.g. a sanitizer.
+
+if [ ! -e wuffs-root-directory.txt ]; then
+  echo "$0 should be run from the Wuffs root directory."
+  exit 1
+fi
+
+cc=${CC:-gcc}
+cflags=${CFLAGS:--O3}
+reps=${REPS:-100}
+
+if [ $# -eq 0 ]; then
+  set -- $(sed -n -e 's/^\([a-z0-9]*\):.*/\1/p' fuzz/c/std/seed_corpora.txt)
+fi
+
+mkdir -p gen/bin
+for f in $@; do
+  src=fuzz/c/std/${f}_fuzzer.c
+  if [ ! -e $src ]; then
+    echo "$f: skipped (no $src)"
+    continue
+  fi
+
+  seeds=""
+  for g in $(sed -n -e "s/^$f:\(.*\)/\1/p" fuzz/c/std/seed_corpora.txt); do
+    for s in $g; do
+      if [ -e "$s" ]; then
+        seeds="$seeds $s"
+      fi
+    done
+  done
+  if [ -z "$seeds" ]; then
+    echo "$f: skipped (no seed files)"
+    continue
+  fi
+
+  bin=gen/bin/fuzz-$f-bench
+  $cc $cflags -DWUFFS_CONFIG__FUZZLIB_MAIN $src -o $bin
+  echo "$f: $($bin -bench -reps=$reps $seeds | grep ^BENCH)"
+done
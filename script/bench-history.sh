@@ -18,11 +18,18 @@
 # This script measures Wuffs benchmarks over recent commits. For example:
 #
 # PACKAGE=deflate FOCUS=wuffs_deflate_decode_100k script/bench-history.sh
+#
+# If HISTORY_DIR is set, each commit's raw results are also saved, in the
+# machine-readable JSON format of script/bench-json.go, as
+# $HISTORY_DIR/$PACKAGE-$HASH.json. Two such files can then be compared:
+#
+# go run script/bench-json.go compare old.json new.json
 
 num_commits=${NUM_COMMITS:-100}
 cc=${CC:-gcc}
 package=${PACKAGE:-gif}
 focus=${FOCUS:-wuffs_gif_decode_1000k_full_init}
+history_dir=${HISTORY_DIR:-}
 iterscale=${ITERSCALE:-50}
 reps=${REPS:-20}
 
@@ -30,15 +37,25 @@ reps=${REPS:-20}
 
 save=`git log -1 --pretty=format:"%H"`
 
+# Build bench-json.go once, up front, as older commits may not have it.
+if [ -n "$history_dir" ]; then
+  mkdir -p $history_dir
+  go build -o bench-history-json.out script/bench-json.go
+fi
+
 i=0
 while [ $i -lt $num_commits ]; do
   this_hash=`git log -1 --pretty=format:"%h"`
   $cc -O3 -o bench-history.out test/c/std/$package.c
-  this_metric=`./bench-history.out -bench -focus=$focus -iterscale=$iterscale -reps=$reps | benchstat /dev/stdin | sed -ne '/^name.*speed$/,$ p' | grep $focus`
+  ./bench-history.out -bench -focus=$focus -iterscale=$iterscale -reps=$reps > bench-history.txt
+  this_metric=`benchstat bench-history.txt | sed -ne '/^name.*speed$/,$ p' | grep $focus`
   echo $this_hash $this_metric
+  if [ -n "$history_dir" ]; then
+    ./bench-history-json.out convert -commit=$this_hash < bench-history.txt > $history_dir/$package-$this_hash.json
+  fi
   git checkout --quiet HEAD^
   i=$((i + 1))
 done
 
-rm -f ./bench-history.out
+rm -f ./bench-history.out ./bench-history.txt ./bench-history-json.out
 git checkout --quiet $save
@@ -0,0 +1,99 @@
+#!/bin/bash -eu
+# Copyright 2020 The Wuffs Authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# ----------------
+
+# This script measures how long it takes to minify JSON files, comparing
+# example/jsonptr's "-c" (also known as "-compact-output") flag with "jq -c".
+# For example:
+#
+# script/bench-json-compact.sh test/data/github-tags.json
+#
+# It runs each program REPS times over every command line argument (if a
+# directory then every *.json child), printing the fastest wall time.
+#
+# It also checks that both programs produce the same output. This is not
+# always true in general: jq re-formats numbers and escapes strings
+# differently. If REQUIRE_SAME_OUTPUT is 0 then mismatches are only reported.
+
+jsonptr=${JSONPTR:-gen/bin/example-jsonptr}
+jq=${JQ:-jq}
+reps=${REPS:-5}
+require_same_output=${REQUIRE_SAME_OUTPUT:-0}
+
+if [ ! "$(command -v $jsonptr)" ]; then
+  echo "Could not run $jsonptr."
+  echo "Run \"./build-example.sh example/jsonptr\" from the Wuffs root directory."
+  exit 1
+fi
+if [ ! "$(command -v $jq)" ]; then
+  echo "Could not run $jq."
+  exit 1
+fi
+
+sources=$@
+if [ $# -eq 0 ]; then
+  sources=test/data
+fi
+
+# ----
+
+# best_nanos prints the fastest of $reps wall times, each in nanoseconds, of
+# running "$@" with $f as stdin and /dev/null as stdout.
+best_nanos() {
+  local best=0
+  local i=0
+  while [ $i -lt $reps ]; do
+    local t0=$(date +%s%N)
+    "$@" < $f > /dev/null
+    local t1=$(date +%s%N)
+    local t=$((t1 - t0))
+    if [ $best -eq 0 ] || [ $t -lt $best ]; then
+      best=$t
+    fi
+    i=$((i + 1))
+  done
+  echo $best
+}
+
+bench1() {
+  local size=$(stat -c %s $f)
+  local same=same
+  if ! cmp -s <($jsonptr -c < $f) <($jq -c . < $f); then
+    same=different
+    if [ $require_same_output -ne 0 ]; then
+      echo "$f: outputs differ"
+      exit 1
+    fi
+  fi
+
+  local nj=$(best_nanos $jsonptr -c)
+  local nq=$(best_nanos $jq -c .)
+  # Bytes per nanosecond times 1000 is MB/s.
+  echo "$f ($size bytes, $same output)"
+  echo "    jsonptr -c  $((nj / 1000000)) ms  $((size * 1000 / (nj + 1))) MB/s"
+  echo "    jq -c       $((nq / 1000000)) ms  $((size * 1000 / (nq + 1))) MB/s"
+}
+
+for f in $sources; do
+  if [ -d "$f" ]; then
+    for g in $f/*.json; do
+      f=$g
+      bench1
+    done
+  else
+    bench1
+  fi
+done
@@ -0,0 +1,370 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// +build ignore
+
+package main
+
+// bench-json.go converts benchmark output to JSON and compares two such JSON
+// files, flagging statistically significant regressions. It has two modes.
+//
+// "convert" reads benchmark output (in the benchstat format printed by
+// test/c/testlib) from stdin and writes a JSON array to stdout, with one
+// element per benchmark:
+//
+// go run script/bench-json.go convert -commit=abc1234 < bench.txt > abc1234.json
+//
+// Each element records the commit, compiler, CPU, benchmark name and every
+// repetition's value for each unit (ns/op, MB/s and any -perf counters).
+//
+// "compare" reads two such JSON files (old and new) and prints, for every
+// benchmark in both, the median old and new values of one unit, the relative
+// change and a p-value from the Mann-Whitney U test (as benchstat uses):
+//
+// go run script/bench-json.go compare old.json new.json
+//
+// A benchmark regressed if it got slower by more than -threshold and the
+// p-value is below -alpha. The program exits with a non-zero status if any
+// benchmark regressed, so that it can gate e.g. a release.
+//
+// script/bench-history.sh uses "convert" when its HISTORY_DIR is set.
+
+import (
+	"bufio"
+	"encoding/json"
+	"errors"
+	"flag"
+	"fmt"
+	"io/ioutil"
+	"math"
+	"os"
+	"runtime"
+	"sort"
+	"strconv"
+	"strings"
+)
+
+var (
+	alpha     = flag.Float64("alpha", 0.05, "compare: the p-value significance level")
+	commit    = flag.String("commit", "", "convert: the commit hash to record")
+	cpu       = flag.String("cpu", "", "convert: the CPU name to record (default: from /proc/cpuinfo)")
+	threshold = flag.Float64("threshold", 0.02, "compare: the minimum relative slowdown to report")
+	unit      = flag.String("unit", "ns/op", "compare: the unit to compare, e.g. \"ns/op\" or \"cycles/byte\"")
+)
+
+var errFoundRegressions = errors.New("found regressions")
+
+func main() {
+	if err := main1(); err != nil {
+		os.Stderr.WriteString(err.Error() + "\n")
+		os.Exit(1)
+	}
+}
+
+func main1() error {
+	if len(os.Args) < 2 {
+		return errors.New("usage: bench-json (convert | compare old.json new.json) [flags]")
+	}
+	mode := os.Args[1]
+	if err := flag.CommandLine.Parse(os.Args[2:]); err != nil {
+		return err
+	}
+	switch mode {
+	case "convert":
+		return convert()
+	case "compare":
+		if flag.NArg() != 2 {
+			return errors.New("compare: need exactly two JSON files")
+		}
+		return compare(flag.Arg(0), flag.Arg(1))
+	}
+	return fmt.Errorf("unknown mode %q", mode)
+}
+
+// record is the JSON form of one benchmark's results.
+type record struct {
+	Commit string `json:"commit"`
+	CC     string `json:"cc"`
+	CPU    string `json:"cpu"`
+	Name   string `json:"name"`
+	// Values maps units (e.g. "ns/op") to each repetition's value.
+	Values map[string][]float64 `json:"values"`
+}
+
+func (r *record) key() string { return r.Name + "/" + r.CC }
+
+func convert() error {
+	cpuName := *cpu
+	if cpuName == "" {
+		cpuName = cpuNameFromProcCpuinfo()
+	}
+
+	records := []*record(nil)
+	recordsByKey := map[string]*record{}
+
+	s := bufio.NewScanner(os.Stdin)
+	for s.Scan() {
+		line := s.Text()
+		if !strings.HasPrefix(line, "Benchmark") {
+			continue
+		}
+		// A line looks like "Benchmarkwuffs_foo/gcc9 \t 1000 \t 12345 ns/op
+		// \t 12.345 MB/s", with zero or more additional "value unit" pairs.
+		fields := strings.Fields(line[len("Benchmark"):])
+		if (len(fields) < 4) || (len(fields)%2 != 0) {
+			continue
+		}
+		name, cc := fields[0], ""
+		if i := strings.LastIndexByte(name, '/'); i >= 0 {
+			name, cc = name[:i], name[i+1:]
+		}
+
+		r := recordsByKey[name+"/"+cc]
+		if r == nil {
+			r = &record{
+				Commit: *commit,
+				CC:     cc,
+				CPU:    cpuName,
+				Name:   name,
+				Values: map[string][]float64{},
+			}
+			records = append(records, r)
+			recordsByKey[r.key()] = r
+		}
+		for i := 2; i < len(fields); i += 2 {
+			v, err := strconv.ParseFloat(fields[i], 64)
+			if err != nil {
+				return fmt.Errorf("convert: could not parse %q: %v", line, err)
+			}
+			r.Values[fields[i+1]] = append(r.Values[fields[i+1]], v)
+		}
+	}
+	if err := s.Err(); err != nil {
+		return err
+	}
+
+	enc, err := json.MarshalIndent(records, "", "  ")
+	if err != nil {
+		return err
+	}
+	_, err = os.Stdout.Write(append(enc, '\n'))
+	return err
+}
+
+func cpuNameFromProcCpuinfo() string {
+	if b, err := ioutil.ReadFile("/proc/cpuinfo"); err == nil {
+		for _, line := range strings.Split(string(b), "\n") {
+			if strings.HasPrefix(line, "model name") {
+				if i := strings.IndexByte(line, ':'); i >= 0 {
+					return strings.TrimSpace(line[i+1:])
+				}
+			}
+		}
+	}
+	return runtime.GOARCH
+}
+
+func load(filename string) (map[string]*record, []string, error) {
+	b, err := ioutil.ReadFile(filename)
+	if err != nil {
+		return nil, nil, err
+	}
+	records := []*record(nil)
+	if err := json.Unmarshal(b, &records); err != nil {
+		return nil, nil, fmt.Errorf("%s: %v", filename, err)
+	}
+	m := map[string]*record{}
+	keys := []string(nil)
+	for _, r := range records {
+		if m[r.key()] == nil {
+			keys = append(keys, r.key())
+		}
+		m[r.key()] = r
+	}
+	return m, keys, nil
+}
+
+func compare(oldFilename string, newFilename string) error {
+	olds, _, err := load(oldFilename)
+	if err != nil {
+		return err
+	}
+	news, keys, err := load(newFilename)
+	if err != nil {
+		return err
+	}
+
+	// Smaller is better for most units (e.g. ns/op, cycles/byte), but larger
+	// is better for throughput.
+	largerIsBetter := *unit == "MB/s"
+
+	w := 4
+	for _, k := range keys {
+		if w < len(k) {
+			w = len(k)
+		}
+	}
+	fmt.Printf("%-*s  %12s  %12s  %8s  %7s\n", w, "name", "old "+*unit, "new "+*unit, "delta", "p")
+
+	numRegressions := 0
+	for _, k := range keys {
+		o, n := olds[k], news[k]
+		if o == nil {
+			continue
+		}
+		ov, nv := o.Values[*unit], n.Values[*unit]
+		if (len(ov) == 0) || (len(nv) == 0) {
+			continue
+		}
+		om, nm := median(ov), median(nv)
+		if om == 0 {
+			continue
+		}
+		delta := (nm - om) / om
+		p := mannWhitneyUTest(ov, nv)
+
+		slowdown := delta
+		if largerIsBetter {
+			slowdown = -delta
+		}
+		verdict := ""
+		if p >= *alpha {
+			verdict = "~"
+		} else if slowdown > *threshold {
+			verdict = "REGRESSION"
+			numRegressions++
+		}
+		line := fmt.Sprintf("%-*s  %12.6g  %12.6g  %+7.2f%%  %7.3f  %s",
+			w, k, om, nm, 100*delta, p, verdict)
+		fmt.Println(strings.TrimRight(line, " "))
+	}
+
+	if numRegressions > 0 {
+		fmt.Printf("# %d regression(s) in %s (threshold %.1f%%, alpha %g)\n",
+			numRegressions, *unit, 100**threshold, *alpha)
+		return errFoundRegressions
+	}
+	return nil
+}
+
+func median(xs []float64) float64 {
+	s := append([]float64(nil), xs...)
+	sort.Float64s(s)
+	n := len(s)
+	if n%2 == 1 {
+		return s[n/2]
+	}
+	return (s[n/2-1] + s[n/2]) / 2
+}
+
+// mannWhitneyUTest returns the two-sided p-value of the Mann-Whitney U test
+// for whether xs and ys come from the same distribution. It uses the exact
+// distribution of U for small samples without ties, and the normal
+// approximation (with a tie correction) otherwise.
+func mannWhitneyUTest(xs []float64, ys []float64) float64 {
+	n1, n2 := len(xs), len(ys)
+
+	// Rank the combined samples, averaging the ranks of ties.
+	type sample struct {
+		v     float64
+		fromX bool
+	}
+	all := make([]sample, 0, n1+n2)
+	for _, x := range xs {
+		all = append(all, sample{x, true})
+	}
+	for _, y := range ys {
+		all = append(all, sample{y, false})
+	}
+	sort.Slice(all, func(i, j int) bool { return all[i].v < all[j].v })
+
+	rankSumX, tieCorrection, haveTies := 0.0, 0.0, false
+	for i := 0; i < len(all); {
+		j := i + 1
+		for (j < len(all)) && (all[j].v == all[i].v) {
+			j++
+		}
+		rank := float64(i+j+1) / 2
+		for k := i; k < j; k++ {
+			if all[k].fromX {
+				rankSumX += rank
+			}
+		}
+		if t := float64(j - i); t > 1 {
+			haveTies = true
+			tieCorrection += t*t*t - t
+		}
+		i = j
+	}
+	u := rankSumX - float64(n1*(n1+1))/2
+	mu := float64(n1*n2) / 2
+	if u > mu {
+		u = float64(n1*n2) - u
+	}
+
+	if !haveTies && (n1*n2 <= 2500) {
+		// p = 2 * P(U <= u), by counting the arrangements of n1 xs and n2 ys
+		// with at most u (x, y) pairs where y < x.
+		return math.Min(1, 2*exactUCDF(n1, n2, int(u)))
+	}
+
+	n := float64(n1 + n2)
+	sigma := math.Sqrt(float64(n1*n2) / 12 * ((n + 1) - tieCorrection/(n*(n-1))))
+	if sigma == 0 {
+		return 1
+	}
+	z := (u - mu + 0.5) / sigma // With a continuity correction.
+	return math.Min(1, math.Erfc(-z/math.Sqrt2))
+}
+
+// exactUCDF returns P(U <= u) for sample sizes n1 and n2, under the null
+// hypothesis, without ties.
+func exactUCDF(n1 int, n2 int, u int) float64 {
+	// counts[i][j][k] is the number of arrangements of i xs and j ys with a U
+	// statistic of k. Only the current i is kept.
+	maxU := n1 * n2
+	prev := make([][]float64, n2+1)
+	for j := range prev {
+		prev[j] = make([]float64, maxU+1)
+		prev[j][0] = 1
+	}
+	for i := 1; i <= n1; i++ {
+		curr := make([][]float64, n2+1)
+		for j := range curr {
+			curr[j] = make([]float64, maxU+1)
+		}
+		curr[0][0] = 1
+		for j := 1; j <= n2; j++ {
+			for k := 0; k <= maxU; k++ {
+				// The largest element is either an x (which is greater than
+				// all j ys, adding j to U) or a y (adding nothing).
+				c := curr[j-1][k]
+				if k >= j {
+					c += prev[j][k-j]
+				}
+				curr[j][k] = c
+			}
+		}
+		prev = curr
+	}
+
+	total, below := 0.0, 0.0
+	for k, c := range prev[n2] {
+		total += c
+		if k <= u {
+			below += c
+		}
+	}
+	return below / total
+}
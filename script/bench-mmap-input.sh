@@ -0,0 +1,97 @@
+#!/bin/bash -eu
+# Copyright 2020 The Wuffs Authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# ----------------
+
+# This script measures how much faster example/zcat and example/jsonptr are
+# when their input is a regular file (which they memory-map and decode as a
+# single closed io_buffer) than when it is a pipe (which they read into a
+# small, repeatedly compacted io_buffer). For example:
+#
+# script/bench-mmap-input.sh test/data/romeo.txt.gz test/data/github-tags.json
+#
+# Each *.gz argument is decoded by zcat and each *.json argument by "jsonptr
+# -c". It runs each program REPS times per argument, printing the fastest wall
+# time. It also checks that both ways produce the same output.
+
+zcat=${ZCAT:-gen/bin/example-zcat}
+jsonptr=${JSONPTR:-gen/bin/example-jsonptr}
+reps=${REPS:-5}
+
+for p in $zcat $jsonptr; do
+  if [ ! "$(command -v $p)" ]; then
+    echo "Could not run $p."
+    echo "Run \"./build-example.sh example/zcat example/jsonptr\" from the Wuffs root directory."
+    exit 1
+  fi
+done
+
+if [ $# -eq 0 ]; then
+  echo "usage: $0 file.gz|file.json..."
+  exit 1
+fi
+
+# ----
+
+# best_nanos prints the fastest of $reps wall times, each in nanoseconds, of
+# running "$@" with /dev/null as stdout.
+best_nanos() {
+  local best=0
+  local i=0
+  while [ $i -lt $reps ]; do
+    local t0=$(date +%s%N)
+    "$@" > /dev/null
+    local t1=$(date +%s%N)
+    local t=$((t1 - t0))
+    if [ $best -eq 0 ] || [ $t -lt $best ]; then
+      best=$t
+    fi
+    i=$((i + 1))
+  done
+  echo $best
+}
+
+# from_file and from_pipe run $prog with $f as stdin, either directly or via a
+# pipe. A pipe cannot be memory-mapped.
+from_file() {
+  $prog < $f
+}
+
+from_pipe() {
+  cat $f | $prog
+}
+
+for f in $@; do
+  case $f in
+    *.gz) prog=$zcat ;;
+    *.json) prog="$jsonptr -c" ;;
+    *)
+      echo "$f: unsupported file extension"
+      exit 1
+      ;;
+  esac
+  if ! cmp -s <(from_file) <(from_pipe); then
+    echo "$f: outputs differ"
+    exit 1
+  fi
+
+  size=$(stat -c %s $f)
+  nf=$(best_nanos from_file)
+  np=$(best_nanos from_pipe)
+  # Bytes per nanosecond times 1000 is MB/s.
+  echo "$f ($size bytes)"
+  echo "    mmap  $((nf / 1000000)) ms  $((size * 1000 / (nf + 1))) MB/s"
+  echo "    pipe  $((np / 1000000)) ms  $((size * 1000 / (np + 1))) MB/s"
+done
@@ -18,14 +18,17 @@ package main
 
 // print-crc32-magic-numbers.go prints the std/crc32 magic number tables.
 //
-// Usage: go run print-crc32-magic-numbers.go
+// Usage: go run print-crc32-magic-numbers.go -polynomial=ieee
 
 import (
+	"flag"
 	"fmt"
 	"hash/crc32"
 	"os"
 )
 
+var polynomial = flag.String("polynomial", "ieee", "\"castagnoli\" or \"ieee\"")
+
 func main() {
 	if err := main1(); err != nil {
 		os.Stderr.WriteString(err.Error() + "\n")
@@ -34,8 +37,17 @@ func main() {
 }
 
 func main1() error {
+	flag.Parse()
+
 	tables := [16]crc32.Table{}
-	tables[0] = *crc32.MakeTable(crc32.IEEE)
+	switch *polynomial {
+	case "castagnoli":
+		tables[0] = *crc32.MakeTable(crc32.Castagnoli)
+	case "ieee":
+		tables[0] = *crc32.MakeTable(crc32.IEEE)
+	default:
+		return fmt.Errorf("unknown polynomial %q", *polynomial)
+	}
 
 	// See "Multi-Byte Lookup Tables" in std/crc32/README.md for more detail on
 	// the slicing-by-M algorithm. We use an M of 16.
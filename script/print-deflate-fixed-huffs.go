@@ -0,0 +1,155 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// +build ignore
+
+package main
+
+// print-deflate-fixed-huffs.go prints the std/deflate fixed_lcode_huffs and
+// fixed_dcode_huffs values: the decoder.huffs tables for the fixed Huffman
+// codes of RFC 1951 section 3.2.6.
+//
+// The lcode table has a 9 bit key (the maximum fixed lcode length) and the
+// dcode table has a 5 bit key, so neither table has redirects. Nor does the
+// lcode table have any literal pairs, as every fixed literal code is at least
+// 8 bits long.
+//
+// Usage: go run print-deflate-fixed-huffs.go
+
+import (
+	"fmt"
+	"os"
+)
+
+func main() {
+	if err := main1(); err != nil {
+		os.Stderr.WriteString(err.Error() + "\n")
+		os.Exit(1)
+	}
+}
+
+func main1() error {
+	lLengths := make([]uint32, 288)
+	for i := range lLengths {
+		switch {
+		case i < 144:
+			lLengths[i] = 8
+		case i < 256:
+			lLengths[i] = 9
+		case i < 280:
+			lLengths[i] = 7
+		default:
+			lLengths[i] = 8
+		}
+	}
+	dLengths := make([]uint32, 32)
+	for i := range dLengths {
+		dLengths[i] = 5
+	}
+
+	lTable, err := makeTable(lLengths, 9, func(symbol uint32) uint32 {
+		if symbol < 256 {
+			return 0x80000000 | (symbol << 8)
+		} else if symbol == 256 {
+			return 0x20000000
+		}
+		return lcodeMagicNumbers[(symbol-257)&31]
+	})
+	if err != nil {
+		return err
+	}
+	dTable, err := makeTable(dLengths, 5, func(symbol uint32) uint32 {
+		return dcodeMagicNumbers[symbol&31]
+	})
+	if err != nil {
+		return err
+	}
+
+	printTable(lTable)
+	fmt.Println()
+	printTable(dTable)
+	return nil
+}
+
+// makeTable returns the primary table, indexed by nBits bits in LSB first
+// order, for the canonical Huffman code with the given code lengths.
+func makeTable(lengths []uint32, nBits uint32, value func(symbol uint32) uint32) ([]uint32, error) {
+	// Assign codes as per RFC 1951 section 3.2.2.
+	counts := [16]uint32{}
+	for _, cl := range lengths {
+		counts[cl]++
+	}
+	nextCode := [16]uint32{}
+	code := uint32(0)
+	for cl := 1; cl < 16; cl++ {
+		code = (code + counts[cl-1]) << 1
+		nextCode[cl] = code
+	}
+	counts[0] = 0
+
+	table := make([]uint32, 1<<nBits)
+	for symbol, cl := range lengths {
+		code := nextCode[cl]
+		nextCode[cl]++
+		rev := reverse(code, cl)
+		for high := uint32(0); high < (1 << nBits); high += 1 << cl {
+			if table[high|rev] != 0 {
+				return nil, fmt.Errorf("duplicate key 0x%03X", high|rev)
+			}
+			table[high|rev] = value(uint32(symbol)) | cl
+		}
+	}
+	for k, v := range table {
+		if v == 0 {
+			return nil, fmt.Errorf("missing key 0x%03X", k)
+		}
+	}
+	return table, nil
+}
+
+func reverse(x uint32, n uint32) (y uint32) {
+	for i := uint32(0); i < n; i++ {
+		y = (y << 1) | ((x >> i) & 1)
+	}
+	return y
+}
+
+func printTable(table []uint32) {
+	for i, v := range table {
+		fmt.Printf("0x%04X_%04X,", v>>16, v&0xFFFF)
+		if i&7 == 7 {
+			fmt.Println()
+		} else {
+			fmt.Print(" ")
+		}
+	}
+}
+
+var (
+	// These are the std/deflate lcode_magic_numbers and dcode_magic_numbers
+	// values, printed by print-deflate-magic-numbers.go.
+	lcodeMagicNumbers = [32]uint32{
+		0x40000000, 0x40000100, 0x40000200, 0x40000300, 0x40000400, 0x40000500, 0x40000600, 0x40000700,
+		0x40000810, 0x40000A10, 0x40000C10, 0x40000E10, 0x40001020, 0x40001420, 0x40001820, 0x40001C20,
+		0x40002030, 0x40002830, 0x40003030, 0x40003830, 0x40004040, 0x40005040, 0x40006040, 0x40007040,
+		0x40008050, 0x4000A050, 0x4000C050, 0x4000E050, 0x4000FF00, 0x08000000, 0x08000000, 0x08000000,
+	}
+
+	dcodeMagicNumbers = [32]uint32{
+		0x40000000, 0x40000100, 0x40000200, 0x40000300, 0x40000410, 0x40000610, 0x40000820, 0x40000C20,
+		0x40001030, 0x40001830, 0x40002040, 0x40003040, 0x40004050, 0x40006050, 0x40008060, 0x4000C060,
+		0x40010070, 0x40018070, 0x40020080, 0x40030080, 0x40040090, 0x40060090, 0x400800A0, 0x400C00A0,
+		0x401000B0, 0x401800B0, 0x402000C0, 0x403000C0, 0x404000D0, 0x406000D0, 0x08000000, 0x08000000,
+	}
+)
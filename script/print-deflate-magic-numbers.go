@@ -18,6 +18,8 @@ package main
 
 // print-deflate-magic-numbers.go prints the std/deflate lcode_magic_numbers
 // and dcode_magic_numbers values based on the tables in RFC 1951 secion 3.2.5.
+// It also prints the encoder's length_codes and distance_codes values, which
+// map a (biased) length or distance back to its lcode or dcode.
 //
 // The lcode base numbers are biased by -3 so that (base_number_minus_3 +
 // extra_bits) fits in the range [0, 255]. This makes a bitwise-and with 0xFF a
@@ -64,9 +66,41 @@ func main1() error {
 			}
 		}
 	}
+
+	// The encoder's length_codes are indexed by (length - 3), in the range
+	// [0, 255]. Its distance_codes are indexed by (distance - 1) for the first
+	// 256 elements and by (256 + ((distance - 1) >> 7)) for the next 256.
+	fmt.Println()
+	for v := uint32(0); v < 256; v++ {
+		fmt.Printf("%d,", findCode(0, v+biases[0]))
+		if v&31 == 31 {
+			fmt.Println()
+		}
+	}
+	fmt.Println()
+	for k := uint32(0); k < 512; k++ {
+		v := k
+		if k >= 256 {
+			v = (k - 256) << 7
+		}
+		fmt.Printf("%d,", findCode(1, v+biases[1]))
+		if k&31 == 31 {
+			fmt.Println()
+		}
+	}
 	return nil
 }
 
+// findCode returns the largest j such that baseNumbers[i][j] <= x.
+func findCode(i int, x uint32) (j uint32) {
+	for k, bn := range baseNumbers[i] {
+		if (bn != bad) && (bn <= x) {
+			j = uint32(k)
+		}
+	}
+	return j
+}
+
 const bad = 0xFFFFFFFF
 
 var (
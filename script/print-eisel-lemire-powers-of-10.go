@@ -0,0 +1,105 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// +build ignore
+
+package main
+
+// print-eisel-lemire-powers-of-10.go prints the
+// wuffs_base__private_implementation__powers_of_10 table.
+//
+// Each entry is a 128-bit mantissa, truncated (rounded down) and normalized so
+// that its high bit is set. The base-2 exponent is not stored, as it can be
+// calculated from the base-10 exponent. This program checks that calculation.
+//
+// The table is used for both parsing (Eisel-Lemire) and rendering (Schubfach)
+// f64 values, which need slightly different ranges of exponents.
+//
+// Usage: go run print-eisel-lemire-powers-of-10.go
+
+import (
+	"fmt"
+	"math/big"
+	"os"
+)
+
+func main() {
+	if err := main1(); err != nil {
+		os.Stderr.WriteString(err.Error() + "\n")
+		os.Exit(1)
+	}
+}
+
+const (
+	minExp10 = -307
+	maxExp10 = +324
+)
+
+func main1() error {
+	fmt.Printf("static const uint64_t "+
+		"wuffs_base__private_implementation__powers_of_10[%d][2] = {\n",
+		1+maxExp10-minExp10)
+	for e := minExp10; e <= maxExp10; e++ {
+		if err := do(e); err != nil {
+			return err
+		}
+	}
+	fmt.Printf("};\n")
+	return nil
+}
+
+var (
+	one    = big.NewInt(1)
+	ten    = big.NewInt(10)
+	two127 = big.NewInt(0).Lsh(one, 127)
+	two128 = big.NewInt(0).Lsh(one, 128)
+	mask64 = big.NewInt(0).Sub(big.NewInt(0).Lsh(one, 64), one)
+)
+
+// N is large enough so that (1<<N) is much bigger than 1e307.
+const N = 2048
+
+func do(e int) error {
+	// z approximates (10 ** e) * (1 << n).
+	z := big.NewInt(0)
+	n := 0
+	if e >= 0 {
+		z.Exp(ten, big.NewInt(int64(+e)), nil)
+	} else {
+		z.Exp(ten, big.NewInt(int64(-e)), nil)
+		z.Div(big.NewInt(0).Lsh(one, N), z)
+		n = N
+	}
+
+	// Normalize to 128 bits, truncating any lower bits.
+	for z.Cmp(two128) >= 0 {
+		z.Rsh(z, 1)
+		n--
+	}
+	for z.Cmp(two127) < 0 {
+		z.Lsh(z, 1)
+		n++
+	}
+
+	// Check that the base-2 exponent of (10 ** e), ignoring the mantissa, is
+	// what the C code's linear approximation calculates.
+	if have, want := (217706*e)>>16, 127-n; have != want {
+		return fmt.Errorf("1e%d: exponent mismatch: have %d, want %d", e, have, want)
+	}
+
+	lo := big.NewInt(0).And(z, mask64)
+	hi := big.NewInt(0).Rsh(z, 64)
+	fmt.Printf("    {0x%016X, 0x%016X},  // 1e%d\n", lo, hi, e)
+	return nil
+}
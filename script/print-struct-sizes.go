@@ -0,0 +1,221 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// +build ignore
+
+package main
+
+// print-struct-sizes.go prints the memory footprint of every public struct in
+// the Wuffs standard library (e.g. wuffs_deflate__decoder), broken down by
+// field, largest first. Usage, from the repository root directory:
+//
+// go run script/print-struct-sizes.go
+// go run script/print-struct-sizes.go deflate gif
+//
+// It parses the std/*/*.wuffs files to find each struct's fields, generates a
+// C program that prints the sizeof each field's C counterpart, then compiles
+// (with -cc) and runs that C program. The -c flag prints the C program instead.
+//
+// The "(other)" row is everything that isn't a field: coroutine state (the
+// p_etc and s_etc fields in the generated C code), vtables and padding.
+//
+// Bulk arrays that don't need to outlive a single transform_io or
+// decode_frame call can live in the caller-supplied workbuf instead (see
+// std/lzw's suffixes), so that idle decoders are smaller.
+
+import (
+	"bytes"
+	"flag"
+	"fmt"
+	"io/ioutil"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"sort"
+	"strings"
+
+	"github.com/google/wuffs/lang/parse"
+
+	a "github.com/google/wuffs/lang/ast"
+	t "github.com/google/wuffs/lang/token"
+)
+
+var (
+	cFlag  = flag.Bool("c", false, "print the generated C program instead of running it")
+	ccFlag = flag.String("cc", "cc", "the C compiler")
+)
+
+func main() {
+	if err := main1(); err != nil {
+		os.Stderr.WriteString(err.Error() + "\n")
+		os.Exit(1)
+	}
+}
+
+func main1() error {
+	flag.Parse()
+	pkgs := flag.Args()
+	if len(pkgs) == 0 {
+		dirs, err := ioutil.ReadDir("std")
+		if err != nil {
+			return err
+		}
+		for _, d := range dirs {
+			if d.IsDir() {
+				pkgs = append(pkgs, d.Name())
+			}
+		}
+	}
+	sort.Strings(pkgs)
+
+	src := &bytes.Buffer{}
+	src.WriteString(cPrologue)
+	for _, pkg := range pkgs {
+		if err := genPackage(src, pkg); err != nil {
+			return err
+		}
+	}
+	src.WriteString(cEpilogue)
+
+	if *cFlag {
+		_, err := os.Stdout.Write(src.Bytes())
+		return err
+	}
+
+	tmpDir, err := ioutil.TempDir("", "wuffs-print-struct-sizes")
+	if err != nil {
+		return err
+	}
+	defer os.RemoveAll(tmpDir)
+	cFilename := filepath.Join(tmpDir, "a.c")
+	exeFilename := filepath.Join(tmpDir, "a.out")
+	if err := ioutil.WriteFile(cFilename, src.Bytes(), 0644); err != nil {
+		return err
+	}
+
+	wd, err := os.Getwd()
+	if err != nil {
+		return err
+	}
+	cc := exec.Command(*ccFlag, "-I"+wd, cFilename, "-o", exeFilename)
+	cc.Stdout = os.Stdout
+	cc.Stderr = os.Stderr
+	if err := cc.Run(); err != nil {
+		return fmt.Errorf("%s: %v", *ccFlag, err)
+	}
+	run := exec.Command(exeFilename)
+	run.Stdout = os.Stdout
+	run.Stderr = os.Stderr
+	return run.Run()
+}
+
+func genPackage(src *bytes.Buffer, pkg string) error {
+	filenames, err := filepath.Glob(filepath.Join("std", pkg, "*.wuffs"))
+	if err != nil {
+		return err
+	} else if len(filenames) == 0 {
+		return fmt.Errorf("no std/%s/*.wuffs files", pkg)
+	}
+	sort.Strings(filenames)
+
+	tm := &t.Map{}
+	for _, filename := range filenames {
+		b, err := ioutil.ReadFile(filename)
+		if err != nil {
+			return err
+		}
+		tokens, _, err := t.Tokenize(tm, filename, b)
+		if err != nil {
+			return err
+		}
+		f, err := parse.Parse(tm, filename, tokens, nil)
+		if err != nil {
+			return err
+		}
+
+		for _, n := range f.TopLevelDecls() {
+			if n.Kind() != a.KStruct {
+				continue
+			}
+			s := n.AsStruct()
+			if !s.Public() || !s.Classy() {
+				continue
+			}
+			cName := "wuffs_" + pkg + "__" + s.QID()[1].Str(tm)
+			fmt.Fprintf(src, "  {\n    static const field fields[] = {\n")
+			for _, o := range s.Fields() {
+				o := o.AsField()
+				if o.XType().Str(tm) == "base.utility" {
+					continue
+				}
+				part := "private_impl"
+				if o.PrivateData() {
+					part = "private_data"
+				}
+				member := part + ".f_" + o.Name().Str(tm)
+				fmt.Fprintf(src, "        {%q, sizeof(((%s*)NULL)->%s)},\n", member, cName, member)
+			}
+			fmt.Fprintf(src, "    };\n")
+			fmt.Fprintf(src, "    print_struct(%q, sizeof(%s), fields,\n"+
+				"                 sizeof(fields) / sizeof(fields[0]));\n  }\n", cName, cName)
+		}
+	}
+	return nil
+}
+
+var cPrologue = strings.TrimSpace(`
+// Code generated by script/print-struct-sizes.go. DO NOT EDIT.
+
+#define WUFFS_IMPLEMENTATION
+#include "release/c/wuffs-unsupported-snapshot.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+  const char* name;
+  size_t size;
+} field;
+
+int  //
+compare_fields(const void* x, const void* y) {
+  size_t xs = ((const field*)x)->size;
+  size_t ys = ((const field*)y)->size;
+  return (xs < ys) ? +1 : (xs > ys) ? -1 : 0;
+}
+
+void  //
+print_struct(const char* name, size_t size, const field* fields, size_t n) {
+  field sorted[256];
+  if (n > 256) {
+    n = 256;
+  }
+  memcpy(sorted, fields, n * sizeof(field));
+  qsort(sorted, n, sizeof(field), compare_fields);
+
+  printf("%-52s %8zu\n", name, size);
+  size_t other = size;
+  size_t i;
+  for (i = 0; i < n; i++) {
+    printf("    %-48s %8zu\n", sorted[i].name, sorted[i].size);
+    other -= sorted[i].size;
+  }
+  printf("    %-48s %8zu\n\n", "(other)", other);
+}
+
+int  //
+main(int argc, char** argv) {
+`) + "\n"
+
+const cEpilogue = "  return 0;\n}\n"
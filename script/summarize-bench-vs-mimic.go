@@ -0,0 +1,191 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// +build ignore
+
+package main
+
+// summarize-bench-vs-mimic.go reads benchmark output (in the benchstat format
+// printed by test/c/testlib) from stdin and prints a single summary table,
+// comparing each wuffs_etc benchmark with its mimic_etc counterpart. Usage:
+//
+// wuffs bench -mimic -reps=5 | go run script/summarize-bench-vs-mimic.go
+//
+// Each benchmark's speed is the median over its repetitions. The vs_mimic
+// column is relative to the mimic library (e.g. zlib, libdeflate or giflib,
+// depending on how the test/c/std programs were built), so that "2.00x" means
+// twice as fast. Benchmarks without a mimic counterpart are listed without a
+// vs_mimic value.
+
+import (
+	"bufio"
+	"fmt"
+	"os"
+	"sort"
+	"strconv"
+	"strings"
+)
+
+func main() {
+	if err := main1(); err != nil {
+		os.Stderr.WriteString(err.Error() + "\n")
+		os.Exit(1)
+	}
+}
+
+type result struct {
+	// bytesPerSec is true if values are in MB/s (higher is better), false if
+	// they are in ns/op (lower is better).
+	bytesPerSec bool
+	values      []float64
+}
+
+func (r *result) median() float64 {
+	sort.Float64s(r.values)
+	n := len(r.values)
+	if n%2 == 1 {
+		return r.values[n/2]
+	}
+	return (r.values[n/2-1] + r.values[n/2]) / 2
+}
+
+func main1() error {
+	names := []string(nil)
+	results := map[string]*result{}
+
+	s := bufio.NewScanner(os.Stdin)
+	for s.Scan() {
+		name, bytesPerSec, value, ok := parseLine(s.Text())
+		if !ok {
+			continue
+		}
+		r := results[name]
+		if r == nil {
+			r = &result{bytesPerSec: bytesPerSec}
+			results[name] = r
+			names = append(names, name)
+		}
+		r.values = append(r.values, value)
+	}
+	if err := s.Err(); err != nil {
+		return err
+	}
+
+	w := 4
+	for _, name := range names {
+		if w < len(name) {
+			w = len(name)
+		}
+	}
+
+	fmt.Printf("%-*s  %10s  %s\n", w, "name", "speed", "vs_mimic")
+	prefix := ""
+	for _, name := range names {
+		// Separate groups of benchmarks with a blank line.
+		if p := groupPrefix(name); p != prefix {
+			fmt.Println()
+			prefix = p
+		}
+
+		r := results[name]
+		m := r.median()
+		ratio := ""
+		if other := mimicName(name, results); other != "" {
+			if o := results[other]; o.bytesPerSec == r.bytesPerSec {
+				om := o.median()
+				if r.bytesPerSec && (om > 0) {
+					ratio = fmt.Sprintf("%.2fx", m/om)
+				} else if !r.bytesPerSec && (m > 0) {
+					ratio = fmt.Sprintf("%.2fx", om/m)
+				}
+			}
+		}
+		line := fmt.Sprintf("%-*s  %10s  %s", w, name, formatValue(m, r.bytesPerSec), ratio)
+		fmt.Println(strings.TrimRight(line, " "))
+	}
+	return nil
+}
+
+// parseLine parses a line like
+// "Benchmarkwuffs_foo_bar/gcc9 \t 1000 \t 12345 ns/op \t 12.345 MB/s", returning
+// the "wuffs_foo_bar/gcc9" name and its MB/s value (or, if there is no MB/s
+// value, its ns/op value).
+func parseLine(line string) (name string, bytesPerSec bool, value float64, ok bool) {
+	if !strings.HasPrefix(line, "Benchmark") {
+		return "", false, 0, false
+	}
+	fields := strings.Fields(line[len("Benchmark"):])
+	if len(fields) < 4 {
+		return "", false, 0, false
+	}
+	name = fields[0]
+	for i := 2; i+1 < len(fields); i += 2 {
+		v, err := strconv.ParseFloat(fields[i], 64)
+		if err != nil {
+			return "", false, 0, false
+		}
+		switch fields[i+1] {
+		case "MB/s":
+			return name, true, v, true
+		case "ns/op":
+			bytesPerSec, value, ok = false, v, true
+		}
+	}
+	return name, bytesPerSec, value, ok
+}
+
+// groupPrefix returns the package part of the name, e.g. "gif_" for both
+// "wuffs_gif_etc" and "mimic_gif_etc", so that they are in the same group.
+func groupPrefix(name string) string {
+	if i := strings.IndexByte(name, '_'); i >= 0 {
+		name = name[i+1:]
+		if j := strings.IndexByte(name, '_'); j >= 0 {
+			return name[:j+1]
+		}
+	}
+	return name
+}
+
+// mimicName returns the mimic counterpart of a "wuffs_etc/cc" benchmark name.
+// Wuffs benchmarks can have extra suffixes, so that the counterpart of
+// "wuffs_deflate_decode_10k_full_init/gcc9" is "mimic_deflate_decode_10k/gcc9".
+// It returns "" if there is no counterpart.
+func mimicName(name string, results map[string]*result) string {
+	if !strings.HasPrefix(name, "wuffs_") && !strings.HasPrefix(name, "mimic_") {
+		return ""
+	}
+	base, cc := name[len("wuffs_"):], ""
+	if i := strings.LastIndexByte(base, '/'); i >= 0 {
+		base, cc = base[:i], base[i:]
+	}
+	for {
+		if other := "mimic_" + base + cc; results[other] != nil {
+			return other
+		}
+		i := strings.LastIndexByte(base, '_')
+		if i < 0 {
+			return ""
+		}
+		base = base[:i]
+	}
+}
+
+func formatValue(v float64, bytesPerSec bool) string {
+	if !bytesPerSec {
+		return fmt.Sprintf("%.0fns/op", v)
+	} else if v >= 1000 {
+		return fmt.Sprintf("%.2fGB/s", v/1000)
+	}
+	return fmt.Sprintf("%.0fMB/s", v)
+}
@@ -0,0 +1,173 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+This test program covers the WUFFS_CONFIG__QUIRKS__ENABLE_ALLOWLIST and
+WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST build configurations, which
+the test/c/std programs do not define. See doc/note/quirks.md.
+
+To manually run this test:
+
+for CC in clang gcc; do
+  $CC -std=c99 -Wall -Werror allowlist.c && ./a.out
+  rm -f a.out
+done
+
+Each edition should print "PASS", amongst other information, and exit(0).
+*/
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c whitelist which parts of Wuffs to build. That file contains
+// the entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__JSON
+
+// Allow only one JSON quirk and only one destination pixel format. Every other
+// quirk and destination pixel format is compiled out.
+#define WUFFS_CONFIG__QUIRKS__ENABLE_ALLOWLIST
+#define WUFFS_CONFIG__QUIRKS__ALLOW__JSON__ALLOW_COMMENT_BLOCK
+#define WUFFS_CONFIG__DST_PIXEL_FORMAT__ENABLE_ALLOWLIST
+#define WUFFS_CONFIG__DST_PIXEL_FORMAT__ALLOW_BGRA_PREMUL
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../../release/c/wuffs-unsupported-snapshot.c"
+#include "../testlib/testlib.c"
+
+// ---------------- Allowlist Tests
+
+const char*  //
+test_wuffs_allowlist_dst_pixel_formats() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    uint32_t dst_pixfmt_repr;
+    bool want_ok;
+  } test_cases[] = {
+      {.dst_pixfmt_repr = WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+       .want_ok = true},
+      {.dst_pixfmt_repr = WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+       .want_ok = false},
+      {.dst_pixfmt_repr = WUFFS_BASE__PIXEL_FORMAT__BGR_565, .want_ok = false},
+      {.dst_pixfmt_repr = WUFFS_BASE__PIXEL_FORMAT__RGB, .want_ok = false},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_base__pixel_swizzler swizzler;
+    const char* have =
+        wuffs_base__pixel_swizzler__prepare(
+            &swizzler,
+            wuffs_base__make_pixel_format(test_cases[tc].dst_pixfmt_repr),
+            wuffs_base__empty_slice_u8(),
+            wuffs_base__make_pixel_format(
+                WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+            wuffs_base__empty_slice_u8(), WUFFS_BASE__PIXEL_BLEND__SRC)
+            .repr;
+    const char* want =
+        test_cases[tc].want_ok
+            ? NULL
+            : wuffs_base__error__disabled_by_wuffs_config_dst_pixel_format_enable_allowlist;
+    if (have != want) {
+      RETURN_FAIL("tc=%d: prepare: have \"%s\", want \"%s\"", tc, have, want);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_allowlist_quirks() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    // want has 4 bytes, one for each possible q:
+    //  - q&1 sets WUFFS_JSON__QUIRK_ALLOW_COMMENT_BLOCK.
+    //  - q&2 sets WUFFS_JSON__QUIRK_ALLOW_COMMENT_LINE.
+    // An 'X' or '-' means that decoding should succeed or fail. Only the
+    // first quirk is in the allowlist, so the second one has no effect.
+    const char* want;
+    const char* str;
+  } test_cases[] = {
+      {.want = "-X-X", .str = "[ /*com*/ 0]"},
+      {.want = "----", .str = "//l\n  //m\n0"},
+      {.want = "----", .str = "[ 0, /*com*/ 1 //l\n\n]"},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    int q;
+    for (q = 0; q < 4; q++) {
+      wuffs_json__decoder dec;
+      CHECK_STATUS("initialize", wuffs_json__decoder__initialize(
+                                     &dec, sizeof dec, WUFFS_VERSION,
+                                     WUFFS_INITIALIZE__DEFAULT_OPTIONS));
+      wuffs_json__decoder__set_quirk_enabled(
+          &dec, WUFFS_JSON__QUIRK_ALLOW_COMMENT_BLOCK, q & 1);
+      wuffs_json__decoder__set_quirk_enabled(
+          &dec, WUFFS_JSON__QUIRK_ALLOW_COMMENT_LINE, q & 2);
+
+      wuffs_base__token_buffer tok =
+          wuffs_base__slice_token__writer(g_have_slice_token);
+      wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+          (void*)test_cases[tc].str, strlen(test_cases[tc].str), true);
+      const char* have =
+          wuffs_json__decoder__decode_tokens(&dec, &tok, &src, g_work_slice_u8)
+              .repr;
+      const char* want =
+          (test_cases[tc].want[q] != '-') ? NULL : wuffs_json__error__bad_input;
+      if (have != want) {
+        RETURN_FAIL("tc=%d, q=%d: decode_tokens: have \"%s\", want \"%s\"", tc,
+                    q, have, want);
+      }
+    }
+  }
+  return NULL;
+}
+
+// ---------------- Manifest
+
+proc g_tests[] = {
+
+    test_wuffs_allowlist_dst_pixel_formats,
+    test_wuffs_allowlist_quirks,
+
+    NULL,
+};
+
+proc g_benches[] = {
+
+    NULL,
+};
+
+int  //
+main(int argc, char** argv) {
+  g_proc_package_name = "allowlist";
+  return test_main(argc, argv, g_tests, g_benches);
+}
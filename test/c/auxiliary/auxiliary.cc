@@ -0,0 +1,348 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+This test program covers the base package's auxiliary C++ API (the wuffs_aux
+namespace): its decoder_pool and its transform_io and decode_tokens drivers.
+Unlike the test/c/std programs, it is C++, not C.
+
+To manually run this test:
+
+for CXX in clang++ g++; do
+  $CXX -std=c++11 -Wall -Werror auxiliary.cc && ./a.out
+  rm -f a.out
+done
+
+Each edition should print "PASS", amongst other information, and exit(0).
+*/
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c whitelist which parts of Wuffs to build. That file contains
+// the entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__DEFLATE
+#define WUFFS_CONFIG__MODULE__JSON
+#define WUFFS_CONFIG__MODULE__ZLIB
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../../release/c/wuffs-unsupported-snapshot.c"
+#include "../testlib/testlib.c"
+
+typedef wuffs_aux::decoder_pool<wuffs_zlib__decoder,
+                                sizeof__wuffs_zlib__decoder>
+    zlib_pool;
+
+typedef wuffs_aux::decoder_pool<wuffs_json__decoder,
+                                sizeof__wuffs_json__decoder>
+    json_pool;
+
+// ---------------- Decoder Pool Tests
+
+const char*  //
+test_wuffs_aux_decoder_pool() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_zlib__decoder* ptr0 = nullptr;
+  {
+    zlib_pool::handle h0 = zlib_pool::acquire();
+    if (!h0) {
+      RETURN_FAIL("acquire #0: empty handle");
+    }
+    ptr0 = h0.get();
+
+    // Two live handles hold different objects.
+    zlib_pool::handle h1 = zlib_pool::acquire();
+    if (!h1) {
+      RETURN_FAIL("acquire #1: empty handle");
+    } else if (h1.get() == ptr0) {
+      RETURN_FAIL("acquire #1: same object as acquire #0");
+    }
+
+    // Moving a handle moves ownership.
+    zlib_pool::handle h2(std::move(h1));
+    if (h1 || !h2) {
+      RETURN_FAIL("move: have (%d, %d), want (0, 1)", (int)(bool)(h1),
+                  (int)(bool)(h2));
+    }
+  }
+
+  // Releasing a handle (here, by its destructor) puts its object on this
+  // thread's free list, so that the next acquire re-uses it.
+  zlib_pool::handle h3 = zlib_pool::acquire();
+  if (!h3) {
+    RETURN_FAIL("acquire #3: empty handle");
+  }
+  wuffs_zlib__decoder* ptr3 = h3.get();
+  h3.reset();
+  if (h3) {
+    RETURN_FAIL("reset: handle was not emptied");
+  }
+  zlib_pool::handle h4 = zlib_pool::acquire();
+  if (h4.get() != ptr3) {
+    RETURN_FAIL("acquire #4: object was not re-used");
+  }
+  return NULL;
+}
+
+// ---------------- Transform IO Tests
+
+const char*  //
+do_test_wuffs_aux_transform_io(size_t dst_len,
+                               size_t src_len,
+                               size_t rlimit) {
+  wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  wuffs_base__io_buffer want = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+  wuffs_base__io_buffer file = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&file, "test/data/midsummer.txt.zlib"));
+  CHECK_STRING(read_file(&want, "test/data/midsummer.txt"));
+
+  zlib_pool::handle dec = zlib_pool::acquire();
+  if (!dec) {
+    RETURN_FAIL("acquire: empty handle");
+  }
+
+  // The dst buffer is the start of g_work_slice_u8. The zlib decoder's work
+  // buffer is empty, so the two do not overlap.
+  wuffs_base__io_buffer dst =
+      wuffs_base__ptr_u8__writer(g_work_slice_u8.ptr, dst_len);
+  auto write = [&have](wuffs_base__slice_u8 s) -> wuffs_base__status {
+    if (s.len > (have.data.len - have.meta.wi)) {
+      return wuffs_base__make_status("#test: have buffer is full");
+    }
+    memcpy(have.data.ptr + have.meta.wi, s.ptr, s.len);
+    have.meta.wi += s.len;
+    return wuffs_base__make_status(nullptr);
+  };
+
+  wuffs_base__status status;
+  if (src_len == 0) {
+    status = wuffs_aux::transform_io(
+        dec.get(), &dst,
+        wuffs_aux::input_span(file.data.ptr, file.meta.wi),
+        wuffs_base__empty_slice_u8(), write);
+  } else {
+    // The src buffer is the end of g_work_slice_u8. It is refilled, rlimit
+    // bytes at a time, from the file contents.
+    wuffs_base__io_buffer src = wuffs_base__ptr_u8__writer(
+        g_work_slice_u8.ptr + g_work_slice_u8.len - src_len, src_len);
+    status = wuffs_aux::transform_io(
+        dec.get(), &dst, &src, wuffs_base__empty_slice_u8(),
+        [&file, rlimit](wuffs_base__io_buffer* src) -> wuffs_base__status {
+          size_t n = file.meta.wi - file.meta.ri;
+          if (n > rlimit) {
+            n = rlimit;
+          }
+          if (n > (src->data.len - src->meta.wi)) {
+            n = src->data.len - src->meta.wi;
+          }
+          memcpy(src->data.ptr + src->meta.wi, file.data.ptr + file.meta.ri,
+                 n);
+          src->meta.wi += n;
+          file.meta.ri += n;
+          src->meta.closed = file.meta.ri == file.meta.wi;
+          return wuffs_base__make_status(nullptr);
+        },
+        write);
+  }
+
+  if (dst_len == 0) {
+    if (status.repr != wuffs_base__error__bad_argument_length_too_short) {
+      RETURN_FAIL("transform_io: have \"%s\", want \"%s\"", status.repr,
+                  wuffs_base__error__bad_argument_length_too_short);
+    }
+    return NULL;
+  }
+  CHECK_STATUS("transform_io", status);
+  return check_io_buffers_equal("", &have, &want);
+}
+
+const char*  //
+test_wuffs_aux_transform_io_input_span() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_aux_transform_io(4096, 0, 0);
+}
+
+const char*  //
+test_wuffs_aux_transform_io_small_reads() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_aux_transform_io(4096, 100, 7);
+}
+
+const char*  //
+test_wuffs_aux_transform_io_small_writes() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_aux_transform_io(10, 100, 100);
+}
+
+const char*  //
+test_wuffs_aux_transform_io_zero_length_dst() {
+  CHECK_FOCUS(__func__);
+  CHECK_STRING(do_test_wuffs_aux_transform_io(0, 0, 0));
+  return do_test_wuffs_aux_transform_io(0, 100, 100);
+}
+
+// ---------------- Decode Tokens Tests
+
+const char*  //
+do_test_wuffs_aux_decode_tokens(size_t tok_len, size_t src_len) {
+  wuffs_base__io_buffer file = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&file, "test/data/github-tags.json"));
+
+  json_pool::handle dec = json_pool::acquire();
+  if (!dec) {
+    RETURN_FAIL("acquire: empty handle");
+  }
+
+  // Every byte of valid JSON is covered by exactly one token, so the sum of
+  // the token lengths is the file length, less the trailing newline (the
+  // decoder stops after the top-level value). The src bytes that those tokens
+  // cover immediately precede src->meta.ri.
+  uint64_t want_total_length = file.meta.wi;
+  if ((want_total_length > 0) &&
+      (file.data.ptr[want_total_length - 1] == '\n')) {
+    want_total_length--;
+  }
+  uint64_t total_length = 0;
+  uint64_t num_tokens = 0;
+  bool bad_position = false;
+  auto handle_tokens = [&](wuffs_base__token_buffer* tok,
+                           wuffs_base__io_buffer* src) -> wuffs_base__status {
+    uint64_t n = 0;
+    for (size_t i = tok->meta.ri; i < tok->meta.wi; i++) {
+      n += wuffs_base__token__length(&tok->data.ptr[i]);
+    }
+    bad_position = bad_position || (n > src->meta.ri);
+    total_length += n;
+    num_tokens += tok->meta.wi - tok->meta.ri;
+    return wuffs_base__make_status(nullptr);
+  };
+
+  wuffs_base__token_buffer tok = wuffs_base__slice_token__writer(
+      wuffs_base__make_slice_token(g_have_slice_token.ptr, tok_len));
+  wuffs_base__status status;
+  if (src_len == 0) {
+    status = wuffs_aux::decode_tokens(
+        dec.get(), &tok, wuffs_aux::input_span(file.data.ptr, file.meta.wi),
+        wuffs_base__empty_slice_u8(), handle_tokens);
+  } else {
+    wuffs_base__io_buffer src =
+        wuffs_base__ptr_u8__writer(g_work_slice_u8.ptr, src_len);
+    status = wuffs_aux::decode_tokens(
+        dec.get(), &tok, &src, wuffs_base__empty_slice_u8(),
+        [&file](wuffs_base__io_buffer* src) -> wuffs_base__status {
+          size_t n = file.meta.wi - file.meta.ri;
+          if (n > (src->data.len - src->meta.wi)) {
+            n = src->data.len - src->meta.wi;
+          }
+          memcpy(src->data.ptr + src->meta.wi, file.data.ptr + file.meta.ri,
+                 n);
+          src->meta.wi += n;
+          file.meta.ri += n;
+          src->meta.closed = file.meta.ri == file.meta.wi;
+          return wuffs_base__make_status(nullptr);
+        },
+        handle_tokens);
+  }
+
+  if (tok_len == 0) {
+    if (status.repr != wuffs_base__error__bad_argument_length_too_short) {
+      RETURN_FAIL("decode_tokens: have \"%s\", want \"%s\"", status.repr,
+                  wuffs_base__error__bad_argument_length_too_short);
+    }
+    return NULL;
+  }
+  CHECK_STATUS("decode_tokens", status);
+  if (bad_position) {
+    RETURN_FAIL("tokens covered more bytes than src->meta.ri");
+  } else if (total_length != want_total_length) {
+    RETURN_FAIL("total_length: have %" PRIu64 ", want %" PRIu64, total_length,
+                want_total_length);
+  } else if (num_tokens <= tok_len) {
+    RETURN_FAIL("num_tokens: have %" PRIu64 ", want more than %zu",
+                num_tokens, tok_len);
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_aux_decode_tokens_input_span() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_aux_decode_tokens(16, 0);
+}
+
+const char*  //
+test_wuffs_aux_decode_tokens_small_reads() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_aux_decode_tokens(16, 256);
+}
+
+const char*  //
+test_wuffs_aux_decode_tokens_zero_length_tok() {
+  CHECK_FOCUS(__func__);
+  CHECK_STRING(do_test_wuffs_aux_decode_tokens(0, 0));
+  return do_test_wuffs_aux_decode_tokens(0, 256);
+}
+
+// ---------------- Manifest
+
+proc g_tests[] = {
+
+    test_wuffs_aux_decode_tokens_input_span,
+    test_wuffs_aux_decode_tokens_small_reads,
+    test_wuffs_aux_decode_tokens_zero_length_tok,
+    test_wuffs_aux_decoder_pool,
+    test_wuffs_aux_transform_io_input_span,
+    test_wuffs_aux_transform_io_small_reads,
+    test_wuffs_aux_transform_io_small_writes,
+    test_wuffs_aux_transform_io_zero_length_dst,
+
+    NULL,
+};
+
+proc g_benches[] = {
+
+    NULL,
+};
+
+int  //
+main(int argc, char** argv) {
+  g_proc_package_name = "auxiliary";
+  return test_main(argc, argv, g_tests, g_benches);
+}
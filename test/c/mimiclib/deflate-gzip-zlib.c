@@ -14,10 +14,17 @@
 
 // ----------------
 
-// Uncomment this line to test and bench miniz instead of zlib-the-library.
+// Uncomment one of these lines to test and bench miniz or libdeflate instead
+// of zlib-the-library. For libdeflate, also replace "-lz" with "-ldeflate" in
+// the "wuffs mimic cflags".
 // #define WUFFS_MIMICLIB_USE_MINIZ_INSTEAD_OF_ZLIB 1
+// #define WUFFS_MIMICLIB_USE_LIBDEFLATE_INSTEAD_OF_ZLIB 1
+//
+// zlib-ng needs no code changes here. Build it in its zlib compatible mode
+// (cmake -DZLIB_COMPAT=ON) and link against that instead of the system zlib,
+// e.g. by adding "-L/path/to/your/zlib-ng/build" before "-lz".
 
-#ifdef WUFFS_MIMICLIB_USE_MINIZ_INSTEAD_OF_ZLIB
+#if defined(WUFFS_MIMICLIB_USE_MINIZ_INSTEAD_OF_ZLIB)
 #include "/path/to/your/copy/of/github.com/richgel999/miniz/miniz_tinfl.c"
 
 const char*  //
@@ -101,7 +108,211 @@ mimic_zlib_decode_with_dictionary(wuffs_base__io_buffer* dst,
   return "miniz does not implement zlib dictionaries";
 }
 
-#else  // WUFFS_MIMICLIB_USE_MINIZ_INSTEAD_OF_ZLIB
+const char*  //
+mimic_deflate_encode_level_fast(wuffs_base__io_buffer* dst,
+                                wuffs_base__io_buffer* src,
+                                uint32_t wuffs_initialize_flags,
+                                uint64_t wlimit,
+                                uint64_t rlimit) {
+  return "miniz_tinfl does not implement deflate encoding";
+}
+
+const char*  //
+mimic_deflate_encode_level_balanced(wuffs_base__io_buffer* dst,
+                                    wuffs_base__io_buffer* src,
+                                    uint32_t wuffs_initialize_flags,
+                                    uint64_t wlimit,
+                                    uint64_t rlimit) {
+  return "miniz_tinfl does not implement deflate encoding";
+}
+
+#elif defined(WUFFS_MIMICLIB_USE_LIBDEFLATE_INSTEAD_OF_ZLIB)
+#include "libdeflate.h"
+
+uint32_t global_mimiclib_deflate_unused_u32;
+
+const char*  //
+mimic_bench_adler32(wuffs_base__io_buffer* dst,
+                    wuffs_base__io_buffer* src,
+                    uint32_t wuffs_initialize_flags,
+                    uint64_t wlimit,
+                    uint64_t rlimit) {
+  global_mimiclib_deflate_unused_u32 = 1;
+  while (src->meta.ri < src->meta.wi) {
+    uint8_t* ptr = src->data.ptr + src->meta.ri;
+    size_t len = src->meta.wi - src->meta.ri;
+    if (len > rlimit) {
+      len = rlimit;
+    }
+    global_mimiclib_deflate_unused_u32 =
+        libdeflate_adler32(global_mimiclib_deflate_unused_u32, ptr, len);
+    src->meta.ri += len;
+  }
+  return NULL;
+}
+
+const char*  //
+mimic_bench_crc32_ieee(wuffs_base__io_buffer* dst,
+                       wuffs_base__io_buffer* src,
+                       uint32_t wuffs_initialize_flags,
+                       uint64_t wlimit,
+                       uint64_t rlimit) {
+  global_mimiclib_deflate_unused_u32 = 0;
+  while (src->meta.ri < src->meta.wi) {
+    uint8_t* ptr = src->data.ptr + src->meta.ri;
+    size_t len = src->meta.wi - src->meta.ri;
+    if (len > rlimit) {
+      len = rlimit;
+    }
+    global_mimiclib_deflate_unused_u32 =
+        libdeflate_crc32(global_mimiclib_deflate_unused_u32, ptr, len);
+    src->meta.ri += len;
+  }
+  return NULL;
+}
+
+typedef enum {
+  libdeflate_flavor_raw,
+  libdeflate_flavor_gzip,
+  libdeflate_flavor_zlib,
+} libdeflate_flavor;
+
+const char*  //
+mimic_deflate_gzip_zlib_decode(wuffs_base__io_buffer* dst,
+                               wuffs_base__io_buffer* src,
+                               uint64_t wlimit,
+                               uint64_t rlimit,
+                               libdeflate_flavor flavor) {
+  if ((wlimit < UINT64_MAX) || (rlimit < UINT64_MAX)) {
+    // libdeflate only decodes whole buffers, not streams.
+    return "unsupported I/O limit";
+  }
+  struct libdeflate_decompressor* d = libdeflate_alloc_decompressor();
+  if (!d) {
+    return "libdeflate_alloc_decompressor failed";
+  }
+
+  uint8_t* in = src->data.ptr + src->meta.ri;
+  size_t in_len = src->meta.wi - src->meta.ri;
+  uint8_t* out = dst->data.ptr + dst->meta.wi;
+  size_t out_len = dst->data.len - dst->meta.wi;
+  size_t actual_in_len = 0;
+  size_t actual_out_len = 0;
+  enum libdeflate_result r = LIBDEFLATE_BAD_DATA;
+  switch (flavor) {
+    case libdeflate_flavor_raw:
+      r = libdeflate_deflate_decompress_ex(d, in, in_len, out, out_len,
+                                           &actual_in_len, &actual_out_len);
+      break;
+    case libdeflate_flavor_gzip:
+      r = libdeflate_gzip_decompress_ex(d, in, in_len, out, out_len,
+                                        &actual_in_len, &actual_out_len);
+      break;
+    case libdeflate_flavor_zlib:
+      r = libdeflate_zlib_decompress_ex(d, in, in_len, out, out_len,
+                                        &actual_in_len, &actual_out_len);
+      break;
+  }
+  libdeflate_free_decompressor(d);
+
+  switch (r) {
+    case LIBDEFLATE_SUCCESS:
+      src->meta.ri += actual_in_len;
+      dst->meta.wi += actual_out_len;
+      return NULL;
+    case LIBDEFLATE_BAD_DATA:
+      // Match the zlib mimic's message, which some tests look for.
+      return "inflate failed (data error)";
+    case LIBDEFLATE_INSUFFICIENT_SPACE:
+      return "libdeflate failed (insufficient space)";
+    default:
+      break;
+  }
+  return "libdeflate failed";
+}
+
+const char*  //
+mimic_deflate_decode(wuffs_base__io_buffer* dst,
+                     wuffs_base__io_buffer* src,
+                     uint32_t wuffs_initialize_flags,
+                     uint64_t wlimit,
+                     uint64_t rlimit) {
+  return mimic_deflate_gzip_zlib_decode(dst, src, wlimit, rlimit,
+                                        libdeflate_flavor_raw);
+}
+
+const char*  //
+mimic_gzip_decode(wuffs_base__io_buffer* dst,
+                  wuffs_base__io_buffer* src,
+                  uint32_t wuffs_initialize_flags,
+                  uint64_t wlimit,
+                  uint64_t rlimit) {
+  return mimic_deflate_gzip_zlib_decode(dst, src, wlimit, rlimit,
+                                        libdeflate_flavor_gzip);
+}
+
+const char*  //
+mimic_zlib_decode(wuffs_base__io_buffer* dst,
+                  wuffs_base__io_buffer* src,
+                  uint32_t wuffs_initialize_flags,
+                  uint64_t wlimit,
+                  uint64_t rlimit) {
+  return mimic_deflate_gzip_zlib_decode(dst, src, wlimit, rlimit,
+                                        libdeflate_flavor_zlib);
+}
+
+const char*  //
+mimic_zlib_decode_with_dictionary(wuffs_base__io_buffer* dst,
+                                  wuffs_base__io_buffer* src,
+                                  wuffs_base__slice_u8 dictionary) {
+  return "libdeflate does not implement zlib dictionaries";
+}
+
+const char*  //
+mimic_deflate_encode(wuffs_base__io_buffer* dst,
+                     wuffs_base__io_buffer* src,
+                     int level,
+                     uint64_t wlimit,
+                     uint64_t rlimit) {
+  if ((wlimit < UINT64_MAX) || (rlimit < UINT64_MAX)) {
+    // libdeflate only encodes whole buffers, not streams.
+    return "unsupported I/O limit";
+  }
+  struct libdeflate_compressor* c = libdeflate_alloc_compressor(level);
+  if (!c) {
+    return "libdeflate_alloc_compressor failed";
+  }
+  size_t n = libdeflate_deflate_compress(
+      c, src->data.ptr + src->meta.ri, src->meta.wi - src->meta.ri,
+      dst->data.ptr + dst->meta.wi, dst->data.len - dst->meta.wi);
+  libdeflate_free_compressor(c);
+  if (n == 0) {
+    return "libdeflate_deflate_compress failed";
+  }
+  src->meta.ri = src->meta.wi;
+  dst->meta.wi += n;
+  return NULL;
+}
+
+const char*  //
+mimic_deflate_encode_level_fast(wuffs_base__io_buffer* dst,
+                                wuffs_base__io_buffer* src,
+                                uint32_t wuffs_initialize_flags,
+                                uint64_t wlimit,
+                                uint64_t rlimit) {
+  return mimic_deflate_encode(dst, src, 1, wlimit, rlimit);
+}
+
+const char*  //
+mimic_deflate_encode_level_balanced(wuffs_base__io_buffer* dst,
+                                    wuffs_base__io_buffer* src,
+                                    uint32_t wuffs_initialize_flags,
+                                    uint64_t wlimit,
+                                    uint64_t rlimit) {
+  return mimic_deflate_encode(dst, src, 6, wlimit, rlimit);
+}
+
+#else  // defined(WUFFS_MIMICLIB_USE_MINIZ_INSTEAD_OF_ZLIB) etc
 #include "zlib.h"
 
 uint32_t global_mimiclib_deflate_unused_u32;
@@ -299,4 +510,118 @@ mimic_zlib_decode_with_dictionary(wuffs_base__io_buffer* dst,
                                         UINT64_MAX, zlib_flavor_zlib);
 }
 
-#endif  // WUFFS_MIMICLIB_USE_MINIZ_INSTEAD_OF_ZLIB
+const char*  //
+mimic_deflate_gzip_zlib_encode(wuffs_base__io_buffer* dst,
+                               wuffs_base__io_buffer* src,
+                               int level,
+                               uint64_t wlimit,
+                               uint64_t rlimit,
+                               zlib_flavor flavor) {
+  const char* ret = NULL;
+  if (dst->data.len > UINT_MAX) {
+    ret = "dst length is too large";
+    goto cleanup0;
+  }
+  if (src->data.len > UINT_MAX) {
+    ret = "src length is too large";
+    goto cleanup0;
+  }
+
+  // See deflateInit2 in the zlib manual, or in zlib.h, for details about how
+  // the window_bits int also encodes the wire format wrapper.
+  int window_bits = 0;
+  switch (flavor) {
+    case zlib_flavor_raw:
+      window_bits = -15;
+      break;
+    case zlib_flavor_gzip:
+      window_bits = +15 | 16;
+      break;
+    case zlib_flavor_zlib:
+      window_bits = +15;
+      break;
+    default:
+      ret = "invalid zlib_flavor";
+      goto cleanup0;
+  }
+  z_stream z = {0};
+  int di2_err =
+      deflateInit2(&z, level, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY);
+  if (di2_err != Z_OK) {
+    ret = "deflateInit2 failed";
+    goto cleanup0;
+  }
+
+  while (true) {
+    z.next_in = src->data.ptr + src->meta.ri;
+    z.avail_in = src->meta.wi - src->meta.ri;
+    int flush = Z_FINISH;
+    if (z.avail_in > rlimit) {
+      z.avail_in = rlimit;
+      flush = Z_NO_FLUSH;
+    }
+    uInt initial_avail_in = z.avail_in;
+
+    z.next_out = dst->data.ptr + dst->meta.wi;
+    z.avail_out = dst->data.len - dst->meta.wi;
+    if (z.avail_out > wlimit) {
+      z.avail_out = wlimit;
+    }
+    uInt initial_avail_out = z.avail_out;
+
+    int d_err = deflate(&z, flush);
+
+    if (initial_avail_in < z.avail_in) {
+      ret = "inconsistent avail_in";
+      goto cleanup1;
+    }
+    src->meta.ri += initial_avail_in - z.avail_in;
+
+    if (initial_avail_out < z.avail_out) {
+      ret = "inconsistent avail_out";
+      goto cleanup1;
+    }
+    dst->meta.wi += initial_avail_out - z.avail_out;
+
+    if (d_err == Z_STREAM_END) {
+      break;
+    } else if ((d_err != Z_OK) && (d_err != Z_BUF_ERROR)) {
+      ret = "deflate failed";
+      goto cleanup1;
+    } else if (dst->meta.wi == dst->data.len) {
+      ret = "deflate failed (dst is full)";
+      goto cleanup1;
+    }
+  }
+
+cleanup1:;
+  int de_err = deflateEnd(&z);
+  if ((de_err != Z_OK) && !ret) {
+    ret = "deflateEnd failed";
+  }
+
+cleanup0:;
+  return ret;
+}
+
+const char*  //
+mimic_deflate_encode_level_fast(wuffs_base__io_buffer* dst,
+                                wuffs_base__io_buffer* src,
+                                uint32_t wuffs_initialize_flags,
+                                uint64_t wlimit,
+                                uint64_t rlimit) {
+  return mimic_deflate_gzip_zlib_encode(dst, src, 1, wlimit, rlimit,
+                                        zlib_flavor_raw);
+}
+
+const char*  //
+mimic_deflate_encode_level_balanced(wuffs_base__io_buffer* dst,
+                                    wuffs_base__io_buffer* src,
+                                    uint32_t wuffs_initialize_flags,
+                                    uint64_t wlimit,
+                                    uint64_t rlimit) {
+  return mimic_deflate_gzip_zlib_encode(dst, src, 6, wlimit, rlimit,
+                                        zlib_flavor_raw);
+}
+
+#endif  // defined(WUFFS_MIMICLIB_USE_MINIZ_INSTEAD_OF_ZLIB) etc
@@ -0,0 +1,65 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+#include "lz4frame.h"
+
+const char*  //
+mimic_lz4_decode(wuffs_base__io_buffer* dst,
+                 wuffs_base__io_buffer* src,
+                 uint32_t wuffs_initialize_flags,
+                 uint64_t wlimit,
+                 uint64_t rlimit) {
+  const char* ret = NULL;
+  LZ4F_dctx* dctx = NULL;
+  if (LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION))) {
+    return "LZ4F_createDecompressionContext failed";
+  }
+
+  while (true) {
+    size_t n_src = src->meta.wi - src->meta.ri;
+    if (n_src > rlimit) {
+      n_src = rlimit;
+    }
+    size_t n_dst = dst->data.len - dst->meta.wi;
+    if (n_dst > wlimit) {
+      n_dst = wlimit;
+    }
+
+    size_t hint = LZ4F_decompress(dctx, dst->data.ptr + dst->meta.wi, &n_dst,
+                                  src->data.ptr + src->meta.ri, &n_src, NULL);
+    if (LZ4F_isError(hint)) {
+      ret = LZ4F_getErrorName(hint);
+      goto cleanup;
+    }
+    src->meta.ri += n_src;
+    dst->meta.wi += n_dst;
+
+    if (hint == 0) {
+      break;
+    } else if ((n_src == 0) && (n_dst == 0)) {
+      if (src->meta.ri == src->meta.wi) {
+        ret = "unexpected end of data";
+      } else {
+        ret = "dst buffer is too short";
+      }
+      goto cleanup;
+    }
+  }
+
+cleanup:
+  LZ4F_freeDecompressionContext(dctx);
+  return ret;
+}
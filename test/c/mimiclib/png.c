@@ -0,0 +1,59 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+#include "png.h"
+
+// mimic_png_decode uses libpng's "simplified API" (as of libpng 1.6), which
+// decodes to 8 bits per channel, non-premultiplied BGRA.
+const char*  //
+mimic_png_decode(wuffs_base__io_buffer* dst,
+                 uint32_t wuffs_initialize_flags,
+                 wuffs_base__pixel_format pixfmt,
+                 wuffs_base__io_buffer* src) {
+  if (pixfmt.repr != WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL) {
+    return "unsupported pixfmt";
+  }
+
+  const char* ret = NULL;
+
+  png_image pi;
+  memset(&pi, 0, (sizeof pi));
+  pi.version = PNG_IMAGE_VERSION;
+
+  if (!png_image_begin_read_from_memory(&pi, src->data.ptr + src->meta.ri,
+                                        src->meta.wi - src->meta.ri)) {
+    ret = "png_image_begin_read_from_memory failed";
+    goto cleanup0;
+  }
+  pi.format = PNG_FORMAT_BGRA;
+
+  size_t n = PNG_IMAGE_SIZE(pi);
+  if (n > (dst->data.len - dst->meta.wi)) {
+    ret = "PNG image's pixel data won't fit in the dst buffer";
+    goto cleanup0;
+  }
+  if (!png_image_finish_read(&pi, NULL, dst->data.ptr + dst->meta.wi, 0,
+                             NULL)) {
+    ret = "png_image_finish_read failed";
+    goto cleanup0;
+  }
+  dst->meta.wi += n;
+  src->meta.ri = src->meta.wi;
+
+cleanup0:;
+  png_image_free(&pi);
+  return ret;
+}
@@ -0,0 +1,68 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+#include "zstd.h"
+
+const char*  //
+mimic_zstd_decode(wuffs_base__io_buffer* dst,
+                  wuffs_base__io_buffer* src,
+                  uint32_t wuffs_initialize_flags,
+                  uint64_t wlimit,
+                  uint64_t rlimit) {
+  const char* ret = NULL;
+  ZSTD_DStream* ds = ZSTD_createDStream();
+  if (!ds) {
+    return "ZSTD_createDStream failed";
+  }
+
+  while (true) {
+    ZSTD_inBuffer in = {0};
+    in.src = src->data.ptr + src->meta.ri;
+    in.size = src->meta.wi - src->meta.ri;
+    if (in.size > rlimit) {
+      in.size = rlimit;
+    }
+    ZSTD_outBuffer out = {0};
+    out.dst = dst->data.ptr + dst->meta.wi;
+    out.size = dst->data.len - dst->meta.wi;
+    if (out.size > wlimit) {
+      out.size = wlimit;
+    }
+
+    size_t hint = ZSTD_decompressStream(ds, &out, &in);
+    if (ZSTD_isError(hint)) {
+      ret = ZSTD_getErrorName(hint);
+      goto cleanup;
+    }
+    src->meta.ri += in.pos;
+    dst->meta.wi += out.pos;
+
+    if (hint == 0) {
+      break;
+    } else if ((in.pos == 0) && (out.pos == 0)) {
+      if (src->meta.ri == src->meta.wi) {
+        ret = "unexpected end of data";
+      } else {
+        ret = "dst buffer is too short";
+      }
+      goto cleanup;
+    }
+  }
+
+cleanup:
+  ZSTD_freeDStream(ds);
+  return ret;
+}
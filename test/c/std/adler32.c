@@ -228,16 +228,143 @@ test_wuffs_adler32_pi() {
   return NULL;
 }
 
+const char*  //
+test_wuffs_adler32_combine() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hibiscus.regular.bmp"));
+
+  // The k == 1 case replaces the data with all 0xFF bytes, the worst case for
+  // overflow.
+  int k;
+  for (k = 0; k < 2; k++) {
+    if (k == 1) {
+      memset(src.data.ptr, 0xFF, src.meta.wi);
+    }
+
+    // Split the data into a prefix and suffix, hash each independently and
+    // check that combining those two checksums gives the checksum of the whole.
+    const size_t splits[] = {0, 1, 15, 16, 17, 1000, 65521, 65522};
+    uint32_t want = 0;
+    int i;
+    for (i = -1; i < (int)(WUFFS_TESTLIB_ARRAY_SIZE(splits)); i++) {
+      size_t n = (i < 0) ? src.meta.wi : splits[i];
+      if (n > src.meta.wi) {
+        RETURN_FAIL("source file is too short");
+      }
+
+      uint32_t have[2] = {0};
+      int j;
+      for (j = 0; j < 2; j++) {
+        wuffs_adler32__hasher checksum;
+        CHECK_STATUS(
+            "initialize",
+            wuffs_adler32__hasher__initialize(
+                &checksum, sizeof checksum, WUFFS_VERSION,
+                WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+        have[j] = wuffs_adler32__hasher__update_u32(
+            &checksum, ((wuffs_base__slice_u8){
+                           .ptr = src.data.ptr + (j ? n : 0),
+                           .len = j ? (src.meta.wi - n) : n,
+                       }));
+      }
+
+      if (i < 0) {
+        want = have[0];
+        continue;
+      }
+
+      wuffs_adler32__hasher c;
+      CHECK_STATUS("initialize",
+                   wuffs_adler32__hasher__initialize(
+                       &c, sizeof c, WUFFS_VERSION,
+                       WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+      uint32_t have_combined = wuffs_adler32__hasher__combine_u32(
+          &c, have[0], have[1], src.meta.wi - n);
+      if (have_combined != want) {
+        RETURN_FAIL("k=%d, n=%zu: have 0x%08" PRIX32 ", want 0x%08" PRIX32, k,
+                    n, have_combined, want);
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_adler32_cpu_arch() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hat.bmp"));
+
+  // Compare the CPU-specific code (if any) with the portable code, for a
+  // variety of offsets (alignments) and lengths. The k == 1 case replaces the
+  // data with all 0xFF bytes, the worst case for overflow.
+  const size_t lens[] = {63, 64, 65, 95, 96, 127, 1000, 5552, 5553, 30000};
+  int k;
+  for (k = 0; k < 2; k++) {
+    if (k == 1) {
+      memset(src.data.ptr, 0xFF, src.meta.wi);
+    }
+    int o;
+    for (o = 0; o < 32; o++) {
+      int l;
+      for (l = 0; l < WUFFS_TESTLIB_ARRAY_SIZE(lens); l++) {
+        if ((o + lens[l]) > src.meta.wi) {
+          RETURN_FAIL("source file is too short");
+        }
+        wuffs_base__slice_u8 data = ((wuffs_base__slice_u8){
+            .ptr = src.data.ptr + o,
+            .len = lens[l],
+        });
+
+        uint32_t have[2] = {0};
+        int j;
+        for (j = 0; j < 2; j++) {
+          wuffs_adler32__hasher checksum;
+          CHECK_STATUS(
+              "initialize",
+              wuffs_adler32__hasher__initialize(
+                  &checksum, sizeof checksum, WUFFS_VERSION,
+                  WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+          if (j == 0) {
+            // Force the portable code path.
+            checksum.private_impl.f_cpu_arch_checked = true;
+            checksum.private_impl.f_have_x86_sse42 = false;
+          }
+          // Hash the data twice, so that the second update_u32 call starts
+          // with a state other than the initial (0x00000001) state.
+          wuffs_adler32__hasher__update_u32(&checksum, data);
+          have[j] = wuffs_adler32__hasher__update_u32(&checksum, data);
+        }
+
+        if (have[0] != have[1]) {
+          RETURN_FAIL("k=%d, o=%d, l=%d: portable 0x%08" PRIX32
+                      ", cpu_arch 0x%08" PRIX32,
+                      k, o, l, have[0], have[1]);
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
 // ---------------- Adler32 Benches
 
 uint32_t g_wuffs_adler32_unused_u32;
 
 const char*  //
-wuffs_bench_adler32(wuffs_base__io_buffer* dst,
-                    wuffs_base__io_buffer* src,
-                    uint32_t wuffs_initialize_flags,
-                    uint64_t wlimit,
-                    uint64_t rlimit) {
+do_wuffs_bench_adler32(wuffs_base__io_buffer* dst,
+                       wuffs_base__io_buffer* src,
+                       uint32_t wuffs_initialize_flags,
+                       uint64_t wlimit,
+                       uint64_t rlimit,
+                       bool portable_only) {
   uint64_t len = src->meta.wi - src->meta.ri;
   if (rlimit) {
     len = wuffs_base__u64__min(len, rlimit);
@@ -246,6 +373,10 @@ wuffs_bench_adler32(wuffs_base__io_buffer* dst,
   CHECK_STATUS("initialize", wuffs_adler32__hasher__initialize(
                                  &checksum, sizeof checksum, WUFFS_VERSION,
                                  wuffs_initialize_flags));
+  if (portable_only) {
+    checksum.private_impl.f_cpu_arch_checked = true;
+    checksum.private_impl.f_have_x86_sse42 = false;
+  }
   g_wuffs_adler32_unused_u32 = wuffs_adler32__hasher__update_u32(
       &checksum, ((wuffs_base__slice_u8){
                      .ptr = src->data.ptr + src->meta.ri,
@@ -255,6 +386,26 @@ wuffs_bench_adler32(wuffs_base__io_buffer* dst,
   return NULL;
 }
 
+const char*  //
+wuffs_bench_adler32(wuffs_base__io_buffer* dst,
+                    wuffs_base__io_buffer* src,
+                    uint32_t wuffs_initialize_flags,
+                    uint64_t wlimit,
+                    uint64_t rlimit) {
+  return do_wuffs_bench_adler32(dst, src, wuffs_initialize_flags, wlimit,
+                                rlimit, false);
+}
+
+const char*  //
+wuffs_bench_adler32_portable(wuffs_base__io_buffer* dst,
+                             wuffs_base__io_buffer* src,
+                             uint32_t wuffs_initialize_flags,
+                             uint64_t wlimit,
+                             uint64_t rlimit) {
+  return do_wuffs_bench_adler32(dst, src, wuffs_initialize_flags, wlimit,
+                                rlimit, true);
+}
+
 const char*  //
 bench_wuffs_adler32_10k() {
   CHECK_FOCUS(__func__);
@@ -273,6 +424,24 @@ bench_wuffs_adler32_100k() {
       &g_adler32_pi_gt, UINT64_MAX, UINT64_MAX, 150);
 }
 
+const char*  //
+bench_wuffs_adler32_portable_10k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_bench_adler32_portable,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_adler32_midsummer_gt, UINT64_MAX, UINT64_MAX, 1500);
+}
+
+const char*  //
+bench_wuffs_adler32_portable_100k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_bench_adler32_portable,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_adler32_pi_gt, UINT64_MAX, UINT64_MAX, 150);
+}
+
   // ---------------- Mimic Benches
 
 #ifdef WUFFS_MIMIC
@@ -301,6 +470,8 @@ bench_mimic_adler32_100k() {
 
 proc g_tests[] = {
 
+    test_wuffs_adler32_combine,
+    test_wuffs_adler32_cpu_arch,
     test_wuffs_adler32_golden,
     test_wuffs_adler32_interface,
     test_wuffs_adler32_pi,
@@ -312,6 +483,8 @@ proc g_benches[] = {
 
     bench_wuffs_adler32_10k,
     bench_wuffs_adler32_100k,
+    bench_wuffs_adler32_portable_10k,
+    bench_wuffs_adler32_portable_100k,
 
 #ifdef WUFFS_MIMIC
 
@@ -69,6 +69,268 @@ the first "./a.out" with "./a.out -bench". Combine these changes with the
 
 // ---------------- BMP Tests
 
+const char*  //
+do_test_wuffs_bmp_decode_indexes(const char* filename,
+                                 const char* palette_filename,
+                                 const char* indexes_filename,
+                                 uint64_t rlimit) {
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, filename));
+
+  wuffs_bmp__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_bmp__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+  wuffs_base__image_config ic = ((wuffs_base__image_config){});
+  CHECK_STATUS("decode_image_config",
+               wuffs_bmp__decoder__decode_image_config(&dec, &ic, &src));
+  uint32_t width = wuffs_base__pixel_config__width(&ic.pixcfg);
+  uint32_t height = wuffs_base__pixel_config__height(&ic.pixcfg);
+  wuffs_base__pixel_config__set(
+      &ic.pixcfg, WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_BINARY,
+      WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, width, height);
+  wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+  CHECK_STATUS("set_from_slice", wuffs_base__pixel_buffer__set_from_slice(
+                                     &pb, &ic.pixcfg, g_pixel_slice_u8));
+
+  while (true) {
+    wuffs_base__io_buffer limited_src = make_limited_reader(src, rlimit);
+    size_t old_ri = src.meta.ri;
+    wuffs_base__status status = wuffs_bmp__decoder__decode_frame(
+        &dec, &pb, &limited_src, WUFFS_BASE__PIXEL_BLEND__SRC, g_work_slice_u8,
+        NULL);
+    src.meta.ri += limited_src.meta.ri;
+    if (wuffs_base__status__is_ok(&status)) {
+      break;
+    } else if (status.repr != wuffs_base__suspension__short_read) {
+      RETURN_FAIL("decode_frame: have \"%s\", want \"%s\"", status.repr,
+                  wuffs_base__suspension__short_read);
+    } else if (src.meta.ri == old_ri) {
+      RETURN_FAIL("decode_frame: no progress was made");
+    }
+  }
+
+  uint8_t pal_want_array[1024];
+  wuffs_base__io_buffer pal_want = ((wuffs_base__io_buffer){
+      .data = ((wuffs_base__slice_u8){
+          .ptr = pal_want_array,
+          .len = 1024,
+      }),
+  });
+  CHECK_STRING(read_file(&pal_want, palette_filename));
+  wuffs_base__io_buffer pal_have = ((wuffs_base__io_buffer){
+      .data = wuffs_base__pixel_buffer__palette(&pb),
+  });
+  pal_have.meta.wi = pal_have.data.len;
+  CHECK_STRING(check_io_buffers_equal("palette ", &pal_have, &pal_want));
+
+  wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  CHECK_STRING(copy_to_io_buffer_from_pixel_buffer(
+      &have, &pb, make_rect_ie_u32(0, 0, width, height)));
+  wuffs_base__io_buffer ind_want = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+  CHECK_STRING(read_file(&ind_want, indexes_filename));
+  return check_io_buffers_equal("indexes ", &have, &ind_want);
+}
+
+// ----
+
+const char*  //
+test_wuffs_bmp_decode_bitfields() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/hippopotamus.bitfields.bmp",
+      "test/data/hippopotamus.rgb555.bmp",
+  };
+  const wuffs_base__color_u32_argb_premul want_final_pixels[] = {
+      0xFFF5F5F5,
+      0xFFF7F7F7,
+  };
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    wuffs_bmp__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_bmp__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    const char* z = do_test__wuffs_base__image_decoder(
+        wuffs_bmp__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+        filenames[i], 0, SIZE_MAX, 36, 28, want_final_pixels[i]);
+    if (z) {
+      RETURN_FAIL("%s: %s", filenames[i], z);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_bmp_decode_frame_banded() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/bricks-dither.bmp",     "test/data/hat.bmp",
+      "test/data/harvesters.bmp",        "test/data/hippopotamus.bitfields.bmp",
+      "test/data/hippopotamus.bmp",      "test/data/hippopotamus.rgb555.bmp",
+      "test/data/hippopotamus.rle4.bmp",
+  };
+  const wuffs_base__rect_ie_u32 crops[] = {
+      {0, 0, 0, 0},
+      {3, 5, 40, 30},
+  };
+  const uint32_t band_heights[] = {1, 7, 100000};
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    int c;
+    for (c = 0; c < WUFFS_TESTLIB_ARRAY_SIZE(crops); c++) {
+      uint32_t scale_shift;
+      for (scale_shift = 0; scale_shift <= 1; scale_shift++) {
+        int b;
+        for (b = 0; b < WUFFS_TESTLIB_ARRAY_SIZE(band_heights); b++) {
+          int r;
+          for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+            wuffs_bmp__decoder full;
+            CHECK_STATUS(
+                "initialize (full)",
+                wuffs_bmp__decoder__initialize(
+                    &full, sizeof full, WUFFS_VERSION,
+                    WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+            wuffs_bmp__decoder banded;
+            CHECK_STATUS(
+                "initialize (banded)",
+                wuffs_bmp__decoder__initialize(
+                    &banded, sizeof banded, WUFFS_VERSION,
+                    WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+            wuffs_base__decode_frame_options opts =
+                wuffs_base__null_decode_frame_options();
+            wuffs_base__decode_frame_options__set_scale_shift(&opts,
+                                                              scale_shift);
+            wuffs_base__decode_frame_options__set_crop_rect(&opts, crops[c]);
+            wuffs_base__decode_frame_options__set_band_height(&opts,
+                                                              band_heights[b]);
+            const char* z = do_test__wuffs_base__image_decoder_banded(
+                wuffs_bmp__decoder__upcast_as__wuffs_base__image_decoder(&full),
+                wuffs_bmp__decoder__upcast_as__wuffs_base__image_decoder(
+                    &banded),
+                filenames[i], &opts, rlimits[r]);
+            if (z) {
+              RETURN_FAIL("%s, c=%d, scale_shift=%" PRIu32 ", b=%d, r=%d: %s",
+                          filenames[i], c, scale_shift, b, r, z);
+            }
+          }
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_bmp_decode_frame_cropped() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/bricks-dither.bmp", "test/data/hat.bmp",
+      "test/data/harvesters.bmp",    "test/data/hippopotamus.bitfields.bmp",
+      "test/data/hippopotamus.bmp",  "test/data/hippopotamus.rle4.bmp",
+  };
+  const wuffs_base__rect_ie_u32 crops[] = {
+      {0, 0, 1, 1},
+      {3, 5, 40, 30},
+      {9, 0, 10, 100000},
+      {17, 2, 100000, 31},
+      {100000, 100000, 100001, 100001},
+  };
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    int c;
+    for (c = 0; c < WUFFS_TESTLIB_ARRAY_SIZE(crops); c++) {
+      uint32_t scale_shift;
+      for (scale_shift = 0; scale_shift <= 1; scale_shift++) {
+        int r;
+        for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+          wuffs_bmp__decoder full;
+          CHECK_STATUS(
+              "initialize (full)",
+              wuffs_bmp__decoder__initialize(
+                  &full, sizeof full, WUFFS_VERSION,
+                  WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+          wuffs_bmp__decoder cropped;
+          CHECK_STATUS(
+              "initialize (cropped)",
+              wuffs_bmp__decoder__initialize(
+                  &cropped, sizeof cropped, WUFFS_VERSION,
+                  WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+          wuffs_base__decode_frame_options opts =
+              wuffs_base__null_decode_frame_options();
+          wuffs_base__decode_frame_options__set_scale_shift(&opts, scale_shift);
+          wuffs_base__decode_frame_options__set_crop_rect(&opts, crops[c]);
+          const char* z = do_test__wuffs_base__image_decoder_scaled(
+              wuffs_bmp__decoder__upcast_as__wuffs_base__image_decoder(&full),
+              wuffs_bmp__decoder__upcast_as__wuffs_base__image_decoder(
+                  &cropped),
+              filenames[i], &opts, rlimits[r]);
+          if (z) {
+            RETURN_FAIL("%s, c=%d, scale_shift=%" PRIu32 ", r=%d: %s",
+                        filenames[i], c, scale_shift, r, z);
+          }
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_bmp_decode_frame_scaled() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/bricks-dither.bmp", "test/data/hat.bmp",
+      "test/data/harvesters.bmp",    "test/data/hippopotamus.bitfields.bmp",
+      "test/data/hippopotamus.bmp",  "test/data/hippopotamus.rle4.bmp",
+  };
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    uint32_t scale_shift;
+    for (scale_shift = 1; scale_shift <= 3; scale_shift++) {
+      int r;
+      for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+        wuffs_bmp__decoder full;
+        CHECK_STATUS(
+            "initialize (full)",
+            wuffs_bmp__decoder__initialize(
+                &full, sizeof full, WUFFS_VERSION,
+                WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+        wuffs_bmp__decoder scaled;
+        CHECK_STATUS(
+            "initialize (scaled)",
+            wuffs_bmp__decoder__initialize(
+                &scaled, sizeof scaled, WUFFS_VERSION,
+                WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+        wuffs_base__decode_frame_options opts =
+            wuffs_base__null_decode_frame_options();
+        wuffs_base__decode_frame_options__set_scale_shift(&opts, scale_shift);
+        const char* z = do_test__wuffs_base__image_decoder_scaled(
+            wuffs_bmp__decoder__upcast_as__wuffs_base__image_decoder(&full),
+            wuffs_bmp__decoder__upcast_as__wuffs_base__image_decoder(&scaled),
+            filenames[i], &opts, rlimits[r]);
+        if (z) {
+          RETURN_FAIL("%s, scale_shift=%" PRIu32 ", r=%d: %s", filenames[i],
+                      scale_shift, r, z);
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_bmp_decode_interface() {
   CHECK_FOCUS(__func__);
@@ -112,6 +374,30 @@ test_wuffs_bmp_decode_frame_config() {
   return NULL;
 }
 
+const char*  //
+test_wuffs_bmp_decode_rle() {
+  CHECK_FOCUS(__func__);
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int r;
+  for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+    CHECK_STRING(do_test_wuffs_bmp_decode_indexes(
+        "test/data/bricks-dither.bmp", "test/data/bricks-dither.palette",
+        "test/data/bricks-dither.indexes", rlimits[r]));
+    CHECK_STRING(do_test_wuffs_bmp_decode_indexes(
+        "test/data/bricks-nodither.bmp", "test/data/bricks-nodither.palette",
+        "test/data/bricks-nodither.indexes", rlimits[r]));
+  }
+
+  wuffs_bmp__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_bmp__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  return do_test__wuffs_base__image_decoder(
+      wuffs_bmp__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      "test/data/hippopotamus.rle4.bmp", 0, SIZE_MAX, 36, 28, 0xFFFFFFFF);
+}
+
 const char*  //
 test_wuffs_bmp_decode_io_redirect() {
   CHECK_FOCUS(__func__);
@@ -188,9 +474,14 @@ test_wuffs_bmp_decode_io_redirect() {
 
 proc g_tests[] = {
 
+    test_wuffs_bmp_decode_bitfields,
+    test_wuffs_bmp_decode_frame_banded,
     test_wuffs_bmp_decode_frame_config,
+    test_wuffs_bmp_decode_frame_cropped,
+    test_wuffs_bmp_decode_frame_scaled,
     test_wuffs_bmp_decode_interface,
     test_wuffs_bmp_decode_io_redirect,
+    test_wuffs_bmp_decode_rle,
 
 #ifdef WUFFS_MIMIC
 
@@ -253,6 +253,367 @@ test_wuffs_crc32_ieee_pi() {
   return do_test_xxxxx_crc32_ieee_pi(false);
 }
 
+const char*  //
+test_wuffs_crc32_ieee_combine() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hibiscus.regular.bmp"));
+
+  // Split the data into a prefix and suffix, hash each independently and check
+  // that combining those two checksums gives the checksum of the whole.
+  const size_t splits[] = {0, 1, 15, 16, 17, 1000, 65521, 65522};
+  uint32_t want = 0;
+  int i;
+  for (i = -1; i < (int)(WUFFS_TESTLIB_ARRAY_SIZE(splits)); i++) {
+    size_t n = (i < 0) ? src.meta.wi : splits[i];
+    if (n > src.meta.wi) {
+      RETURN_FAIL("source file is too short");
+    }
+
+    uint32_t have[2] = {0};
+    int j;
+    for (j = 0; j < 2; j++) {
+      wuffs_crc32__ieee_hasher checksum;
+      CHECK_STATUS("initialize",
+                   wuffs_crc32__ieee_hasher__initialize(
+                       &checksum, sizeof checksum, WUFFS_VERSION,
+                       WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+      have[j] = wuffs_crc32__ieee_hasher__update_u32(
+          &checksum, ((wuffs_base__slice_u8){
+                         .ptr = src.data.ptr + (j ? n : 0),
+                         .len = j ? (src.meta.wi - n) : n,
+                     }));
+    }
+
+    if (i < 0) {
+      want = have[0];
+      continue;
+    }
+
+    wuffs_crc32__ieee_hasher c;
+    CHECK_STATUS("initialize",
+                 wuffs_crc32__ieee_hasher__initialize(
+                     &c, sizeof c, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    uint32_t have_combined = wuffs_crc32__ieee_hasher__combine_u32(
+        &c, have[0], have[1], src.meta.wi - n);
+    if (have_combined != want) {
+      RETURN_FAIL("n=%zu: have 0x%08" PRIX32 ", want 0x%08" PRIX32, n,
+                  have_combined, want);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_crc32_ieee_cpu_arch() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hat.bmp"));
+
+  // Compare the CPU-specific code (if any) with the portable code, for a
+  // variety of offsets (alignments) and lengths.
+  const size_t lens[] = {63, 64, 65, 79, 80, 127, 128, 129, 1000, 4096, 4111};
+  int o;
+  for (o = 0; o < 16; o++) {
+    int l;
+    for (l = 0; l < WUFFS_TESTLIB_ARRAY_SIZE(lens); l++) {
+      if ((o + lens[l]) > src.meta.wi) {
+        RETURN_FAIL("source file is too short");
+      }
+      wuffs_base__slice_u8 data = ((wuffs_base__slice_u8){
+          .ptr = src.data.ptr + o,
+          .len = lens[l],
+      });
+
+      uint32_t have[2] = {0};
+      int j;
+      for (j = 0; j < 2; j++) {
+        wuffs_crc32__ieee_hasher checksum;
+        CHECK_STATUS(
+            "initialize",
+            wuffs_crc32__ieee_hasher__initialize(
+                &checksum, sizeof checksum, WUFFS_VERSION,
+                WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+        if (j == 0) {
+          // Force the portable code path.
+          checksum.private_impl.f_cpu_arch_checked = true;
+          checksum.private_impl.f_have_x86_sse42 = false;
+        }
+        have[j] = wuffs_crc32__ieee_hasher__update_u32(&checksum, data);
+      }
+
+      if (have[0] != have[1]) {
+        RETURN_FAIL("o=%d, l=%d: portable 0x%08" PRIX32
+                    ", cpu_arch 0x%08" PRIX32,
+                    o, l, have[0], have[1]);
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_crc32_castagnoli_interface() {
+  CHECK_FOCUS(__func__);
+  wuffs_crc32__castagnoli_hasher h;
+  CHECK_STATUS("initialize",
+               wuffs_crc32__castagnoli_hasher__initialize(
+                   &h, sizeof h, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  return do_test__wuffs_base__hasher_u32(
+      wuffs_crc32__castagnoli_hasher__upcast_as__wuffs_base__hasher_u32(&h),
+      "test/data/hat.lossy.webp", 0, SIZE_MAX, 0x56A84923);
+}
+
+const char*  //
+test_wuffs_crc32_castagnoli_golden() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    const char* filename;
+    // The want values are determined by script/checksum.go.
+    uint32_t want;
+  } test_cases[] = {
+      {
+          .filename = "test/data/hat.bmp",
+          .want = 0xABF7B0E6,
+      },
+      {
+          .filename = "test/data/hat.gif",
+          .want = 0x9570A28D,
+      },
+      {
+          .filename = "test/data/hat.jpeg",
+          .want = 0x5BFEBB65,
+      },
+      {
+          .filename = "test/data/hat.lossless.webp",
+          .want = 0x8EE1FA9D,
+      },
+      {
+          .filename = "test/data/hat.lossy.webp",
+          .want = 0x56A84923,
+      },
+      {
+          .filename = "test/data/hat.png",
+          .want = 0xCFB87FD9,
+      },
+      {
+          .filename = "test/data/hat.tiff",
+          .want = 0xD34CECD3,
+      },
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+        .data = g_src_slice_u8,
+    });
+    CHECK_STRING(read_file(&src, test_cases[tc].filename));
+
+    int j;
+    for (j = 0; j < 2; j++) {
+      wuffs_crc32__castagnoli_hasher checksum;
+      CHECK_STATUS("initialize",
+                   wuffs_crc32__castagnoli_hasher__initialize(
+                       &checksum, sizeof checksum, WUFFS_VERSION,
+                       WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+      uint32_t have = 0;
+      size_t num_fragments = 0;
+      size_t num_bytes = 0;
+      do {
+        wuffs_base__slice_u8 data = ((wuffs_base__slice_u8){
+            .ptr = src.data.ptr + num_bytes,
+            .len = src.meta.wi - num_bytes,
+        });
+        size_t limit = 101 + 103 * num_fragments;
+        if ((j > 0) && (data.len > limit)) {
+          data.len = limit;
+        }
+        have = wuffs_crc32__castagnoli_hasher__update_u32(&checksum, data);
+        num_fragments++;
+        num_bytes += data.len;
+      } while (num_bytes < src.meta.wi);
+
+      if (have != test_cases[tc].want) {
+        RETURN_FAIL("tc=%d, j=%d, filename=\"%s\": have 0x%08" PRIX32
+                    ", want 0x%08" PRIX32,
+                    tc, j, test_cases[tc].filename, have, test_cases[tc].want);
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_crc32_castagnoli_pi() {
+  CHECK_FOCUS(__func__);
+
+  const char* digits =
+      "3."
+      "141592653589793238462643383279502884197169399375105820974944592307816406"
+      "2862089986280348253421170";
+  if (strlen(digits) != 99) {
+    RETURN_FAIL("strlen(digits): have %d, want 99", (int)(strlen(digits)));
+  }
+
+  // The want values are determined by script/checksum.go.
+  //
+  // wants[i] is the checksum of the first i bytes of the digits string.
+  uint32_t wants[100] = {
+      0x00000000, 0x71CEE914, 0x090DFC31, 0x52745EAD, 0xB83500D4, 0x8404DA57,
+      0xD204B41E, 0xA6D8BDD0, 0x50D05301, 0xB604AE58, 0x8C25884E, 0x9C416E07,
+      0x83392B79, 0xE1EEF4C5, 0xECB11D00, 0xB6B8CF16, 0x2C655964, 0xD7BE8830,
+      0xB3919D2E, 0xFDB84970, 0x9922AE6B, 0x5DD29708, 0xCEBB7750, 0xD24E0BB3,
+      0xE5A8323E, 0x397AD35B, 0xB95BE22F, 0x0FD9000C, 0xA50B54FF, 0xDC16B111,
+      0x614C38CA, 0x1E5A3CCF, 0x87AC81F0, 0xA486CD08, 0xE8E3C4E2, 0x8146513E,
+      0x745DF2E8, 0x81DAEF08, 0x2F5C0FDF, 0x1D1A1863, 0x68A7BBA2, 0xF54C1CE1,
+      0x815BFEE6, 0x812FE904, 0xDD3779DA, 0xC92217FE, 0x45F33369, 0x031D7AB1,
+      0x31B305A4, 0xD3B4EFB7, 0x3163AC31, 0x524C30FD, 0x2E8A7576, 0x0078376C,
+      0xC4C266AA, 0x4AC835EF, 0xDFF746EB, 0x604A354B, 0x6EC682B9, 0x6FCDE278,
+      0xE102000C, 0xE8A6402F, 0xDB429945, 0x233E45C5, 0xEC73CDB1, 0xC337E810,
+      0x61531993, 0xE307461A, 0xCD0B961A, 0x9336A6EE, 0xDF2EB878, 0xBFA1DF72,
+      0x351808DA, 0xDA9ACB7B, 0xACF498F5, 0x4596E5E6, 0x2D939B38, 0xFE287FED,
+      0xDF43A6A1, 0x32616FE3, 0x181578AE, 0x1407DED5, 0xFC1A3345, 0x9C3151BC,
+      0xBBF57140, 0xC26582DA, 0x50B4EE3E, 0xFE555898, 0x69411894, 0xF05FA7EF,
+      0x559489B6, 0x17446BBF, 0xBB7E047A, 0x6B0FEB25, 0xB02318D6, 0x76674F4C,
+      0x9CBB2CC0, 0x53E4040B, 0x2F8E3134, 0x95C84A7F,
+  };
+
+  int i;
+  for (i = 0; i < 100; i++) {
+    wuffs_crc32__castagnoli_hasher checksum;
+    CHECK_STATUS("initialize",
+                 wuffs_crc32__castagnoli_hasher__initialize(
+                     &checksum, sizeof checksum, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    uint32_t have = wuffs_crc32__castagnoli_hasher__update_u32(
+        &checksum, ((wuffs_base__slice_u8){
+                       .ptr = (uint8_t*)(digits),
+                       .len = i,
+                   }));
+    if (have != wants[i]) {
+      RETURN_FAIL("i=%d: have 0x%08" PRIX32 ", want 0x%08" PRIX32, i, have,
+                  wants[i]);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_crc32_castagnoli_combine() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hibiscus.regular.bmp"));
+
+  // Split the data into a prefix and suffix, hash each independently and check
+  // that combining those two checksums gives the checksum of the whole.
+  const size_t splits[] = {0, 1, 15, 16, 17, 1000, 65521, 65522};
+  uint32_t want = 0;
+  int i;
+  for (i = -1; i < (int)(WUFFS_TESTLIB_ARRAY_SIZE(splits)); i++) {
+    size_t n = (i < 0) ? src.meta.wi : splits[i];
+    if (n > src.meta.wi) {
+      RETURN_FAIL("source file is too short");
+    }
+
+    uint32_t have[2] = {0};
+    int j;
+    for (j = 0; j < 2; j++) {
+      wuffs_crc32__castagnoli_hasher checksum;
+      CHECK_STATUS("initialize",
+                   wuffs_crc32__castagnoli_hasher__initialize(
+                       &checksum, sizeof checksum, WUFFS_VERSION,
+                       WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+      have[j] = wuffs_crc32__castagnoli_hasher__update_u32(
+          &checksum, ((wuffs_base__slice_u8){
+                         .ptr = src.data.ptr + (j ? n : 0),
+                         .len = j ? (src.meta.wi - n) : n,
+                     }));
+    }
+
+    if (i < 0) {
+      want = have[0];
+      continue;
+    }
+
+    wuffs_crc32__castagnoli_hasher c;
+    CHECK_STATUS("initialize",
+                 wuffs_crc32__castagnoli_hasher__initialize(
+                     &c, sizeof c, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    uint32_t have_combined = wuffs_crc32__castagnoli_hasher__combine_u32(
+        &c, have[0], have[1], src.meta.wi - n);
+    if (have_combined != want) {
+      RETURN_FAIL("n=%zu: have 0x%08" PRIX32 ", want 0x%08" PRIX32, n,
+                  have_combined, want);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_crc32_castagnoli_cpu_arch() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hat.bmp"));
+
+  // Compare the CPU-specific code (if any) with the portable code, for a
+  // variety of offsets (alignments) and lengths.
+  const size_t lens[] = {0, 1, 7, 8, 9, 31, 32, 33, 1000, 4111};
+  int o;
+  for (o = 0; o < 16; o++) {
+    int l;
+    for (l = 0; l < WUFFS_TESTLIB_ARRAY_SIZE(lens); l++) {
+      if ((o + lens[l]) > src.meta.wi) {
+        RETURN_FAIL("source file is too short");
+      }
+      wuffs_base__slice_u8 data = ((wuffs_base__slice_u8){
+          .ptr = src.data.ptr + o,
+          .len = lens[l],
+      });
+
+      uint32_t have[2] = {0};
+      int j;
+      for (j = 0; j < 2; j++) {
+        wuffs_crc32__castagnoli_hasher checksum;
+        CHECK_STATUS(
+            "initialize",
+            wuffs_crc32__castagnoli_hasher__initialize(
+                &checksum, sizeof checksum, WUFFS_VERSION,
+                WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+        if (j == 0) {
+          // Force the portable code path.
+          checksum.private_impl.f_cpu_arch_checked = true;
+          checksum.private_impl.f_have_x86_sse42 = false;
+        }
+        have[j] = wuffs_crc32__castagnoli_hasher__update_u32(&checksum, data);
+      }
+
+      if (have[0] != have[1]) {
+        RETURN_FAIL("o=%d, l=%d: portable 0x%08" PRIX32
+                    ", cpu_arch 0x%08" PRIX32,
+                    o, l, have[0], have[1]);
+      }
+    }
+  }
+  return NULL;
+}
+
   // ---------------- Mimic Tests
 
 #ifdef WUFFS_MIMIC
@@ -270,11 +631,12 @@ test_mimic_crc32_ieee_pi() {
 uint32_t g_wuffs_crc32_unused_u32;
 
 const char*  //
-wuffs_bench_crc32_ieee(wuffs_base__io_buffer* dst,
-                       wuffs_base__io_buffer* src,
-                       uint32_t wuffs_initialize_flags,
-                       uint64_t wlimit,
-                       uint64_t rlimit) {
+do_wuffs_bench_crc32_ieee(wuffs_base__io_buffer* dst,
+                          wuffs_base__io_buffer* src,
+                          uint32_t wuffs_initialize_flags,
+                          uint64_t wlimit,
+                          uint64_t rlimit,
+                          bool portable_only) {
   uint64_t len = src->meta.wi - src->meta.ri;
   if (rlimit) {
     len = wuffs_base__u64__min(len, rlimit);
@@ -283,6 +645,10 @@ wuffs_bench_crc32_ieee(wuffs_base__io_buffer* dst,
   CHECK_STATUS("initialize", wuffs_crc32__ieee_hasher__initialize(
                                  &checksum, sizeof checksum, WUFFS_VERSION,
                                  wuffs_initialize_flags));
+  if (portable_only) {
+    checksum.private_impl.f_cpu_arch_checked = true;
+    checksum.private_impl.f_have_x86_sse42 = false;
+  }
   g_wuffs_crc32_unused_u32 = wuffs_crc32__ieee_hasher__update_u32(
       &checksum, ((wuffs_base__slice_u8){
                      .ptr = src->data.ptr + src->meta.ri,
@@ -292,6 +658,26 @@ wuffs_bench_crc32_ieee(wuffs_base__io_buffer* dst,
   return NULL;
 }
 
+const char*  //
+wuffs_bench_crc32_ieee(wuffs_base__io_buffer* dst,
+                       wuffs_base__io_buffer* src,
+                       uint32_t wuffs_initialize_flags,
+                       uint64_t wlimit,
+                       uint64_t rlimit) {
+  return do_wuffs_bench_crc32_ieee(dst, src, wuffs_initialize_flags, wlimit,
+                                   rlimit, false);
+}
+
+const char*  //
+wuffs_bench_crc32_ieee_portable(wuffs_base__io_buffer* dst,
+                                wuffs_base__io_buffer* src,
+                                uint32_t wuffs_initialize_flags,
+                                uint64_t wlimit,
+                                uint64_t rlimit) {
+  return do_wuffs_bench_crc32_ieee(dst, src, wuffs_initialize_flags, wlimit,
+                                   rlimit, true);
+}
+
 const char*  //
 bench_wuffs_crc32_ieee_10k() {
   CHECK_FOCUS(__func__);
@@ -310,6 +696,108 @@ bench_wuffs_crc32_ieee_100k() {
       &g_crc32_pi_gt, UINT64_MAX, UINT64_MAX, 150);
 }
 
+const char*  //
+bench_wuffs_crc32_ieee_portable_10k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_bench_crc32_ieee_portable,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_crc32_midsummer_gt, UINT64_MAX, UINT64_MAX, 1500);
+}
+
+const char*  //
+bench_wuffs_crc32_ieee_portable_100k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_bench_crc32_ieee_portable,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_crc32_pi_gt, UINT64_MAX, UINT64_MAX, 150);
+}
+
+const char*  //
+do_wuffs_bench_crc32_castagnoli(wuffs_base__io_buffer* dst,
+                                wuffs_base__io_buffer* src,
+                                uint32_t wuffs_initialize_flags,
+                                uint64_t wlimit,
+                                uint64_t rlimit,
+                                bool portable_only) {
+  uint64_t len = src->meta.wi - src->meta.ri;
+  if (rlimit) {
+    len = wuffs_base__u64__min(len, rlimit);
+  }
+  wuffs_crc32__castagnoli_hasher checksum;
+  CHECK_STATUS("initialize", wuffs_crc32__castagnoli_hasher__initialize(
+                                 &checksum, sizeof checksum, WUFFS_VERSION,
+                                 wuffs_initialize_flags));
+  if (portable_only) {
+    checksum.private_impl.f_cpu_arch_checked = true;
+    checksum.private_impl.f_have_x86_sse42 = false;
+  }
+  g_wuffs_crc32_unused_u32 = wuffs_crc32__castagnoli_hasher__update_u32(
+      &checksum, ((wuffs_base__slice_u8){
+                     .ptr = src->data.ptr + src->meta.ri,
+                     .len = len,
+                 }));
+  src->meta.ri += len;
+  return NULL;
+}
+
+const char*  //
+wuffs_bench_crc32_castagnoli(wuffs_base__io_buffer* dst,
+                             wuffs_base__io_buffer* src,
+                             uint32_t wuffs_initialize_flags,
+                             uint64_t wlimit,
+                             uint64_t rlimit) {
+  return do_wuffs_bench_crc32_castagnoli(dst, src, wuffs_initialize_flags,
+                                         wlimit, rlimit, false);
+}
+
+const char*  //
+wuffs_bench_crc32_castagnoli_portable(wuffs_base__io_buffer* dst,
+                                      wuffs_base__io_buffer* src,
+                                      uint32_t wuffs_initialize_flags,
+                                      uint64_t wlimit,
+                                      uint64_t rlimit) {
+  return do_wuffs_bench_crc32_castagnoli(dst, src, wuffs_initialize_flags,
+                                         wlimit, rlimit, true);
+}
+
+const char*  //
+bench_wuffs_crc32_castagnoli_10k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_bench_crc32_castagnoli,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_crc32_midsummer_gt, UINT64_MAX, UINT64_MAX, 1500);
+}
+
+const char*  //
+bench_wuffs_crc32_castagnoli_100k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_bench_crc32_castagnoli,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_crc32_pi_gt, UINT64_MAX, UINT64_MAX, 150);
+}
+
+const char*  //
+bench_wuffs_crc32_castagnoli_portable_10k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_bench_crc32_castagnoli_portable,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_crc32_midsummer_gt, UINT64_MAX, UINT64_MAX, 1500);
+}
+
+const char*  //
+bench_wuffs_crc32_castagnoli_portable_100k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_bench_crc32_castagnoli_portable,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_crc32_pi_gt, UINT64_MAX, UINT64_MAX, 150);
+}
+
   // ---------------- Mimic Benches
 
 #ifdef WUFFS_MIMIC
@@ -338,6 +826,13 @@ bench_mimic_crc32_ieee_100k() {
 
 proc g_tests[] = {
 
+    test_wuffs_crc32_castagnoli_combine,
+    test_wuffs_crc32_castagnoli_cpu_arch,
+    test_wuffs_crc32_castagnoli_golden,
+    test_wuffs_crc32_castagnoli_interface,
+    test_wuffs_crc32_castagnoli_pi,
+    test_wuffs_crc32_ieee_combine,
+    test_wuffs_crc32_ieee_cpu_arch,
     test_wuffs_crc32_ieee_golden,
     test_wuffs_crc32_ieee_interface,
     test_wuffs_crc32_ieee_pi,
@@ -353,8 +848,14 @@ proc g_tests[] = {
 
 proc g_benches[] = {
 
+    bench_wuffs_crc32_castagnoli_10k,
+    bench_wuffs_crc32_castagnoli_100k,
+    bench_wuffs_crc32_castagnoli_portable_10k,
+    bench_wuffs_crc32_castagnoli_portable_100k,
     bench_wuffs_crc32_ieee_10k,
     bench_wuffs_crc32_ieee_100k,
+    bench_wuffs_crc32_ieee_portable_10k,
+    bench_wuffs_crc32_ieee_portable_100k,
 
 #ifdef WUFFS_MIMIC
 
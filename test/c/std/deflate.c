@@ -89,6 +89,15 @@ golden_test g_deflate_deflate_backref_crosses_blocks_gt = {
         "deflate-backref-crosses-blocks.deflate",
 };
 
+golden_test g_deflate_deflate_degenerate_huffman_distance_gt = {
+    .want_filename =
+        "test/data/artificial/"
+        "deflate-degenerate-huffman-distance.deflate.decompressed",
+    .src_filename =
+        "test/data/artificial/"
+        "deflate-degenerate-huffman-distance.deflate",
+};
+
 golden_test g_deflate_deflate_degenerate_huffman_unused_gt = {
     .want_filename =
         "test/data/artificial/"
@@ -151,6 +160,18 @@ golden_test g_deflate_romeo_fixed_gt = {
     .src_filename = "test/data/romeo.txt.fixed-huff.deflate",
 };
 
+// The encode golden tests have no want_filename, as the Wuffs and mimic
+// encoders need not produce identical output. Their round trips are checked
+// by the encode tests instead.
+
+golden_test g_deflate_encode_midsummer_gt = {
+    .src_filename = "test/data/midsummer.txt",
+};
+
+golden_test g_deflate_encode_pi_gt = {
+    .src_filename = "test/data/pi.txt",
+};
+
 // ---------------- Deflate Tests
 
 const char*  //
@@ -197,6 +218,95 @@ wuffs_deflate_decode(wuffs_base__io_buffer* dst,
   }
 }
 
+const char*  //
+do_wuffs_deflate_encode(wuffs_base__io_buffer* dst,
+                        wuffs_base__io_buffer* src,
+                        uint32_t wuffs_initialize_flags,
+                        uint64_t wlimit,
+                        uint64_t rlimit,
+                        uint32_t level) {
+  wuffs_deflate__encoder enc;
+  CHECK_STATUS("initialize",
+               wuffs_deflate__encoder__initialize(
+                   &enc, sizeof enc, WUFFS_VERSION, wuffs_initialize_flags));
+  wuffs_deflate__encoder__set_level(&enc, level);
+
+  while (true) {
+    wuffs_base__io_buffer limited_dst = make_limited_writer(*dst, wlimit);
+    wuffs_base__io_buffer limited_src = make_limited_reader(*src, rlimit);
+
+    wuffs_base__status status = wuffs_deflate__encoder__transform_io(
+        &enc, &limited_dst, &limited_src, g_work_slice_u8);
+
+    dst->meta.wi += limited_dst.meta.wi;
+    src->meta.ri += limited_src.meta.ri;
+
+    if (((wlimit < UINT64_MAX) &&
+         (status.repr == wuffs_base__suspension__short_write)) ||
+        ((rlimit < UINT64_MAX) &&
+         (status.repr == wuffs_base__suspension__short_read))) {
+      continue;
+    }
+    return status.repr;
+  }
+}
+
+const char*  //
+wuffs_deflate_encode_level_fast(wuffs_base__io_buffer* dst,
+                                wuffs_base__io_buffer* src,
+                                uint32_t wuffs_initialize_flags,
+                                uint64_t wlimit,
+                                uint64_t rlimit) {
+  return do_wuffs_deflate_encode(dst, src, wuffs_initialize_flags, wlimit,
+                                 rlimit, WUFFS_DEFLATE__ENCODER_LEVEL_FAST);
+}
+
+const char*  //
+wuffs_deflate_encode_level_balanced(wuffs_base__io_buffer* dst,
+                                    wuffs_base__io_buffer* src,
+                                    uint32_t wuffs_initialize_flags,
+                                    uint64_t wlimit,
+                                    uint64_t rlimit) {
+  return do_wuffs_deflate_encode(dst, src, wuffs_initialize_flags, wlimit,
+                                 rlimit, WUFFS_DEFLATE__ENCODER_LEVEL_BALANCED);
+}
+
+const char*  //
+do_test_wuffs_deflate_encode_round_trip(const char* src_filename,
+                                        uint32_t level,
+                                        uint64_t wlimit,
+                                        uint64_t rlimit) {
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  wuffs_base__io_buffer encoded = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  wuffs_base__io_buffer decoded = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+
+  if (src_filename) {
+    CHECK_STRING(read_file(&src, src_filename));
+  } else {
+    src.meta.closed = true;
+  }
+  CHECK_STRING(do_wuffs_deflate_encode(
+      &encoded, &src, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wlimit, rlimit, level));
+  if (src.meta.ri != src.meta.wi) {
+    RETURN_FAIL("level=%" PRIu32 ": src: have ri=%zu, want %zu", level,
+                src.meta.ri, src.meta.wi);
+  }
+
+  encoded.meta.closed = true;
+  CHECK_STRING(wuffs_deflate_decode(
+      &decoded, &encoded,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, UINT64_MAX,
+      UINT64_MAX));
+  return check_io_buffers_equal("", &decoded, &src);
+}
+
 const char*  //
 test_wuffs_deflate_decode_256_bytes() {
   CHECK_FOCUS(__func__);
@@ -204,6 +314,105 @@ test_wuffs_deflate_decode_256_bytes() {
                             UINT64_MAX, UINT64_MAX);
 }
 
+const char*  //
+test_wuffs_deflate_decode_block_boundaries() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  wuffs_base__io_buffer want = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+
+  // test/data/pi.txt.gz holds a single DEFLATE block, so re-compress
+  // test/data/pi.txt with our encoder, which emits 16 KiB blocks.
+  CHECK_STRING(read_file(&want, "test/data/pi.txt"));
+  CHECK_STRING(do_wuffs_deflate_encode(
+      &src, &want, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      UINT64_MAX, UINT64_MAX, WUFFS_DEFLATE__ENCODER_LEVEL_BALANCED));
+  want.meta.ri = 0;
+  src.meta.closed = true;
+
+  // Decode everything, recording a checkpoint at each block boundary.
+  struct {
+    size_t src_ri;
+    size_t dst_wi;
+    uint32_t n_bits;
+  } checkpoints[16];
+  int num_checkpoints = 0;
+
+  wuffs_deflate__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_deflate__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_deflate__decoder__set_suspend_at_block_boundaries(&dec, true);
+  while (true) {
+    wuffs_base__status status = wuffs_deflate__decoder__transform_io(
+        &dec, &have, &src, g_work_slice_u8);
+    if (status.repr == NULL) {
+      break;
+    } else if (status.repr != wuffs_deflate__suspension__block_boundary) {
+      RETURN_FAIL("transform_io: \"%s\"", status.repr);
+    } else if (num_checkpoints == 16) {
+      RETURN_FAIL("too many checkpoints");
+    }
+    uint32_t n_bits = wuffs_deflate__decoder__num_buffered_bits(&dec);
+    if (n_bits > 7) {
+      RETURN_FAIL("num_buffered_bits: have %" PRIu32 ", want <= 7", n_bits);
+    }
+    checkpoints[num_checkpoints].src_ri = src.meta.ri;
+    checkpoints[num_checkpoints].dst_wi = have.meta.wi;
+    checkpoints[num_checkpoints].n_bits = n_bits;
+    num_checkpoints++;
+  }
+  CHECK_STRING(check_io_buffers_equal("full: ", &have, &want));
+  if (num_checkpoints < 2) {
+    RETURN_FAIL("num_checkpoints: have %d, want >= 2", num_checkpoints);
+  }
+
+  // Resume from each checkpoint with a fresh decoder, overwriting the tail of
+  // the have buffer, primed with the 32 KiB of history before it.
+  int i;
+  for (i = 0; i < num_checkpoints; i++) {
+    size_t src_ri = checkpoints[i].src_ri;
+    size_t dst_wi = checkpoints[i].dst_wi;
+    uint32_t n_bits = checkpoints[i].n_bits;
+    size_t hist_len = (dst_wi < 0x8000) ? dst_wi : 0x8000;
+
+    CHECK_STATUS("initialize",
+                 wuffs_deflate__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    wuffs_deflate__decoder__add_history(
+        &dec, ((wuffs_base__slice_u8){
+                  .ptr = have.data.ptr + dst_wi - hist_len,
+                  .len = hist_len,
+              }));
+    wuffs_deflate__decoder__prime(
+        &dec, n_bits, (n_bits > 0) ? (src.data.ptr[src_ri - 1] >> (8 - n_bits))
+                                   : 0);
+
+    memset(have.data.ptr + dst_wi, 0, have.meta.wi - dst_wi);
+    have.meta.wi = dst_wi;
+    src.meta.ri = src_ri;
+    wuffs_base__status status = wuffs_deflate__decoder__transform_io(
+        &dec, &have, &src, g_work_slice_u8);
+    if (status.repr) {
+      RETURN_FAIL("i=%d: transform_io: \"%s\"", i, status.repr);
+    }
+
+    char prefix[64];
+    snprintf(prefix, 64, "i=%d: ", i);
+    CHECK_STRING(check_io_buffers_equal(prefix, &have, &want));
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_deflate_decode_deflate_backref_crosses_blocks() {
   CHECK_FOCUS(__func__);
@@ -212,6 +421,14 @@ test_wuffs_deflate_decode_deflate_backref_crosses_blocks() {
                             UINT64_MAX, UINT64_MAX);
 }
 
+const char*  //
+test_wuffs_deflate_decode_deflate_degenerate_huffman_distance() {
+  CHECK_FOCUS(__func__);
+  return do_test_io_buffers(wuffs_deflate_decode,
+                            &g_deflate_deflate_degenerate_huffman_distance_gt,
+                            UINT64_MAX, UINT64_MAX);
+}
+
 const char*  //
 test_wuffs_deflate_decode_deflate_degenerate_huffman_unused() {
   CHECK_FOCUS(__func__);
@@ -336,6 +553,63 @@ test_wuffs_deflate_decode_romeo_fixed() {
                             UINT64_MAX, UINT64_MAX);
 }
 
+const char*  //
+test_wuffs_deflate_decode_short_distances() {
+  CHECK_FOCUS(__func__);
+
+  // Make runs of periodic data, with periods (back-reference distances) from
+  // 1 to 19 and run lengths either side of multiples of 8, so that the
+  // decoder's history copies exercise their 8 byte chunk special cases.
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  const uint32_t lengths[] = {3, 7, 8, 9, 15, 16, 17, 100, 258, 1000};
+  uint32_t period;
+  for (period = 1; period < 20; period++) {
+    int i;
+    for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(lengths); i++) {
+      uint32_t n = period + lengths[i];
+      if (n > (src.data.len - src.meta.wi)) {
+        RETURN_FAIL("src buffer is too short");
+      }
+      uint32_t j;
+      for (j = 0; j < n; j++) {
+        src.data.ptr[src.meta.wi + j] =
+            (j < period) ? ((uint8_t)(0x41 + ((period * 7 + j) % 26)))
+                         : src.data.ptr[src.meta.wi + j - period];
+      }
+      src.meta.wi += n;
+    }
+  }
+  src.meta.closed = true;
+
+  wuffs_base__io_buffer encoded = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  CHECK_STRING(do_wuffs_deflate_encode(
+      &encoded, &src, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      UINT64_MAX, UINT64_MAX, WUFFS_DEFLATE__ENCODER_LEVEL_BEST));
+  encoded.meta.closed = true;
+
+  const uint64_t wlimits[] = {UINT64_MAX, 300, 4096};
+  int w;
+  for (w = 0; w < WUFFS_TESTLIB_ARRAY_SIZE(wlimits); w++) {
+    encoded.meta.ri = 0;
+    wuffs_base__io_buffer decoded = ((wuffs_base__io_buffer){
+        .data = g_want_slice_u8,
+    });
+    CHECK_STRING(wuffs_deflate_decode(
+        &decoded, &encoded,
+        WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, wlimits[w],
+        UINT64_MAX));
+    const char* z = check_io_buffers_equal("", &decoded, &src);
+    if (z) {
+      RETURN_FAIL("w=%d: %s", w, z);
+    }
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_deflate_decode_split_src() {
   CHECK_FOCUS(__func__);
@@ -396,6 +670,74 @@ test_wuffs_deflate_decode_split_src() {
   return NULL;
 }
 
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// This test only runs if the program is compiled with
+// -DWUFFS_CONFIG__ENABLE_STATS.
+const char*  //
+test_wuffs_deflate_decode_stats() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+
+  golden_test* gt = &g_deflate_pi_gt;
+  CHECK_STRING(read_file(&src, gt->src_filename));
+  src.meta.ri = gt->src_offset0;
+  src.meta.wi = gt->src_offset1;
+
+  wuffs_deflate__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_deflate__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+  uint64_t num_calls = 0;
+  while (true) {
+    wuffs_base__io_buffer limited_src = make_limited_reader(src, 4096);
+    wuffs_base__status status = wuffs_deflate__decoder__transform_io(
+        &dec, &have, &limited_src, g_work_slice_u8);
+    src.meta.ri += limited_src.meta.ri;
+    num_calls++;
+    if (status.repr == NULL) {
+      break;
+    } else if (status.repr != wuffs_base__suspension__short_read) {
+      RETURN_FAIL("transform_io: \"%s\"", status.repr);
+    }
+  }
+
+  wuffs_deflate__decoder__stats stats = wuffs_deflate__decoder__get_stats(&dec);
+  wuffs_base__func_stats* f =
+      &stats.funcs[WUFFS_DEFLATE__DECODER__STATS__FUNC__TRANSFORM_IO];
+  if (f->num_calls != num_calls) {
+    RETURN_FAIL("transform_io num_calls: have %" PRIu64 ", want %" PRIu64,
+                f->num_calls, num_calls);
+  } else if (f->num_written != have.meta.wi) {
+    RETURN_FAIL("transform_io num_written: have %" PRIu64 ", want %zu",
+                f->num_written, have.meta.wi);
+  } else if (stats.num_suspensions != (num_calls - 1)) {
+    RETURN_FAIL("num_suspensions: have %" PRIu64 ", want %" PRIu64,
+                stats.num_suspensions, num_calls - 1);
+  }
+
+  uint64_t fast_and_slow =
+      stats.funcs[WUFFS_DEFLATE__DECODER__STATS__FUNC__DECODE_HUFFMAN_FAST]
+          .num_written +
+      stats.funcs[WUFFS_DEFLATE__DECODER__STATS__FUNC__DECODE_HUFFMAN_SLOW]
+          .num_written;
+  if (fast_and_slow != have.meta.wi) {
+    RETURN_FAIL("decode_huffman num_written: have %" PRIu64 ", want %zu",
+                fast_and_slow, have.meta.wi);
+  }
+  return NULL;
+}
+
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
 const char*  //
 do_test_wuffs_deflate_history(int i,
                               golden_test* gt,
@@ -449,6 +791,150 @@ do_test_wuffs_deflate_history(int i,
   return NULL;
 }
 
+const char*  //
+do_test_wuffs_deflate_dst_holds_history(bool provide_history) {
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  wuffs_base__io_buffer want = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+
+  golden_test* gt = &g_deflate_pi_gt;
+  CHECK_STRING(read_file(&src, gt->src_filename));
+  CHECK_STRING(read_file(&want, gt->want_filename));
+  src.meta.ri = gt->src_offset0;
+  src.meta.wi = gt->src_offset1;
+
+  wuffs_deflate__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_deflate__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_deflate__decoder__set_dst_holds_history(&dec, true);
+
+  // Decode into a small "window" sliding over the have buffer. This is a
+  // degenerate (never wrapping) ring buffer, but that is enough to exercise
+  // the decoder. When provide_history is true, the window starts up to 32 KiB
+  // before the next byte to write.
+  const size_t window_len = 1000;
+  size_t pos = 0;
+  while (true) {
+    size_t h = 0;
+    if (provide_history) {
+      h = (pos < 0x8000) ? pos : 0x8000;
+    }
+    wuffs_base__io_buffer window = ((wuffs_base__io_buffer){
+        .data = ((wuffs_base__slice_u8){
+            .ptr = have.data.ptr + pos - h,
+            .len = h + window_len,
+        }),
+    });
+    window.meta.wi = h;
+
+    wuffs_base__status status = wuffs_deflate__decoder__transform_io(
+        &dec, &window, &src, g_work_slice_u8);
+    pos += window.meta.wi - h;
+
+    if (status.repr == wuffs_base__suspension__short_write) {
+      if (pos + window_len > have.data.len) {
+        RETURN_FAIL("pos=%zu: not enough room", pos);
+      }
+      continue;
+    } else if (provide_history) {
+      CHECK_STATUS("transform_io", status);
+      break;
+    } else if (status.repr != wuffs_deflate__error__bad_distance) {
+      RETURN_FAIL("transform_io: have \"%s\", want \"%s\"", status.repr,
+                  wuffs_deflate__error__bad_distance);
+    }
+    return NULL;
+  }
+
+  if (dec.private_impl.f_history_index != 0) {
+    RETURN_FAIL("history_index: have 0x%04" PRIX32 ", want 0",
+                dec.private_impl.f_history_index);
+  }
+  have.meta.wi = pos;
+  return check_io_buffers_equal("", &have, &want);
+}
+
+const char*  //
+test_wuffs_deflate_dst_holds_history_missing() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_deflate_dst_holds_history(false);
+}
+
+const char*  //
+test_wuffs_deflate_dst_holds_history_provided() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_deflate_dst_holds_history(true);
+}
+
+const char*  //
+test_wuffs_deflate_encode_256_bytes() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_deflate_encode_round_trip(
+      "test/data/artificial/256.bytes", WUFFS_DEFLATE__ENCODER_LEVEL_BEST,
+      UINT64_MAX, UINT64_MAX);
+}
+
+const char*  //
+test_wuffs_deflate_encode_empty() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_deflate_encode_round_trip(
+      NULL, WUFFS_DEFLATE__ENCODER_LEVEL_BALANCED, UINT64_MAX, UINT64_MAX);
+}
+
+const char*  //
+test_wuffs_deflate_encode_interface() {
+  CHECK_FOCUS(__func__);
+  wuffs_deflate__encoder enc;
+  CHECK_STATUS("initialize",
+               wuffs_deflate__encoder__initialize(
+                   &enc, sizeof enc, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_base__io_transformer* t =
+      wuffs_deflate__encoder__upcast_as__wuffs_base__io_transformer(&enc);
+  wuffs_base__range_ii_u64 have = wuffs_base__io_transformer__workbuf_len(t);
+  if ((have.min_incl !=
+       WUFFS_DEFLATE__ENCODER_WORKBUF_LEN_MAX_INCL_WORST_CASE) ||
+      (have.max_incl !=
+       WUFFS_DEFLATE__ENCODER_WORKBUF_LEN_MAX_INCL_WORST_CASE)) {
+    RETURN_FAIL("workbuf_len: have [%" PRIu64 " ..= %" PRIu64 "]",
+                have.min_incl, have.max_incl);
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_deflate_encode_levels() {
+  CHECK_FOCUS(__func__);
+  uint32_t level;
+  for (level = 0; level <= 10; level++) {
+    CHECK_STRING(do_test_wuffs_deflate_encode_round_trip(
+        "test/data/midsummer.txt", level, UINT64_MAX, UINT64_MAX));
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_deflate_encode_pi_many_small_writes_reads() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_deflate_encode_round_trip(
+      "test/data/pi.txt", WUFFS_DEFLATE__ENCODER_LEVEL_BALANCED, 61, 59);
+}
+
+const char*  //
+test_wuffs_deflate_encode_pi_stored() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_deflate_encode_round_trip(
+      "test/data/pi.txt", WUFFS_DEFLATE__ENCODER_LEVEL_NONE, 4096, UINT64_MAX);
+}
+
 const char*  //
 test_wuffs_deflate_history_full() {
   CHECK_FOCUS(__func__);
@@ -727,6 +1213,14 @@ test_mimic_deflate_decode_deflate_backref_crosses_blocks() {
                             UINT64_MAX, UINT64_MAX);
 }
 
+const char*  //
+test_mimic_deflate_decode_deflate_degenerate_huffman_distance() {
+  CHECK_FOCUS(__func__);
+  return do_test_io_buffers(mimic_deflate_decode,
+                            &g_deflate_deflate_degenerate_huffman_distance_gt,
+                            UINT64_MAX, UINT64_MAX);
+}
+
 const char*  //
 test_mimic_deflate_decode_deflate_degenerate_huffman_unused() {
   CHECK_FOCUS(__func__);
@@ -800,6 +1294,38 @@ test_mimic_deflate_decode_romeo_fixed() {
                             UINT64_MAX, UINT64_MAX);
 }
 
+const char*  //
+test_mimic_deflate_decode_wuffs_encoded() {
+  CHECK_FOCUS(__func__);
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  wuffs_base__io_buffer encoded = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  wuffs_base__io_buffer decoded = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+
+  CHECK_STRING(read_file(&src, "test/data/pi.txt"));
+  uint32_t level;
+  for (level = 0; level <= 9; level++) {
+    src.meta.ri = 0;
+    encoded.meta.ri = 0;
+    encoded.meta.wi = 0;
+    encoded.meta.closed = false;
+    decoded.meta.wi = 0;
+    CHECK_STRING(do_wuffs_deflate_encode(
+        &encoded, &src, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+        UINT64_MAX, UINT64_MAX, level));
+    encoded.meta.closed = true;
+    CHECK_STRING(
+        mimic_deflate_decode(&decoded, &encoded, 0, UINT64_MAX, UINT64_MAX));
+    CHECK_STRING(check_io_buffers_equal("", &decoded, &src));
+  }
+  return NULL;
+}
+
 #endif  // WUFFS_MIMIC
 
 // ---------------- Deflate Benches
@@ -856,6 +1382,51 @@ bench_wuffs_deflate_decode_100k_many_big_reads() {
       &g_deflate_pi_gt, UINT64_MAX, 4096, 30);
 }
 
+const char*  //
+bench_wuffs_deflate_decode_100k_many_medium_reads() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_deflate_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_dst,
+      &g_deflate_pi_gt, UINT64_MAX, 599, 30);
+}
+
+const char*  //
+bench_wuffs_deflate_encode_10k_level_fast() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_deflate_encode_level_fast,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_deflate_encode_midsummer_gt, UINT64_MAX, UINT64_MAX, 30);
+}
+
+const char*  //
+bench_wuffs_deflate_encode_10k_level_balanced() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_deflate_encode_level_balanced,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_deflate_encode_midsummer_gt, UINT64_MAX, UINT64_MAX, 30);
+}
+
+const char*  //
+bench_wuffs_deflate_encode_100k_level_fast() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_deflate_encode_level_fast,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_deflate_encode_pi_gt, UINT64_MAX, UINT64_MAX, 3);
+}
+
+const char*  //
+bench_wuffs_deflate_encode_100k_level_balanced() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_deflate_encode_level_balanced,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_deflate_encode_pi_gt, UINT64_MAX, UINT64_MAX, 3);
+}
+
   // ---------------- Mimic Benches
 
 #ifdef WUFFS_MIMIC
@@ -889,6 +1460,45 @@ bench_mimic_deflate_decode_100k_many_big_reads() {
                              &g_deflate_pi_gt, UINT64_MAX, 4096, 30);
 }
 
+const char*  //
+bench_mimic_deflate_decode_100k_many_medium_reads() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(mimic_deflate_decode, 0, tcounter_dst,
+                             &g_deflate_pi_gt, UINT64_MAX, 599, 30);
+}
+
+const char*  //
+bench_mimic_deflate_encode_10k_level_fast() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(mimic_deflate_encode_level_fast, 0, tcounter_src,
+                             &g_deflate_encode_midsummer_gt, UINT64_MAX,
+                             UINT64_MAX, 30);
+}
+
+const char*  //
+bench_mimic_deflate_encode_10k_level_balanced() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(mimic_deflate_encode_level_balanced, 0,
+                             tcounter_src, &g_deflate_encode_midsummer_gt,
+                             UINT64_MAX, UINT64_MAX, 30);
+}
+
+const char*  //
+bench_mimic_deflate_encode_100k_level_fast() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(mimic_deflate_encode_level_fast, 0, tcounter_src,
+                             &g_deflate_encode_pi_gt, UINT64_MAX, UINT64_MAX,
+                             3);
+}
+
+const char*  //
+bench_mimic_deflate_encode_100k_level_balanced() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(mimic_deflate_encode_level_balanced, 0,
+                             tcounter_src, &g_deflate_encode_pi_gt, UINT64_MAX,
+                             UINT64_MAX, 3);
+}
+
 #endif  // WUFFS_MIMIC
 
 // ---------------- Manifest
@@ -896,7 +1506,9 @@ bench_mimic_deflate_decode_100k_many_big_reads() {
 proc g_tests[] = {
 
     test_wuffs_deflate_decode_256_bytes,
+    test_wuffs_deflate_decode_block_boundaries,
     test_wuffs_deflate_decode_deflate_backref_crosses_blocks,
+    test_wuffs_deflate_decode_deflate_degenerate_huffman_distance,
     test_wuffs_deflate_decode_deflate_degenerate_huffman_unused,
     test_wuffs_deflate_decode_deflate_distance_32768,
     test_wuffs_deflate_decode_deflate_distance_code_31,
@@ -909,7 +1521,19 @@ proc g_tests[] = {
     test_wuffs_deflate_decode_pi_many_small_writes_reads,
     test_wuffs_deflate_decode_romeo,
     test_wuffs_deflate_decode_romeo_fixed,
+    test_wuffs_deflate_decode_short_distances,
     test_wuffs_deflate_decode_split_src,
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+    test_wuffs_deflate_decode_stats,
+#endif
+    test_wuffs_deflate_dst_holds_history_missing,
+    test_wuffs_deflate_dst_holds_history_provided,
+    test_wuffs_deflate_encode_256_bytes,
+    test_wuffs_deflate_encode_empty,
+    test_wuffs_deflate_encode_interface,
+    test_wuffs_deflate_encode_levels,
+    test_wuffs_deflate_encode_pi_many_small_writes_reads,
+    test_wuffs_deflate_encode_pi_stored,
     test_wuffs_deflate_history_full,
     test_wuffs_deflate_history_partial,
     test_wuffs_deflate_table_redirect,
@@ -918,6 +1542,7 @@ proc g_tests[] = {
 
     test_mimic_deflate_decode_256_bytes,
     test_mimic_deflate_decode_deflate_backref_crosses_blocks,
+    test_mimic_deflate_decode_deflate_degenerate_huffman_distance,
     test_mimic_deflate_decode_deflate_degenerate_huffman_unused,
     test_mimic_deflate_decode_deflate_distance_32768,
     test_mimic_deflate_decode_deflate_distance_code_31,
@@ -927,6 +1552,7 @@ proc g_tests[] = {
     test_mimic_deflate_decode_pi_many_big_reads,
     test_mimic_deflate_decode_romeo,
     test_mimic_deflate_decode_romeo_fixed,
+    test_mimic_deflate_decode_wuffs_encoded,
 
 #endif  // WUFFS_MIMIC
 
@@ -941,6 +1567,11 @@ proc g_benches[] = {
     bench_wuffs_deflate_decode_10k_part_init,
     bench_wuffs_deflate_decode_100k_just_one_read,
     bench_wuffs_deflate_decode_100k_many_big_reads,
+    bench_wuffs_deflate_decode_100k_many_medium_reads,
+    bench_wuffs_deflate_encode_10k_level_fast,
+    bench_wuffs_deflate_encode_10k_level_balanced,
+    bench_wuffs_deflate_encode_100k_level_fast,
+    bench_wuffs_deflate_encode_100k_level_balanced,
 
 #ifdef WUFFS_MIMIC
 
@@ -948,6 +1579,11 @@ proc g_benches[] = {
     bench_mimic_deflate_decode_10k,
     bench_mimic_deflate_decode_100k_just_one_read,
     bench_mimic_deflate_decode_100k_many_big_reads,
+    bench_mimic_deflate_decode_100k_many_medium_reads,
+    bench_mimic_deflate_encode_10k_level_fast,
+    bench_mimic_deflate_encode_10k_level_balanced,
+    bench_mimic_deflate_encode_100k_level_fast,
+    bench_mimic_deflate_encode_100k_level_balanced,
 
 #endif  // WUFFS_MIMIC
 
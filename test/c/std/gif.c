@@ -898,6 +898,204 @@ test_wuffs_gif_decode_first_frame_is_opaque() {
   return NULL;
 }
 
+const char*  //
+test_wuffs_gif_decode_frame_banded() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/animated-red-blue.gif",
+      "test/data/artificial/gif-frame-out-of-bounds.gif",
+      "test/data/bricks-dither.gif",
+      "test/data/harvesters.gif",
+      "test/data/hat.gif",
+      "test/data/hippopotamus.regular.gif",
+  };
+  const wuffs_base__rect_ie_u32 crops[] = {
+      {0, 0, 0, 0},
+      {3, 5, 40, 30},
+  };
+  const uint32_t band_heights[] = {1, 7, 100000};
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    int c;
+    for (c = 0; c < WUFFS_TESTLIB_ARRAY_SIZE(crops); c++) {
+      uint32_t scale_shift;
+      for (scale_shift = 0; scale_shift <= 1; scale_shift++) {
+        int b;
+        for (b = 0; b < WUFFS_TESTLIB_ARRAY_SIZE(band_heights); b++) {
+          int r;
+          for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+            wuffs_gif__decoder full;
+            CHECK_STATUS(
+                "initialize (full)",
+                wuffs_gif__decoder__initialize(
+                    &full, sizeof full, WUFFS_VERSION,
+                    WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+            wuffs_gif__decoder banded;
+            CHECK_STATUS(
+                "initialize (banded)",
+                wuffs_gif__decoder__initialize(
+                    &banded, sizeof banded, WUFFS_VERSION,
+                    WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+            wuffs_base__decode_frame_options opts =
+                wuffs_base__null_decode_frame_options();
+            wuffs_base__decode_frame_options__set_scale_shift(&opts,
+                                                              scale_shift);
+            wuffs_base__decode_frame_options__set_crop_rect(&opts, crops[c]);
+            wuffs_base__decode_frame_options__set_band_height(&opts,
+                                                              band_heights[b]);
+            const char* z = do_test__wuffs_base__image_decoder_banded(
+                wuffs_gif__decoder__upcast_as__wuffs_base__image_decoder(&full),
+                wuffs_gif__decoder__upcast_as__wuffs_base__image_decoder(
+                    &banded),
+                filenames[i], &opts, rlimits[r]);
+            if (z) {
+              RETURN_FAIL("%s, c=%d, scale_shift=%" PRIu32 ", b=%d, r=%d: %s",
+                          filenames[i], c, scale_shift, b, r, z);
+            }
+          }
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_gif_decode_frame_banded_interlaced() {
+  CHECK_FOCUS(__func__);
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hippopotamus.interlaced.gif"));
+
+  wuffs_gif__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_gif__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_base__image_config ic = ((wuffs_base__image_config){});
+  CHECK_STATUS("decode_image_config",
+               wuffs_gif__decoder__decode_image_config(&dec, &ic, &src));
+  wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+  CHECK_STATUS("set_from_slice", wuffs_base__pixel_buffer__set_from_slice(
+                                     &pb, &ic.pixcfg, g_pixel_slice_u8));
+
+  // Interlaced frames do not support banding.
+  wuffs_base__decode_frame_options opts =
+      wuffs_base__null_decode_frame_options();
+  wuffs_base__decode_frame_options__set_band_height(&opts, 16);
+  wuffs_base__status status = wuffs_gif__decoder__decode_frame(
+      &dec, &pb, &src, WUFFS_BASE__PIXEL_BLEND__SRC, g_work_slice_u8, &opts);
+  if (status.repr != wuffs_base__error__unsupported_option) {
+    RETURN_FAIL("decode_frame: have \"%s\", want \"%s\"", status.repr,
+                wuffs_base__error__unsupported_option);
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_gif_decode_frame_cropped() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/bricks-dither.gif",
+      "test/data/hat.gif",
+      "test/data/hippopotamus.interlaced.gif",
+      "test/data/muybridge.gif",
+  };
+  const wuffs_base__rect_ie_u32 crops[] = {
+      {0, 0, 1, 1},
+      {3, 5, 40, 30},
+      {9, 0, 10, 100000},
+      {17, 2, 100000, 31},
+      {100000, 100000, 100001, 100001},
+  };
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    int c;
+    for (c = 0; c < WUFFS_TESTLIB_ARRAY_SIZE(crops); c++) {
+      uint32_t scale_shift;
+      for (scale_shift = 0; scale_shift <= 1; scale_shift++) {
+        int r;
+        for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+          wuffs_gif__decoder full;
+          CHECK_STATUS(
+              "initialize (full)",
+              wuffs_gif__decoder__initialize(
+                  &full, sizeof full, WUFFS_VERSION,
+                  WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+          wuffs_gif__decoder cropped;
+          CHECK_STATUS(
+              "initialize (cropped)",
+              wuffs_gif__decoder__initialize(
+                  &cropped, sizeof cropped, WUFFS_VERSION,
+                  WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+          wuffs_base__decode_frame_options opts =
+              wuffs_base__null_decode_frame_options();
+          wuffs_base__decode_frame_options__set_scale_shift(&opts, scale_shift);
+          wuffs_base__decode_frame_options__set_crop_rect(&opts, crops[c]);
+          const char* z = do_test__wuffs_base__image_decoder_scaled(
+              wuffs_gif__decoder__upcast_as__wuffs_base__image_decoder(&full),
+              wuffs_gif__decoder__upcast_as__wuffs_base__image_decoder(
+                  &cropped),
+              filenames[i], &opts, rlimits[r]);
+          if (z) {
+            RETURN_FAIL("%s, c=%d, scale_shift=%" PRIu32 ", r=%d: %s",
+                        filenames[i], c, scale_shift, r, z);
+          }
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_gif_decode_frame_scaled() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/bricks-dither.gif",
+      "test/data/hat.gif",
+      "test/data/hippopotamus.interlaced.gif",
+      "test/data/muybridge.gif",
+  };
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    uint32_t scale_shift;
+    for (scale_shift = 1; scale_shift <= 3; scale_shift++) {
+      int r;
+      for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+        wuffs_gif__decoder full;
+        CHECK_STATUS(
+            "initialize (full)",
+            wuffs_gif__decoder__initialize(
+                &full, sizeof full, WUFFS_VERSION,
+                WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+        wuffs_gif__decoder scaled;
+        CHECK_STATUS(
+            "initialize (scaled)",
+            wuffs_gif__decoder__initialize(
+                &scaled, sizeof scaled, WUFFS_VERSION,
+                WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+        wuffs_base__decode_frame_options opts =
+            wuffs_base__null_decode_frame_options();
+        wuffs_base__decode_frame_options__set_scale_shift(&opts, scale_shift);
+        const char* z = do_test__wuffs_base__image_decoder_scaled(
+            wuffs_gif__decoder__upcast_as__wuffs_base__image_decoder(&full),
+            wuffs_gif__decoder__upcast_as__wuffs_base__image_decoder(&scaled),
+            filenames[i], &opts, rlimits[r]);
+        if (z) {
+          RETURN_FAIL("%s, scale_shift=%" PRIu32 ", r=%d: %s", filenames[i],
+                      scale_shift, r, z);
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_gif_decode_frame_out_of_bounds() {
   CHECK_FOCUS(__func__);
@@ -1730,6 +1928,99 @@ test_wuffs_gif_frame_dirty_rect() {
   return NULL;
 }
 
+const char*  //
+do_test_wuffs_gif_frame_dirty_rect_persistent_canvas(const char* filename) {
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, filename));
+
+  wuffs_gif__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_gif__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_base__image_config ic = ((wuffs_base__image_config){});
+  CHECK_STATUS("decode_image_config",
+               wuffs_gif__decoder__decode_image_config(&dec, &ic, &src));
+  uint32_t width = wuffs_base__pixel_config__width(&ic.pixcfg);
+  uint32_t height = wuffs_base__pixel_config__height(&ic.pixcfg);
+  wuffs_base__pixel_config__set(
+      &ic.pixcfg, WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+      WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, width, height);
+  uint64_t n = wuffs_base__pixel_config__pixbuf_len(&ic.pixcfg);
+  if ((n > g_pixel_slice_u8.len) || (n > g_want_slice_u8.len)) {
+    RETURN_FAIL("image is too large");
+  }
+
+  // Start with a canvas that no GIF frame would produce.
+  size_t i;
+  for (i = 0; i < n; i++) {
+    g_pixel_slice_u8.ptr[i] = (uint8_t)(0x40 + (i % 0x7F));
+  }
+  wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+  CHECK_STATUS(
+      "set_from_slice",
+      wuffs_base__pixel_buffer__set_from_slice(
+          &pb, &ic.pixcfg, wuffs_base__make_slice_u8(g_pixel_slice_u8.ptr, n)));
+
+  // Decoding onto the (persistent) canvas should leave every pixel outside of
+  // the frame_dirty_rect unchanged.
+  int num_frames = 0;
+  while (true) {
+    wuffs_base__status status =
+        wuffs_gif__decoder__decode_frame_config(&dec, NULL, &src);
+    if (status.repr == wuffs_base__note__end_of_data) {
+      break;
+    } else if (!wuffs_base__status__is_ok(&status)) {
+      RETURN_FAIL("decode_frame_config #%d: \"%s\"", num_frames, status.repr);
+    }
+
+    memcpy(g_want_slice_u8.ptr, g_pixel_slice_u8.ptr, n);
+    status = wuffs_gif__decoder__decode_frame(&dec, &pb, &src,
+                                              WUFFS_BASE__PIXEL_BLEND__SRC_OVER,
+                                              g_work_slice_u8, NULL);
+    if (!wuffs_base__status__is_ok(&status)) {
+      RETURN_FAIL("decode_frame #%d: \"%s\"", num_frames, status.repr);
+    }
+
+    wuffs_base__rect_ie_u32 r = wuffs_gif__decoder__frame_dirty_rect(&dec);
+    uint32_t y;
+    for (y = 0; y < height; y++) {
+      uint32_t x;
+      for (x = 0; x < width; x++) {
+        if (wuffs_base__rect_ie_u32__contains(&r, x, y)) {
+          continue;
+        }
+        size_t j = 4 * ((y * (size_t)width) + x);
+        if (memcmp(g_pixel_slice_u8.ptr + j, g_want_slice_u8.ptr + j, 4)) {
+          RETURN_FAIL("frame #%d: pixel (%" PRIu32 ", %" PRIu32
+                      ") outside of the dirty rect was modified",
+                      num_frames, x, y);
+        }
+      }
+    }
+    num_frames++;
+  }
+
+  if (num_frames == 0) {
+    RETURN_FAIL("no frames");
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_gif_frame_dirty_rect_persistent_canvas() {
+  CHECK_FOCUS(__func__);
+  CHECK_STRING(do_test_wuffs_gif_frame_dirty_rect_persistent_canvas(
+      "test/data/animated-red-blue.gif"));
+  CHECK_STRING(do_test_wuffs_gif_frame_dirty_rect_persistent_canvas(
+      "test/data/hippopotamus.masked-with-muybridge.gif"));
+  CHECK_STRING(do_test_wuffs_gif_frame_dirty_rect_persistent_canvas(
+      "test/data/muybridge.gif"));
+  return NULL;
+}
+
 const char*  //
 do_test_wuffs_gif_num_decoded(bool frame_config) {
   wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
@@ -1971,6 +2262,113 @@ test_wuffs_gif_io_position_two_chunks() {
   return do_test_wuffs_gif_io_position(true);
 }
 
+const char*  //
+test_wuffs_gif_restart_frame_random_access() {
+  CHECK_FOCUS(__func__);
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/animated-red-blue.gif"));
+
+  // Decode every frame serially, each onto its own transparent black pixel
+  // buffer, recording the frame configs as a frame index.
+  wuffs_gif__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_gif__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_base__image_config ic = ((wuffs_base__image_config){});
+  CHECK_STATUS("decode_image_config",
+               wuffs_gif__decoder__decode_image_config(&dec, &ic, &src));
+  uint32_t width = wuffs_base__pixel_config__width(&ic.pixcfg);
+  uint32_t height = wuffs_base__pixel_config__height(&ic.pixcfg);
+  wuffs_base__pixel_config__set(
+      &ic.pixcfg, WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+      WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, width, height);
+  uint64_t frame_len = wuffs_base__pixel_config__pixbuf_len(&ic.pixcfg);
+
+  wuffs_base__frame_config fcs[4];
+  int num_frames = 0;
+  while (true) {
+    if (((uint64_t)(num_frames + 1) * frame_len) > g_want_slice_u8.len) {
+      RETURN_FAIL("want buffer is too small");
+    }
+    wuffs_base__frame_config fc = ((wuffs_base__frame_config){});
+    wuffs_base__status status =
+        wuffs_gif__decoder__decode_frame_config(&dec, &fc, &src);
+    if (status.repr == wuffs_base__note__end_of_data) {
+      break;
+    } else if (!wuffs_base__status__is_ok(&status)) {
+      RETURN_FAIL("decode_frame_config #%d: \"%s\"", num_frames, status.repr);
+    } else if (num_frames >= WUFFS_TESTLIB_ARRAY_SIZE(fcs)) {
+      RETURN_FAIL("too many frames");
+    }
+    fcs[num_frames] = fc;
+
+    wuffs_base__slice_u8 pixels = wuffs_base__make_slice_u8(
+        g_want_slice_u8.ptr + (num_frames * frame_len), frame_len);
+    memset(pixels.ptr, 0, pixels.len);
+    wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+    CHECK_STATUS("set_from_slice", wuffs_base__pixel_buffer__set_from_slice(
+                                       &pb, &ic.pixcfg, pixels));
+    status = wuffs_gif__decoder__decode_frame(
+        &dec, &pb, &src, WUFFS_BASE__PIXEL_BLEND__SRC, g_work_slice_u8, NULL);
+    if (!wuffs_base__status__is_ok(&status)) {
+      RETURN_FAIL("decode_frame #%d: \"%s\"", num_frames, status.repr);
+    }
+    num_frames++;
+  }
+  if (num_frames != WUFFS_TESTLIB_ARRAY_SIZE(fcs)) {
+    RETURN_FAIL("num_frames: have %d, want %d", num_frames,
+                (int)(WUFFS_TESTLIB_ARRAY_SIZE(fcs)));
+  }
+
+  // Decode the frames again, in reverse order, each on a separate decoder.
+  // Each decoder only needs the image config (which it reads from the start
+  // of the src) and that frame's entry in the frame index.
+  int i;
+  for (i = num_frames - 1; i >= 0; i--) {
+    CHECK_STATUS("initialize",
+                 wuffs_gif__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    src.meta.ri = 0;
+    CHECK_STATUS("decode_image_config",
+                 wuffs_gif__decoder__decode_image_config(&dec, NULL, &src));
+
+    uint64_t pos = wuffs_base__frame_config__io_position(&fcs[i]);
+    CHECK_STATUS("restart_frame",
+                 wuffs_gif__decoder__restart_frame(&dec, (uint64_t)i, pos));
+    src.meta.ri = pos;
+
+    wuffs_base__frame_config fc = ((wuffs_base__frame_config){});
+    CHECK_STATUS("decode_frame_config",
+                 wuffs_gif__decoder__decode_frame_config(&dec, &fc, &src));
+    if (wuffs_base__frame_config__index(&fc) != (uint64_t)i) {
+      RETURN_FAIL("index #%d: have %" PRIu64, i,
+                  wuffs_base__frame_config__index(&fc));
+    } else if (wuffs_base__frame_config__disposal(&fc) !=
+               wuffs_base__frame_config__disposal(&fcs[i])) {
+      RETURN_FAIL("disposal #%d: differs from serial decoding", i);
+    }
+
+    wuffs_base__slice_u8 pixels =
+        wuffs_base__make_slice_u8(g_have_slice_u8.ptr, frame_len);
+    memset(pixels.ptr, 0, pixels.len);
+    wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+    CHECK_STATUS("set_from_slice", wuffs_base__pixel_buffer__set_from_slice(
+                                       &pb, &ic.pixcfg, pixels));
+    CHECK_STATUS("decode_frame",
+                 wuffs_gif__decoder__decode_frame(&dec, &pb, &src,
+                                                  WUFFS_BASE__PIXEL_BLEND__SRC,
+                                                  g_work_slice_u8, NULL));
+    if (memcmp(pixels.ptr, g_want_slice_u8.ptr + (i * frame_len), frame_len)) {
+      RETURN_FAIL("pixels #%d: differ from serial decoding", i);
+    }
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_gif_small_frame_interlaced() {
   CHECK_FOCUS(__func__);
@@ -2422,7 +2820,11 @@ proc g_tests[] = {
     test_wuffs_gif_decode_delay_num_frames_decoded,
     test_wuffs_gif_decode_empty_palette,
     test_wuffs_gif_decode_first_frame_is_opaque,
+    test_wuffs_gif_decode_frame_banded,
+    test_wuffs_gif_decode_frame_banded_interlaced,
+    test_wuffs_gif_decode_frame_cropped,
     test_wuffs_gif_decode_frame_out_of_bounds,
+    test_wuffs_gif_decode_frame_scaled,
     test_wuffs_gif_decode_input_is_a_gif_just_one_read,
     test_wuffs_gif_decode_input_is_a_gif_many_big_reads,
     test_wuffs_gif_decode_input_is_a_gif_many_medium_reads,
@@ -2448,10 +2850,12 @@ proc g_tests[] = {
     test_wuffs_gif_decode_pixfmt_rgba_nonpremul,
     test_wuffs_gif_decode_zero_width_frame,
     test_wuffs_gif_frame_dirty_rect,
+    test_wuffs_gif_frame_dirty_rect_persistent_canvas,
     test_wuffs_gif_num_decoded_frame_configs,
     test_wuffs_gif_num_decoded_frames,
     test_wuffs_gif_io_position_one_chunk,
     test_wuffs_gif_io_position_two_chunks,
+    test_wuffs_gif_restart_frame_random_access,
     test_wuffs_gif_small_frame_interlaced,
     test_wuffs_gif_sizeof,
 
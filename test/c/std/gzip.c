@@ -127,6 +127,69 @@ wuffs_gzip_decode(wuffs_base__io_buffer* dst,
   }
 }
 
+const char*  //
+do_wuffs_gzip_encode(wuffs_base__io_buffer* dst,
+                     wuffs_base__io_buffer* src,
+                     uint64_t wlimit,
+                     uint64_t rlimit,
+                     uint32_t level) {
+  wuffs_gzip__encoder enc;
+  CHECK_STATUS("initialize",
+               wuffs_gzip__encoder__initialize(
+                   &enc, sizeof enc, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_gzip__encoder__set_level(&enc, level);
+
+  while (true) {
+    wuffs_base__io_buffer limited_dst = make_limited_writer(*dst, wlimit);
+    wuffs_base__io_buffer limited_src = make_limited_reader(*src, rlimit);
+
+    wuffs_base__status status = wuffs_gzip__encoder__transform_io(
+        &enc, &limited_dst, &limited_src, g_work_slice_u8);
+
+    dst->meta.wi += limited_dst.meta.wi;
+    src->meta.ri += limited_src.meta.ri;
+
+    if (((wlimit < UINT64_MAX) &&
+         (status.repr == wuffs_base__suspension__short_write)) ||
+        ((rlimit < UINT64_MAX) &&
+         (status.repr == wuffs_base__suspension__short_read))) {
+      continue;
+    }
+    return status.repr;
+  }
+}
+
+const char*  //
+do_test_wuffs_gzip_encode_round_trip(
+    const char* (*decode_func)(wuffs_base__io_buffer*,
+                               wuffs_base__io_buffer*,
+                               uint32_t,
+                               uint64_t,
+                               uint64_t),
+    uint32_t level,
+    uint64_t wlimit,
+    uint64_t rlimit) {
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  wuffs_base__io_buffer encoded = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  wuffs_base__io_buffer decoded = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+
+  CHECK_STRING(read_file(&src, g_gzip_midsummer_gt.want_filename));
+  CHECK_STRING(do_wuffs_gzip_encode(&encoded, &src, wlimit, rlimit, level));
+  encoded.meta.closed = true;
+  CHECK_STRING(
+      decode_func(&decoded, &encoded,
+                  WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+                  UINT64_MAX, UINT64_MAX));
+  return check_io_buffers_equal("", &decoded, &src);
+}
+
 const char*  //
 do_test_wuffs_gzip_checksum(bool ignore_checksum, uint32_t bad_checksum) {
   wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
@@ -215,6 +278,29 @@ test_wuffs_gzip_checksum_verify_good() {
   return do_test_wuffs_gzip_checksum(false, 0);
 }
 
+const char*  //
+test_wuffs_gzip_encode_level_best() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_gzip_encode_round_trip(wuffs_gzip_decode,
+                                              WUFFS_DEFLATE__ENCODER_LEVEL_BEST,
+                                              UINT64_MAX, UINT64_MAX);
+}
+
+const char*  //
+test_wuffs_gzip_encode_level_none() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_gzip_encode_round_trip(wuffs_gzip_decode,
+                                              WUFFS_DEFLATE__ENCODER_LEVEL_NONE,
+                                              UINT64_MAX, UINT64_MAX);
+}
+
+const char*  //
+test_wuffs_gzip_encode_many_small_writes_reads() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_gzip_encode_round_trip(
+      wuffs_gzip_decode, WUFFS_DEFLATE__ENCODER_LEVEL_BALANCED, 3, 5);
+}
+
 const char*  //
 test_wuffs_gzip_decode_midsummer() {
   CHECK_FOCUS(__func__);
@@ -222,6 +308,98 @@ test_wuffs_gzip_decode_midsummer() {
                             UINT64_MAX);
 }
 
+const char*  //
+do_test_wuffs_gzip_decode_multiple_members(bool quirk,
+                                           bool trailing_garbage,
+                                           uint64_t rlimit) {
+  wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  wuffs_base__io_buffer want = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+
+  // Concatenate two gzip members, optionally followed by something that
+  // isn't a gzip member.
+  //
+  // read_file closes its dst buffer, so re-open it before appending to it.
+  CHECK_STRING(read_file(&src, g_gzip_midsummer_gt.src_filename));
+  uint64_t first_member_length = src.meta.wi;
+  src.meta.closed = false;
+  CHECK_STRING(read_file(&src, g_gzip_pi_gt.src_filename));
+  src.meta.closed = false;
+  if (trailing_garbage) {
+    if ((src.data.len - src.meta.wi) < 4) {
+      RETURN_FAIL("source buffer was too short");
+    }
+    memcpy(src.data.ptr + src.meta.wi, "abcd", 4);
+    src.meta.wi += 4;
+  }
+  src.meta.closed = true;
+
+  // Without the quirk, only the first member is decoded.
+  CHECK_STRING(read_file(&want, g_gzip_midsummer_gt.want_filename));
+  if (quirk) {
+    want.meta.closed = false;
+    CHECK_STRING(read_file(&want, g_gzip_pi_gt.want_filename));
+  }
+
+  wuffs_gzip__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_gzip__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_gzip__decoder__set_quirk_enabled(
+      &dec, WUFFS_GZIP__QUIRK_DECODE_MULTIPLE_MEMBERS, quirk);
+
+  const char* want_z =
+      (quirk && trailing_garbage) ? wuffs_gzip__error__bad_header : NULL;
+  while (true) {
+    wuffs_base__io_buffer limited_src = make_limited_reader(src, rlimit);
+    wuffs_base__status have_z = wuffs_gzip__decoder__transform_io(
+        &dec, &have, &limited_src, g_work_slice_u8);
+    src.meta.ri += limited_src.meta.ri;
+    if (have_z.repr == wuffs_base__suspension__short_read) {
+      continue;
+    } else if (have_z.repr != want_z) {
+      RETURN_FAIL("transform_io: have \"%s\", want \"%s\"", have_z.repr,
+                  want_z);
+    }
+    break;
+  }
+
+  if (!quirk && (src.meta.ri != first_member_length)) {
+    RETURN_FAIL("src.meta.ri: have %" PRIu64 ", want %" PRIu64, src.meta.ri,
+                first_member_length);
+  }
+  return check_io_buffers_equal("", &have, &want);
+}
+
+const char*  //
+test_wuffs_gzip_decode_multiple_members_quirk_off() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_gzip_decode_multiple_members(false, false, UINT64_MAX);
+}
+
+const char*  //
+test_wuffs_gzip_decode_multiple_members_quirk_on() {
+  CHECK_FOCUS(__func__);
+  CHECK_STRING(
+      do_test_wuffs_gzip_decode_multiple_members(true, false, UINT64_MAX));
+  return do_test_wuffs_gzip_decode_multiple_members(true, false, 7);
+}
+
+const char*  //
+test_wuffs_gzip_decode_multiple_members_trailing_garbage() {
+  CHECK_FOCUS(__func__);
+  CHECK_STRING(
+      do_test_wuffs_gzip_decode_multiple_members(false, true, UINT64_MAX));
+  return do_test_wuffs_gzip_decode_multiple_members(true, true, UINT64_MAX);
+}
+
 const char*  //
 test_wuffs_gzip_decode_pi() {
   CHECK_FOCUS(__func__);
@@ -233,6 +411,14 @@ test_wuffs_gzip_decode_pi() {
 
 #ifdef WUFFS_MIMIC
 
+const char*  //
+test_mimic_gzip_decode_wuffs_encoded() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_gzip_encode_round_trip(
+      mimic_gzip_decode, WUFFS_DEFLATE__ENCODER_LEVEL_BALANCED, UINT64_MAX,
+      UINT64_MAX);
+}
+
 const char*  //
 test_mimic_gzip_decode_midsummer() {
   CHECK_FOCUS(__func__);
@@ -267,6 +453,14 @@ bench_wuffs_gzip_decode_100k() {
       tcounter_dst, &g_gzip_pi_gt, UINT64_MAX, UINT64_MAX, 30);
 }
 
+const char*  //
+bench_wuffs_gzip_decode_100k_many_big_reads() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_gzip_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      tcounter_dst, &g_gzip_pi_gt, UINT64_MAX, 4096, 30);
+}
+
   // ---------------- Mimic Benches
 
 #ifdef WUFFS_MIMIC
@@ -285,6 +479,13 @@ bench_mimic_gzip_decode_100k() {
                              UINT64_MAX, UINT64_MAX, 30);
 }
 
+const char*  //
+bench_mimic_gzip_decode_100k_many_big_reads() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(mimic_gzip_decode, 0, tcounter_dst, &g_gzip_pi_gt,
+                             UINT64_MAX, 4096, 30);
+}
+
 #endif  // WUFFS_MIMIC
 
 // ---------------- Manifest
@@ -300,12 +501,19 @@ proc g_tests[] = {
     test_wuffs_gzip_checksum_verify_good,
     test_wuffs_gzip_decode_interface,
     test_wuffs_gzip_decode_midsummer,
+    test_wuffs_gzip_decode_multiple_members_quirk_off,
+    test_wuffs_gzip_decode_multiple_members_quirk_on,
+    test_wuffs_gzip_decode_multiple_members_trailing_garbage,
     test_wuffs_gzip_decode_pi,
+    test_wuffs_gzip_encode_level_best,
+    test_wuffs_gzip_encode_level_none,
+    test_wuffs_gzip_encode_many_small_writes_reads,
 
 #ifdef WUFFS_MIMIC
 
     test_mimic_gzip_decode_midsummer,
     test_mimic_gzip_decode_pi,
+    test_mimic_gzip_decode_wuffs_encoded,
 
 #endif  // WUFFS_MIMIC
 
@@ -316,11 +524,13 @@ proc g_benches[] = {
 
     bench_wuffs_gzip_decode_10k,
     bench_wuffs_gzip_decode_100k,
+    bench_wuffs_gzip_decode_100k_many_big_reads,
 
 #ifdef WUFFS_MIMIC
 
     bench_mimic_gzip_decode_10k,
     bench_mimic_gzip_decode_100k,
+    bench_mimic_gzip_decode_100k_many_big_reads,
 
 #endif  // WUFFS_MIMIC
 
@@ -546,6 +546,100 @@ test_wuffs_strconv_mpb_assign_from_hpd() {
   return NULL;
 }
 
+const char*  //
+test_wuffs_strconv_eisel_lemire() {
+  CHECK_FOCUS(__func__);
+
+  const int64_t fail = -1;
+
+  struct {
+    int64_t want;
+    uint64_t man;
+    int32_t exp10;
+  } test_cases[] = {
+      {.want = 0x3FF0000000000000, .man = 1, .exp10 = 0},
+      {.want = 0x3FB999999999999A, .man = 1, .exp10 = -1},
+      {.want = 0x400921F9F01B866E, .man = 314159, .exp10 = -5},
+      {.want = 0x4132D687CCCCCCCD, .man = 12345678, .exp10 = -1},
+      {.want = 0x4340000000000000, .man = 9007199254740992, .exp10 = 0},
+      {.want = 0x4340000000000002, .man = 9007199254740995, .exp10 = 0},
+      {.want = 0x43E158E460913D00, .man = 9999999999999999999u, .exp10 = 0},
+      {.want = 0x0031FA182C40C60D, .man = 1, .exp10 = -307},
+      {.want = 0x7BBA44DF832B8D46, .man = 1, .exp10 = +288},
+      {.want = 0x7FAC7B1F3CAC7433, .man = 9999999999999999999u, .exp10 = +288},
+
+      // (1 << 53) + 1 is exactly halfway between two f64 values.
+      {.want = fail, .man = 9007199254740993, .exp10 = 0},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    int64_t have =
+        wuffs_base__private_implementation__parse_number_f64_eisel_lemire(
+            test_cases[tc].man, test_cases[tc].exp10);
+    if (have < 0) {
+      have = fail;
+    }
+    if (have != test_cases[tc].want) {
+      RETURN_FAIL(
+          "%" PRIu64 "e%" PRId32 ": have 0x%" PRIX64 ", want 0x%" PRIX64,
+          test_cases[tc].man, test_cases[tc].exp10, have, test_cases[tc].want);
+    }
+  }
+
+  // Compare with the C standard library's strtod, for pseudo-random inputs.
+  // When Eisel-Lemire gives up, wuffs_base__parse_number_f64 falls back to
+  // slower algorithms, which should still agree with strtod.
+  uint64_t x = 0x123456789ABCDEF0;
+  uint32_t num_fails = 0;
+  int i;
+  for (i = 0; i < 100000; i++) {
+    // This is the xorshift64 pseudo-random number generator.
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    uint64_t man = x >> (x >> 58);
+    if (man >= 10000000000000000000u) {
+      man /= 10;
+    } else if (man == 0) {
+      man = 1;
+    }
+    int32_t exp10 = ((int32_t)((x & 0xFFFF) % (1 + 288 + 307))) - 307;
+
+    char buf[64];
+    int n = snprintf(buf, sizeof buf, "%" PRIu64 "e%" PRId32, man, exp10);
+    uint64_t want =
+        wuffs_base__ieee_754_bit_representation__from_f64(strtod(buf, NULL));
+
+    int64_t have_el =
+        wuffs_base__private_implementation__parse_number_f64_eisel_lemire(
+            man, exp10);
+    if (have_el < 0) {
+      num_fails++;
+    } else if (((uint64_t)have_el) != want) {
+      RETURN_FAIL("%s: eisel_lemire: have 0x%" PRIX64 ", want 0x%" PRIX64, buf,
+                  have_el, want);
+    }
+
+    wuffs_base__result_f64 r = wuffs_base__parse_number_f64(
+        wuffs_base__make_slice_u8((void*)buf, (size_t)n));
+    if (r.status.repr) {
+      RETURN_FAIL("%s: parse_number_f64: %s", buf, r.status.repr);
+    }
+    uint64_t have = wuffs_base__ieee_754_bit_representation__from_f64(r.value);
+    if (have != want) {
+      RETURN_FAIL("%s: parse_number_f64: have 0x%" PRIX64 ", want 0x%" PRIX64,
+                  buf, have, want);
+    }
+  }
+
+  // Giving up should be rare.
+  if (num_fails > 100) {
+    RETURN_FAIL("num_fails: have %" PRIu32 ", want <= 100", num_fails);
+  }
+  return NULL;
+}
+
 // ----------------
 
 const char*  //
@@ -614,6 +708,7 @@ test_wuffs_strconv_parse_number_f64() {
       {.want = 0x0000000000000001, .str = "4.9406564584124654e-324"},
       {.want = 0x000FFFFFFFFFFFFF, .str = "2.2250738585072009E-308"},
       {.want = 0x0010000000000000, .str = "2.2250738585072014E-308"},
+      {.want = 0x02D0DFC730000000, .str = "4.128247519743014e-295"},
       {.want = 0x369C314ABE948EB1,
        .str = "0.0000000000000000000000000000000000000000000012345678900000"},
       {.want = 0x3F88000000000000, .str = "0.01171875"},
@@ -664,6 +759,7 @@ test_wuffs_strconv_parse_number_f64() {
       {.want = 0x46293E5939A08CEA, .str = "1e30"},
       {.want = 0x54B249AD2594C37D, .str = "+1E+100"},
       {.want = 0x54B249AD2594C37D, .str = "+_1_E_+_1_0_0_"},
+      {.want = 0x7FC3248710DBA562, .str = "2.688490242153815e+307"},
       {.want = 0x7FEFFFFFFFFFFFFF, .str = "1.7976931348623157e308"},
       {.want = 0x7FF0000000000000, .str = "1.8e308"},
       {.want = 0x7FF0000000000000, .str = "1e+316"},
@@ -858,6 +954,357 @@ test_wuffs_strconv_parse_number_u64() {
   return NULL;
 }
 
+const char*  //
+test_wuffs_strconv_render_number_f64() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    uint64_t x;
+    uint32_t options;
+    const char* want;
+  } test_cases[] = {
+      {.x = 0x0000000000000000, .options = 0, .want = "0"},
+      {.x = 0x0000000000000001, .options = 0, .want = "5e-324"},
+      {.x = 0x0000000000000002, .options = 0, .want = "1e-323"},
+      {.x = 0x000FFFFFFFFFFFFF, .options = 0, .want = "2.225073858507201e-308"},
+      {.x = 0x0010000000000000,
+       .options = 0,
+       .want = "2.2250738585072014e-308"},
+      {.x = 0x02D0DFC730000000, .options = 0, .want = "4.128247519743014e-295"},
+      {.x = 0x3EB0C6F7A0B5ED8D, .options = 0, .want = "0.000001"},
+      {.x = 0x3E7AD7F29ABCAF48, .options = 0, .want = "1e-7"},
+      {.x = 0x3F50624DD2F1A9FC, .options = 0, .want = "0.001"},
+      {.x = 0x3FB999999999999A, .options = 0, .want = "0.1"},
+      {.x = 0x3FD3333333333333, .options = 0, .want = "0.3"},
+      {.x = 0x3FD3333333333334, .options = 0, .want = "0.30000000000000004"},
+      {.x = 0x3FEFFFFFFFFFFFFF, .options = 0, .want = "0.9999999999999999"},
+      {.x = 0x3FF0000000000000, .options = 0, .want = "1"},
+      {.x = 0x3FF0000000000001, .options = 0, .want = "1.0000000000000002"},
+      {.x = 0x3FF8000000000000, .options = 0, .want = "1.5"},
+      {.x = 0x3FF8000000000000,
+       .options = WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN,
+       .want = "+1.5"},
+      {.x = 0x400921FB54442D18, .options = 0, .want = "3.141592653589793"},
+      {.x = 0x4036000000000000, .options = 0, .want = "22"},
+      {.x = 0x40FE240C9FCB0C02, .options = 0, .want = "123456.789012"},
+      {.x = 0x4202A05F20000000, .options = 0, .want = "10000000000"},
+      {.x = 0x4340000000000000, .options = 0, .want = "9007199254740992"},
+      {.x = 0x4340000000000001, .options = 0, .want = "9007199254740994"},
+      {.x = 0x4415AF1D78B58C40, .options = 0, .want = "100000000000000000000"},
+      {.x = 0x444B1AE4D6E2EF50, .options = 0, .want = "1e+21"},
+      {.x = 0x44B52D02C7E14AF6, .options = 0, .want = "1e+23"},
+      {.x = 0x54B249AD2594C37D, .options = 0, .want = "1e+100"},
+      {.x = 0x7FEFFFFFFFFFFFFF,
+       .options = 0,
+       .want = "1.7976931348623157e+308"},
+      {.x = 0x7FF0000000000000, .options = 0, .want = "Infinity"},
+      {.x = 0x7FF0000000000000,
+       .options = WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN,
+       .want = "+Infinity"},
+      {.x = 0x7FF0000000000000,
+       .options = WUFFS_BASE__RENDER_NUMBER_FXX__INF_NAN_AS_NULL,
+       .want = "null"},
+      {.x = 0x7FFFFFFFFFFFFFFF, .options = 0, .want = "NaN"},
+      {.x = 0x7FFFFFFFFFFFFFFF,
+       .options = WUFFS_BASE__RENDER_NUMBER_FXX__INF_NAN_AS_NULL,
+       .want = "null"},
+      {.x = 0x8000000000000000, .options = 0, .want = "-0"},
+      {.x = 0x8000000000000000,
+       .options = WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN,
+       .want = "-0"},
+      {.x = 0x800FFFFFFFFFFFFF,
+       .options = 0,
+       .want = "-2.225073858507201e-308"},
+      {.x = 0xBEB0C6F7A0B5ED8D, .options = 0, .want = "-0.000001"},
+      {.x = 0xC008000000000000, .options = 0, .want = "-3"},
+      {.x = 0xFFEFFFFFFFFFFFFF,
+       .options = 0,
+       .want = "-1.7976931348623157e+308"},
+      {.x = 0xFFF0000000000000, .options = 0, .want = "-Infinity"},
+      {.x = 0xFFFFFFFFFFFFFFFF, .options = 0, .want = "NaN"},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    double x =
+        wuffs_base__ieee_754_bit_representation__to_f64(test_cases[tc].x);
+    uint8_t buf[WUFFS_BASE__F64__BYTE_LENGTH__MAX_INCL];
+    size_t want_len = strlen(test_cases[tc].want);
+
+    size_t have_len = wuffs_base__render_number_f64(
+        wuffs_base__make_slice_u8(buf, sizeof buf), x, test_cases[tc].options);
+    if ((have_len != want_len) || memcmp(buf, test_cases[tc].want, want_len)) {
+      RETURN_FAIL("0x%" PRIX64 ": have \"%.*s\", want \"%s\"", test_cases[tc].x,
+                  (int)(have_len), buf, test_cases[tc].want);
+    }
+
+    // A too-short dst should not be written to.
+    buf[0] = '#';
+    have_len = wuffs_base__render_number_f64(
+        wuffs_base__make_slice_u8(buf, want_len - 1), x,
+        test_cases[tc].options);
+    if ((have_len != 0) || (buf[0] != '#')) {
+      RETURN_FAIL("0x%" PRIX64 ": short dst: have %zu, want 0",
+                  test_cases[tc].x, have_len);
+    }
+  }
+
+  // Check that pseudo-random f64 values round-trip, with as few digits as the
+  // C standard library's "%.*e" needs to round-trip.
+  uint64_t x = 0x123456789ABCDEF0;
+  int i;
+  for (i = 0; i < 100000; i++) {
+    // This is the xorshift64 pseudo-random number generator.
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    if ((x & 0x7FF0000000000000) == 0x7FF0000000000000) {
+      continue;
+    }
+    double f = wuffs_base__ieee_754_bit_representation__to_f64(x);
+
+    uint8_t buf[WUFFS_BASE__F64__BYTE_LENGTH__MAX_INCL];
+    size_t n = wuffs_base__render_number_f64(
+        wuffs_base__make_slice_u8(buf, sizeof buf), f,
+        WUFFS_BASE__RENDER_NUMBER_XXX__DEFAULT_OPTIONS);
+    wuffs_base__result_f64 r =
+        wuffs_base__parse_number_f64(wuffs_base__make_slice_u8(buf, n));
+    if (r.status.repr ||
+        (wuffs_base__ieee_754_bit_representation__from_f64(r.value) != x)) {
+      RETURN_FAIL("0x%" PRIX64 ": \"%.*s\" did not round-trip", x, (int)(n),
+                  buf);
+    }
+
+    int have_digits = 0;
+    int have_trailing_zeroes = 0;
+    size_t j;
+    for (j = 0; (j < n) && (buf[j] != 'e'); j++) {
+      if ((buf[j] < '0') || ('9' < buf[j])) {
+        continue;
+      } else if (buf[j] != '0') {
+        have_digits += 1 + have_trailing_zeroes;
+        have_trailing_zeroes = 0;
+      } else if (have_digits > 0) {
+        have_trailing_zeroes++;
+      }
+    }
+
+    int want_digits;
+    for (want_digits = 1; want_digits < 17; want_digits++) {
+      char s[64];
+      snprintf(s, sizeof s, "%.*e", want_digits - 1, f);
+      if (strtod(s, NULL) == f) {
+        break;
+      }
+    }
+    if (have_digits != want_digits) {
+      RETURN_FAIL("0x%" PRIX64 ": \"%.*s\": have %d digits, want %d", x,
+                  (int)(n), buf, have_digits, want_digits);
+    }
+  }
+
+  return NULL;
+}
+
+const char*  //
+test_wuffs_strconv_render_number_i64() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    int64_t x;
+    uint32_t options;
+    const char* want;
+  } test_cases[] = {
+      {.x = +0x0000000000000000, .options = 0, .want = "0"},
+      {.x = +0x0000000000000000,
+       .options = WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN,
+       .want = "+0"},
+      {.x = +0x0000000000000009, .options = 0, .want = "9"},
+      {.x = +0x000000000000000A, .options = 0, .want = "10"},
+      {.x = +0x000000000000012C, .options = 0, .want = "300"},
+      {.x = +0x7FFFFFFFFFFFFFFF, .options = 0, .want = "9223372036854775807"},
+      {.x = +0x7FFFFFFFFFFFFFFF,
+       .options = WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN,
+       .want = "+9223372036854775807"},
+      {.x = -0x0000000000000002, .options = 0, .want = "-2"},
+      {.x = -0x0000000000000002,
+       .options = WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN,
+       .want = "-2"},
+      {.x = -0x00000000000000AB, .options = 0, .want = "-171"},
+      {.x = -0x7FFFFFFFFFFFFFFF, .options = 0, .want = "-9223372036854775807"},
+      {.x = -0x7FFFFFFFFFFFFFFF - 1,
+       .options = 0,
+       .want = "-9223372036854775808"},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    uint8_t buf[WUFFS_BASE__I64__BYTE_LENGTH__MAX_INCL];
+    size_t want_len = strlen(test_cases[tc].want);
+
+    size_t have_len = wuffs_base__render_number_i64(
+        wuffs_base__make_slice_u8(buf, sizeof buf), test_cases[tc].x,
+        test_cases[tc].options);
+    if ((have_len != want_len) || memcmp(buf, test_cases[tc].want, want_len)) {
+      RETURN_FAIL("%" PRId64 ": have \"%.*s\", want \"%s\"", test_cases[tc].x,
+                  (int)(have_len), buf, test_cases[tc].want);
+    }
+
+    have_len = wuffs_base__render_number_i64(
+        wuffs_base__make_slice_u8(buf, want_len - 1), test_cases[tc].x,
+        test_cases[tc].options);
+    if (have_len != 0) {
+      RETURN_FAIL("%" PRId64 ": short dst: have %zu, want 0", test_cases[tc].x,
+                  have_len);
+    }
+  }
+
+  return NULL;
+}
+
+const char*  //
+test_wuffs_strconv_render_number_u64() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    uint64_t x;
+    uint32_t options;
+    const char* want;
+  } test_cases[] = {
+      {.x = 0x0000000000000000, .options = 0, .want = "0"},
+      {.x = 0x0000000000000000,
+       .options = WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN,
+       .want = "+0"},
+      {.x = 0x0000000000000063, .options = 0, .want = "99"},
+      {.x = 0x0000000000000064, .options = 0, .want = "100"},
+      {.x = 0x000000000000007B, .options = 0, .want = "123"},
+      {.x = 0x00000000FFFFFFFF, .options = 0, .want = "4294967295"},
+      {.x = 0x0000000100000000, .options = 0, .want = "4294967296"},
+      {.x = 0x0123456789ABCDEF, .options = 0, .want = "81985529216486895"},
+      {.x = 0xFFFFFFFFFFFFFFFF, .options = 0, .want = "18446744073709551615"},
+      {.x = 0xFFFFFFFFFFFFFFFF,
+       .options = WUFFS_BASE__RENDER_NUMBER_XXX__LEADING_PLUS_SIGN,
+       .want = "+18446744073709551615"},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    uint8_t buf[WUFFS_BASE__U64__BYTE_LENGTH__MAX_INCL];
+    size_t want_len = strlen(test_cases[tc].want);
+
+    size_t have_len = wuffs_base__render_number_u64(
+        wuffs_base__make_slice_u8(buf, sizeof buf), test_cases[tc].x,
+        test_cases[tc].options);
+    if ((have_len != want_len) || memcmp(buf, test_cases[tc].want, want_len)) {
+      RETURN_FAIL("%" PRIu64 ": have \"%.*s\", want \"%s\"", test_cases[tc].x,
+                  (int)(have_len), buf, test_cases[tc].want);
+    }
+
+    have_len = wuffs_base__render_number_u64(
+        wuffs_base__make_slice_u8(buf, want_len - 1), test_cases[tc].x,
+        test_cases[tc].options);
+    if (have_len != 0) {
+      RETURN_FAIL("%" PRIu64 ": short dst: have %zu, want 0", test_cases[tc].x,
+                  have_len);
+    }
+  }
+
+  return NULL;
+}
+
+const char*  //
+test_wuffs_strconv_utf_8_longest_valid_prefix() {
+  CHECK_FOCUS(__func__);
+
+  // Build pseudo-random strings out of these pieces, so that the ASCII and
+  // multi-byte code points (and any invalid UTF-8) appear at every alignment,
+  // relative to the 8 or 16 bytes that the fast paths process at a time.
+  const char* pieces[] = {
+      "a",
+      "bcdefghijklmnop",
+      "\x7F",
+      "\xC2\x80",
+      "\xCE\x94",
+      "\xDF\xBF",
+      "\xE0\xA0\x80",
+      "\xE2\x98\x83",
+      "\xED\x9F\xBF",
+      "\xEE\x80\x80",
+      "\xEF\xBF\xBF",
+      "\xF0\x90\x80\x80",
+      "\xF0\x9F\x92\xA9",
+      "\xF4\x8F\xBF\xBF",
+      // Invalid.
+      "\x80",
+      "\xBF",
+      "\xC0\x80",
+      "\xC1\xBF",
+      "\xC2",
+      "\xE0\x80\x80",
+      "\xE0\x9F\xBF",
+      "\xE2\x98",
+      "\xED\xA0\x80",
+      "\xF0\x8F\xBF\xBF",
+      "\xF0\x9F\x92",
+      "\xF4\x90\x80\x80",
+      "\xF5\x80\x80\x80",
+      "\xFF",
+  };
+  const uint32_t num_pieces = WUFFS_TESTLIB_ARRAY_SIZE(pieces);
+  const uint32_t num_valid_pieces = 14;
+
+  uint8_t buf[256];
+  uint32_t rng = 0x12345678;
+  int i;
+  for (i = 0; i < 20000; i++) {
+    // Odd i values only use valid pieces, so that those strings are longer.
+    size_t n = 0;
+    while (n < (sizeof(buf) - 16)) {
+      rng = (rng * 1103515245) + 12345;
+      uint32_t r = rng >> 16;
+      if ((r & 0x3F) == 0) {
+        break;
+      }
+      uint32_t j = (r >> 6) % ((i & 1) ? num_valid_pieces : num_pieces);
+      size_t piece_len = strlen(pieces[j]);
+      memcpy(&buf[n], pieces[j], piece_len);
+      n += piece_len;
+    }
+
+    size_t o;
+    for (o = 0; (o < 4) && (o <= n); o++) {
+      wuffs_base__slice_u8 s = wuffs_base__make_slice_u8(&buf[o], n - o);
+
+      size_t want_utf_8 = 0;
+      while (want_utf_8 < s.len) {
+        wuffs_base__utf_8__next__output x = wuffs_base__utf_8__next(
+            wuffs_base__make_slice_u8(s.ptr + want_utf_8, s.len - want_utf_8));
+        if (!wuffs_base__utf_8__next__output__is_valid(&x)) {
+          break;
+        }
+        want_utf_8 += x.byte_length;
+      }
+      size_t have_utf_8 = wuffs_base__utf_8__longest_valid_prefix(s);
+      if (have_utf_8 != want_utf_8) {
+        RETURN_FAIL("i=%d, o=%zu: utf_8: have %zu, want %zu", i, o, have_utf_8,
+                    want_utf_8);
+      }
+
+      size_t want_ascii = 0;
+      while ((want_ascii < s.len) && (s.ptr[want_ascii] < 0x80)) {
+        want_ascii++;
+      }
+      size_t have_ascii = wuffs_base__ascii__longest_valid_prefix(s);
+      if (have_ascii != want_ascii) {
+        RETURN_FAIL("i=%d, o=%zu: ascii: have %zu, want %zu", i, o, have_ascii,
+                    want_ascii);
+      }
+    }
+  }
+
+  return NULL;
+}
+
 const char*  //
 test_wuffs_strconv_utf_8_next() {
   CHECK_FOCUS(__func__);
@@ -967,6 +1414,293 @@ test_wuffs_strconv_utf_8_next() {
   return NULL;
 }
 
+// ---------------- Token Tests
+
+const char*  //
+test_wuffs_token_buffer_reader_category_run() {
+  CHECK_FOCUS(__func__);
+
+  // Each test case is a (value_major, value_base_category) pair. Tokens with a
+  // non-zero value_major do not have a base category, but their value_major
+  // still needs a match.
+  struct {
+    uint64_t major;
+    uint64_t vbc;
+    uint64_t want_run;
+  } test_cases[] = {
+      {.major = 0, .vbc = WUFFS_BASE__TOKEN__VBC__FILLER, .want_run = 2},
+      {.major = 0, .vbc = WUFFS_BASE__TOKEN__VBC__FILLER, .want_run = 1},
+      {.major = 0, .vbc = WUFFS_BASE__TOKEN__VBC__STRUCTURE, .want_run = 1},
+      {.major = 0, .vbc = WUFFS_BASE__TOKEN__VBC__STRING, .want_run = 3},
+      {.major = 0, .vbc = WUFFS_BASE__TOKEN__VBC__STRING, .want_run = 2},
+      {.major = 0, .vbc = WUFFS_BASE__TOKEN__VBC__STRING, .want_run = 1},
+      {.major = 0x12345, .vbc = WUFFS_BASE__TOKEN__VBC__STRING, .want_run = 1},
+      {.major = 0x12346, .vbc = WUFFS_BASE__TOKEN__VBC__STRING, .want_run = 1},
+      {.major = 0, .vbc = WUFFS_BASE__TOKEN__VBC__NUMBER, .want_run = 1},
+      {.major = 0, .vbc = WUFFS_BASE__TOKEN__VBC__FILLER, .want_run = 1},
+  };
+  const int num_test_cases = WUFFS_TESTLIB_ARRAY_SIZE(test_cases);
+
+  wuffs_base__token tok_array[WUFFS_TESTLIB_ARRAY_SIZE(test_cases)];
+  int tc;
+  for (tc = 0; tc < num_test_cases; tc++) {
+    // Vary the value_base_detail, continued bit and length, which should not
+    // affect the run lengths.
+    tok_array[tc] = wuffs_base__make_token(
+        (test_cases[tc].major << WUFFS_BASE__TOKEN__VALUE_MAJOR__SHIFT) |
+        (test_cases[tc].vbc << WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT) |
+        (((uint64_t)tc) << WUFFS_BASE__TOKEN__VALUE_BASE_DETAIL__SHIFT) |
+        (((uint64_t)(tc & 1)) << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) |
+        ((uint64_t)tc));
+  }
+
+  wuffs_base__token_buffer tok = wuffs_base__slice_token__reader(
+      wuffs_base__make_slice_token(&tok_array[0], num_test_cases), true);
+  for (tc = 0; tc < num_test_cases; tc++) {
+    tok.meta.ri = tc;
+    uint64_t have = wuffs_base__token_buffer__reader_category_run(&tok);
+    if (have != test_cases[tc].want_run) {
+      RETURN_FAIL("tc=%d: have %" PRIu64 ", want %" PRIu64, tc, have,
+                  test_cases[tc].want_run);
+    }
+  }
+
+  tok.meta.ri = tok.meta.wi;
+  if (wuffs_base__token_buffer__reader_category_run(&tok) != 0) {
+    RETURN_FAIL("empty buffer: have non-zero, want zero");
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_token_buffer_reader_copy_run() {
+  CHECK_FOCUS(__func__);
+
+  const uint64_t copy =
+      WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY;
+  const uint64_t drop =
+      WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_0_DST_1_SRC_DROP;
+
+  // Each test case is a token's (value_major, value_base_category,
+  // value_base_detail, continued) and the copy run length starting there.
+  struct {
+    uint64_t major;
+    uint64_t vbc;
+    uint64_t vbd;
+    uint64_t continued;
+    uint64_t want_run;
+  } test_cases[] = {
+      {0, WUFFS_BASE__TOKEN__VBC__STRING, drop, 1, 0},
+      {0, WUFFS_BASE__TOKEN__VBC__STRING, copy, 1, 3},
+      {0, WUFFS_BASE__TOKEN__VBC__STRING, copy, 1, 2},
+      {0, WUFFS_BASE__TOKEN__VBC__STRING, copy, 0, 1},
+      {0, WUFFS_BASE__TOKEN__VBC__STRING, copy, 1, 1},
+      {0, WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT, copy, 1, 0},
+      {0x12345, WUFFS_BASE__TOKEN__VBC__STRING, copy, 1, 0},
+      {0, WUFFS_BASE__TOKEN__VBC__STRING, copy, 1, 2},
+      {0, WUFFS_BASE__TOKEN__VBC__STRING, copy, 1, 1},
+      {0, WUFFS_BASE__TOKEN__VBC__STRING, drop, 0, 0},
+      {0, WUFFS_BASE__TOKEN__VBC__NUMBER, copy, 0, 0},
+  };
+  const int num_test_cases = WUFFS_TESTLIB_ARRAY_SIZE(test_cases);
+
+  wuffs_base__token tok_array[WUFFS_TESTLIB_ARRAY_SIZE(test_cases)];
+  int tc;
+  for (tc = 0; tc < num_test_cases; tc++) {
+    tok_array[tc] = wuffs_base__make_token(
+        (test_cases[tc].major << WUFFS_BASE__TOKEN__VALUE_MAJOR__SHIFT) |
+        (test_cases[tc].vbc << WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT) |
+        (test_cases[tc].vbd << WUFFS_BASE__TOKEN__VALUE_BASE_DETAIL__SHIFT) |
+        (test_cases[tc].continued << WUFFS_BASE__TOKEN__CONTINUED__SHIFT) |
+        ((uint64_t)(tc + 1)));
+  }
+
+  wuffs_base__token_buffer tok = wuffs_base__slice_token__reader(
+      wuffs_base__make_slice_token(&tok_array[0], num_test_cases), true);
+  for (tc = 0; tc < num_test_cases; tc++) {
+    tok.meta.ri = tc;
+    uint64_t have = wuffs_base__token_buffer__reader_copy_run(&tok);
+    if (have != test_cases[tc].want_run) {
+      RETURN_FAIL("tc=%d: have %" PRIu64 ", want %" PRIu64, tc, have,
+                  test_cases[tc].want_run);
+    }
+  }
+
+  // A run can end at the end of the buffer, even if its last token is
+  // continued.
+  tok.meta.ri = 7;
+  tok.meta.wi = 8;
+  if (wuffs_base__token_buffer__reader_copy_run(&tok) != 1) {
+    RETURN_FAIL("truncated buffer: have other than one, want one");
+  }
+
+  tok.meta.ri = tok.meta.wi;
+  if (wuffs_base__token_buffer__reader_copy_run(&tok) != 0) {
+    RETURN_FAIL("empty buffer: have non-zero, want zero");
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_tape_builder() {
+  CHECK_FOCUS(__func__);
+
+  const char* src_str =
+      "{\"a\":[1,true,\"x\\ny\"],\"bc\":{},\"\":\"\\u00E9z\",\"d\":\"e\"} ";
+
+  struct {
+    uint32_t want_kind;
+    uint32_t want_skip;
+    bool want_converted;
+    const char* want_data;
+  } test_cases[] = {
+      {WUFFS_BASE__TAPE_NODE__KIND__DICT, 12, false,
+       "{\"a\":[1,true,\"x\\ny\"],\"bc\":{},\"\":\"\\u00E9z\",\"d\":\"e\"}"},
+      {WUFFS_BASE__TAPE_NODE__KIND__STRING, 1, false, "a"},
+      {WUFFS_BASE__TAPE_NODE__KIND__LIST, 4, false, "[1,true,\"x\\ny\"]"},
+      {WUFFS_BASE__TAPE_NODE__KIND__NUMBER, 1, false, "1"},
+      {WUFFS_BASE__TAPE_NODE__KIND__LITERAL, 1, false, "true"},
+      {WUFFS_BASE__TAPE_NODE__KIND__STRING, 1, true, "x\ny"},
+      {WUFFS_BASE__TAPE_NODE__KIND__STRING, 1, false, "bc"},
+      {WUFFS_BASE__TAPE_NODE__KIND__DICT, 1, false, "{}"},
+      {WUFFS_BASE__TAPE_NODE__KIND__STRING, 1, false, ""},
+      {WUFFS_BASE__TAPE_NODE__KIND__STRING, 1, true, "\xC3\xA9z"},
+      {WUFFS_BASE__TAPE_NODE__KIND__STRING, 1, false, "d"},
+      {WUFFS_BASE__TAPE_NODE__KIND__STRING, 1, false, "e"},
+  };
+  const int num_test_cases = WUFFS_TESTLIB_ARRAY_SIZE(test_cases);
+
+  wuffs_json__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_json__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+  wuffs_base__slice_u8 src_slice =
+      wuffs_base__make_slice_u8((void*)src_str, strlen(src_str));
+  wuffs_base__io_buffer src = wuffs_base__slice_u8__reader(src_slice, true);
+
+  // Use a small token buffer, so that the tape is built in batches, and start
+  // with no nodes or arena memory, so that the builder asks for more, one
+  // node or a few bytes at a time.
+  wuffs_base__token tok_array[3];
+  wuffs_base__token_buffer tok = wuffs_base__slice_token__writer(
+      wuffs_base__make_slice_token(&tok_array[0], 3));
+
+  wuffs_base__tape_node nodes[16];
+  size_t nodes_len = 0;
+  uint8_t arenas[8][16];
+  size_t num_arenas = 0;
+
+  wuffs_base__tape_builder builder;
+  wuffs_base__tape_builder__initialize(&builder, src_slice);
+
+  while (true) {
+    wuffs_base__status dec_status =
+        wuffs_json__decoder__decode_tokens(&dec, &tok, &src, g_work_slice_u8);
+
+    while (true) {
+      wuffs_base__status z =
+          wuffs_base__tape_builder__append_tokens(&builder, &tok);
+      if (wuffs_base__status__is_ok(&z)) {
+        break;
+      } else if (z.repr != wuffs_base__error__bad_argument_length_too_short) {
+        RETURN_FAIL("append_tokens: \"%s\"", z.repr);
+      } else if (wuffs_base__tape_builder__nodes(&builder).len >= nodes_len) {
+        if (nodes_len >= WUFFS_TESTLIB_ARRAY_SIZE(nodes)) {
+          RETURN_FAIL("too many nodes");
+        }
+        nodes_len++;
+        CHECK_STATUS("set_nodes",
+                     wuffs_base__tape_builder__set_nodes(
+                         &builder, wuffs_base__make_slice_tape_node(
+                                       &nodes[0], nodes_len)));
+      } else {
+        if (num_arenas >= WUFFS_TESTLIB_ARRAY_SIZE(arenas)) {
+          RETURN_FAIL("too many arenas");
+        }
+        num_arenas++;
+        CHECK_STATUS("set_arena", wuffs_base__tape_builder__set_arena(
+                                      &builder, wuffs_base__make_slice_u8(
+                                                    &arenas[num_arenas - 1][0],
+                                                    1 + num_arenas)));
+      }
+    }
+    wuffs_base__token_buffer__compact(&tok);
+
+    if (wuffs_base__status__is_ok(&dec_status)) {
+      break;
+    } else if (dec_status.repr != wuffs_base__suspension__short_write) {
+      RETURN_FAIL("decode_tokens: \"%s\"", dec_status.repr);
+    }
+  }
+
+  if (!wuffs_base__tape_builder__is_complete(&builder)) {
+    RETURN_FAIL("is_complete: have false, want true");
+  }
+  wuffs_base__slice_tape_node have = wuffs_base__tape_builder__nodes(&builder);
+  if (have.len != num_test_cases) {
+    RETURN_FAIL("nodes().len: have %zu, want %d", have.len, num_test_cases);
+  }
+
+  int tc;
+  for (tc = 0; tc < num_test_cases; tc++) {
+    wuffs_base__tape_node* n = &have.ptr[tc];
+    size_t want_len = strlen(test_cases[tc].want_data);
+    if (wuffs_base__tape_node__kind(n) != test_cases[tc].want_kind) {
+      RETURN_FAIL("tc=%d: kind: have %" PRIu32 ", want %" PRIu32, tc,
+                  wuffs_base__tape_node__kind(n), test_cases[tc].want_kind);
+    } else if (n->skip != test_cases[tc].want_skip) {
+      RETURN_FAIL("tc=%d: skip: have %" PRIu32 ", want %" PRIu32, tc, n->skip,
+                  test_cases[tc].want_skip);
+    } else if (wuffs_base__tape_node__converted(n) !=
+               test_cases[tc].want_converted) {
+      RETURN_FAIL("tc=%d: converted: have %d, want %d", tc,
+                  wuffs_base__tape_node__converted(n),
+                  test_cases[tc].want_converted);
+    } else if ((n->data.len != want_len) ||
+               memcmp(n->data.ptr, test_cases[tc].want_data, want_len)) {
+      RETURN_FAIL("tc=%d: data: have \"%.*s\", want \"%s\"", tc,
+                  (int)(n->data.len), n->data.ptr, test_cases[tc].want_data);
+    } else if (!wuffs_base__tape_node__converted(n) &&
+               ((n->data.ptr < src_slice.ptr) ||
+                (n->data.ptr > (src_slice.ptr + src_slice.len)))) {
+      RETURN_FAIL("tc=%d: data does not point into the source", tc);
+    }
+  }
+
+  if (wuffs_base__tape_node__detail(&have.ptr[4]) !=
+      WUFFS_BASE__TOKEN__VBD__LITERAL__TRUE) {
+    RETURN_FAIL("detail: have 0x%" PRIX32 ", want 0x%" PRIX32,
+                wuffs_base__tape_node__detail(&have.ptr[4]),
+                (uint32_t)(WUFFS_BASE__TOKEN__VBD__LITERAL__TRUE));
+  }
+
+  // An unbalanced pop is rejected.
+  {
+    wuffs_base__tape_builder__initialize(&builder, src_slice);
+    CHECK_STATUS("set_nodes", wuffs_base__tape_builder__set_nodes(
+                                  &builder, wuffs_base__make_slice_tape_node(
+                                                &nodes[0], 16)));
+    tok_array[0] = wuffs_base__make_token(
+        (((uint64_t)WUFFS_BASE__TOKEN__VBC__STRUCTURE)
+         << WUFFS_BASE__TOKEN__VALUE_BASE_CATEGORY__SHIFT) |
+        (((uint64_t)WUFFS_BASE__TOKEN__VBD__STRUCTURE__POP)
+         << WUFFS_BASE__TOKEN__VALUE_BASE_DETAIL__SHIFT) |
+        1);
+    tok = wuffs_base__slice_token__reader(
+        wuffs_base__make_slice_token(&tok_array[0], 1), true);
+    wuffs_base__status z =
+        wuffs_base__tape_builder__append_tokens(&builder, &tok);
+    if (z.repr != wuffs_base__error__bad_argument) {
+      RETURN_FAIL("unbalanced pop: have \"%s\", want \"%s\"", z.repr,
+                  wuffs_base__error__bad_argument);
+    }
+  }
+
+  return NULL;
+}
+
 // ---------------- Golden Tests
 
 golden_test g_json_australian_abc_gt = {
@@ -1063,15 +1797,20 @@ test_wuffs_json_decode_interface() {
 }
 
 const char*  //
-wuffs_json_decode(wuffs_base__token_buffer* tok,
-                  wuffs_base__io_buffer* src,
-                  uint32_t wuffs_initialize_flags,
-                  uint64_t wlimit,
-                  uint64_t rlimit) {
+do_wuffs_json_decode(wuffs_base__token_buffer* tok,
+                     wuffs_base__io_buffer* src,
+                     uint32_t wuffs_initialize_flags,
+                     uint64_t wlimit,
+                     uint64_t rlimit,
+                     bool portable_only) {
   wuffs_json__decoder dec;
   CHECK_STATUS("initialize",
                wuffs_json__decoder__initialize(&dec, sizeof dec, WUFFS_VERSION,
                                                wuffs_initialize_flags));
+  if (portable_only) {
+    dec.private_impl.f_cpu_arch_checked = true;
+    dec.private_impl.f_have_x86_sse42 = false;
+  }
 
   while (true) {
     wuffs_base__token_buffer limited_tok =
@@ -1094,6 +1833,181 @@ wuffs_json_decode(wuffs_base__token_buffer* tok,
   }
 }
 
+const char*  //
+wuffs_json_decode(wuffs_base__token_buffer* tok,
+                  wuffs_base__io_buffer* src,
+                  uint32_t wuffs_initialize_flags,
+                  uint64_t wlimit,
+                  uint64_t rlimit) {
+  return do_wuffs_json_decode(tok, src, wuffs_initialize_flags, wlimit, rlimit,
+                              false);
+}
+
+const char*  //
+wuffs_json_decode_portable(wuffs_base__token_buffer* tok,
+                           wuffs_base__io_buffer* src,
+                           uint32_t wuffs_initialize_flags,
+                           uint64_t wlimit,
+                           uint64_t rlimit) {
+  return do_wuffs_json_decode(tok, src, wuffs_initialize_flags, wlimit, rlimit,
+                              true);
+}
+
+// hash_json_tokens decodes src, in chunks of at most wlimit tokens and rlimit
+// bytes, and sets *hash to a hash (and *count to the number) of the tokens.
+const char*  //
+hash_json_tokens(uint64_t* hash,
+                 uint64_t* count,
+                 wuffs_base__slice_u8 src_data,
+                 uint64_t wlimit,
+                 uint64_t rlimit,
+                 bool portable_only) {
+  wuffs_json__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_json__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  if (portable_only) {
+    dec.private_impl.f_cpu_arch_checked = true;
+    dec.private_impl.f_have_x86_sse42 = false;
+  }
+
+  wuffs_base__io_buffer src = wuffs_base__slice_u8__reader(src_data, true);
+  *hash = 0;
+  *count = 0;
+  while (true) {
+    wuffs_base__token_buffer tok =
+        wuffs_base__slice_token__writer(g_have_slice_token);
+    wuffs_base__token_buffer limited_tok =
+        make_limited_token_writer(tok, wlimit);
+    wuffs_base__io_buffer limited_src = make_limited_reader(src, rlimit);
+
+    wuffs_base__status status = wuffs_json__decoder__decode_tokens(
+        &dec, &limited_tok, &limited_src, g_work_slice_u8);
+    src.meta.ri += limited_src.meta.ri;
+
+    size_t i;
+    for (i = 0; i < limited_tok.meta.wi; i++) {
+      *hash = (*hash * 0x100000001B3) ^ limited_tok.data.ptr[i].repr;
+    }
+    *count += limited_tok.meta.wi;
+
+    if ((status.repr == wuffs_base__suspension__short_write) ||
+        (status.repr == wuffs_base__suspension__short_read)) {
+      continue;
+    }
+    return status.repr;
+  }
+}
+
+const char*  //
+test_wuffs_json_decode_cpu_arch() {
+  CHECK_FOCUS(__func__);
+
+  // Make a synthetic document with long strings and whitespace runs (longer
+  // than the maximum token length), interspersed with escapes, UTF-8 and
+  // control bytes at an assortment of offsets.
+  uint8_t* p = g_src_slice_u8.ptr;
+  size_t n = 0;
+  p[n++] = '[';
+  int i;
+  for (i = 0; i < 3; i++) {
+    size_t j;
+    for (j = 0; j < 0x14321; j++) {
+      p[n++] = "\t\n\r "[(j >> (4 * i)) & 3];
+    }
+    p[n++] = '"';
+    for (j = 0; j < 0x12345; j++) {
+      size_t k = j % (13 + (8 * i));
+      if (k == 0) {
+        p[n++] = '\\';
+        p[n++] = 'n';
+      } else if (k == 5) {
+        p[n++] = 0xC3;
+        p[n++] = 0xA9;
+      } else if ((k == 7) && (j > 0x10000)) {
+        p[n++] = 0xE2;
+        p[n++] = 0x98;
+        p[n++] = 0x83;
+      } else {
+        p[n++] = 'a' + (j % 26);
+      }
+    }
+    for (j = 0; j < 0x12345; j++) {
+      p[n++] = 'A' + (j % 26);
+    }
+    p[n++] = '"';
+    p[n++] = ',';
+  }
+  p[n++] = '0';
+  p[n++] = ']';
+  uint8_t* synthetic_ptr = p;
+  size_t synthetic_len = n;
+
+  // The first few files are read into the tail of g_src_slice_u8.
+  const char* filenames[] = {
+      NULL,
+      "test/data/australian-abc-local-stations.json",
+      "test/data/file-sizes.json",
+      "test/data/json-things.formatted.json",
+      "test/data/nobel-prizes.json",
+  };
+  // The rlimits are at least WUFFS_JSON__DECODER_SRC_IO_BUFFER_LENGTH_MIN_INCL,
+  // so that the decoder can always make progress.
+  const uint64_t wlimits[] = {1, 7, 4096, UINT64_MAX};
+  const uint64_t rlimits[] = {
+      WUFFS_JSON__DECODER_SRC_IO_BUFFER_LENGTH_MIN_INCL,
+      WUFFS_JSON__DECODER_SRC_IO_BUFFER_LENGTH_MIN_INCL + 13,
+      4096,
+      UINT64_MAX,
+  };
+
+  size_t f;
+  for (f = 0; f < WUFFS_TESTLIB_ARRAY_SIZE(filenames); f++) {
+    wuffs_base__slice_u8 src_data =
+        wuffs_base__make_slice_u8(synthetic_ptr, synthetic_len);
+    if (filenames[f]) {
+      wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+          .data = wuffs_base__make_slice_u8(g_src_slice_u8.ptr + synthetic_len,
+                                            g_src_slice_u8.len - synthetic_len),
+      });
+      CHECK_STRING(read_file(&src, filenames[f]));
+      src_data = wuffs_base__make_slice_u8(src.data.ptr, src.meta.wi);
+    }
+
+    size_t w;
+    for (w = 0; w < WUFFS_TESTLIB_ARRAY_SIZE(wlimits); w++) {
+      size_t r;
+      for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+        uint64_t have_hash[2] = {0};
+        uint64_t have_count[2] = {0};
+        const char* have_status[2] = {NULL};
+        int j;
+        for (j = 0; j < 2; j++) {
+          have_status[j] =
+              hash_json_tokens(&have_hash[j], &have_count[j], src_data,
+                               wlimits[w], rlimits[r], j == 0);
+        }
+        if (have_status[0] != NULL) {
+          RETURN_FAIL("f=%zu, w=%zu, r=%zu: portable: %s", f, w, r,
+                      have_status[0]);
+        } else if (have_status[1] != NULL) {
+          RETURN_FAIL("f=%zu, w=%zu, r=%zu: cpu_arch: %s", f, w, r,
+                      have_status[1]);
+        } else if ((have_hash[0] != have_hash[1]) ||
+                   (have_count[0] != have_count[1])) {
+          RETURN_FAIL("f=%zu, w=%zu, r=%zu: portable 0x%016" PRIX64 " (%" PRIu64
+                      " tokens), cpu_arch 0x%016" PRIX64 " (%" PRIu64
+                      " tokens)",
+                      f, w, r, have_hash[0], have_count[0], have_hash[1],
+                      have_count[1]);
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_json_decode_end_of_data() {
   CHECK_FOCUS(__func__);
@@ -1806,6 +2720,99 @@ test_wuffs_json_decode_quirk_allow_comment_etc() {
   return NULL;
 }
 
+const char*  //
+test_wuffs_json_decode_quirk_allow_json_lines() {
+  CHECK_FOCUS(__func__);
+
+  const char* bad_inp = wuffs_json__error__bad_input;
+
+  struct {
+    const char* want_status;
+    uint32_t want_num_records;
+    bool allow_leading_ars;
+    const char* str;
+  } test_cases[] = {
+      {.want_status = NULL, .want_num_records = 0, .str = ""},
+      {.want_status = NULL, .want_num_records = 0, .str = "\n\n \t"},
+      {.want_status = NULL, .want_num_records = 1, .str = "0"},
+      {.want_status = NULL, .want_num_records = 2, .str = "[1,\n2]\n{}\n"},
+      {.want_status = NULL, .want_num_records = 2, .str = "1\n\n\n [true] \n"},
+      {.want_status = NULL, .want_num_records = 3, .str = "1\n\"2\"\n3"},
+      {.want_status = NULL, .want_num_records = 3, .str = "1\n\"2\"\n3\n"},
+      {.want_status = NULL,
+       .want_num_records = 2,
+       .allow_leading_ars = true,
+       .str = "\x1E[1]\n\x1E[2]\n"},
+      {.want_status = bad_inp, .want_num_records = 1, .str = "1\n2 3\n"},
+      {.want_status = bad_inp, .want_num_records = 1, .str = "{}\n[1\n"},
+      {.want_status = bad_inp, .want_num_records = 1, .str = "{}\nnull]\n"},
+  };
+
+  const uint64_t wlimits[] = {1, UINT64_MAX};
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    size_t w;
+    for (w = 0; w < WUFFS_TESTLIB_ARRAY_SIZE(wlimits); w++) {
+      wuffs_json__decoder dec;
+      CHECK_STATUS("initialize", wuffs_json__decoder__initialize(
+                                     &dec, sizeof dec, WUFFS_VERSION,
+                                     WUFFS_INITIALIZE__DEFAULT_OPTIONS));
+      wuffs_json__decoder__set_quirk_enabled(
+          &dec, WUFFS_JSON__QUIRK_ALLOW_JSON_LINES, true);
+      wuffs_json__decoder__set_quirk_enabled(
+          &dec, WUFFS_JSON__QUIRK_ALLOW_LEADING_ASCII_RECORD_SEPARATOR,
+          test_cases[tc].allow_leading_ars);
+
+      wuffs_base__token_buffer tok =
+          wuffs_base__slice_token__writer(g_have_slice_token);
+      wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+          (void*)test_cases[tc].str, strlen(test_cases[tc].str), true);
+      uint32_t have_num_records = 0;
+      const char* have_status = NULL;
+      while (true) {
+        wuffs_base__token_buffer limited_tok =
+            make_limited_token_writer(tok, wlimits[w]);
+        wuffs_base__status status = wuffs_json__decoder__decode_tokens(
+            &dec, &limited_tok, &src, g_work_slice_u8);
+        tok.meta.wi += limited_tok.meta.wi;
+        if (status.repr == NULL) {
+          have_num_records++;
+        } else if (status.repr == wuffs_base__note__end_of_data) {
+          break;
+        } else if (status.repr != wuffs_base__suspension__short_write) {
+          have_status = status.repr;
+          break;
+        }
+      }
+
+      if (have_status != test_cases[tc].want_status) {
+        RETURN_FAIL("tc=%d, w=%zu: status: have \"%s\", want \"%s\"", tc, w,
+                    have_status, test_cases[tc].want_status);
+      }
+      if (have_num_records != test_cases[tc].want_num_records) {
+        RETURN_FAIL("tc=%d, w=%zu: num_records: have %" PRIu32
+                    ", want %" PRIu32,
+                    tc, w, have_num_records, test_cases[tc].want_num_records);
+      }
+
+      size_t total_length = 0;
+      while (tok.meta.ri < tok.meta.wi) {
+        total_length += wuffs_base__token__length(&tok.data.ptr[tok.meta.ri++]);
+      }
+      if (total_length != src.meta.ri) {
+        RETURN_FAIL("tc=%d, w=%zu: total_length: have %zu, want %zu", tc, w,
+                    total_length, src.meta.ri);
+      }
+      if (!have_status && (total_length != src.data.len)) {
+        RETURN_FAIL("tc=%d, w=%zu: total_length: have %zu, want %zu", tc, w,
+                    total_length, src.data.len);
+      }
+    }
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_json_decode_quirk_allow_leading_etc() {
   CHECK_FOCUS(__func__);
@@ -2204,6 +3211,243 @@ test_wuffs_json_decode_unicode4_escapes() {
 // The JSON specification doesn't give a maximum byte length for a number, but
 // implementations are permitted to impose one. Wuffs' implementation imposes
 // WUFFS_JSON__DECODER_NUMBER_LENGTH_MAX_INCL.
+// skip_json_tokens decodes src_data, one token at a time and in chunks of at
+// most rlimit bytes, and sets *have to the concatenated source bytes of every
+// non-filler token. After skip_after non-filler tokens, it asks the decoder to
+// skip the remainder of the innermost n containers, repeating that request
+// (decremented for every ']' or '}' seen since) after every suspension.
+const char*  //
+skip_json_tokens(wuffs_base__io_buffer* have,
+                 wuffs_base__slice_u8 src_data,
+                 uint64_t skip_after,
+                 uint32_t n,
+                 uint64_t rlimit,
+                 bool portable_only) {
+  wuffs_json__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_json__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  if (portable_only) {
+    dec.private_impl.f_cpu_arch_checked = true;
+    dec.private_impl.f_have_x86_sse42 = false;
+  }
+
+  wuffs_base__io_buffer src = wuffs_base__slice_u8__reader(src_data, true);
+  uint64_t num_tokens = 0;
+  uint64_t src_index = 0;
+  bool skipping = false;
+  if (skip_after == 0) {
+    // Outside of any container, the request should have no effect.
+    wuffs_json__decoder__skip_remainder_of_containers(&dec, n);
+  }
+  while (true) {
+    wuffs_base__token_buffer tok =
+        wuffs_base__slice_token__writer(g_have_slice_token);
+    wuffs_base__token_buffer limited_tok = make_limited_token_writer(tok, 1);
+    wuffs_base__io_buffer limited_src = make_limited_reader(src, rlimit);
+
+    wuffs_base__status status = wuffs_json__decoder__decode_tokens(
+        &dec, &limited_tok, &limited_src, g_work_slice_u8);
+    src.meta.ri += limited_src.meta.ri;
+
+    size_t i;
+    for (i = 0; i < limited_tok.meta.wi; i++) {
+      wuffs_base__token* t = &limited_tok.data.ptr[i];
+      uint64_t len = wuffs_base__token__length(t);
+      if (wuffs_base__token__value(t) != 0) {
+        if ((have->data.len - have->meta.wi) < len) {
+          return "skip_json_tokens: have buffer is full";
+        }
+        memcpy(have->data.ptr + have->meta.wi, src_data.ptr + src_index, len);
+        have->meta.wi += len;
+        num_tokens++;
+      }
+      src_index += len;
+
+      if (skipping && (n > 0) &&
+          (wuffs_base__token__value_base_category(t) ==
+           WUFFS_BASE__TOKEN__VBC__STRUCTURE) &&
+          (wuffs_base__token__value_base_detail(t) &
+           WUFFS_BASE__TOKEN__VBD__STRUCTURE__POP)) {
+        n--;
+      }
+    }
+
+    if (skip_after > 0) {
+      skipping = skipping || (num_tokens >= skip_after);
+      if (skipping) {
+        wuffs_json__decoder__skip_remainder_of_containers(&dec, n);
+      }
+    }
+
+    if ((status.repr == wuffs_base__suspension__short_write) ||
+        (status.repr == wuffs_base__suspension__short_read)) {
+      continue;
+    }
+    if (src_index != src.meta.ri) {
+      return "skip_json_tokens: inconsistent token lengths";
+    }
+    return status.repr;
+  }
+}
+
+const char*  //
+test_wuffs_json_decode_skip_remainder_of_containers() {
+  CHECK_FOCUS(__func__);
+
+  const char* bad_inp = wuffs_json__error__bad_input;
+
+  struct {
+    const char* want_str;
+    const char* want_status;
+    const char* str;
+    uint64_t skip_after;
+    uint32_t n;
+  } test_cases[] = {
+      {
+          .want_str = "",
+          .want_status = bad_inp,
+          .str = "[1,{]",
+          .skip_after = 1,
+          .n = 1,
+      },
+      {
+          .want_str = "[",
+          .want_status = bad_inp,
+          .str = "[{\"a\":1}}",
+          .skip_after = 1,
+          .n = 1,
+      },
+      {
+          .want_str = "[1{\"a\"[23]}4]",
+          .want_status = NULL,
+          .str = "[1,{\"a\":[2,3]},4]",
+          .skip_after = 0,
+          .n = 1,
+      },
+      {
+          .want_str = "[1{\"a\"[23]}4]",
+          .want_status = NULL,
+          .str = "[1,{\"a\":[2,3]},4]",
+          .skip_after = 1,
+          .n = 0,
+      },
+      {
+          .want_str = "[1{\"a\"[2]}4]",
+          .want_status = NULL,
+          .str = "[1,{\"a\":[2,3]},4]",
+          .skip_after = 8,
+          .n = 2,
+      },
+      {
+          .want_str = "[1{\"a\"[2]}]",
+          .want_status = NULL,
+          .str = "[1,{\"a\":[2,3]},4]",
+          .skip_after = 8,
+          .n = 3,
+      },
+      {
+          .want_str = "[1{\"a\"[2]}]",
+          .want_status = NULL,
+          .str = "[1,{\"a\":[2,3]},4]",
+          .skip_after = 8,
+          .n = 9,
+      },
+      {
+          .want_str = "[1{\"a\"}4]",
+          .want_status = NULL,
+          .str = "[1,{\"a\":[2,3]},4]",
+          .skip_after = 4,
+          .n = 1,
+      },
+      {
+          .want_str = "[[]2]",
+          .want_status = NULL,
+          .str = "[[1,\"]\\\"[{\",{\"k\":[]}],2]",
+          .skip_after = 2,
+          .n = 1,
+      },
+      {
+          .want_str = "[]",
+          .want_status = NULL,
+          .str = "[1,{\"a\":[2,3]},4]",
+          .skip_after = 1,
+          .n = 1,
+      },
+      {
+          .want_str = "{\"x\"[]}",
+          .want_status = NULL,
+          .str = "{\"x\": [ \"\\\\\", {\"y\\\"\": \"}\"} ] }",
+          .skip_after = 5,
+          .n = 1,
+      },
+  };
+
+  // Make a synthetic document that is longer than the maximum token length,
+  // whose strings contain brackets and backslash-escaped quotes.
+  uint8_t* p = g_src_slice_u8.ptr;
+  const char* chunk = "{\"k\\\"]\":[\"\\\\\",[{}],\"}{\"]},";
+  size_t chunk_len = strlen(chunk);
+  size_t n = 0;
+  p[n++] = '[';
+  while (n < 0x30000) {
+    memcpy(p + n, chunk, chunk_len);
+    n += chunk_len;
+  }
+  p[n++] = '0';
+  p[n++] = ']';
+
+  const uint64_t rlimits[] = {
+      WUFFS_JSON__DECODER_SRC_IO_BUFFER_LENGTH_MIN_INCL,
+      UINT64_MAX,
+  };
+
+  int tc;
+  for (tc = 0; tc <= (int)(WUFFS_TESTLIB_ARRAY_SIZE(test_cases)); tc++) {
+    wuffs_base__slice_u8 src_data = wuffs_base__make_slice_u8(p, n);
+    const char* want_str = "[]";
+    const char* want_status = NULL;
+    uint64_t skip_after = 1;
+    uint32_t skip_n = 1;
+    if (tc < (int)(WUFFS_TESTLIB_ARRAY_SIZE(test_cases))) {
+      src_data = wuffs_base__make_slice_u8((void*)(test_cases[tc].str),
+                                           strlen(test_cases[tc].str));
+      want_str = test_cases[tc].want_str;
+      want_status = test_cases[tc].want_status;
+      skip_after = test_cases[tc].skip_after;
+      skip_n = test_cases[tc].n;
+    }
+
+    size_t r;
+    for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+      int portable_only;
+      for (portable_only = 0; portable_only < 2; portable_only++) {
+        wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+            .data = g_have_slice_u8,
+        });
+        const char* have_status = skip_json_tokens(
+            &have, src_data, skip_after, skip_n, rlimits[r], portable_only);
+        if (have_status != want_status) {
+          RETURN_FAIL("tc=%d, r=%zu, p=%d: status: have \"%s\", want \"%s\"",
+                      tc, r, portable_only, have_status, want_status);
+        }
+        if (want_status) {
+          continue;
+        }
+        size_t want_len = strlen(want_str);
+        if ((have.meta.wi != want_len) ||
+            memcmp(have.data.ptr, want_str, want_len)) {
+          RETURN_FAIL("tc=%d, r=%zu, p=%d: have \"%.*s\", want \"%s\"", tc, r,
+                      portable_only, (int)(have.meta.wi), have.data.ptr,
+                      want_str);
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_json_decode_src_io_buffer_length() {
   CHECK_FOCUS(__func__);
@@ -2380,6 +3624,41 @@ test_wuffs_json_decode_string() {
 
 // ---------------- String Conversions Benches
 
+// These are typical of float-heavy JSON, such as geographic coordinates,
+// sensor telemetry and the like.
+const char* g_dense_f64_strs[] = {
+    "37.7749295",
+    "-122.4194155",
+    "0.000123456",
+    "-273.15",
+    "6.02214076e23",
+    "1.602176634e-19",
+    "98.6",
+    "0.1",
+    "2.718281828459045",
+    "-0.5772156649",
+    "299792458.0",
+    "1.7976931348623157e308",
+    "4.9e-324",
+    "12345.678901234",
+    "-1e-10",
+    "0.30000000000000004",
+};
+
+// parse_dense_f64s sets dst[j] to the parsed g_dense_f64_strs[j].
+const char*  //
+parse_dense_f64s(double* dst) {
+  int j;
+  for (j = 0; j < WUFFS_TESTLIB_ARRAY_SIZE(g_dense_f64_strs); j++) {
+    wuffs_base__result_f64 r =
+        wuffs_base__parse_number_f64(wuffs_base__make_slice_u8(
+            (void*)g_dense_f64_strs[j], strlen(g_dense_f64_strs[j])));
+    CHECK_STATUS("", r.status);
+    dst[j] = r.value;
+  }
+  return NULL;
+}
+
 const char*  //
 do_bench_wuffs_strconv_parse_number_f64(const char* str,
                                         uint64_t iters_unscaled) {
@@ -2410,6 +3689,78 @@ bench_wuffs_strconv_parse_number_f64_1_lsh53_add1() {
   return do_bench_wuffs_strconv_parse_number_f64("9007199254740993", 1000);
 }
 
+const char*  //
+bench_wuffs_strconv_parse_number_f64_dense() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__slice_u8 slices[WUFFS_TESTLIB_ARRAY_SIZE(g_dense_f64_strs)];
+  uint64_t n_bytes = 0;
+  int j;
+  for (j = 0; j < WUFFS_TESTLIB_ARRAY_SIZE(g_dense_f64_strs); j++) {
+    slices[j] = wuffs_base__make_slice_u8((void*)g_dense_f64_strs[j],
+                                          strlen(g_dense_f64_strs[j]));
+    n_bytes += slices[j].len;
+  }
+
+  bench_start();
+  uint64_t i;
+  uint64_t iters = 100 * g_flags.iterscale;
+  for (i = 0; i < iters; i++) {
+    for (j = 0; j < WUFFS_TESTLIB_ARRAY_SIZE(g_dense_f64_strs); j++) {
+      CHECK_STATUS("", wuffs_base__parse_number_f64(slices[j]).status);
+    }
+  }
+  bench_finish(iters, iters * n_bytes);
+
+  return NULL;
+}
+
+const char*  //
+bench_wuffs_strconv_render_number_f64_dense() {
+  CHECK_FOCUS(__func__);
+  double xs[WUFFS_TESTLIB_ARRAY_SIZE(g_dense_f64_strs)];
+  CHECK_STRING(parse_dense_f64s(xs));
+
+  uint8_t buf[WUFFS_BASE__F64__BYTE_LENGTH__MAX_INCL];
+  bench_start();
+  uint64_t i;
+  uint64_t iters = 100 * g_flags.iterscale;
+  for (i = 0; i < iters; i++) {
+    int j;
+    for (j = 0; j < WUFFS_TESTLIB_ARRAY_SIZE(xs); j++) {
+      if (!wuffs_base__render_number_f64(
+              wuffs_base__make_slice_u8(buf, sizeof buf), xs[j],
+              WUFFS_BASE__RENDER_NUMBER_XXX__DEFAULT_OPTIONS)) {
+        RETURN_FAIL("render_number_f64 failed");
+      }
+    }
+  }
+  bench_finish(iters, 0);
+
+  return NULL;
+}
+
+const char*  //
+bench_wuffs_strconv_render_number_i64() {
+  CHECK_FOCUS(__func__);
+  uint8_t buf[WUFFS_BASE__I64__BYTE_LENGTH__MAX_INCL];
+  bench_start();
+  uint64_t i;
+  uint64_t iters = 100000 * g_flags.iterscale;
+  for (i = 0; i < iters; i++) {
+    // Render numbers of various lengths: the low bits of i, scaled up.
+    int64_t x = ((int64_t)(i & 0xFFFF)) << (i % 48);
+    if (!wuffs_base__render_number_i64(
+            wuffs_base__make_slice_u8(buf, sizeof buf), (i & 1) ? -x : x,
+            WUFFS_BASE__RENDER_NUMBER_XXX__DEFAULT_OPTIONS)) {
+      RETURN_FAIL("render_number_i64 failed");
+    }
+  }
+  bench_finish(iters, 0);
+
+  return NULL;
+}
+
 const char*  //
 bench_wuffs_strconv_parse_number_f64_pi_long() {
   CHECK_FOCUS(__func__);
@@ -2457,11 +3808,117 @@ bench_wuffs_json_decode_217k_stringy() {
       tcounter_src, &g_json_nobel_prizes_gt, UINT64_MAX, UINT64_MAX, 25);
 }
 
+// The 217k_stringy_etc benches sweep the token and source buffer sizes, from
+// small enough to fit in L1 cache to large enough to hold the whole input.
+// Each wlimit (or rlimit) sized call to decode_tokens ends with a short write
+// (or short read) suspension and resumes in the next call.
+
+const char*  //
+bench_wuffs_json_decode_217k_stringy_w256() {
+  CHECK_FOCUS(__func__);
+  return do_bench_token_decoder(
+      wuffs_json_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      tcounter_src, &g_json_nobel_prizes_gt, 256, UINT64_MAX, 25);
+}
+
+const char*  //
+bench_wuffs_json_decode_217k_stringy_w4k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_token_decoder(
+      wuffs_json_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      tcounter_src, &g_json_nobel_prizes_gt, 4096, UINT64_MAX, 25);
+}
+
+const char*  //
+bench_wuffs_json_decode_217k_stringy_w32k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_token_decoder(
+      wuffs_json_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      tcounter_src, &g_json_nobel_prizes_gt, 32768, UINT64_MAX, 25);
+}
+
+const char*  //
+bench_wuffs_json_decode_217k_stringy_r4k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_token_decoder(
+      wuffs_json_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      tcounter_src, &g_json_nobel_prizes_gt, UINT64_MAX, 4096, 25);
+}
+
+const char*  //
+bench_wuffs_json_decode_217k_stringy_r32k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_token_decoder(
+      wuffs_json_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      tcounter_src, &g_json_nobel_prizes_gt, UINT64_MAX, 32768, 25);
+}
+
+const char*  //
+bench_wuffs_json_decode_portable_21k_formatted() {
+  CHECK_FOCUS(__func__);
+  return do_bench_token_decoder(
+      wuffs_json_decode_portable,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_json_file_sizes_gt, UINT64_MAX, UINT64_MAX, 300);
+}
+
+const char*  //
+bench_wuffs_json_decode_portable_217k_stringy() {
+  CHECK_FOCUS(__func__);
+  return do_bench_token_decoder(
+      wuffs_json_decode_portable,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_src,
+      &g_json_nobel_prizes_gt, UINT64_MAX, UINT64_MAX, 25);
+}
+
   // ---------------- Mimic Benches
 
 #ifdef WUFFS_MIMIC
 
-  // No mimic benches.
+// The mimic benches use the C standard library's snprintf, not a separate
+// mimic library. "%.17g" always round-trips but is often not the shortest
+// representation.
+
+const char*  //
+bench_mimic_strconv_render_number_f64_dense() {
+  CHECK_FOCUS(__func__);
+  double xs[WUFFS_TESTLIB_ARRAY_SIZE(g_dense_f64_strs)];
+  CHECK_STRING(parse_dense_f64s(xs));
+
+  char buf[32];
+  bench_start();
+  uint64_t i;
+  uint64_t iters = 100 * g_flags.iterscale;
+  for (i = 0; i < iters; i++) {
+    int j;
+    for (j = 0; j < WUFFS_TESTLIB_ARRAY_SIZE(xs); j++) {
+      if (snprintf(buf, sizeof buf, "%.17g", xs[j]) <= 0) {
+        RETURN_FAIL("snprintf failed");
+      }
+    }
+  }
+  bench_finish(iters, 0);
+
+  return NULL;
+}
+
+const char*  //
+bench_mimic_strconv_render_number_i64() {
+  CHECK_FOCUS(__func__);
+  char buf[32];
+  bench_start();
+  uint64_t i;
+  uint64_t iters = 100000 * g_flags.iterscale;
+  for (i = 0; i < iters; i++) {
+    int64_t x = ((int64_t)(i & 0xFFFF)) << (i % 48);
+    if (snprintf(buf, sizeof buf, "%" PRId64, (i & 1) ? -x : x) <= 0) {
+      RETURN_FAIL("snprintf failed");
+    }
+  }
+  bench_finish(iters, 0);
+
+  return NULL;
+}
 
 #endif  // WUFFS_MIMIC
 
@@ -2469,11 +3926,13 @@ bench_wuffs_json_decode_217k_stringy() {
 
 proc g_tests[] = {
 
-    // These core and strconv tests are really testing the Wuffs base library.
+    // These core, strconv, tape and token tests are really testing the Wuffs
+    // base library.
     // They aren't specific to the std/json code, but putting them here is as
     // good as any other place.
     test_wuffs_core_count_leading_zeroes_u64,
     test_wuffs_core_multiply_u64,
+    test_wuffs_strconv_eisel_lemire,
     test_wuffs_strconv_hexadecimal,
     test_wuffs_strconv_hpd_rounded_integer,
     test_wuffs_strconv_hpd_shift,
@@ -2481,8 +3940,16 @@ proc g_tests[] = {
     test_wuffs_strconv_parse_number_f64,
     test_wuffs_strconv_parse_number_i64,
     test_wuffs_strconv_parse_number_u64,
+    test_wuffs_strconv_render_number_f64,
+    test_wuffs_strconv_render_number_i64,
+    test_wuffs_strconv_render_number_u64,
+    test_wuffs_strconv_utf_8_longest_valid_prefix,
     test_wuffs_strconv_utf_8_next,
+    test_wuffs_tape_builder,
+    test_wuffs_token_buffer_reader_category_run,
+    test_wuffs_token_buffer_reader_copy_run,
 
+    test_wuffs_json_decode_cpu_arch,
     test_wuffs_json_decode_end_of_data,
     test_wuffs_json_decode_interface,
     test_wuffs_json_decode_long_numbers,
@@ -2492,9 +3959,11 @@ proc g_tests[] = {
     test_wuffs_json_decode_quirk_allow_comment_etc,
     test_wuffs_json_decode_quirk_allow_extra_comma,
     test_wuffs_json_decode_quirk_allow_inf_nan_numbers,
+    test_wuffs_json_decode_quirk_allow_json_lines,
     test_wuffs_json_decode_quirk_allow_leading_etc,
     test_wuffs_json_decode_quirk_allow_trailing_etc,
     test_wuffs_json_decode_quirk_replace_invalid_unicode,
+    test_wuffs_json_decode_skip_remainder_of_containers,
     test_wuffs_json_decode_src_io_buffer_length,
     test_wuffs_json_decode_string,
     test_wuffs_json_decode_unicode4_escapes,
@@ -2512,17 +3981,28 @@ proc g_benches[] = {
 
     bench_wuffs_strconv_parse_number_f64_1_lsh53_add0,
     bench_wuffs_strconv_parse_number_f64_1_lsh53_add1,
+    bench_wuffs_strconv_parse_number_f64_dense,
     bench_wuffs_strconv_parse_number_f64_pi_long,
     bench_wuffs_strconv_parse_number_f64_pi_short,
+    bench_wuffs_strconv_render_number_f64_dense,
+    bench_wuffs_strconv_render_number_i64,
 
     bench_wuffs_json_decode_1k,
     bench_wuffs_json_decode_21k_formatted,
     bench_wuffs_json_decode_26k_compact,
     bench_wuffs_json_decode_217k_stringy,
+    bench_wuffs_json_decode_217k_stringy_r4k,
+    bench_wuffs_json_decode_217k_stringy_r32k,
+    bench_wuffs_json_decode_217k_stringy_w256,
+    bench_wuffs_json_decode_217k_stringy_w4k,
+    bench_wuffs_json_decode_217k_stringy_w32k,
+    bench_wuffs_json_decode_portable_21k_formatted,
+    bench_wuffs_json_decode_portable_217k_stringy,
 
 #ifdef WUFFS_MIMIC
 
-// No mimic benches.
+    bench_mimic_strconv_render_number_f64_dense,
+    bench_mimic_strconv_render_number_i64,
 
 #endif  // WUFFS_MIMIC
 
@@ -0,0 +1,432 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+This test program is typically run indirectly, by the "wuffs test" or "wuffs
+bench" commands. These commands take an optional "-mimic" flag to check that
+Wuffs' output mimics (i.e. exactly matches) other libraries' output, such as
+giflib for GIF, libpng for PNG, etc.
+
+To manually run this test:
+
+for CC in clang gcc; do
+  $CC -std=c99 -Wall -Werror lz4.c && ./a.out
+  rm -f a.out
+done
+
+Each edition should print "PASS", amongst other information, and exit(0).
+
+Add the "wuffs mimic cflags" (everything after the colon below) to the C
+compiler flags (after the .c file) to run the mimic tests.
+
+To manually run the benchmarks, replace "-Wall -Werror" with "-O3" and replace
+the first "./a.out" with "./a.out -bench". Combine these changes with the
+"wuffs mimic cflags" to run the mimic benchmarks.
+*/
+
+// !! wuffs mimic cflags: -DWUFFS_MIMIC -llz4
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c whitelist which parts of Wuffs to build. That file contains
+// the entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__LZ4
+#define WUFFS_CONFIG__MODULE__XXHASH32
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../../release/c/wuffs-unsupported-snapshot.c"
+#include "../testlib/testlib.c"
+#ifdef WUFFS_MIMIC
+#include "../mimiclib/lz4.c"
+#endif
+
+// ---------------- Golden Tests
+
+golden_test g_lz4_empty_gt = {
+    .want_filename = "test/data/artificial/0.bytes",
+    .src_filename = "test/data/artificial/0.bytes.lz4",
+};
+
+golden_test g_lz4_midsummer_gt = {
+    .want_filename = "test/data/midsummer.txt",
+    .src_filename = "test/data/midsummer.txt.lz4",
+};
+
+golden_test g_lz4_pi_gt = {
+    .want_filename = "test/data/pi.txt",
+    .src_filename = "test/data/pi.txt.lz4",
+};
+
+// ---------------- LZ4 Tests
+
+const char*  //
+test_wuffs_lz4_decode_in_place() {
+  CHECK_FOCUS(__func__);
+
+  // The src and dst share one backing array, as for in-place decompression:
+  // dst is the first 4096 bytes and the compressed frame sits src_offset
+  // bytes into them. The frame's first sequence expands 5 bytes to 220, so
+  // that the second sequence's 2 literals are read from only 10 bytes ahead
+  // of where they are written. Copying them 16 bytes at a time would clobber
+  // the frame's not yet read bytes.
+  const size_t src_offset = 213;
+  uint8_t* a = g_have_array_u8;
+  uint8_t* b = a + src_offset;
+  int i;
+
+  // Frame header: magic number, FLG (version 1, independent blocks), BD (64
+  // KiB block maximum size) and HC (a checksum of FLG and BD).
+  memcpy(b, "\x04\x22\x4D\x18\x60\x40\x82", 7);
+  b += 7;
+  // Block size: 5 + 5 + 303 = 313 = 0x139 bytes, compressed.
+  memcpy(b, "\x39\x01\x00\x00", 4);
+  b += 4;
+  // 1 literal ('a') and then a match (offset 1, length 19 + 200).
+  memcpy(b, "\x1F\x61\x01\x00\xC8", 5);
+  b += 5;
+  // 2 literals ('A' and 'B') and then a match (offset 1, length 4).
+  memcpy(b, "\x20\x41\x42\x01\x00", 5);
+  b += 5;
+  // The last sequence: 15 + 255 + 30 = 300 literals ('0' ..= '9', repeated).
+  memcpy(b, "\xF0\xFF\x1E", 3);
+  b += 3;
+  for (i = 0; i < 300; i++) {
+    *b++ = (uint8_t)('0' + (i % 10));
+  }
+  // End mark.
+  memcpy(b, "\x00\x00\x00\x00", 4);
+  b += 4;
+
+  uint8_t* w = g_want_array_u8;
+  memset(w, 'a', 220);
+  w += 220;
+  *w++ = 'A';
+  memset(w, 'B', 5);
+  w += 5;
+  for (i = 0; i < 300; i++) {
+    *w++ = (uint8_t)('0' + (i % 10));
+  }
+
+  wuffs_base__io_buffer have = wuffs_base__ptr_u8__writer(a, 4096);
+  wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+      a + src_offset, (size_t)(b - a) - src_offset, true);
+  wuffs_base__io_buffer want = wuffs_base__ptr_u8__reader(
+      g_want_array_u8, (size_t)(w - g_want_array_u8), true);
+
+  wuffs_lz4__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_lz4__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  CHECK_STATUS("transform_io", wuffs_lz4__decoder__transform_io(
+                                   &dec, &have, &src, g_work_slice_u8));
+  return check_io_buffers_equal("", &have, &want);
+}
+
+const char*  //
+test_wuffs_lz4_decode_interface() {
+  CHECK_FOCUS(__func__);
+  wuffs_lz4__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_lz4__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  return do_test__wuffs_base__io_transformer(
+      wuffs_lz4__decoder__upcast_as__wuffs_base__io_transformer(&dec),
+      "test/data/romeo.txt.lz4", 0, SIZE_MAX, 942, 0x0A);
+}
+
+const char*  //
+wuffs_lz4_decode(wuffs_base__io_buffer* dst,
+                 wuffs_base__io_buffer* src,
+                 uint32_t wuffs_initialize_flags,
+                 uint64_t wlimit,
+                 uint64_t rlimit) {
+  wuffs_lz4__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_lz4__decoder__initialize(&dec, sizeof dec, WUFFS_VERSION,
+                                              wuffs_initialize_flags));
+
+  while (true) {
+    wuffs_base__io_buffer limited_dst = make_limited_writer(*dst, wlimit);
+    wuffs_base__io_buffer limited_src = make_limited_reader(*src, rlimit);
+
+    wuffs_base__status status = wuffs_lz4__decoder__transform_io(
+        &dec, &limited_dst, &limited_src, g_work_slice_u8);
+
+    dst->meta.wi += limited_dst.meta.wi;
+    src->meta.ri += limited_src.meta.ri;
+
+    if (((wlimit < UINT64_MAX) &&
+         (status.repr == wuffs_base__suspension__short_write)) ||
+        ((rlimit < UINT64_MAX) &&
+         (status.repr == wuffs_base__suspension__short_read))) {
+      continue;
+    }
+    return status.repr;
+  }
+}
+
+const char*  //
+do_test_wuffs_lz4_checksum(bool ignore_checksum, uint32_t bad_checksum) {
+  wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+
+  CHECK_STRING(read_file(&src, g_lz4_midsummer_gt.src_filename));
+
+  // Flip a bit in the content checksum, which is the last 4 bytes of the file.
+  if (src.meta.wi < 4) {
+    RETURN_FAIL("source file was too short");
+  }
+  if (bad_checksum) {
+    src.data.ptr[src.meta.wi - 1 - (bad_checksum & 3)] ^= 1;
+  }
+
+  int end_limit;  // The rlimit, relative to the end of the data.
+  for (end_limit = 0; end_limit < 10; end_limit++) {
+    wuffs_lz4__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_lz4__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    wuffs_lz4__decoder__set_ignore_checksum(&dec, ignore_checksum);
+    have.meta.wi = 0;
+    src.meta.ri = 0;
+
+    // Decode the src data in 1 or 2 chunks, depending on whether end_limit is
+    // or isn't zero.
+    int i;
+    for (i = 0; i < 2; i++) {
+      uint64_t rlimit = UINT64_MAX;
+      const char* want_z = NULL;
+      if (i == 0) {
+        if (end_limit == 0) {
+          continue;
+        }
+        if (src.meta.wi < end_limit) {
+          RETURN_FAIL("end_limit=%d: not enough source data", end_limit);
+        }
+        rlimit = src.meta.wi - (uint64_t)(end_limit);
+        want_z = wuffs_base__suspension__short_read;
+      } else {
+        want_z = (bad_checksum && !ignore_checksum)
+                     ? wuffs_lz4__error__bad_checksum
+                     : NULL;
+      }
+
+      wuffs_base__io_buffer limited_src = make_limited_reader(src, rlimit);
+      wuffs_base__status have_z = wuffs_lz4__decoder__transform_io(
+          &dec, &have, &limited_src, g_work_slice_u8);
+      src.meta.ri += limited_src.meta.ri;
+      if (have_z.repr != want_z) {
+        RETURN_FAIL("end_limit=%d: have \"%s\", want \"%s\"", end_limit,
+                    have_z.repr, want_z);
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_lz4_checksum_ignore() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_lz4_checksum(true, 4 | 0);
+}
+
+const char*  //
+test_wuffs_lz4_checksum_verify_bad0() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_lz4_checksum(false, 4 | 0);
+}
+
+const char*  //
+test_wuffs_lz4_checksum_verify_bad3() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_lz4_checksum(false, 4 | 3);
+}
+
+const char*  //
+test_wuffs_lz4_checksum_verify_good() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_lz4_checksum(false, 0);
+}
+
+const char*  //
+test_wuffs_lz4_decode_empty() {
+  CHECK_FOCUS(__func__);
+  return do_test_io_buffers(wuffs_lz4_decode, &g_lz4_empty_gt, UINT64_MAX,
+                            UINT64_MAX);
+}
+
+const char*  //
+test_wuffs_lz4_decode_midsummer() {
+  CHECK_FOCUS(__func__);
+  return do_test_io_buffers(wuffs_lz4_decode, &g_lz4_midsummer_gt, UINT64_MAX,
+                            UINT64_MAX);
+}
+
+const char*  //
+test_wuffs_lz4_decode_pi() {
+  CHECK_FOCUS(__func__);
+  return do_test_io_buffers(wuffs_lz4_decode, &g_lz4_pi_gt, UINT64_MAX,
+                            UINT64_MAX);
+}
+
+const char*  //
+test_wuffs_lz4_decode_pi_many_small_writes_reads() {
+  CHECK_FOCUS(__func__);
+  return do_test_io_buffers(wuffs_lz4_decode, &g_lz4_pi_gt, 59, 61);
+}
+
+  // ---------------- Mimic Tests
+
+#ifdef WUFFS_MIMIC
+
+const char*  //
+test_mimic_lz4_decode_midsummer() {
+  CHECK_FOCUS(__func__);
+  return do_test_io_buffers(mimic_lz4_decode, &g_lz4_midsummer_gt, UINT64_MAX,
+                            UINT64_MAX);
+}
+
+const char*  //
+test_mimic_lz4_decode_pi() {
+  CHECK_FOCUS(__func__);
+  return do_test_io_buffers(mimic_lz4_decode, &g_lz4_pi_gt, UINT64_MAX,
+                            UINT64_MAX);
+}
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- LZ4 Benches
+
+const char*  //
+bench_wuffs_lz4_decode_10k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_lz4_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      tcounter_dst, &g_lz4_midsummer_gt, UINT64_MAX, UINT64_MAX, 300);
+}
+
+const char*  //
+bench_wuffs_lz4_decode_100k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_lz4_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      tcounter_dst, &g_lz4_pi_gt, UINT64_MAX, UINT64_MAX, 30);
+}
+
+const char*  //
+bench_wuffs_lz4_decode_100k_many_big_reads() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_lz4_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      tcounter_dst, &g_lz4_pi_gt, UINT64_MAX, 4096, 30);
+}
+
+  // ---------------- Mimic Benches
+
+#ifdef WUFFS_MIMIC
+
+const char*  //
+bench_mimic_lz4_decode_10k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(mimic_lz4_decode, 0, tcounter_dst,
+                             &g_lz4_midsummer_gt, UINT64_MAX, UINT64_MAX, 300);
+}
+
+const char*  //
+bench_mimic_lz4_decode_100k() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(mimic_lz4_decode, 0, tcounter_dst, &g_lz4_pi_gt,
+                             UINT64_MAX, UINT64_MAX, 30);
+}
+
+const char*  //
+bench_mimic_lz4_decode_100k_many_big_reads() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(mimic_lz4_decode, 0, tcounter_dst, &g_lz4_pi_gt,
+                             UINT64_MAX, 4096, 30);
+}
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- Manifest
+
+proc g_tests[] = {
+
+    test_wuffs_lz4_checksum_ignore,
+    test_wuffs_lz4_checksum_verify_bad0,
+    test_wuffs_lz4_checksum_verify_bad3,
+    test_wuffs_lz4_checksum_verify_good,
+    test_wuffs_lz4_decode_empty,
+    test_wuffs_lz4_decode_in_place,
+    test_wuffs_lz4_decode_interface,
+    test_wuffs_lz4_decode_midsummer,
+    test_wuffs_lz4_decode_pi,
+    test_wuffs_lz4_decode_pi_many_small_writes_reads,
+
+#ifdef WUFFS_MIMIC
+
+    test_mimic_lz4_decode_midsummer,
+    test_mimic_lz4_decode_pi,
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+proc g_benches[] = {
+
+    bench_wuffs_lz4_decode_10k,
+    bench_wuffs_lz4_decode_100k,
+    bench_wuffs_lz4_decode_100k_many_big_reads,
+
+#ifdef WUFFS_MIMIC
+
+    bench_mimic_lz4_decode_10k,
+    bench_mimic_lz4_decode_100k,
+    bench_mimic_lz4_decode_100k_many_big_reads,
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+int  //
+main(int argc, char** argv) {
+  g_proc_package_name = "std/lz4";
+  return test_main(argc, argv, g_tests, g_benches);
+}
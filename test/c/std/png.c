@@ -0,0 +1,698 @@
+// Copyright 2020 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+This test program is typically run indirectly, by the "wuffs test" or "wuffs
+bench" commands. These commands take an optional "-mimic" flag to check that
+Wuffs' output mimics (i.e. exactly matches) other libraries' output, such as
+giflib for GIF, libpng for PNG, etc.
+
+To manually run this test:
+
+for CC in clang gcc; do
+  $CC -std=c99 -Wall -Werror png.c && ./a.out
+  rm -f a.out
+done
+
+Each edition should print "PASS", amongst other information, and exit(0).
+
+Add the "wuffs mimic cflags" (everything after the colon below) to the C
+compiler flags (after the .c file) to run the mimic tests.
+
+To manually run the benchmarks, replace "-Wall -Werror" with "-O3" and replace
+the first "./a.out" with "./a.out -bench". Combine these changes with the
+"wuffs mimic cflags" to run the mimic benchmarks.
+*/
+
+// !! wuffs mimic cflags: -DWUFFS_MIMIC -lpng
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c whitelist which parts of Wuffs to build. That file contains
+// the entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__CRC32
+#define WUFFS_CONFIG__MODULE__DEFLATE
+#define WUFFS_CONFIG__MODULE__PNG
+#define WUFFS_CONFIG__MODULE__ZLIB
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../../release/c/wuffs-unsupported-snapshot.c"
+#include "../testlib/testlib.c"
+#ifdef WUFFS_MIMIC
+#include "../mimiclib/png.c"
+#endif
+
+// ---------------- PNG Tests
+
+const char*  //
+wuffs_png_decode(wuffs_base__io_buffer* dst,
+                 uint32_t wuffs_initialize_flags,
+                 wuffs_base__pixel_format pixfmt,
+                 wuffs_base__io_buffer* src) {
+  wuffs_png__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_png__decoder__initialize(&dec, sizeof dec, WUFFS_VERSION,
+                                              wuffs_initialize_flags));
+
+  wuffs_base__image_config ic = ((wuffs_base__image_config){});
+  CHECK_STATUS("decode_image_config",
+               wuffs_png__decoder__decode_image_config(&dec, &ic, src));
+  wuffs_base__pixel_config__set(&ic.pixcfg, pixfmt.repr,
+                                WUFFS_BASE__PIXEL_SUBSAMPLING__NONE,
+                                wuffs_base__pixel_config__width(&ic.pixcfg),
+                                wuffs_base__pixel_config__height(&ic.pixcfg));
+
+  wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+  CHECK_STATUS("set_from_slice", wuffs_base__pixel_buffer__set_from_slice(
+                                     &pb, &ic.pixcfg, g_pixel_slice_u8));
+  CHECK_STATUS("decode_frame",
+               wuffs_png__decoder__decode_frame(&dec, &pb, src,
+                                                WUFFS_BASE__PIXEL_BLEND__SRC,
+                                                g_work_slice_u8, NULL));
+  return copy_to_io_buffer_from_pixel_buffer(
+      dst, &pb, wuffs_base__pixel_config__bounds(&ic.pixcfg));
+}
+
+const char*  //
+do_test_wuffs_png_decode_status(const char* filename,
+                                bool ignore_checksum,
+                                const char* want_status_repr) {
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, filename));
+
+  wuffs_png__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_png__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_png__decoder__set_ignore_checksum(&dec, ignore_checksum);
+
+  wuffs_base__image_config ic = ((wuffs_base__image_config){});
+  wuffs_base__status status =
+      wuffs_png__decoder__decode_image_config(&dec, &ic, &src);
+  if (wuffs_base__status__is_ok(&status)) {
+    wuffs_base__pixel_config__set(
+        &ic.pixcfg, WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+        WUFFS_BASE__PIXEL_SUBSAMPLING__NONE,
+        wuffs_base__pixel_config__width(&ic.pixcfg),
+        wuffs_base__pixel_config__height(&ic.pixcfg));
+    wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+    CHECK_STATUS("set_from_slice", wuffs_base__pixel_buffer__set_from_slice(
+                                       &pb, &ic.pixcfg, g_pixel_slice_u8));
+    status = wuffs_png__decoder__decode_frame(&dec, &pb, &src,
+                                              WUFFS_BASE__PIXEL_BLEND__SRC,
+                                              g_work_slice_u8, NULL);
+  }
+  if (status.repr != want_status_repr) {
+    RETURN_FAIL("have \"%s\", want \"%s\"", status.repr, want_status_repr);
+  }
+  return NULL;
+}
+
+// ----
+
+const char*  //
+test_wuffs_png_decode_bad_checksum() {
+  CHECK_FOCUS(__func__);
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hippopotamus.regular.png"));
+
+  // Flip a bit in the IHDR chunk's CRC-32 checksum, which is the 4 bytes
+  // after the 8 byte signature, the 8 byte chunk header and 13 bytes of data.
+  g_src_array_u8[29] ^= 0x01;
+
+  int i;
+  for (i = 0; i < 2; i++) {
+    bool ignore_checksum = i > 0;
+    wuffs_png__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_png__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    wuffs_png__decoder__set_ignore_checksum(&dec, ignore_checksum);
+
+    src.meta.ri = 0;
+    wuffs_base__image_config ic = ((wuffs_base__image_config){});
+    wuffs_base__status status =
+        wuffs_png__decoder__decode_image_config(&dec, &ic, &src);
+    const char* want = ignore_checksum ? NULL : wuffs_png__error__bad_checksum;
+    if (status.repr != want) {
+      RETURN_FAIL("ignore_checksum=%d: have \"%s\", want \"%s\"",
+                  (int)ignore_checksum, status.repr, want);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_png_decode_frame_banded() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/bricks-dither.png",
+      "test/data/bricks-gray.png",
+      "test/data/hippopotamus.masked-with-muybridge.png",
+      "test/data/hippopotamus.regular.png",
+      "test/data/pjw-thumbnail.png",
+  };
+  const wuffs_base__rect_ie_u32 crops[] = {
+      {0, 0, 0, 0},
+      {3, 5, 40, 30},
+  };
+  const uint32_t band_heights[] = {1, 7, 100000};
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    int c;
+    for (c = 0; c < WUFFS_TESTLIB_ARRAY_SIZE(crops); c++) {
+      uint32_t scale_shift;
+      for (scale_shift = 0; scale_shift <= 1; scale_shift++) {
+        int b;
+        for (b = 0; b < WUFFS_TESTLIB_ARRAY_SIZE(band_heights); b++) {
+          int r;
+          for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+            wuffs_png__decoder full;
+            CHECK_STATUS(
+                "initialize (full)",
+                wuffs_png__decoder__initialize(
+                    &full, sizeof full, WUFFS_VERSION,
+                    WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+            wuffs_png__decoder banded;
+            CHECK_STATUS(
+                "initialize (banded)",
+                wuffs_png__decoder__initialize(
+                    &banded, sizeof banded, WUFFS_VERSION,
+                    WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+            wuffs_base__decode_frame_options opts =
+                wuffs_base__null_decode_frame_options();
+            wuffs_base__decode_frame_options__set_scale_shift(&opts,
+                                                              scale_shift);
+            wuffs_base__decode_frame_options__set_crop_rect(&opts, crops[c]);
+            wuffs_base__decode_frame_options__set_band_height(&opts,
+                                                              band_heights[b]);
+            const char* z = do_test__wuffs_base__image_decoder_banded(
+                wuffs_png__decoder__upcast_as__wuffs_base__image_decoder(&full),
+                wuffs_png__decoder__upcast_as__wuffs_base__image_decoder(
+                    &banded),
+                filenames[i], &opts, rlimits[r]);
+            if (z) {
+              RETURN_FAIL("%s, c=%d, scale_shift=%" PRIu32 ", b=%d, r=%d: %s",
+                          filenames[i], c, scale_shift, b, r, z);
+            }
+          }
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_png_decode_frame_config() {
+  CHECK_FOCUS(__func__);
+  wuffs_png__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_png__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+  wuffs_base__frame_config fc = ((wuffs_base__frame_config){});
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hat.png"));
+  CHECK_STATUS("decode_frame_config #0",
+               wuffs_png__decoder__decode_frame_config(&dec, &fc, &src));
+
+  wuffs_base__status status =
+      wuffs_png__decoder__decode_frame_config(&dec, &fc, &src);
+  if (status.repr != wuffs_base__note__end_of_data) {
+    RETURN_FAIL("decode_frame_config #1: have \"%s\", want \"%s\"", status.repr,
+                wuffs_base__note__end_of_data);
+  }
+
+  // Skipping the frame reads up to the IEND chunk's length and type. Only its
+  // CRC-32 checksum remains.
+  if ((src.meta.ri + 4) != src.meta.wi) {
+    RETURN_FAIL("at end of data: ri (%zu) + 4 doesn't equal wi (%zu)",
+                src.meta.ri, src.meta.wi);
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_png_decode_frame_cropped() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/bricks-color.png",
+      "test/data/bricks-dither.png",
+      "test/data/bricks-gray.png",
+      "test/data/harvesters.png",
+      "test/data/hippopotamus.masked-with-muybridge.png",
+      "test/data/pjw-thumbnail.png",
+  };
+  const wuffs_base__rect_ie_u32 crops[] = {
+      {0, 0, 1, 1},
+      {3, 5, 40, 30},
+      {9, 0, 10, 100000},
+      {17, 2, 100000, 31},
+      {100000, 100000, 100001, 100001},
+  };
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    int c;
+    for (c = 0; c < WUFFS_TESTLIB_ARRAY_SIZE(crops); c++) {
+      uint32_t scale_shift;
+      for (scale_shift = 0; scale_shift <= 1; scale_shift++) {
+        int r;
+        for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+          wuffs_png__decoder full;
+          CHECK_STATUS(
+              "initialize (full)",
+              wuffs_png__decoder__initialize(
+                  &full, sizeof full, WUFFS_VERSION,
+                  WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+          wuffs_png__decoder cropped;
+          CHECK_STATUS(
+              "initialize (cropped)",
+              wuffs_png__decoder__initialize(
+                  &cropped, sizeof cropped, WUFFS_VERSION,
+                  WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+          wuffs_base__decode_frame_options opts =
+              wuffs_base__null_decode_frame_options();
+          wuffs_base__decode_frame_options__set_scale_shift(&opts, scale_shift);
+          wuffs_base__decode_frame_options__set_crop_rect(&opts, crops[c]);
+          const char* z = do_test__wuffs_base__image_decoder_scaled(
+              wuffs_png__decoder__upcast_as__wuffs_base__image_decoder(&full),
+              wuffs_png__decoder__upcast_as__wuffs_base__image_decoder(
+                  &cropped),
+              filenames[i], &opts, rlimits[r]);
+          if (z) {
+            RETURN_FAIL("%s, c=%d, scale_shift=%" PRIu32 ", r=%d: %s",
+                        filenames[i], c, scale_shift, r, z);
+          }
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_png_decode_frame_scaled() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/bricks-color.png",
+      "test/data/bricks-nodither.png",
+      "test/data/hat.png",
+      "test/data/hibiscus.primitive.png",
+      "test/data/hippopotamus.regular.png",
+      "test/data/pjw-thumbnail.png",
+  };
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    uint32_t scale_shift;
+    for (scale_shift = 1; scale_shift <= 3; scale_shift++) {
+      int r;
+      for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+        wuffs_png__decoder full;
+        CHECK_STATUS(
+            "initialize (full)",
+            wuffs_png__decoder__initialize(
+                &full, sizeof full, WUFFS_VERSION,
+                WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+        wuffs_png__decoder scaled;
+        CHECK_STATUS(
+            "initialize (scaled)",
+            wuffs_png__decoder__initialize(
+                &scaled, sizeof scaled, WUFFS_VERSION,
+                WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+        wuffs_base__decode_frame_options opts =
+            wuffs_base__null_decode_frame_options();
+        wuffs_base__decode_frame_options__set_scale_shift(&opts, scale_shift);
+        const char* z = do_test__wuffs_base__image_decoder_scaled(
+            wuffs_png__decoder__upcast_as__wuffs_base__image_decoder(&full),
+            wuffs_png__decoder__upcast_as__wuffs_base__image_decoder(&scaled),
+            filenames[i], &opts, rlimits[r]);
+        if (z) {
+          RETURN_FAIL("%s, scale_shift=%" PRIu32 ", r=%d: %s", filenames[i],
+                      scale_shift, r, z);
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_png_decode_interface() {
+  CHECK_FOCUS(__func__);
+  wuffs_png__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_png__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  return do_test__wuffs_base__image_decoder(
+      wuffs_png__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      "test/data/hippopotamus.regular.png", 0, SIZE_MAX, 36, 28, 0xFFF5F5F5);
+}
+
+const char*  //
+test_wuffs_png_decode_portable_filters() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/bricks-color.png",
+      "test/data/harvesters.png",
+      "test/data/hibiscus.primitive.png",
+      "test/data/hippopotamus.masked-with-muybridge.png",
+  };
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    wuffs_png__decoder full;
+    CHECK_STATUS("initialize (full)",
+                 wuffs_png__decoder__initialize(
+                     &full, sizeof full, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    wuffs_png__decoder portable;
+    CHECK_STATUS("initialize (portable)",
+                 wuffs_png__decoder__initialize(
+                     &portable, sizeof portable, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    // Skip the CPU feature detection, so that the SIMD code paths are never
+    // taken. The output should be the same either way.
+    portable.private_impl.f_cpu_arch_checked = true;
+    portable.private_impl.f_have_x86_sse42 = false;
+
+    wuffs_base__decode_frame_options opts =
+        wuffs_base__null_decode_frame_options();
+    const char* z = do_test__wuffs_base__image_decoder_scaled(
+        wuffs_png__decoder__upcast_as__wuffs_base__image_decoder(&full),
+        wuffs_png__decoder__upcast_as__wuffs_base__image_decoder(&portable),
+        filenames[i], &opts, UINT64_MAX);
+    if (z) {
+      RETURN_FAIL("%s: %s", filenames[i], z);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_png_decode_unsupported_interlace() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_png_decode_status(
+      "test/data/hippopotamus.interlaced.png", false,
+      wuffs_png__error__unsupported_png_file);
+}
+
+  // ---------------- Mimic Tests
+
+#ifdef WUFFS_MIMIC
+
+const char*  //
+do_test_mimic_png_decode(const char* filename) {
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, filename));
+
+  src.meta.ri = 0;
+  wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  CHECK_STRING(wuffs_png_decode(
+      &have, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      &src));
+
+  src.meta.ri = 0;
+  wuffs_base__io_buffer want = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+  CHECK_STRING(mimic_png_decode(
+      &want, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      &src));
+
+  return check_io_buffers_equal("", &have, &want);
+}
+
+const char*  //
+test_mimic_png_decode_bricks_dither() {
+  CHECK_FOCUS(__func__);
+  return do_test_mimic_png_decode("test/data/bricks-dither.png");
+}
+
+const char*  //
+test_mimic_png_decode_bricks_nodither() {
+  CHECK_FOCUS(__func__);
+  return do_test_mimic_png_decode("test/data/bricks-nodither.png");
+}
+
+const char*  //
+test_mimic_png_decode_harvesters() {
+  CHECK_FOCUS(__func__);
+  return do_test_mimic_png_decode("test/data/harvesters.png");
+}
+
+const char*  //
+test_mimic_png_decode_hibiscus_primitive() {
+  CHECK_FOCUS(__func__);
+  return do_test_mimic_png_decode("test/data/hibiscus.primitive.png");
+}
+
+const char*  //
+test_mimic_png_decode_hippopotamus_masked() {
+  CHECK_FOCUS(__func__);
+  return do_test_mimic_png_decode(
+      "test/data/hippopotamus.masked-with-muybridge.png");
+}
+
+const char*  //
+test_mimic_png_decode_pjw_thumbnail() {
+  CHECK_FOCUS(__func__);
+  return do_test_mimic_png_decode("test/data/pjw-thumbnail.png");
+}
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- PNG Benches
+
+const char*  //
+do_bench_png_decode(const char* (*decode_func)(wuffs_base__io_buffer*,
+                                               uint32_t wuffs_initialize_flags,
+                                               wuffs_base__pixel_format,
+                                               wuffs_base__io_buffer*),
+                    uint32_t wuffs_initialize_flags,
+                    const char* filename,
+                    wuffs_base__pixel_format pixfmt,
+                    uint64_t iters_unscaled) {
+  wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, filename));
+
+  bench_start();
+  uint64_t n_bytes = 0;
+  uint64_t i;
+  uint64_t iters = iters_unscaled * g_flags.iterscale;
+  for (i = 0; i < iters; i++) {
+    have.meta.wi = 0;
+    src.meta.ri = 0;
+    CHECK_STRING(decode_func(&have, wuffs_initialize_flags, pixfmt, &src));
+    n_bytes += have.meta.wi;
+  }
+  bench_finish(iters, n_bytes);
+  return NULL;
+}
+
+const char*  //
+bench_wuffs_png_decode_image_19k_8bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_png_decode(
+      wuffs_png_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      "test/data/bricks-gray.png",
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      50);
+}
+
+const char*  //
+bench_wuffs_png_decode_image_40k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_png_decode(
+      wuffs_png_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      "test/data/hat.png",
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      30);
+}
+
+const char*  //
+bench_wuffs_png_decode_image_77k_8bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_png_decode(
+      wuffs_png_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      "test/data/bricks-dither.png",
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      30);
+}
+
+const char*  //
+bench_wuffs_png_decode_image_552k_32bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_png_decode(
+      wuffs_png_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      "test/data/hibiscus.primitive.png",
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      4);
+}
+
+const char*  //
+bench_wuffs_png_decode_image_4002k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_png_decode(
+      wuffs_png_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      "test/data/harvesters.png",
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      1);
+}
+
+  // ---------------- Mimic Benches
+
+#ifdef WUFFS_MIMIC
+
+const char*  //
+bench_mimic_png_decode_image_19k_8bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_png_decode(
+      mimic_png_decode, 0, "test/data/bricks-gray.png",
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      50);
+}
+
+const char*  //
+bench_mimic_png_decode_image_40k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_png_decode(
+      mimic_png_decode, 0, "test/data/hat.png",
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      30);
+}
+
+const char*  //
+bench_mimic_png_decode_image_77k_8bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_png_decode(
+      mimic_png_decode, 0, "test/data/bricks-dither.png",
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      30);
+}
+
+const char*  //
+bench_mimic_png_decode_image_552k_32bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_png_decode(
+      mimic_png_decode, 0, "test/data/hibiscus.primitive.png",
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      4);
+}
+
+const char*  //
+bench_mimic_png_decode_image_4002k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_png_decode(
+      mimic_png_decode, 0, "test/data/harvesters.png",
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      1);
+}
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- Manifest
+
+proc g_tests[] = {
+
+    test_wuffs_png_decode_bad_checksum,
+    test_wuffs_png_decode_frame_banded,
+    test_wuffs_png_decode_frame_config,
+    test_wuffs_png_decode_frame_cropped,
+    test_wuffs_png_decode_frame_scaled,
+    test_wuffs_png_decode_interface,
+    test_wuffs_png_decode_portable_filters,
+    test_wuffs_png_decode_unsupported_interlace,
+
+#ifdef WUFFS_MIMIC
+
+    test_mimic_png_decode_bricks_dither,
+    test_mimic_png_decode_bricks_nodither,
+    test_mimic_png_decode_harvesters,
+    test_mimic_png_decode_hibiscus_primitive,
+    test_mimic_png_decode_hippopotamus_masked,
+    test_mimic_png_decode_pjw_thumbnail,
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+proc g_benches[] = {
+
+    bench_wuffs_png_decode_image_19k_8bpp,
+    bench_wuffs_png_decode_image_40k_24bpp,
+    bench_wuffs_png_decode_image_77k_8bpp,
+    bench_wuffs_png_decode_image_552k_32bpp,
+    bench_wuffs_png_decode_image_4002k_24bpp,
+
+#ifdef WUFFS_MIMIC
+
+    bench_mimic_png_decode_image_19k_8bpp,
+    bench_mimic_png_decode_image_40k_24bpp,
+    bench_mimic_png_decode_image_77k_8bpp,
+    bench_mimic_png_decode_image_552k_32bpp,
+    bench_mimic_png_decode_image_4002k_24bpp,
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+int  //
+main(int argc, char** argv) {
+  g_proc_package_name = "std/png";
+  return test_main(argc, argv, g_tests, g_benches);
+}
@@ -101,6 +101,175 @@ colors_differ(wuffs_base__color_u32_argb_premul color0,
   return false;
 }
 
+// g_palette_lookup is a global, not a local, as it is relatively large.
+wuffs_base__pixel_palette_lookup g_palette_lookup;
+
+void  //
+fill_palette_with_pattern(wuffs_base__slice_u8 palette) {
+  size_t i;
+  for (i = 0; (i < 256) && ((4 * i) < palette.len); i++) {
+    palette.ptr[(4 * i) + 0] = (uint8_t)(i * 0x3B);
+    palette.ptr[(4 * i) + 1] = (uint8_t)(i * 0x65);
+    palette.ptr[(4 * i) + 2] = (uint8_t)(i * 0x17);
+    palette.ptr[(4 * i) + 3] = (i < 0xE0) ? 0xFF : (uint8_t)(i * 0x29);
+  }
+}
+
+const char*  //
+test_wuffs_pixel_palette_lookup() {
+  CHECK_FOCUS(__func__);
+
+  uint8_t palette_array[1024];
+  fill_palette_with_pattern(wuffs_base__make_slice_u8(
+      &palette_array[0], WUFFS_TESTLIB_ARRAY_SIZE(palette_array)));
+
+  const uint32_t palette_pixfmt_reprs[] = {
+      WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL,
+      WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_PREMUL,
+  };
+
+  // Include palettes with fewer than 256 elements.
+  const size_t palette_lens[] = {0, 4 * 1, 4 * 17, 1024};
+
+  int f;
+  for (f = 0; f < WUFFS_TESTLIB_ARRAY_SIZE(palette_pixfmt_reprs); f++) {
+    wuffs_base__pixel_format palette_pixfmt =
+        wuffs_base__make_pixel_format(palette_pixfmt_reprs[f]);
+    int l;
+    for (l = 0; l < WUFFS_TESTLIB_ARRAY_SIZE(palette_lens); l++) {
+      wuffs_base__slice_u8 palette =
+          wuffs_base__make_slice_u8(&palette_array[0], palette_lens[l]);
+      CHECK_STATUS("prepare", wuffs_base__pixel_palette_lookup__prepare(
+                                  &g_palette_lookup, palette, palette_pixfmt));
+
+      // Look up enough colors to have cache hits, cache misses and cache
+      // evictions, and check that they all agree with the slow path.
+      uint32_t i;
+      for (i = 0; i < 20000; i++) {
+        uint32_t a = (i < 10000) ? 0xFF : (uint8_t)(i * 0x47);
+        uint32_t r = ((uint8_t)(i * 0x1F)) * a / 0xFF;
+        uint32_t g = ((uint8_t)(i * 0x0B)) * a / 0xFF;
+        uint32_t b = ((uint8_t)((i >> 2) * 0x35)) * a / 0xFF;
+        wuffs_base__color_u32_argb_premul c =
+            (a << 24) | (r << 16) | (g << 8) | (b << 0);
+        uint8_t want = wuffs_base__pixel_palette__closest_element(
+            palette, palette_pixfmt, c);
+        uint8_t have = wuffs_base__pixel_palette_lookup__closest_element(
+            &g_palette_lookup, c);
+        if (have != want) {
+          RETURN_FAIL("f=%d, l=%d, c=0x%08" PRIX32 ": have %" PRIu8
+                      ", want %" PRIu8,
+                      f, l, c, have, want);
+        }
+      }
+    }
+  }
+
+  CHECK_STATUS(
+      "prepare",
+      wuffs_base__pixel_palette_lookup__prepare(
+          &g_palette_lookup,
+          wuffs_base__make_slice_u8(&palette_array[0],
+                                    WUFFS_TESTLIB_ARRAY_SIZE(palette_array)),
+          wuffs_base__make_pixel_format(
+              WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL)));
+  wuffs_base__status status = wuffs_base__pixel_palette_lookup__prepare(
+      &g_palette_lookup, wuffs_base__empty_slice_u8(),
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL));
+  if (status.repr != wuffs_base__error__unsupported_option) {
+    RETURN_FAIL("prepare (non-indexed): have \"%s\", want \"%s\"", status.repr,
+                wuffs_base__error__unsupported_option);
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_pixel_swizzler_prepare_quantizing() {
+  CHECK_FOCUS(__func__);
+
+  uint8_t palette_array[1024];
+  wuffs_base__slice_u8 palette = wuffs_base__make_slice_u8(
+      &palette_array[0], WUFFS_TESTLIB_ARRAY_SIZE(palette_array));
+  fill_palette_with_pattern(palette);
+  wuffs_base__pixel_format dst_pixfmt = wuffs_base__make_pixel_format(
+      WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL);
+
+  const uint32_t src_pixfmt_reprs[] = {
+      WUFFS_BASE__PIXEL_FORMAT__Y,
+      WUFFS_BASE__PIXEL_FORMAT__BGR,
+      WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+      WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+      WUFFS_BASE__PIXEL_FORMAT__BGRX,
+  };
+
+  const uint32_t width = 1000;
+  if ((g_src_slice_u8.len < (4 * width)) || (g_have_slice_u8.len < width)) {
+    return "src or have slice is too short";
+  }
+  size_t i;
+  for (i = 0; i < (4 * width); i++) {
+    g_src_slice_u8.ptr[i] = (uint8_t)((i * 0x9B) ^ (i >> 7));
+  }
+
+  int s;
+  for (s = 0; s < WUFFS_TESTLIB_ARRAY_SIZE(src_pixfmt_reprs); s++) {
+    wuffs_base__pixel_format src_pixfmt =
+        wuffs_base__make_pixel_format(src_pixfmt_reprs[s]);
+    uint32_t src_bytes_per_pixel =
+        wuffs_base__pixel_format__bits_per_pixel(&src_pixfmt) / 8;
+
+    // Use the src pixels as a one-row pixel buffer, so that color_u32_at
+    // gives each src pixel's premultiplied color.
+    wuffs_base__pixel_config src_pixcfg = ((wuffs_base__pixel_config){});
+    wuffs_base__pixel_config__set(&src_pixcfg, src_pixfmt_reprs[s],
+                                  WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, width,
+                                  1);
+    wuffs_base__pixel_buffer src_pixbuf = ((wuffs_base__pixel_buffer){});
+    CHECK_STATUS("set_from_slice",
+                 wuffs_base__pixel_buffer__set_from_slice(
+                     &src_pixbuf, &src_pixcfg, g_src_slice_u8));
+
+    wuffs_base__pixel_swizzler swizzler;
+    CHECK_STATUS("prepare_quantizing",
+                 wuffs_base__pixel_swizzler__prepare_quantizing(
+                     &swizzler, &g_palette_lookup, dst_pixfmt, palette,
+                     src_pixfmt, WUFFS_BASE__PIXEL_BLEND__SRC));
+    uint64_t have_n = wuffs_base__pixel_swizzler__swizzle_interleaved(
+        &swizzler, wuffs_base__make_slice_u8(g_have_slice_u8.ptr, width),
+        wuffs_base__empty_slice_u8(),
+        wuffs_base__make_slice_u8(g_src_slice_u8.ptr,
+                                  width * src_bytes_per_pixel));
+    if (have_n != width) {
+      RETURN_FAIL("s=%d: n: have %" PRIu64 ", want %" PRIu32, s, have_n, width);
+    }
+
+    uint32_t x;
+    for (x = 0; x < width; x++) {
+      uint8_t want = wuffs_base__pixel_palette__closest_element(
+          palette, dst_pixfmt,
+          wuffs_base__pixel_buffer__color_u32_at(&src_pixbuf, x, 0));
+      uint8_t have = g_have_slice_u8.ptr[x];
+      if (have != want) {
+        RETURN_FAIL("s=%d, x=%" PRIu32 ": have %" PRIu8 ", want %" PRIu8, s, x,
+                    have, want);
+      }
+    }
+  }
+
+  // SRC_OVER onto palette indexes is only supported for opaque sources.
+  wuffs_base__pixel_swizzler swizzler;
+  wuffs_base__status status = wuffs_base__pixel_swizzler__prepare_quantizing(
+      &swizzler, &g_palette_lookup, dst_pixfmt, palette,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      WUFFS_BASE__PIXEL_BLEND__SRC_OVER);
+  if (status.repr != wuffs_base__error__unsupported_pixel_swizzler_option) {
+    RETURN_FAIL("prepare_quantizing (SRC_OVER): have \"%s\", want \"%s\"",
+                status.repr,
+                wuffs_base__error__unsupported_pixel_swizzler_option);
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_pixel_swizzler_swizzle() {
   CHECK_FOCUS(__func__);
@@ -130,6 +299,10 @@ test_wuffs_pixel_swizzler_swizzle() {
           .pixel = 0x55443300,
           .pixfmt_repr = WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
       },
+      {
+          .pixel = 0x55443300,
+          .pixfmt_repr = WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+      },
   };
 
   const struct {
@@ -152,6 +325,14 @@ test_wuffs_pixel_swizzler_swizzle() {
           .pixel = 0x80000040,
           .pixfmt_repr = WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
       },
+      {
+          .pixel = 0x80000040,
+          .pixfmt_repr = WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE,
+      },
+      {
+          .pixel = 0x80000040,
+          .pixfmt_repr = WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL_4X16LE,
+      },
   };
 
   const wuffs_base__pixel_blend blends[] = {
@@ -261,6 +442,366 @@ test_wuffs_pixel_swizzler_swizzle() {
   return NULL;
 }
 
+const char*  //
+test_wuffs_pixel_swizzler_swizzle_planar() {
+  CHECK_FOCUS(__func__);
+
+  // Odd dimensions exercise the partial chroma samples at the right and
+  // bottom edges.
+  const uint32_t width = 37;
+  const uint32_t height = 5;
+  uint8_t dummy_palette_array[1024];
+  wuffs_base__pixel_swizzler swizzler;
+
+  const uint32_t pixsubs[] = {
+      WUFFS_BASE__PIXEL_SUBSAMPLING__444,
+      WUFFS_BASE__PIXEL_SUBSAMPLING__422,
+      WUFFS_BASE__PIXEL_SUBSAMPLING__420,
+  };
+
+  const uint32_t dst_pixfmt_reprs[] = {
+      WUFFS_BASE__PIXEL_FORMAT__BGR,
+      WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+      WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+      WUFFS_BASE__PIXEL_FORMAT__BGRX,
+      WUFFS_BASE__PIXEL_FORMAT__RGB,
+      WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL,
+  };
+
+  // Check the fixed-point conversion against the JFIF floating-point
+  // formulae, over a coarse grid of Y, Cb and Cr values.
+  int yy;
+  for (yy = 0; yy < 256; yy += 15) {
+    int cb;
+    for (cb = 0; cb < 256; cb += 15) {
+      int cr;
+      for (cr = 0; cr < 256; cr += 15) {
+        double fr = yy + (1.402 * (cr - 128));
+        double fg = yy - (0.344136 * (cb - 128)) - (0.714136 * (cr - 128));
+        double fb = yy + (1.772 * (cb - 128));
+        uint32_t ir = (fr < 0) ? 0 : (fr > 255) ? 255 : (uint32_t)(fr + 0.5);
+        uint32_t ig = (fg < 0) ? 0 : (fg > 255) ? 255 : (uint32_t)(fg + 0.5);
+        uint32_t ib = (fb < 0) ? 0 : (fb > 255) ? 255 : (uint32_t)(fb + 0.5);
+        wuffs_base__color_u32_argb_premul want =
+            0xFF000000 | (ir << 16) | (ig << 8) | (ib << 0);
+        wuffs_base__color_u32_argb_premul have =
+            wuffs_base__color_ycc__as__color_u32_argb_premul(
+                (uint8_t)yy, (uint8_t)cb, (uint8_t)cr);
+        if (colors_differ(have, want, 1)) {
+          RETURN_FAIL("ycc=(%d, %d, %d): have 0x%08" PRIX32
+                      ", want 0x%08" PRIX32,
+                      yy, cb, cr, have, want);
+        }
+      }
+    }
+  }
+
+  int s;
+  for (s = 0; s < WUFFS_TESTLIB_ARRAY_SIZE(pixsubs); s++) {
+    // Allocate and fill the src_pixbuf.
+    wuffs_base__pixel_config src_pixcfg = ((wuffs_base__pixel_config){});
+    wuffs_base__pixel_config__set(&src_pixcfg, WUFFS_BASE__PIXEL_FORMAT__YCBCR,
+                                  pixsubs[s], width, height);
+    wuffs_base__pixel_buffer src_pixbuf = ((wuffs_base__pixel_buffer){});
+    CHECK_STATUS("set_from_slice",
+                 wuffs_base__pixel_buffer__set_from_slice(
+                     &src_pixbuf, &src_pixcfg, g_src_slice_u8));
+    uint32_t p;
+    for (p = 0; p < 3; p++) {
+      wuffs_base__table_u8 tab =
+          wuffs_base__pixel_buffer__plane(&src_pixbuf, p);
+      size_t j;
+      for (j = 0; j < tab.height; j++) {
+        size_t i;
+        for (i = 0; i < tab.width; i++) {
+          tab.ptr[(j * tab.stride) + i] =
+              (uint8_t)((p * 0x55) + (i * 0x1D) + (j * 0x33));
+        }
+      }
+    }
+
+    int d;
+    for (d = 0; d < WUFFS_TESTLIB_ARRAY_SIZE(dst_pixfmt_reprs); d++) {
+      // Allocate the dst_pixbuf.
+      wuffs_base__pixel_config dst_pixcfg = ((wuffs_base__pixel_config){});
+      wuffs_base__pixel_config__set(&dst_pixcfg, dst_pixfmt_reprs[d],
+                                    WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, width,
+                                    height);
+      wuffs_base__pixel_buffer dst_pixbuf = ((wuffs_base__pixel_buffer){});
+      CHECK_STATUS("set_from_slice",
+                   wuffs_base__pixel_buffer__set_from_slice(
+                       &dst_pixbuf, &dst_pixcfg, g_have_slice_u8));
+      memset(g_have_slice_u8.ptr, 0, 4 * width * height);
+
+      // Swizzle.
+      CHECK_STATUS(
+          "prepare",
+          wuffs_base__pixel_swizzler__prepare(
+              &swizzler, wuffs_base__make_pixel_format(dst_pixfmt_reprs[d]),
+              wuffs_base__make_slice_u8(
+                  &dummy_palette_array[0],
+                  WUFFS_TESTLIB_ARRAY_SIZE(dummy_palette_array)),
+              wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__YCBCR),
+              wuffs_base__empty_slice_u8(), WUFFS_BASE__PIXEL_BLEND__SRC));
+      CHECK_STATUS("swizzle_planar", wuffs_base__pixel_swizzler__swizzle_planar(
+                                         &swizzler, &dst_pixbuf, &src_pixbuf));
+
+      // Check every dst pixel.
+      uint32_t y;
+      for (y = 0; y < height; y++) {
+        uint32_t x;
+        for (x = 0; x < width; x++) {
+          wuffs_base__color_u32_argb_premul want_dst_pixel =
+              wuffs_base__pixel_buffer__color_u32_at(&src_pixbuf, x, y);
+          wuffs_base__color_u32_argb_premul have_dst_pixel =
+              wuffs_base__pixel_buffer__color_u32_at(&dst_pixbuf, x, y);
+          if ((want_dst_pixel == 0) || (have_dst_pixel != want_dst_pixel)) {
+            RETURN_FAIL("s=%d, d=%d, (x, y)=(%" PRIu32 ", %" PRIu32
+                        "): have 0x%08" PRIX32 ", want 0x%08" PRIX32,
+                        s, d, x, y, have_dst_pixel, want_dst_pixel);
+          }
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_pixel_swizzler_x86_sse42() {
+  CHECK_FOCUS(__func__);
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_64)
+  if (!wuffs_base__cpu_arch__have_x86_sse42()) {
+    return NULL;
+  }
+
+  const struct {
+    wuffs_base__pixel_swizzler__func scalar;
+    wuffs_base__pixel_swizzler__func sse42;
+    uint32_t dst_bytes_per_pixel;
+    uint32_t src_bytes_per_pixel;
+  } funcs[] = {
+      {
+          .scalar = wuffs_base__pixel_swizzler__xxxx__y,
+          .sse42 = wuffs_base__pixel_swizzler__xxxx__y__x86_sse42,
+          .dst_bytes_per_pixel = 4,
+          .src_bytes_per_pixel = 1,
+      },
+      {
+          .scalar = wuffs_base__pixel_swizzler__xxxx__xxx,
+          .sse42 = wuffs_base__pixel_swizzler__xxxx__xxx__x86_sse42,
+          .dst_bytes_per_pixel = 4,
+          .src_bytes_per_pixel = 3,
+      },
+      {
+          .scalar = wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx,
+          .sse42 =
+              wuffs_base__pixel_swizzler__xxxx__xxxx__swap_rgbx_bgrx__x86_sse42,
+          .dst_bytes_per_pixel = 4,
+          .src_bytes_per_pixel = 4,
+      },
+      {
+          .scalar =
+              wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src,
+          .sse42 =
+              wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src__x86_sse42,
+          .dst_bytes_per_pixel = 4,
+          .src_bytes_per_pixel = 4,
+      },
+      {
+          .scalar =
+              wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src,
+          .sse42 =
+              wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_nonpremul__src__x86_sse42,
+          .dst_bytes_per_pixel = 8,
+          .src_bytes_per_pixel = 4,
+      },
+      {
+          .scalar =
+              wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src,
+          .sse42 =
+              wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_nonpremul__src__x86_sse42,
+          .dst_bytes_per_pixel = 8,
+          .src_bytes_per_pixel = 4,
+      },
+      {
+          .scalar =
+              wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src,
+          .sse42 =
+              wuffs_base__pixel_swizzler__bgra_premul_4x16le__bgra_premul__src__x86_sse42,
+          .dst_bytes_per_pixel = 8,
+          .src_bytes_per_pixel = 4,
+      },
+      {
+          .scalar =
+              wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src,
+          .sse42 =
+              wuffs_base__pixel_swizzler__rgba_premul_4x16le__bgra_premul__src__x86_sse42,
+          .dst_bytes_per_pixel = 8,
+          .src_bytes_per_pixel = 4,
+      },
+      {
+          .scalar =
+              wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over,
+          .sse42 =
+              wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_nonpremul__src_over__x86_sse42,
+          .dst_bytes_per_pixel = 4,
+          .src_bytes_per_pixel = 4,
+      },
+      {
+          .scalar =
+              wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over,
+          .sse42 =
+              wuffs_base__pixel_swizzler__bgra_premul__bgra_nonpremul__src_over__x86_sse42,
+          .dst_bytes_per_pixel = 4,
+          .src_bytes_per_pixel = 4,
+      },
+      {
+          .scalar =
+              wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over,
+          .sse42 =
+              wuffs_base__pixel_swizzler__bgra_nonpremul__bgra_premul__src_over__x86_sse42,
+          .dst_bytes_per_pixel = 4,
+          .src_bytes_per_pixel = 4,
+      },
+      {
+          .scalar =
+              wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over,
+          .sse42 =
+              wuffs_base__pixel_swizzler__bgra_premul__bgra_premul__src_over__x86_sse42,
+          .dst_bytes_per_pixel = 4,
+          .src_bytes_per_pixel = 4,
+      },
+  };
+
+  // Fill the src with every (color, alpha) combination, so that the premul
+  // conversion is checked exhaustively, followed by some opaque pixels, so
+  // that the all-opaque fast path is also exercised, followed by some valid
+  // premul pixels (each color is at most the alpha), for the SRC_OVER funcs
+  // that take a BGRA_PREMUL src.
+  const size_t num_pixels = 256 * 256 + 256 + 1024;
+  const size_t src_len = 4 * num_pixels;
+  if ((g_src_slice_u8.len < src_len) || (g_want_slice_u8.len < (4 * src_len)) ||
+      (g_have_slice_u8.len < (4 * src_len))) {
+    return "src, want or have slice is too short";
+  }
+  size_t i;
+  for (i = 0; i < (256 * 256); i++) {
+    g_src_slice_u8.ptr[(4 * i) + 0] = (uint8_t)(i >> 0);
+    g_src_slice_u8.ptr[(4 * i) + 1] = (uint8_t)(i >> 3);
+    g_src_slice_u8.ptr[(4 * i) + 2] = (uint8_t)(i >> 5);
+    g_src_slice_u8.ptr[(4 * i) + 3] = (uint8_t)(i >> 8);
+  }
+  for (; i < (256 * 256 + 256); i++) {
+    g_src_slice_u8.ptr[(4 * i) + 0] = (uint8_t)(i * 7);
+    g_src_slice_u8.ptr[(4 * i) + 1] = (uint8_t)(i * 5);
+    g_src_slice_u8.ptr[(4 * i) + 2] = (uint8_t)(i * 3);
+    g_src_slice_u8.ptr[(4 * i) + 3] = 0xFF;
+  }
+  for (; i < num_pixels; i++) {
+    uint32_t a = (uint32_t)(i * 29) & 0xFF;
+    g_src_slice_u8.ptr[(4 * i) + 0] = (uint8_t)((i * 7) % (a + 1));
+    g_src_slice_u8.ptr[(4 * i) + 1] = (uint8_t)((i * 5) % (a + 1));
+    g_src_slice_u8.ptr[(4 * i) + 2] = (uint8_t)((i * 3) % (a + 1));
+    g_src_slice_u8.ptr[(4 * i) + 3] = (uint8_t)a;
+  }
+
+  // Vary the src and dst lengths, including lengths that aren't a multiple
+  // of the SIMD width, to exercise the scalar tail loops.
+  const size_t lens[] = {0, 1, 3, 4, 5, 6, 7, 15, 16, 17, 63, num_pixels};
+
+  int f;
+  for (f = 0; f < WUFFS_TESTLIB_ARRAY_SIZE(funcs); f++) {
+    int l;
+    for (l = 0; l < WUFFS_TESTLIB_ARRAY_SIZE(lens); l++) {
+      wuffs_base__slice_u8 src = wuffs_base__make_slice_u8(
+          g_src_slice_u8.ptr, lens[l] * funcs[f].src_bytes_per_pixel);
+      wuffs_base__slice_u8 want = wuffs_base__make_slice_u8(
+          g_want_slice_u8.ptr, lens[l] * funcs[f].dst_bytes_per_pixel);
+      wuffs_base__slice_u8 have = wuffs_base__make_slice_u8(
+          g_have_slice_u8.ptr, lens[l] * funcs[f].dst_bytes_per_pixel);
+      // The SRC_OVER funcs read the dst, so fill it with the same arbitrary
+      // bytes (but with runs of opaque pixels) for both want and have.
+      size_t j;
+      for (j = 0; j < (want.len + 16); j++) {
+        uint8_t v = (uint8_t)((j * 0x9B) ^ (j >> 7));
+        if (((j & 3) == 3) && (j & 0x100)) {
+          v = 0xFF;
+        }
+        want.ptr[j] = v;
+        have.ptr[j] = v;
+      }
+
+      uint64_t want_n = (*funcs[f].scalar)(want, g_work_slice_u8, src);
+      uint64_t have_n = (*funcs[f].sse42)(have, g_work_slice_u8, src);
+      if (have_n != want_n) {
+        RETURN_FAIL("f=%d, l=%d: n: have %" PRIu64 ", want %" PRIu64, f, l,
+                    have_n, want_n);
+      }
+      // Also compare the 16 bytes past the end of the slices, to check that
+      // the SIMD code does not write past the end of its dst.
+      for (j = 0; j < (have.len + 16); j++) {
+        if (have.ptr[j] != want.ptr[j]) {
+          RETURN_FAIL("f=%d, l=%d: byte at offset %zu: have 0x%02" PRIX8
+                      ", want 0x%02" PRIX8,
+                      f, l, j, have.ptr[j], want.ptr[j]);
+        }
+      }
+    }
+  }
+
+  // Repeat for the planar funcs, re-using the src bytes as the three planes.
+  const struct {
+    wuffs_base__pixel_swizzler__planar_func scalar;
+    wuffs_base__pixel_swizzler__planar_func sse42;
+  } planar_funcs[] = {
+      {
+          .scalar = wuffs_base__pixel_swizzler__bgrx__ycc,
+          .sse42 = wuffs_base__pixel_swizzler__bgrx__ycc__x86_sse42,
+      },
+      {
+          .scalar = wuffs_base__pixel_swizzler__rgbx__ycc,
+          .sse42 = wuffs_base__pixel_swizzler__rgbx__ycc__x86_sse42,
+      },
+  };
+
+  for (f = 0; f < WUFFS_TESTLIB_ARRAY_SIZE(planar_funcs); f++) {
+    int l;
+    for (l = 0; l < WUFFS_TESTLIB_ARRAY_SIZE(lens); l++) {
+      wuffs_base__slice_u8 src0 = wuffs_base__make_slice_u8(
+          g_src_slice_u8.ptr + (0 * lens[l]), lens[l]);
+      wuffs_base__slice_u8 src1 = wuffs_base__make_slice_u8(
+          g_src_slice_u8.ptr + (1 * lens[l]), lens[l]);
+      wuffs_base__slice_u8 src2 = wuffs_base__make_slice_u8(
+          g_src_slice_u8.ptr + (2 * lens[l]), lens[l]);
+      wuffs_base__slice_u8 want =
+          wuffs_base__make_slice_u8(g_want_slice_u8.ptr, lens[l] * 4);
+      wuffs_base__slice_u8 have =
+          wuffs_base__make_slice_u8(g_have_slice_u8.ptr, lens[l] * 4);
+      memset(want.ptr, 0, want.len + 16);
+      memset(have.ptr, 0, have.len + 16);
+
+      uint64_t want_n = (*planar_funcs[f].scalar)(want, src0, src1, src2);
+      uint64_t have_n = (*planar_funcs[f].sse42)(have, src0, src1, src2);
+      if (have_n != want_n) {
+        RETURN_FAIL("planar f=%d, l=%d: n: have %" PRIu64 ", want %" PRIu64, f,
+                    l, have_n, want_n);
+      }
+      size_t j;
+      for (j = 0; j < (have.len + 16); j++) {
+        if (have.ptr[j] != want.ptr[j]) {
+          RETURN_FAIL("planar f=%d, l=%d: byte at offset %zu: have 0x%02" PRIX8
+                      ", want 0x%02" PRIX8,
+                      f, l, j, have.ptr[j], want.ptr[j]);
+        }
+      }
+    }
+  }
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_64)
+  return NULL;
+}
+
 // ---------------- WBMP Tests
 
 const char*  //
@@ -276,6 +817,123 @@ test_wuffs_wbmp_decode_interface() {
       "test/data/muybridge-frame-000.wbmp", 0, SIZE_MAX, 30, 20, 0xFFFFFFFF);
 }
 
+const char*  //
+test_wuffs_wbmp_decode_frame_banded() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/bricks-nodither.wbmp",
+      "test/data/hat.wbmp",
+      "test/data/muybridge-frame-000.wbmp",
+  };
+  const wuffs_base__rect_ie_u32 crops[] = {
+      {0, 0, 0, 0},
+      {3, 5, 40, 30},
+  };
+  const uint32_t band_heights[] = {1, 7, 100000};
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    int c;
+    for (c = 0; c < WUFFS_TESTLIB_ARRAY_SIZE(crops); c++) {
+      uint32_t scale_shift;
+      for (scale_shift = 0; scale_shift <= 1; scale_shift++) {
+        int b;
+        for (b = 0; b < WUFFS_TESTLIB_ARRAY_SIZE(band_heights); b++) {
+          int r;
+          for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+            wuffs_wbmp__decoder full;
+            CHECK_STATUS(
+                "initialize (full)",
+                wuffs_wbmp__decoder__initialize(
+                    &full, sizeof full, WUFFS_VERSION,
+                    WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+            wuffs_wbmp__decoder banded;
+            CHECK_STATUS(
+                "initialize (banded)",
+                wuffs_wbmp__decoder__initialize(
+                    &banded, sizeof banded, WUFFS_VERSION,
+                    WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+            wuffs_base__decode_frame_options opts =
+                wuffs_base__null_decode_frame_options();
+            wuffs_base__decode_frame_options__set_scale_shift(&opts,
+                                                              scale_shift);
+            wuffs_base__decode_frame_options__set_crop_rect(&opts, crops[c]);
+            wuffs_base__decode_frame_options__set_band_height(&opts,
+                                                              band_heights[b]);
+            const char* z = do_test__wuffs_base__image_decoder_banded(
+                wuffs_wbmp__decoder__upcast_as__wuffs_base__image_decoder(
+                    &full),
+                wuffs_wbmp__decoder__upcast_as__wuffs_base__image_decoder(
+                    &banded),
+                filenames[i], &opts, rlimits[r]);
+            if (z) {
+              RETURN_FAIL("%s, c=%d, scale_shift=%" PRIu32 ", b=%d, r=%d: %s",
+                          filenames[i], c, scale_shift, b, r, z);
+            }
+          }
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_wbmp_decode_frame_cropped() {
+  CHECK_FOCUS(__func__);
+  const char* filenames[] = {
+      "test/data/bricks-nodither.wbmp",
+      "test/data/hat.wbmp",
+      "test/data/muybridge-frame-000.wbmp",
+  };
+  const wuffs_base__rect_ie_u32 crops[] = {
+      {0, 0, 1, 1},
+      {3, 5, 40, 30},
+      {9, 0, 10, 100000},
+      {17, 2, 100000, 31},
+      {100000, 100000, 100001, 100001},
+  };
+  const uint64_t rlimits[] = {UINT64_MAX, 7};
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(filenames); i++) {
+    int c;
+    for (c = 0; c < WUFFS_TESTLIB_ARRAY_SIZE(crops); c++) {
+      uint32_t scale_shift;
+      for (scale_shift = 0; scale_shift <= 1; scale_shift++) {
+        int r;
+        for (r = 0; r < WUFFS_TESTLIB_ARRAY_SIZE(rlimits); r++) {
+          wuffs_wbmp__decoder full;
+          CHECK_STATUS(
+              "initialize (full)",
+              wuffs_wbmp__decoder__initialize(
+                  &full, sizeof full, WUFFS_VERSION,
+                  WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+          wuffs_wbmp__decoder cropped;
+          CHECK_STATUS(
+              "initialize (cropped)",
+              wuffs_wbmp__decoder__initialize(
+                  &cropped, sizeof cropped, WUFFS_VERSION,
+                  WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+          wuffs_base__decode_frame_options opts =
+              wuffs_base__null_decode_frame_options();
+          wuffs_base__decode_frame_options__set_scale_shift(&opts, scale_shift);
+          wuffs_base__decode_frame_options__set_crop_rect(&opts, crops[c]);
+          const char* z = do_test__wuffs_base__image_decoder_scaled(
+              wuffs_wbmp__decoder__upcast_as__wuffs_base__image_decoder(&full),
+              wuffs_wbmp__decoder__upcast_as__wuffs_base__image_decoder(
+                  &cropped),
+              filenames[i], &opts, rlimits[r]);
+          if (z) {
+            RETURN_FAIL("%s, c=%d, scale_shift=%" PRIu32 ", r=%d: %s",
+                        filenames[i], c, scale_shift, r, z);
+          }
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_wbmp_decode_frame_config() {
   CHECK_FOCUS(__func__);
@@ -346,6 +1004,229 @@ test_wuffs_wbmp_decode_image_config() {
 
 #endif  // WUFFS_MIMIC
 
+// ---------------- Pixel Swizzler Benches
+
+const char*  //
+do_bench_wuffs_pixel_swizzler(uint32_t dst_pixfmt_repr,
+                              uint32_t src_pixfmt_repr,
+                              wuffs_base__pixel_blend blend,
+                              uint64_t iters_unscaled) {
+  wuffs_base__pixel_format dst_pixfmt =
+      wuffs_base__make_pixel_format(dst_pixfmt_repr);
+  wuffs_base__pixel_format src_pixfmt =
+      wuffs_base__make_pixel_format(src_pixfmt_repr);
+  uint32_t dst_bytes_per_pixel =
+      wuffs_base__pixel_format__bits_per_pixel(&dst_pixfmt) / 8;
+  uint32_t src_bytes_per_pixel =
+      wuffs_base__pixel_format__bits_per_pixel(&src_pixfmt) / 8;
+
+  // Swizzle 1 MiB of src pixels (whose values are arbitrary) per iteration,
+  // one 4096-pixel row at a time.
+  const size_t width = 4096;
+  const size_t height = (1024 * 1024) / width;
+  if ((g_src_slice_u8.len < (width * height * src_bytes_per_pixel)) ||
+      (g_have_slice_u8.len < (width * height * dst_bytes_per_pixel)) ||
+      (g_work_slice_u8.len < 1024)) {
+    return "src, have or work slice is too short";
+  }
+  size_t i;
+  for (i = 0; i < (width * height * src_bytes_per_pixel); i++) {
+    g_src_slice_u8.ptr[i] = (uint8_t)((i * 0x9B) ^ (i >> 7));
+  }
+  wuffs_base__slice_u8 palette =
+      wuffs_base__make_slice_u8(g_work_slice_u8.ptr, 1024);
+
+  wuffs_base__pixel_swizzler swizzler;
+  CHECK_STATUS("prepare",
+               wuffs_base__pixel_swizzler__prepare(
+                   &swizzler, dst_pixfmt, palette, src_pixfmt, palette, blend));
+
+  uint64_t iters = iters_unscaled * g_flags.iterscale;
+  uint64_t n_bytes = 0;
+  bench_start();
+  uint64_t k;
+  for (k = 0; k < iters; k++) {
+    size_t y;
+    for (y = 0; y < height; y++) {
+      n_bytes +=
+          dst_bytes_per_pixel *
+          wuffs_base__pixel_swizzler__swizzle_interleaved(
+              &swizzler,
+              wuffs_base__make_slice_u8(
+                  g_have_slice_u8.ptr + (y * width * dst_bytes_per_pixel),
+                  width * dst_bytes_per_pixel),
+              palette,
+              wuffs_base__make_slice_u8(
+                  g_src_slice_u8.ptr + (y * width * src_bytes_per_pixel),
+                  width * src_bytes_per_pixel));
+    }
+  }
+  bench_finish(iters, n_bytes);
+  return NULL;
+}
+
+const char*  //
+bench_wuffs_pixel_swizzler_bgra_nonpremul_y() {
+  CHECK_FOCUS(__func__);
+  return do_bench_wuffs_pixel_swizzler(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+                                       WUFFS_BASE__PIXEL_FORMAT__Y,
+                                       WUFFS_BASE__PIXEL_BLEND__SRC, 10);
+}
+
+const char*  //
+bench_wuffs_pixel_swizzler_bgra_nonpremul_bgr() {
+  CHECK_FOCUS(__func__);
+  return do_bench_wuffs_pixel_swizzler(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+                                       WUFFS_BASE__PIXEL_FORMAT__BGR,
+                                       WUFFS_BASE__PIXEL_BLEND__SRC, 10);
+}
+
+const char*  //
+bench_wuffs_pixel_swizzler_bgra_premul_4x16le_bgra_nonpremul() {
+  CHECK_FOCUS(__func__);
+  return do_bench_wuffs_pixel_swizzler(
+      WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE,
+      WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL, WUFFS_BASE__PIXEL_BLEND__SRC,
+      10);
+}
+
+const char*  //
+bench_wuffs_pixel_swizzler_index_bgra_nonpremul() {
+  CHECK_FOCUS(__func__);
+
+  uint8_t palette_array[1024];
+  wuffs_base__slice_u8 palette = wuffs_base__make_slice_u8(
+      &palette_array[0], WUFFS_TESTLIB_ARRAY_SIZE(palette_array));
+  fill_palette_with_pattern(palette);
+
+  // Quantize 1 MiB of src bytes per iteration, one 4096-pixel row at a time.
+  // Unlike do_bench_wuffs_pixel_swizzler, the src has natural-image-like
+  // runs of similar colors, as per-color caching matters here.
+  const size_t width = 4096;
+  const size_t height = (1024 * 1024) / (4 * width);
+  if ((g_src_slice_u8.len < (4 * width * height)) ||
+      (g_have_slice_u8.len < (width * height))) {
+    return "src or have slice is too short";
+  }
+  size_t i;
+  for (i = 0; i < (width * height); i++) {
+    size_t x = i % width;
+    size_t y = i / width;
+    g_src_slice_u8.ptr[(4 * i) + 0] = (uint8_t)(x >> 4);
+    g_src_slice_u8.ptr[(4 * i) + 1] = (uint8_t)(y * 4);
+    g_src_slice_u8.ptr[(4 * i) + 2] = (uint8_t)((x + y) >> 5);
+    g_src_slice_u8.ptr[(4 * i) + 3] = 0xFF;
+  }
+
+  wuffs_base__pixel_swizzler swizzler;
+  CHECK_STATUS("prepare_quantizing",
+               wuffs_base__pixel_swizzler__prepare_quantizing(
+                   &swizzler, &g_palette_lookup,
+                   wuffs_base__make_pixel_format(
+                       WUFFS_BASE__PIXEL_FORMAT__INDEXED__BGRA_NONPREMUL),
+                   palette,
+                   wuffs_base__make_pixel_format(
+                       WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+                   WUFFS_BASE__PIXEL_BLEND__SRC));
+
+  uint64_t iters = 10 * g_flags.iterscale;
+  uint64_t n_bytes = 0;
+  bench_start();
+  uint64_t k;
+  for (k = 0; k < iters; k++) {
+    size_t y;
+    for (y = 0; y < height; y++) {
+      n_bytes += wuffs_base__pixel_swizzler__swizzle_interleaved(
+          &swizzler,
+          wuffs_base__make_slice_u8(g_have_slice_u8.ptr + (y * width), width),
+          wuffs_base__empty_slice_u8(),
+          wuffs_base__make_slice_u8(g_src_slice_u8.ptr + (y * 4 * width),
+                                    4 * width));
+    }
+  }
+  bench_finish(iters, n_bytes);
+  return NULL;
+}
+
+const char*  //
+bench_wuffs_pixel_swizzler_bgra_premul_bgra_nonpremul() {
+  CHECK_FOCUS(__func__);
+  return do_bench_wuffs_pixel_swizzler(WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+                                       WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+                                       WUFFS_BASE__PIXEL_BLEND__SRC, 10);
+}
+
+const char*  //
+bench_wuffs_pixel_swizzler_bgra_premul_bgra_nonpremul_src_over() {
+  CHECK_FOCUS(__func__);
+  return do_bench_wuffs_pixel_swizzler(WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+                                       WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+                                       WUFFS_BASE__PIXEL_BLEND__SRC_OVER, 10);
+}
+
+const char*  //
+bench_wuffs_pixel_swizzler_bgra_nonpremul_bgra_nonpremul_src_over() {
+  CHECK_FOCUS(__func__);
+  return do_bench_wuffs_pixel_swizzler(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+                                       WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+                                       WUFFS_BASE__PIXEL_BLEND__SRC_OVER, 10);
+}
+
+const char*  //
+bench_wuffs_pixel_swizzler_rgba_nonpremul_bgra_nonpremul() {
+  CHECK_FOCUS(__func__);
+  return do_bench_wuffs_pixel_swizzler(WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL,
+                                       WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+                                       WUFFS_BASE__PIXEL_BLEND__SRC, 10);
+}
+
+const char*  //
+bench_wuffs_pixel_swizzler_bgra_nonpremul_ycbcr_420() {
+  CHECK_FOCUS(__func__);
+
+  // Swizzle a 1 megapixel YCbCr 4:2:0 src (whose values are arbitrary) per
+  // iteration.
+  const uint32_t width = 1024;
+  const uint32_t height = 1024;
+  wuffs_base__pixel_config src_pixcfg = ((wuffs_base__pixel_config){});
+  wuffs_base__pixel_config__set(&src_pixcfg, WUFFS_BASE__PIXEL_FORMAT__YCBCR,
+                                WUFFS_BASE__PIXEL_SUBSAMPLING__420, width,
+                                height);
+  wuffs_base__pixel_buffer src_pixbuf = ((wuffs_base__pixel_buffer){});
+  CHECK_STATUS("set_from_slice", wuffs_base__pixel_buffer__set_from_slice(
+                                     &src_pixbuf, &src_pixcfg, g_src_slice_u8));
+  size_t i;
+  for (i = 0; i < ((width * height * 3) / 2); i++) {
+    g_src_slice_u8.ptr[i] = (uint8_t)((i * 0x9B) ^ (i >> 7));
+  }
+
+  wuffs_base__pixel_config dst_pixcfg = ((wuffs_base__pixel_config){});
+  wuffs_base__pixel_config__set(
+      &dst_pixcfg, WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+      WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, width, height);
+  wuffs_base__pixel_buffer dst_pixbuf = ((wuffs_base__pixel_buffer){});
+  CHECK_STATUS("set_from_slice",
+               wuffs_base__pixel_buffer__set_from_slice(
+                   &dst_pixbuf, &dst_pixcfg, g_have_slice_u8));
+
+  wuffs_base__pixel_swizzler swizzler;
+  CHECK_STATUS("prepare",
+               wuffs_base__pixel_swizzler__prepare(
+                   &swizzler, dst_pixcfg.private_impl.pixfmt,
+                   wuffs_base__empty_slice_u8(), src_pixcfg.private_impl.pixfmt,
+                   wuffs_base__empty_slice_u8(), WUFFS_BASE__PIXEL_BLEND__SRC));
+
+  uint64_t iters = 10 * g_flags.iterscale;
+  bench_start();
+  uint64_t k;
+  for (k = 0; k < iters; k++) {
+    CHECK_STATUS("swizzle_planar", wuffs_base__pixel_swizzler__swizzle_planar(
+                                       &swizzler, &dst_pixbuf, &src_pixbuf));
+  }
+  bench_finish(iters, iters * 4 * width * height);
+  return NULL;
+}
+
   // ---------------- WBMP Benches
 
   // No WBMP benches.
@@ -365,8 +1246,14 @@ proc g_tests[] = {
     // These pixel_swizzler tests are really testing the Wuffs base library.
     // They aren't specific to the std/wbmp code, but putting them here is as
     // good as any other place.
+    test_wuffs_pixel_palette_lookup,
+    test_wuffs_pixel_swizzler_prepare_quantizing,
     test_wuffs_pixel_swizzler_swizzle,
+    test_wuffs_pixel_swizzler_swizzle_planar,
+    test_wuffs_pixel_swizzler_x86_sse42,
 
+    test_wuffs_wbmp_decode_frame_banded,
+    test_wuffs_wbmp_decode_frame_cropped,
     test_wuffs_wbmp_decode_frame_config,
     test_wuffs_wbmp_decode_image_config,
     test_wuffs_wbmp_decode_interface,
@@ -382,6 +1269,19 @@ proc g_tests[] = {
 
 proc g_benches[] = {
 
+    // These pixel_swizzler benches are really benchmarking the Wuffs base
+    // library. They aren't specific to the std/wbmp code, but putting them
+    // here is as good as any other place.
+    bench_wuffs_pixel_swizzler_bgra_nonpremul_bgr,
+    bench_wuffs_pixel_swizzler_bgra_nonpremul_bgra_nonpremul_src_over,
+    bench_wuffs_pixel_swizzler_bgra_nonpremul_y,
+    bench_wuffs_pixel_swizzler_bgra_nonpremul_ycbcr_420,
+    bench_wuffs_pixel_swizzler_bgra_premul_4x16le_bgra_nonpremul,
+    bench_wuffs_pixel_swizzler_bgra_premul_bgra_nonpremul,
+    bench_wuffs_pixel_swizzler_bgra_premul_bgra_nonpremul_src_over,
+    bench_wuffs_pixel_swizzler_index_bgra_nonpremul,
+    bench_wuffs_pixel_swizzler_rgba_nonpremul_bgra_nonpremul,
+
 // No WBMP benches.
 
 #ifdef WUFFS_MIMIC
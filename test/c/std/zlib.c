@@ -138,6 +138,69 @@ wuffs_zlib_decode(wuffs_base__io_buffer* dst,
   }
 }
 
+const char*  //
+do_wuffs_zlib_encode(wuffs_base__io_buffer* dst,
+                     wuffs_base__io_buffer* src,
+                     uint64_t wlimit,
+                     uint64_t rlimit,
+                     uint32_t level) {
+  wuffs_zlib__encoder enc;
+  CHECK_STATUS("initialize",
+               wuffs_zlib__encoder__initialize(
+                   &enc, sizeof enc, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_zlib__encoder__set_level(&enc, level);
+
+  while (true) {
+    wuffs_base__io_buffer limited_dst = make_limited_writer(*dst, wlimit);
+    wuffs_base__io_buffer limited_src = make_limited_reader(*src, rlimit);
+
+    wuffs_base__status status = wuffs_zlib__encoder__transform_io(
+        &enc, &limited_dst, &limited_src, g_work_slice_u8);
+
+    dst->meta.wi += limited_dst.meta.wi;
+    src->meta.ri += limited_src.meta.ri;
+
+    if (((wlimit < UINT64_MAX) &&
+         (status.repr == wuffs_base__suspension__short_write)) ||
+        ((rlimit < UINT64_MAX) &&
+         (status.repr == wuffs_base__suspension__short_read))) {
+      continue;
+    }
+    return status.repr;
+  }
+}
+
+const char*  //
+do_test_wuffs_zlib_encode_round_trip(
+    const char* (*decode_func)(wuffs_base__io_buffer*,
+                               wuffs_base__io_buffer*,
+                               uint32_t,
+                               uint64_t,
+                               uint64_t),
+    uint32_t level,
+    uint64_t wlimit,
+    uint64_t rlimit) {
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  wuffs_base__io_buffer encoded = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  wuffs_base__io_buffer decoded = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+
+  CHECK_STRING(read_file(&src, g_zlib_midsummer_gt.want_filename));
+  CHECK_STRING(do_wuffs_zlib_encode(&encoded, &src, wlimit, rlimit, level));
+  encoded.meta.closed = true;
+  CHECK_STRING(
+      decode_func(&decoded, &encoded,
+                  WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+                  UINT64_MAX, UINT64_MAX));
+  return check_io_buffers_equal("", &decoded, &src);
+}
+
 const char*  //
 do_test_wuffs_zlib_checksum(bool ignore_checksum, uint32_t bad_checksum) {
   wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
@@ -226,6 +289,29 @@ test_wuffs_zlib_checksum_verify_good() {
   return do_test_wuffs_zlib_checksum(false, 0);
 }
 
+const char*  //
+test_wuffs_zlib_encode_level_best() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_zlib_encode_round_trip(wuffs_zlib_decode,
+                                              WUFFS_DEFLATE__ENCODER_LEVEL_BEST,
+                                              UINT64_MAX, UINT64_MAX);
+}
+
+const char*  //
+test_wuffs_zlib_encode_level_none() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_zlib_encode_round_trip(wuffs_zlib_decode,
+                                              WUFFS_DEFLATE__ENCODER_LEVEL_NONE,
+                                              UINT64_MAX, UINT64_MAX);
+}
+
+const char*  //
+test_wuffs_zlib_encode_many_small_writes_reads() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_zlib_encode_round_trip(
+      wuffs_zlib_decode, WUFFS_DEFLATE__ENCODER_LEVEL_BALANCED, 3, 5);
+}
+
 const char*  //
 test_wuffs_zlib_decode_midsummer() {
   CHECK_FOCUS(__func__);
@@ -291,6 +377,14 @@ test_wuffs_zlib_decode_sheep() {
 
 #ifdef WUFFS_MIMIC
 
+const char*  //
+test_mimic_zlib_decode_wuffs_encoded() {
+  CHECK_FOCUS(__func__);
+  return do_test_wuffs_zlib_encode_round_trip(
+      mimic_zlib_decode, WUFFS_DEFLATE__ENCODER_LEVEL_BALANCED, UINT64_MAX,
+      UINT64_MAX);
+}
+
 const char*  //
 test_mimic_zlib_decode_midsummer() {
   CHECK_FOCUS(__func__);
@@ -330,6 +424,84 @@ test_mimic_zlib_decode_sheep() {
 
 // ---------------- Zlib Benches
 
+// g_zlib_many_tiny_lengths are the decoded lengths of the messages that
+// do_bench_zlib_decode_many_tiny splits its input into, repeating as
+// necessary. They range from tens of bytes to 4 KiB, typical of (for example)
+// compressed RPC payloads or database rows. The shortest messages' encodings
+// use fixed Huffman blocks and the others use dynamic Huffman blocks.
+const size_t g_zlib_many_tiny_lengths[] = {
+    100, 4096, 40, 250, 700, 64, 1500, 160, 3000, 48, 400,
+};
+
+const char*  //
+do_bench_zlib_decode_many_tiny(
+    const char* (*decode_func)(wuffs_base__io_buffer*,
+                               wuffs_base__io_buffer*,
+                               uint32_t,
+                               uint64_t,
+                               uint64_t),
+    uint32_t wuffs_initialize_flags,
+    uint64_t iters_unscaled) {
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  wuffs_base__io_buffer encoded = ((wuffs_base__io_buffer){
+      .data = g_work_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, g_zlib_midsummer_gt.want_filename));
+
+  // Split src into independent zlib messages, each encoded by a fresh
+  // encoder, and remember where each message starts and ends.
+  const size_t n_lengths = WUFFS_TESTLIB_ARRAY_SIZE(g_zlib_many_tiny_lengths);
+  size_t n_msgs = 0;
+  size_t msg_ends[256];
+  size_t want_ends[256];
+  while ((src.meta.ri < src.meta.wi) &&
+         (n_msgs < WUFFS_TESTLIB_ARRAY_SIZE(msg_ends))) {
+    wuffs_base__io_buffer piece =
+        make_limited_reader(src, g_zlib_many_tiny_lengths[n_msgs % n_lengths]);
+    piece.meta.closed = true;
+    CHECK_STRING(do_wuffs_zlib_encode(&encoded, &piece, UINT64_MAX, UINT64_MAX,
+                                      WUFFS_DEFLATE__ENCODER_LEVEL_BALANCED));
+    src.meta.ri += piece.meta.ri;
+    msg_ends[n_msgs] = encoded.meta.wi;
+    want_ends[n_msgs] = src.meta.ri;
+    n_msgs++;
+  }
+
+  // Decode the messages back to back, as a server handling many small
+  // requests would. The decode_func initializes a decoder for each message,
+  // so that each message's cost includes that of the per-message reset.
+  uint64_t n_bytes = 0;
+  uint64_t iters = iters_unscaled * g_flags.iterscale;
+  bench_start();
+  uint64_t i;
+  for (i = 0; i < iters; i++) {
+    size_t j;
+    for (j = 0; j < n_msgs; j++) {
+      wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+          .data = g_have_slice_u8,
+      });
+      size_t msg_begin = j ? msg_ends[j - 1] : 0;
+      wuffs_base__io_buffer msg = make_io_buffer_from_string(
+          (const char*)(encoded.data.ptr + msg_begin), msg_ends[j] - msg_begin);
+      CHECK_STRING(decode_func(&have, &msg, wuffs_initialize_flags, UINT64_MAX,
+                               UINT64_MAX));
+      n_bytes += have.meta.wi;
+
+      if (i == 0) {
+        size_t want_begin = j ? want_ends[j - 1] : 0;
+        wuffs_base__io_buffer want = make_io_buffer_from_string(
+            (const char*)(src.data.ptr + want_begin),
+            want_ends[j] - want_begin);
+        CHECK_STRING(check_io_buffers_equal("", &have, &want));
+      }
+    }
+  }
+  bench_finish(iters, n_bytes);
+  return NULL;
+}
+
 const char*  //
 bench_wuffs_zlib_decode_10k() {
   CHECK_FOCUS(__func__);
@@ -346,6 +518,14 @@ bench_wuffs_zlib_decode_100k() {
       tcounter_dst, &g_zlib_pi_gt, UINT64_MAX, UINT64_MAX, 30);
 }
 
+const char*  //
+bench_wuffs_zlib_decode_many_tiny() {
+  CHECK_FOCUS(__func__);
+  return do_bench_zlib_decode_many_tiny(
+      wuffs_zlib_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      30);
+}
+
   // ---------------- Mimic Benches
 
 #ifdef WUFFS_MIMIC
@@ -364,6 +544,12 @@ bench_mimic_zlib_decode_100k() {
                              UINT64_MAX, UINT64_MAX, 30);
 }
 
+const char*  //
+bench_mimic_zlib_decode_many_tiny() {
+  CHECK_FOCUS(__func__);
+  return do_bench_zlib_decode_many_tiny(mimic_zlib_decode, 0, 30);
+}
+
 #endif  // WUFFS_MIMIC
 
 // ---------------- Manifest
@@ -378,12 +564,16 @@ proc g_tests[] = {
     test_wuffs_zlib_decode_midsummer,
     test_wuffs_zlib_decode_pi,
     test_wuffs_zlib_decode_sheep,
+    test_wuffs_zlib_encode_level_best,
+    test_wuffs_zlib_encode_level_none,
+    test_wuffs_zlib_encode_many_small_writes_reads,
 
 #ifdef WUFFS_MIMIC
 
     test_mimic_zlib_decode_midsummer,
     test_mimic_zlib_decode_pi,
     test_mimic_zlib_decode_sheep,
+    test_mimic_zlib_decode_wuffs_encoded,
 
 #endif  // WUFFS_MIMIC
 
@@ -394,11 +584,13 @@ proc g_benches[] = {
 
     bench_wuffs_zlib_decode_10k,
     bench_wuffs_zlib_decode_100k,
+    bench_wuffs_zlib_decode_many_tiny,
 
 #ifdef WUFFS_MIMIC
 
     bench_mimic_zlib_decode_10k,
     bench_mimic_zlib_decode_100k,
+    bench_mimic_zlib_decode_many_tiny,
 
 #endif  // WUFFS_MIMIC
 
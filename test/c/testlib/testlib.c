@@ -20,6 +20,16 @@
 #include <sys/time.h>
 #include <unistd.h>
 
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+
+// syscall is only declared by <unistd.h> when _DEFAULT_SOURCE or _GNU_SOURCE
+// is defined, which "-std=c99" does not imply. Re-declaring it, with glibc's
+// signature, is harmless either way.
+long int syscall(long int sysno, ...);
+#endif
+
 #define IO_BUFFER_ARRAY_SIZE (64 * 1024 * 1024)
 #define PIXEL_BUFFER_ARRAY_SIZE (64 * 1024 * 1024)
 #define TOKEN_BUFFER_ARRAY_SIZE (128 * 1024)
@@ -112,13 +122,16 @@ struct {
   char** remaining_argv;
 
   bool bench;
+  int cpu;
   const char* focus;
   uint64_t iterscale;
+  bool perf;
   int reps;
 } g_flags = {0};
 
 const char*  //
 parse_flags(int argc, char** argv) {
+  g_flags.cpu = -1;
   g_flags.iterscale = 100;
   g_flags.reps = 5;
 
@@ -147,6 +160,23 @@ parse_flags(int argc, char** argv) {
       continue;
     }
 
+    if (!strncmp(arg, "cpu=", 4)) {
+      arg += 4;
+      if (!*arg) {
+        return "missing -cpu=N value";
+      }
+      char* end = NULL;
+      long int n = strtol(arg, &end, 10);
+      if (*end) {
+        return "invalid -cpu=N value";
+      }
+      if ((n < 0) || (1023 < n)) {
+        return "out-of-range -cpu=N value";
+      }
+      g_flags.cpu = n;
+      continue;
+    }
+
     if (!strncmp(arg, "focus=", 6)) {
       g_flags.focus = arg + 6;
       continue;
@@ -169,6 +199,11 @@ parse_flags(int argc, char** argv) {
       continue;
     }
 
+    if (!strcmp(arg, "perf")) {
+      g_flags.perf = true;
+      continue;
+    }
+
     if (!strncmp(arg, "reps=", 5)) {
       arg += 5;
       if (!*arg) {
@@ -249,19 +284,20 @@ check_focus() {
 
       // See if g_proc_func_name (with or without a "test_" or "bench_" prefix)
       // starts with the [p, q) string.
-      if ((n >= q - p) && !strncmp(g_proc_func_name, p, q - p)) {
+      if ((n >= (size_t)(q - p)) && !strncmp(g_proc_func_name, p, q - p)) {
         return true;
       }
       const char* unprefixed_proc_func_name = NULL;
       size_t unprefixed_n = 0;
-      if ((n >= q - p) && !strncmp(g_proc_func_name, "test_", 5)) {
+      if ((n >= (size_t)(q - p)) && !strncmp(g_proc_func_name, "test_", 5)) {
         unprefixed_proc_func_name = g_proc_func_name + 5;
         unprefixed_n = n - 5;
-      } else if ((n >= q - p) && !strncmp(g_proc_func_name, "bench_", 6)) {
+      } else if ((n >= (size_t)(q - p)) &&
+                 !strncmp(g_proc_func_name, "bench_", 6)) {
         unprefixed_proc_func_name = g_proc_func_name + 6;
         unprefixed_n = n - 6;
       }
-      if (unprefixed_proc_func_name && (unprefixed_n >= q - p) &&
+      if (unprefixed_proc_func_name && (unprefixed_n >= (size_t)(q - p)) &&
           !strncmp(unprefixed_proc_func_name, p, q - p)) {
         return true;
       }
@@ -301,18 +337,181 @@ typedef struct {
   size_t src_offset1;
 } golden_test;
 
+// The -perf flag adds hardware performance counters to the benchmark output.
+// These are less sensitive than wall clock time to other processes sharing the
+// machine. On Linux, they come from perf_event_open. Elsewhere (or if that
+// syscall fails, e.g. because of /proc/sys/kernel/perf_event_paranoid), the
+// only counter is the x86 time stamp counter, when available.
+
+#define WUFFS_TESTLIB__NUM_PERF_COUNTERS 4
+
+const char* g_perf_counter_names[WUFFS_TESTLIB__NUM_PERF_COUNTERS] = {
+    "cycles",
+    "instrs",
+    "branch-misses",
+    "L1d-misses",
+};
+
+int g_perf_counter_fds[WUFFS_TESTLIB__NUM_PERF_COUNTERS] = {-1, -1, -1, -1};
+uint64_t g_perf_counter_start_values[WUFFS_TESTLIB__NUM_PERF_COUNTERS] = {0};
+bool g_perf_have_tsc = false;
+uint64_t g_perf_tsc_start_value = 0;
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define WUFFS_TESTLIB__HAVE_TSC
+#endif
+
+void  //
+open_perf_counters() {
+  int i;
+#if defined(__linux__)
+  static const uint32_t types[WUFFS_TESTLIB__NUM_PERF_COUNTERS] = {
+      PERF_TYPE_HARDWARE,
+      PERF_TYPE_HARDWARE,
+      PERF_TYPE_HARDWARE,
+      PERF_TYPE_HW_CACHE,
+  };
+  static const uint64_t configs[WUFFS_TESTLIB__NUM_PERF_COUNTERS] = {
+      PERF_COUNT_HW_CPU_CYCLES,
+      PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_BRANCH_MISSES,
+      (PERF_COUNT_HW_CACHE_L1D) |               //
+          (PERF_COUNT_HW_CACHE_OP_READ << 8) |  //
+          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+  };
+  for (i = 0; i < WUFFS_TESTLIB__NUM_PERF_COUNTERS; i++) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = types[i];
+    attr.config = configs[i];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    g_perf_counter_fds[i] =
+        (int)(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+  }
+#endif
+
+  int n = 0;
+  for (i = 0; i < WUFFS_TESTLIB__NUM_PERF_COUNTERS; i++) {
+    if (g_perf_counter_fds[i] >= 0) {
+      printf("%s%s", n++ ? ", " : "# perf counters: ", g_perf_counter_names[i]);
+    }
+  }
+  if (n > 0) {
+    printf("\n");
+    return;
+  }
+
+#if defined(WUFFS_TESTLIB__HAVE_TSC)
+  g_perf_have_tsc = true;
+  printf("# perf counters: unavailable, using rdtsc instead\n");
+#else
+  printf("# perf counters: unavailable\n");
+#endif
+}
+
+uint64_t  //
+read_perf_counter(int i) {
+  uint64_t value = 0;
+  if ((g_perf_counter_fds[i] < 0) ||
+      (read(g_perf_counter_fds[i], &value, sizeof(value)) != sizeof(value))) {
+    return 0;
+  }
+  return value;
+}
+
+uint64_t  //
+read_tsc() {
+#if defined(WUFFS_TESTLIB__HAVE_TSC)
+  return __builtin_ia32_rdtsc();
+#else
+  return 0;
+#endif
+}
+
+// pin_to_cpu restricts this process to run on a single CPU, which reduces the
+// noise from the OS scheduler migrating it between CPUs (and caches).
+const char*  //
+pin_to_cpu(int cpu) {
+#if defined(__linux__)
+  const int bits_per_word = 8 * sizeof(unsigned long);
+  unsigned long mask[1024 / (8 * sizeof(unsigned long))] = {0};
+  mask[cpu / bits_per_word] |= 1ul << (cpu % bits_per_word);
+  if (syscall(__NR_sched_setaffinity, 0, sizeof(mask), mask) != 0) {
+    return "could not pin to the -cpu=N CPU";
+  }
+  return NULL;
+#else
+  return "-cpu=N is not supported on this platform";
+#endif
+}
+
 bool g_bench_warm_up;
 struct timeval g_bench_start_tv;
 
 void  //
 bench_start() {
+  if (g_flags.perf) {
+    int i;
+    for (i = 0; i < WUFFS_TESTLIB__NUM_PERF_COUNTERS; i++) {
+      g_perf_counter_start_values[i] = read_perf_counter(i);
+    }
+    if (g_perf_have_tsc) {
+      g_perf_tsc_start_value = read_tsc();
+    }
+  }
   gettimeofday(&g_bench_start_tv, NULL);
 }
 
+// finish_perf_counters replaces values[i] with the -perf counter deltas since
+// bench_start. For the cycles counter, values[0], the rdtsc fallback is used
+// if there is no perf_event_open counter.
+void  //
+finish_perf_counters(uint64_t* values) {
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB__NUM_PERF_COUNTERS; i++) {
+    values[i] = read_perf_counter(i) - g_perf_counter_start_values[i];
+  }
+  if (g_perf_have_tsc) {
+    values[0] = read_tsc() - g_perf_tsc_start_value;
+  }
+}
+
+// print_perf_counters prints the -perf counter deltas in a format that the
+// benchstat tool treats as additional units. Cycles are per byte (or per op if
+// n_bytes is zero). Other counters are per op.
+void  //
+print_perf_counters(const uint64_t* values, uint64_t iters, uint64_t n_bytes) {
+  const char* cycles_name = g_perf_counter_names[0];
+  if (g_perf_have_tsc) {
+    cycles_name = "tsc";
+  } else if (g_perf_counter_fds[0] < 0) {
+    cycles_name = NULL;
+  }
+  if (cycles_name && n_bytes) {
+    printf("\t%8.3f %s/byte", ((double)(values[0])) / ((double)(n_bytes)),
+           cycles_name);
+  } else if (cycles_name) {
+    printf("\t%8" PRIu64 " %s/op", values[0] / iters, cycles_name);
+  }
+  int i;
+  for (i = 1; i < WUFFS_TESTLIB__NUM_PERF_COUNTERS; i++) {
+    if (g_perf_counter_fds[i] >= 0) {
+      printf("\t%8" PRIu64 " %s/op", values[i] / iters,
+             g_perf_counter_names[i]);
+    }
+  }
+}
+
 void  //
 bench_finish(uint64_t iters, uint64_t n_bytes) {
   struct timeval bench_finish_tv;
   gettimeofday(&bench_finish_tv, NULL);
+  uint64_t perf_values[WUFFS_TESTLIB__NUM_PERF_COUNTERS] = {0};
+  if (g_flags.perf) {
+    finish_perf_counters(perf_values);
+  }
   int64_t micros =
       (int64_t)(bench_finish_tv.tv_sec - g_bench_start_tv.tv_sec) * 1000000 +
       (int64_t)(bench_finish_tv.tv_usec - g_bench_start_tv.tv_usec);
@@ -330,14 +529,20 @@ bench_finish(uint64_t iters, uint64_t n_bytes) {
     printf("# (warm up) %s/%s\t%8" PRIu64 ".%06" PRIu64 " seconds\n",  //
            name, g_cc, nanos / 1000000000, (nanos % 1000000000) / 1000);
   } else if (!n_bytes) {
-    printf("Benchmark%s/%s\t%8" PRIu64 "\t%8" PRIu64 " ns/op\n",  //
+    printf("Benchmark%s/%s\t%8" PRIu64 "\t%8" PRIu64 " ns/op",  //
            name, g_cc, iters, nanos / iters);
   } else {
     printf("Benchmark%s/%s\t%8" PRIu64 "\t%8" PRIu64
-           " ns/op\t%8d.%03d MB/s\n",         //
+           " ns/op\t%8d.%03d MB/s",           //
            name, g_cc, iters, nanos / iters,  //
            (int)(kb_per_s / 1000), (int)(kb_per_s % 1000));
   }
+  if (!g_bench_warm_up) {
+    if (g_flags.perf && (iters > 0)) {
+      print_perf_counters(perf_values, iters, n_bytes);
+    }
+    printf("\n");
+  }
   // Flush stdout so that "wuffs bench | tee etc" still prints its numbers as
   // soon as they are available.
   fflush(stdout);
@@ -390,6 +595,14 @@ test_main(int argc, char** argv, proc* tests, proc* benches) {
     return 1;
   }
 
+  if (g_flags.cpu >= 0) {
+    status = pin_to_cpu(g_flags.cpu);
+    if (status) {
+      fprintf(stderr, "%s\n", status);
+      return 1;
+    }
+  }
+
   int reps = 1;
   proc* procs = tests;
   if (g_flags.bench) {
@@ -403,6 +616,9 @@ test_main(int argc, char** argv, proc* tests, proc* benches) {
         "# https://godoc.org/golang.org/x/perf/cmd/benchstat tool. To install "
         "it, first\n"
         "# install Go, then run \"go get golang.org/x/perf/cmd/benchstat\".\n");
+    if (g_flags.perf) {
+      open_perf_counters();
+    }
   }
 
   int i;
@@ -417,7 +633,18 @@ test_main(int argc, char** argv, proc* tests, proc* benches) {
       if (!g_in_focus) {
         continue;
       }
-      if (status) {
+      if (status && g_flags.bench &&
+          !strncmp(g_proc_func_name, "bench_mimic_", 12) &&
+          !strncmp(status, "unsupported", 11)) {
+        // Some mimic libraries (e.g. those that only decode whole buffers)
+        // can't run every benchmark. Skip those instead of failing, so that
+        // the rest of the comparison still runs.
+        if (i == 0) {
+          printf("# (skipped) %s/%s\t%s\n", g_proc_func_name + 6, g_cc,
+                 status);
+        }
+        continue;
+      } else if (status) {
         printf("%-16s%-8sFAIL %s: %s\n", g_proc_package_name, g_cc,
                g_proc_func_name, status);
         return 1;
@@ -642,7 +869,7 @@ read_file_fragment(wuffs_base__io_buffer* dst,
 char*  //
 hex_dump(char* msg, wuffs_base__io_buffer* buf, size_t i) {
   if (!msg || !buf) {
-    RETURN_FAIL("hex_dump: NULL argument");
+    return msg;
   }
   if (buf->meta.wi == 0) {
     return msg;
@@ -1064,6 +1291,263 @@ do_test__wuffs_base__image_decoder(
   return NULL;
 }
 
+// do_test__wuffs_base__image_decoder_scaled decodes the first frame of
+// src_filename twice: by the full decoder, and then by the scaled decoder with
+// the given decode_frame_options (e.g. a scale_shift or crop_rect), reading at
+// most rlimit bytes at a time. Both decoders should be freshly initialized and
+// of the same type. It checks that the scaled pixels and frame_dirty_rect are
+// a (cropped) nearest neighbor sampling of the full ones.
+const char*  //
+do_test__wuffs_base__image_decoder_scaled(
+    wuffs_base__image_decoder* full,
+    wuffs_base__image_decoder* scaled,
+    const char* src_filename,
+    wuffs_base__decode_frame_options* opts,
+    uint64_t rlimit) {
+  wuffs_base__image_config ic = ((wuffs_base__image_config){});
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, src_filename));
+  CHECK_STATUS("decode_image_config (full)",
+               wuffs_base__image_decoder__decode_image_config(full, &ic, &src));
+  uint32_t width = wuffs_base__pixel_config__width(&ic.pixcfg);
+  uint32_t height = wuffs_base__pixel_config__height(&ic.pixcfg);
+  if ((width > 16384) || (height > 16384) ||
+      ((width * height * 4) > PIXEL_BUFFER_ARRAY_SIZE) ||
+      ((width * height * 4) > IO_BUFFER_ARRAY_SIZE)) {
+    return "dimensions are too large";
+  }
+  wuffs_base__pixel_config__set(
+      &ic.pixcfg, WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+      WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, width, height);
+  memset(g_pixel_array_u8, 0, width * height * 4);
+  wuffs_base__pixel_buffer full_pb = ((wuffs_base__pixel_buffer){});
+  CHECK_STATUS("set_from_slice (full)",
+               wuffs_base__pixel_buffer__set_from_slice(&full_pb, &ic.pixcfg,
+                                                        g_pixel_slice_u8));
+  CHECK_STATUS("decode_frame (full)",
+               wuffs_base__image_decoder__decode_frame(
+                   full, &full_pb, &src, WUFFS_BASE__PIXEL_BLEND__SRC,
+                   g_work_slice_u8, NULL));
+
+  uint32_t scale_shift = wuffs_base__decode_frame_options__scale_shift(opts);
+  wuffs_base__rect_ie_u32 crop =
+      wuffs_base__decode_frame_options__crop_rect(opts);
+  if (wuffs_base__rect_ie_u32__is_empty(&crop)) {
+    crop = make_rect_ie_u32(0, 0, width, height);
+  }
+  wuffs_base__rect_ie_u32 scaled_bounds =
+      wuffs_base__decode_frame_options__dst_rect(
+          opts, make_rect_ie_u32(0, 0, width, height));
+  uint32_t scaled_width = scaled_bounds.max_excl_x;
+  uint32_t scaled_height = scaled_bounds.max_excl_y;
+
+  src.meta.ri = 0;
+  CHECK_STATUS(
+      "decode_image_config (scaled)",
+      wuffs_base__image_decoder__decode_image_config(scaled, &ic, &src));
+  wuffs_base__pixel_config__set(
+      &ic.pixcfg, WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+      WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, scaled_width, scaled_height);
+  memset(g_have_array_u8, 0, scaled_width * scaled_height * 4);
+  wuffs_base__pixel_buffer scaled_pb = ((wuffs_base__pixel_buffer){});
+  CHECK_STATUS("set_from_slice (scaled)",
+               wuffs_base__pixel_buffer__set_from_slice(&scaled_pb, &ic.pixcfg,
+                                                        g_have_slice_u8));
+  while (true) {
+    wuffs_base__io_buffer limited_src = make_limited_reader(src, rlimit);
+    size_t old_ri = src.meta.ri;
+    wuffs_base__status status = wuffs_base__image_decoder__decode_frame(
+        scaled, &scaled_pb, &limited_src, WUFFS_BASE__PIXEL_BLEND__SRC,
+        g_work_slice_u8, opts);
+    src.meta.ri += limited_src.meta.ri;
+    if (wuffs_base__status__is_ok(&status)) {
+      break;
+    } else if (status.repr != wuffs_base__suspension__short_read) {
+      RETURN_FAIL("decode_frame (scaled): have \"%s\", want \"%s\"",
+                  status.repr, wuffs_base__suspension__short_read);
+    } else if (src.meta.ri == old_ri) {
+      RETURN_FAIL("decode_frame (scaled): no progress was made");
+    }
+  }
+
+  wuffs_base__rect_ie_u32 want_dirty =
+      wuffs_base__decode_frame_options__dst_rect(
+          opts, wuffs_base__image_decoder__frame_dirty_rect(full));
+  wuffs_base__rect_ie_u32 have_dirty =
+      wuffs_base__image_decoder__frame_dirty_rect(scaled);
+  if (!wuffs_base__rect_ie_u32__equals(&have_dirty, want_dirty)) {
+    RETURN_FAIL("frame_dirty_rect: have (%" PRIu32 ", %" PRIu32 ")-(%" PRIu32
+                ", %" PRIu32 "), want (%" PRIu32 ", %" PRIu32 ")-(%" PRIu32
+                ", %" PRIu32 ")",
+                have_dirty.min_incl_x, have_dirty.min_incl_y,
+                have_dirty.max_excl_x, have_dirty.max_excl_y,
+                want_dirty.min_incl_x, want_dirty.min_incl_y,
+                want_dirty.max_excl_x, want_dirty.max_excl_y);
+  }
+
+  uint32_t y;
+  for (y = 0; y < scaled_height; y++) {
+    uint32_t x;
+    for (x = 0; x < scaled_width; x++) {
+      wuffs_base__color_u32_argb_premul have =
+          wuffs_base__pixel_buffer__color_u32_at(&scaled_pb, x, y);
+      wuffs_base__color_u32_argb_premul want =
+          wuffs_base__pixel_buffer__color_u32_at(
+              &full_pb, crop.min_incl_x + (x << scale_shift),
+              crop.min_incl_y + (y << scale_shift));
+      if (have != want) {
+        RETURN_FAIL("pixel at (%" PRIu32 ", %" PRIu32 "): have 0x%08" PRIX32
+                    ", want 0x%08" PRIX32,
+                    x, y, have, want);
+      }
+    }
+  }
+  return NULL;
+}
+
+// do_test__wuffs_base__image_decoder_banded decodes the first frame of
+// src_filename twice: by the full decoder, with the given decode_frame_options
+// other than the band_height, and then by the banded decoder, with the given
+// decode_frame_options (whose band_height should be non-zero) and a pixel
+// buffer only band_height rows tall, reading at most rlimit bytes at a time.
+// Both decoders should be freshly initialized and of the same type. It checks
+// that the bands, each reported by a "$short write" or by the final OK, cover
+// the dst_rect exactly once, in order, and match the full decoder's pixels.
+const char*  //
+do_test__wuffs_base__image_decoder_banded(
+    wuffs_base__image_decoder* full,
+    wuffs_base__image_decoder* banded,
+    const char* src_filename,
+    wuffs_base__decode_frame_options* opts,
+    uint64_t rlimit) {
+  uint32_t band_height = wuffs_base__decode_frame_options__band_height(opts);
+  if (band_height == 0) {
+    return "band_height is zero";
+  }
+  wuffs_base__decode_frame_options full_opts = *opts;
+  wuffs_base__decode_frame_options__set_band_height(&full_opts, 0);
+
+  wuffs_base__image_config ic = ((wuffs_base__image_config){});
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, src_filename));
+  CHECK_STATUS("decode_image_config (full)",
+               wuffs_base__image_decoder__decode_image_config(full, &ic, &src));
+  uint32_t width = wuffs_base__pixel_config__width(&ic.pixcfg);
+  uint32_t height = wuffs_base__pixel_config__height(&ic.pixcfg);
+  if ((width > 16384) || (height > 16384) ||
+      ((width * height * 4) > PIXEL_BUFFER_ARRAY_SIZE) ||
+      ((width * height * 4) > IO_BUFFER_ARRAY_SIZE)) {
+    return "dimensions are too large";
+  }
+  wuffs_base__rect_ie_u32 dst_rect = wuffs_base__decode_frame_options__dst_rect(
+      opts, make_rect_ie_u32(0, 0, width, height));
+  uint32_t dst_width = dst_rect.max_excl_x;
+  uint32_t dst_height = dst_rect.max_excl_y;
+  uint32_t buffer_height = wuffs_base__u32__min(band_height, dst_height);
+
+  wuffs_base__pixel_config__set(
+      &ic.pixcfg, WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+      WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, dst_width, dst_height);
+  memset(g_pixel_array_u8, 0, dst_width * dst_height * 4);
+  wuffs_base__pixel_buffer full_pb = ((wuffs_base__pixel_buffer){});
+  CHECK_STATUS("set_from_slice (full)",
+               wuffs_base__pixel_buffer__set_from_slice(&full_pb, &ic.pixcfg,
+                                                        g_pixel_slice_u8));
+  CHECK_STATUS("decode_frame (full)",
+               wuffs_base__image_decoder__decode_frame(
+                   full, &full_pb, &src, WUFFS_BASE__PIXEL_BLEND__SRC,
+                   g_work_slice_u8, &full_opts));
+
+  src.meta.ri = 0;
+  CHECK_STATUS(
+      "decode_image_config (banded)",
+      wuffs_base__image_decoder__decode_image_config(banded, &ic, &src));
+  wuffs_base__pixel_config__set(
+      &ic.pixcfg, WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+      WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, dst_width, buffer_height);
+  wuffs_base__pixel_buffer banded_pb = ((wuffs_base__pixel_buffer){});
+  CHECK_STATUS("set_from_slice (banded)",
+               wuffs_base__pixel_buffer__set_from_slice(&banded_pb, &ic.pixcfg,
+                                                        g_have_slice_u8));
+
+  uint32_t num_rows = 0;
+  wuffs_base__rect_ie_u32 prev_band = wuffs_base__empty_rect_ie_u32();
+  memset(g_have_array_u8, 0, dst_width * buffer_height * 4);
+  while (true) {
+    wuffs_base__io_buffer limited_src = make_limited_reader(src, rlimit);
+    size_t old_ri = src.meta.ri;
+    wuffs_base__status status = wuffs_base__image_decoder__decode_frame(
+        banded, &banded_pb, &limited_src, WUFFS_BASE__PIXEL_BLEND__SRC,
+        g_work_slice_u8, opts);
+    src.meta.ri += limited_src.meta.ri;
+    if (status.repr == wuffs_base__suspension__short_read) {
+      if (src.meta.ri == old_ri) {
+        RETURN_FAIL("decode_frame (banded): no progress was made");
+      }
+      continue;
+    } else if (!wuffs_base__status__is_ok(&status) &&
+               (status.repr != wuffs_base__suspension__short_write)) {
+      RETURN_FAIL("decode_frame (banded): have \"%s\", want \"%s\"",
+                  status.repr, wuffs_base__suspension__short_write);
+    }
+
+    wuffs_base__rect_ie_u32 band =
+        wuffs_base__image_decoder__frame_dirty_rect(banded);
+    if ((band.min_incl_x != 0) || (band.max_excl_x != dst_width) ||
+        (band.min_incl_y >= band.max_excl_y) ||
+        ((band.max_excl_y - band.min_incl_y) > band_height) ||
+        ((band.min_incl_y % band_height) != 0) ||
+        (band.max_excl_y > dst_height) ||
+        (!wuffs_base__rect_ie_u32__is_empty(&prev_band) &&
+         (band.min_incl_y != prev_band.max_excl_y) &&
+         (band.max_excl_y != prev_band.min_incl_y))) {
+      if ((dst_width == 0) || (dst_height == 0)) {
+        // No bands are expected, other than the final empty one.
+      } else {
+        RETURN_FAIL("band %" PRIu32 " rows: bad rect (%" PRIu32 ", %" PRIu32
+                    ")-(%" PRIu32 ", %" PRIu32 ")",
+                    num_rows, band.min_incl_x, band.min_incl_y, band.max_excl_x,
+                    band.max_excl_y);
+      }
+    } else {
+      num_rows += band.max_excl_y - band.min_incl_y;
+      prev_band = band;
+
+      uint32_t y;
+      for (y = band.min_incl_y; y < band.max_excl_y; y++) {
+        uint32_t x;
+        for (x = 0; x < dst_width; x++) {
+          wuffs_base__color_u32_argb_premul have =
+              wuffs_base__pixel_buffer__color_u32_at(&banded_pb, x,
+                                                     y - band.min_incl_y);
+          wuffs_base__color_u32_argb_premul want =
+              wuffs_base__pixel_buffer__color_u32_at(&full_pb, x, y);
+          if (have != want) {
+            RETURN_FAIL("pixel at (%" PRIu32 ", %" PRIu32 "): have 0x%08" PRIX32
+                        ", want 0x%08" PRIX32,
+                        x, y, have, want);
+          }
+        }
+      }
+      memset(g_have_array_u8, 0, dst_width * buffer_height * 4);
+    }
+
+    if (wuffs_base__status__is_ok(&status)) {
+      break;
+    }
+  }
+
+  if ((dst_width > 0) && (num_rows != dst_height)) {
+    RETURN_FAIL("bands: have %" PRIu32 " rows, want %" PRIu32, num_rows,
+                dst_height);
+  }
+  return NULL;
+}
+
 const char*  //
 do_test__wuffs_base__io_transformer(wuffs_base__io_transformer* b,
                                     const char* src_filename,